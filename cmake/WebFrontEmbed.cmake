@@ -0,0 +1,206 @@
+# ==============================================================================
+# webfront_embed_assets(<target> <directory> [CLASS <name>] [NAMESPACE <namespace>] [ENCODING br|gzip|identity])
+#
+# Embeds every file of <directory> in <target> as a webfront::fs::EmbeddedFS provider named <namespace>::<name>
+# (default webfront::fs::<DirectoryName>FS), declared in the generated header <name>.hpp.
+# Each file is precompressed at build time with brotli and gzip (when the tools are found and the result is smaller).
+# The variant served is ENCODING (default gzip) with a fallback on the identity one.
+# The data is linked from a binary blob (#embed, .incbin or a generated array), not parsed from a header.
+#
+#   webfront_embed_assets(MyApp ${CMAKE_CURRENT_SOURCE_DIR}/frontend/dist CLASS FrontendFS)
+#   using WebFront = webfront::BasicWF<webfront::NetProvider, webfront::fs::FrontendFS>;
+# ==============================================================================
+
+if(NOT CMAKE_SCRIPT_MODE_FILE)
+set(WEBFRONT_EMBED_SCRIPT ${CMAKE_CURRENT_LIST_FILE})
+
+function(webfront_embed_assets TARGET DIRECTORY)
+  cmake_parse_arguments(EMBED "" "CLASS;NAMESPACE;ENCODING" "" ${ARGN})
+  get_filename_component(DIRECTORY ${DIRECTORY} ABSOLUTE)
+  if(NOT EMBED_CLASS)
+    get_filename_component(directoryName ${DIRECTORY} NAME)
+    string(MAKE_C_IDENTIFIER ${directoryName} directoryName)
+    set(EMBED_CLASS ${directoryName}FS)
+  endif()
+  if(NOT EMBED_NAMESPACE)
+    set(EMBED_NAMESPACE webfront::fs)
+  endif()
+  if(NOT EMBED_ENCODING)
+    set(EMBED_ENCODING gzip)
+  endif()
+
+  find_program(WEBFRONT_BROTLI brotli)
+  find_program(WEBFRONT_GZIP gzip)
+  if(NOT WEBFRONT_BROTLI)
+    message(STATUS "webfront_embed_assets: brotli not found, ${EMBED_CLASS} has no br variants")
+  endif()
+  if(NOT WEBFRONT_GZIP)
+    message(STATUS "webfront_embed_assets: gzip not found, ${EMBED_CLASS} has no gzip variants")
+  endif()
+
+  # GCC and Clang link the blob with #embed or .incbin, other compilers compile it from a generated array
+  set(arrayFallback ON)
+  if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+    set(arrayFallback OFF)
+  endif()
+
+  set(outputDir ${CMAKE_CURRENT_BINARY_DIR}/webfront_assets)
+  set(outputs ${outputDir}/${EMBED_CLASS}.hpp ${outputDir}/${EMBED_CLASS}.cpp ${outputDir}/${EMBED_CLASS}.bin)
+  file(GLOB_RECURSE assets CONFIGURE_DEPENDS ${DIRECTORY}/*)
+  add_custom_command(
+    OUTPUT ${outputs}
+    COMMAND ${CMAKE_COMMAND} -DASSETS_DIRECTORY=${DIRECTORY} -DOUTPUT_DIRECTORY=${outputDir} -DCLASS=${EMBED_CLASS}
+            -DNAMESPACE=${EMBED_NAMESPACE} -DENCODING=${EMBED_ENCODING} -DBROTLI=${WEBFRONT_BROTLI} -DGZIP=${WEBFRONT_GZIP}
+            -DARRAY_FALLBACK=${arrayFallback} -P ${WEBFRONT_EMBED_SCRIPT}
+    DEPENDS ${assets} ${WEBFRONT_EMBED_SCRIPT}
+    COMMENT "Embedding ${DIRECTORY} in ${EMBED_NAMESPACE}::${EMBED_CLASS}"
+    VERBATIM)
+
+  target_sources(${TARGET} PRIVATE ${outputDir}/${EMBED_CLASS}.hpp ${outputDir}/${EMBED_CLASS}.cpp)
+  # #embed and .incbin are not seen by the dependency scanners : the object depends on the blob explicitly
+  set_source_files_properties(${outputDir}/${EMBED_CLASS}.cpp PROPERTIES OBJECT_DEPENDS ${outputDir}/${EMBED_CLASS}.bin)
+  target_include_directories(${TARGET} PRIVATE ${outputDir})
+endfunction()
+
+return()
+endif()
+
+# ==============================================================================
+# Script mode : generation of <CLASS>.bin, <CLASS>.hpp and <CLASS>.cpp in OUTPUT_DIRECTORY
+# ==============================================================================
+
+# Escapes text for a C++ string literal (or an assembler one)
+function(webfront_escape_literal output text)
+  string(REPLACE "\\" "\\\\" text "${text}")
+  string(REPLACE "\"" "\\\"" text "${text}")
+  string(REPLACE "\n" "\\n" text "${text}")
+  set(${output} "${text}" PARENT_SCOPE)
+endfunction()
+
+set(blob ${OUTPUT_DIRECTORY}/${CLASS}.bin)
+set(workDirectory ${OUTPUT_DIRECTORY}/${CLASS}.variants)
+set(symbol webfront_assets_${CLASS})
+file(REMOVE_RECURSE ${workDirectory})
+file(MAKE_DIRECTORY ${workDirectory})
+
+if(ENCODING STREQUAL "identity")
+  set(ENCODING "")
+endif()
+
+# Variants of every file, sorted by path then encoding as required by EmbeddedFS ("" < "br" < "gzip")
+file(GLOB_RECURSE files RELATIVE ${ASSETS_DIRECTORY} LIST_DIRECTORIES false ${ASSETS_DIRECTORY}/*)
+list(SORT files)
+set(variants)
+set(table)
+set(offset 0)
+set(index 0)
+foreach(file IN LISTS files)
+  set(source ${ASSETS_DIRECTORY}/${file})
+  file(SIZE ${source} identitySize)
+  file(SHA1 ${source} hash)
+  string(SUBSTRING ${hash} 0 16 etag)
+  webfront_escape_literal(path "${file}")
+  list(APPEND variants ${source})
+  string(APPEND table "          webfront::fs::EmbeddedAsset{\"${path}\", \"\", ${offset}, ${identitySize}, \"\\\"${etag}\\\"\"},\n")
+  math(EXPR offset "${offset} + ${identitySize}")
+
+  foreach(encoding IN ITEMS br gzip)
+    if(encoding STREQUAL "br")
+      set(tool ${BROTLI})
+      set(arguments --best --stdout --no-copy-stat)
+    else()
+      set(tool ${GZIP})
+      set(arguments -9 --no-name --stdout)
+    endif()
+    if(NOT tool)
+      continue()
+    endif()
+    set(variant ${workDirectory}/${index}.${encoding})
+    execute_process(COMMAND ${tool} ${arguments} ${source} OUTPUT_FILE ${variant} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "webfront_embed_assets: ${tool} failed on ${source}")
+    endif()
+    file(SIZE ${variant} variantSize)
+    if(variantSize LESS identitySize)
+      file(SHA1 ${variant} hash)
+      string(SUBSTRING ${hash} 0 16 etag)
+      list(APPEND variants ${variant})
+      string(APPEND table "          webfront::fs::EmbeddedAsset{\"${path}\", \"${encoding}\", ${offset}, ${variantSize}, \"\\\"${etag}\\\"\"},\n")
+      math(EXPR offset "${offset} + ${variantSize}")
+    endif()
+  endforeach()
+  math(EXPR index "${index} + 1")
+endforeach()
+list(LENGTH variants variantsCount)
+
+# cmake -E cat copies the bytes unchanged : file(WRITE) cannot write binary data
+if(variantsCount GREATER 0)
+  execute_process(COMMAND ${CMAKE_COMMAND} -E cat ${variants} OUTPUT_FILE ${blob} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "webfront_embed_assets: cannot write ${blob}")
+  endif()
+else()
+  file(WRITE ${blob} "")
+endif()
+file(REMOVE_RECURSE ${workDirectory})
+
+file(WRITE ${OUTPUT_DIRECTORY}/${CLASS}.hpp
+"/// Generated by webfront_embed_assets() from ${ASSETS_DIRECTORY} : do not edit
+#pragma once
+
+#include <system/EmbeddedFS.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+extern \"C\" const unsigned char ${symbol}[];
+
+namespace ${NAMESPACE} {
+
+struct ${CLASS}Assets {
+    static constexpr std::string_view encoding{\"${ENCODING}\"};
+    static constexpr size_t blobSize{${offset}};
+    static constexpr std::array<webfront::fs::EmbeddedAsset, ${variantsCount}> assets{
+${table}    };
+
+    static std::span<const std::byte> blob() { return {reinterpret_cast<const std::byte*>(${symbol}), blobSize}; }
+};
+
+using ${CLASS} = webfront::fs::EmbeddedFS<${CLASS}Assets>;
+
+} // namespace ${NAMESPACE}
+")
+
+# .incbin takes the path of the blob in an assembler string, itself within a string literal (#embed takes it as is, as #include)
+webfront_escape_literal(blobAssembler "${blob}")
+webfront_escape_literal(blobAssembler "${blobAssembler}")
+
+if(ARRAY_FALLBACK)
+  file(READ ${blob} hex HEX)
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+  string(REGEX REPLACE "((0x[0-9a-f][0-9a-f],){32})" "\\1\n" bytes "${bytes}")
+  set(definition "alignas(16) const unsigned char ${symbol}[] = {\n${bytes}0};")
+else()
+  set(definition
+"#if defined(__has_embed)
+alignas(16) const unsigned char ${symbol}[] = {
+#embed \"${blob}\" suffix(,)
+0};
+#elif defined(__APPLE__)
+__asm__(\".const_data\\n.balign 16\\n.globl _${symbol}\\n_${symbol}:\\n.incbin \\\"${blobAssembler}\\\"\\n.byte 0\\n.text\\n\");
+#else
+__asm__(\".section .rodata.${symbol},\\\"a\\\"\\n.balign 16\\n.globl ${symbol}\\n${symbol}:\\n.incbin \\\"${blobAssembler}\\\"\\n.byte 0\\n.previous\\n\");
+#endif")
+endif()
+
+file(WRITE ${OUTPUT_DIRECTORY}/${CLASS}.cpp
+"// Generated by webfront_embed_assets() from ${ASSETS_DIRECTORY} : do not edit
+#include \"${CLASS}.hpp\"
+
+extern \"C\" {
+${definition}
+}
+")
+
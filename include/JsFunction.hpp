@@ -8,7 +8,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
 #include <string_view>
+#include <vector>
 
 #include <iostream>
 
@@ -26,7 +30,18 @@ class JsFunction {
         command.encodeParameter(name, frame);
         (((command.encodeParameter(std::forward<decltype(ts)>(ts), frame))), ...);
         
-        webFront.getLink(webLinkId).sendFrame(std::move(frame));
+        // The frame refers to the parameters : its data is copied, to be sent from the strand of the link (later from another thread)
+        std::vector<std::byte> data;
+        auto buffers = frame.toBuffers();
+        for (auto buffer : std::span(buffers).subspan(1)) {
+            auto bytes = static_cast<const std::byte*>(buffer.data());
+            data.insert(data.end(), bytes, bytes + buffer.size());
+        }
+        auto sent = webFront.withLink(webLinkId, [headerSize = command.header().size(), data = std::move(data)](auto& link) {
+            auto message = std::span<const std::byte>(data);
+            link.sendFrame(websocket::Frame<typename WebFront::Net>{message.first(headerSize), message.subspan(headerSize)});
+        });
+        if (!sent) throw std::out_of_range("JsFunction called on a closed WebLink");
     }
 
 private:
@@ -16,7 +16,9 @@
 #include <cstdlib>
 #include <filesystem>
 #include <functional>
+#include <limits>
 #include <map>
+#include <mutex>
 #include <span>
 #include <string>
 #include <string_view>
@@ -25,6 +27,7 @@
 #include <stdexcept>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace webfront {
 
@@ -47,11 +50,11 @@ class BasicUI {
      * @param script
      */
     void addScript(std::string_view script) const {
-        try {
-            webFront.getLink(webLinkId).sendCommand(msg::TextCommand(msg::TxtOpcode::injectScript, script));
-        } catch (const std::out_of_range&) {
-            throw ConnectionError("Connection with client lost");
-        }
+        // The script is copied : it is sent from the strand of the link, later if called from another thread
+        auto sent = webFront.withLink(webLinkId, [command = std::string(script)](WebLink<typename WebFront::Net>& link) {
+            link.sendCommand(msg::TextCommand(msg::TxtOpcode::injectScript, command));
+        });
+        if (!sent) throw ConnectionError("Connection with client lost");
     }
 
     /**
@@ -93,14 +96,26 @@ class BasicWF {
     using Net = NetProvider;
     using UI  = BasicUI<BasicWF<Net, Filesystem>>;
 
-    explicit BasicWF(std::string_view port, std::filesystem::path docRoot = ".")
-        : httpServer((detail::ensureCEFInitialized(), "0.0.0.0"), port, docRoot), httpPort(port), httpDocRoot(docRoot), idsCounter(0) {
-        httpServer.onUpgrade([this](typename Net::Socket&& socket, http::Protocol protocol) {
-            if (protocol == http::Protocol::WebSocket)
-                for (bool inserted = false; !inserted; ++idsCounter)
-                    std::tie(std::ignore, inserted) = webLinks.try_emplace(idsCounter, std::move(socket), idsCounter, [this](WebLinkEvent event) {
-                        onEvent(event);
-                    });
+    /// @param options options.shardsCount selects the shared-nothing mode : the links are then sharded as the connections, each one being
+    /// owned by the shard which accepted it
+    explicit BasicWF(std::string_view port, std::filesystem::path docRoot = ".", http::ServerOptions options = {})
+        : httpServer((detail::ensureCEFInitialized(), "0.0.0.0"), port, docRoot, options), httpPort(port), httpDocRoot(docRoot),
+          linkShards(httpServer.shardsCount()) {
+        auto limits = websocket::Limits{&httpServer.memory(), options.webSocketMemoryMax, options.webSocketMessageSizeMax};
+        auto profile = options.webSocketProfile;
+        httpServer.onUpgrade([this, pingInterval = options.webSocketPingInterval, limits, profile](typename Net::Socket&& socket, http::Protocol protocol) {
+            if (protocol != http::Protocol::WebSocket) return;
+            auto shardIndex = httpServer.currentShard().value_or(0);
+            auto& shard = linkShards[shardIndex];
+            std::scoped_lock lock(shard.mutex);
+            // The id of a link tells its shard : shardIndex modulo the count of shards
+            auto idsPerShard = (size_t{std::numeric_limits<WebLinkId>::max()} + 1) / linkShards.size();
+            for (bool inserted = false; !inserted;) {
+                auto id = static_cast<WebLinkId>(shardIndex + linkShards.size() * (shard.idsCounter++ % idsPerShard));
+                std::tie(std::ignore, inserted) = shard.links.try_emplace(id, std::move(socket), id, [this](WebLinkEvent event) {
+                    onEvent(event);
+                }, &httpServer.timeouts(), pingInterval, limits, profile);
+            }
         });
     }
 
@@ -122,13 +137,58 @@ class BasicWF {
         httpServer.stop();
     }
 
+    /// Serves the requests of method on pattern (e.g. "/api/items/{id}") with handler instead of the files. Called before run().
+    void route(http::Request::Method method, std::string_view pattern, http::RouteHandler handler) { httpServer.route(method, pattern, std::move(handler)); }
+    /// Serves the requests of method on pattern with the consumer of their body returned by handler, e.g. http::uploadTo(file).
+    void route(http::Request::Method method, std::string_view pattern, http::BodyRouteHandler handler) {
+        httpServer.route(method, pattern, std::move(handler));
+    }
+
+    /// @return the memory held by the connections and the links, bounded by ServerOptions::memoryBudget : the usage of each link is
+    /// given by getLink(id).memory()
+    [[nodiscard]] const utils::MemoryBudget& memory() const { return httpServer.memory(); }
+
     void onUIStarted(std::function<void(UI)>&& handler) {
         uiStartedHandler = std::move(handler);
     }
+    /// @return the link of id, to be used from its strand only (e.g. from the UI and C++ functions handlers, called by it) : the link is closed
+    /// and erased from its strand, the other threads reach it by withLink()
+    /// @throw std::out_of_range if the link is closed
     WebLink<Net>& getLink(WebLinkId id) {
-        return webLinks.at(id);
+        auto& shard = linkShards[id % linkShards.size()];
+        std::scoped_lock lock(shard.mutex);
+        return shard.links.at(id);
+    }
+
+    /// Runs task with the link id on its strand, from which it is closed and erased : at once from it, later from the other threads (and
+    /// shards). Can be called from any thread.
+    /// @return false if the link is closed. The task is dropped as well if the link is closed before running it.
+    bool withLink(WebLinkId id, std::function<void(WebLink<Net>&)> task) {
+        auto& shard = linkShards[id % linkShards.size()];
+        std::unique_lock lock(shard.mutex);
+        auto found = shard.links.find(id);
+        if (found == shard.links.end()) return false;
+        auto run = found->second.runner();
+        lock.unlock(); // task may run at once, reaching the links of the shard
+        run([&link = found->second, task = std::move(task)] { task(link); });
+        return true;
     }
 
+    /// Runs task with each link, on its strand
+    void broadcast(std::function<void(WebLink<Net>&)> task) {
+        for (auto& shard : linkShards) {
+            std::vector<WebLinkId> ids;
+            {
+                std::scoped_lock lock(shard.mutex);
+                for (auto& [id, link] : shard.links) ids.push_back(id);
+            }
+            for (auto id : ids) withLink(id, task);
+        }
+    }
+
+    /// @return the port the server is listening to (useful when it has been bound to port "0")
+    [[nodiscard]] uint16_t port() const { return httpServer.port(); }
+
     /**
      * @brief Registers a function which will be callable from Javascript.
      *
@@ -179,11 +239,17 @@ class BasicWF {
     }
 
 private:
+    // Links owned by a shard of the server, created by its thread (by any io thread in the shared io_context mode) and erased from their strand
+    struct LinkShard {
+        std::map<WebLinkId, WebLink<Net>> links;
+        std::mutex                        mutex;  // Uncontended but by the other threads using withLink()
+        size_t                            idsCounter{0};
+    };
+
     http::Server<Net, Filesystem>                                          httpServer;
     std::string_view                                                       httpPort;
     std::filesystem::path                                                  httpDocRoot;
-    std::map<WebLinkId, WebLink<Net>>                                      webLinks;
-    WebLinkId                                                              idsCounter{0};
+    std::vector<LinkShard>                                                 linkShards;
     std::function<void(UI)>                                                uiStartedHandler;
     std::map<std::string, std::function<void(std::span<const std::byte>)>> cppFunctions;
     std::thread                                                            serverThread;  // Background thread running the HTTP server
@@ -194,9 +260,11 @@ class BasicWF {
             case WebLinkEvent::Code::linked:
                 uiStartedHandler(UI{*this, event.webLinkId});
                 break;
-            case WebLinkEvent::Code::closed:
-                webLinks.erase(event.webLinkId);
-                break;
+            case WebLinkEvent::Code::closed: { // Called once by a handler of the link's own : it may be destroyed, releasing its memory
+                auto& shard = linkShards[event.webLinkId % linkShards.size()];
+                std::scoped_lock lock(shard.mutex);
+                shard.links.erase(event.webLinkId);
+            } break;
             case WebLinkEvent::Code::cppFunctionCalled:
                 cppFunctions.at(event.text)(event.data);
                 break;
@@ -0,0 +1,141 @@
+/// @date 21/10/2026 11:02:17
+/// @author Ambroise Leclerc
+/// @brief Admission control of the HTTP server : limits of the connections and requests at once, and of the connection rate of each client
+#pragma once
+#include "../utils/TokenBucket.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace webfront::http {
+
+/// Counts the connections and the requests being served by all the threads of a Server, handing out a Ticket to each one admitted below
+/// its limit. The excess load is shed before any work is done for it : the caller answers 503 Service Unavailable. Thread-safe.
+class Admission {
+public:
+    /// Slot of an admitted connection or request, freed when the ticket is destroyed or released. An empty ticket denotes a refusal.
+    class Ticket {
+    public:
+        Ticket() = default;
+        ~Ticket() { release(); }
+        Ticket(const Ticket&) = delete;
+        Ticket(Ticket&& other) noexcept : count(std::exchange(other.count, nullptr)) {}
+        Ticket& operator=(const Ticket&) = delete;
+        Ticket& operator=(Ticket&& other) noexcept {
+            if (this != &other) {
+                release();
+                count = std::exchange(other.count, nullptr);
+            }
+            return *this;
+        }
+
+        explicit operator bool() const { return count != nullptr; }
+
+        void release() {
+            if (count) count->fetch_sub(1, std::memory_order_relaxed);
+            count = nullptr;
+        }
+
+    private:
+        friend class Admission;
+        explicit Ticket(std::atomic<size_t>& counter) : count(&counter) {}
+        std::atomic<size_t>* count{nullptr};
+    };
+
+    /// @param connectionsMaximum connections at once, 0 for no limit
+    /// @param requestsMaximum requests at once, 0 for no limit
+    Admission(size_t connectionsMaximum, size_t requestsMaximum) : connectionsMax(connectionsMaximum), requestsMax(requestsMaximum) {}
+    ~Admission() = default;
+    Admission(const Admission&) = delete;
+    Admission(Admission&&) = delete;
+    Admission& operator=(const Admission&) = delete;
+    Admission& operator=(Admission&&) = delete;
+
+    /// @return the ticket of an accepted connection, empty if connectionsMax connections are already open
+    [[nodiscard]] Ticket enterConnection() { return enter(connectionsCount, connectionsMax); }
+
+    /// @return the ticket of a request whose header has been received, held until its response is sent : empty if requestsMax requests
+    /// are already being answered
+    [[nodiscard]] Ticket enterRequest() { return enter(requestsCount, requestsMax); }
+
+    /// @return the count of connections holding a ticket
+    [[nodiscard]] size_t connections() const { return connectionsCount.load(std::memory_order_relaxed); }
+    /// @return the count of requests being answered
+    [[nodiscard]] size_t requestsInFlight() const { return requestsCount.load(std::memory_order_relaxed); }
+
+private:
+    size_t connectionsMax, requestsMax;
+    std::atomic<size_t> connectionsCount{0}, requestsCount{0};
+
+    static Ticket enter(std::atomic<size_t>& count, size_t maximum) {
+        if (count.fetch_add(1, std::memory_order_relaxed) >= maximum && maximum != 0) {
+            count.fetch_sub(1, std::memory_order_relaxed);
+            return {};
+        }
+        return Ticket{count};
+    }
+};
+
+/// Connection rates of the clients of a shard, by IP address : each one draws its connections from a TokenBucket. The buckets are held by
+/// a table of fixed size, so that a storm of clients costs no memory : a client is looked up among 4 neighbouring slots, and a client
+/// not found replaces the least recently seen of them, its bucket starting full. Not thread-safe : each shard has its own.
+class ClientRates {
+public:
+    /// IPv6 address, or IPv4 address followed by zeros, and the IP version in its last byte
+    using Address = std::array<uint8_t, 17>;
+
+    /// @param rate connections per second of a client in the long run, 0 for no limit
+    /// @param burst connections of a client admitted at once
+    /// @param slotsCount clients tracked at once (rounded up to a power of 2)
+    ClientRates(double rate, double burst, size_t slotsCount = 4096) : ratePerSecond(rate), burstSize(burst) {
+        if (rate > 0) slots.resize(std::bit_ceil(std::max<size_t>(slotsCount, ways)));
+    }
+
+    /// @return true if a connection of the client of address is admitted at now
+    bool admit(const Address& address, utils::TokenBucket::Clock::time_point now = utils::TokenBucket::Clock::now()) {
+        if (slots.empty()) return true;
+        auto first = hash(address) & (slots.size() - 1);
+        Slot* oldest = nullptr;
+        for (size_t way = 0; way < ways; ++way) {
+            auto& slot = slots[(first + way) & (slots.size() - 1)];
+            if (slot.bucket && slot.address == address) return slot.bucket->take(now);
+            if (!oldest || !slot.bucket || (oldest->bucket && slot.bucket->lastUse() < oldest->bucket->lastUse())) oldest = &slot;
+        }
+        oldest->address = address;
+        oldest->bucket.emplace(ratePerSecond, burstSize, now);
+        return oldest->bucket->take(now);
+    }
+
+    /// @return the IPv4 address of bytes (4 bytes) or the IPv6 one (16 bytes)
+    [[nodiscard]] static Address toAddress(std::span<const uint8_t> bytes) {
+        Address address{};
+        std::ranges::copy(bytes.first(std::min(bytes.size(), address.size() - 1)), address.begin());
+        address.back() = bytes.size() == 4 ? 4 : 6;
+        return address;
+    }
+
+private:
+    static constexpr size_t ways = 4;
+    struct Slot {
+        Address address{};
+        std::optional<utils::TokenBucket> bucket; // Unused slot if unset
+    };
+    double ratePerSecond, burstSize;
+    std::vector<Slot> slots;
+
+    static size_t hash(const Address& address) { // FNV-1a
+        uint64_t value = 14695981039346656037ull;
+        for (auto byte : address) value = (value ^ byte) * 1099511628211ull;
+        return static_cast<size_t>(value ^ (value >> 32));
+    }
+};
+
+} // namespace webfront::http
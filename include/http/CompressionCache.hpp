@@ -0,0 +1,94 @@
+/// @date 18/10/2026 15:48:13
+/// @author Ambroise Leclerc
+/// @brief Gzip variants of the files served without content coding, compressed by a background thread and kept in a ResponseCache
+#pragma once
+#include "../utils/Deflate.hpp"
+#include "ResponseCache.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+namespace webfront::http {
+
+/// Variants are keyed by the caller, with the entity tag of the compressed file so that a changed file is compressed again.
+/// A request for a variant not compressed yet schedules its compression and is answered without waiting for it.
+class CompressionCache {
+public:
+    /// Loads the content of the file to compress, nullopt if it changed since the compression was scheduled
+    using Loader = std::function<std::optional<std::string>()>;
+
+    static constexpr size_t queueCapacity = 64; // Compressions requested above are dropped, and requested again by the next hits
+
+    explicit CompressionCache(size_t capacityBytes) : variants(capacityBytes) {}
+
+    /// @return the cached gzip variant of key, nullptr if it is not compressed yet. An incompressible file has an empty encoding :
+    /// it is to be sent without content coding.
+    [[nodiscard]] std::shared_ptr<const SerializedResponse> find(const std::string& key) { return variants.find(key); }
+
+    /// Queues the compression of the content returned by load, cached as key with the validators of the identity file.
+    void schedule(std::string key, std::string_view eTag, std::optional<std::chrono::sys_seconds> lastModified, Loader load) {
+        std::scoped_lock lock(mutex);
+        if (queue.size() >= queueCapacity || !queued.insert(key).second) return;
+        queue.push_back({std::move(key), std::string(eTag), lastModified, std::move(load)});
+        if (!worker.joinable()) worker = std::jthread([this](std::stop_token stopToken) { run(stopToken); });
+        wakeUp.notify_one();
+    }
+
+private:
+    struct Job {
+        std::string key, eTag;
+        std::optional<std::chrono::sys_seconds> lastModified;
+        Loader load;
+    };
+
+    ResponseCache variants;
+    std::mutex mutex;
+    std::condition_variable_any wakeUp;
+    std::deque<Job> queue;
+    std::unordered_set<std::string> queued; // Keys of the jobs queued or running
+    std::jthread worker;                    // Declared last : stopped before the queue is destroyed
+
+    void run(std::stop_token stopToken) {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock lock(mutex);
+                if (!wakeUp.wait(lock, stopToken, [this] { return !queue.empty(); })) return;
+                job = std::move(queue.front());
+                queue.pop_front();
+            }
+            compress(job);
+            std::scoped_lock lock(mutex);
+            queued.erase(job.key);
+        }
+    }
+
+    void compress(const Job& job) {
+        auto generation = variants.generation();
+        auto content = job.load();
+        if (!content) return;
+        auto variant = std::make_shared<SerializedResponse>();
+        auto compressed = utils::gzip(std::as_bytes(std::span{*content}));
+        if (compressed.size() + compressed.size() / 8 < content->size()) { // Saves more than 1/9 of the bytes
+            variant->content = std::move(compressed);
+            variant->encoding = "gzip";
+            variant->eTag = job.eTag.empty() ? std::string{} : job.eTag.substr(0, job.eTag.size() - 1) + "-gzip\"";
+        }
+        variant->lastModified = job.lastModified;
+        variants.insert(job.key, std::move(variant), generation);
+    }
+};
+
+} // namespace webfront::http
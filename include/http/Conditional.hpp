@@ -0,0 +1,112 @@
+/// @date 17/10/2026 22:31:06
+/// @author Ambroise Leclerc
+/// @brief Conditional requests : validators of a file, HTTP dates and evaluation of the preconditions - RFC9110 13
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace webfront::http {
+
+/// Validators of a file : strong entity tag (quoted, empty if unknown) and modification date
+struct Validators {
+    std::string_view eTag;
+    std::optional<std::chrono::sys_seconds> lastModified;
+
+    /// If-None-Match (weak comparison, RFC9110 13.1.2), or If-Modified-Since when If-None-Match is absent (13.1.3).
+    /// @return true if the client's copy is still valid : 304 Not Modified is to be sent
+    [[nodiscard]] bool notModified(std::optional<std::string_view> ifNoneMatch, std::optional<std::string_view> ifModifiedSince) const;
+
+    /// If-Range (RFC9110 13.1.5) : an entity tag must strongly match eTag, a date must be exactly lastModified.
+    /// @return true if the Range header field is to be evaluated, false if the whole file is to be sent
+    [[nodiscard]] bool rangeApplies(std::string_view ifRange) const;
+};
+
+/// @return date in the IMF-fixdate format : "Sun, 06 Nov 1994 08:49:37 GMT"
+[[nodiscard]] inline std::string toHTTPDate(std::chrono::sys_seconds date) {
+    using namespace std::chrono;
+    static constexpr std::array<std::string_view, 7> days{"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    static constexpr std::array<std::string_view, 12> months{"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    auto day = floor<std::chrono::days>(date);
+    year_month_day ymd{day};
+    hh_mm_ss time{date - day};
+    auto twoDigits = [](auto value) {
+        auto number = static_cast<unsigned>(value);
+        return std::string{static_cast<char>('0' + number / 10), static_cast<char>('0' + number % 10)};
+    };
+    return std::string(days[weekday{day}.c_encoding()]) + ", " + twoDigits(static_cast<unsigned>(ymd.day())) + ' ' +
+           std::string(months[static_cast<unsigned>(ymd.month()) - 1]) + ' ' + std::to_string(static_cast<int>(ymd.year())) + ' ' +
+           twoDigits(time.hours().count()) + ':' + twoDigits(time.minutes().count()) + ':' + twoDigits(time.seconds().count()) + " GMT";
+}
+
+/// @return the date of an IMF-fixdate, nullopt for an invalid date or one of the obsolete formats (the precondition is then ignored)
+[[nodiscard]] inline std::optional<std::chrono::sys_seconds> parseHTTPDate(std::string_view text) {
+    using namespace std::chrono;
+    static constexpr std::string_view months{"JanFebMarAprMayJunJulAugSepOctNovDec"};
+    // "Sun, 06 Nov 1994 08:49:37 GMT"
+    if (text.size() != 29 || text[3] != ',' || text[4] != ' ' || text[7] != ' ' || text[11] != ' ' || text[16] != ' ' || text[19] != ':' ||
+        text[22] != ':' || text.substr(25) != " GMT")
+        return {};
+    auto number = [&](size_t offset, size_t length) -> std::optional<int> {
+        int value = 0;
+        for (auto c : text.substr(offset, length)) {
+            if (c < '0' || c > '9') return {};
+            value = value * 10 + (c - '0');
+        }
+        return value;
+    };
+    auto monthIndex = months.find(text.substr(8, 3));
+    auto dayOfMonth = number(5, 2), yearNumber = number(12, 4), hours = number(17, 2), minutes = number(20, 2), seconds = number(23, 2);
+    if (monthIndex == std::string_view::npos || monthIndex % 3 != 0 || !dayOfMonth || !yearNumber || !hours || !minutes || !seconds) return {};
+    year_month_day ymd{year{*yearNumber}, month{static_cast<unsigned>(monthIndex / 3 + 1)}, day{static_cast<unsigned>(*dayOfMonth)}};
+    if (!ymd.ok() || *hours > 23 || *minutes > 59 || *seconds > 60) return {};
+    return sys_days{ymd} + std::chrono::hours{*hours} + std::chrono::minutes{*minutes} + std::chrono::seconds{*seconds};
+}
+
+namespace details {
+/// Calls onTag(opaqueTag, isWeak) for each entity-tag of a comma separated list, until it returns true.
+/// @return true if onTag returned true
+template<typename OnTag>
+bool anyEntityTag(std::string_view list, OnTag onTag) {
+    while (!list.empty()) {
+        auto first = list.find_first_not_of(" \t,");
+        if (first == std::string_view::npos) break;
+        list.remove_prefix(first);
+        bool weak = list.starts_with("W/");
+        if (weak) list.remove_prefix(2);
+        if (list.empty() || list.front() != '"') return false; // Malformed list
+        auto closing = list.find('"', 1);
+        if (closing == std::string_view::npos) return false;
+        if (onTag(list.substr(0, closing + 1), weak)) return true;
+        list.remove_prefix(closing + 1);
+    }
+    return false;
+}
+} // namespace details
+
+inline bool Validators::notModified(std::optional<std::string_view> ifNoneMatch, std::optional<std::string_view> ifModifiedSince) const {
+    if (ifNoneMatch) {
+        auto list = ifNoneMatch->substr(std::min(ifNoneMatch->find_first_not_of(" \t"), ifNoneMatch->size()));
+        if (list.starts_with('*')) return true; // Matches any current representation
+        return !eTag.empty() && details::anyEntityTag(list, [&](std::string_view tag, bool /*weak*/) { return tag == eTag; });
+    }
+    if (!ifModifiedSince || !lastModified) return false;
+    auto since = parseHTTPDate(*ifModifiedSince);
+    return since && *lastModified <= *since;
+}
+
+inline bool Validators::rangeApplies(std::string_view ifRange) const {
+    auto first = ifRange.find_first_not_of(" \t");
+    if (first == std::string_view::npos) return false;
+    ifRange.remove_prefix(first);
+    if (ifRange.starts_with('"') || ifRange.starts_with("W/"))
+        return !eTag.empty() && details::anyEntityTag(ifRange, [&](std::string_view tag, bool weak) { return !weak && tag == eTag; });
+    auto date = parseHTTPDate(ifRange);
+    return date && lastModified && *date == *lastModified;
+}
+
+} // namespace webfront::http
@@ -0,0 +1,102 @@
+/// @date 18/10/2026 10:03:27
+/// @author Ambroise Leclerc
+/// @brief Proactive negotiation of the content coding of a response : quality values of the Accept-Encoding field - RFC9110 12.5.3
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace webfront::http {
+
+/// Content codings accepted by a client, with their quality values (RFC9110 12.4.2) in thousandths : 0 means not acceptable.
+/// Without Accept-Encoding field, only the identity coding ("") is selected : clients able to decode send the field.
+class AcceptEncoding {
+public:
+    /// Codings which may be embedded, by server preference on equal quality values : the smallest representations first
+    static constexpr std::array<std::string_view, 3> knownCodings{"br", "gzip", ""};
+
+    explicit AcceptEncoding(std::optional<std::string_view> acceptEncoding) : field(acceptEncoding) {
+        std::array<std::pair<uint16_t, std::string_view>, knownCodings.size()> ranked{};
+        std::ranges::transform(knownCodings, ranked.begin(), [this](std::string_view coding) { return std::pair{quality(coding), coding}; });
+        for (size_t index = 1; index < ranked.size(); ++index) // Stable insertion sort : no temporary buffer, unlike std::stable_sort
+            for (auto position = index; position > 0 && ranked[position - 1].first < ranked[position].first; --position)
+                std::swap(ranked[position - 1], ranked[position]);
+        for (auto& [value, coding] : ranked)
+            if (value > 0) codings[count++] = coding;
+    }
+
+    /// @return the quality value of coding ("" for identity) in thousandths, 0 if it is not acceptable
+    [[nodiscard]] uint16_t quality(std::string_view coding) const {
+        if (!field) return coding.empty() ? 1000 : 0;
+        if (coding.empty()) coding = "identity";
+        std::optional<uint16_t> listed, any;
+        forEachCoding([&](std::string_view name, uint16_t value) {
+            if (equals(name, coding) || (equals(coding, "gzip") && equals(name, "x-gzip"))) listed = value;
+            else if (name == "*") any = value;
+        });
+        if (listed) return *listed;
+        if (any) return *any;
+        return coding == "identity" ? 1000 : 0; // Identity is acceptable unless refused : RFC9110 12.5.3
+    }
+
+    /// @return the acceptable known codings, preferred first
+    [[nodiscard]] std::span<const std::string_view> preferred() const { return std::span{codings}.first(count); }
+
+private:
+    std::optional<std::string_view> field;
+    std::array<std::string_view, knownCodings.size()> codings{};
+    size_t count{0};
+
+    /// Calls onCoding(name, quality) for each element of the field
+    template<typename OnCoding>
+    void forEachCoding(OnCoding onCoding) const {
+        for (auto elements = *field; !elements.empty();) {
+            auto comma = elements.find(',');
+            auto element = elements.substr(0, comma);
+            elements = comma == std::string_view::npos ? std::string_view{} : elements.substr(comma + 1);
+            auto semicolon = element.find(';');
+            auto name = trim(element.substr(0, semicolon));
+            if (name.empty()) continue;
+            uint16_t value = 1000;
+            if (semicolon != std::string_view::npos) {
+                auto parameter = trim(element.substr(semicolon + 1));
+                if (parameter.size() < 2 || (parameter[0] | 0x20) != 'q' || parameter[1] != '=') continue;
+                auto parsed = qvalue(trim(parameter.substr(2)));
+                if (!parsed) continue;
+                value = *parsed;
+            }
+            onCoding(name, value);
+        }
+    }
+
+    /// @return the value of a qvalue ("0", "0.5", "1.000"...) in thousandths
+    [[nodiscard]] static std::optional<uint16_t> qvalue(std::string_view text) {
+        if (text.empty() || (text[0] != '0' && text[0] != '1') || text.size() > 5 || (text.size() > 1 && text[1] != '.')) return {};
+        auto value = static_cast<uint16_t>((text[0] - '0') * 1000);
+        int scale = 100;
+        for (auto digit : text.substr(std::min<size_t>(2, text.size()))) {
+            if (digit < '0' || digit > '9') return {};
+            value = static_cast<uint16_t>(value + (digit - '0') * scale);
+            scale /= 10;
+        }
+        if (value > 1000) return {};
+        return value;
+    }
+
+    [[nodiscard]] static std::string_view trim(std::string_view text) {
+        auto first = text.find_first_not_of(" \t");
+        return first == std::string_view::npos ? std::string_view{} : text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    }
+
+    [[nodiscard]] static bool equals(std::string_view a, std::string_view b) {
+        return std::ranges::equal(a, b, [](char x, char y) { return (x | 0x20) == (y | 0x20); });
+    }
+};
+
+} // namespace webfront::http
@@ -10,6 +10,7 @@
 #include <array>
 #include <bit>
 #include <concepts>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -158,6 +159,32 @@ concept Container = ::std::movable<T> || requires(T t) {
     return encode(std::move(input));
 }
 
+/// @return the bytes encoded in base64url (RFC4648 5), padded or not, such as the HTTP2-Settings header field. nullopt if text is not base64url.
+[[nodiscard]] inline std::optional<std::string> decodeUrl(std::string_view text) {
+    while (text.ends_with('=')) text.remove_suffix(1);
+    std::string decoded;
+    decoded.reserve(text.size() * 3 / 4);
+    uint32_t bits = 0;
+    size_t bitsCount = 0;
+    for (auto c : text) {
+        int value = c >= 'A' && c <= 'Z'   ? c - 'A'
+                    : c >= 'a' && c <= 'z' ? c - 'a' + 26
+                    : c >= '0' && c <= '9' ? c - '0' + 52
+                    : c == '-'             ? 62
+                    : c == '_'             ? 63
+                                           : -1;
+        if (value < 0) return {};
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        bitsCount += 6;
+        if (bitsCount >= 8) {
+            bitsCount -= 8;
+            decoded += static_cast<char>(bits >> bitsCount);
+        }
+    }
+    if (bitsCount == 6) return {}; // A single character left : not even an octet
+    return decoded;
+}
+
 } // namespace base64
 
 namespace crypto {
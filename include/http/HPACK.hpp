@@ -0,0 +1,330 @@
+/// @date 21/10/2026 09:12:40
+/// @author Ambroise Leclerc
+/// @brief HPACK : compression of the header fields of HTTP/2 (RFC7541), static and dynamic tables, Huffman coding
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace webfront::http::hpack {
+
+/// Header field name and value
+using Field = std::pair<std::string_view, std::string_view>;
+
+namespace huffman {
+/// Lengths of the codes of the 256 octets and of EOS (RFC7541 Appendix B) : the code is canonical, the codes themselves are derived from them
+inline constexpr std::array<uint8_t, 257> codeLengths{
+    13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    6,  10, 10, 12, 13, 6,  8,  11, 10, 10, 8,  11, 8,  6,  6,  6,  5,  5,  5,  6,  6,  6,  6,  6,  6,  6,  7,  8,  15, 6,  12, 10,
+    13, 6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  8,  7,  8,  13, 19, 13, 14, 6,
+    15, 5,  6,  5,  6,  5,  6,  6,  6,  5,  7,  7,  6,  6,  6,  5,  6,  7,  6,  5,  5,  6,  7,  7,  7,  7,  7,  15, 11, 14, 13, 28,
+    20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23, 24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,
+    22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23, 21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,
+    26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25, 19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,
+    20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23, 26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,
+    30};
+inline constexpr size_t codeLengthMax = 30;
+
+/// Canonical code : the symbols sorted by code length then by value, the codes of a length being consecutive
+struct Code {
+    std::array<uint16_t, 257> symbols{};                 // Sorted by code
+    std::array<uint32_t, codeLengthMax + 1> firstCode{}; // Code of the first symbol of each length
+    std::array<uint16_t, codeLengthMax + 1> firstIndex{}, count{};
+    std::array<uint32_t, 257> codes{};                   // Code of each symbol
+};
+
+inline constexpr Code code = [] {
+    Code canonical;
+    size_t index = 0;
+    uint32_t next = 0;
+    for (size_t length = 1; length <= codeLengthMax; ++length) {
+        canonical.firstCode[length] = next;
+        canonical.firstIndex[length] = static_cast<uint16_t>(index);
+        for (size_t symbol = 0; symbol < codeLengths.size(); ++symbol) {
+            if (codeLengths[symbol] != length) continue;
+            canonical.symbols[index++] = static_cast<uint16_t>(symbol);
+            canonical.codes[symbol] = next++;
+            ++canonical.count[length];
+        }
+        next <<= 1;
+    }
+    return canonical;
+}();
+
+[[nodiscard]] constexpr size_t encodedSize(std::string_view text) {
+    size_t bits = 0;
+    for (auto c : text) bits += codeLengths[static_cast<uint8_t>(c)];
+    return (bits + 7) / 8;
+}
+
+/// Appends the Huffman code of text to out, padded with the most significant bits of EOS
+inline void encode(std::string_view text, std::string& out) {
+    uint64_t pending = 0; // Bits not yet appended, in the lowest pendingCount bits
+    size_t pendingCount = 0;
+    for (auto c : text) {
+        auto symbol = static_cast<uint8_t>(c);
+        pending = (pending << codeLengths[symbol]) | code.codes[symbol];
+        for (pendingCount += codeLengths[symbol]; pendingCount >= 8; pendingCount -= 8) out += static_cast<char>(pending >> (pendingCount - 8));
+    }
+    if (pendingCount > 0) out += static_cast<char>((pending << (8 - pendingCount)) | (0xFFu >> pendingCount));
+}
+
+/// Appends the text whose Huffman code is data to out
+/// @return false if data is not a valid code : EOS, padding longer than 7 bits or not made of the most significant bits of EOS
+inline bool decode(std::string_view data, std::string& out) {
+    uint32_t bits = 0;
+    size_t length = 0;
+    bool ones = true; // The bits of the symbol being decoded are all 1 : padding so far
+    for (auto c : data) {
+        for (int bit = 7; bit >= 0; --bit) {
+            auto value = (static_cast<uint8_t>(c) >> bit) & 1u;
+            bits = (bits << 1) | value;
+            ones = ones && value == 1;
+            if (++length > codeLengthMax) return false;
+            auto offset = bits - code.firstCode[length];
+            if (offset >= code.count[length]) continue;
+            auto symbol = code.symbols[code.firstIndex[length] + offset];
+            if (symbol == 256) return false; // EOS
+            out += static_cast<char>(symbol);
+            bits = 0;
+            length = 0;
+            ones = true;
+        }
+    }
+    return length < 8 && ones;
+}
+} // namespace huffman
+
+/// Static table (RFC7541 Appendix A), indexed from 1
+inline constexpr std::array<Field, 61> staticTable{{
+    {":authority", ""}, {":method", "GET"}, {":method", "POST"}, {":path", "/"}, {":path", "/index.html"}, {":scheme", "http"},
+    {":scheme", "https"}, {":status", "200"}, {":status", "204"}, {":status", "206"}, {":status", "304"}, {":status", "400"},
+    {":status", "404"}, {":status", "500"}, {"accept-charset", ""}, {"accept-encoding", "gzip, deflate"}, {"accept-language", ""},
+    {"accept-ranges", ""}, {"accept", ""}, {"access-control-allow-origin", ""}, {"age", ""}, {"allow", ""}, {"authorization", ""},
+    {"cache-control", ""}, {"content-disposition", ""}, {"content-encoding", ""}, {"content-language", ""}, {"content-length", ""},
+    {"content-location", ""}, {"content-range", ""}, {"content-type", ""}, {"cookie", ""}, {"date", ""}, {"etag", ""}, {"expect", ""},
+    {"expires", ""}, {"from", ""}, {"host", ""}, {"if-match", ""}, {"if-modified-since", ""}, {"if-none-match", ""}, {"if-range", ""},
+    {"if-unmodified-since", ""}, {"last-modified", ""}, {"link", ""}, {"location", ""}, {"max-forwards", ""}, {"proxy-authenticate", ""},
+    {"proxy-authorization", ""}, {"range", ""}, {"referer", ""}, {"refresh", ""}, {"retry-after", ""}, {"server", ""}, {"set-cookie", ""},
+    {"strict-transport-security", ""}, {"transfer-encoding", ""}, {"user-agent", ""}, {"vary", ""}, {"via", ""}, {"www-authenticate", ""}}};
+
+/// Dynamic table : the fields inserted last come first, the oldest ones being evicted beyond the capacity (RFC7541 4)
+class DynamicTable {
+public:
+    static constexpr size_t entryOverhead = 32;
+
+    explicit DynamicTable(size_t tableCapacity) : capacity(tableCapacity) {}
+
+    [[nodiscard]] size_t size() const { return entries.size(); }
+    [[nodiscard]] size_t bytes() const { return tableBytes; }
+    [[nodiscard]] size_t maxBytes() const { return capacity; }
+    /// @param index 0 for the newest entry
+    [[nodiscard]] Field operator[](size_t index) const { return {entries[index].first, entries[index].second}; }
+
+    void insert(std::string_view name, std::string_view value) {
+        auto entrySize = entryOverhead + name.size() + value.size();
+        std::pair<std::string, std::string> entry{name, value}; // Copied before the eviction of the entry name or value may refer to
+        evict(entrySize > capacity ? 0 : capacity - entrySize);
+        if (entrySize > capacity) return; // Empties the table (RFC7541 4.4)
+        entries.push_front(std::move(entry));
+        tableBytes += entrySize;
+    }
+
+    void resize(size_t tableCapacity) {
+        capacity = tableCapacity;
+        evict(capacity);
+    }
+
+private:
+    std::deque<std::pair<std::string, std::string>> entries;
+    size_t tableBytes{0};
+    size_t capacity;
+
+    void evict(size_t bytesMax) {
+        while (tableBytes > bytesMax) {
+            tableBytes -= entryOverhead + entries.back().first.size() + entries.back().second.size();
+            entries.pop_back();
+        }
+    }
+};
+
+/// Appends the integer value with a prefix of prefixBits bits to out, its first octet starting with the bits of pattern (RFC7541 5.1)
+inline void encodeInteger(uint64_t value, size_t prefixBits, uint8_t pattern, std::string& out) {
+    uint64_t prefixMax = (1u << prefixBits) - 1;
+    if (value < prefixMax) {
+        out += static_cast<char>(pattern | value);
+        return;
+    }
+    out += static_cast<char>(pattern | prefixMax);
+    for (value -= prefixMax; value >= 128; value >>= 7) out += static_cast<char>((value & 0x7F) | 0x80);
+    out += static_cast<char>(value);
+}
+
+/// Decodes the integer with a prefix of prefixBits bits at the beginning of data, removed from it
+/// @return nullopt if data ends before the integer or if it exceeds 2^32
+inline std::optional<uint32_t> decodeInteger(std::string_view& data, size_t prefixBits) {
+    if (data.empty()) return {};
+    uint32_t prefixMax = (1u << prefixBits) - 1;
+    uint64_t value = static_cast<uint8_t>(data.front()) & prefixMax;
+    data.remove_prefix(1);
+    if (value < prefixMax) return static_cast<uint32_t>(value);
+    for (size_t shift = 0; !data.empty() && shift <= 28; shift += 7) {
+        auto octet = static_cast<uint8_t>(data.front());
+        data.remove_prefix(1);
+        value += static_cast<uint64_t>(octet & 0x7F) << shift;
+        if ((octet & 0x80) == 0) {
+            if (value > UINT32_MAX) return {};
+            return static_cast<uint32_t>(value);
+        }
+    }
+    return {};
+}
+
+/// Appends the string literal text to out, Huffman coded when shorter (RFC7541 5.2)
+inline void encodeString(std::string_view text, std::string& out) {
+    auto huffmanSize = huffman::encodedSize(text);
+    if (huffmanSize < text.size()) {
+        encodeInteger(huffmanSize, 7, 0x80, out);
+        huffman::encode(text, out);
+        return;
+    }
+    encodeInteger(text.size(), 7, 0, out);
+    out.append(text);
+}
+
+/// Decoder of the header blocks received on a connection, sharing their dynamic table.
+class Decoder {
+public:
+    /// @param tableSizeMax SETTINGS_HEADER_TABLE_SIZE sent to the peer : largest dynamic table its encoder may ask for
+    explicit Decoder(size_t tableSizeMax = 4096) : table(tableSizeMax), sizeMax(tableSizeMax) {}
+
+    /// Decodes a whole header block, calling onField(std::string_view name, std::string_view value) for each field, the views being valid
+    /// during the call only.
+    /// @return false on a compression error : the connection is then unusable (RFC7541 2.3.3)
+    template<typename OnField>
+    bool decode(std::string_view block, OnField onField) {
+        bool fieldsStarted = false;
+        while (!block.empty()) {
+            auto first = static_cast<uint8_t>(block.front());
+            if (first & 0x80) { // Indexed field
+                auto index = decodeInteger(block, 7);
+                auto field = index ? fieldAt(*index) : std::nullopt;
+                if (!field) return false;
+                onField(field->first, field->second);
+                fieldsStarted = true;
+            }
+            else if ((first & 0xE0) == 0x20) { // Dynamic table size update, only at the beginning of the block
+                auto size = decodeInteger(block, 5);
+                if (fieldsStarted || !size || *size > sizeMax) return false;
+                table.resize(*size);
+            }
+            else { // Literal, with incremental indexing (01), without indexing (0000) or never indexed (0001)
+                bool indexing = (first & 0xC0) == 0x40;
+                auto nameIndex = decodeInteger(block, indexing ? 6 : 4);
+                if (!nameIndex) return false;
+                name.clear();
+                if (*nameIndex == 0) {
+                    if (!decodeString(block, name)) return false;
+                }
+                else if (auto field = fieldAt(*nameIndex))
+                    name = field->first;
+                else
+                    return false;
+                value.clear();
+                if (!decodeString(block, value)) return false;
+                if (indexing) table.insert(name, value);
+                onField(std::string_view(name), std::string_view(value));
+                fieldsStarted = true;
+            }
+        }
+        return true;
+    }
+
+private:
+    DynamicTable table;
+    size_t sizeMax;
+    std::string name, value; // Literals being decoded, keeping their capacity from one field to the other
+
+    [[nodiscard]] std::optional<Field> fieldAt(size_t index) const {
+        if (index == 0) return {};
+        if (index <= staticTable.size()) return staticTable[index - 1];
+        if (index - staticTable.size() > table.size()) return {};
+        return table[index - staticTable.size() - 1];
+    }
+
+    static bool decodeString(std::string_view& data, std::string& out) {
+        if (data.empty()) return false;
+        bool huffmanCoded = static_cast<uint8_t>(data.front()) & 0x80;
+        auto length = decodeInteger(data, 7);
+        if (!length || *length > data.size()) return false;
+        auto text = data.substr(0, *length);
+        data.remove_prefix(*length);
+        if (huffmanCoded) return huffman::decode(text, out);
+        out.append(text);
+        return true;
+    }
+};
+
+/// Encoder of the header blocks sent on a connection, sharing their dynamic table. The fields are indexed in the dynamic table unless
+/// their value varies from one message to the other (content-length, etag...) : repeated ones, such as the content-type or the
+/// cache-control of the files of a page, are then sent as a single octet.
+class Encoder {
+public:
+    static constexpr size_t tableSizeDefault = 4096;
+
+    /// Applies the SETTINGS_HEADER_TABLE_SIZE of the peer : the table is resized (up to tableSizeDefault), the size update being signaled
+    /// at the beginning of the next block
+    void setTableSizeMax(size_t size) {
+        auto capacity = std::min(size, tableSizeDefault);
+        if (capacity == finalSize && !sizeUpdate) return;
+        sizeUpdate = std::min(sizeUpdate.value_or(capacity), capacity); // The smallest one evicts what the peer evicted (RFC7541 4.2)
+        finalSize = capacity;
+    }
+
+    /// Appends the field (lowercase name) to the header block being encoded in block
+    void encode(std::string_view name, std::string_view value, std::string& block) {
+        if (sizeUpdate) {
+            encodeInteger(*sizeUpdate, 5, 0x20, block);
+            if (*sizeUpdate != finalSize) encodeInteger(finalSize, 5, 0x20, block);
+            table.resize(finalSize);
+            sizeUpdate.reset();
+        }
+        size_t nameIndex = 0;
+        for (size_t index = 0; index < staticTable.size(); ++index) {
+            if (staticTable[index].first != name) continue;
+            if (staticTable[index].second == value) return encodeInteger(index + 1, 7, 0x80, block);
+            if (nameIndex == 0) nameIndex = index + 1;
+        }
+        for (size_t index = 0; index < table.size(); ++index) {
+            auto field = table[index];
+            if (field.first != name) continue;
+            if (field.second == value) return encodeInteger(staticTable.size() + index + 1, 7, 0x80, block);
+            if (nameIndex == 0) nameIndex = staticTable.size() + index + 1;
+        }
+        bool indexing = !varies(name) && DynamicTable::entryOverhead + name.size() + value.size() <= table.maxBytes() / 2;
+        encodeInteger(nameIndex, indexing ? 6 : 4, indexing ? 0x40 : 0, block);
+        if (nameIndex == 0) encodeString(name, block);
+        encodeString(value, block);
+        if (indexing) table.insert(name, value);
+    }
+
+private:
+    DynamicTable table{tableSizeDefault};
+    std::optional<size_t> sizeUpdate;
+    size_t finalSize{tableSizeDefault};
+
+    [[nodiscard]] static bool varies(std::string_view name) {
+        constexpr std::array names{std::string_view{":path"}, std::string_view{"content-length"}, std::string_view{"content-range"},
+                                   std::string_view{"date"}, std::string_view{"etag"}, std::string_view{"last-modified"},
+                                   std::string_view{"location"}, std::string_view{"set-cookie"}};
+        return std::ranges::find(names, name) != names.end();
+    }
+};
+
+} // namespace webfront::http::hpack
@@ -0,0 +1,561 @@
+/// @date 22/10/2026 10:41:17
+/// @author Ambroise Leclerc
+/// @brief HTTP/2 (RFC9113) : framing, flow control and multiplexing of the streams of a connection, independent of its transport
+#pragma once
+#include "Encodings.hpp"
+#include "HPACK.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace webfront::http::http2 {
+
+/// Client connection preface (RFC9113 3.4), sent before its SETTINGS frame
+inline constexpr std::string_view preface{"PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"};
+
+enum class FrameType : uint8_t { data, headers, priority, rstStream, settings, pushPromise, ping, goAway, windowUpdate, continuation };
+
+enum class ErrorCode : uint32_t {
+    noError,
+    protocolError,
+    internalError,
+    flowControlError,
+    settingsTimeout,
+    streamClosed,
+    frameSizeError,
+    refusedStream,
+    cancel,
+    compressionError,
+    connectError,
+    enhanceYourCalm,
+    inadequateSecurity,
+    http11Required
+};
+
+namespace flags {
+inline constexpr uint8_t endStream = 0x1, ack = 0x1, endHeaders = 0x4, padded = 0x8, priority = 0x20;
+} // namespace flags
+
+[[nodiscard]] inline uint32_t readUint32(std::string_view data) {
+    auto octet = [data](size_t index) { return static_cast<uint32_t>(static_cast<uint8_t>(data[index])); };
+    return octet(0) << 24 | octet(1) << 16 | octet(2) << 8 | octet(3);
+}
+
+inline void appendUint32(std::string& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) out += static_cast<char>(value >> shift);
+}
+
+struct FrameHeader {
+    static constexpr size_t size = 9;
+    uint32_t length{0};
+    FrameType type{FrameType::data};
+    uint8_t flags{0};
+    uint32_t streamId{0};
+
+    [[nodiscard]] static FrameHeader parse(std::string_view data) {
+        auto length = readUint32(data.substr(0, 4)) >> 8;
+        return {length, static_cast<FrameType>(data[3]), static_cast<uint8_t>(data[4]), readUint32(data.substr(5)) & 0x7FFFFFFF};
+    }
+
+    void appendTo(std::string& out) const {
+        for (int shift = 16; shift >= 0; shift -= 8) out += static_cast<char>(length >> shift);
+        out += static_cast<char>(type);
+        out += static_cast<char>(flags);
+        appendUint32(out, streamId);
+    }
+};
+
+inline void appendFrame(std::string& out, FrameType type, uint8_t frameFlags, uint32_t streamId, std::string_view payload = {}) {
+    FrameHeader{static_cast<uint32_t>(payload.size()), type, frameFlags, streamId}.appendTo(out);
+    out.append(payload);
+}
+
+/// Parameters of a SETTINGS frame (RFC9113 6.5.2), the defaults of the protocol when not sent
+struct Settings {
+    enum Identifier : uint16_t { headerTableSize = 1, enablePush, maxConcurrentStreams, initialWindowSize, maxFrameSize, maxHeaderListSize };
+    static constexpr uint32_t windowSizeDefault = 65535, windowSizeMax = 0x7FFFFFFF, frameSizeDefault = 16384, frameSizeMax = 0xFFFFFF;
+    static constexpr uint32_t unlimited = UINT32_MAX;
+
+    uint32_t tableSize{4096};
+    uint32_t concurrentStreamsMax{unlimited};
+    uint32_t windowSize{windowSizeDefault};
+    uint32_t frameSize{frameSizeDefault};
+    uint32_t headerListSizeMax{unlimited};
+
+    /// Applies the parameters of a SETTINGS frame payload, the unknown ones being ignored
+    /// @return the connection error of a malformed payload or an invalid value
+    std::optional<ErrorCode> apply(std::string_view payload) {
+        if (payload.size() % 6 != 0) return ErrorCode::frameSizeError;
+        for (; !payload.empty(); payload.remove_prefix(6)) {
+            auto identifier = static_cast<uint16_t>(static_cast<uint8_t>(payload[0]) << 8 | static_cast<uint8_t>(payload[1]));
+            auto value = readUint32(payload.substr(2));
+            switch (identifier) {
+            case headerTableSize: tableSize = value; break;
+            case enablePush:
+                if (value > 1) return ErrorCode::protocolError;
+                break;
+            case maxConcurrentStreams: concurrentStreamsMax = value; break;
+            case initialWindowSize:
+                if (value > windowSizeMax) return ErrorCode::flowControlError;
+                windowSize = value;
+                break;
+            case maxFrameSize:
+                if (value < frameSizeDefault || value > frameSizeMax) return ErrorCode::protocolError;
+                frameSize = value;
+                break;
+            case maxHeaderListSize: headerListSizeMax = value; break;
+            default: break;
+            }
+        }
+        return {};
+    }
+
+    /// Appends the parameters differing from the defaults to a SETTINGS frame payload
+    void appendTo(std::string& payload) const {
+        Settings defaults;
+        auto append = [&payload](Identifier identifier, uint32_t value) {
+            payload += static_cast<char>(identifier >> 8);
+            payload += static_cast<char>(identifier);
+            appendUint32(payload, value);
+        };
+        if (tableSize != defaults.tableSize) append(headerTableSize, tableSize);
+        if (concurrentStreamsMax != defaults.concurrentStreamsMax) append(maxConcurrentStreams, concurrentStreamsMax);
+        if (windowSize != defaults.windowSize) append(initialWindowSize, windowSize);
+        if (frameSize != defaults.frameSize) append(maxFrameSize, frameSize);
+        if (headerListSizeMax != defaults.headerListSizeMax) append(maxHeaderListSize, headerListSizeMax);
+    }
+};
+
+/// Server side of an HTTP/2 connection : it is handed the bytes received and builds the frames to send, its Handler answering the requests.
+/// The requests of a connection are multiplexed on their streams, the DATA frames of their responses being interleaved within the flow
+/// control windows of the peer. Handler provides :
+///  - void onRequest(uint32_t streamId, std::span<const hpack::Field> fields, bool endStream) : valid header block opening a stream (its
+///    views are valid during the call only), answered by respond() at once or later, e.g. once the body of the request has been received.
+///  - void onData(uint32_t streamId, std::span<const std::byte> data, bool endStream) : part of the body of a request, its trailer fields
+///    being ignored.
+///  - std::pair<std::span<const std::byte>, bool> readBody(uint32_t streamId, size_t sizeMax) : the next bytes (sizeMax at most) of the
+///    body of a response, and whether they are the last ones. They stay valid until the next nextWrite() call.
+///  - void onClose(uint32_t streamId) : the stream is closed (answered or reset), the data of its request and response can be released.
+template<typename Handler>
+class Session {
+public:
+    /// Bytes of DATA frames of a write : each stream having data to send gets its share of them
+    static constexpr size_t writeSizeMax = 256 * 1024;
+    /// Bytes of frames waiting to be written above which received() stops being called (wantsInput() false) : flow control of the peer
+    static constexpr size_t backlogSizeMax = 256 * 1024;
+    /// Size of the header blocks received : a larger one is a connection error
+    static constexpr size_t headerBlockSizeMax = 64 * 1024;
+
+    /// @param localSettings settings announced to the client, such as its concurrent streams limit and the window of its request bodies
+    Session(Handler& streamsHandler, Settings localSettings = {})
+        : handler(streamsHandler), local(localSettings), decoder(local.tableSize), input(2 * (FrameHeader::size + local.frameSize)),
+          receiveWindow(local.windowSize) {
+        std::string payload;
+        local.appendTo(payload);
+        appendFrame(control, FrameType::settings, 0, 0, payload);
+        if (local.windowSize > Settings::windowSizeDefault) appendWindowUpdate(control, 0, local.windowSize - Settings::windowSizeDefault);
+    }
+
+    /// Opens the stream 1 of an HTTP/1.1 request upgraded to h2c (RFC7540 3.2), which is half-closed : its response is sent by HTTP/2.
+    /// @param http2Settings HTTP2-Settings header field of the request : base64url SETTINGS payload of the client
+    /// @return false if http2Settings is invalid
+    bool upgrade(std::string_view http2Settings) {
+        auto payload = base64::decodeUrl(http2Settings);
+        if (!payload || peer.apply(*payload)) return false;
+        encoder.setTableSizeMax(peer.tableSize);
+        lastStreamId = 1;
+        streams.push_back({1, peer.windowSize, local.windowSize, true});
+        return true;
+    }
+
+    /// @return the free part of the receive buffer, where the bytes received from the client are to be read
+    [[nodiscard]] std::span<char> receiveBuffer() { return std::span{input}.subspan(inputSize); }
+
+    /// Processes the count bytes received in receiveBuffer() : the complete frames are processed, the handler being called.
+    /// @return false once the connection has failed : the frames left (GOAWAY) are to be written before it is closed
+    bool received(size_t count) {
+        inputSize += count;
+        std::string_view data(input.data(), inputSize);
+        size_t processed = 0;
+        if (!prefaceReceived) {
+            if (!data.starts_with(preface.substr(0, std::min(data.size(), preface.size())))) connectionError(ErrorCode::protocolError);
+            else if (data.size() >= preface.size()) {
+                prefaceReceived = true;
+                processed = preface.size();
+            }
+        }
+        while (prefaceReceived && !goAwaySent && data.size() - processed >= FrameHeader::size) {
+            auto header = FrameHeader::parse(data.substr(processed));
+            if (header.length > local.frameSize) {
+                connectionError(ErrorCode::frameSizeError);
+                break;
+            }
+            if (data.size() - processed < FrameHeader::size + header.length) break;
+            processFrame(header, data.substr(processed + FrameHeader::size, header.length));
+            processed += FrameHeader::size + header.length;
+        }
+        std::memmove(input.data(), input.data() + processed, inputSize - processed);
+        inputSize -= processed;
+        return !goAwaySent;
+    }
+
+    /// Sends the response of a stream opened by onRequest() : its header fields (":status" first, lowercase names), followed by its body,
+    /// read by the handler's readBody() if withBody. The stream is reset (NO_ERROR) once answered if the client is still sending its request.
+    void respond(uint32_t streamId, std::span<const hpack::Field> responseFields, bool withBody) {
+        auto stream = find(streamId);
+        if (!stream || stream->closed || stream->responded) return;
+        fieldsBlock.clear();
+        for (auto [name, value] : responseFields) encoder.encode(name, value, fieldsBlock);
+        std::string_view block{fieldsBlock};
+        auto type = FrameType::headers;
+        uint8_t frameFlags = withBody ? 0 : flags::endStream;
+        do {
+            auto fragment = block.substr(0, peer.frameSize);
+            block.remove_prefix(fragment.size());
+            appendFrame(control, type, frameFlags | (block.empty() ? flags::endHeaders : 0), streamId, fragment);
+            type = FrameType::continuation;
+            frameFlags = 0;
+        } while (!block.empty());
+        stream->responded = true;
+        stream->sending = withBody;
+        if (!withBody) finish(*stream, control);
+    }
+
+    /// Resets a stream, e.g. whose request cannot be answered
+    void reset(uint32_t streamId, ErrorCode code) {
+        auto stream = find(streamId);
+        if (!stream || stream->closed) return;
+        appendReset(control, streamId, code);
+        stream->closed = true;
+    }
+
+    /// Builds the next write : the control frames and the HEADERS frames waiting, then DATA frames of the streams sending their response,
+    /// in turn. The handler is told of the streams closed since the previous write, which is complete.
+    /// @return the buffers to write, empty if there is nothing to send. They stay valid until the next call.
+    const std::vector<std::string_view>& nextWrite() {
+        for (auto& stream : streams)
+            if (stream.closed) handler.onClose(stream.id);
+        std::erase_if(streams, [](const Stream& stream) { return stream.closed; });
+        writing.clear();
+        writing.swap(control);
+        pieces.clear();
+        own(0);
+        if (settingsReceived && !goAwaySent) scheduleData(); // The client's SETTINGS set the windows of its upgraded stream
+        buffers.clear();
+        for (auto& piece : pieces) buffers.emplace_back(piece.external ? piece.external : writing.data() + piece.offset, piece.size);
+        return buffers;
+    }
+
+    /// @return true if the frames received are to be processed : false while too many frames are waiting to be written, or once the
+    /// connection is done
+    [[nodiscard]] bool wantsInput() const { return !isDone() && control.size() < backlogSizeMax; }
+
+    /// @return true once the connection is to be closed, its last frames written : it failed (GOAWAY sent), or the client is leaving
+    /// (GOAWAY received) and its streams are closed
+    [[nodiscard]] bool isDone() const { return goAwaySent || (goAwayReceived && openStreams() == 0); }
+
+    /// @return the count of the streams not closed : waiting for their request body, or sending their response
+    [[nodiscard]] size_t openStreams() const { return static_cast<size_t>(std::ranges::count(streams, false, &Stream::closed)); }
+
+private:
+    struct Stream {
+        uint32_t id;
+        int64_t sendWindow;       // Bytes of DATA the peer accepts
+        int64_t receiveWindow;    // Bytes of DATA the peer may send
+        bool remoteClosed{false}; // END_STREAM received : the whole request has been received
+        bool responded{false};    // HEADERS of the response sent
+        bool sending{false};      // DATA of the response left to send
+        bool closed{false};       // Erased by the next nextWrite(), the handler being told
+        uint32_t consumed{0};     // Bytes of DATA received since the last WINDOW_UPDATE of the stream
+    };
+    // Part of a write : bytes of writing, or external bytes (body of a response)
+    struct Piece {
+        const char* external;
+        size_t offset, size;
+    };
+
+    Handler& handler;
+    Settings local, peer;
+    hpack::Decoder decoder;
+    hpack::Encoder encoder;
+    std::vector<char> input; // Receive buffer, holding complete frames once processed
+    size_t inputSize{0};
+    bool prefaceReceived{false}, settingsReceived{false}, goAwaySent{false}, goAwayReceived{false};
+    std::vector<Stream> streams; // By id
+    uint32_t lastStreamId{0};    // Of the last stream opened by the client
+    size_t nextSender{0};        // Stream to serve first by the next write
+    int64_t sendWindow{Settings::windowSizeDefault};
+    int64_t receiveWindow;
+    uint32_t consumed{0};          // Bytes of DATA received since the last WINDOW_UPDATE of the connection
+    std::string control, writing;  // Frames waiting for the next write, frames of the write in progress
+    std::vector<Piece> pieces;
+    std::vector<std::string_view> buffers;
+    std::string headerBlock;       // Header block being received (HEADERS and CONTINUATION frames)
+    uint32_t headerStreamId{0};    // Stream of headerBlock, 0 if none
+    bool headerEndStream{false};
+    std::string fieldsText;        // Decoded header block
+    std::vector<hpack::Field> fields;
+    std::string fieldsBlock;       // Encoded header block of a response
+
+    [[nodiscard]] Stream* find(uint32_t streamId) {
+        auto stream = std::ranges::find(streams, streamId, &Stream::id);
+        return stream == streams.end() ? nullptr : &*stream;
+    }
+
+    [[nodiscard]] bool isIdle(uint32_t streamId) const { return streamId > lastStreamId; }
+
+    void processFrame(const FrameHeader& header, std::string_view payload) {
+        if (headerStreamId != 0 && header.type != FrameType::continuation) return connectionError(ErrorCode::protocolError); // Interleaved
+        if (!settingsReceived && header.type != FrameType::settings) return connectionError(ErrorCode::protocolError);
+        switch (header.type) {
+        case FrameType::data: return processData(header, payload);
+        case FrameType::headers: return processHeaders(header, payload);
+        case FrameType::priority: // Priorities are deprecated (RFC9113 5.3.2), the streams being served in turn
+            if (header.streamId == 0) return connectionError(ErrorCode::protocolError);
+            if (payload.size() != 5) return reset(header.streamId, ErrorCode::frameSizeError);
+            return;
+        case FrameType::rstStream:
+            if (header.streamId == 0 || isIdle(header.streamId)) return connectionError(ErrorCode::protocolError);
+            if (payload.size() != 4) return connectionError(ErrorCode::frameSizeError);
+            if (auto stream = find(header.streamId)) stream->closed = true;
+            return;
+        case FrameType::settings: return processSettings(header, payload);
+        case FrameType::pushPromise: return connectionError(ErrorCode::protocolError); // Only sent by servers
+        case FrameType::ping:
+            if (header.streamId != 0) return connectionError(ErrorCode::protocolError);
+            if (payload.size() != 8) return connectionError(ErrorCode::frameSizeError);
+            if (!(header.flags & flags::ack)) appendFrame(control, FrameType::ping, flags::ack, 0, payload);
+            return;
+        case FrameType::goAway:
+            if (header.streamId != 0) return connectionError(ErrorCode::protocolError);
+            if (payload.size() < 8) return connectionError(ErrorCode::frameSizeError);
+            goAwayReceived = true;
+            return;
+        case FrameType::windowUpdate: return processWindowUpdate(header, payload);
+        case FrameType::continuation:
+            if (header.streamId != headerStreamId || headerStreamId == 0) return connectionError(ErrorCode::protocolError);
+            if (headerBlock.size() + payload.size() > headerBlockSizeMax) return connectionError(ErrorCode::enhanceYourCalm);
+            headerBlock.append(payload);
+            if (header.flags & flags::endHeaders) completeHeaders();
+            return;
+        default: return; // Unknown frame types are ignored (RFC9113 5.5)
+        }
+    }
+
+    /// @return the payload without its padding, nullopt if the padding is invalid
+    static std::optional<std::string_view> unpadded(const FrameHeader& header, std::string_view payload) {
+        if (!(header.flags & flags::padded)) return payload;
+        if (payload.empty()) return {};
+        auto padLength = static_cast<uint8_t>(payload.front());
+        if (padLength >= payload.size()) return {};
+        return payload.substr(1, payload.size() - 1 - padLength);
+    }
+
+    void processData(const FrameHeader& header, std::string_view payload) {
+        if (header.streamId == 0 || isIdle(header.streamId)) return connectionError(ErrorCode::protocolError);
+        auto data = unpadded(header, payload);
+        if (!data) return connectionError(ErrorCode::protocolError);
+        if (header.length > receiveWindow) return connectionError(ErrorCode::flowControlError);
+        receiveWindow -= header.length; // The padding counts
+        consume(header.length);
+        auto stream = find(header.streamId);
+        if (!stream || stream->closed) return; // Closed : frames sent before the client knew it are ignored
+        if (stream->remoteClosed) return reset(header.streamId, ErrorCode::streamClosed);
+        if (header.length > stream->receiveWindow) return reset(header.streamId, ErrorCode::flowControlError);
+        stream->receiveWindow -= header.length;
+        bool endStream = header.flags & flags::endStream;
+        stream->remoteClosed = endStream;
+        if (!endStream && (stream->consumed += header.length) >= local.windowSize / 2) {
+            appendWindowUpdate(control, header.streamId, stream->consumed);
+            stream->receiveWindow += std::exchange(stream->consumed, 0);
+        }
+        handler.onData(header.streamId, std::as_bytes(std::span{data->data(), data->size()}), endStream);
+    }
+
+    void processHeaders(const FrameHeader& header, std::string_view payload) {
+        if (header.streamId == 0 || header.streamId % 2 == 0) return connectionError(ErrorCode::protocolError);
+        auto block = unpadded(header, payload);
+        if (!block) return connectionError(ErrorCode::protocolError);
+        if (header.flags & flags::priority) {
+            if (block->size() < 5) return connectionError(ErrorCode::frameSizeError);
+            block->remove_prefix(5); // Stream dependency and weight
+        }
+        if (block->size() > headerBlockSizeMax) return connectionError(ErrorCode::enhanceYourCalm);
+        headerBlock.assign(*block);
+        headerStreamId = header.streamId;
+        headerEndStream = header.flags & flags::endStream;
+        if (header.flags & flags::endHeaders) completeHeaders();
+    }
+
+    // The header block is decoded whatever becomes of its stream : the dynamic table is shared by all of them
+    void completeHeaders() {
+        auto streamId = std::exchange(headerStreamId, 0);
+        fieldsText.clear();
+        std::vector<std::pair<size_t, size_t>> sizes; // Of the name and value of each field, in fieldsText
+        if (!decoder.decode(headerBlock, [this, &sizes](std::string_view name, std::string_view value) {
+                fieldsText.append(name).append(value);
+                sizes.emplace_back(name.size(), value.size());
+            }))
+            return connectionError(ErrorCode::compressionError);
+        fields.clear();
+        for (size_t offset = 0; auto [nameSize, valueSize] : sizes) {
+            fields.emplace_back(std::string_view(fieldsText).substr(offset, nameSize), std::string_view(fieldsText).substr(offset + nameSize, valueSize));
+            offset += nameSize + valueSize;
+        }
+
+        if (auto stream = find(streamId)) { // Trailer fields, ending the request
+            if (stream->closed) return;
+            if (stream->remoteClosed) return reset(streamId, ErrorCode::streamClosed);
+            if (!headerEndStream) return reset(streamId, ErrorCode::protocolError);
+            stream->remoteClosed = true;
+            return handler.onData(streamId, {}, true);
+        }
+        if (!isIdle(streamId) || goAwaySent) return; // Closed stream, or connection failing : ignored
+        lastStreamId = streamId;
+        if (openStreams() >= local.concurrentStreamsMax) return appendReset(control, streamId, ErrorCode::refusedStream);
+        if (!isValidRequest(fields)) return appendReset(control, streamId, ErrorCode::protocolError);
+        streams.push_back({streamId, peer.windowSize, local.windowSize, headerEndStream});
+        handler.onRequest(streamId, fields, headerEndStream);
+    }
+
+    /// @return true if the fields of a request are well-formed (RFC9113 8.2 and 8.3.1) : lowercase names, known pseudo-header fields before
+    /// the regular ones, no connection-specific field
+    static bool isValidRequest(std::span<const hpack::Field> requestFields) {
+        bool regular = false;
+        std::array<bool, 4> pseudo{}; // :method, :scheme, :path, :authority
+        constexpr std::array<std::string_view, 4> pseudoNames{":method", ":scheme", ":path", ":authority"};
+        constexpr std::array<std::string_view, 5> connectionSpecific{"connection", "keep-alive", "proxy-connection", "transfer-encoding", "upgrade"};
+        for (auto [name, value] : requestFields) {
+            if (name.empty() || std::ranges::any_of(name, [](char c) { return c >= 'A' && c <= 'Z'; })) return false;
+            if (name.front() == ':') {
+                auto index = static_cast<size_t>(std::ranges::find(pseudoNames, name) - pseudoNames.begin());
+                if (regular || index == pseudoNames.size() || std::exchange(pseudo[index], true)) return false;
+                if (name == ":path" && value.empty()) return false;
+            }
+            else {
+                regular = true;
+                if (std::ranges::find(connectionSpecific, name) != connectionSpecific.end() || (name == "te" && value != "trailers")) return false;
+            }
+        }
+        return pseudo[0] && pseudo[1] && pseudo[2];
+    }
+
+    void processSettings(const FrameHeader& header, std::string_view payload) {
+        if (header.streamId != 0) return connectionError(ErrorCode::protocolError);
+        if (header.flags & flags::ack) {
+            if (!payload.empty()) connectionError(ErrorCode::frameSizeError);
+            return;
+        }
+        auto previousWindowSize = peer.windowSize;
+        if (auto error = peer.apply(payload)) return connectionError(*error);
+        settingsReceived = true;
+        encoder.setTableSizeMax(peer.tableSize);
+        auto delta = static_cast<int64_t>(peer.windowSize) - previousWindowSize;
+        for (auto& stream : streams)
+            if ((stream.sendWindow += delta) > Settings::windowSizeMax) return connectionError(ErrorCode::flowControlError);
+        appendFrame(control, FrameType::settings, flags::ack, 0);
+    }
+
+    void processWindowUpdate(const FrameHeader& header, std::string_view payload) {
+        if (payload.size() != 4) return connectionError(ErrorCode::frameSizeError);
+        auto increment = readUint32(payload) & 0x7FFFFFFF;
+        if (header.streamId == 0) {
+            if (increment == 0) return connectionError(ErrorCode::protocolError);
+            if ((sendWindow += increment) > Settings::windowSizeMax) return connectionError(ErrorCode::flowControlError);
+            return;
+        }
+        if (isIdle(header.streamId)) return connectionError(ErrorCode::protocolError);
+        auto stream = find(header.streamId);
+        if (!stream) return;
+        if (increment == 0) return reset(header.streamId, ErrorCode::protocolError);
+        if ((stream->sendWindow += increment) > Settings::windowSizeMax) return reset(header.streamId, ErrorCode::flowControlError);
+    }
+
+    // Gives the received DATA back to the connection window of the client once half of it has been received
+    void consume(uint32_t length) {
+        if ((consumed += length) < local.windowSize / 2) return;
+        appendWindowUpdate(control, 0, consumed);
+        receiveWindow += std::exchange(consumed, 0);
+    }
+
+    // Ends the response of stream, the client being told to stop sending its request if it is still doing so (RFC9113 8.1)
+    void finish(Stream& stream, std::string& out) {
+        stream.sending = false;
+        stream.closed = true;
+        if (!stream.remoteClosed) appendReset(out, stream.id, ErrorCode::noError);
+    }
+
+    void connectionError(ErrorCode code) {
+        if (std::exchange(goAwaySent, true)) return;
+        std::string payload;
+        appendUint32(payload, lastStreamId);
+        appendUint32(payload, static_cast<uint32_t>(code));
+        appendFrame(control, FrameType::goAway, 0, 0, payload);
+    }
+
+    static void appendReset(std::string& out, uint32_t streamId, ErrorCode code) {
+        std::string payload;
+        appendUint32(payload, static_cast<uint32_t>(code));
+        appendFrame(out, FrameType::rstStream, 0, streamId, payload);
+    }
+
+    static void appendWindowUpdate(std::string& out, uint32_t streamId, uint32_t increment) {
+        std::string payload;
+        appendUint32(payload, increment);
+        appendFrame(out, FrameType::windowUpdate, 0, streamId, payload);
+    }
+
+    // Adds the bytes of writing from offset to the pieces of the write
+    void own(size_t offset) {
+        auto size = writing.size() - offset;
+        if (size == 0) return;
+        if (!pieces.empty() && !pieces.back().external && pieces.back().offset + pieces.back().size == offset) pieces.back().size += size;
+        else pieces.push_back({nullptr, offset, size});
+    }
+
+    // Each stream sending its response gets a share of the write, within its window and the connection's one, starting from a different
+    // stream on each write : the responses progress together, a large one not delaying the small ones
+    void scheduleData() {
+        auto sending = static_cast<size_t>(std::ranges::count_if(streams, [](const Stream& stream) { return stream.sending && stream.sendWindow > 0; }));
+        if (sending == 0 || sendWindow <= 0) return;
+        size_t budget = writeSizeMax;
+        auto share = std::max<size_t>(peer.frameSize, std::min(budget, static_cast<size_t>(sendWindow)) / sending);
+        auto first = nextSender++ % streams.size();
+        for (size_t index = 0; index < streams.size() && budget > 0 && sendWindow > 0; ++index) {
+            auto& stream = streams[(first + index) % streams.size()];
+            if (!stream.sending || stream.sendWindow <= 0) continue;
+            auto sizeMax = std::min({share, budget, static_cast<size_t>(sendWindow), static_cast<size_t>(stream.sendWindow)});
+            auto [data, last] = handler.readBody(stream.id, sizeMax);
+            if (data.empty() && !last) continue;
+            auto bytes = std::string_view(reinterpret_cast<const char*>(data.data()), data.size());
+            do {
+                auto payload = bytes.substr(0, peer.frameSize);
+                bytes.remove_prefix(payload.size());
+                auto offset = writing.size();
+                FrameHeader{static_cast<uint32_t>(payload.size()), FrameType::data, last && bytes.empty() ? flags::endStream : uint8_t{0}, stream.id}
+                    .appendTo(writing);
+                own(offset);
+                if (!payload.empty()) pieces.push_back({payload.data(), 0, payload.size()});
+            } while (!bytes.empty());
+            budget -= data.size();
+            sendWindow -= static_cast<int64_t>(data.size());
+            stream.sendWindow -= static_cast<int64_t>(data.size());
+            if (last) {
+                auto offset = writing.size();
+                finish(stream, writing);
+                own(offset);
+            }
+        }
+    }
+};
+
+} // namespace webfront::http::http2
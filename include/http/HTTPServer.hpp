@@ -3,88 +3,203 @@
 /// @brief HTTPServer minimal implementation for WebSocket support - RFC1945
 #pragma once
 #include "../networking/BasicNetworking.hpp"
+#include "../networking/SocketTuning.hpp"
 #include "../tooling/HexDump.hpp"
 #include "../system/FileSystem.hpp"
+#include "../utils/Inflate.hpp"
+#include "../utils/IntrusiveList.hpp"
+#include "../utils/Mailbox.hpp"
+#include "../utils/MemoryBudget.hpp"
+#include "../utils/SlabPool.hpp"
+#include "../utils/TimingWheel.hpp"
+#include "Admission.hpp"
+#include "CompressionCache.hpp"
+#include "Conditional.hpp"
+#include "ContentNegotiation.hpp"
 #include "Encodings.hpp"
+#include "HeaderField.hpp"
+#include "HTTP2.hpp"
 #include "MimeType.hpp"
+#include "Range.hpp"
+#include "RequestBody.hpp"
+#include "ResponseCache.hpp"
+#include "Router.hpp"
+#include "Scanner.hpp"
 #include "WebSocket.hpp"
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <locale>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
 #include <regex>
-#include <set>
+#include <span>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace webfront::http {
 
-class Headers {
+/// Memory resource of the Requests and Responses built by the calling thread : the arena of the connection whose request is being answered,
+/// set by an ArenaScope, the default resource otherwise.
+inline thread_local std::pmr::memory_resource* requestArena{nullptr};
+
+/// Scope in which the Requests and Responses built by the calling thread draw their memory from arena, released once the response has been
+/// sent : a Response built in this scope (e.g. by a RouteHandler) is not to be kept beyond its request, a copy of it uses the default resource.
+class ArenaScope {
+public:
+    explicit ArenaScope(std::pmr::memory_resource& arena) : previous(std::exchange(requestArena, &arena)) {}
+    ~ArenaScope() { requestArena = previous; }
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+
+private:
+    std::pmr::memory_resource* previous;
+};
+
+/// List of HTTP headers, owning their text (StringType = std::pmr::string) or viewing a received buffer (std::string_view).
+/// Well-known header names are classified once, when the header is added : looking them up compares HeaderField ids.
+/// The list and the text it owns are allocated from the memory resource of the list, requestArena when it is default constructed.
+template<typename StringType>
+class BasicHeaders {
     struct Header {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
         Header() = default;
-        Header(std::string_view n, std::string_view v) : name(std::move(n)), value(std::move(v)) {}
-        std::string name;
-        std::string value;
+        Header(std::string_view n, std::string_view v, const allocator_type& allocator = {})
+            : field(n), name(text(n, allocator)), value(text(v, allocator)) {}
+        Header(const Header& other, const allocator_type& allocator)
+            : field(other.field), name(text(other.name, allocator)), value(text(other.value, allocator)) {}
+        Header(Header&& other, const allocator_type& allocator)
+            : field(other.field), name(text(std::move(other.name), allocator)), value(text(std::move(other.value), allocator)) {}
+        Header(const Header&) = default;
+        Header(Header&&) noexcept = default;
+        Header& operator=(const Header&) = default;
+        Header& operator=(Header&&) noexcept = default;
+        ~Header() = default;
+        HeaderField field{HeaderField::unknown};
+        StringType name;
+        StringType value;
+
+        template<typename Text>
+        static StringType text(Text&& source, const allocator_type& allocator) {
+            if constexpr (std::is_same_v<StringType, std::string_view>) return std::string_view(source);
+            else return StringType(std::forward<Text>(source), allocator);
+        }
     };
 
+public:
+    BasicHeaders() : headers(requestArena ? requestArena : std::pmr::get_default_resource()) {}
+    explicit BasicHeaders(std::pmr::memory_resource* resource) : headers(resource) {}
+
 public:
     /// @return the header value with headerName name (or at least the first one)
-    [[nodiscard]] std::optional<std::string> getHeaderValue(std::string_view headerName) const {
-        for (auto& header : headers)
-            if (caseInsensitiveEqual(header.name, headerName)) return header.value;
-        return {};
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(std::string_view headerName) const {
+        return getHeaderValue(headerName, headers.cbegin());
     }
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(HeaderField field) const { return getHeaderValue(field, headers.cbegin()); }
 
     /// @return the list of headers values with the same headerName name
-    [[nodiscard]] std::list<std::string> getHeadersValues(std::string_view headerName) const {
-        std::list<std::string> values{};
+    [[nodiscard]] std::vector<std::string_view> getHeadersValues(std::string_view headerName) const {
+        std::vector<std::string_view> values{};
+        HeaderField field{headerName};
         for (auto& header : headers)
-            if (caseInsensitiveEqual(header.name, headerName)) values.push_back(header.value);
+            if (matches(header, field, headerName)) values.emplace_back(header.value);
         return values;
     }
 
     /// @return true if text is contained in the value field of headerName (case insensitive)
     [[nodiscard]] bool headersContain(std::string_view headerName, std::string_view text) const {
-        for (auto header : getHeadersValues(headerName)) {
-            if (std::search(header.cbegin(), header.cend(), text.cbegin(), text.cend(), [](char c1, char c2) {
-                    return (c1 == c2 || std::toupper(c1) == std::toupper(c2));
-                }) != header.cend())
+        return headersContain(headerName, text, headers.cbegin());
+    }
+    [[nodiscard]] bool headersContain(HeaderField field, std::string_view text) const { return headersContain(field, text, headers.cbegin()); }
+
+    std::pmr::vector<Header> headers;
+
+protected:
+    using Iterator = typename std::pmr::vector<Header>::const_iterator;
+
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(HeaderField field, std::string_view headerName, Iterator first) const {
+        for (auto header = first; header != headers.cend(); ++header)
+            if (matches(*header, field, headerName)) return header->value;
+        return {};
+    }
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(std::string_view headerName, Iterator first) const {
+        return getHeaderValue(HeaderField{headerName}, headerName, first);
+    }
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(HeaderField field, Iterator first) const {
+        return getHeaderValue(field, field.toString(), first);
+    }
+
+    [[nodiscard]] bool headersContain(HeaderField field, std::string_view headerName, std::string_view text, Iterator first) const {
+        for (auto header = first; header != headers.cend(); ++header) {
+            if (!matches(*header, field, headerName)) continue;
+            std::string_view value{header->value};
+            if (std::search(value.cbegin(), value.cend(), text.cbegin(), text.cend(), [](char c1, char c2) {
+                    return HeaderField::toLower(c1) == HeaderField::toLower(c2);
+                }) != value.cend())
                 return true;
         }
         return false;
     }
-
-    std::vector<Header> headers;
+    [[nodiscard]] bool headersContain(std::string_view headerName, std::string_view text, Iterator first) const {
+        return headersContain(HeaderField{headerName}, headerName, text, first);
+    }
+    [[nodiscard]] bool headersContain(HeaderField field, std::string_view text, Iterator first) const {
+        return headersContain(field, field.toString(), text, first);
+    }
 
 private:
-    [[nodiscard]] static constexpr bool caseInsensitiveEqual(std::string_view s1, std::string_view s2) {
-        return ((s1.size() == s2.size()) && std::equal(s1.begin(), s1.end(), s2.begin(), [](char c1, char c2) {
-                    return (c1 == c2 || std::toupper(c1) == std::toupper(c2));
-                }));
+    [[nodiscard]] static constexpr bool matches(const Header& header, HeaderField field, std::string_view headerName) {
+        if (field.isKnown()) return header.field == field;
+        return !header.field.isKnown() && HeaderField::caseInsensitiveEqual(header.name, headerName);
     }
 };
 
-struct BadRequestException : public std::runtime_error {
-    BadRequestException() : std::runtime_error("Bad HTTP request") {}
-};
+using Headers = BasicHeaders<std::pmr::string>;
 
-struct Request : Headers {
+/// HTTP request whose URI and headers are views into the buffer handed to parse() : the buffer must outlive the Request.
+/// parse() indexes the first header of each well-known field, their lookups are O(1).
+struct Request : BasicHeaders<std::string_view> {
     enum class Method { Connect, Delete, Get, Head, Options, Patch, Post, Put, Trace, Undefined };
-    Method method;
-    std::string uri;
-    int httpVersionMajor;
-    int httpVersionMinor;
+    enum class ParseResult { completed, incomplete, badRequest };
+    Method method{Method::Undefined};
+    std::string_view uri;
+    int httpVersionMajor{};
+    int httpVersionMinor{};
+
+    Request() = default;
+    /// The headers list is allocated from resource
+    explicit Request(std::pmr::memory_resource* resource) : BasicHeaders(resource) {}
 
+    /// Prepares the Request for the parsing of a new request.
     void reset() {
         headers.clear();
-        uri.clear();
+        uri = {};
+        method = Method::Undefined;
+        httpVersionMajor = httpVersionMinor = 0;
+        firstHeaders.fill(0);
+        state = State::requestLine;
+        parsedSize = 0;
     }
 
     [[nodiscard]] static Method getMethodFromString(std::string_view text) {
@@ -93,166 +208,498 @@ struct Request : Headers {
         return Method::Undefined;
     }
 
-    [[nodiscard]] std::string_view getMethodName() const { return methodNames[static_cast<size_t>(method)]; }
+    [[nodiscard]] std::string_view getMethodName() const { return getMethodName(method); }
+    [[nodiscard]] static std::string_view getMethodName(Method requestMethod) { return methodNames[static_cast<size_t>(requestMethod)]; }
         
     void setMethod(std::string_view text) { method = getMethodFromString(text); }
 
-    [[nodiscard]] bool isUpgradeRequest(std::string_view protocol) const {
-        return headersContain("Connection", "upgrade") && headersContain("Upgrade", protocol);
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(std::string_view headerName) const {
+        HeaderField field{headerName};
+        return field.isKnown() ? getHeaderValue(field) : BasicHeaders::getHeaderValue(headerName);
+    }
+    [[nodiscard]] std::optional<std::string_view> getHeaderValue(HeaderField field) const {
+        if (!field.isKnown() || firstHeaders[field.id] == 0) return {};
+        return headers[firstHeaders[field.id] - 1].value;
     }
 
-    template<typename InputIterator>
-    bool parseSomeData(InputIterator begin, InputIterator end) {
-        while (begin != end)
-            if (completeRequest(*begin++)) return true;
+    [[nodiscard]] bool headersContain(std::string_view headerName, std::string_view text) const {
+        HeaderField field{headerName};
+        return field.isKnown() ? headersContain(field, text) : BasicHeaders::headersContain(headerName, text);
+    }
+    [[nodiscard]] bool headersContain(HeaderField field, std::string_view text) const {
+        if (!field.isKnown() || firstHeaders[field.id] == 0) return false;
+        return BasicHeaders::headersContain(field, text, headers.cbegin() + (firstHeaders[field.id] - 1));
+    }
 
-        return false;
+    [[nodiscard]] bool isUpgradeRequest(std::string_view protocol) const {
+        return headersContain(HeaderField::connection, "upgrade") && headersContain(HeaderField::upgrade, protocol);
     }
 
-    bool completed() const { return state == State::completed; }
+    /// @return true if the connection should persist after the response (HTTP/1.1 default or HTTP/1.0 keep-alive)
+    [[nodiscard]] bool isPersistent() const {
+        if (headersContain(HeaderField::connection, "close")) return false;
+        return httpVersionMajor > 1 || (httpVersionMajor == 1 && httpVersionMinor >= 1) || headersContain(HeaderField::connection, "keep-alive");
+    }
 
-private: // clang-format off
-    enum class State { methodStart, method, URI, versionH, versionT1, versionT2, versionP, versionSlash, versionMajorStart, versionMajor, versionMinorStart,
-                 versionMinor, newline1, headerLineStart, headerLws, headerName, spaceBeforeHeaderValue, headerValue, newline2, newline3, completed };
-    State state { State::methodStart };    
-    bool completeRequest(char input) {
-        auto isChar = [](char c) { return c >= 0; };
-        auto isCtrl = [](char c) { return (c >= 0 && c <= 31) || (c == 127); };
-        auto isSpecial = [](char c) {   switch (c) {
-            case '(': case ')': case '<': case '>': case '@': case ',': case ';': case ':': case '\\': case '"':
-            case '/': case '[': case ']': case '?': case '=': case '{': case '}': case ' ': case '\t': return true;
-            default: return false;
-        }};
-        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
-        auto setState = [this](bool cond, State next) {
-            state = next;
-            if (cond) throw BadRequestException();
-        };
+    /// @return the decoder of the body following the headers (RFC9112 6.3), nullopt if its framing is invalid : a Transfer-Encoding other
+    /// than chunked once, sent with a Content-Length (request smuggling), or Content-Length values invalid or differing. Every line of these
+    /// fields is a list of values, a proxy framing the body by another line than the first one.
+    [[nodiscard]] std::optional<BodyDecoder> bodyDecoder() const {
+        auto lengthLine = firstHeaders[HeaderField::contentLength], codingLine = firstHeaders[HeaderField::transferEncoding];
+        if (lengthLine == 0 && codingLine == 0) return BodyDecoder{};
+        std::optional<uint64_t> length;
+        size_t codings = 0;
+        bool chunked = false, malformed = false;
+        auto firstLine = std::min(lengthLine == 0 ? codingLine : lengthLine, codingLine == 0 ? lengthLine : codingLine);
+        for (auto header = headers.cbegin() + (firstLine - 1); header != headers.cend(); ++header) {
+            if (header->field == HeaderField::contentLength)
+                forEachElement(header->value, [&](std::string_view element) {
+                    uint64_t size = 0;
+                    auto [end, error] = std::from_chars(element.data(), element.data() + element.size(), size);
+                    if (element.empty() || error != std::errc{} || end != element.data() + element.size() || (length && *length != size))
+                        malformed = true;
+                    length = size;
+                });
+            else if (header->field == HeaderField::transferEncoding)
+                forEachElement(header->value, [&](std::string_view element) {
+                    if (element.empty()) return; // RFC9110 5.6.1 : empty list elements are ignored
+                    ++codings;
+                    chunked = std::ranges::equal(element, std::string_view("chunked"), [](char a, char b) { return (a | 0x20) == b; });
+                });
+        }
+        if (malformed) return {};
+        if (codingLine != 0) {
+            if (length || codings != 1 || !chunked) return {};
+            return BodyDecoder::chunked();
+        }
+        return BodyDecoder::ofLength(*length);
+    }
 
-        static std::string buffer;
-        using enum State;
-        switch (state) {
-            case methodStart:
-                setState(!isChar(input) || isCtrl(input) || isSpecial(input), method);
-                buffer = input;
-                break;
-            case method: if (input == ' ') { state = URI; setMethod(buffer); }
-                              else if (!isChar(input) || isCtrl(input) || isSpecial(input)) { throw BadRequestException(); }
-                              else buffer.push_back(input);
-                break;
-            case URI: if (input == ' ') { state = versionH; break; }
-                           else if (isCtrl(input)) throw BadRequestException();
-                           else { uri.push_back(input); break; }
-            case versionH: setState(input != 'H', versionT1); break;
-            case versionT1: setState(input != 'T', versionT2); break;
-            case versionT2: setState(input != 'T', versionP); break;
-            case versionP: setState(input != 'P', versionSlash); break;
-            case versionSlash: setState(input != '/', versionMajorStart); httpVersionMajor = 0; httpVersionMinor = 0; break;
-            case versionMajorStart: setState(!isDigit(input), versionMajor); httpVersionMajor = httpVersionMajor * 10 + input - '0'; break;
-            case versionMajor: if (input == '.') state = versionMinorStart;
-                                    else if (isDigit(input)) httpVersionMajor = httpVersionMajor * 10 + input - '0';
-                                    else throw BadRequestException();
+    /// Parses the request held at the beginning of data, line by line.
+    /// An incomplete request can be resumed by calling parse() again with the same buffer grown with the newly received bytes.
+    /// @return badRequest on a malformed request, completed once the empty line ending the headers has been parsed
+    ParseResult parse(std::string_view data) {
+        while (state != State::completed) {
+            std::string_view line;
+            if (auto result = nextLine(data, line); result != ParseResult::completed) return result;
+
+            switch (state) {
+            case State::requestLine:
+                if (line.empty()) break; // RFC9112 2.2 : empty lines preceding a request-line are ignored
+                if (!parseRequestLine(line)) return ParseResult::badRequest;
+                state = State::headers;
                 break;
-            case versionMinorStart: setState(!isDigit(input), versionMinor); httpVersionMinor = httpVersionMinor * 10 + input - '0'; break;
-            case versionMinor: if (input == '\r') state = newline1;
-                                    else if (isDigit(input)) httpVersionMinor = httpVersionMinor * 10 + input - '0';
-                                    else throw BadRequestException();
+            case State::headers:
+                if (line.empty())
+                    state = State::completed;
+                else if (!parseHeaderLine(line))
+                    return ParseResult::badRequest;
                 break;
-            case newline1: setState(input != '\n', headerLineStart); break;
-            case headerLineStart: if (input == '\r') { state = newline3; break; }
-                                       else if (!headers.empty() && (input == ' ' || input == '\t')) { state = headerLws; break; }
-                                       else if (!isChar(input) || isCtrl(input) || isSpecial(input)) throw BadRequestException();
-                                       else { headers.push_back({}); headers.back().name.push_back(input); state = headerName; break; }
-            case headerLws:if (input == '\r') { state = newline2; break; }
-                                 else if (input == ' ' || input == '\t') break;
-                                 else if (isCtrl(input)) throw BadRequestException();
-                                 else { state = headerValue; headers.back().value.push_back(input); break; }
-            case headerName: if (input == ':') { state = spaceBeforeHeaderValue; break; }
-                                  else if (!isChar(input) || isCtrl(input) || isSpecial(input)) throw BadRequestException();
-                                  else { headers.back().name.push_back(input); break; }
-            case spaceBeforeHeaderValue: setState(input != ' ', headerValue); break;
-            case headerValue: if (input == '\r') { state = newline2; break; }
-                                   else if (isCtrl(input)) throw BadRequestException();
-                                   else { headers.back().value.push_back(input); break; }
-            case newline2: setState(input != '\n', headerLineStart); break;
-            case newline3: if (input == '\n') { state = completed; return true; } else throw BadRequestException();
-            case completed: return true;
-            default: throw BadRequestException();
+            case State::completed: break;
+            }
         }
-        return false;
+        return ParseResult::completed;
     }
+
+    bool completed() const { return state == State::completed; }
+
+    /// Adds a header whose name and value outlive the Request, such as a field of an HTTP/2 request
+    void addHeader(std::string_view name, std::string_view value) {
+        auto& header = headers.emplace_back(name, value);
+        if (header.field.isKnown() && firstHeaders[header.field.id] == 0) firstHeaders[header.field.id] = static_cast<uint16_t>(headers.size());
+    }
+
+    /// @return the count of bytes of the buffer consumed by the request : the beginning of a pipelined request if any
+    [[nodiscard]] size_t size() const { return parsedSize; }
+
+private:
+    enum class State { requestLine, headers, completed };
+    State state{State::requestLine};
+    size_t parsedSize{0};
+    std::array<uint16_t, HeaderField::count> firstHeaders{}; // 1 + position in headers of the first header of each known field, 0 if absent
+
+    /// Calls onElement with each element of the comma separated list, without its surrounding whitespace
+    template<typename OnElement>
+    static void forEachElement(std::string_view list, OnElement onElement) {
+        for (;;) {
+            auto comma = list.find(',');
+            auto element = list.substr(0, comma);
+            auto first = element.find_first_not_of(" \t");
+            onElement(first == std::string_view::npos ? std::string_view{} : element.substr(first, element.find_last_not_of(" \t") - first + 1));
+            if (comma == std::string_view::npos) return;
+            list.remove_prefix(comma + 1);
+        }
+    }
+
+    /// Extracts in line the next CRLF terminated line (without its CRLF). The only control character allowed in a line is HTAB in headers.
+    ParseResult nextLine(std::string_view data, std::string_view& line) {
+        auto lineStart = parsedSize;
+        auto index = lineStart;
+        for (;;) {
+            auto control = scanner::findControl(data.substr(index));
+            if (control == std::string_view::npos) return ParseResult::incomplete;
+            index += control;
+            if (data[index] == '\t' && state == State::headers) {
+                ++index;
+                continue;
+            }
+            if (data[index] != '\r') return ParseResult::badRequest;
+            if (index + 1 == data.size()) return ParseResult::incomplete;
+            if (data[index + 1] != '\n') return ParseResult::badRequest;
+            parsedSize = index + 2;
+            line = data.substr(lineStart, index - lineStart);
+            return ParseResult::completed;
+        }
+    }
+
+    // request-line = method SP request-target SP HTTP-version
+    bool parseRequestLine(std::string_view line) {
+        auto methodEnd = line.find(' ');
+        if (methodEnd == std::string_view::npos || !scanner::isToken(line.substr(0, methodEnd))) return false;
+        auto uriEnd = line.find(' ', methodEnd + 1);
+        if (uriEnd == std::string_view::npos || uriEnd == methodEnd + 1) return false;
+        setMethod(line.substr(0, methodEnd));
+        uri = line.substr(methodEnd + 1, uriEnd - methodEnd - 1);
+        return parseVersion(line.substr(uriEnd + 1));
+    }
+
+    // HTTP-version = "HTTP/" DIGIT "." DIGIT
+    bool parseVersion(std::string_view version) {
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        if (version.size() != 8 || !version.starts_with("HTTP/") || !isDigit(version[5]) || version[6] != '.' || !isDigit(version[7])) return false;
+        httpVersionMajor = version[5] - '0';
+        httpVersionMinor = version[7] - '0';
+        return true;
+    }
+
+    // field-line = field-name ":" OWS field-value OWS  (obs-fold is rejected as allowed by RFC9112 5.2)
+    bool parseHeaderLine(std::string_view line) {
+        auto colon = line.find(':');
+        if (colon == std::string_view::npos || !scanner::isToken(line.substr(0, colon))) return false;
+        auto value = line.substr(colon + 1);
+        auto first = value.find_first_not_of(" \t");
+        value = first == std::string_view::npos ? std::string_view{} : value.substr(first, value.find_last_not_of(" \t") - first + 1);
+        addHeader(line.substr(0, colon), value);
+        return true;
+    }
+
     inline static std::array methodNames{"CONNECT", "DELETE", "GET", "HEAD", "OPTIONS", "PATCH", "POST", "PUT", "TRACE"};
-}; // clang-format on
+};
 
 struct Response : Headers {
+    Response() = default;
+    /// The headers and the content are allocated from resource
+    explicit Response(std::pmr::memory_resource* resource) : Headers(resource) {}
+
     enum StatusCode : uint16_t {
         switchingProtocols = 101,
         ok = 200,
+        created = 201,
+        noContent = 204,
+        partialContent = 206,
+        notModified = 304,
         badRequest = 400,
         notFound = 404,
+        methodNotAllowed = 405,
+        contentTooLarge = 413,
+        rangeNotSatisfiable = 416,
+        requestHeaderFieldsTooLarge = 431,
+        internalServerError = 500,
         notImplemented = 501,
+        serviceUnavailable = 503,
         variantAlsoNegotiates = 506
     };
     StatusCode statusCode;
-    std::string content;
+    std::pmr::string content{headers.get_allocator()};
+    /// Content held in memory by the file system (File::contiguous()) : when set, it is sent instead of content, without copy
+    std::span<const std::byte> fileContent;
+    /// Keeps fileContent valid until it has been sent (File::contiguousOwner())
+    std::shared_ptr<const void> fileContentOwner;
+    /// Native file sent by the kernel after the headers (File::nativeDescriptor()), instead of content
+    std::shared_ptr<const fs::FileDescriptor> fileDescriptor;
+    /// File read and sent chunk by chunk after the headers, instead of content : it is never held whole in memory
+    std::shared_ptr<fs::File> streamedFile;
+    /// streamedFile is sent with the chunked transfer coding, its size being unknown
+    bool chunked{false};
+    /// Part of fileDescriptor or streamedFile (already positioned at its offset) which is sent, the whole file when unset (Range request)
+    std::optional<ByteRange> fileRange;
+    /// Header lines built at compile time for an embedded file (File::headers()), sent after headers
+    std::string_view staticHeaders;
+    /// Cache-Control header line of the CachePolicy of the file (CRLF included, empty if none), sent after staticHeaders
+    std::string_view cacheControl;
+    /// Headers and content shared with the ResponseCache : when set, they are sent after headers and instead of content
+    std::shared_ptr<const SerializedResponse> serialized;
 
     static Response getStatusResponse(StatusCode code) {
         Response response;
         response.statusCode = code;
-        response.content = "<html><head><title>" + toString(code) + "</title></head>";
-        response.content += "<body><h1>" + std::to_string(code) + " " + toString(code) + "</h1></body></html>";
+        auto reason = std::string(toString(code));
+        response.content = "<html><head><title>" + reason + "</title></head>";
+        response.content += "<body><h1>" + std::to_string(code) + " " + reason + "</h1></body></html>";
         response.headers.emplace_back("Content-Length", std::to_string(response.content.size()));
         response.headers.emplace_back("Content-Type", "text/html");
 
         return response;
     }
 
-    template<typename Net>
-    [[nodiscard]] std::vector<typename Net::ConstBuffer> toBuffers() const {
-        std::vector<typename Net::ConstBuffer> buffers;
-        static std::string httpStatus;
-        httpStatus = "HTTP/1.1 " + std::to_string(statusCode) + " " + toString(statusCode) + "\r\n";
-        buffers.push_back(Net::Buffer(httpStatus));
+    /// @return a response of code holding content, of MIME type contentType (e.g. "application/json")
+    static Response getContentResponse(StatusCode code, std::string content, std::string_view contentType) {
+        Response response;
+        response.statusCode = code;
+        response.content.assign(content);
+        response.headers.emplace_back("Content-Length", std::to_string(response.content.size()));
+        response.headers.emplace_back("Content-Type", contentType);
+        return response;
+    }
 
-        static const char separator[] = {':', ' '};
-        static const char crlf[] = {'\r', '\n'};
-        for (auto& header : headers) {
-            buffers.push_back(Net::Buffer(header.name));
-            buffers.push_back(Net::Buffer(separator));
-            buffers.push_back(Net::Buffer(header.value));
-            buffers.push_back(Net::Buffer(crlf));
+    /// @return the pre-rendered status line of code, CRLF included
+    [[nodiscard]] static constexpr std::string_view getStatusLine(StatusCode code) {
+        switch (code) {
+        case switchingProtocols: return "HTTP/1.1 101 Switching Protocols\r\n";
+        case ok: return "HTTP/1.1 200 OK\r\n";
+        case created: return "HTTP/1.1 201 Created\r\n";
+        case noContent: return "HTTP/1.1 204 No Content\r\n";
+        case partialContent: return "HTTP/1.1 206 Partial Content\r\n";
+        case notModified: return "HTTP/1.1 304 Not Modified\r\n";
+        case badRequest: return "HTTP/1.1 400 Bad Request\r\n";
+        case notFound: return "HTTP/1.1 404 Not Found\r\n";
+        case methodNotAllowed: return "HTTP/1.1 405 Method Not Allowed\r\n";
+        case contentTooLarge: return "HTTP/1.1 413 Content Too Large\r\n";
+        case rangeNotSatisfiable: return "HTTP/1.1 416 Range Not Satisfiable\r\n";
+        case requestHeaderFieldsTooLarge: return "HTTP/1.1 431 Request Header Fields Too Large\r\n";
+        case internalServerError: return "HTTP/1.1 500 Internal Server Error\r\n";
+        case notImplemented: return "HTTP/1.1 501 Not Implemented\r\n";
+        case serviceUnavailable: return "HTTP/1.1 503 Service Unavailable\r\n";
+        case variantAlsoNegotiates: return "HTTP/1.1 506 Variant Also Negotiates\r\n";
         }
-        buffers.push_back(Net::Buffer(crlf));
-        if (!content.empty()) buffers.push_back(Net::Buffer(content));
+        return {};
+    }
+
+    /// Serializes the status line and the headers into headerBlock, reused from one response to the other to keep its capacity.
+    /// @return the header block and the content buffers, sent together by a single gathered write
+    template<typename Net>
+    [[nodiscard]] std::array<typename Net::ConstBuffer, 2> toBuffers(std::string& headerBlock) const {
+        constexpr std::string_view separator{": "}, crlf{"\r\n"};
+        auto statusLine = getStatusLine(statusCode);
+        auto size = statusLine.size() + crlf.size();
+        for (auto& header : headers) size += header.name.size() + separator.size() + header.value.size() + crlf.size();
+        if (serialized) size += serialized->headers.size();
+        size += staticHeaders.size() + cacheControl.size();
 
-        return buffers;
+        headerBlock.reserve(size);
+        headerBlock.assign(statusLine);
+        for (auto& header : headers) headerBlock.append(header.name).append(separator).append(header.value).append(crlf);
+        if (serialized) headerBlock.append(serialized->headers);
+        headerBlock.append(staticHeaders);
+        headerBlock.append(cacheControl);
+        headerBlock.append(crlf);
+
+        if (serialized) return {Net::Buffer(std::string_view(headerBlock)), Net::Buffer(std::string_view(serialized->content))};
+        if (fileDescriptor) return {Net::Buffer(std::string_view(headerBlock)), Net::Buffer(std::string_view{})};
+        if (!fileContent.empty()) return {Net::Buffer(std::string_view(headerBlock)), Net::Buffer(fileContent.data(), fileContent.size())};
+        return {Net::Buffer(std::string_view(headerBlock)), Net::Buffer(std::string_view(content))};
+    }
+
+    /// @return true if the end of the content can only be signaled by closing the connection : streamed file of unknown size, not chunked
+    [[nodiscard]] bool isCloseDelimited() const { return streamedFile && !chunked && !streamedFile->size(); }
+
+    [[nodiscard]] size_t contentSize() const {
+        if (fileRange) return fileRange->length;
+        if (fileDescriptor) return fileDescriptor->size;
+        return fileContent.empty() ? content.size() : fileContent.size();
+    }
+
+    /// @return a copy of the headers (serialized) and of the content, to be shared through the ResponseCache
+    [[nodiscard]] std::shared_ptr<const SerializedResponse> serialize(std::string_view encoding, const Validators& validators) const {
+        auto shared = std::make_shared<SerializedResponse>();
+        for (auto& header : headers) shared->headers.append(header.name).append(": ").append(header.value).append("\r\n");
+        shared->headers.append(cacheControl);
+        shared->content = content;
+        shared->encoding = encoding;
+        shared->eTag = validators.eTag;
+        shared->lastModified = validators.lastModified;
+        return shared;
     }
 
 private:
-    [[nodiscard]] static std::string toString(StatusCode code) {
-        switch (code) {
-        case switchingProtocols: return "Switching Protocols";
-        case ok: return "OK";
-        case badRequest: return "Bad Request";
-        case notFound: return "Not Found";
-        case notImplemented: return "Not Implemented";
-        case variantAlsoNegotiates: return "Variant Also Negotiates";
-        }
-        return {};
+    // Reason phrase : the status line without "HTTP/1.1 xyz " and CRLF
+    [[nodiscard]] static constexpr std::string_view toString(StatusCode code) {
+        auto statusLine = getStatusLine(code);
+        return statusLine.empty() ? statusLine : statusLine.substr(13, statusLine.size() - 15);
     }
 };
 
+/// Cache-Control field values sent with the files (RFC9111 5.2.2), none when empty : clients then revalidate with the ETag and
+/// Last-Modified validators, answered by 304 Not Modified. Embedded files only change with the executable, so an application serving
+/// fingerprinted assets may set embedded to "public, max-age=31536000, immutable".
+struct CachePolicy {
+    std::string embedded; ///< Files without a modification time (EmbeddedFS, IndexFS...)
+    std::string native;   ///< Files of a native file system, e.g. "no-cache" to have them revalidated on each use
+};
+
+/// Handler of the requests of a route : its path parameters and query string are views into the request-target
+using RouteHandler = std::function<Response(const Request&, const RouteParameters&)>;
+
+/// Consumer of the body of a request, created by the BodyRouteHandler of its route once the headers have been received. The request and
+/// its views stay valid until onEnd returns.
+struct BodyConsumer {
+    /// Called with each part of the body as it is received, a view of the connection's buffer valid during the call only. The next part is
+    /// read once onData returns : a slow consumer slows the client down (TCP flow control).
+    std::function<void(std::span<const std::byte>)> onData;
+    /// Called once the whole body has been received : @return the response to the request
+    std::function<Response()> onEnd;
+    /// Larger bodies are refused with 413 Content Too Large, ServerOptions::requestBodySizeMax if unset
+    std::optional<uint64_t> sizeMax{};
+};
+
+/// Handler of the requests of a route reading their body : its path parameters and query string are views into the request-target
+using BodyRouteHandler = std::function<BodyConsumer(const Request&, const RouteParameters&)>;
+
+/// Handlers of a route : the requests are answered by respond, or their body is consumed by the consumer returned by receive
+struct Route {
+    RouteHandler respond;
+    BodyRouteHandler receive;
+
+    explicit operator bool() const { return respond || receive; }
+};
+
+/// @return a consumer writing the body to file, without holding it in memory : 201 Created once it is complete, 500 if it cannot be
+/// written. An incomplete upload is removed. file is chosen by the application : names received from the client are to be sanitized.
+inline BodyConsumer uploadTo(std::filesystem::path file, std::optional<uint64_t> sizeMax = {}) {
+    auto sink = std::make_shared<FileSink>(std::move(file));
+    return {[sink](std::span<const std::byte> data) { sink->write(data); },
+            [sink] { return Response::getStatusResponse(sink->commit() ? Response::created : Response::internalServerError); }, sizeMax};
+}
+
 template<networking::Features Net, fs::Provider FS>
 class RequestHandler {
 public:
-    explicit RequestHandler(std::filesystem::path root) : fs(root) {}
+    /// @param cacheSize bytes of responses kept in memory, 0 disables the cache. The entries of a Watchable FS are invalidated on change.
+    /// @param decodedCacheSize bytes of the files decoded for the clients not accepting their content coding, kept in memory
+    /// @param compressedCacheSize bytes of the gzip variants of the compressible files, compressed in the background. 0 disables it.
+    /// @param retryAfter delay announced by the 503 Service Unavailable responses shedding the excess load
+    explicit RequestHandler(std::filesystem::path root, size_t cacheSize = 0, const CachePolicy& cachePolicy = {},
+                            size_t decodedCacheSize = 8 * 1024 * 1024, size_t compressedCacheSize = 16 * 1024 * 1024,
+                            std::chrono::seconds retryAfter = std::chrono::seconds(1))
+        : decodedCache(decodedCacheSize), fs(root), embeddedCacheControl(cacheControlLine(cachePolicy.embedded)),
+          nativeCacheControl(cacheControlLine(cachePolicy.native)), unavailable(unavailableResponse(retryAfter)),
+          unavailableMessage(std::string(Response::getStatusLine(Response::serviceUnavailable))
+                                 .append(unavailable->headers)
+                                 .append("Connection: close\r\n\r\n")
+                                 .append(unavailable->content)) {
+        if (compressedCacheSize > 0) compressed.emplace(compressedCacheSize);
+        if (cacheSize == 0) return;
+        cache.emplace(cacheSize);
+        if constexpr (fs::Watchable<FS>) {
+            if (!fs.watch([this](const std::filesystem::path& changed) {
+                    auto path = changed.generic_string();
+                    cache->invalidate(path);
+                    if (path.ends_with(".gz") || path.ends_with(".br")) cache->invalidate(path.substr(0, path.size() - 3)); // Precompressed sibling
+                })) {
+                log::warn("Response cache disabled : changes of the files in {} cannot be watched", root.string());
+                cache.reset();
+            }
+        }
+    }
     ~RequestHandler() = default;
-    RequestHandler(const RequestHandler&) = default;
-    RequestHandler(RequestHandler&&) = default;
-    RequestHandler& operator=(const RequestHandler&) = default;
-    RequestHandler& operator=(RequestHandler&&) = default;
+    RequestHandler(const RequestHandler&) = delete;
+    RequestHandler(RequestHandler&&) = delete;
+    RequestHandler& operator=(const RequestHandler&) = delete;
+    RequestHandler& operator=(RequestHandler&&) = delete;
+
+    /// Routes the requests of method whose path matches pattern (e.g. "/api/items/{id}") to handler, before the files are looked up. The
+    /// Content-Length of its response is added if missing. A HEAD request is routed to the GET handler if there is no HEAD one.
+    /// Routes are added before the server runs.
+    /// @throw std::invalid_argument if the pattern is malformed or already routed for method
+    void route(Request::Method method, std::string_view pattern, RouteHandler handler) { router.add(method, pattern, {std::move(handler), {}}); }
+
+    /// Routes the requests of method whose path matches pattern to handler, which returns the consumer of their body : see bodyConsumer()
+    /// @throw std::invalid_argument if the pattern is malformed or already routed for method
+    void route(Request::Method method, std::string_view pattern, BodyRouteHandler handler) { router.add(method, pattern, {{}, std::move(handler)}); }
+
+    /// Called by the connection once the headers of request have been received, before its body.
+    /// @return the consumer of the body of request if it is routed to a BodyRouteHandler, nullopt if it is answered by handleRequest().
+    /// The response returned by its onEnd is completed as the one of a RouteHandler, a handler throwing being answered 500.
+    std::optional<BodyConsumer> bodyConsumer(const Request& request) {
+        if (router.isEmpty()) return {};
+        auto match = router.find(request.method, request.uri);
+        if (!match.handler || !match.handler->receive) return {};
+        struct Routed {
+            BodyConsumer consumer;
+            bool failed{false};
+        };
+        auto routed = std::make_shared<Routed>();
+        try {
+            routed->consumer = match.handler->receive(request, match.parameters);
+        }
+        catch (const std::exception& e) {
+            log::error("Handler of {} {} failed : {}", request.getMethodName(), request.uri, e.what());
+            routed->failed = true; // The body is read and ignored
+        }
+        auto context = std::string(request.getMethodName()).append(" ").append(request.uri);
+        return BodyConsumer{[routed, context](std::span<const std::byte> data) {
+                                if (routed->failed || !routed->consumer.onData) return;
+                                try {
+                                    routed->consumer.onData(data);
+                                }
+                                catch (const std::exception& e) {
+                                    log::error("Handler of {} failed : {}", context, e.what());
+                                    routed->failed = true;
+                                }
+                            },
+                            [routed, context] {
+                                if (routed->failed || !routed->consumer.onEnd) return Response::getStatusResponse(Response::internalServerError);
+                                Response response;
+                                try {
+                                    response = routed->consumer.onEnd();
+                                }
+                                catch (const std::exception& e) {
+                                    log::error("Handler of {} failed : {}", context, e.what());
+                                    return Response::getStatusResponse(Response::internalServerError);
+                                }
+                                completeRouted(response);
+                                return response;
+                            },
+                            routed->consumer.sizeMax};
+    }
+
+    Response handleRequest(const Request& request) {
+        if (auto routed = routedResponse(request)) return std::move(*routed);
+        auto response = fileResponse(request);
+        if (request.method == Request::Method::Head) withoutContent(response);
+        return response;
+    }
+
+    /// @return the 503 Service Unavailable response, with its Retry-After field, answering a request shed by the admission control. Its
+    /// headers and content are rendered once by the constructor : building it allocates nothing.
+    [[nodiscard]] Response serviceUnavailable() const {
+        Response response;
+        response.statusCode = Response::serviceUnavailable;
+        response.serialized = unavailable;
+        return response;
+    }
+
+    /// @return the whole message of serviceUnavailable() closing the connection, written as is to the connections shed as soon as accepted
+    [[nodiscard]] std::string_view serviceUnavailableMessage() const { return unavailableMessage; }
+
+    /// Files larger than this, or of unknown size, are streamed by the connection instead of being read whole (and are not cached)
+    static constexpr size_t streamedSizeMin = 64 * 1024;
 
-    Response handleRequest(Request request) {
+private:
+    static constexpr size_t decodedSizeMax = 64 * 1024 * 1024; // Larger files are not decoded : HTTP ERROR 506
+    static constexpr size_t compressedSizeMin = 256, compressedSizeMax = 8 * 1024 * 1024; // Sizes of the files compressed on the fly
+
+    std::optional<ResponseCache> cache; // Declared before fs : the FS watcher calling invalidate() is stopped first
+    ResponseCache decodedCache;         // Identity variant of the encoded files, keyed by path and ETag of the encoded one
+    FS fs;
+    std::string embeddedCacheControl, nativeCacheControl; // Cache-Control lines of the CachePolicy
+    std::optional<CompressionCache> compressed;           // Declared after fs : its worker opening the files is stopped first
+    Router<Request::Method, Route> router;
+    std::shared_ptr<const SerializedResponse> unavailable; // Headers and content of serviceUnavailable()
+    std::string unavailableMessage;
+
+    // Response to a request on a file : HEAD gets the headers of the GET response, its content being dropped by handleRequest()
+    Response fileResponse(const Request& request) {
         auto requestUri = uri::decode(request.uri);
         log::debug("Request uri - raw:'{}' decoded:'{}'", request.uri, requestUri);
         if (requestUri.empty() || requestUri[0] != '/' || requestUri.find("..") != std::string::npos)
@@ -262,93 +709,743 @@ class RequestHandler {
         //uri::URI verifUri{requestUri};
         //log::debug("(URI)   -> Path : {}   Query : {}", verifUri.path, verifUri.query);
         if (!requestPath.has_filename()) requestPath /= "index.html";
+        auto cacheKey = requestPath.generic_string();
+        auto cacheGeneration = cache ? cache->generation() : 0;
+        std::string_view encoding;
+        std::optional<std::string_view> aliasEncoding; // Preferred coding of the client, whose key also caches the response sent in another one
+        std::optional<fs::File> file;
+        Validators validators; // Of the file requested by a GET
 
         Response response;
         switch (request.method) {
+        case Request::Method::Head: {
+            // The header lines of an embedded file known without opening it, if its coding is accepted : otherwise the file is opened
+            // and negotiated as for GET
+            AcceptEncoding accepted{request.getHeaderValue(HeaderField::acceptEncoding)};
+            auto encodings = fs::Negotiable<FS> ? accepted.preferred() : std::span<const std::string_view>{};
+            if (auto headers = fs::headersOf(fs, requestPath, encodings); headers && accepted.quality(staticEncoding(*headers)) > 0) {
+                validators = {staticETag(*headers), {}};
+                if (auto notModified = notModifiedResponse(request, validators)) {
+                    if (headers->find("Vary: ") != std::string_view::npos) notModified->headers.emplace_back("Vary", "Accept-Encoding");
+                    return std::move(*notModified);
+                }
+                response.statusCode = Response::ok;
+                response.staticHeaders = *headers;
+                response.cacheControl = cacheControlOf(validators);
+                return response;
+            }
+            [[fallthrough]];
+        }
         case Request::Method::Get: {
-            if (request.isUpgradeRequest("websocket")) {
-                auto key = request.getHeaderValue("Sec-WebSocket-Key");
+            bool get = request.method == Request::Method::Get;
+            if (get && request.isUpgradeRequest("websocket")) {
+                auto key = request.getHeaderValue(HeaderField::secWebSocketKey);
                 if (key) {
                     response.statusCode = Response::StatusCode::switchingProtocols;
                     response.headers.emplace_back("Upgrade", "websocket");
                     response.headers.emplace_back("Connection", "Upgrade");
-                    response.headers.emplace_back("Sec-WebSocket-Accept", websocket::getHashedSecKey(key.value()));
+                    response.headers.emplace_back("Sec-WebSocket-Accept", websocket::getHashedSecKey(std::string(*key)));
                     response.headers.emplace_back("Sec-WebSocket-Protocol", "WebFront_0.1");
                     return response;
                 }
             }
 
-            auto file = fs.open(requestPath);
-            if (!file) return Response::getStatusResponse(Response::notFound);
-            if (file->isEncoded()) {
-                if (!request.headersContain("Accept-Encoding", file->getEncoding())) {
-                    log::error("File {} encoding is not supported by client : HTTP ERROR 506", file->getEncoding());
-                    return Response::getStatusResponse(Response::variantAlsoNegotiates);
+            AcceptEncoding accepted{request.getHeaderValue(HeaderField::acceptEncoding)};
+            // The cache holds whole files, serialized with their content : HEAD builds its headers from the file
+            auto range = get ? request.getHeaderValue(HeaderField::range) : std::nullopt;
+            auto acceptable = [&](const SerializedResponse& cached) {
+                return accepted.quality(cached.encoding) > 0 && !(cached.encoding.empty() && compresses(requestPath, accepted));
+            };
+            // Responses are cached by path and content coding : a client looks up the one of its preferred coding, under whose key the
+            // response negotiated for it is also cached if its coding is another one (no such variant)
+            auto preferred = accepted.preferred();
+            if (auto cached = cache && get && !range && !preferred.empty() ? cache->find(responseKey(cacheKey, preferred.front())) : nullptr;
+                cached && acceptable(*cached)) {
+                validators = {cached->eTag, cached->lastModified};
+                if (auto notModified = notModifiedResponse(request, validators)) return std::move(*notModified);
+                response.statusCode = Response::ok;
+                response.serialized = std::move(cached);
+                return response;
+            }
+
+            auto opened = [&] {
+                if constexpr (fs::Negotiable<FS>) return fs.open(requestPath, accepted.preferred());
+                else return fs.open(requestPath);
+            }();
+            if (!opened) return Response::getStatusResponse(Response::notFound);
+            // Encoded files may be decoded, compressible ones compressed, and the variants of a Negotiable FS list Vary in their static lines
+            bool varies = opened->isEncoded() || opened->headers().find("Vary: ") != std::string_view::npos ||
+                          (opened->headers().empty() && MimeType(requestPath.extension().string()).isCompressible());
+            auto negotiated = [varies](Response negotiatedResponse) {
+                if (varies && negotiatedResponse.staticHeaders.find("Vary: ") == std::string_view::npos)
+                    negotiatedResponse.headers.emplace_back("Vary", "Accept-Encoding");
+                return negotiatedResponse;
+            };
+            if (accepted.quality(opened->getEncoding()) == 0) {
+                auto identity = decoded(cacheKey, *opened);
+                if (!identity) return Response::getStatusResponse(Response::variantAlsoNegotiates);
+                file.emplace(std::move(*identity));
+            } else if (auto variant = range ? std::nullopt : compressedVariant(cacheKey, requestPath, *opened, accepted))
+                file.emplace(std::move(*variant));
+            else
+                file.emplace(std::move(*opened)); // Kept until the response is cached : validators refers to its ETag
+            validators = {file->eTag(), file->lastModified()};
+            if (auto notModified = notModifiedResponse(request, validators)) return negotiated(std::move(*notModified));
+            response.cacheControl = cacheControlOf(validators);
+            // A Range whose If-Range validator does not match the file is ignored : the whole file is sent
+            auto ifRange = request.getHeaderValue(HeaderField::ifRange);
+            if (range && file->size() && (!ifRange || validators.rangeApplies(*ifRange))) {
+                auto rangeSet = RangeSet::parse(*range, *file->size());
+                if (rangeSet.status != RangeSet::Status::ignored) {
+                    if (auto partial = partialResponse(requestPath, *file, rangeSet, validators, response.cacheControl))
+                        return negotiated(std::move(*partial));
                 }
             }
+            if (!file->headers().empty()) { // Embedded file : headers and content are static, nothing to build
+                response.statusCode = Response::ok;
+                response.staticHeaders = file->headers();
+                response.fileContent = file->contiguous();
+                return response;
+            }
 
-            std::array<char, 512> buffer{0, 0};
-            while (auto bytesRead = file->read(buffer)) response.content.append(buffer.data(), bytesRead);
+            addValidators(response, validators);
+            if (varies) response.headers.emplace_back("Vary", "Accept-Encoding");
+            response.fileContent = file->contiguous();
+            response.fileContentOwner = file->contiguousOwner();
+            response.fileDescriptor = file->nativeDescriptor();
             if (file->isEncoded()) response.headers.emplace_back("Content-Encoding", file->getEncoding());
+            encoding = file->getEncoding();
+            if (!preferred.empty() && preferred.front() != encoding && !(encoding.empty() && compresses(requestPath, accepted)))
+                aliasEncoding = preferred.front();
+            if (response.fileContent.empty() && !response.fileDescriptor) {
+                if (auto size = file->size(); !size || *size > streamedSizeMin) return streamed(request, requestPath, std::move(*file), std::move(response));
+                std::array<char, 512> buffer{0, 0};
+                while (auto bytesRead = file->read(buffer)) response.content.append(buffer.data(), bytesRead);
+            }
 
         } break;
-        case Request::Method::Head:
-            if (!fs.open(requestPath)) return Response::getStatusResponse(Response::notFound);
-            break;
-
         default: return Response::getStatusResponse(Response::notImplemented);
         };
 
         response.statusCode = Response::ok;
-        response.headers.emplace_back("Content-Length", std::to_string(response.content.size()));
+        response.headers.emplace_back("Content-Length", std::to_string(response.contentSize()));
         response.headers.emplace_back("Content-Type", MimeType(requestPath.extension().string()).toString());
+        response.headers.emplace_back("Accept-Ranges", "bytes");
+        // Contiguous file contents are already in memory and native files are sent by the kernel : caching would only copy them
+        if (cache && request.method == Request::Method::Get && response.fileContent.empty() && !response.fileDescriptor) {
+            auto serialized = response.serialize(encoding, validators);
+            if (aliasEncoding) cache->insert(responseKey(cacheKey, *aliasEncoding), serialized, cacheGeneration);
+            cache->insert(responseKey(cacheKey, encoding), std::move(serialized), cacheGeneration);
+        }
 
         return response;
     }
 
-private:
-    FS fs;
+    // Key of the cached response of path in the content coding encoding ("" for identity)
+    static std::string responseKey(const std::string& path, std::string_view encoding) { return path + '\n' + std::string(encoding); }
+
+    static std::shared_ptr<const SerializedResponse> unavailableResponse(std::chrono::seconds retryAfter) {
+        auto response = Response::getStatusResponse(Response::serviceUnavailable);
+        response.headers.emplace_back("Retry-After", std::to_string(retryAfter.count()));
+        return response.serialize({}, {});
+    }
+
+    /// @return the response of the route of request, 405 if its path is only routed for other methods, nullopt if it is not routed
+    std::optional<Response> routedResponse(const Request& request) const {
+        if (router.isEmpty()) return {};
+        auto match = router.find(request.method, request.uri);
+        bool head = request.method == Request::Method::Head;
+        if (!match.handler && head) {
+            auto get = router.find(Request::Method::Get, request.uri);
+            get.allowed |= match.allowed;
+            match = std::move(get);
+        }
+        if (!match.handler || !match.handler->respond) {
+            if (match.allowed.none()) return {};
+            auto response = Response::getStatusResponse(Response::methodNotAllowed);
+            std::string allowed;
+            for (size_t index = 0; index < match.allowed.size(); ++index) {
+                if (!match.allowed.test(index)) continue;
+                auto method = static_cast<Request::Method>(index);
+                allowed.append(allowed.empty() ? "" : ", ").append(Request::getMethodName(method));
+                if (method == Request::Method::Get && !match.allowed.test(static_cast<size_t>(Request::Method::Head))) allowed.append(", HEAD");
+            }
+            response.headers.emplace_back("Allow", std::move(allowed));
+            return response;
+        }
+
+        Response response;
+        try {
+            response = match.handler->respond(request, match.parameters);
+        }
+        catch (const std::exception& e) {
+            log::error("Handler of {} {} failed : {}", request.getMethodName(), request.uri, e.what());
+            return Response::getStatusResponse(Response::internalServerError);
+        }
+        completeRouted(response);
+        if (head) response.content.clear();
+        return response;
+    }
+
+    // HEAD : keeps the headers of the response, Content-Length included, and drops its content
+    static void withoutContent(Response& response) {
+        response.content.clear();
+        response.fileContent = {};
+        response.fileContentOwner.reset();
+        response.fileDescriptor.reset();
+        response.streamedFile.reset();
+        response.chunked = false;
+        response.fileRange.reset();
+    }
+
+    static void completeRouted(Response& response) {
+        if (response.statusCode != Response::noContent && response.statusCode != Response::notModified && !response.getHeaderValue("Content-Length"))
+            response.headers.emplace_back("Content-Length", std::to_string(response.contentSize()));
+    }
+
+    static Response streamed(const Request& request, const std::filesystem::path& requestPath, fs::File file, Response response) {
+        response.statusCode = Response::ok;
+        if (auto size = file.size()) {
+            response.headers.emplace_back("Content-Length", std::to_string(*size));
+            response.headers.emplace_back("Accept-Ranges", "bytes");
+        } else if (request.httpVersionMajor > 1 || (request.httpVersionMajor == 1 && request.httpVersionMinor >= 1)) {
+            response.headers.emplace_back("Transfer-Encoding", "chunked");
+            response.chunked = true;
+        }
+        response.headers.emplace_back("Content-Type", MimeType(requestPath.extension().string()).toString());
+        response.streamedFile = std::make_shared<fs::File>(std::move(file));
+        return response;
+    }
+
+    /// @return the 206 response holding the satisfiable ranges of file (416 if none is), nullopt if several ranges are requested whose
+    /// total size is too large for the multipart/byteranges body to be held in memory : the whole file is then sent.
+    static std::optional<Response> partialResponse(const std::filesystem::path& requestPath, fs::File& file, const RangeSet& rangeSet,
+                                                   const Validators& validators, std::string_view cacheControl) {
+        auto size = *file.size();
+        if (rangeSet.status == RangeSet::Status::unsatisfiable) {
+            auto response = Response::getStatusResponse(Response::rangeNotSatisfiable);
+            response.headers.emplace_back("Content-Range", "bytes */" + std::to_string(size));
+            return response;
+        }
+        auto& ranges = rangeSet.ranges;
+        size_t rangesSize = 0;
+        for (auto& range : ranges) rangesSize += range.length;
+        if (ranges.size() > 1 && rangesSize > streamedSizeMin) return {};
+
+        Response response;
+        response.statusCode = Response::partialContent;
+        response.cacheControl = cacheControl;
+        auto contentType = MimeType(requestPath.extension().string()).toString();
+        auto staticLines = file.headers();
+        if (staticLines.empty()) addValidators(response, validators); // Static lines hold the ETag of an embedded file
+        if (ranges.size() == 1) {
+            auto range = ranges.front();
+            response.headers.emplace_back("Content-Range", range.contentRange(size));
+            response.headers.emplace_back("Content-Length", std::to_string(range.length));
+            if (!staticLines.empty())
+                response.staticHeaders = staticLines.substr(staticLines.find("\r\n") + 2); // All the lines but Content-Length, the first one
+            else {
+                response.headers.emplace_back("Content-Type", contentType);
+                if (file.isEncoded()) response.headers.emplace_back("Content-Encoding", file.getEncoding());
+            }
+
+            if (auto bytes = file.contiguous(); !bytes.empty()) {
+                response.fileContent = bytes.subspan(range.offset, range.length);
+                response.fileContentOwner = file.contiguousOwner();
+            } else if (auto descriptor = file.nativeDescriptor()) {
+                response.fileDescriptor = std::move(descriptor);
+                response.fileRange = range;
+            } else if (!file.seek(range.offset))
+                return Response::getStatusResponse(Response::internalServerError);
+            else if (range.length > streamedSizeMin) {
+                response.streamedFile = std::make_shared<fs::File>(std::move(file));
+                response.fileRange = range;
+            } else if (!readRange(file, range.length, response.content))
+                return Response::getStatusResponse(Response::internalServerError);
+            return response;
+        }
+
+        constexpr std::string_view boundary{"WebFront-byteranges-5c2e9a71f04b"}; // Not expected in a file : RFC2046 5.1.1
+        response.headers.emplace_back("Content-Type", "multipart/byteranges; boundary=" + std::string(boundary));
+        if (file.isEncoded()) response.headers.emplace_back("Content-Encoding", file.getEncoding());
+        if (auto eTag = staticLines.find("ETag: "); eTag != std::string_view::npos)
+            response.staticHeaders = staticLines.substr(eTag, staticLines.find("\r\n", eTag) + 2 - eTag);
+        for (auto& range : ranges) {
+            response.content.append("\r\n--").append(boundary).append("\r\nContent-Type: ").append(contentType);
+            response.content.append("\r\nContent-Range: ").append(range.contentRange(size)).append("\r\n\r\n");
+            if (!file.seek(range.offset) || !readRange(file, range.length, response.content))
+                return Response::getStatusResponse(Response::internalServerError);
+        }
+        response.content.append("\r\n--").append(boundary).append("--\r\n");
+        response.headers.emplace_back("Content-Length", std::to_string(response.content.size()));
+        return response;
+    }
+
+    /// @return the 304 response answering a request whose preconditions show that the client's copy of the file is still valid
+    std::optional<Response> notModifiedResponse(const Request& request, const Validators& validators) const {
+        if (!validators.notModified(request.getHeaderValue(HeaderField::ifNoneMatch), request.getHeaderValue(HeaderField::ifModifiedSince)))
+            return {};
+        Response response;
+        response.statusCode = Response::notModified;
+        // RFC9110 15.4.5 : the fields a 200 response would hold to update the cache, Last-Modified being useless with an ETag
+        if (!validators.eTag.empty()) response.headers.emplace_back("ETag", validators.eTag);
+        else if (validators.lastModified) response.headers.emplace_back("Last-Modified", toHTTPDate(*validators.lastModified));
+        response.cacheControl = cacheControlOf(validators);
+        return response;
+    }
+
+    std::string_view cacheControlOf(const Validators& validators) const {
+        return validators.lastModified ? nativeCacheControl : embeddedCacheControl;
+    }
+
+    static std::string cacheControlLine(std::string_view policy) { return policy.empty() ? std::string{} : "Cache-Control: " + std::string(policy) + "\r\n"; }
+
+    static void addValidators(Response& response, const Validators& validators) {
+        if (!validators.eTag.empty()) response.headers.emplace_back("ETag", validators.eTag);
+        if (validators.lastModified) response.headers.emplace_back("Last-Modified", toHTTPDate(*validators.lastModified));
+    }
+
+    /// @return the value of the ETag line of the header lines of an embedded file, empty if it has none
+    static std::string_view staticETag(std::string_view staticLines) {
+        constexpr std::string_view name{"ETag: "};
+        auto line = staticLines.find(name);
+        if (line == std::string_view::npos) return {};
+        auto value = staticLines.substr(line + name.size());
+        return value.substr(0, value.find("\r\n"));
+    }
+
+    /// @return the content coding of the header lines of an embedded file, empty if it has none
+    static std::string_view staticEncoding(std::string_view staticLines) {
+        constexpr std::string_view name{"Content-Encoding: "};
+        auto line = staticLines.find(name);
+        if (line == std::string_view::npos) return {};
+        auto value = staticLines.substr(line + name.size());
+        return value.substr(0, value.find("\r\n"));
+    }
+
+    /// Appends the next length bytes of file to content
+    static bool readRange(fs::File& file, size_t length, std::pmr::string& content) {
+        auto begin = content.size();
+        content.resize(begin + length);
+        for (auto next = begin; next < content.size();) {
+            auto count = file.read(std::span{content}.subspan(next));
+            if (count == 0) return false;
+            next += count;
+        }
+        return true;
+    }
+
+    /// @return true if the gzip variant of a file of requestPath is to be sent : compressible type, gzip preferred to identity
+    bool compresses(const std::filesystem::path& requestPath, const AcceptEncoding& accepted) const {
+        auto gzip = accepted.quality("gzip");
+        return compressed && gzip > 0 && gzip >= accepted.quality("") && MimeType(requestPath.extension().string()).isCompressible();
+    }
+
+    /// @return the gzip variant of a native file to be sent without content coding, nullopt if the variant is not to be sent, or is not
+    /// compressed yet : its compression is then scheduled, and the file is sent as is meanwhile.
+    std::optional<fs::File> compressedVariant(const std::string& path, const std::filesystem::path& requestPath, const fs::File& file,
+                                              const AcceptEncoding& accepted) {
+        auto size = file.size();
+        if (!compresses(requestPath, accepted) || file.isEncoded() || !file.headers().empty() || file.eTag().empty() || !size ||
+            *size < compressedSizeMin || *size > compressedSizeMax)
+            return {};
+        auto key = path + '\n' + std::string(file.eTag());
+        auto variant = compressed->find(key);
+        if (!variant) {
+            compressed->schedule(key, file.eTag(), file.lastModified(), [this, requestPath, eTag = std::string(file.eTag())]() -> std::optional<std::string> {
+                auto identity = fs.open(requestPath);
+                if (!identity || identity->isEncoded() || identity->eTag() != eTag) return {};
+                return readAll(*identity);
+            });
+            return {};
+        }
+        if (variant->encoding.empty()) return {}; // Incompressible : sent as is
+        fs::File gzipped{std::as_bytes(std::span{variant->content}), variant, variant->eTag};
+        gzipped.setEncoding(variant->encoding);
+        gzipped.setLastModified(variant->lastModified);
+        return gzipped;
+    }
+
+    static std::string readAll(fs::File& file) {
+        if (auto bytes = file.contiguous(); !bytes.empty()) return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+        std::string content;
+        std::array<char, 4096> buffer;
+        while (auto bytesRead = file.read(buffer)) content.append(buffer.data(), bytesRead);
+        return content;
+    }
+
+    /// @return the identity variant of an encoded file, for a client not accepting its coding : it is decoded once, then shared through
+    /// the decoded files cache. nullopt if its coding cannot be decoded (only gzip and deflate can).
+    std::optional<fs::File> decoded(const std::string& path, fs::File& file) {
+        auto key = path + '\n' + std::string(file.eTag()); // Another content of the same path has another ETag
+        auto entry = decodedCache.find(key);
+        if (!entry) {
+            auto generation = decodedCache.generation();
+            std::string encoded;
+            auto bytes = file.contiguous();
+            if (bytes.empty()) {
+                encoded = readAll(file);
+                bytes = std::as_bytes(std::span{encoded});
+            }
+            std::optional<std::string> content;
+            if (file.getEncoding() == "gzip") content = utils::gunzip(bytes, decodedSizeMax);
+            else if (file.getEncoding() == "deflate") content = utils::unzlib(bytes, decodedSizeMax);
+            if (!content) {
+                log::error("File {} encoding is not supported by client and cannot be decoded : HTTP ERROR 506", file.getEncoding());
+                return {};
+            }
+            auto identity = std::make_shared<SerializedResponse>();
+            identity->content = std::move(*content);
+            if (auto eTag = file.eTag(); !eTag.empty()) identity->eTag = std::string(eTag.substr(0, eTag.size() - 1)) + "-identity\"";
+            decodedCache.insert(key, identity, generation);
+            entry = std::move(identity);
+        }
+        std::string_view eTag{entry->eTag};
+        return fs::File{std::as_bytes(std::span{entry->content}), std::move(entry), eTag};
+    }
 };
 
+/// Active connections of a shard, linked through their hook (utils::IntrusiveList) : starting and stopping a connection allocates nothing. The
+/// list does not own them : a connection is kept alive by its pending operations, and unlinks itself once recycled.
 template<typename ConnectionType>
 class Connections {
 public:
     Connections() = default;
     Connections(const Connections&) = delete;
-    Connections(Connections&&) = default;
+    Connections(Connections&&) = delete;
     Connections& operator=(const Connections&) = delete;
-    Connections& operator=(Connections&&) = default;
+    Connections& operator=(Connections&&) = delete;
     ~Connections() = default;
 
-    void start(std::shared_ptr<ConnectionType> connection) {
+    template<typename Socket>
+    void start(const std::shared_ptr<ConnectionType>& connection, Socket&& socket) {
         log::debug("Start connection 0x{:016x}", reinterpret_cast<std::uintptr_t>(connection.get()));
-        connections.insert(connection);
-        connection->start();
+        {
+            std::scoped_lock lock(mutex);
+            active.pushBack(*connection);
+        }
+        connection->start(std::forward<Socket>(socket));
     }
 
-    void stop(std::shared_ptr<ConnectionType> connection) {
+    void stop(const std::shared_ptr<ConnectionType>& connection) {
         log::debug("Stop connection 0x{:016x}", reinterpret_cast<std::uintptr_t>(connection.get()));
-        connections.erase(connection);
+        erase(*connection);
         connection->stop();
     }
 
+    /// Unlinks connection, called when it is recycled
+    void erase(ConnectionType& connection) {
+        std::scoped_lock lock(mutex);
+        active.erase(connection);
+    }
+
     void stopAll() {
-        for (auto connection : connections) connection->stop();
-        connections.clear();
+        std::vector<std::shared_ptr<ConnectionType>> stopping;
+        {
+            std::scoped_lock lock(mutex);
+            stopping.reserve(active.size());
+            active.forEach([&stopping](ConnectionType& connection) {
+                if (auto owned = connection.weak_from_this().lock()) stopping.push_back(std::move(owned)); // Not being recycled
+            });
+            active.clear();
+        }
+        for (auto& connection : stopping) connection->stop();
+    }
+
+    [[nodiscard]] size_t size() const {
+        std::scoped_lock lock(mutex);
+        return active.size();
     }
 
 private:
-    std::set<std::shared_ptr<ConnectionType>> connections;
+    mutable std::mutex mutex;
+    utils::IntrusiveList<ConnectionType> active;
 };
 
-enum class Protocol { HTTP, HTTPUpgrading, WebSocket };
+struct ServerOptions {
+    /// Number of threads running the server's io_context. Each connection is serialized on its own strand.
+    size_t threadsCount{1};
+    /// Shared-nothing mode when above 1 : count of shards, each one running its own io_context on a thread pinned to a core, with its own
+    /// SO_REUSEPORT acceptor, connections, timeouts and RequestHandler (threadsCount is ignored). The caches of the RequestHandler are not
+    /// shared : their sizes below are per shard. See Server.
+    size_t shardsCount{0};
+    /// Number of requests served on a persistent connection before it is closed (1 disables keep-alive).
+    size_t keepAliveMaxRequests{100};
+    /// Delay after which a connection waiting for its next request is closed.
+    std::chrono::milliseconds keepAliveTimeout{std::chrono::seconds(5)};
+    /// Delay given to a client to send the header block of a request, from its connection or from the first bytes of a persistent connection's
+    /// next request : a slowloris sending its fields byte by byte is closed.
+    std::chrono::milliseconds headerTimeout{std::chrono::seconds(10)};
+    /// Delay after which a connection receiving a request body is closed if no part of it has been received.
+    std::chrono::milliseconds bodyTimeout{std::chrono::seconds(30)};
+    /// Bytes of the bodies accepted by the routes reading them, unless their BodyConsumer sets its own limit : 413 Content Too Large above.
+    uint64_t requestBodySizeMax{1024 * 1024};
+    /// Cleartext HTTP/2 (h2c) for the clients starting with its preface (prior knowledge) or asking for Upgrade: h2c : their requests are
+    /// multiplexed on a single connection. Browsers only speak HTTP/2 over TLS : h2c serves the other clients, or a TLS-terminating proxy.
+    bool http2{true};
+    /// Streams of an HTTP/2 connection open at once : the following ones are refused (REFUSED_STREAM), the client retrying them later.
+    uint32_t http2MaxConcurrentStreams{100};
+    /// Delay after which a connection whose response makes no progress (the client does not read it) is closed : detected between one and two
+    /// delays after the last bytes sent.
+    std::chrono::milliseconds writeTimeout{std::chrono::seconds(30)};
+    /// Delay after which a silent WebSocket is pinged, then closed if still silent after another one (0 disables the pings).
+    std::chrono::milliseconds webSocketPingInterval{std::chrono::seconds(30)};
+    /// Period of the timing wheel driving the timeouts of all the connections : precision of the timeouts.
+    std::chrono::milliseconds timeoutsTick{std::chrono::milliseconds(100)};
+    /// Bytes of serialized responses kept in memory by the RequestHandler (0 disables the response cache).
+    size_t responseCacheSize{0};
+    /// Size of the chunks of the streamed files (larger than RequestHandler::streamedSizeMin or of unknown size) : bytes of file held
+    /// in memory by a connection while it sends one.
+    size_t streamChunkSize{16 * 1024};
+    /// Cache-Control header fields sent with the files.
+    CachePolicy cachePolicy{};
+    /// Bytes of the files decoded for the clients not accepting their content coding (e.g. gzip), kept in memory by the RequestHandler.
+    size_t decodedCacheSize{8 * 1024 * 1024};
+    /// Bytes of the gzip variants of the compressible native files without precompressed sibling (app.js.gz), compressed in the
+    /// background and kept in memory by the RequestHandler. 0 disables the compression on the fly.
+    size_t compressedCacheSize{16 * 1024 * 1024};
+    /// HTTP connections open at once, all shards together (0 for no limit) : the following ones are answered 503 Service Unavailable as soon
+    /// as accepted, then closed. Connections upgraded to WebSocket are no longer counted.
+    size_t connectionsMax{0};
+    /// Requests being answered at once, from the reception of their header to the end of their response, all connections and HTTP/2 streams
+    /// together (0 for no limit) : the following ones are answered 503 Service Unavailable without being handled.
+    size_t requestsInFlightMax{0};
+    /// Connections accepted per second from a client IP address in the long run (0 for no limit) : the following ones are answered 503
+    /// Service Unavailable as soon as accepted, then closed. Each shard limits its share of it, the kernel spreading the connections of a
+    /// client among the shards.
+    double clientConnectionsRate{0};
+    /// Connections of a client IP address accepted at once, before clientConnectionsRate applies
+    double clientConnectionsBurst{16};
+    /// Client IP addresses whose connection rates are tracked by each shard : beyond, the least recently seen ones are forgotten.
+    size_t clientsTracked{4096};
+    /// Delay announced by the Retry-After field of the 503 Service Unavailable responses
+    std::chrono::seconds retryAfter{std::chrono::seconds(1)};
+    /// Bytes held at once by the connections and the WebSocket links (read buffers, response contents, received messages, pending writes),
+    /// all shards together (0 for no limit, the usage being accounted anyway : Server::memory()). When it is exhausted, the connections are
+    /// refused and the responses replaced by 503 Service Unavailable, the messages sent to the links are dropped and the links receiving
+    /// a message are closed.
+    size_t memoryBudget{0};
+    /// Bytes of response held at once by a connection (0 for no limit) : a larger response is replaced by 503 Service Unavailable.
+    size_t connectionMemoryMax{0};
+    /// Bytes held at once by a WebSocket link, message being received and messages waiting to be sent (0 for no limit) : a link exceeding
+    /// it is closed, e.g. a client not reading its messages.
+    size_t webSocketMemoryMax{64 * 1024 * 1024};
+    /// Size of the messages received by a WebSocket link : a larger one closes it (1009 Message Too Big) before its payload is allocated.
+    uint64_t webSocketMessageSizeMax{16 * 1024 * 1024};
+    /// Options of the listening and accepted sockets (networking::SocketTuning) : lowLatency for interactive clients, throughput for bulk
+    /// transfers. throughput defers the accept of a connection until its first request (TCP_DEFER_ACCEPT) : the connections refused by the
+    /// admission control are only answered then.
+    networking::SocketProfile socketProfile{networking::SocketProfile::system};
+    /// Profile of the WebSocket links once upgraded, for the messages sent without a profile of their own (see WebSocket::write())
+    networking::SocketProfile webSocketProfile{networking::SocketProfile::lowLatency};
+};
 
+/// Streams of a connection switched to HTTP/2 : their requests are answered by the RequestHandler as the HTTP/1.1 ones, the bodies of
+/// the responses being handed to the http2::Session without copy (streamed and native files chunk by chunk). Handler of session.
 template<networking::Features Net, fs::Provider FS>
-class Connection : public std::enable_shared_from_this<Connection<Net, FS>> {
+class HTTP2Streams {
+public:
+    /// Window of the request bodies announced to the clients : an upload is not slowed down by round trips waiting for WINDOW_UPDATE
+    static constexpr uint32_t windowSize = 1024 * 1024;
+
+    HTTP2Streams(RequestHandler<Net, FS>& handler, Admission& admissionControl, utils::MemoryBudget::Account& memoryAccount,
+                 const ServerOptions& serverOptions)
+        : requestHandler(handler), admission(admissionControl), memory(memoryAccount), options(serverOptions),
+          session(*this, {.concurrentStreamsMax = serverOptions.http2MaxConcurrentStreams, .windowSize = windowSize}) {}
+    ~HTTP2Streams() {
+        for (auto& [streamId, exchange] : exchanges) memory.release(exchange.charged);
+    }
+    HTTP2Streams(const HTTP2Streams&) = delete;
+    HTTP2Streams(HTTP2Streams&&) = delete;
+    HTTP2Streams& operator=(const HTTP2Streams&) = delete;
+    HTTP2Streams& operator=(HTTP2Streams&&) = delete;
+
+    /// Answers by HTTP/2 on the stream 1 an HTTP/1.1 request upgraded to h2c (RFC7540 3.2), its body being empty
+    /// @return false if its HTTP2-Settings field is invalid
+    bool upgrade(const Request& request) {
+        if (!session.upgrade(request.getHeaderValue(HeaderField::http2Settings).value_or(""))) return false;
+        std::vector<hpack::Field> fields{{":method", request.getMethodName()}, {":scheme", "http"}, {":path", request.uri}};
+        for (auto& header : request.headers)
+            if (header.field != HeaderField::connection && header.field != HeaderField::upgrade && header.field != HeaderField::http2Settings)
+                fields.emplace_back(header.name, header.value);
+        onRequest(1, fields, true);
+        return true;
+    }
+
+    void onRequest(uint32_t streamId, std::span<const hpack::Field> fields, bool endStream) {
+        auto& exchange = exchanges[streamId];
+        auto& request = exchange.request;
+        auto& text = exchange.fields;
+        size_t size = 0;
+        for (auto [name, value] : fields) size += name.size() + value.size() + 2;
+        text.reserve(size); // The views of request into text are not invalidated by the appends
+        auto keep = [&text](std::string_view part) {
+            auto start = text.size();
+            text.append(part);
+            return std::string_view(text).substr(start);
+        };
+        std::string_view authority;
+        for (auto [name, value] : fields) {
+            if (name == ":method") request.setMethod(value);
+            else if (name == ":path") request.uri = keep(value);
+            else if (name == ":authority") authority = keep(value);
+            else if (name != "cookie" && !name.starts_with(':')) request.addHeader(keep(name), keep(value));
+        }
+        auto cookieStart = text.size(); // The cookie pairs may be sent as separate fields (RFC9113 8.2.3)
+        for (auto [name, value] : fields)
+            if (name == "cookie") text.append(text.size() > cookieStart ? "; " : "").append(value);
+        if (text.size() > cookieStart) request.addHeader("cookie", std::string_view(text).substr(cookieStart));
+        if (!authority.empty() && !request.getHeaderValue(HeaderField::host)) request.addHeader("host", authority);
+        request.httpVersionMajor = 2;
+
+        log::info("Received HTTP/2 request {} on {}", request.getMethodName(), request.uri);
+        exchange.admitted = admission.enterRequest();
+        if (!exchange.admitted) return respond(streamId, exchange, requestHandler.serviceUnavailable());
+        if (auto consumer = requestHandler.bodyConsumer(request)) {
+            auto decoder = request.bodyDecoder();
+            if (!decoder) return respond(streamId, exchange, Response::getStatusResponse(Response::badRequest));
+            exchange.bodySizeMax = consumer->sizeMax.value_or(options.requestBodySizeMax);
+            if (decoder->length().value_or(0) > exchange.bodySizeMax)
+                return respond(streamId, exchange, Response::getStatusResponse(Response::contentTooLarge));
+            exchange.consumer = std::move(*consumer);
+            if (endStream) onData(streamId, {}, true);
+            return;
+        }
+        respond(streamId, exchange, requestHandler.handleRequest(request));
+    }
+
+    void onData(uint32_t streamId, std::span<const std::byte> data, bool endStream) {
+        auto found = exchanges.find(streamId);
+        if (found == exchanges.end() || !found->second.consumer) return; // Body of a request answered without reading it
+        auto& exchange = found->second;
+        if ((exchange.bodySize += data.size()) > exchange.bodySizeMax) {
+            exchange.consumer.reset(); // An incomplete upload is discarded by its consumer's destruction
+            return respond(streamId, exchange, Response::getStatusResponse(Response::contentTooLarge));
+        }
+        if (!data.empty()) exchange.consumer->onData(data);
+        if (!endStream) return;
+        auto consumer = std::move(*std::exchange(exchange.consumer, std::nullopt));
+        respond(streamId, exchange, consumer.onEnd());
+    }
+
+    std::pair<std::span<const std::byte>, bool> readBody(uint32_t streamId, size_t sizeMax) {
+        auto found = exchanges.find(streamId);
+        if (found == exchanges.end()) return {{}, true};
+        auto& exchange = found->second;
+        if (!exchange.file) {
+            auto part = exchange.body.first(std::min(sizeMax, exchange.body.size()));
+            exchange.body = exchange.body.subspan(part.size());
+            return {part, exchange.body.empty()};
+        }
+        exchange.chunk.resize(std::min({sizeMax, options.streamChunkSize, exchange.fileLeft.value_or(sizeMax)}));
+        auto size = exchange.file->read(std::span{exchange.chunk});
+        if (exchange.fileLeft) *exchange.fileLeft -= size;
+        auto last = size == 0 || exchange.file->eof() || exchange.fileLeft == 0; // A file truncated meanwhile ends its response early
+        return {std::as_bytes(std::span{exchange.chunk}.first(size)), last};
+    }
+
+    void onClose(uint32_t streamId) {
+        auto found = exchanges.find(streamId);
+        if (found == exchanges.end()) return;
+        memory.release(found->second.charged);
+        exchanges.erase(found);
+    }
+
+private:
+    // Request of a stream and its response
+    struct Exchange {
+        std::string fields; // Text of the fields of request, which views it
+        Request request;
+        std::optional<BodyConsumer> consumer;
+        uint64_t bodySize{0}, bodySizeMax{0};
+        Response response;
+        std::span<const std::byte> body;  // Part of the content of response left to send
+        std::shared_ptr<fs::File> file;   // File of response read chunk by chunk, instead of body
+        std::optional<size_t> fileLeft;   // Bytes of file left to send, unknown if unset
+        std::vector<char> chunk;          // Chunk of file being sent
+        Admission::Ticket admitted;       // Held until the stream is closed
+        size_t charged{0};                // Bytes of the response reserved from the memory of the connection
+    };
+
+    RequestHandler<Net, FS>& requestHandler;
+    Admission& admission;
+    utils::MemoryBudget::Account& memory;
+    const ServerOptions& options;
+    std::map<uint32_t, Exchange> exchanges;
+    std::string status, names;              // Text of the fields of the response being sent
+    std::vector<hpack::Field> responseFields;
+
 public:
-    explicit Connection(typename Net::Socket sock, Connections<Connection>& connectionsHandler,
-                        RequestHandler<Net, FS>& handler)
-        : socket(std::move(sock)), connections(connectionsHandler), requestHandler(handler) {
+    http2::Session<HTTP2Streams> session;
+
+private:
+    // Sends response as header fields (lowercase names, without the connection-specific ones) followed by its body
+    void respond(uint32_t streamId, Exchange& exchange, Response response) {
+        log::info("  responding http/2 {}", static_cast<int>(response.statusCode));
+        memory.release(std::exchange(exchange.charged, 0));
+        if (!memory.reserve(response.content.size())) {
+            log::warn("Response of {} bytes exceeding the memory budget : 503", response.content.size());
+            response = requestHandler.serviceUnavailable();
+        }
+        else
+            exchange.charged = response.content.size();
+        auto& sent = exchange.response = std::move(response);
+        std::vector<std::pair<std::string_view, std::string_view>> lines;
+        for (auto& header : sent.headers) lines.emplace_back(header.name, header.value);
+        for (auto block : {sent.serialized ? std::string_view(sent.serialized->headers) : std::string_view{}, sent.staticHeaders, sent.cacheControl}) {
+            while (!block.empty()) { // Serialized header lines
+                auto end = block.find("\r\n");
+                auto line = block.substr(0, end);
+                block.remove_prefix(end == std::string_view::npos ? block.size() : end + 2);
+                auto colon = line.find(':');
+                if (colon == std::string_view::npos) continue;
+                auto value = line.substr(colon + 1);
+                value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+                lines.emplace_back(line.substr(0, colon), value);
+            }
+        }
+
+        size_t size = 0;
+        for (auto& line : lines) size += line.first.size();
+        names.clear();
+        names.reserve(size); // The views of responseFields into names are not invalidated by the appends
+        status = std::to_string(static_cast<int>(sent.statusCode));
+        responseFields.assign({{":status", status}});
+        for (auto [name, value] : lines) {
+            auto start = names.size();
+            std::ranges::transform(name, std::back_inserter(names), [](char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c; });
+            auto lowercase = std::string_view(names).substr(start);
+            HeaderField field{lowercase};
+            if (field != HeaderField::connection && field != HeaderField::transferEncoding && field != HeaderField::upgrade && lowercase != "keep-alive" &&
+                lowercase != "proxy-connection")
+                responseFields.emplace_back(lowercase, value);
+        }
+
+        auto bodiless = exchange.request.method == Request::Method::Head || sent.statusCode == Response::noContent || sent.statusCode == Response::notModified;
+        if (!bodiless && sent.serialized)
+            exchange.body = std::as_bytes(std::span{sent.serialized->content});
+        else if (!bodiless && (sent.fileDescriptor || sent.streamedFile)) {
+            exchange.file = sent.streamedFile ? sent.streamedFile : std::make_shared<fs::File>(sent.fileDescriptor);
+            if (sent.fileDescriptor && sent.fileRange) exchange.file->seek(sent.fileRange->offset);
+            exchange.fileLeft = sent.fileRange ? std::optional<size_t>{sent.fileRange->length} : exchange.file->size();
+        }
+        else if (!bodiless)
+            exchange.body = sent.fileContent.empty() ? std::as_bytes(std::span{sent.content}) : sent.fileContent;
+        session.respond(streamId, responseFields, !exchange.body.empty() || (exchange.file && exchange.fileLeft != 0));
+    }
+};
+
+enum class Protocol { HTTP, HTTPUpgrading, WebSocket, HTTP2 };
+
+/// Connection of a client, recycled by the SlabPool of its shard once released : its buffers and the capacities of its containers serve the
+/// following clients. The Requests and Responses of its HTTP/1.1 requests are allocated from its arena, released once each response is sent.
+template<networking::Features Net, fs::Provider FS>
+class Connection : public std::enable_shared_from_this<Connection<Net, FS>>, public utils::IntrusiveList<Connection<Net, FS>>::Hook {
+public:
+    Connection(utils::TimingWheel& timingWheel, Connections<Connection>& connectionsHandler, RequestHandler<Net, FS>& handler,
+               Admission& admissionControl, utils::MemoryBudget& memoryBudget, const ServerOptions& serverOptions)
+        : deadline(timingWheel), connections(connectionsHandler), requestHandler(handler), admission(admissionControl),
+          memory(&memoryBudget, serverOptions.connectionMemoryMax), options(serverOptions) {
         log::debug("New connection");
     }
     ~Connection() = default;
@@ -357,80 +1454,476 @@ class Connection : public std::enable_shared_from_this<Connection<Net, FS>> {
     Connection& operator=(const Connection&) = delete;
     Connection& operator=(Connection&&) = delete;
 
-    void start() { read(); }
-    void stop() { socket.close(); }
+    void start(typename Net::Socket sock) {
+        memory.charge(fixedSize());
+        socket.emplace(std::move(sock));
+        strand.emplace(socket->get_executor());
+        deadline.onExpiry([weak = this->weak_from_this()] {
+            if (auto self = weak.lock()) Net::Post(*self->strand, [self] { self->timedOut(); });
+        });
+        read();
+    }
+    void stop() {
+        Net::Dispatch(*strand, [self = this->shared_from_this()]() {
+            self->disarm();
+            self->socket->close();
+        });
+    }
+
+    /// Called by the SlabPool once the connection is released : closes its socket and resets it for its next client, keeping its buffers
+    void recycle() {
+        connections.erase(*this);
+        deadline.cancel();
+        socket.reset();
+        strand.reset();
+        onUpgrade = {};
+        admitted.release();
+        received = streamedSize = requestsCount = 0;
+        protocol = Protocol::HTTP;
+        keepAlive = writeProgressed = receivingBody = readingFrames = writingFrames = corked = false;
+        waiting = Waiting::nothing;
+        bodyConsumer = {};
+        bodyDecoder = {};
+        bodySizeMax = 0;
+        http2.reset();
+        frameBuffers.clear();
+        releaseArena();
+        memory.release(memory.used()); // Its buffers are kept by the pool
+        chunkCharged = false;
+    }
 
 public:
     std::function<void(typename Net::Socket&&, Protocol)> onUpgrade;
+    Admission::Ticket admitted; /// Of the connection, released with it
+
+    /// @return the memory held by a connection while it serves a client, whatever its requests : its read buffer and its arena
+    [[nodiscard]] static constexpr size_t fixedSize() { return sizeof(decltype(buffer)) + arenaSize; }
 
 private:
-    typename Net::Socket socket;
+    static constexpr size_t arenaSize = 8 * 1024; /// Memory of the request and response of a typical exchange : larger ones use the heap too
+
+    std::optional<typename Net::Socket> socket; /// Socket and strand of the client, released with it : a free connection holds no socket
+    std::optional<typename Net::Strand> strand;
+    utils::TimingWheel::Timer deadline;
     Connections<Connection<Net, FS>>& connections;
     RequestHandler<Net, FS>& requestHandler;
+    Admission& admission;
+    utils::MemoryBudget::Account memory; /// fixedSize, response content outside the arena, chunk of streamed file, HTTP/2 responses
+    const ServerOptions& options;
     std::array<char, 8192> buffer;
-    Request request;
-    Response response;
+    size_t received{0};                 /// Count of bytes of buffer holding the request being parsed and the pipelined ones
+    std::array<std::byte, arenaSize> arenaBuffer;
+    std::pmr::monotonic_buffer_resource arena{arenaBuffer.data(), arenaBuffer.size()};
+    Request request{&arena};
+    Response response{&arena};
+    Admission::Ticket requestAdmitted;  /// Of request, released with the arena once its response has been sent
+    std::string headerBlock;            /// Serialized status line and headers of response
+    size_t responseCharged{0};          /// Bytes of response reserved from memory
+    std::vector<char> chunk;            /// Chunk of response.streamedFile being sent, allocated by the first streamed response
+    bool chunkCharged{false};           /// chunk is reserved from memory
+    std::array<char, 24> chunkFraming;  /// Chunk size line (chunked transfer coding)
+    size_t streamedSize{0};             /// Bytes of response.streamedFile sent so far
     Protocol protocol = Protocol::HTTP;
+    size_t requestsCount{0};
+    bool keepAlive{false};
+    enum class Waiting { nothing, header, nextRequest, body, writeProgress } waiting{Waiting::nothing}; /// What deadline bounds
+    bool writeProgressed{false};        /// Bytes of the response have been sent since deadline was armed
+    bool receivingBody{false};          /// The bytes read belong to the body of request, handed to bodyConsumer
+    BodyConsumer bodyConsumer;
+    BodyDecoder bodyDecoder;
+    uint64_t bodySizeMax{0};
+    std::unique_ptr<HTTP2Streams<Net, FS>> http2;       /// Streams of the connection once switched to HTTP/2
+    std::vector<typename Net::ConstBuffer> frameBuffers; /// Frames being written
+    bool readingFrames{false}, writingFrames{false};
+    bool corked{false};                 /// The socket holds the partial segments of a response written in several steps
+
+    static constexpr size_t sendFileSlice = 64 * 1024; /// Files sent by the kernel report their progress every slice
+
+    void arm(Waiting reason, std::chrono::milliseconds delay) {
+        waiting = reason;
+        deadline.expiresAfter(delay);
+    }
+
+    void disarm() {
+        waiting = Waiting::nothing;
+        deadline.cancel();
+    }
+
+    void timedOut() {
+        if (waiting == Waiting::nothing || deadline.armed()) return; // Disarmed or re-armed since it expired
+        switch (waiting) {
+        case Waiting::writeProgress:
+            if (std::exchange(writeProgressed, false)) return deadline.expiresAfter(options.writeTimeout);
+            log::debug("Response not read by the client for {}ms : closing", options.writeTimeout.count());
+            break;
+        case Waiting::nextRequest: log::debug("Connection idle for {}ms : closing", options.keepAliveTimeout.count()); break;
+        case Waiting::body: log::debug("Request body not received for {}ms : closing", options.bodyTimeout.count()); break;
+        default: log::debug("Request header not received within {}ms : closing", options.headerTimeout.count());
+        }
+        waiting = Waiting::nothing;
+        connections.stop(this->shared_from_this());
+    }
 
     void read() {
         auto self(this->shared_from_this());
-        socket.async_read_some(Net::Buffer(buffer), [this, self](std::error_code ec, std::size_t bytesTransferred) {
+        if (receivingBody)
+            arm(Waiting::body, options.bodyTimeout); // Re-armed by each read : bounds the delay between two parts of the body
+        else if (received == 0 && requestsCount > 0)
+            arm(Waiting::nextRequest, options.keepAliveTimeout);
+        else if (waiting != Waiting::header) // Not re-armed by the following reads : the whole header block is due within headerTimeout
+            arm(Waiting::header, options.headerTimeout);
+        socket->async_read_some(Net::Buffer(buffer.data() + received, buffer.size() - received),
+                               Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t bytesTransferred) {
             if (!ec) {
                 switch (protocol) {
                 case Protocol::HTTP:
-                    try {
-                        request.parseSomeData(buffer.data(), buffer.data() + bytesTransferred);
-                        if (request.completed()) {
-                            log::info("Received request {} on {}", request.getMethodName(), request.uri);
-                            response = requestHandler.handleRequest(request);
-                            log::info("  responding http {}", static_cast<int>(response.statusCode));
-                            write();
-                            if (response.statusCode == Response::switchingProtocols) protocol = Protocol::HTTPUpgrading;
-                        }
-                        else
-                            read();
-                    }
-                    catch (const BadRequestException&) {
-                        response = Response::getStatusResponse(Response::badRequest);
-                        write();
-                    }
+                    received += bytesTransferred;
+                    receivingBody ? processBody() : processData();
                     break;
-
                 default: log::warn("Connection is no longer in HTTP protocol. Connection::read() is disabled.");
                 }
             }
             else if (ec != Net::Error::OperationAborted)
                 connections.stop(self);
-        });
+        }));
     }
 
-    void write() {
+    // Parses received data in place : a complete request is answered, the data following it is kept for the next (pipelined) request.
+    void processData() {
+        if (options.http2 && requestsCount == 0) { // HTTP/2 by prior knowledge : the client starts with its preface (RFC9113 3.3)
+            std::string_view data(buffer.data(), received);
+            if (data.starts_with(http2::preface)) return startHTTP2(data);
+            if (http2::preface.starts_with(data)) return read();
+        }
+        switch (request.parse(std::string_view(buffer.data(), received))) {
+        case Request::ParseResult::incomplete:
+            if (received < buffer.size()) return read();
+            return closeWith(Response::requestHeaderFieldsTooLarge);
+        case Request::ParseResult::badRequest: return closeWith(Response::badRequest);
+        case Request::ParseResult::completed: break;
+        }
+
+        auto decoder = request.bodyDecoder();
+        if (!decoder) return closeWith(Response::badRequest);
+        log::info("Received request {} on {}", request.getMethodName(), request.uri);
+        requestAdmitted = admission.enterRequest();
+        if (!requestAdmitted) {
+            setResponse(inArena([this] { return requestHandler.serviceUnavailable(); }));
+            return respond(!decoder->hasBody());
+        }
+        if (options.http2 && !decoder->hasBody() && request.isUpgradeRequest("h2c") && request.getHeaderValue(HeaderField::http2Settings))
+            return upgradeToHTTP2();
+        if (auto consumer = requestHandler.bodyConsumer(request)) return receiveBody(std::move(*consumer), *decoder);
+        setResponse(inArena([this] { return requestHandler.handleRequest(request); }));
+        reserveResponse();
+        respond(!decoder->hasBody());
+    }
+
+    // Sends response : the connection persists if the request asks for it and if its body, if any, has been read
+    void respond(bool bodyRead) {
+        log::info("  responding http {}", static_cast<int>(response.statusCode));
+        if (response.statusCode == Response::switchingProtocols)
+            protocol = Protocol::HTTPUpgrading;
+        else {
+            keepAlive = bodyRead && request.isPersistent() && ++requestsCount < options.keepAliveMaxRequests && !response.isCloseDelimited();
+            response.headers.emplace_back("Connection", keepAlive ? "keep-alive" : "close");
+        }
+        write();
+    }
+
+    // The body is received in the part of buffer following the headers, which stay valid for the consumer
+    void receiveBody(BodyConsumer consumer, BodyDecoder decoder) {
+        bodySizeMax = consumer.sizeMax.value_or(options.requestBodySizeMax);
+        if (decoder.length().value_or(0) > bodySizeMax) return closeWith(Response::contentTooLarge);
+        if (decoder.hasBody() && request.size() == buffer.size()) return closeWith(Response::requestHeaderFieldsTooLarge); // No room left
+        bodyConsumer = std::move(consumer);
+        bodyDecoder = decoder;
+        receivingBody = true;
+        if (!decoder.hasBody() || received > request.size() || !request.headersContain(HeaderField::expect, "100-continue")) return processBody();
+
+        constexpr std::string_view continueLine{"HTTP/1.1 100 Continue\r\n\r\n"}; // The client waits for it before sending the body
         auto self(this->shared_from_this());
-        Net::AsyncWrite(socket, response.toBuffers<Net>(), [this, self](std::error_code ec, std::size_t /*bytesTransferred*/) {
-            if (protocol == Protocol::HTTPUpgrading) {
-                protocol = Protocol::WebSocket;
-                if (onUpgrade) onUpgrade(std::move(socket), protocol);
-            }
-            else {
-                if (!ec) socket.shutdown(Net::Socket::shutdown_both);
+        Net::AsyncWrite(*socket, std::array{Net::Buffer(continueLine)},
+                        Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            if (!ec) return read();
+            if (ec != Net::Error::OperationAborted) connections.stop(self);
+        }));
+    }
+
+    // Hands the payload of the body bytes received so far to the consumer, then reads the following ones or responds.
+    void processBody() {
+        auto bodyStart = request.size();
+        auto [consumed, status] = bodyDecoder.decode(std::string_view(buffer.data() + bodyStart, received - bodyStart), bodySizeMax,
+                                                     [this](std::string_view payload) { bodyConsumer.onData(std::as_bytes(std::span{payload})); });
+        std::memmove(buffer.data() + bodyStart, buffer.data() + bodyStart + consumed, received - bodyStart - consumed); // Pipelined request
+        received -= consumed;
+        if (status == BodyDecoder::Status::incomplete) return read();
+
+        receivingBody = false;
+        auto consumer = std::exchange(bodyConsumer, {}); // An incomplete upload is discarded by its consumer's destruction
+        if (status == BodyDecoder::Status::malformed) return closeWith(Response::badRequest);
+        if (status == BodyDecoder::Status::tooLarge) return closeWith(Response::contentTooLarge);
+        setResponse(inArena([&consumer] { return consumer.onEnd(); }));
+        reserveResponse();
+        respond(true);
+    }
+
+    // Answers request by HTTP/2 on the stream 1, once 101 Switching Protocols has been sent (RFC7540 3.2)
+    void upgradeToHTTP2() {
+        http2 = std::make_unique<HTTP2Streams<Net, FS>>(requestHandler, admission, memory, options);
+        if (!http2->upgrade(request)) {
+            http2.reset();
+            return closeWith(Response::badRequest);
+        }
+        constexpr std::string_view switching{"HTTP/1.1 101 Switching Protocols\r\nConnection: Upgrade\r\nUpgrade: h2c\r\n\r\n"};
+        auto self(this->shared_from_this());
+        arm(Waiting::writeProgress, options.writeTimeout);
+        Net::AsyncWrite(*socket, std::array{Net::Buffer(switching)},
+                        Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            if (!ec) return startHTTP2(std::string_view(buffer.data() + request.size(), received - request.size()));
+            if (ec != Net::Error::OperationAborted) connections.stop(self);
+        }));
+    }
+
+    // Switches the connection to HTTP/2, data being the bytes already received from the client : its preface and first frames
+    void startHTTP2(std::string_view data) {
+        if (!http2) http2 = std::make_unique<HTTP2Streams<Net, FS>>(requestHandler, admission, memory, options);
+        protocol = Protocol::HTTP2;
+        log::debug("Connection switched to HTTP/2");
+        std::ranges::copy(data, http2->session.receiveBuffer().begin()); // Smaller than buffer : fits in the receive buffer
+        received = 0;
+        request.reset();
+        requestAdmitted.release(); // The streams are admitted one by one
+        framesReceived(data.size());
+    }
+
+    void readFrames() {
+        auto self(this->shared_from_this());
+        readingFrames = true;
+        if (!writingFrames) armHTTP2();
+        auto space = http2->session.receiveBuffer();
+        socket->async_read_some(Net::Buffer(space.data(), space.size()),
+                               Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t bytesTransferred) {
+            readingFrames = false;
+            if (!ec) return framesReceived(bytesTransferred);
+            if (ec != Net::Error::OperationAborted) connections.stop(self);
+        }));
+    }
+
+    // Processes the frames received, writes the frames answering them, and reads the next ones unless too many are waiting to be written
+    void framesReceived(size_t count) {
+        http2->session.received(count);
+        writeFrames();
+        if (http2->session.wantsInput()) readFrames();
+    }
+
+    // Writes the frames waiting, then the following ones : the responses of the streams progress as the client reads them. The connection
+    // is closed once the session is done.
+    void writeFrames() {
+        if (writingFrames) return;
+        auto& session = http2->session;
+        auto& frames = session.nextWrite();
+        if (frames.empty()) {
+            if (!session.isDone()) return armHTTP2();
+            disarm();
+            socket->shutdown(Net::Socket::shutdown_both);
+            return connections.stop(this->shared_from_this());
+        }
+        frameBuffers.clear();
+        for (auto frame : frames) frameBuffers.push_back(Net::Buffer(frame));
+        writingFrames = true;
+        writeProgressed = false;
+        arm(Waiting::writeProgress, options.writeTimeout);
+        auto self(this->shared_from_this());
+        Net::AsyncWrite(*socket, frameBuffers, progress(), Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            writingFrames = false;
+            if (ec) {
                 if (ec != Net::Error::OperationAborted) connections.stop(self);
+                return;
             }
+            writeFrames();
+            if (!readingFrames && http2->session.wantsInput()) readFrames();
+        }));
+    }
+
+    // Bounds the silence of the client while nothing is being written : bodyTimeout while streams wait for it (request body, WINDOW_UPDATE),
+    // keepAliveTimeout once they are all answered
+    void armHTTP2() {
+        if (http2->session.openStreams() > 0)
+            arm(Waiting::body, options.bodyTimeout);
+        else
+            arm(Waiting::nextRequest, options.keepAliveTimeout);
+    }
+
+    void closeWith(Response::StatusCode code) {
+        setResponse(Response::getStatusResponse(code));
+        keepAlive = false;
+        response.headers.emplace_back("Connection", "close");
+        write();
+    }
+
+    // Moves the pipelined data following the answered request to the beginning of the buffer.
+    void consumeRequest() {
+        auto requestSize = request.size();
+        std::memmove(buffer.data(), buffer.data() + requestSize, received - requestSize);
+        received -= requestSize;
+        releaseArena();
+    }
+
+    /// @return the response built by handling, the Responses it builds being allocated from arena (e.g. by a RouteHandler)
+    template<typename Handling>
+    Response inArena(Handling&& handling) {
+        ArenaScope scope(arena);
+        return handling();
+    }
+
+    /// Replaces response by answer, which keeps its memory resource : a response built in the arena is moved without copy
+    void setResponse(Response answer) {
+        std::destroy_at(&response);
+        std::construct_at(&response, std::move(answer));
+    }
+
+    // Reserves the memory of the content of response held beyond the buffer of the arena : a response exceeding the memory of the
+    // connection or the budget is replaced by 503 Service Unavailable
+    void reserveResponse() {
+        auto size = response.content.get_allocator().resource() == &arena && response.content.capacity() <= arenaSize ? 0 : response.content.capacity();
+        if (memory.reserve(size)) {
+            responseCharged = size;
+            return;
+        }
+        log::warn("Response of {} bytes exceeding the memory budget : 503", size);
+        setResponse(inArena([this] { return requestHandler.serviceUnavailable(); }));
+    }
+
+    /// Frees the request answered and its response, then the arena holding them, for the next request
+    void releaseArena() {
+        requestAdmitted.release();
+        memory.release(std::exchange(responseCharged, 0));
+        setResponse(Response{&arena});
+        std::destroy_at(&request);
+        std::construct_at(&request, &arena);
+        arena.release();
+    }
+
+    void write() {
+        auto self(this->shared_from_this());
+        writeProgressed = false;
+        arm(Waiting::writeProgress, options.writeTimeout);
+        // The header block and the first bytes of a file sent after it share their segments
+        if ((response.streamedFile || response.fileDescriptor) && networking::SocketTuning::of(options.socketProfile).cork)
+            Net::Cork(*socket, corked = true);
+        Net::AsyncWrite(*socket, response.toBuffers<Net>(headerBlock), progress(),
+                        Net::BindExecutor(*strand, [this, self](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            if (!ec && response.streamedFile) {
+                streamedSize = 0;
+                return writeChunk();
+            }
+            if (ec || !response.fileDescriptor) return written(ec);
+            sendFile(response.fileRange ? response.fileRange->offset : 0, response.contentSize());
+        }));
+    }
+
+    /// @return the completion condition of the writes, which notes their progress for the write timeout
+    auto progress() {
+        return [this](std::error_code ec, std::size_t bytesTransferred) -> std::size_t {
+            if (bytesTransferred > 0) writeProgressed = true;
+            return ec ? 0 : 64 * 1024;
+        };
+    }
+
+    void sendFile(std::size_t offset, std::size_t size) {
+        auto self(this->shared_from_this());
+        auto slice = std::min(size, sendFileSlice);
+        Net::AsyncSendFile(*socket, response.fileDescriptor->handle, offset, slice,
+                           Net::BindExecutor(*strand, [this, self, offset, size, slice](std::error_code ec, std::size_t /*bytesSent*/) {
+            if (ec || slice == size) return written(ec);
+            writeProgressed = true;
+            sendFile(offset + slice, size - slice);
+        }));
+    }
+
+    // Reads the next chunk of the streamed file and writes it : the following one is read once it has been written, so that a slow client
+    // holds a single chunk in memory.
+    void writeChunk() {
+        auto self(this->shared_from_this());
+        if (!chunkCharged && !(chunkCharged = memory.reserve(options.streamChunkSize))) {
+            log::warn("Chunk of streamed file exceeding the memory budget : closing");
+            return written(std::make_error_code(std::errc::not_enough_memory));
+        }
+        chunk.resize(options.streamChunkSize);
+        // Content-Length : a file growing meanwhile is not sent beyond
+        auto announced = response.fileRange ? std::optional{response.fileRange->length} : response.streamedFile->size();
+        auto size = response.streamedFile->read(std::span{chunk}.first(announced ? std::min(chunk.size(), *announced - streamedSize) : chunk.size()));
+        streamedSize += size;
+        auto last = size == 0 || response.streamedFile->eof() || streamedSize == announced;
+        auto onWritten = Net::BindExecutor(*strand, [this, self, last](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            if (ec || last) return written(ec);
+            writeProgressed = true;
+            writeChunk();
         });
+        if (!response.chunked) {
+            if (last && announced && streamedSize != *announced) keepAlive = false; // File truncated meanwhile : the client sees the close
+            return Net::AsyncWrite(*socket, std::array{Net::Buffer(std::string_view(chunk.data(), size))}, std::move(onWritten));
+        }
+
+        constexpr std::string_view crlf{"\r\n"}, lastChunk{"\r\n0\r\n\r\n"};
+        if (size == 0) return Net::AsyncWrite(*socket, std::array{Net::Buffer(lastChunk.substr(crlf.size()))}, std::move(onWritten));
+        auto sizeEnd = std::to_chars(chunkFraming.data(), chunkFraming.data() + chunkFraming.size() - crlf.size(), size, 16).ptr;
+        auto sizeLine = std::string_view(chunkFraming.data(), std::copy(crlf.begin(), crlf.end(), sizeEnd));
+        Net::AsyncWrite(*socket, std::array{Net::Buffer(sizeLine), Net::Buffer(std::string_view(chunk.data(), size)), Net::Buffer(last ? lastChunk : crlf)},
+                        std::move(onWritten));
+    }
+
+    void written(std::error_code ec) {
+        auto self(this->shared_from_this());
+        if (std::exchange(corked, false) && !ec) Net::Cork(*socket, false); // Sends the last partial segment
+        response.streamedFile.reset();
+        response.fileDescriptor.reset(); // Sent : the file can be closed or unmapped while the connection waits for its next request
+        response.fileContentOwner.reset();
+        disarm();
+        if (protocol == Protocol::HTTPUpgrading) {
+            protocol = Protocol::WebSocket;
+            if (onUpgrade) onUpgrade(std::move(*socket), protocol);
+        }
+        else if (!ec && keepAlive) {
+            consumeRequest();
+            if (received == 0)
+                read();
+            else
+                processData();
+        }
+        else {
+            if (!ec) socket->shutdown(Net::Socket::shutdown_both);
+            if (ec != Net::Error::OperationAborted) connections.stop(self);
+        }
     }
 };
 
+/// Shard run by the calling thread, set by Server::run()
+struct RunningShard {
+    const void* server{nullptr};
+    size_t index{0};
+};
+inline thread_local RunningShard runningShard;
+
+/// HTTP server. Its connections are run by a single io_context shared by a pool of threads (ServerOptions::threadsCount), or by shards
+/// sharing nothing (ServerOptions::shardsCount) : each one owns an io_context run by a thread pinned to a core, an acceptor, the
+/// connections it accepted, their timeouts and a RequestHandler. The kernel spreads the incoming connections among the acceptors
+/// (SO_REUSEPORT), so that the accept and request paths of a shard never touch the state of another one. Other threads reach the state
+/// of a shard through its mailbox : post().
 template<networking::Features Net, fs::Provider FS>
 class Server {
 public:
-    Server(std::string_view address, std::string_view port, std::filesystem::path docRoot = ".")
-        : acceptor(ioContext), requestHandler(docRoot) {
-        typename Net::Resolver resolver(ioContext);
+    Server(std::string_view address, std::string_view port, std::filesystem::path docRoot = ".", ServerOptions serverOptions = {})
+        : options(serverOptions), memoryBudget(options.memoryBudget), admissionControl(options.connectionsMax, options.requestsInFlightMax) {
+        auto shardsCount = std::max<size_t>(options.shardsCount, 1);
+        for (size_t index = 0; index < shardsCount; ++index) shards.push_back(std::make_unique<Shard>(options, docRoot, shardsCount));
+        typename Net::Resolver resolver(shards.front()->ioContext);
         typename Net::Endpoint endpoint = *resolver.resolve(address, port).begin();
-        acceptor.open(endpoint.protocol());
-        acceptor.set_option(typename Net::Acceptor::reuse_address(true));
-        acceptor.bind(endpoint);
-        acceptor.listen();
-        accept();
+        for (auto& shard : shards) {
+            listen(*shard, endpoint);
+            endpoint = shard->acceptor.local_endpoint(); // The following acceptors share the port bound by the first one, e.g. for port "0"
+        }
     }
     ~Server() = default;
     Server(const Server&) = delete;
@@ -438,33 +1931,181 @@ class Server {
     Server& operator=(const Server&) = delete;
     Server& operator=(Server&&) = delete;
 
-    void run() { ioContext.run(); }
-    void runOne() { ioContext.run_one(); }
-    
+    /// Runs the server until it is stopped : its io_context on options.threadsCount threads, or its shards on a thread each, pinned to the
+    /// core of the shard's index (modulo the cores). The calling thread is one of them (the first shard's one).
+    void run() {
+        std::vector<std::jthread> pool;
+        if (shards.size() == 1) {
+            for (size_t index = 1; index < options.threadsCount; ++index) pool.emplace_back([this] { runShard(0, false); });
+            return runShard(0, false);
+        }
+        for (size_t index = 1; index < shards.size(); ++index) pool.emplace_back([this, index] { runShard(index, true); });
+        runShard(0, true);
+    }
+    void runOne() { shards.front()->ioContext.run_one(); }
+
+    /// @return the port the server is listening to (useful when the server has been bound to port "0")
+    [[nodiscard]] uint16_t port() const { return shards.front()->acceptor.local_endpoint().port(); }
+
+    /// Can be called from any thread : the acceptors and the connections are closed from the acceptors' strands.
     void stop() {
         log::info("Stopping HTTP server...");
-        acceptor.close();
-        connections.stopAll();
-        ioContext.stop();
+        for (auto& shard : shards)
+            Net::Post(shard->acceptorStrand, [&shard = *shard] {
+                shard.acceptor.close();
+                shard.ticker.cancel();
+                shard.connections.stopAll();
+                shard.ioContext.stop();
+            });
     }
 
     void onUpgrade(std::function<void(typename Net::Socket&&, Protocol)>&& handler) { upgradeHandler = std::move(handler); }
 
+    /// Routes the requests of method whose path matches pattern (e.g. "/api/items/{id}") to handler, before the files : see RequestHandler.
+    void route(Request::Method method, std::string_view pattern, RouteHandler handler) {
+        for (auto& shard : shards) shard->requestHandler.route(method, pattern, handler);
+    }
+    void route(Request::Method method, std::string_view pattern, BodyRouteHandler handler) {
+        for (auto& shard : shards) shard->requestHandler.route(method, pattern, handler);
+    }
+
+    /// Wheel driving the timeouts of the connections of the calling thread's shard (the first one from other threads), ticked by its
+    /// io_context : the upgraded protocols arm their timers on it
+    [[nodiscard]] utils::TimingWheel& timeouts() { return shards[currentShard().value_or(0)]->timingWheel; }
+
+    /// @return the counts of connections and of requests being served, limited by the ServerOptions
+    [[nodiscard]] const Admission& admission() const { return admissionControl; }
+
+    /// @return the memory held by the connections, and by the WebSocket links accounting it (websocket::Limits), bounded by
+    /// ServerOptions::memoryBudget
+    [[nodiscard]] utils::MemoryBudget& memory() { return memoryBudget; }
+    [[nodiscard]] const utils::MemoryBudget& memory() const { return memoryBudget; }
+
+    /// @return 1 in the shared io_context mode, the count of shards otherwise
+    [[nodiscard]] size_t shardsCount() const { return shards.size(); }
+
+    /// @return the shard run by the calling thread, nullopt if it does not run the server
+    [[nodiscard]] std::optional<size_t> currentShard() const {
+        if (runningShard.server != this) return {};
+        return runningShard.index;
+    }
+
+    /// Runs task on the thread of shard (in the strand of its acceptor in the shared io_context mode), through its lock-free mailbox : its
+    /// io_context is woken up once per batch of tasks. Can be called from any thread.
+    void post(size_t shard, std::function<void()> task) {
+        auto& target = *shards[shard];
+        if (target.mailbox.push(std::move(task))) Net::Post(target.acceptorStrand, [&target] { target.mailbox.drain(); });
+    }
+
 private:
-    typename Net::IoContext ioContext;
-    typename Net::Acceptor acceptor;
-    Connections<Connection<Net, FS>> connections;
-    RequestHandler<Net, FS> requestHandler;
-    std::function<void(typename Net::Socket socket, Protocol protocol)> upgradeHandler;
-
-    void accept() {
-        acceptor.async_accept([this](std::error_code ec, typename Net::Socket socket) {
-            if (!acceptor.is_open()) return;
-            auto newConnection = std::make_shared<Connection<Net, FS>>(std::move(socket), connections, requestHandler);
-            newConnection->onUpgrade = upgradeHandler;
-            if (!ec) connections.start(newConnection);
-            accept();
-        });
+    struct Shard {
+        Shard(const ServerOptions& options, const std::filesystem::path& docRoot, size_t shardsCount)
+            : timingWheel(options.timeoutsTick), acceptor(ioContext), acceptorStrand(ioContext.get_executor()), ticker(ioContext),
+              requestHandler(docRoot, options.responseCacheSize, options.cachePolicy, options.decodedCacheSize, options.compressedCacheSize,
+                             options.retryAfter),
+              clientRates(options.clientConnectionsRate / static_cast<double>(shardsCount),
+                          std::max(1.0, options.clientConnectionsBurst / static_cast<double>(shardsCount)), options.clientsTracked) {}
+
+        utils::TimingWheel timingWheel; // Outlives the connections released with the io_context
+        utils::SlabPool<Connection<Net, FS>, 16> connectionPool;
+        Connections<Connection<Net, FS>> connections;
+        typename Net::IoContext ioContext;
+        typename Net::Acceptor acceptor;
+        typename Net::Strand acceptorStrand;
+        typename Net::SteadyTimer ticker; // Single timer of all the connections' timeouts
+        RequestHandler<Net, FS> requestHandler;
+        ClientRates clientRates; // Of the connections accepted by the shard
+        utils::Mailbox<> mailbox;
+    };
+
+    ServerOptions options;
+    utils::MemoryBudget memoryBudget; // Declared before the shards : outlives the accounts of their connections
+    Admission admissionControl;       // Declared before the shards : outlives the tickets of their connections
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::function<void(typename Net::Socket&&, Protocol)> upgradeHandler; // Type of Connection::onUpgrade : copied without being wrapped
+
+    void listen(Shard& shard, typename Net::Endpoint endpoint) {
+        shard.acceptor.open(endpoint.protocol());
+        shard.acceptor.set_option(typename Net::Acceptor::reuse_address(true));
+        if (shards.size() > 1) shard.acceptor.set_option(typename Net::ReusePort(true));
+        if (options.socketProfile != networking::SocketProfile::system && !Net::Tune(shard.acceptor, networking::SocketTuning::of(options.socketProfile)))
+            log::debug("Acceptor options partly refused");
+        shard.acceptor.bind(endpoint);
+        shard.acceptor.listen();
+        accept(shard);
+        tick(shard);
+    }
+
+    void runShard(size_t index, bool pinned) {
+        runningShard = {this, index};
+        if (pinned) pinToCore(index);
+        shards[index]->ioContext.run();
+        runningShard = {};
+    }
+
+    static void pinToCore(size_t index) {
+#if defined(__linux__)
+        cpu_set_t cores;
+        CPU_ZERO(&cores);
+        CPU_SET(index % std::max(std::thread::hardware_concurrency(), 1u), &cores);
+        if (::pthread_setaffinity_np(::pthread_self(), sizeof(cores), &cores) != 0) log::warn("Shard {} not pinned to a core", index);
+#endif
+    }
+
+    void accept(Shard& shard) {
+        shard.acceptor.async_accept(Net::BindExecutor(shard.acceptorStrand, [this, &shard](std::error_code ec, typename Net::Socket socket) {
+            if (!shard.acceptor.is_open()) return;
+            if (!ec) {
+                auto admitted = shard.clientRates.admit(clientAddress(socket)) && memoryBudget.available() >= Connection<Net, FS>::fixedSize()
+                                  ? admissionControl.enterConnection()
+                                  : Admission::Ticket{};
+                if (!admitted)
+                    shed(shard, socket);
+                else {
+                    if (options.socketProfile != networking::SocketProfile::system && !Net::Tune(socket, networking::SocketTuning::of(options.socketProfile)))
+                        log::debug("Socket options partly refused");
+                    auto newConnection = shard.connectionPool.acquire(shard.timingWheel, shard.connections, shard.requestHandler, admissionControl,
+                                                                     memoryBudget, options);
+                    newConnection->onUpgrade = upgradeHandler;
+                    newConnection->admitted = std::move(admitted);
+                    shard.connections.start(newConnection, std::move(socket));
+                }
+            }
+            accept(shard);
+        }));
+    }
+
+    // Answers the precomputed 503 Service Unavailable to a connection refused by the admission control, and closes it : a single write into
+    // the empty send buffer of the socket, which does not wait for the client's request
+    static void shed(Shard& shard, typename Net::Socket& socket) {
+        try {
+            socket.write_some(Net::Buffer(shard.requestHandler.serviceUnavailableMessage()));
+            socket.close();
+        }
+        catch (const std::exception& e) {
+            log::debug("Refused connection already closed by the client : {}", e.what());
+        }
+    }
+
+    // @return the IP address of the client of socket, the unspecified address if it is already disconnected
+    static ClientRates::Address clientAddress(typename Net::Socket& socket) {
+        try {
+            auto address = socket.remote_endpoint().address();
+            if (address.is_v4()) return ClientRates::toAddress(address.to_v4().to_bytes());
+            return ClientRates::toAddress(address.to_v6().to_bytes());
+        }
+        catch (const std::exception&) {
+            return {};
+        }
+    }
+
+    void tick(Shard& shard) {
+        shard.ticker.expires_after(shard.timingWheel.tickPeriod());
+        shard.ticker.async_wait(Net::BindExecutor(shard.acceptorStrand, [this, &shard](std::error_code ec) {
+            if (ec || !shard.acceptor.is_open()) return;
+            shard.timingWheel.advance();
+            tick(shard);
+        }));
     }
 };
 
@@ -0,0 +1,60 @@
+/// @date 17/10/2026 14:05:12
+/// @author Ambroise Leclerc
+/// @brief HeaderField : well-known HTTP header names classified through a constexpr perfect hash
+#pragma once
+#include "utils/PerfectHash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace webfront::http {
+
+namespace details::headerfield {
+
+inline constexpr std::array<std::string_view, 31> names{
+  "Accept",        "Accept-Encoding",   "Accept-Language",  "Accept-Ranges",       "Cache-Control",        "Connection",
+  "Content-Encoding", "Content-Length", "Content-Range",    "Content-Type",        "ETag",                 "Expect",
+  "Host",          "HTTP2-Settings",    "If-Match",         "If-Modified-Since",   "If-None-Match",        "If-Range",
+  "If-Unmodified-Since", "Last-Modified", "Origin",         "Range",               "Sec-WebSocket-Accept", "Sec-WebSocket-Extensions",
+  "Sec-WebSocket-Key", "Sec-WebSocket-Protocol", "Sec-WebSocket-Version", "Transfer-Encoding", "Upgrade",      "User-Agent",
+  "Vary"};
+inline constexpr utils::PerfectHash<names.size(), true> hash{names};
+
+} // namespace details::headerfield
+
+struct HeaderField {
+    enum Id : uint8_t {
+        accept, acceptEncoding, acceptLanguage, acceptRanges, cacheControl, connection, contentEncoding, contentLength, contentRange, contentType,
+        eTag, expect, host, http2Settings, ifMatch, ifModifiedSince, ifNoneMatch, ifRange, ifUnmodifiedSince, lastModified, origin, range,
+        secWebSocketAccept, secWebSocketExtensions, secWebSocketKey, secWebSocketProtocol, secWebSocketVersion, transferEncoding, upgrade,
+        userAgent, vary, unknown
+    };
+    static constexpr size_t count = unknown;
+    static_assert(count == details::headerfield::names.size());
+    Id id;
+
+    constexpr HeaderField(Id field) : id(field) {}
+    constexpr HeaderField(std::string_view name) : id(fromName(name).id) {}
+    constexpr bool operator==(const HeaderField&) const = default;
+
+    [[nodiscard]] constexpr bool isKnown() const { return id != unknown; }
+
+    [[nodiscard]] constexpr std::string_view toString() const { return isKnown() ? details::headerfield::names[id] : std::string_view{}; }
+
+    /// O(1) classification : the case insensitive perfect hash selects the only candidate name, then a single comparison confirms it.
+    [[nodiscard]] static constexpr HeaderField fromName(std::string_view name) {
+        auto index = details::headerfield::hash.find(name);
+        return index == details::headerfield::hash.npos ? unknown : static_cast<Id>(index);
+    }
+
+    [[nodiscard]] static constexpr char toLower(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+    [[nodiscard]] static constexpr bool caseInsensitiveEqual(std::string_view s1, std::string_view s2) {
+        return s1.size() == s2.size() && std::equal(s1.begin(), s1.end(), s2.begin(), [](char c1, char c2) { return toLower(c1) == toLower(c2); });
+    }
+};
+
+} // namespace webfront::http
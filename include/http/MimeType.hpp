@@ -32,6 +32,11 @@ struct MimeType {
         return plain;
     }
 
+    /// @return true for the types worth sending with a content coding : jpg, png, gif, webp and pdf files are already compressed
+    [[nodiscard]] constexpr bool isCompressible() const {
+        return type == plain || type == html || type == css || type == js || type == json || type == ttf || type == ico || type == svg || type == csv;
+    }
+
     [[nodiscard]] constexpr std::string_view toString() const {
         auto names =
           std::array{"text/plain",      "text/html", "text/css",     "application/javascript", "image/jpeg", "image/png", "image/gif", "application/json",
@@ -0,0 +1,91 @@
+/// @date 17/10/2026 21:04:51
+/// @author Ambroise Leclerc
+/// @brief Range requests : byte ranges of a Range header field resolved against the size of a file - RFC9110 14
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <string_view>
+#include <vector>
+
+namespace webfront::http {
+
+/// Bytes [offset, offset + length) of a file
+struct ByteRange {
+    size_t offset;
+    size_t length;
+
+    bool operator==(const ByteRange&) const = default;
+
+    /// @return the Content-Range field value of the range of a file of size bytes
+    [[nodiscard]] std::string contentRange(size_t size) const {
+        return "bytes " + std::to_string(offset) + '-' + std::to_string(offset + length - 1) + '/' + std::to_string(size);
+    }
+};
+
+/// Ranges requested by a Range header field, resolved against the size of the selected file.
+struct RangeSet {
+    enum class Status {
+        ignored,      ///< Malformed, other unit than bytes, too many or overlapping ranges : the whole file is sent (200)
+        satisfiable,  ///< ranges hold the satisfiable ranges, in request order (206)
+        unsatisfiable ///< None of the ranges overlaps the file (416)
+    };
+    static constexpr size_t maxRanges = 16; // Many small ranges are a denial of service vector : RFC9110 14.2 allows to ignore them
+
+    Status status{Status::ignored};
+    std::vector<ByteRange> ranges;
+
+    /// Parses field, "bytes=" followed by a comma separated list of "first-last", "first-" or "-suffixLength" ranges
+    [[nodiscard]] static RangeSet parse(std::string_view field, size_t size) {
+        constexpr std::string_view unit{"bytes="};
+        if (field.size() <= unit.size() || !std::equal(unit.begin(), unit.end(), field.begin(), [](char a, char b) { return a == (b | 0x20); }))
+            return {};
+        RangeSet rangeSet{Status::unsatisfiable, {}};
+        size_t specsCount = 0;
+        for (auto specs = field.substr(unit.size()); !specs.empty();) {
+            auto comma = specs.find(',');
+            auto spec = trim(specs.substr(0, comma));
+            specs = comma == std::string_view::npos ? std::string_view{} : specs.substr(comma + 1);
+            if (spec.empty()) continue; // RFC9110 5.6.1 : empty list elements are ignored
+            if (++specsCount > maxRanges) return {};
+
+            auto dash = spec.find('-');
+            if (dash == std::string_view::npos) return {};
+            auto first = number(spec.substr(0, dash)), last = number(spec.substr(dash + 1));
+            if (dash == 0) { // Suffix range : the last bytes of the file
+                if (!last) return {};
+                if (*last > 0 && size > 0) rangeSet.ranges.push_back({size - std::min(*last, size), std::min(*last, size)});
+                continue;
+            }
+            if (!first || (dash + 1 < spec.size() && (!last || *last < *first))) return {};
+            if (*first >= size) continue;
+            rangeSet.ranges.push_back({*first, std::min(last.value_or(size - 1), size - 1) - *first + 1});
+        }
+        if (specsCount == 0) return {};
+        for (size_t index = 0; index < rangeSet.ranges.size(); ++index)
+            for (size_t other = 0; other < index; ++other)
+                if (overlap(rangeSet.ranges[index], rangeSet.ranges[other])) return {};
+        if (!rangeSet.ranges.empty()) rangeSet.status = Status::satisfiable;
+        return rangeSet;
+    }
+
+private:
+    [[nodiscard]] static std::string_view trim(std::string_view text) {
+        auto first = text.find_first_not_of(" \t");
+        return first == std::string_view::npos ? std::string_view{} : text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    }
+
+    [[nodiscard]] static std::optional<size_t> number(std::string_view digits) {
+        size_t value;
+        auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+        if (error != std::errc{} || end != digits.data() + digits.size()) return {};
+        return value;
+    }
+
+    [[nodiscard]] static bool overlap(const ByteRange& a, const ByteRange& b) { return a.offset < b.offset + b.length && b.offset < a.offset + a.length; }
+};
+
+} // namespace webfront::http
@@ -0,0 +1,160 @@
+/// @date 20/10/2026 10:24:51
+/// @author Ambroise Leclerc
+/// @brief Request bodies : incremental decoding of their Content-Length or chunked framing (RFC9112 6 and 7.1), and upload to a file
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace webfront::http {
+
+/// Decodes a body received in successive parts, handing its payload over without copy : the data of a chunk is a view of the received
+/// part. The framing (chunk sizes, extensions, trailer fields) is parsed byte by byte, so that a part may end anywhere.
+class BodyDecoder {
+public:
+    enum class Status { incomplete, completed, malformed, tooLarge };
+
+    /// Empty body
+    BodyDecoder() = default;
+    [[nodiscard]] static BodyDecoder ofLength(uint64_t length) { return BodyDecoder{State::data, length}; }
+    [[nodiscard]] static BodyDecoder chunked() { return BodyDecoder{State::chunkSize, 0}; }
+
+    /// @return false for an empty body : Content-Length: 0, or neither Content-Length nor Transfer-Encoding
+    [[nodiscard]] bool hasBody() const { return state != State::completed; }
+    /// @return the bytes of a Content-Length body left to decode (its announced size before decode()), nullopt for a chunked body
+    [[nodiscard]] std::optional<uint64_t> length() const {
+        if (isChunked) return {};
+        return remaining;
+    }
+    /// @return the bytes of payload decoded so far
+    [[nodiscard]] uint64_t decodedSize() const { return decoded; }
+
+    /// Decodes data, calling onPayload(std::string_view) for its payload, until the end of the body.
+    /// @return the count of bytes of data consumed (the following ones belong to the next request) and the status of the body
+    template<typename OnPayload>
+    std::pair<size_t, Status> decode(std::string_view data, uint64_t sizeMax, OnPayload onPayload) {
+        size_t index = 0;
+        while (state != State::completed) {
+            if (index == data.size()) return {index, Status::incomplete};
+            auto c = data[index];
+            switch (state) {
+            case State::data: {
+                if (decoded + remaining > sizeMax && !isChunked) return {index, Status::tooLarge};
+                auto size = static_cast<size_t>(std::min<uint64_t>(remaining, data.size() - index));
+                onPayload(data.substr(index, size));
+                index += size;
+                remaining -= size;
+                decoded += size;
+                if (remaining == 0) state = isChunked ? State::dataCR : State::completed;
+                continue;
+            }
+            case State::chunkSize:
+                if (auto digit = hexValue(c); digit >= 0) {
+                    if (remaining > (std::numeric_limits<uint64_t>::max() >> 4)) return {index, Status::malformed};
+                    remaining = remaining * 16 + static_cast<uint64_t>(digit);
+                    digits = true;
+                }
+                else if (!digits)
+                    return {index, Status::malformed};
+                else if (c == ';' || c == ' ' || c == '\t')
+                    state = State::chunkExtension;
+                else if (c == '\r')
+                    state = State::chunkSizeLF;
+                else
+                    return {index, Status::malformed};
+                break;
+            case State::chunkExtension:
+                if (c == '\r') state = State::chunkSizeLF;
+                break;
+            case State::chunkSizeLF:
+                if (c != '\n') return {index, Status::malformed};
+                if (decoded + remaining > sizeMax) return {index, Status::tooLarge};
+                state = remaining == 0 ? State::trailerLineStart : State::data;
+                break;
+            case State::dataCR:
+                if (c != '\r') return {index, Status::malformed};
+                state = State::dataLF;
+                break;
+            case State::dataLF:
+                if (c != '\n') return {index, Status::malformed};
+                state = State::chunkSize;
+                digits = false;
+                break;
+            case State::trailerLineStart: state = c == '\r' ? State::lastLF : State::trailerLine; break;
+            case State::trailerLine:
+                if (c == '\n') state = State::trailerLineStart; // Trailer fields are ignored
+                break;
+            case State::lastLF:
+                if (c != '\n') return {index, Status::malformed};
+                state = State::completed;
+                break;
+            case State::completed: break;
+            }
+            ++index;
+        }
+        return {index, Status::completed};
+    }
+
+private:
+    enum class State { data, chunkSize, chunkExtension, chunkSizeLF, dataCR, dataLF, trailerLineStart, trailerLine, lastLF, completed };
+    State state{State::completed};
+    bool isChunked{false};
+    bool digits{false};      // The chunk size has at least one digit
+    uint64_t remaining{0};   // Bytes of the body (Content-Length) or of the chunk left to decode, size of the chunk being parsed
+    uint64_t decoded{0};
+
+    BodyDecoder(State initial, uint64_t length) : state(length == 0 && initial == State::data ? State::completed : initial),
+                                                  isChunked(initial == State::chunkSize), remaining(length) {}
+
+    [[nodiscard]] static int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') return (c | 0x20) - 'a' + 10;
+        return -1;
+    }
+};
+
+/// Writes a body to a file as it is received : it is written to "<file>.part", renamed to file by commit() once complete.
+/// An upload not committed (failed, too large, connection lost) is removed when the sink is destroyed.
+class FileSink {
+public:
+    explicit FileSink(std::filesystem::path file) : path(std::move(file)), partPath(path.string() + ".part"), stream(partPath, std::ios::binary) {}
+    ~FileSink() {
+        if (committed) return;
+        stream.close();
+        std::error_code ec;
+        std::filesystem::remove(partPath, ec);
+    }
+    FileSink(const FileSink&) = delete;
+    FileSink(FileSink&&) = delete;
+    FileSink& operator=(const FileSink&) = delete;
+    FileSink& operator=(FileSink&&) = delete;
+
+    void write(std::span<const std::byte> data) {
+        if (stream) stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    /// @return true if the whole body has been written to the file
+    bool commit() {
+        stream.close();
+        if (!stream) return false;
+        std::error_code ec;
+        std::filesystem::rename(partPath, path, ec);
+        committed = !ec;
+        return committed;
+    }
+
+private:
+    std::filesystem::path path, partPath;
+    std::ofstream stream;
+    bool committed{false};
+};
+
+} // namespace webfront::http
@@ -0,0 +1,98 @@
+/// @date 17/10/2026 16:21:48
+/// @author Ambroise Leclerc
+/// @brief In-memory cache of serialized HTTP responses with a byte-size LRU bound
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace webfront::http {
+
+/// Headers and content of a response, shared by the cache and the connections sending it.
+struct SerializedResponse {
+    std::string headers;  /// "Name: value\r\n" lines
+    std::string content;
+    std::string encoding; /// Content-coding of content, empty for identity
+    std::string eTag;     /// Validators of the file, to answer the conditional requests without opening it
+    std::optional<std::chrono::sys_seconds> lastModified;
+
+    [[nodiscard]] size_t size() const { return headers.size() + content.size() + encoding.size() + eTag.size(); }
+};
+
+/// Responses keyed by normalized path, possibly followed by '\n' and a variant (e.g. its content coding), shared by the server threads.
+/// The least recently used ones are evicted above capacity bytes.
+class ResponseCache {
+public:
+    explicit ResponseCache(size_t capacityBytes) : capacity(capacityBytes) {}
+
+    /// @return the cached response of key (which becomes the most recently used one) or nullptr
+    [[nodiscard]] std::shared_ptr<const SerializedResponse> find(const std::string& key) {
+        std::scoped_lock lock(mutex);
+        auto found = index.find(key);
+        if (found == index.end()) return {};
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->response;
+    }
+
+    /// Count of invalidations so far : to be read before loading a response, then given to insert().
+    [[nodiscard]] uint64_t generation() const {
+        std::scoped_lock lock(mutex);
+        return invalidations;
+    }
+
+    /// Inserts a response loaded since loadGeneration : it is dropped if an invalidation happened meanwhile, as it may be stale.
+    void insert(const std::string& key, std::shared_ptr<const SerializedResponse> response, uint64_t loadGeneration) {
+        auto responseSize = key.size() + response->size();
+        std::scoped_lock lock(mutex);
+        if (responseSize > capacity || loadGeneration != invalidations) return;
+        if (auto found = index.find(key); found != index.end()) erase(found->second);
+        entries.push_front({key, std::move(response), responseSize});
+        index.emplace(key, entries.begin());
+        usedBytes += responseSize;
+        while (usedBytes > capacity) erase(std::prev(entries.end()));
+    }
+
+    /// Removes path with its variants and, if it is a directory, everything below it. An empty path clears the whole cache.
+    void invalidate(std::string_view path) {
+        std::scoped_lock lock(mutex);
+        ++invalidations;
+        for (auto entry = entries.begin(); entry != entries.end();) {
+            std::string_view key{entry->key};
+            bool below = key.starts_with(path) && (key.size() == path.size() || key[path.size()] == '/' || key[path.size()] == '\n' || path.empty());
+            entry = below ? erase(entry) : std::next(entry);
+        }
+    }
+
+    /// @return the bytes held by the cached responses (keys included)
+    [[nodiscard]] size_t size() const {
+        std::scoped_lock lock(mutex);
+        return usedBytes;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const SerializedResponse> response;
+        size_t size;
+    };
+    mutable std::mutex mutex;
+    size_t capacity, usedBytes{0};
+    uint64_t invalidations{0};
+    std::list<Entry> entries; // Most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+    std::list<Entry>::iterator erase(std::list<Entry>::iterator entry) {
+        usedBytes -= entry->size;
+        index.erase(entry->key);
+        return entries.erase(entry);
+    }
+};
+
+} // namespace webfront::http
@@ -0,0 +1,162 @@
+/// @date 19/10/2026 14:37:05
+/// @author Ambroise Leclerc
+/// @brief Routing of requests to C++ handlers on path patterns such as "/api/items/{id}" : trie of path segments
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace webfront::http {
+
+/// Path parameters and query string of a routed request : views into its request-target, still percent-encoded (see uri::decode).
+class RouteParameters {
+public:
+    static constexpr size_t capacity = 8; // Parameters of a pattern
+
+    /// @return the value of the path parameter {name}
+    [[nodiscard]] std::optional<std::string_view> operator[](std::string_view name) const {
+        auto found = std::ranges::find(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(count), name, &Parameter::first);
+        if (found == values.begin() + static_cast<std::ptrdiff_t>(count)) return {};
+        return found->second;
+    }
+    [[nodiscard]] size_t size() const { return count; }
+
+    /// @return the query string, without '?'
+    [[nodiscard]] std::string_view query() const { return queryString; }
+
+    /// @return the value of the first parameter name of the query string ("" for "?name" or "?name=")
+    [[nodiscard]] std::optional<std::string_view> queryValue(std::string_view name) const {
+        for (auto rest = queryString; !rest.empty();) {
+            auto ampersand = rest.find('&');
+            auto pair = rest.substr(0, ampersand);
+            rest = ampersand == std::string_view::npos ? std::string_view{} : rest.substr(ampersand + 1);
+            auto equal = pair.find('=');
+            if (pair.substr(0, equal) == name) return equal == std::string_view::npos ? std::string_view{} : pair.substr(equal + 1);
+        }
+        return {};
+    }
+
+private:
+    template<typename, typename>
+    friend class Router;
+    using Parameter = std::pair<std::string_view, std::string_view>; // Name (owned by the Router) and value
+    std::array<Parameter, capacity> values{};
+    size_t count{0};
+    std::string_view queryString;
+};
+
+/// Handlers of the routes, registered by method and path pattern before the server runs : find() is then safe from any thread.
+/// Method is an enumeration whose values up to Method::Undefined index the handlers. Handler is default constructible and testable
+/// (std::function). A segment of a pattern is either literal or a parameter "{name}" matching any non-empty segment : literal segments
+/// are preferred, the parameters being tried when the literal ones lead to no handler of the method.
+template<typename Method, typename Handler>
+class Router {
+public:
+    static constexpr size_t methodsCount = static_cast<size_t>(Method::Undefined);
+
+    struct Match {
+        const Handler* handler{nullptr};   // nullptr if no route of the method matches the path
+        std::bitset<methodsCount> allowed; // Methods routed on the path : a path routed for other methods only is answered 405
+        RouteParameters parameters;
+    };
+
+    /// @throw std::invalid_argument if the pattern is malformed or already routed for method
+    void add(Method method, std::string_view pattern, Handler handler) {
+        if (static_cast<size_t>(method) >= methodsCount) throw std::invalid_argument("Route of an undefined method");
+        if (!pattern.starts_with('/')) throw std::invalid_argument("Route pattern not starting with '/' : " + std::string(pattern));
+        Node* node = &root;
+        size_t parametersCount = 0;
+        forEachSegment(pattern, [&](std::string_view segment) {
+            if (segment.starts_with('{') && segment.ends_with('}') && segment.size() > 2) {
+                auto name = segment.substr(1, segment.size() - 2);
+                if (++parametersCount > RouteParameters::capacity) throw std::invalid_argument("Too many parameters : " + std::string(pattern));
+                if (!node->parameter) {
+                    node->parameter = std::make_unique<Node>();
+                    node->parameterName = name;
+                }
+                else if (node->parameterName != name)
+                    throw std::invalid_argument("Parameter {" + std::string(name) + "} routed as {" + node->parameterName + "} : " + std::string(pattern));
+                node = node->parameter.get();
+                return;
+            }
+            if (segment.find_first_of("{}") != std::string_view::npos) throw std::invalid_argument("Malformed route pattern : " + std::string(pattern));
+            auto position = std::ranges::lower_bound(node->literals, segment, {}, segmentOf);
+            if (position == node->literals.end() || position->first != segment)
+                position = node->literals.insert(position, {std::string(segment), std::make_unique<Node>()});
+            node = position->second.get();
+        });
+        auto index = static_cast<size_t>(method);
+        if (node->allowed.test(index)) throw std::invalid_argument("Route already defined : " + std::string(pattern));
+        node->handlers[index] = std::move(handler);
+        node->allowed.set(index);
+        ++routesCount;
+    }
+
+    /// @param target request-target in origin form ("/path?query"), as received
+    [[nodiscard]] Match find(Method method, std::string_view target) const {
+        Match match;
+        if (isEmpty() || !target.starts_with('/') || static_cast<size_t>(method) >= methodsCount) return match;
+        auto question = target.find('?');
+        if (question != std::string_view::npos) match.parameters.queryString = target.substr(question + 1);
+        find(root, target.substr(0, question), static_cast<size_t>(method), match);
+        return match;
+    }
+
+    [[nodiscard]] bool isEmpty() const { return routesCount == 0; }
+
+private:
+    struct Node {
+        using Literal = std::pair<std::string, std::unique_ptr<Node>>;
+        std::vector<Literal> literals; // Sorted by segment
+        std::unique_ptr<Node> parameter;
+        std::string parameterName;
+        std::array<Handler, methodsCount> handlers{};
+        std::bitset<methodsCount> allowed;
+    };
+    Node root;
+    size_t routesCount{0};
+
+    static std::string_view segmentOf(const typename Node::Literal& literal) { return literal.first; }
+
+    // Calls onSegment for each segment of path : "/" has a single empty segment, "/a/" has "a" and ""
+    template<typename OnSegment>
+    static void forEachSegment(std::string_view path, OnSegment onSegment) {
+        while (!path.empty()) {
+            path.remove_prefix(1);
+            auto slash = path.find('/');
+            onSegment(path.substr(0, slash));
+            path = slash == std::string_view::npos ? std::string_view{} : path.substr(slash);
+        }
+    }
+
+    // Depth-first search of the path (starting with '/' unless fully matched) from node, the literal segments first
+    static bool find(const Node& node, std::string_view path, size_t method, Match& match) {
+        if (path.empty()) {
+            match.allowed |= node.allowed;
+            if (!node.handlers[method]) return false;
+            match.handler = &node.handlers[method];
+            return true;
+        }
+        auto slash = path.find('/', 1);
+        auto segment = path.substr(1, slash == std::string_view::npos ? std::string_view::npos : slash - 1);
+        auto rest = slash == std::string_view::npos ? std::string_view{} : path.substr(slash);
+        auto literal = std::ranges::lower_bound(node.literals, segment, {}, segmentOf);
+        if (literal != node.literals.end() && literal->first == segment && find(*literal->second, rest, method, match)) return true;
+        if (!node.parameter || segment.empty()) return false;
+        auto& parameters = match.parameters;
+        parameters.values[parameters.count++] = {node.parameterName, segment};
+        if (find(*node.parameter, rest, method, match)) return true;
+        --parameters.count;
+        return false;
+    }
+};
+
+} // namespace webfront::http
@@ -0,0 +1,67 @@
+/// @date 17/10/2026 10:12:37
+/// @author Ambroise Leclerc
+/// @brief Bulk scanning of HTTP messages (SSE2/AVX2 on x86 with a scalar fallback)
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+namespace webfront::http::scanner {
+
+/// @return true for ASCII control characters (CR, LF and HTAB included)
+[[nodiscard]] constexpr bool isControl(char c) {
+    auto u = static_cast<uint8_t>(c);
+    return u < 0x20 || u == 0x7f;
+}
+
+inline constexpr auto tokenChars = [] {
+    std::array<bool, 256> table{};
+    for (auto c : std::string_view{"!#$%&'*+-.^_`|~0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"}) table[static_cast<uint8_t>(c)] = true;
+    return table;
+}();
+
+/// @return true for characters allowed in a RFC9110 token (methods and header names)
+[[nodiscard]] constexpr bool isTokenChar(char c) { return tokenChars[static_cast<uint8_t>(c)]; }
+
+[[nodiscard]] constexpr bool isToken(std::string_view text) {
+    if (text.empty()) return false;
+    for (auto c : text)
+        if (!isTokenChar(c)) return false;
+    return true;
+}
+
+/// @return the index of the first control character of text (line ends included) or npos
+[[nodiscard]] inline size_t findControl(std::string_view text) {
+    size_t index = 0;
+#if defined(__AVX2__)
+    const auto highestControl256 = _mm256_set1_epi8(0x1f), del256 = _mm256_set1_epi8(0x7f);
+    for (; index + 32 <= text.size(); index += 32) {
+        auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + index));
+        auto controls = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, highestControl256), chunk), _mm256_cmpeq_epi8(chunk, del256));
+        if (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(controls))) return index + static_cast<size_t>(std::countr_zero(mask));
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    const auto highestControl = _mm_set1_epi8(0x1f), del = _mm_set1_epi8(0x7f);
+    for (; index + 16 <= text.size(); index += 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + index));
+        auto controls = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(chunk, highestControl), chunk), _mm_cmpeq_epi8(chunk, del));
+        if (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(controls))) return index + static_cast<size_t>(std::countr_zero(mask));
+    }
+#endif
+    for (; index < text.size(); ++index)
+        if (isControl(text[index])) return index;
+    return std::string_view::npos;
+}
+
+} // namespace webfront::http::scanner
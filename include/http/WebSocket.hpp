@@ -3,15 +3,24 @@
 /// @brief WebSocket protocol implementation - RFC6455
 #pragma once
 #include "Encodings.hpp"
+#include "../networking/SocketTuning.hpp"
 #include "../tooling/HexDump.hpp"
 #include "../tooling/Logger.hpp"
+#include "../utils/MemoryBudget.hpp"
+#include "../utils/TimingWheel.hpp"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <set>
 #include <span>
+#include <utility>
+#include <vector>
 
 namespace webfront::websocket {
 using Handle = uint32_t;
@@ -137,7 +146,11 @@ struct Frame : public Header {
 
     [[nodiscard]] size_t size() const { return payloadSize(); };
 
-    std::vector<typename Net::ConstBuffer> toBuffers() const { return buffers; }
+    std::vector<typename Net::ConstBuffer> toBuffers() const {
+        auto frameBuffers = buffers;
+        frameBuffers.front() = typename Net::ConstBuffer(raw.data(), headerSize()); // raw may have moved with the Frame
+        return frameBuffers;
+    }
 
     /// @return size of added buffer
     size_t addBuffer(std::span<const std::byte> buffer) {
@@ -150,14 +163,25 @@ struct Frame : public Header {
     std::vector<typename Net::ConstBuffer> buffers;
 };
 
+/// Decodes the frames received. The payload buffer is sized by the header of each frame, a length chosen by the peer : it is bounded by
+/// payloadSizeMax and reserved from the account, if any, before being allocated. A refused frame stops the decoding (refused()). The bytes
+/// reserved are given back when reset() frees a large buffer, the others with the account, which outlives the decoder.
 class FrameDecoder {
 public:
     Header::Opcode frameType;
+    static constexpr uint64_t payloadSizeMaxDefault = 16 * 1024 * 1024;
 
 public:
-    FrameDecoder() : payloadBuffer(sizeof(Header)) { reset(); }
+    explicit FrameDecoder(utils::MemoryBudget::Account* memoryAccount = nullptr, uint64_t payloadSizeMaximum = payloadSizeMaxDefault)
+        : payloadBuffer(sizeof(Header)), account(memoryAccount), payloadSizeMax(payloadSizeMaximum) {
+        reset();
+    }
+
     std::span<const std::byte> payload() const { return std::span(payloadBuffer.data(), payloadSize); }
 
+    /// @return true if the payload of the frame being decoded exceeds payloadSizeMax or the memory of the account : the frame is dropped
+    [[nodiscard]] bool refused() const { return state == DecodingState::refused; }
+
     // Parses some incoming data and tries to decode it.
     // @return true if the frame is complete, false if it needs more data
     bool parse(std::span<const std::byte> buffer) {
@@ -170,7 +194,12 @@ class FrameDecoder {
             headerSize = reinterpret_cast<const Header*>(input)->headerSize();
             mask = reinterpret_cast<const Header*>(input)->maskingKey();
             frameType = reinterpret_cast<const Header*>(input)->opcode();
-            payloadBuffer.reserve(payloadSize);
+            if (!reservePayload()) {
+                log::warn("WebSocket frame of {} bytes refused", payloadSize);
+                state = DecodingState::refused;
+                return false;
+            }
+            return true;
         };
         auto bufferizeHeaderData = [&](std::span<const std::byte> input) -> size_t {
             for (size_t index = 0; index < input.size(); ++index) {
@@ -184,7 +213,7 @@ class FrameDecoder {
         case DecodingState::starting:
             if (reinterpret_cast<const Header*>(buffer.data())->isComplete(buffer.size())) {
                 reinterpret_cast<const Header*>(buffer.data())->dump();
-                decodeHeader(buffer.data());
+                if (!decodeHeader(buffer.data())) return false;
                 if (decodePayload(buffer.subspan(headerSize, std::min(buffer.size() - headerSize, payloadSize))) == payloadSize) return true;
                 state = DecodingState::decodingPayload;
             }
@@ -196,7 +225,7 @@ class FrameDecoder {
         case DecodingState::partialHeader: {
             auto consumedData = bufferizeHeaderData(buffer);
             if (headerBuffer.isComplete(headerBufferParser)) {
-                decodeHeader(headerBuffer.raw.data());
+                if (!decodeHeader(headerBuffer.raw.data())) return false;
                 if (decodePayload(buffer.subspan(consumedData, std::min(buffer.size() - consumedData, payloadSize))) == payloadSize) return true;
                 state = DecodingState::decodingPayload;
             }
@@ -205,36 +234,78 @@ class FrameDecoder {
             decodePayload(buffer.first(std::min(payloadSize - payloadBuffer.size(), buffer.size())));
             return (buffer.size() >= (payloadSize - payloadBuffer.size()));
         }
+        case DecodingState::refused: break;
         }
         return false;
     }
 
+    /// Prepares the decoding of the next frame. A payload buffer larger than retainedSize is freed.
     void reset() {
         maskIndex = 0;
         headerBufferParser = 0;
         payloadBuffer.clear();
+        if (payloadBuffer.capacity() > retainedSize) {
+            payloadBuffer = {};
+            if (account) account->release(std::exchange(charged, 0));
+        }
         state = DecodingState::starting;
     }
 
 private:
-    enum class DecodingState { starting, partialHeader, decodingPayload } state;
+    static constexpr size_t retainedSize = 64 * 1024; // Capacity of the payload buffer kept from one frame to the next
+    enum class DecodingState { starting, partialHeader, decodingPayload, refused } state;
     std::vector<std::byte> payloadBuffer;
+    utils::MemoryBudget::Account* account; // Of the payload buffer beyond its initial capacity
+    uint64_t payloadSizeMax;
+    size_t charged{0};                     // Bytes of payloadBuffer reserved from account
     Header headerBuffer;
     size_t headerBufferParser;
     size_t payloadSize, headerSize;
     std::array<std::byte, 4> mask;
     uint8_t maskIndex;
+
+    // Reserves the memory of the payload announced by the header before allocating it
+    bool reservePayload() {
+        if (payloadSize > payloadSizeMax) return false;
+        if (payloadSize <= payloadBuffer.capacity()) return true;
+        if (account) {
+            if (payloadSize <= charged) return true;
+            if (!account->reserve(payloadSize - charged)) return false;
+            charged = payloadSize;
+        }
+        payloadBuffer.reserve(payloadSize);
+        return true;
+    }
+};
+
+/// Memory limits of a WebSocket
+struct Limits {
+    utils::MemoryBudget* budget{nullptr}; ///< Budget the received messages and the pending writes of the WebSocket are reserved from
+    size_t memoryMax{0};                  ///< Bytes of the message being received and of the pending writes (0 for no limit)
+    uint64_t messageSizeMax{FrameDecoder::payloadSizeMaxDefault}; ///< Larger messages received close the WebSocket (1009 Message Too Big)
 };
 
 template<typename Net>
 class WebSocket {
     typename Net::Socket socket;
+    typename Net::Strand strand;
     static constexpr size_t receptionBufferSize = 8192;
 
 public:
-    explicit WebSocket(typename Net::Socket netSocket) : socket(std::move(netSocket)), started(false) {
+    /// The WebSocket does not read from the socket before start() is called, so that handlers can be installed first.
+    /// With a timing wheel, a peer silent for pingInterval is pinged and the socket is closed if it stays silent for another interval, or if
+    /// a write makes no progress during an interval : half-open connections and peers not reading are released.
+    /// Its reception buffer, the message being received and the messages waiting to be sent are accounted against limits : a message
+    /// larger than limits.messageSizeMax, or exceeding limits.memoryMax, closes it.
+    /// The socket is tuned with socketProfile before the messages written without a profile of their own (none leaves it as it is).
+    explicit WebSocket(typename Net::Socket netSocket, utils::TimingWheel* timingWheel = nullptr, std::chrono::milliseconds pingInterval = {},
+                       Limits limits = {}, std::optional<networking::SocketProfile> socketProfile = {})
+        : socket(std::move(netSocket)), strand(socket.get_executor()), started(false), interval(pingInterval),
+          account(std::make_unique<utils::MemoryBudget::Account>(limits.budget, limits.memoryMax)), decoder(account.get(), limits.messageSizeMax),
+          profile(socketProfile) {
+        if (timingWheel && interval.count() > 0) keepAlive = std::make_unique<utils::TimingWheel::Timer>(*timingWheel);
+        account->charge(receptionBufferSize);
         log::debug("WebSocket constructor");
-        start();
     }
     WebSocket(const WebSocket&) = delete;
     WebSocket(WebSocket&&) = default;
@@ -244,34 +315,121 @@ class WebSocket {
 
     void start() {
         started = true;
+        if (keepAlive) {
+            keepAlive->onExpiry([this, alive = guard()] {
+                Net::Post(strand, [this, alive] {
+                    if (!alive.expired()) timedOut();
+                });
+            });
+            keepAlive->expiresAfter(interval);
+        }
         read();
     }
 
     void stop() {
         started = false;
+        if (keepAlive) keepAlive->cancel();
         socket.close();
     }
 
     void onMessage(std::function<void(std::string_view)>&& handler) { textHandler = std::move(handler); }
     void onMessage(std::function<void(std::span<const std::byte>)>&& handler) { binaryHandler = std::move(handler); }
+    /// handler is called once, by a handler of its own on the strand, when the WebSocket is closed whatever the reason (closing handshake, error,
+    /// limits exceeded) : it may destroy the WebSocket, the operations still pending then doing nothing
     void onClose(std::function<void(CloseEvent)>&& handler) { closeHandler = std::move(handler); }
-    void write(std::string_view text) { writeData(Frame<Net>(text)); }
-    void write(std::span<const std::byte> data) { writeData(Frame<Net>(data)); }
-    void write(std::span<const std::byte> data, std::span<const std::byte> data2) { writeData(Frame<Net>(data, data2)); }
-    void write(Frame<Net> frame) { writeData(std::move(frame)); }
+    /// The data of the message is copied : it may be released once the call returns. Writes may be requested from any thread.
+    /// @param messageProfile socket profile of this class of messages (e.g. lowLatency for the UI updates, throughput for bulk data) : the
+    /// socket is tuned with it before the message is written, the WebSocket's profile applying to the messages written without one
+    /// @return false if the message has been dropped : the memory budget is exhausted (backpressure, the caller may try again later) or the
+    /// pending writes exceed the memory of the WebSocket (its peer does not read them : it is closed)
+    bool write(std::string_view text, std::optional<networking::SocketProfile> messageProfile = {}) {
+        return writeData(Frame<Net>(text), messageProfile);
+    }
+    bool write(std::span<const std::byte> data, std::optional<networking::SocketProfile> messageProfile = {}) {
+        return writeData(Frame<Net>(data), messageProfile);
+    }
+    bool write(std::span<const std::byte> data, std::span<const std::byte> data2, std::optional<networking::SocketProfile> messageProfile = {}) {
+        return writeData(Frame<Net>(data, data2), messageProfile);
+    }
+    bool write(Frame<Net> frame, std::optional<networking::SocketProfile> messageProfile = {}) {
+        return writeData(std::move(frame), messageProfile);
+    }
+
+    /// Sets the socket profile of the following messages written without a profile of their own
+    void setProfile(networking::SocketProfile socketProfile) {
+        Net::Dispatch(strand, [this, alive = guard(), socketProfile] {
+            if (!alive.expired()) profile = socketProfile;
+        });
+    }
+
+    /// @return the memory held by the WebSocket : reception buffer, message being received and pending writes
+    [[nodiscard]] const utils::MemoryBudget::Account& memory() const { return *account; }
+
+    /// @return a function running tasks on the strand of the WebSocket : at once when called from it, later from the other threads. It may be
+    /// called from any thread, even once the WebSocket is destroyed : the tasks not run yet are then dropped.
+    [[nodiscard]] std::function<void(std::function<void()>)> runner() const {
+        return [strand = strand, alive = guard()](std::function<void()> task) {
+            Net::Dispatch(strand, [alive, task = std::move(task)] {
+                if (!alive.expired()) task();
+            });
+        };
+    }
 
 private:
+    // Frame waiting to be written, owning a copy of its header and payload
+    struct Outgoing {
+        std::array<std::byte, Header::maxHeaderSize> header;
+        size_t headerSize;
+        std::vector<std::byte> payload;
+        std::optional<networking::SocketProfile> profile;
+        [[nodiscard]] size_t size() const { return headerSize + payload.size(); }
+    };
+
     std::array<std::byte, receptionBufferSize> readBuffer;
-    FrameDecoder decoder;
     std::function<void(std::string_view)> textHandler;
     std::function<void(std::span<const std::byte>)> binaryHandler;
     std::function<void(CloseEvent)> closeHandler;
     bool started;
+    std::chrono::milliseconds interval;
+    std::unique_ptr<utils::TimingWheel::Timer> keepAlive; // Held by pointer : the WebSocket stays movable until it is started
+    std::unique_ptr<utils::MemoryBudget::Account> account; // Declared before decoder, which reserves from it
+    FrameDecoder decoder;
+    bool heard{false}, pinged{false}, writeProgressed{false};
+    std::deque<Outgoing> outgoing; // Frames written one after the other : the first one is being written
+    std::optional<CloseEvent> closing; // Of the close frame queued : the socket is closed and the handler called once outgoing has been written
+    bool closeNotified{false};
+    std::optional<networking::SocketProfile> profile, tuned; // Of the messages written without one, and applied to the socket
+    std::shared_ptr<bool> lifetime{std::make_shared<bool>(true)}; // Expires with the WebSocket : the handlers pending on the strand do nothing
+
+    [[nodiscard]] std::weak_ptr<bool> guard() const { return lifetime; }
+
+    void timedOut() {
+        if (!started) return;
+        if (!outgoing.empty() && !writeProgressed) {
+            log::debug("WebSocket peer not reading for {}ms : closing", interval.count());
+            return abort("Peer not reading");
+        }
+        if (!heard) {
+            if (pinged) {
+                log::debug("WebSocket peer silent for {}ms : closing", 2 * interval.count());
+                return abort("Peer silent");
+            }
+            pinged = true;
+            Frame<Net> ping{std::span<const std::byte>{}};
+            ping.setOpcode(Header::Opcode::ping);
+            writeData(std::move(ping));
+        }
+        heard = writeProgressed = false;
+        keepAlive->expiresAfter(interval);
+    }
 
 private:
     void read() {
-        socket.async_read_some(Net::Buffer(readBuffer), [this](std::error_code ec, std::size_t bytesTransferred) {
+        socket.async_read_some(Net::Buffer(readBuffer), Net::BindExecutor(strand, [this, alive = guard()](std::error_code ec, std::size_t bytesTransferred) {
+            if (alive.expired()) return;
             if (!ec) {
+                heard = true;
+                pinged = false;
                 if (decoder.parse(std::span(readBuffer.data(), bytesTransferred))) {
                     auto data = decoder.payload();
                     switch (decoder.frameType) {
@@ -282,33 +440,123 @@ class WebSocket {
                         if (binaryHandler) binaryHandler(data);
                         break;
                     case Header::Opcode::connectionClose:
-                        if (closeHandler) closeHandler(CloseEvent{});
                         stop();
+                        notifyClose(CloseEvent{});
                         break;
                     default: log::debug("Unhandled frameType");
                     };
                     decoder.reset();
                 }
+                else if (decoder.refused())
+                    return close(CloseEvent{1009, "Message Too Big"});
                 read();
             }
             else {
                 log::error("Error in websocket::read() : {}:{}", ec.value(), ec.message());
-                if (closeHandler) closeHandler(CloseEvent{static_cast<uint16_t>(ec.value()), ec.message()});
                 stop();
+                notifyClose(CloseEvent{static_cast<uint16_t>(ec.value()), ec.message()});
             }
+        }));
+    }
+
+    // Stops reading and sends a close frame of event's status : the socket is closed and the close handler called once it has been written.
+    // Called on the strand.
+    void close(CloseEvent event) {
+        log::warn("Closing WebSocket : {} {}", event.status, event.reason);
+        std::array status{std::byte(event.status >> 8), std::byte(event.status & 0xFF)};
+        Frame<Net> frame{std::span<const std::byte>(status)};
+        frame.setOpcode(Header::Opcode::connectionClose);
+        account->charge(frame.getFrameSize()); // Sent whatever the limits
+        closing = std::move(event);
+        push(toOutgoing(frame));
+    }
+
+    // Closes the socket at once, without closing handshake (1006 Abnormal Closure), the peer being unresponsive or exceeding its limits.
+    // Called on the strand.
+    void abort(std::string reason) {
+        log::warn("Aborting WebSocket : {}", reason);
+        stop();
+        notifyClose(CloseEvent{1006, std::move(reason)});
+    }
+
+    // Calls the close handler once, from a handler of its own since it may destroy the WebSocket
+    void notifyClose(CloseEvent event) {
+        if (std::exchange(closeNotified, true) || !closeHandler) return;
+        Net::Post(strand, [alive = guard(), handler = closeHandler, event = std::move(event)] {
+            if (!alive.expired()) handler(event);
         });
     }
 
-    void writeData(Frame<Net> frame) {
-        Net::AsyncWrite(socket, frame.toBuffers(), [this](std::error_code ec, std::size_t /*bytesTransferred*/) {
-            if (ec) {
-                if (started) {
-                    log::error("Error during write : ec.value() = {}", ec.value());
-                    if (closeHandler) closeHandler(CloseEvent{static_cast<uint16_t>(ec.value()), ec.message()});
-                    if (ec != Net::Error::OperationAborted) stop();
-                }
+    // Writes may be requested from any thread : the frame is copied, then queued on the WebSocket's strand and written once the previous
+    // ones have been written
+    bool writeData(Frame<Net> frame, std::optional<networking::SocketProfile> messageProfile = {}) {
+        if (!account->reserve(frame.getFrameSize())) {
+            if (account->limit() != 0 && account->used() + frame.getFrameSize() > account->limit()) {
+                log::warn("WebSocket pending writes exceed {} bytes : closing", account->limit());
+                Net::Post(strand, [this, alive = guard()] {
+                    if (!alive.expired() && started) abort("Pending writes exceed the limit");
+                });
             }
+            else
+                log::warn("Memory budget exhausted : WebSocket message of {} bytes dropped", frame.size());
+            return false;
+        }
+        auto message = toOutgoing(frame);
+        message.profile = messageProfile;
+        Net::Dispatch(strand, [this, alive = guard(), message = std::move(message)]() mutable {
+            if (!alive.expired()) push(std::move(message));
         });
+        return true;
+    }
+
+    static Outgoing toOutgoing(const Frame<Net>& frame) {
+        Outgoing message;
+        message.headerSize = frame.headerSize();
+        std::copy_n(frame.raw.begin(), message.headerSize, message.header.begin());
+        message.payload.reserve(frame.size());
+        for (auto buffer : std::span(frame.buffers).subspan(1)) {
+            auto data = static_cast<const std::byte*>(buffer.data());
+            message.payload.insert(message.payload.end(), data, data + buffer.size());
+        }
+        return message;
+    }
+
+    void push(Outgoing message) {
+        outgoing.push_back(std::move(message));
+        if (outgoing.size() == 1) writeNext();
+    }
+
+    void writeNext() {
+        if (outgoing.empty()) {
+            if (closing) {
+                stop();
+                notifyClose(*closing);
+            }
+            return;
+        }
+        auto& message = outgoing.front();
+        if (auto wanted = message.profile ? message.profile : profile; wanted && wanted != tuned) {
+            if (!Net::Tune(socket, networking::SocketTuning::of(*wanted))) log::debug("WebSocket socket options partly refused");
+            tuned = wanted;
+        }
+        auto progress = [this](std::error_code ec, std::size_t bytesTransferred) -> std::size_t {
+            if (bytesTransferred > 0) writeProgressed = true;
+            return ec ? 0 : 64 * 1024;
+        };
+        Net::AsyncWrite(socket, std::array{Net::Buffer(message.header.data(), message.headerSize), Net::Buffer(message.payload.data(), message.payload.size())},
+                        progress, Net::BindExecutor(strand, [this, alive = guard()](std::error_code ec, std::size_t /*bytesTransferred*/) {
+            if (alive.expired()) return;
+            account->release(outgoing.front().size());
+            outgoing.pop_front();
+            if (!ec) return writeNext();
+            for (auto& pending : outgoing) account->release(pending.size());
+            outgoing.clear();
+            if (started) {
+                log::error("Error during write : ec.value() = {}", ec.value());
+                if (ec != Net::Error::OperationAborted) stop();
+                notifyClose(CloseEvent{static_cast<uint16_t>(ec.value()), ec.message()});
+            }
+        }));
     }
 };
 
@@ -22,6 +22,8 @@ concept Features = requires {
     typename T::IoContext;
     typename T::Resolver;
     typename T::Socket;
+    typename T::Strand;
+    typename T::SteadyTimer;
     typename T::ConstBuffer;
     typename T::MutableBuffer;
 };
@@ -3,6 +3,7 @@
 /// @brief a Networking mock implementation for testing purposes
 #pragma once
 #include "BasicNetworking.hpp"
+#include "SocketTuning.hpp"
 
 #include <algorithm>
 #include <array>
@@ -11,10 +12,28 @@
 #include <string_view>
 #include <system_error>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 namespace webfront::networking {
 
 class IoContextMock {};
 
+/// Strands are meaningless for the mock : every handler is invoked synchronously.
+class StrandMock {
+public:
+    explicit StrandMock(IoContextMock) {}
+};
+
+class SteadyTimerMock {
+public:
+    explicit SteadyTimerMock(IoContextMock&) {}
+    void expires_after(auto /*duration*/) {}
+    void async_wait(auto /*completionFunction*/) {}
+    size_t cancel() { return 0; }
+};
+
 class EndpointMock {
     std::string originalAddress, originalPort;
 
@@ -31,6 +50,11 @@ class SocketBaseMock {
         bool value() { return isSet; }
     };
     void set_option(reuse_address option) { log::debug("SocketBaseMock::set_option(reuse_address({}))", option.value()); }
+    struct reuse_port {
+        bool isSet;
+        bool value() { return isSet; }
+    };
+    void set_option(reuse_port option) { log::debug("SocketBaseMock::set_option(reuse_port({}))", option.value()); }
     void bind(const EndpointMock&) { log::debug("SocketBaseMock::bind()"); }
     void listen(int backlog = max_connections) { log::debug("SocketBaseMock::listen({})", backlog); }
 
@@ -54,6 +78,7 @@ class SocketMock : public SocketBaseMock {
     inline static size_t bufferIndex = 0;
 
     enum shutdown_type { shutdown_receive, shutdown_send, shutdown_both };
+    using executor_type = IoContextMock;
 
 public:
     SocketMock() {
@@ -69,6 +94,7 @@ class SocketMock : public SocketBaseMock {
         return inputBuffer.size();
     }
 
+    executor_type get_executor() { return {}; }
     void close() { log::debug("SocketMock::close()"); }
     void shutdown(shutdown_type type) { log::debug("SocketMock::shutdown({})", static_cast<int>(type)); }
 };
@@ -89,10 +115,13 @@ class AcceptorMock : public SocketBaseMock {
 class NetworkingMock : public BasicNetworking<> {
 public:
     using Acceptor = AcceptorMock;
+    using ReusePort = AcceptorMock::reuse_port;
     using Endpoint = EndpointMock;
     using IoContext = IoContextMock;
     using Resolver = ResolverMock;
     using Socket = SocketMock;
+    using Strand = StrandMock;
+    using SteadyTimer = SteadyTimerMock;
     using super::ConstBuffer;
     using super::MutableBuffer;
 
@@ -113,6 +142,50 @@ class NetworkingMock : public BasicNetworking<> {
         });
     }
 
+    /// completionCondition(error_code, bytesTransferred) is told the progress of the write after each buffer
+    template<typename WriteHandler>
+    static void AsyncWrite(Socket socket, auto buffers, auto completionCondition, WriteHandler writeHandler) {
+        AsyncWrite(socket, std::move(buffers), [completionCondition, writeHandler](std::error_code ec, size_t bytesTransferred) mutable {
+            completionCondition(ec, bytesTransferred);
+            writeHandler(ec, bytesTransferred);
+        });
+    }
+
+    /// Writes size bytes of the file read from fileDescriptor at offset to the socket, as the kernel would with sendfile
+    template<typename WriteHandler>
+    static void AsyncSendFile([[maybe_unused]] Socket socket, [[maybe_unused]] int fileDescriptor, [[maybe_unused]] size_t offset, [[maybe_unused]] size_t size,
+                              WriteHandler writeHandler) {
+        std::error_code ec;
+        size_t bytesTransferred = 0;
+#if defined(__linux__)
+        std::array<char, 512> buffer;
+        while (bytesTransferred < size) {
+            auto position = static_cast<off_t>(offset + bytesTransferred);
+            auto count = ::pread(fileDescriptor, buffer.data(), std::min(buffer.size(), size - bytesTransferred), position);
+            if (count <= 0) return writeHandler(std::make_error_code(std::errc::io_error), bytesTransferred);
+            bytesTransferred += socket.write_some(Buffer(buffer.data(), static_cast<size_t>(count)), ec);
+        }
+#else
+        ec = std::make_error_code(std::errc::operation_not_supported);
+#endif
+        writeHandler(ec, bytesTransferred);
+    }
+
+    /// Last tuning applied to a socket, and whether it is corked : sockets of the mock share them as they share debugBuffer
+    inline static SocketTuning tuned{};
+    inline static bool corked{false};
+
+    static bool Tune(Acceptor&, const SocketTuning&) { return true; }
+    static bool Tune(Socket&, const SocketTuning& tuning) {
+        tuned = tuning;
+        return true;
+    }
+    static void Cork(Socket&, bool cork) { corked = cork; }
+
+    static auto BindExecutor(auto&& /*executor*/, auto handler) { return handler; }
+    static void Dispatch(auto&& /*executor*/, auto handler) { handler(); }
+    static void Post(auto&& /*executor*/, auto handler) { handler(); }
+
     struct Error {
         static inline const auto OperationAborted = std::make_error_code(std::errc::operation_canceled);
     };
@@ -0,0 +1,40 @@
+/// @date 23/10/2026 09:12:40
+/// @author Ambroise Leclerc
+/// @brief Socket tuning profiles : latency of the interactive exchanges vs throughput of the bulk transfers
+#pragma once
+
+namespace webfront::networking {
+
+/// Named sets of socket options, applied by Features::Tune()
+enum class SocketProfile {
+    system,     ///< Options left to the system (Nagle's algorithm, autotuned buffers)
+    lowLatency, ///< Interactive exchanges (UI frames, small responses) : every write is sent at once, reads busy poll the device
+    throughput  ///< Bulk transfers (assets, data) : writes coalesced into full segments, large buffers
+};
+
+/// Socket options of a profile. The acceptor options apply to the sockets it accepts. Each option is applied as far as the platform
+/// supports it : an option refused (e.g. SO_BUSY_POLL beyond net.core.busy_poll without CAP_NET_ADMIN) is skipped.
+struct SocketTuning {
+    bool noDelay{false};      ///< TCP_NODELAY : small writes sent at once instead of being coalesced until the previous ones are acknowledged
+    bool cork{false};         ///< TCP_CORK while a response is written in several steps (header then file) : only full segments are sent
+    int sendBufferSize{0};    ///< SO_SNDBUF bytes, 0 to keep the autotuning of the system (it cannot be restored once set)
+    int receiveBufferSize{0}; ///< SO_RCVBUF bytes, set on the acceptor so that the window scale of the accepted connections accounts for it
+    int deferAccept{0};       ///< Acceptor : TCP_DEFER_ACCEPT seconds waiting for the first data of a connection before accepting it
+    int fastOpenQueue{0};     ///< Acceptor : TCP_FASTOPEN connections whose request came with their SYN, pending their accept (0 disables)
+    int busyPoll{0};          ///< SO_BUSY_POLL microseconds of busy polling of the device queue by the reads, instead of waiting for an interrupt
+
+    [[nodiscard]] bool operator==(const SocketTuning&) const = default;
+
+    /// @return the options of profile
+    [[nodiscard]] static constexpr SocketTuning of(SocketProfile profile) {
+        switch (profile) {
+        case SocketProfile::lowLatency: return {.noDelay = true, .fastOpenQueue = 256, .busyPoll = 50};
+        case SocketProfile::throughput:
+            return {.cork = true, .sendBufferSize = 4 * 1024 * 1024, .receiveBufferSize = 4 * 1024 * 1024, .deferAccept = 1, .fastOpenQueue = 256};
+        case SocketProfile::system: break;
+        }
+        return {};
+    }
+};
+
+} // namespace webfront::networking
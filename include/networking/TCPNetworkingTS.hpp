@@ -4,9 +4,31 @@
 #pragma once
 
 #include "BasicNetworking.hpp"
+#include "SocketTuning.hpp"
 
 #include <experimental/net>
 
+#include <cstddef>
+#include <system_error>
+
+#if defined(__linux__)
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#endif
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
 namespace webfront::networking {
 
 class TCPNetworkingTS : public BasicNetworking<std::experimental::net::const_buffer, std::experimental::net::mutable_buffer> {
@@ -16,6 +38,8 @@ class TCPNetworkingTS : public BasicNetworking<std::experimental::net::const_buf
     using IoContext = std::experimental::net::io_context;
     using Resolver = std::experimental::net::ip::tcp::resolver;
     using Socket = std::experimental::net::ip::tcp::socket;
+    using Strand = std::experimental::net::strand<Socket::executor_type>;
+    using SteadyTimer = std::experimental::net::steady_timer;
     using super::ConstBuffer;
     using super::MutableBuffer;
 
@@ -29,9 +53,138 @@ class TCPNetworkingTS : public BasicNetworking<std::experimental::net::const_buf
         return std::experimental::net::write(std::forward<Args>(args)...);
     }
 
+    template<typename... Args>
+    static auto BindExecutor(Args&&... args) -> decltype(std::experimental::net::bind_executor(std::forward<Args>(args)...)) {
+        return std::experimental::net::bind_executor(std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    static auto Dispatch(Args&&... args) -> decltype(std::experimental::net::dispatch(std::forward<Args>(args)...)) {
+        return std::experimental::net::dispatch(std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    static auto Post(Args&&... args) -> decltype(std::experimental::net::post(std::forward<Args>(args)...)) {
+        return std::experimental::net::post(std::forward<Args>(args)...);
+    }
+
+    /// Sends size bytes of the file fileDescriptor from offset, from the page cache to the socket (sendfile), waiting for the socket to be
+    /// writable whenever its send buffer is full. handler(error_code, bytesSent) is called once everything has been sent or on error.
+    template<typename Handler>
+    static void AsyncSendFile(Socket& socket, int fileDescriptor, std::size_t offset, std::size_t size, Handler handler) {
+#if defined(__linux__)
+        auto flags = ::fcntl(socket.native_handle(), F_GETFL);
+        if (flags < 0 || ::fcntl(socket.native_handle(), F_SETFL, flags | O_NONBLOCK) < 0) return handler(std::error_code(errno, std::system_category()), 0);
+        sendFileFrom(socket, fileDescriptor, static_cast<off_t>(offset), static_cast<off_t>(offset + size), std::move(handler), static_cast<off_t>(offset));
+#else
+        handler(std::make_error_code(std::errc::operation_not_supported), 0);
+#endif
+    }
+
+    /// Acceptor option letting several acceptors, one per thread, listen to the same port : the kernel spreads the incoming connections among
+    /// them (SO_REUSEPORT). Where it does not exist, SO_REUSEADDR is set instead and the connections are not spread.
+    class ReusePort {
+    public:
+        explicit ReusePort(bool enabled) : value(enabled ? 1 : 0) {}
+        template<typename Protocol>
+        [[nodiscard]] int level(const Protocol&) const { return SOL_SOCKET; }
+        template<typename Protocol>
+        [[nodiscard]] int name(const Protocol&) const {
+#if defined(SO_REUSEPORT)
+            return SO_REUSEPORT;
+#else
+            return SO_REUSEADDR;
+#endif
+        }
+        template<typename Protocol>
+        [[nodiscard]] const void* data(const Protocol&) const { return &value; }
+        template<typename Protocol>
+        [[nodiscard]] std::size_t size(const Protocol&) const { return sizeof(value); }
+
+    private:
+        int value;
+    };
+
+    /// Applies the options of tuning to an acceptor, before it listens : they are inherited by the sockets it accepts.
+    /// @return false if an option has been refused or is not supported
+    static bool Tune(Acceptor& acceptor, const SocketTuning& tuning) {
+        auto handle = acceptor.native_handle();
+        auto applied = !tuning.receiveBufferSize || setOption(handle, SOL_SOCKET, SO_RCVBUF, tuning.receiveBufferSize);
+        if (tuning.deferAccept) {
+#if defined(TCP_DEFER_ACCEPT)
+            applied &= setOption(handle, IPPROTO_TCP, TCP_DEFER_ACCEPT, tuning.deferAccept);
+#else
+            applied = false;
+#endif
+        }
+        if (tuning.fastOpenQueue) {
+#if defined(TCP_FASTOPEN)
+            applied &= setOption(handle, IPPROTO_TCP, TCP_FASTOPEN, tuning.fastOpenQueue);
+#else
+            applied = false;
+#endif
+        }
+        return applied;
+    }
+
+    /// Applies the options of tuning to a connected socket : it can be tuned again, e.g. before each class of messages.
+    /// @return false if an option has been refused or is not supported
+    static bool Tune(Socket& socket, const SocketTuning& tuning) {
+        auto handle = socket.native_handle();
+        auto applied = setOption(handle, IPPROTO_TCP, TCP_NODELAY, tuning.noDelay ? 1 : 0);
+        if (tuning.sendBufferSize) applied &= setOption(handle, SOL_SOCKET, SO_SNDBUF, tuning.sendBufferSize);
+        if (tuning.receiveBufferSize) applied &= setOption(handle, SOL_SOCKET, SO_RCVBUF, tuning.receiveBufferSize);
+#if defined(SO_BUSY_POLL)
+        applied &= setOption(handle, SOL_SOCKET, SO_BUSY_POLL, tuning.busyPoll);
+#else
+        applied &= tuning.busyPoll == 0;
+#endif
+        return applied;
+    }
+
+    /// Holds the partial segments written to socket until it is uncorked (TCP_CORK), so that a response written in several steps leaves
+    /// in full segments. Nothing is held where it is not supported.
+    static void Cork(Socket& socket, bool corked) {
+#if defined(TCP_CORK)
+        setOption(socket.native_handle(), IPPROTO_TCP, TCP_CORK, corked ? 1 : 0);
+#else
+        (void)socket;
+        (void)corked;
+#endif
+    }
+
     struct Error {
         static inline const auto OperationAborted = std::experimental::net::error::operation_aborted;
     };
+
+private:
+    template<typename NativeHandle>
+    static bool setOption(NativeHandle handle, int level, int name, int value) {
+        return ::setsockopt(handle, level, name, reinterpret_cast<const char*>(&value), sizeof(value)) == 0;
+    }
+
+#if defined(__linux__)
+    // Sends the bytes [offset, end) of the file, first being the offset of the whole transfer
+    template<typename Handler>
+    static void sendFileFrom(Socket& socket, int fileDescriptor, off_t offset, off_t end, Handler handler, off_t first) {
+        auto sentCount = [&] { return static_cast<std::size_t>(offset - first); };
+        while (offset < end) {
+            auto sent = ::sendfile(socket.native_handle(), fileDescriptor, &offset, static_cast<std::size_t>(end - offset));
+            if (sent > 0) continue;
+            if (sent == 0) return handler(std::make_error_code(std::errc::io_error), sentCount()); // File truncated
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN) return handler(std::error_code(errno, std::system_category()), sentCount());
+            // Resumed on the executor of handler (the connection's strand) : the socket is not closed meanwhile
+            auto executor = std::experimental::net::get_associated_executor(handler, socket.get_executor());
+            auto resume = [&socket, fileDescriptor, offset, end, handler = std::move(handler), first](std::error_code ec) mutable {
+                if (ec) return handler(ec, static_cast<std::size_t>(offset - first));
+                sendFileFrom(socket, fileDescriptor, offset, end, std::move(handler), first);
+            };
+            return socket.async_wait(Socket::wait_write, BindExecutor(executor, std::move(resume)));
+        }
+        handler(std::error_code{}, sentCount());
+    }
+#endif
 };
 
 } // namespace webfront::networking
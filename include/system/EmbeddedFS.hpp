@@ -0,0 +1,141 @@
+/// @date 17/10/2026 18:02:15
+/// @author Ambroise Leclerc
+/// @brief Base of the virtual file systems generated by the webfront_embed_assets() CMake function.
+#pragma once
+
+#include "FileSystem.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace webfront::fs {
+
+/// One variant (identity, gzip or br encoded) of an embedded file, stored at offset in the assets blob.
+struct EmbeddedAsset {
+    std::string_view path;
+    std::string_view encoding;
+    size_t offset;
+    size_t size;
+    std::string_view etag{}; // Quoted entity tag of the variant, computed at build time
+
+    [[nodiscard]] constexpr auto key() const { return std::pair{path, encoding}; }
+};
+
+namespace details {
+template<typename Assets>
+constexpr const EmbeddedAsset* findAsset(std::string_view path, std::string_view encoding) {
+    auto asset = std::ranges::lower_bound(Assets::assets, std::pair{path, encoding}, {}, &EmbeddedAsset::key);
+    if (asset == Assets::assets.end() || asset->key() != std::pair{path, encoding}) return nullptr;
+    return &*asset;
+}
+
+/// Variant of path served by EmbeddedFS : the Assets::encoding one if it has been embedded, the identity one otherwise
+template<typename Assets>
+constexpr const EmbeddedAsset* servedAsset(std::string_view path) {
+    auto asset = findAsset<Assets>(path, Assets::encoding);
+    return asset ? asset : findAsset<Assets>(path, "");
+}
+
+/// @return true if the responses serving asset vary with the Accept-Encoding of the request : its path has several variants, or it is
+/// encoded and decoded for the clients not accepting its encoding
+template<typename Assets>
+constexpr bool varies(const EmbeddedAsset& asset) {
+    return !asset.encoding.empty() || std::ranges::count(Assets::assets, asset.path, &EmbeddedAsset::path) > 1;
+}
+
+/// Variant served for each embedded file, in assets order
+template<typename Assets>
+constexpr auto servedAssets() {
+    constexpr auto count = std::ranges::count_if(Assets::assets, [](auto& asset) { return servedAsset<Assets>(asset.path) == &asset; });
+    std::array<const EmbeddedAsset*, static_cast<size_t>(count)> served;
+    auto next = served.begin();
+    for (auto& asset : Assets::assets)
+        if (servedAsset<Assets>(asset.path) == &asset) *next++ = &asset;
+    return served;
+}
+} // namespace details
+
+/// Provider serving the files of Assets, which lists its variants in a constexpr table sorted by path and encoding. The variant served
+/// is negotiated with open(file, encodings), Assets::encoding being the default one :
+/// @code
+/// struct Assets {
+///     static constexpr std::string_view encoding{"gzip"};                   // Variant served when available
+///     static constexpr std::array<EmbeddedAsset, N> assets{...};              // Sorted by path, then encoding
+///     static std::span<const std::byte> blob();                               // Variants data, linked in the executable
+/// };
+/// @endcode
+template<typename Assets>
+class EmbeddedFS {
+public:
+    EmbeddedFS(std::filesystem::path /*docRoot*/) {}
+    EmbeddedFS() = delete;
+
+    /// @return the file encoded with Assets::encoding if this variant has been embedded, the identity one otherwise
+    std::optional<File> open(std::filesystem::path file) const { return open(std::move(file), {}); }
+
+    /// @return the variant of file whose encoding comes first in encodings, the one open(file) returns if none has been embedded
+    std::optional<File> open(std::filesystem::path file, std::span<const std::string_view> encodings) const {
+        auto path = file.relative_path().generic_string();
+        auto found = std::ranges::lower_bound(files, path);
+        if (found == files.end() || *found != path) return {};
+        return fileAt(static_cast<size_t>(found - files.begin()), encodings);
+    }
+
+    /// Paths of the embedded files (sorted), for the compile-time dispatch of Multi
+    static constexpr auto files = [] {
+        constexpr auto served = details::servedAssets<Assets>();
+        std::array<std::string_view, served.size()> paths;
+        std::ranges::transform(served, paths.begin(), &EmbeddedAsset::path);
+        return paths;
+    }();
+
+    /// Header lines of every variant, in assets order
+    static constexpr auto headers = [] {
+        std::array<StaticHeaders, Assets::assets.size()> lines{};
+        std::ranges::transform(Assets::assets, lines.begin(), [](auto& asset) {
+            return StaticHeaders{asset.path, asset.size, asset.encoding, asset.etag, details::varies<Assets>(asset)};
+        });
+        return lines;
+    }();
+
+    static File fileAt(size_t index) { return variant(*served[index]); }
+    static File fileAt(size_t index, std::span<const std::string_view> encodings) { return variant(negotiated(index, encodings)); }
+
+    static constexpr std::string_view headersAt(size_t index) { return headers[assetIndex(*served[index])].view(); }
+    /// @return the header lines of the variant fileAt(index, encodings) opens
+    static constexpr std::string_view headersAt(size_t index, std::span<const std::string_view> encodings) {
+        return headers[assetIndex(negotiated(index, encodings))].view();
+    }
+
+    /// Compile-time lookup in the assets table.
+    /// @return the variant of path encoded with encoding ("" for identity), nullptr if it has not been embedded
+    [[nodiscard]] static constexpr const EmbeddedAsset* find(std::string_view path, std::string_view encoding) {
+        return details::findAsset<Assets>(path, encoding);
+    }
+
+private:
+    static constexpr auto served = details::servedAssets<Assets>();
+
+    static constexpr size_t assetIndex(const EmbeddedAsset& asset) { return static_cast<size_t>(&asset - Assets::assets.data()); }
+
+    // Variant of files[index] whose encoding comes first in encodings, the served one if none has been embedded
+    static constexpr const EmbeddedAsset& negotiated(size_t index, std::span<const std::string_view> encodings) {
+        for (auto encoding : encodings)
+            if (auto asset = find(files[index], encoding)) return *asset;
+        return *served[index];
+    }
+
+    static File variant(const EmbeddedAsset& asset) {
+        return File{Assets::blob().subspan(asset.offset, asset.size), asset.encoding, headers[assetIndex(asset)].view(), asset.etag};
+    }
+
+    static_assert(std::ranges::is_sorted(Assets::assets, {}, &EmbeddedAsset::key), "Embedded assets must be sorted by path and encoding");
+};
+
+} // namespace webfront::fs
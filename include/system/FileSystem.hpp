@@ -4,17 +4,35 @@
 #pragma once
 
 #include "../details/C++23Support.hpp"
+#include "http/MimeType.hpp"
 #include "tooling/Logger.hpp"
+#include "utils/PerfectHash.hpp"
 
+#include <algorithm>
 #include <array>
-#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <functional>
 #include <ios>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <span>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
 
 namespace webfront::fs {
 
@@ -25,6 +43,7 @@ template<typename T>
 concept IsData = requires(T t) {
     T::data;
     T::dataSize;
+    requires sizeof(T::data[0]) == 1;
 };
 
 template<typename T>
@@ -33,73 +52,193 @@ concept EncodedData = IsData<T> && HasEncoding<T>;
 template<typename T>
 concept RawData = IsData<T>;
 
+/// Header lines ("Name: value\r\n") of a file known at compile time : Content-Length (always the first line), Content-Type,
+/// Content-Encoding, Vary, ETag and Accept-Ranges. Vary is sent by the files whose content coding is negotiated.
+class StaticHeaders {
+public:
+    constexpr StaticHeaders() = default;
+    constexpr StaticHeaders(std::string_view path, size_t size, std::string_view encoding = "", std::string_view etag = "", bool varies = false) {
+        auto extension = path.substr(std::min(path.rfind('.'), path.size()));
+        append("Content-Length: ").append(size).append("\r\nContent-Type: ").append(http::MimeType(extension).toString()).append("\r\n");
+        if (!encoding.empty()) append("Content-Encoding: ").append(encoding).append("\r\n");
+        if (varies) append("Vary: Accept-Encoding\r\n");
+        if (!etag.empty()) append("ETag: ").append(etag).append("\r\n");
+        append("Accept-Ranges: bytes\r\n");
+    }
+
+    /// Headers of the embedded Data (dataSize, encoding and etag members) served as path. Encoded data varies : it is decoded for the
+    /// clients not accepting its encoding.
+    template<IsData Data>
+    [[nodiscard]] static constexpr StaticHeaders of(std::string_view path) {
+        std::string_view encoding, etag;
+        if constexpr (HasEncoding<Data>) encoding = Data::encoding;
+        if constexpr (requires { Data::etag; }) etag = Data::etag;
+        return {path, Data::dataSize, encoding, etag, !encoding.empty()};
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const { return {chars.data(), length}; }
+
+private:
+    std::array<char, 192> chars{};
+    size_t length{0};
+
+    constexpr StaticHeaders& append(std::string_view text) {
+        if (length + text.size() > chars.size()) throw std::length_error("StaticHeaders : header lines too long");
+        std::copy(text.begin(), text.end(), chars.begin() + static_cast<std::ptrdiff_t>(length));
+        length += text.size();
+        return *this;
+    }
+
+    constexpr StaticHeaders& append(size_t number) {
+        std::array<char, 20> digits{};
+        auto first = digits.end();
+        do *--first = static_cast<char>('0' + number % 10);
+        while ((number /= 10) != 0);
+        return append(std::string_view(first, digits.end()));
+    }
+};
+
+/// Open descriptor of a native file : the server sends it from the page cache (sendfile) instead of reading it.
+/// Closed by the deleter of its provider, once the last File or Response sharing it is destroyed.
+struct FileDescriptor {
+    int handle;
+    size_t size;
+};
+
 class File {
-    enum class FileType { nativeFStream, staticData };
 public:
-    File(EncodedData auto t) : File(decltype(t)::data, decltype(t)::dataSize, decltype(t)::encoding) {}
-    File(RawData auto t) : File(decltype(t)::data, decltype(t)::dataSize) {}
-    File(std::span<const uint64_t> input, size_t fileSize, std::string_view contentEncoding = "")
-        : fileType{FileType::staticData}, data(input), size(fileSize), eofBit(fileSize==0), encoding(contentEncoding) {}
-    File(std::ifstream ifstream) : fileType{FileType::nativeFStream}, fstream{std::move(ifstream)} {}
+    File(EncodedData auto t, std::string_view headerLines = "") : File(bytesOf(t), decltype(t)::encoding, headerLines, eTagOf(t)) {}
+    File(RawData auto t, std::string_view headerLines = "") : File(bytesOf(t), "", headerLines, eTagOf(t)) {}
+    File(std::span<const std::byte> bytes, std::string_view contentEncoding = "", std::string_view headerLines = "", std::string_view entityTag = "")
+        : content(bytes), eofBit(bytes.empty()), encoding(contentEncoding), staticHeaders(headerLines), staticETag(entityTag) {}
+    File(std::span<const std::byte> bytes, std::shared_ptr<const void> bytesOwner, std::string_view entityTag = "")
+        : content(bytes), eofBit(bytes.empty()), staticETag(entityTag), owner(std::move(bytesOwner)) {}
+    File(std::shared_ptr<const FileDescriptor> fileDescriptor) : eofBit(fileDescriptor->size == 0), descriptor(std::move(fileDescriptor)) {}
+    File(std::ifstream ifstream, std::optional<size_t> fileSize = {}) : streamSize(fileSize), fstream{std::make_unique<std::ifstream>(std::move(ifstream))} {}
 
     [[nodiscard]] bool isEncoded() const { return !encoding.empty(); }
     [[nodiscard]] std::string_view getEncoding() const { return encoding; }
     [[nodiscard]] bool eof() const { return eofBit; }
 
+    /// @return the size of the file content, nullopt for a stream whose size is unknown until its end is read
+    [[nodiscard]] std::optional<size_t> size() const {
+        if (fstream) return streamSize;
+        return descriptor ? descriptor->size : content.size();
+    }
+
+    /// Moves the position of the next read() to offset, for random access.
+    /// @return false if the position cannot be moved (stream already read up to its end)
+    bool seek(size_t offset) {
+        if (fstream) {
+            fstream->clear();
+            if (!fstream->is_open() || !fstream->seekg(static_cast<std::streamoff>(offset))) return false;
+        } else {
+            readIndex = std::min(offset, descriptor ? descriptor->size : content.size());
+        }
+        eofBit = false;
+        return true;
+    }
+
+    /// @return the whole content of a file held in memory (embedded data or mapped file) : it can be sent without copy, as long as
+    /// contiguousOwner() is kept. Empty for a file streamed from disk, to be read().
+    [[nodiscard]] std::span<const std::byte> contiguous() const { return content; }
+
+    /// @return the owner of a contiguous() content which does not outlive its provider (mapped file), nullptr for embedded data
+    [[nodiscard]] std::shared_ptr<const void> contiguousOwner() const { return owner; }
+
+    /// @return the native descriptor of a file to be sent by the kernel (sendfile), nullptr if the file is not sent this way
+    [[nodiscard]] std::shared_ptr<const FileDescriptor> nativeDescriptor() const { return descriptor; }
+
+    /// @return the header lines of a file known at compile time (see StaticHeaders), empty if they must be computed
+    [[nodiscard]] std::string_view headers() const { return staticHeaders; }
+
+    /// @return the quoted strong entity tag of the content : a hash computed at build time for embedded data, derived from the
+    /// modification time and the size for a native file. Empty if unknown.
+    [[nodiscard]] std::string_view eTag() const { return nativeETag.empty() ? staticETag : std::string_view{nativeETag}; }
+
+    /// @return the modification time of a native file, nullopt for embedded data
+    [[nodiscard]] std::optional<std::chrono::sys_seconds> lastModified() const { return modified; }
+
+    /// Sets the validators of a native file from its modification time : Last-Modified, and the ETag "<time>-<size>" (hexadecimal)
+    void setModified(std::chrono::system_clock::time_point modificationTime) {
+        modified = std::chrono::floor<std::chrono::seconds>(modificationTime);
+        std::array<char, 36> tag;
+        tag.front() = '"';
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(modificationTime.time_since_epoch()).count();
+        auto end = std::to_chars(tag.data() + 1, tag.data() + tag.size(), static_cast<unsigned long long>(nanoseconds), 16).ptr;
+        *end++ = '-';
+        end = std::to_chars(end, tag.data() + tag.size() - 1, size().value_or(0), 16).ptr;
+        *end++ = '"';
+        nativeETag.assign(tag.data(), end);
+    }
+
+    /// Sets the content coding of a native file holding an encoded representation (precompressed sibling, compressed variant)
+    void setEncoding(std::string_view contentEncoding) { encoding = contentEncoding; }
+
+    /// Sets the modification time of a representation derived from a native file, without changing its entity tag
+    void setLastModified(std::optional<std::chrono::sys_seconds> modificationTime) { modified = modificationTime; }
+
     // Extracts characters from file into given buffer until buffer size or end of file is reached.
     // @param buffer buffer which will receive extracted data
     // @return bytes read
     size_t read(std::span<char> buffer) {
-        if (fileType == FileType::staticData) return readData(buffer);
-        else return readFStream(buffer);
+        if (fstream) return readFStream(buffer);
+        return descriptor ? readDescriptor(buffer) : readContent(buffer);
     }
 
 private:
-    FileType fileType;
-    std::span<const uint64_t> data;
-    size_t readIndex{}, size{};
+    std::span<const std::byte> content;
+    size_t readIndex{};
     bool eofBit{false};
-    const std::string encoding{};
-    std::ifstream fstream;
+    std::string encoding{};
+    std::string_view staticHeaders;
+    std::string_view staticETag;
+    std::string nativeETag;
+    std::optional<std::chrono::sys_seconds> modified;
+    std::shared_ptr<const void> owner;
+    std::shared_ptr<const FileDescriptor> descriptor;
+    std::optional<size_t> streamSize;
+    std::unique_ptr<std::ifstream> fstream;
 
-    union UIntByte {
-        uint64_t uInt;
-        uint8_t byte[sizeof(uInt)];
-    };
-
-    size_t readData(std::span<char> buffer) {
-        constexpr auto bytesPerInt = sizeof(decltype(data)::value_type);
-        UIntByte chunk{};
-        for (size_t index = 0; (index < buffer.size()); ++index) {
-            if (eof()) return index;
+    template<IsData T>
+    static std::span<const std::byte> bytesOf(T) { return std::as_bytes(std::span{T::data}).first(T::dataSize); }
 
-            if (readIndex % bytesPerInt == 0) chunk = convert(data[readIndex / bytesPerInt]);
+    template<IsData T>
+    static constexpr std::string_view eTagOf(T) {
+        if constexpr (requires { T::etag; }) return T::etag;
+        else return {};
+    }
 
-            buffer[index] = static_cast<char>(chunk.byte[readIndex % bytesPerInt]);
-            readIndex++;
-            if (readIndex == size) eofBit = true;
-        }
-        return buffer.size();
+    size_t readContent(std::span<char> buffer) {
+        auto count = std::min(buffer.size(), content.size() - readIndex);
+        if (count > 0) std::memcpy(buffer.data(), content.data() + readIndex, count);
+        readIndex += count;
+        if (readIndex == content.size()) eofBit = true;
+        return count;
     }
 
-    static UIntByte convert(uint64_t input) {
-        UIntByte result;
-        uint64_t bigEndian;
-        if constexpr (std::endian::native == std::endian::little)
-            bigEndian = std::byteswap(input);
-        else
-            bigEndian = input;
-        std::memcpy(result.byte, &bigEndian, sizeof(bigEndian));
-        return result;
+    size_t readDescriptor(std::span<char> buffer) {
+        ssize_t count = 0;
+#if defined(__linux__)
+        auto size = std::min(buffer.size(), descriptor->size - readIndex);
+        if (size > 0) count = ::pread(descriptor->handle, buffer.data(), size, static_cast<off_t>(readIndex));
+#endif
+        if (count <= 0) {
+            eofBit = true;
+            return 0;
+        }
+        readIndex += static_cast<size_t>(count);
+        if (readIndex == descriptor->size) eofBit = true;
+        return static_cast<size_t>(count);
     }
 
     size_t readFStream(std::span<char> buffer) {
-        fstream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
-        if (fstream.eof()) {
+        fstream->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (fstream->eof()) {
             eofBit = true;
-            fstream.close();
+            fstream->close();
         }
-        return static_cast<size_t>(fstream.gcount());
+        return static_cast<size_t>(fstream->gcount());
     }
 };
 
@@ -109,24 +248,245 @@ concept Provider = requires(T t, std::filesystem::path filename) {
     requires std::constructible_from<T, std::filesystem::path>;
 };
 
+/// Provider holding several content codings of its files : open(filename, encodings) opens the variant of filename whose coding comes
+/// first in encodings (the acceptable codings, preferred first, "" for identity), the variant open(filename) returns if none does.
+template<typename T>
+concept Negotiable = Provider<T> && requires(T t, std::filesystem::path filename, std::span<const std::string_view> encodings) {
+    { t.open(filename, encodings) } -> std::same_as<std::optional<File>>;
+};
+
+/// Provider whose files may change while the server runs : paths (relative to its root) of the changed files or directories are
+/// reported to onChange, from any thread. An empty path means that anything may have changed.
+/// watch() returns false when changes cannot be reported. Providers without watch() are immutable.
+template<typename T>
+concept Watchable = requires(T t, std::function<void(const std::filesystem::path&)> onChange) {
+    { t.watch(onChange) } -> std::same_as<bool>;
+};
+
+/// Provider whose files are known at compile time : files is a constexpr list of their paths (relative, generic format), fileAt(index)
+/// opens files[index] and headersAt(index) returns its StaticHeaders lines. Multi finds them with a single hash probe.
+/// A Negotiable one may negotiate the variant with fileAt(index, encodings), headersAt(index, encodings) returning the lines of that variant.
+template<typename T>
+concept Indexed = Provider<T> && requires(size_t index) {
+    { T::files.size() } -> std::convertible_to<size_t>;
+    { T::files[index] } -> std::convertible_to<std::string_view>;
+    { T::fileAt(index) } -> std::same_as<File>;
+    { T::headersAt(index) } -> std::same_as<std::string_view>;
+};
+
+namespace details {
+struct IndexedEntry {
+    std::string_view path;
+    size_t provider, file;
+};
+
+template<typename FS>
+constexpr size_t indexedFilesCount() {
+    if constexpr (Indexed<FS>) return FS::files.size();
+    else return 0;
+}
+
+/// Files of all the Indexed providers, a file also served by a previous provider being skipped
+template<typename ... FSs>
+constexpr auto indexedEntries() {
+    constexpr auto all = [] {
+        std::array<IndexedEntry, (indexedFilesCount<FSs>() + ... + 0)> entries{};
+        size_t count = 0, provider = 0;
+        auto append = [&]<typename FS>() {
+            if constexpr (Indexed<FS>)
+                for (size_t file = 0; file < FS::files.size(); ++file) {
+                    auto path = std::string_view{FS::files[file]};
+                    if (std::none_of(entries.begin(), entries.begin() + count, [&](auto& entry) { return entry.path == path; }))
+                        entries[count++] = IndexedEntry{path, provider, file};
+                }
+            ++provider;
+        };
+        (append.template operator()<FSs>(), ...);
+        return std::pair{entries, count};
+    }();
+    std::array<IndexedEntry, all.second> unique{};
+    std::copy_n(all.first.begin(), unique.size(), unique.begin());
+    return unique;
+}
+
+template<size_t N>
+constexpr auto pathsHash(const std::array<IndexedEntry, N>& entries) {
+    std::array<std::string_view, N> paths{};
+    std::ranges::transform(entries, paths.begin(), &IndexedEntry::path);
+    return utils::PerfectHash<N>{paths};
+}
+
+using FileOpener = File (*)(size_t, std::span<const std::string_view>);
+
+template<typename FS>
+constexpr FileOpener fileOpener() {
+    if constexpr (!Indexed<FS>) return nullptr;
+    else if constexpr (requires(size_t index, std::span<const std::string_view> encodings) { FS::fileAt(index, encodings); })
+        return [](size_t index, std::span<const std::string_view> encodings) { return FS::fileAt(index, encodings); };
+    else return [](size_t index, std::span<const std::string_view>) { return FS::fileAt(index); };
+}
+
+using HeadersGetter = std::string_view (*)(size_t, std::span<const std::string_view>);
+
+template<typename FS>
+constexpr HeadersGetter headersGetter() {
+    if constexpr (!Indexed<FS>) return nullptr;
+    else if constexpr (requires(size_t index, std::span<const std::string_view> encodings) { FS::headersAt(index, encodings); })
+        return [](size_t index, std::span<const std::string_view> encodings) { return FS::headersAt(index, encodings); };
+    else return [](size_t index, std::span<const std::string_view>) { return FS::headersAt(index); };
+}
+} // namespace details
+
+/// Files of the first provider (in parameters order) serving them. The files of the Indexed providers are looked up in a single
+/// perfect hash table built at compile time. When the other providers are all Watchable, the paths they miss are remembered until
+/// a file changes, so a request for an embedded file does not reach them again : a miss holds for the encodings it was looked up with
+/// only, since a Negotiable provider may serve a precompressed sibling of a file it does not have.
 template<Provider ... FSs>
 class Multi : FSs... {
 public:
-    Multi(std::filesystem::path docRoot) : FSs(docRoot)... {}
-    std::optional<File> open(std::filesystem::path filename) {
-        return openFile<FSs...>(filename);
+    Multi(std::filesystem::path docRoot) : FSs(docRoot)... {
+        if constexpr (cachesMisses) {
+            if ((watchProvider<FSs>([misses = misses](const std::filesystem::path& changed) { misses->changed(changed); }) && ...))
+                misses->enable();
+        }
+    }
+
+    std::optional<File> open(std::filesystem::path filename) { return open(std::move(filename), {}); }
+
+    /// Negotiates the variant with the provider serving filename, if it is Negotiable
+    std::optional<File> open(std::filesystem::path filename, std::span<const std::string_view> encodings) {
+        auto path = filename.relative_path().generic_string();
+        auto indexed = entriesHash.find(path);
+        if constexpr (hasMutableProviders) {
+            auto servedBy = indexed == entriesHash.npos ? sizeof...(FSs) : entries[indexed].provider;
+            if constexpr (cachesMisses) {
+                if (auto key = missKey(path, encodings); !misses->contains(key)) {
+                    auto generation = misses->generation();
+                    if (auto file = openMutable(filename, encodings, servedBy)) return file;
+                    misses->insert(std::move(key), generation);
+                }
+            } else if (auto file = openMutable(filename, encodings, servedBy)) return file;
+        }
+        if (indexed == entriesHash.npos) return {};
+        return fileOpeners[entries[indexed].provider](entries[indexed].file, encodings);
+    }
+
+    /// @return the header lines of filename if it is served by an Indexed provider, known without opening it. nullopt if the file must be
+    /// opened : unknown file, or file which may be served by a previous provider which is not Indexed (for these encodings).
+    std::optional<std::string_view> headersOf(const std::filesystem::path& filename, std::span<const std::string_view> encodings = {}) const {
+        auto path = filename.relative_path().generic_string();
+        auto indexed = entriesHash.find(path);
+        if (indexed == entriesHash.npos) return {};
+        if constexpr (hasMutableProviders) {
+            if (!cachesMisses || !misses->contains(missKey(path, encodings))) return {};
+        }
+        return headersGetters[entries[indexed].provider](entries[indexed].file, encodings);
+    }
+
+    /// Watches all the Watchable providers : true if they all report their changes.
+    bool watch(std::function<void(const std::filesystem::path&)> onChange) {
+        if constexpr (cachesMisses) return misses->listen(std::move(onChange)); // Providers already watched for the misses cache
+        else return (watchProvider<FSs>(onChange) && ...);
     }
 
 private:
-    template<typename First, typename ... Rest>
-    std::optional<File> openFile(std::filesystem::path filename) {
-        auto file = this->First::open(filename);
-        if constexpr (sizeof...(Rest) == 0) return file;
+    /// Paths missed by all the mutable providers, shared with their watchers which may outlive the Multi members.
+    class Misses {
+    public:
+        static constexpr size_t capacity = 4096; // Forgets everything above : unknown paths requested in a loop must not exhaust memory
+
+        void enable() {
+            std::scoped_lock lock(mutex);
+            enabled = true;
+        }
+        [[nodiscard]] bool contains(const std::string& path) const {
+            std::shared_lock lock(mutex);
+            return paths.contains(path);
+        }
+        /// Count of changes so far : to be read before trying the providers, then given to insert().
+        [[nodiscard]] uint64_t generation() const {
+            std::shared_lock lock(mutex);
+            return changes;
+        }
+        /// Remembers a path missed since loadGeneration, unless a file changed meanwhile.
+        void insert(std::string path, uint64_t loadGeneration) {
+            std::scoped_lock lock(mutex);
+            if (!enabled || loadGeneration != changes) return;
+            if (paths.size() >= capacity) paths.clear();
+            paths.insert(std::move(path));
+        }
+        void changed(const std::filesystem::path& path) {
+            std::scoped_lock lock(mutex);
+            ++changes;
+            paths.clear();
+            if (listener) listener(path);
+        }
+        bool listen(std::function<void(const std::filesystem::path&)> onChange) {
+            std::scoped_lock lock(mutex);
+            listener = std::move(onChange);
+            return enabled;
+        }
+
+    private:
+        mutable std::shared_mutex mutex;
+        bool enabled{false};
+        uint64_t changes{0};
+        std::unordered_set<std::string> paths;
+        std::function<void(const std::filesystem::path&)> listener;
+    };
+
+    static constexpr bool hasMutableProviders = (!Indexed<FSs> || ...);
+    static constexpr bool cachesMisses = hasMutableProviders && ((Indexed<FSs> || Watchable<FSs>) && ...);
+    std::shared_ptr<Misses> misses = cachesMisses ? std::make_shared<Misses>() : nullptr;
+
+    static constexpr auto entries = details::indexedEntries<FSs...>();
+    static constexpr auto entriesHash = details::pathsHash(entries);
+    static constexpr std::array<details::FileOpener, sizeof...(FSs)> fileOpeners{details::fileOpener<FSs>()...};
+    static constexpr std::array<details::HeadersGetter, sizeof...(FSs)> headersGetters{details::headersGetter<FSs>()...};
+
+    // Key of the misses of path looked up with encodings
+    static std::string missKey(std::string path, std::span<const std::string_view> encodings) {
+        for (auto encoding : encodings) path.append("\n").append(encoding);
+        return path;
+    }
+
+    template<typename FS>
+    bool watchProvider(const std::function<void(const std::filesystem::path&)>& onChange) {
+        if constexpr (Watchable<FS>) return this->FS::watch(onChange);
+        else return true;
+    }
+
+    // Tries the providers which are not Indexed, in parameters order, up to the limit one
+    template<size_t Index = 0>
+    std::optional<File> openMutable(const std::filesystem::path& filename, std::span<const std::string_view> encodings, size_t limit) {
+        if constexpr (Index == sizeof...(FSs)) return {};
         else {
-            if (file.has_value()) return file;
-            return openFile<Rest...>(filename);
+            using FS = std::tuple_element_t<Index, std::tuple<FSs...>>;
+            if (Index >= limit) return {};
+            if constexpr (Negotiable<FS> && !Indexed<FS>) {
+                if (auto file = this->FS::open(filename, encodings)) return file;
+            } else if constexpr (!Indexed<FS>) {
+                if (auto file = this->FS::open(filename)) return file;
+            }
+            return openMutable<Index + 1>(filename, encodings, limit);
         }
     }
 };
 
+/// @return the header lines of filename if provider knows them without opening it (Indexed provider or Multi), nullopt otherwise.
+/// encodings are those a Negotiable provider would be opened with.
+template<Provider FS>
+std::optional<std::string_view> headersOf(const FS& provider, const std::filesystem::path& filename, std::span<const std::string_view> encodings = {}) {
+    if constexpr (Indexed<FS>) {
+        auto found = std::ranges::find(FS::files, filename.relative_path().generic_string());
+        if (found == FS::files.end()) return {};
+        return details::headersGetter<FS>()(static_cast<size_t>(found - FS::files.begin()), encodings);
+    } else if constexpr (requires { provider.headersOf(filename, encodings); })
+        return provider.headersOf(filename, encodings);
+    else if constexpr (requires { provider.headersOf(filename); })
+        return provider.headersOf(filename);
+    else
+        return {};
+}
+
 } // namespace webfront::fs
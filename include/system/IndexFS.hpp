@@ -21,131 +21,213 @@ class IndexFS {
     struct IndexHtml {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{69};
-        static constexpr std::array<uint64_t, 9> data{0xa1700400e0383dd6, 0xfcacc835c88b58d9, 0x52b82a1f239ddcf9,
-                                                      0xa0d65a2581e511b4, 0x2cd0c06df85c8a2c, 0xa29e6831070def20,
-                                                      0x0ff44a658bab1f4d, 0x14065fb5a7c383b8, 0x7904c81000000000};
+        static constexpr std::string_view etag{"\"235cc1eda7d7fa91\""};
+        static constexpr std::array<uint8_t, 69> data{
+          0xa1, 0x70, 0x04, 0x00, 0xe0, 0x38, 0x3d, 0xd6, 0xfc, 0xac, 0xc8, 0x35, 0xc8, 0x8b, 0x58, 0xd9, 0x52, 0xb8, 0x2a, 0x1f, 0x23, 0x9d, 0xdc, 0xf9,
+          0xa0, 0xd6, 0x5a, 0x25, 0x81, 0xe5, 0x11, 0xb4, 0x2c, 0xd0, 0xc0, 0x6d, 0xf8, 0x5c, 0x8a, 0x2c, 0xa2, 0x9e, 0x68, 0x31, 0x07, 0x0d, 0xef, 0x20,
+          0x0f, 0xf4, 0x4a, 0x65, 0x8b, 0xab, 0x1f, 0x4d, 0x14, 0x06, 0x5f, 0xb5, 0xa7, 0xc3, 0x83, 0xb8, 0x79, 0x04, 0xc8, 0x10, 0x00};
     };
 
     struct WebFrontIco {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{528};
-        static constexpr std::array<uint64_t, 67> data{
-          0xa1e81700f7658093, 0x2b7d8145c6c61015, 0xc4c80e31aa99183d, 0x54378e5eed6ed133, 0xfaca20ffde26c4fe,
-          0x907c01bcd106aa84, 0x16c239717525dc81, 0x22b0dd830e70c053, 0x2d28ed2ecb3c4fbc, 0x0430c0d5c91daf4f,
-          0x2cd10c1eb53020ac, 0xffcdde67d7cf55af, 0xdca9e2830d38c108, 0x02e090573dedc964, 0x4a677eea547dcc18,
-          0x9b828b2818b06030, 0xb1d56e2bc8a235a8, 0x57f5b1c17b35af71, 0x09dcb5b387b49237, 0x2bdf037ce083b6b6,
-          0x2cf8208817fca008, 0xc0188036006fe0f1, 0xe8c664f10f9ded6d, 0xf1602cf0eafe452b, 0xccc1e6541d9eed16,
-          0x622383f1703e31d1, 0x6c85e32b9771da2a, 0xf1fbbb4b1b9de5ce, 0x7871d6e52607625f, 0x0f11b7ddbf8ce898,
-          0x36fafcd39cf2feab, 0xdf7b812c200bd7c9, 0xa04403e83225c651, 0x5970c2e4d00fc03f, 0x8a6a815662143084,
-          0x42e7539252581640, 0xd64742491a255ac8, 0x024e89050883ccf0, 0x948edad49eb3b200, 0x2932fd7a3fa2a643,
-          0x0caee9e2e8369bc5, 0xf0a48e2c487a14ce, 0xbf9ea9b66b209da8, 0x688fa7b3abb9a366, 0xf9b40909d3d7fc74,
-          0x3a527b181930c5eb, 0xea13b3cf8b3ba3b3, 0x6a80e6e995babfbf, 0x433e003e386581fe, 0x634428651a6664dc,
-          0x8cd11a312546eb0d, 0x0b0a7259de712cf8, 0x204c13d9fc84a554, 0x5616147cfb2fc7d5, 0xd5711cb7f5dfc302,
-          0xe7762297f2d9d1f1, 0x1bb50b483ff7cab2, 0xcbaddcfaecb29b0f, 0xf00f75b5bcbebdca, 0xfedcaabc563fb7eb,
-          0xe7e86527d9eb7fec, 0x5f1ef92563fb2708, 0x74c08718f1cb0272, 0xcb0d2100faca96e8, 0x30c1a7e51d0d0c67,
-          0x7640a3c384ef0122};
+        static constexpr std::string_view etag{"\"5bd1077b467155a5\""};
+        static constexpr std::array<uint8_t, 528> data{
+          0xa1, 0xe8, 0x17, 0x00, 0xf7, 0x65, 0x80, 0x93, 0x2b, 0x7d, 0x81, 0x45, 0xc6, 0xc6, 0x10, 0x15, 0xc4, 0xc8, 0x0e, 0x31, 0xaa, 0x99, 0x18, 0x3d,
+          0x54, 0x37, 0x8e, 0x5e, 0xed, 0x6e, 0xd1, 0x33, 0xfa, 0xca, 0x20, 0xff, 0xde, 0x26, 0xc4, 0xfe, 0x90, 0x7c, 0x01, 0xbc, 0xd1, 0x06, 0xaa, 0x84,
+          0x16, 0xc2, 0x39, 0x71, 0x75, 0x25, 0xdc, 0x81, 0x22, 0xb0, 0xdd, 0x83, 0x0e, 0x70, 0xc0, 0x53, 0x2d, 0x28, 0xed, 0x2e, 0xcb, 0x3c, 0x4f, 0xbc,
+          0x04, 0x30, 0xc0, 0xd5, 0xc9, 0x1d, 0xaf, 0x4f, 0x2c, 0xd1, 0x0c, 0x1e, 0xb5, 0x30, 0x20, 0xac, 0xff, 0xcd, 0xde, 0x67, 0xd7, 0xcf, 0x55, 0xaf,
+          0xdc, 0xa9, 0xe2, 0x83, 0x0d, 0x38, 0xc1, 0x08, 0x02, 0xe0, 0x90, 0x57, 0x3d, 0xed, 0xc9, 0x64, 0x4a, 0x67, 0x7e, 0xea, 0x54, 0x7d, 0xcc, 0x18,
+          0x9b, 0x82, 0x8b, 0x28, 0x18, 0xb0, 0x60, 0x30, 0xb1, 0xd5, 0x6e, 0x2b, 0xc8, 0xa2, 0x35, 0xa8, 0x57, 0xf5, 0xb1, 0xc1, 0x7b, 0x35, 0xaf, 0x71,
+          0x09, 0xdc, 0xb5, 0xb3, 0x87, 0xb4, 0x92, 0x37, 0x2b, 0xdf, 0x03, 0x7c, 0xe0, 0x83, 0xb6, 0xb6, 0x2c, 0xf8, 0x20, 0x88, 0x17, 0xfc, 0xa0, 0x08,
+          0xc0, 0x18, 0x80, 0x36, 0x00, 0x6f, 0xe0, 0xf1, 0xe8, 0xc6, 0x64, 0xf1, 0x0f, 0x9d, 0xed, 0x6d, 0xf1, 0x60, 0x2c, 0xf0, 0xea, 0xfe, 0x45, 0x2b,
+          0xcc, 0xc1, 0xe6, 0x54, 0x1d, 0x9e, 0xed, 0x16, 0x62, 0x23, 0x83, 0xf1, 0x70, 0x3e, 0x31, 0xd1, 0x6c, 0x85, 0xe3, 0x2b, 0x97, 0x71, 0xda, 0x2a,
+          0xf1, 0xfb, 0xbb, 0x4b, 0x1b, 0x9d, 0xe5, 0xce, 0x78, 0x71, 0xd6, 0xe5, 0x26, 0x07, 0x62, 0x5f, 0x0f, 0x11, 0xb7, 0xdd, 0xbf, 0x8c, 0xe8, 0x98,
+          0x36, 0xfa, 0xfc, 0xd3, 0x9c, 0xf2, 0xfe, 0xab, 0xdf, 0x7b, 0x81, 0x2c, 0x20, 0x0b, 0xd7, 0xc9, 0xa0, 0x44, 0x03, 0xe8, 0x32, 0x25, 0xc6, 0x51,
+          0x59, 0x70, 0xc2, 0xe4, 0xd0, 0x0f, 0xc0, 0x3f, 0x8a, 0x6a, 0x81, 0x56, 0x62, 0x14, 0x30, 0x84, 0x42, 0xe7, 0x53, 0x92, 0x52, 0x58, 0x16, 0x40,
+          0xd6, 0x47, 0x42, 0x49, 0x1a, 0x25, 0x5a, 0xc8, 0x02, 0x4e, 0x89, 0x05, 0x08, 0x83, 0xcc, 0xf0, 0x94, 0x8e, 0xda, 0xd4, 0x9e, 0xb3, 0xb2, 0x00,
+          0x29, 0x32, 0xfd, 0x7a, 0x3f, 0xa2, 0xa6, 0x43, 0x0c, 0xae, 0xe9, 0xe2, 0xe8, 0x36, 0x9b, 0xc5, 0xf0, 0xa4, 0x8e, 0x2c, 0x48, 0x7a, 0x14, 0xce,
+          0xbf, 0x9e, 0xa9, 0xb6, 0x6b, 0x20, 0x9d, 0xa8, 0x68, 0x8f, 0xa7, 0xb3, 0xab, 0xb9, 0xa3, 0x66, 0xf9, 0xb4, 0x09, 0x09, 0xd3, 0xd7, 0xfc, 0x74,
+          0x3a, 0x52, 0x7b, 0x18, 0x19, 0x30, 0xc5, 0xeb, 0xea, 0x13, 0xb3, 0xcf, 0x8b, 0x3b, 0xa3, 0xb3, 0x6a, 0x80, 0xe6, 0xe9, 0x95, 0xba, 0xbf, 0xbf,
+          0x43, 0x3e, 0x00, 0x3e, 0x38, 0x65, 0x81, 0xfe, 0x63, 0x44, 0x28, 0x65, 0x1a, 0x66, 0x64, 0xdc, 0x8c, 0xd1, 0x1a, 0x31, 0x25, 0x46, 0xeb, 0x0d,
+          0x0b, 0x0a, 0x72, 0x59, 0xde, 0x71, 0x2c, 0xf8, 0x20, 0x4c, 0x13, 0xd9, 0xfc, 0x84, 0xa5, 0x54, 0x56, 0x16, 0x14, 0x7c, 0xfb, 0x2f, 0xc7, 0xd5,
+          0xd5, 0x71, 0x1c, 0xb7, 0xf5, 0xdf, 0xc3, 0x02, 0xe7, 0x76, 0x22, 0x97, 0xf2, 0xd9, 0xd1, 0xf1, 0x1b, 0xb5, 0x0b, 0x48, 0x3f, 0xf7, 0xca, 0xb2,
+          0xcb, 0xad, 0xdc, 0xfa, 0xec, 0xb2, 0x9b, 0x0f, 0xf0, 0x0f, 0x75, 0xb5, 0xbc, 0xbe, 0xbd, 0xca, 0xfe, 0xdc, 0xaa, 0xbc, 0x56, 0x3f, 0xb7, 0xeb,
+          0xe7, 0xe8, 0x65, 0x27, 0xd9, 0xeb, 0x7f, 0xec, 0x5f, 0x1e, 0xf9, 0x25, 0x63, 0xfb, 0x27, 0x08, 0x74, 0xc0, 0x87, 0x18, 0xf1, 0xcb, 0x02, 0x72,
+          0xcb, 0x0d, 0x21, 0x00, 0xfa, 0xca, 0x96, 0xe8, 0x30, 0xc1, 0xa7, 0xe5, 0x1d, 0x0d, 0x0c, 0x67, 0x76, 0x40, 0xa3, 0xc3, 0x84, 0xef, 0x01, 0x22};
     };
 
     struct WebFrontJs {
         static constexpr std::string_view encoding{"gzip"};
         static constexpr size_t dataSize{3501};
-        static constexpr std::array<uint64_t, 438> data{
-          0x1f8b080872a34764, 0x020357656246726f, 0x6e742e6a7300d51b, 0xdb8edb36f6bd40ff, 0x81f5432dc58ac6f6,
-          0x4ca6d371bc6d934e, 0x802eb24dd1c9b60f, 0x8661c8366d2b9125, 0x43a2e7b2adff7dcf, 0xe145222551d24cd1,
-          0x057690c016c573e1, 0xe1b9933e3b3b23df, 0xaf0346c9f89bb3e1, 0xe86c3c1c8fc9787c, 0x7d31babe187ff9c5,
-          0x19be0e8e6c97a4e4, 0x87fd324dc28c92f7, 0x7415d17425df2ed3, 0x906ec8ef74f92e4d, 0x6246565148f12349,
-          0xe9975fdc0529592c, 0xe803a3f13a2353e2, 0xb05d9891afbf26f8, 0xe9e76f5cf2e79fc4, 0xd91ce3150b939838,
-          0x2ef9e3cb2f08fc21, 0xbc9873cb0216ae10, 0x47316ded91653e15, 0xffca533f2c3fd115, 0xf333ca7e491396b0,
-          0xc703fdb0015a0504, 0xfe397f008f079cb0, 0x585c93d99c9c4818, 0x672c885734d9901f, 0xd2347844962b74c9,
-          0xdacfe180d872424e, 0x6e0579156a03a274, 0x706107208343e186, 0x3892d38362d3df05, 0xd987fb18d83ed094,
-          0x3dfaab208a9ca547, 0x0eae4bd6b3c31ce9, 0xc107909c14f452ca, 0x8e696c4a41909593, 0xd46439b14192c813,
-          0xf201025892afa653, 0xd253937b280b3116, 0x1fa3c83597cb7669, 0x724f627a4f3e02f4, 0x4d9a26a9d37b1b05,
-          0x59469416dc05d191, 0x921e19905b9686f1, 0xd601ca037806c588, 0x134602501d907e7a, 0x5c311014fc432a3d,
-          0x7762d965637d86c0, 0x170bd423a1693aca, 0x295983d80a807521, 0x75942a99ca9591ef, 0x94feac520a06827c,
-          0x5e1367b130e7174f, 0x1e5f3792d5e57d72, 0x1d7c1496901d00d5, 0x5aa854d51ab4b7dc, 0x228afd6189473669,
-          0xb2070508569ff39d, 0xc25dc2019c1ca4db, 0xe31e2c2ff3231a6f, 0xd98eaf63ec16ea16, 0x02c5a14722342140,
-          0x25a77900388177af, 0x49041f8341450b00, 0x12b07fe584a8ad08, 0xe81a53d4b4af82d4, 0x0554809cf3af6972,
-          0x16852b2a14582c01, 0x9808f51dc3bf209d, 0x8573c9197cd3deca, 0x9d3a199acb12dcd2, 0x55c0247b2d34f986,
-          0x9ce42edcd3e5063d, 0x153c6a2e478d1aae, 0xe78ea619be9d821e, 0xed834f497a8dccef, 0xc318bf8d7033d86a,
-          0x07df72c3caf1ad92, 0xfde1c8e84dbc0e83, 0x38a659e6185243e4, 0xc79f62763e06dca8, 0x35ff0ef1812fc399,
-          0x0d1f46a321fc6d36, 0x735d4e0ae84a83b9, 0x122002975bf5057c, 0xfe6c38e7da307c78, 0xf70eb49a72a6fc28,
-          0x642ca2a0d2a539a3, 0x513167196e618209, 0x30d05e4e8ccde1de, 0x9abf93e39a7cc5b8, 0xe9adf9d04c7ef404,
-          0xfa1e6a01f242d4c0, 0xc40a010cf0e9233e, 0x1d9fec7363f01677, 0x027bcdde7004728a, 0x5a932b79e6b1497e,
-          0x054538e5d68dcb85, 0xb0f73e8c3fa333a2, 0xd545eb6f8da5eb2f, 0x66c643ef188771c8, 0xc2200aff43d79a34,
-          0xccf149275cbb001c, 0xee2ef80c5e561394, 0x3eda0d4f045f2533, 0x63b9357ca010953e, 0x9f0bcc18a888ed67,
-          0xcade078f14ddc5d9, 0x8b17e4fb158f102f, 0xce6a9300c3b014a4, 0x53f142dcc3728f3a, 0xe50eb5e461300424,
-          0x11f5a364ebf462ca, 0x224e3f0f0cb09ab2, 0x4fe25e39a5abbb37, 0xc7cd86f38a56c70d, 0x4e8c38af46632bd0,
-          0xbfb26dd54e4b286b, 0x8133d0b527534420, 0x3bc502653d70b2fa, 0x4c9984858dbbe5cf, 0x4eff3ebb3e3b8b12,
-          0x70a3bb2463d77d30, 0xfdfb305e27f73e0e, 0xe276f88724651ee9, 0xabec6f31f447fd06, 0x1a7e124342131b59,
-          0x1cbda39adbb56d59, 0x5f39681c8da98045, 0x5c745d21887f0b9d, 0xea328c83f4f1a388, 0xd8fd0005b3e4e2e8,
-          0x5b2193f8032077ca, 0xa84f8d6b5b454946, 0x3b2e0e83267febdf, 0x07d9db888273ac4e, 0xaa28ee8c939893b7,
-          0x8510f8c81a3e0045, 0xf4e8c1fc359df654, 0x7c142470cc831c0b, 0xf28b2c89a73dd77c, 0x2d86dd3a39d228a3,
-          0xed7cf56bf85a8735, 0x5bd32c3f8af9a229, 0x3f1cc134ce94021f, 0x9e9362957c9a3b69, 0xc1bf07671f6cbbee,
-          0x10cf004230096118, 0x3f062cf80d1ea5cc, 0xa0660aea04865010, 0x61f6e0640110e1fd, 0x2d65dc229d611d00,
-          0xd4500d929df9be5f, 0x32698dfedcdf0707, 0xe7814cff411e7c96, 0xc8847a74e9fa8700, 0x33e494396330cf61,
-          0xdf75fd4f49183b7d, 0xd2afdde6ec3e8454, 0x863892f35a7970d6, 0x0250f011386dd869, 0x3ed3c7f4f3c5d975,
-          0xfd74a5e8d21a4530, 0x802c438f0ebe168f, 0xac744b662da38a81, 0x46c4a44917789159, 0xdca8986e6ed2c805,
-          0x16cd9ca705a9a19b, 0x922750996db20a81, 0xb1356450194d2197, 0xc412a7e7d5f1f09d, 0xca7624dd1ec06042,
-          0xa31edd060e4ef657, 0x4b30eccf93869d1c, 0xeb3bc9a0b092df9b, 0x77b4658fd0029203, 0xba9c1ad94eda6191,
-          0x8ff7b4bc31a34b67, 0xec76da5d6d1d8ee0, 0xc3235613f2c885a7, 0x28ba7f9798cf7531, 0x6355f24eb99fbf2a,
-          0xe7439006fbec6d72, 0x8cd9f3842d10a06f, 0xbb85c4b284e37cec, 0x5cd4e96b1b62963e, 0xb6315f6c17cae39f,
-          0x999288a3adc8b3f9, 0x5d8f5c7925cedd36, 0x9e4e2d361c70ffa7, 0xe24d3bf3cae8a9e8, 0x71fc1e42c9cd9772,
-          0x7bcd9b1b02d3f399, 0x7a86be9dbac4da3a, 0xd769d41675502587, 0xb909202ba8d6e8f8, 0xa7f273ad18d7fd8a,
-          0x1e79956de27bdce0, 0xda8c1e5fca00fc11, 0xbefe481106e47d64, 0x9b975790c7acf980, 0x93e32871afe29aa0,
-          0x559f65a2850ed142, 0x3f029ffbf5073e15, 0x102f8fdbf7c9d66e, 0xa2badb47fab6cdb6, 0x6d57114b0dc2618c,
-          0x4da7db551a1e1812, 0xb729234a2713b3a6, 0x649dac78f747f6aa, 0x6e228a4f4e4f4cb0, 0xc60ff1da9742c60f,
-          0xcbc41cff32593ffa, 0xc10172e3f5db5d18, 0xad1d81c2eda08e9a, 0xbe4c1a1546ece92f, 0x68df94d1d46cfa1a,
-          0xfe41388364b3c928, 0xab6d4b89573ce7b8, 0x4bc23519622ea906, 0xc97052663277898a, 0xf06c3ea9ce40b2c0,
-          0x5ec64b3481ad34ab, 0x68f222b29fe2357d, 0x10f4b4e7d7baf79e, 0x90c1a07867cd4765, 0xd71119281c7dc14e,
-          0x536a87a01df23a2e, 0x762c9560ab13ac29, 0x3ea647caf5101255, 0x19d641b2f225a634, 0x503f53bbb32aa4e9,
-          0x1f8ed9cec1d94d6e, 0x5193ed604a4693bf, 0x9add54d6f30e9d57, 0xe382b87bebbe223e, 0xfd7fb4a4737349f1,
-          0x71bf04ace66206e4, 0x8a2c1f19cdc84f37, 0x3737dfbcba209b28, 0x81723dde9203d400, 0x8c08a8ee0b54daf6,
-          0x0ed15c5e38fa7ab0, 0x0d5acd0fba4be3db, 0xbf228d0b531ad91e, 0xe2afa8812a221971, 0x91900c225c03c257,
-          0x258439ae8624cd20, 0x339692b7d3d1adf9, 0x3e4931240aa39e5a, 0xa93f2967e638bf33, 0x3c04a4ceed5b0615,
-          0x87cdab2048b75cf2, 0x1134642dfd530eeb, 0x4896ce81c4b86b01, 0xd021e67376451f47, 0x34fce5086cc007e1,
-          0xe1078a2511296a5f, 0xc1b72ee97fad2b6b, 0x08fa35da3ead92fc, 0x9bea8dd195a949ec, 0x788884cbfba3ce28,
-          0x36fc948d7b9264a3, 0x87bffb5d089183f7, 0x48437684996c07ff, 0x11999d39dcc078c9, 0x69670d91aa4da778,
-          0x98e5fbfc2b0fd55c, 0x61cb8981a308a94c, 0xc0c0dfa86b151fa7, 0x68cd86f3eede6b0c, 0x640ac8d1dc02787a,
-          0x4a72a49ddecc0a2e, 0x8db5bd944987714e, 0xd69c539955567346, 0x55df5a0facbb3092, 0x605e8ef4677805d3,
-          0x170148d32bf22d78, 0x1ed5e55346c6554f, 0x432f745f925129f5, 0x0332e5b2a5be04a5, 0x0f74058aace4f0e6,
-          0x1139c57c367a7444, 0x82e899c7b4ce4c5f, 0x135f8ee881cf3da2, 0xef8e48022aedced2, 0x19445b91591c9fab,
-          0xa373d8360c02f96e, 0x616959e2889f9e37, 0x149ddd13effb3464, 0x6677d4d60fd40f1d, 0xf8d1a1ea795aeaaf,
-          0xa6be625180a91689, 0xea08527be83518e0, 0xe75ab263274ef126, 0x4d507525b0d6846c, 0x8415ad6424ece82c,
-          0xc80004da33763bca, 0x5fdab8da06759656, 0xdc1e308f19c5ed9a, 0x86f3b245763c5053, 0xadf20b368e4200da,
-          0x2da6d5dd9850939a, 0xcfd6040271b88e43, 0xfcaa42cb815bbfb8, 0x1e541cb8e527cba4, 0x9f1f2a97652785b4,
-          0x28e13f19c7961cb3, 0xeeeb0e875a471783, 0xbd5496a66e14f056, 0x5401f8068c1c56b9, 0x0ce5467b84435b1c,
-          0x6e33130297c18a6e, 0xc2b5d20ed26d6df9, 0x9917960bbccf319a, 0xe0e7ebcae50f1c2e, 0xdde5286e5a6cb319,
-          0x00bd14a7c139248c, 0xcd9bbd1752dd815f, 0xa4a96c155ed5ba72, 0x9ee2c819c3d20cfd, 0xed60aaeee6f0e3f8,
-          0xdcd7e34b533e3611, 0x84a2a4960228d63e, 0x18843567699d6973, 0x0985952cc0e8f2ab, 0x4c0ef37c08085144,
-          0x96e24e9346c5ad11, 0x8f3c81c2ae65cde9, 0xaec1a226eb3a4c98, 0xb9fd56733aa55128, 0x832910bc10270fa4,
-          0xbcc6de743b8291a7, 0x8bbe2ea9abc28c3d, 0x326c9f75de6196e8, 0x4f6b52ab2b6c6a64, 0x17c6904531d59529,
-          0xabb1fe56290a8d8d, 0x7cc4d04fcfba019e, 0x8ecb7d961ed71e1d, 0x7760502af173792b, 0x29bccc90e448e538,
-          0x45d7b99614a81245, 0x2dfadae65d6b0cb7, 0x9ad43ef58e88de2a, 0x4b360a893d69e9c9, 0xa651ef5a859191ad,
-          0xcfdb13055631f35b, 0xeb4c51f7f79a1bbf, 0x62bdaa44be894589, 0xec4a3d909c2b4daa, 0xc72319c984b771f8,
-          0xe76b327e7509b5fa, 0x1882f37987a66ec1, 0x75c2ef4af62ce91a, 0xf662c525bd30133a, 0xd320dbf2421723bc,
-          0x7834c1d2f523af64, 0x79c324a6749da986, 0x4b4ba1e783addd04, 0xab9d7e214db4c8b1, 0x1fac09024881452d,
-          0xecc14181e165df86, 0x32d140d9bd2a5cd3, 0x4d708c9835e72d55, 0x07f91d5bd8ad3e46, 0x1f5371b130e86343,
-          0x1352ac630c691bde, 0xd681bc0b67f53a66, 0xa935b657723555b3, 0xf388e8ca583bf32d, 0x66f89cc6fd934db7,
-          0x8b95897b43ed7636, 0xb1a3c0207eab7478, 0x38b15b87a0a50229, 0xb7c346e3508d2fca, 0xf0faa692d7000bd8,
-          0xc6b66893d6da7042, 0x9437d86bc2612c78, 0xdc5df5d565a35a61, 0x5cbe7a75fe6c71d8, 0xdaaa9d2531bab48b,
-          0xa243c66195cef9d3, 0xa563c75c710ebf06, 0xf15678876b50f918, 0xefd60ba525520260, 0x26fb24c5a61ef887,
-          0xcb8bcf6f7084f7eb, 0xace78572e9556fca, 0x2ff5634a210eafac, 0xdba1ad7f20667be2, 0x07014d0e553a5303,
-          0xd6d884a7c4a93c64, 0x5b5668d7236eeb10, 0x1b1b8fc9b0c7dd78, 0xecd4b2c8f604e2c9, 0x7cdbce8cac9b9ca3,
-          0x52073ebaf64b0fdf, 0x59eb5bd39dbf2171, 0x681086ad35fe4cb7, 0x28b28b76afc88f35, 0x200047b4d5373e2d,
-          0x693190e6a94bb91a, 0x90704560d6c13ae6, 0x323ac8d31c975e39, 0x5b03e6ff45ea236e, 0x051b194ffe1b23de,
-          0x3c75ac7d4cb7f6b7, 0x5a8a46defd53edc0, 0xbc8e52f79e7dad07, 0x5882ca99a9ed6e97, 0x6a55d80c7e6e55fe,
-          0x394a5dc3c96c368d, 0x9fd66c2a1a4de3a6, 0x46d3c96403bb6cd9, 0x215851fdd6076fd2, 0x670770374ecf0c4e,
-          0x0882b33047cb2167, 0xc557954260b74b03, 0xd3261c928371cbbb, 0xae2aafe0133f95aa, 0xf487e4c1a5fca6b1,
-          0x0195f8bcbaf96a1e, 0x2e605e94d83826da, 0x2a6ef1fb9a939bff, 0x4489ffbe227f90bf, 0xadc0e228a7972b4d,
-          0xfe8b27a539684115, 0x8de2ebff2ff6cede, 0xa7093a0000000000};
+        static constexpr std::string_view etag{"\"92944065c2d1dd6f\""};
+        static constexpr std::array<uint8_t, 3501> data{
+          0x1f, 0x8b, 0x08, 0x08, 0x72, 0xa3, 0x47, 0x64, 0x02, 0x03, 0x57, 0x65, 0x62, 0x46, 0x72, 0x6f, 0x6e, 0x74, 0x2e, 0x6a, 0x73, 0x00, 0xd5, 0x1b,
+          0xdb, 0x8e, 0xdb, 0x36, 0xf6, 0xbd, 0x40, 0xff, 0x81, 0xf5, 0x43, 0x2d, 0xc5, 0x8a, 0xc6, 0xf6, 0x4c, 0xa6, 0xd3, 0x71, 0xbc, 0x6d, 0x93, 0x4e,
+          0x80, 0x2e, 0xb2, 0x4d, 0xd1, 0xc9, 0xb6, 0x0f, 0x86, 0x61, 0xc8, 0x36, 0x6d, 0x2b, 0x91, 0x25, 0x43, 0xa2, 0xe7, 0xb2, 0xad, 0xff, 0x7d, 0xcf,
+          0xe1, 0x45, 0x22, 0x25, 0x51, 0xd2, 0x4c, 0xd1, 0x05, 0x76, 0x90, 0xc0, 0x16, 0xc5, 0x73, 0xe1, 0xe1, 0xb9, 0x93, 0x3e, 0x3b, 0x3b, 0x23, 0xdf,
+          0xaf, 0x03, 0x46, 0xc9, 0xf8, 0x9b, 0xb3, 0xe1, 0xe8, 0x6c, 0x3c, 0x1c, 0x8f, 0xc9, 0x78, 0x7c, 0x7d, 0x31, 0xba, 0xbe, 0x18, 0x7f, 0xf9, 0xc5,
+          0x19, 0xbe, 0x0e, 0x8e, 0x6c, 0x97, 0xa4, 0xe4, 0x87, 0xfd, 0x32, 0x4d, 0xc2, 0x8c, 0x92, 0xf7, 0x74, 0x15, 0xd1, 0x74, 0x25, 0xdf, 0x2e, 0xd3,
+          0x90, 0x6e, 0xc8, 0xef, 0x74, 0xf9, 0x2e, 0x4d, 0x62, 0x46, 0x56, 0x51, 0x48, 0xf1, 0x23, 0x49, 0xe9, 0x97, 0x5f, 0xdc, 0x05, 0x29, 0x59, 0x2c,
+          0xe8, 0x03, 0xa3, 0xf1, 0x3a, 0x23, 0x53, 0xe2, 0xb0, 0x5d, 0x98, 0x91, 0xaf, 0xbf, 0x26, 0xf8, 0xe9, 0xe7, 0x6f, 0x5c, 0xf2, 0xe7, 0x9f, 0xc4,
+          0xd9, 0x1c, 0xe3, 0x15, 0x0b, 0x93, 0x98, 0x38, 0x2e, 0xf9, 0xe3, 0xcb, 0x2f, 0x08, 0xfc, 0x21, 0xbc, 0x98, 0x73, 0xcb, 0x02, 0x16, 0xae, 0x10,
+          0x47, 0x31, 0x6d, 0xed, 0x91, 0x65, 0x3e, 0x15, 0xff, 0xca, 0x53, 0x3f, 0x2c, 0x3f, 0xd1, 0x15, 0xf3, 0x33, 0xca, 0x7e, 0x49, 0x13, 0x96, 0xb0,
+          0xc7, 0x03, 0xfd, 0xb0, 0x01, 0x5a, 0x05, 0x04, 0xfe, 0x39, 0x7f, 0x00, 0x8f, 0x07, 0x9c, 0xb0, 0x58, 0x5c, 0x93, 0xd9, 0x9c, 0x9c, 0x48, 0x18,
+          0x67, 0x2c, 0x88, 0x57, 0x34, 0xd9, 0x90, 0x1f, 0xd2, 0x34, 0x78, 0x44, 0x96, 0x2b, 0x74, 0xc9, 0xda, 0xcf, 0xe1, 0x80, 0xd8, 0x72, 0x42, 0x4e,
+          0x6e, 0x05, 0x79, 0x15, 0x6a, 0x03, 0xa2, 0x74, 0x70, 0x61, 0x07, 0x20, 0x83, 0x43, 0xe1, 0x86, 0x38, 0x92, 0xd3, 0x83, 0x62, 0xd3, 0xdf, 0x05,
+          0xd9, 0x87, 0xfb, 0x18, 0xd8, 0x3e, 0xd0, 0x94, 0x3d, 0xfa, 0xab, 0x20, 0x8a, 0x9c, 0xa5, 0x47, 0x0e, 0xae, 0x4b, 0xd6, 0xb3, 0xc3, 0x1c, 0xe9,
+          0xc1, 0x07, 0x90, 0x9c, 0x14, 0xf4, 0x52, 0xca, 0x8e, 0x69, 0x6c, 0x4a, 0x41, 0x90, 0x95, 0x93, 0xd4, 0x64, 0x39, 0xb1, 0x41, 0x92, 0xc8, 0x13,
+          0xf2, 0x01, 0x02, 0x58, 0x92, 0xaf, 0xa6, 0x53, 0xd2, 0x53, 0x93, 0x7b, 0x28, 0x0b, 0x31, 0x16, 0x1f, 0xa3, 0xc8, 0x35, 0x97, 0xcb, 0x76, 0x69,
+          0x72, 0x4f, 0x62, 0x7a, 0x4f, 0x3e, 0x02, 0xf4, 0x4d, 0x9a, 0x26, 0xa9, 0xd3, 0x7b, 0x1b, 0x05, 0x59, 0x46, 0x94, 0x16, 0xdc, 0x05, 0xd1, 0x91,
+          0x92, 0x1e, 0x19, 0x90, 0x5b, 0x96, 0x86, 0xf1, 0xd6, 0x01, 0xca, 0x03, 0x78, 0x06, 0xc5, 0x88, 0x13, 0x46, 0x02, 0x50, 0x1d, 0x90, 0x7e, 0x7a,
+          0x5c, 0x31, 0x10, 0x14, 0xfc, 0x43, 0x2a, 0x3d, 0x77, 0x62, 0xd9, 0x65, 0x63, 0x7d, 0x86, 0xc0, 0x17, 0x0b, 0xd4, 0x23, 0xa1, 0x69, 0x3a, 0xca,
+          0x29, 0x59, 0x83, 0xd8, 0x0a, 0x80, 0x75, 0x21, 0x75, 0x94, 0x2a, 0x99, 0xca, 0x95, 0x91, 0xef, 0x94, 0xfe, 0xac, 0x52, 0x0a, 0x06, 0x82, 0x7c,
+          0x5e, 0x13, 0x67, 0xb1, 0x30, 0xe7, 0x17, 0x4f, 0x1e, 0x5f, 0x37, 0x92, 0xd5, 0xe5, 0x7d, 0x72, 0x1d, 0x7c, 0x14, 0x96, 0x90, 0x1d, 0x00, 0xd5,
+          0x5a, 0xa8, 0x54, 0xd5, 0x1a, 0xb4, 0xb7, 0xdc, 0x22, 0x8a, 0xfd, 0x61, 0x89, 0x47, 0x36, 0x69, 0xb2, 0x07, 0x05, 0x08, 0x56, 0x9f, 0xf3, 0x9d,
+          0xc2, 0x5d, 0xc2, 0x01, 0x9c, 0x1c, 0xa4, 0xdb, 0xe3, 0x1e, 0x2c, 0x2f, 0xf3, 0x23, 0x1a, 0x6f, 0xd9, 0x8e, 0xaf, 0x63, 0xec, 0x16, 0xea, 0x16,
+          0x02, 0xc5, 0xa1, 0x47, 0x22, 0x34, 0x21, 0x40, 0x25, 0xa7, 0x79, 0x00, 0x38, 0x81, 0x77, 0xaf, 0x49, 0x04, 0x1f, 0x83, 0x41, 0x45, 0x0b, 0x00,
+          0x12, 0xb0, 0x7f, 0xe5, 0x84, 0xa8, 0xad, 0x08, 0xe8, 0x1a, 0x53, 0xd4, 0xb4, 0xaf, 0x82, 0xd4, 0x05, 0x54, 0x80, 0x9c, 0xf3, 0xaf, 0x69, 0x72,
+          0x16, 0x85, 0x2b, 0x2a, 0x14, 0x58, 0x2c, 0x01, 0x98, 0x08, 0xf5, 0x1d, 0xc3, 0xbf, 0x20, 0x9d, 0x85, 0x73, 0xc9, 0x19, 0x7c, 0xd3, 0xde, 0xca,
+          0x9d, 0x3a, 0x19, 0x9a, 0xcb, 0x12, 0xdc, 0xd2, 0x55, 0xc0, 0x24, 0x7b, 0x2d, 0x34, 0xf9, 0x86, 0x9c, 0xe4, 0x2e, 0xdc, 0xd3, 0xe5, 0x06, 0x3d,
+          0x15, 0x3c, 0x6a, 0x2e, 0x47, 0x8d, 0x1a, 0xae, 0xe7, 0x8e, 0xa6, 0x19, 0xbe, 0x9d, 0x82, 0x1e, 0xed, 0x83, 0x4f, 0x49, 0x7a, 0x8d, 0xcc, 0xef,
+          0xc3, 0x18, 0xbf, 0x8d, 0x70, 0x33, 0xd8, 0x6a, 0x07, 0xdf, 0x72, 0xc3, 0xca, 0xf1, 0xad, 0x92, 0xfd, 0xe1, 0xc8, 0xe8, 0x4d, 0xbc, 0x0e, 0x83,
+          0x38, 0xa6, 0x59, 0xe6, 0x18, 0x52, 0x43, 0xe4, 0xc7, 0x9f, 0x62, 0x76, 0x3e, 0x06, 0xdc, 0xa8, 0x35, 0xff, 0x0e, 0xf1, 0x81, 0x2f, 0xc3, 0x99,
+          0x0d, 0x1f, 0x46, 0xa3, 0x21, 0xfc, 0x6d, 0x36, 0x73, 0x5d, 0x4e, 0x0a, 0xe8, 0x4a, 0x83, 0xb9, 0x12, 0x20, 0x02, 0x97, 0x5b, 0xf5, 0x05, 0x7c,
+          0xfe, 0x6c, 0x38, 0xe7, 0xda, 0x30, 0x7c, 0x78, 0xf7, 0x0e, 0xb4, 0x9a, 0x72, 0xa6, 0xfc, 0x28, 0x64, 0x2c, 0xa2, 0xa0, 0xd2, 0xa5, 0x39, 0xa3,
+          0x51, 0x31, 0x67, 0x19, 0x6e, 0x61, 0x82, 0x09, 0x30, 0xd0, 0x5e, 0x4e, 0x8c, 0xcd, 0xe1, 0xde, 0x9a, 0xbf, 0x93, 0xe3, 0x9a, 0x7c, 0xc5, 0xb8,
+          0xe9, 0xad, 0xf9, 0xd0, 0x4c, 0x7e, 0xf4, 0x04, 0xfa, 0x1e, 0x6a, 0x01, 0xf2, 0x42, 0xd4, 0xc0, 0xc4, 0x0a, 0x01, 0x0c, 0xf0, 0xe9, 0x23, 0x3e,
+          0x1d, 0x9f, 0xec, 0x73, 0x63, 0xf0, 0x16, 0x77, 0x02, 0x7b, 0xcd, 0xde, 0x70, 0x04, 0x72, 0x8a, 0x5a, 0x93, 0x2b, 0x79, 0xe6, 0xb1, 0x49, 0x7e,
+          0x05, 0x45, 0x38, 0xe5, 0xd6, 0x8d, 0xcb, 0x85, 0xb0, 0xf7, 0x3e, 0x8c, 0x3f, 0xa3, 0x33, 0xa2, 0xd5, 0x45, 0xeb, 0x6f, 0x8d, 0xa5, 0xeb, 0x2f,
+          0x66, 0xc6, 0x43, 0xef, 0x18, 0x87, 0x71, 0xc8, 0xc2, 0x20, 0x0a, 0xff, 0x43, 0xd7, 0x9a, 0x34, 0xcc, 0xf1, 0x49, 0x27, 0x5c, 0xbb, 0x00, 0x1c,
+          0xee, 0x2e, 0xf8, 0x0c, 0x5e, 0x56, 0x13, 0x94, 0x3e, 0xda, 0x0d, 0x4f, 0x04, 0x5f, 0x25, 0x33, 0x63, 0xb9, 0x35, 0x7c, 0xa0, 0x10, 0x95, 0x3e,
+          0x9f, 0x0b, 0xcc, 0x18, 0xa8, 0x88, 0xed, 0x67, 0xca, 0xde, 0x07, 0x8f, 0x14, 0xdd, 0xc5, 0xd9, 0x8b, 0x17, 0xe4, 0xfb, 0x15, 0x8f, 0x10, 0x2f,
+          0xce, 0x6a, 0x93, 0x00, 0xc3, 0xb0, 0x14, 0xa4, 0x53, 0xf1, 0x42, 0xdc, 0xc3, 0x72, 0x8f, 0x3a, 0xe5, 0x0e, 0xb5, 0xe4, 0x61, 0x30, 0x04, 0x24,
+          0x11, 0xf5, 0xa3, 0x64, 0xeb, 0xf4, 0x62, 0xca, 0x22, 0x4e, 0x3f, 0x0f, 0x0c, 0xb0, 0x9a, 0xb2, 0x4f, 0xe2, 0x5e, 0x39, 0xa5, 0xab, 0xbb, 0x37,
+          0xc7, 0xcd, 0x86, 0xf3, 0x8a, 0x56, 0xc7, 0x0d, 0x4e, 0x8c, 0x38, 0xaf, 0x46, 0x63, 0x2b, 0xd0, 0xbf, 0xb2, 0x6d, 0xd5, 0x4e, 0x4b, 0x28, 0x6b,
+          0x81, 0x33, 0xd0, 0xb5, 0x27, 0x53, 0x44, 0x20, 0x3b, 0xc5, 0x02, 0x65, 0x3d, 0x70, 0xb2, 0xfa, 0x4c, 0x99, 0x84, 0x85, 0x8d, 0xbb, 0xe5, 0xcf,
+          0x4e, 0xff, 0x3e, 0xbb, 0x3e, 0x3b, 0x8b, 0x12, 0x70, 0xa3, 0xbb, 0x24, 0x63, 0xd7, 0x7d, 0x30, 0xfd, 0xfb, 0x30, 0x5e, 0x27, 0xf7, 0x3e, 0x0e,
+          0xe2, 0x76, 0xf8, 0x87, 0x24, 0x65, 0x1e, 0xe9, 0xab, 0xec, 0x6f, 0x31, 0xf4, 0x47, 0xfd, 0x06, 0x1a, 0x7e, 0x12, 0x43, 0x42, 0x13, 0x1b, 0x59,
+          0x1c, 0xbd, 0xa3, 0x9a, 0xdb, 0xb5, 0x6d, 0x59, 0x5f, 0x39, 0x68, 0x1c, 0x8d, 0xa9, 0x80, 0x45, 0x5c, 0x74, 0x5d, 0x21, 0x88, 0x7f, 0x0b, 0x9d,
+          0xea, 0x32, 0x8c, 0x83, 0xf4, 0xf1, 0xa3, 0x88, 0xd8, 0xfd, 0x00, 0x05, 0xb3, 0xe4, 0xe2, 0xe8, 0x5b, 0x21, 0x93, 0xf8, 0x03, 0x20, 0x77, 0xca,
+          0xa8, 0x4f, 0x8d, 0x6b, 0x5b, 0x45, 0x49, 0x46, 0x3b, 0x2e, 0x0e, 0x83, 0x26, 0x7f, 0xeb, 0xdf, 0x07, 0xd9, 0xdb, 0x88, 0x82, 0x73, 0xac, 0x4e,
+          0xaa, 0x28, 0xee, 0x8c, 0x93, 0x98, 0x93, 0xb7, 0x85, 0x10, 0xf8, 0xc8, 0x1a, 0x3e, 0x00, 0x45, 0xf4, 0xe8, 0xc1, 0xfc, 0x35, 0x9d, 0xf6, 0x54,
+          0x7c, 0x14, 0x24, 0x70, 0xcc, 0x83, 0x1c, 0x0b, 0xf2, 0x8b, 0x2c, 0x89, 0xa7, 0x3d, 0xd7, 0x7c, 0x2d, 0x86, 0xdd, 0x3a, 0x39, 0xd2, 0x28, 0xa3,
+          0xed, 0x7c, 0xf5, 0x6b, 0xf8, 0x5a, 0x87, 0x35, 0x5b, 0xd3, 0x2c, 0x3f, 0x8a, 0xf9, 0xa2, 0x29, 0x3f, 0x1c, 0xc1, 0x34, 0xce, 0x94, 0x02, 0x1f,
+          0x9e, 0x93, 0x62, 0x95, 0x7c, 0x9a, 0x3b, 0x69, 0xc1, 0xbf, 0x07, 0x67, 0x1f, 0x6c, 0xbb, 0xee, 0x10, 0xcf, 0x00, 0x42, 0x30, 0x09, 0x61, 0x18,
+          0x3f, 0x06, 0x2c, 0xf8, 0x0d, 0x1e, 0xa5, 0xcc, 0xa0, 0x66, 0x0a, 0xea, 0x04, 0x86, 0x50, 0x10, 0x61, 0xf6, 0xe0, 0x64, 0x01, 0x10, 0xe1, 0xfd,
+          0x2d, 0x65, 0xdc, 0x22, 0x9d, 0x61, 0x1d, 0x00, 0xd4, 0x50, 0x0d, 0x92, 0x9d, 0xf9, 0xbe, 0x5f, 0x32, 0x69, 0x8d, 0xfe, 0xdc, 0xdf, 0x07, 0x07,
+          0xe7, 0x81, 0x4c, 0xff, 0x41, 0x1e, 0x7c, 0x96, 0xc8, 0x84, 0x7a, 0x74, 0xe9, 0xfa, 0x87, 0x00, 0x33, 0xe4, 0x94, 0x39, 0x63, 0x30, 0xcf, 0x61,
+          0xdf, 0x75, 0xfd, 0x4f, 0x49, 0x18, 0x3b, 0x7d, 0xd2, 0xaf, 0xdd, 0xe6, 0xec, 0x3e, 0x84, 0x54, 0x86, 0x38, 0x92, 0xf3, 0x5a, 0x79, 0x70, 0xd6,
+          0x02, 0x50, 0xf0, 0x11, 0x38, 0x6d, 0xd8, 0x69, 0x3e, 0xd3, 0xc7, 0xf4, 0xf3, 0xc5, 0xd9, 0x75, 0xfd, 0x74, 0xa5, 0xe8, 0xd2, 0x1a, 0x45, 0x30,
+          0x80, 0x2c, 0x43, 0x8f, 0x0e, 0xbe, 0x16, 0x8f, 0xac, 0x74, 0x4b, 0x66, 0x2d, 0xa3, 0x8a, 0x81, 0x46, 0xc4, 0xa4, 0x49, 0x17, 0x78, 0x91, 0x59,
+          0xdc, 0xa8, 0x98, 0x6e, 0x6e, 0xd2, 0xc8, 0x05, 0x16, 0xcd, 0x9c, 0xa7, 0x05, 0xa9, 0xa1, 0x9b, 0x92, 0x27, 0x50, 0x99, 0x6d, 0xb2, 0x0a, 0x81,
+          0xb1, 0x35, 0x64, 0x50, 0x19, 0x4d, 0x21, 0x97, 0xc4, 0x12, 0xa7, 0xe7, 0xd5, 0xf1, 0xf0, 0x9d, 0xca, 0x76, 0x24, 0xdd, 0x1e, 0xc0, 0x60, 0x42,
+          0xa3, 0x1e, 0xdd, 0x06, 0x0e, 0x4e, 0xf6, 0x57, 0x4b, 0x30, 0xec, 0xcf, 0x93, 0x86, 0x9d, 0x1c, 0xeb, 0x3b, 0xc9, 0xa0, 0xb0, 0x92, 0xdf, 0x9b,
+          0x77, 0xb4, 0x65, 0x8f, 0xd0, 0x02, 0x92, 0x03, 0xba, 0x9c, 0x1a, 0xd9, 0x4e, 0xda, 0x61, 0x91, 0x8f, 0xf7, 0xb4, 0xbc, 0x31, 0xa3, 0x4b, 0x67,
+          0xec, 0x76, 0xda, 0x5d, 0x6d, 0x1d, 0x8e, 0xe0, 0xc3, 0x23, 0x56, 0x13, 0xf2, 0xc8, 0x85, 0xa7, 0x28, 0xba, 0x7f, 0x97, 0x98, 0xcf, 0x75, 0x31,
+          0x63, 0x55, 0xf2, 0x4e, 0xb9, 0x9f, 0xbf, 0x2a, 0xe7, 0x43, 0x90, 0x06, 0xfb, 0xec, 0x6d, 0x72, 0x8c, 0xd9, 0xf3, 0x84, 0x2d, 0x10, 0xa0, 0x6f,
+          0xbb, 0x85, 0xc4, 0xb2, 0x84, 0xe3, 0x7c, 0xec, 0x5c, 0xd4, 0xe9, 0x6b, 0x1b, 0x62, 0x96, 0x3e, 0xb6, 0x31, 0x5f, 0x6c, 0x17, 0xca, 0xe3, 0x9f,
+          0x99, 0x92, 0x88, 0xa3, 0xad, 0xc8, 0xb3, 0xf9, 0x5d, 0x8f, 0x5c, 0x79, 0x25, 0xce, 0xdd, 0x36, 0x9e, 0x4e, 0x2d, 0x36, 0x1c, 0x70, 0xff, 0xa7,
+          0xe2, 0x4d, 0x3b, 0xf3, 0xca, 0xe8, 0xa9, 0xe8, 0x71, 0xfc, 0x1e, 0x42, 0xc9, 0xcd, 0x97, 0x72, 0x7b, 0xcd, 0x9b, 0x1b, 0x02, 0xd3, 0xf3, 0x99,
+          0x7a, 0x86, 0xbe, 0x9d, 0xba, 0xc4, 0xda, 0x3a, 0xd7, 0x69, 0xd4, 0x16, 0x75, 0x50, 0x25, 0x87, 0xb9, 0x09, 0x20, 0x2b, 0xa8, 0xd6, 0xe8, 0xf8,
+          0xa7, 0xf2, 0x73, 0xad, 0x18, 0xd7, 0xfd, 0x8a, 0x1e, 0x79, 0x95, 0x6d, 0xe2, 0x7b, 0xdc, 0xe0, 0xda, 0x8c, 0x1e, 0x5f, 0xca, 0x00, 0xfc, 0x11,
+          0xbe, 0xfe, 0x48, 0x11, 0x06, 0xe4, 0x7d, 0x64, 0x9b, 0x97, 0x57, 0x90, 0xc7, 0xac, 0xf9, 0x80, 0x93, 0xe3, 0x28, 0x71, 0xaf, 0xe2, 0x9a, 0xa0,
+          0x55, 0x9f, 0x65, 0xa2, 0x85, 0x0e, 0xd1, 0x42, 0x3f, 0x02, 0x9f, 0xfb, 0xf5, 0x07, 0x3e, 0x15, 0x10, 0x2f, 0x8f, 0xdb, 0xf7, 0xc9, 0xd6, 0x6e,
+          0xa2, 0xba, 0xdb, 0x47, 0xfa, 0xb6, 0xcd, 0xb6, 0x6d, 0x57, 0x11, 0x4b, 0x0d, 0xc2, 0x61, 0x8c, 0x4d, 0xa7, 0xdb, 0x55, 0x1a, 0x1e, 0x18, 0x12,
+          0xb7, 0x29, 0x23, 0x4a, 0x27, 0x13, 0xb3, 0xa6, 0x64, 0x9d, 0xac, 0x78, 0xf7, 0x47, 0xf6, 0xaa, 0x6e, 0x22, 0x8a, 0x4f, 0x4e, 0x4f, 0x4c, 0xb0,
+          0xc6, 0x0f, 0xf1, 0xda, 0x97, 0x42, 0xc6, 0x0f, 0xcb, 0xc4, 0x1c, 0xff, 0x32, 0x59, 0x3f, 0xfa, 0xc1, 0x01, 0x72, 0xe3, 0xf5, 0xdb, 0x5d, 0x18,
+          0xad, 0x1d, 0x81, 0xc2, 0xed, 0xa0, 0x8e, 0x9a, 0xbe, 0x4c, 0x1a, 0x15, 0x46, 0xec, 0xe9, 0x2f, 0x68, 0xdf, 0x94, 0xd1, 0xd4, 0x6c, 0xfa, 0x1a,
+          0xfe, 0x41, 0x38, 0x83, 0x64, 0xb3, 0xc9, 0x28, 0xab, 0x6d, 0x4b, 0x89, 0x57, 0x3c, 0xe7, 0xb8, 0x4b, 0xc2, 0x35, 0x19, 0x62, 0x2e, 0xa9, 0x06,
+          0xc9, 0x70, 0x52, 0x66, 0x32, 0x77, 0x89, 0x8a, 0xf0, 0x6c, 0x3e, 0xa9, 0xce, 0x40, 0xb2, 0xc0, 0x5e, 0xc6, 0x4b, 0x34, 0x81, 0xad, 0x34, 0xab,
+          0x68, 0xf2, 0x22, 0xb2, 0x9f, 0xe2, 0x35, 0x7d, 0x10, 0xf4, 0xb4, 0xe7, 0xd7, 0xba, 0xf7, 0x9e, 0x90, 0xc1, 0xa0, 0x78, 0x67, 0xcd, 0x47, 0x65,
+          0xd7, 0x11, 0x19, 0x28, 0x1c, 0x7d, 0xc1, 0x4e, 0x53, 0x6a, 0x87, 0xa0, 0x1d, 0xf2, 0x3a, 0x2e, 0x76, 0x2c, 0x95, 0x60, 0xab, 0x13, 0xac, 0x29,
+          0x3e, 0xa6, 0x47, 0xca, 0xf5, 0x10, 0x12, 0x55, 0x19, 0xd6, 0x41, 0xb2, 0xf2, 0x25, 0xa6, 0x34, 0x50, 0x3f, 0x53, 0xbb, 0xb3, 0x2a, 0xa4, 0xe9,
+          0x1f, 0x8e, 0xd9, 0xce, 0xc1, 0xd9, 0x4d, 0x6e, 0x51, 0x93, 0xed, 0x60, 0x4a, 0x46, 0x93, 0xbf, 0x9a, 0xdd, 0x54, 0xd6, 0xf3, 0x0e, 0x9d, 0x57,
+          0xe3, 0x82, 0xb8, 0x7b, 0xeb, 0xbe, 0x22, 0x3e, 0xfd, 0x7f, 0xb4, 0xa4, 0x73, 0x73, 0x49, 0xf1, 0x71, 0xbf, 0x04, 0xac, 0xe6, 0x62, 0x06, 0xe4,
+          0x8a, 0x2c, 0x1f, 0x19, 0xcd, 0xc8, 0x4f, 0x37, 0x37, 0x37, 0xdf, 0xbc, 0xba, 0x20, 0x9b, 0x28, 0x81, 0x72, 0x3d, 0xde, 0x92, 0x03, 0xd4, 0x00,
+          0x8c, 0x08, 0xa8, 0xee, 0x0b, 0x54, 0xda, 0xf6, 0x0e, 0xd1, 0x5c, 0x5e, 0x38, 0xfa, 0x7a, 0xb0, 0x0d, 0x5a, 0xcd, 0x0f, 0xba, 0x4b, 0xe3, 0xdb,
+          0xbf, 0x22, 0x8d, 0x0b, 0x53, 0x1a, 0xd9, 0x1e, 0xe2, 0xaf, 0xa8, 0x81, 0x2a, 0x22, 0x19, 0x71, 0x91, 0x90, 0x0c, 0x22, 0x5c, 0x03, 0xc2, 0x57,
+          0x25, 0x84, 0x39, 0xae, 0x86, 0x24, 0xcd, 0x20, 0x33, 0x96, 0x92, 0xb7, 0xd3, 0xd1, 0xad, 0xf9, 0x3e, 0x49, 0x31, 0x24, 0x0a, 0xa3, 0x9e, 0x5a,
+          0xa9, 0x3f, 0x29, 0x67, 0xe6, 0x38, 0xbf, 0x33, 0x3c, 0x04, 0xa4, 0xce, 0xed, 0x5b, 0x06, 0x15, 0x87, 0xcd, 0xab, 0x20, 0x48, 0xb7, 0x5c, 0xf2,
+          0x11, 0x34, 0x64, 0x2d, 0xfd, 0x53, 0x0e, 0xeb, 0x48, 0x96, 0xce, 0x81, 0xc4, 0xb8, 0x6b, 0x01, 0xd0, 0x21, 0xe6, 0x73, 0x76, 0x45, 0x1f, 0x47,
+          0x34, 0xfc, 0xe5, 0x08, 0x6c, 0xc0, 0x07, 0xe1, 0xe1, 0x07, 0x8a, 0x25, 0x11, 0x29, 0x6a, 0x5f, 0xc1, 0xb7, 0x2e, 0xe9, 0x7f, 0xad, 0x2b, 0x6b,
+          0x08, 0xfa, 0x35, 0xda, 0x3e, 0xad, 0x92, 0xfc, 0x9b, 0xea, 0x8d, 0xd1, 0x95, 0xa9, 0x49, 0xec, 0x78, 0x88, 0x84, 0xcb, 0xfb, 0xa3, 0xce, 0x28,
+          0x36, 0xfc, 0x94, 0x8d, 0x7b, 0x92, 0x64, 0xa3, 0x87, 0xbf, 0xfb, 0x5d, 0x08, 0x91, 0x83, 0xf7, 0x48, 0x43, 0x76, 0x84, 0x99, 0x6c, 0x07, 0xff,
+          0x11, 0x99, 0x9d, 0x39, 0xdc, 0xc0, 0x78, 0xc9, 0x69, 0x67, 0x0d, 0x91, 0xaa, 0x4d, 0xa7, 0x78, 0x98, 0xe5, 0xfb, 0xfc, 0x2b, 0x0f, 0xd5, 0x5c,
+          0x61, 0xcb, 0x89, 0x81, 0xa3, 0x08, 0xa9, 0x4c, 0xc0, 0xc0, 0xdf, 0xa8, 0x6b, 0x15, 0x1f, 0xa7, 0x68, 0xcd, 0x86, 0xf3, 0xee, 0xde, 0x6b, 0x0c,
+          0x64, 0x0a, 0xc8, 0xd1, 0xdc, 0x02, 0x78, 0x7a, 0x4a, 0x72, 0xa4, 0x9d, 0xde, 0xcc, 0x0a, 0x2e, 0x8d, 0xb5, 0xbd, 0x94, 0x49, 0x87, 0x71, 0x4e,
+          0xd6, 0x9c, 0x53, 0x99, 0x55, 0x56, 0x73, 0x46, 0x55, 0xdf, 0x5a, 0x0f, 0xac, 0xbb, 0x30, 0x92, 0x60, 0x5e, 0x8e, 0xf4, 0x67, 0x78, 0x05, 0xd3,
+          0x17, 0x01, 0x48, 0xd3, 0x2b, 0xf2, 0x2d, 0x78, 0x1e, 0xd5, 0xe5, 0x53, 0x46, 0xc6, 0x55, 0x4f, 0x43, 0x2f, 0x74, 0x5f, 0x92, 0x51, 0x29, 0xf5,
+          0x03, 0x32, 0xe5, 0xb2, 0xa5, 0xbe, 0x04, 0xa5, 0x0f, 0x74, 0x05, 0x8a, 0xac, 0xe4, 0xf0, 0xe6, 0x11, 0x39, 0xc5, 0x7c, 0x36, 0x7a, 0x74, 0x44,
+          0x82, 0xe8, 0x99, 0xc7, 0xb4, 0xce, 0x4c, 0x5f, 0x13, 0x5f, 0x8e, 0xe8, 0x81, 0xcf, 0x3d, 0xa2, 0xef, 0x8e, 0x48, 0x02, 0x2a, 0xed, 0xce, 0xd2,
+          0x19, 0x44, 0x5b, 0x91, 0x59, 0x1c, 0x9f, 0xab, 0xa3, 0x73, 0xd8, 0x36, 0x0c, 0x02, 0xf9, 0x6e, 0x61, 0x69, 0x59, 0xe2, 0x88, 0x9f, 0x9e, 0x37,
+          0x14, 0x9d, 0xdd, 0x13, 0xef, 0xfb, 0x34, 0x64, 0x66, 0x77, 0xd4, 0xd6, 0x0f, 0xd4, 0x0f, 0x1d, 0xf8, 0xd1, 0xa1, 0xea, 0x79, 0x5a, 0xea, 0xaf,
+          0xa6, 0xbe, 0x62, 0x51, 0x80, 0xa9, 0x16, 0x89, 0xea, 0x08, 0x52, 0x7b, 0xe8, 0x35, 0x18, 0xe0, 0xe7, 0x5a, 0xb2, 0x63, 0x27, 0x4e, 0xf1, 0x26,
+          0x4d, 0x50, 0x75, 0x25, 0xb0, 0xd6, 0x84, 0x6c, 0x84, 0x15, 0xad, 0x64, 0x24, 0xec, 0xe8, 0x2c, 0xc8, 0x00, 0x04, 0xda, 0x33, 0x76, 0x3b, 0xca,
+          0x5f, 0xda, 0xb8, 0xda, 0x06, 0x75, 0x96, 0x56, 0xdc, 0x1e, 0x30, 0x8f, 0x19, 0xc5, 0xed, 0x9a, 0x86, 0xf3, 0xb2, 0x45, 0x76, 0x3c, 0x50, 0x53,
+          0xad, 0xf2, 0x0b, 0x36, 0x8e, 0x42, 0x00, 0xda, 0x2d, 0xa6, 0xd5, 0xdd, 0x98, 0x50, 0x93, 0x9a, 0xcf, 0xd6, 0x04, 0x02, 0x71, 0xb8, 0x8e, 0x43,
+          0xfc, 0xaa, 0x42, 0xcb, 0x81, 0x5b, 0xbf, 0xb8, 0x1e, 0x54, 0x1c, 0xb8, 0xe5, 0x27, 0xcb, 0xa4, 0x9f, 0x1f, 0x2a, 0x97, 0x65, 0x27, 0x85, 0xb4,
+          0x28, 0xe1, 0x3f, 0x19, 0xc7, 0x96, 0x1c, 0xb3, 0xee, 0xeb, 0x0e, 0x87, 0x5a, 0x47, 0x17, 0x83, 0xbd, 0x54, 0x96, 0xa6, 0x6e, 0x14, 0xf0, 0x56,
+          0x54, 0x01, 0xf8, 0x06, 0x8c, 0x1c, 0x56, 0xb9, 0x0c, 0xe5, 0x46, 0x7b, 0x84, 0x43, 0x5b, 0x1c, 0x6e, 0x33, 0x13, 0x02, 0x97, 0xc1, 0x8a, 0x6e,
+          0xc2, 0xb5, 0xd2, 0x0e, 0xd2, 0x6d, 0x6d, 0xf9, 0x99, 0x17, 0x96, 0x0b, 0xbc, 0xcf, 0x31, 0x9a, 0xe0, 0xe7, 0xeb, 0xca, 0xe5, 0x0f, 0x1c, 0x2e,
+          0xdd, 0xe5, 0x28, 0x6e, 0x5a, 0x6c, 0xb3, 0x19, 0x00, 0xbd, 0x14, 0xa7, 0xc1, 0x39, 0x24, 0x8c, 0xcd, 0x9b, 0xbd, 0x17, 0x52, 0xdd, 0x81, 0x5f,
+          0xa4, 0xa9, 0x6c, 0x15, 0x5e, 0xd5, 0xba, 0x72, 0x9e, 0xe2, 0xc8, 0x19, 0xc3, 0xd2, 0x0c, 0xfd, 0xed, 0x60, 0xaa, 0xee, 0xe6, 0xf0, 0xe3, 0xf8,
+          0xdc, 0xd7, 0xe3, 0x4b, 0x53, 0x3e, 0x36, 0x11, 0x84, 0xa2, 0xa4, 0x96, 0x02, 0x28, 0xd6, 0x3e, 0x18, 0x84, 0x35, 0x67, 0x69, 0x9d, 0x69, 0x73,
+          0x09, 0x85, 0x95, 0x2c, 0xc0, 0xe8, 0xf2, 0xab, 0x4c, 0x0e, 0xf3, 0x7c, 0x08, 0x08, 0x51, 0x44, 0x96, 0xe2, 0x4e, 0x93, 0x46, 0xc5, 0xad, 0x11,
+          0x8f, 0x3c, 0x81, 0xc2, 0xae, 0x65, 0xcd, 0xe9, 0xae, 0xc1, 0xa2, 0x26, 0xeb, 0x3a, 0x4c, 0x98, 0xb9, 0xfd, 0x56, 0x73, 0x3a, 0xa5, 0x51, 0x28,
+          0x83, 0x29, 0x10, 0xbc, 0x10, 0x27, 0x0f, 0xa4, 0xbc, 0xc6, 0xde, 0x74, 0x3b, 0x82, 0x91, 0xa7, 0x8b, 0xbe, 0x2e, 0xa9, 0xab, 0xc2, 0x8c, 0x3d,
+          0x32, 0x6c, 0x9f, 0x75, 0xde, 0x61, 0x96, 0xe8, 0x4f, 0x6b, 0x52, 0xab, 0x2b, 0x6c, 0x6a, 0x64, 0x17, 0xc6, 0x90, 0x45, 0x31, 0xd5, 0x95, 0x29,
+          0xab, 0xb1, 0xfe, 0x56, 0x29, 0x0a, 0x8d, 0x8d, 0x7c, 0xc4, 0xd0, 0x4f, 0xcf, 0xba, 0x01, 0x9e, 0x8e, 0xcb, 0x7d, 0x96, 0x1e, 0xd7, 0x1e, 0x1d,
+          0x77, 0x60, 0x50, 0x2a, 0xf1, 0x73, 0x79, 0x2b, 0x29, 0xbc, 0xcc, 0x90, 0xe4, 0x48, 0xe5, 0x38, 0x45, 0xd7, 0xb9, 0x96, 0x14, 0xa8, 0x12, 0x45,
+          0x2d, 0xfa, 0xda, 0xe6, 0x5d, 0x6b, 0x0c, 0xb7, 0x9a, 0xd4, 0x3e, 0xf5, 0x8e, 0x88, 0xde, 0x2a, 0x4b, 0x36, 0x0a, 0x89, 0x3d, 0x69, 0xe9, 0xc9,
+          0xa6, 0x51, 0xef, 0x5a, 0x85, 0x91, 0x91, 0xad, 0xcf, 0xdb, 0x13, 0x05, 0x56, 0x31, 0xf3, 0x5b, 0xeb, 0x4c, 0x51, 0xf7, 0xf7, 0x9a, 0x1b, 0xbf,
+          0x62, 0xbd, 0xaa, 0x44, 0xbe, 0x89, 0x45, 0x89, 0xec, 0x4a, 0x3d, 0x90, 0x9c, 0x2b, 0x4d, 0xaa, 0xc7, 0x23, 0x19, 0xc9, 0x84, 0xb7, 0x71, 0xf8,
+          0xe7, 0x6b, 0x32, 0x7e, 0x75, 0x09, 0xb5, 0xfa, 0x18, 0x82, 0xf3, 0x79, 0x87, 0xa6, 0x6e, 0xc1, 0x75, 0xc2, 0xef, 0x4a, 0xf6, 0x2c, 0xe9, 0x1a,
+          0xf6, 0x62, 0xc5, 0x25, 0xbd, 0x30, 0x13, 0x3a, 0xd3, 0x20, 0xdb, 0xf2, 0x42, 0x17, 0x23, 0xbc, 0x78, 0x34, 0xc1, 0xd2, 0xf5, 0x23, 0xaf, 0x64,
+          0x79, 0xc3, 0x24, 0xa6, 0x74, 0x9d, 0xa9, 0x86, 0x4b, 0x4b, 0xa1, 0xe7, 0x83, 0xad, 0xdd, 0x04, 0xab, 0x9d, 0x7e, 0x21, 0x4d, 0xb4, 0xc8, 0xb1,
+          0x1f, 0xac, 0x09, 0x02, 0x48, 0x81, 0x45, 0x2d, 0xec, 0xc1, 0x41, 0x81, 0xe1, 0x65, 0xdf, 0x86, 0x32, 0xd1, 0x40, 0xd9, 0xbd, 0x2a, 0x5c, 0xd3,
+          0x4d, 0x70, 0x8c, 0x98, 0x35, 0xe7, 0x2d, 0x55, 0x07, 0xf9, 0x1d, 0x5b, 0xd8, 0xad, 0x3e, 0x46, 0x1f, 0x53, 0x71, 0xb1, 0x30, 0xe8, 0x63, 0x43,
+          0x13, 0x52, 0xac, 0x63, 0x0c, 0x69, 0x1b, 0xde, 0xd6, 0x81, 0xbc, 0x0b, 0x67, 0xf5, 0x3a, 0x66, 0xa9, 0x35, 0xb6, 0x57, 0x72, 0x35, 0x55, 0xb3,
+          0xf3, 0x88, 0xe8, 0xca, 0x58, 0x3b, 0xf3, 0x2d, 0x66, 0xf8, 0x9c, 0xc6, 0xfd, 0x93, 0x4d, 0xb7, 0x8b, 0x95, 0x89, 0x7b, 0x43, 0xed, 0x76, 0x36,
+          0xb1, 0xa3, 0xc0, 0x20, 0x7e, 0xab, 0x74, 0x78, 0x38, 0xb1, 0x5b, 0x87, 0xa0, 0xa5, 0x02, 0x29, 0xb7, 0xc3, 0x46, 0xe3, 0x50, 0x8d, 0x2f, 0xca,
+          0xf0, 0xfa, 0xa6, 0x92, 0xd7, 0x00, 0x0b, 0xd8, 0xc6, 0xb6, 0x68, 0x93, 0xd6, 0xda, 0x70, 0x42, 0x94, 0x37, 0xd8, 0x6b, 0xc2, 0x61, 0x2c, 0x78,
+          0xdc, 0x5d, 0xf5, 0xd5, 0x65, 0xa3, 0x5a, 0x61, 0x5c, 0xbe, 0x7a, 0x75, 0xfe, 0x6c, 0x71, 0xd8, 0xda, 0xaa, 0x9d, 0x25, 0x31, 0xba, 0xb4, 0x8b,
+          0xa2, 0x43, 0xc6, 0x61, 0x95, 0xce, 0xf9, 0xd3, 0xa5, 0x63, 0xc7, 0x5c, 0x71, 0x0e, 0xbf, 0x06, 0xf1, 0x56, 0x78, 0x87, 0x6b, 0x50, 0xf9, 0x18,
+          0xef, 0xd6, 0x0b, 0xa5, 0x25, 0x52, 0x02, 0x60, 0x26, 0xfb, 0x24, 0xc5, 0xa6, 0x1e, 0xf8, 0x87, 0xcb, 0x8b, 0xcf, 0x6f, 0x70, 0x84, 0xf7, 0xeb,
+          0xac, 0xe7, 0x85, 0x72, 0xe9, 0x55, 0x6f, 0xca, 0x2f, 0xf5, 0x63, 0x4a, 0x21, 0x0e, 0xaf, 0xac, 0xdb, 0xa1, 0xad, 0x7f, 0x20, 0x66, 0x7b, 0xe2,
+          0x07, 0x01, 0x4d, 0x0e, 0x55, 0x3a, 0x53, 0x03, 0xd6, 0xd8, 0x84, 0xa7, 0xc4, 0xa9, 0x3c, 0x64, 0x5b, 0x56, 0x68, 0xd7, 0x23, 0x6e, 0xeb, 0x10,
+          0x1b, 0x1b, 0x8f, 0xc9, 0xb0, 0xc7, 0xdd, 0x78, 0xec, 0xd4, 0xb2, 0xc8, 0xf6, 0x04, 0xe2, 0xc9, 0x7c, 0xdb, 0xce, 0x8c, 0xac, 0x9b, 0x9c, 0xa3,
+          0x52, 0x07, 0x3e, 0xba, 0xf6, 0x4b, 0x0f, 0xdf, 0x59, 0xeb, 0x5b, 0xd3, 0x9d, 0xbf, 0x21, 0x71, 0x68, 0x10, 0x86, 0xad, 0x35, 0xfe, 0x4c, 0xb7,
+          0x28, 0xb2, 0x8b, 0x76, 0xaf, 0xc8, 0x8f, 0x35, 0x20, 0x00, 0x47, 0xb4, 0xd5, 0x37, 0x3e, 0x2d, 0x69, 0x31, 0x90, 0xe6, 0xa9, 0x4b, 0xb9, 0x1a,
+          0x90, 0x70, 0x45, 0x60, 0xd6, 0xc1, 0x3a, 0xe6, 0x32, 0x3a, 0xc8, 0xd3, 0x1c, 0x97, 0x5e, 0x39, 0x5b, 0x03, 0xe6, 0xff, 0x45, 0xea, 0x23, 0x6e,
+          0x05, 0x1b, 0x19, 0x4f, 0xfe, 0x1b, 0x23, 0xde, 0x3c, 0x75, 0xac, 0x7d, 0x4c, 0xb7, 0xf6, 0xb7, 0x5a, 0x8a, 0x46, 0xde, 0xfd, 0x53, 0xed, 0xc0,
+          0xbc, 0x8e, 0x52, 0xf7, 0x9e, 0x7d, 0xad, 0x07, 0x58, 0x82, 0xca, 0x99, 0xa9, 0xed, 0x6e, 0x97, 0x6a, 0x55, 0xd8, 0x0c, 0x7e, 0x6e, 0x55, 0xfe,
+          0x39, 0x4a, 0x5d, 0xc3, 0xc9, 0x6c, 0x36, 0x8d, 0x9f, 0xd6, 0x6c, 0x2a, 0x1a, 0x4d, 0xe3, 0xa6, 0x46, 0xd3, 0xc9, 0x64, 0x03, 0xbb, 0x6c, 0xd9,
+          0x21, 0x58, 0x51, 0xfd, 0xd6, 0x07, 0x6f, 0xd2, 0x67, 0x07, 0x70, 0x37, 0x4e, 0xcf, 0x0c, 0x4e, 0x08, 0x82, 0xb3, 0x30, 0x47, 0xcb, 0x21, 0x67,
+          0xc5, 0x57, 0x95, 0x42, 0x60, 0xb7, 0x4b, 0x03, 0xd3, 0x26, 0x1c, 0x92, 0x83, 0x71, 0xcb, 0xbb, 0xae, 0x2a, 0xaf, 0xe0, 0x13, 0x3f, 0x95, 0xaa,
+          0xf4, 0x87, 0xe4, 0xc1, 0xa5, 0xfc, 0xa6, 0xb1, 0x01, 0x95, 0xf8, 0xbc, 0xba, 0xf9, 0x6a, 0x1e, 0x2e, 0x60, 0x5e, 0x94, 0xd8, 0x38, 0x26, 0xda,
+          0x2a, 0x6e, 0xf1, 0xfb, 0x9a, 0x93, 0x9b, 0xff, 0x44, 0x89, 0xff, 0xbe, 0x22, 0x7f, 0x90, 0xbf, 0xad, 0xc0, 0xe2, 0x28, 0xa7, 0x97, 0x2b, 0x4d,
+          0xfe, 0x8b, 0x27, 0xa5, 0x39, 0x68, 0x41, 0x15, 0x8d, 0xe2, 0xeb, 0xff, 0x2f, 0xf6, 0xce, 0xde, 0xa7, 0x09, 0x3a, 0x00, 0x00};
     };
 
+    static constexpr std::array<std::string_view, 3> files{"index.html", "favicon.ico", "WebFront.js"};
+    static constexpr std::array<StaticHeaders, 3> headers{StaticHeaders::of<IndexHtml>(files[0]), StaticHeaders::of<WebFrontIco>(files[1]),
+                                                          StaticHeaders::of<WebFrontJs>(files[2])};
+
+    static File fileAt(size_t index) {
+        switch (index) {
+        case 0: return File{IndexHtml{}, headersAt(0)};
+        case 1: return File{WebFrontIco{}, headersAt(1)};
+        default: return File{WebFrontJs{}, headersAt(2)};
+        }
+    }
+
+    static constexpr std::string_view headersAt(size_t index) { return headers[index].view(); }
+
     static std::optional<File> open(std::filesystem::path file) {
-        auto filename = file.relative_path().string();
-        if (filename == "index.html") return File(IndexHtml{});
-        if (filename == "favicon.ico") return File{WebFrontIco{}};
-        if (filename == "WebFront.js") return File{WebFrontJs{}};
-        return {};
+        auto found = std::ranges::find(files, file.relative_path().generic_string());
+        if (found == files.end()) return {};
+        return fileAt(static_cast<size_t>(found - files.begin()));
     }
 };
 
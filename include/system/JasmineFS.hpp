@@ -16,1687 +16,2796 @@ class JasmineFS {
     JasmineFS& operator=(const JasmineFS&) = default;
     JasmineFS& operator=(JasmineFS&&) = default;
 
-    static std::optional<File> open(std::filesystem::path file) {
-        auto filename = file.relative_path().string();
-        if (filename == "jasmine/4.6.0/jasmine_favicon.png") return File(JasmineFavicon{});
-        if (filename == "jasmine/4.6.0/jasmine.css") return File{JasmineCss{}};
-        if (filename == "jasmine/4.6.0/jasmine.js") return File{JasmineJs{}};
-        if (filename == "jasmine/4.6.0/jasmine-html.js") return File{JasmineHtml{}};
-        if (filename == "jasmine/4.6.0/boot0.js") return File{Boot0{}};
-        if (filename == "jasmine/4.6.0/boot1.js") return File{Boot1{}};
-        return {};
-    }
-
     struct Boot0 {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{990};
-        static constexpr std::array<uint64_t, 124> data{
-          0xc1a0540020feb79c, 0xddffe5f4929a307b, 0xf69ac1aa40a475e8, 0xe4b3627eb5774622, 0x848e73bc2d47e9c7,
-          0x27bdaad6f716ba22, 0x2826aab9a8081d9b, 0xc770d569234e6c1e, 0x7773a24a3fae96e3, 0x4a5b5aa9917b5e3c,
-          0x5f7d386fb6ab614f, 0x11d537acae18ce66, 0xd1b76026d0b380d7, 0x4fbce21d8cfdae9b, 0x605cf97565176430,
-          0x226773c5e89968f2, 0xa63490446ddd28fb, 0x654a214c63587108, 0x334ce4d595dad218, 0xf37ad4bafd116aa4,
-          0x8562946a9e99cf92, 0xdd774eeb3c5fe84c, 0xebf8b99c064d4e6b, 0xb289d4f09257c8b1, 0x2cff78c1d844b88c,
-          0x7c0e0927f121eb3b, 0x827734817e15ecc6, 0xa00e5d19c70fecac, 0xeef1324d82fc8b03, 0xbb3a269e76d0c3fc,
-          0x5f377b44d7cb29a4, 0x427ec0134a522418, 0x2c5265223dde8b52, 0x6a7a1935417a9301, 0xeb3dd40cde17011b,
-          0x2bebc95666a42b61, 0xebea6f9db02e59d7, 0xbcaebf2f5bf2fa01, 0xaa8f967cc0861d56, 0xe9cc18c9d4e5851d,
-          0xd070212d223c3602, 0x0385a362ddcaa877, 0xf558236ea0e532c7, 0x25e26a260eab13c6, 0x9de524dffca725bb,
-          0x24951cc9fee5480e, 0x364df36c24219554, 0x3d89356b724e049e, 0x0c3f1a6e9acb432e, 0xa12f5ea1dda3e988,
-          0x1d67762eca877d0a, 0x64e11fc32409f913, 0x5ac587228064b8d9, 0x6ec9b3747593547f, 0xfb013f5dabcbebdd,
-          0x1f14b94e63dfff44, 0x60cb25659111fc6b, 0x89c03d8e5889eaf2, 0x6f7337573dff8061, 0xebdd911c5c599018,
-          0x78dca4aa2051ad52, 0x232c122557b53a19, 0x7429cc15172e2c42, 0x8c0d73a83035f28d, 0xba35567bbf4ee8ec,
-          0xd4661c96eadc2cc9, 0x2945c6c57c4ced47, 0xd307264f63c6aea9, 0x5094e9b5d3ab6bd6, 0xf6843f96deb234a8,
-          0x84f53d849c2a692f, 0x970f0c44971db684, 0xd76aae35858b8cf9, 0x1bfb34fe4bc7644e, 0xffd02454c5688b0e,
-          0xb0dc43158fd2492c, 0x901e9e5af6f7771a, 0x39cf959a220858b6, 0x200290bf0e5491cb, 0xc1986430d9c8a6c4,
-          0xe8535df443781750, 0x974a9d60886585a4, 0xe32746966a9f746f, 0xf685290607bba94d, 0xb9c4f278ac6f752d,
-          0xee22f2c144018059, 0x3806056472e2fcfd, 0x5aa54e0010c198da, 0x6f2e52bff39e9b95, 0x43d233b9697b0a2a,
-          0x29ce08354785efb5, 0xecdd1ec9aa980e37, 0x1df855638c0a6331, 0x390b43091e03e9a5, 0xa73f946a0df242a1,
-          0x440fc86980407037, 0x50795dc0e48205d8, 0xa9d75ec4738f3e58, 0xa88e59099e09ab44, 0x082da20f5e2c73b8,
-          0x15a9bd4882550eb8, 0xbfe9d98f32da2123, 0xe188085c0a588ca3, 0x668cf8bef765586d, 0x5ce94a1119bd0d0b,
-          0xb74704e6276a2dff, 0x9e233616544e5cfd, 0xc400081d4aa5bbdb, 0x95e1b42a79ce18bb, 0x9c191e019e8cad77,
-          0x885ea9bbc9de2d0d, 0xd60b026ba0bb61b2, 0xfa3ca073a90e540f, 0x849bad24494b36f0, 0x82cb13050c248189,
-          0x16e240e7333b18d0, 0x48bda36f85b28591, 0x927d525536ae790f, 0xd9d758591c31f54e, 0x133536d49b661442,
-          0x24967006934e3ae5, 0x828c0f849a686b4f, 0xda177fc1b1d18054, 0x3eeb9fa6b9020000};
+        static constexpr std::string_view etag{"\"e09ae0d0829deabc\""};
+        static constexpr std::array<uint8_t, 990> data{
+          0xc1, 0xa0, 0x54, 0x00, 0x20, 0xfe, 0xb7, 0x9c, 0xdd, 0xff, 0xe5, 0xf4, 0x92, 0x9a, 0x30, 0x7b, 0xf6, 0x9a, 0xc1, 0xaa, 0x40, 0xa4, 0x75, 0xe8,
+          0xe4, 0xb3, 0x62, 0x7e, 0xb5, 0x77, 0x46, 0x22, 0x84, 0x8e, 0x73, 0xbc, 0x2d, 0x47, 0xe9, 0xc7, 0x27, 0xbd, 0xaa, 0xd6, 0xf7, 0x16, 0xba, 0x22,
+          0x28, 0x26, 0xaa, 0xb9, 0xa8, 0x08, 0x1d, 0x9b, 0xc7, 0x70, 0xd5, 0x69, 0x23, 0x4e, 0x6c, 0x1e, 0x77, 0x73, 0xa2, 0x4a, 0x3f, 0xae, 0x96, 0xe3,
+          0x4a, 0x5b, 0x5a, 0xa9, 0x91, 0x7b, 0x5e, 0x3c, 0x5f, 0x7d, 0x38, 0x6f, 0xb6, 0xab, 0x61, 0x4f, 0x11, 0xd5, 0x37, 0xac, 0xae, 0x18, 0xce, 0x66,
+          0xd1, 0xb7, 0x60, 0x26, 0xd0, 0xb3, 0x80, 0xd7, 0x4f, 0xbc, 0xe2, 0x1d, 0x8c, 0xfd, 0xae, 0x9b, 0x60, 0x5c, 0xf9, 0x75, 0x65, 0x17, 0x64, 0x30,
+          0x22, 0x67, 0x73, 0xc5, 0xe8, 0x99, 0x68, 0xf2, 0xa6, 0x34, 0x90, 0x44, 0x6d, 0xdd, 0x28, 0xfb, 0x65, 0x4a, 0x21, 0x4c, 0x63, 0x58, 0x71, 0x08,
+          0x33, 0x4c, 0xe4, 0xd5, 0x95, 0xda, 0xd2, 0x18, 0xf3, 0x7a, 0xd4, 0xba, 0xfd, 0x11, 0x6a, 0xa4, 0x85, 0x62, 0x94, 0x6a, 0x9e, 0x99, 0xcf, 0x92,
+          0xdd, 0x77, 0x4e, 0xeb, 0x3c, 0x5f, 0xe8, 0x4c, 0xeb, 0xf8, 0xb9, 0x9c, 0x06, 0x4d, 0x4e, 0x6b, 0xb2, 0x89, 0xd4, 0xf0, 0x92, 0x57, 0xc8, 0xb1,
+          0x2c, 0xff, 0x78, 0xc1, 0xd8, 0x44, 0xb8, 0x8c, 0x7c, 0x0e, 0x09, 0x27, 0xf1, 0x21, 0xeb, 0x3b, 0x82, 0x77, 0x34, 0x81, 0x7e, 0x15, 0xec, 0xc6,
+          0xa0, 0x0e, 0x5d, 0x19, 0xc7, 0x0f, 0xec, 0xac, 0xee, 0xf1, 0x32, 0x4d, 0x82, 0xfc, 0x8b, 0x03, 0xbb, 0x3a, 0x26, 0x9e, 0x76, 0xd0, 0xc3, 0xfc,
+          0x5f, 0x37, 0x7b, 0x44, 0xd7, 0xcb, 0x29, 0xa4, 0x42, 0x7e, 0xc0, 0x13, 0x4a, 0x52, 0x24, 0x18, 0x2c, 0x52, 0x65, 0x22, 0x3d, 0xde, 0x8b, 0x52,
+          0x6a, 0x7a, 0x19, 0x35, 0x41, 0x7a, 0x93, 0x01, 0xeb, 0x3d, 0xd4, 0x0c, 0xde, 0x17, 0x01, 0x1b, 0x2b, 0xeb, 0xc9, 0x56, 0x66, 0xa4, 0x2b, 0x61,
+          0xeb, 0xea, 0x6f, 0x9d, 0xb0, 0x2e, 0x59, 0xd7, 0xbc, 0xae, 0xbf, 0x2f, 0x5b, 0xf2, 0xfa, 0x01, 0xaa, 0x8f, 0x96, 0x7c, 0xc0, 0x86, 0x1d, 0x56,
+          0xe9, 0xcc, 0x18, 0xc9, 0xd4, 0xe5, 0x85, 0x1d, 0xd0, 0x70, 0x21, 0x2d, 0x22, 0x3c, 0x36, 0x02, 0x03, 0x85, 0xa3, 0x62, 0xdd, 0xca, 0xa8, 0x77,
+          0xf5, 0x58, 0x23, 0x6e, 0xa0, 0xe5, 0x32, 0xc7, 0x25, 0xe2, 0x6a, 0x26, 0x0e, 0xab, 0x13, 0xc6, 0x9d, 0xe5, 0x24, 0xdf, 0xfc, 0xa7, 0x25, 0xbb,
+          0x24, 0x95, 0x1c, 0xc9, 0xfe, 0xe5, 0x48, 0x0e, 0x36, 0x4d, 0xf3, 0x6c, 0x24, 0x21, 0x95, 0x54, 0x3d, 0x89, 0x35, 0x6b, 0x72, 0x4e, 0x04, 0x9e,
+          0x0c, 0x3f, 0x1a, 0x6e, 0x9a, 0xcb, 0x43, 0x2e, 0xa1, 0x2f, 0x5e, 0xa1, 0xdd, 0xa3, 0xe9, 0x88, 0x1d, 0x67, 0x76, 0x2e, 0xca, 0x87, 0x7d, 0x0a,
+          0x64, 0xe1, 0x1f, 0xc3, 0x24, 0x09, 0xf9, 0x13, 0x5a, 0xc5, 0x87, 0x22, 0x80, 0x64, 0xb8, 0xd9, 0x6e, 0xc9, 0xb3, 0x74, 0x75, 0x93, 0x54, 0x7f,
+          0xfb, 0x01, 0x3f, 0x5d, 0xab, 0xcb, 0xeb, 0xdd, 0x1f, 0x14, 0xb9, 0x4e, 0x63, 0xdf, 0xff, 0x44, 0x60, 0xcb, 0x25, 0x65, 0x91, 0x11, 0xfc, 0x6b,
+          0x89, 0xc0, 0x3d, 0x8e, 0x58, 0x89, 0xea, 0xf2, 0x6f, 0x73, 0x37, 0x57, 0x3d, 0xff, 0x80, 0x61, 0xeb, 0xdd, 0x91, 0x1c, 0x5c, 0x59, 0x90, 0x18,
+          0x78, 0xdc, 0xa4, 0xaa, 0x20, 0x51, 0xad, 0x52, 0x23, 0x2c, 0x12, 0x25, 0x57, 0xb5, 0x3a, 0x19, 0x74, 0x29, 0xcc, 0x15, 0x17, 0x2e, 0x2c, 0x42,
+          0x8c, 0x0d, 0x73, 0xa8, 0x30, 0x35, 0xf2, 0x8d, 0xba, 0x35, 0x56, 0x7b, 0xbf, 0x4e, 0xe8, 0xec, 0xd4, 0x66, 0x1c, 0x96, 0xea, 0xdc, 0x2c, 0xc9,
+          0x29, 0x45, 0xc6, 0xc5, 0x7c, 0x4c, 0xed, 0x47, 0xd3, 0x07, 0x26, 0x4f, 0x63, 0xc6, 0xae, 0xa9, 0x50, 0x94, 0xe9, 0xb5, 0xd3, 0xab, 0x6b, 0xd6,
+          0xf6, 0x84, 0x3f, 0x96, 0xde, 0xb2, 0x34, 0xa8, 0x84, 0xf5, 0x3d, 0x84, 0x9c, 0x2a, 0x69, 0x2f, 0x97, 0x0f, 0x0c, 0x44, 0x97, 0x1d, 0xb6, 0x84,
+          0xd7, 0x6a, 0xae, 0x35, 0x85, 0x8b, 0x8c, 0xf9, 0x1b, 0xfb, 0x34, 0xfe, 0x4b, 0xc7, 0x64, 0x4e, 0xff, 0xd0, 0x24, 0x54, 0xc5, 0x68, 0x8b, 0x0e,
+          0xb0, 0xdc, 0x43, 0x15, 0x8f, 0xd2, 0x49, 0x2c, 0x90, 0x1e, 0x9e, 0x5a, 0xf6, 0xf7, 0x77, 0x1a, 0x39, 0xcf, 0x95, 0x9a, 0x22, 0x08, 0x58, 0xb6,
+          0x20, 0x02, 0x90, 0xbf, 0x0e, 0x54, 0x91, 0xcb, 0xc1, 0x98, 0x64, 0x30, 0xd9, 0xc8, 0xa6, 0xc4, 0xe8, 0x53, 0x5d, 0xf4, 0x43, 0x78, 0x17, 0x50,
+          0x97, 0x4a, 0x9d, 0x60, 0x88, 0x65, 0x85, 0xa4, 0xe3, 0x27, 0x46, 0x96, 0x6a, 0x9f, 0x74, 0x6f, 0xf6, 0x85, 0x29, 0x06, 0x07, 0xbb, 0xa9, 0x4d,
+          0xb9, 0xc4, 0xf2, 0x78, 0xac, 0x6f, 0x75, 0x2d, 0xee, 0x22, 0xf2, 0xc1, 0x44, 0x01, 0x80, 0x59, 0x38, 0x06, 0x05, 0x64, 0x72, 0xe2, 0xfc, 0xfd,
+          0x5a, 0xa5, 0x4e, 0x00, 0x10, 0xc1, 0x98, 0xda, 0x6f, 0x2e, 0x52, 0xbf, 0xf3, 0x9e, 0x9b, 0x95, 0x43, 0xd2, 0x33, 0xb9, 0x69, 0x7b, 0x0a, 0x2a,
+          0x29, 0xce, 0x08, 0x35, 0x47, 0x85, 0xef, 0xb5, 0xec, 0xdd, 0x1e, 0xc9, 0xaa, 0x98, 0x0e, 0x37, 0x1d, 0xf8, 0x55, 0x63, 0x8c, 0x0a, 0x63, 0x31,
+          0x39, 0x0b, 0x43, 0x09, 0x1e, 0x03, 0xe9, 0xa5, 0xa7, 0x3f, 0x94, 0x6a, 0x0d, 0xf2, 0x42, 0xa1, 0x44, 0x0f, 0xc8, 0x69, 0x80, 0x40, 0x70, 0x37,
+          0x50, 0x79, 0x5d, 0xc0, 0xe4, 0x82, 0x05, 0xd8, 0xa9, 0xd7, 0x5e, 0xc4, 0x73, 0x8f, 0x3e, 0x58, 0xa8, 0x8e, 0x59, 0x09, 0x9e, 0x09, 0xab, 0x44,
+          0x08, 0x2d, 0xa2, 0x0f, 0x5e, 0x2c, 0x73, 0xb8, 0x15, 0xa9, 0xbd, 0x48, 0x82, 0x55, 0x0e, 0xb8, 0xbf, 0xe9, 0xd9, 0x8f, 0x32, 0xda, 0x21, 0x23,
+          0xe1, 0x88, 0x08, 0x5c, 0x0a, 0x58, 0x8c, 0xa3, 0x66, 0x8c, 0xf8, 0xbe, 0xf7, 0x65, 0x58, 0x6d, 0x5c, 0xe9, 0x4a, 0x11, 0x19, 0xbd, 0x0d, 0x0b,
+          0xb7, 0x47, 0x04, 0xe6, 0x27, 0x6a, 0x2d, 0xff, 0x9e, 0x23, 0x36, 0x16, 0x54, 0x4e, 0x5c, 0xfd, 0xc4, 0x00, 0x08, 0x1d, 0x4a, 0xa5, 0xbb, 0xdb,
+          0x95, 0xe1, 0xb4, 0x2a, 0x79, 0xce, 0x18, 0xbb, 0x9c, 0x19, 0x1e, 0x01, 0x9e, 0x8c, 0xad, 0x77, 0x88, 0x5e, 0xa9, 0xbb, 0xc9, 0xde, 0x2d, 0x0d,
+          0xd6, 0x0b, 0x02, 0x6b, 0xa0, 0xbb, 0x61, 0xb2, 0xfa, 0x3c, 0xa0, 0x73, 0xa9, 0x0e, 0x54, 0x0f, 0x84, 0x9b, 0xad, 0x24, 0x49, 0x4b, 0x36, 0xf0,
+          0x82, 0xcb, 0x13, 0x05, 0x0c, 0x24, 0x81, 0x89, 0x16, 0xe2, 0x40, 0xe7, 0x33, 0x3b, 0x18, 0xd0, 0x48, 0xbd, 0xa3, 0x6f, 0x85, 0xb2, 0x85, 0x91,
+          0x92, 0x7d, 0x52, 0x55, 0x36, 0xae, 0x79, 0x0f, 0xd9, 0xd7, 0x58, 0x59, 0x1c, 0x31, 0xf5, 0x4e, 0x13, 0x35, 0x36, 0xd4, 0x9b, 0x66, 0x14, 0x42,
+          0x24, 0x96, 0x70, 0x06, 0x93, 0x4e, 0x3a, 0xe5, 0x82, 0x8c, 0x0f, 0x84, 0x9a, 0x68, 0x6b, 0x4f, 0xda, 0x17, 0x7f, 0xc1, 0xb1, 0xd1, 0x80, 0x54,
+          0x3e, 0xeb, 0x9f, 0xa6, 0xb9, 0x02};
     };
 
     struct Boot1 {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{1475};
-        static constexpr std::array<uint64_t, 185> data{
-          0xd1888d00e0288c1b, 0x9f032bb2587ce650, 0x8a73a578d40a202a, 0x2f753a3d46353377, 0x179ee4632779ca03,
-          0x4cccffa6eafe97e9, 0xa5023a19652eaddc, 0x0e323f364e023e7d, 0x5c9a5fed570648c6, 0x181446eeeb7ed357,
-          0xf3ffee01830cf6cc, 0xd2bf20392a7f1545, 0x0ed89a1c63aefa39, 0xf50620e3985e582f, 0xbdf2e782ee1b04a6,
-          0xd84b3d0ffe719a8b, 0xffdb1bf64344e50d, 0x1351c076b85d4ccc, 0x045a16e8fe13dd65, 0xd72f176513ea578e,
-          0x8c69401e3d7266a2, 0xa065a24b9b524b8a, 0xb4d5a3b12e306dd7, 0xe0b6618411266aeb, 0x83b415b658ae456d,
-          0xb63d42835e7d370c, 0x21a17a962c4c846b, 0x9d2fc248ebf8bb60, 0xab315a7b6cade2a5, 0xb6e29c70f78f077c,
-          0x0a4deec4670b3889, 0x09156e1525d300fa, 0x75a81b8332f4a038, 0xbea9b3ba20430e4f, 0x47850cc975034f67,
-          0xbc87bb5c378bf470, 0x08294b0f7440496c, 0x04274472b5881eaf, 0x6b99aa5eaade4ad5, 0x2e1398f39a667c4e,
-          0xb071503dd9cf19e9, 0xf8d05a3632ea9975, 0xad417d3d957d1006, 0xe5c1013bacbb668c, 0x0c47ded8019d16d2,
-          0x9cc2633761a0604a, 0x72e33eebb921da40, 0xf336c7c5e96a160d, 0xab13c59d7925dffc, 0x87f211bed169e95c,
-          0x074d73f381e0dbac, 0x7a8a6ad6c28e139e, 0x0c333a6d9a8b574b, 0xe89e7a58b891ef41, 0x1d67dcc162729c02,
-          0x75f28ff12893fc09, 0x509a9013900c9e43, 0xca6be9ea8c841d7e, 0xc037bedfb28ffe20, 0xe7751ac7fd8f13b6,
-          0x5c0421a7f97314e7, 0x3e84ad02302c9bdd, 0x358962be662f3b57, 0x2145b8f6a6355e4d, 0x252c849dd08d6942,
-          0xa012c2ab621a283c, 0x7a49945c474d270a, 0xd920e81574f3d230, 0x48e186c7d0039f9a, 0x63f32d9679dff0aa,
-          0x6f7d5c0832e6be58, 0x03ba248f9444668a, 0xceb8371fd89138b4, 0x93c21ab115099654, 0x580a4af0f0429e4b,
-          0x467c4712ecce4d7a, 0x0b4f2fa7856e7b43, 0x84db69091d471276, 0x33fc794bd507cb0c, 0x223621210aeb9c24,
-          0xb913c135e9bc9d1a, 0x2292018c6f234c13, 0x1138215985e0c72c, 0x07a20b6d454eae70, 0xf058c347222a1666,
-          0xf935f6702d52f890, 0x1be1fdc20eb8dca4, 0xa93696ec97e895b5, 0x76631ca79f8a8291, 0x78b911cc2a0ee403,
-          0x2c5535fab1c44c3e, 0x20c5a4afc3496640, 0x2eaf8047fd3fa0c2, 0xce4e9f9394b8db61, 0x3fd6120425e3cc1d,
-          0x9b4806b978b80775, 0xfd457dd812da8358, 0x6f8dc992b16b31a6, 0xfcf5a684c0e90927, 0xc98c1a0ad2bb0dfa,
-          0x7b72a46143655c7c, 0x3d50b608b6ad7cac, 0x8dda452238eb8080, 0x4142c9480702c7aa, 0xb65caa5f1c412c6e,
-          0x84eea566041512ae, 0x7c8db92f0f6f6d19, 0x09ce2d2e3aa095b3, 0x55152afdd4304e18, 0x436c1a784b943810,
-          0xe2531cf69a079e55, 0xa6a682a7f9b77433, 0xff5353eb3608d2ca, 0x77add00b05483e90, 0xc1426be9960c99c0,
-          0x0d28e362fe414b7e, 0xeee6045f41e85690, 0x598933bb7572d2d0, 0x04a2b45f37a2ae8d, 0xa72aa9063e048c47,
-          0xc6700fef27cce109, 0x00f8d0072cc9d127, 0x05fc69b49360a472, 0x6b083e116245747d, 0x03c2bac2b56371ed,
-          0xdd90f31ddc1e32bc, 0xcfc78cb4a9682bcb, 0x17632a02b9197291, 0xba3d8f8a49937325, 0x64247e777dd9c10f,
-          0x6b0af47dc10b25ee, 0x75818e3fcfc30b13, 0xbaeca13a347cee2e, 0xb117df17384d0fff, 0x50dfe2f6a213b9f5,
-          0xfde42bcfdcd887b7, 0xa95f5eeca93513f2, 0xd2add3945282cf60, 0xa96c777c08dfb9fb, 0x860ffe1d668dec80,
-          0xfedbde272316eb26, 0xd0729c92696e9452, 0xc9b45d6aff31c512, 0x8d695c89876567ee, 0x6458a15f03faac74,
-          0xe8d1d03af23e51e2, 0xbf7324be267e2f2e, 0x755c92c49b870e17, 0x307e65c072c16877, 0x2417e3f8a8d20333,
-          0xa7a5786feeac1daf, 0x9c0b3fc82b5e8703, 0x19c592fd0349a544, 0x12e47a7e58c800ad, 0x55eb43f0fba9c99e,
-          0x648ea0925094b39b, 0xb62d97822d588363, 0x184d7493647cc910, 0x53c04baa13e04725, 0x40a70500d1512a9d,
-          0x67d624351ba80144, 0xde4d8274e30b809f, 0xdc360c47adfa9736, 0x12bd34ddb4b83435, 0x8d91c71ab2084f0e,
-          0x98b358222f60864e, 0x3bb8ecd3d13c21a9, 0xe15670b295fe9797, 0x764c29142fe5f816, 0x2a7ce36ca44d095c,
-          0x214be9f6dbbc148b, 0x92f10ddc5011316d, 0x3dc6ee5e2a4f25ee, 0x5078e92eb8d51d4a, 0x5a110a6e8c417389,
-          0xdf8451afa74ce3c2, 0x18f5e8b1b4e88b12, 0xa633a49acecbea59, 0x4fc3b212159bb49f, 0x891509aab3c07d6d,
-          0x29a1b21e4693d466, 0x0403c89380a7aaf6, 0x4187912039a59708, 0x0837e0358a257889, 0xdc18900000000000};
+        static constexpr std::string_view etag{"\"4d752ec43ad82943\""};
+        static constexpr std::array<uint8_t, 1475> data{
+          0xd1, 0x88, 0x8d, 0x00, 0xe0, 0x28, 0x8c, 0x1b, 0x9f, 0x03, 0x2b, 0xb2, 0x58, 0x7c, 0xe6, 0x50, 0x8a, 0x73, 0xa5, 0x78, 0xd4, 0x0a, 0x20, 0x2a,
+          0x2f, 0x75, 0x3a, 0x3d, 0x46, 0x35, 0x33, 0x77, 0x17, 0x9e, 0xe4, 0x63, 0x27, 0x79, 0xca, 0x03, 0x4c, 0xcc, 0xff, 0xa6, 0xea, 0xfe, 0x97, 0xe9,
+          0xa5, 0x02, 0x3a, 0x19, 0x65, 0x2e, 0xad, 0xdc, 0x0e, 0x32, 0x3f, 0x36, 0x4e, 0x02, 0x3e, 0x7d, 0x5c, 0x9a, 0x5f, 0xed, 0x57, 0x06, 0x48, 0xc6,
+          0x18, 0x14, 0x46, 0xee, 0xeb, 0x7e, 0xd3, 0x57, 0xf3, 0xff, 0xee, 0x01, 0x83, 0x0c, 0xf6, 0xcc, 0xd2, 0xbf, 0x20, 0x39, 0x2a, 0x7f, 0x15, 0x45,
+          0x0e, 0xd8, 0x9a, 0x1c, 0x63, 0xae, 0xfa, 0x39, 0xf5, 0x06, 0x20, 0xe3, 0x98, 0x5e, 0x58, 0x2f, 0xbd, 0xf2, 0xe7, 0x82, 0xee, 0x1b, 0x04, 0xa6,
+          0xd8, 0x4b, 0x3d, 0x0f, 0xfe, 0x71, 0x9a, 0x8b, 0xff, 0xdb, 0x1b, 0xf6, 0x43, 0x44, 0xe5, 0x0d, 0x13, 0x51, 0xc0, 0x76, 0xb8, 0x5d, 0x4c, 0xcc,
+          0x04, 0x5a, 0x16, 0xe8, 0xfe, 0x13, 0xdd, 0x65, 0xd7, 0x2f, 0x17, 0x65, 0x13, 0xea, 0x57, 0x8e, 0x8c, 0x69, 0x40, 0x1e, 0x3d, 0x72, 0x66, 0xa2,
+          0xa0, 0x65, 0xa2, 0x4b, 0x9b, 0x52, 0x4b, 0x8a, 0xb4, 0xd5, 0xa3, 0xb1, 0x2e, 0x30, 0x6d, 0xd7, 0xe0, 0xb6, 0x61, 0x84, 0x11, 0x26, 0x6a, 0xeb,
+          0x83, 0xb4, 0x15, 0xb6, 0x58, 0xae, 0x45, 0x6d, 0xb6, 0x3d, 0x42, 0x83, 0x5e, 0x7d, 0x37, 0x0c, 0x21, 0xa1, 0x7a, 0x96, 0x2c, 0x4c, 0x84, 0x6b,
+          0x9d, 0x2f, 0xc2, 0x48, 0xeb, 0xf8, 0xbb, 0x60, 0xab, 0x31, 0x5a, 0x7b, 0x6c, 0xad, 0xe2, 0xa5, 0xb6, 0xe2, 0x9c, 0x70, 0xf7, 0x8f, 0x07, 0x7c,
+          0x0a, 0x4d, 0xee, 0xc4, 0x67, 0x0b, 0x38, 0x89, 0x09, 0x15, 0x6e, 0x15, 0x25, 0xd3, 0x00, 0xfa, 0x75, 0xa8, 0x1b, 0x83, 0x32, 0xf4, 0xa0, 0x38,
+          0xbe, 0xa9, 0xb3, 0xba, 0x20, 0x43, 0x0e, 0x4f, 0x47, 0x85, 0x0c, 0xc9, 0x75, 0x03, 0x4f, 0x67, 0xbc, 0x87, 0xbb, 0x5c, 0x37, 0x8b, 0xf4, 0x70,
+          0x08, 0x29, 0x4b, 0x0f, 0x74, 0x40, 0x49, 0x6c, 0x04, 0x27, 0x44, 0x72, 0xb5, 0x88, 0x1e, 0xaf, 0x6b, 0x99, 0xaa, 0x5e, 0xaa, 0xde, 0x4a, 0xd5,
+          0x2e, 0x13, 0x98, 0xf3, 0x9a, 0x66, 0x7c, 0x4e, 0xb0, 0x71, 0x50, 0x3d, 0xd9, 0xcf, 0x19, 0xe9, 0xf8, 0xd0, 0x5a, 0x36, 0x32, 0xea, 0x99, 0x75,
+          0xad, 0x41, 0x7d, 0x3d, 0x95, 0x7d, 0x10, 0x06, 0xe5, 0xc1, 0x01, 0x3b, 0xac, 0xbb, 0x66, 0x8c, 0x0c, 0x47, 0xde, 0xd8, 0x01, 0x9d, 0x16, 0xd2,
+          0x9c, 0xc2, 0x63, 0x37, 0x61, 0xa0, 0x60, 0x4a, 0x72, 0xe3, 0x3e, 0xeb, 0xb9, 0x21, 0xda, 0x40, 0xf3, 0x36, 0xc7, 0xc5, 0xe9, 0x6a, 0x16, 0x0d,
+          0xab, 0x13, 0xc5, 0x9d, 0x79, 0x25, 0xdf, 0xfc, 0x87, 0xf2, 0x11, 0xbe, 0xd1, 0x69, 0xe9, 0x5c, 0x07, 0x4d, 0x73, 0xf3, 0x81, 0xe0, 0xdb, 0xac,
+          0x7a, 0x8a, 0x6a, 0xd6, 0xc2, 0x8e, 0x13, 0x9e, 0x0c, 0x33, 0x3a, 0x6d, 0x9a, 0x8b, 0x57, 0x4b, 0xe8, 0x9e, 0x7a, 0x58, 0xb8, 0x91, 0xef, 0x41,
+          0x1d, 0x67, 0xdc, 0xc1, 0x62, 0x72, 0x9c, 0x02, 0x75, 0xf2, 0x8f, 0xf1, 0x28, 0x93, 0xfc, 0x09, 0x50, 0x9a, 0x90, 0x13, 0x90, 0x0c, 0x9e, 0x43,
+          0xca, 0x6b, 0xe9, 0xea, 0x8c, 0x84, 0x1d, 0x7e, 0xc0, 0x37, 0xbe, 0xdf, 0xb2, 0x8f, 0xfe, 0x20, 0xe7, 0x75, 0x1a, 0xc7, 0xfd, 0x8f, 0x13, 0xb6,
+          0x5c, 0x04, 0x21, 0xa7, 0xf9, 0x73, 0x14, 0xe7, 0x3e, 0x84, 0xad, 0x02, 0x30, 0x2c, 0x9b, 0xdd, 0x35, 0x89, 0x62, 0xbe, 0x66, 0x2f, 0x3b, 0x57,
+          0x21, 0x45, 0xb8, 0xf6, 0xa6, 0x35, 0x5e, 0x4d, 0x25, 0x2c, 0x84, 0x9d, 0xd0, 0x8d, 0x69, 0x42, 0xa0, 0x12, 0xc2, 0xab, 0x62, 0x1a, 0x28, 0x3c,
+          0x7a, 0x49, 0x94, 0x5c, 0x47, 0x4d, 0x27, 0x0a, 0xd9, 0x20, 0xe8, 0x15, 0x74, 0xf3, 0xd2, 0x30, 0x48, 0xe1, 0x86, 0xc7, 0xd0, 0x03, 0x9f, 0x9a,
+          0x63, 0xf3, 0x2d, 0x96, 0x79, 0xdf, 0xf0, 0xaa, 0x6f, 0x7d, 0x5c, 0x08, 0x32, 0xe6, 0xbe, 0x58, 0x03, 0xba, 0x24, 0x8f, 0x94, 0x44, 0x66, 0x8a,
+          0xce, 0xb8, 0x37, 0x1f, 0xd8, 0x91, 0x38, 0xb4, 0x93, 0xc2, 0x1a, 0xb1, 0x15, 0x09, 0x96, 0x54, 0x58, 0x0a, 0x4a, 0xf0, 0xf0, 0x42, 0x9e, 0x4b,
+          0x46, 0x7c, 0x47, 0x12, 0xec, 0xce, 0x4d, 0x7a, 0x0b, 0x4f, 0x2f, 0xa7, 0x85, 0x6e, 0x7b, 0x43, 0x84, 0xdb, 0x69, 0x09, 0x1d, 0x47, 0x12, 0x76,
+          0x33, 0xfc, 0x79, 0x4b, 0xd5, 0x07, 0xcb, 0x0c, 0x22, 0x36, 0x21, 0x21, 0x0a, 0xeb, 0x9c, 0x24, 0xb9, 0x13, 0xc1, 0x35, 0xe9, 0xbc, 0x9d, 0x1a,
+          0x22, 0x92, 0x01, 0x8c, 0x6f, 0x23, 0x4c, 0x13, 0x11, 0x38, 0x21, 0x59, 0x85, 0xe0, 0xc7, 0x2c, 0x07, 0xa2, 0x0b, 0x6d, 0x45, 0x4e, 0xae, 0x70,
+          0xf0, 0x58, 0xc3, 0x47, 0x22, 0x2a, 0x16, 0x66, 0xf9, 0x35, 0xf6, 0x70, 0x2d, 0x52, 0xf8, 0x90, 0x1b, 0xe1, 0xfd, 0xc2, 0x0e, 0xb8, 0xdc, 0xa4,
+          0xa9, 0x36, 0x96, 0xec, 0x97, 0xe8, 0x95, 0xb5, 0x76, 0x63, 0x1c, 0xa7, 0x9f, 0x8a, 0x82, 0x91, 0x78, 0xb9, 0x11, 0xcc, 0x2a, 0x0e, 0xe4, 0x03,
+          0x2c, 0x55, 0x35, 0xfa, 0xb1, 0xc4, 0x4c, 0x3e, 0x20, 0xc5, 0xa4, 0xaf, 0xc3, 0x49, 0x66, 0x40, 0x2e, 0xaf, 0x80, 0x47, 0xfd, 0x3f, 0xa0, 0xc2,
+          0xce, 0x4e, 0x9f, 0x93, 0x94, 0xb8, 0xdb, 0x61, 0x3f, 0xd6, 0x12, 0x04, 0x25, 0xe3, 0xcc, 0x1d, 0x9b, 0x48, 0x06, 0xb9, 0x78, 0xb8, 0x07, 0x75,
+          0xfd, 0x45, 0x7d, 0xd8, 0x12, 0xda, 0x83, 0x58, 0x6f, 0x8d, 0xc9, 0x92, 0xb1, 0x6b, 0x31, 0xa6, 0xfc, 0xf5, 0xa6, 0x84, 0xc0, 0xe9, 0x09, 0x27,
+          0xc9, 0x8c, 0x1a, 0x0a, 0xd2, 0xbb, 0x0d, 0xfa, 0x7b, 0x72, 0xa4, 0x61, 0x43, 0x65, 0x5c, 0x7c, 0x3d, 0x50, 0xb6, 0x08, 0xb6, 0xad, 0x7c, 0xac,
+          0x8d, 0xda, 0x45, 0x22, 0x38, 0xeb, 0x80, 0x80, 0x41, 0x42, 0xc9, 0x48, 0x07, 0x02, 0xc7, 0xaa, 0xb6, 0x5c, 0xaa, 0x5f, 0x1c, 0x41, 0x2c, 0x6e,
+          0x84, 0xee, 0xa5, 0x66, 0x04, 0x15, 0x12, 0xae, 0x7c, 0x8d, 0xb9, 0x2f, 0x0f, 0x6f, 0x6d, 0x19, 0x09, 0xce, 0x2d, 0x2e, 0x3a, 0xa0, 0x95, 0xb3,
+          0x55, 0x15, 0x2a, 0xfd, 0xd4, 0x30, 0x4e, 0x18, 0x43, 0x6c, 0x1a, 0x78, 0x4b, 0x94, 0x38, 0x10, 0xe2, 0x53, 0x1c, 0xf6, 0x9a, 0x07, 0x9e, 0x55,
+          0xa6, 0xa6, 0x82, 0xa7, 0xf9, 0xb7, 0x74, 0x33, 0xff, 0x53, 0x53, 0xeb, 0x36, 0x08, 0xd2, 0xca, 0x77, 0xad, 0xd0, 0x0b, 0x05, 0x48, 0x3e, 0x90,
+          0xc1, 0x42, 0x6b, 0xe9, 0x96, 0x0c, 0x99, 0xc0, 0x0d, 0x28, 0xe3, 0x62, 0xfe, 0x41, 0x4b, 0x7e, 0xee, 0xe6, 0x04, 0x5f, 0x41, 0xe8, 0x56, 0x90,
+          0x59, 0x89, 0x33, 0xbb, 0x75, 0x72, 0xd2, 0xd0, 0x04, 0xa2, 0xb4, 0x5f, 0x37, 0xa2, 0xae, 0x8d, 0xa7, 0x2a, 0xa9, 0x06, 0x3e, 0x04, 0x8c, 0x47,
+          0xc6, 0x70, 0x0f, 0xef, 0x27, 0xcc, 0xe1, 0x09, 0x00, 0xf8, 0xd0, 0x07, 0x2c, 0xc9, 0xd1, 0x27, 0x05, 0xfc, 0x69, 0xb4, 0x93, 0x60, 0xa4, 0x72,
+          0x6b, 0x08, 0x3e, 0x11, 0x62, 0x45, 0x74, 0x7d, 0x03, 0xc2, 0xba, 0xc2, 0xb5, 0x63, 0x71, 0xed, 0xdd, 0x90, 0xf3, 0x1d, 0xdc, 0x1e, 0x32, 0xbc,
+          0xcf, 0xc7, 0x8c, 0xb4, 0xa9, 0x68, 0x2b, 0xcb, 0x17, 0x63, 0x2a, 0x02, 0xb9, 0x19, 0x72, 0x91, 0xba, 0x3d, 0x8f, 0x8a, 0x49, 0x93, 0x73, 0x25,
+          0x64, 0x24, 0x7e, 0x77, 0x7d, 0xd9, 0xc1, 0x0f, 0x6b, 0x0a, 0xf4, 0x7d, 0xc1, 0x0b, 0x25, 0xee, 0x75, 0x81, 0x8e, 0x3f, 0xcf, 0xc3, 0x0b, 0x13,
+          0xba, 0xec, 0xa1, 0x3a, 0x34, 0x7c, 0xee, 0x2e, 0xb1, 0x17, 0xdf, 0x17, 0x38, 0x4d, 0x0f, 0xff, 0x50, 0xdf, 0xe2, 0xf6, 0xa2, 0x13, 0xb9, 0xf5,
+          0xfd, 0xe4, 0x2b, 0xcf, 0xdc, 0xd8, 0x87, 0xb7, 0xa9, 0x5f, 0x5e, 0xec, 0xa9, 0x35, 0x13, 0xf2, 0xd2, 0xad, 0xd3, 0x94, 0x52, 0x82, 0xcf, 0x60,
+          0xa9, 0x6c, 0x77, 0x7c, 0x08, 0xdf, 0xb9, 0xfb, 0x86, 0x0f, 0xfe, 0x1d, 0x66, 0x8d, 0xec, 0x80, 0xfe, 0xdb, 0xde, 0x27, 0x23, 0x16, 0xeb, 0x26,
+          0xd0, 0x72, 0x9c, 0x92, 0x69, 0x6e, 0x94, 0x52, 0xc9, 0xb4, 0x5d, 0x6a, 0xff, 0x31, 0xc5, 0x12, 0x8d, 0x69, 0x5c, 0x89, 0x87, 0x65, 0x67, 0xee,
+          0x64, 0x58, 0xa1, 0x5f, 0x03, 0xfa, 0xac, 0x74, 0xe8, 0xd1, 0xd0, 0x3a, 0xf2, 0x3e, 0x51, 0xe2, 0xbf, 0x73, 0x24, 0xbe, 0x26, 0x7e, 0x2f, 0x2e,
+          0x75, 0x5c, 0x92, 0xc4, 0x9b, 0x87, 0x0e, 0x17, 0x30, 0x7e, 0x65, 0xc0, 0x72, 0xc1, 0x68, 0x77, 0x24, 0x17, 0xe3, 0xf8, 0xa8, 0xd2, 0x03, 0x33,
+          0xa7, 0xa5, 0x78, 0x6f, 0xee, 0xac, 0x1d, 0xaf, 0x9c, 0x0b, 0x3f, 0xc8, 0x2b, 0x5e, 0x87, 0x03, 0x19, 0xc5, 0x92, 0xfd, 0x03, 0x49, 0xa5, 0x44,
+          0x12, 0xe4, 0x7a, 0x7e, 0x58, 0xc8, 0x00, 0xad, 0x55, 0xeb, 0x43, 0xf0, 0xfb, 0xa9, 0xc9, 0x9e, 0x64, 0x8e, 0xa0, 0x92, 0x50, 0x94, 0xb3, 0x9b,
+          0xb6, 0x2d, 0x97, 0x82, 0x2d, 0x58, 0x83, 0x63, 0x18, 0x4d, 0x74, 0x93, 0x64, 0x7c, 0xc9, 0x10, 0x53, 0xc0, 0x4b, 0xaa, 0x13, 0xe0, 0x47, 0x25,
+          0x40, 0xa7, 0x05, 0x00, 0xd1, 0x51, 0x2a, 0x9d, 0x67, 0xd6, 0x24, 0x35, 0x1b, 0xa8, 0x01, 0x44, 0xde, 0x4d, 0x82, 0x74, 0xe3, 0x0b, 0x80, 0x9f,
+          0xdc, 0x36, 0x0c, 0x47, 0xad, 0xfa, 0x97, 0x36, 0x12, 0xbd, 0x34, 0xdd, 0xb4, 0xb8, 0x34, 0x35, 0x8d, 0x91, 0xc7, 0x1a, 0xb2, 0x08, 0x4f, 0x0e,
+          0x98, 0xb3, 0x58, 0x22, 0x2f, 0x60, 0x86, 0x4e, 0x3b, 0xb8, 0xec, 0xd3, 0xd1, 0x3c, 0x21, 0xa9, 0xe1, 0x56, 0x70, 0xb2, 0x95, 0xfe, 0x97, 0x97,
+          0x76, 0x4c, 0x29, 0x14, 0x2f, 0xe5, 0xf8, 0x16, 0x2a, 0x7c, 0xe3, 0x6c, 0xa4, 0x4d, 0x09, 0x5c, 0x21, 0x4b, 0xe9, 0xf6, 0xdb, 0xbc, 0x14, 0x8b,
+          0x92, 0xf1, 0x0d, 0xdc, 0x50, 0x11, 0x31, 0x6d, 0x3d, 0xc6, 0xee, 0x5e, 0x2a, 0x4f, 0x25, 0xee, 0x50, 0x78, 0xe9, 0x2e, 0xb8, 0xd5, 0x1d, 0x4a,
+          0x5a, 0x11, 0x0a, 0x6e, 0x8c, 0x41, 0x73, 0x89, 0xdf, 0x84, 0x51, 0xaf, 0xa7, 0x4c, 0xe3, 0xc2, 0x18, 0xf5, 0xe8, 0xb1, 0xb4, 0xe8, 0x8b, 0x12,
+          0xa6, 0x33, 0xa4, 0x9a, 0xce, 0xcb, 0xea, 0x59, 0x4f, 0xc3, 0xb2, 0x12, 0x15, 0x9b, 0xb4, 0x9f, 0x89, 0x15, 0x09, 0xaa, 0xb3, 0xc0, 0x7d, 0x6d,
+          0x29, 0xa1, 0xb2, 0x1e, 0x46, 0x93, 0xd4, 0x66, 0x04, 0x03, 0xc8, 0x93, 0x80, 0xa7, 0xaa, 0xf6, 0x41, 0x87, 0x91, 0x20, 0x39, 0xa5, 0x97, 0x08,
+          0x08, 0x37, 0xe0, 0x35, 0x8a, 0x25, 0x78, 0x89, 0xdc, 0x18, 0x90};
     };
 
     struct JasmineCss {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{6409};
-        static constexpr std::array<uint64_t, 802> data{
-          0xf128b11a1908360e, 0x60b1c726a22855a4, 0x6254d4eac10912d4, 0x4b023786a235d2fa, 0x85c0427e82cc9586,
-          0xdc85b9e10caaef5b, 0x6a1defffebe8b4dc, 0x163803db46fe2427, 0xeffdfce9b446c670, 0x41fcffdab0b46faf,
-          0x1f12318828097829, 0x9a200a7dadc2342c, 0x0ebeb78d949683a5, 0xbed9b115cdce094d, 0xfeb32d39fe9853b1,
-          0x716d82c2ae820781, 0xef84e13d68ad070d, 0x1e53e37e6cba2869, 0x2980504c72ef8bf0, 0xcdeb2d29f07eabff,
-          0x8f7516eeefcc4820, 0x10380ec16ce0a87f, 0x7f8b1707dd8cff71, 0xe850fce07d050f16, 0xc4372d45021431f8,
-          0xd70d525aa020cc4d, 0x91f4fd8aa9d925cb, 0x65faee02ad5fedad, 0x59522a4f212446af, 0xa63c4222143baf7b,
-          0xfa0829097342fd0e, 0xd373cb10b3c28332, 0x08e9bf3c84c348fe, 0x7e5a4a9f9cf6e5aa, 0x4b69c8ebd43de402,
-          0x485a01388447efbd, 0x2f59ffffdbdc4ada, 0xa6dd34adeb96146d, 0x5a599ddb3ab502d4, 0xeaf0d20b801e9e52,
-          0x090c81819920e7d0, 0xcd218f91098681cf, 0x7bc4de4b6999f109, 0x320e673264a701f1, 0x62044dc5a1e2d654,
-          0xa783ca3621271015, 0x0804a2025181e092, 0x137397cfdbebec33, 0xc927600f83a83288, 0x5457dac3c0e08101,
-          0x03060c3078c0bbbd, 0x0ed8336f6bb7d3a3, 0xb2bbd457fd775b2e, 0x6e1ec3bd43a2805b, 0x3f9c82c74678f2af,
-          0xb99c862b0b594870, 0xdf8f86b82c8fedcd, 0x9c73d43a6497125d, 0x7ee4468b03e094da, 0xa7790c3570fdf1bd,
-          0xec301662e48acb84, 0x837f4de23ab1e554, 0x29904243f57797b9, 0x225c25bb29a5cc5e, 0xc4700acd66f9a17d,
-          0x44c950070ed0925a, 0x1325f82d9588fa8e, 0x0b1e7341b1a05c50, 0x2da84f1965a56df8, 0x851e55b85af8af3a,
-          0x6b4b471dea0c34fb, 0xb6f44976ea1a67a0, 0x6db432faa4e6183c, 0xed6c09944e435bef, 0x411243a8cacd66cb,
-          0xba13c6359cfa2154, 0xa11e194efbf6618c, 0x592fcc9726d84c26, 0x8a3ab866119470f4, 0x5ea0af86ffeb45d0,
-          0x45fc7021eaf13ab4, 0xeee6fd00f86a4691, 0xf24a4402f44ecc50, 0x9b893f96b2fdf02b, 0x870daf15ddb999c8,
-          0x5b6f4654f775bc03, 0xae500d8215c9c99b, 0xfe7c16745e7c03c4, 0x5f94ff7817889945, 0x233e4a45dfcf8c73,
-          0x240853860f0e36bd, 0x693f920e29e4fb05, 0xe081d67976cd0135, 0xf4285175a9dcba96, 0x569d3437bd4954ec,
-          0xd800a71eeb5e2e40, 0x77f2f549dbe90278, 0xc272951673071800, 0x5dc0790e1d525077, 0x5368b94e9d1201b6,
-          0x61368033b1928283, 0x2b0d09e00754d527, 0xdf1459cbb4806528, 0x10a0cd1bcc149aee, 0x9452aa090cc012aa,
-          0x01706eaa5aa6a56b, 0x1d47a97a93a34040, 0x1939b432ef96775b, 0x404fc732bd033afa, 0x6e413a7c64da360c,
-          0x1906481bb12b48e9, 0x301a35b797c52a9f, 0xc044a5522d5d9618, 0xc3d2213061427951, 0x369f679e6f7c226f,
-          0xae620806000ffb15, 0xa360b12357de822e, 0xf93edc43356a564a, 0xf1ce2f2f50d2b39b, 0x7251c1e65a94d89c,
-          0xab838034cb1fefff, 0x936289e70783c5f3, 0x2e90043e5485b3d1, 0xc566b52497726441, 0xf6e5cb8d946f99aa,
-          0xde546802566b37df, 0x82db1df4bb9c8c76, 0x5d4d9f3aadc0c5ed, 0xaea46030fd39d2f9, 0x72304174310ff8e1,
-          0x6c06320e43c50ea3, 0xa84a6365c8639cfe, 0xa4aad2a64436e6ea, 0xf0cb896b2b48e12a, 0x471babc62f5d8f1b,
-          0xfb49e8770354f10b, 0x62d04eb7dd4d2fb7, 0xcf603864798ab25f, 0x31ea443d196a3b31, 0x31fa19685d72e658,
-          0x4df5d9969ada8bdf, 0xdf6112afd3d2a4cb, 0xeaf47b3dec677dbb, 0x586586f8f64989ea, 0x28c9eddd50b5d9d1,
-          0x75313270fc31af67, 0xfbdbdf277b3818f7, 0x29c8973332aff7e2, 0xde471fb909cff3bc, 0x95fba12744dab7a6,
-          0xabe48a701b57adcf, 0xf510bc50480de011, 0x1d493abc2309e866, 0x68e5d12cc46116e6, 0x6a817e933a679edf,
-          0xaaad17cf8c316534, 0x2f60594a631e4099, 0x0b86fc6bf4569a1c, 0x6f8fc32ae19083f7, 0xa27fe042c2bd640f,
-          0x8e7b9cbaa4b9e7f8, 0xd04cf73a5263885a, 0xfff347d05842590b, 0x09092e687e182b54, 0xaa4049dfb2ee659d,
-          0x4e7bd750d626ceaa, 0xade3f4397a01f672, 0x3a53f9f5cb2a831f, 0x641dcd9fdb9564ba, 0x387fca5f27af1fbd,
-          0xeb0f6f5da390fcf3, 0x2b00772a113ff421, 0xebce3a9efa3c7a76, 0xc8e9e8fa5a3d3be0, 0x4dfd05cbefef1b28,
-          0xdd03a557f4615986, 0xe07e86a547f6b081, 0x51a9bdfaf2dc5b1f, 0xecfa57e1ad2a0dfe, 0xb38010dc49712b1f,
-          0x447ae9bc94ae57ff, 0x0dbf2dbed5b4f894, 0x4c15601e71a00ac2, 0x3e21779a16f1c521, 0xff3e5babbd36a9b8,
-          0xa9e5ed090176b2c1, 0x2df7cbab9e052e69, 0x1c09f9691a17cb57, 0xdc953407f7497e24, 0x974f82d1efbf2fde,
-          0x9e3ead86e20f37bc, 0x9414071ca6546e50, 0x6feb06316c22c871, 0x3a9e68d5ff76817c, 0x8b74d0179d7766b4,
-          0x5e2f6744b55efce3, 0x34a550acdc785758, 0x90fef2db6b5d6707, 0xd7e593c2ceea71c8, 0x616f66db8cf6efe8,
-          0xbff933d60f96bf83, 0x228246478b39ccbe, 0xcc275699b7791f9c, 0xf0ce4c0f6fceb7ff, 0xfecc451d49a425c6,
-          0xf8d032fe114b7064, 0xe86de1b8f77ec49b, 0xe0638984a815df5e, 0x2bd46615eb67c1b8, 0xdec3dfdf09fdf132,
-          0xe7f26282042566e0, 0xb8d048e18773f1ea, 0xb3b06f5f27905289, 0xc780a703474aad16, 0x6647529b7aa1fa4f,
-          0xbad34da413eb50f8, 0x790f3db6bac41f9d, 0x572e3129e66f9539, 0xf9224deae742ac86, 0x4e1dd217cd14f79c,
-          0xccd434fa7241c31e, 0x88093348f946d341, 0x3d3d9b6db8a59ee7, 0xfdf270865870f424, 0x311c307eafdb88a9,
-          0xc4e9fa31f76922c2, 0x82ec271365b0255d, 0xa9f9a28742c8b2f5, 0x8b3dbf1d293b7f54, 0xcbcdec7c0fe7df70,
-          0x359674df0303a3bf, 0xaceec6ceb63ef9b6, 0xb37fe6e5151a067c, 0x926e3622a7b20ea9, 0x7324548641c60b03,
-          0xec9eede2d8577f05, 0x4fd3a2d174822732, 0x3277feb177153424, 0x2ff824af44b86b63, 0x29c5e7c4dcc85d3c,
-          0xbaa1d7712696df06, 0xe311f72aff2e2d34, 0x9e74348fe30e5f2d, 0x675884aee98f4c1d, 0x77066fa984275c6f,
-          0x3fef6ad329d9d53e, 0x1cbd57865baf08ec, 0x9c7ffc93d5fc2723, 0xa7f82eaeeae5bc49, 0x5ebe4aeebe507d88,
-          0xc8e5799e17742fa4, 0xe5a5d79ba6f9cff3, 0xe80fefc6fcebd774, 0xc9f5685e171a7e4e, 0x7f738ec451457c36,
-          0x158aee92188ea2c3, 0x5acba74ed00a4381, 0xec2353873d7bb036, 0x8a3cd50c9a166836, 0x96c6749fc6d751a0,
-          0x9003883e40c7bec4, 0xeefc9a3ed6b8a43e, 0xa4893764a240e689, 0x370179d873d2eed2, 0x441880f89d2acd3b,
-          0x61cb1e1559912682, 0x3f1413717776b333, 0x10b1cd6926c3d16c, 0x223ba706880255c4, 0xd75e3e739f3e589b,
-          0x6b1e564ad3619202, 0x5ea2732f487d3409, 0xaf338968cd627c28, 0x46ef311f79b77cb6, 0x155bbe01da772b54,
-          0xfa81c8ee1c5fe798, 0x947d99b942515710, 0x780082490fc2ede5, 0x6d851e30ea7dd651, 0xb6818aac6e9ab46e,
-          0xfa28517958414f43, 0x9f3dad96bdad16bf, 0x3335dd4a72d82b55, 0xa1cc987ec00d0c20, 0xf24dade26b315a4c,
-          0x4966232d2773e658, 0x3e223fc36d49fc69, 0x923691459e9503e8, 0x8b551acf9837f747, 0xafdcabc7d2683ce0,
-          0x5ca823736bd008fe, 0xdc7381b627259433, 0x0b6a86a0f1abfe6c, 0x81942d4bec338ded, 0xa1bc394c67ca6126,
-          0xaef48723f3d8c372, 0x096bedaeb9ccae27, 0xac2ebce19b4f593c, 0x8cb9e672a09329fb, 0xa670549eb38cfc5b,
-          0x586d710c47cab33a, 0xbe7e96287ab24427, 0xaee77e392a3e54aa, 0xd2a789f7ed84fee3, 0xe4b1cb0184ca504c,
-          0x4aebb67ef63d395d, 0xd4ed0e3eeda3446b, 0xcebbbeaf12790822, 0xa52dc808737cd03a, 0xddd5a7cf8c0a52df,
-          0xd2c47de531fecd88, 0x50f64319e4772ba4, 0xf3c8548bc9107717, 0xb182f97dac4e8481, 0x3645eaa78cfa5012,
-          0x1c5e227b683e506a, 0xd15d88ea1877dbd7, 0xb6b73cf1e8520d8f, 0x90f4e642bdf42256, 0xc6cc078df950ac49,
-          0xd4a42f47e406fb52, 0x4cd87baad39d4711, 0x47581a7bdf4a955f, 0x8eea0dd96815b372, 0x365323543e69e973,
-          0x75853a9ca1aa6039, 0xdf21275964af7922, 0xb8e964058dab4e93, 0x2f0cd4f497eeb1c6, 0x12cfcb0ef81348fc,
-          0x6a89c20aa410b383, 0x70b71f77b544fe34, 0x2519b724be09b6a9, 0x3b0f13be037a2909, 0xfb5baa219312dc5e,
-          0xa0a8ab54ee36631b, 0x2fc7ec5b69d13d6c, 0x6c89913c7d7214fc, 0xf96a735ba2945f82, 0x3a5c1f53ec7be037,
-          0x3ed0bbd3981a2601, 0xd6767cef251a2843, 0x9277ab0b574b3c4f, 0x53c42eb303b85998, 0x0d1ad2ecc2795456,
-          0xb8e2d03bbe3e5a01, 0xaf34320a7d71012b, 0x91b29744769408e3, 0xc06877697c0d86c4, 0xef967f9e662707f3,
-          0xea697959edd0aaac, 0x9c1a9edc16bd2c75, 0x8ccc44c10547ba52, 0xd3a5c435970a5875, 0x41b17fac0d26ac56,
-          0x6b9e9fc937b6d0b6, 0xaaaf8d74cf23622c, 0x49b6fd13c78445db, 0x6f0913e96de0e53d, 0x86dfdb24c320f161,
-          0x4ad2f251ed3f273e, 0x286db674f2dc1b7a, 0xfaaf91a82b599432, 0x19b21ffbd102d3a3, 0x0e733ae403587a88,
-          0x75e8a240e050c3e5, 0x7da037fbfd37611a, 0x337f94d68d9754e2, 0x115ff87142571207, 0xb187140e2cbe64c9,
-          0x7b2722001ad51efa, 0xdc6ad9d433c51bfb, 0x674cbdc749c68b96, 0x11a1b1c16a4bbf5c, 0xe04d68d124614fb7,
-          0x1c524133cf7addf1, 0x7a942f9042d665b5, 0xcdb74b0b27b73a70, 0x0d336a9ef50215ef, 0x469e6a6fcf46ded0,
-          0x56bc1732855ccace, 0xe7ebbb104d14c9e1, 0xb6f477cbcd4f6fb0, 0x0ad8ffcacfd959c9, 0x2b6d5863ef3543c3,
-          0x5a4853075519b382, 0xe686443617eaf9df, 0x75cd6f4a0c581d4c, 0x17689463b4f810f3, 0x5e10349325fa0149,
-          0x1b2b11b7ac871e40, 0xcb1f2fc404247eb0, 0x4d2d030f44c9394f, 0x754b32fbb82f3085, 0x1b8c242eada65e96,
-          0x9461f20077644206, 0xb13533e9a0b1a975, 0xcca977ab71aa4b00, 0x201ab385f6d0516a, 0x4ba056b48609ebe5,
-          0x8006584d9696d0dd, 0xcec3c929c080ea86, 0xa25391244481e2c8, 0x6d0f854c8b07f4e5, 0xbded7c3e6f86748c,
-          0xfcfb7ffc1b533adb, 0x08c752b49efb276e, 0xcb1e98bb5cd70dc7, 0xa31a311ebb8fb048, 0xa79ed183b5b4a12e,
-          0x27659be90b5cf79e, 0x24cd22b4ba89b577, 0xdba245af28155f5b, 0xb5785c81571327cc, 0xb6418516f382c168,
-          0x5503261104f17cb4, 0xc75056c504e37a93, 0x7ae759ee2d7d4321, 0x616c6babeb932641, 0xd71fd06179c1ca2a,
-          0xb4988e87a0632763, 0x9002577da3458276, 0x58f9a57b84a72849, 0x554c51af05f2fecb, 0x3708dfa6efdd2391,
-          0x7d14881e52d23bca, 0x16efaa4427d2c4c3, 0x4bffde6ec76361df, 0xa0baf72b010c6ba6, 0x243dba50fd4c50be,
-          0x2c039eefd79664ca, 0xea3694c7d76ac6dc, 0x99c6f65c693d6305, 0x8546a2e38b0fc214, 0x88db6b14ddc5b33d,
-          0x95a61f39b17b76a0, 0x16d7c337c086aa18, 0x0d07c80806a9b250, 0x2e9fb4e74feb08e3, 0x9ad39e0b2e8ee086,
-          0x287c787ad8c23132, 0x0c0b8b45696343f4, 0x24b74982c949c081, 0x0ea6f9e5c0389afd, 0x7100a5d43a1f16a3,
-          0x2c29fda38c938115, 0x253ad59e9a7a7a02, 0xa5952e7695ad6eb5, 0x57404c20676a7598, 0xf342a6d68a0b42b5,
-          0x7ce076d03a493727, 0x0b977175fc711a2a, 0x14a72e6ad1819118, 0xb7753bebb9ab14c0, 0xb5b84dab61798444,
-          0x730e91225043aba2, 0x13ad48543b7609ac, 0x5502f6a27568029c, 0x847b457083f8a3eb, 0x5246db1205958211,
-          0x04dd6809bf94ef25, 0xee02b335bf0de2a8, 0xd0144ac9226edae4, 0x4d1cc829f2075b50, 0x72e82214d4343101,
-          0x0e1c7c4ad3224119, 0xb78e82b96d017459, 0x8ccbd64eaf434092, 0x9814970e4d595186, 0x8b7e0a65bd46e3ba,
-          0x8e8d250d419bfac5, 0xd10233da8f068811, 0xdb27a97632485de4, 0x15771b561a1e208d, 0x133009022a47b341,
-          0xb0c3d3e8eb45cd5d, 0x41d07b16db584182, 0x2d25a3bb420a5625, 0xfae0f840db8d72e9, 0xedd92d2719cdc6ea,
-          0xf89a0004f979616b, 0x5169e05e50027f82, 0x6645fc2855a53bce, 0x829d5c28dfd5e283, 0x40441fc5380f2562,
-          0xff4ad2bb0b62db9f, 0x4114b640646dd731, 0x92cc196e92c21412, 0xaa1e933308cf40d2, 0x37bac9b558285b6c,
-          0x8494b27061a81685, 0x5a5b544525075026, 0x1bf06c8935451992, 0x0982c1f5d902ed66, 0x48d1eaed20cc389a,
-          0x13a4f45081c1c0c1, 0xe3da41d74da7507a, 0x65ada10f8e33f64a, 0xe564aa1759845c17, 0x76fe63f30dbaea37,
-          0xc0dadc2e38488219, 0xb49815606b406791, 0x4448909d3008f444, 0xa12bd9589898099c, 0x69c280b9db524bc4,
-          0x064de803365e8036, 0x75ef5451752f11fc, 0xfed5baba6f553e25, 0xdea1a7f6f4ca4c18, 0x8a3d6eb424be200d,
-          0xb129dcf5de155617, 0xfb1205879f9b165a, 0x783b8e0da62c2d5b, 0x267080c32e0bed6a, 0x5d33cbcc996b44f1,
-          0xa0a16516c324c129, 0x90dc117655b9357c, 0x88851a102558c9c5, 0x2dcab241dee67633, 0x01e070e229fa7acb,
-          0x8a3d54fcd44f24cb, 0x7fdc70953cd1233a, 0x684604c05119bf60, 0xcca5e5a5c60df343, 0xb06fdae23d89d4ab,
-          0x0fd895f1b23e762a, 0x2110bf64aa50b117, 0x5142a8ee940eaca6, 0x932d927ca683d01a, 0x95fdfa5192572d36,
-          0xc12799bf727d4445, 0xe81c884883eb1da6, 0xd119f5f5ccd8f2d8, 0xc7c8b3e35ab875a6, 0x13dd168fc71011bb,
-          0x1add36bb12205502, 0x7b783d9b8684f240, 0xa3e8fdc5ed0b66ed, 0xbf3ff9fbad8e5a27, 0x7766fc8286f3d410,
-          0xd81614d3ff029fed, 0x213c1f436fc8c0ba, 0xe8dd71cd6bf6cd26, 0xd1ada36f7af4d0f9, 0x1cf824f19de4cbef,
-          0x33ec4ad4a35a68a8, 0x41313f22a7133380, 0x9eb014e7dca4bfa2, 0xc05ef52d0d31e04a, 0x1aa9b0366c8c4d19,
-          0x816b6e7bc5282b4b, 0x6d766bd94872ec1f, 0x209252715f025f88, 0x6a0cef68c9dc2ec6, 0xef34c68bd8183a8f,
-          0xc2284405c7ce968c, 0xb07d3c191aab19bb, 0x9103c3e15184265c, 0x4be13116f7f4cddc, 0x27f473336757a1bc,
-          0x18c791d8c56c3a87, 0x6498f114f5a9940b, 0x6b860727387caa76, 0x55741e5216c6ae61, 0xddc2f790b9021b60,
-          0xed386a3a7df7f17e, 0x02c77fa6b7d9e427, 0xb664916ed9363cd5, 0x8d6cba1b10a3a43c, 0x40c92c4487b226a6,
-          0x8a5a915876be6290, 0xb64d69ffa4b29757, 0x08e168cf13028013, 0xd332bf1aed10b627, 0x315be312d78ffddb,
-          0x9ec6a78c3370c30c, 0x4853361d10a78fa8, 0xd15e71d4729e5825, 0x9e1542a95c46bb54, 0x2cb210503b4c21aa,
-          0x86873bd4be6980cc, 0x8b312ec364852423, 0xf4c79ee0e22249f1, 0xa4605e36d92a17c2, 0x725e60522cb14732,
-          0xccb25dc29f1ace7c, 0xd3eab86c1718c2ca, 0xc616b0350622a4e1, 0x0be4176465384052, 0xf56dd233dc39ab2d,
-          0x2fb509a60f0d38b7, 0xa8676a9a0e425d63, 0xce4413240a85a4a8, 0x5e8d8d76664b3565, 0x57a5130df734dabe,
-          0x140ae4d3a8dd28a5, 0x26070dadbb32956c, 0xfec1924d276d5bb6, 0xbcb861469865884d, 0x7648d325e6ced2e1,
-          0x2eee9a48b7024189, 0xcd13582595d4d8ec, 0xe1d0a24b76a374a6, 0x962785bc775d2d16, 0x63d3c9b1699e4e8d,
-          0xcc2e14816115c80f, 0x52492a836c548425, 0x6dd4db1944441d1b, 0xc80fed7647a1fa1e, 0xf574c210186567b5,
-          0x2e211c3aed0e5b27, 0x6eb41a3972062b44, 0x3e9de4a62a0d834d, 0x69dcc24be163ce11, 0x412cca3595c43212,
-          0xb791c3c9dbe69000, 0x171f83695b446931, 0x9356e25e26769503, 0xc9d3887401512df3, 0xb36b889f191bcb3b,
-          0x3b9117f7d67470a2, 0x40b50f5649e3441b, 0xb54eb3bb39ba9071, 0x514a21f05c78c5be, 0x84e157948aa41f14,
-          0x852a03a4505d7318, 0x158608248953072e, 0x2de09272a41e1fdf, 0x687a4249181d78e6, 0xee4ae7b3c96f6c4b,
-          0x2b0f27e42746da87, 0x1e28f484b6560c50, 0xab504c88005497c3, 0xb354bac73aa0d8e6, 0x364cab2853129ed0,
-          0x46773905656269f4, 0x25c3ae99b148f4ec, 0x5428ddf4d37556f4, 0xc1b25cd60ebf7aa6, 0x519832d6336dc5a6,
-          0xf91fdd37c60c114f, 0xe94ea5bef28e1ae9, 0xacfa6a9d72fea673, 0x0c7ee2550beb76c6, 0xb3aa3f4da12d6c32,
-          0xef243ae13f632b9b, 0x413374ed704df655, 0x49a04156f9347649, 0x8e4046b233e94ecf, 0x81e695ab2dc0cb98,
-          0xc155902710faab3b, 0xc857f72744a4b582, 0xa7a43e14435b8e4f, 0x682c5c2ea7b446c6, 0x7726a4131494573d,
-          0xefdcb5aee35ab6bb, 0x7f217ff3aa5aaaaf, 0x31623d16255c0185, 0x5adfca375e47238f, 0xcc2a9a5ea26b5f89,
-          0xa6ad6fe977533eed, 0xd2c9d395997c49ff, 0xbf4bca5f65341613, 0x187acc0f929493a3, 0xb98bd164e9002816,
-          0x74fb7c919096e806, 0x09cf09ff8c44e682, 0x9180b75f277dda80, 0xcdfae39552592256, 0x3be72cc5b4cb2147,
-          0xb77f1e9ceb7ab1d1, 0x94dd7465a615829b, 0xc1e561d7e913a289, 0x16c5232734b4a28e, 0x4cb1e3aaa8e3d9e4,
-          0xfdb6159954975476, 0x32e291ec50434476, 0xea0e5a4c33b6fe53, 0x9fa21e94bacdb112, 0x47e33f09947b1850,
-          0xf2466b5e2c89dbef, 0xaedf6c62deea0200, 0x23e3b7b0867c14df, 0x973d21034cc3fcae, 0x653561a4fdc69adf,
-          0x63a408317db9d975, 0x438e5b6e3679d306, 0x02c521d74172aabd, 0xccc661cb50c26c9a, 0x04f48b41162bb48a,
-          0x482d5b5effe1bcaa, 0xf757987f53d96eed, 0x3d2e9f5fa23c19bf, 0x587a6e77f7867c70, 0xd79f273f43bed5aa,
-          0xbfb2cb5fbfe56ff2, 0x5abf2db9c1efbe9e, 0x3c1dfccddf439ed5, 0xaa5f073d4242abbb, 0xfce3657c2550fff8,
-          0x1bdf2ef5bf75581e, 0xba7e2af5c7b39b8f, 0xb0735c7f6242ff80, 0x91ffb332fdeb1e3d, 0x93e887fb9fa07ec5,
-          0xf80722e20f29a73f, 0xd99af323dacbe9fc, 0xe362355412c01048, 0xa951d6ec1b753fbc, 0x70b780fa77e54218,
-          0x81d16044025191d4, 0xfbd003c6e8d26669, 0x951aa9f17155dddb, 0xc399d44cf0b76f24, 0xdf62f20592a884cf,
-          0xf3b4c6671328cde9, 0x0e2b4057eb3ac62c, 0x33de4a8d77f9fd85, 0xa33de24fc84babad, 0x8e5043e8cdc857ec,
-          0x18224ae4fc42dd03, 0xb034662ff051810b, 0x2a5f43bae9525532, 0x2bdf7931a0d7acb4, 0x558427b02bd049fc,
-          0x4caa76841ebf6393, 0x25202aa945d212b7, 0xd8fe9c02797a149f, 0xc4be4c4c80f59859, 0xcd00976896f2ebc5,
-          0x93c37907505e83d6, 0xc36b449fed9a415e, 0xa7f01ebf75a8b813, 0xf017358a3fb13a13, 0xc716962abd4462ac,
-          0x1264c77ada7e859a, 0x5748205b9c0cd9f9, 0x8c0faf78df144c1e, 0xd68fd33d68dce71e, 0x279e9771381300a9,
-          0x9f821f2f42cf8ad5, 0xaa6e552fd91924bc, 0xe0370dda22ad7df6, 0x018b3f3788f72932, 0x02eba26817c09a2c,
-          0x3e184103bfb066d0, 0xca444f3306aa9554, 0x68bee83446fb42c8, 0x389dca6302b0e6f3, 0xa9d347aab66031fd,
-          0x4335270be31afaf3, 0x5489c3f9cfb17c79, 0x6430d4c03ba9d201, 0x42cb579897be7a1e, 0x9ecfee249ab365d6,
-          0x84686008da0d4898, 0x82eb141451021946, 0x0aa95f3461c4988f, 0x26034c30294b0693, 0x588a3222df4b208c,
-          0x78ec4d93dcc98b2e, 0x5b2d16a62fbd4be7, 0x8db5a84a88622701, 0x6c8cb315d9f02a60, 0xcf151685d2bd4026,
-          0x92c4002e9d9dc1b1, 0xede6094bbde8d689, 0x5a4b6e4f1a5dc78c, 0x709bd1aa0dce0dc7, 0x387fcb67c073dbd9,
-          0x38ebfc9fedb9fd3c, 0x5ae4f058567ae9aa, 0xe6aac7cf7c3e545d, 0xbe16abbf7c1b975a, 0xc8f6323070c9cd2c,
-          0x576ae5f5653545ef, 0x7cf7c9a035e70c0c, 0x44297f606377fea8, 0x29938f8f873668fd, 0x1096a75d19f905db,
-          0xb6a8d4d3fa1c65f2, 0x6710996875a0a8c6, 0x0c1fddd0dcaaac55, 0x9d046736ff82a569, 0xc54dde90f8a874f5,
-          0xc0f0a436142f9a96, 0x36dc362b402fd53b, 0x8ec0ed3437355bb8, 0xce9335734456795f, 0x482959b85adc1c6c,
-          0xce205dbdf1311691, 0x3fe28bdc07c3e69c, 0xb3f1227d89cec0d0, 0xe3ccf6d2a8aea6e6, 0x26f3fe2d2c8d6854,
-          0xdca462d360a1edd2, 0x0013f7676053e68d, 0x4d73e8da80f20404, 0xfefab9c611cd0e82, 0xbd6846f84311045e,
-          0xdcc2821a112b9693, 0x0300000000000000};
+        static constexpr std::string_view etag{"\"81c713d210a14c73\""};
+        static constexpr std::array<uint8_t, 6409> data{
+          0xf1, 0x28, 0xb1, 0x1a, 0x19, 0x08, 0x36, 0x0e, 0x60, 0xb1, 0xc7, 0x26, 0xa2, 0x28, 0x55, 0xa4, 0x62, 0x54, 0xd4, 0xea, 0xc1, 0x09, 0x12, 0xd4,
+          0x4b, 0x02, 0x37, 0x86, 0xa2, 0x35, 0xd2, 0xfa, 0x85, 0xc0, 0x42, 0x7e, 0x82, 0xcc, 0x95, 0x86, 0xdc, 0x85, 0xb9, 0xe1, 0x0c, 0xaa, 0xef, 0x5b,
+          0x6a, 0x1d, 0xef, 0xff, 0xeb, 0xe8, 0xb4, 0xdc, 0x16, 0x38, 0x03, 0xdb, 0x46, 0xfe, 0x24, 0x27, 0xef, 0xfd, 0xfc, 0xe9, 0xb4, 0x46, 0xc6, 0x70,
+          0x41, 0xfc, 0xff, 0xda, 0xb0, 0xb4, 0x6f, 0xaf, 0x1f, 0x12, 0x31, 0x88, 0x28, 0x09, 0x78, 0x29, 0x9a, 0x20, 0x0a, 0x7d, 0xad, 0xc2, 0x34, 0x2c,
+          0x0e, 0xbe, 0xb7, 0x8d, 0x94, 0x96, 0x83, 0xa5, 0xbe, 0xd9, 0xb1, 0x15, 0xcd, 0xce, 0x09, 0x4d, 0xfe, 0xb3, 0x2d, 0x39, 0xfe, 0x98, 0x53, 0xb1,
+          0x71, 0x6d, 0x82, 0xc2, 0xae, 0x82, 0x07, 0x81, 0xef, 0x84, 0xe1, 0x3d, 0x68, 0xad, 0x07, 0x0d, 0x1e, 0x53, 0xe3, 0x7e, 0x6c, 0xba, 0x28, 0x69,
+          0x29, 0x80, 0x50, 0x4c, 0x72, 0xef, 0x8b, 0xf0, 0xcd, 0xeb, 0x2d, 0x29, 0xf0, 0x7e, 0xab, 0xff, 0x8f, 0x75, 0x16, 0xee, 0xef, 0xcc, 0x48, 0x20,
+          0x10, 0x38, 0x0e, 0xc1, 0x6c, 0xe0, 0xa8, 0x7f, 0x7f, 0x8b, 0x17, 0x07, 0xdd, 0x8c, 0xff, 0x71, 0xe8, 0x50, 0xfc, 0xe0, 0x7d, 0x05, 0x0f, 0x16,
+          0xc4, 0x37, 0x2d, 0x45, 0x02, 0x14, 0x31, 0xf8, 0xd7, 0x0d, 0x52, 0x5a, 0xa0, 0x20, 0xcc, 0x4d, 0x91, 0xf4, 0xfd, 0x8a, 0xa9, 0xd9, 0x25, 0xcb,
+          0x65, 0xfa, 0xee, 0x02, 0xad, 0x5f, 0xed, 0xad, 0x59, 0x52, 0x2a, 0x4f, 0x21, 0x24, 0x46, 0xaf, 0xa6, 0x3c, 0x42, 0x22, 0x14, 0x3b, 0xaf, 0x7b,
+          0xfa, 0x08, 0x29, 0x09, 0x73, 0x42, 0xfd, 0x0e, 0xd3, 0x73, 0xcb, 0x10, 0xb3, 0xc2, 0x83, 0x32, 0x08, 0xe9, 0xbf, 0x3c, 0x84, 0xc3, 0x48, 0xfe,
+          0x7e, 0x5a, 0x4a, 0x9f, 0x9c, 0xf6, 0xe5, 0xaa, 0x4b, 0x69, 0xc8, 0xeb, 0xd4, 0x3d, 0xe4, 0x02, 0x48, 0x5a, 0x01, 0x38, 0x84, 0x47, 0xef, 0xbd,
+          0x2f, 0x59, 0xff, 0xff, 0xdb, 0xdc, 0x4a, 0xda, 0xa6, 0xdd, 0x34, 0xad, 0xeb, 0x96, 0x14, 0x6d, 0x5a, 0x59, 0x9d, 0xdb, 0x3a, 0xb5, 0x02, 0xd4,
+          0xea, 0xf0, 0xd2, 0x0b, 0x80, 0x1e, 0x9e, 0x52, 0x09, 0x0c, 0x81, 0x81, 0x99, 0x20, 0xe7, 0xd0, 0xcd, 0x21, 0x8f, 0x91, 0x09, 0x86, 0x81, 0xcf,
+          0x7b, 0xc4, 0xde, 0x4b, 0x69, 0x99, 0xf1, 0x09, 0x32, 0x0e, 0x67, 0x32, 0x64, 0xa7, 0x01, 0xf1, 0x62, 0x04, 0x4d, 0xc5, 0xa1, 0xe2, 0xd6, 0x54,
+          0xa7, 0x83, 0xca, 0x36, 0x21, 0x27, 0x10, 0x15, 0x08, 0x04, 0xa2, 0x02, 0x51, 0x81, 0xe0, 0x92, 0x13, 0x73, 0x97, 0xcf, 0xdb, 0xeb, 0xec, 0x33,
+          0xc9, 0x27, 0x60, 0x0f, 0x83, 0xa8, 0x32, 0x88, 0x54, 0x57, 0xda, 0xc3, 0xc0, 0xe0, 0x81, 0x01, 0x03, 0x06, 0x0c, 0x30, 0x78, 0xc0, 0xbb, 0xbd,
+          0x0e, 0xd8, 0x33, 0x6f, 0x6b, 0xb7, 0xd3, 0xa3, 0xb2, 0xbb, 0xd4, 0x57, 0xfd, 0x77, 0x5b, 0x2e, 0x6e, 0x1e, 0xc3, 0xbd, 0x43, 0xa2, 0x80, 0x5b,
+          0x3f, 0x9c, 0x82, 0xc7, 0x46, 0x78, 0xf2, 0xaf, 0xb9, 0x9c, 0x86, 0x2b, 0x0b, 0x59, 0x48, 0x70, 0xdf, 0x8f, 0x86, 0xb8, 0x2c, 0x8f, 0xed, 0xcd,
+          0x9c, 0x73, 0xd4, 0x3a, 0x64, 0x97, 0x12, 0x5d, 0x7e, 0xe4, 0x46, 0x8b, 0x03, 0xe0, 0x94, 0xda, 0xa7, 0x79, 0x0c, 0x35, 0x70, 0xfd, 0xf1, 0xbd,
+          0xec, 0x30, 0x16, 0x62, 0xe4, 0x8a, 0xcb, 0x84, 0x83, 0x7f, 0x4d, 0xe2, 0x3a, 0xb1, 0xe5, 0x54, 0x29, 0x90, 0x42, 0x43, 0xf5, 0x77, 0x97, 0xb9,
+          0x22, 0x5c, 0x25, 0xbb, 0x29, 0xa5, 0xcc, 0x5e, 0xc4, 0x70, 0x0a, 0xcd, 0x66, 0xf9, 0xa1, 0x7d, 0x44, 0xc9, 0x50, 0x07, 0x0e, 0xd0, 0x92, 0x5a,
+          0x13, 0x25, 0xf8, 0x2d, 0x95, 0x88, 0xfa, 0x8e, 0x0b, 0x1e, 0x73, 0x41, 0xb1, 0xa0, 0x5c, 0x50, 0x2d, 0xa8, 0x4f, 0x19, 0x65, 0xa5, 0x6d, 0xf8,
+          0x85, 0x1e, 0x55, 0xb8, 0x5a, 0xf8, 0xaf, 0x3a, 0x6b, 0x4b, 0x47, 0x1d, 0xea, 0x0c, 0x34, 0xfb, 0xb6, 0xf4, 0x49, 0x76, 0xea, 0x1a, 0x67, 0xa0,
+          0x6d, 0xb4, 0x32, 0xfa, 0xa4, 0xe6, 0x18, 0x3c, 0xed, 0x6c, 0x09, 0x94, 0x4e, 0x43, 0x5b, 0xef, 0x41, 0x12, 0x43, 0xa8, 0xca, 0xcd, 0x66, 0xcb,
+          0xba, 0x13, 0xc6, 0x35, 0x9c, 0xfa, 0x21, 0x54, 0xa1, 0x1e, 0x19, 0x4e, 0xfb, 0xf6, 0x61, 0x8c, 0x59, 0x2f, 0xcc, 0x97, 0x26, 0xd8, 0x4c, 0x26,
+          0x8a, 0x3a, 0xb8, 0x66, 0x11, 0x94, 0x70, 0xf4, 0x5e, 0xa0, 0xaf, 0x86, 0xff, 0xeb, 0x45, 0xd0, 0x45, 0xfc, 0x70, 0x21, 0xea, 0xf1, 0x3a, 0xb4,
+          0xee, 0xe6, 0xfd, 0x00, 0xf8, 0x6a, 0x46, 0x91, 0xf2, 0x4a, 0x44, 0x02, 0xf4, 0x4e, 0xcc, 0x50, 0x9b, 0x89, 0x3f, 0x96, 0xb2, 0xfd, 0xf0, 0x2b,
+          0x87, 0x0d, 0xaf, 0x15, 0xdd, 0xb9, 0x99, 0xc8, 0x5b, 0x6f, 0x46, 0x54, 0xf7, 0x75, 0xbc, 0x03, 0xae, 0x50, 0x0d, 0x82, 0x15, 0xc9, 0xc9, 0x9b,
+          0xfe, 0x7c, 0x16, 0x74, 0x5e, 0x7c, 0x03, 0xc4, 0x5f, 0x94, 0xff, 0x78, 0x17, 0x88, 0x99, 0x45, 0x23, 0x3e, 0x4a, 0x45, 0xdf, 0xcf, 0x8c, 0x73,
+          0x24, 0x08, 0x53, 0x86, 0x0f, 0x0e, 0x36, 0xbd, 0x69, 0x3f, 0x92, 0x0e, 0x29, 0xe4, 0xfb, 0x05, 0xe0, 0x81, 0xd6, 0x79, 0x76, 0xcd, 0x01, 0x35,
+          0xf4, 0x28, 0x51, 0x75, 0xa9, 0xdc, 0xba, 0x96, 0x56, 0x9d, 0x34, 0x37, 0xbd, 0x49, 0x54, 0xec, 0xd8, 0x00, 0xa7, 0x1e, 0xeb, 0x5e, 0x2e, 0x40,
+          0x77, 0xf2, 0xf5, 0x49, 0xdb, 0xe9, 0x02, 0x78, 0xc2, 0x72, 0x95, 0x16, 0x73, 0x07, 0x18, 0x00, 0x5d, 0xc0, 0x79, 0x0e, 0x1d, 0x52, 0x50, 0x77,
+          0x53, 0x68, 0xb9, 0x4e, 0x9d, 0x12, 0x01, 0xb6, 0x61, 0x36, 0x80, 0x33, 0xb1, 0x92, 0x82, 0x83, 0x2b, 0x0d, 0x09, 0xe0, 0x07, 0x54, 0xd5, 0x27,
+          0xdf, 0x14, 0x59, 0xcb, 0xb4, 0x80, 0x65, 0x28, 0x10, 0xa0, 0xcd, 0x1b, 0xcc, 0x14, 0x9a, 0xee, 0x94, 0x52, 0xaa, 0x09, 0x0c, 0xc0, 0x12, 0xaa,
+          0x01, 0x70, 0x6e, 0xaa, 0x5a, 0xa6, 0xa5, 0x6b, 0x1d, 0x47, 0xa9, 0x7a, 0x93, 0xa3, 0x40, 0x40, 0x19, 0x39, 0xb4, 0x32, 0xef, 0x96, 0x77, 0x5b,
+          0x40, 0x4f, 0xc7, 0x32, 0xbd, 0x03, 0x3a, 0xfa, 0x6e, 0x41, 0x3a, 0x7c, 0x64, 0xda, 0x36, 0x0c, 0x19, 0x06, 0x48, 0x1b, 0xb1, 0x2b, 0x48, 0xe9,
+          0x30, 0x1a, 0x35, 0xb7, 0x97, 0xc5, 0x2a, 0x9f, 0xc0, 0x44, 0xa5, 0x52, 0x2d, 0x5d, 0x96, 0x18, 0xc3, 0xd2, 0x21, 0x30, 0x61, 0x42, 0x79, 0x51,
+          0x36, 0x9f, 0x67, 0x9e, 0x6f, 0x7c, 0x22, 0x6f, 0xae, 0x62, 0x08, 0x06, 0x00, 0x0f, 0xfb, 0x15, 0xa3, 0x60, 0xb1, 0x23, 0x57, 0xde, 0x82, 0x2e,
+          0xf9, 0x3e, 0xdc, 0x43, 0x35, 0x6a, 0x56, 0x4a, 0xf1, 0xce, 0x2f, 0x2f, 0x50, 0xd2, 0xb3, 0x9b, 0x72, 0x51, 0xc1, 0xe6, 0x5a, 0x94, 0xd8, 0x9c,
+          0xab, 0x83, 0x80, 0x34, 0xcb, 0x1f, 0xef, 0xff, 0x93, 0x62, 0x89, 0xe7, 0x07, 0x83, 0xc5, 0xf3, 0x2e, 0x90, 0x04, 0x3e, 0x54, 0x85, 0xb3, 0xd1,
+          0xc5, 0x66, 0xb5, 0x24, 0x97, 0x72, 0x64, 0x41, 0xf6, 0xe5, 0xcb, 0x8d, 0x94, 0x6f, 0x99, 0xaa, 0xde, 0x54, 0x68, 0x02, 0x56, 0x6b, 0x37, 0xdf,
+          0x82, 0xdb, 0x1d, 0xf4, 0xbb, 0x9c, 0x8c, 0x76, 0x5d, 0x4d, 0x9f, 0x3a, 0xad, 0xc0, 0xc5, 0xed, 0xae, 0xa4, 0x60, 0x30, 0xfd, 0x39, 0xd2, 0xf9,
+          0x72, 0x30, 0x41, 0x74, 0x31, 0x0f, 0xf8, 0xe1, 0x6c, 0x06, 0x32, 0x0e, 0x43, 0xc5, 0x0e, 0xa3, 0xa8, 0x4a, 0x63, 0x65, 0xc8, 0x63, 0x9c, 0xfe,
+          0xa4, 0xaa, 0xd2, 0xa6, 0x44, 0x36, 0xe6, 0xea, 0xf0, 0xcb, 0x89, 0x6b, 0x2b, 0x48, 0xe1, 0x2a, 0x47, 0x1b, 0xab, 0xc6, 0x2f, 0x5d, 0x8f, 0x1b,
+          0xfb, 0x49, 0xe8, 0x77, 0x03, 0x54, 0xf1, 0x0b, 0x62, 0xd0, 0x4e, 0xb7, 0xdd, 0x4d, 0x2f, 0xb7, 0xcf, 0x60, 0x38, 0x64, 0x79, 0x8a, 0xb2, 0x5f,
+          0x31, 0xea, 0x44, 0x3d, 0x19, 0x6a, 0x3b, 0x31, 0x31, 0xfa, 0x19, 0x68, 0x5d, 0x72, 0xe6, 0x58, 0x4d, 0xf5, 0xd9, 0x96, 0x9a, 0xda, 0x8b, 0xdf,
+          0xdf, 0x61, 0x12, 0xaf, 0xd3, 0xd2, 0xa4, 0xcb, 0xea, 0xf4, 0x7b, 0x3d, 0xec, 0x67, 0x7d, 0xbb, 0x58, 0x65, 0x86, 0xf8, 0xf6, 0x49, 0x89, 0xea,
+          0x28, 0xc9, 0xed, 0xdd, 0x50, 0xb5, 0xd9, 0xd1, 0x75, 0x31, 0x32, 0x70, 0xfc, 0x31, 0xaf, 0x67, 0xfb, 0xdb, 0xdf, 0x27, 0x7b, 0x38, 0x18, 0xf7,
+          0x29, 0xc8, 0x97, 0x33, 0x32, 0xaf, 0xf7, 0xe2, 0xde, 0x47, 0x1f, 0xb9, 0x09, 0xcf, 0xf3, 0xbc, 0x95, 0xfb, 0xa1, 0x27, 0x44, 0xda, 0xb7, 0xa6,
+          0xab, 0xe4, 0x8a, 0x70, 0x1b, 0x57, 0xad, 0xcf, 0xf5, 0x10, 0xbc, 0x50, 0x48, 0x0d, 0xe0, 0x11, 0x1d, 0x49, 0x3a, 0xbc, 0x23, 0x09, 0xe8, 0x66,
+          0x68, 0xe5, 0xd1, 0x2c, 0xc4, 0x61, 0x16, 0xe6, 0x6a, 0x81, 0x7e, 0x93, 0x3a, 0x67, 0x9e, 0xdf, 0xaa, 0xad, 0x17, 0xcf, 0x8c, 0x31, 0x65, 0x34,
+          0x2f, 0x60, 0x59, 0x4a, 0x63, 0x1e, 0x40, 0x99, 0x0b, 0x86, 0xfc, 0x6b, 0xf4, 0x56, 0x9a, 0x1c, 0x6f, 0x8f, 0xc3, 0x2a, 0xe1, 0x90, 0x83, 0xf7,
+          0xa2, 0x7f, 0xe0, 0x42, 0xc2, 0xbd, 0x64, 0x0f, 0x8e, 0x7b, 0x9c, 0xba, 0xa4, 0xb9, 0xe7, 0xf8, 0xd0, 0x4c, 0xf7, 0x3a, 0x52, 0x63, 0x88, 0x5a,
+          0xff, 0xf3, 0x47, 0xd0, 0x58, 0x42, 0x59, 0x0b, 0x09, 0x09, 0x2e, 0x68, 0x7e, 0x18, 0x2b, 0x54, 0xaa, 0x40, 0x49, 0xdf, 0xb2, 0xee, 0x65, 0x9d,
+          0x4e, 0x7b, 0xd7, 0x50, 0xd6, 0x26, 0xce, 0xaa, 0xad, 0xe3, 0xf4, 0x39, 0x7a, 0x01, 0xf6, 0x72, 0x3a, 0x53, 0xf9, 0xf5, 0xcb, 0x2a, 0x83, 0x1f,
+          0x64, 0x1d, 0xcd, 0x9f, 0xdb, 0x95, 0x64, 0xba, 0x38, 0x7f, 0xca, 0x5f, 0x27, 0xaf, 0x1f, 0xbd, 0xeb, 0x0f, 0x6f, 0x5d, 0xa3, 0x90, 0xfc, 0xf3,
+          0x2b, 0x00, 0x77, 0x2a, 0x11, 0x3f, 0xf4, 0x21, 0xeb, 0xce, 0x3a, 0x9e, 0xfa, 0x3c, 0x7a, 0x76, 0xc8, 0xe9, 0xe8, 0xfa, 0x5a, 0x3d, 0x3b, 0xe0,
+          0x4d, 0xfd, 0x05, 0xcb, 0xef, 0xef, 0x1b, 0x28, 0xdd, 0x03, 0xa5, 0x57, 0xf4, 0x61, 0x59, 0x86, 0xe0, 0x7e, 0x86, 0xa5, 0x47, 0xf6, 0xb0, 0x81,
+          0x51, 0xa9, 0xbd, 0xfa, 0xf2, 0xdc, 0x5b, 0x1f, 0xec, 0xfa, 0x57, 0xe1, 0xad, 0x2a, 0x0d, 0xfe, 0xb3, 0x80, 0x10, 0xdc, 0x49, 0x71, 0x2b, 0x1f,
+          0x44, 0x7a, 0xe9, 0xbc, 0x94, 0xae, 0x57, 0xff, 0x0d, 0xbf, 0x2d, 0xbe, 0xd5, 0xb4, 0xf8, 0x94, 0x4c, 0x15, 0x60, 0x1e, 0x71, 0xa0, 0x0a, 0xc2,
+          0x3e, 0x21, 0x77, 0x9a, 0x16, 0xf1, 0xc5, 0x21, 0xff, 0x3e, 0x5b, 0xab, 0xbd, 0x36, 0xa9, 0xb8, 0xa9, 0xe5, 0xed, 0x09, 0x01, 0x76, 0xb2, 0xc1,
+          0x2d, 0xf7, 0xcb, 0xab, 0x9e, 0x05, 0x2e, 0x69, 0x1c, 0x09, 0xf9, 0x69, 0x1a, 0x17, 0xcb, 0x57, 0xdc, 0x95, 0x34, 0x07, 0xf7, 0x49, 0x7e, 0x24,
+          0x97, 0x4f, 0x82, 0xd1, 0xef, 0xbf, 0x2f, 0xde, 0x9e, 0x3e, 0xad, 0x86, 0xe2, 0x0f, 0x37, 0xbc, 0x94, 0x14, 0x07, 0x1c, 0xa6, 0x54, 0x6e, 0x50,
+          0x6f, 0xeb, 0x06, 0x31, 0x6c, 0x22, 0xc8, 0x71, 0x3a, 0x9e, 0x68, 0xd5, 0xff, 0x76, 0x81, 0x7c, 0x8b, 0x74, 0xd0, 0x17, 0x9d, 0x77, 0x66, 0xb4,
+          0x5e, 0x2f, 0x67, 0x44, 0xb5, 0x5e, 0xfc, 0xe3, 0x34, 0xa5, 0x50, 0xac, 0xdc, 0x78, 0x57, 0x58, 0x90, 0xfe, 0xf2, 0xdb, 0x6b, 0x5d, 0x67, 0x07,
+          0xd7, 0xe5, 0x93, 0xc2, 0xce, 0xea, 0x71, 0xc8, 0x61, 0x6f, 0x66, 0xdb, 0x8c, 0xf6, 0xef, 0xe8, 0xbf, 0xf9, 0x33, 0xd6, 0x0f, 0x96, 0xbf, 0x83,
+          0x22, 0x82, 0x46, 0x47, 0x8b, 0x39, 0xcc, 0xbe, 0xcc, 0x27, 0x56, 0x99, 0xb7, 0x79, 0x1f, 0x9c, 0xf0, 0xce, 0x4c, 0x0f, 0x6f, 0xce, 0xb7, 0xff,
+          0xfe, 0xcc, 0x45, 0x1d, 0x49, 0xa4, 0x25, 0xc6, 0xf8, 0xd0, 0x32, 0xfe, 0x11, 0x4b, 0x70, 0x64, 0xe8, 0x6d, 0xe1, 0xb8, 0xf7, 0x7e, 0xc4, 0x9b,
+          0xe0, 0x63, 0x89, 0x84, 0xa8, 0x15, 0xdf, 0x5e, 0x2b, 0xd4, 0x66, 0x15, 0xeb, 0x67, 0xc1, 0xb8, 0xde, 0xc3, 0xdf, 0xdf, 0x09, 0xfd, 0xf1, 0x32,
+          0xe7, 0xf2, 0x62, 0x82, 0x04, 0x25, 0x66, 0xe0, 0xb8, 0xd0, 0x48, 0xe1, 0x87, 0x73, 0xf1, 0xea, 0xb3, 0xb0, 0x6f, 0x5f, 0x27, 0x90, 0x52, 0x89,
+          0xc7, 0x80, 0xa7, 0x03, 0x47, 0x4a, 0xad, 0x16, 0x66, 0x47, 0x52, 0x9b, 0x7a, 0xa1, 0xfa, 0x4f, 0xba, 0xd3, 0x4d, 0xa4, 0x13, 0xeb, 0x50, 0xf8,
+          0x79, 0x0f, 0x3d, 0xb6, 0xba, 0xc4, 0x1f, 0x9d, 0x57, 0x2e, 0x31, 0x29, 0xe6, 0x6f, 0x95, 0x39, 0xf9, 0x22, 0x4d, 0xea, 0xe7, 0x42, 0xac, 0x86,
+          0x4e, 0x1d, 0xd2, 0x17, 0xcd, 0x14, 0xf7, 0x9c, 0xcc, 0xd4, 0x34, 0xfa, 0x72, 0x41, 0xc3, 0x1e, 0x88, 0x09, 0x33, 0x48, 0xf9, 0x46, 0xd3, 0x41,
+          0x3d, 0x3d, 0x9b, 0x6d, 0xb8, 0xa5, 0x9e, 0xe7, 0xfd, 0xf2, 0x70, 0x86, 0x58, 0x70, 0xf4, 0x24, 0x31, 0x1c, 0x30, 0x7e, 0xaf, 0xdb, 0x88, 0xa9,
+          0xc4, 0xe9, 0xfa, 0x31, 0xf7, 0x69, 0x22, 0xc2, 0x82, 0xec, 0x27, 0x13, 0x65, 0xb0, 0x25, 0x5d, 0xa9, 0xf9, 0xa2, 0x87, 0x42, 0xc8, 0xb2, 0xf5,
+          0x8b, 0x3d, 0xbf, 0x1d, 0x29, 0x3b, 0x7f, 0x54, 0xcb, 0xcd, 0xec, 0x7c, 0x0f, 0xe7, 0xdf, 0x70, 0x35, 0x96, 0x74, 0xdf, 0x03, 0x03, 0xa3, 0xbf,
+          0xac, 0xee, 0xc6, 0xce, 0xb6, 0x3e, 0xf9, 0xb6, 0xb3, 0x7f, 0xe6, 0xe5, 0x15, 0x1a, 0x06, 0x7c, 0x92, 0x6e, 0x36, 0x22, 0xa7, 0xb2, 0x0e, 0xa9,
+          0x73, 0x24, 0x54, 0x86, 0x41, 0xc6, 0x0b, 0x03, 0xec, 0x9e, 0xed, 0xe2, 0xd8, 0x57, 0x7f, 0x05, 0x4f, 0xd3, 0xa2, 0xd1, 0x74, 0x82, 0x27, 0x32,
+          0x32, 0x77, 0xfe, 0xb1, 0x77, 0x15, 0x34, 0x24, 0x2f, 0xf8, 0x24, 0xaf, 0x44, 0xb8, 0x6b, 0x63, 0x29, 0xc5, 0xe7, 0xc4, 0xdc, 0xc8, 0x5d, 0x3c,
+          0xba, 0xa1, 0xd7, 0x71, 0x26, 0x96, 0xdf, 0x06, 0xe3, 0x11, 0xf7, 0x2a, 0xff, 0x2e, 0x2d, 0x34, 0x9e, 0x74, 0x34, 0x8f, 0xe3, 0x0e, 0x5f, 0x2d,
+          0x67, 0x58, 0x84, 0xae, 0xe9, 0x8f, 0x4c, 0x1d, 0x77, 0x06, 0x6f, 0xa9, 0x84, 0x27, 0x5c, 0x6f, 0x3f, 0xef, 0x6a, 0xd3, 0x29, 0xd9, 0xd5, 0x3e,
+          0x1c, 0xbd, 0x57, 0x86, 0x5b, 0xaf, 0x08, 0xec, 0x9c, 0x7f, 0xfc, 0x93, 0xd5, 0xfc, 0x27, 0x23, 0xa7, 0xf8, 0x2e, 0xae, 0xea, 0xe5, 0xbc, 0x49,
+          0x5e, 0xbe, 0x4a, 0xee, 0xbe, 0x50, 0x7d, 0x88, 0xc8, 0xe5, 0x79, 0x9e, 0x17, 0x74, 0x2f, 0xa4, 0xe5, 0xa5, 0xd7, 0x9b, 0xa6, 0xf9, 0xcf, 0xf3,
+          0xe8, 0x0f, 0xef, 0xc6, 0xfc, 0xeb, 0xd7, 0x74, 0xc9, 0xf5, 0x68, 0x5e, 0x17, 0x1a, 0x7e, 0x4e, 0x7f, 0x73, 0x8e, 0xc4, 0x51, 0x45, 0x7c, 0x36,
+          0x15, 0x8a, 0xee, 0x92, 0x18, 0x8e, 0xa2, 0xc3, 0x5a, 0xcb, 0xa7, 0x4e, 0xd0, 0x0a, 0x43, 0x81, 0xec, 0x23, 0x53, 0x87, 0x3d, 0x7b, 0xb0, 0x36,
+          0x8a, 0x3c, 0xd5, 0x0c, 0x9a, 0x16, 0x68, 0x36, 0x96, 0xc6, 0x74, 0x9f, 0xc6, 0xd7, 0x51, 0xa0, 0x90, 0x03, 0x88, 0x3e, 0x40, 0xc7, 0xbe, 0xc4,
+          0xee, 0xfc, 0x9a, 0x3e, 0xd6, 0xb8, 0xa4, 0x3e, 0xa4, 0x89, 0x37, 0x64, 0xa2, 0x40, 0xe6, 0x89, 0x37, 0x01, 0x79, 0xd8, 0x73, 0xd2, 0xee, 0xd2,
+          0x44, 0x18, 0x80, 0xf8, 0x9d, 0x2a, 0xcd, 0x3b, 0x61, 0xcb, 0x1e, 0x15, 0x59, 0x91, 0x26, 0x82, 0x3f, 0x14, 0x13, 0x71, 0x77, 0x76, 0xb3, 0x33,
+          0x10, 0xb1, 0xcd, 0x69, 0x26, 0xc3, 0xd1, 0x6c, 0x22, 0x3b, 0xa7, 0x06, 0x88, 0x02, 0x55, 0xc4, 0xd7, 0x5e, 0x3e, 0x73, 0x9f, 0x3e, 0x58, 0x9b,
+          0x6b, 0x1e, 0x56, 0x4a, 0xd3, 0x61, 0x92, 0x02, 0x5e, 0xa2, 0x73, 0x2f, 0x48, 0x7d, 0x34, 0x09, 0xaf, 0x33, 0x89, 0x68, 0xcd, 0x62, 0x7c, 0x28,
+          0x46, 0xef, 0x31, 0x1f, 0x79, 0xb7, 0x7c, 0xb6, 0x15, 0x5b, 0xbe, 0x01, 0xda, 0x77, 0x2b, 0x54, 0xfa, 0x81, 0xc8, 0xee, 0x1c, 0x5f, 0xe7, 0x98,
+          0x94, 0x7d, 0x99, 0xb9, 0x42, 0x51, 0x57, 0x10, 0x78, 0x00, 0x82, 0x49, 0x0f, 0xc2, 0xed, 0xe5, 0x6d, 0x85, 0x1e, 0x30, 0xea, 0x7d, 0xd6, 0x51,
+          0xb6, 0x81, 0x8a, 0xac, 0x6e, 0x9a, 0xb4, 0x6e, 0xfa, 0x28, 0x51, 0x79, 0x58, 0x41, 0x4f, 0x43, 0x9f, 0x3d, 0xad, 0x96, 0xbd, 0xad, 0x16, 0xbf,
+          0x33, 0x35, 0xdd, 0x4a, 0x72, 0xd8, 0x2b, 0x55, 0xa1, 0xcc, 0x98, 0x7e, 0xc0, 0x0d, 0x0c, 0x20, 0xf2, 0x4d, 0xad, 0xe2, 0x6b, 0x31, 0x5a, 0x4c,
+          0x49, 0x66, 0x23, 0x2d, 0x27, 0x73, 0xe6, 0x58, 0x3e, 0x22, 0x3f, 0xc3, 0x6d, 0x49, 0xfc, 0x69, 0x92, 0x36, 0x91, 0x45, 0x9e, 0x95, 0x03, 0xe8,
+          0x8b, 0x55, 0x1a, 0xcf, 0x98, 0x37, 0xf7, 0x47, 0xaf, 0xdc, 0xab, 0xc7, 0xd2, 0x68, 0x3c, 0xe0, 0x5c, 0xa8, 0x23, 0x73, 0x6b, 0xd0, 0x08, 0xfe,
+          0xdc, 0x73, 0x81, 0xb6, 0x27, 0x25, 0x94, 0x33, 0x0b, 0x6a, 0x86, 0xa0, 0xf1, 0xab, 0xfe, 0x6c, 0x81, 0x94, 0x2d, 0x4b, 0xec, 0x33, 0x8d, 0xed,
+          0xa1, 0xbc, 0x39, 0x4c, 0x67, 0xca, 0x61, 0x26, 0xae, 0xf4, 0x87, 0x23, 0xf3, 0xd8, 0xc3, 0x72, 0x09, 0x6b, 0xed, 0xae, 0xb9, 0xcc, 0xae, 0x27,
+          0xac, 0x2e, 0xbc, 0xe1, 0x9b, 0x4f, 0x59, 0x3c, 0x8c, 0xb9, 0xe6, 0x72, 0xa0, 0x93, 0x29, 0xfb, 0xa6, 0x70, 0x54, 0x9e, 0xb3, 0x8c, 0xfc, 0x5b,
+          0x58, 0x6d, 0x71, 0x0c, 0x47, 0xca, 0xb3, 0x3a, 0xbe, 0x7e, 0x96, 0x28, 0x7a, 0xb2, 0x44, 0x27, 0xae, 0xe7, 0x7e, 0x39, 0x2a, 0x3e, 0x54, 0xaa,
+          0xd2, 0xa7, 0x89, 0xf7, 0xed, 0x84, 0xfe, 0xe3, 0xe4, 0xb1, 0xcb, 0x01, 0x84, 0xca, 0x50, 0x4c, 0x4a, 0xeb, 0xb6, 0x7e, 0xf6, 0x3d, 0x39, 0x5d,
+          0xd4, 0xed, 0x0e, 0x3e, 0xed, 0xa3, 0x44, 0x6b, 0xce, 0xbb, 0xbe, 0xaf, 0x12, 0x79, 0x08, 0x22, 0xa5, 0x2d, 0xc8, 0x08, 0x73, 0x7c, 0xd0, 0x3a,
+          0xdd, 0xd5, 0xa7, 0xcf, 0x8c, 0x0a, 0x52, 0xdf, 0xd2, 0xc4, 0x7d, 0xe5, 0x31, 0xfe, 0xcd, 0x88, 0x50, 0xf6, 0x43, 0x19, 0xe4, 0x77, 0x2b, 0xa4,
+          0xf3, 0xc8, 0x54, 0x8b, 0xc9, 0x10, 0x77, 0x17, 0xb1, 0x82, 0xf9, 0x7d, 0xac, 0x4e, 0x84, 0x81, 0x36, 0x45, 0xea, 0xa7, 0x8c, 0xfa, 0x50, 0x12,
+          0x1c, 0x5e, 0x22, 0x7b, 0x68, 0x3e, 0x50, 0x6a, 0xd1, 0x5d, 0x88, 0xea, 0x18, 0x77, 0xdb, 0xd7, 0xb6, 0xb7, 0x3c, 0xf1, 0xe8, 0x52, 0x0d, 0x8f,
+          0x90, 0xf4, 0xe6, 0x42, 0xbd, 0xf4, 0x22, 0x56, 0xc6, 0xcc, 0x07, 0x8d, 0xf9, 0x50, 0xac, 0x49, 0xd4, 0xa4, 0x2f, 0x47, 0xe4, 0x06, 0xfb, 0x52,
+          0x4c, 0xd8, 0x7b, 0xaa, 0xd3, 0x9d, 0x47, 0x11, 0x47, 0x58, 0x1a, 0x7b, 0xdf, 0x4a, 0x95, 0x5f, 0x8e, 0xea, 0x0d, 0xd9, 0x68, 0x15, 0xb3, 0x72,
+          0x36, 0x53, 0x23, 0x54, 0x3e, 0x69, 0xe9, 0x73, 0x75, 0x85, 0x3a, 0x9c, 0xa1, 0xaa, 0x60, 0x39, 0xdf, 0x21, 0x27, 0x59, 0x64, 0xaf, 0x79, 0x22,
+          0xb8, 0xe9, 0x64, 0x05, 0x8d, 0xab, 0x4e, 0x93, 0x2f, 0x0c, 0xd4, 0xf4, 0x97, 0xee, 0xb1, 0xc6, 0x12, 0xcf, 0xcb, 0x0e, 0xf8, 0x13, 0x48, 0xfc,
+          0x6a, 0x89, 0xc2, 0x0a, 0xa4, 0x10, 0xb3, 0x83, 0x70, 0xb7, 0x1f, 0x77, 0xb5, 0x44, 0xfe, 0x34, 0x25, 0x19, 0xb7, 0x24, 0xbe, 0x09, 0xb6, 0xa9,
+          0x3b, 0x0f, 0x13, 0xbe, 0x03, 0x7a, 0x29, 0x09, 0xfb, 0x5b, 0xaa, 0x21, 0x93, 0x12, 0xdc, 0x5e, 0xa0, 0xa8, 0xab, 0x54, 0xee, 0x36, 0x63, 0x1b,
+          0x2f, 0xc7, 0xec, 0x5b, 0x69, 0xd1, 0x3d, 0x6c, 0x6c, 0x89, 0x91, 0x3c, 0x7d, 0x72, 0x14, 0xfc, 0xf9, 0x6a, 0x73, 0x5b, 0xa2, 0x94, 0x5f, 0x82,
+          0x3a, 0x5c, 0x1f, 0x53, 0xec, 0x7b, 0xe0, 0x37, 0x3e, 0xd0, 0xbb, 0xd3, 0x98, 0x1a, 0x26, 0x01, 0xd6, 0x76, 0x7c, 0xef, 0x25, 0x1a, 0x28, 0x43,
+          0x92, 0x77, 0xab, 0x0b, 0x57, 0x4b, 0x3c, 0x4f, 0x53, 0xc4, 0x2e, 0xb3, 0x03, 0xb8, 0x59, 0x98, 0x0d, 0x1a, 0xd2, 0xec, 0xc2, 0x79, 0x54, 0x56,
+          0xb8, 0xe2, 0xd0, 0x3b, 0xbe, 0x3e, 0x5a, 0x01, 0xaf, 0x34, 0x32, 0x0a, 0x7d, 0x71, 0x01, 0x2b, 0x91, 0xb2, 0x97, 0x44, 0x76, 0x94, 0x08, 0xe3,
+          0xc0, 0x68, 0x77, 0x69, 0x7c, 0x0d, 0x86, 0xc4, 0xef, 0x96, 0x7f, 0x9e, 0x66, 0x27, 0x07, 0xf3, 0xea, 0x69, 0x79, 0x59, 0xed, 0xd0, 0xaa, 0xac,
+          0x9c, 0x1a, 0x9e, 0xdc, 0x16, 0xbd, 0x2c, 0x75, 0x8c, 0xcc, 0x44, 0xc1, 0x05, 0x47, 0xba, 0x52, 0xd3, 0xa5, 0xc4, 0x35, 0x97, 0x0a, 0x58, 0x75,
+          0x41, 0xb1, 0x7f, 0xac, 0x0d, 0x26, 0xac, 0x56, 0x6b, 0x9e, 0x9f, 0xc9, 0x37, 0xb6, 0xd0, 0xb6, 0xaa, 0xaf, 0x8d, 0x74, 0xcf, 0x23, 0x62, 0x2c,
+          0x49, 0xb6, 0xfd, 0x13, 0xc7, 0x84, 0x45, 0xdb, 0x6f, 0x09, 0x13, 0xe9, 0x6d, 0xe0, 0xe5, 0x3d, 0x86, 0xdf, 0xdb, 0x24, 0xc3, 0x20, 0xf1, 0x61,
+          0x4a, 0xd2, 0xf2, 0x51, 0xed, 0x3f, 0x27, 0x3e, 0x28, 0x6d, 0xb6, 0x74, 0xf2, 0xdc, 0x1b, 0x7a, 0xfa, 0xaf, 0x91, 0xa8, 0x2b, 0x59, 0x94, 0x32,
+          0x19, 0xb2, 0x1f, 0xfb, 0xd1, 0x02, 0xd3, 0xa3, 0x0e, 0x73, 0x3a, 0xe4, 0x03, 0x58, 0x7a, 0x88, 0x75, 0xe8, 0xa2, 0x40, 0xe0, 0x50, 0xc3, 0xe5,
+          0x7d, 0xa0, 0x37, 0xfb, 0xfd, 0x37, 0x61, 0x1a, 0x33, 0x7f, 0x94, 0xd6, 0x8d, 0x97, 0x54, 0xe2, 0x11, 0x5f, 0xf8, 0x71, 0x42, 0x57, 0x12, 0x07,
+          0xb1, 0x87, 0x14, 0x0e, 0x2c, 0xbe, 0x64, 0xc9, 0x7b, 0x27, 0x22, 0x00, 0x1a, 0xd5, 0x1e, 0xfa, 0xdc, 0x6a, 0xd9, 0xd4, 0x33, 0xc5, 0x1b, 0xfb,
+          0x67, 0x4c, 0xbd, 0xc7, 0x49, 0xc6, 0x8b, 0x96, 0x11, 0xa1, 0xb1, 0xc1, 0x6a, 0x4b, 0xbf, 0x5c, 0xe0, 0x4d, 0x68, 0xd1, 0x24, 0x61, 0x4f, 0xb7,
+          0x1c, 0x52, 0x41, 0x33, 0xcf, 0x7a, 0xdd, 0xf1, 0x7a, 0x94, 0x2f, 0x90, 0x42, 0xd6, 0x65, 0xb5, 0xcd, 0xb7, 0x4b, 0x0b, 0x27, 0xb7, 0x3a, 0x70,
+          0x0d, 0x33, 0x6a, 0x9e, 0xf5, 0x02, 0x15, 0xef, 0x46, 0x9e, 0x6a, 0x6f, 0xcf, 0x46, 0xde, 0xd0, 0x56, 0xbc, 0x17, 0x32, 0x85, 0x5c, 0xca, 0xce,
+          0xe7, 0xeb, 0xbb, 0x10, 0x4d, 0x14, 0xc9, 0xe1, 0xb6, 0xf4, 0x77, 0xcb, 0xcd, 0x4f, 0x6f, 0xb0, 0x0a, 0xd8, 0xff, 0xca, 0xcf, 0xd9, 0x59, 0xc9,
+          0x2b, 0x6d, 0x58, 0x63, 0xef, 0x35, 0x43, 0xc3, 0x5a, 0x48, 0x53, 0x07, 0x55, 0x19, 0xb3, 0x82, 0xe6, 0x86, 0x44, 0x36, 0x17, 0xea, 0xf9, 0xdf,
+          0x75, 0xcd, 0x6f, 0x4a, 0x0c, 0x58, 0x1d, 0x4c, 0x17, 0x68, 0x94, 0x63, 0xb4, 0xf8, 0x10, 0xf3, 0x5e, 0x10, 0x34, 0x93, 0x25, 0xfa, 0x01, 0x49,
+          0x1b, 0x2b, 0x11, 0xb7, 0xac, 0x87, 0x1e, 0x40, 0xcb, 0x1f, 0x2f, 0xc4, 0x04, 0x24, 0x7e, 0xb0, 0x4d, 0x2d, 0x03, 0x0f, 0x44, 0xc9, 0x39, 0x4f,
+          0x75, 0x4b, 0x32, 0xfb, 0xb8, 0x2f, 0x30, 0x85, 0x1b, 0x8c, 0x24, 0x2e, 0xad, 0xa6, 0x5e, 0x96, 0x94, 0x61, 0xf2, 0x00, 0x77, 0x64, 0x42, 0x06,
+          0xb1, 0x35, 0x33, 0xe9, 0xa0, 0xb1, 0xa9, 0x75, 0xcc, 0xa9, 0x77, 0xab, 0x71, 0xaa, 0x4b, 0x00, 0x20, 0x1a, 0xb3, 0x85, 0xf6, 0xd0, 0x51, 0x6a,
+          0x4b, 0xa0, 0x56, 0xb4, 0x86, 0x09, 0xeb, 0xe5, 0x80, 0x06, 0x58, 0x4d, 0x96, 0x96, 0xd0, 0xdd, 0xce, 0xc3, 0xc9, 0x29, 0xc0, 0x80, 0xea, 0x86,
+          0xa2, 0x53, 0x91, 0x24, 0x44, 0x81, 0xe2, 0xc8, 0x6d, 0x0f, 0x85, 0x4c, 0x8b, 0x07, 0xf4, 0xe5, 0xbd, 0xed, 0x7c, 0x3e, 0x6f, 0x86, 0x74, 0x8c,
+          0xfc, 0xfb, 0x7f, 0xfc, 0x1b, 0x53, 0x3a, 0xdb, 0x08, 0xc7, 0x52, 0xb4, 0x9e, 0xfb, 0x27, 0x6e, 0xcb, 0x1e, 0x98, 0xbb, 0x5c, 0xd7, 0x0d, 0xc7,
+          0xa3, 0x1a, 0x31, 0x1e, 0xbb, 0x8f, 0xb0, 0x48, 0xa7, 0x9e, 0xd1, 0x83, 0xb5, 0xb4, 0xa1, 0x2e, 0x27, 0x65, 0x9b, 0xe9, 0x0b, 0x5c, 0xf7, 0x9e,
+          0x24, 0xcd, 0x22, 0xb4, 0xba, 0x89, 0xb5, 0x77, 0xdb, 0xa2, 0x45, 0xaf, 0x28, 0x15, 0x5f, 0x5b, 0xb5, 0x78, 0x5c, 0x81, 0x57, 0x13, 0x27, 0xcc,
+          0xb6, 0x41, 0x85, 0x16, 0xf3, 0x82, 0xc1, 0x68, 0x55, 0x03, 0x26, 0x11, 0x04, 0xf1, 0x7c, 0xb4, 0xc7, 0x50, 0x56, 0xc5, 0x04, 0xe3, 0x7a, 0x93,
+          0x7a, 0xe7, 0x59, 0xee, 0x2d, 0x7d, 0x43, 0x21, 0x61, 0x6c, 0x6b, 0xab, 0xeb, 0x93, 0x26, 0x41, 0xd7, 0x1f, 0xd0, 0x61, 0x79, 0xc1, 0xca, 0x2a,
+          0xb4, 0x98, 0x8e, 0x87, 0xa0, 0x63, 0x27, 0x63, 0x90, 0x02, 0x57, 0x7d, 0xa3, 0x45, 0x82, 0x76, 0x58, 0xf9, 0xa5, 0x7b, 0x84, 0xa7, 0x28, 0x49,
+          0x55, 0x4c, 0x51, 0xaf, 0x05, 0xf2, 0xfe, 0xcb, 0x37, 0x08, 0xdf, 0xa6, 0xef, 0xdd, 0x23, 0x91, 0x7d, 0x14, 0x88, 0x1e, 0x52, 0xd2, 0x3b, 0xca,
+          0x16, 0xef, 0xaa, 0x44, 0x27, 0xd2, 0xc4, 0xc3, 0x4b, 0xff, 0xde, 0x6e, 0xc7, 0x63, 0x61, 0xdf, 0xa0, 0xba, 0xf7, 0x2b, 0x01, 0x0c, 0x6b, 0xa6,
+          0x24, 0x3d, 0xba, 0x50, 0xfd, 0x4c, 0x50, 0xbe, 0x2c, 0x03, 0x9e, 0xef, 0xd7, 0x96, 0x64, 0xca, 0xea, 0x36, 0x94, 0xc7, 0xd7, 0x6a, 0xc6, 0xdc,
+          0x99, 0xc6, 0xf6, 0x5c, 0x69, 0x3d, 0x63, 0x05, 0x85, 0x46, 0xa2, 0xe3, 0x8b, 0x0f, 0xc2, 0x14, 0x88, 0xdb, 0x6b, 0x14, 0xdd, 0xc5, 0xb3, 0x3d,
+          0x95, 0xa6, 0x1f, 0x39, 0xb1, 0x7b, 0x76, 0xa0, 0x16, 0xd7, 0xc3, 0x37, 0xc0, 0x86, 0xaa, 0x18, 0x0d, 0x07, 0xc8, 0x08, 0x06, 0xa9, 0xb2, 0x50,
+          0x2e, 0x9f, 0xb4, 0xe7, 0x4f, 0xeb, 0x08, 0xe3, 0x9a, 0xd3, 0x9e, 0x0b, 0x2e, 0x8e, 0xe0, 0x86, 0x28, 0x7c, 0x78, 0x7a, 0xd8, 0xc2, 0x31, 0x32,
+          0x0c, 0x0b, 0x8b, 0x45, 0x69, 0x63, 0x43, 0xf4, 0x24, 0xb7, 0x49, 0x82, 0xc9, 0x49, 0xc0, 0x81, 0x0e, 0xa6, 0xf9, 0xe5, 0xc0, 0x38, 0x9a, 0xfd,
+          0x71, 0x00, 0xa5, 0xd4, 0x3a, 0x1f, 0x16, 0xa3, 0x2c, 0x29, 0xfd, 0xa3, 0x8c, 0x93, 0x81, 0x15, 0x25, 0x3a, 0xd5, 0x9e, 0x9a, 0x7a, 0x7a, 0x02,
+          0xa5, 0x95, 0x2e, 0x76, 0x95, 0xad, 0x6e, 0xb5, 0x57, 0x40, 0x4c, 0x20, 0x67, 0x6a, 0x75, 0x98, 0xf3, 0x42, 0xa6, 0xd6, 0x8a, 0x0b, 0x42, 0xb5,
+          0x7c, 0xe0, 0x76, 0xd0, 0x3a, 0x49, 0x37, 0x27, 0x0b, 0x97, 0x71, 0x75, 0xfc, 0x71, 0x1a, 0x2a, 0x14, 0xa7, 0x2e, 0x6a, 0xd1, 0x81, 0x91, 0x18,
+          0xb7, 0x75, 0x3b, 0xeb, 0xb9, 0xab, 0x14, 0xc0, 0xb5, 0xb8, 0x4d, 0xab, 0x61, 0x79, 0x84, 0x44, 0x73, 0x0e, 0x91, 0x22, 0x50, 0x43, 0xab, 0xa2,
+          0x13, 0xad, 0x48, 0x54, 0x3b, 0x76, 0x09, 0xac, 0x55, 0x02, 0xf6, 0xa2, 0x75, 0x68, 0x02, 0x9c, 0x84, 0x7b, 0x45, 0x70, 0x83, 0xf8, 0xa3, 0xeb,
+          0x52, 0x46, 0xdb, 0x12, 0x05, 0x95, 0x82, 0x11, 0x04, 0xdd, 0x68, 0x09, 0xbf, 0x94, 0xef, 0x25, 0xee, 0x02, 0xb3, 0x35, 0xbf, 0x0d, 0xe2, 0xa8,
+          0xd0, 0x14, 0x4a, 0xc9, 0x22, 0x6e, 0xda, 0xe4, 0x4d, 0x1c, 0xc8, 0x29, 0xf2, 0x07, 0x5b, 0x50, 0x72, 0xe8, 0x22, 0x14, 0xd4, 0x34, 0x31, 0x01,
+          0x0e, 0x1c, 0x7c, 0x4a, 0xd3, 0x22, 0x41, 0x19, 0xb7, 0x8e, 0x82, 0xb9, 0x6d, 0x01, 0x74, 0x59, 0x8c, 0xcb, 0xd6, 0x4e, 0xaf, 0x43, 0x40, 0x92,
+          0x98, 0x14, 0x97, 0x0e, 0x4d, 0x59, 0x51, 0x86, 0x8b, 0x7e, 0x0a, 0x65, 0xbd, 0x46, 0xe3, 0xba, 0x8e, 0x8d, 0x25, 0x0d, 0x41, 0x9b, 0xfa, 0xc5,
+          0xd1, 0x02, 0x33, 0xda, 0x8f, 0x06, 0x88, 0x11, 0xdb, 0x27, 0xa9, 0x76, 0x32, 0x48, 0x5d, 0xe4, 0x15, 0x77, 0x1b, 0x56, 0x1a, 0x1e, 0x20, 0x8d,
+          0x13, 0x30, 0x09, 0x02, 0x2a, 0x47, 0xb3, 0x41, 0xb0, 0xc3, 0xd3, 0xe8, 0xeb, 0x45, 0xcd, 0x5d, 0x41, 0xd0, 0x7b, 0x16, 0xdb, 0x58, 0x41, 0x82,
+          0x2d, 0x25, 0xa3, 0xbb, 0x42, 0x0a, 0x56, 0x25, 0xfa, 0xe0, 0xf8, 0x40, 0xdb, 0x8d, 0x72, 0xe9, 0xed, 0xd9, 0x2d, 0x27, 0x19, 0xcd, 0xc6, 0xea,
+          0xf8, 0x9a, 0x00, 0x04, 0xf9, 0x79, 0x61, 0x6b, 0x51, 0x69, 0xe0, 0x5e, 0x50, 0x02, 0x7f, 0x82, 0x66, 0x45, 0xfc, 0x28, 0x55, 0xa5, 0x3b, 0xce,
+          0x82, 0x9d, 0x5c, 0x28, 0xdf, 0xd5, 0xe2, 0x83, 0x40, 0x44, 0x1f, 0xc5, 0x38, 0x0f, 0x25, 0x62, 0xff, 0x4a, 0xd2, 0xbb, 0x0b, 0x62, 0xdb, 0x9f,
+          0x41, 0x14, 0xb6, 0x40, 0x64, 0x6d, 0xd7, 0x31, 0x92, 0xcc, 0x19, 0x6e, 0x92, 0xc2, 0x14, 0x12, 0xaa, 0x1e, 0x93, 0x33, 0x08, 0xcf, 0x40, 0xd2,
+          0x37, 0xba, 0xc9, 0xb5, 0x58, 0x28, 0x5b, 0x6c, 0x84, 0x94, 0xb2, 0x70, 0x61, 0xa8, 0x16, 0x85, 0x5a, 0x5b, 0x54, 0x45, 0x25, 0x07, 0x50, 0x26,
+          0x1b, 0xf0, 0x6c, 0x89, 0x35, 0x45, 0x19, 0x92, 0x09, 0x82, 0xc1, 0xf5, 0xd9, 0x02, 0xed, 0x66, 0x48, 0xd1, 0xea, 0xed, 0x20, 0xcc, 0x38, 0x9a,
+          0x13, 0xa4, 0xf4, 0x50, 0x81, 0xc1, 0xc0, 0xc1, 0xe3, 0xda, 0x41, 0xd7, 0x4d, 0xa7, 0x50, 0x7a, 0x65, 0xad, 0xa1, 0x0f, 0x8e, 0x33, 0xf6, 0x4a,
+          0xe5, 0x64, 0xaa, 0x17, 0x59, 0x84, 0x5c, 0x17, 0x76, 0xfe, 0x63, 0xf3, 0x0d, 0xba, 0xea, 0x37, 0xc0, 0xda, 0xdc, 0x2e, 0x38, 0x48, 0x82, 0x19,
+          0xb4, 0x98, 0x15, 0x60, 0x6b, 0x40, 0x67, 0x91, 0x44, 0x48, 0x90, 0x9d, 0x30, 0x08, 0xf4, 0x44, 0xa1, 0x2b, 0xd9, 0x58, 0x98, 0x98, 0x09, 0x9c,
+          0x69, 0xc2, 0x80, 0xb9, 0xdb, 0x52, 0x4b, 0xc4, 0x06, 0x4d, 0xe8, 0x03, 0x36, 0x5e, 0x80, 0x36, 0x75, 0xef, 0x54, 0x51, 0x75, 0x2f, 0x11, 0xfc,
+          0xfe, 0xd5, 0xba, 0xba, 0x6f, 0x55, 0x3e, 0x25, 0xde, 0xa1, 0xa7, 0xf6, 0xf4, 0xca, 0x4c, 0x18, 0x8a, 0x3d, 0x6e, 0xb4, 0x24, 0xbe, 0x20, 0x0d,
+          0xb1, 0x29, 0xdc, 0xf5, 0xde, 0x15, 0x56, 0x17, 0xfb, 0x12, 0x05, 0x87, 0x9f, 0x9b, 0x16, 0x5a, 0x78, 0x3b, 0x8e, 0x0d, 0xa6, 0x2c, 0x2d, 0x5b,
+          0x26, 0x70, 0x80, 0xc3, 0x2e, 0x0b, 0xed, 0x6a, 0x5d, 0x33, 0xcb, 0xcc, 0x99, 0x6b, 0x44, 0xf1, 0xa0, 0xa1, 0x65, 0x16, 0xc3, 0x24, 0xc1, 0x29,
+          0x90, 0xdc, 0x11, 0x76, 0x55, 0xb9, 0x35, 0x7c, 0x88, 0x85, 0x1a, 0x10, 0x25, 0x58, 0xc9, 0xc5, 0x2d, 0xca, 0xb2, 0x41, 0xde, 0xe6, 0x76, 0x33,
+          0x01, 0xe0, 0x70, 0xe2, 0x29, 0xfa, 0x7a, 0xcb, 0x8a, 0x3d, 0x54, 0xfc, 0xd4, 0x4f, 0x24, 0xcb, 0x7f, 0xdc, 0x70, 0x95, 0x3c, 0xd1, 0x23, 0x3a,
+          0x68, 0x46, 0x04, 0xc0, 0x51, 0x19, 0xbf, 0x60, 0xcc, 0xa5, 0xe5, 0xa5, 0xc6, 0x0d, 0xf3, 0x43, 0xb0, 0x6f, 0xda, 0xe2, 0x3d, 0x89, 0xd4, 0xab,
+          0x0f, 0xd8, 0x95, 0xf1, 0xb2, 0x3e, 0x76, 0x2a, 0x21, 0x10, 0xbf, 0x64, 0xaa, 0x50, 0xb1, 0x17, 0x51, 0x42, 0xa8, 0xee, 0x94, 0x0e, 0xac, 0xa6,
+          0x93, 0x2d, 0x92, 0x7c, 0xa6, 0x83, 0xd0, 0x1a, 0x95, 0xfd, 0xfa, 0x51, 0x92, 0x57, 0x2d, 0x36, 0xc1, 0x27, 0x99, 0xbf, 0x72, 0x7d, 0x44, 0x45,
+          0xe8, 0x1c, 0x88, 0x48, 0x83, 0xeb, 0x1d, 0xa6, 0xd1, 0x19, 0xf5, 0xf5, 0xcc, 0xd8, 0xf2, 0xd8, 0xc7, 0xc8, 0xb3, 0xe3, 0x5a, 0xb8, 0x75, 0xa6,
+          0x13, 0xdd, 0x16, 0x8f, 0xc7, 0x10, 0x11, 0xbb, 0x1a, 0xdd, 0x36, 0xbb, 0x12, 0x20, 0x55, 0x02, 0x7b, 0x78, 0x3d, 0x9b, 0x86, 0x84, 0xf2, 0x40,
+          0xa3, 0xe8, 0xfd, 0xc5, 0xed, 0x0b, 0x66, 0xed, 0xbf, 0x3f, 0xf9, 0xfb, 0xad, 0x8e, 0x5a, 0x27, 0x77, 0x66, 0xfc, 0x82, 0x86, 0xf3, 0xd4, 0x10,
+          0xd8, 0x16, 0x14, 0xd3, 0xff, 0x02, 0x9f, 0xed, 0x21, 0x3c, 0x1f, 0x43, 0x6f, 0xc8, 0xc0, 0xba, 0xe8, 0xdd, 0x71, 0xcd, 0x6b, 0xf6, 0xcd, 0x26,
+          0xd1, 0xad, 0xa3, 0x6f, 0x7a, 0xf4, 0xd0, 0xf9, 0x1c, 0xf8, 0x24, 0xf1, 0x9d, 0xe4, 0xcb, 0xef, 0x33, 0xec, 0x4a, 0xd4, 0xa3, 0x5a, 0x68, 0xa8,
+          0x41, 0x31, 0x3f, 0x22, 0xa7, 0x13, 0x33, 0x80, 0x9e, 0xb0, 0x14, 0xe7, 0xdc, 0xa4, 0xbf, 0xa2, 0xc0, 0x5e, 0xf5, 0x2d, 0x0d, 0x31, 0xe0, 0x4a,
+          0x1a, 0xa9, 0xb0, 0x36, 0x6c, 0x8c, 0x4d, 0x19, 0x81, 0x6b, 0x6e, 0x7b, 0xc5, 0x28, 0x2b, 0x4b, 0x6d, 0x76, 0x6b, 0xd9, 0x48, 0x72, 0xec, 0x1f,
+          0x20, 0x92, 0x52, 0x71, 0x5f, 0x02, 0x5f, 0x88, 0x6a, 0x0c, 0xef, 0x68, 0xc9, 0xdc, 0x2e, 0xc6, 0xef, 0x34, 0xc6, 0x8b, 0xd8, 0x18, 0x3a, 0x8f,
+          0xc2, 0x28, 0x44, 0x05, 0xc7, 0xce, 0x96, 0x8c, 0xb0, 0x7d, 0x3c, 0x19, 0x1a, 0xab, 0x19, 0xbb, 0x91, 0x03, 0xc3, 0xe1, 0x51, 0x84, 0x26, 0x5c,
+          0x4b, 0xe1, 0x31, 0x16, 0xf7, 0xf4, 0xcd, 0xdc, 0x27, 0xf4, 0x73, 0x33, 0x67, 0x57, 0xa1, 0xbc, 0x18, 0xc7, 0x91, 0xd8, 0xc5, 0x6c, 0x3a, 0x87,
+          0x64, 0x98, 0xf1, 0x14, 0xf5, 0xa9, 0x94, 0x0b, 0x6b, 0x86, 0x07, 0x27, 0x38, 0x7c, 0xaa, 0x76, 0x55, 0x74, 0x1e, 0x52, 0x16, 0xc6, 0xae, 0x61,
+          0xdd, 0xc2, 0xf7, 0x90, 0xb9, 0x02, 0x1b, 0x60, 0xed, 0x38, 0x6a, 0x3a, 0x7d, 0xf7, 0xf1, 0x7e, 0x02, 0xc7, 0x7f, 0xa6, 0xb7, 0xd9, 0xe4, 0x27,
+          0xb6, 0x64, 0x91, 0x6e, 0xd9, 0x36, 0x3c, 0xd5, 0x8d, 0x6c, 0xba, 0x1b, 0x10, 0xa3, 0xa4, 0x3c, 0x40, 0xc9, 0x2c, 0x44, 0x87, 0xb2, 0x26, 0xa6,
+          0x8a, 0x5a, 0x91, 0x58, 0x76, 0xbe, 0x62, 0x90, 0xb6, 0x4d, 0x69, 0xff, 0xa4, 0xb2, 0x97, 0x57, 0x08, 0xe1, 0x68, 0xcf, 0x13, 0x02, 0x80, 0x13,
+          0xd3, 0x32, 0xbf, 0x1a, 0xed, 0x10, 0xb6, 0x27, 0x31, 0x5b, 0xe3, 0x12, 0xd7, 0x8f, 0xfd, 0xdb, 0x9e, 0xc6, 0xa7, 0x8c, 0x33, 0x70, 0xc3, 0x0c,
+          0x48, 0x53, 0x36, 0x1d, 0x10, 0xa7, 0x8f, 0xa8, 0xd1, 0x5e, 0x71, 0xd4, 0x72, 0x9e, 0x58, 0x25, 0x9e, 0x15, 0x42, 0xa9, 0x5c, 0x46, 0xbb, 0x54,
+          0x2c, 0xb2, 0x10, 0x50, 0x3b, 0x4c, 0x21, 0xaa, 0x86, 0x87, 0x3b, 0xd4, 0xbe, 0x69, 0x80, 0xcc, 0x8b, 0x31, 0x2e, 0xc3, 0x64, 0x85, 0x24, 0x23,
+          0xf4, 0xc7, 0x9e, 0xe0, 0xe2, 0x22, 0x49, 0xf1, 0xa4, 0x60, 0x5e, 0x36, 0xd9, 0x2a, 0x17, 0xc2, 0x72, 0x5e, 0x60, 0x52, 0x2c, 0xb1, 0x47, 0x32,
+          0xcc, 0xb2, 0x5d, 0xc2, 0x9f, 0x1a, 0xce, 0x7c, 0xd3, 0xea, 0xb8, 0x6c, 0x17, 0x18, 0xc2, 0xca, 0xc6, 0x16, 0xb0, 0x35, 0x06, 0x22, 0xa4, 0xe1,
+          0x0b, 0xe4, 0x17, 0x64, 0x65, 0x38, 0x40, 0x52, 0xf5, 0x6d, 0xd2, 0x33, 0xdc, 0x39, 0xab, 0x2d, 0x2f, 0xb5, 0x09, 0xa6, 0x0f, 0x0d, 0x38, 0xb7,
+          0xa8, 0x67, 0x6a, 0x9a, 0x0e, 0x42, 0x5d, 0x63, 0xce, 0x44, 0x13, 0x24, 0x0a, 0x85, 0xa4, 0xa8, 0x5e, 0x8d, 0x8d, 0x76, 0x66, 0x4b, 0x35, 0x65,
+          0x57, 0xa5, 0x13, 0x0d, 0xf7, 0x34, 0xda, 0xbe, 0x14, 0x0a, 0xe4, 0xd3, 0xa8, 0xdd, 0x28, 0xa5, 0x26, 0x07, 0x0d, 0xad, 0xbb, 0x32, 0x95, 0x6c,
+          0xfe, 0xc1, 0x92, 0x4d, 0x27, 0x6d, 0x5b, 0xb6, 0xbc, 0xb8, 0x61, 0x46, 0x98, 0x65, 0x88, 0x4d, 0x76, 0x48, 0xd3, 0x25, 0xe6, 0xce, 0xd2, 0xe1,
+          0x2e, 0xee, 0x9a, 0x48, 0xb7, 0x02, 0x41, 0x89, 0xcd, 0x13, 0x58, 0x25, 0x95, 0xd4, 0xd8, 0xec, 0xe1, 0xd0, 0xa2, 0x4b, 0x76, 0xa3, 0x74, 0xa6,
+          0x96, 0x27, 0x85, 0xbc, 0x77, 0x5d, 0x2d, 0x16, 0x63, 0xd3, 0xc9, 0xb1, 0x69, 0x9e, 0x4e, 0x8d, 0xcc, 0x2e, 0x14, 0x81, 0x61, 0x15, 0xc8, 0x0f,
+          0x52, 0x49, 0x2a, 0x83, 0x6c, 0x54, 0x84, 0x25, 0x6d, 0xd4, 0xdb, 0x19, 0x44, 0x44, 0x1d, 0x1b, 0xc8, 0x0f, 0xed, 0x76, 0x47, 0xa1, 0xfa, 0x1e,
+          0xf5, 0x74, 0xc2, 0x10, 0x18, 0x65, 0x67, 0xb5, 0x2e, 0x21, 0x1c, 0x3a, 0xed, 0x0e, 0x5b, 0x27, 0x6e, 0xb4, 0x1a, 0x39, 0x72, 0x06, 0x2b, 0x44,
+          0x3e, 0x9d, 0xe4, 0xa6, 0x2a, 0x0d, 0x83, 0x4d, 0x69, 0xdc, 0xc2, 0x4b, 0xe1, 0x63, 0xce, 0x11, 0x41, 0x2c, 0xca, 0x35, 0x95, 0xc4, 0x32, 0x12,
+          0xb7, 0x91, 0xc3, 0xc9, 0xdb, 0xe6, 0x90, 0x00, 0x17, 0x1f, 0x83, 0x69, 0x5b, 0x44, 0x69, 0x31, 0x93, 0x56, 0xe2, 0x5e, 0x26, 0x76, 0x95, 0x03,
+          0xc9, 0xd3, 0x88, 0x74, 0x01, 0x51, 0x2d, 0xf3, 0xb3, 0x6b, 0x88, 0x9f, 0x19, 0x1b, 0xcb, 0x3b, 0x3b, 0x91, 0x17, 0xf7, 0xd6, 0x74, 0x70, 0xa2,
+          0x40, 0xb5, 0x0f, 0x56, 0x49, 0xe3, 0x44, 0x1b, 0xb5, 0x4e, 0xb3, 0xbb, 0x39, 0xba, 0x90, 0x71, 0x51, 0x4a, 0x21, 0xf0, 0x5c, 0x78, 0xc5, 0xbe,
+          0x84, 0xe1, 0x57, 0x94, 0x8a, 0xa4, 0x1f, 0x14, 0x85, 0x2a, 0x03, 0xa4, 0x50, 0x5d, 0x73, 0x18, 0x15, 0x86, 0x08, 0x24, 0x89, 0x53, 0x07, 0x2e,
+          0x2d, 0xe0, 0x92, 0x72, 0xa4, 0x1e, 0x1f, 0xdf, 0x68, 0x7a, 0x42, 0x49, 0x18, 0x1d, 0x78, 0xe6, 0xee, 0x4a, 0xe7, 0xb3, 0xc9, 0x6f, 0x6c, 0x4b,
+          0x2b, 0x0f, 0x27, 0xe4, 0x27, 0x46, 0xda, 0x87, 0x1e, 0x28, 0xf4, 0x84, 0xb6, 0x56, 0x0c, 0x50, 0xab, 0x50, 0x4c, 0x88, 0x00, 0x54, 0x97, 0xc3,
+          0xb3, 0x54, 0xba, 0xc7, 0x3a, 0xa0, 0xd8, 0xe6, 0x36, 0x4c, 0xab, 0x28, 0x53, 0x12, 0x9e, 0xd0, 0x46, 0x77, 0x39, 0x05, 0x65, 0x62, 0x69, 0xf4,
+          0x25, 0xc3, 0xae, 0x99, 0xb1, 0x48, 0xf4, 0xec, 0x54, 0x28, 0xdd, 0xf4, 0xd3, 0x75, 0x56, 0xf4, 0xc1, 0xb2, 0x5c, 0xd6, 0x0e, 0xbf, 0x7a, 0xa6,
+          0x51, 0x98, 0x32, 0xd6, 0x33, 0x6d, 0xc5, 0xa6, 0xf9, 0x1f, 0xdd, 0x37, 0xc6, 0x0c, 0x11, 0x4f, 0xe9, 0x4e, 0xa5, 0xbe, 0xf2, 0x8e, 0x1a, 0xe9,
+          0xac, 0xfa, 0x6a, 0x9d, 0x72, 0xfe, 0xa6, 0x73, 0x0c, 0x7e, 0xe2, 0x55, 0x0b, 0xeb, 0x76, 0xc6, 0xb3, 0xaa, 0x3f, 0x4d, 0xa1, 0x2d, 0x6c, 0x32,
+          0xef, 0x24, 0x3a, 0xe1, 0x3f, 0x63, 0x2b, 0x9b, 0x41, 0x33, 0x74, 0xed, 0x70, 0x4d, 0xf6, 0x55, 0x49, 0xa0, 0x41, 0x56, 0xf9, 0x34, 0x76, 0x49,
+          0x8e, 0x40, 0x46, 0xb2, 0x33, 0xe9, 0x4e, 0xcf, 0x81, 0xe6, 0x95, 0xab, 0x2d, 0xc0, 0xcb, 0x98, 0xc1, 0x55, 0x90, 0x27, 0x10, 0xfa, 0xab, 0x3b,
+          0xc8, 0x57, 0xf7, 0x27, 0x44, 0xa4, 0xb5, 0x82, 0xa7, 0xa4, 0x3e, 0x14, 0x43, 0x5b, 0x8e, 0x4f, 0x68, 0x2c, 0x5c, 0x2e, 0xa7, 0xb4, 0x46, 0xc6,
+          0x77, 0x26, 0xa4, 0x13, 0x14, 0x94, 0x57, 0x3d, 0xef, 0xdc, 0xb5, 0xae, 0xe3, 0x5a, 0xb6, 0xbb, 0x7f, 0x21, 0x7f, 0xf3, 0xaa, 0x5a, 0xaa, 0xaf,
+          0x31, 0x62, 0x3d, 0x16, 0x25, 0x5c, 0x01, 0x85, 0x5a, 0xdf, 0xca, 0x37, 0x5e, 0x47, 0x23, 0x8f, 0xcc, 0x2a, 0x9a, 0x5e, 0xa2, 0x6b, 0x5f, 0x89,
+          0xa6, 0xad, 0x6f, 0xe9, 0x77, 0x53, 0x3e, 0xed, 0xd2, 0xc9, 0xd3, 0x95, 0x99, 0x7c, 0x49, 0xff, 0xbf, 0x4b, 0xca, 0x5f, 0x65, 0x34, 0x16, 0x13,
+          0x18, 0x7a, 0xcc, 0x0f, 0x92, 0x94, 0x93, 0xa3, 0xb9, 0x8b, 0xd1, 0x64, 0xe9, 0x00, 0x28, 0x16, 0x74, 0xfb, 0x7c, 0x91, 0x90, 0x96, 0xe8, 0x06,
+          0x09, 0xcf, 0x09, 0xff, 0x8c, 0x44, 0xe6, 0x82, 0x91, 0x80, 0xb7, 0x5f, 0x27, 0x7d, 0xda, 0x80, 0xcd, 0xfa, 0xe3, 0x95, 0x52, 0x59, 0x22, 0x56,
+          0x3b, 0xe7, 0x2c, 0xc5, 0xb4, 0xcb, 0x21, 0x47, 0xb7, 0x7f, 0x1e, 0x9c, 0xeb, 0x7a, 0xb1, 0xd1, 0x94, 0xdd, 0x74, 0x65, 0xa6, 0x15, 0x82, 0x9b,
+          0xc1, 0xe5, 0x61, 0xd7, 0xe9, 0x13, 0xa2, 0x89, 0x16, 0xc5, 0x23, 0x27, 0x34, 0xb4, 0xa2, 0x8e, 0x4c, 0xb1, 0xe3, 0xaa, 0xa8, 0xe3, 0xd9, 0xe4,
+          0xfd, 0xb6, 0x15, 0x99, 0x54, 0x97, 0x54, 0x76, 0x32, 0xe2, 0x91, 0xec, 0x50, 0x43, 0x44, 0x76, 0xea, 0x0e, 0x5a, 0x4c, 0x33, 0xb6, 0xfe, 0x53,
+          0x9f, 0xa2, 0x1e, 0x94, 0xba, 0xcd, 0xb1, 0x12, 0x47, 0xe3, 0x3f, 0x09, 0x94, 0x7b, 0x18, 0x50, 0xf2, 0x46, 0x6b, 0x5e, 0x2c, 0x89, 0xdb, 0xef,
+          0xae, 0xdf, 0x6c, 0x62, 0xde, 0xea, 0x02, 0x00, 0x23, 0xe3, 0xb7, 0xb0, 0x86, 0x7c, 0x14, 0xdf, 0x97, 0x3d, 0x21, 0x03, 0x4c, 0xc3, 0xfc, 0xae,
+          0x65, 0x35, 0x61, 0xa4, 0xfd, 0xc6, 0x9a, 0xdf, 0x63, 0xa4, 0x08, 0x31, 0x7d, 0xb9, 0xd9, 0x75, 0x43, 0x8e, 0x5b, 0x6e, 0x36, 0x79, 0xd3, 0x06,
+          0x02, 0xc5, 0x21, 0xd7, 0x41, 0x72, 0xaa, 0xbd, 0xcc, 0xc6, 0x61, 0xcb, 0x50, 0xc2, 0x6c, 0x9a, 0x04, 0xf4, 0x8b, 0x41, 0x16, 0x2b, 0xb4, 0x8a,
+          0x48, 0x2d, 0x5b, 0x5e, 0xff, 0xe1, 0xbc, 0xaa, 0xf7, 0x57, 0x98, 0x7f, 0x53, 0xd9, 0x6e, 0xed, 0x3d, 0x2e, 0x9f, 0x5f, 0xa2, 0x3c, 0x19, 0xbf,
+          0x58, 0x7a, 0x6e, 0x77, 0xf7, 0x86, 0x7c, 0x70, 0xd7, 0x9f, 0x27, 0x3f, 0x43, 0xbe, 0xd5, 0xaa, 0xbf, 0xb2, 0xcb, 0x5f, 0xbf, 0xe5, 0x6f, 0xf2,
+          0x5a, 0xbf, 0x2d, 0xb9, 0xc1, 0xef, 0xbe, 0x9e, 0x3c, 0x1d, 0xfc, 0xcd, 0xdf, 0x43, 0x9e, 0xd5, 0xaa, 0x5f, 0x07, 0x3d, 0x42, 0x42, 0xab, 0xbb,
+          0xfc, 0xe3, 0x65, 0x7c, 0x25, 0x50, 0xff, 0xf8, 0x1b, 0xdf, 0x2e, 0xf5, 0xbf, 0x75, 0x58, 0x1e, 0xba, 0x7e, 0x2a, 0xf5, 0xc7, 0xb3, 0x9b, 0x8f,
+          0xb0, 0x73, 0x5c, 0x7f, 0x62, 0x42, 0xff, 0x80, 0x91, 0xff, 0xb3, 0x32, 0xfd, 0xeb, 0x1e, 0x3d, 0x93, 0xe8, 0x87, 0xfb, 0x9f, 0xa0, 0x7e, 0xc5,
+          0xf8, 0x07, 0x22, 0xe2, 0x0f, 0x29, 0xa7, 0x3f, 0xd9, 0x9a, 0xf3, 0x23, 0xda, 0xcb, 0xe9, 0xfc, 0xe3, 0x62, 0x35, 0x54, 0x12, 0xc0, 0x10, 0x48,
+          0xa9, 0x51, 0xd6, 0xec, 0x1b, 0x75, 0x3f, 0xbc, 0x70, 0xb7, 0x80, 0xfa, 0x77, 0xe5, 0x42, 0x18, 0x81, 0xd1, 0x60, 0x44, 0x02, 0x51, 0x91, 0xd4,
+          0xfb, 0xd0, 0x03, 0xc6, 0xe8, 0xd2, 0x66, 0x69, 0x95, 0x1a, 0xa9, 0xf1, 0x71, 0x55, 0xdd, 0xdb, 0xc3, 0x99, 0xd4, 0x4c, 0xf0, 0xb7, 0x6f, 0x24,
+          0xdf, 0x62, 0xf2, 0x05, 0x92, 0xa8, 0x84, 0xcf, 0xf3, 0xb4, 0xc6, 0x67, 0x13, 0x28, 0xcd, 0xe9, 0x0e, 0x2b, 0x40, 0x57, 0xeb, 0x3a, 0xc6, 0x2c,
+          0x33, 0xde, 0x4a, 0x8d, 0x77, 0xf9, 0xfd, 0x85, 0xa3, 0x3d, 0xe2, 0x4f, 0xc8, 0x4b, 0xab, 0xad, 0x8e, 0x50, 0x43, 0xe8, 0xcd, 0xc8, 0x57, 0xec,
+          0x18, 0x22, 0x4a, 0xe4, 0xfc, 0x42, 0xdd, 0x03, 0xb0, 0x34, 0x66, 0x2f, 0xf0, 0x51, 0x81, 0x0b, 0x2a, 0x5f, 0x43, 0xba, 0xe9, 0x52, 0x55, 0x32,
+          0x2b, 0xdf, 0x79, 0x31, 0xa0, 0xd7, 0xac, 0xb4, 0x55, 0x84, 0x27, 0xb0, 0x2b, 0xd0, 0x49, 0xfc, 0x4c, 0xaa, 0x76, 0x84, 0x1e, 0xbf, 0x63, 0x93,
+          0x25, 0x20, 0x2a, 0xa9, 0x45, 0xd2, 0x12, 0xb7, 0xd8, 0xfe, 0x9c, 0x02, 0x79, 0x7a, 0x14, 0x9f, 0xc4, 0xbe, 0x4c, 0x4c, 0x80, 0xf5, 0x98, 0x59,
+          0xcd, 0x00, 0x97, 0x68, 0x96, 0xf2, 0xeb, 0xc5, 0x93, 0xc3, 0x79, 0x07, 0x50, 0x5e, 0x83, 0xd6, 0xc3, 0x6b, 0x44, 0x9f, 0xed, 0x9a, 0x41, 0x5e,
+          0xa7, 0xf0, 0x1e, 0xbf, 0x75, 0xa8, 0xb8, 0x13, 0xf0, 0x17, 0x35, 0x8a, 0x3f, 0xb1, 0x3a, 0x13, 0xc7, 0x16, 0x96, 0x2a, 0xbd, 0x44, 0x62, 0xac,
+          0x12, 0x64, 0xc7, 0x7a, 0xda, 0x7e, 0x85, 0x9a, 0x57, 0x48, 0x20, 0x5b, 0x9c, 0x0c, 0xd9, 0xf9, 0x8c, 0x0f, 0xaf, 0x78, 0xdf, 0x14, 0x4c, 0x1e,
+          0xd6, 0x8f, 0xd3, 0x3d, 0x68, 0xdc, 0xe7, 0x1e, 0x27, 0x9e, 0x97, 0x71, 0x38, 0x13, 0x00, 0xa9, 0x9f, 0x82, 0x1f, 0x2f, 0x42, 0xcf, 0x8a, 0xd5,
+          0xaa, 0x6e, 0x55, 0x2f, 0xd9, 0x19, 0x24, 0xbc, 0xe0, 0x37, 0x0d, 0xda, 0x22, 0xad, 0x7d, 0xf6, 0x01, 0x8b, 0x3f, 0x37, 0x88, 0xf7, 0x29, 0x32,
+          0x02, 0xeb, 0xa2, 0x68, 0x17, 0xc0, 0x9a, 0x2c, 0x3e, 0x18, 0x41, 0x03, 0xbf, 0xb0, 0x66, 0xd0, 0xca, 0x44, 0x4f, 0x33, 0x06, 0xaa, 0x95, 0x54,
+          0x68, 0xbe, 0xe8, 0x34, 0x46, 0xfb, 0x42, 0xc8, 0x38, 0x9d, 0xca, 0x63, 0x02, 0xb0, 0xe6, 0xf3, 0xa9, 0xd3, 0x47, 0xaa, 0xb6, 0x60, 0x31, 0xfd,
+          0x43, 0x35, 0x27, 0x0b, 0xe3, 0x1a, 0xfa, 0xf3, 0x54, 0x89, 0xc3, 0xf9, 0xcf, 0xb1, 0x7c, 0x79, 0x64, 0x30, 0xd4, 0xc0, 0x3b, 0xa9, 0xd2, 0x01,
+          0x42, 0xcb, 0x57, 0x98, 0x97, 0xbe, 0x7a, 0x1e, 0x9e, 0xcf, 0xee, 0x24, 0x9a, 0xb3, 0x65, 0xd6, 0x84, 0x68, 0x60, 0x08, 0xda, 0x0d, 0x48, 0x98,
+          0x82, 0xeb, 0x14, 0x14, 0x51, 0x02, 0x19, 0x46, 0x0a, 0xa9, 0x5f, 0x34, 0x61, 0xc4, 0x98, 0x8f, 0x26, 0x03, 0x4c, 0x30, 0x29, 0x4b, 0x06, 0x93,
+          0x58, 0x8a, 0x32, 0x22, 0xdf, 0x4b, 0x20, 0x8c, 0x78, 0xec, 0x4d, 0x93, 0xdc, 0xc9, 0x8b, 0x2e, 0x5b, 0x2d, 0x16, 0xa6, 0x2f, 0xbd, 0x4b, 0xe7,
+          0x8d, 0xb5, 0xa8, 0x4a, 0x88, 0x62, 0x27, 0x01, 0x6c, 0x8c, 0xb3, 0x15, 0xd9, 0xf0, 0x2a, 0x60, 0xcf, 0x15, 0x16, 0x85, 0xd2, 0xbd, 0x40, 0x26,
+          0x92, 0xc4, 0x00, 0x2e, 0x9d, 0x9d, 0xc1, 0xb1, 0xed, 0xe6, 0x09, 0x4b, 0xbd, 0xe8, 0xd6, 0x89, 0x5a, 0x4b, 0x6e, 0x4f, 0x1a, 0x5d, 0xc7, 0x8c,
+          0x70, 0x9b, 0xd1, 0xaa, 0x0d, 0xce, 0x0d, 0xc7, 0x38, 0x7f, 0xcb, 0x67, 0xc0, 0x73, 0xdb, 0xd9, 0x38, 0xeb, 0xfc, 0x9f, 0xed, 0xb9, 0xfd, 0x3c,
+          0x5a, 0xe4, 0xf0, 0x58, 0x56, 0x7a, 0xe9, 0xaa, 0xe6, 0xaa, 0xc7, 0xcf, 0x7c, 0x3e, 0x54, 0x5d, 0xbe, 0x16, 0xab, 0xbf, 0x7c, 0x1b, 0x97, 0x5a,
+          0xc8, 0xf6, 0x32, 0x30, 0x70, 0xc9, 0xcd, 0x2c, 0x57, 0x6a, 0xe5, 0xf5, 0x65, 0x35, 0x45, 0xef, 0x7c, 0xf7, 0xc9, 0xa0, 0x35, 0xe7, 0x0c, 0x0c,
+          0x44, 0x29, 0x7f, 0x60, 0x63, 0x77, 0xfe, 0xa8, 0x29, 0x93, 0x8f, 0x8f, 0x87, 0x36, 0x68, 0xfd, 0x10, 0x96, 0xa7, 0x5d, 0x19, 0xf9, 0x05, 0xdb,
+          0xb6, 0xa8, 0xd4, 0xd3, 0xfa, 0x1c, 0x65, 0xf2, 0x67, 0x10, 0x99, 0x68, 0x75, 0xa0, 0xa8, 0xc6, 0x0c, 0x1f, 0xdd, 0xd0, 0xdc, 0xaa, 0xac, 0x55,
+          0x9d, 0x04, 0x67, 0x36, 0xff, 0x82, 0xa5, 0x69, 0xc5, 0x4d, 0xde, 0x90, 0xf8, 0xa8, 0x74, 0xf5, 0xc0, 0xf0, 0xa4, 0x36, 0x14, 0x2f, 0x9a, 0x96,
+          0x36, 0xdc, 0x36, 0x2b, 0x40, 0x2f, 0xd5, 0x3b, 0x8e, 0xc0, 0xed, 0x34, 0x37, 0x35, 0x5b, 0xb8, 0xce, 0x93, 0x35, 0x73, 0x44, 0x56, 0x79, 0x5f,
+          0x48, 0x29, 0x59, 0xb8, 0x5a, 0xdc, 0x1c, 0x6c, 0xce, 0x20, 0x5d, 0xbd, 0xf1, 0x31, 0x16, 0x91, 0x3f, 0xe2, 0x8b, 0xdc, 0x07, 0xc3, 0xe6, 0x9c,
+          0xb3, 0xf1, 0x22, 0x7d, 0x89, 0xce, 0xc0, 0xd0, 0xe3, 0xcc, 0xf6, 0xd2, 0xa8, 0xae, 0xa6, 0xe6, 0x26, 0xf3, 0xfe, 0x2d, 0x2c, 0x8d, 0x68, 0x54,
+          0xdc, 0xa4, 0x62, 0xd3, 0x60, 0xa1, 0xed, 0xd2, 0x00, 0x13, 0xf7, 0x67, 0x60, 0x53, 0xe6, 0x8d, 0x4d, 0x73, 0xe8, 0xda, 0x80, 0xf2, 0x04, 0x04,
+          0xfe, 0xfa, 0xb9, 0xc6, 0x11, 0xcd, 0x0e, 0x82, 0xbd, 0x68, 0x46, 0xf8, 0x43, 0x11, 0x04, 0x5e, 0xdc, 0xc2, 0x82, 0x1a, 0x11, 0x2b, 0x96, 0x93,
+          0x03};
     };
 
     struct JasmineJs {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{50056};
-        static constexpr std::array<uint64_t, 6258> data{
-          0x55fb87646420b70d, 0xa002a5fdee698f99, 0x88c0790024c56577, 0x00bc0d37aebe0e28, 0x5a8686c64510d6ac,
-          0x1d0e07e79a6c6aa3, 0xdf865a30848f4580, 0x3b3d448aece50b19, 0x8cad53d2613ae87c, 0x285828a23af80fa7,
-          0x8ae8cbfcb2888a33, 0x0968d896bd93eb1c, 0xc7f3d8cdbfd05b72, 0x2d69bb05c93fd202, 0x0a2c9fdf3bfd7f7e,
-          0xbe2e990011265ef3, 0xf4b4e96acfd28cc7, 0x241d13ba537f927b, 0x7fa97dfd1af718ed, 0xeaa9063be9b63c8f,
-          0xa9d3931e97dd931e, 0x1ad9604f12248ac4, 0x923e30bc5f4be54b, 0xd04bddc8d67cf353, 0xd20975a980646f82,
-          0x725099fabd51ca6f, 0xe52813bac8d8483e, 0xb3ad43099c335b83, 0xe55b1c08114e998f, 0x51ece7d8490baac2,
-          0xa29065259ddf3554, 0x4c9dc94b90355259, 0x4a6fe72f4917840d, 0xf0fc34d5feeecb69, 0xf637d180ac00ffa8,
-          0xada9db9d6dcd7068, 0x0ea530a6c6c4ccb3, 0x256f81af7e69223a, 0x54757b0b88a15142, 0x314f8dd3d7ab7577,
-          0x4b3afff56bd6ffd7, 0xcfd75118c9d79acb, 0xa597d5f4064950af, 0xd00accbca5a6b43c, 0xea06dca9a6103691,
-          0xfc84fd62699f77e7, 0x94013532322166ae, 0xa3e0abbb5f3f7f8d, 0x4653f5257dd5ada4, 0x0bfb2fa4d0dd23af,
-          0x670390d6490e31a3, 0x9499cb00190133fb, 0xffeffb96558fce16, 0x4279a30c5b098aac, 0x1c2184e356dc7bce,
-          0xdd4d001f7f552010, 0x589311885c4b9125, 0x48565537c91ac599, 0xbbcf3ef7bd2f8048, 0xa864212233a94bb4,
-          0xd0da1ccf16da1dd3, 0xf908d2c896ca9b19, 0x28b7d107ab59e61d, 0xc66a68d66889af3a, 0x642161f8cbe774b4,
-          0xaddb30adcb6e9a76, 0xf33433ad0d42f01b, 0x1b8c41f26dc3b4ce, 0xdd34d9244d3bd31a, 0x10209e574276f796,
-          0xa1d97fcfd929fba7, 0xe56e638300512d6c, 0x4c91b30cd3fadf74, 0xda743657dfdfb141, 0x08210e632e41e61f,
-          0xa8447e3c164fefe1, 0x99c64fecf97fbcaf, 0xc38036e37536a120, 0xf90d476c28bbd8a4, 0x8e99902d0b6cff89,
-          0x4f0b1291f226ccad, 0xfc502fbb4257899c, 0xdbbd61cbc4103765, 0x4d6a6aeb59627de8, 0xcca953ad914252c3,
-          0xc488f7d496db58b5, 0x456db93dc2b4f817, 0x8b6128086b67c971, 0x67addb7ce135adcb, 0xcf0d5a0359939d99,
-          0x152f23e2cd1ebb7f, 0x7c12d14d164a3ed3, 0xe3240c4ddc7d08ce, 0x2ad06fd1dc18c943, 0xf786e3b339ab376c,
-          0xaface51f22796b15, 0x4f17ce231cd7cd8d, 0x64775421c5f8c02a, 0x94544b08ae08b375, 0xc9e3d31966ab5e86,
-          0xa4a5a116022ba749, 0xf4d1c1c6def4e4d8, 0x67a4b74dabefb1eb, 0x8e7bd675a4fadda3, 0x6a34f9897757582f,
-          0x7f62c00edb50c6c8, 0xe2dd3b6607644ba8, 0x41c1aba1c3404551, 0x80bb62b83ace2969, 0x0d34788e0bddd5ac,
-          0x2dac4e0d7706916f, 0x5e192f6a90e8a728, 0x8c5aad8ed641d37c, 0x285fe2ed4fbdeaa9, 0x4db356e5acb38d05,
-          0x47f6b767f3a295d0, 0x4f1ee3e25bd2fbb1, 0x39ce72518de94085, 0x59e71feb87f6f289, 0x080586e8806451f3,
-          0x8acba874f57632b8, 0x1a7ec02fd9fe349a, 0x8cfe20fa755ac6fd, 0x0f1db6dcbc03145a, 0xfedc91465cd35646,
-          0x91bd2dfb3ef4e921, 0x50395fb3ef0ba3f6, 0x18d9c0bf92d72172, 0x0aa57b2f714c6034, 0x5ee43a4a98f65f52,
-          0xb22e369c4d79bc8d, 0x06fe5c6ca3c5368a, 0x03f81afbed45b9a5, 0x7dd3f58f5fc041df, 0x49a7c3f2d8ffd532,
-          0x1018c0a5c107ef27, 0xc0f47d03c857ad6d, 0xf3255114ddd38abb, 0x398df68653cf602a, 0x348ead7cae1b5c31,
-          0xa011669966a9dfff, 0xee832f164033cd54, 0x07ab64fdda1743a6, 0x555f85bfaf133a55, 0xf46560c4066f562c,
-          0x7ca05ead7ebaefc6, 0x68c683233c4abd73, 0xe2d6c675caf5f3fb, 0xe08d59d50d6d870f, 0x00dbdea3d9d819a2,
-          0x0568926b9776771d, 0xb1a6ce1528ee0b48, 0x04d26776554f5a15, 0xe224941daaafddb1, 0xc1e56be7e87ed727,
-          0xe7e0e40a7f892f26, 0xab9f47bee7ca4d7c, 0x069ad17da3113459, 0xd52add6cef80362b, 0xdd753aefe18f73a7,
-          0xbd528dc60eab92f4, 0x2aa6ec628bdb3841, 0x77c37ed65c261dd7, 0xf346dadd4989bf5e, 0xef1b1e4621ba37ec,
-          0xe7cf4773305bf997, 0x5adfdaf060621954, 0x02b75c7e1cf4dace, 0xded3ce10b6cd926e, 0xb3bdc9e5397d661b,
-          0x80fddacb49438bc1, 0x38540203b79bf2a8, 0xb3ec622dd52f0557, 0x8c14a8042f4cec36, 0x668eebd1fd4a4704,
-          0xe0f151437dc6783c, 0xd6713502a2756da4, 0x177b1dfb33f6a52c, 0x6123b5a2db6b3036, 0x94643aa18b017db2,
-          0x7bce0e5f870e70c3, 0x8a6cac54903febcd, 0x54c444c5d019151a, 0xd878ad8af3fbbbd7, 0x40b83d0eeb74ffaf,
-          0xa21afe4af5acc636, 0x59adbe1bd3ec0cc6, 0xea6cb89228e80b2b, 0xeb47211ea8741e6d, 0xa09620685d412abf,
-          0x3ec576288a8f9b8c, 0xf128bff1672564f9, 0xca774b0e21474a6c, 0xa4526214b2146383, 0x4ac62265365a942a,
-          0x2985b5541f9dae3e, 0x371580f29a4b596c, 0x40eb0f9d15adc97e, 0x740da145fdab1d9a, 0xd59db7c4a2be1fff,
-          0x874533021baab3e7, 0x97a3e5a730fe4b86, 0xa337de44b0a810f1, 0x43e2206d655ff4b1, 0x215d36a68b137190,
-          0x4ea884069c7733bf, 0x43493cdbf8fe3f81, 0x36deac0254537118, 0x7f595519d4d11eea, 0xfaab10f5f8b4fe7f,
-          0x0229f15669cc4873, 0xdd29b4554a230e39, 0x566343a5938274db, 0xce55d2f4dad448f6, 0x469a49910c796f04,
-          0x69f7ddbdc62b06ea, 0x48db4945fcbb5477, 0xef1752e247a1624b, 0x180b9555ae5c665a, 0x907ba012e4864765,
-          0x3d3cc5f3f420357e, 0x58f570e36d9d8fff, 0xd85b7baf34731459, 0x7d2f83fe8a5672d0, 0x673bf951e7b2fc13,
-          0x6c0bb076a5d089fd, 0xfcb51eba7fd37357, 0x2f3e0b3c7a792759, 0x2b0b51c7be54835d, 0x7be85c9f04b13cd5,
-          0xa3e070ed7fff758d, 0xbf2af835aef9fb31, 0xe5f831696c4d23f5, 0x4ac2e9d44a201758, 0x4bc1aee855eb0d2e,
-          0x8a1c7ca1738376e8, 0x9d5f65ed197f2b59, 0xde151f5470aee481, 0x42a382bce27aee95, 0x0a517c7c98e43cdb,
-          0x0bd161ee79b41205, 0x65a0a7d02eb24956, 0xd19fcf5966b9b311, 0x33feba3de7de8b87, 0xf34a120df63682ca,
-          0x849942ee186f5761, 0xaf13449da4e43931, 0xed8efd50282e0b99, 0x65f82cc4b2c60d3e, 0xa96a1586a49e42fd,
-          0x592a5cc957a5e44c, 0xfe9500ea7041ec8b, 0x4b9d2876e9adc656, 0xdae94702f5e1c79a, 0x43c52a01bd086ccc,
-          0x6b72d4c26cc09bcc, 0x7a34f3964a845ead, 0x4e2d9694028471a9, 0x7bb8ca0b6ca76747, 0x034fe134f6d94df3,
-          0xa7686daba7645c37, 0xdbcd11af48259780, 0x284c10fa3c74da73, 0xd3340130315abaeb, 0x6dc7dd0836e68f37,
-          0x005cbb1b1aef57de, 0xdb3a90b7df1dc0a4, 0xa6f0241efc753fc4, 0xaf6378e8b307e4e6, 0x11fee0eedfdbbcfe,
-          0xf287baffb53999fc, 0x548705d2a8033381, 0x6e0cedb70ff6e930, 0xe6430902bccd454a, 0xb17e38df11e8c141,
-          0x47181ed131526735, 0x8eb90632dc51fb2e, 0xfb45a938147532c2, 0xa9d3aa831dc22fc2, 0xe63d709d778e9801,
-          0xa84f79dc3431e403, 0x9c0f6c31feae50ae, 0xde176fcae8ac8780, 0x72a04ea37c84d5cb, 0xe77cff779c636978,
-          0x15bbefe49cef18a2, 0x99f413b4dd3b828b, 0x5f56fd87ea688c84, 0x2b13be7fb42f20dd, 0x079a6604f894e97f,
-          0x421a85506d984a84, 0x946c1e90f5fa6704, 0x29cf1fde9f0619f6, 0x06df1a18a689db32, 0x73a28f61828f077f,
-          0x1ba79bc89858733a, 0x16a331cda299996b, 0xb31d2a22348e165e, 0x86cdf568a038fbc3, 0xd9f55f1b2ab300d6,
-          0x9cec40ec843b8540, 0x7f91fd650e2e1e53, 0xd3d61c8da513149a, 0x1055f18daee88129, 0x457bd61948716202,
-          0x516d2013bed39ca2, 0xc8372c0ed262ded2, 0x1f985baedc3173c5, 0x2303a813a0753c7a, 0xbc439472ae953c6d,
-          0x53e738277be833c7, 0x1e2a9e955808cd06, 0xb3d2b01b2437f3a0, 0x2565a40e75b5f309, 0xfb883f069063ab72,
-          0x8c45970523c97180, 0xd3011468b4528a2e, 0xf1c46ef5ebb9feb4, 0x8313a9dfaa5fd0c1, 0x541dd54e9d7df0ab,
-          0x374ffeaa0c009a66, 0x1e96824c147cabd2, 0x38e3072dd12e0410, 0x16cce5eba7e900ef, 0xa85d549eb78281fe,
-          0x7b2be14fbfc1594d, 0x8c83fc0e8fddde2e, 0x4c1f6213757f4e35, 0xc05dcb1a06170627, 0x0e330c2e34de1640,
-          0x073387202a2ff39a, 0xcb7f341a520685f5, 0x9538e94e8ef61ad1, 0x2b9e823d35d6173d, 0xc435236d4fc8e38f,
-          0x3b10bbf07175b00d, 0x73b60a48c94318e0, 0x2f46299a52df5561, 0x32878b41f45da69d, 0xd74623103dd88406,
-          0xbc5f4f72bef13c7c, 0x3206096066190e44, 0xf6f010cc637bfbcd, 0xae2ddc8a43805173, 0xffccb863f154fdd2,
-          0x7cab0813685f7de5, 0x60646d4c6305cf52, 0xc087f5e4f0d87414, 0x2397c9ad003734bb, 0x9bb3c6461065d68b,
-          0xeca54bcc323e1566, 0xe920ebcf71f313f9, 0xcecca49e36ab6422, 0x88f696dada38c744, 0xaf662af5aa6df089,
-          0x41c3681abe2f6cf6, 0x051ed40e181fb2a7, 0x4cc83937c74744a1, 0x1e3fbf0e8f83c7f3, 0xf3e8f9ee8cd6fbaf,
-          0xedd5e5af7428f1e9, 0xf515f6e6b7f3bdb9, 0x5c374db6ea179ef9, 0x0dcfa1c7c7eb1fed, 0x80fb8114b5360b9a,
-          0x3af85ed8c0ab40f2, 0x7cb184eae13a1079, 0x84fae30009945f27, 0x9240d22dac4d5a1d, 0x1730c2be4ef706f4,
-          0x265ef0c040bd34ca, 0xf447bb0e96000011, 0x7ae302b5363e5f21, 0x1d35362c5afd6467, 0xadb1e44eaccd2770,
-          0xf14d24d9cffbfd5b, 0x71f2e17646596181, 0x156532cf9b7ffcba, 0xde43af45963114d5, 0x13f1806bd37d6119,
-          0xf392fd089da194e6, 0xb5194c5ec37c837a, 0xbacc744a7ef5c681, 0x3a31e1914749d0f1, 0x0936e8ee92fa600a,
-          0xe5bb0c1a82209a8a, 0x508145332afceffe, 0x1655087169da75ff, 0xa8059532aed64dca, 0x289a2c2cedac41a6,
-          0x3416a14c0b72cd84, 0xd58ef39b25018e27, 0x8ea9e67906fdbc15, 0x31c29fff2305d932, 0xb3941e6517e566a6,
-          0x5457f441535dcc18, 0x2d638b8912f8af70, 0xe0c07fe7f7a070a2, 0xbbfb1874c76887d6, 0x09c477da91effef1,
-          0x5dcf81bf31bf44b5, 0xddf45949dd5f72c9, 0x8328d73ef8fecf6e, 0xf4414add6063958b, 0x3c0adac9ce77dbfb,
-          0xcd351a07ce442def, 0xd26f8b9278f1ffa0, 0x850e336153a10a1e, 0xb72daa6116dd4530, 0xdac00bf7d391fd3c,
-          0x73a56ee5072a64cb, 0xbe22be6cfc05552e, 0x2fab1f9df2ff008d, 0x99fe6ea69acfb9a7, 0x136a73f8beedf78e,
-          0xdfc17fec3e10d76b, 0x333eabaee4cd2f66, 0xd589b6adfc20f839, 0xff249b5127b8eb30, 0xfbe97f50da260585,
-          0xb9d7577ee8c8b7a9, 0xdd1cc37dde7cd0b0, 0xfb6c8f442f3a5d90, 0x6cf6f02be7956e91, 0x0358d64afe7b866f,
-          0x401ed99d42abc56e, 0x586dd3c2dba5b7c4, 0x146b7c6a80cc11e8, 0x10d84c135b5797ec, 0x8698ae5adb0f892e,
-          0xae54dde53bb3755e, 0xddee9448663000b0, 0xb8fc70903b815eeb, 0xacbd886f55632be1, 0x19e540687e311afc,
-          0x595cbebf3a5b1746, 0x8c96979f6af79cd0, 0xacc669b65e148eb3, 0x7a078b9bada3d369, 0xae8f79ce58bd6572,
-          0x958a285a0688e52a, 0x6abc108b29905355, 0x3a83d549b6a07baf, 0xbe289ed43f51a9d5, 0x5687b4b0972d7ae3,
-          0xe7ffa1fa227beb1e, 0x2148c0e80776d477, 0x68147be9b3c28932, 0x9c53cb3851d1b47c, 0xd320e67ca715d025,
-          0xdaa26141b3d445d8, 0xf626a634a292a8ef, 0x7f9b471704350c52, 0x7867de5cf79f37a0, 0xed0fa31ff31c6fe0,
-          0x84c0d80f63e33a94, 0x4d993ffe5d2f606e, 0x6cf0c346e4bf79f0, 0xe16978d54fbc65c7, 0x5efd9b5aee06615f,
-          0x7727b6a23cddc34c, 0x8d3c7c5ed237111e, 0x951c510764559d6c, 0x3353031b668eedfc, 0xd663c7a420db6e78,
-          0xb9cd06b741fbcd50, 0x75a49506d0096c3f, 0xada37d39546a14de, 0x3cb9d2633d558b6c, 0x9d577830a1c34389,
-          0x1c7c3958e5b9647c, 0x314889b7e3d0b47c, 0x3361cb269f1f5411, 0xb777181cfac2bcca, 0x6f166486ed0c7055,
-          0x8693d194211ddc9b, 0x764415a2ed336d56, 0x00ae409decc57bbf, 0x2765ecd5ef17198f, 0x51ee10bb6a38af90,
-          0xa423dfc8e71c3e62, 0x70a07b820e1a73be, 0xc0d48116c4a454ac, 0xa05347b3a591054c, 0xd4624224338b0e2e,
-          0x761c66b6c4146978, 0xe38f6642fc11840c, 0x30f0cd8337644edc, 0x15331c67385be292, 0xe83c7c0ec517c09f,
-          0xf605d3df24783d02, 0x7a201c9b2ccc7a76, 0xd896bb273a6688d8, 0x6fda1ca76ead44a3, 0xb803d013964b15e6,
-          0x37131e9958d37196, 0xd35714e555d82b1d, 0x8134ad67148f5e99, 0xad6d98263a6908df, 0x4857742adbc137af,
-          0x384e2e85db1ac714, 0x6f6e974398853fbb, 0xc504cc92c2328758, 0x126ad8e9cabb8c88, 0xef6d4829ffce5397,
-          0xf7d64fa98f57f9e9, 0x87abe270ca649f4c, 0xf0fc8d77fcac41b5, 0x1bb11210a78e8bff, 0xc118f8db620cfefb,
-          0xf77905febd8f0196, 0xbdecd7326a9cc770, 0x42230e297e7d3de4, 0x3b759b3d6fdda9c4, 0x78396cd306fe5b99,
-          0x66a185274c73bc35, 0x53183cdc2493a27f, 0x6d357759bd4c8c36, 0x87d0a387cd73f994, 0x9a9ed127a780f4e6,
-          0xbf523cddbc2f2628, 0xc7dc0f3656b9d5f1, 0x8db9aae486c55378, 0xc66bfb0062d38e63, 0x650ad4083b948ffb,
-          0xcab23faf0a2ccc36, 0xa8d1c63e48ff5331, 0xd2430217027de3b9, 0x31bb2cbf9d678e44, 0x6ba43540bed6fe4a,
-          0xcdb053b8dbdbd1e8, 0xaaa640dd0525321f, 0x068f54613a09aead, 0x022770d13d241203, 0x380318a86548d4a3,
-          0x3b48b7718f85fd4f, 0xdab027fed53157d1, 0x77c97793797b1679, 0xfb9a569bfadcc551, 0x1c2f577b0dc32222,
-          0xe1a6af91d7e31ae7, 0xef2f09edaaa72fdc, 0x21945bcaddc17a4a, 0xf978fa01d1359440, 0x0deb60d448d30693,
-          0x92ca1e4ff530f8cb, 0x3ab6edbedf47acd7, 0xbce860750eaecd49, 0xa65b27c7b1608734, 0x0366d498248b8051,
-          0x1ac526a165c915a6, 0xc499ad81c418374b, 0xa384d15cbef3858b, 0x8679b530163a1067, 0xc1de3e4225528aa7,
-          0xba7402b88246c78e, 0xf99bdd15f4f836eb, 0x3db24c469a4675d9, 0x89be482a054a2cd2, 0xa9dd0e27d4760bee,
-          0xa23c78fc4fe33ba5, 0x55fb3d10d64bef25, 0xea322b54fcf0706c, 0x61478d27fac1c842, 0xa860a9d9f1f2501e,
-          0xde7e2c9fa2eac017, 0x607f82856742e3bb, 0xdf6a2c36c36a127f, 0xac5d12fda054e7b8, 0xbc0d239ec5621339,
-          0x912f83ca4fe8cb64, 0x7efb7d5adb0d3c2d, 0xa7211f3493068e32, 0x0d5b9e7142fec589, 0xca7d3a07bd62202a,
-          0x0637ee91235a9041, 0x088b7038e5f0a833, 0x040e1245befeb11c, 0x666c22057f99bfee, 0x89f3bd3b93ee7e84,
-          0x7d30b3c0180daf65, 0x66004343d0ec3e73, 0x8246852c969100cf, 0xb06e34c670690e5a, 0x59775963f1981647,
-          0x02e769963771934c, 0x743d21a13df1a821, 0x1e64c44c3af25bcd, 0x54038a7565e1976a, 0x97b095a228db2c4e,
-          0x4642009b54ff705e, 0xb6b6e7cb39242c5d, 0x371aa84ffa68c611, 0x331ef7398d4cb036, 0xe0fd4d0462a5d1e4,
-          0xb51307b81dbeb8f4, 0xf62abc93e0d79a60, 0x85f27192f521ca5e, 0x3df2cbfae5a696be, 0x034e2e007cc26067,
-          0x95c737b2911d054d, 0x1a3e662ec2354f09, 0xdde9ca2172b656b6, 0x8e7e4cc0804bda0f, 0xa85beb10791ed0ed,
-          0xb81e1e0f42148578, 0x2a6897f5fcd72407, 0x02e704481bb10e71, 0x1dce3121245acb4f, 0xce0509416190ee93,
-          0xf801e997131e07d1, 0x17eac72364189ddb, 0x8c64ea1aeda15954, 0x1d50768a9ef3e6f3, 0x98b8abcf8ea7b166,
-          0xae1022a21a9de737, 0x01fb9cdbd8ea7620, 0x7515fd03abb305f8, 0xb8543baa4038f633, 0x679ef610dcc05c2f,
-          0xb63ef554bbaeaaab, 0x1e2b3e0c07728465, 0xa643ba104e91215c, 0xe8fd9f89bf9d8090, 0xad863bfb8c2cb8c5,
-          0x45d767a3f9c80b88, 0xb610468adacbb891, 0x5103ceecc64720f2, 0xd8ac733ff9c7f928, 0xcc4987851aece878,
-          0x3ed1aed37d2841f1, 0xc7a8d60ea3e16fa7, 0x49d201c47976e6ef, 0xc8820f702d55488a, 0x8a1499842b647af0,
-          0xe6ccc1052f8db8ff, 0xdb5c0f21b8b55149, 0xed213015a7553c38, 0x43a12e69dbe35694, 0xbcfbb241d34bcb2d,
-          0x9ae172a6fa6306b0, 0x37e401a7a16bb110, 0x41b1ac75288d84e8, 0x204e60ec4e5f0d41, 0xcb969f8a3d190a17,
-          0xfe9f5f8f594f80f6, 0xff87c9905a7ffbdd, 0x1cf4a5581d3e0a24, 0x49faab51f2395d71, 0xa4e4cac9d69ac1c1,
-          0x7c658d960392a73b, 0x2b5016f285ea9088, 0xbc1e79a298b90c5c, 0x11dd29e99225d8ea, 0xc5abe577ae648d67,
-          0xe3a7612f5da3d6e1, 0xc95190b269a40bb2, 0xda11d568bb5feb6e, 0x1d0b3858ebf1765a, 0x3d28725048cbde50,
-          0xb09f580c4ea0f08b, 0x484c1a8821e2c21a, 0xd063fdddb264da00, 0x34f7ad88cddc46cf, 0x73d8651a327b0d80,
-          0x1eccdeb195ae0f5d, 0x4f1dc0d041092896, 0x677ecd2925589f41, 0x11a392e69491d484, 0x06a430c8dee44b01,
-          0xf346eb545dbec5e2, 0x4ae7c2702013933a, 0x378b757deea4fd8c, 0xf109662c838c07f4, 0x5af3c2b07e0c3f50,
-          0x2230df7790ba56bf, 0xfdbadef4b4e12c3b, 0xa41d7b940cf6b93b, 0x68f13b3778c7d078, 0xf9c7222b0b5d2cc0,
-          0x3162074f02ba45be, 0xa6bf35c1768d5dae, 0xd825c4d4eac90d5b, 0xb60c81ae3df02ae6, 0x81ed87c31b8b77ac,
-          0xb7c416c28496367c, 0xc6c2c51404e3dab7, 0x45c2733801a10e0e, 0x1dad3b61bcd28880, 0xeaabed3212752154,
-          0xa5886ac1e3e62459, 0x1fa583c598b2a78e, 0x00d21efc65a5a560, 0x1ca7b16bfb8a9d74, 0x9ff56e4cc0a2e93e,
-          0xf2891cae7445ee24, 0x7a52e075a95afb94, 0x0753b35a69bde02d, 0x807e3d198a25255f, 0x5b12862b25c1684a,
-          0xcac30cc832b5c19d, 0xd46a9a896813103a, 0xb833eab3453094fb, 0x64f71c54564950e3, 0x0a16b8e7fd1aec43,
-          0x6646973e79bfdff4, 0x7a95dfa26ef0d799, 0xd175072d17839e0c, 0x267bf47cbca3299e, 0xe6030c3fcd9c2271,
-          0x2784fedc82c43dc0, 0xe660cfd89318bb81, 0x55a7b05d5b72b463, 0x11144708f6a543f8, 0x0d7fc120a789cb0d,
-          0x1c6047eb3969d74b, 0xdbcbd61efb7a5251, 0xd2506fe1ab3d4823, 0xa596c356b1ea3812, 0x1019c2ed8def8166,
-          0x1c4004edcf226311, 0xe64b758bdbd2536a, 0x1a776dc5917cd58c, 0xeee28a04ecd2632c, 0x11a1397d04eb490d,
-          0xea63dfd3f37c013f, 0xd76e80244c3f2bd2, 0x14468e557aeaa96d, 0x4759ca9142d1ae25, 0xe4fadae0f5be597f,
-          0x034776c45b45183d, 0x67cc10b1b5113092, 0x6cc5f70818f9d02c, 0x6950391fdc177582, 0x731096038a6ddd62,
-          0x9772702b1ca415c4, 0x655804b6a9689803, 0xce37e1d6ff5cbaa4, 0x5cdfbd982ee7d5e6, 0xcd9c96158dc01ceb,
-          0x8d1eda57a27d7944, 0xe782b6afe20d1cb0, 0x5460e5427e85934c, 0x0b79f61a78be0904, 0x8eb7d46937aadf01,
-          0x7e3a05186937478e, 0xb05e804514360984, 0xe72a532b10d728ae, 0x1e589ed39a2d144d, 0xefed800b097bb89f,
-          0xf97b2654b445aeb2, 0xc63fb3ec3956a04d, 0x67baef4e0b72729e, 0x0d23072db2541dc3, 0x0decb39ef3588bbc,
-          0x8f6cd836d43aa6b7, 0xd2174c23ebaa2d2b, 0x2f9cde1da8b5b41f, 0x3ec12bddf679ee74, 0xc01f25ce154b4ac3,
-          0xe7b761e9e5c3b100, 0x190a4a4557f94343, 0x3b9cbda284ebcab9, 0x693d765644a6a878, 0xad6248162061745b,
-          0x4f0f98bb3c6d3912, 0x852e8c45a20b33ee, 0x03b029a014974ea2, 0xa6607b96844b8147, 0xf82d0075ca4b9780,
-          0x20847d32aeb684b4, 0x379287dc4214b944, 0x2e43c1b0e9b6e043, 0xbcabca2dd91a8651, 0xa4a1d9383cb505ab,
-          0xd680edcf742e26f8, 0x16d540585fd5d0fc, 0x4aed4d1b694d88ec, 0x18dacf18fc1ddf2d, 0x10f886187c524b7c,
-          0x544a990e4b2e370e, 0xe205d365f5ca6905, 0x6af9441564e64427, 0x356d633d543ea0ea, 0x64c865559212ebde,
-          0x961071904587ae2d, 0xbfa6daaf79626395, 0x908aa790e7e31917, 0x0d9a1fc784a5444d, 0xa0708441928ec51b,
-          0xc0003a4fb042eefa, 0x881e797f2182dd23, 0x3dd51ff2f225b87a, 0x328cc4d2b85c67db, 0x5a8521331ecfcc44,
-          0x21f260e7e281136c, 0x594c53f52cda9cfc, 0xf8a8aab2208df315, 0x2ec0ef3e11e24773, 0x020012ee318c593c,
-          0x1d544df442d2cc97, 0x6cb5f961df55acfb, 0xb4ce14026bd4ef5d, 0xacdc5feed07628d1, 0xf776c5cf3d4983f9,
-          0x6c8e22dba7e75b81, 0x1960e7baaa964311, 0x60cb70acc950631c, 0x02065ca5aa460c94, 0x34871ee95b519b5d,
-          0x8beb909204e24e39, 0xdd7c312acbc9faaf, 0xa518670ec0048e85, 0xc7997994b2bee5a5, 0x152b25d603239c41,
-          0x50f2ae4ce29749ed, 0x3aaffd91ec39b7ad, 0x5e0439165266bcae, 0xd80aa07b8e4c01bb, 0x46507225b655f815,
-          0xdd9bcf62b191d5a2, 0xfb366b37b308ca6d, 0x915a4cb239e6bed8, 0x3296651f96862cf6, 0x678d536f80c1a1bd,
-          0x3c89a967c76bd982, 0xaf813d6ed9a28a11, 0xf65977b175fd3ca6, 0x7becef1ac4562d0e, 0x1a3cb37729d92e67,
-          0xfa41dcb693fc82b1, 0x4751eb563e07f09a, 0xe1143017c15636d2, 0xc7b718907bbfee8d, 0x3a7c8a2e9c4d4ae0,
-          0xa4aadccd353bee23, 0x23edb50cd8be46f8, 0x35ca9f85268cdbe3, 0xcbd1d371989a311f, 0xdea7b5eae1cf41db,
-          0x3d224cb6b9b15937, 0x2a3f5d42fce849ba, 0x5c864c7706a690c4, 0xaff1287bd0e44826, 0x9ad6ba9a27f8909d,
-          0x1c5ce7836cc02e6b, 0xe07e6b3a6d8de7fc, 0x7b4a7665d8f0da31, 0x76d4ece6e26a2c58, 0x16bb607a6f12d00e,
-          0x6e0cc5c6eeee61a6, 0xe6e90875812316b5, 0x14d770118424e699, 0x865e5a2f4f4a6965, 0x27e83dfb96dc9e3a,
-          0xdedec3f182c8bdf2, 0xeb8c07fa21d7603e, 0x4b953c9809e748ff, 0x6a4fe571d4d2dc96, 0x2d5f34eabc554cb8,
-          0xe3f22787e86ac20b, 0x25d2a8b6d91646e6, 0x7b3cffb122b2e2c3, 0x855505e6f5945e9f, 0x4ac1356daae03e6c,
-          0xd737ec0fca205dbd, 0xdfeb1a91b38a9217, 0x25749031fa93f703, 0xa065606d6bbba025, 0xcc85ac931636ddcc,
-          0x820e959af9c9296e, 0xdd759979605957b5, 0x9b4124de77193720, 0x213eb11ac2de1f6b, 0x45bfa1a883aca042,
-          0xf193c77b18093aab, 0x9a984999023f6c47, 0xd0e86cdcc4a04925, 0x1514389c953da439, 0xea8d2b285cd082e6,
-          0xb662b99bf58f626a, 0x3d638131ef55e2bb, 0x9aee0f82ed213038, 0x4876587afddff0e5, 0x41036058aec42233,
-          0x421a116b8333bb64, 0xfa131b707280607f, 0xf5caf39db2e1fafc, 0x798e13c7fd5265a0, 0xa9a7facce36730b3,
-          0x6eb1cac717c519c0, 0x7bc25a04b0327966, 0x5c1df3a8a2e85180, 0x5355d08d389675f4, 0xb4ae6f041c4ce9be,
-          0x592ec50ed1451e68, 0xb1cf0bf7429acebe, 0x3782b1cc47f0e6e0, 0x0c2f56d2f9aaf76c, 0xaa566e8dbcc08ec8,
-          0xfaf75ba9a80aeca6, 0x20a63143f47ffcb5, 0x3b8663cf4406bf90, 0xd8f5cb340a6c8b6c, 0x4ae09913698393ca,
-          0x2f4a0e2efaf7ddda, 0xc10e289e9c404652, 0x7602143ed39d58c8, 0xda29a74a36d630aa, 0xd4b46d36d98e88e4,
-          0x0282c717f1383fe9, 0xe437013e6ead8847, 0x96ce18bc477c80c7, 0xa1a38f60686004a6, 0x0ab6fad7c15db358,
-          0x78deace507d4cd82, 0xb39ab8849a4092bd, 0x4a3c7e780ed7cffc, 0xd57d7737053959d1, 0x17f36af1ef5e0733,
-          0x5386ef035d0f0de9, 0x69bd55a475be19e9, 0xa292e14d777fe6c6, 0xbbd8edf59ac3439a, 0x50056381baeb955e,
-          0x428be8bfd0dd015c, 0xb1cd7e39f202b21b, 0xafe25e88b5eb73d5, 0xdb6cf301d2d0d13b, 0x26bfec95ceab3655,
-          0x71db8f1978bc520e, 0xa8076abd79df08d6, 0x57fea4eacb70a107, 0x6dc32962ca93fadc, 0x15f03865a3ba633d,
-          0x9cc9e85dcfd93a14, 0x67933c1c522be19d, 0xce6e4a6a5705ff83, 0x95a6ac7aec5be8c8, 0x0919ec448eb6e8a6,
-          0xaa7cae59c23cbda4, 0x1b52d796bd230960, 0xcf9878f619b9d067, 0x2307d676d8cbda81, 0xc79b505c64f40bbc,
-          0x2f8df14c2557a31c, 0x2c945baa5e363976, 0x8f7ade8fe09808d1, 0x754ce566aa4153b8, 0x7c24604a81e10acf,
-          0xde894781b0378adb, 0xb6407886c2f36c5a, 0x8528c877feb75083, 0x4fd0728b760522ce, 0x839ab1cdebc174a8,
-          0xf60d50ce746c5b8b, 0x5d8aff4af9457d81, 0x62c52a815799562e, 0xc30f4f06e9ef94ab, 0xa19e0775812c7c20,
-          0x57502de6ac47e6ef, 0xd3d4beed01efb4b7, 0x477b04f28898b3cb, 0x55a3a0af65445b8b, 0x9ad1e6f2c8cc7687,
-          0xbdc3e30c68e6ab79, 0xb0516208d7be729d, 0xd5b3e9998b586e19, 0xcfe85af5448b4c99, 0xfd26e4d263043fbd,
-          0x6560244dfbb119b4, 0xaea48d12b0332fd5, 0x6eaf45db0e37e8af, 0x87a3058cfcd8fbc0, 0xcc6533f433d4c8ae,
-          0x8932cfb898b7da54, 0xa077dda578095ecb, 0xea0d91e7d7355855, 0x499f8440bb7a1e1c, 0xe7578274552f8861,
-          0x1a36f5422416f94a, 0x1bf31e21c3939007, 0x2fe1d7aaa858f94d, 0x25b4a7b628e5b71a, 0xc698aabb446deef7,
-          0x5081e71a132881b2, 0x8830adbcf5699eaf, 0xb4cef774e1c20d5e, 0xbaef6fe19de84267, 0xacef27352839b7c3,
-          0xa994fca35456193f, 0xcd748c83f83b2241, 0x261f00ec626f1e1e, 0x80409726731d2b6f, 0xb75f719491c90fb8,
-          0xce015dfbc2dd84e1, 0xa1004d12167e06c4, 0x10be465d7a199568, 0x91587c33bbac4fde, 0x36099502d339d048,
-          0x3ae1d3e7e5c039de, 0xc38f4812a5d818a0, 0xa45a23ab5777be84, 0x2c9b48a3066632b4, 0xc9b2a122cff18f79,
-          0x1ad25336fbfedb2d, 0x0b9384eaeff8f545, 0xab77ee673c5a3a01, 0x60b1b8c4d7e3c4de, 0x859d1b2a56d6b73e,
-          0xebc2d5f39dfc136b, 0xe0d1746baae554c1, 0x9aee4975ed05ba4a, 0x81528b17b788a836, 0xca290e3103fbbfe9,
-          0x9c7f0b0f9e485630, 0xb8b792a69d7f0b97, 0xbad764212faef58e, 0x495a4ef452eebbe6, 0x99bef030f7241581,
-          0x807a5efaadd605af, 0x17f861eeecbb909d, 0x62d61967bec7f93e, 0xfba43cd9095dbb8c, 0xd87696172da418ce,
-          0x75f9043eafe90c20, 0xf0ca89d8fe4d5313, 0x2442226e2b41855f, 0xab3bd1406269419c, 0x4094ca862af91288,
-          0x615c36108f7c6662, 0x74bd0a8790941244, 0xcc9670539070c4ec, 0x437b9c71cd6bffbb, 0x61fe58030bcea080,
-          0x34293a1cbf411a56, 0xead84f53e5e006d3, 0xf4b58e9317a2cf1d, 0xe91b598b829eb210, 0x747a6c54040a858f,
-          0x004ae28fe6ac1207, 0x6cb28f69ab2342ca, 0x63b0e678c3791197, 0x2598757f107efebb, 0xed96d17e941ac32c,
-          0x14ce313ad006070d, 0x54638cb29cee7d14, 0x2c0354d8dc35ebd3, 0x2e12b04be1c1511c, 0x919b9fbf1b3e4f23,
-          0xc8b5d0d5e127b8df, 0x85c302571febf276, 0x11b58e931eeb0371, 0xc9453bb08c50c22a, 0xa8a2d918b413a3d1,
-          0xc27feb028194cc73, 0xe1e07fbff92940b2, 0xff736a83c15be360, 0xe7c6f0153459cd3c, 0xf485eee2868c93cf,
-          0xf64a8e160cac70f5, 0xddc063ea9ef046a9, 0x40b9b8509788a476, 0x6efeb2297430570e, 0xadc9e4be5f78382b,
-          0xe6c0f05027b94491, 0x0c1047fe39809afa, 0x39fe7120fac80e2e, 0x4d9c2d16413569c4, 0x5bb104e395e9102e,
-          0xa2f3c1ed3cabc5d9, 0x7480d109739a19f0, 0x6481fc992bd6ad61, 0x6144f9f869bdd1c0, 0xf2cef8195b8551bd,
-          0xbcc7ab3ffaa917af, 0x0f3801fb0cac271d, 0xfae1c5953601cb19, 0x2459c256061f82c5, 0x9e46d7e8427e2b11,
-          0xb558ec001e0523b1, 0x650866b4f2d5317b, 0x3e4e06217d245a25, 0x072014fa5fe14ada, 0x394138d494669f35,
-          0x272ddd1bcefde412, 0x8ad4411c20d6954d, 0x122aa8d72b1c695b, 0xd3afe5fae474d433, 0x5361a17e4a877e0d,
-          0x8b1c9778a47ff6e4, 0x4a59c8919385427b, 0x9102ee99a332f230, 0x87757dd397b8ce38, 0x6951dfcf4ef2fe78,
-          0xc479fbe5141f81a5, 0xe6eee49823dbbc0c, 0xdf6410bb55586915, 0xba96631f072db228, 0x3212f8f0cd78506b,
-          0xdfe32b0a1f9f00cd, 0xa1b2a5890c80fa94, 0x1c79998e1e814cba, 0xa8c2d8d14f952648, 0x931cda1084618fe3,
-          0xa40df0ce91381eb1, 0x9ac4588e0030322b, 0x525037198d06f05d, 0xdcb0b8b8ec60c222, 0x5bd209a95205f8c1,
-          0x131d1ae7ba7a4e6f, 0x4ff7cab9d45a08d9, 0x55ed9fde099dd847, 0xe2ad08b1f056e748, 0x640e6e2651ee5bd7,
-          0xf8adf483958353a5, 0xd85a98735276d2ae, 0x05ec9be4d9367e34, 0x928fc584250acfd7, 0x18df9fa2a93dc556,
-          0xa12235162b8f82a2, 0x6d625ee469a51e3b, 0x0f06552f2b8be80a, 0x90c65cd4e7063e88, 0xb9143e61d5823fb8,
-          0x077082070886bf9e, 0x8c0998d505fe0b7d, 0x70295dc1d9b093f2, 0x1b53294d4e5117ee, 0x71658b2512dabcd2,
-          0xb15d403cc4fa40e4, 0x418f6df62b86b40c, 0xf153d5e3b0e30402, 0x66a870fc481cf835, 0x6fd1ff0da643e2f2,
-          0xf536cf94a62cf304, 0x174fa63fa4dd0fdd, 0xb9e2280742616d2e, 0x64736813ab463337, 0xd36c9cd58e20f544,
-          0xb5cd5c642b2f11a3, 0x6af4ff0b259acbfd, 0xff856cecc424423c, 0x7f8695ac0cd72faf, 0xcccbcb69a3d3df3e,
-          0x6b467b70889813a6, 0x9293c7d8a7071be2, 0xa5e2b155a30dc3ca, 0xc25347c078e40da7, 0x142798374a9d642f,
-          0xb4f14c4ac601df16, 0xedf75d939fbba0f5, 0x64004444ef8ddd72, 0xd9f7b65e445cdd22, 0xe582a05dc119717d,
-          0x88ec9733c7b6a3c7, 0x7978bc1e56523723, 0x030abbfc3d5f2c23, 0xa024e7cf92e19115, 0xef4dd6674927154f,
-          0xa41637445883ae28, 0x0abd71bebc30eacb, 0x23b91ef9ea91744e, 0x90463232e65bb8f0, 0x3419c69573e3ca09,
-          0xcb770a1832dd95c4, 0x5d4151bd4aa02cac, 0x5736b722f5245887, 0x6bafe13d0199e581, 0xb7b42f6db44a3ef8,
-          0xea635ccabcb68db5, 0x869ccfb649a67a9d, 0x91bd4a6fe80ca90f, 0x08479178eda07acf, 0x4856491a58640552,
-          0xa68e751c7fd8b459, 0x44be534aa77b8cea, 0x86d946325fd8d84e, 0xef08b303cbe2c1df, 0x2ebab543f334b082,
-          0x0fd261a971598558, 0xb71bc8cd3345eadc, 0x7e6a40b61ae250dd, 0xfff1f2bb29af2cf2, 0xb7b0873603504161,
-          0xb7604e75c611b57c, 0xb9a9ca6e9764b783, 0xf1dd3e1a2115d20d, 0xaa61a7cd830ad8eb, 0xd3b67fec4d5bad80,
-          0xdc4b2bab1d42c27a, 0x2928d662dcff2bba, 0xf1b43b9be1fa0628, 0x309db1b552eacf6f, 0x35431bb41f666d2e,
-          0x104412e4e5de5d21, 0x8f7005084f7cd297, 0x1041b03a6855f1c2, 0x7a29c4f02043c05e, 0x68724d232218b710,
-          0x2c150483847d6e32, 0x87e3e9a103fc9fa6, 0x1d9311403ec02d0e, 0x4f85a71d8b10b84a, 0x4594e38d021068f2,
-          0x0f263b70f7434dd2, 0x416c771f71c10ca4, 0x682360f7925a6fde, 0x26ef8c1a57850d33, 0x3df9e427f15d3af8,
-          0x391077d7a6122974, 0x16ed7fec86aa1329, 0x1bb03feebe7c7f18, 0x2cfa00e67ea053b0, 0xd89d416a08df6b62,
-          0x5cbb9ce5f570f079, 0x3e40e8a6fb547d17, 0x1626d7b139e60464, 0x21ab427652eb21b8, 0x94babd69339c053a,
-          0xb64f4b2d692bae07, 0xdb0dfbceba988fec, 0x7e21d72262a5db36, 0x79421a4d35e337ba, 0xf9859b24c6b8bbe0,
-          0xdcff27fc400c9293, 0x6274ec5850a23aae, 0xfd501a5f148b09ad, 0x2e8e34a147540d2c, 0xbf2bbf0b3d07256a,
-          0xdbabfddf1ce8cf2d, 0xfbbf40edcfdc10cb, 0x1bf61882e1e22123, 0x51dbf3db082340d5, 0xf90c1c6f9376f199,
-          0x90da93237c4298b2, 0x5dd098e36ef0db24, 0x076d0464d2eded62, 0x161ba30cdd07a11e, 0x72fa635a8ecd677f,
-          0xd8778e341c625495, 0x66dcc61106f26b03, 0x7a2f2a29c297d12a, 0x5f018ee93c383861, 0x73fe339d419e14e3,
-          0xaf7baad49d02c106, 0x9a5bb56b9d873a1d, 0x9bfcf9928f33fb0e, 0xb11e3e877c4966e7, 0x1f71c03c0e5be50a,
-          0xb4ece280c34a67ed, 0xdf12d8e402b57d82, 0xfab63c25d2a66d33, 0xacfb708193c941e9, 0xa3d3b6bebd276c38,
-          0xbbd21cce5a4f24b3, 0x63265dc316614e18, 0x2f85da60bea79e73, 0x8c1dccdc8a09aff7, 0x19a29cbf535b9f6a,
-          0x8e193e8e0fca2fac, 0xb55fa8493561eb72, 0x1de72d1b254b8aac, 0x256650b852f37981, 0x2610d08de45a529b,
-          0x3ef1c45b30c327d3, 0x05fdad8791a2ff4e, 0xdea1870e0047546b, 0xb47a779246121524, 0xcff334d15622daee,
-          0xf4807cda2e82bd92, 0x591c5edb3bbc0290, 0x369c48cdcb9fed89, 0x068e2362725b27b1, 0x55132f5fe6f3c104,
-          0x683cef0da6f19520, 0xf8cc43041eb32096, 0x6a629d9ae21a4daa, 0x72ac36946eadf03f, 0x608bc42b1f792828,
-          0xa4f205958c85dfca, 0xf8dc9a14a3c303bb, 0x27121d456ce245de, 0x617712cf9c591bc4, 0x0aa79c4b274670e2,
-          0xc3e65e50be30a513, 0x71fa4ef0cd738cf0, 0x29b1fc934ffa00c6, 0xe81f842a5d8205e2, 0x8a33fb62dedae41a,
-          0x1ff50e91e3df4e95, 0xe92b53bfc89d3d5a, 0xc91eb6850574b779, 0x4a1183d6b1fd4d69, 0x823c9061b09caef4,
-          0xb2bdfb63acd92b76, 0xe9990869375d8e75, 0x0e10111059a03921, 0x31a4697781d0353e, 0xb15b3aca7e864852,
-          0xd37380e4a4f696d8, 0x94ae919beacab441, 0x309821780478a375, 0x87f90d542856d75c, 0xbf59f425c78b9de9,
-          0xaccb5bba8600b32a, 0x1c27b76f119981dd, 0x6941bc3032c1adef, 0x4d75f6b57f719bf5, 0x6cd9b5ade5b9dab6,
-          0xee187e51ccb73d2c, 0x644795be0c8727e4, 0xd6787cbc7a22d7b1, 0xb350a68eea6556fe, 0x372e59994c403c8f,
-          0xd1e51339bf575794, 0xed8e81341a9c3503, 0x9465135321e22872, 0x4ca57dd58ef2a7db, 0xe24fa85da24cb183,
-          0xe6ae6a36b9a2ca88, 0x240c2aa9a422ca88, 0x1842136bb1ae3d1c, 0xa7d9f273a8262ae6, 0x4b9b42e57dcb7d38,
-          0x2cd22a50ff9b8a2f, 0x47c9b6f30647df36, 0x6f15d01153d62556, 0x744b775bcdc55100, 0x9ac6640ca7f6b741,
-          0xb64cadacfb31e936, 0x50fc68567cdcf058, 0x69cadd4fe5c5f95e, 0x950662257d337f1b, 0x5d764c5377f8d668,
-          0x191a92a4bdfef7e5, 0xda2f82d15140988e, 0x5f2e13da79557c21, 0x88029fd83d68bcd9, 0x70471165376122c3,
-          0x60d94506a259d8a9, 0x3badb1c66aa33602, 0x4a8766d209bf4765, 0x093511ea36a4f068, 0xed90d73d9bfe2034,
-          0x41d3421dcdb20354, 0x6c0a510bce3fa72c, 0x5e8d94091a5c0c86, 0x151ad735af367fa2, 0xbb2bc6745dae52d2,
-          0x4d0115adf6b4ee61, 0x6d28dbbded80c38b, 0x313b9b1e3fbd4cd6, 0x747316fa7499f3e7, 0xe5063210db9146d7,
-          0x4d9cbb3c0e8d4c12, 0x662b68541a84e147, 0xf728ad6b6234bb7d, 0x2567107780061b46, 0x78b9628e37d7bbaa,
-          0x4adb1b0efef04bf9, 0x311612e530540575, 0xcd74b48d828297da, 0x8598ea7776afe88f, 0xa3369d7ad619c75b,
-          0x0941d006b4b22475, 0x0d48ed7d9a1f722d, 0xadd85ccd59a95df3, 0xf5d2bab85b38654d, 0x9a1724c1c2d391cb,
-          0x2ce970d2a79e945a, 0xf76c9d6870debcd7, 0x9e36cfca4d4157d8, 0x62e948493b81ee60, 0x2e78133deec53556,
-          0x37c8096f64cc7f10, 0x34d4850da9cf8202, 0x1cd476ec04662d44, 0x89fe35317b0152e2, 0x0525b3bdcc4fc02a,
-          0xe863f69b062c56ec, 0x29f9dad3f641211b, 0xb220bd28e6a14e4d, 0x2f6e422a2f193929, 0x539159e2eeb19aa5,
-          0x0b16f9405ab05320, 0x838c471c0dcd3f9f, 0xf0279022771b6223, 0x8439fcf29811b580, 0x3d7ebc979e54aa28,
-          0xbad83fb699f21499, 0xd5f0478c82d6b9dc, 0x058677f1d09e1049, 0x1c454cc9e69b56e0, 0x6d24b546c85b3680,
-          0x8baad5cd31d70a25, 0x22ee079b8de816ec, 0x4363f4d95c73101e, 0x428f1df7e936113b, 0x109bc2a77ce31f5e,
-          0x82f0d947c15ff2f6, 0xcb027a9b70923a5e, 0xef256e59d18d98af, 0x369dac4fca2c3d4e, 0xfa794f324798fad7,
-          0x1738a169e75e235c, 0xa6c352bc5c64aa0c, 0x47991a0b7f220e0b, 0x42d60fb07cc12ad3, 0x7f547370fb022b87,
-          0xa28e43ca677cd321, 0x0c75b2a3b473d812, 0x80c89becbe495207, 0x25634454973c9ff3, 0x1956cb0a33a1a8cd,
-          0x00cfc2e58af1251f, 0x1cb2c5980f829bca, 0x822a6ea80de3c4f7, 0x7e1b72d653add241, 0x8409ef42c6e1f9f6,
-          0xa8d49dcf25fab88f, 0x9e68cbdcb22157ed, 0xd7e2ae301a855f0b, 0x60a7d67ee73ccf08, 0xb3fe2470914f7dc2,
-          0x699d7758b5eb1deb, 0x15132cd2d0c90674, 0x979c875f401d662d, 0x74bf6fc66980926a, 0x4efa29649d16c803,
-          0x92f60d71afb94090, 0xc6c5df09d6e30431, 0xdd56d50fbb5c7b88, 0x0b97742a3f155662, 0xbc04cb7a2cd766e2,
-          0xb6c7945facbaffc1, 0x3055dbd87eb39403, 0x5d18c2e64c526968, 0x78a2e20ee97c9ee5, 0x290dc9d7a6449c19,
-          0xac3296ed91cf1995, 0xa7010f84b669c37e, 0x9090de92d6c43d5b, 0x892305386a62cd5a, 0xde712a1897dd3a63,
-          0x40ca6e651d4eff9c, 0x2c91769b65e1f2b1, 0xf09284378f75500c, 0xd6b19e5ec22cd97c, 0xc6ce3a1a04263f2b,
-          0x2701f76571d2c1f4, 0xb9279930d1407794, 0x3ca692892218d07d, 0xcb47d1ffda7cfafa, 0xacf4cf1115acdf1c,
-          0xde0330d840cb7350, 0x0bcbe0b0ee1c1cbc, 0x4395a5d3fe163310, 0xe314c199c598633b, 0xa40f8797739f6cf1,
-          0x7cd3101e94595ca0, 0x60b92803b2450687, 0xc681b3509f9f6157, 0x515d75762dcdda2c, 0x83c561613ab3e943,
-          0x3a39a40fe42f27cf, 0x763a9565a6fad8b9, 0xce23eebf3e5dfee8, 0xed0fbd7f31dbf86e, 0x4988701b6e4e129c,
-          0x4e16fa17192bfa58, 0xeee2fbac439e43da, 0x631470a78e73a429, 0x2bdac1f369043fd4, 0xdaf4c0fdb73caaa1,
-          0x21bb8f63cbad3286, 0x639509f96483c7c3, 0xcd9400b48fa295a4, 0x97226cc3822184c7, 0x70574661d2223222,
-          0xae6f27e2c44fadb9, 0x039d7de014ed5942, 0xb357cc6de1f98ee9, 0x390e0c0d1c6a7582, 0x12181056e55127b7,
-          0x6afcc4095cbf4791, 0x3880cd03c5612869, 0x0dd44b7af249364b, 0x2058f00f3b7c9207, 0xd668193be8a806bd,
-          0x7d2b227b333d8b2b, 0xc03982bfc2f5f74c, 0x486381e1b4f4d660, 0xc6698f0af8166674, 0x121482d0aa465891,
-          0xd30cda1648796eaf, 0x06ca80c8c6c29291, 0x86b392753c5eed87, 0x5ec439573e981a44, 0x8430d93dc9cff0ed,
-          0x97c0398ad5bd3f17, 0x2c08ac1db4521b33, 0x758433457c076f49, 0x06e2849aaf521f46, 0x4f62795b0b1a9481,
-          0xe2e86a896fbbc3a4, 0x28adb99a99d8ab9e, 0x2e3231ba4248bef1, 0x410bf2c2d53ac3c9, 0xc5ea9e74adb64e36,
-          0xa01e8a6b15359e6c, 0xe01fe993d379630c, 0x848ff3c2b50e2086, 0xec18c8efed5b5318, 0xa2aee88c9802d42e,
-          0x63fcda6cf53209cf, 0x873583db51ccad89, 0xe56bde773dc62639, 0xfa3b5f0c1bf85170, 0x0755804ae360a2d3,
-          0xe1f3a5507b2fa4e1, 0x629c18573aad9b26, 0x450d8675c4c4035b, 0xc948fc90d1598a4e, 0x3d2217141faaae10,
-          0x90e51a9261322d74, 0x6031d08dec496465, 0x0cb612f8c0688cf2, 0x8789f25f478d19d9, 0xeec45b0656fd68a3,
-          0xf9893aa624d985e6, 0x920286157b64b9b6, 0x0cfee72ab5c7b5e3, 0x725f9f74cc85f042, 0x540189fb185daa4e,
-          0xc8b4a3fbb9f45194, 0xf317c44c143eb69a, 0x5eb0a37e0ed7111b, 0xaf0626f63925f965, 0x0444675a4876eb24,
-          0x38bb3e37add41d30, 0xd4e9ed6327ac1304, 0xd08fdd7c6fb885a6, 0x0d5c108ebd7ccd69, 0x3d9cdfb2e39f80db,
-          0x96845e9b27aa843b, 0x4e393229aa53a729, 0xe48c449883462e9e, 0xf608e7e7692dfc99, 0x8b301bfeabfb81d5,
-          0x45537db44d7fc0e7, 0x5e8a25169529249b, 0xb234ad9bea56730d, 0x2c44066d476e134c, 0x1a70d64f8d990319,
-          0xc47e0a92294b285a, 0xee994fe9f5211431, 0x58563391a6faf58d, 0xfb396b5a292aa136, 0xf9bb2904a0684d10,
-          0x104844c12dda8fc1, 0xd04e16d7033cb15d, 0x1b5d43e59cdfdc00, 0x27f15ab221ddf949, 0x55281096fe804c5f,
-          0x1fbcfdd7076cfa7a, 0xe5bbbfe78397fef3, 0x8a76da9bab52bc5e, 0xa9a6f505fff559a6, 0x7874e04781a70bd5,
-          0xbb5700d4c83e070a, 0xf5ec047aa6a77061, 0xb47b6cc03bbd8dd5, 0x45dc68b1cdf6762e, 0x44da4a5776a492cb,
-          0xa6d1dc0194c85aac, 0xea3fd39454c59ec4, 0xcd8d00cde8883944, 0xc7eb077a7e5ad21e, 0xa3f6875d1c36f772,
-          0x099a32420d621a11, 0x8c78e56cf1474faa, 0xc163a6c9dffef231, 0xf13f374b41a5f737, 0xf960716e8b7d90f6,
-          0x5f6ff3f4f54a771f, 0xa4f49f57aae3aca4, 0x3fe806045075561d, 0x272b70d01564bbb7, 0xa94443b659241476,
-          0xdfb7719d0e907844, 0x88eb39bb47f662bc, 0xbd683e70bcded57e, 0xeebd23ea6e1cd60a, 0xf51dbbd9b10a86df,
-          0x2d75710ed184e3fa, 0xe0fe19df238c2ad6, 0x405dea7323a61e4d, 0x2ec316954d931a8c, 0xec70d1304f9e562c,
-          0x8504fd76d36a40a8, 0xd38279b44372118d, 0xee3a57561aa6ef55, 0xd18bf0ce088fdfb7, 0x538e9a8a954cdb84,
-          0xf7f218bd335ab061, 0x9e974090a18e29f9, 0xb8ba38d1f46119d1, 0xacd3746b34b6c0cc, 0x34f91e5e31952b46,
-          0x78ff115f2706ae25, 0x4caed613941819da, 0x0b2c266d3f192b98, 0x51d30424de853f4f, 0x783a64e809e56f7b,
-          0x1cb02e307ff90c77, 0x01d7701499724527, 0x85db3f492bcf2fdc, 0x6d82c1bc1716d580, 0x6896745d614cba75,
-          0x7b3c0b7d8a3452a7, 0x1749254ef4f446a6, 0xcd91c842e639ba61, 0xc7843768cddca086, 0x0c19c5130559e982,
-          0x1d135ea03573811a, 0x61c8e04744cab67d, 0x6a2c93846c4a60c2, 0x388ade8f69b67ff3, 0xaf04a38b5a2b8439,
-          0xd40b2a65cdc550d7, 0xb9aecb3ecff18d90, 0xa1571fdb0295c1f1, 0xaa79cbbb14081575, 0xee6ae873d1381bf1,
-          0x00fc556d222ad70b, 0x3d561ee87b0a39ea, 0xf95bb6a3c57a5925, 0x80d0301249ee3647, 0x6300627e38319793,
-          0x646a2c59ce3e771c, 0xfe77a5aa49676f92, 0x4f5e1de4d4cdd768, 0x1a9859a2c545d608, 0x1f376d2599a53d90,
-          0x804f9f84d9f5d12a, 0xe896c7f9ac8bfda7, 0x7f748edc9a18f4ce, 0xb7d2ed3c9f591aba, 0x4efb2b37ae637275,
-          0x7ed5467fc4921805, 0x1e9a4e45606f788a, 0x02e7e23691814278, 0x71999510fea8711d, 0x76367b88c66ef861,
-          0x120750568df2bd29, 0xb2d0d4d97e1531a8, 0x57d21376a7189762, 0xec5accf4e505d8d3, 0x1d65fa19776783e0,
-          0xc484f85a447e670b, 0x4ebedf0abb894928, 0x9d94bf5ccb3ae4ab, 0xa582e58b5bd7687e, 0x4503c770605d5c50,
-          0xc27e922e17995c09, 0xb90bdba0db5c41f2, 0xd942d76e9064f67e, 0x14219ef47999c049, 0x67ec45a564717fac,
-          0x4be68d1252b7e212, 0xd4e9169c2e0ca79c, 0xd31e5f5783d05d8d, 0x90cb0c378ba24452, 0x418142ca7369f1ea,
-          0xac01dcd8ea7cd7f7, 0x6e4353c778dc7ba2, 0x2ef5853dcbfe7cfe, 0x1a6dc3dc96cf72a0, 0x7ca5f64b07231013,
-          0x16b2744f8e3c8b8b, 0x8a25c7dad7ec5405, 0xc171c7b2419d5a15, 0x459119e1f8a74be0, 0x9832a20837e35200,
-          0x602c2cbe79517762, 0x1bb061ddaf1e684a, 0x4dc039287fdd92d4, 0x2d9dda6f019db849, 0xbfdebc0daad914be,
-          0x7bc89539745ad03c, 0xc75503e30a2698ac, 0xf3367cf7da51b269, 0xc6b49d7fdaa3de4f, 0x4b6b9e29babc2ec1,
-          0x1ae7b59c2c1b09ec, 0x7e9e1f1eef5eab9f, 0x701c77bfd2a59495, 0x610abb88a420fa10, 0x30b62869650d2028,
-          0x861647b708cf76d6, 0xbbaefc29d04dd627, 0xf7acb659301a3197, 0xbaab54babb72b7ff, 0xa1d496385b487ca1,
-          0x39d1dba904cf4cc6, 0xa49ab350ef1caef0, 0x160312b2d323299f, 0x6f6eef6eeb73f5b6, 0x1b90fbb91e649ee9,
-          0x43133462569d78a5, 0xb8eb1ab781d3bb60, 0xea9a0f4e88783a4c, 0x79dc1a3ec9839725, 0x2337d30df79ae7c3,
-          0x61ede8ada891babd, 0xe2442b3ff3df1cde, 0xf005964bdca064aa, 0x5b9138cd4d7bb70a, 0xa65961cc71a6f73d,
-          0xe3d6678b27ec3ac4, 0xb329f1885fe5a09f, 0xc113edd978159e3c, 0x093895343929c051, 0x82080c3f4f0c560d,
-          0xa204c7359c18cf1f, 0xe1bcf7aaa461b9de, 0xd360fcd81602aa91, 0xbf048aec4774f843, 0x479da5c4d6283767,
-          0x5522b41d13708b97, 0xa281be93e8744074, 0x9314e35c6819984d, 0xe3c7e1d03a643004, 0x42b4954f3ddeafb5,
-          0xe3fde867535524b7, 0xbb86768d2cdf5ca2, 0x208e86551308024a, 0x24af956288a8daa8, 0x45c79910b3833b41,
-          0x85b40619488f47ef, 0xe846fce4709abd86, 0x4c35661dbc98a7d3, 0x178733c9a5658a0e, 0x3e1b09f513b02679,
-          0xda9fc25f0e9b8a2b, 0x46b84008d1290cf3, 0xae0147ede8f53c04, 0x70576df324b63112, 0xa6f20c30dcf58c72,
-          0x50552b072424284d, 0xc69117d8922ff77a, 0x6dc6dcb2e315ba04, 0x8570e05981948f52, 0xd2b60e5d7855480c,
-          0xe9e08a3606c23e0f, 0x0746024004167b03, 0x4eb0715a1f0edca4, 0x94c5a6b85e02ce83, 0xcd60f8aca4755092,
-          0x68be3b4d39165d67, 0x8c805acc1d1e2489, 0x6dbe37ec0f084349, 0xfb84145fe7c6d679, 0xd446bd7ccdc64d8e,
-          0xd4e8e899971aeebf, 0x4ff5ce2302f31ebb, 0x8130b6165528564a, 0x4d9304a312c46222, 0x225aa62d7f92db84,
-          0xda30286a03b9cf64, 0x3db44b9fddfd32c6, 0x58a2a59fe9f1d383, 0x99c1b7b9dcf202f0, 0x07535b7673488c96,
-          0xb583593bdcebbb5d, 0xf7511fc1c0e4a533, 0x8b397090cb1ca8ad, 0xb94c91ebebce64b3, 0xb2b2bfa8255e61ff,
-          0xf7a462e68d69dafc, 0x7a5327edfd504fd5, 0x7e64586382097337, 0x74a5d7da7a78d149, 0x2be2b3b6c62ece84,
-          0x15c439ad849f309f, 0x3ba586d714fe60d8, 0xf3df70e9ef00660d, 0x612f35cd86c9f094, 0xb48f851279798674,
-          0x60a1b54d17666828, 0x13041dd50473befa, 0x4772dfbf130a108c, 0x684bec6268023b09, 0x0f53621f23886f7c,
-          0xf1fa1e4dd0993d91, 0x063d9d5fd250f25e, 0x8a85e7d33ea8aa42, 0x22a56e99f825ce19, 0xbb8a5ba3c1f8bc07,
-          0x6282f3ee4452ba1f, 0x18dbd562566ce233, 0x8726bcf735805c46, 0xf3267db564620a3d, 0xea62cc95695c4366,
-          0x84d382e0b3a5ca6a, 0x94295e063ffd32b1, 0x31f3ec5144e1625b, 0xe64abcd61dc01520, 0x672340c1a9ba18fc,
-          0xfce5dad07edbb876, 0x8e7333b3cf2f88e4, 0x788b8fea57eb037a, 0x66a8885251293a60, 0x6dbb2af304b01960,
-          0x44a73ec4c1f78fd7, 0x9f4ea69b7fa10b60, 0xfe0a8845efc78101, 0xdd3cb7df2c86559e, 0x77a4c0561c17c2d7,
-          0xce1707be5e75cadf, 0x4bfa68e6d36a623e, 0x47414672f944036c, 0xb93b87181c926d50, 0xb81147972b4589df,
-          0xb3ada2cde3a44cf4, 0xebc25e8cb003ad65, 0xe5e65a54c72c56b3, 0xd457d05a91dc6f66, 0xb3ae80863490a553,
-          0xa4ab3583f1378122, 0x141b938dee2f9e5d, 0x4fdc9b2f0a4644ad, 0x8120a955579ee828, 0x10a0a2ab929c1f51,
-          0x6fc69190f4719d81, 0x25d88b2ab326b9c4, 0xc878cb0f298c99d3, 0x2560baf9d3f3f034, 0x533e80cae0e37d46,
-          0x22fde10af1838d2f, 0xa69f0f58f40fe0ee, 0xca455cd41d449ff9, 0x6721a0c40f4cc9ff, 0x9865a68862a061e2,
-          0xdc211a59eba1559e, 0x30894916cd160e98, 0xefb1c5420311d491, 0x793bc57c054c24b5, 0x09f098643203d82a,
-          0x5a5495027cd57e81, 0x1aa6639762322716, 0x3903116d34aefff0, 0x63ccd7b6fd29ce30, 0x5b73be0805def7d5,
-          0xc64c3af17d887db5, 0xe3640e9d1c8200a1, 0x92aafc464e68e405, 0x14ae01b775148df5, 0x6674431838b035ba,
-          0x8d48e1cc190fe5b9, 0xc6463af5dbb5506f, 0xaabbaf6f979bf65b, 0xa3015c8f7219ae75, 0x23a94a052f7da9c0,
-          0x0edc7f369b897eb1, 0xbc1dd857955762d1, 0x69345d99beb2df68, 0x4e66dd2effe38d79, 0xe273877521607a28,
-          0xfd9d2011ccbe554d, 0x42fd300f02837ce8, 0x2d056de5a48f39ce, 0x42722c3410dba7f6, 0x546d24f09b5db784,
-          0xb2b8c2aa860508c9, 0xc0ed96e086f91325, 0x46a6e97f80d0f8cf, 0x17644c4c03d5f903, 0x99ff20d7e0677b70,
-          0xafbf4b97ffa0ef81, 0xa6cbe005797ec307, 0x3055311db60c1cad, 0x2c6a8141a0d57f75, 0xc03f2eace8564267,
-          0x2bae34f314e95efa, 0x48cdbdfc9de385b7, 0x9e5707bd5c6a81ec, 0xe3588e8b5cb0c62f, 0x60b2b763f78440fa,
-          0x6848c60955177242, 0x5f40c732e0bbf92f, 0xff0118002a6317c3, 0x698a702327ce2d7b, 0x143a5281aa6c1072,
-          0x2ccd27ced3b961db, 0x8c876f30394fcaaf, 0x218a731c696da35f, 0xe4752daffab3032b, 0xb31509482acf3e86,
-          0x759e06318bc7a749, 0x31f056ffabc83694, 0xe2e2832807106474, 0xb521bac2e985ed67, 0x3ce4d9686e5d471a,
-          0xc078d49b663fd63f, 0xfe539d65f001e553, 0x3eaae02798850cfb, 0x5b50f8fd66dcf959, 0x700215382dcccc5b,
-          0xbd4ec7be174c6987, 0x53c0b3b0d63cd9cf, 0x64ac4db69a292416, 0x5186cdf88063d80b, 0x48e442257ea6ef2e,
-          0xe57f9e214c19b256, 0x6cd35cf9f7f405a0, 0xb3def70148dccd04, 0xbf1f258d358447b4, 0xe0fd193dae73ec5d,
-          0xa6b6d45bd76cfb12, 0xd5ecae060362388b, 0xd03633e08e3cad13, 0xda3233c6a2a61ccb, 0x6b2ec9c7bd951be6,
-          0x736f6afa818a8852, 0xd6045781413fa363, 0x0d2fe87ad91be1a6, 0x194cb47785863d06, 0xf169e8a775ccee0f,
-          0xeaa4dd41c188559e, 0xd62009d30bcc41c0, 0xd2a56aee3842a829, 0xbaecd4e190965200, 0xe122a43d20680ee3,
-          0x94f564ed152d3497, 0x3c6b809f071a7cb0, 0xccb5d5ac36077259, 0xe12770f4b8318f6f, 0xcb09eeb351e8cd4f,
-          0x1b73384c1e08a1d7, 0xf83b0d9676c8ea32, 0x8e91e87b30f0099b, 0xd6597f7865807bd3, 0xc157b84747a31b39,
-          0xb81201ce76156d5c, 0x7755839d8ce522a0, 0xfab6a81ad8ef70b3, 0xe3dab318e182f15a, 0xa73f18c0c0675206,
-          0x30a40aa1cf39a7bb, 0xdb3631e6321eec79, 0x179bfaae2ec50660, 0x48b905aaddddf1f0, 0x8d5c87b7ed4635e0,
-          0x20d267251bed51c5, 0x1edb0114a30c865a, 0x7c124245381efea8, 0x3be8602273f646e9, 0xb442dfffcde6bb91,
-          0xaabe1f3747ac5ecb, 0x67716202992ea910, 0xd4f1873cbba3dd80, 0x510b5d42bb06ebf2, 0x5dea4141f1298275,
-          0x07fa6a0048206de2, 0x0c888eb9432b3720, 0xac6d05f6e63cc780, 0x4fa54c5ff677a176, 0x4b254c2200387875,
-          0x8f5429386c59f150, 0xd163031869cf0cd0, 0xea7a608d1ababf9d, 0x9420db592b0d1589, 0xd0e583e690422b0a,
-          0xfbdfdb35746186d4, 0xe0a1bc21a4897a3e, 0x03986f97811b56d6, 0xa97c3015b5a7e093, 0x12ca2324600cd64b,
-          0x2d8aab71c078f86e, 0x4c18fe26390bc768, 0x811c193476062810, 0xb618efd9ad73cd58, 0xccb8a34ed8fbe70c,
-          0x70678f61e3d8602d, 0xaf3da9a0442ad597, 0x4fb34308e5e12600, 0xea84224274dfecd0, 0xd0c1e9bd192c3262,
-          0x0142e3c6f7bca56b, 0x8e58777d0f200841, 0x973c29f63e2b4178, 0x4fbab89607e285fa, 0x6ce5d4a17e8d1485,
-          0x3ed990b5ba85ae36, 0x77af134c8b0e3e7c, 0x1ce2cbd4c156eb37, 0x33aa8b059afee08f, 0x34a9f6151295e2fe,
-          0x0e3cdd411c4549e3, 0xfdf4ec44d5d0aa7d, 0xdad0e24edc583867, 0xbfba9c36d37ffba2, 0x8afcd355c0f9e764,
-          0x1f98254b08d3421d, 0x8ba187d19e00e39f, 0xc5717de117f6a284, 0x5f961d5553c407f1, 0xd42412265581a897,
-          0x5933bc14ed1ca9b8, 0x3266d4e85ea5a0b7, 0x787a144a55ee6599, 0xc647c83ecc932d53, 0x6f9d25f6de741843,
-          0x786c2f5ffa3ef653, 0x0489cbdfce0bec7f, 0xfc6869dbc7a7a3b5, 0x4b1727e04a7a5033, 0x46fad33663e05bd7,
-          0xb56a9081bf1f56ef, 0x759bdce3a5776b74, 0xdd58b3f288ff85c5, 0x46ead3e303276732, 0xdcf308ccc25763be,
-          0x813146a334314a94, 0x312d41f2bed1010f, 0xd2a2ca97bb5ff48f, 0x8ac82a491c746739, 0xa917aa1ae76a4380,
-          0x1c5e5dab11831f3e, 0xb79ca97ffba5de9e, 0xd4a245fafedde78e, 0xda16e60c5b9962aa, 0xaf138a8402751e6f,
-          0xc1cfc7e4e1f80613, 0x4a6ca0b3ecbcb784, 0x34fe1096abfab5bd, 0xa2849db6c3eae6ea, 0xd318f926953ffaf8,
-          0xaac9b2dbe4c64323, 0x5a08bd75ce7e9f5e, 0xe5a0a7308ee65771, 0xcad8ba2fbf24b884, 0xed8314284e67ea3a,
-          0xec48160f3c68003c, 0x2a750e295a6de954, 0x0ae0c5758ae85242, 0xd1712125791da34d, 0x9d33f2cf436b0f5f,
-          0xcec7be51b3203b78, 0x7d107776fd8fc67f, 0x1427101ab26a0d21, 0x1116f7a61a78fa0a, 0x6c45dd3ac5402eff,
-          0xe91dbec6666c5b5a, 0x9d12fd8c77352e25, 0x606512ff58fcee73, 0x8e16dd7e50acac84, 0x4e1357d28f88a62d,
-          0xa9f142c68b4fba67, 0x16a7f5378a497a5c, 0xc6af4fb1986a3f57, 0x1080a076ce4e8f78, 0x81afb1793fb49d59,
-          0xf7f66d8515f3f8ac, 0x7473f10337ad0cc7, 0xe75b4fe51f7b69df, 0x58013bfc320a9ed4, 0x8cbf99d354949ffd,
-          0x62b3f98b7dcc843d, 0x72308b39a4aa7a77, 0x16f39aced020fb22, 0xc060154ec65c774a, 0x5ba159ba1ba41792,
-          0x97758ea8ff595dad, 0x38986ac1d79c4a62, 0x9e9017f69e8d72a8, 0x73de5f09eecd97b3, 0x0802d233156639fd,
-          0xa555f737600f71fe, 0x6e8b42be70b4af2d, 0x886938b34c29b575, 0xb2a6a2199dea31f9, 0x75dc7cd9aa8ec24f,
-          0x4cf12bbe3f238db8, 0xc8e8ac922e7e4fa1, 0xea1fd09658add2b5, 0xea4fcc69e9100696, 0x2e95846c75eb7389,
-          0x8b6e45ed21a7ff01, 0xcfca55387a8793ce, 0xc9019bf0d28b3eb8, 0x0e207aadea3ab1cf, 0xe558e0d5db52ba6a,
-          0x242c66295ee91480, 0xd30d855b657b064e, 0x8c20c07bc3322b4d, 0xceae2720880c6160, 0xbfc613f3ddcfef6c,
-          0x00fbbbc060e316cb, 0xfa17ca9361704fce, 0x155f86644265bf52, 0x62bf667751b8db61, 0x4ab10d5baaacf47c,
-          0xc303a275782c8019, 0x48b3ddad92f3624c, 0x69ec9b8a20306597, 0xc8859c1f26f82162, 0x86145a33fd942dd0,
-          0x373f5810f0ba09f9, 0x763233a2d9a853e7, 0xbe4681c340a6eb15, 0x8f43a2ae65b6b666, 0x4acdbb3b3f898005,
-          0xa1833f52f34e9508, 0x5d701d0e5494581d, 0xd506fcfc774a1018, 0xf5b971467d4352a0, 0x1d6b9f36e8d7420d,
-          0xcb0954b2dde612bf, 0x63c3a1714e33bc36, 0xa867bf22b13baa92, 0x696e46016786f7c2, 0xf62262f8df399545,
-          0x2d1186b93209c2f1, 0x6bd9d4e065d7fdad, 0xa9e291ab419e0efa, 0xe12b2bc58eeed94f, 0x92383efbed0c33fe,
-          0xc57b102bc22eff39, 0x54d9ea9025c6b01f, 0x445be39b138c03bb, 0x73ee0855d65a2c9d, 0x92b87d95ad78e9fd,
-          0x1671c0ebcb8d54b9, 0xb2f30b35eaaaebb7, 0xff646c185b7a705c, 0x6b2cb718d96086dc, 0x8a0a46e5503860f1,
-          0xc23943ef8b3864d7, 0xdf64be10db10dbb0, 0xc708282de83be933, 0xd5ed8e88d1c4faa3, 0x77fe33cae3edaa72,
-          0x94db9b1a00dd93c3, 0x716ff8917552e3f3, 0xdb0bafab7817fabc, 0x1167a9ce3f735cf3, 0x8e80810252f54a6c,
-          0x1221e0512e17e5dd, 0x3f89672dac588964, 0xb053040bb6569a24, 0x180e0d98cf914104, 0x1882bbf20464b17e,
-          0x11788af6d4859322, 0x48e54bf025152af7, 0xe032bdb921a69c10, 0xadf8b425a31e2893, 0x311ce22418d74f0f,
-          0xb768883df8e2f2df, 0xb7f3ada77d9d2663, 0xc4569b8ba1804cb7, 0x2e1b2059bbb20b7d, 0xe8b86c861b0ab818,
-          0xa96b86198ae94a8b, 0x66625ef8a8428ff1, 0xc92527e0c91de171, 0xf36f113e6ac6d3cd, 0x61458d1c1083a843,
-          0x6dd70825f1b13480, 0x25dbed97013b9221, 0x4be52067001baec0, 0x32a487cb183cb555, 0x925fea694db89623,
-          0xf11bff4fdff47391, 0x7cfa8762f680cb9c, 0xef7a681d2b27d8d3, 0xcf959b69a757e46f, 0x08d0a503e84ec0be,
-          0xd4afac32311871c4, 0x9b94afe529a92366, 0x09d14d7de3262a22, 0xfce438f66313a87e, 0x9c124957293a6648,
-          0x76f1bfedf84509a4, 0xdd431626cc7ae724, 0x1f3bd9b91bbfe201, 0xe9e620414947eb3d, 0xe24600c49af9ce30,
-          0xe55d0fef7051fecc, 0xbc9f2f79691b60e8, 0x2f4124941c1b1e72, 0x5f4458068077ed73, 0xf48457af2be47bf9,
-          0xc95b86985be7bd19, 0xb64df6963f4519f5, 0x2a8b88a0a635489b, 0x09518db2516b85ea, 0xa0cec6b0d9539336,
-          0xca8554996ca329c0, 0xf5fe01e0456b7a7c, 0x9d5baeadea2e10a1, 0xba4cd43133707229, 0x285d37907c8d9914,
-          0x588b83ae77073601, 0x41cabaa29e7cf034, 0x04050af593828bd4, 0x8dd565301983c32a, 0xfd96e88519a9af4f,
-          0x9558e4a1c582a072, 0x22374265f7413ae4, 0x3d3025d969da80e9, 0x1dc5bbd0383a64e1, 0x0c4872e2a40759d8,
-          0x9fda5ee2de5bede0, 0x5f06c6362294ae6f, 0xea502caccfb57365, 0xdbe00c44e38be265, 0xe8f0b1ebbb726294,
-          0xf98a6bfe0a356177, 0x4f8e64c70bec5b9a, 0x92048b1053232e18, 0x750b1bd3011ea518, 0xb9fb5f1a48c2a89e,
-          0xf12b432c78c35df9, 0x81b9833fa4aaaced, 0xdd6d36611b8c5ffd, 0xba2b8c0237dccd3b, 0xdbaa94e7f02cb3c6,
-          0xa1d5421227b648aa, 0xe913d24979be9429, 0x5aa2b7bdc01bed8b, 0xbbc598aab9a022f3, 0x90dd12cdd6613b0b,
-          0x57beb1bb8acc01bf, 0x26a07ca1f67cfb0e, 0x4bfee4f3aef333d3, 0x3b50e96f40fb1a89, 0xaace6de5d0ce5276,
-          0x076d43b7575e2afd, 0xfb2a2fc697873a33, 0xc19d2c6f3c33c03d, 0xe2d246abfce2432c, 0xde454053e1e5356e,
-          0x2da0853ab70b69f9, 0x6e4892b37bdbd242, 0x5edc070dfb5a7b01, 0x4573abb5e47e4f86, 0x3bef9412b7d6b864,
-          0x279cc88e8fbb714b, 0xaae0d006f6d3e42c, 0x6226368f6ca49f1e, 0x4e2b53bd79f0c1a6, 0x6d302b03ed9349bc,
-          0x172bc785cb31f5de, 0x185fee7387d8107c, 0x2b3eae48428e91de, 0x92c039ed63b348b0, 0x5c8ceab828b8c47c,
-          0x3d763dbee27c232b, 0x4287ab991bcf54c1, 0xf64c76272302401b, 0x02218a03fc0cf60d, 0xb63dfd122959ad49,
-          0xb2712e582e1c3603, 0x65598f879eab7943, 0x8d18b9bc74703e53, 0x2bf51b51c838dd36, 0x1560b11a8d3f9bc1,
-          0x76d1e7fe46fc453a, 0x50cd4918980f4e53, 0x1a59cc66ac4b7919, 0x5316ebd5d28be5b1, 0x1ac0b220966727c2,
-          0x4fa29528a62c5f8d, 0x3f5b34bd3fca5428, 0x153f41f1f16f1c83, 0xd94347b9f7d9b220, 0x93c99e0f817f7838,
-          0xda24f8d863ba2e65, 0x04d20ba9d5cdeffa, 0x09dcb2b6fd820303, 0x2632132b4e5e914d, 0xfaf124dedfc898ff,
-          0x7cf32d9e7bb4e46b, 0xd17529296c3d49ab, 0x525464d7d5eba359, 0x7ec0a99f51d7c89b, 0xbf1050a7472323a4,
-          0xf235903cc0ff8ccc, 0xeaf7f2e528913c52, 0x59b2426653be81fe, 0x041ed0c6a9e1bcfb, 0x33a5ca071b8ab86b,
-          0x659945b7e4097a0c, 0xdc022346b8088ce7, 0x98374ec239cfc890, 0x55f7094727263975, 0xaa7f891b363bc600,
-          0xe76c701cc4c4d8e2, 0x5e20e4c27d363273, 0x692d22c4cd98e081, 0x1825a56e35867750, 0xd5980ac895cc431a,
-          0x075b4293e0f16357, 0xa970cf10e9e19cc7, 0x6a1a11cc15dfbf7c, 0x2a85c91d0b0f86e0, 0x322a4c918734e43b,
-          0x3b0040240e63cd9e, 0xa4dc4de11c99695d, 0x9af8fd8b10808eb4, 0x29009e7061033a35, 0x76bcbf91fd612bdc,
-          0x33f054608a99bf24, 0x0fbfd6efc009b85a, 0xebafb3a915aa21ef, 0x84994eeda0933a2a, 0x073a9d9563c729e3,
-          0xade34c2519507b03, 0x04106f06b1eeefee, 0x399b44db7a0bab71, 0x1cbf1f4abd1cb7e0, 0xec056cd0644621d5,
-          0xb9b4135e45a0b649, 0xc2f0ac24143aa104, 0xb4f84c2756e1190e, 0x31d458573ed7d6ad, 0x954ad3d051b18eb9,
-          0xe338b8c5e4650662, 0x73efe782369f10fe, 0x514ffc0a370ba003, 0x0b6224c8e59e51ff, 0xe9386e56f85144ee,
-          0x66b584ccb6d51754, 0xf73680a66dea138e, 0xa09371ae3b51531d, 0xbf69c282b2c93af2, 0xee5f6619af8dbb09,
-          0x21e56cca2a78dc54, 0xa47b2a42f0637a7a, 0x1010224b1cdffbe8, 0x28b301616c84277a, 0x11a84cad9dc3f01f,
-          0x5e0db84128acc7ff, 0x5a3a24e9a06750a4, 0x19bfb22ee6cc1e75, 0x6a7363d6688bd65f, 0xb4d4474a7122b30c,
-          0x17781fba3ba83a51, 0x45af87887e4c1bfd, 0x4cde88302838446e, 0xe92b9c5cac428996, 0xa596783ac0ba0777,
-          0xf1f5288f63ee8cd2, 0x9e9c44f4ef4a561f, 0x6a7526bc26de670f, 0x7aaa5f1650ace000, 0x021fd2398e0b6f0a,
-          0x07eb0b68254faa8b, 0x584b04be3c1af446, 0xecfba55ae2a82064, 0x8af94fa2080a8070, 0x32ec5a2e35b41c80,
-          0x7e7a839a65b0a488, 0xa7bbe4b1bfd6a50a, 0x309b16d6a24111ae, 0xa7540480d35dc7af, 0x983884f1e807fe87,
-          0xe39cce3f6f1c87de, 0x3a0bbed343bcba8d, 0x55f04123efc52100, 0x32e5854af27d5205, 0xa506b749b3dda9a7,
-          0xa29248f84443d9e1, 0xe2afde3054eb83b3, 0x88a9268ea41b3593, 0xea53da1456e04872, 0xd91995a134a34e2f,
-          0x6ad354ba0c8c0444, 0x24eede5ddd97052c, 0x32cb6303ea0fd010, 0xe45ac4fe2191af2b, 0x04f574f40db299f3,
-          0x6ca99f035b37c3f2, 0x8a45224d36db63fa, 0xa2da8a392618c9db, 0x822013f9dc2c21db, 0x047b28df517d1fe4,
-          0xa58012173dafde90, 0x6708dd8bf732447a, 0x88ee36734e73dd65, 0xe372cfa43dd43c96, 0x2dfc5ae87989bdba,
-          0xdc1a10e1b249edb2, 0x55659b44b3c80b09, 0x3ddc9662b28cc4e4, 0x91671538bb5573b5, 0x02f7200bf9326516,
-          0x3d7df517887c441f, 0x57d2cf04c09a66c9, 0xe50424a3cb017d1f, 0x34ea56f646fa0f9a, 0xcf840033a6faca0d,
-          0x12b8789fea62251e, 0xbce99ff64e169516, 0x1f9fac856a61b78c, 0x858684b66d7413df, 0x670144e446363513,
-          0xd19b2ac33411f35c, 0x2b047e32e43e3400, 0x4bdafc214e4ceba4, 0x0920fac13ebd54d3, 0xa58fb2fd61e790ac,
-          0x2e3c0b1ce3bacee6, 0x1c5a0d26b7198048, 0x2704b2a4d5f22f31, 0x01f4f10bc2586fab, 0xa7735aa056638428,
-          0x883919ddbe552005, 0x0f63e353317f19d8, 0x490582dfde49095a, 0xef29841900c15e1b, 0x54807f43a9c69e05,
-          0x84312978d5ef4e73, 0xeb995c3726a8ecfb, 0x311955842f8f19a1, 0xfcf29a33a0f23a59, 0x801402039270f05f,
-          0x521adfde8f9af5f7, 0x018f599402a54309, 0x7b8443097191f38d, 0x43bd495a3da51caa, 0xa8bdae7bbec4646b,
-          0x754b7bb1ffc0efbf, 0x53feb11f7fee8061, 0xef3e740eef35c4d2, 0xf011e1955d65d8a3, 0x025e26d81ef1b9e3,
-          0x7cd48319e1a5419c, 0xe269971031c76664, 0x84d2bec632903a51, 0x6637ab5805dc369f, 0x64f2892ac94ec341,
-          0x3c8525284512efed, 0x98e832e174820d68, 0x08268c58bcc86646, 0xc458d916b779682a, 0xdc944f4bb675e132,
-          0x5575ab5a06595bf7, 0xc4f41e07feb3392d, 0x7eaa076d8f1f9e56, 0xd6a57a2b82f8e4e3, 0x8bdeb3e475d19fed,
-          0x48a56db5b7d0ab6f, 0xe91238d8ecc559fd, 0x8d06fb551a8e8709, 0xc2ce89f69879c6c5, 0x9c2f9bea922a693c,
-          0xd9ab6d3d7b853336, 0xb6e6627d27901eb4, 0x941ef093a54c83d1, 0x3b0536cd0cfd4928, 0x17ad6f026ab1431e,
-          0x16521e38743d9640, 0xec00bd6993c6616b, 0x38594dfd0c5d142d, 0x59696821be5f8f49, 0xe3c36265b6159c98,
-          0xc1ee0d0063d55128, 0x59c38b9beeb4751c, 0x9e33795fe8c24f1a, 0x0a121bf81695a9e5, 0x59f5b0751bd9e8e5,
-          0x119d0a2744053cab, 0xeaa221fb93811329, 0x6b14075319bcc510, 0xb70d88cea2464250, 0xa5ad3edcbac3eed5,
-          0x0c98b5665a61cb4c, 0xc183995838f7b3c4, 0x6161bd868d32cde5, 0x7272610456c584a1, 0x1d5b1b5dc7f5b380,
-          0xb71c6d44daadf557, 0x6c50ff716290c513, 0x385d70eb2185af70, 0xbcdb81b8aceadd2b, 0x276ec6cadb39a60f,
-          0x53f775150b158145, 0xaa2d31a36ddcd82e, 0x9036d09f19946d0b, 0xea1fcae39c150773, 0xc31cf1881e86b053,
-          0x54e08d1937ea605e, 0x6c8689bda971ad0a, 0x9236ccbfb4e92f45, 0xeeac252414864c86, 0x503a18a80d378833,
-          0xbd8ffcdac08afd03, 0xf491af10dfc48762, 0x30c530a210955f43, 0xb0dc789560a4c25f, 0x29a76daac996c29b,
-          0x65c6f993e30b2dc1, 0x2f328ee268d9563c, 0x7ea9df6bb8585d5a, 0x1763a53fe88ecd83, 0x8721030a06bffaa8,
-          0xc3d4bf8609e46087, 0x234bc07c505fa26f, 0xb7ba2f3a1963af1a, 0x31545ea264816a56, 0xdcb2124cdfa9667c,
-          0x443c6aca7d6443e4, 0xa9610aa8917c064a, 0xf3423c4b39864337, 0xd4a1521431d80e1a, 0xca878fa4239de532,
-          0x24c0f1b1316bbca8, 0xad9dacf2a25bd98e, 0x13af385b26e630f0, 0x90152563a2118951, 0x83c64c0c6e4bd08d,
-          0x3abf22525565b275, 0x7123e1b241d67c69, 0xa66f3743a8c6ff4a, 0x6051c0ddca4a4eca, 0xd4f0c8c1020e2ff2,
-          0xed54bb7890de826f, 0xe1cc1387eba7ad0a, 0x9b01c58d5b7b83f8, 0xaa0c7f8f05a7db83, 0xceadd6866c04df0a,
-          0x2dd4465324b26fdf, 0xc23aef441665c474, 0xd470ff550cc0e08c, 0xc66aa9beb89ccfeb, 0x675bd6d761fbff6a,
-          0x0de4c0f052920533, 0x3c5727ab4840fe84, 0x4f7907a577265937, 0x01a646b433e6c9da, 0x8483d4dae83e6357,
-          0x5b0bf9ae510b5376, 0xfcd22d460f90f115, 0xaff2d114c2349b3a, 0xcf68be411b26b813, 0x3bf447d13da23d9b,
-          0xae6257381a4537e5, 0x317527da89cd2159, 0x6521d7650bd86c2a, 0x00414eeacbaf432e, 0x8faad13e9085b280,
-          0x4e50de3a0cd48ff7, 0x6645433fc5cc441c, 0x318b926ed692d696, 0xe70f6ecb0a8167b8, 0x638e02353d85309a,
-          0xcebfc16b60c5334b, 0xdb5203c6bade1420, 0x2bb1efbde2278d97, 0x71bd0e59fc6f72c2, 0x1544873758210308,
-          0x3d725083ec265ba1, 0xdbfda31a54276aa2, 0x9bc2c07ead138e99, 0x0151bfa639f536e4, 0xefaa945e8c120379,
-          0xdb096bdc4f6ba2ea, 0x677c30bd7ffb632f, 0x2f1c06392cf7f3e5, 0x8720d78c65193114, 0xbd2916c28210e897,
-          0x78ce201297a2590b, 0x7faf22b8cc2bceb1, 0x4695e5982fdd4467, 0xbab6e6a14b9d1c94, 0xd62098bfd1727d05,
-          0x9a7cf5b8dc238929, 0xecac42f15807a85a, 0x3edee77c0f7b475a, 0xe1126d6e3fa70eb5, 0xf740763ee00f6604,
-          0x88c4496b560f6add, 0xcc0171296f080dda, 0xd5afcf9dc16a8b7d, 0xca4d8b1823044d80, 0x6c8d5ef9fe4cfca6,
-          0x611b8c363cdad436, 0x54f9eabb17efb8c0, 0x0fefd2f0dc6677ec, 0x6e1f1b26b29b6042, 0x3531bb684b25d382,
-          0x0dbdd9c49139bec8, 0xe7643642ba83185d, 0xa73e2acc1d4c8254, 0xf03a1d0215d32646, 0x58f3788aa46a99ec,
-          0x5e9f3b9a2ea946a4, 0x132770b5dd4fa2b8, 0x99f9840a6145c995, 0x6a9d177c9a855d05, 0x0917fde0e44b31ac,
-          0x2610fb641dbc9d8c, 0xd7d7fbb522587212, 0x4d07289f0caa8f5d, 0x4b0b3d35fa2a03c8, 0xbc47c3abd8af5f55,
-          0x3455c54b9e652c3f, 0xb0420c85488863b0, 0x49dc1392538bde3c, 0x76c595dda4595d1a, 0xc076c6b51dec1c2e,
-          0xeec8fac29bfb67c6, 0xe101393c4e74d944, 0xfce5edd90521c3e8, 0x9c18705c755309e0, 0x57b80d24641e3184,
-          0xd620b2f7696abf72, 0xada023a299d34ec7, 0x496fe94d4ca0a5e5, 0xdcb9d8d99ec6fa64, 0x0f1de4657fc358b4,
-          0xcec1bc13f70eaae5, 0xf7750282b5450387, 0x50c79db081269266, 0x5d564ccc030c519d, 0xfb687b2f40c513e2,
-          0x3c382633a2dd695c, 0xcb3f3d81e50ec362, 0x8f8c3be506b603e5, 0x1e265d399cfb0178, 0x22207d1c78c975dd,
-          0x51b32999cd75f285, 0x957e4da03a01d2b0, 0x05026182c79158a5, 0x5dc0b1d94f7cc253, 0xdbdbb66359cd6e84,
-          0xf0691ecab8582cae, 0xcde0bb3a4a2e9a92, 0xce4d3af3dc9c6de9, 0xd731c6b2bd1b158e, 0x9587e1eb27c8e0a2,
-          0x64e1e262b684311a, 0xe445acf7fdc15a13, 0x84ca558e66a06a93, 0x3b1733a4471796b5, 0x2ee4ea7f625e8fb0,
-          0x13e76590c711edeb, 0x89c1b46592584fcf, 0x0139bd4a0329356a, 0x9ec1ba473c96d1be, 0xa3d72f078a3665dd,
-          0xd8994b241850edd5, 0xd638ac5b6bd46243, 0x7df4e438c379b0b7, 0x0d07b82dfe4d0b99, 0x8543ba951c1c228e,
-          0xbe8e070542b99343, 0x0dc40631f4bdd068, 0x7478954b94ab9ca1, 0xe5fb683ab6fe0c26, 0xfa69c2b574202e16,
-          0x609b955e2444d4e9, 0x97f968094be951c3, 0xabe0debbf301c92a, 0x820c8d5770a1818c, 0xb218a048d44b55bb,
-          0xf548536890d6f135, 0x28d416edba004321, 0x58a79c437f37167d, 0x426ccb175f67ed94, 0xd67ded45ca54ee8a,
-          0x5d884da4fed72b18, 0xdbbcd2abb667d687, 0x935bac5b98b20676, 0xaa7a863e44d513e9, 0x26a6c1cd3d8482d2,
-          0x1f4fdbc2a005fc9c, 0x9c61b3320b05c46b, 0x818a4b60c9705c03, 0xc450e4e9de5f5019, 0xe1318d5664b2287a,
-          0x24119d1cad5c5d38, 0xd1b9abbe1ceb9b27, 0xf3273e95ed8fb874, 0xa0ff858bca4957c9, 0x63db16995b9eddb4,
-          0xa670244ce4096f0e, 0x1362f5e27c82481c, 0xf2214f603a263d60, 0x227b552f3391e5aa, 0x96796c0803c7ace9,
-          0x66f17db098a65e2a, 0xaee102abacc9245b, 0xb28dfb5cf5913d9f, 0x2539cb764bbddabe, 0xf062915444947f83,
-          0xf3b4693d0dba242d, 0xa1cc2968e6460dd2, 0xf5f0fc758e232063, 0xa7eb815fa1072e6b, 0x97b52ad9bbd61c40,
-          0xad9b481c49b749b0, 0x537132ddfa64a3b1, 0x29a5e291b4d5234a, 0x1cb290327dc6db78, 0xe8ab0f9604820037,
-          0x7257e9e6e2b93d64, 0x9e0277181eb59186, 0x23258a333a6f101e, 0x959605180b46a7b4, 0x3782e17219b84e7f,
-          0x7d3bf1a86464a74c, 0x1d13013f78616fd0, 0x0edbf663f3cfba1a, 0x3e537df1a4f080ff, 0xb63a709e3ea0bd6e,
-          0x3d39a82698696679, 0xdac9d45161fd8c93, 0x0d868d43b51cc3f3, 0x30fc22ff83f32fd1, 0xaee3d1ba3229696e,
-          0xbf229c15c4e4c01c, 0xf2335d487aa412dd, 0x6c063958379357d9, 0x8546e3709c2bbff8, 0x02089e7a8f888ee9,
-          0xac43a530670a21d5, 0xbdc974e7012f1028, 0xa28ba5fb47da0745, 0x7f7ff1d8761c10f2, 0x098ad8ee8bb3057a,
-          0x976a0a756e136cb7, 0x99b8273ab5174539, 0xec343a5a425c4441, 0x5b08ebcad1097578, 0x23e98a955d55806c,
-          0x9e9b42b73e3b02f7, 0xb8f81859d20f3961, 0x004b56e7579595c4, 0x3feec8a15bf5c718, 0xfcaa01474a41c459,
-          0xa49622c229b279a0, 0x5f0413616bc3cbb0, 0x29caddbaeb396601, 0x3b5f75ee785112c1, 0xad4f690fe56f791f,
-          0x5222598a453c5377, 0x30b733723a455192, 0x117d6647db7373e4, 0x0ddcaba844df9996, 0x59e9f0051c0c789a,
-          0xddc9a802c8463d41, 0x2a1532e25b100366, 0x8a0371905cda7b3c, 0xc93d9e615d94e247, 0x739b8887c6b3aaf3,
-          0xd8f2b907c2589f86, 0x082ce06cef787178, 0x87935199f152abf6, 0xc76424c2db50367e, 0x68822a293cddce23,
-          0x90915e8a070c4350, 0xce1c993e70655a5d, 0x4426503120f214c0, 0xb09e0844f168b8bb, 0x26c819d2c7968007,
-          0xc144986898ff99ba, 0xabac539ec0cead98, 0xb5ab51abd2ec4f42, 0xfeb370fd4d704efa, 0x2116e38f0f8cd534,
-          0xdb35e507f45ebba9, 0x6b00c94c669bbbd5, 0x7b7d82ba1a478f67, 0xf60f173905c83dfb, 0x695ca93bf05d9406,
-          0xd28110541a12b5e2, 0x1a72960c3021a0fb, 0x301756ca138aa450, 0xcca7984971d4bb2e, 0xa6276e7c5ae25cf6,
-          0x4bea8bfe3503d31b, 0xec0b4fbd8ed35656, 0xfc12244b8c55c69d, 0x8c5c4207a1d23ac4, 0x38ace707ea753bf3,
-          0x3f55558508158a90, 0xa3dd4baae946157c, 0x46ab321c1ef10739, 0x16e51fa26106f4a8, 0x6d7945c937737c90,
-          0x4f1aa3fb8077146b, 0x8f31d080404e4aa9, 0xd8fa7271a2f8e850, 0x6219428412ee21ec, 0xf28a160056b1cbc8,
-          0x6c136c92aadc0abd, 0xbf5d21fd4e79c5c4, 0xed882af35a2e1d5d, 0x37f612a1f194dd3b, 0x24bb8e3377b7de98,
-          0xd53f428594d0c71f, 0xac6d1c09fe9e1622, 0x242e37b6fe694eeb, 0x95011aff6ea19330, 0x55f48777331c7f0e,
-          0x63b9cb32142c683f, 0x20dcf1dd7c5bc595, 0x25f659fca141de58, 0x77454a3756d8a722, 0xd5c966534f98aca9,
-          0xf046a43a86e7162e, 0x41fd3dff3e0bdce5, 0xeceddeb004d90c0a, 0x55fe679268193ea7, 0x0f36f2e159fe7b64,
-          0x7267fc4b064bfccd, 0x10357322b4a98ab3, 0x0d1feac0665972df, 0x73576037ec8b2c74, 0xe84ae05120c34193,
-          0x06c8210968cac6b4, 0x0682bff6e9eabf9b, 0xa7f55dda11a2b151, 0x1e47a6fbe95c6287, 0x9a483dc07ed68083,
-          0xd1d40404925cd006, 0x708a8fc006fcca92, 0xc27f4732af76f6c5, 0xae5147e8d57784c9, 0xb4c236c61e68a0ed,
-          0x1771749741071a03, 0x5eca740b7cba6ca8, 0x380f666bb4e5c9a3, 0xfc89aab8afb8475c, 0xd1886e7a100467c2,
-          0x6fb1ba283b2326ad, 0x1844aa48003ce4b0, 0xfc0078b7ec7f5583, 0xe94218a06ebe0614, 0x4541b82797cd609b,
-          0x4909b1df8adcb00b, 0x6eaeda1174f1be22, 0x18aa22b0dedb3dd0, 0x0478b8594a59f75c, 0xb28a0282be22ad53,
-          0xd5dbbb9f7aa3f50a, 0xa4204efbb0eab343, 0x4e4b921044d047d1, 0x28c04ba661d20026, 0xc4457956781c3623,
-          0x5e98d59eabfe05a7, 0x8c13211c9ff65bf3, 0x50c87e9ba7ea3d00, 0x0eb066d2692b90aa, 0x947532720527a5f3,
-          0xe2d95c232bd3be43, 0x0a43607ba4672a0c, 0xa8d1e2c85d6b3103, 0xbbf8c659cee2438d, 0x46b2ff05f14f1e52,
-          0x69efc38acd0dfb77, 0xb110d22c6bb4421e, 0x082ff9e076fc4854, 0x8bc2f8db528f9879, 0xf360c5931b1cd8e5,
-          0x1494d69d85248ce2, 0x101c5acf353d0cc7, 0xde5c570a69720496, 0xcf180485495cb693, 0xbd7486c178b682ce,
-          0x5fe19c906cde8ad5, 0x2df30264e97af19e, 0x9b1597fff2825bbf, 0x56c67bdc6b772ef8, 0x0d3c818a9dabf6eb,
-          0x7cb2720bba3a478f, 0xf3a64230cf092a6d, 0x2cfd670f8e6a5884, 0x9960a4d42fe16968, 0xff0b47a74b05e645,
-          0xb576b5f81a188528, 0xe113cc1ade9aab16, 0xbc5e1da6059f2ff5, 0xd43a456ef5b70c39, 0x712b30c285dfe28f,
-          0xcb8dbf896256f6d0, 0xd1f82f5bf2a88cdf, 0x5643cdffe653f2c2, 0xe27a382e639e62f1, 0x8e4fa7becfcde340,
-          0x412c22d1d46c0e88, 0xf9ea48e330f2fe04, 0x6aeffc1d084d7b67, 0x7105c0e973f3e5f4, 0xfcfdb76398e7cf32,
-          0xdcdf73fd78dd781a, 0x027211450302adef, 0x5c8ad4caabcce84b, 0x6093811ab37a68a3, 0xf52d6415445b5028,
-          0x6d3c870704b2f729, 0x32ceeb11a0db8dab, 0xc54fce0736ef4da1, 0x9d4e764fe96d1da7, 0x654db24ad4493cf3,
-          0xd492c9b30767ab64, 0x3df9a0e0f12090fd, 0x8d5d1543a6c47706, 0x271829f2761d6221, 0xc77e1d56e06b9b78,
-          0x2d86c6653f9e539a, 0x283f6253d8821d60, 0x24749bbf1a41a36c, 0x5568ad5b7645fe91, 0x30ccdf097cc487cc,
-          0x762323c7266d21e3, 0xe26bc4d6f84651c3, 0xfcbd88acbf6047fd, 0x8dec84714434f1c7, 0x6b706cc441842a76,
-          0xa211aed4bcc98e23, 0x358d12641763bb1a, 0xacec4694e796dfc8, 0xcf99e334e01b456c, 0x1fb6aac22799e2f2,
-          0x5d150abd63ad91ea, 0xa4a2188d90d19b98, 0xed978a3c58f937cc, 0x70647b0f81387cab, 0x82ecef03c6fc7a43,
-          0x61c6aac5fc2bf3a4, 0x6f2ee9d8c77173e3, 0x668d712d2639febc, 0xe6f0af9621f14636, 0x1b3e9e0a9c1bf687,
-          0xce3e0827b0670225, 0xed8af4c5747761bb, 0xe1440660cc9fd278, 0x83b47bfa5f7fe63d, 0x7b550df3a435f412,
-          0xa63c390023cb718f, 0xea08523b9b46f59b, 0xff4c4f740e0ae542, 0xc99d8edfb994a1b9, 0xa18ed943024e16ab,
-          0x2c7351666963b47c, 0x005527aa72aabec9, 0x6fa54cf03643749b, 0x895cb7d93e337c37, 0xb558daa06318cc12,
-          0x8558305fb8488853, 0x6d1f259434ce8da6, 0x46ff957c06e07ed3, 0x819336be0d657fc3, 0xd9ec0ef59cb4a8f6,
-          0x2d26f318e784a248, 0xc6423dbddc95fde1, 0x1c82c4ae21844f14, 0xb7980fa71b63f536, 0xf839b6d4d39be333,
-          0x3bf3a86afe6ca208, 0x9c459a57a73175d8, 0xf0755b81431b2655, 0x9595b97ae35ec545, 0xf921ca0da46ab323,
-          0xa68923282da443ba, 0xf1fbacb6e93f49ab, 0x9bcfca73969d2eca, 0xa04ee2bcd576e1d7, 0x3c9cead75eb0c2f4,
-          0x00830a0295451bf2, 0x34b3dbd6673588a1, 0xb51aa1efdb9fd6af, 0x528582870a1083e6, 0xbd2372385521f507,
-          0x23e8e13e134cb481, 0x905f0f39ff84ba0f, 0x299712844daf0528, 0xafbf666ed1b45782, 0x12ac3107c533f503,
-          0x85298341368c1d24, 0x794c3dfdb191eb9f, 0x2d1fcfc1cc9fd30d, 0x88d35f0063f002b5, 0xc422773bd71bc84d,
-          0x75d9a5aff71fe6f9, 0xf2675cd54e057856, 0x06c90c259ff7a1af, 0xc8efc85e77291fdf, 0x2df4fdb0f10166b9,
-          0xa30fd8227abce2f6, 0xf7b855efcde98314, 0x20397bce3d039df4, 0x01cd2fb2078749cc, 0xa8d9e78b2d6f1efe,
-          0xe58e3cbe5993ef0d, 0x17bf238f3b19698e, 0x1389af2fb2e89196, 0x6e3b29fb20291442, 0x1062425de9b1a92c,
-          0xdb39d0742dde284f, 0xa0b62cc82eef396a, 0x1c3f28fb7761434a, 0x08d7813bd253c6eb, 0x1faa6979b9a38731,
-          0xe7eb77ee20834677, 0x2e2a8c6a9578bcfa, 0x06046d0e3961a094, 0x34d5b6e45ffee49b, 0xcbf2df8820a67d55,
-          0x90ae6c13bb42f4b9, 0xe0d3c7d02f74d4bc, 0x0640ae90db6afba5, 0x0cb3b73bd8776a50, 0x777f5df0429c90a1,
-          0xdc562946c51c12ef, 0xe33881834680844d, 0xc51ef76be0e16044, 0x6004ff00f160765b, 0x6586a561acd81955,
-          0xecf480877446b65b, 0xc84e545c0b84ec6d, 0xbf5bb73cc8093d4b, 0x32c4a782d6b4c5cf, 0xd73a2b284c8b7e6a,
-          0xf8bd640916a3506b, 0x81c1fec4efd0a580, 0x47fa52cad0a21021, 0xc0681313c65c4f3a, 0x94f7cd746a26e993,
-          0xdadb456ea16fdc99, 0x547528e3da3496d5, 0x25bca10274ac7496, 0x9ab1ce6c5337629e, 0x7b549f8eb243c3fa,
-          0x59e399e22fea27de, 0x4dedf5fd48107ae2, 0x53b7ba2536ef0203, 0x1d746283051d0c1f, 0x16aac664c25e378d,
-          0xd18d7df2d285ccdc, 0x392264e08c03cdd5, 0xbcc254357e57ac6a, 0xe9f68b8007fd7aae, 0x88b06168457fc1f9,
-          0xf024b2260d5446d2, 0xd1096123391081c1, 0x683c21032b48de07, 0x55f773517422edbd, 0x0a69632c0aa31c42,
-          0x3d8c930f488914d7, 0x72f25f2957b99ee8, 0xf5ed87ddc10d58a6, 0x7bdb1d827c8493fd, 0xe176b9dcd5b452f2,
-          0x7041d1185abab156, 0x445b9b5df4b5ea22, 0x32f60793041bf199, 0x0f112c9ed1b83062, 0x94b35b213818cf6a,
-          0xbeffceb4932dd1c9, 0xdb838f42f9f813c9, 0xe3aa051b6a9053ff, 0xa65becb10a7a35f0, 0xd34cc5a6b7846006,
-          0x0d00e3a76d44aa3a, 0x6c4e9312bcf9d433, 0x4dace9f0a4d8939e, 0x78d8ce65c12fe5e1, 0xa3ad321e96c2ea5e,
-          0xe15061ea313af312, 0x7e43a5bfb3820cde, 0x691313681fa61501, 0xbd8fee72b46c0e86, 0x9f4a18bd33db7e9a,
-          0x89b307af5a9ac602, 0xda0ba156cc3b3d0a, 0xc353465c55516761, 0x45a7db1186dda861, 0xd3a47ae659f183c3,
-          0x1c077e1bbb721043, 0x8478d5575a671698, 0xfe9ac2e857e191be, 0xbd646cbdebe8abfb, 0x5166b40b641e07c9,
-          0x83df1f7f7d447553, 0xc6301a14592418cd, 0x9152dd11b66cdcd7, 0x19b230ba73f95007, 0xbea13739eedcbfd2,
-          0x8ca2e3e7e913917b, 0xbd219da20bbee2b1, 0x26ac3c71ec47a861, 0x6cd9468b5b337d55, 0x63d7b520db5113e2,
-          0xb7e9bb7e77dc2a65, 0x7cdf10cb32530556, 0xd231be1959c76ae8, 0x79af836d47a0032b, 0x4b303a54873f7831,
-          0x32151581e5e6a367, 0x03b0600df216184d, 0xc014ed1645630e21, 0x970fd5f1fbd9ce84, 0x7baf3182a5bd898d,
-          0x288c89215fda99fb, 0x385185605ab4dc3b, 0xf0c653536f4fe87b, 0xa975b554db5a750d, 0x2703807e943d3b72,
-          0x138da51a20165c1d, 0x2b435d79ae5181d1, 0x51ee10221a5885c5, 0xba357ca71bd0263e, 0x91da01cbc20094aa,
-          0x1192e382aa01288c, 0xa6eeb8e33ee60480, 0x3f2f499b0de6fcbd, 0xe56c63cc2043c90d, 0xf9d7b26ae72c8dc5,
-          0x37d46dad07e7c928, 0x3adda15c2ad7a61c, 0x3378e5ae62bae4c9, 0xa1d9ef6e6d679c15, 0x3fd05eaa98018df9,
-          0x26e78b5feae7f748, 0x7b6ca5771f2f51d8, 0xf5c1c52f4e5390d0, 0x669764e69b23949a, 0x839a804f0f5e8a45,
-          0x3fd6224de6cf1fef, 0x900ee383792c13f5, 0x9ceb287edbd2cfa9, 0xec438bc242bbe2d0, 0x7f0bf17af1ebafcd,
-          0x7c37efd6fdc0ca76, 0xa473e6c389cdac60, 0x73d51b722953c485, 0xc8914622b522a2a6, 0x4e913bb2c0551a8c,
-          0xb62a6948918dcad7, 0xce1392b2d38a0125, 0x2b9870c91fce5088, 0x72d4b991a14d2a1a, 0x43ba5a002989eb31,
-          0xd7dba52ce3a6c156, 0xc08b7c080bfbe77e, 0x2ea8ce67f73fafd4, 0xa9759438ab0f5bb3, 0xd1ac7087f4101372,
-          0xef1d8a7ec2694307, 0x50e0fedfb7253936, 0x69fea8cf2914e4e4, 0xda6e5a26edea6616, 0x90a04d42d36d9226,
-          0x426cfdb3234f498b, 0x785fb3429ac8bbd3, 0x29d25fe67ccd14e6, 0xc80a5f6aa185e916, 0x4d92e76192d3a009,
-          0x94935836124a2f52, 0x288c5e0fa8dca065, 0x0ef722b8d4e4479a, 0x7f78f3f27d15d7cb, 0x87533f8771b9e3fa,
-          0x1f1ff1cc4bcf43ab, 0x000be33660838a8e, 0x9932a649d257f9c3, 0xaf2571fc4c3c78c0, 0xb18415c35992fa9a,
-          0x4fcadf0e879ad48c, 0x38947ccfad02d30b, 0x5693acc22c33cdde, 0x01ce61365ac95e09, 0xb82507ca7c2a51a8,
-          0x680f308339686256, 0x24ff3f6b26d76cca, 0xfd30753fc375177f, 0x6efa84f38b68c616, 0xbd0623773561cf52,
-          0x3fca7b7ced0b3b82, 0x749bd9ed1d27e05f, 0xd8a2cdf01e057583, 0x4e590c9c1eea97a0, 0xff7029ff71286b41,
-          0x2beeb8f39defe1dd, 0xa950f0b2324725d4, 0x91d8423d14956987, 0xb4136fde156ea82b, 0x61bc4822800a83d2,
-          0x9ccdcda179f18537, 0xe42a71b88c07a9b8, 0xf35d80ceadcd6dd6, 0x03065f96e3369b25, 0x32a2e8379e7fc8cc,
-          0xd8fd48e224893730, 0x9d20de87366f0ae9, 0xfad18dca704413b7, 0x21633da8495e0838, 0xe79e9a45c135429f,
-          0xa397bfdadc700c0e, 0xbc67a1e8b7d3f8f3, 0x77dff094f7a726cf, 0x6ecfe77d889f75ba, 0x05c4055b78ae1ada,
-          0x6ad0785c516d1ebf, 0x1389cc105c7ff840, 0x1b4cfae51f5c93bf, 0x9da80cff133087f0, 0x78a35b6c84160b86,
-          0xf86c6ccc584415cd, 0x2ccd1c656813bedb, 0x46845f06b3e2a407, 0xc0d1d702fbe0a893, 0x7abee8ba0c7e7b48,
-          0xf7f9613f350e89ea, 0xd5e7b57d3f1bed9d, 0xe5224b76870f0fa2, 0x47c2e60fcc3eede0, 0xfdd4c0d24a78c2e0,
-          0x373ad0c755cf4da6, 0x1298eec888c1d670, 0x0b66031207e1c715, 0x35653bd612d99bd2, 0x9ee96f51a7ae3e47,
-          0xb01560d671b11629, 0x98463e4686851c55, 0xec649a3804bbe476, 0xe60f34e18234ae8c, 0x16134dbf4cddcbf2,
-          0x5ff35b78f3395619, 0x2f611fc08343cf11, 0x7990c2fe0cccb7e3, 0xb4d1a88d388de500, 0x8f7d484909f474e6,
-          0xae01c92f494e2bc3, 0xfc743adb52bfb61f, 0x87e7fee3862c9871, 0x9145ce5dc32d065f, 0x727b6eb9372c3142,
-          0xfc673c36ea56dd7e, 0x703909220d6ca3e2, 0xe8ab8ac5bec39c37, 0xa9d0b79620604e98, 0x93208cd2f280e93e,
-          0xd0cac2b159d96cb9, 0x07e374304e22ddb7, 0x72fe7fc64a0b3262, 0x99332779ecfa8ff3, 0x8efbada2ddc0495e,
-          0x8d523b0e0d7816bb, 0x9b3bc77ee11e9f38, 0x5767415894188f06, 0xc5ad87fe75923f59, 0xc08f0d2a65caa953,
-          0x8d4eda76079ab7fd, 0xf7322eaaf57976e3, 0xf2a7428327db4328, 0xec0069525b291fe5, 0x1db227b4fc67decc,
-          0x62917b7eda44f99f, 0x68aa8334719abd80, 0xc2ace8dbebee767a, 0x1e13dccdc32bd34d, 0x003528420f01f43d,
-          0x44b06696cd1b5bf2, 0xcacaca13560c60ce, 0x0c88083067336257, 0x43b40f88c5607a79, 0x41e6c5022bd14fc2,
-          0x4c7d65fad6939ffa, 0x17ad9d69ab7945ae, 0x4832430054dfd574, 0x9034dbbff2e8f9ad, 0xc3f703c0e41f3169,
-          0xb1d184974ffe10ab, 0x7f94a4c4fa81f11b, 0xe9a26461f9ca2a5b, 0xb77c007b5d83c51e, 0xbf6b0f346c746052,
-          0x1ad08e29cf79c5fe, 0xb39ebec7398c6376, 0x3e96004f1cc1005f, 0x5d07c57fb76efdf4, 0x5bae84b7e3b278d8,
-          0xc48d05f51ac0daec, 0xcbe3c0193abfde39, 0xcfd3f4dc8beebf64, 0x1888ffe0b81da500, 0xd9062ae9d762b1a8,
-          0x8ca2de899a2e7f4c, 0x595ad8751dca75d8, 0x6c442ecd2b5af5b8, 0xc85d5321d193097d, 0x0b679fb8c1f6b3eb,
-          0xcc63128eb1baf921, 0xdcd76a39ffa50034, 0x5b6786d8cd83f07f, 0x6c386bf007cd6941, 0x0cc987def5f24487,
-          0x09b3456e69d706b0, 0x3fd11b3c204a5e6a, 0x356a9bac57640733, 0x159e6af9dc89c075, 0x90981f6f7ebc515e,
-          0x1adb451e88c01b1a, 0x8fc58d2b5b574b5d, 0x89a9d31a08f6b28d, 0xc3bbe74866f5c0f8, 0x47a367b976e21c1f,
-          0x6dd42ddae595c81b, 0x12261bbc63a2fcbd, 0x6a6d0fbe98c5f0b0, 0x0d9b8da35259f6ed, 0x324e1804f094be8b,
-          0x0c9264e29fb364a2, 0x65eba0f3f332e8a3, 0x7e261da1d7ed43c2, 0x8f372fc388c4944c, 0x52691c47cbeb4603,
-          0x66bab1036d8b2873, 0xb8eb058051ee938c, 0x7daf789b85b578f8, 0x86d6091947cc4f53, 0xc5cd792db12f2ebb,
-          0x3258ccf62108977d, 0xe87c4bae95595dbf, 0xb97fba49589de9d0, 0x005b6058178b5119, 0x384b09f0479f7dd8,
-          0xf98f9f7fe8bc8b44, 0x1e3f53fb38a450c1, 0x5491daf749ede2d8, 0x27259ed1611c245b, 0x2496f9274100167a,
-          0x75ab0c2bc5c4870a, 0xfb4d08031b90617c, 0x76562def2bf9f6ab, 0x3d61b804f2553e57, 0x58a3285e5ade5cae,
-          0x1571079b91230bb9, 0xbc7b12f963e63f76, 0x168761ee9e8b032b, 0xbecad59179d6ac99, 0x5ff825aa2ee5b854,
-          0x25482b2eaefc8609, 0x57e8e4c35ebe74d9, 0x14c1f4219721521e, 0x02e51c979d56044e, 0xec09810adafedf6e,
-          0xb4c6606ff680e073, 0x2078c1107c78661e, 0x6cdaf244fa542f27, 0x57b7d64c8738f0a2, 0xd0727c6fdb4eb612,
-          0x6ec77f4fdfb25218, 0x08958eebf90a31e4, 0x1c75c7c7f172c2f0, 0x55cfe99b94eefed9, 0xeb89b6af5095b025,
-          0xa858a1ea041b4fe5, 0x2cc5c63a50dffcc6, 0x634bd896b5ead69d, 0xabd8147ff4eef8f6, 0x226ff0759e20d530,
-          0x5dc2c64c2ce3c017, 0x6c2722b34966bead, 0x291a0ce35e3881fd, 0x6de5f521d0c84084, 0xa865ff2b8c51c992,
-          0x4c9c09577b864d29, 0x2ce2387024fe9348, 0xe19bdc226aae15c3, 0xa9e3c39fbb069875, 0xe7268f18f01e88f9,
-          0x48172ed9222a1742, 0x6fa110a2d7811851, 0x7cfd0be7e32f8e07, 0xebaa4457179bcbca, 0x014b9143fa2dd30a,
-          0x5d7aed85c72236e8, 0xe1a699b24eda7f6c, 0xf38f679f8dc5359a, 0xecc004feb53c9bcf, 0x3da0b913c46ad0db,
-          0xc0f3d326a69f362c, 0x726925dac261f720, 0xdc50a09f2f250ab4, 0xd72f0766ccc39612, 0xf084bd79bb9d0d9b,
-          0x6e3555bd727f8e34, 0x32aa8d4c799bdc18, 0x79a33d4c9e6fc7cc, 0x097da8fefa3d2941, 0x0fb03640b74e4196,
-          0x2e2415e3ef47eaf8, 0x444895b17eca062e, 0x11caa6a83d3af27f, 0xc5ebc17ae51a9642, 0xaba9644a3fadda82,
-          0x8edf20c1c0536a7d, 0x06388e562fa06bb1, 0x14bad3d2f0351a62, 0xcb3b0248a03f42cf, 0x3551dc610b42a3ad,
-          0xaee70c889564ed8f, 0xcb3997c786f0dc66, 0x077738427256a0c0, 0x64b37c8293ba077b, 0x0717ff92562a390f,
-          0x1b34f340381e7b4f, 0x274327f0c88de42b, 0x1f6135ce43fa4c22, 0x213c0fea58711eb6, 0x414144750cb91167,
-          0xd5ccd4db37624b6d, 0x4f27a2a353981530, 0x286388b3140f3480, 0xb5a615a9871a9579, 0x1f1b2380b59a3d55,
-          0x801b1a92d21b8f6f, 0x83de7a853b5fb028, 0x857c88d9363dae9a, 0x012b6edce45192b1, 0xdbee749f449ec50a,
-          0xf8f0813744d944b0, 0x798314a1f2c14841, 0x09c5258410e4c1db, 0xc6c9406c691f9f49, 0x2f503f011d68d063,
-          0x30217be5096191b9, 0x3005d6ea2ba7b47d, 0x981d1ff1bdfb0dbd, 0xd135e314d2355a4d, 0x850e7a9e3bb3548d,
-          0xeba22562bafd9540, 0x57eefda2574bcb8d, 0x10960ad5d3458501, 0x5e4ee0eedce144e9, 0xb8451ac0a2ed092d,
-          0x11b7f13eafa9eb9d, 0x0fdce0179a0c6dd6, 0x921ea88e5abc45d9, 0xfddb184981f794ad, 0x7b8561677b694aa5,
-          0xae32ead99d027da3, 0x9ebe08eeb6b7ac63, 0x507b6ae6dfe94d19, 0xfd3a15c919dad431, 0x9ab65778073b9e56,
-          0x9c6961c1ef64ef67, 0x2cf485b9d98a0408, 0x1f1e0f87b477e350, 0xb4b9faf1ea838815, 0x21c3ff30b51117e5,
-          0x889fcfa03bb1c97d, 0x7e981984c365b8e8, 0xd55cd28773db5d6a, 0x4caa0fd6429ea5f9, 0xa44fc82f26ef6042,
-          0xdd9e2ef6f27ef4c5, 0xb75b885867d1dee8, 0xfaadebba7c6cf7b0, 0x2ac71f7bb2061ecb, 0x60b21192e8dfb16b,
-          0xf465dcb89751003c, 0xf286eb2fed926fc5, 0x8c1c0226cab8bf7d, 0xb5612fb595c71f28, 0xd2431c3f77bd3e3c,
-          0x298c78bd47992b0a, 0x7bceef1a0309ba05, 0x5f675b0c2878cc96, 0x204de68ad9dd7621, 0x1e1d46a77ffd69dc,
-          0xa078dffdff174d92, 0xf6c8c0bde06e613d, 0x3663a8bf0f66b09c, 0x052d7cc1a5f9473a, 0x85291ecfe8568ff6,
-          0x48f2fe263ad078ec, 0x5d4d780b59bd2211, 0xc56794a09003fa02, 0xd0be21e3f433e5af, 0x776b54815783c72d,
-          0xbbe2998702fc5f41, 0x5a9a954e0027e5dc, 0xae47f55d9768e8c0, 0x04052c98f82108a1, 0x6630c53ae877ed2b,
-          0xda299aac70eaea7c, 0x35582c4d6a671c1c, 0x49e21717f744de9d, 0xca673054a20c876c, 0x47d6a50c4a6b8aaa,
-          0xa41d5f10eda1672a, 0x9e4a808704fb7458, 0x11925230d77d6540, 0xc4aee8af7a30ad47, 0x7b0fbe060b02622f,
-          0xc169f5e9dfd35bf3, 0xf4a57c1cea902ae8, 0xf84f088e8aa77660, 0x5c887ef772eecced, 0x15c33e9bd9b23f80,
-          0x389dbf3d8e336df8, 0x2ff154b480136d8c, 0x6370a09f334fce9f, 0xaf5dcda53d624c92, 0xeda1fb0e81752d97,
-          0x06b6c2cd9b8c607a, 0xde93527a52016aba, 0x50b458e16ae70e80, 0x30a38a6caca096ba, 0xd7198f06472ab367,
-          0x4351faca8dd652ce, 0x4972185ceaea0686, 0x7dac006d29dec67d, 0x69e8ad25ee7fc21a, 0xdb66ba04e790c25a,
-          0x2a5007d1732a1b5a, 0x169dd4f549e0e1fa, 0xc72dc77d135f910b, 0x9ffa8e370bfa1148, 0x7aab8d2c06cf851e,
-          0xcda0fe6c6bc960a0, 0xb72744daa79b0684, 0x76b5d34601e8e5a7, 0xa0166560b7837c01, 0x20b77132b52ef2e3,
-          0x206b998a225e465f, 0xe3a83ebe29fe8c7a, 0xfdeca2f277dff967, 0x195da6cf11bd7846, 0x0c3903792259b7d1,
-          0x728ecaa760b73bd4, 0x4327b199fc63f757, 0xd8c967fd242f27ba, 0xe9748ef775c2091e, 0xdffe7f6ee5f7e35f,
-          0xbbecfbccc5094d54, 0x78e143a0326f3c7e, 0x6eae2da7c71a136d, 0x3e76a6a5ea15b2fa, 0xac9016b9065d8abb,
-          0x28ee47381339caaf, 0x45d17e6e198f9c2e, 0x45e705bde7de59c1, 0x61edf07e6cbdb9d8, 0x1bf4382a9850bba5,
-          0x4687292b54fe66e0, 0xd68bbd50714b0530, 0x9b46ee6259ec57ea, 0xcafcd28326e50262, 0xaa62bd58ae89d6da,
-          0xe0989fc9744545a1, 0x25f70d03b52c91ad, 0x45f794100eb0e240, 0x03c3cb5de3437fde, 0x178285264d8aa6c8,
-          0x39f7d3c79bc600ec, 0x5d33cf46d0ce5147, 0xcf4d549051642846, 0x8a296b8f4ce15e5c, 0x9aac9eeae519768e,
-          0x075cadac8bbb4e90, 0x4850f6d311882881, 0x6adc82fdbf8e88a7, 0x4babe331b9c6e590, 0xe1b073a462e14fcb,
-          0x5a2f55b0276c4d9d, 0xba113088c1356d54, 0xc36e355a9b4b95d3, 0x4a806a1b27f9f450, 0x8931ffcc37b3969f,
-          0x0d426803fb33afec, 0xea685ca134d6db3a, 0xe630f2224847cccd, 0x084b95414c4aa827, 0x25c4fce589d4facf,
-          0xeb4697fe7b45fef3, 0x0efb4a7da19539a0, 0x3560e9c3644d5e07, 0x24a2b58233a9e05b, 0xa646704a9069205a,
-          0x8bf8d927a9159437, 0xa337220191cbd044, 0xc5287266728fc9a8, 0x15719e70ac78b908, 0x4492d3bd0232675d,
-          0xca6427c82eb6c3c5, 0x37c30a1f8b6f8850, 0x37b60e5b01ab7344, 0xc9aa5069ab588226, 0xdca0c0e212fdc4a3,
-          0x4bd54edd01b88340, 0x337d212e5cbb9fd0, 0x6e2e8d8614d1ec4c, 0xe50e09b759f4d9c0, 0x8e81c9c09c5a77f4,
-          0x6247ef5041464f64, 0xeacc66a8125fb0f1, 0x985ec74a17d637f3, 0x2f51d873d1ebfe2d, 0x01d4f414b9c838cf,
-          0xc8e52cca7f87cdde, 0x28eedae5a5faea86, 0x5d5cbe90c7ebacac, 0x9342a53b46b5bb3f, 0x4452c742acc3f5ec,
-          0x77a982ef2bb235bc, 0x870ee9f03b4d25d7, 0xcc44b52f80609620, 0x8fe39bac3506631a, 0xda482339dce040c5,
-          0xb7ba5ac84aa32dab, 0xa537d6e6bfa28f0f, 0x982906111345b607, 0x588190209b291038, 0x4961fb7dfc937c74,
-          0xe2e4033e238aefba, 0x85b78166a0544cf8, 0x5bac8407715004c9, 0x3d962c55eb471d46, 0x522ab1961b8a7190,
-          0xd80c6c61a954a23a, 0x2ed9ce150a234fa8, 0x25abfcd9232d3208, 0x9a2fb2cc676faa0e, 0x07e991da84a0bddc,
-          0xb24d169e47e0e194, 0x406eaa385d89471a, 0xf23bcab928b3ea37, 0x7595282da78c8d58, 0x6fdf0531408a8de8,
-          0x325b128aed917147, 0x3e5981136f763eaa, 0xb604dc1f272535e7, 0x3b751f0eff09f81a, 0xb927478a9550c8d6,
-          0x4f222f7f7f36aafd, 0xedb3b3f8fbe7a14a, 0x7e7cf593e0eedfe1, 0x2ac3c6254761526f, 0xade96fc1e54eb3b3,
-          0x9c132aa1416ce744, 0x87fc0997147479e2, 0xc3034919820b99d4, 0x21795f74fcc15470, 0x0fa67cb41b331a86,
-          0xad2b39c3a94487e7, 0x3251e3d17241853f, 0xe74faac9b069ab22, 0x171b05369cc946ed, 0x35de344cecbb46e3,
-          0xd7792a96afa2885a, 0x10f687f14a29d070, 0x1fd5ec7a695b7919, 0x99b747b107e8335c, 0x7d2ed3ce8276f20d,
-          0xa62632073d913553, 0x57a90c03c0c7af55, 0x15fbd19d04cbccdb, 0xa39b47a3877560ac, 0x16d8bc3526b38b14,
-          0x3d4415fef2c5f02f, 0xd13a2ffa0d5b2009, 0x558e11e18a8da4bf, 0x0a9af94fcfe452e4, 0xe1a6bfd9d991d4b1,
-          0x5b09589718f4a439, 0x7c21b4b9a39e5177, 0xc9eeb230c2e9fbf3, 0x860732bc73429f31, 0xfa7bf559698f6d00,
-          0x18f3bf9d2e75f8b0, 0xf0de24749a44bcc8, 0x9d8249c2354d2cb4, 0xd29702ffd20958c5, 0x9fbfbed1985717ad,
-          0x29cbc520999e307b, 0xb2c3ca3fae47fae1, 0x6e4dd151dd5a85b7, 0x147e0aef5bd9f1ae, 0xc1b6a2706e0df152,
-          0xd7a490c456a5e4c2, 0xc4e23d7a5cfb2749, 0xe09faa37c006efb7, 0x62c12f9fe8a084e1, 0xb9ca1063e65b83cd,
-          0x9d4d6c0a4a16dbe2, 0x8550882d8d9de078, 0xb08d7bf6c048a78d, 0x234b7bde3bde264b, 0x777b19b219c618dd,
-          0xbb87b195f6e5fe47, 0x204f9f3968d25b75, 0xa61b99acd8aaf221, 0x7b33f73db6066c30, 0xeaf90c659ad9fb57,
-          0x176f5a964595307b, 0x92d56472e16321b6, 0xf343e33faf7e5e95, 0x5d212296d339b708, 0x987bdd88291b0a5a,
-          0xccc5a6d1b40b8899, 0xbe523c63f6e8bb74, 0xd7b0cf644e655fd0, 0x5d7e02f367cdfb72, 0x1ec2198f30a1b2a8,
-          0x05c7a8cd00827e41, 0xc4aebd3808a9669e, 0xc652f03dfe7a6553, 0xb93eb574cb71e6c8, 0xf8f4d1a70f5efaef,
-          0x20ba4e6b0d2f2731, 0x3f73cd6a19cc4210, 0x332530595fc2b664, 0xea304c644ebc92c7, 0x76cdbad84ea9c148,
-          0xe04c29c2c9bce372, 0x2573aa27eb752227, 0x015ef5da219771e2, 0x54a4f4fcae045a9d, 0xc3b160d6fcae8675,
-          0xf5fec895eb8184bb, 0xe088deceb72bf43c, 0xe09898fdc204dd88, 0xeb75ebd5d9115cdc, 0x66eb1f57a800f1e0,
-          0xc34a3e5621aadd85, 0xca5ea4ace20a6d7b, 0x85373ea893158071, 0x67ac2b93c3ced632, 0x07c61fac41911818,
-          0x5e6f3615df1d4e1d, 0x227d11818c9475b5, 0xbf6c49dd55185b7c, 0xd16659f8e644a879, 0xa368ea5b541a4baa,
-          0xcbb43f60b18a6036, 0x3f45cb44595d59c5, 0x1111dfe56e0e153f, 0xe135a9f36dab89c2, 0x52b62d8ea89d3f5c,
-          0xace92ef0955a7518, 0xf3cc4d4588e46d01, 0xf0e5a4e24080b578, 0x24d52353a1fc4b40, 0xc643223539c8b912,
-          0x28591c1381b1c31d, 0x5457ddcd44740984, 0x2338663f02747471, 0xa3f435e73347b507, 0x834c8cae7473ed52,
-          0x060f560edd720023, 0xa81a70c55bf45dcd, 0x87802a0f8b5d9d26, 0x03200b70dcb035d5, 0x7d479ebb62d291e8,
-          0x8e83a67c3407a63e, 0x9b3ded5ce944737e, 0xa0a3bb9c18825eae, 0xa5b7d01fa2ee46c2, 0xf91558368d8ebb84,
-          0x5993ccda41ccff81, 0x26effe4769e96b93, 0xf578b1f0bbf27905, 0x96a4e1f1cf977899, 0x658eaa95db6d54c3,
-          0x63aa44dab8eb706d, 0x4c452f4436a84bd7, 0xa4105f3e5bb26ef2, 0xac49261dea976e58, 0x81ce87ece22d07db,
-          0xc7b6bfccb7597e74, 0xc79c798863758e81, 0x8ae94a2ff99e74ac, 0x0ddce7cc9884c5e5, 0xbf255fbacdee8691,
-          0xb5f1a90622303f4f, 0xe08ca5b6a210eedc, 0xd34d4b58da814bc1, 0x77cab5bf84eed70f, 0xe57ca7795d85cb16,
-          0xfbd77c807fba7fd8, 0xd69df605d0cc2ef9, 0x056dc7831ee3fb77, 0xe588df798c65dce5, 0x3775a7cfe96900f4,
-          0x070276ed13e53c4f, 0xf382c6f21f30c1dc, 0x2e0550fd65c20b34, 0x35f70458f90982ef, 0xfed44eef9cbbf0df,
-          0x0be1b2ab17b6e1f1, 0xe9bfe00ff31cfff3, 0x78cc737475a7cfec, 0x7400890704ecf063, 0xba2de9a1b161bbf8,
-          0xd2629feefb01d4f8, 0x0495c370e7e51310, 0xb48540c82ee6764e, 0x7a859e069f3804e2, 0xac2fda42e3654be8,
-          0x609e37a0d8fb234e, 0x10b5c3ef5700a1bf, 0x91b7ef763ce3e4fb, 0x96539f594e443981, 0x3e84171acfae814e,
-          0x16d7439090a68fd4, 0x02237ab39f92875d, 0xef38b7055bd0f7a2, 0x3bfe0bd67e159ff9, 0xb358c61d89ee9963,
-          0x016e1aa703738c38, 0x1b50dfe64cf4cd5f, 0x7534edac5c9f536f, 0x331b646c641dd3e3, 0x503d0860e5fff114,
-          0xa7a9bbbf26057b8c, 0x1a83c7fc34bbc5c9, 0xb8b4f95f2329489d, 0xa54089267de033ca, 0x83a2b2702fc74995,
-          0x59e2cc312a093b6c, 0xf9a3aa5fafd86697, 0xb4217988c507f7bd, 0xd551d12f76b8e95b, 0x586c9eae4e8872b9,
-          0x8454b1a7b725e9c5, 0x211aa460189f6436, 0xfdc9813cf9f43304, 0x1abe8f323f68665b, 0x3e28ff142967fea2,
-          0xd08c527492557a13, 0x75f0e5b89f64ad4c, 0x192f5f3f5e6cf753, 0xac4d097d6f560867, 0x6f180adcc975b8ed,
-          0xd9808b3d5977923f, 0x51162cb9112c54f5, 0x977bec3b9503f57e, 0x0e627dca9ff8339e, 0x57db5592a2dbe5fb,
-          0xed488cb2142ee375, 0xd6f86fd06d7f1ccd, 0x618283fae4a0071b, 0x1fd41eee3cf224b6, 0x738104c9e7ed0480,
-          0xe472ab9875d84f3c, 0xdd79928172ce946f, 0x616c3fad054c0d6f, 0x86302b46ea448117, 0x188870878230801e,
-          0x0ec8480e0421589b, 0x2811321cb879d9c5, 0xce29cb2467e2700f, 0x3a57a4294e961425, 0xfa0fa94cf55f163a,
-          0xeeba57ef409b76bd, 0xd1f5a4612c305d11, 0x50048d05a390367d, 0x605a8bd47d6bdd89, 0x87b41b3c68a4424f,
-          0x48b8736fa83fd53b, 0x631498f6ce3da181, 0xe99e99a84e545f3f, 0x3076439c07c4f5a4, 0x167c4aeca1a8424c,
-          0x809de47d335cb555, 0x0149bba271c09dff, 0xa9edc518f579ff29, 0x82ac1faed6590175, 0x0ceb2da2fa33d5b9,
-          0x1e82219af45bcf6c, 0xf708715345296099, 0x2859e871e352a169, 0x09d7e3164022522e, 0x2880e2c7e24a450f,
-          0x1a3830249fba96c2, 0x039474d884b4d6d1, 0xc7b57021da52879f, 0x71ebaeea336da1b0, 0xb6c13bdf5db71892,
-          0x6f81f071bbc43df5, 0x3230234a014d43cf, 0x378495568e2b9790, 0xeef3f7c560ad998f, 0x77125bc8caca87cc,
-          0x89c2f98dc6934e75, 0x4c6c53f363700ec4, 0xeca8439a0cc76ca4, 0x7933ac743a2cff4e, 0xf1fde3ec897b0d7c,
-          0xfccdb2cae18b6175, 0x70b7e816ce2eb72f, 0x39677f529f8b41ef, 0xe998f7159a993ced, 0x0f63f1fb232c4ea5,
-          0x943449a76d4369a2, 0x6f4f9b96871e6c8f, 0x846323509e7b9ea8, 0x87fca77626e79be0, 0x19ab5dc59b2b8b07,
-          0x6d86dcb592ba2b9a, 0x6817292ff964f6d6, 0x8ec43245729a49ab, 0x7b6c0521f9a287d5, 0xfa6c988f4c16b0fe,
-          0x93f7afb28c465033, 0x2cd2384be2502a44, 0x676c41411ad95a17, 0x191c3f74f3472e05, 0x64c234ebb6d2ce70,
-          0xbbba4f800cb961b2, 0xc9238445cc00e2ad, 0x54ec36efc829bca9, 0x4ec6c299ce8707e7, 0xa1846e20de166815,
-          0x96c7a813d2354c67, 0xdc5737aec5e0efda, 0xc734a01ca71769f6, 0x31dfa114fd4532ee, 0xbd86b6cae02aaa97,
-          0x950cd707b2ed8483, 0xc9b9f77d364fd7cb, 0x7beccf067338e0fa, 0x81666456b04284f7, 0x440da1e896cc7860,
-          0xbf964755713d71b9, 0x75545d18e91f634c, 0xfcb2624ab19f4098, 0xd0f1b5b4f7c786b9, 0x6cb3d32d01f65124,
-          0x0825267473d3df71, 0xd7c07ae7e5405217, 0x72b622c0a696bcce, 0x67eefdd0b1603bf3, 0xd65a1f4f62c27964,
-          0x7736c26d28081dbf, 0xe56f971c69320b27, 0x9d6f6dafd1ceb120, 0x5c1cbfe56fe4bba6, 0xc82f4fa696c613df,
-          0xcc4e9bbbf301e4c1, 0x0f4b7940d9e6841f, 0xac0fe9ed8801e150, 0x8694c58ed3a6aaa1, 0xeb88987eeedcb926,
-          0xd37be09cc87e9a72, 0x0516f5be355af80e, 0xe5fcbfe8f316e75f, 0x5b98861ecdb56a04, 0x46770163b4039739,
-          0xf303fc5eb93824c6, 0xe76d6cd48d11f174, 0x273a15fef48a92a8, 0x37025629443a2112, 0x6f1ac761b28292b1,
-          0xf6932e27fa596c95, 0x86f2c064d66f45f6, 0x753d50f1584f779a, 0x093b6bdc93cc9c0d, 0xe1311a4240e02ff4,
-          0x8c7c376e24d1a08a, 0x4ce019cd7487cdf3, 0xf6e649560814a77b, 0xec1eb56a424ad56e, 0x53a93c0d24e95034,
-          0x94175fd0adc6a130, 0x82da0a67f7295233, 0x50a344bbc35ea05f, 0xc371d5371cdb0a6d, 0xa19bdfbc8dda4fe4,
-          0x032fe839f085d310, 0x64187be38499b3fc, 0xb7c20d54ab15ba09, 0x7384b945631313e1, 0xb46515478be3aabc,
-          0x58acf2ef602bac33, 0x6f83b3ef30353dc5, 0x58518da7a51c4bea, 0x319095a622332559, 0x13e566d77d9e0e38,
-          0x332d909dc69c74c1, 0x3ce5a87c16888946, 0x44b8d9f4e2b388b2, 0x7436089071a75a94, 0x5b0c43dbe6372aa1,
-          0xb386ad66178f9fa1, 0xeecd4f43a765b04a, 0x3adc6d3ab4d9a98c, 0xe551ea1678bd75ee, 0x9d43f6a82d6d8d99,
-          0xfcc0c410f3140907, 0xed459f6f3956c87e, 0xa0c254fad74b1d3b, 0xcbe2cce2ef1b499e, 0xeb60b65ebfb4a45e,
-          0x922569fc9d64a228, 0x3b126ce07eb95a78, 0xdea7e4b3fe0b813b, 0x496a7a686c9ef167, 0x36598962c3c8ca45,
-          0xbb5e46772a755c96, 0x83afed523a53ed04, 0x0514c280d65f1c37, 0xb95c87357611a7b8, 0x9bfbb13f050b4595,
-          0x9a2c8e31dd6a9b5f, 0xcf5639eaf7bc192e, 0x93dff7bcf4d12259, 0xb5ecdcfeb839d9cc, 0x414607daffa1b51f,
-          0xa1021b5f22edd01e, 0xd82a225f44ab2aa9, 0xee86eb6f3f507136, 0x66a7f81f70388b5b, 0xfa84985d2e95a56f,
-          0x67f435ee18839642, 0x449f9f5803b3df7d, 0x6ee41353fce77612, 0xc584e7d91ef81af0, 0xd46dd7048f0e80f0,
-          0xd6bb120cb6b8a8fd, 0x71d4dc24e086f697, 0x894025579ea32a2e, 0xf3147913bb07c64d, 0x5973e05e60654c0d,
-          0x88cebf9280f800d5, 0x5d5f12ea3c51b5bb, 0xab42d9b08595f816, 0xea748f874a21c2b9, 0xc5a45f7f482e1a75,
-          0xfef6ca95ec2fd971, 0xf830ad690e3b4cd2, 0xfca8cdae3d1a194e, 0x7fed8ea429a23cf3, 0xea65512f325824bf,
-          0x397c6702b39d793d, 0x9b849cbd68293395, 0xbfaba0efd5af1edf, 0x3e5a413c8d58447c, 0x7ee7b1d278864e4e,
-          0x93678994f7618534, 0x0e85b5e83b53440f, 0x63afb4431b8c799c, 0xc9d96eeeb13804dd, 0xc97278c345efdeb1,
-          0x51a93aecde97866c, 0xa8e457064f98b93b, 0xd5af5cb78f2d4de1, 0xcf6a4ce833376f82, 0xbab0059147babf17,
-          0xa2111dd7b6003164, 0x5a05508a5c9d3b39, 0x9eedb586be6c17bc, 0x57e57e63dfe7325f, 0x82441d56bfce3c35,
-          0xec772fdbd759cfbd, 0x062be62a7d1631a2, 0xac7d4e98f1cb2dca, 0x469f0b0e97e680bc, 0xb1bb636a28a632fd,
-          0xd6382b008bece037, 0xbb0ac596dc5d2606, 0x8a55a27549869d6f, 0x2ef2a2aa0328cb72, 0xd5de2be7d1c40d90,
-          0xa45d417eeb72498b, 0x3fc0f731b5ca36fa, 0x807acbedef1d9182, 0x4524bff0ad9112ae, 0x05dd90302b82a742,
-          0xee35568c72015143, 0x19be7030d3532c74, 0x9c31f2ac8563cf9b, 0x3470587162a01f9a, 0x9ce50715bf95b222,
-          0x44f63ea4c80e96c3, 0x1d34f90eacfd40ff, 0x394f97779c583d9c, 0x1a704d0de50372b3, 0x6c453bea283310c3,
-          0x7e59c5a7b7a339bd, 0xfabc44ae5c61e7c7, 0xbc1eff71f20509b6, 0xfb6dfcfdb12b66eb, 0x55f2c105cdbcf636,
-          0xf798208d47c6938c, 0x11527e47ccfc6821, 0x0dd2511c08b53774, 0x928de180f5bc9773, 0xee0c9e777258e144,
-          0xd925ecfd968bf2c3, 0xe9ef35724a47a42d, 0x6ea56981c9783adb, 0x959ca034236e8431, 0x3c163772d85b36ac,
-          0x9a55ecbcf1cdfcbb, 0x0d0df7ad3546259b, 0x9de5b9b50755d844, 0x864f05fa65c1044a, 0xfde816e70c807ada,
-          0xaff145fa5d5fbeab, 0x65e2e86c774ec616, 0x33bb5ec714aea353, 0x1f7c15052353fd94, 0xa60a030eaa20f06a,
-          0x9443e1eff591235c, 0x0b8ed9f4f0e3c08c, 0x5172d63f5f275099, 0x995fe54f526c24d9, 0xad236095861967d2,
-          0x5d9bf51a4fd922ed, 0x0e6653730d03604a, 0xecd56b981ecc8b32, 0xccab3ca0918ce469, 0xd1a7322f5d03bdb7,
-          0x7961a073aa8cbc69, 0x51a8d3ca3b6ab65d, 0x30d78e3bb0d9f30e, 0x11940f27086a2038, 0x7baa0000a74e1a58,
-          0x90bc316b7ced5b1f, 0x6ce912de9e478987, 0x25b5477cfc49ba12, 0x49886fe09a703e7d, 0x3a25f11db56b7c7e,
-          0xc0bfca67b3e82441, 0xa4610e03abab466a, 0xfad5f59aba3b0192, 0x4e9fcddb28f34caf, 0x9e7447bc3a3d8019,
-          0x990e36bbc369309d, 0x241c4f988946740f, 0x24974cab37952a5d, 0x379e7e532d0b3739, 0x9884ee7625de8369,
-          0xee421476565dd9bd, 0xed8b9a4da5b367a8, 0xfe7b9719313a15b2, 0xc9bb9e6071f941b2, 0xb51cfc132114326e,
-          0x11127706db303f02, 0x8409550c7cc82dbc, 0xa5833c3dfda142a8, 0xf911ee19c825a671, 0x5b0b4f0092045a74,
-          0xff9392c9a163f506, 0x72f8c95f0c8fbfb5, 0x2e3d586189e974a1, 0x864310ee1b54fa1a, 0xa9e5c91322c10a5d,
-          0x1f5f5874b607b3c2, 0xdab8f051fd442bd1, 0xcf69d2e253fb61dd, 0x78eebcff9558933d, 0x2f3ae8c8b8162f10,
-          0x5489748d78f760a5, 0xe776ba713fefcc9b, 0xdb4705d3c24351e7, 0x259b76444e1fbbc3, 0x3975127ae405ebe1,
-          0xdc7ca5ea4ecad1f3, 0xaaf6c1ddd796af90, 0x86ee0278384c129c, 0x196cefb454a35bfa, 0x7bb09699b0ea9eaf,
-          0xe15770d159668705, 0x85207bda6d0de81a, 0xf76684328f9e7bd5, 0x10b5456921135d15, 0x941a127793238f8f,
-          0xaa75a7922f1b7f74, 0xb1aef0456c6542aa, 0x3779c467ca4dc25d, 0xa72e2c1d91101236, 0x48e5ce75df45128e,
-          0xe9a12b65a19de166, 0x28848d018826fb6b, 0x488e9425dd31ca82, 0x123f40f4a883d7f8, 0x1e8599c29e0388bb,
-          0xb05527f33ae7cf35, 0xdb883bba1542a39a, 0xa3eb8a71706812f5, 0x8eaf1ec288e10850, 0x7b3226836db414b0,
-          0x8a24e55bdd67a569, 0x6d27381242b54bcf, 0xb78c59268f71d7ee, 0x4daf09cc8f89bb83, 0x85b184cad9089567,
-          0xc7ea24499a385d02, 0x96988f137a582a82, 0x21aae81244f6f16d, 0x467d4e3d1718b232, 0xb015f87ba028d6a9,
-          0xc7ebf1feebbe597a, 0x1afa968566406584, 0x20ea2fe6aa783733, 0xaa6731adc996f410, 0xc0acb86a48e9ae4a,
-          0x704734eda3fd90ef, 0x4384797a0e41ab00, 0x20447719a6a8b6fa, 0x53ce5c0300063931, 0x5915d2bfb5d0d6c3,
-          0xb7f951066c17a33e, 0xa16a604f455b85d6, 0xf46e207adc60a0d4, 0x0d48313117912e71, 0x02bcdee28481234e,
-          0xf13897474b93e4c8, 0x8a4db15fb596accc, 0x6dd02fe2c420b1c5, 0x3d1d61c0ca55d3ff, 0x18fa8c79b4c02a3d,
-          0x25316fa26be7b2a7, 0xfd22d5a1bb79bee1, 0xe05f20c444b8cd9d, 0x2028025bf8cc4f6e, 0x60fd263cfcd9ab75,
-          0xe69d26698eeb139b, 0xc8d15da64cd2b7b9, 0x09a079a2664e554e, 0x0ff8fc9295a2d638, 0xf3eb0d43ebab6c3a,
-          0xb182430246562b71, 0x19aa5b5d065827f5, 0x1b9134c4f0784982, 0x63d8f2ef90add868, 0x1cf578e405d6e2aa,
-          0x3177bda5e63fee09, 0x9cc410fac8e4a21e, 0xb50b2de8e67b4051, 0x65f454fdb9bdd393, 0x1c13bd76dd40a94f,
-          0x30bc4e6e742ca1a4, 0x3b14e16037405f93, 0xfba8e999ad7b416f, 0xa4b5890e675ac6cd, 0x20966e8d87c4a601,
-          0x7ed561d551a29b0e, 0xf3708ac731269234, 0xe0044eaa963bdc5d, 0x76e086a593b5f988, 0x38990d568183c3bf,
-          0x3134e81b4a873c67, 0x21a590a2e3c39124, 0x3c9032131011be6d, 0xf7e232afef98e8f3, 0x313a39c011f48292,
-          0x44e36dad204a9420, 0x0a7542cbeacd85a7, 0x4378990975cc5bf8, 0xfc169cebcc1e007c, 0xa5163c67b303ff32,
-          0xcfd8ebb05a99a51f, 0x9dfde8dcc5a42fa1, 0x46ffac70fe5feeeb, 0xcca911fe2c77ffbf, 0xdcb4fddd702867f6,
-          0x85fdccfd59fb30f7, 0x48f6a70edc101c21, 0x0c63021230c464a4, 0x50d606d9145da466, 0x2954864605ac07f0,
-          0x143e80e2bc64cb7d, 0x2946f9c3c47fe2a9, 0x9e070df88bd9f1e7, 0xd6c70ff59bcfd415, 0x7e45222e9f1c0cf9,
-          0x563f9d2a24f16a0c, 0x6daafa1037f960d7, 0x40fb625c6bdc56a0, 0xc474634d43dd2c18, 0x82496348f4c844ae,
-          0x0eab766ee6f712de, 0xf56e496d5635cf79, 0xf9700053125709f6, 0x76e02796063d90f0, 0x5dbdc4e299d6f24b,
-          0xd740f1f77546658e, 0x3d01202454275b4f, 0x281796e74a1515ae, 0x689afe5cb545bb96, 0x6badbd57cfcb3332,
-          0x0975e643d416ddd3, 0xe3d86f40d7a3c695, 0x8c32370524355619, 0xff0bc6b3c7faaecd, 0xadcad19985499e4e,
-          0x1f508386705f0237, 0x40c83b1b015884a5, 0x61610ffcb790c8ec, 0xc6951d1c51e31d05, 0xa7b7a8470c47601e,
-          0x1492b967fd00391e, 0x36d7818f967648ce, 0xf31d0a31f143dee6, 0x4ca05fb2f0be009d, 0x5c40dde7d23ad6be,
-          0xcae1bd8787154114, 0x32a96a903ca8ac7d, 0xa96cf0bcaa814a67, 0x21f4677bb166c450, 0xa0ae268073d32e95,
-          0x7df48eec16d2b7b0, 0x56a97a7ae3502890, 0x03cbe7a46a0d177a, 0x932bd86ca8e48f23, 0x1c3483a412354908,
-          0xebb59ed04fbba077, 0x029c28042501fd7b, 0xf891822939f1d062, 0xe7017682d3703bd9, 0x9143971c896ec292,
-          0x6c8eeefb77b20e03, 0x418ffb58d483c026, 0x3d52de88d9a6f737, 0x4cb41f72726fbdc6, 0xc66d933d1c433c18,
-          0x57287dd415225980, 0x3e821f0fd0585b9f, 0x5461575a72314e3c, 0x6f452dda16f07c9c, 0xc16ff14f48f13cbc,
-          0xa2867f4849ba09ad, 0xc04d46f353bc36e2, 0xb151b572e1fb338a, 0xe4eca78a9c361031, 0x6d4aa95abb68560e,
-          0xc19f27a8deda1c1f, 0xa140a42e1fad48a8, 0xbd0113647ede9b4c, 0xd747abe14cecaa49, 0x7349a0e47ca791c1,
-          0x5263b5af0f82f5c9, 0x74ea30deda829e26, 0xecec75da9beb3ded, 0xa39e72a022ad313e, 0x825d641ebb1fbf3e,
-          0xc51dea26c25c64ce, 0xaa4c744b01184f98, 0x7b2d4edf1a4a08b0, 0x9f2f8a430cbf3fd0, 0xe0ce4c5bde96ad5a,
-          0x41f70704680cb473, 0x8c15444616b93fb1, 0x52e02770862f8e25, 0xbb4bcd4e955f5d10, 0x17de4304206f2c30,
-          0x9ae69376d2498ef4, 0x87f448131e7e8df7, 0x92a6b453d3dc642f, 0xa58f2f7e3c01abd6, 0xbd66c0f0e3e24664,
-          0xedfccd1c816b8122, 0x2620742739945646, 0x533d03e3088e368c, 0x9f80ca038bcfa321, 0xf56bdcccb36cdb8e,
-          0x31214feb9aee0616, 0x5c344eaa2ac79881, 0x0e7843280e78c771, 0xa8aea8fa78a83748, 0x8eb852830c392d36,
-          0x59e043fcfcebb796, 0x26fcdb6e073ee63d, 0x8fc12d21eb59ba80, 0xa011adbbc5ebf51d, 0xc8f4a93c51e74bba,
-          0xbad0675a8468ed33, 0x127e078d104b772f, 0xe64e793845ece8a8, 0x295bbc270c809f13, 0x5a6979dccde8cb87,
-          0xfdc753ff7fdb8d29, 0xd3bf3ffd14c81a9c, 0xfe831d530a9c17de, 0x44cdd799c8e5004d, 0xbb3975c9a730e9e4,
-          0x5d1c1cf1937c60ab, 0xfd42706f2eadf139, 0xa0b09fac42a6b947, 0xad34f58d75e11fdc, 0x8c02b735216ba441,
-          0x607e1ecfa13d80bc, 0x1ef3e1c6d1261788, 0x371e53c27e5e342f, 0xe8ec2ebc369e5c30, 0x8814485de29672a1,
-          0xecb68a2c9ed8791b, 0xb306bb020387ade9, 0xbb0778797a50ab8d, 0x874238bf0501dd69, 0x74a0900a1dd422e8,
-          0xec415a3d62d648b6, 0xc062a8dd7ec500e2, 0x7420ab7c2ac3372e, 0xa33ead9630fecb28, 0x009000b792ce614a,
-          0xdf95d5b24327137e, 0x16a172c90cee4d0f, 0xc69a0d9cdc7d2828, 0xef1264f7ddbc4e89, 0xa7cf0be53a194809,
-          0x0f0516baa1a3083b, 0x110107d4d6653869, 0x0468a43b18ce4971, 0xbb82507856871176, 0x21795369f84d0e56,
-          0x83461c5fb5b84274, 0x5c42c5d04326b64b, 0x109ac2ad9ebbb5c0, 0x519dce5182e3acf8, 0x5e0636970e0a64b9,
-          0x060850870421946c, 0x1254fe0882b0bce4, 0x91a0e461ce9543b6, 0xa2957e60f259d3bc, 0x7ccc5dcd727478ce,
-          0x0c728637b91dd091, 0x86e84acbaacefbc6, 0xd96d1789ca3ed17f, 0x982b0274456bfcf0, 0x78c452e8ed808051,
-          0x4f9662bc279d9632, 0x5bcba98425c0a9ca, 0x32a12e62a88b15dc, 0x0886c64e6311027c, 0x4f85659980614dad,
-          0xf104ec7e7a71b4f6, 0xc7bc8fcf4aad18b5, 0x3c4392c461619beb, 0x486608f147679b9d, 0x8bb657cde54a83ba,
-          0x90a3bcf16a1f3933, 0x7f08b636af13d60f, 0xea0862eaa6cde6d6, 0xd04c1a3fc82123fc, 0xeea6b2b125e65b3d,
-          0x1b3029e225dbb2c5, 0xf586c4d13e1402ec, 0x293b7e3a8d25e53a, 0x65c48d3b418e2c39, 0x9794bde6528d0dea,
-          0xd886e0db6588e0b4, 0xbdc235dfde77a755, 0x093a0a1238d49796, 0x2482362636bd7ea2, 0xe57780413f64c32b,
-          0xfdf0b70d798e4f39, 0x7c53f64d28cef6d9, 0x81a8784089aa2db9, 0xd5b376dcdc3fd6aa, 0x0f5afe235b8d9cf4,
-          0xd210b52aae85f063, 0xe8a783a3aa419661, 0xbfac1095f8e50633, 0x8774a633901379c7, 0xaae7f7bb435abaa9,
-          0x1b993aac83fcb351, 0x7023e87e68b86aaf, 0xe88aa5da011c1322, 0x6e049ce9dcef1d11, 0xae8b66ae00b9ef33,
-          0xecbf4b6e7083e024, 0x8341dfbf471bfab6, 0x0175c2dc16364116, 0xcd91010efa061bed, 0x9a7a41c754692d93,
-          0x2a933930560e589e, 0xaf0fca87a8e64d3e, 0xfe6f3000cb143d03, 0x25ee5fd14faf1f0e, 0x10cf1df151d55f0b,
-          0x49d701210538fc5f, 0x766cd5d5833936cf, 0x3e68d984784c4561, 0x32318154c3eb98c4, 0x30d3062ad0d3679c,
-          0xd75500037c10e223, 0xb2302ec1ab827c77, 0x3b3e0a6a2845d8f3, 0x0b828da8dfdec446, 0xb682b79e9cb6b268,
-          0xad4d4c70d46a4872, 0x54300dd2a25a5f91, 0x6670b15835464a0e, 0x5b9229424497c09a, 0xf0809dca80374ccb,
-          0x0465880ef8d75663, 0x40e55ec12737eb0e, 0xe3905c455a373283, 0x522f32878b6863d7, 0x72b0283b42334965,
-          0x453fcf9f4a5d03bd, 0xc90dfef468c0796b, 0xf8403808591d255e, 0xf9932697a7a30969, 0x44a0744c13cc3453,
-          0xd102f355f558cdd7, 0xb9184689a889d51e, 0x345d3f220b815c9e, 0x55de09f796a24967, 0x4d8dced5fd059c2a,
-          0x42034ee4a3110608, 0x3eadca9e759868e1, 0x8b88146f5c319f20, 0x8d8849b30e4f9a41, 0x0852f7e21e3a8087,
-          0x2ce06acb55758038, 0x6dd3eb4a7693cb53, 0x139418967030c33b, 0x0fad87b9995cfa16, 0x3b288efdf87885c7,
-          0xefc4ce3e59005794, 0x7f6e8ba4905ffd7d, 0x61d0268f89bf9aef, 0x122981aa022489e3, 0xb9f1d06484117d08,
-          0x30402dca1c3258c8, 0x53793aabc56853f4, 0xd635e5b01e253178, 0x2b0610d88f57bbb0, 0x7e529596231db0b2,
-          0x01daf20a1c4a6f99, 0x0c93b572e01dbfca, 0xdfe1413d2f5e7327, 0xe0192d0d7d5fedee, 0x559519432d189a0a,
-          0x47f9b30e00d7365d, 0x5b8530b2a7b1433f, 0x96a4ac4a6de6e41c, 0x8f753592bc00cdd9, 0x2af97035107ec75f,
-          0xfa3a34d2aa14fa00, 0x308f0d6bb4b96cf3, 0xd4cbbd6afbd5ed5c, 0x47b4b383daeaaf60, 0x73fac9b007fcd167,
-          0xafe8247f9ddd79fa, 0xaf05267f8a34aa2d, 0x43bedce9c857c28c, 0xd6a77fbf8c57175c, 0x41fb856b6b9a2d97,
-          0x3d9c134471cbd2ef, 0x6947ca59447ec0d5, 0x5e25498474660888, 0xcc91aabedb46fb26, 0x41c38beee12a5d44,
-          0xd768cd7801a77063, 0x908fe0bc4b2642e3, 0x0631ae5bfaab1da3, 0x2438000bfc5cd953, 0x105dec119b167ab3,
-          0xf2b4e703609a5b74, 0x793cece60411e987, 0x8719acec1b3a5961, 0x4a55faf713cbd50d, 0x9290a58e05a946d6,
-          0x70ed7a0692703e44, 0x4b67a03a65ab9c34, 0xc15862ac87e8a696, 0x566c4721375e6ac4, 0xaa380151c0ca8dfd,
-          0xc65d5e7e27218f97, 0x2ccd26b03e0e23eb, 0x2fc5084b599b5805, 0xfa888c2ee1e7f456, 0x9518633cc76a609b,
-          0x45179827ad65d214, 0xe52cb27db57082f1, 0xd249d6b05d3e4347, 0xcd80fe4039961467, 0x1ef7887ee9d8f3c5,
-          0xa133d1cfe75399d5, 0x83c1e2f8861a1a28, 0xfcfb2bac0087aa96, 0x28ff617730741588, 0xfc716f14b5d57501,
-          0xac8edd35ff47411b, 0x7a6d0f0ebcc4c12e, 0xd28c081be697a3ee, 0xf8871004c18358e8, 0x4b9205509f89d24c,
-          0x9c97bedd3576e945, 0x3d6c9e1b4a97e739, 0x44d56387942eb40f, 0xe75a7c8e5b08f9a6, 0x5c1dd253be561f9d,
-          0xe0d289a3b600cb27, 0x4d7478850470af69, 0x8f6f45569d1a90d5, 0x7e306661070a9c27, 0xea07782764095cac,
-          0xf1cfd278fa1a36cb, 0xf91878ab9e1fa7a5, 0x70875e6a5362b2ea, 0x02a5a37938820329, 0x8bb6180f8d2112f1,
-          0x5c7d9eb2b451e38d, 0x66a578b626524c9b, 0xbab01fb9f88de601, 0xccc55d23d7895e27, 0x09a277e7fc5c6348,
-          0xa5c22285c77bd909, 0xaf63e52c37929e28, 0x20d70826fedc16da, 0xd6a9df4e3a419b0c, 0xd14cd79615d9feaa,
-          0x8b9800e44926c15f, 0x0950fe91881a563d, 0xe551fe7eddc03b28, 0x793572a2d2d28c6a, 0xd052749f4952b08f,
-          0x42301eda2caff5e4, 0xd0fcb101fc1f7c38, 0x8613cfbd94f8bc49, 0x370ea17d03409e25, 0x24d5376608b31ec2,
-          0x6402c3913bfb2631, 0xc68816417c210405, 0x05283eeb6bb6e50b, 0xfd1cd371cb59eb01, 0xea628c2de90d5387,
-          0x0cefe4ec4c47e6a5, 0x12c71c54076b9032, 0xd2e8ad733fe73479, 0xa6242c04b6ee220f, 0x9513d11e79d98528,
-          0x9b6a47b081d505a8, 0x714398f6869b5e1b, 0x38d75284bf38c93a, 0x8c600da2c5128870, 0x2a83b8721438b24c,
-          0x7759573bb2ad5b09, 0x69394e6cfb2ed200, 0xfea6e3eeee4381c0, 0xa09e03a490631e09, 0xc546ef1921ef0025,
-          0x7eeb6d604c7168d9, 0x952d520d0a43c2e2, 0xd29bf7d94f32cf17, 0x0b63f985a77c3e09, 0xe3c93977f1225c44,
-          0x3cd7ea4b6f28a3a1, 0xc45b348c6519c08e, 0xfa57ab6c06d506e8, 0xbf9c8de9750f906c, 0x4a9ef51ca621e027,
-          0x7b26bc0026da91eb, 0x02ba77a36a50f120, 0x154e11ab63f38641, 0x41c7d09bed94d26e, 0xc268506702bf47f0,
-          0x4986ca6186d49316, 0x8c8fb0df6caa8845, 0x7d26479f4c09dca0, 0x00c9982f164a24f2, 0xc08ce13b17f4b320,
-          0xc96501e3126a5cb8, 0x041e9e3ab282acb7, 0xee7ad171bb4501e7, 0x76f65e497127ca25, 0x5e6948e5309dd590,
-          0xf4b69308f503937f, 0x6237bccdb8891aae, 0xd1984983e78cee85, 0xa3a02e3cc11b3d6c, 0xbd5c47cef9c6b5c3,
-          0xc69e732ce822049b, 0x2fbd9bc56108e911, 0x3a3792aa0abf1d37, 0x2c3700d60e8c0723, 0x5ed5f736a98037a9,
-          0xe1742c6e9647aea6, 0xe0c351bad2e69519, 0x4497a164e44dea31, 0xd2449680dd78ba56, 0x9cea5e86a8680522,
-          0xe669cbc45ac6fc0e, 0xe4289c496fb21053, 0x2663bea69a50c282, 0x98e15791021f51e6, 0x6310a91cee813ce0,
-          0x1fd7c740d0b01e37, 0xdaba07ac8e260044, 0x435265a2d7ab4e9a, 0xf8b1e310e5f44204, 0x54ba8ec66c0fde99,
-          0xef42064131115110, 0xaf18b986cd15f5cd, 0xf99604d3d0419da0, 0x5a396c30690fba4d, 0x4dfb735043e2db04,
-          0x429919e86c0e2633, 0x3e06d8b01437711f, 0x630df65f80ce0bae, 0x25668c75b21e5505, 0xa38d3394c79e8e46,
-          0xac38d5db17005a5c, 0x2e142055cbc86794, 0x68fd24b0984b4c8f, 0xa932c2c3d4bd7f16, 0xe8011c026252252f,
-          0xc8e04f402ce20e9e, 0x843c1c6c3a5c69ab, 0x2645f25cddc19a3e, 0xc773dbc2a4b68911, 0x641f29368ec16cda,
-          0x4a8673bef82ef659, 0xc0d7d4950acec8f7, 0xa0b5c394e0c67a6f, 0xd70238eee52a4443, 0x63e5a4abe73ad38c,
-          0x6a26c8d1f940b4f6, 0x9bc5ae27111593b7, 0x2c66242d1b016f23, 0x973a1800f01a3456, 0x8e09c73129b63f31,
-          0x3638ceeb02e21dad, 0x849cded653c497f9, 0x98185dccc051b009, 0xfea56a258f3b20f0, 0x792bcfe5095a1d07,
-          0xb9cf83de1698b7c4, 0x0c11ef911b6010d3, 0x832008bd0a929cad, 0xb9aa81a9b187bf04, 0xbf34de605e24e77e,
-          0x9fc298ca6572d9e6, 0x0e8d415a27081848, 0x36671235c8f4b3fc, 0x8651c1147cf866a6, 0xebc5baa72e5f4439,
-          0x22adcab249c4db1e, 0x0498e603ef337fcf, 0xa0b43ed5948a8a6f, 0x3413ffb35b41178d, 0x778c261a6d4f08b1,
-          0x1bfdb2a91e8c196a, 0x44d5b426384af9c0, 0xd3b8a64b2517fe15, 0x01416a91f41156f4, 0x2ed7f2b51f5e9aa2,
-          0x4969aca068965c4f, 0xe009bf4e54616a1c, 0x35fb067cc29163b7, 0x4ca3c02968ba362f, 0x8c1afd6e679f47d5,
-          0xd48c25e79caa61f5, 0x1cb7d6e656f3efec, 0xc48913a3a3d7335f, 0xa0fd7526e6a04a35, 0x9ad4419b308033b4,
-          0x34b716a221a8bee9, 0x098f02272f1ba367, 0x24681db0e76532d0, 0xadef4a61eb1b136a, 0x9c0c1c8a8f019d3b,
-          0x86ef26a03fd2b1ff, 0x652702eb1fd3a0d3, 0x4a985082e12cfedc, 0xede6e36dfffe787b, 0xa70f2759c571c780,
-          0x08a8e90ee44ff884, 0xa4d0885e12abe190, 0x8098081499dc029f, 0x53155cc98fadd460, 0xef7fa37379c5db57,
-          0xb2ab02973afcc955, 0xf223a1f5cf1e71e2, 0x207b7a7e20e3bd28, 0xad5d88f2d80f17c2, 0xfb1489982cb5cf23,
-          0x051aa6a093ac0f41, 0xbb0062950ab82ee7, 0x51d805c9f69eedc0, 0x666755429dd2d403, 0x85a5543a8dc42005,
-          0x7e5c86bd8c29a061, 0x6dac01ed3b312586, 0x01ec6864e9240747, 0xec11bd2d9a11bdde, 0xe299f3f03beeb743,
-          0x42102855fd100d67, 0x5c84b6d07b925383, 0x9441eab171735e14, 0x17ff15c409716d7b, 0x0222b7760cfd7008,
-          0x38910e7c3553187e, 0xf363cbcab7295602, 0x293c1a58d3244566, 0xdc640058262e0b1d, 0x615dd7486ae758e6,
-          0x2d5f17ef1df5d0c6, 0x165f99ed78bce506, 0xf3e111d38f3a5365, 0x64ffbc38c4d36b8f, 0x7d9cb2c0750fa03c,
-          0xb5895300272641fe, 0x559cc01ef486cc14, 0xb17c4236b6ea3831, 0xa68214b4470eefcf, 0x16371f1f7cf9d8fe,
-          0xc560380d3068d54f, 0x73fa409c3e68bdf3, 0xc7e3dac2f1e228fb, 0x85f687aed35d5f0c, 0x21c739db8fa7db7d,
-          0x94cae11f7b07a6ba, 0xafac91e68bc23d03, 0xfeb933f2b6168569, 0xc85518d3d8330824, 0xf175f454813f6b70,
-          0x91f7d84f27f5d4c7, 0x412d17fb364deefc, 0xa3378c116bef450f, 0xd97e7799d3117c76, 0xc06b378c5bffedd0,
-          0xcbe0be38eed0f35d, 0x7ac33886ee103c76, 0xc765f660a0e6ebb7, 0xb0e08b40abbf5e4b, 0xa2924bf491f06b17,
-          0x1047661f3376a234, 0x55ad3e8f8ed79fc0, 0xbe0ece2ea0c40975, 0x6f5de3b78b17ce7e, 0xcc648d3d3b13dae6,
-          0xf147a2d9a47509a2, 0x51134de442a1ba88, 0xe1be710aa3601643, 0x77081ebae3b20b77, 0x73a1d5d1eff41dea,
-          0xfadb5e77ed8eb7b8, 0x7fe3157ee235721f, 0xbd0366fefec2a143, 0xc017200d0286a86e, 0x7584de276d274b8c,
-          0x7ff87ef15c5e8884, 0xf8075ca7b71dc81e, 0x7f604596207fe085, 0x66e605a19e0b9c39, 0xbda88878c7f7d81d,
-          0x720de506ee0820ce, 0x87a4c39e4e0e8d2b, 0x8cd5e5c7fb20d706, 0xc93d33346a74bc86, 0x33658e4be2a5c486,
-          0xa95fb1c4dff37c63, 0x1a7c8d641d6fdf26, 0x10f088cf47408fbc, 0x3167896084bd9ff4, 0x49a3e3ed2b48f7a6,
-          0x93170d4874a06194, 0xcd0e96fd2ba76f00, 0x74b0e00d43743e75, 0x53d8d8ffdd7d37a4, 0x472d34dc217fa6c7,
-          0xf74bb2283b06041a, 0x922b3ce103ce1a12, 0x2771db909476e020, 0xd47d77befd651b93, 0x94d03204de3ea6bc,
-          0x91bdbbf4388df42d, 0x4cd9982ca7c17d38, 0x6a1af34f32319f31, 0x94f070a113de3ba6, 0xa85daf0dafa61a45,
-          0x76ddf763d253d386, 0xaf0d9a53672e21f9, 0x07b199d41943df45, 0xdc84df202d106f58, 0xe863e210b75cf4c6,
-          0x0d608191184950ee, 0x4a9c5254f2668699, 0x9a85d9042b23fb12, 0x9d7a0487c4a79d9c, 0x6fdb962009221750,
-          0x40fbc96a690bfde3, 0x6d56ca2cb2133308, 0x3c04637f483baaf2, 0x42d113d9cf05502a, 0x0ce72a82ed7a4c48,
-          0x9f5a63a99984d64b, 0xf33b65b9992b0c20, 0xf18290d1970ea88c, 0x62792b7f8ebe3507, 0x952a36e700946d7e,
-          0x2f7f799715b0ca92, 0x3aef1b873362a34f, 0x3aa7931a7649a705, 0x58590883ce6d119a, 0x81ea699647fdf4bc,
-          0x5d0adab50e7ae9cf, 0xd6e826dd16135467, 0x9c90f83bc861eeeb, 0x6c8356407d7f69b7, 0x964a07c35d478a9a,
-          0xc05fa3ee1ad85aeb, 0x4c5ebcc861b309dd, 0x0090f7e8efd447be, 0x90bb10c616b90d8d, 0xaa7ec6d0b230d86d,
-          0x04043df7dd8e65cc, 0x6e0888d76f35d645, 0x10092ef7a5d2173f, 0x3bba70e8725d1a1b, 0x854f5fb602a83b9e,
-          0x05519a867d1de6b1, 0x29ba32bd325d6897, 0xc3e2a03cef0a4c2a, 0x78ece0c89772be53, 0x689b73a5b9adec02,
-          0x87b96d98d3ca241b, 0xb3a4c80a7b16e6a7, 0x719d533357e019ec, 0x71e179480f705f14, 0x70df6381bd9b5a8f,
-          0x9de0a87d9180f4ad, 0x572bfb2296ba4700, 0xd0962c6a2d0574b8, 0xcf5dbd626e1ad4ed, 0x5de84046b7fc769b,
-          0x96eeb2aba3cf486c, 0xa2b7c71d855d34f6, 0xa2733e6ddf73133a, 0x190441d0ed91627f, 0x76e05e430f928873,
-          0x1baab77649fbf0b5, 0xca265d8cbae72958, 0xdbac8f822d9205a1, 0x037667cbdc2f4c1b, 0xe4fe380a8ffd7c17,
-          0xad112635bd6502f3, 0x896d1452c7ad753b, 0x753ad88b304c9755, 0x3aabf6f18f07ead0, 0x7df6bda40c139741,
-          0x013ada2b27c26c48, 0xf90272becd627e7c, 0xbd31b8952989b85b, 0x3b1a0da39738154f, 0xa5d5d69834ca7501,
-          0x890aa568aa10376e, 0x3ac924c16c337a57, 0x11a6c300c9288409, 0x9838a547145b78d6, 0x4493b37ef6990749,
-          0xaf63e910758df126, 0x68adb78f37a5f224, 0xc6fb9adbd948401d, 0xa753b2761696b0bc, 0x779dee2b58f0b970,
-          0xa627584e07211798, 0x6f39e8a235bc5471, 0x978ee2518b5a6da6, 0xad560453bd7db516, 0x9f75ef5089de8884,
-          0x2d8e136caab259c8, 0x151292f68d333703, 0x8e45909665bc9d52, 0x8d54bbb216676db8, 0x9fe56da49a6af6f7,
-          0xcc458cd5a96d59c8, 0xd717bb9b94c04ecb, 0x9fff088c283db584, 0x70ded9873eabaa00, 0xee5aadff8a923548,
-          0x36381d55aec1dd10, 0x08e2daa76811f093, 0x234d37b2a1da58e7, 0xd5dfbf9feb0ff2d8, 0xb34f7daf551f6dee,
-          0x2c2f0099f1210909, 0x4938e779697f955d, 0x39831c8633980478, 0xe23bb1cae98b2dfa, 0x678a349f304d078f,
-          0x96e1920d98c3e70a, 0xb3c79dfa9288e57c, 0x1df11b4c4fe91a91, 0x92b0e2d72540f4df, 0x8246903953ec16a6,
-          0xa28eb65965d73346, 0x7ee7aea8702891ec, 0x408a7413cf6c40d7, 0x8fbe38df9abed1a7, 0x48fcc55490fed5a0,
-          0x20ab6b4cf8ff5a00, 0x998a6a825aaf173d, 0x42dd79841f91a78b, 0xdbbe8ce82494f141, 0x37d71cb10388d3d3,
-          0x893abb97e9e8439d, 0x9a821217524e3f62, 0xd60048fe8d457333, 0x50c4c8ace2f36473, 0x311700d145887f2a,
-          0x1604a021815042ce, 0x34ad278ce4d23cda, 0x9f2951656c3f26fe, 0x988e2a0f327dae9c, 0xc35b1e7703aad4d0,
-          0x44b73e494b16616a, 0x7139f80d46d8ab17, 0x140e671b82251d79, 0xfb75736168e00243, 0x3ce819b703ab1e5b,
-          0xc29a53af26020817, 0x4499573bc9c22235, 0xae73799cc4671355, 0x404464957ab8d9db, 0x82f9a00315e2130d,
-          0x66ecdff987cdc215, 0x2f6310ebd551d068, 0xfa6607437368aa52, 0xbfe9900dc6b816c4, 0xae485e78b9516021,
-          0xdc474f6d039dd062, 0x6355766fa664466e, 0x76f616d766b2c198, 0x68421ebdccb095bb, 0x3d012a2485c4077b,
-          0x78ec393bfeac1535, 0x6b698bb9c258182e, 0x723e2e5a903677fd, 0x66cb5b1a313026d5, 0xc7a1ae2fbfb0a119,
-          0xf5b77145226ec626, 0x40566d1d56c5b955, 0xbd051454216c9a52, 0x647588e1553c9af7, 0x8f484329edb7e081,
-          0xe11ee375fdd8dd68, 0x1016f7ddacbb2fb5, 0xb149919f9819da96, 0xe15d9a029b3c61cf, 0x4a16683132c22186,
-          0x34fe331c3fe8812d, 0xd0350d2963ca2a72, 0x969d4701689da4a0, 0xdd278d1aebd64652, 0xd44db928328d096b,
-          0x3f7fb91a480bbf33, 0xbd53d85c5fa022a7, 0xf1c5a2ee6e0a2d46, 0x5b0639b3bd1cda4c, 0x486ba4f8c541e0f4,
-          0xf8bafc19d16c8018, 0xbf11e29dcf8c2838, 0xe2a5507b6affd595, 0x01bd3570dd2d762c, 0xdae6a83a6e39529f,
-          0xcd842b90b71fe60c, 0x7cb461b3b0e94d1c, 0x40eeaeb1738c3c8f, 0x1f942b61e6b2038d, 0x1cbfc5080949e251,
-          0x172261fe52f34152, 0x58a4f9390a9bf0ea, 0x8b020c130fd80792, 0xc24055059194623a, 0x7e6ef1ca4cb21593,
-          0x8d6358154810e001, 0x812563530ea50d04, 0xada84a1b4bd153c6, 0xde51fdda80f5bcbb, 0x3928a8eb6e86b854,
-          0x5a02507583dae265, 0xfba12c83331fda8b, 0xe66246b20734557a, 0xb8284ca794a5a0b3, 0x6892150b20e92195,
-          0x45d3339acdcf7535, 0x1a7a88f9fc10153f, 0xd24b88e0572b3cd2, 0x4bc374160c128fa6, 0x0766f02320f55b86,
-          0xce735922934f2eef, 0x57808984d90fd33f, 0xd8372204627da457, 0xb07e243bdb25b230, 0x817041fab91cbcb3,
-          0xdfd1c13ac30115c2, 0x048414cb7069b67a, 0xe6358125cd11b17d, 0x7756baac8dc7ae18, 0x6efcae9c24f4e783,
-          0xba24f4f1c154d3c7, 0x84117d1860318144, 0xdb19fa6311ee5fb2, 0xb2a53c5afd1a1c36, 0x05f6b074c8e0b82e,
-          0xc09a474c74f2bcde, 0x50857e8d5af68887, 0x9e7bb18ef009c3fd, 0x8995f77f9d7faf2b, 0x284d0ace41e424dd,
-          0x1c44c5a109314e10, 0x2d034b48a84b7ed8, 0xf523b4e790a30ad4, 0x610dd088b87622f4, 0xc32191cd4ad3c067,
-          0xa490ee866b067225, 0x10e7a15d95b1fc4d, 0x8501bf2fd355e3e4, 0xcdc1f58333552621, 0x7d00ee9f70333990,
-          0xbf480738ff4bf0b1, 0x4dbbe832f7cb2d19, 0x931e408e555b3f39, 0x976dd5f15526e807, 0x959fb4efb5e7696c,
-          0x9d9621e9c6e411f8, 0x15c199d959b9f25f, 0xd03d87cc586e61b2, 0x1a98260f276aa2d2, 0xaf7972ca1e212c9f,
-          0x816c672858b44d0f, 0x2219d698690e80f3, 0xdcf8c9cf71f0792e, 0xf24cf722775c0179, 0x2e2667b2d3a6cf31,
-          0xae9a70d34b0aeb40, 0x3d7e9429faf41947, 0x5015309cce78d453, 0x2be73518c03899ba, 0x89e80ed8e4e2010a,
-          0xdef139002a122e4c, 0x90a80e2a450bc0f6, 0x6de2f64c966f2e4d, 0x06cc26d31c10de01, 0xb9020bbfe5626b8d,
-          0xe32a3d404e57ef9c, 0xb972c26fcfd8c495, 0x23662bf4b01d7263, 0x862de86098cd75dc, 0x7ab983a5a7a48d61,
-          0x28a15eac9dd8965e, 0x8b743769d09f686e, 0xc3be8fc306ed5e5a, 0x17a85eb91a89076b, 0x98ee66683d9c0656,
-          0x0da6266db5c3186f, 0x3bfebce0f56a398b, 0x0a9b66a92779af97, 0xdbcb64922ad9e454, 0x71e870d584b7386e,
-          0x1e0a315c6455a044, 0x15fab23962d80513, 0x3fc60c0c4b1a792e, 0xe4371b8f31e30ba9, 0x49e8d68a13a30bb7,
-          0x336dabc7982a6a39, 0x71aa6ac113a8cf6b, 0x977442c3f9cc8115, 0x707aefcaff15f562, 0x571e4d87de78c9c0,
-          0x13aed30008b302e2, 0xe5d11b019762e19f, 0x26099be3f4d8764b, 0x561bc5b3524a87c3, 0x56080c880c563110,
-          0x05d18fb9e6929514, 0x65c22ff288ee3a34, 0x22663e41a0f0bd40, 0x6c4166557dc48666, 0x9b07d9bc98a252c1,
-          0x383fe6023ce8d22a, 0xd444e9222755b72b, 0x32396f1cdd7f2012, 0xa95ef869693bd357, 0x315e0754d59bcca2,
-          0x680fe8bc398c4103, 0xa3a44469681cf876, 0x4f653f0a4f3c9a52, 0x885c16be0c4bb8f5, 0xe6a582259608403a,
-          0x2600dc295e1a3778, 0xd5f16836ef71c6e3, 0x5a6e129393c9b79d, 0xd7853b96beb5b2cb, 0x6c36672331ee4d46,
-          0x2fbc8ef3ac8deae6, 0x75466d0571bf3a5e, 0x9dccb26aaf461e78, 0xa76b28b019a3a858, 0xfc160a044ea85278,
-          0xc9e84769ec54d0f9, 0x97458bd271644021, 0x5148ab62215f2769, 0xfea0b2a62bf2df10, 0x99fb5e1b60bb2123,
-          0xef416540d4e11c50, 0x2d5bdd2ded624aec, 0xc6c67a9e0a9d4b24, 0xc2a1f25e98f87d85, 0x01f5697b7fbf706b,
-          0xbf87201d1e091522, 0x0bdc92ad7483e220, 0xec5bfd9120578706, 0x7977320e989e6f8b, 0xcef59a678bac2afd,
-          0x90513d6f4321c85c, 0xeb85e47a9f98918a, 0x80c93813158d288e, 0x18f02324922cecd8, 0x6f44e81d37b9e017,
-          0x22e11837b4491b10, 0x22eed91c366c7653, 0x13f12ae6485e179a, 0x2614072465f4b987, 0x121e91d07f245913,
-          0xe9f368a2a348d9e4, 0x6c246c2150248493, 0xcda3cb4c2119d866, 0xd1d5f90a6364058d, 0xd4fb140b9978ea7e,
-          0x36aec2c20722f87a, 0x09d9158e000b63d7, 0xb92406cc2fae9f89, 0x134b0669a31d6e0a, 0xe7baf090aaceaf02,
-          0x3377f1e3a3a338f3, 0xe70c0c55f69bcbf6, 0xd8d48e96d524ee2f, 0xfc7fcfc36e4fa464, 0xc5ab028f747c8d58,
-          0x443b667c700cfc3d, 0x4089c260fa130440, 0x39358ad08ced843a, 0x497234119ea2b313, 0xf550157e41953fff,
-          0x975024d02e816121, 0x1a5b22d809a0518f, 0xf0649307cb43419c, 0x80fa0f997ef735b4, 0x8a492d3587c573ca,
-          0xb0d0f47a85cfbcf3, 0x308da80bef85cff7, 0x9027728be41a50b3, 0xdd7556f59881193c, 0x120dbd167d745f9f,
-          0xf92ceafc8e3f73b2, 0xe727f6aaca6828b7, 0xbcec56e2bafe726a, 0x4fdf00762c8040cd, 0xc43ad712b02f66c9,
-          0x9bfaf35a0d518c45, 0x42be71edd8abec54, 0x5a525890f6d6b5e5, 0x631d5d594d429e56, 0x2e54082b2c6dec87,
-          0x2b44244b354cba56, 0xe39a1cbfb37d691a, 0xb0eac9a60a610832, 0x99436785a81dd109, 0x16847dd7731ce280,
-          0xcefc309c188dd2ce, 0x8f170814f6879979, 0xdb0bb29c155a4a11, 0x5f8489383307d5f3, 0x525ed332ad4fef20,
-          0xd6123fa6d0d27039, 0xb1f3de757f66cab8, 0xb7680fbf47b662db, 0xf207e010aa7695f3, 0xd2bef79c13dd89ce,
-          0x7fc126e180069a30, 0xa9f8ee59147d3c6f, 0xfa5ad288491c625a, 0x9d3f1bd699cbbb87, 0xdd69ce2dcbbbb511,
-          0x962e53a11db577a6, 0x2e9ce538226de144, 0x9c2b7e739ebafb4f, 0x666c342cc453b7c1, 0x4f33f67a0f3fd9d2,
-          0xbdd5541431212bd7, 0x4485b728791a331f, 0xab2e9cbaccc4294f, 0x387f0c8249866aaf, 0x2b2bc3245d00c2a2,
-          0x47d481631757b481, 0xe8c4a6e1bba85a59, 0x1e412d8c93eabc22, 0x52fed38ba38b4571, 0x62fbf97528b4391f,
-          0x375011a51b03f2f4, 0x4b72a051d4b74f8f, 0xa1f8f91dbb01e5c4, 0x2458b519761288a7, 0xd35077c210bcbea8,
-          0x20f7ea1c0e5b94eb, 0x345560f5d2723350, 0x5a4c76037ce85813, 0x664626b2e2fc172d, 0x14d7dea84934c4d4,
-          0xeb4f8c48c1a161d5, 0x91db5f3d01af350c, 0x8335126c1c4b2c32, 0x80bdb25aae72d291, 0x01a0abb0a179e322,
-          0xc8fd8d660b3a9b5b, 0x1dca8c1d7241037c, 0x6de3e2a7af9d401f, 0x233980e7b15dc39e, 0x7d31c40750246cac,
-          0xed6a36bfa50c9669, 0xe3569d87b9f771c3, 0xaa4a510caec05362, 0x6fc974107cce64c8, 0x4b7718a13d614d12,
-          0x4a3dd0fc6bc92cdb, 0x189babd44027d835, 0x70af7b9a5bb98de9, 0x9c69f7c56e3ca981, 0x758d2d73b39baa56,
-          0xa472b0e833602270, 0xecb4428de9af31dc, 0x513a2cae357cfb9a, 0x6a1c984ce670643e, 0x52c22d21786f4f79,
-          0xf6a71c1222873d28, 0x97a2429107c90b24, 0x04d4fc3da3e1ab5f, 0x6ffe4c2dea7972b7, 0xfbc79fabb37e91dc,
-          0xedfff117ea7c7d99, 0xdc95fff84b757f78, 0x95dc54fff82bf5df, 0xfc3ab93bfce3afd5, 0x83ed9be4eef88fbf,
-          0x510fc9db7b9f64f4, 0xb647d3a3daa1c7db, 0x4938a82b97f3d0a4, 0xa71356678477d70f, 0xe78f345d079d7753,
-          0xeb9eae9f8aa143ec, 0x8e0b108f7d6c0a5f, 0x5dd151991fdd94b9, 0xd734f05ce12cd536, 0xe46cd060f5a9dea4,
-          0x3be8953d486680ee, 0x753aeddae41ccb49, 0x59254b1731a407de, 0xcc283a35fdb25a55, 0x255c4d09577085d9,
-          0x7c0ccec4ae1bafe9, 0x41e53d03765f9944, 0x0425c9e446fa1a91, 0xe037907e32b6eb6b, 0x102adf2561b52d13,
-          0xbde27bd074d5beeb, 0xcaf06d89afd67f5f, 0xe85bcd927bcf35aa, 0x5a432ea75e113eac, 0xa2085609649bb979,
-          0xba3f12b47a7085cc, 0xf261f0564c1c3b5c, 0x873182125979efb2, 0x0e6d858d35360f98, 0x555c65f138a14d7e,
-          0x1d524a77b90afd3e, 0xc0b40e1ab8ae29cd, 0xbc61fb06d9a117be, 0xd3b6b000c49edc20, 0x6b25acfbfa3503ce,
-          0xdcc6a0549a041d95, 0x8542ae2f5c0951aa, 0x9efaf5a8ee1d4f44, 0x09d3aeb93f69b683, 0x8967af92f3d3cdf7,
-          0x7131a255a17a4900, 0x1ada3ea3469568a0, 0x7b5c7c97a6eee132, 0x34c7aeebe79e2e2d, 0xef003a74de5b8864,
-          0x2353a8b5c1b1a776, 0xb1b937252d40846f, 0x69484ee23ded9d96, 0xce40a4d83008d65c, 0x2d17620bdec17793,
-          0x14ae8a6408d6f713, 0xd6543fc2f7354926, 0x94fe2f18d3d1b4ed, 0x8df3ecb640933dc8, 0x086b63be15cbad11,
-          0x779614671b06e180, 0x3c44f0ae2384c3b1, 0xcd1e5389b77fe7b5, 0x1e3bbd53e97f6fff, 0x83b74f01684d7458,
-          0x86648964da6383ac, 0x02c9d5e168d7221b, 0x0f331ef0fc7a0d20, 0x3ae7a87ee995aea7, 0x1e02da7bb39c5a4d,
-          0xcb1eaba1ec652084, 0x07079a9d1187a4b1, 0x16c1791ed0d4b34d, 0x69f883be812d21d9, 0x390d4d969bb88578,
-          0xf2d01eb881678093, 0x294ae62514feda14, 0x24df9cbc91546962, 0xd80431d405da5ec2, 0xf979a0e10d86bf74,
-          0xbf890a9294fb1c36, 0x15691a9983f488b1, 0xd707ed81d54ea9be, 0xe9d9c8b0ca3ab3aa, 0xbcc8f992c2a1c366,
-          0x0e99f51be7ebb518, 0x6e3df9d5b6618d62, 0xb5ec7794d7d8666e, 0xbc89a3f1d8f2831c, 0x4ca6a79b7f3d8096,
-          0x55428d31820c4bdd, 0xc66a1677a0fdf694, 0xe7c78b120b112343, 0x418f8d1ddb489fef, 0x4e58d9b81aacee4b,
-          0x9a2ef2b9650268bb, 0x33f625e574ef248f, 0x002021e4f22e3c37, 0x27a02f1167eeb293, 0x263e266b5fcce4a4,
-          0x82044ff6c8b85d02, 0x220e1bc50c13d6c0, 0xe21b53df220427bd, 0x40b66f3e4e1caff0, 0x8f66b92a4505e398,
-          0xf127fea70e69ca45, 0x2314dc3674c0e280, 0x748012aecdaa6dd1, 0x773936aa525b769c, 0x0ee0b259970b39fe,
-          0x052c1f8237150337, 0xd87da77a31a5e014, 0x2e99f452a30378d7, 0xe64ab900da0c61cf, 0x632f401b78337725,
-          0xb28eba1dbe046d50, 0x0255ed44c61c9b2d, 0xb0f0779d79cf7dc9, 0x08dc2bf3f6a3569d, 0xa106560659e9776f,
-          0x0005b9d0020910de, 0x52fecb336dff8ac0, 0x79b073a358dbab56, 0x94327e42572a1a68, 0x0568c16c9199b506,
-          0x816163b37f3f5e82, 0xda6a67efb41e74a8, 0xcf709dd66735c761, 0x944aaa4ae76faa3a, 0xe692fea0e4e14eb9,
-          0xc481113a3581e229, 0xa8f4e92017fe2b5a, 0xeae79d86850ae1bc, 0x40428e56116bce75, 0xe292436616a2912b,
-          0x122862cc7d6e6b88, 0x9f7a2bb71c29e360, 0x0e123a23c9265409, 0x98dc00c47276467a, 0x48a28ac3713c5b5e,
-          0x9073b3bb75738447, 0x1f78b30a30a75195, 0x209e55c41c52b978, 0xa0fa5cf3bed3162b, 0x2cd8ddf68631c988,
-          0xf94ecf4e5afd159e, 0xb6978be92498aa6e, 0x459204b248c03023, 0x16ba97f3e7544cc5, 0x00d10b1558e72719,
-          0x87616ccf83ba132e, 0xe0e22809250f7eb0, 0x40ae09b07b3d8e5e, 0x309fc93fda8b354b, 0x71b2fc57a94a3a8a,
-          0x272e3a2f6718942e, 0x01d222bcf3714ee3, 0x1bd25507b36aae9b, 0x34ae47d2d8331219, 0xbe1fd2a9ece7e908,
-          0x2324cf0c8d2fc84a, 0xea8726e3c8a025f9, 0xb6abc70c36a1cadd, 0x40b1dda8135690df, 0xb9505dd03a023167,
-          0x6718681d7f398e31, 0x4a71ba1865ddcf78, 0x4f18c0674cc73993, 0xb12f630fd441ab79, 0x90fdb4a5ec3ff1aa,
-          0xd1e9a2bc959fdf98, 0xc7015fe293a40114, 0x3c71eafe9ddf0020, 0xaa1a0f23a987c39a, 0x36782dd04221c30c,
-          0x1edf08587b2437d5, 0x50b938a9738d27b2, 0x0f75f1d189684939, 0xf0da007218022f8c, 0x9f64e8eb17700e52,
-          0x54e30716229aec47, 0x92d0576d42ed0fd3, 0x30dfb882c84ef38a, 0x8423c521782adcf0, 0x99e411348a22c143,
-          0x4731f666638f375e, 0x2b53cbab5da9adde, 0x4431ed1851725fd1, 0xe66d347b328e9560, 0x9a66e5e8e3a9e623,
-          0x4cc0a588b3037281, 0x7046f5ebbff23007, 0x26869d3746b5d4c0, 0x64f12a6008d288c8, 0x4f9835ce25159eda,
-          0x3c7a6d92c57b343c, 0x77dd9447e62fd410, 0xef15fa67124d0778, 0x3c0154188f9559d9, 0x3539c4eec42e84b5,
-          0xa3a3095283628621, 0xcd51127f5e97db6c, 0x665a37c9a7c63e1d, 0x985980eb743d954b, 0x4672481a7fe25491,
-          0x84b41389a33cf65e, 0x050e12d150783001, 0x35de434c03e987ce, 0xa7c525f42b120dd6, 0x503915c141750687,
-          0xd3a4278693112a50, 0x983225304eb182b9, 0x14c63e383695d027, 0x104871b8bc3b15cd, 0x672cd22258089c06,
-          0x85e49ae224c2534b, 0x869e3534c677a83d, 0x7f24be59788cc7db, 0xe73194f4ffb0f1f0, 0x798a567875c75b61,
-          0xe3fb9c02da094a97, 0xe3a9a61779cf3ef8, 0x32fef511d1f21da2, 0x2e1d82d395811aa2, 0x2ff540823c262799,
-          0xece64c7e8fc28f03, 0x41caedb85c43c084, 0x46ea373986c3c23b, 0x360d8cecb5c95a22, 0xa52dc399670d5240,
-          0xf4c67d76f3f00eed, 0x8d2735b971c9815a, 0xa8cd5f9169f5ea08, 0x77048bccf17ba88b, 0x095c9edc60f4b21b,
-          0x74f162ffd7f9e4f4, 0x51870adfdbef4325, 0xcd24570b2f88c331, 0xbd06c884f7f5127f, 0xf2e05ae5765f7f1f,
-          0xac46ab9cc5e7b279, 0x142f21e0cc12420e, 0x12ed3f9cfa487004, 0xc496e53c1c5379d4, 0x57696200e3461b0c,
-          0xa061abad25e2dc12, 0x04cfa6f6888f8b8f, 0x10ac08b192bf7d51, 0xbe35b3282f9183ef, 0x6499fbeab2b4e8b8,
-          0xbec4f101492f045b, 0x60af5b29f097adc0, 0x9c3c8249ed2d3498, 0xf972392ad468ec05, 0x5d174542272e15b0,
-          0xfa6633e40fd5ea0e, 0x132ecc2ca3206d05, 0x049af8e306ffdb2c, 0xc13ca9d4c4fae979, 0xa09b28607ece8c3d,
-          0x361747648a5cbc92, 0xab94597ecb52c439, 0xaf4ac2aa91c18748, 0xfde1a2b9b1af97a6, 0x8ac642c014ab6472,
-          0xa4b3db9f164dfaf3, 0xfe4c11231fc0e070, 0x74dcdac92dadb105, 0x3e6f348d7da72a72, 0x5475b0fdba9fa274,
-          0xd10b6fbae1526813, 0x1fbc6edc0de234b2, 0x50045230312bedb5, 0xf2d81e2bc762bd75, 0xcefecfe9e15f5a3b,
-          0x252829acdf1a38f1, 0xfd4b5e6d0c76e743, 0x8ff1dfb71567d8e6, 0xb2b5dddaebfd52bd, 0x4fc682996d6454b0,
-          0x3da2427c14860842, 0x1abd45ee37c1df6c, 0x23c84fa9e5b499c4, 0xdd8a0ad23753d44d, 0x2c5c8fc17aae7ef0,
-          0x31cade2aba814f40, 0x5851d32814cc1deb, 0x19db757a2561484d, 0x2be1e11006011239, 0xba1c3ba88c9b7c09,
-          0x10c1e4b77399bd41, 0xfbffc0bf0afb4753, 0x71471e0e78eabf71, 0x04297cca53ac69da, 0xcb317799e91e5342,
-          0x9a2eda9eb140c92f, 0x8d5e29e39dd6c189, 0x00b7d421933a8ae5, 0xc7898cc85d279139, 0x2befadb947c99eca,
-          0xa57decc53cd8f802, 0x7730243b3ab6ab69, 0xaa7480adb848dff0, 0x7c514cda502d8b55, 0x30ef0b195be92fd9,
-          0x97286d9fe0e7d585, 0x1534e87a5832ee04, 0x30638d118a7a8402, 0x3a384266df06f613, 0x04e9af62b7da7158,
-          0x51b05de034a09469, 0x2181081fe4ad003c, 0xd85c67b5befeaefc, 0x35bbcf20222f4e55, 0xdf868d0452113c8d,
-          0xebbddfbc6df03259, 0x809837a65e651d3c, 0x0edd70638a569cd9, 0x0831a4b32a9e79d3, 0x20565ced56396e77,
-          0xdf567b64f5a77605, 0x1f2733f34df6f191, 0x8dcbe6b57779191c, 0x2f49d84e3d62dd69, 0xf0202e573891dd88,
-          0xcc0b3542f3f95004, 0x91c0a436bab4f16d, 0x9bd96a3d52c1e1e5, 0x8cfb8be5bae36ba6, 0xbc5779dee4067444,
-          0x57d78334fbdbaf86, 0xd888757488d01300, 0xa3dc15174b7d8940, 0xe257b2689566ada4, 0x088eda145392d0ec,
-          0xf6534edb403f3455, 0xb61a6e977ea898a7, 0xe9415756831e675d, 0x5d2436bd26a1fef8, 0xe486bc51432ca8a8,
-          0xadbf81384553c79a, 0x5aa5202749f319bc, 0x16069e7f67a17cc4, 0x89c3d46fde4674aa, 0xaf161bfaea7bd604,
-          0x3a5c7247225e558d, 0x4c2ce1ae668ce62e, 0xece5522f7224de44, 0x062ece9e73393fa4, 0xabdb7913cd1738c2,
-          0x92d3be68dcb76805, 0xb92c68babc1c54bf, 0x2e8a05f6b0c109a4, 0xe0401e0e28b22f5f, 0x7c2a244ec03e9b0d,
-          0xef9e4805898802e3, 0xccd7f28c2f65861f, 0xd33153b064c0f291, 0xe89d0b9f86ce46e5, 0x3e5e3aa8d1a2ec66,
-          0x06e1080882086391, 0x6d1e9361602cf0b5, 0x8d27323f53a7dae9, 0x2fdaa51ec4fa38cc, 0xf473e2ec6ae64b3b,
-          0x9a44a5e9e6ed01a5, 0xe23b8804fdfde5bb, 0x4daffaee5225fbe9, 0x7fe25350c12bf0f3, 0xdac9755ece231e3e,
-          0x5739a9f9474e3121, 0xe7786ceed5251895, 0x783dc32e3c613f58, 0x74f7d7e6ab540579, 0xcbb5e2a1fb3f7977,
-          0xba2b9cbf49bd075f, 0x3458f1f4b47ddcdf, 0xf417bb08b9b5bfac, 0xfcd2e3c9db98e62b, 0x47ec83d41700301e,
-          0x7b6dc1e8a00fed7a, 0x25530e1f236c8dd3, 0xde03a65bf81eddde, 0xacc5f5eaf7eb40c4, 0x87678bdd5af0a3f0,
-          0xf9c8563c9ef8c2a5, 0x6ec64f7112defb7c, 0xf2ab123d37cf7be7, 0x5cade2592dd87eca, 0xda2c960c7ef9e2b7,
-          0xb320846448ea99ce, 0x44cfc82c1e35c186, 0x0c6871d1eb9f98dd, 0x1df4e42bd89bb6e9, 0xcef485eb35e9e922,
-          0x216cef846a42f389, 0xef8f56e230dcaf72, 0xe0dd7b7cdda9b218, 0xe79692029baff772, 0xc92787d1adeb37c0,
-          0x0953203d5679c4b3, 0x9ceddd5699ade209, 0x9fe2bf223e20bd96, 0x56796be61f6441f2, 0x16647cd71d098bf2,
-          0x317a9d9483fc70fa, 0x0bc98e7b4e825f45, 0x57163a0b6d74c928, 0x903adfff21c06aea, 0xe9467c8b41cade1c,
-          0xe1706f2092c26245, 0x3eeda835050781d2, 0x083fe390121e530e, 0x4fdf1a6242de13f4, 0xa728504955df4d96,
-          0xc93d2b2ab17f002d, 0x4e0a04ac2cb14bfb, 0xb4a20cb37c7af4af, 0x0defe78857aa1bed, 0x956a27b0d3f295ed,
-          0xbfad500b2a8aabfa, 0x2df75c31ed3f9e3f, 0x1053b33c3c1150a2, 0x1dc09d38eab037fc, 0x7cfb6860c9703dc3,
-          0xcae0d7199dfba938, 0x5aefecd6288ade79, 0x51895d7b1ad6a865, 0xbcd97d590995dc3f, 0x2ee0cc536bae0dfa,
-          0xdb92a632b2dbd2f5, 0x04411f90cb1b359d, 0x3da6fd08dce0b65b, 0xf7b31f4c262bd45d, 0x703db7ac20352729,
-          0x20be8a4b1e0cf3fe, 0x00240f8279cac35e, 0x067e61420649989a, 0x8e2a26b5d10e6cac, 0xe70e5163035fef56,
-          0x53219d9340e5a978, 0x2841d000e34a0b04, 0xa4fdb537d4a60e0e, 0xef1c0752404a6ef9, 0x5244ab46d749b4c3,
-          0xe3648a59a53b6a3a, 0xf6953fdabdbfb873, 0xf54468745b9c3c73, 0x852aa8ce5829e92a, 0x6996f3472704205b,
-          0x7902897c502a5921, 0x1afe3e157f08dd41, 0xc25f60a579cd2d25, 0xd507eeef6325a4f9, 0xab28c9c6bf952525,
-          0xcbbcfafb2097fcd2, 0x8e4afdcdd327e27e, 0x5fc5d6a7db7f72d7, 0xaf1631ceb7bf779e, 0x5d81e7e78adedde7,
-          0x6bdf99d8ce57b0c1, 0x0ab1852cf3758a9a, 0x875aee53f268f6b4, 0x6ce29b1985cc2c07, 0xf8565716b1d6eeff,
-          0x5fac04fd00a6bbfd, 0x804abbff809ae3fc, 0x548a94a28b72db95, 0x87024821173191e5, 0x1a73319924d0140a,
-          0xec1455ac66447702, 0x97a00b5a2cebc552, 0x0099dd800a703c16, 0xbf09809156b1f303, 0xcf245d4c1bb0bbbc,
-          0xe28fdf967356c465, 0xb96375902d56d32c, 0xad6a4aecc803fb3b, 0x7c52bbf955f3b76a, 0x5ba8b3932e99d0b2,
-          0x605655fd2e80119a, 0x0cb0adaa76c89a83, 0x61382792834e388f, 0x83c832bbbe877027, 0x0db1b39e3c0c02d3,
-          0xac521007e6bac51f, 0xe7265e887a4a4675, 0xb4643f793171437a, 0x0426807a4ea3785e, 0xd7102695878a2e2e,
-          0x7da75da80bf7a238, 0xee370bed7d44badb, 0x308ffa6a5e6b7602, 0x9dbd6e84dd16f192, 0xd2fd3fffdfa4c08f,
-          0xc187dcf87b268f20, 0xfd60337d4725d74e, 0xd4d7385300f7d8c7, 0x8ef56a1b7164bd7c, 0xd7a086bebaaf8d6e,
-          0x6fd3f38eae0198ef, 0x5180ccf4782630ad, 0x16d2cdebf703627c, 0x67acaacecf46ba5a, 0x91f91f36277e100f,
-          0xe9deab1ffabd2a6e, 0x1d32bbffc8ef9ab4, 0xfa6a36e1dd67ecdc, 0xeb1c0a8f335aae49, 0x9bfda1d51f7f5483,
-          0xabae6c90c772ddb0, 0xff4c66a6cb2d773c, 0x5e788c8ecb4bf6f3, 0x333cee384be38eb3, 0x28eefcbc888b654a,
-          0xd1912bd1a0cdd649, 0x419359deb98ba971, 0x75aae7a8bb1d95d2, 0x058a8e8df3ac869b, 0xe1a597f99985761a,
-          0x2ea11de1c359bd43, 0x42ecd87428fe7e35, 0x441a4bff038b1275, 0xd53c273f445d6ee1, 0x93050963de7906b3,
-          0xd58ada017874fd5c, 0xa0154793da5c8a0b, 0xefec43cc6fd875be, 0x9e7a41329c6d25b3, 0xafe435427d4ba3ce,
-          0xbae89303ce34157f, 0x734690533b69fd11, 0x16953dbadb1907b7, 0x579d3115fe6a90fb, 0x78d906b8c7d066e6,
-          0x035e9450a21d9929, 0xd6c9d1377dd33750, 0x4e11e940ec062cf6, 0xf3e38c0fcd6e53e7, 0xa508e092c5079b3f,
-          0x95e192e679687d8b, 0x95f30bdfc66f1a5c, 0x3ee8123de3a077da, 0xb8ac6b8c9993f795, 0x778aef95778de795,
-          0x6187da7118ddde25, 0x3b9542378264b4ab, 0x29f2b74d0db72006, 0x14137bee04872b0b, 0xea89d57afa0c5529,
-          0x5876053e997ea0d8, 0x20972e2ffff230da, 0x47f4ddb47ed37317, 0x02ea7d77a782c143, 0xd3708b7e536417c3,
-          0x819aeafed43999ac, 0xfa9b277c503d37ef, 0x53b38bfbc68d417a, 0x932c8cfbfffe95a0, 0x1fd50aab928bd733,
-          0xbcaf032667fd5a5d, 0xbad854e89a07cecc, 0xfb374ac5ff11869b, 0x7762dd3db4afa5ff, 0x725c927c986be2b9,
-          0xe4a2230b1ecc2556, 0xc4954c883bb8108f, 0xb5f0ae62b9480ced, 0x7c0c349217c6dc85, 0xa035d0c7a9433aa9,
-          0x025591e81e0cb0a7, 0xe91f2183a300f7ba, 0x0aad72eee670c626, 0x764a3662673de8dd, 0xb1bcfe01b3e8a78b,
-          0xf28bb365a9c63aeb, 0xd319f916a4436359, 0xdfc49e686a361786, 0x3f23598902042d7b, 0xf04935b60c0ca5c1,
-          0x367badb0202bdcb4, 0xff807d7bf72f62bf, 0xb8f3f785f97b59bf, 0x1c8a3685472e5aef, 0x4d7edd541383395d,
-          0x7f81fbcf12b526a7, 0x8f36061682e847ef, 0x83b71c2aca0f6e34, 0x3446bc462472b4b9, 0x89d8aa889a3f8877,
-          0x6e631c96a1df4198, 0xcdb4e3c8a0440f72, 0x564939f64a18dc42, 0xc103d57d308dbef4, 0x7280d9df79ade17a,
-          0x4f25ee71c2bd3363, 0x9ec55204df71914c, 0x218200509b3ebabf, 0x3c2b682bd31361ca, 0x11e6eee58380a239,
-          0xdcf18799ecb07713, 0xcdb8c1b2929f5cab, 0x89a57ba496caf244, 0x7394fa939d0dda47, 0x099506bf097bd5e6,
-          0x23c558c693b18c97, 0x606b27503c402029, 0xc7c56067f386c538, 0x40553a2e6a5647e4, 0xd3ea626940a6af90,
-          0xb4bae3ba4aa5eb2f, 0x7addcd6379bb09f3, 0xe10993aa3962ef71, 0x868f234daf96f760, 0x234c4b0c06a6af79,
-          0x608b6df003d87e7c, 0xb0d20f4f353ef0c2, 0x4d620b95ac7bed9b, 0xb21737deea688f84, 0xc52c0d8226374e68,
-          0xc0431f1fc0efff3e, 0x78fbffe0e876d03c, 0x8639ae8b3b0fa9c8, 0x5a728e56713ad5f7, 0xfa6b6f5735987c7f,
-          0xe1f98816e445e19d, 0xb8bc36108fcc38f7, 0xd39e63d67dfc3d07, 0xf6dca41a7d60a2ed, 0xea7825beb32fdfef,
-          0xc3c42c38beef94da, 0x54024735b149eedd, 0x7c94f34a50fd152f, 0xcfec1c3753c034c3, 0xada55fed247cb7fb,
-          0x26ba61ffc10edf1a, 0x7e3ab1b9ee231d2e, 0x7f554ec030ed14dd, 0x4618109710b1fdbc, 0xfc561264ffff540e,
-          0x880e37052ea3d59f, 0xff6988af21dc126b, 0xab113a80f534a454, 0x4f33827ebac33bef, 0xcc907f4c2a7ab305,
-          0x4827cf2019103e68, 0x49e577844bc3b635, 0x9cccc11a64344c70, 0x205ea84207ef63b6, 0x3e055365e192b104,
-          0x0d600566ec8cdd8c, 0x1b69af373a68fb6b, 0x1c646312e8c657ed, 0x33d2849a03870e9d, 0xe659e39893f29730,
-          0xff6ee10daa470f2c, 0x9bef3174d2698d4f, 0x52fe12e6efda57ac, 0xe64349ac508e34dc, 0x307e012b9ab06cde,
-          0x89cf97ade95f90ce, 0x8f3be71a9be21261, 0xb3bac509e258bc67, 0x36f58e442673af9b, 0x554da8c7f4f1d448,
-          0xfc329a82c7475413, 0xd8a956fc5be42d5a, 0x6360e2f6800902c9, 0x999ddb802a021ef3, 0xf8f303ca48f9cb54,
-          0xa86707e8a3ef5711, 0xbd6bfe09431f0055, 0xf51a24f1e582e739, 0x6dc29b3883709586, 0xfb05c90dfdb8b966,
-          0xbc63562744d0fcce, 0xe648859dcc0c91ec, 0x4c8e50a801e5f22a, 0xdf69eb9cddea60c5, 0x5bb50346bc1412f9,
-          0x6cde1444bb44a832, 0xbc8689d73c8e97a4, 0xc1379a7263c94c95, 0xa3a6074a40f6dc28, 0x19a5f783ba3f214d,
-          0x117d4678eaa10b90, 0xf9d5716e542daad6, 0x9644bc29509756a0, 0x531c8901edf60703, 0x4136a80f21165bdd,
-          0x2dffbb1c4293db7f, 0xc539a3e4fae57864, 0x86716b209b648734, 0x698470730642286a, 0x653647e0fa947db0,
-          0x1a9e81fbe7f20128, 0x7251552c89af7b19, 0x3e8a287e94371e83, 0x01258785f18917bf, 0xc5cd3677b9c32164,
-          0x3ec3628a30aa171b, 0x9cb2f2efc911d545, 0xce6737c8b3624ed7, 0xc7b73b65be872792, 0x42e70f9d86df4eac,
-          0xfa078e709842e473, 0xa873914ec7a71b5d, 0xe42a4eecf7912e1a, 0x39bbdf8c569b85f6, 0xeabadae9360ce825,
-          0x9da4f5fb5d8e2ff3, 0xc9088a26f3294441, 0xaf88be9cf4d104d5, 0x32729e916eb10421, 0xfc50e0eb22837599,
-          0x48914e0ffa50d89a, 0x1ea30ba680224296, 0x1552f12331a7811c, 0xf1473173bae69774, 0xdc714f178fa2114b,
-          0x99a17e0c209eef66, 0x8c323544ee2905f3, 0xaca133bd6d8e0267, 0xa2caf561bd8b5c86, 0x07f5103b5c48927f,
-          0x6744ffcde4930b0e, 0xabee350df4d508e5, 0x91d1bc326de9c96d, 0x803c3b7d54a546c8, 0x8c2b9d9f39ae977e,
-          0xe83aaae4178d3e55, 0x746a955357fb1eac, 0x23fdd40018620931, 0xe47ad00c7259bd3a, 0xf0f40997bc8a12fe,
-          0x9b57f46da2a9a46a, 0xacbeffc292a8e42a, 0x2e5917af57b00814, 0x97eeeaffd3c2d888, 0x792cdccffe4a3573,
-          0x251701276b6f2802, 0x6953a98033c7fa4d, 0x8e447a998a0eb00c, 0xee55445d07034b79, 0xc7f3d4b8a037b919,
-          0xa67b2f5dec3b2212, 0xd467978ead33448f, 0xce8eb6c6509e0d6c, 0xb869860632d8cca8, 0x62363947663f631d,
-          0x777e72dff1da6985, 0xd805cdcbcec76c82, 0xa62b2feee4dc2754, 0x485392a497834fd7, 0x516df21fa0606639,
-          0xb3abcccedb1e1fc5, 0x409aefc0592c57b9, 0xe4e6f6893035beca, 0x8495fb02e8a80720, 0xae9f4ec245d3f921,
-          0x4bcc26c968fb3ee4, 0x60aadcb10ccb8dbb, 0x9a8e66a421641bee, 0xdfd584947d11386e, 0xf27b540f12cf17ed,
-          0x28a87f5512825b02, 0xdfaea407ba44cad2, 0xdcc1a7ee0a79f62c, 0xc6482cc6629856fc, 0x86047953c1a997fa,
-          0x0499b1de2a01a10a, 0x48413f31d3ed4494, 0x40782e6a807cc283, 0xb9a0a2ebcf75c7d4, 0x58231e5f12d26d7c,
-          0x2278328dae82192a, 0xeb326c6e1b752881, 0x790af9b3b85d0d57, 0x04528daabf04a6fd, 0xf4a926b754a772ba,
-          0x188132829b8373d3, 0xf8587c51639077af, 0x17738087479262c9, 0xb220248b2c92a4be, 0x938c922d43346851,
-          0x669bef3fa4cc563d, 0x07649fe3bdaca37b, 0x52c7940d66305a5b, 0xb7a2ea8e4dea9fb5, 0xb904dfb23cdd7b39,
-          0x1bf201270988ebef, 0x276a722c6a8d8d82, 0xed3467717542b176, 0x46d0b9b6b1b9d52a, 0xd62b79c51ad4b486,
-          0xb659968ce81432f3, 0x6430dd5540d3d680, 0xf08ad4ebaf91c45c, 0xef3046ea0fb0f235, 0x07b904c83f9822c8,
-          0xfdaf270098bc7779, 0xd5832f4aa304ed86, 0x5b0278e97eea9d61, 0x2d86ca8f21f4a415, 0x89aa2b3f1526ef00,
-          0x4f92fd37784ea981, 0x205f0be5facbee53, 0xf0c350fd05025a23, 0xa1e8bbce2fb0cbcf, 0x1b57023efe50e27e,
-          0x1b173df74789656d, 0xb692fec599fee533, 0xe55aef71f6e361a3, 0x793c8f96b7706bd0, 0x1813fd391abfa07c,
-          0x0f22f666b9695249, 0x08477ac038e8be12, 0x28955821288cdfaa, 0xb4d86741ca40c4a2, 0x3be8b5de13da3b58,
-          0xc7feee90ebecf220, 0x153596c582ea553a, 0xb8abe2be297899d4, 0xebe09df7404a4baa, 0x1be8e077d8d637d6,
-          0x16b489f577a5395c, 0x40e5d085cb7bb0ea, 0xba05c0f64b0bd991, 0x7012893174e0d878, 0x009df69ef19a4a24,
-          0x262cba9392761b53, 0x09679dea007e7dfe, 0xe95f8f4cb1fdba9a, 0x14ce8596dd0bab0e, 0xd767866a8ab38900,
-          0xc7633675c905cb90, 0x5787ba1ce252683b, 0x1cd24e1bca7202a9, 0xaf3d5160985e2ba7, 0x164bb577d601118c,
-          0x4d97bf0c612a2dd8, 0x447857678cf0315b, 0x42fd45f1f499ad26, 0x1a4bf49fefbf7d68, 0xf35214f7e87cc172,
-          0x702cf0a797f06bb9, 0x9482463dc9ac501d, 0x3b68b4882822bec1, 0x19492025e51659b8, 0x7b1906f031e12247,
-          0x94107a5549f095c5, 0x3f5dcf88a3e73b73, 0xc138e94a7a027de7, 0x7b6f69100087df5b, 0xbba807a8a8215360,
-          0x887cb7de379455dd, 0xf5a51941be90041c, 0x538ffd0a114bb69e, 0x2ca09f9ee95f3ed3, 0x4fccf45333092f0b,
-          0x01ec7039a8435c74, 0x63201f914b1f4d49, 0x68bae148785ecf6b, 0xb6d2eb3e1092effa, 0xe5b3ec9258fa0619,
-          0x91877193aa240e90, 0x90e547a5d72eb725, 0x941136542a624f80, 0x322a230a850de979, 0x40ef423824227812,
-          0x59d5fd15f9838ddb, 0x19ffc8a2143488f1, 0x136e7e9f4cf5aac2, 0xfc9c3b644308deb3, 0x1442e3663af5ca49,
-          0x34fd1aa7639af9b1, 0xdd1f6a258f75334d, 0x6756a57fed296820, 0xff918929c62d7eaa, 0xfae3cd0c94d57092,
-          0x75904aa3891d9aaa, 0x32d7b03252e7f6b3, 0xd96431ac6721e1ae, 0x45b7468380c2c9de, 0x07619ddf073b720a,
-          0x10d28951377ec9ba, 0xfdabc48ffe1da2e0, 0x168d83e012914dbb, 0x3c24c23425ecdfad, 0x9587a9611ae59a22,
-          0xe65a149332bf267d, 0x197c3531f98b45f2, 0x5466d2a44860ba81, 0x4e636bf8d3fbdcaa, 0x573467074b47cea7,
-          0x58766bd1fc70354e, 0x9072869a08c682c7, 0x10a143c221479965, 0xccf63379fdf746c0, 0x35d4f512fe419514,
-          0x4a47d921f8d1fad4, 0x91fd50381f412b2d, 0xf8abbfecbed4d29a, 0xf01cabe74f6052a2, 0x4d8c1e73479c2933,
-          0x5c52630b354ceaa1, 0x9d55c55241d1ba75, 0x8e9c737776fdf461, 0x49fe902bbd58740e, 0x6baa804102763aaf,
-          0xeea18f16ee1b2db2, 0x0a674b0d9b09204d, 0xddb2c15f4d172616, 0xcf4efae0afa80b7f, 0xe2e9cbc804797ce3,
-          0x77ee0e87cb9dcddd, 0x87cb5e0ed8bfed0c};
+        static constexpr std::string_view etag{"\"14bb1cdfbfdfcce8\""};
+        static constexpr std::array<uint8_t, 50056> data{
+          0x55, 0xfb, 0x87, 0x64, 0x64, 0x20, 0xb7, 0x0d, 0xa0, 0x02, 0xa5, 0xfd, 0xee, 0x69, 0x8f, 0x99, 0x88, 0xc0, 0x79, 0x00, 0x24, 0xc5, 0x65, 0x77,
+          0x00, 0xbc, 0x0d, 0x37, 0xae, 0xbe, 0x0e, 0x28, 0x5a, 0x86, 0x86, 0xc6, 0x45, 0x10, 0xd6, 0xac, 0x1d, 0x0e, 0x07, 0xe7, 0x9a, 0x6c, 0x6a, 0xa3,
+          0xdf, 0x86, 0x5a, 0x30, 0x84, 0x8f, 0x45, 0x80, 0x3b, 0x3d, 0x44, 0x8a, 0xec, 0xe5, 0x0b, 0x19, 0x8c, 0xad, 0x53, 0xd2, 0x61, 0x3a, 0xe8, 0x7c,
+          0x28, 0x58, 0x28, 0xa2, 0x3a, 0xf8, 0x0f, 0xa7, 0x8a, 0xe8, 0xcb, 0xfc, 0xb2, 0x88, 0x8a, 0x33, 0x09, 0x68, 0xd8, 0x96, 0xbd, 0x93, 0xeb, 0x1c,
+          0xc7, 0xf3, 0xd8, 0xcd, 0xbf, 0xd0, 0x5b, 0x72, 0x2d, 0x69, 0xbb, 0x05, 0xc9, 0x3f, 0xd2, 0x02, 0x0a, 0x2c, 0x9f, 0xdf, 0x3b, 0xfd, 0x7f, 0x7e,
+          0xbe, 0x2e, 0x99, 0x00, 0x11, 0x26, 0x5e, 0xf3, 0xf4, 0xb4, 0xe9, 0x6a, 0xcf, 0xd2, 0x8c, 0xc7, 0x24, 0x1d, 0x13, 0xba, 0x53, 0x7f, 0x92, 0x7b,
+          0x7f, 0xa9, 0x7d, 0xfd, 0x1a, 0xf7, 0x18, 0xed, 0xea, 0xa9, 0x06, 0x3b, 0xe9, 0xb6, 0x3c, 0x8f, 0xa9, 0xd3, 0x93, 0x1e, 0x97, 0xdd, 0x93, 0x1e,
+          0x1a, 0xd9, 0x60, 0x4f, 0x12, 0x24, 0x8a, 0xc4, 0x92, 0x3e, 0x30, 0xbc, 0x5f, 0x4b, 0xe5, 0x4b, 0xd0, 0x4b, 0xdd, 0xc8, 0xd6, 0x7c, 0xf3, 0x53,
+          0xd2, 0x09, 0x75, 0xa9, 0x80, 0x64, 0x6f, 0x82, 0x72, 0x50, 0x99, 0xfa, 0xbd, 0x51, 0xca, 0x6f, 0xe5, 0x28, 0x13, 0xba, 0xc8, 0xd8, 0x48, 0x3e,
+          0xb3, 0xad, 0x43, 0x09, 0x9c, 0x33, 0x5b, 0x83, 0xe5, 0x5b, 0x1c, 0x08, 0x11, 0x4e, 0x99, 0x8f, 0x51, 0xec, 0xe7, 0xd8, 0x49, 0x0b, 0xaa, 0xc2,
+          0xa2, 0x90, 0x65, 0x25, 0x9d, 0xdf, 0x35, 0x54, 0x4c, 0x9d, 0xc9, 0x4b, 0x90, 0x35, 0x52, 0x59, 0x4a, 0x6f, 0xe7, 0x2f, 0x49, 0x17, 0x84, 0x0d,
+          0xf0, 0xfc, 0x34, 0xd5, 0xfe, 0xee, 0xcb, 0x69, 0xf6, 0x37, 0xd1, 0x80, 0xac, 0x00, 0xff, 0xa8, 0xad, 0xa9, 0xdb, 0x9d, 0x6d, 0xcd, 0x70, 0x68,
+          0x0e, 0xa5, 0x30, 0xa6, 0xc6, 0xc4, 0xcc, 0xb3, 0x25, 0x6f, 0x81, 0xaf, 0x7e, 0x69, 0x22, 0x3a, 0x54, 0x75, 0x7b, 0x0b, 0x88, 0xa1, 0x51, 0x42,
+          0x31, 0x4f, 0x8d, 0xd3, 0xd7, 0xab, 0x75, 0x77, 0x4b, 0x3a, 0xff, 0xf5, 0x6b, 0xd6, 0xff, 0xd7, 0xcf, 0xd7, 0x51, 0x18, 0xc9, 0xd7, 0x9a, 0xcb,
+          0xa5, 0x97, 0xd5, 0xf4, 0x06, 0x49, 0x50, 0xaf, 0xd0, 0x0a, 0xcc, 0xbc, 0xa5, 0xa6, 0xb4, 0x3c, 0xea, 0x06, 0xdc, 0xa9, 0xa6, 0x10, 0x36, 0x91,
+          0xfc, 0x84, 0xfd, 0x62, 0x69, 0x9f, 0x77, 0xe7, 0x94, 0x01, 0x35, 0x32, 0x32, 0x21, 0x66, 0xae, 0xa3, 0xe0, 0xab, 0xbb, 0x5f, 0x3f, 0x7f, 0x8d,
+          0x46, 0x53, 0xf5, 0x25, 0x7d, 0xd5, 0xad, 0xa4, 0x0b, 0xfb, 0x2f, 0xa4, 0xd0, 0xdd, 0x23, 0xaf, 0x67, 0x03, 0x90, 0xd6, 0x49, 0x0e, 0x31, 0xa3,
+          0x94, 0x99, 0xcb, 0x00, 0x19, 0x01, 0x33, 0xfb, 0xff, 0xef, 0xfb, 0x96, 0x55, 0x8f, 0xce, 0x16, 0x42, 0x79, 0xa3, 0x0c, 0x5b, 0x09, 0x8a, 0xac,
+          0x1c, 0x21, 0x84, 0xe3, 0x56, 0xdc, 0x7b, 0xce, 0xdd, 0x4d, 0x00, 0x1f, 0x7f, 0x55, 0x20, 0x10, 0x58, 0x93, 0x11, 0x88, 0x5c, 0x4b, 0x91, 0x25,
+          0x48, 0x56, 0x55, 0x37, 0xc9, 0x1a, 0xc5, 0x99, 0xbb, 0xcf, 0x3e, 0xf7, 0xbd, 0x2f, 0x80, 0x48, 0xa8, 0x64, 0x21, 0x22, 0x33, 0xa9, 0x4b, 0xb4,
+          0xd0, 0xda, 0x1c, 0xcf, 0x16, 0xda, 0x1d, 0xd3, 0xf9, 0x08, 0xd2, 0xc8, 0x96, 0xca, 0x9b, 0x19, 0x28, 0xb7, 0xd1, 0x07, 0xab, 0x59, 0xe6, 0x1d,
+          0xc6, 0x6a, 0x68, 0xd6, 0x68, 0x89, 0xaf, 0x3a, 0x64, 0x21, 0x61, 0xf8, 0xcb, 0xe7, 0x74, 0xb4, 0xad, 0xdb, 0x30, 0xad, 0xcb, 0x6e, 0x9a, 0x76,
+          0xf3, 0x34, 0x33, 0xad, 0x0d, 0x42, 0xf0, 0x1b, 0x1b, 0x8c, 0x41, 0xf2, 0x6d, 0xc3, 0xb4, 0xce, 0xdd, 0x34, 0xd9, 0x24, 0x4d, 0x3b, 0xd3, 0x1a,
+          0x10, 0x20, 0x9e, 0x57, 0x42, 0x76, 0xf7, 0x96, 0xa1, 0xd9, 0x7f, 0xcf, 0xd9, 0x29, 0xfb, 0xa7, 0xe5, 0x6e, 0x63, 0x83, 0x00, 0x51, 0x2d, 0x6c,
+          0x4c, 0x91, 0xb3, 0x0c, 0xd3, 0xfa, 0xdf, 0x74, 0xda, 0x74, 0x36, 0x57, 0xdf, 0xdf, 0xb1, 0x41, 0x08, 0x21, 0x0e, 0x63, 0x2e, 0x41, 0xe6, 0x1f,
+          0xa8, 0x44, 0x7e, 0x3c, 0x16, 0x4f, 0xef, 0xe1, 0x99, 0xc6, 0x4f, 0xec, 0xf9, 0x7f, 0xbc, 0xaf, 0xc3, 0x80, 0x36, 0xe3, 0x75, 0x36, 0xa1, 0x20,
+          0xf9, 0x0d, 0x47, 0x6c, 0x28, 0xbb, 0xd8, 0xa4, 0x8e, 0x99, 0x90, 0x2d, 0x0b, 0x6c, 0xff, 0x89, 0x4f, 0x0b, 0x12, 0x91, 0xf2, 0x26, 0xcc, 0xad,
+          0xfc, 0x50, 0x2f, 0xbb, 0x42, 0x57, 0x89, 0x9c, 0xdb, 0xbd, 0x61, 0xcb, 0xc4, 0x10, 0x37, 0x65, 0x4d, 0x6a, 0x6a, 0xeb, 0x59, 0x62, 0x7d, 0xe8,
+          0xcc, 0xa9, 0x53, 0xad, 0x91, 0x42, 0x52, 0xc3, 0xc4, 0x88, 0xf7, 0xd4, 0x96, 0xdb, 0x58, 0xb5, 0x45, 0x6d, 0xb9, 0x3d, 0xc2, 0xb4, 0xf8, 0x17,
+          0x8b, 0x61, 0x28, 0x08, 0x6b, 0x67, 0xc9, 0x71, 0x67, 0xad, 0xdb, 0x7c, 0xe1, 0x35, 0xad, 0xcb, 0xcf, 0x0d, 0x5a, 0x03, 0x59, 0x93, 0x9d, 0x99,
+          0x15, 0x2f, 0x23, 0xe2, 0xcd, 0x1e, 0xbb, 0x7f, 0x7c, 0x12, 0xd1, 0x4d, 0x16, 0x4a, 0x3e, 0xd3, 0xe3, 0x24, 0x0c, 0x4d, 0xdc, 0x7d, 0x08, 0xce,
+          0x2a, 0xd0, 0x6f, 0xd1, 0xdc, 0x18, 0xc9, 0x43, 0xf7, 0x86, 0xe3, 0xb3, 0x39, 0xab, 0x37, 0x6c, 0xaf, 0xac, 0xe5, 0x1f, 0x22, 0x79, 0x6b, 0x15,
+          0x4f, 0x17, 0xce, 0x23, 0x1c, 0xd7, 0xcd, 0x8d, 0x64, 0x77, 0x54, 0x21, 0xc5, 0xf8, 0xc0, 0x2a, 0x94, 0x54, 0x4b, 0x08, 0xae, 0x08, 0xb3, 0x75,
+          0xc9, 0xe3, 0xd3, 0x19, 0x66, 0xab, 0x5e, 0x86, 0xa4, 0xa5, 0xa1, 0x16, 0x02, 0x2b, 0xa7, 0x49, 0xf4, 0xd1, 0xc1, 0xc6, 0xde, 0xf4, 0xe4, 0xd8,
+          0x67, 0xa4, 0xb7, 0x4d, 0xab, 0xef, 0xb1, 0xeb, 0x8e, 0x7b, 0xd6, 0x75, 0xa4, 0xfa, 0xdd, 0xa3, 0x6a, 0x34, 0xf9, 0x89, 0x77, 0x57, 0x58, 0x2f,
+          0x7f, 0x62, 0xc0, 0x0e, 0xdb, 0x50, 0xc6, 0xc8, 0xe2, 0xdd, 0x3b, 0x66, 0x07, 0x64, 0x4b, 0xa8, 0x41, 0xc1, 0xab, 0xa1, 0xc3, 0x40, 0x45, 0x51,
+          0x80, 0xbb, 0x62, 0xb8, 0x3a, 0xce, 0x29, 0x69, 0x0d, 0x34, 0x78, 0x8e, 0x0b, 0xdd, 0xd5, 0xac, 0x2d, 0xac, 0x4e, 0x0d, 0x77, 0x06, 0x91, 0x6f,
+          0x5e, 0x19, 0x2f, 0x6a, 0x90, 0xe8, 0xa7, 0x28, 0x8c, 0x5a, 0xad, 0x8e, 0xd6, 0x41, 0xd3, 0x7c, 0x28, 0x5f, 0xe2, 0xed, 0x4f, 0xbd, 0xea, 0xa9,
+          0x4d, 0xb3, 0x56, 0xe5, 0xac, 0xb3, 0x8d, 0x05, 0x47, 0xf6, 0xb7, 0x67, 0xf3, 0xa2, 0x95, 0xd0, 0x4f, 0x1e, 0xe3, 0xe2, 0x5b, 0xd2, 0xfb, 0xb1,
+          0x39, 0xce, 0x72, 0x51, 0x8d, 0xe9, 0x40, 0x85, 0x59, 0xe7, 0x1f, 0xeb, 0x87, 0xf6, 0xf2, 0x89, 0x08, 0x05, 0x86, 0xe8, 0x80, 0x64, 0x51, 0xf3,
+          0x8a, 0xcb, 0xa8, 0x74, 0xf5, 0x76, 0x32, 0xb8, 0x1a, 0x7e, 0xc0, 0x2f, 0xd9, 0xfe, 0x34, 0x9a, 0x8c, 0xfe, 0x20, 0xfa, 0x75, 0x5a, 0xc6, 0xfd,
+          0x0f, 0x1d, 0xb6, 0xdc, 0xbc, 0x03, 0x14, 0x5a, 0xfe, 0xdc, 0x91, 0x46, 0x5c, 0xd3, 0x56, 0x46, 0x91, 0xbd, 0x2d, 0xfb, 0x3e, 0xf4, 0xe9, 0x21,
+          0x50, 0x39, 0x5f, 0xb3, 0xef, 0x0b, 0xa3, 0xf6, 0x18, 0xd9, 0xc0, 0xbf, 0x92, 0xd7, 0x21, 0x72, 0x0a, 0xa5, 0x7b, 0x2f, 0x71, 0x4c, 0x60, 0x34,
+          0x5e, 0xe4, 0x3a, 0x4a, 0x98, 0xf6, 0x5f, 0x52, 0xb2, 0x2e, 0x36, 0x9c, 0x4d, 0x79, 0xbc, 0x8d, 0x06, 0xfe, 0x5c, 0x6c, 0xa3, 0xc5, 0x36, 0x8a,
+          0x03, 0xf8, 0x1a, 0xfb, 0xed, 0x45, 0xb9, 0xa5, 0x7d, 0xd3, 0xf5, 0x8f, 0x5f, 0xc0, 0x41, 0xdf, 0x49, 0xa7, 0xc3, 0xf2, 0xd8, 0xff, 0xd5, 0x32,
+          0x10, 0x18, 0xc0, 0xa5, 0xc1, 0x07, 0xef, 0x27, 0xc0, 0xf4, 0x7d, 0x03, 0xc8, 0x57, 0xad, 0x6d, 0xf3, 0x25, 0x51, 0x14, 0xdd, 0xd3, 0x8a, 0xbb,
+          0x39, 0x8d, 0xf6, 0x86, 0x53, 0xcf, 0x60, 0x2a, 0x34, 0x8e, 0xad, 0x7c, 0xae, 0x1b, 0x5c, 0x31, 0xa0, 0x11, 0x66, 0x99, 0x66, 0xa9, 0xdf, 0xff,
+          0xee, 0x83, 0x2f, 0x16, 0x40, 0x33, 0xcd, 0x54, 0x07, 0xab, 0x64, 0xfd, 0xda, 0x17, 0x43, 0xa6, 0x55, 0x5f, 0x85, 0xbf, 0xaf, 0x13, 0x3a, 0x55,
+          0xf4, 0x65, 0x60, 0xc4, 0x06, 0x6f, 0x56, 0x2c, 0x7c, 0xa0, 0x5e, 0xad, 0x7e, 0xba, 0xef, 0xc6, 0x68, 0xc6, 0x83, 0x23, 0x3c, 0x4a, 0xbd, 0x73,
+          0xe2, 0xd6, 0xc6, 0x75, 0xca, 0xf5, 0xf3, 0xfb, 0xe0, 0x8d, 0x59, 0xd5, 0x0d, 0x6d, 0x87, 0x0f, 0x00, 0xdb, 0xde, 0xa3, 0xd9, 0xd8, 0x19, 0xa2,
+          0x05, 0x68, 0x92, 0x6b, 0x97, 0x76, 0x77, 0x1d, 0xb1, 0xa6, 0xce, 0x15, 0x28, 0xee, 0x0b, 0x48, 0x04, 0xd2, 0x67, 0x76, 0x55, 0x4f, 0x5a, 0x15,
+          0xe2, 0x24, 0x94, 0x1d, 0xaa, 0xaf, 0xdd, 0xb1, 0xc1, 0xe5, 0x6b, 0xe7, 0xe8, 0x7e, 0xd7, 0x27, 0xe7, 0xe0, 0xe4, 0x0a, 0x7f, 0x89, 0x2f, 0x26,
+          0xab, 0x9f, 0x47, 0xbe, 0xe7, 0xca, 0x4d, 0x7c, 0x06, 0x9a, 0xd1, 0x7d, 0xa3, 0x11, 0x34, 0x59, 0xd5, 0x2a, 0xdd, 0x6c, 0xef, 0x80, 0x36, 0x2b,
+          0xdd, 0x75, 0x3a, 0xef, 0xe1, 0x8f, 0x73, 0xa7, 0xbd, 0x52, 0x8d, 0xc6, 0x0e, 0xab, 0x92, 0xf4, 0x2a, 0xa6, 0xec, 0x62, 0x8b, 0xdb, 0x38, 0x41,
+          0x77, 0xc3, 0x7e, 0xd6, 0x5c, 0x26, 0x1d, 0xd7, 0xf3, 0x46, 0xda, 0xdd, 0x49, 0x89, 0xbf, 0x5e, 0xef, 0x1b, 0x1e, 0x46, 0x21, 0xba, 0x37, 0xec,
+          0xe7, 0xcf, 0x47, 0x73, 0x30, 0x5b, 0xf9, 0x97, 0x5a, 0xdf, 0xda, 0xf0, 0x60, 0x62, 0x19, 0x54, 0x02, 0xb7, 0x5c, 0x7e, 0x1c, 0xf4, 0xda, 0xce,
+          0xde, 0xd3, 0xce, 0x10, 0xb6, 0xcd, 0x92, 0x6e, 0xb3, 0xbd, 0xc9, 0xe5, 0x39, 0x7d, 0x66, 0x1b, 0x80, 0xfd, 0xda, 0xcb, 0x49, 0x43, 0x8b, 0xc1,
+          0x38, 0x54, 0x02, 0x03, 0xb7, 0x9b, 0xf2, 0xa8, 0xb3, 0xec, 0x62, 0x2d, 0xd5, 0x2f, 0x05, 0x57, 0x8c, 0x14, 0xa8, 0x04, 0x2f, 0x4c, 0xec, 0x36,
+          0x66, 0x8e, 0xeb, 0xd1, 0xfd, 0x4a, 0x47, 0x04, 0xe0, 0xf1, 0x51, 0x43, 0x7d, 0xc6, 0x78, 0x3c, 0xd6, 0x71, 0x35, 0x02, 0xa2, 0x75, 0x6d, 0xa4,
+          0x17, 0x7b, 0x1d, 0xfb, 0x33, 0xf6, 0xa5, 0x2c, 0x61, 0x23, 0xb5, 0xa2, 0xdb, 0x6b, 0x30, 0x36, 0x94, 0x64, 0x3a, 0xa1, 0x8b, 0x01, 0x7d, 0xb2,
+          0x7b, 0xce, 0x0e, 0x5f, 0x87, 0x0e, 0x70, 0xc3, 0x8a, 0x6c, 0xac, 0x54, 0x90, 0x3f, 0xeb, 0xcd, 0x54, 0xc4, 0x44, 0xc5, 0xd0, 0x19, 0x15, 0x1a,
+          0xd8, 0x78, 0xad, 0x8a, 0xf3, 0xfb, 0xbb, 0xd7, 0x40, 0xb8, 0x3d, 0x0e, 0xeb, 0x74, 0xff, 0xaf, 0xa2, 0x1a, 0xfe, 0x4a, 0xf5, 0xac, 0xc6, 0x36,
+          0x59, 0xad, 0xbe, 0x1b, 0xd3, 0xec, 0x0c, 0xc6, 0xea, 0x6c, 0xb8, 0x92, 0x28, 0xe8, 0x0b, 0x2b, 0xeb, 0x47, 0x21, 0x1e, 0xa8, 0x74, 0x1e, 0x6d,
+          0xa0, 0x96, 0x20, 0x68, 0x5d, 0x41, 0x2a, 0xbf, 0x3e, 0xc5, 0x76, 0x28, 0x8a, 0x8f, 0x9b, 0x8c, 0xf1, 0x28, 0xbf, 0xf1, 0x67, 0x25, 0x64, 0xf9,
+          0xca, 0x77, 0x4b, 0x0e, 0x21, 0x47, 0x4a, 0x6c, 0xa4, 0x52, 0x62, 0x14, 0xb2, 0x14, 0x63, 0x83, 0x4a, 0xc6, 0x22, 0x65, 0x36, 0x5a, 0x94, 0x2a,
+          0x29, 0x85, 0xb5, 0x54, 0x1f, 0x9d, 0xae, 0x3e, 0x37, 0x15, 0x80, 0xf2, 0x9a, 0x4b, 0x59, 0x6c, 0x40, 0xeb, 0x0f, 0x9d, 0x15, 0xad, 0xc9, 0x7e,
+          0x74, 0x0d, 0xa1, 0x45, 0xfd, 0xab, 0x1d, 0x9a, 0xd5, 0x9d, 0xb7, 0xc4, 0xa2, 0xbe, 0x1f, 0xff, 0x87, 0x45, 0x33, 0x02, 0x1b, 0xaa, 0xb3, 0xe7,
+          0x97, 0xa3, 0xe5, 0xa7, 0x30, 0xfe, 0x4b, 0x86, 0xa3, 0x37, 0xde, 0x44, 0xb0, 0xa8, 0x10, 0xf1, 0x43, 0xe2, 0x20, 0x6d, 0x65, 0x5f, 0xf4, 0xb1,
+          0x21, 0x5d, 0x36, 0xa6, 0x8b, 0x13, 0x71, 0x90, 0x4e, 0xa8, 0x84, 0x06, 0x9c, 0x77, 0x33, 0xbf, 0x43, 0x49, 0x3c, 0xdb, 0xf8, 0xfe, 0x3f, 0x81,
+          0x36, 0xde, 0xac, 0x02, 0x54, 0x53, 0x71, 0x18, 0x7f, 0x59, 0x55, 0x19, 0xd4, 0xd1, 0x1e, 0xea, 0xfa, 0xab, 0x10, 0xf5, 0xf8, 0xb4, 0xfe, 0x7f,
+          0x02, 0x29, 0xf1, 0x56, 0x69, 0xcc, 0x48, 0x73, 0xdd, 0x29, 0xb4, 0x55, 0x4a, 0x23, 0x0e, 0x39, 0x56, 0x63, 0x43, 0xa5, 0x93, 0x82, 0x74, 0xdb,
+          0xce, 0x55, 0xd2, 0xf4, 0xda, 0xd4, 0x48, 0xf6, 0x46, 0x9a, 0x49, 0x91, 0x0c, 0x79, 0x6f, 0x04, 0x69, 0xf7, 0xdd, 0xbd, 0xc6, 0x2b, 0x06, 0xea,
+          0x48, 0xdb, 0x49, 0x45, 0xfc, 0xbb, 0x54, 0x77, 0xef, 0x17, 0x52, 0xe2, 0x47, 0xa1, 0x62, 0x4b, 0x18, 0x0b, 0x95, 0x55, 0xae, 0x5c, 0x66, 0x5a,
+          0x90, 0x7b, 0xa0, 0x12, 0xe4, 0x86, 0x47, 0x65, 0x3d, 0x3c, 0xc5, 0xf3, 0xf4, 0x20, 0x35, 0x7e, 0x58, 0xf5, 0x70, 0xe3, 0x6d, 0x9d, 0x8f, 0xff,
+          0xd8, 0x5b, 0x7b, 0xaf, 0x34, 0x73, 0x14, 0x59, 0x7d, 0x2f, 0x83, 0xfe, 0x8a, 0x56, 0x72, 0xd0, 0x67, 0x3b, 0xf9, 0x51, 0xe7, 0xb2, 0xfc, 0x13,
+          0x6c, 0x0b, 0xb0, 0x76, 0xa5, 0xd0, 0x89, 0xfd, 0xfc, 0xb5, 0x1e, 0xba, 0x7f, 0xd3, 0x73, 0x57, 0x2f, 0x3e, 0x0b, 0x3c, 0x7a, 0x79, 0x27, 0x59,
+          0x2b, 0x0b, 0x51, 0xc7, 0xbe, 0x54, 0x83, 0x5d, 0x7b, 0xe8, 0x5c, 0x9f, 0x04, 0xb1, 0x3c, 0xd5, 0xa3, 0xe0, 0x70, 0xed, 0x7f, 0xff, 0x75, 0x8d,
+          0xbf, 0x2a, 0xf8, 0x35, 0xae, 0xf9, 0xfb, 0x31, 0xe5, 0xf8, 0x31, 0x69, 0x6c, 0x4d, 0x23, 0xf5, 0x4a, 0xc2, 0xe9, 0xd4, 0x4a, 0x20, 0x17, 0x58,
+          0x4b, 0xc1, 0xae, 0xe8, 0x55, 0xeb, 0x0d, 0x2e, 0x8a, 0x1c, 0x7c, 0xa1, 0x73, 0x83, 0x76, 0xe8, 0x9d, 0x5f, 0x65, 0xed, 0x19, 0x7f, 0x2b, 0x59,
+          0xde, 0x15, 0x1f, 0x54, 0x70, 0xae, 0xe4, 0x81, 0x42, 0xa3, 0x82, 0xbc, 0xe2, 0x7a, 0xee, 0x95, 0x0a, 0x51, 0x7c, 0x7c, 0x98, 0xe4, 0x3c, 0xdb,
+          0x0b, 0xd1, 0x61, 0xee, 0x79, 0xb4, 0x12, 0x05, 0x65, 0xa0, 0xa7, 0xd0, 0x2e, 0xb2, 0x49, 0x56, 0xd1, 0x9f, 0xcf, 0x59, 0x66, 0xb9, 0xb3, 0x11,
+          0x33, 0xfe, 0xba, 0x3d, 0xe7, 0xde, 0x8b, 0x87, 0xf3, 0x4a, 0x12, 0x0d, 0xf6, 0x36, 0x82, 0xca, 0x84, 0x99, 0x42, 0xee, 0x18, 0x6f, 0x57, 0x61,
+          0xaf, 0x13, 0x44, 0x9d, 0xa4, 0xe4, 0x39, 0x31, 0xed, 0x8e, 0xfd, 0x50, 0x28, 0x2e, 0x0b, 0x99, 0x65, 0xf8, 0x2c, 0xc4, 0xb2, 0xc6, 0x0d, 0x3e,
+          0xa9, 0x6a, 0x15, 0x86, 0xa4, 0x9e, 0x42, 0xfd, 0x59, 0x2a, 0x5c, 0xc9, 0x57, 0xa5, 0xe4, 0x4c, 0xfe, 0x95, 0x00, 0xea, 0x70, 0x41, 0xec, 0x8b,
+          0x4b, 0x9d, 0x28, 0x76, 0xe9, 0xad, 0xc6, 0x56, 0xda, 0xe9, 0x47, 0x02, 0xf5, 0xe1, 0xc7, 0x9a, 0x43, 0xc5, 0x2a, 0x01, 0xbd, 0x08, 0x6c, 0xcc,
+          0x6b, 0x72, 0xd4, 0xc2, 0x6c, 0xc0, 0x9b, 0xcc, 0x7a, 0x34, 0xf3, 0x96, 0x4a, 0x84, 0x5e, 0xad, 0x4e, 0x2d, 0x96, 0x94, 0x02, 0x84, 0x71, 0xa9,
+          0x7b, 0xb8, 0xca, 0x0b, 0x6c, 0xa7, 0x67, 0x47, 0x03, 0x4f, 0xe1, 0x34, 0xf6, 0xd9, 0x4d, 0xf3, 0xa7, 0x68, 0x6d, 0xab, 0xa7, 0x64, 0x5c, 0x37,
+          0xdb, 0xcd, 0x11, 0xaf, 0x48, 0x25, 0x97, 0x80, 0x28, 0x4c, 0x10, 0xfa, 0x3c, 0x74, 0xda, 0x73, 0xd3, 0x34, 0x01, 0x30, 0x31, 0x5a, 0xba, 0xeb,
+          0x6d, 0xc7, 0xdd, 0x08, 0x36, 0xe6, 0x8f, 0x37, 0x00, 0x5c, 0xbb, 0x1b, 0x1a, 0xef, 0x57, 0xde, 0xdb, 0x3a, 0x90, 0xb7, 0xdf, 0x1d, 0xc0, 0xa4,
+          0xa6, 0xf0, 0x24, 0x1e, 0xfc, 0x75, 0x3f, 0xc4, 0xaf, 0x63, 0x78, 0xe8, 0xb3, 0x07, 0xe4, 0xe6, 0x11, 0xfe, 0xe0, 0xee, 0xdf, 0xdb, 0xbc, 0xfe,
+          0xf2, 0x87, 0xba, 0xff, 0xb5, 0x39, 0x99, 0xfc, 0x54, 0x87, 0x05, 0xd2, 0xa8, 0x03, 0x33, 0x81, 0x6e, 0x0c, 0xed, 0xb7, 0x0f, 0xf6, 0xe9, 0x30,
+          0xe6, 0x43, 0x09, 0x02, 0xbc, 0xcd, 0x45, 0x4a, 0xb1, 0x7e, 0x38, 0xdf, 0x11, 0xe8, 0xc1, 0x41, 0x47, 0x18, 0x1e, 0xd1, 0x31, 0x52, 0x67, 0x35,
+          0x8e, 0xb9, 0x06, 0x32, 0xdc, 0x51, 0xfb, 0x2e, 0xfb, 0x45, 0xa9, 0x38, 0x14, 0x75, 0x32, 0xc2, 0xa9, 0xd3, 0xaa, 0x83, 0x1d, 0xc2, 0x2f, 0xc2,
+          0xe6, 0x3d, 0x70, 0x9d, 0x77, 0x8e, 0x98, 0x01, 0xa8, 0x4f, 0x79, 0xdc, 0x34, 0x31, 0xe4, 0x03, 0x9c, 0x0f, 0x6c, 0x31, 0xfe, 0xae, 0x50, 0xae,
+          0xde, 0x17, 0x6f, 0xca, 0xe8, 0xac, 0x87, 0x80, 0x72, 0xa0, 0x4e, 0xa3, 0x7c, 0x84, 0xd5, 0xcb, 0xe7, 0x7c, 0xff, 0x77, 0x9c, 0x63, 0x69, 0x78,
+          0x15, 0xbb, 0xef, 0xe4, 0x9c, 0xef, 0x18, 0xa2, 0x99, 0xf4, 0x13, 0xb4, 0xdd, 0x3b, 0x82, 0x8b, 0x5f, 0x56, 0xfd, 0x87, 0xea, 0x68, 0x8c, 0x84,
+          0x2b, 0x13, 0xbe, 0x7f, 0xb4, 0x2f, 0x20, 0xdd, 0x07, 0x9a, 0x66, 0x04, 0xf8, 0x94, 0xe9, 0x7f, 0x42, 0x1a, 0x85, 0x50, 0x6d, 0x98, 0x4a, 0x84,
+          0x94, 0x6c, 0x1e, 0x90, 0xf5, 0xfa, 0x67, 0x04, 0x29, 0xcf, 0x1f, 0xde, 0x9f, 0x06, 0x19, 0xf6, 0x06, 0xdf, 0x1a, 0x18, 0xa6, 0x89, 0xdb, 0x32,
+          0x73, 0xa2, 0x8f, 0x61, 0x82, 0x8f, 0x07, 0x7f, 0x1b, 0xa7, 0x9b, 0xc8, 0x98, 0x58, 0x73, 0x3a, 0x16, 0xa3, 0x31, 0xcd, 0xa2, 0x99, 0x99, 0x6b,
+          0xb3, 0x1d, 0x2a, 0x22, 0x34, 0x8e, 0x16, 0x5e, 0x86, 0xcd, 0xf5, 0x68, 0xa0, 0x38, 0xfb, 0xc3, 0xd9, 0xf5, 0x5f, 0x1b, 0x2a, 0xb3, 0x00, 0xd6,
+          0x9c, 0xec, 0x40, 0xec, 0x84, 0x3b, 0x85, 0x40, 0x7f, 0x91, 0xfd, 0x65, 0x0e, 0x2e, 0x1e, 0x53, 0xd3, 0xd6, 0x1c, 0x8d, 0xa5, 0x13, 0x14, 0x9a,
+          0x10, 0x55, 0xf1, 0x8d, 0xae, 0xe8, 0x81, 0x29, 0x45, 0x7b, 0xd6, 0x19, 0x48, 0x71, 0x62, 0x02, 0x51, 0x6d, 0x20, 0x13, 0xbe, 0xd3, 0x9c, 0xa2,
+          0xc8, 0x37, 0x2c, 0x0e, 0xd2, 0x62, 0xde, 0xd2, 0x1f, 0x98, 0x5b, 0xae, 0xdc, 0x31, 0x73, 0xc5, 0x23, 0x03, 0xa8, 0x13, 0xa0, 0x75, 0x3c, 0x7a,
+          0xbc, 0x43, 0x94, 0x72, 0xae, 0x95, 0x3c, 0x6d, 0x53, 0xe7, 0x38, 0x27, 0x7b, 0xe8, 0x33, 0xc7, 0x1e, 0x2a, 0x9e, 0x95, 0x58, 0x08, 0xcd, 0x06,
+          0xb3, 0xd2, 0xb0, 0x1b, 0x24, 0x37, 0xf3, 0xa0, 0x25, 0x65, 0xa4, 0x0e, 0x75, 0xb5, 0xf3, 0x09, 0xfb, 0x88, 0x3f, 0x06, 0x90, 0x63, 0xab, 0x72,
+          0x8c, 0x45, 0x97, 0x05, 0x23, 0xc9, 0x71, 0x80, 0xd3, 0x01, 0x14, 0x68, 0xb4, 0x52, 0x8a, 0x2e, 0xf1, 0xc4, 0x6e, 0xf5, 0xeb, 0xb9, 0xfe, 0xb4,
+          0x83, 0x13, 0xa9, 0xdf, 0xaa, 0x5f, 0xd0, 0xc1, 0x54, 0x1d, 0xd5, 0x4e, 0x9d, 0x7d, 0xf0, 0xab, 0x37, 0x4f, 0xfe, 0xaa, 0x0c, 0x00, 0x9a, 0x66,
+          0x1e, 0x96, 0x82, 0x4c, 0x14, 0x7c, 0xab, 0xd2, 0x38, 0xe3, 0x07, 0x2d, 0xd1, 0x2e, 0x04, 0x10, 0x16, 0xcc, 0xe5, 0xeb, 0xa7, 0xe9, 0x00, 0xef,
+          0xa8, 0x5d, 0x54, 0x9e, 0xb7, 0x82, 0x81, 0xfe, 0x7b, 0x2b, 0xe1, 0x4f, 0xbf, 0xc1, 0x59, 0x4d, 0x8c, 0x83, 0xfc, 0x0e, 0x8f, 0xdd, 0xde, 0x2e,
+          0x4c, 0x1f, 0x62, 0x13, 0x75, 0x7f, 0x4e, 0x35, 0xc0, 0x5d, 0xcb, 0x1a, 0x06, 0x17, 0x06, 0x27, 0x0e, 0x33, 0x0c, 0x2e, 0x34, 0xde, 0x16, 0x40,
+          0x07, 0x33, 0x87, 0x20, 0x2a, 0x2f, 0xf3, 0x9a, 0xcb, 0x7f, 0x34, 0x1a, 0x52, 0x06, 0x85, 0xf5, 0x95, 0x38, 0xe9, 0x4e, 0x8e, 0xf6, 0x1a, 0xd1,
+          0x2b, 0x9e, 0x82, 0x3d, 0x35, 0xd6, 0x17, 0x3d, 0xc4, 0x35, 0x23, 0x6d, 0x4f, 0xc8, 0xe3, 0x8f, 0x3b, 0x10, 0xbb, 0xf0, 0x71, 0x75, 0xb0, 0x0d,
+          0x73, 0xb6, 0x0a, 0x48, 0xc9, 0x43, 0x18, 0xe0, 0x2f, 0x46, 0x29, 0x9a, 0x52, 0xdf, 0x55, 0x61, 0x32, 0x87, 0x8b, 0x41, 0xf4, 0x5d, 0xa6, 0x9d,
+          0xd7, 0x46, 0x23, 0x10, 0x3d, 0xd8, 0x84, 0x06, 0xbc, 0x5f, 0x4f, 0x72, 0xbe, 0xf1, 0x3c, 0x7c, 0x32, 0x06, 0x09, 0x60, 0x66, 0x19, 0x0e, 0x44,
+          0xf6, 0xf0, 0x10, 0xcc, 0x63, 0x7b, 0xfb, 0xcd, 0xae, 0x2d, 0xdc, 0x8a, 0x43, 0x80, 0x51, 0x73, 0xff, 0xcc, 0xb8, 0x63, 0xf1, 0x54, 0xfd, 0xd2,
+          0x7c, 0xab, 0x08, 0x13, 0x68, 0x5f, 0x7d, 0xe5, 0x60, 0x64, 0x6d, 0x4c, 0x63, 0x05, 0xcf, 0x52, 0xc0, 0x87, 0xf5, 0xe4, 0xf0, 0xd8, 0x74, 0x14,
+          0x23, 0x97, 0xc9, 0xad, 0x00, 0x37, 0x34, 0xbb, 0x9b, 0xb3, 0xc6, 0x46, 0x10, 0x65, 0xd6, 0x8b, 0xec, 0xa5, 0x4b, 0xcc, 0x32, 0x3e, 0x15, 0x66,
+          0xe9, 0x20, 0xeb, 0xcf, 0x71, 0xf3, 0x13, 0xf9, 0xce, 0xcc, 0xa4, 0x9e, 0x36, 0xab, 0x64, 0x22, 0x88, 0xf6, 0x96, 0xda, 0xda, 0x38, 0xc7, 0x44,
+          0xaf, 0x66, 0x2a, 0xf5, 0xaa, 0x6d, 0xf0, 0x89, 0x41, 0xc3, 0x68, 0x1a, 0xbe, 0x2f, 0x6c, 0xf6, 0x05, 0x1e, 0xd4, 0x0e, 0x18, 0x1f, 0xb2, 0xa7,
+          0x4c, 0xc8, 0x39, 0x37, 0xc7, 0x47, 0x44, 0xa1, 0x1e, 0x3f, 0xbf, 0x0e, 0x8f, 0x83, 0xc7, 0xf3, 0xf3, 0xe8, 0xf9, 0xee, 0x8c, 0xd6, 0xfb, 0xaf,
+          0xed, 0xd5, 0xe5, 0xaf, 0x74, 0x28, 0xf1, 0xe9, 0xf5, 0x15, 0xf6, 0xe6, 0xb7, 0xf3, 0xbd, 0xb9, 0x5c, 0x37, 0x4d, 0xb6, 0xea, 0x17, 0x9e, 0xf9,
+          0x0d, 0xcf, 0xa1, 0xc7, 0xc7, 0xeb, 0x1f, 0xed, 0x80, 0xfb, 0x81, 0x14, 0xb5, 0x36, 0x0b, 0x9a, 0x3a, 0xf8, 0x5e, 0xd8, 0xc0, 0xab, 0x40, 0xf2,
+          0x7c, 0xb1, 0x84, 0xea, 0xe1, 0x3a, 0x10, 0x79, 0x84, 0xfa, 0xe3, 0x00, 0x09, 0x94, 0x5f, 0x27, 0x92, 0x40, 0xd2, 0x2d, 0xac, 0x4d, 0x5a, 0x1d,
+          0x17, 0x30, 0xc2, 0xbe, 0x4e, 0xf7, 0x06, 0xf4, 0x26, 0x5e, 0xf0, 0xc0, 0x40, 0xbd, 0x34, 0xca, 0xf4, 0x47, 0xbb, 0x0e, 0x96, 0x00, 0x00, 0x11,
+          0x7a, 0xe3, 0x02, 0xb5, 0x36, 0x3e, 0x5f, 0x21, 0x1d, 0x35, 0x36, 0x2c, 0x5a, 0xfd, 0x64, 0x67, 0xad, 0xb1, 0xe4, 0x4e, 0xac, 0xcd, 0x27, 0x70,
+          0xf1, 0x4d, 0x24, 0xd9, 0xcf, 0xfb, 0xfd, 0x5b, 0x71, 0xf2, 0xe1, 0x76, 0x46, 0x59, 0x61, 0x81, 0x15, 0x65, 0x32, 0xcf, 0x9b, 0x7f, 0xfc, 0xba,
+          0xde, 0x43, 0xaf, 0x45, 0x96, 0x31, 0x14, 0xd5, 0x13, 0xf1, 0x80, 0x6b, 0xd3, 0x7d, 0x61, 0x19, 0xf3, 0x92, 0xfd, 0x08, 0x9d, 0xa1, 0x94, 0xe6,
+          0xb5, 0x19, 0x4c, 0x5e, 0xc3, 0x7c, 0x83, 0x7a, 0xba, 0xcc, 0x74, 0x4a, 0x7e, 0xf5, 0xc6, 0x81, 0x3a, 0x31, 0xe1, 0x91, 0x47, 0x49, 0xd0, 0xf1,
+          0x09, 0x36, 0xe8, 0xee, 0x92, 0xfa, 0x60, 0x0a, 0xe5, 0xbb, 0x0c, 0x1a, 0x82, 0x20, 0x9a, 0x8a, 0x50, 0x81, 0x45, 0x33, 0x2a, 0xfc, 0xef, 0xfe,
+          0x16, 0x55, 0x08, 0x71, 0x69, 0xda, 0x75, 0xff, 0xa8, 0x05, 0x95, 0x32, 0xae, 0xd6, 0x4d, 0xca, 0x28, 0x9a, 0x2c, 0x2c, 0xed, 0xac, 0x41, 0xa6,
+          0x34, 0x16, 0xa1, 0x4c, 0x0b, 0x72, 0xcd, 0x84, 0xd5, 0x8e, 0xf3, 0x9b, 0x25, 0x01, 0x8e, 0x27, 0x8e, 0xa9, 0xe6, 0x79, 0x06, 0xfd, 0xbc, 0x15,
+          0x31, 0xc2, 0x9f, 0xff, 0x23, 0x05, 0xd9, 0x32, 0xb3, 0x94, 0x1e, 0x65, 0x17, 0xe5, 0x66, 0xa6, 0x54, 0x57, 0xf4, 0x41, 0x53, 0x5d, 0xcc, 0x18,
+          0x2d, 0x63, 0x8b, 0x89, 0x12, 0xf8, 0xaf, 0x70, 0xe0, 0xc0, 0x7f, 0xe7, 0xf7, 0xa0, 0x70, 0xa2, 0xbb, 0xfb, 0x18, 0x74, 0xc7, 0x68, 0x87, 0xd6,
+          0x09, 0xc4, 0x77, 0xda, 0x91, 0xef, 0xfe, 0xf1, 0x5d, 0xcf, 0x81, 0xbf, 0x31, 0xbf, 0x44, 0xb5, 0xdd, 0xf4, 0x59, 0x49, 0xdd, 0x5f, 0x72, 0xc9,
+          0x83, 0x28, 0xd7, 0x3e, 0xf8, 0xfe, 0xcf, 0x6e, 0xf4, 0x41, 0x4a, 0xdd, 0x60, 0x63, 0x95, 0x8b, 0x3c, 0x0a, 0xda, 0xc9, 0xce, 0x77, 0xdb, 0xfb,
+          0xcd, 0x35, 0x1a, 0x07, 0xce, 0x44, 0x2d, 0xef, 0xd2, 0x6f, 0x8b, 0x92, 0x78, 0xf1, 0xff, 0xa0, 0x85, 0x0e, 0x33, 0x61, 0x53, 0xa1, 0x0a, 0x1e,
+          0xb7, 0x2d, 0xaa, 0x61, 0x16, 0xdd, 0x45, 0x30, 0xda, 0xc0, 0x0b, 0xf7, 0xd3, 0x91, 0xfd, 0x3c, 0x73, 0xa5, 0x6e, 0xe5, 0x07, 0x2a, 0x64, 0xcb,
+          0xbe, 0x22, 0xbe, 0x6c, 0xfc, 0x05, 0x55, 0x2e, 0x2f, 0xab, 0x1f, 0x9d, 0xf2, 0xff, 0x00, 0x8d, 0x99, 0xfe, 0x6e, 0xa6, 0x9a, 0xcf, 0xb9, 0xa7,
+          0x13, 0x6a, 0x73, 0xf8, 0xbe, 0xed, 0xf7, 0x8e, 0xdf, 0xc1, 0x7f, 0xec, 0x3e, 0x10, 0xd7, 0x6b, 0x33, 0x3e, 0xab, 0xae, 0xe4, 0xcd, 0x2f, 0x66,
+          0xd5, 0x89, 0xb6, 0xad, 0xfc, 0x20, 0xf8, 0x39, 0xff, 0x24, 0x9b, 0x51, 0x27, 0xb8, 0xeb, 0x30, 0xfb, 0xe9, 0x7f, 0x50, 0xda, 0x26, 0x05, 0x85,
+          0xb9, 0xd7, 0x57, 0x7e, 0xe8, 0xc8, 0xb7, 0xa9, 0xdd, 0x1c, 0xc3, 0x7d, 0xde, 0x7c, 0xd0, 0xb0, 0xfb, 0x6c, 0x8f, 0x44, 0x2f, 0x3a, 0x5d, 0x90,
+          0x6c, 0xf6, 0xf0, 0x2b, 0xe7, 0x95, 0x6e, 0x91, 0x03, 0x58, 0xd6, 0x4a, 0xfe, 0x7b, 0x86, 0x6f, 0x40, 0x1e, 0xd9, 0x9d, 0x42, 0xab, 0xc5, 0x6e,
+          0x58, 0x6d, 0xd3, 0xc2, 0xdb, 0xa5, 0xb7, 0xc4, 0x14, 0x6b, 0x7c, 0x6a, 0x80, 0xcc, 0x11, 0xe8, 0x10, 0xd8, 0x4c, 0x13, 0x5b, 0x57, 0x97, 0xec,
+          0x86, 0x98, 0xae, 0x5a, 0xdb, 0x0f, 0x89, 0x2e, 0xae, 0x54, 0xdd, 0xe5, 0x3b, 0xb3, 0x75, 0x5e, 0xdd, 0xee, 0x94, 0x48, 0x66, 0x30, 0x00, 0xb0,
+          0xb8, 0xfc, 0x70, 0x90, 0x3b, 0x81, 0x5e, 0xeb, 0xac, 0xbd, 0x88, 0x6f, 0x55, 0x63, 0x2b, 0xe1, 0x19, 0xe5, 0x40, 0x68, 0x7e, 0x31, 0x1a, 0xfc,
+          0x59, 0x5c, 0xbe, 0xbf, 0x3a, 0x5b, 0x17, 0x46, 0x8c, 0x96, 0x97, 0x9f, 0x6a, 0xf7, 0x9c, 0xd0, 0xac, 0xc6, 0x69, 0xb6, 0x5e, 0x14, 0x8e, 0xb3,
+          0x7a, 0x07, 0x8b, 0x9b, 0xad, 0xa3, 0xd3, 0x69, 0xae, 0x8f, 0x79, 0xce, 0x58, 0xbd, 0x65, 0x72, 0x95, 0x8a, 0x28, 0x5a, 0x06, 0x88, 0xe5, 0x2a,
+          0x6a, 0xbc, 0x10, 0x8b, 0x29, 0x90, 0x53, 0x55, 0x3a, 0x83, 0xd5, 0x49, 0xb6, 0xa0, 0x7b, 0xaf, 0xbe, 0x28, 0x9e, 0xd4, 0x3f, 0x51, 0xa9, 0xd5,
+          0x56, 0x87, 0xb4, 0xb0, 0x97, 0x2d, 0x7a, 0xe3, 0xe7, 0xff, 0xa1, 0xfa, 0x22, 0x7b, 0xeb, 0x1e, 0x21, 0x48, 0xc0, 0xe8, 0x07, 0x76, 0xd4, 0x77,
+          0x68, 0x14, 0x7b, 0xe9, 0xb3, 0xc2, 0x89, 0x32, 0x9c, 0x53, 0xcb, 0x38, 0x51, 0xd1, 0xb4, 0x7c, 0xd3, 0x20, 0xe6, 0x7c, 0xa7, 0x15, 0xd0, 0x25,
+          0xda, 0xa2, 0x61, 0x41, 0xb3, 0xd4, 0x45, 0xd8, 0xf6, 0x26, 0xa6, 0x34, 0xa2, 0x92, 0xa8, 0xef, 0x7f, 0x9b, 0x47, 0x17, 0x04, 0x35, 0x0c, 0x52,
+          0x78, 0x67, 0xde, 0x5c, 0xf7, 0x9f, 0x37, 0xa0, 0xed, 0x0f, 0xa3, 0x1f, 0xf3, 0x1c, 0x6f, 0xe0, 0x84, 0xc0, 0xd8, 0x0f, 0x63, 0xe3, 0x3a, 0x94,
+          0x4d, 0x99, 0x3f, 0xfe, 0x5d, 0x2f, 0x60, 0x6e, 0x6c, 0xf0, 0xc3, 0x46, 0xe4, 0xbf, 0x79, 0xf0, 0xe1, 0x69, 0x78, 0xd5, 0x4f, 0xbc, 0x65, 0xc7,
+          0x5e, 0xfd, 0x9b, 0x5a, 0xee, 0x06, 0x61, 0x5f, 0x77, 0x27, 0xb6, 0xa2, 0x3c, 0xdd, 0xc3, 0x4c, 0x8d, 0x3c, 0x7c, 0x5e, 0xd2, 0x37, 0x11, 0x1e,
+          0x95, 0x1c, 0x51, 0x07, 0x64, 0x55, 0x9d, 0x6c, 0x33, 0x53, 0x03, 0x1b, 0x66, 0x8e, 0xed, 0xfc, 0xd6, 0x63, 0xc7, 0xa4, 0x20, 0xdb, 0x6e, 0x78,
+          0xb9, 0xcd, 0x06, 0xb7, 0x41, 0xfb, 0xcd, 0x50, 0x75, 0xa4, 0x95, 0x06, 0xd0, 0x09, 0x6c, 0x3f, 0xad, 0xa3, 0x7d, 0x39, 0x54, 0x6a, 0x14, 0xde,
+          0x3c, 0xb9, 0xd2, 0x63, 0x3d, 0x55, 0x8b, 0x6c, 0x9d, 0x57, 0x78, 0x30, 0xa1, 0xc3, 0x43, 0x89, 0x1c, 0x7c, 0x39, 0x58, 0xe5, 0xb9, 0x64, 0x7c,
+          0x31, 0x48, 0x89, 0xb7, 0xe3, 0xd0, 0xb4, 0x7c, 0x33, 0x61, 0xcb, 0x26, 0x9f, 0x1f, 0x54, 0x11, 0xb7, 0x77, 0x18, 0x1c, 0xfa, 0xc2, 0xbc, 0xca,
+          0x6f, 0x16, 0x64, 0x86, 0xed, 0x0c, 0x70, 0x55, 0x86, 0x93, 0xd1, 0x94, 0x21, 0x1d, 0xdc, 0x9b, 0x76, 0x44, 0x15, 0xa2, 0xed, 0x33, 0x6d, 0x56,
+          0x00, 0xae, 0x40, 0x9d, 0xec, 0xc5, 0x7b, 0xbf, 0x27, 0x65, 0xec, 0xd5, 0xef, 0x17, 0x19, 0x8f, 0x51, 0xee, 0x10, 0xbb, 0x6a, 0x38, 0xaf, 0x90,
+          0xa4, 0x23, 0xdf, 0xc8, 0xe7, 0x1c, 0x3e, 0x62, 0x70, 0xa0, 0x7b, 0x82, 0x0e, 0x1a, 0x73, 0xbe, 0xc0, 0xd4, 0x81, 0x16, 0xc4, 0xa4, 0x54, 0xac,
+          0xa0, 0x53, 0x47, 0xb3, 0xa5, 0x91, 0x05, 0x4c, 0xd4, 0x62, 0x42, 0x24, 0x33, 0x8b, 0x0e, 0x2e, 0x76, 0x1c, 0x66, 0xb6, 0xc4, 0x14, 0x69, 0x78,
+          0xe3, 0x8f, 0x66, 0x42, 0xfc, 0x11, 0x84, 0x0c, 0x30, 0xf0, 0xcd, 0x83, 0x37, 0x64, 0x4e, 0xdc, 0x15, 0x33, 0x1c, 0x67, 0x38, 0x5b, 0xe2, 0x92,
+          0xe8, 0x3c, 0x7c, 0x0e, 0xc5, 0x17, 0xc0, 0x9f, 0xf6, 0x05, 0xd3, 0xdf, 0x24, 0x78, 0x3d, 0x02, 0x7a, 0x20, 0x1c, 0x9b, 0x2c, 0xcc, 0x7a, 0x76,
+          0xd8, 0x96, 0xbb, 0x27, 0x3a, 0x66, 0x88, 0xd8, 0x6f, 0xda, 0x1c, 0xa7, 0x6e, 0xad, 0x44, 0xa3, 0xb8, 0x03, 0xd0, 0x13, 0x96, 0x4b, 0x15, 0xe6,
+          0x37, 0x13, 0x1e, 0x99, 0x58, 0xd3, 0x71, 0x96, 0xd3, 0x57, 0x14, 0xe5, 0x55, 0xd8, 0x2b, 0x1d, 0x81, 0x34, 0xad, 0x67, 0x14, 0x8f, 0x5e, 0x99,
+          0xad, 0x6d, 0x98, 0x26, 0x3a, 0x69, 0x08, 0xdf, 0x48, 0x57, 0x74, 0x2a, 0xdb, 0xc1, 0x37, 0xaf, 0x38, 0x4e, 0x2e, 0x85, 0xdb, 0x1a, 0xc7, 0x14,
+          0x6f, 0x6e, 0x97, 0x43, 0x98, 0x85, 0x3f, 0xbb, 0xc5, 0x04, 0xcc, 0x92, 0xc2, 0x32, 0x87, 0x58, 0x12, 0x6a, 0xd8, 0xe9, 0xca, 0xbb, 0x8c, 0x88,
+          0xef, 0x6d, 0x48, 0x29, 0xff, 0xce, 0x53, 0x97, 0xf7, 0xd6, 0x4f, 0xa9, 0x8f, 0x57, 0xf9, 0xe9, 0x87, 0xab, 0xe2, 0x70, 0xca, 0x64, 0x9f, 0x4c,
+          0xf0, 0xfc, 0x8d, 0x77, 0xfc, 0xac, 0x41, 0xb5, 0x1b, 0xb1, 0x12, 0x10, 0xa7, 0x8e, 0x8b, 0xff, 0xc1, 0x18, 0xf8, 0xdb, 0x62, 0x0c, 0xfe, 0xfb,
+          0xf7, 0x79, 0x05, 0xfe, 0xbd, 0x8f, 0x01, 0x96, 0xbd, 0xec, 0xd7, 0x32, 0x6a, 0x9c, 0xc7, 0x70, 0x42, 0x23, 0x0e, 0x29, 0x7e, 0x7d, 0x3d, 0xe4,
+          0x3b, 0x75, 0x9b, 0x3d, 0x6f, 0xdd, 0xa9, 0xc4, 0x78, 0x39, 0x6c, 0xd3, 0x06, 0xfe, 0x5b, 0x99, 0x66, 0xa1, 0x85, 0x27, 0x4c, 0x73, 0xbc, 0x35,
+          0x53, 0x18, 0x3c, 0xdc, 0x24, 0x93, 0xa2, 0x7f, 0x6d, 0x35, 0x77, 0x59, 0xbd, 0x4c, 0x8c, 0x36, 0x87, 0xd0, 0xa3, 0x87, 0xcd, 0x73, 0xf9, 0x94,
+          0x9a, 0x9e, 0xd1, 0x27, 0xa7, 0x80, 0xf4, 0xe6, 0xbf, 0x52, 0x3c, 0xdd, 0xbc, 0x2f, 0x26, 0x28, 0xc7, 0xdc, 0x0f, 0x36, 0x56, 0xb9, 0xd5, 0xf1,
+          0x8d, 0xb9, 0xaa, 0xe4, 0x86, 0xc5, 0x53, 0x78, 0xc6, 0x6b, 0xfb, 0x00, 0x62, 0xd3, 0x8e, 0x63, 0x65, 0x0a, 0xd4, 0x08, 0x3b, 0x94, 0x8f, 0xfb,
+          0xca, 0xb2, 0x3f, 0xaf, 0x0a, 0x2c, 0xcc, 0x36, 0xa8, 0xd1, 0xc6, 0x3e, 0x48, 0xff, 0x53, 0x31, 0xd2, 0x43, 0x02, 0x17, 0x02, 0x7d, 0xe3, 0xb9,
+          0x31, 0xbb, 0x2c, 0xbf, 0x9d, 0x67, 0x8e, 0x44, 0x6b, 0xa4, 0x35, 0x40, 0xbe, 0xd6, 0xfe, 0x4a, 0xcd, 0xb0, 0x53, 0xb8, 0xdb, 0xdb, 0xd1, 0xe8,
+          0xaa, 0xa6, 0x40, 0xdd, 0x05, 0x25, 0x32, 0x1f, 0x06, 0x8f, 0x54, 0x61, 0x3a, 0x09, 0xae, 0xad, 0x02, 0x27, 0x70, 0xd1, 0x3d, 0x24, 0x12, 0x03,
+          0x38, 0x03, 0x18, 0xa8, 0x65, 0x48, 0xd4, 0xa3, 0x3b, 0x48, 0xb7, 0x71, 0x8f, 0x85, 0xfd, 0x4f, 0xda, 0xb0, 0x27, 0xfe, 0xd5, 0x31, 0x57, 0xd1,
+          0x77, 0xc9, 0x77, 0x93, 0x79, 0x7b, 0x16, 0x79, 0xfb, 0x9a, 0x56, 0x9b, 0xfa, 0xdc, 0xc5, 0x51, 0x1c, 0x2f, 0x57, 0x7b, 0x0d, 0xc3, 0x22, 0x22,
+          0xe1, 0xa6, 0xaf, 0x91, 0xd7, 0xe3, 0x1a, 0xe7, 0xef, 0x2f, 0x09, 0xed, 0xaa, 0xa7, 0x2f, 0xdc, 0x21, 0x94, 0x5b, 0xca, 0xdd, 0xc1, 0x7a, 0x4a,
+          0xf9, 0x78, 0xfa, 0x01, 0xd1, 0x35, 0x94, 0x40, 0x0d, 0xeb, 0x60, 0xd4, 0x48, 0xd3, 0x06, 0x93, 0x92, 0xca, 0x1e, 0x4f, 0xf5, 0x30, 0xf8, 0xcb,
+          0x3a, 0xb6, 0xed, 0xbe, 0xdf, 0x47, 0xac, 0xd7, 0xbc, 0xe8, 0x60, 0x75, 0x0e, 0xae, 0xcd, 0x49, 0xa6, 0x5b, 0x27, 0xc7, 0xb1, 0x60, 0x87, 0x34,
+          0x03, 0x66, 0xd4, 0x98, 0x24, 0x8b, 0x80, 0x51, 0x1a, 0xc5, 0x26, 0xa1, 0x65, 0xc9, 0x15, 0xa6, 0xc4, 0x99, 0xad, 0x81, 0xc4, 0x18, 0x37, 0x4b,
+          0xa3, 0x84, 0xd1, 0x5c, 0xbe, 0xf3, 0x85, 0x8b, 0x86, 0x79, 0xb5, 0x30, 0x16, 0x3a, 0x10, 0x67, 0xc1, 0xde, 0x3e, 0x42, 0x25, 0x52, 0x8a, 0xa7,
+          0xba, 0x74, 0x02, 0xb8, 0x82, 0x46, 0xc7, 0x8e, 0xf9, 0x9b, 0xdd, 0x15, 0xf4, 0xf8, 0x36, 0xeb, 0x3d, 0xb2, 0x4c, 0x46, 0x9a, 0x46, 0x75, 0xd9,
+          0x89, 0xbe, 0x48, 0x2a, 0x05, 0x4a, 0x2c, 0xd2, 0xa9, 0xdd, 0x0e, 0x27, 0xd4, 0x76, 0x0b, 0xee, 0xa2, 0x3c, 0x78, 0xfc, 0x4f, 0xe3, 0x3b, 0xa5,
+          0x55, 0xfb, 0x3d, 0x10, 0xd6, 0x4b, 0xef, 0x25, 0xea, 0x32, 0x2b, 0x54, 0xfc, 0xf0, 0x70, 0x6c, 0x61, 0x47, 0x8d, 0x27, 0xfa, 0xc1, 0xc8, 0x42,
+          0xa8, 0x60, 0xa9, 0xd9, 0xf1, 0xf2, 0x50, 0x1e, 0xde, 0x7e, 0x2c, 0x9f, 0xa2, 0xea, 0xc0, 0x17, 0x60, 0x7f, 0x82, 0x85, 0x67, 0x42, 0xe3, 0xbb,
+          0xdf, 0x6a, 0x2c, 0x36, 0xc3, 0x6a, 0x12, 0x7f, 0xac, 0x5d, 0x12, 0xfd, 0xa0, 0x54, 0xe7, 0xb8, 0xbc, 0x0d, 0x23, 0x9e, 0xc5, 0x62, 0x13, 0x39,
+          0x91, 0x2f, 0x83, 0xca, 0x4f, 0xe8, 0xcb, 0x64, 0x7e, 0xfb, 0x7d, 0x5a, 0xdb, 0x0d, 0x3c, 0x2d, 0xa7, 0x21, 0x1f, 0x34, 0x93, 0x06, 0x8e, 0x32,
+          0x0d, 0x5b, 0x9e, 0x71, 0x42, 0xfe, 0xc5, 0x89, 0xca, 0x7d, 0x3a, 0x07, 0xbd, 0x62, 0x20, 0x2a, 0x06, 0x37, 0xee, 0x91, 0x23, 0x5a, 0x90, 0x41,
+          0x08, 0x8b, 0x70, 0x38, 0xe5, 0xf0, 0xa8, 0x33, 0x04, 0x0e, 0x12, 0x45, 0xbe, 0xfe, 0xb1, 0x1c, 0x66, 0x6c, 0x22, 0x05, 0x7f, 0x99, 0xbf, 0xee,
+          0x89, 0xf3, 0xbd, 0x3b, 0x93, 0xee, 0x7e, 0x84, 0x7d, 0x30, 0xb3, 0xc0, 0x18, 0x0d, 0xaf, 0x65, 0x66, 0x00, 0x43, 0x43, 0xd0, 0xec, 0x3e, 0x73,
+          0x82, 0x46, 0x85, 0x2c, 0x96, 0x91, 0x00, 0xcf, 0xb0, 0x6e, 0x34, 0xc6, 0x70, 0x69, 0x0e, 0x5a, 0x59, 0x77, 0x59, 0x63, 0xf1, 0x98, 0x16, 0x47,
+          0x02, 0xe7, 0x69, 0x96, 0x37, 0x71, 0x93, 0x4c, 0x74, 0x3d, 0x21, 0xa1, 0x3d, 0xf1, 0xa8, 0x21, 0x1e, 0x64, 0xc4, 0x4c, 0x3a, 0xf2, 0x5b, 0xcd,
+          0x54, 0x03, 0x8a, 0x75, 0x65, 0xe1, 0x97, 0x6a, 0x97, 0xb0, 0x95, 0xa2, 0x28, 0xdb, 0x2c, 0x4e, 0x46, 0x42, 0x00, 0x9b, 0x54, 0xff, 0x70, 0x5e,
+          0xb6, 0xb6, 0xe7, 0xcb, 0x39, 0x24, 0x2c, 0x5d, 0x37, 0x1a, 0xa8, 0x4f, 0xfa, 0x68, 0xc6, 0x11, 0x33, 0x1e, 0xf7, 0x39, 0x8d, 0x4c, 0xb0, 0x36,
+          0xe0, 0xfd, 0x4d, 0x04, 0x62, 0xa5, 0xd1, 0xe4, 0xb5, 0x13, 0x07, 0xb8, 0x1d, 0xbe, 0xb8, 0xf4, 0xf6, 0x2a, 0xbc, 0x93, 0xe0, 0xd7, 0x9a, 0x60,
+          0x85, 0xf2, 0x71, 0x92, 0xf5, 0x21, 0xca, 0x5e, 0x3d, 0xf2, 0xcb, 0xfa, 0xe5, 0xa6, 0x96, 0xbe, 0x03, 0x4e, 0x2e, 0x00, 0x7c, 0xc2, 0x60, 0x67,
+          0x95, 0xc7, 0x37, 0xb2, 0x91, 0x1d, 0x05, 0x4d, 0x1a, 0x3e, 0x66, 0x2e, 0xc2, 0x35, 0x4f, 0x09, 0xdd, 0xe9, 0xca, 0x21, 0x72, 0xb6, 0x56, 0xb6,
+          0x8e, 0x7e, 0x4c, 0xc0, 0x80, 0x4b, 0xda, 0x0f, 0xa8, 0x5b, 0xeb, 0x10, 0x79, 0x1e, 0xd0, 0xed, 0xb8, 0x1e, 0x1e, 0x0f, 0x42, 0x14, 0x85, 0x78,
+          0x2a, 0x68, 0x97, 0xf5, 0xfc, 0xd7, 0x24, 0x07, 0x02, 0xe7, 0x04, 0x48, 0x1b, 0xb1, 0x0e, 0x71, 0x1d, 0xce, 0x31, 0x21, 0x24, 0x5a, 0xcb, 0x4f,
+          0xce, 0x05, 0x09, 0x41, 0x61, 0x90, 0xee, 0x93, 0xf8, 0x01, 0xe9, 0x97, 0x13, 0x1e, 0x07, 0xd1, 0x17, 0xea, 0xc7, 0x23, 0x64, 0x18, 0x9d, 0xdb,
+          0x8c, 0x64, 0xea, 0x1a, 0xed, 0xa1, 0x59, 0x54, 0x1d, 0x50, 0x76, 0x8a, 0x9e, 0xf3, 0xe6, 0xf3, 0x98, 0xb8, 0xab, 0xcf, 0x8e, 0xa7, 0xb1, 0x66,
+          0xae, 0x10, 0x22, 0xa2, 0x1a, 0x9d, 0xe7, 0x37, 0x01, 0xfb, 0x9c, 0xdb, 0xd8, 0xea, 0x76, 0x20, 0x75, 0x15, 0xfd, 0x03, 0xab, 0xb3, 0x05, 0xf8,
+          0xb8, 0x54, 0x3b, 0xaa, 0x40, 0x38, 0xf6, 0x33, 0x67, 0x9e, 0xf6, 0x10, 0xdc, 0xc0, 0x5c, 0x2f, 0xb6, 0x3e, 0xf5, 0x54, 0xbb, 0xae, 0xaa, 0xab,
+          0x1e, 0x2b, 0x3e, 0x0c, 0x07, 0x72, 0x84, 0x65, 0xa6, 0x43, 0xba, 0x10, 0x4e, 0x91, 0x21, 0x5c, 0xe8, 0xfd, 0x9f, 0x89, 0xbf, 0x9d, 0x80, 0x90,
+          0xad, 0x86, 0x3b, 0xfb, 0x8c, 0x2c, 0xb8, 0xc5, 0x45, 0xd7, 0x67, 0xa3, 0xf9, 0xc8, 0x0b, 0x88, 0xb6, 0x10, 0x46, 0x8a, 0xda, 0xcb, 0xb8, 0x91,
+          0x51, 0x03, 0xce, 0xec, 0xc6, 0x47, 0x20, 0xf2, 0xd8, 0xac, 0x73, 0x3f, 0xf9, 0xc7, 0xf9, 0x28, 0xcc, 0x49, 0x87, 0x85, 0x1a, 0xec, 0xe8, 0x78,
+          0x3e, 0xd1, 0xae, 0xd3, 0x7d, 0x28, 0x41, 0xf1, 0xc7, 0xa8, 0xd6, 0x0e, 0xa3, 0xe1, 0x6f, 0xa7, 0x49, 0xd2, 0x01, 0xc4, 0x79, 0x76, 0xe6, 0xef,
+          0xc8, 0x82, 0x0f, 0x70, 0x2d, 0x55, 0x48, 0x8a, 0x8a, 0x14, 0x99, 0x84, 0x2b, 0x64, 0x7a, 0xf0, 0xe6, 0xcc, 0xc1, 0x05, 0x2f, 0x8d, 0xb8, 0xff,
+          0xdb, 0x5c, 0x0f, 0x21, 0xb8, 0xb5, 0x51, 0x49, 0xed, 0x21, 0x30, 0x15, 0xa7, 0x55, 0x3c, 0x38, 0x43, 0xa1, 0x2e, 0x69, 0xdb, 0xe3, 0x56, 0x94,
+          0xbc, 0xfb, 0xb2, 0x41, 0xd3, 0x4b, 0xcb, 0x2d, 0x9a, 0xe1, 0x72, 0xa6, 0xfa, 0x63, 0x06, 0xb0, 0x37, 0xe4, 0x01, 0xa7, 0xa1, 0x6b, 0xb1, 0x10,
+          0x41, 0xb1, 0xac, 0x75, 0x28, 0x8d, 0x84, 0xe8, 0x20, 0x4e, 0x60, 0xec, 0x4e, 0x5f, 0x0d, 0x41, 0xcb, 0x96, 0x9f, 0x8a, 0x3d, 0x19, 0x0a, 0x17,
+          0xfe, 0x9f, 0x5f, 0x8f, 0x59, 0x4f, 0x80, 0xf6, 0xff, 0x87, 0xc9, 0x90, 0x5a, 0x7f, 0xfb, 0xdd, 0x1c, 0xf4, 0xa5, 0x58, 0x1d, 0x3e, 0x0a, 0x24,
+          0x49, 0xfa, 0xab, 0x51, 0xf2, 0x39, 0x5d, 0x71, 0xa4, 0xe4, 0xca, 0xc9, 0xd6, 0x9a, 0xc1, 0xc1, 0x7c, 0x65, 0x8d, 0x96, 0x03, 0x92, 0xa7, 0x3b,
+          0x2b, 0x50, 0x16, 0xf2, 0x85, 0xea, 0x90, 0x88, 0xbc, 0x1e, 0x79, 0xa2, 0x98, 0xb9, 0x0c, 0x5c, 0x11, 0xdd, 0x29, 0xe9, 0x92, 0x25, 0xd8, 0xea,
+          0xc5, 0xab, 0xe5, 0x77, 0xae, 0x64, 0x8d, 0x67, 0xe3, 0xa7, 0x61, 0x2f, 0x5d, 0xa3, 0xd6, 0xe1, 0xc9, 0x51, 0x90, 0xb2, 0x69, 0xa4, 0x0b, 0xb2,
+          0xda, 0x11, 0xd5, 0x68, 0xbb, 0x5f, 0xeb, 0x6e, 0x1d, 0x0b, 0x38, 0x58, 0xeb, 0xf1, 0x76, 0x5a, 0x3d, 0x28, 0x72, 0x50, 0x48, 0xcb, 0xde, 0x50,
+          0xb0, 0x9f, 0x58, 0x0c, 0x4e, 0xa0, 0xf0, 0x8b, 0x48, 0x4c, 0x1a, 0x88, 0x21, 0xe2, 0xc2, 0x1a, 0xd0, 0x63, 0xfd, 0xdd, 0xb2, 0x64, 0xda, 0x00,
+          0x34, 0xf7, 0xad, 0x88, 0xcd, 0xdc, 0x46, 0xcf, 0x73, 0xd8, 0x65, 0x1a, 0x32, 0x7b, 0x0d, 0x80, 0x1e, 0xcc, 0xde, 0xb1, 0x95, 0xae, 0x0f, 0x5d,
+          0x4f, 0x1d, 0xc0, 0xd0, 0x41, 0x09, 0x28, 0x96, 0x67, 0x7e, 0xcd, 0x29, 0x25, 0x58, 0x9f, 0x41, 0x11, 0xa3, 0x92, 0xe6, 0x94, 0x91, 0xd4, 0x84,
+          0x06, 0xa4, 0x30, 0xc8, 0xde, 0xe4, 0x4b, 0x01, 0xf3, 0x46, 0xeb, 0x54, 0x5d, 0xbe, 0xc5, 0xe2, 0x4a, 0xe7, 0xc2, 0x70, 0x20, 0x13, 0x93, 0x3a,
+          0x37, 0x8b, 0x75, 0x7d, 0xee, 0xa4, 0xfd, 0x8c, 0xf1, 0x09, 0x66, 0x2c, 0x83, 0x8c, 0x07, 0xf4, 0x5a, 0xf3, 0xc2, 0xb0, 0x7e, 0x0c, 0x3f, 0x50,
+          0x22, 0x30, 0xdf, 0x77, 0x90, 0xba, 0x56, 0xbf, 0xfd, 0xba, 0xde, 0xf4, 0xb4, 0xe1, 0x2c, 0x3b, 0xa4, 0x1d, 0x7b, 0x94, 0x0c, 0xf6, 0xb9, 0x3b,
+          0x68, 0xf1, 0x3b, 0x37, 0x78, 0xc7, 0xd0, 0x78, 0xf9, 0xc7, 0x22, 0x2b, 0x0b, 0x5d, 0x2c, 0xc0, 0x31, 0x62, 0x07, 0x4f, 0x02, 0xba, 0x45, 0xbe,
+          0xa6, 0xbf, 0x35, 0xc1, 0x76, 0x8d, 0x5d, 0xae, 0xd8, 0x25, 0xc4, 0xd4, 0xea, 0xc9, 0x0d, 0x5b, 0xb6, 0x0c, 0x81, 0xae, 0x3d, 0xf0, 0x2a, 0xe6,
+          0x81, 0xed, 0x87, 0xc3, 0x1b, 0x8b, 0x77, 0xac, 0xb7, 0xc4, 0x16, 0xc2, 0x84, 0x96, 0x36, 0x7c, 0xc6, 0xc2, 0xc5, 0x14, 0x04, 0xe3, 0xda, 0xb7,
+          0x45, 0xc2, 0x73, 0x38, 0x01, 0xa1, 0x0e, 0x0e, 0x1d, 0xad, 0x3b, 0x61, 0xbc, 0xd2, 0x88, 0x80, 0xea, 0xab, 0xed, 0x32, 0x12, 0x75, 0x21, 0x54,
+          0xa5, 0x88, 0x6a, 0xc1, 0xe3, 0xe6, 0x24, 0x59, 0x1f, 0xa5, 0x83, 0xc5, 0x98, 0xb2, 0xa7, 0x8e, 0x00, 0xd2, 0x1e, 0xfc, 0x65, 0xa5, 0xa5, 0x60,
+          0x1c, 0xa7, 0xb1, 0x6b, 0xfb, 0x8a, 0x9d, 0x74, 0x9f, 0xf5, 0x6e, 0x4c, 0xc0, 0xa2, 0xe9, 0x3e, 0xf2, 0x89, 0x1c, 0xae, 0x74, 0x45, 0xee, 0x24,
+          0x7a, 0x52, 0xe0, 0x75, 0xa9, 0x5a, 0xfb, 0x94, 0x07, 0x53, 0xb3, 0x5a, 0x69, 0xbd, 0xe0, 0x2d, 0x80, 0x7e, 0x3d, 0x19, 0x8a, 0x25, 0x25, 0x5f,
+          0x5b, 0x12, 0x86, 0x2b, 0x25, 0xc1, 0x68, 0x4a, 0xca, 0xc3, 0x0c, 0xc8, 0x32, 0xb5, 0xc1, 0x9d, 0xd4, 0x6a, 0x9a, 0x89, 0x68, 0x13, 0x10, 0x3a,
+          0xb8, 0x33, 0xea, 0xb3, 0x45, 0x30, 0x94, 0xfb, 0x64, 0xf7, 0x1c, 0x54, 0x56, 0x49, 0x50, 0xe3, 0x0a, 0x16, 0xb8, 0xe7, 0xfd, 0x1a, 0xec, 0x43,
+          0x66, 0x46, 0x97, 0x3e, 0x79, 0xbf, 0xdf, 0xf4, 0x7a, 0x95, 0xdf, 0xa2, 0x6e, 0xf0, 0xd7, 0x99, 0xd1, 0x75, 0x07, 0x2d, 0x17, 0x83, 0x9e, 0x0c,
+          0x26, 0x7b, 0xf4, 0x7c, 0xbc, 0xa3, 0x29, 0x9e, 0xe6, 0x03, 0x0c, 0x3f, 0xcd, 0x9c, 0x22, 0x71, 0x27, 0x84, 0xfe, 0xdc, 0x82, 0xc4, 0x3d, 0xc0,
+          0xe6, 0x60, 0xcf, 0xd8, 0x93, 0x18, 0xbb, 0x81, 0x55, 0xa7, 0xb0, 0x5d, 0x5b, 0x72, 0xb4, 0x63, 0x11, 0x14, 0x47, 0x08, 0xf6, 0xa5, 0x43, 0xf8,
+          0x0d, 0x7f, 0xc1, 0x20, 0xa7, 0x89, 0xcb, 0x0d, 0x1c, 0x60, 0x47, 0xeb, 0x39, 0x69, 0xd7, 0x4b, 0xdb, 0xcb, 0xd6, 0x1e, 0xfb, 0x7a, 0x52, 0x51,
+          0xd2, 0x50, 0x6f, 0xe1, 0xab, 0x3d, 0x48, 0x23, 0xa5, 0x96, 0xc3, 0x56, 0xb1, 0xea, 0x38, 0x12, 0x10, 0x19, 0xc2, 0xed, 0x8d, 0xef, 0x81, 0x66,
+          0x1c, 0x40, 0x04, 0xed, 0xcf, 0x22, 0x63, 0x11, 0xe6, 0x4b, 0x75, 0x8b, 0xdb, 0xd2, 0x53, 0x6a, 0x1a, 0x77, 0x6d, 0xc5, 0x91, 0x7c, 0xd5, 0x8c,
+          0xee, 0xe2, 0x8a, 0x04, 0xec, 0xd2, 0x63, 0x2c, 0x11, 0xa1, 0x39, 0x7d, 0x04, 0xeb, 0x49, 0x0d, 0xea, 0x63, 0xdf, 0xd3, 0xf3, 0x7c, 0x01, 0x3f,
+          0xd7, 0x6e, 0x80, 0x24, 0x4c, 0x3f, 0x2b, 0xd2, 0x14, 0x46, 0x8e, 0x55, 0x7a, 0xea, 0xa9, 0x6d, 0x47, 0x59, 0xca, 0x91, 0x42, 0xd1, 0xae, 0x25,
+          0xe4, 0xfa, 0xda, 0xe0, 0xf5, 0xbe, 0x59, 0x7f, 0x03, 0x47, 0x76, 0xc4, 0x5b, 0x45, 0x18, 0x3d, 0x67, 0xcc, 0x10, 0xb1, 0xb5, 0x11, 0x30, 0x92,
+          0x6c, 0xc5, 0xf7, 0x08, 0x18, 0xf9, 0xd0, 0x2c, 0x69, 0x50, 0x39, 0x1f, 0xdc, 0x17, 0x75, 0x82, 0x73, 0x10, 0x96, 0x03, 0x8a, 0x6d, 0xdd, 0x62,
+          0x97, 0x72, 0x70, 0x2b, 0x1c, 0xa4, 0x15, 0xc4, 0x65, 0x58, 0x04, 0xb6, 0xa9, 0x68, 0x98, 0x03, 0xce, 0x37, 0xe1, 0xd6, 0xff, 0x5c, 0xba, 0xa4,
+          0x5c, 0xdf, 0xbd, 0x98, 0x2e, 0xe7, 0xd5, 0xe6, 0xcd, 0x9c, 0x96, 0x15, 0x8d, 0xc0, 0x1c, 0xeb, 0x8d, 0x1e, 0xda, 0x57, 0xa2, 0x7d, 0x79, 0x44,
+          0xe7, 0x82, 0xb6, 0xaf, 0xe2, 0x0d, 0x1c, 0xb0, 0x54, 0x60, 0xe5, 0x42, 0x7e, 0x85, 0x93, 0x4c, 0x0b, 0x79, 0xf6, 0x1a, 0x78, 0xbe, 0x09, 0x04,
+          0x8e, 0xb7, 0xd4, 0x69, 0x37, 0xaa, 0xdf, 0x01, 0x7e, 0x3a, 0x05, 0x18, 0x69, 0x37, 0x47, 0x8e, 0xb0, 0x5e, 0x80, 0x45, 0x14, 0x36, 0x09, 0x84,
+          0xe7, 0x2a, 0x53, 0x2b, 0x10, 0xd7, 0x28, 0xae, 0x1e, 0x58, 0x9e, 0xd3, 0x9a, 0x2d, 0x14, 0x4d, 0xef, 0xed, 0x80, 0x0b, 0x09, 0x7b, 0xb8, 0x9f,
+          0xf9, 0x7b, 0x26, 0x54, 0xb4, 0x45, 0xae, 0xb2, 0xc6, 0x3f, 0xb3, 0xec, 0x39, 0x56, 0xa0, 0x4d, 0x67, 0xba, 0xef, 0x4e, 0x0b, 0x72, 0x72, 0x9e,
+          0x0d, 0x23, 0x07, 0x2d, 0xb2, 0x54, 0x1d, 0xc3, 0x0d, 0xec, 0xb3, 0x9e, 0xf3, 0x58, 0x8b, 0xbc, 0x8f, 0x6c, 0xd8, 0x36, 0xd4, 0x3a, 0xa6, 0xb7,
+          0xd2, 0x17, 0x4c, 0x23, 0xeb, 0xaa, 0x2d, 0x2b, 0x2f, 0x9c, 0xde, 0x1d, 0xa8, 0xb5, 0xb4, 0x1f, 0x3e, 0xc1, 0x2b, 0xdd, 0xf6, 0x79, 0xee, 0x74,
+          0xc0, 0x1f, 0x25, 0xce, 0x15, 0x4b, 0x4a, 0xc3, 0xe7, 0xb7, 0x61, 0xe9, 0xe5, 0xc3, 0xb1, 0x00, 0x19, 0x0a, 0x4a, 0x45, 0x57, 0xf9, 0x43, 0x43,
+          0x3b, 0x9c, 0xbd, 0xa2, 0x84, 0xeb, 0xca, 0xb9, 0x69, 0x3d, 0x76, 0x56, 0x44, 0xa6, 0xa8, 0x78, 0xad, 0x62, 0x48, 0x16, 0x20, 0x61, 0x74, 0x5b,
+          0x4f, 0x0f, 0x98, 0xbb, 0x3c, 0x6d, 0x39, 0x12, 0x85, 0x2e, 0x8c, 0x45, 0xa2, 0x0b, 0x33, 0xee, 0x03, 0xb0, 0x29, 0xa0, 0x14, 0x97, 0x4e, 0xa2,
+          0xa6, 0x60, 0x7b, 0x96, 0x84, 0x4b, 0x81, 0x47, 0xf8, 0x2d, 0x00, 0x75, 0xca, 0x4b, 0x97, 0x80, 0x20, 0x84, 0x7d, 0x32, 0xae, 0xb6, 0x84, 0xb4,
+          0x37, 0x92, 0x87, 0xdc, 0x42, 0x14, 0xb9, 0x44, 0x2e, 0x43, 0xc1, 0xb0, 0xe9, 0xb6, 0xe0, 0x43, 0xbc, 0xab, 0xca, 0x2d, 0xd9, 0x1a, 0x86, 0x51,
+          0xa4, 0xa1, 0xd9, 0x38, 0x3c, 0xb5, 0x05, 0xab, 0xd6, 0x80, 0xed, 0xcf, 0x74, 0x2e, 0x26, 0xf8, 0x16, 0xd5, 0x40, 0x58, 0x5f, 0xd5, 0xd0, 0xfc,
+          0x4a, 0xed, 0x4d, 0x1b, 0x69, 0x4d, 0x88, 0xec, 0x18, 0xda, 0xcf, 0x18, 0xfc, 0x1d, 0xdf, 0x2d, 0x10, 0xf8, 0x86, 0x18, 0x7c, 0x52, 0x4b, 0x7c,
+          0x54, 0x4a, 0x99, 0x0e, 0x4b, 0x2e, 0x37, 0x0e, 0xe2, 0x05, 0xd3, 0x65, 0xf5, 0xca, 0x69, 0x05, 0x6a, 0xf9, 0x44, 0x15, 0x64, 0xe6, 0x44, 0x27,
+          0x35, 0x6d, 0x63, 0x3d, 0x54, 0x3e, 0xa0, 0xea, 0x64, 0xc8, 0x65, 0x55, 0x92, 0x12, 0xeb, 0xde, 0x96, 0x10, 0x71, 0x90, 0x45, 0x87, 0xae, 0x2d,
+          0xbf, 0xa6, 0xda, 0xaf, 0x79, 0x62, 0x63, 0x95, 0x90, 0x8a, 0xa7, 0x90, 0xe7, 0xe3, 0x19, 0x17, 0x0d, 0x9a, 0x1f, 0xc7, 0x84, 0xa5, 0x44, 0x4d,
+          0xa0, 0x70, 0x84, 0x41, 0x92, 0x8e, 0xc5, 0x1b, 0xc0, 0x00, 0x3a, 0x4f, 0xb0, 0x42, 0xee, 0xfa, 0x88, 0x1e, 0x79, 0x7f, 0x21, 0x82, 0xdd, 0x23,
+          0x3d, 0xd5, 0x1f, 0xf2, 0xf2, 0x25, 0xb8, 0x7a, 0x32, 0x8c, 0xc4, 0xd2, 0xb8, 0x5c, 0x67, 0xdb, 0x5a, 0x85, 0x21, 0x33, 0x1e, 0xcf, 0xcc, 0x44,
+          0x21, 0xf2, 0x60, 0xe7, 0xe2, 0x81, 0x13, 0x6c, 0x59, 0x4c, 0x53, 0xf5, 0x2c, 0xda, 0x9c, 0xfc, 0xf8, 0xa8, 0xaa, 0xb2, 0x20, 0x8d, 0xf3, 0x15,
+          0x2e, 0xc0, 0xef, 0x3e, 0x11, 0xe2, 0x47, 0x73, 0x02, 0x00, 0x12, 0xee, 0x31, 0x8c, 0x59, 0x3c, 0x1d, 0x54, 0x4d, 0xf4, 0x42, 0xd2, 0xcc, 0x97,
+          0x6c, 0xb5, 0xf9, 0x61, 0xdf, 0x55, 0xac, 0xfb, 0xb4, 0xce, 0x14, 0x02, 0x6b, 0xd4, 0xef, 0x5d, 0xac, 0xdc, 0x5f, 0xee, 0xd0, 0x76, 0x28, 0xd1,
+          0xf7, 0x76, 0xc5, 0xcf, 0x3d, 0x49, 0x83, 0xf9, 0x6c, 0x8e, 0x22, 0xdb, 0xa7, 0xe7, 0x5b, 0x81, 0x19, 0x60, 0xe7, 0xba, 0xaa, 0x96, 0x43, 0x11,
+          0x60, 0xcb, 0x70, 0xac, 0xc9, 0x50, 0x63, 0x1c, 0x02, 0x06, 0x5c, 0xa5, 0xaa, 0x46, 0x0c, 0x94, 0x34, 0x87, 0x1e, 0xe9, 0x5b, 0x51, 0x9b, 0x5d,
+          0x8b, 0xeb, 0x90, 0x92, 0x04, 0xe2, 0x4e, 0x39, 0xdd, 0x7c, 0x31, 0x2a, 0xcb, 0xc9, 0xfa, 0xaf, 0xa5, 0x18, 0x67, 0x0e, 0xc0, 0x04, 0x8e, 0x85,
+          0xc7, 0x99, 0x79, 0x94, 0xb2, 0xbe, 0xe5, 0xa5, 0x15, 0x2b, 0x25, 0xd6, 0x03, 0x23, 0x9c, 0x41, 0x50, 0xf2, 0xae, 0x4c, 0xe2, 0x97, 0x49, 0xed,
+          0x3a, 0xaf, 0xfd, 0x91, 0xec, 0x39, 0xb7, 0xad, 0x5e, 0x04, 0x39, 0x16, 0x52, 0x66, 0xbc, 0xae, 0xd8, 0x0a, 0xa0, 0x7b, 0x8e, 0x4c, 0x01, 0xbb,
+          0x46, 0x50, 0x72, 0x25, 0xb6, 0x55, 0xf8, 0x15, 0xdd, 0x9b, 0xcf, 0x62, 0xb1, 0x91, 0xd5, 0xa2, 0xfb, 0x36, 0x6b, 0x37, 0xb3, 0x08, 0xca, 0x6d,
+          0x91, 0x5a, 0x4c, 0xb2, 0x39, 0xe6, 0xbe, 0xd8, 0x32, 0x96, 0x65, 0x1f, 0x96, 0x86, 0x2c, 0xf6, 0x67, 0x8d, 0x53, 0x6f, 0x80, 0xc1, 0xa1, 0xbd,
+          0x3c, 0x89, 0xa9, 0x67, 0xc7, 0x6b, 0xd9, 0x82, 0xaf, 0x81, 0x3d, 0x6e, 0xd9, 0xa2, 0x8a, 0x11, 0xf6, 0x59, 0x77, 0xb1, 0x75, 0xfd, 0x3c, 0xa6,
+          0x7b, 0xec, 0xef, 0x1a, 0xc4, 0x56, 0x2d, 0x0e, 0x1a, 0x3c, 0xb3, 0x77, 0x29, 0xd9, 0x2e, 0x67, 0xfa, 0x41, 0xdc, 0xb6, 0x93, 0xfc, 0x82, 0xb1,
+          0x47, 0x51, 0xeb, 0x56, 0x3e, 0x07, 0xf0, 0x9a, 0xe1, 0x14, 0x30, 0x17, 0xc1, 0x56, 0x36, 0xd2, 0xc7, 0xb7, 0x18, 0x90, 0x7b, 0xbf, 0xee, 0x8d,
+          0x3a, 0x7c, 0x8a, 0x2e, 0x9c, 0x4d, 0x4a, 0xe0, 0xa4, 0xaa, 0xdc, 0xcd, 0x35, 0x3b, 0xee, 0x23, 0x23, 0xed, 0xb5, 0x0c, 0xd8, 0xbe, 0x46, 0xf8,
+          0x35, 0xca, 0x9f, 0x85, 0x26, 0x8c, 0xdb, 0xe3, 0xcb, 0xd1, 0xd3, 0x71, 0x98, 0x9a, 0x31, 0x1f, 0xde, 0xa7, 0xb5, 0xea, 0xe1, 0xcf, 0x41, 0xdb,
+          0x3d, 0x22, 0x4c, 0xb6, 0xb9, 0xb1, 0x59, 0x37, 0x2a, 0x3f, 0x5d, 0x42, 0xfc, 0xe8, 0x49, 0xba, 0x5c, 0x86, 0x4c, 0x77, 0x06, 0xa6, 0x90, 0xc4,
+          0xaf, 0xf1, 0x28, 0x7b, 0xd0, 0xe4, 0x48, 0x26, 0x9a, 0xd6, 0xba, 0x9a, 0x27, 0xf8, 0x90, 0x9d, 0x1c, 0x5c, 0xe7, 0x83, 0x6c, 0xc0, 0x2e, 0x6b,
+          0xe0, 0x7e, 0x6b, 0x3a, 0x6d, 0x8d, 0xe7, 0xfc, 0x7b, 0x4a, 0x76, 0x65, 0xd8, 0xf0, 0xda, 0x31, 0x76, 0xd4, 0xec, 0xe6, 0xe2, 0x6a, 0x2c, 0x58,
+          0x16, 0xbb, 0x60, 0x7a, 0x6f, 0x12, 0xd0, 0x0e, 0x6e, 0x0c, 0xc5, 0xc6, 0xee, 0xee, 0x61, 0xa6, 0xe6, 0xe9, 0x08, 0x75, 0x81, 0x23, 0x16, 0xb5,
+          0x14, 0xd7, 0x70, 0x11, 0x84, 0x24, 0xe6, 0x99, 0x86, 0x5e, 0x5a, 0x2f, 0x4f, 0x4a, 0x69, 0x65, 0x27, 0xe8, 0x3d, 0xfb, 0x96, 0xdc, 0x9e, 0x3a,
+          0xde, 0xde, 0xc3, 0xf1, 0x82, 0xc8, 0xbd, 0xf2, 0xeb, 0x8c, 0x07, 0xfa, 0x21, 0xd7, 0x60, 0x3e, 0x4b, 0x95, 0x3c, 0x98, 0x09, 0xe7, 0x48, 0xff,
+          0x6a, 0x4f, 0xe5, 0x71, 0xd4, 0xd2, 0xdc, 0x96, 0x2d, 0x5f, 0x34, 0xea, 0xbc, 0x55, 0x4c, 0xb8, 0xe3, 0xf2, 0x27, 0x87, 0xe8, 0x6a, 0xc2, 0x0b,
+          0x25, 0xd2, 0xa8, 0xb6, 0xd9, 0x16, 0x46, 0xe6, 0x7b, 0x3c, 0xff, 0xb1, 0x22, 0xb2, 0xe2, 0xc3, 0x85, 0x55, 0x05, 0xe6, 0xf5, 0x94, 0x5e, 0x9f,
+          0x4a, 0xc1, 0x35, 0x6d, 0xaa, 0xe0, 0x3e, 0x6c, 0xd7, 0x37, 0xec, 0x0f, 0xca, 0x20, 0x5d, 0xbd, 0xdf, 0xeb, 0x1a, 0x91, 0xb3, 0x8a, 0x92, 0x17,
+          0x25, 0x74, 0x90, 0x31, 0xfa, 0x93, 0xf7, 0x03, 0xa0, 0x65, 0x60, 0x6d, 0x6b, 0xbb, 0xa0, 0x25, 0xcc, 0x85, 0xac, 0x93, 0x16, 0x36, 0xdd, 0xcc,
+          0x82, 0x0e, 0x95, 0x9a, 0xf9, 0xc9, 0x29, 0x6e, 0xdd, 0x75, 0x99, 0x79, 0x60, 0x59, 0x57, 0xb5, 0x9b, 0x41, 0x24, 0xde, 0x77, 0x19, 0x37, 0x20,
+          0x21, 0x3e, 0xb1, 0x1a, 0xc2, 0xde, 0x1f, 0x6b, 0x45, 0xbf, 0xa1, 0xa8, 0x83, 0xac, 0xa0, 0x42, 0xf1, 0x93, 0xc7, 0x7b, 0x18, 0x09, 0x3a, 0xab,
+          0x9a, 0x98, 0x49, 0x99, 0x02, 0x3f, 0x6c, 0x47, 0xd0, 0xe8, 0x6c, 0xdc, 0xc4, 0xa0, 0x49, 0x25, 0x15, 0x14, 0x38, 0x9c, 0x95, 0x3d, 0xa4, 0x39,
+          0xea, 0x8d, 0x2b, 0x28, 0x5c, 0xd0, 0x82, 0xe6, 0xb6, 0x62, 0xb9, 0x9b, 0xf5, 0x8f, 0x62, 0x6a, 0x3d, 0x63, 0x81, 0x31, 0xef, 0x55, 0xe2, 0xbb,
+          0x9a, 0xee, 0x0f, 0x82, 0xed, 0x21, 0x30, 0x38, 0x48, 0x76, 0x58, 0x7a, 0xfd, 0xdf, 0xf0, 0xe5, 0x41, 0x03, 0x60, 0x58, 0xae, 0xc4, 0x22, 0x33,
+          0x42, 0x1a, 0x11, 0x6b, 0x83, 0x33, 0xbb, 0x64, 0xfa, 0x13, 0x1b, 0x70, 0x72, 0x80, 0x60, 0x7f, 0xf5, 0xca, 0xf3, 0x9d, 0xb2, 0xe1, 0xfa, 0xfc,
+          0x79, 0x8e, 0x13, 0xc7, 0xfd, 0x52, 0x65, 0xa0, 0xa9, 0xa7, 0xfa, 0xcc, 0xe3, 0x67, 0x30, 0xb3, 0x6e, 0xb1, 0xca, 0xc7, 0x17, 0xc5, 0x19, 0xc0,
+          0x7b, 0xc2, 0x5a, 0x04, 0xb0, 0x32, 0x79, 0x66, 0x5c, 0x1d, 0xf3, 0xa8, 0xa2, 0xe8, 0x51, 0x80, 0x53, 0x55, 0xd0, 0x8d, 0x38, 0x96, 0x75, 0xf4,
+          0xb4, 0xae, 0x6f, 0x04, 0x1c, 0x4c, 0xe9, 0xbe, 0x59, 0x2e, 0xc5, 0x0e, 0xd1, 0x45, 0x1e, 0x68, 0xb1, 0xcf, 0x0b, 0xf7, 0x42, 0x9a, 0xce, 0xbe,
+          0x37, 0x82, 0xb1, 0xcc, 0x47, 0xf0, 0xe6, 0xe0, 0x0c, 0x2f, 0x56, 0xd2, 0xf9, 0xaa, 0xf7, 0x6c, 0xaa, 0x56, 0x6e, 0x8d, 0xbc, 0xc0, 0x8e, 0xc8,
+          0xfa, 0xf7, 0x5b, 0xa9, 0xa8, 0x0a, 0xec, 0xa6, 0x20, 0xa6, 0x31, 0x43, 0xf4, 0x7f, 0xfc, 0xb5, 0x3b, 0x86, 0x63, 0xcf, 0x44, 0x06, 0xbf, 0x90,
+          0xd8, 0xf5, 0xcb, 0x34, 0x0a, 0x6c, 0x8b, 0x6c, 0x4a, 0xe0, 0x99, 0x13, 0x69, 0x83, 0x93, 0xca, 0x2f, 0x4a, 0x0e, 0x2e, 0xfa, 0xf7, 0xdd, 0xda,
+          0xc1, 0x0e, 0x28, 0x9e, 0x9c, 0x40, 0x46, 0x52, 0x76, 0x02, 0x14, 0x3e, 0xd3, 0x9d, 0x58, 0xc8, 0xda, 0x29, 0xa7, 0x4a, 0x36, 0xd6, 0x30, 0xaa,
+          0xd4, 0xb4, 0x6d, 0x36, 0xd9, 0x8e, 0x88, 0xe4, 0x02, 0x82, 0xc7, 0x17, 0xf1, 0x38, 0x3f, 0xe9, 0xe4, 0x37, 0x01, 0x3e, 0x6e, 0xad, 0x88, 0x47,
+          0x96, 0xce, 0x18, 0xbc, 0x47, 0x7c, 0x80, 0xc7, 0xa1, 0xa3, 0x8f, 0x60, 0x68, 0x60, 0x04, 0xa6, 0x0a, 0xb6, 0xfa, 0xd7, 0xc1, 0x5d, 0xb3, 0x58,
+          0x78, 0xde, 0xac, 0xe5, 0x07, 0xd4, 0xcd, 0x82, 0xb3, 0x9a, 0xb8, 0x84, 0x9a, 0x40, 0x92, 0xbd, 0x4a, 0x3c, 0x7e, 0x78, 0x0e, 0xd7, 0xcf, 0xfc,
+          0xd5, 0x7d, 0x77, 0x37, 0x05, 0x39, 0x59, 0xd1, 0x17, 0xf3, 0x6a, 0xf1, 0xef, 0x5e, 0x07, 0x33, 0x53, 0x86, 0xef, 0x03, 0x5d, 0x0f, 0x0d, 0xe9,
+          0x69, 0xbd, 0x55, 0xa4, 0x75, 0xbe, 0x19, 0xe9, 0xa2, 0x92, 0xe1, 0x4d, 0x77, 0x7f, 0xe6, 0xc6, 0xbb, 0xd8, 0xed, 0xf5, 0x9a, 0xc3, 0x43, 0x9a,
+          0x50, 0x05, 0x63, 0x81, 0xba, 0xeb, 0x95, 0x5e, 0x42, 0x8b, 0xe8, 0xbf, 0xd0, 0xdd, 0x01, 0x5c, 0xb1, 0xcd, 0x7e, 0x39, 0xf2, 0x02, 0xb2, 0x1b,
+          0xaf, 0xe2, 0x5e, 0x88, 0xb5, 0xeb, 0x73, 0xd5, 0xdb, 0x6c, 0xf3, 0x01, 0xd2, 0xd0, 0xd1, 0x3b, 0x26, 0xbf, 0xec, 0x95, 0xce, 0xab, 0x36, 0x55,
+          0x71, 0xdb, 0x8f, 0x19, 0x78, 0xbc, 0x52, 0x0e, 0xa8, 0x07, 0x6a, 0xbd, 0x79, 0xdf, 0x08, 0xd6, 0x57, 0xfe, 0xa4, 0xea, 0xcb, 0x70, 0xa1, 0x07,
+          0x6d, 0xc3, 0x29, 0x62, 0xca, 0x93, 0xfa, 0xdc, 0x15, 0xf0, 0x38, 0x65, 0xa3, 0xba, 0x63, 0x3d, 0x9c, 0xc9, 0xe8, 0x5d, 0xcf, 0xd9, 0x3a, 0x14,
+          0x67, 0x93, 0x3c, 0x1c, 0x52, 0x2b, 0xe1, 0x9d, 0xce, 0x6e, 0x4a, 0x6a, 0x57, 0x05, 0xff, 0x83, 0x95, 0xa6, 0xac, 0x7a, 0xec, 0x5b, 0xe8, 0xc8,
+          0x09, 0x19, 0xec, 0x44, 0x8e, 0xb6, 0xe8, 0xa6, 0xaa, 0x7c, 0xae, 0x59, 0xc2, 0x3c, 0xbd, 0xa4, 0x1b, 0x52, 0xd7, 0x96, 0xbd, 0x23, 0x09, 0x60,
+          0xcf, 0x98, 0x78, 0xf6, 0x19, 0xb9, 0xd0, 0x67, 0x23, 0x07, 0xd6, 0x76, 0xd8, 0xcb, 0xda, 0x81, 0xc7, 0x9b, 0x50, 0x5c, 0x64, 0xf4, 0x0b, 0xbc,
+          0x2f, 0x8d, 0xf1, 0x4c, 0x25, 0x57, 0xa3, 0x1c, 0x2c, 0x94, 0x5b, 0xaa, 0x5e, 0x36, 0x39, 0x76, 0x8f, 0x7a, 0xde, 0x8f, 0xe0, 0x98, 0x08, 0xd1,
+          0x75, 0x4c, 0xe5, 0x66, 0xaa, 0x41, 0x53, 0xb8, 0x7c, 0x24, 0x60, 0x4a, 0x81, 0xe1, 0x0a, 0xcf, 0xde, 0x89, 0x47, 0x81, 0xb0, 0x37, 0x8a, 0xdb,
+          0xb6, 0x40, 0x78, 0x86, 0xc2, 0xf3, 0x6c, 0x5a, 0x85, 0x28, 0xc8, 0x77, 0xfe, 0xb7, 0x50, 0x83, 0x4f, 0xd0, 0x72, 0x8b, 0x76, 0x05, 0x22, 0xce,
+          0x83, 0x9a, 0xb1, 0xcd, 0xeb, 0xc1, 0x74, 0xa8, 0xf6, 0x0d, 0x50, 0xce, 0x74, 0x6c, 0x5b, 0x8b, 0x5d, 0x8a, 0xff, 0x4a, 0xf9, 0x45, 0x7d, 0x81,
+          0x62, 0xc5, 0x2a, 0x81, 0x57, 0x99, 0x56, 0x2e, 0xc3, 0x0f, 0x4f, 0x06, 0xe9, 0xef, 0x94, 0xab, 0xa1, 0x9e, 0x07, 0x75, 0x81, 0x2c, 0x7c, 0x20,
+          0x57, 0x50, 0x2d, 0xe6, 0xac, 0x47, 0xe6, 0xef, 0xd3, 0xd4, 0xbe, 0xed, 0x01, 0xef, 0xb4, 0xb7, 0x47, 0x7b, 0x04, 0xf2, 0x88, 0x98, 0xb3, 0xcb,
+          0x55, 0xa3, 0xa0, 0xaf, 0x65, 0x44, 0x5b, 0x8b, 0x9a, 0xd1, 0xe6, 0xf2, 0xc8, 0xcc, 0x76, 0x87, 0xbd, 0xc3, 0xe3, 0x0c, 0x68, 0xe6, 0xab, 0x79,
+          0xb0, 0x51, 0x62, 0x08, 0xd7, 0xbe, 0x72, 0x9d, 0xd5, 0xb3, 0xe9, 0x99, 0x8b, 0x58, 0x6e, 0x19, 0xcf, 0xe8, 0x5a, 0xf5, 0x44, 0x8b, 0x4c, 0x99,
+          0xfd, 0x26, 0xe4, 0xd2, 0x63, 0x04, 0x3f, 0xbd, 0x65, 0x60, 0x24, 0x4d, 0xfb, 0xb1, 0x19, 0xb4, 0xae, 0xa4, 0x8d, 0x12, 0xb0, 0x33, 0x2f, 0xd5,
+          0x6e, 0xaf, 0x45, 0xdb, 0x0e, 0x37, 0xe8, 0xaf, 0x87, 0xa3, 0x05, 0x8c, 0xfc, 0xd8, 0xfb, 0xc0, 0xcc, 0x65, 0x33, 0xf4, 0x33, 0xd4, 0xc8, 0xae,
+          0x89, 0x32, 0xcf, 0xb8, 0x98, 0xb7, 0xda, 0x54, 0xa0, 0x77, 0xdd, 0xa5, 0x78, 0x09, 0x5e, 0xcb, 0xea, 0x0d, 0x91, 0xe7, 0xd7, 0x35, 0x58, 0x55,
+          0x49, 0x9f, 0x84, 0x40, 0xbb, 0x7a, 0x1e, 0x1c, 0xe7, 0x57, 0x82, 0x74, 0x55, 0x2f, 0x88, 0x61, 0x1a, 0x36, 0xf5, 0x42, 0x24, 0x16, 0xf9, 0x4a,
+          0x1b, 0xf3, 0x1e, 0x21, 0xc3, 0x93, 0x90, 0x07, 0x2f, 0xe1, 0xd7, 0xaa, 0xa8, 0x58, 0xf9, 0x4d, 0x25, 0xb4, 0xa7, 0xb6, 0x28, 0xe5, 0xb7, 0x1a,
+          0xc6, 0x98, 0xaa, 0xbb, 0x44, 0x6d, 0xee, 0xf7, 0x50, 0x81, 0xe7, 0x1a, 0x13, 0x28, 0x81, 0xb2, 0x88, 0x30, 0xad, 0xbc, 0xf5, 0x69, 0x9e, 0xaf,
+          0xb4, 0xce, 0xf7, 0x74, 0xe1, 0xc2, 0x0d, 0x5e, 0xba, 0xef, 0x6f, 0xe1, 0x9d, 0xe8, 0x42, 0x67, 0xac, 0xef, 0x27, 0x35, 0x28, 0x39, 0xb7, 0xc3,
+          0xa9, 0x94, 0xfc, 0xa3, 0x54, 0x56, 0x19, 0x3f, 0xcd, 0x74, 0x8c, 0x83, 0xf8, 0x3b, 0x22, 0x41, 0x26, 0x1f, 0x00, 0xec, 0x62, 0x6f, 0x1e, 0x1e,
+          0x80, 0x40, 0x97, 0x26, 0x73, 0x1d, 0x2b, 0x6f, 0xb7, 0x5f, 0x71, 0x94, 0x91, 0xc9, 0x0f, 0xb8, 0xce, 0x01, 0x5d, 0xfb, 0xc2, 0xdd, 0x84, 0xe1,
+          0xa1, 0x00, 0x4d, 0x12, 0x16, 0x7e, 0x06, 0xc4, 0x10, 0xbe, 0x46, 0x5d, 0x7a, 0x19, 0x95, 0x68, 0x91, 0x58, 0x7c, 0x33, 0xbb, 0xac, 0x4f, 0xde,
+          0x36, 0x09, 0x95, 0x02, 0xd3, 0x39, 0xd0, 0x48, 0x3a, 0xe1, 0xd3, 0xe7, 0xe5, 0xc0, 0x39, 0xde, 0xc3, 0x8f, 0x48, 0x12, 0xa5, 0xd8, 0x18, 0xa0,
+          0xa4, 0x5a, 0x23, 0xab, 0x57, 0x77, 0xbe, 0x84, 0x2c, 0x9b, 0x48, 0xa3, 0x06, 0x66, 0x32, 0xb4, 0xc9, 0xb2, 0xa1, 0x22, 0xcf, 0xf1, 0x8f, 0x79,
+          0x1a, 0xd2, 0x53, 0x36, 0xfb, 0xfe, 0xdb, 0x2d, 0x0b, 0x93, 0x84, 0xea, 0xef, 0xf8, 0xf5, 0x45, 0xab, 0x77, 0xee, 0x67, 0x3c, 0x5a, 0x3a, 0x01,
+          0x60, 0xb1, 0xb8, 0xc4, 0xd7, 0xe3, 0xc4, 0xde, 0x85, 0x9d, 0x1b, 0x2a, 0x56, 0xd6, 0xb7, 0x3e, 0xeb, 0xc2, 0xd5, 0xf3, 0x9d, 0xfc, 0x13, 0x6b,
+          0xe0, 0xd1, 0x74, 0x6b, 0xaa, 0xe5, 0x54, 0xc1, 0x9a, 0xee, 0x49, 0x75, 0xed, 0x05, 0xba, 0x4a, 0x81, 0x52, 0x8b, 0x17, 0xb7, 0x88, 0xa8, 0x36,
+          0xca, 0x29, 0x0e, 0x31, 0x03, 0xfb, 0xbf, 0xe9, 0x9c, 0x7f, 0x0b, 0x0f, 0x9e, 0x48, 0x56, 0x30, 0xb8, 0xb7, 0x92, 0xa6, 0x9d, 0x7f, 0x0b, 0x97,
+          0xba, 0xd7, 0x64, 0x21, 0x2f, 0xae, 0xf5, 0x8e, 0x49, 0x5a, 0x4e, 0xf4, 0x52, 0xee, 0xbb, 0xe6, 0x99, 0xbe, 0xf0, 0x30, 0xf7, 0x24, 0x15, 0x81,
+          0x80, 0x7a, 0x5e, 0xfa, 0xad, 0xd6, 0x05, 0xaf, 0x17, 0xf8, 0x61, 0xee, 0xec, 0xbb, 0x90, 0x9d, 0x62, 0xd6, 0x19, 0x67, 0xbe, 0xc7, 0xf9, 0x3e,
+          0xfb, 0xa4, 0x3c, 0xd9, 0x09, 0x5d, 0xbb, 0x8c, 0xd8, 0x76, 0x96, 0x17, 0x2d, 0xa4, 0x18, 0xce, 0x75, 0xf9, 0x04, 0x3e, 0xaf, 0xe9, 0x0c, 0x20,
+          0xf0, 0xca, 0x89, 0xd8, 0xfe, 0x4d, 0x53, 0x13, 0x24, 0x42, 0x22, 0x6e, 0x2b, 0x41, 0x85, 0x5f, 0xab, 0x3b, 0xd1, 0x40, 0x62, 0x69, 0x41, 0x9c,
+          0x40, 0x94, 0xca, 0x86, 0x2a, 0xf9, 0x12, 0x88, 0x61, 0x5c, 0x36, 0x10, 0x8f, 0x7c, 0x66, 0x62, 0x74, 0xbd, 0x0a, 0x87, 0x90, 0x94, 0x12, 0x44,
+          0xcc, 0x96, 0x70, 0x53, 0x90, 0x70, 0xc4, 0xec, 0x43, 0x7b, 0x9c, 0x71, 0xcd, 0x6b, 0xff, 0xbb, 0x61, 0xfe, 0x58, 0x03, 0x0b, 0xce, 0xa0, 0x80,
+          0x34, 0x29, 0x3a, 0x1c, 0xbf, 0x41, 0x1a, 0x56, 0xea, 0xd8, 0x4f, 0x53, 0xe5, 0xe0, 0x06, 0xd3, 0xf4, 0xb5, 0x8e, 0x93, 0x17, 0xa2, 0xcf, 0x1d,
+          0xe9, 0x1b, 0x59, 0x8b, 0x82, 0x9e, 0xb2, 0x10, 0x74, 0x7a, 0x6c, 0x54, 0x04, 0x0a, 0x85, 0x8f, 0x00, 0x4a, 0xe2, 0x8f, 0xe6, 0xac, 0x12, 0x07,
+          0x6c, 0xb2, 0x8f, 0x69, 0xab, 0x23, 0x42, 0xca, 0x63, 0xb0, 0xe6, 0x78, 0xc3, 0x79, 0x11, 0x97, 0x25, 0x98, 0x75, 0x7f, 0x10, 0x7e, 0xfe, 0xbb,
+          0xed, 0x96, 0xd1, 0x7e, 0x94, 0x1a, 0xc3, 0x2c, 0x14, 0xce, 0x31, 0x3a, 0xd0, 0x06, 0x07, 0x0d, 0x54, 0x63, 0x8c, 0xb2, 0x9c, 0xee, 0x7d, 0x14,
+          0x2c, 0x03, 0x54, 0xd8, 0xdc, 0x35, 0xeb, 0xd3, 0x2e, 0x12, 0xb0, 0x4b, 0xe1, 0xc1, 0x51, 0x1c, 0x91, 0x9b, 0x9f, 0xbf, 0x1b, 0x3e, 0x4f, 0x23,
+          0xc8, 0xb5, 0xd0, 0xd5, 0xe1, 0x27, 0xb8, 0xdf, 0x85, 0xc3, 0x02, 0x57, 0x1f, 0xeb, 0xf2, 0x76, 0x11, 0xb5, 0x8e, 0x93, 0x1e, 0xeb, 0x03, 0x71,
+          0xc9, 0x45, 0x3b, 0xb0, 0x8c, 0x50, 0xc2, 0x2a, 0xa8, 0xa2, 0xd9, 0x18, 0xb4, 0x13, 0xa3, 0xd1, 0xc2, 0x7f, 0xeb, 0x02, 0x81, 0x94, 0xcc, 0x73,
+          0xe1, 0xe0, 0x7f, 0xbf, 0xf9, 0x29, 0x40, 0xb2, 0xff, 0x73, 0x6a, 0x83, 0xc1, 0x5b, 0xe3, 0x60, 0xe7, 0xc6, 0xf0, 0x15, 0x34, 0x59, 0xcd, 0x3c,
+          0xf4, 0x85, 0xee, 0xe2, 0x86, 0x8c, 0x93, 0xcf, 0xf6, 0x4a, 0x8e, 0x16, 0x0c, 0xac, 0x70, 0xf5, 0xdd, 0xc0, 0x63, 0xea, 0x9e, 0xf0, 0x46, 0xa9,
+          0x40, 0xb9, 0xb8, 0x50, 0x97, 0x88, 0xa4, 0x76, 0x6e, 0xfe, 0xb2, 0x29, 0x74, 0x30, 0x57, 0x0e, 0xad, 0xc9, 0xe4, 0xbe, 0x5f, 0x78, 0x38, 0x2b,
+          0xe6, 0xc0, 0xf0, 0x50, 0x27, 0xb9, 0x44, 0x91, 0x0c, 0x10, 0x47, 0xfe, 0x39, 0x80, 0x9a, 0xfa, 0x39, 0xfe, 0x71, 0x20, 0xfa, 0xc8, 0x0e, 0x2e,
+          0x4d, 0x9c, 0x2d, 0x16, 0x41, 0x35, 0x69, 0xc4, 0x5b, 0xb1, 0x04, 0xe3, 0x95, 0xe9, 0x10, 0x2e, 0xa2, 0xf3, 0xc1, 0xed, 0x3c, 0xab, 0xc5, 0xd9,
+          0x74, 0x80, 0xd1, 0x09, 0x73, 0x9a, 0x19, 0xf0, 0x64, 0x81, 0xfc, 0x99, 0x2b, 0xd6, 0xad, 0x61, 0x61, 0x44, 0xf9, 0xf8, 0x69, 0xbd, 0xd1, 0xc0,
+          0xf2, 0xce, 0xf8, 0x19, 0x5b, 0x85, 0x51, 0xbd, 0xbc, 0xc7, 0xab, 0x3f, 0xfa, 0xa9, 0x17, 0xaf, 0x0f, 0x38, 0x01, 0xfb, 0x0c, 0xac, 0x27, 0x1d,
+          0xfa, 0xe1, 0xc5, 0x95, 0x36, 0x01, 0xcb, 0x19, 0x24, 0x59, 0xc2, 0x56, 0x06, 0x1f, 0x82, 0xc5, 0x9e, 0x46, 0xd7, 0xe8, 0x42, 0x7e, 0x2b, 0x11,
+          0xb5, 0x58, 0xec, 0x00, 0x1e, 0x05, 0x23, 0xb1, 0x65, 0x08, 0x66, 0xb4, 0xf2, 0xd5, 0x31, 0x7b, 0x3e, 0x4e, 0x06, 0x21, 0x7d, 0x24, 0x5a, 0x25,
+          0x07, 0x20, 0x14, 0xfa, 0x5f, 0xe1, 0x4a, 0xda, 0x39, 0x41, 0x38, 0xd4, 0x94, 0x66, 0x9f, 0x35, 0x27, 0x2d, 0xdd, 0x1b, 0xce, 0xfd, 0xe4, 0x12,
+          0x8a, 0xd4, 0x41, 0x1c, 0x20, 0xd6, 0x95, 0x4d, 0x12, 0x2a, 0xa8, 0xd7, 0x2b, 0x1c, 0x69, 0x5b, 0xd3, 0xaf, 0xe5, 0xfa, 0xe4, 0x74, 0xd4, 0x33,
+          0x53, 0x61, 0xa1, 0x7e, 0x4a, 0x87, 0x7e, 0x0d, 0x8b, 0x1c, 0x97, 0x78, 0xa4, 0x7f, 0xf6, 0xe4, 0x4a, 0x59, 0xc8, 0x91, 0x93, 0x85, 0x42, 0x7b,
+          0x91, 0x02, 0xee, 0x99, 0xa3, 0x32, 0xf2, 0x30, 0x87, 0x75, 0x7d, 0xd3, 0x97, 0xb8, 0xce, 0x38, 0x69, 0x51, 0xdf, 0xcf, 0x4e, 0xf2, 0xfe, 0x78,
+          0xc4, 0x79, 0xfb, 0xe5, 0x14, 0x1f, 0x81, 0xa5, 0xe6, 0xee, 0xe4, 0x98, 0x23, 0xdb, 0xbc, 0x0c, 0xdf, 0x64, 0x10, 0xbb, 0x55, 0x58, 0x69, 0x15,
+          0xba, 0x96, 0x63, 0x1f, 0x07, 0x2d, 0xb2, 0x28, 0x32, 0x12, 0xf8, 0xf0, 0xcd, 0x78, 0x50, 0x6b, 0xdf, 0xe3, 0x2b, 0x0a, 0x1f, 0x9f, 0x00, 0xcd,
+          0xa1, 0xb2, 0xa5, 0x89, 0x0c, 0x80, 0xfa, 0x94, 0x1c, 0x79, 0x99, 0x8e, 0x1e, 0x81, 0x4c, 0xba, 0xa8, 0xc2, 0xd8, 0xd1, 0x4f, 0x95, 0x26, 0x48,
+          0x93, 0x1c, 0xda, 0x10, 0x84, 0x61, 0x8f, 0xe3, 0xa4, 0x0d, 0xf0, 0xce, 0x91, 0x38, 0x1e, 0xb1, 0x9a, 0xc4, 0x58, 0x8e, 0x00, 0x30, 0x32, 0x2b,
+          0x52, 0x50, 0x37, 0x19, 0x8d, 0x06, 0xf0, 0x5d, 0xdc, 0xb0, 0xb8, 0xb8, 0xec, 0x60, 0xc2, 0x22, 0x5b, 0xd2, 0x09, 0xa9, 0x52, 0x05, 0xf8, 0xc1,
+          0x13, 0x1d, 0x1a, 0xe7, 0xba, 0x7a, 0x4e, 0x6f, 0x4f, 0xf7, 0xca, 0xb9, 0xd4, 0x5a, 0x08, 0xd9, 0x55, 0xed, 0x9f, 0xde, 0x09, 0x9d, 0xd8, 0x47,
+          0xe2, 0xad, 0x08, 0xb1, 0xf0, 0x56, 0xe7, 0x48, 0x64, 0x0e, 0x6e, 0x26, 0x51, 0xee, 0x5b, 0xd7, 0xf8, 0xad, 0xf4, 0x83, 0x95, 0x83, 0x53, 0xa5,
+          0xd8, 0x5a, 0x98, 0x73, 0x52, 0x76, 0xd2, 0xae, 0x05, 0xec, 0x9b, 0xe4, 0xd9, 0x36, 0x7e, 0x34, 0x92, 0x8f, 0xc5, 0x84, 0x25, 0x0a, 0xcf, 0xd7,
+          0x18, 0xdf, 0x9f, 0xa2, 0xa9, 0x3d, 0xc5, 0x56, 0xa1, 0x22, 0x35, 0x16, 0x2b, 0x8f, 0x82, 0xa2, 0x6d, 0x62, 0x5e, 0xe4, 0x69, 0xa5, 0x1e, 0x3b,
+          0x0f, 0x06, 0x55, 0x2f, 0x2b, 0x8b, 0xe8, 0x0a, 0x90, 0xc6, 0x5c, 0xd4, 0xe7, 0x06, 0x3e, 0x88, 0xb9, 0x14, 0x3e, 0x61, 0xd5, 0x82, 0x3f, 0xb8,
+          0x07, 0x70, 0x82, 0x07, 0x08, 0x86, 0xbf, 0x9e, 0x8c, 0x09, 0x98, 0xd5, 0x05, 0xfe, 0x0b, 0x7d, 0x70, 0x29, 0x5d, 0xc1, 0xd9, 0xb0, 0x93, 0xf2,
+          0x1b, 0x53, 0x29, 0x4d, 0x4e, 0x51, 0x17, 0xee, 0x71, 0x65, 0x8b, 0x25, 0x12, 0xda, 0xbc, 0xd2, 0xb1, 0x5d, 0x40, 0x3c, 0xc4, 0xfa, 0x40, 0xe4,
+          0x41, 0x8f, 0x6d, 0xf6, 0x2b, 0x86, 0xb4, 0x0c, 0xf1, 0x53, 0xd5, 0xe3, 0xb0, 0xe3, 0x04, 0x02, 0x66, 0xa8, 0x70, 0xfc, 0x48, 0x1c, 0xf8, 0x35,
+          0x6f, 0xd1, 0xff, 0x0d, 0xa6, 0x43, 0xe2, 0xf2, 0xf5, 0x36, 0xcf, 0x94, 0xa6, 0x2c, 0xf3, 0x04, 0x17, 0x4f, 0xa6, 0x3f, 0xa4, 0xdd, 0x0f, 0xdd,
+          0xb9, 0xe2, 0x28, 0x07, 0x42, 0x61, 0x6d, 0x2e, 0x64, 0x73, 0x68, 0x13, 0xab, 0x46, 0x33, 0x37, 0xd3, 0x6c, 0x9c, 0xd5, 0x8e, 0x20, 0xf5, 0x44,
+          0xb5, 0xcd, 0x5c, 0x64, 0x2b, 0x2f, 0x11, 0xa3, 0x6a, 0xf4, 0xff, 0x0b, 0x25, 0x9a, 0xcb, 0xfd, 0xff, 0x85, 0x6c, 0xec, 0xc4, 0x24, 0x42, 0x3c,
+          0x7f, 0x86, 0x95, 0xac, 0x0c, 0xd7, 0x2f, 0xaf, 0xcc, 0xcb, 0xcb, 0x69, 0xa3, 0xd3, 0xdf, 0x3e, 0x6b, 0x46, 0x7b, 0x70, 0x88, 0x98, 0x13, 0xa6,
+          0x92, 0x93, 0xc7, 0xd8, 0xa7, 0x07, 0x1b, 0xe2, 0xa5, 0xe2, 0xb1, 0x55, 0xa3, 0x0d, 0xc3, 0xca, 0xc2, 0x53, 0x47, 0xc0, 0x78, 0xe4, 0x0d, 0xa7,
+          0x14, 0x27, 0x98, 0x37, 0x4a, 0x9d, 0x64, 0x2f, 0xb4, 0xf1, 0x4c, 0x4a, 0xc6, 0x01, 0xdf, 0x16, 0xed, 0xf7, 0x5d, 0x93, 0x9f, 0xbb, 0xa0, 0xf5,
+          0x64, 0x00, 0x44, 0x44, 0xef, 0x8d, 0xdd, 0x72, 0xd9, 0xf7, 0xb6, 0x5e, 0x44, 0x5c, 0xdd, 0x22, 0xe5, 0x82, 0xa0, 0x5d, 0xc1, 0x19, 0x71, 0x7d,
+          0x88, 0xec, 0x97, 0x33, 0xc7, 0xb6, 0xa3, 0xc7, 0x79, 0x78, 0xbc, 0x1e, 0x56, 0x52, 0x37, 0x23, 0x03, 0x0a, 0xbb, 0xfc, 0x3d, 0x5f, 0x2c, 0x23,
+          0xa0, 0x24, 0xe7, 0xcf, 0x92, 0xe1, 0x91, 0x15, 0xef, 0x4d, 0xd6, 0x67, 0x49, 0x27, 0x15, 0x4f, 0xa4, 0x16, 0x37, 0x44, 0x58, 0x83, 0xae, 0x28,
+          0x0a, 0xbd, 0x71, 0xbe, 0xbc, 0x30, 0xea, 0xcb, 0x23, 0xb9, 0x1e, 0xf9, 0xea, 0x91, 0x74, 0x4e, 0x90, 0x46, 0x32, 0x32, 0xe6, 0x5b, 0xb8, 0xf0,
+          0x34, 0x19, 0xc6, 0x95, 0x73, 0xe3, 0xca, 0x09, 0xcb, 0x77, 0x0a, 0x18, 0x32, 0xdd, 0x95, 0xc4, 0x5d, 0x41, 0x51, 0xbd, 0x4a, 0xa0, 0x2c, 0xac,
+          0x57, 0x36, 0xb7, 0x22, 0xf5, 0x24, 0x58, 0x87, 0x6b, 0xaf, 0xe1, 0x3d, 0x01, 0x99, 0xe5, 0x81, 0xb7, 0xb4, 0x2f, 0x6d, 0xb4, 0x4a, 0x3e, 0xf8,
+          0xea, 0x63, 0x5c, 0xca, 0xbc, 0xb6, 0x8d, 0xb5, 0x86, 0x9c, 0xcf, 0xb6, 0x49, 0xa6, 0x7a, 0x9d, 0x91, 0xbd, 0x4a, 0x6f, 0xe8, 0x0c, 0xa9, 0x0f,
+          0x08, 0x47, 0x91, 0x78, 0xed, 0xa0, 0x7a, 0xcf, 0x48, 0x56, 0x49, 0x1a, 0x58, 0x64, 0x05, 0x52, 0xa6, 0x8e, 0x75, 0x1c, 0x7f, 0xd8, 0xb4, 0x59,
+          0x44, 0xbe, 0x53, 0x4a, 0xa7, 0x7b, 0x8c, 0xea, 0x86, 0xd9, 0x46, 0x32, 0x5f, 0xd8, 0xd8, 0x4e, 0xef, 0x08, 0xb3, 0x03, 0xcb, 0xe2, 0xc1, 0xdf,
+          0x2e, 0xba, 0xb5, 0x43, 0xf3, 0x34, 0xb0, 0x82, 0x0f, 0xd2, 0x61, 0xa9, 0x71, 0x59, 0x85, 0x58, 0xb7, 0x1b, 0xc8, 0xcd, 0x33, 0x45, 0xea, 0xdc,
+          0x7e, 0x6a, 0x40, 0xb6, 0x1a, 0xe2, 0x50, 0xdd, 0xff, 0xf1, 0xf2, 0xbb, 0x29, 0xaf, 0x2c, 0xf2, 0xb7, 0xb0, 0x87, 0x36, 0x03, 0x50, 0x41, 0x61,
+          0xb7, 0x60, 0x4e, 0x75, 0xc6, 0x11, 0xb5, 0x7c, 0xb9, 0xa9, 0xca, 0x6e, 0x97, 0x64, 0xb7, 0x83, 0xf1, 0xdd, 0x3e, 0x1a, 0x21, 0x15, 0xd2, 0x0d,
+          0xaa, 0x61, 0xa7, 0xcd, 0x83, 0x0a, 0xd8, 0xeb, 0xd3, 0xb6, 0x7f, 0xec, 0x4d, 0x5b, 0xad, 0x80, 0xdc, 0x4b, 0x2b, 0xab, 0x1d, 0x42, 0xc2, 0x7a,
+          0x29, 0x28, 0xd6, 0x62, 0xdc, 0xff, 0x2b, 0xba, 0xf1, 0xb4, 0x3b, 0x9b, 0xe1, 0xfa, 0x06, 0x28, 0x30, 0x9d, 0xb1, 0xb5, 0x52, 0xea, 0xcf, 0x6f,
+          0x35, 0x43, 0x1b, 0xb4, 0x1f, 0x66, 0x6d, 0x2e, 0x10, 0x44, 0x12, 0xe4, 0xe5, 0xde, 0x5d, 0x21, 0x8f, 0x70, 0x05, 0x08, 0x4f, 0x7c, 0xd2, 0x97,
+          0x10, 0x41, 0xb0, 0x3a, 0x68, 0x55, 0xf1, 0xc2, 0x7a, 0x29, 0xc4, 0xf0, 0x20, 0x43, 0xc0, 0x5e, 0x68, 0x72, 0x4d, 0x23, 0x22, 0x18, 0xb7, 0x10,
+          0x2c, 0x15, 0x04, 0x83, 0x84, 0x7d, 0x6e, 0x32, 0x87, 0xe3, 0xe9, 0xa1, 0x03, 0xfc, 0x9f, 0xa6, 0x1d, 0x93, 0x11, 0x40, 0x3e, 0xc0, 0x2d, 0x0e,
+          0x4f, 0x85, 0xa7, 0x1d, 0x8b, 0x10, 0xb8, 0x4a, 0x45, 0x94, 0xe3, 0x8d, 0x02, 0x10, 0x68, 0xf2, 0x0f, 0x26, 0x3b, 0x70, 0xf7, 0x43, 0x4d, 0xd2,
+          0x41, 0x6c, 0x77, 0x1f, 0x71, 0xc1, 0x0c, 0xa4, 0x68, 0x23, 0x60, 0xf7, 0x92, 0x5a, 0x6f, 0xde, 0x26, 0xef, 0x8c, 0x1a, 0x57, 0x85, 0x0d, 0x33,
+          0x3d, 0xf9, 0xe4, 0x27, 0xf1, 0x5d, 0x3a, 0xf8, 0x39, 0x10, 0x77, 0xd7, 0xa6, 0x12, 0x29, 0x74, 0x16, 0xed, 0x7f, 0xec, 0x86, 0xaa, 0x13, 0x29,
+          0x1b, 0xb0, 0x3f, 0xee, 0xbe, 0x7c, 0x7f, 0x18, 0x2c, 0xfa, 0x00, 0xe6, 0x7e, 0xa0, 0x53, 0xb0, 0xd8, 0x9d, 0x41, 0x6a, 0x08, 0xdf, 0x6b, 0x62,
+          0x5c, 0xbb, 0x9c, 0xe5, 0xf5, 0x70, 0xf0, 0x79, 0x3e, 0x40, 0xe8, 0xa6, 0xfb, 0x54, 0x7d, 0x17, 0x16, 0x26, 0xd7, 0xb1, 0x39, 0xe6, 0x04, 0x64,
+          0x21, 0xab, 0x42, 0x76, 0x52, 0xeb, 0x21, 0xb8, 0x94, 0xba, 0xbd, 0x69, 0x33, 0x9c, 0x05, 0x3a, 0xb6, 0x4f, 0x4b, 0x2d, 0x69, 0x2b, 0xae, 0x07,
+          0xdb, 0x0d, 0xfb, 0xce, 0xba, 0x98, 0x8f, 0xec, 0x7e, 0x21, 0xd7, 0x22, 0x62, 0xa5, 0xdb, 0x36, 0x79, 0x42, 0x1a, 0x4d, 0x35, 0xe3, 0x37, 0xba,
+          0xf9, 0x85, 0x9b, 0x24, 0xc6, 0xb8, 0xbb, 0xe0, 0xdc, 0xff, 0x27, 0xfc, 0x40, 0x0c, 0x92, 0x93, 0x62, 0x74, 0xec, 0x58, 0x50, 0xa2, 0x3a, 0xae,
+          0xfd, 0x50, 0x1a, 0x5f, 0x14, 0x8b, 0x09, 0xad, 0x2e, 0x8e, 0x34, 0xa1, 0x47, 0x54, 0x0d, 0x2c, 0xbf, 0x2b, 0xbf, 0x0b, 0x3d, 0x07, 0x25, 0x6a,
+          0xdb, 0xab, 0xfd, 0xdf, 0x1c, 0xe8, 0xcf, 0x2d, 0xfb, 0xbf, 0x40, 0xed, 0xcf, 0xdc, 0x10, 0xcb, 0x1b, 0xf6, 0x18, 0x82, 0xe1, 0xe2, 0x21, 0x23,
+          0x51, 0xdb, 0xf3, 0xdb, 0x08, 0x23, 0x40, 0xd5, 0xf9, 0x0c, 0x1c, 0x6f, 0x93, 0x76, 0xf1, 0x99, 0x90, 0xda, 0x93, 0x23, 0x7c, 0x42, 0x98, 0xb2,
+          0x5d, 0xd0, 0x98, 0xe3, 0x6e, 0xf0, 0xdb, 0x24, 0x07, 0x6d, 0x04, 0x64, 0xd2, 0xed, 0xed, 0x62, 0x16, 0x1b, 0xa3, 0x0c, 0xdd, 0x07, 0xa1, 0x1e,
+          0x72, 0xfa, 0x63, 0x5a, 0x8e, 0xcd, 0x67, 0x7f, 0xd8, 0x77, 0x8e, 0x34, 0x1c, 0x62, 0x54, 0x95, 0x66, 0xdc, 0xc6, 0x11, 0x06, 0xf2, 0x6b, 0x03,
+          0x7a, 0x2f, 0x2a, 0x29, 0xc2, 0x97, 0xd1, 0x2a, 0x5f, 0x01, 0x8e, 0xe9, 0x3c, 0x38, 0x38, 0x61, 0x73, 0xfe, 0x33, 0x9d, 0x41, 0x9e, 0x14, 0xe3,
+          0xaf, 0x7b, 0xaa, 0xd4, 0x9d, 0x02, 0xc1, 0x06, 0x9a, 0x5b, 0xb5, 0x6b, 0x9d, 0x87, 0x3a, 0x1d, 0x9b, 0xfc, 0xf9, 0x92, 0x8f, 0x33, 0xfb, 0x0e,
+          0xb1, 0x1e, 0x3e, 0x87, 0x7c, 0x49, 0x66, 0xe7, 0x1f, 0x71, 0xc0, 0x3c, 0x0e, 0x5b, 0xe5, 0x0a, 0xb4, 0xec, 0xe2, 0x80, 0xc3, 0x4a, 0x67, 0xed,
+          0xdf, 0x12, 0xd8, 0xe4, 0x02, 0xb5, 0x7d, 0x82, 0xfa, 0xb6, 0x3c, 0x25, 0xd2, 0xa6, 0x6d, 0x33, 0xac, 0xfb, 0x70, 0x81, 0x93, 0xc9, 0x41, 0xe9,
+          0xa3, 0xd3, 0xb6, 0xbe, 0xbd, 0x27, 0x6c, 0x38, 0xbb, 0xd2, 0x1c, 0xce, 0x5a, 0x4f, 0x24, 0xb3, 0x63, 0x26, 0x5d, 0xc3, 0x16, 0x61, 0x4e, 0x18,
+          0x2f, 0x85, 0xda, 0x60, 0xbe, 0xa7, 0x9e, 0x73, 0x8c, 0x1d, 0xcc, 0xdc, 0x8a, 0x09, 0xaf, 0xf7, 0x19, 0xa2, 0x9c, 0xbf, 0x53, 0x5b, 0x9f, 0x6a,
+          0x8e, 0x19, 0x3e, 0x8e, 0x0f, 0xca, 0x2f, 0xac, 0xb5, 0x5f, 0xa8, 0x49, 0x35, 0x61, 0xeb, 0x72, 0x1d, 0xe7, 0x2d, 0x1b, 0x25, 0x4b, 0x8a, 0xac,
+          0x25, 0x66, 0x50, 0xb8, 0x52, 0xf3, 0x79, 0x81, 0x26, 0x10, 0xd0, 0x8d, 0xe4, 0x5a, 0x52, 0x9b, 0x3e, 0xf1, 0xc4, 0x5b, 0x30, 0xc3, 0x27, 0xd3,
+          0x05, 0xfd, 0xad, 0x87, 0x91, 0xa2, 0xff, 0x4e, 0xde, 0xa1, 0x87, 0x0e, 0x00, 0x47, 0x54, 0x6b, 0xb4, 0x7a, 0x77, 0x92, 0x46, 0x12, 0x15, 0x24,
+          0xcf, 0xf3, 0x34, 0xd1, 0x56, 0x22, 0xda, 0xee, 0xf4, 0x80, 0x7c, 0xda, 0x2e, 0x82, 0xbd, 0x92, 0x59, 0x1c, 0x5e, 0xdb, 0x3b, 0xbc, 0x02, 0x90,
+          0x36, 0x9c, 0x48, 0xcd, 0xcb, 0x9f, 0xed, 0x89, 0x06, 0x8e, 0x23, 0x62, 0x72, 0x5b, 0x27, 0xb1, 0x55, 0x13, 0x2f, 0x5f, 0xe6, 0xf3, 0xc1, 0x04,
+          0x68, 0x3c, 0xef, 0x0d, 0xa6, 0xf1, 0x95, 0x20, 0xf8, 0xcc, 0x43, 0x04, 0x1e, 0xb3, 0x20, 0x96, 0x6a, 0x62, 0x9d, 0x9a, 0xe2, 0x1a, 0x4d, 0xaa,
+          0x72, 0xac, 0x36, 0x94, 0x6e, 0xad, 0xf0, 0x3f, 0x60, 0x8b, 0xc4, 0x2b, 0x1f, 0x79, 0x28, 0x28, 0xa4, 0xf2, 0x05, 0x95, 0x8c, 0x85, 0xdf, 0xca,
+          0xf8, 0xdc, 0x9a, 0x14, 0xa3, 0xc3, 0x03, 0xbb, 0x27, 0x12, 0x1d, 0x45, 0x6c, 0xe2, 0x45, 0xde, 0x61, 0x77, 0x12, 0xcf, 0x9c, 0x59, 0x1b, 0xc4,
+          0x0a, 0xa7, 0x9c, 0x4b, 0x27, 0x46, 0x70, 0xe2, 0xc3, 0xe6, 0x5e, 0x50, 0xbe, 0x30, 0xa5, 0x13, 0x71, 0xfa, 0x4e, 0xf0, 0xcd, 0x73, 0x8c, 0xf0,
+          0x29, 0xb1, 0xfc, 0x93, 0x4f, 0xfa, 0x00, 0xc6, 0xe8, 0x1f, 0x84, 0x2a, 0x5d, 0x82, 0x05, 0xe2, 0x8a, 0x33, 0xfb, 0x62, 0xde, 0xda, 0xe4, 0x1a,
+          0x1f, 0xf5, 0x0e, 0x91, 0xe3, 0xdf, 0x4e, 0x95, 0xe9, 0x2b, 0x53, 0xbf, 0xc8, 0x9d, 0x3d, 0x5a, 0xc9, 0x1e, 0xb6, 0x85, 0x05, 0x74, 0xb7, 0x79,
+          0x4a, 0x11, 0x83, 0xd6, 0xb1, 0xfd, 0x4d, 0x69, 0x82, 0x3c, 0x90, 0x61, 0xb0, 0x9c, 0xae, 0xf4, 0xb2, 0xbd, 0xfb, 0x63, 0xac, 0xd9, 0x2b, 0x76,
+          0xe9, 0x99, 0x08, 0x69, 0x37, 0x5d, 0x8e, 0x75, 0x0e, 0x10, 0x11, 0x10, 0x59, 0xa0, 0x39, 0x21, 0x31, 0xa4, 0x69, 0x77, 0x81, 0xd0, 0x35, 0x3e,
+          0xb1, 0x5b, 0x3a, 0xca, 0x7e, 0x86, 0x48, 0x52, 0xd3, 0x73, 0x80, 0xe4, 0xa4, 0xf6, 0x96, 0xd8, 0x94, 0xae, 0x91, 0x9b, 0xea, 0xca, 0xb4, 0x41,
+          0x30, 0x98, 0x21, 0x78, 0x04, 0x78, 0xa3, 0x75, 0x87, 0xf9, 0x0d, 0x54, 0x28, 0x56, 0xd7, 0x5c, 0xbf, 0x59, 0xf4, 0x25, 0xc7, 0x8b, 0x9d, 0xe9,
+          0xac, 0xcb, 0x5b, 0xba, 0x86, 0x00, 0xb3, 0x2a, 0x1c, 0x27, 0xb7, 0x6f, 0x11, 0x99, 0x81, 0xdd, 0x69, 0x41, 0xbc, 0x30, 0x32, 0xc1, 0xad, 0xef,
+          0x4d, 0x75, 0xf6, 0xb5, 0x7f, 0x71, 0x9b, 0xf5, 0x6c, 0xd9, 0xb5, 0xad, 0xe5, 0xb9, 0xda, 0xb6, 0xee, 0x18, 0x7e, 0x51, 0xcc, 0xb7, 0x3d, 0x2c,
+          0x64, 0x47, 0x95, 0xbe, 0x0c, 0x87, 0x27, 0xe4, 0xd6, 0x78, 0x7c, 0xbc, 0x7a, 0x22, 0xd7, 0xb1, 0xb3, 0x50, 0xa6, 0x8e, 0xea, 0x65, 0x56, 0xfe,
+          0x37, 0x2e, 0x59, 0x99, 0x4c, 0x40, 0x3c, 0x8f, 0xd1, 0xe5, 0x13, 0x39, 0xbf, 0x57, 0x57, 0x94, 0xed, 0x8e, 0x81, 0x34, 0x1a, 0x9c, 0x35, 0x03,
+          0x94, 0x65, 0x13, 0x53, 0x21, 0xe2, 0x28, 0x72, 0x4c, 0xa5, 0x7d, 0xd5, 0x8e, 0xf2, 0xa7, 0xdb, 0xe2, 0x4f, 0xa8, 0x5d, 0xa2, 0x4c, 0xb1, 0x83,
+          0xe6, 0xae, 0x6a, 0x36, 0xb9, 0xa2, 0xca, 0x88, 0x24, 0x0c, 0x2a, 0xa9, 0xa4, 0x22, 0xca, 0x88, 0x18, 0x42, 0x13, 0x6b, 0xb1, 0xae, 0x3d, 0x1c,
+          0xa7, 0xd9, 0xf2, 0x73, 0xa8, 0x26, 0x2a, 0xe6, 0x4b, 0x9b, 0x42, 0xe5, 0x7d, 0xcb, 0x7d, 0x38, 0x2c, 0xd2, 0x2a, 0x50, 0xff, 0x9b, 0x8a, 0x2f,
+          0x47, 0xc9, 0xb6, 0xf3, 0x06, 0x47, 0xdf, 0x36, 0x6f, 0x15, 0xd0, 0x11, 0x53, 0xd6, 0x25, 0x56, 0x74, 0x4b, 0x77, 0x5b, 0xcd, 0xc5, 0x51, 0x00,
+          0x9a, 0xc6, 0x64, 0x0c, 0xa7, 0xf6, 0xb7, 0x41, 0xb6, 0x4c, 0xad, 0xac, 0xfb, 0x31, 0xe9, 0x36, 0x50, 0xfc, 0x68, 0x56, 0x7c, 0xdc, 0xf0, 0x58,
+          0x69, 0xca, 0xdd, 0x4f, 0xe5, 0xc5, 0xf9, 0x5e, 0x95, 0x06, 0x62, 0x25, 0x7d, 0x33, 0x7f, 0x1b, 0x5d, 0x76, 0x4c, 0x53, 0x77, 0xf8, 0xd6, 0x68,
+          0x19, 0x1a, 0x92, 0xa4, 0xbd, 0xfe, 0xf7, 0xe5, 0xda, 0x2f, 0x82, 0xd1, 0x51, 0x40, 0x98, 0x8e, 0x5f, 0x2e, 0x13, 0xda, 0x79, 0x55, 0x7c, 0x21,
+          0x88, 0x02, 0x9f, 0xd8, 0x3d, 0x68, 0xbc, 0xd9, 0x70, 0x47, 0x11, 0x65, 0x37, 0x61, 0x22, 0xc3, 0x60, 0xd9, 0x45, 0x06, 0xa2, 0x59, 0xd8, 0xa9,
+          0x3b, 0xad, 0xb1, 0xc6, 0x6a, 0xa3, 0x36, 0x02, 0x4a, 0x87, 0x66, 0xd2, 0x09, 0xbf, 0x47, 0x65, 0x09, 0x35, 0x11, 0xea, 0x36, 0xa4, 0xf0, 0x68,
+          0xed, 0x90, 0xd7, 0x3d, 0x9b, 0xfe, 0x20, 0x34, 0x41, 0xd3, 0x42, 0x1d, 0xcd, 0xb2, 0x03, 0x54, 0x6c, 0x0a, 0x51, 0x0b, 0xce, 0x3f, 0xa7, 0x2c,
+          0x5e, 0x8d, 0x94, 0x09, 0x1a, 0x5c, 0x0c, 0x86, 0x15, 0x1a, 0xd7, 0x35, 0xaf, 0x36, 0x7f, 0xa2, 0xbb, 0x2b, 0xc6, 0x74, 0x5d, 0xae, 0x52, 0xd2,
+          0x4d, 0x01, 0x15, 0xad, 0xf6, 0xb4, 0xee, 0x61, 0x6d, 0x28, 0xdb, 0xbd, 0xed, 0x80, 0xc3, 0x8b, 0x31, 0x3b, 0x9b, 0x1e, 0x3f, 0xbd, 0x4c, 0xd6,
+          0x74, 0x73, 0x16, 0xfa, 0x74, 0x99, 0xf3, 0xe7, 0xe5, 0x06, 0x32, 0x10, 0xdb, 0x91, 0x46, 0xd7, 0x4d, 0x9c, 0xbb, 0x3c, 0x0e, 0x8d, 0x4c, 0x12,
+          0x66, 0x2b, 0x68, 0x54, 0x1a, 0x84, 0xe1, 0x47, 0xf7, 0x28, 0xad, 0x6b, 0x62, 0x34, 0xbb, 0x7d, 0x25, 0x67, 0x10, 0x77, 0x80, 0x06, 0x1b, 0x46,
+          0x78, 0xb9, 0x62, 0x8e, 0x37, 0xd7, 0xbb, 0xaa, 0x4a, 0xdb, 0x1b, 0x0e, 0xfe, 0xf0, 0x4b, 0xf9, 0x31, 0x16, 0x12, 0xe5, 0x30, 0x54, 0x05, 0x75,
+          0xcd, 0x74, 0xb4, 0x8d, 0x82, 0x82, 0x97, 0xda, 0x85, 0x98, 0xea, 0x77, 0x76, 0xaf, 0xe8, 0x8f, 0xa3, 0x36, 0x9d, 0x7a, 0xd6, 0x19, 0xc7, 0x5b,
+          0x09, 0x41, 0xd0, 0x06, 0xb4, 0xb2, 0x24, 0x75, 0x0d, 0x48, 0xed, 0x7d, 0x9a, 0x1f, 0x72, 0x2d, 0xad, 0xd8, 0x5c, 0xcd, 0x59, 0xa9, 0x5d, 0xf3,
+          0xf5, 0xd2, 0xba, 0xb8, 0x5b, 0x38, 0x65, 0x4d, 0x9a, 0x17, 0x24, 0xc1, 0xc2, 0xd3, 0x91, 0xcb, 0x2c, 0xe9, 0x70, 0xd2, 0xa7, 0x9e, 0x94, 0x5a,
+          0xf7, 0x6c, 0x9d, 0x68, 0x70, 0xde, 0xbc, 0xd7, 0x9e, 0x36, 0xcf, 0xca, 0x4d, 0x41, 0x57, 0xd8, 0x62, 0xe9, 0x48, 0x49, 0x3b, 0x81, 0xee, 0x60,
+          0x2e, 0x78, 0x13, 0x3d, 0xee, 0xc5, 0x35, 0x56, 0x37, 0xc8, 0x09, 0x6f, 0x64, 0xcc, 0x7f, 0x10, 0x34, 0xd4, 0x85, 0x0d, 0xa9, 0xcf, 0x82, 0x02,
+          0x1c, 0xd4, 0x76, 0xec, 0x04, 0x66, 0x2d, 0x44, 0x89, 0xfe, 0x35, 0x31, 0x7b, 0x01, 0x52, 0xe2, 0x05, 0x25, 0xb3, 0xbd, 0xcc, 0x4f, 0xc0, 0x2a,
+          0xe8, 0x63, 0xf6, 0x9b, 0x06, 0x2c, 0x56, 0xec, 0x29, 0xf9, 0xda, 0xd3, 0xf6, 0x41, 0x21, 0x1b, 0xb2, 0x20, 0xbd, 0x28, 0xe6, 0xa1, 0x4e, 0x4d,
+          0x2f, 0x6e, 0x42, 0x2a, 0x2f, 0x19, 0x39, 0x29, 0x53, 0x91, 0x59, 0xe2, 0xee, 0xb1, 0x9a, 0xa5, 0x0b, 0x16, 0xf9, 0x40, 0x5a, 0xb0, 0x53, 0x20,
+          0x83, 0x8c, 0x47, 0x1c, 0x0d, 0xcd, 0x3f, 0x9f, 0xf0, 0x27, 0x90, 0x22, 0x77, 0x1b, 0x62, 0x23, 0x84, 0x39, 0xfc, 0xf2, 0x98, 0x11, 0xb5, 0x80,
+          0x3d, 0x7e, 0xbc, 0x97, 0x9e, 0x54, 0xaa, 0x28, 0xba, 0xd8, 0x3f, 0xb6, 0x99, 0xf2, 0x14, 0x99, 0xd5, 0xf0, 0x47, 0x8c, 0x82, 0xd6, 0xb9, 0xdc,
+          0x05, 0x86, 0x77, 0xf1, 0xd0, 0x9e, 0x10, 0x49, 0x1c, 0x45, 0x4c, 0xc9, 0xe6, 0x9b, 0x56, 0xe0, 0x6d, 0x24, 0xb5, 0x46, 0xc8, 0x5b, 0x36, 0x80,
+          0x8b, 0xaa, 0xd5, 0xcd, 0x31, 0xd7, 0x0a, 0x25, 0x22, 0xee, 0x07, 0x9b, 0x8d, 0xe8, 0x16, 0xec, 0x43, 0x63, 0xf4, 0xd9, 0x5c, 0x73, 0x10, 0x1e,
+          0x42, 0x8f, 0x1d, 0xf7, 0xe9, 0x36, 0x11, 0x3b, 0x10, 0x9b, 0xc2, 0xa7, 0x7c, 0xe3, 0x1f, 0x5e, 0x82, 0xf0, 0xd9, 0x47, 0xc1, 0x5f, 0xf2, 0xf6,
+          0xcb, 0x02, 0x7a, 0x9b, 0x70, 0x92, 0x3a, 0x5e, 0xef, 0x25, 0x6e, 0x59, 0xd1, 0x8d, 0x98, 0xaf, 0x36, 0x9d, 0xac, 0x4f, 0xca, 0x2c, 0x3d, 0x4e,
+          0xfa, 0x79, 0x4f, 0x32, 0x47, 0x98, 0xfa, 0xd7, 0x17, 0x38, 0xa1, 0x69, 0xe7, 0x5e, 0x23, 0x5c, 0xa6, 0xc3, 0x52, 0xbc, 0x5c, 0x64, 0xaa, 0x0c,
+          0x47, 0x99, 0x1a, 0x0b, 0x7f, 0x22, 0x0e, 0x0b, 0x42, 0xd6, 0x0f, 0xb0, 0x7c, 0xc1, 0x2a, 0xd3, 0x7f, 0x54, 0x73, 0x70, 0xfb, 0x02, 0x2b, 0x87,
+          0xa2, 0x8e, 0x43, 0xca, 0x67, 0x7c, 0xd3, 0x21, 0x0c, 0x75, 0xb2, 0xa3, 0xb4, 0x73, 0xd8, 0x12, 0x80, 0xc8, 0x9b, 0xec, 0xbe, 0x49, 0x52, 0x07,
+          0x25, 0x63, 0x44, 0x54, 0x97, 0x3c, 0x9f, 0xf3, 0x19, 0x56, 0xcb, 0x0a, 0x33, 0xa1, 0xa8, 0xcd, 0x00, 0xcf, 0xc2, 0xe5, 0x8a, 0xf1, 0x25, 0x1f,
+          0x1c, 0xb2, 0xc5, 0x98, 0x0f, 0x82, 0x9b, 0xca, 0x82, 0x2a, 0x6e, 0xa8, 0x0d, 0xe3, 0xc4, 0xf7, 0x7e, 0x1b, 0x72, 0xd6, 0x53, 0xad, 0xd2, 0x41,
+          0x84, 0x09, 0xef, 0x42, 0xc6, 0xe1, 0xf9, 0xf6, 0xa8, 0xd4, 0x9d, 0xcf, 0x25, 0xfa, 0xb8, 0x8f, 0x9e, 0x68, 0xcb, 0xdc, 0xb2, 0x21, 0x57, 0xed,
+          0xd7, 0xe2, 0xae, 0x30, 0x1a, 0x85, 0x5f, 0x0b, 0x60, 0xa7, 0xd6, 0x7e, 0xe7, 0x3c, 0xcf, 0x08, 0xb3, 0xfe, 0x24, 0x70, 0x91, 0x4f, 0x7d, 0xc2,
+          0x69, 0x9d, 0x77, 0x58, 0xb5, 0xeb, 0x1d, 0xeb, 0x15, 0x13, 0x2c, 0xd2, 0xd0, 0xc9, 0x06, 0x74, 0x97, 0x9c, 0x87, 0x5f, 0x40, 0x1d, 0x66, 0x2d,
+          0x74, 0xbf, 0x6f, 0xc6, 0x69, 0x80, 0x92, 0x6a, 0x4e, 0xfa, 0x29, 0x64, 0x9d, 0x16, 0xc8, 0x03, 0x92, 0xf6, 0x0d, 0x71, 0xaf, 0xb9, 0x40, 0x90,
+          0xc6, 0xc5, 0xdf, 0x09, 0xd6, 0xe3, 0x04, 0x31, 0xdd, 0x56, 0xd5, 0x0f, 0xbb, 0x5c, 0x7b, 0x88, 0x0b, 0x97, 0x74, 0x2a, 0x3f, 0x15, 0x56, 0x62,
+          0xbc, 0x04, 0xcb, 0x7a, 0x2c, 0xd7, 0x66, 0xe2, 0xb6, 0xc7, 0x94, 0x5f, 0xac, 0xba, 0xff, 0xc1, 0x30, 0x55, 0xdb, 0xd8, 0x7e, 0xb3, 0x94, 0x03,
+          0x5d, 0x18, 0xc2, 0xe6, 0x4c, 0x52, 0x69, 0x68, 0x78, 0xa2, 0xe2, 0x0e, 0xe9, 0x7c, 0x9e, 0xe5, 0x29, 0x0d, 0xc9, 0xd7, 0xa6, 0x44, 0x9c, 0x19,
+          0xac, 0x32, 0x96, 0xed, 0x91, 0xcf, 0x19, 0x95, 0xa7, 0x01, 0x0f, 0x84, 0xb6, 0x69, 0xc3, 0x7e, 0x90, 0x90, 0xde, 0x92, 0xd6, 0xc4, 0x3d, 0x5b,
+          0x89, 0x23, 0x05, 0x38, 0x6a, 0x62, 0xcd, 0x5a, 0xde, 0x71, 0x2a, 0x18, 0x97, 0xdd, 0x3a, 0x63, 0x40, 0xca, 0x6e, 0x65, 0x1d, 0x4e, 0xff, 0x9c,
+          0x2c, 0x91, 0x76, 0x9b, 0x65, 0xe1, 0xf2, 0xb1, 0xf0, 0x92, 0x84, 0x37, 0x8f, 0x75, 0x50, 0x0c, 0xd6, 0xb1, 0x9e, 0x5e, 0xc2, 0x2c, 0xd9, 0x7c,
+          0xc6, 0xce, 0x3a, 0x1a, 0x04, 0x26, 0x3f, 0x2b, 0x27, 0x01, 0xf7, 0x65, 0x71, 0xd2, 0xc1, 0xf4, 0xb9, 0x27, 0x99, 0x30, 0xd1, 0x40, 0x77, 0x94,
+          0x3c, 0xa6, 0x92, 0x89, 0x22, 0x18, 0xd0, 0x7d, 0xcb, 0x47, 0xd1, 0xff, 0xda, 0x7c, 0xfa, 0xfa, 0xac, 0xf4, 0xcf, 0x11, 0x15, 0xac, 0xdf, 0x1c,
+          0xde, 0x03, 0x30, 0xd8, 0x40, 0xcb, 0x73, 0x50, 0x0b, 0xcb, 0xe0, 0xb0, 0xee, 0x1c, 0x1c, 0xbc, 0x43, 0x95, 0xa5, 0xd3, 0xfe, 0x16, 0x33, 0x10,
+          0xe3, 0x14, 0xc1, 0x99, 0xc5, 0x98, 0x63, 0x3b, 0xa4, 0x0f, 0x87, 0x97, 0x73, 0x9f, 0x6c, 0xf1, 0x7c, 0xd3, 0x10, 0x1e, 0x94, 0x59, 0x5c, 0xa0,
+          0x60, 0xb9, 0x28, 0x03, 0xb2, 0x45, 0x06, 0x87, 0xc6, 0x81, 0xb3, 0x50, 0x9f, 0x9f, 0x61, 0x57, 0x51, 0x5d, 0x75, 0x76, 0x2d, 0xcd, 0xda, 0x2c,
+          0x83, 0xc5, 0x61, 0x61, 0x3a, 0xb3, 0xe9, 0x43, 0x3a, 0x39, 0xa4, 0x0f, 0xe4, 0x2f, 0x27, 0xcf, 0x76, 0x3a, 0x95, 0x65, 0xa6, 0xfa, 0xd8, 0xb9,
+          0xce, 0x23, 0xee, 0xbf, 0x3e, 0x5d, 0xfe, 0xe8, 0xed, 0x0f, 0xbd, 0x7f, 0x31, 0xdb, 0xf8, 0x6e, 0x49, 0x88, 0x70, 0x1b, 0x6e, 0x4e, 0x12, 0x9c,
+          0x4e, 0x16, 0xfa, 0x17, 0x19, 0x2b, 0xfa, 0x58, 0xee, 0xe2, 0xfb, 0xac, 0x43, 0x9e, 0x43, 0xda, 0x63, 0x14, 0x70, 0xa7, 0x8e, 0x73, 0xa4, 0x29,
+          0x2b, 0xda, 0xc1, 0xf3, 0x69, 0x04, 0x3f, 0xd4, 0xda, 0xf4, 0xc0, 0xfd, 0xb7, 0x3c, 0xaa, 0xa1, 0x21, 0xbb, 0x8f, 0x63, 0xcb, 0xad, 0x32, 0x86,
+          0x63, 0x95, 0x09, 0xf9, 0x64, 0x83, 0xc7, 0xc3, 0xcd, 0x94, 0x00, 0xb4, 0x8f, 0xa2, 0x95, 0xa4, 0x97, 0x22, 0x6c, 0xc3, 0x82, 0x21, 0x84, 0xc7,
+          0x70, 0x57, 0x46, 0x61, 0xd2, 0x22, 0x32, 0x22, 0xae, 0x6f, 0x27, 0xe2, 0xc4, 0x4f, 0xad, 0xb9, 0x03, 0x9d, 0x7d, 0xe0, 0x14, 0xed, 0x59, 0x42,
+          0xb3, 0x57, 0xcc, 0x6d, 0xe1, 0xf9, 0x8e, 0xe9, 0x39, 0x0e, 0x0c, 0x0d, 0x1c, 0x6a, 0x75, 0x82, 0x12, 0x18, 0x10, 0x56, 0xe5, 0x51, 0x27, 0xb7,
+          0x6a, 0xfc, 0xc4, 0x09, 0x5c, 0xbf, 0x47, 0x91, 0x38, 0x80, 0xcd, 0x03, 0xc5, 0x61, 0x28, 0x69, 0x0d, 0xd4, 0x4b, 0x7a, 0xf2, 0x49, 0x36, 0x4b,
+          0x20, 0x58, 0xf0, 0x0f, 0x3b, 0x7c, 0x92, 0x07, 0xd6, 0x68, 0x19, 0x3b, 0xe8, 0xa8, 0x06, 0xbd, 0x7d, 0x2b, 0x22, 0x7b, 0x33, 0x3d, 0x8b, 0x2b,
+          0xc0, 0x39, 0x82, 0xbf, 0xc2, 0xf5, 0xf7, 0x4c, 0x48, 0x63, 0x81, 0xe1, 0xb4, 0xf4, 0xd6, 0x60, 0xc6, 0x69, 0x8f, 0x0a, 0xf8, 0x16, 0x66, 0x74,
+          0x12, 0x14, 0x82, 0xd0, 0xaa, 0x46, 0x58, 0x91, 0xd3, 0x0c, 0xda, 0x16, 0x48, 0x79, 0x6e, 0xaf, 0x06, 0xca, 0x80, 0xc8, 0xc6, 0xc2, 0x92, 0x91,
+          0x86, 0xb3, 0x92, 0x75, 0x3c, 0x5e, 0xed, 0x87, 0x5e, 0xc4, 0x39, 0x57, 0x3e, 0x98, 0x1a, 0x44, 0x84, 0x30, 0xd9, 0x3d, 0xc9, 0xcf, 0xf0, 0xed,
+          0x97, 0xc0, 0x39, 0x8a, 0xd5, 0xbd, 0x3f, 0x17, 0x2c, 0x08, 0xac, 0x1d, 0xb4, 0x52, 0x1b, 0x33, 0x75, 0x84, 0x33, 0x45, 0x7c, 0x07, 0x6f, 0x49,
+          0x06, 0xe2, 0x84, 0x9a, 0xaf, 0x52, 0x1f, 0x46, 0x4f, 0x62, 0x79, 0x5b, 0x0b, 0x1a, 0x94, 0x81, 0xe2, 0xe8, 0x6a, 0x89, 0x6f, 0xbb, 0xc3, 0xa4,
+          0x28, 0xad, 0xb9, 0x9a, 0x99, 0xd8, 0xab, 0x9e, 0x2e, 0x32, 0x31, 0xba, 0x42, 0x48, 0xbe, 0xf1, 0x41, 0x0b, 0xf2, 0xc2, 0xd5, 0x3a, 0xc3, 0xc9,
+          0xc5, 0xea, 0x9e, 0x74, 0xad, 0xb6, 0x4e, 0x36, 0xa0, 0x1e, 0x8a, 0x6b, 0x15, 0x35, 0x9e, 0x6c, 0xe0, 0x1f, 0xe9, 0x93, 0xd3, 0x79, 0x63, 0x0c,
+          0x84, 0x8f, 0xf3, 0xc2, 0xb5, 0x0e, 0x20, 0x86, 0xec, 0x18, 0xc8, 0xef, 0xed, 0x5b, 0x53, 0x18, 0xa2, 0xae, 0xe8, 0x8c, 0x98, 0x02, 0xd4, 0x2e,
+          0x63, 0xfc, 0xda, 0x6c, 0xf5, 0x32, 0x09, 0xcf, 0x87, 0x35, 0x83, 0xdb, 0x51, 0xcc, 0xad, 0x89, 0xe5, 0x6b, 0xde, 0x77, 0x3d, 0xc6, 0x26, 0x39,
+          0xfa, 0x3b, 0x5f, 0x0c, 0x1b, 0xf8, 0x51, 0x70, 0x07, 0x55, 0x80, 0x4a, 0xe3, 0x60, 0xa2, 0xd3, 0xe1, 0xf3, 0xa5, 0x50, 0x7b, 0x2f, 0xa4, 0xe1,
+          0x62, 0x9c, 0x18, 0x57, 0x3a, 0xad, 0x9b, 0x26, 0x45, 0x0d, 0x86, 0x75, 0xc4, 0xc4, 0x03, 0x5b, 0xc9, 0x48, 0xfc, 0x90, 0xd1, 0x59, 0x8a, 0x4e,
+          0x3d, 0x22, 0x17, 0x14, 0x1f, 0xaa, 0xae, 0x10, 0x90, 0xe5, 0x1a, 0x92, 0x61, 0x32, 0x2d, 0x74, 0x60, 0x31, 0xd0, 0x8d, 0xec, 0x49, 0x64, 0x65,
+          0x0c, 0xb6, 0x12, 0xf8, 0xc0, 0x68, 0x8c, 0xf2, 0x87, 0x89, 0xf2, 0x5f, 0x47, 0x8d, 0x19, 0xd9, 0xee, 0xc4, 0x5b, 0x06, 0x56, 0xfd, 0x68, 0xa3,
+          0xf9, 0x89, 0x3a, 0xa6, 0x24, 0xd9, 0x85, 0xe6, 0x92, 0x02, 0x86, 0x15, 0x7b, 0x64, 0xb9, 0xb6, 0x0c, 0xfe, 0xe7, 0x2a, 0xb5, 0xc7, 0xb5, 0xe3,
+          0x72, 0x5f, 0x9f, 0x74, 0xcc, 0x85, 0xf0, 0x42, 0x54, 0x01, 0x89, 0xfb, 0x18, 0x5d, 0xaa, 0x4e, 0xc8, 0xb4, 0xa3, 0xfb, 0xb9, 0xf4, 0x51, 0x94,
+          0xf3, 0x17, 0xc4, 0x4c, 0x14, 0x3e, 0xb6, 0x9a, 0x5e, 0xb0, 0xa3, 0x7e, 0x0e, 0xd7, 0x11, 0x1b, 0xaf, 0x06, 0x26, 0xf6, 0x39, 0x25, 0xf9, 0x65,
+          0x04, 0x44, 0x67, 0x5a, 0x48, 0x76, 0xeb, 0x24, 0x38, 0xbb, 0x3e, 0x37, 0xad, 0xd4, 0x1d, 0x30, 0xd4, 0xe9, 0xed, 0x63, 0x27, 0xac, 0x13, 0x04,
+          0xd0, 0x8f, 0xdd, 0x7c, 0x6f, 0xb8, 0x85, 0xa6, 0x0d, 0x5c, 0x10, 0x8e, 0xbd, 0x7c, 0xcd, 0x69, 0x3d, 0x9c, 0xdf, 0xb2, 0xe3, 0x9f, 0x80, 0xdb,
+          0x96, 0x84, 0x5e, 0x9b, 0x27, 0xaa, 0x84, 0x3b, 0x4e, 0x39, 0x32, 0x29, 0xaa, 0x53, 0xa7, 0x29, 0xe4, 0x8c, 0x44, 0x98, 0x83, 0x46, 0x2e, 0x9e,
+          0xf6, 0x08, 0xe7, 0xe7, 0x69, 0x2d, 0xfc, 0x99, 0x8b, 0x30, 0x1b, 0xfe, 0xab, 0xfb, 0x81, 0xd5, 0x45, 0x53, 0x7d, 0xb4, 0x4d, 0x7f, 0xc0, 0xe7,
+          0x5e, 0x8a, 0x25, 0x16, 0x95, 0x29, 0x24, 0x9b, 0xb2, 0x34, 0xad, 0x9b, 0xea, 0x56, 0x73, 0x0d, 0x2c, 0x44, 0x06, 0x6d, 0x47, 0x6e, 0x13, 0x4c,
+          0x1a, 0x70, 0xd6, 0x4f, 0x8d, 0x99, 0x03, 0x19, 0xc4, 0x7e, 0x0a, 0x92, 0x29, 0x4b, 0x28, 0x5a, 0xee, 0x99, 0x4f, 0xe9, 0xf5, 0x21, 0x14, 0x31,
+          0x58, 0x56, 0x33, 0x91, 0xa6, 0xfa, 0xf5, 0x8d, 0xfb, 0x39, 0x6b, 0x5a, 0x29, 0x2a, 0xa1, 0x36, 0xf9, 0xbb, 0x29, 0x04, 0xa0, 0x68, 0x4d, 0x10,
+          0x10, 0x48, 0x44, 0xc1, 0x2d, 0xda, 0x8f, 0xc1, 0xd0, 0x4e, 0x16, 0xd7, 0x03, 0x3c, 0xb1, 0x5d, 0x1b, 0x5d, 0x43, 0xe5, 0x9c, 0xdf, 0xdc, 0x00,
+          0x27, 0xf1, 0x5a, 0xb2, 0x21, 0xdd, 0xf9, 0x49, 0x55, 0x28, 0x10, 0x96, 0xfe, 0x80, 0x4c, 0x5f, 0x1f, 0xbc, 0xfd, 0xd7, 0x07, 0x6c, 0xfa, 0x7a,
+          0xe5, 0xbb, 0xbf, 0xe7, 0x83, 0x97, 0xfe, 0xf3, 0x8a, 0x76, 0xda, 0x9b, 0xab, 0x52, 0xbc, 0x5e, 0xa9, 0xa6, 0xf5, 0x05, 0xff, 0xf5, 0x59, 0xa6,
+          0x78, 0x74, 0xe0, 0x47, 0x81, 0xa7, 0x0b, 0xd5, 0xbb, 0x57, 0x00, 0xd4, 0xc8, 0x3e, 0x07, 0x0a, 0xf5, 0xec, 0x04, 0x7a, 0xa6, 0xa7, 0x70, 0x61,
+          0xb4, 0x7b, 0x6c, 0xc0, 0x3b, 0xbd, 0x8d, 0xd5, 0x45, 0xdc, 0x68, 0xb1, 0xcd, 0xf6, 0x76, 0x2e, 0x44, 0xda, 0x4a, 0x57, 0x76, 0xa4, 0x92, 0xcb,
+          0xa6, 0xd1, 0xdc, 0x01, 0x94, 0xc8, 0x5a, 0xac, 0xea, 0x3f, 0xd3, 0x94, 0x54, 0xc5, 0x9e, 0xc4, 0xcd, 0x8d, 0x00, 0xcd, 0xe8, 0x88, 0x39, 0x44,
+          0xc7, 0xeb, 0x07, 0x7a, 0x7e, 0x5a, 0xd2, 0x1e, 0xa3, 0xf6, 0x87, 0x5d, 0x1c, 0x36, 0xf7, 0x72, 0x09, 0x9a, 0x32, 0x42, 0x0d, 0x62, 0x1a, 0x11,
+          0x8c, 0x78, 0xe5, 0x6c, 0xf1, 0x47, 0x4f, 0xaa, 0xc1, 0x63, 0xa6, 0xc9, 0xdf, 0xfe, 0xf2, 0x31, 0xf1, 0x3f, 0x37, 0x4b, 0x41, 0xa5, 0xf7, 0x37,
+          0xf9, 0x60, 0x71, 0x6e, 0x8b, 0x7d, 0x90, 0xf6, 0x5f, 0x6f, 0xf3, 0xf4, 0xf5, 0x4a, 0x77, 0x1f, 0xa4, 0xf4, 0x9f, 0x57, 0xaa, 0xe3, 0xac, 0xa4,
+          0x3f, 0xe8, 0x06, 0x04, 0x50, 0x75, 0x56, 0x1d, 0x27, 0x2b, 0x70, 0xd0, 0x15, 0x64, 0xbb, 0xb7, 0xa9, 0x44, 0x43, 0xb6, 0x59, 0x24, 0x14, 0x76,
+          0xdf, 0xb7, 0x71, 0x9d, 0x0e, 0x90, 0x78, 0x44, 0x88, 0xeb, 0x39, 0xbb, 0x47, 0xf6, 0x62, 0xbc, 0xbd, 0x68, 0x3e, 0x70, 0xbc, 0xde, 0xd5, 0x7e,
+          0xee, 0xbd, 0x23, 0xea, 0x6e, 0x1c, 0xd6, 0x0a, 0xf5, 0x1d, 0xbb, 0xd9, 0xb1, 0x0a, 0x86, 0xdf, 0x2d, 0x75, 0x71, 0x0e, 0xd1, 0x84, 0xe3, 0xfa,
+          0xe0, 0xfe, 0x19, 0xdf, 0x23, 0x8c, 0x2a, 0xd6, 0x40, 0x5d, 0xea, 0x73, 0x23, 0xa6, 0x1e, 0x4d, 0x2e, 0xc3, 0x16, 0x95, 0x4d, 0x93, 0x1a, 0x8c,
+          0xec, 0x70, 0xd1, 0x30, 0x4f, 0x9e, 0x56, 0x2c, 0x85, 0x04, 0xfd, 0x76, 0xd3, 0x6a, 0x40, 0xa8, 0xd3, 0x82, 0x79, 0xb4, 0x43, 0x72, 0x11, 0x8d,
+          0xee, 0x3a, 0x57, 0x56, 0x1a, 0xa6, 0xef, 0x55, 0xd1, 0x8b, 0xf0, 0xce, 0x08, 0x8f, 0xdf, 0xb7, 0x53, 0x8e, 0x9a, 0x8a, 0x95, 0x4c, 0xdb, 0x84,
+          0xf7, 0xf2, 0x18, 0xbd, 0x33, 0x5a, 0xb0, 0x61, 0x9e, 0x97, 0x40, 0x90, 0xa1, 0x8e, 0x29, 0xf9, 0xb8, 0xba, 0x38, 0xd1, 0xf4, 0x61, 0x19, 0xd1,
+          0xac, 0xd3, 0x74, 0x6b, 0x34, 0xb6, 0xc0, 0xcc, 0x34, 0xf9, 0x1e, 0x5e, 0x31, 0x95, 0x2b, 0x46, 0x78, 0xff, 0x11, 0x5f, 0x27, 0x06, 0xae, 0x25,
+          0x4c, 0xae, 0xd6, 0x13, 0x94, 0x18, 0x19, 0xda, 0x0b, 0x2c, 0x26, 0x6d, 0x3f, 0x19, 0x2b, 0x98, 0x51, 0xd3, 0x04, 0x24, 0xde, 0x85, 0x3f, 0x4f,
+          0x78, 0x3a, 0x64, 0xe8, 0x09, 0xe5, 0x6f, 0x7b, 0x1c, 0xb0, 0x2e, 0x30, 0x7f, 0xf9, 0x0c, 0x77, 0x01, 0xd7, 0x70, 0x14, 0x99, 0x72, 0x45, 0x27,
+          0x85, 0xdb, 0x3f, 0x49, 0x2b, 0xcf, 0x2f, 0xdc, 0x6d, 0x82, 0xc1, 0xbc, 0x17, 0x16, 0xd5, 0x80, 0x68, 0x96, 0x74, 0x5d, 0x61, 0x4c, 0xba, 0x75,
+          0x7b, 0x3c, 0x0b, 0x7d, 0x8a, 0x34, 0x52, 0xa7, 0x17, 0x49, 0x25, 0x4e, 0xf4, 0xf4, 0x46, 0xa6, 0xcd, 0x91, 0xc8, 0x42, 0xe6, 0x39, 0xba, 0x61,
+          0xc7, 0x84, 0x37, 0x68, 0xcd, 0xdc, 0xa0, 0x86, 0x0c, 0x19, 0xc5, 0x13, 0x05, 0x59, 0xe9, 0x82, 0x1d, 0x13, 0x5e, 0xa0, 0x35, 0x73, 0x81, 0x1a,
+          0x61, 0xc8, 0xe0, 0x47, 0x44, 0xca, 0xb6, 0x7d, 0x6a, 0x2c, 0x93, 0x84, 0x6c, 0x4a, 0x60, 0xc2, 0x38, 0x8a, 0xde, 0x8f, 0x69, 0xb6, 0x7f, 0xf3,
+          0xaf, 0x04, 0xa3, 0x8b, 0x5a, 0x2b, 0x84, 0x39, 0xd4, 0x0b, 0x2a, 0x65, 0xcd, 0xc5, 0x50, 0xd7, 0xb9, 0xae, 0xcb, 0x3e, 0xcf, 0xf1, 0x8d, 0x90,
+          0xa1, 0x57, 0x1f, 0xdb, 0x02, 0x95, 0xc1, 0xf1, 0xaa, 0x79, 0xcb, 0xbb, 0x14, 0x08, 0x15, 0x75, 0xee, 0x6a, 0xe8, 0x73, 0xd1, 0x38, 0x1b, 0xf1,
+          0x00, 0xfc, 0x55, 0x6d, 0x22, 0x2a, 0xd7, 0x0b, 0x3d, 0x56, 0x1e, 0xe8, 0x7b, 0x0a, 0x39, 0xea, 0xf9, 0x5b, 0xb6, 0xa3, 0xc5, 0x7a, 0x59, 0x25,
+          0x80, 0xd0, 0x30, 0x12, 0x49, 0xee, 0x36, 0x47, 0x63, 0x00, 0x62, 0x7e, 0x38, 0x31, 0x97, 0x93, 0x64, 0x6a, 0x2c, 0x59, 0xce, 0x3e, 0x77, 0x1c,
+          0xfe, 0x77, 0xa5, 0xaa, 0x49, 0x67, 0x6f, 0x92, 0x4f, 0x5e, 0x1d, 0xe4, 0xd4, 0xcd, 0xd7, 0x68, 0x1a, 0x98, 0x59, 0xa2, 0xc5, 0x45, 0xd6, 0x08,
+          0x1f, 0x37, 0x6d, 0x25, 0x99, 0xa5, 0x3d, 0x90, 0x80, 0x4f, 0x9f, 0x84, 0xd9, 0xf5, 0xd1, 0x2a, 0xe8, 0x96, 0xc7, 0xf9, 0xac, 0x8b, 0xfd, 0xa7,
+          0x7f, 0x74, 0x8e, 0xdc, 0x9a, 0x18, 0xf4, 0xce, 0xb7, 0xd2, 0xed, 0x3c, 0x9f, 0x59, 0x1a, 0xba, 0x4e, 0xfb, 0x2b, 0x37, 0xae, 0x63, 0x72, 0x75,
+          0x7e, 0xd5, 0x46, 0x7f, 0xc4, 0x92, 0x18, 0x05, 0x1e, 0x9a, 0x4e, 0x45, 0x60, 0x6f, 0x78, 0x8a, 0x02, 0xe7, 0xe2, 0x36, 0x91, 0x81, 0x42, 0x78,
+          0x71, 0x99, 0x95, 0x10, 0xfe, 0xa8, 0x71, 0x1d, 0x76, 0x36, 0x7b, 0x88, 0xc6, 0x6e, 0xf8, 0x61, 0x12, 0x07, 0x50, 0x56, 0x8d, 0xf2, 0xbd, 0x29,
+          0xb2, 0xd0, 0xd4, 0xd9, 0x7e, 0x15, 0x31, 0xa8, 0x57, 0xd2, 0x13, 0x76, 0xa7, 0x18, 0x97, 0x62, 0xec, 0x5a, 0xcc, 0xf4, 0xe5, 0x05, 0xd8, 0xd3,
+          0x1d, 0x65, 0xfa, 0x19, 0x77, 0x67, 0x83, 0xe0, 0xc4, 0x84, 0xf8, 0x5a, 0x44, 0x7e, 0x67, 0x0b, 0x4e, 0xbe, 0xdf, 0x0a, 0xbb, 0x89, 0x49, 0x28,
+          0x9d, 0x94, 0xbf, 0x5c, 0xcb, 0x3a, 0xe4, 0xab, 0xa5, 0x82, 0xe5, 0x8b, 0x5b, 0xd7, 0x68, 0x7e, 0x45, 0x03, 0xc7, 0x70, 0x60, 0x5d, 0x5c, 0x50,
+          0xc2, 0x7e, 0x92, 0x2e, 0x17, 0x99, 0x5c, 0x09, 0xb9, 0x0b, 0xdb, 0xa0, 0xdb, 0x5c, 0x41, 0xf2, 0xd9, 0x42, 0xd7, 0x6e, 0x90, 0x64, 0xf6, 0x7e,
+          0x14, 0x21, 0x9e, 0xf4, 0x79, 0x99, 0xc0, 0x49, 0x67, 0xec, 0x45, 0xa5, 0x64, 0x71, 0x7f, 0xac, 0x4b, 0xe6, 0x8d, 0x12, 0x52, 0xb7, 0xe2, 0x12,
+          0xd4, 0xe9, 0x16, 0x9c, 0x2e, 0x0c, 0xa7, 0x9c, 0xd3, 0x1e, 0x5f, 0x57, 0x83, 0xd0, 0x5d, 0x8d, 0x90, 0xcb, 0x0c, 0x37, 0x8b, 0xa2, 0x44, 0x52,
+          0x41, 0x81, 0x42, 0xca, 0x73, 0x69, 0xf1, 0xea, 0xac, 0x01, 0xdc, 0xd8, 0xea, 0x7c, 0xd7, 0xf7, 0x6e, 0x43, 0x53, 0xc7, 0x78, 0xdc, 0x7b, 0xa2,
+          0x2e, 0xf5, 0x85, 0x3d, 0xcb, 0xfe, 0x7c, 0xfe, 0x1a, 0x6d, 0xc3, 0xdc, 0x96, 0xcf, 0x72, 0xa0, 0x7c, 0xa5, 0xf6, 0x4b, 0x07, 0x23, 0x10, 0x13,
+          0x16, 0xb2, 0x74, 0x4f, 0x8e, 0x3c, 0x8b, 0x8b, 0x8a, 0x25, 0xc7, 0xda, 0xd7, 0xec, 0x54, 0x05, 0xc1, 0x71, 0xc7, 0xb2, 0x41, 0x9d, 0x5a, 0x15,
+          0x45, 0x91, 0x19, 0xe1, 0xf8, 0xa7, 0x4b, 0xe0, 0x98, 0x32, 0xa2, 0x08, 0x37, 0xe3, 0x52, 0x00, 0x60, 0x2c, 0x2c, 0xbe, 0x79, 0x51, 0x77, 0x62,
+          0x1b, 0xb0, 0x61, 0xdd, 0xaf, 0x1e, 0x68, 0x4a, 0x4d, 0xc0, 0x39, 0x28, 0x7f, 0xdd, 0x92, 0xd4, 0x2d, 0x9d, 0xda, 0x6f, 0x01, 0x9d, 0xb8, 0x49,
+          0xbf, 0xde, 0xbc, 0x0d, 0xaa, 0xd9, 0x14, 0xbe, 0x7b, 0xc8, 0x95, 0x39, 0x74, 0x5a, 0xd0, 0x3c, 0xc7, 0x55, 0x03, 0xe3, 0x0a, 0x26, 0x98, 0xac,
+          0xf3, 0x36, 0x7c, 0xf7, 0xda, 0x51, 0xb2, 0x69, 0xc6, 0xb4, 0x9d, 0x7f, 0xda, 0xa3, 0xde, 0x4f, 0x4b, 0x6b, 0x9e, 0x29, 0xba, 0xbc, 0x2e, 0xc1,
+          0x1a, 0xe7, 0xb5, 0x9c, 0x2c, 0x1b, 0x09, 0xec, 0x7e, 0x9e, 0x1f, 0x1e, 0xef, 0x5e, 0xab, 0x9f, 0x70, 0x1c, 0x77, 0xbf, 0xd2, 0xa5, 0x94, 0x95,
+          0x61, 0x0a, 0xbb, 0x88, 0xa4, 0x20, 0xfa, 0x10, 0x30, 0xb6, 0x28, 0x69, 0x65, 0x0d, 0x20, 0x28, 0x86, 0x16, 0x47, 0xb7, 0x08, 0xcf, 0x76, 0xd6,
+          0xbb, 0xae, 0xfc, 0x29, 0xd0, 0x4d, 0xd6, 0x27, 0xf7, 0xac, 0xb6, 0x59, 0x30, 0x1a, 0x31, 0x97, 0xba, 0xab, 0x54, 0xba, 0xbb, 0x72, 0xb7, 0xff,
+          0xa1, 0xd4, 0x96, 0x38, 0x5b, 0x48, 0x7c, 0xa1, 0x39, 0xd1, 0xdb, 0xa9, 0x04, 0xcf, 0x4c, 0xc6, 0xa4, 0x9a, 0xb3, 0x50, 0xef, 0x1c, 0xae, 0xf0,
+          0x16, 0x03, 0x12, 0xb2, 0xd3, 0x23, 0x29, 0x9f, 0x6f, 0x6e, 0xef, 0x6e, 0xeb, 0x73, 0xf5, 0xb6, 0x1b, 0x90, 0xfb, 0xb9, 0x1e, 0x64, 0x9e, 0xe9,
+          0x43, 0x13, 0x34, 0x62, 0x56, 0x9d, 0x78, 0xa5, 0xb8, 0xeb, 0x1a, 0xb7, 0x81, 0xd3, 0xbb, 0x60, 0xea, 0x9a, 0x0f, 0x4e, 0x88, 0x78, 0x3a, 0x4c,
+          0x79, 0xdc, 0x1a, 0x3e, 0xc9, 0x83, 0x97, 0x25, 0x23, 0x37, 0xd3, 0x0d, 0xf7, 0x9a, 0xe7, 0xc3, 0x61, 0xed, 0xe8, 0xad, 0xa8, 0x91, 0xba, 0xbd,
+          0xe2, 0x44, 0x2b, 0x3f, 0xf3, 0xdf, 0x1c, 0xde, 0xf0, 0x05, 0x96, 0x4b, 0xdc, 0xa0, 0x64, 0xaa, 0x5b, 0x91, 0x38, 0xcd, 0x4d, 0x7b, 0xb7, 0x0a,
+          0xa6, 0x59, 0x61, 0xcc, 0x71, 0xa6, 0xf7, 0x3d, 0xe3, 0xd6, 0x67, 0x8b, 0x27, 0xec, 0x3a, 0xc4, 0xb3, 0x29, 0xf1, 0x88, 0x5f, 0xe5, 0xa0, 0x9f,
+          0xc1, 0x13, 0xed, 0xd9, 0x78, 0x15, 0x9e, 0x3c, 0x09, 0x38, 0x95, 0x34, 0x39, 0x29, 0xc0, 0x51, 0x82, 0x08, 0x0c, 0x3f, 0x4f, 0x0c, 0x56, 0x0d,
+          0xa2, 0x04, 0xc7, 0x35, 0x9c, 0x18, 0xcf, 0x1f, 0xe1, 0xbc, 0xf7, 0xaa, 0xa4, 0x61, 0xb9, 0xde, 0xd3, 0x60, 0xfc, 0xd8, 0x16, 0x02, 0xaa, 0x91,
+          0xbf, 0x04, 0x8a, 0xec, 0x47, 0x74, 0xf8, 0x43, 0x47, 0x9d, 0xa5, 0xc4, 0xd6, 0x28, 0x37, 0x67, 0x55, 0x22, 0xb4, 0x1d, 0x13, 0x70, 0x8b, 0x97,
+          0xa2, 0x81, 0xbe, 0x93, 0xe8, 0x74, 0x40, 0x74, 0x93, 0x14, 0xe3, 0x5c, 0x68, 0x19, 0x98, 0x4d, 0xe3, 0xc7, 0xe1, 0xd0, 0x3a, 0x64, 0x30, 0x04,
+          0x42, 0xb4, 0x95, 0x4f, 0x3d, 0xde, 0xaf, 0xb5, 0xe3, 0xfd, 0xe8, 0x67, 0x53, 0x55, 0x24, 0xb7, 0xbb, 0x86, 0x76, 0x8d, 0x2c, 0xdf, 0x5c, 0xa2,
+          0x20, 0x8e, 0x86, 0x55, 0x13, 0x08, 0x02, 0x4a, 0x24, 0xaf, 0x95, 0x62, 0x88, 0xa8, 0xda, 0xa8, 0x45, 0xc7, 0x99, 0x10, 0xb3, 0x83, 0x3b, 0x41,
+          0x85, 0xb4, 0x06, 0x19, 0x48, 0x8f, 0x47, 0xef, 0xe8, 0x46, 0xfc, 0xe4, 0x70, 0x9a, 0xbd, 0x86, 0x4c, 0x35, 0x66, 0x1d, 0xbc, 0x98, 0xa7, 0xd3,
+          0x17, 0x87, 0x33, 0xc9, 0xa5, 0x65, 0x8a, 0x0e, 0x3e, 0x1b, 0x09, 0xf5, 0x13, 0xb0, 0x26, 0x79, 0xda, 0x9f, 0xc2, 0x5f, 0x0e, 0x9b, 0x8a, 0x2b,
+          0x46, 0xb8, 0x40, 0x08, 0xd1, 0x29, 0x0c, 0xf3, 0xae, 0x01, 0x47, 0xed, 0xe8, 0xf5, 0x3c, 0x04, 0x70, 0x57, 0x6d, 0xf3, 0x24, 0xb6, 0x31, 0x12,
+          0xa6, 0xf2, 0x0c, 0x30, 0xdc, 0xf5, 0x8c, 0x72, 0x50, 0x55, 0x2b, 0x07, 0x24, 0x24, 0x28, 0x4d, 0xc6, 0x91, 0x17, 0xd8, 0x92, 0x2f, 0xf7, 0x7a,
+          0x6d, 0xc6, 0xdc, 0xb2, 0xe3, 0x15, 0xba, 0x04, 0x85, 0x70, 0xe0, 0x59, 0x81, 0x94, 0x8f, 0x52, 0xd2, 0xb6, 0x0e, 0x5d, 0x78, 0x55, 0x48, 0x0c,
+          0xe9, 0xe0, 0x8a, 0x36, 0x06, 0xc2, 0x3e, 0x0f, 0x07, 0x46, 0x02, 0x40, 0x04, 0x16, 0x7b, 0x03, 0x4e, 0xb0, 0x71, 0x5a, 0x1f, 0x0e, 0xdc, 0xa4,
+          0x94, 0xc5, 0xa6, 0xb8, 0x5e, 0x02, 0xce, 0x83, 0xcd, 0x60, 0xf8, 0xac, 0xa4, 0x75, 0x50, 0x92, 0x68, 0xbe, 0x3b, 0x4d, 0x39, 0x16, 0x5d, 0x67,
+          0x8c, 0x80, 0x5a, 0xcc, 0x1d, 0x1e, 0x24, 0x89, 0x6d, 0xbe, 0x37, 0xec, 0x0f, 0x08, 0x43, 0x49, 0xfb, 0x84, 0x14, 0x5f, 0xe7, 0xc6, 0xd6, 0x79,
+          0xd4, 0x46, 0xbd, 0x7c, 0xcd, 0xc6, 0x4d, 0x8e, 0xd4, 0xe8, 0xe8, 0x99, 0x97, 0x1a, 0xee, 0xbf, 0x4f, 0xf5, 0xce, 0x23, 0x02, 0xf3, 0x1e, 0xbb,
+          0x81, 0x30, 0xb6, 0x16, 0x55, 0x28, 0x56, 0x4a, 0x4d, 0x93, 0x04, 0xa3, 0x12, 0xc4, 0x62, 0x22, 0x22, 0x5a, 0xa6, 0x2d, 0x7f, 0x92, 0xdb, 0x84,
+          0xda, 0x30, 0x28, 0x6a, 0x03, 0xb9, 0xcf, 0x64, 0x3d, 0xb4, 0x4b, 0x9f, 0xdd, 0xfd, 0x32, 0xc6, 0x58, 0xa2, 0xa5, 0x9f, 0xe9, 0xf1, 0xd3, 0x83,
+          0x99, 0xc1, 0xb7, 0xb9, 0xdc, 0xf2, 0x02, 0xf0, 0x07, 0x53, 0x5b, 0x76, 0x73, 0x48, 0x8c, 0x96, 0xb5, 0x83, 0x59, 0x3b, 0xdc, 0xeb, 0xbb, 0x5d,
+          0xf7, 0x51, 0x1f, 0xc1, 0xc0, 0xe4, 0xa5, 0x33, 0x8b, 0x39, 0x70, 0x90, 0xcb, 0x1c, 0xa8, 0xad, 0xb9, 0x4c, 0x91, 0xeb, 0xeb, 0xce, 0x64, 0xb3,
+          0xb2, 0xb2, 0xbf, 0xa8, 0x25, 0x5e, 0x61, 0xff, 0xf7, 0xa4, 0x62, 0xe6, 0x8d, 0x69, 0xda, 0xfc, 0x7a, 0x53, 0x27, 0xed, 0xfd, 0x50, 0x4f, 0xd5,
+          0x7e, 0x64, 0x58, 0x63, 0x82, 0x09, 0x73, 0x37, 0x74, 0xa5, 0xd7, 0xda, 0x7a, 0x78, 0xd1, 0x49, 0x2b, 0xe2, 0xb3, 0xb6, 0xc6, 0x2e, 0xce, 0x84,
+          0x15, 0xc4, 0x39, 0xad, 0x84, 0x9f, 0x30, 0x9f, 0x3b, 0xa5, 0x86, 0xd7, 0x14, 0xfe, 0x60, 0xd8, 0xf3, 0xdf, 0x70, 0xe9, 0xef, 0x00, 0x66, 0x0d,
+          0x61, 0x2f, 0x35, 0xcd, 0x86, 0xc9, 0xf0, 0x94, 0xb4, 0x8f, 0x85, 0x12, 0x79, 0x79, 0x86, 0x74, 0x60, 0xa1, 0xb5, 0x4d, 0x17, 0x66, 0x68, 0x28,
+          0x13, 0x04, 0x1d, 0xd5, 0x04, 0x73, 0xbe, 0xfa, 0x47, 0x72, 0xdf, 0xbf, 0x13, 0x0a, 0x10, 0x8c, 0x68, 0x4b, 0xec, 0x62, 0x68, 0x02, 0x3b, 0x09,
+          0x0f, 0x53, 0x62, 0x1f, 0x23, 0x88, 0x6f, 0x7c, 0xf1, 0xfa, 0x1e, 0x4d, 0xd0, 0x99, 0x3d, 0x91, 0x06, 0x3d, 0x9d, 0x5f, 0xd2, 0x50, 0xf2, 0x5e,
+          0x8a, 0x85, 0xe7, 0xd3, 0x3e, 0xa8, 0xaa, 0x42, 0x22, 0xa5, 0x6e, 0x99, 0xf8, 0x25, 0xce, 0x19, 0xbb, 0x8a, 0x5b, 0xa3, 0xc1, 0xf8, 0xbc, 0x07,
+          0x62, 0x82, 0xf3, 0xee, 0x44, 0x52, 0xba, 0x1f, 0x18, 0xdb, 0xd5, 0x62, 0x56, 0x6c, 0xe2, 0x33, 0x87, 0x26, 0xbc, 0xf7, 0x35, 0x80, 0x5c, 0x46,
+          0xf3, 0x26, 0x7d, 0xb5, 0x64, 0x62, 0x0a, 0x3d, 0xea, 0x62, 0xcc, 0x95, 0x69, 0x5c, 0x43, 0x66, 0x84, 0xd3, 0x82, 0xe0, 0xb3, 0xa5, 0xca, 0x6a,
+          0x94, 0x29, 0x5e, 0x06, 0x3f, 0xfd, 0x32, 0xb1, 0x31, 0xf3, 0xec, 0x51, 0x44, 0xe1, 0x62, 0x5b, 0xe6, 0x4a, 0xbc, 0xd6, 0x1d, 0xc0, 0x15, 0x20,
+          0x67, 0x23, 0x40, 0xc1, 0xa9, 0xba, 0x18, 0xfc, 0xfc, 0xe5, 0xda, 0xd0, 0x7e, 0xdb, 0xb8, 0x76, 0x8e, 0x73, 0x33, 0xb3, 0xcf, 0x2f, 0x88, 0xe4,
+          0x78, 0x8b, 0x8f, 0xea, 0x57, 0xeb, 0x03, 0x7a, 0x66, 0xa8, 0x88, 0x52, 0x51, 0x29, 0x3a, 0x60, 0x6d, 0xbb, 0x2a, 0xf3, 0x04, 0xb0, 0x19, 0x60,
+          0x44, 0xa7, 0x3e, 0xc4, 0xc1, 0xf7, 0x8f, 0xd7, 0x9f, 0x4e, 0xa6, 0x9b, 0x7f, 0xa1, 0x0b, 0x60, 0xfe, 0x0a, 0x88, 0x45, 0xef, 0xc7, 0x81, 0x01,
+          0xdd, 0x3c, 0xb7, 0xdf, 0x2c, 0x86, 0x55, 0x9e, 0x77, 0xa4, 0xc0, 0x56, 0x1c, 0x17, 0xc2, 0xd7, 0xce, 0x17, 0x07, 0xbe, 0x5e, 0x75, 0xca, 0xdf,
+          0x4b, 0xfa, 0x68, 0xe6, 0xd3, 0x6a, 0x62, 0x3e, 0x47, 0x41, 0x46, 0x72, 0xf9, 0x44, 0x03, 0x6c, 0xb9, 0x3b, 0x87, 0x18, 0x1c, 0x92, 0x6d, 0x50,
+          0xb8, 0x11, 0x47, 0x97, 0x2b, 0x45, 0x89, 0xdf, 0xb3, 0xad, 0xa2, 0xcd, 0xe3, 0xa4, 0x4c, 0xf4, 0xeb, 0xc2, 0x5e, 0x8c, 0xb0, 0x03, 0xad, 0x65,
+          0xe5, 0xe6, 0x5a, 0x54, 0xc7, 0x2c, 0x56, 0xb3, 0xd4, 0x57, 0xd0, 0x5a, 0x91, 0xdc, 0x6f, 0x66, 0xb3, 0xae, 0x80, 0x86, 0x34, 0x90, 0xa5, 0x53,
+          0xa4, 0xab, 0x35, 0x83, 0xf1, 0x37, 0x81, 0x22, 0x14, 0x1b, 0x93, 0x8d, 0xee, 0x2f, 0x9e, 0x5d, 0x4f, 0xdc, 0x9b, 0x2f, 0x0a, 0x46, 0x44, 0xad,
+          0x81, 0x20, 0xa9, 0x55, 0x57, 0x9e, 0xe8, 0x28, 0x10, 0xa0, 0xa2, 0xab, 0x92, 0x9c, 0x1f, 0x51, 0x6f, 0xc6, 0x91, 0x90, 0xf4, 0x71, 0x9d, 0x81,
+          0x25, 0xd8, 0x8b, 0x2a, 0xb3, 0x26, 0xb9, 0xc4, 0xc8, 0x78, 0xcb, 0x0f, 0x29, 0x8c, 0x99, 0xd3, 0x25, 0x60, 0xba, 0xf9, 0xd3, 0xf3, 0xf0, 0x34,
+          0x53, 0x3e, 0x80, 0xca, 0xe0, 0xe3, 0x7d, 0x46, 0x22, 0xfd, 0xe1, 0x0a, 0xf1, 0x83, 0x8d, 0x2f, 0xa6, 0x9f, 0x0f, 0x58, 0xf4, 0x0f, 0xe0, 0xee,
+          0xca, 0x45, 0x5c, 0xd4, 0x1d, 0x44, 0x9f, 0xf9, 0x67, 0x21, 0xa0, 0xc4, 0x0f, 0x4c, 0xc9, 0xff, 0x98, 0x65, 0xa6, 0x88, 0x62, 0xa0, 0x61, 0xe2,
+          0xdc, 0x21, 0x1a, 0x59, 0xeb, 0xa1, 0x55, 0x9e, 0x30, 0x89, 0x49, 0x16, 0xcd, 0x16, 0x0e, 0x98, 0xef, 0xb1, 0xc5, 0x42, 0x03, 0x11, 0xd4, 0x91,
+          0x79, 0x3b, 0xc5, 0x7c, 0x05, 0x4c, 0x24, 0xb5, 0x09, 0xf0, 0x98, 0x64, 0x32, 0x03, 0xd8, 0x2a, 0x5a, 0x54, 0x95, 0x02, 0x7c, 0xd5, 0x7e, 0x81,
+          0x1a, 0xa6, 0x63, 0x97, 0x62, 0x32, 0x27, 0x16, 0x39, 0x03, 0x11, 0x6d, 0x34, 0xae, 0xff, 0xf0, 0x63, 0xcc, 0xd7, 0xb6, 0xfd, 0x29, 0xce, 0x30,
+          0x5b, 0x73, 0xbe, 0x08, 0x05, 0xde, 0xf7, 0xd5, 0xc6, 0x4c, 0x3a, 0xf1, 0x7d, 0x88, 0x7d, 0xb5, 0xe3, 0x64, 0x0e, 0x9d, 0x1c, 0x82, 0x00, 0xa1,
+          0x92, 0xaa, 0xfc, 0x46, 0x4e, 0x68, 0xe4, 0x05, 0x14, 0xae, 0x01, 0xb7, 0x75, 0x14, 0x8d, 0xf5, 0x66, 0x74, 0x43, 0x18, 0x38, 0xb0, 0x35, 0xba,
+          0x8d, 0x48, 0xe1, 0xcc, 0x19, 0x0f, 0xe5, 0xb9, 0xc6, 0x46, 0x3a, 0xf5, 0xdb, 0xb5, 0x50, 0x6f, 0xaa, 0xbb, 0xaf, 0x6f, 0x97, 0x9b, 0xf6, 0x5b,
+          0xa3, 0x01, 0x5c, 0x8f, 0x72, 0x19, 0xae, 0x75, 0x23, 0xa9, 0x4a, 0x05, 0x2f, 0x7d, 0xa9, 0xc0, 0x0e, 0xdc, 0x7f, 0x36, 0x9b, 0x89, 0x7e, 0xb1,
+          0xbc, 0x1d, 0xd8, 0x57, 0x95, 0x57, 0x62, 0xd1, 0x69, 0x34, 0x5d, 0x99, 0xbe, 0xb2, 0xdf, 0x68, 0x4e, 0x66, 0xdd, 0x2e, 0xff, 0xe3, 0x8d, 0x79,
+          0xe2, 0x73, 0x87, 0x75, 0x21, 0x60, 0x7a, 0x28, 0xfd, 0x9d, 0x20, 0x11, 0xcc, 0xbe, 0x55, 0x4d, 0x42, 0xfd, 0x30, 0x0f, 0x02, 0x83, 0x7c, 0xe8,
+          0x2d, 0x05, 0x6d, 0xe5, 0xa4, 0x8f, 0x39, 0xce, 0x42, 0x72, 0x2c, 0x34, 0x10, 0xdb, 0xa7, 0xf6, 0x54, 0x6d, 0x24, 0xf0, 0x9b, 0x5d, 0xb7, 0x84,
+          0xb2, 0xb8, 0xc2, 0xaa, 0x86, 0x05, 0x08, 0xc9, 0xc0, 0xed, 0x96, 0xe0, 0x86, 0xf9, 0x13, 0x25, 0x46, 0xa6, 0xe9, 0x7f, 0x80, 0xd0, 0xf8, 0xcf,
+          0x17, 0x64, 0x4c, 0x4c, 0x03, 0xd5, 0xf9, 0x03, 0x99, 0xff, 0x20, 0xd7, 0xe0, 0x67, 0x7b, 0x70, 0xaf, 0xbf, 0x4b, 0x97, 0xff, 0xa0, 0xef, 0x81,
+          0xa6, 0xcb, 0xe0, 0x05, 0x79, 0x7e, 0xc3, 0x07, 0x30, 0x55, 0x31, 0x1d, 0xb6, 0x0c, 0x1c, 0xad, 0x2c, 0x6a, 0x81, 0x41, 0xa0, 0xd5, 0x7f, 0x75,
+          0xc0, 0x3f, 0x2e, 0xac, 0xe8, 0x56, 0x42, 0x67, 0x2b, 0xae, 0x34, 0xf3, 0x14, 0xe9, 0x5e, 0xfa, 0x48, 0xcd, 0xbd, 0xfc, 0x9d, 0xe3, 0x85, 0xb7,
+          0x9e, 0x57, 0x07, 0xbd, 0x5c, 0x6a, 0x81, 0xec, 0xe3, 0x58, 0x8e, 0x8b, 0x5c, 0xb0, 0xc6, 0x2f, 0x60, 0xb2, 0xb7, 0x63, 0xf7, 0x84, 0x40, 0xfa,
+          0x68, 0x48, 0xc6, 0x09, 0x55, 0x17, 0x72, 0x42, 0x5f, 0x40, 0xc7, 0x32, 0xe0, 0xbb, 0xf9, 0x2f, 0xff, 0x01, 0x18, 0x00, 0x2a, 0x63, 0x17, 0xc3,
+          0x69, 0x8a, 0x70, 0x23, 0x27, 0xce, 0x2d, 0x7b, 0x14, 0x3a, 0x52, 0x81, 0xaa, 0x6c, 0x10, 0x72, 0x2c, 0xcd, 0x27, 0xce, 0xd3, 0xb9, 0x61, 0xdb,
+          0x8c, 0x87, 0x6f, 0x30, 0x39, 0x4f, 0xca, 0xaf, 0x21, 0x8a, 0x73, 0x1c, 0x69, 0x6d, 0xa3, 0x5f, 0xe4, 0x75, 0x2d, 0xaf, 0xfa, 0xb3, 0x03, 0x2b,
+          0xb3, 0x15, 0x09, 0x48, 0x2a, 0xcf, 0x3e, 0x86, 0x75, 0x9e, 0x06, 0x31, 0x8b, 0xc7, 0xa7, 0x49, 0x31, 0xf0, 0x56, 0xff, 0xab, 0xc8, 0x36, 0x94,
+          0xe2, 0xe2, 0x83, 0x28, 0x07, 0x10, 0x64, 0x74, 0xb5, 0x21, 0xba, 0xc2, 0xe9, 0x85, 0xed, 0x67, 0x3c, 0xe4, 0xd9, 0x68, 0x6e, 0x5d, 0x47, 0x1a,
+          0xc0, 0x78, 0xd4, 0x9b, 0x66, 0x3f, 0xd6, 0x3f, 0xfe, 0x53, 0x9d, 0x65, 0xf0, 0x01, 0xe5, 0x53, 0x3e, 0xaa, 0xe0, 0x27, 0x98, 0x85, 0x0c, 0xfb,
+          0x5b, 0x50, 0xf8, 0xfd, 0x66, 0xdc, 0xf9, 0x59, 0x70, 0x02, 0x15, 0x38, 0x2d, 0xcc, 0xcc, 0x5b, 0xbd, 0x4e, 0xc7, 0xbe, 0x17, 0x4c, 0x69, 0x87,
+          0x53, 0xc0, 0xb3, 0xb0, 0xd6, 0x3c, 0xd9, 0xcf, 0x64, 0xac, 0x4d, 0xb6, 0x9a, 0x29, 0x24, 0x16, 0x51, 0x86, 0xcd, 0xf8, 0x80, 0x63, 0xd8, 0x0b,
+          0x48, 0xe4, 0x42, 0x25, 0x7e, 0xa6, 0xef, 0x2e, 0xe5, 0x7f, 0x9e, 0x21, 0x4c, 0x19, 0xb2, 0x56, 0x6c, 0xd3, 0x5c, 0xf9, 0xf7, 0xf4, 0x05, 0xa0,
+          0xb3, 0xde, 0xf7, 0x01, 0x48, 0xdc, 0xcd, 0x04, 0xbf, 0x1f, 0x25, 0x8d, 0x35, 0x84, 0x47, 0xb4, 0xe0, 0xfd, 0x19, 0x3d, 0xae, 0x73, 0xec, 0x5d,
+          0xa6, 0xb6, 0xd4, 0x5b, 0xd7, 0x6c, 0xfb, 0x12, 0xd5, 0xec, 0xae, 0x06, 0x03, 0x62, 0x38, 0x8b, 0xd0, 0x36, 0x33, 0xe0, 0x8e, 0x3c, 0xad, 0x13,
+          0xda, 0x32, 0x33, 0xc6, 0xa2, 0xa6, 0x1c, 0xcb, 0x6b, 0x2e, 0xc9, 0xc7, 0xbd, 0x95, 0x1b, 0xe6, 0x73, 0x6f, 0x6a, 0xfa, 0x81, 0x8a, 0x88, 0x52,
+          0xd6, 0x04, 0x57, 0x81, 0x41, 0x3f, 0xa3, 0x63, 0x0d, 0x2f, 0xe8, 0x7a, 0xd9, 0x1b, 0xe1, 0xa6, 0x19, 0x4c, 0xb4, 0x77, 0x85, 0x86, 0x3d, 0x06,
+          0xf1, 0x69, 0xe8, 0xa7, 0x75, 0xcc, 0xee, 0x0f, 0xea, 0xa4, 0xdd, 0x41, 0xc1, 0x88, 0x55, 0x9e, 0xd6, 0x20, 0x09, 0xd3, 0x0b, 0xcc, 0x41, 0xc0,
+          0xd2, 0xa5, 0x6a, 0xee, 0x38, 0x42, 0xa8, 0x29, 0xba, 0xec, 0xd4, 0xe1, 0x90, 0x96, 0x52, 0x00, 0xe1, 0x22, 0xa4, 0x3d, 0x20, 0x68, 0x0e, 0xe3,
+          0x94, 0xf5, 0x64, 0xed, 0x15, 0x2d, 0x34, 0x97, 0x3c, 0x6b, 0x80, 0x9f, 0x07, 0x1a, 0x7c, 0xb0, 0xcc, 0xb5, 0xd5, 0xac, 0x36, 0x07, 0x72, 0x59,
+          0xe1, 0x27, 0x70, 0xf4, 0xb8, 0x31, 0x8f, 0x6f, 0xcb, 0x09, 0xee, 0xb3, 0x51, 0xe8, 0xcd, 0x4f, 0x1b, 0x73, 0x38, 0x4c, 0x1e, 0x08, 0xa1, 0xd7,
+          0xf8, 0x3b, 0x0d, 0x96, 0x76, 0xc8, 0xea, 0x32, 0x8e, 0x91, 0xe8, 0x7b, 0x30, 0xf0, 0x09, 0x9b, 0xd6, 0x59, 0x7f, 0x78, 0x65, 0x80, 0x7b, 0xd3,
+          0xc1, 0x57, 0xb8, 0x47, 0x47, 0xa3, 0x1b, 0x39, 0xb8, 0x12, 0x01, 0xce, 0x76, 0x15, 0x6d, 0x5c, 0x77, 0x55, 0x83, 0x9d, 0x8c, 0xe5, 0x22, 0xa0,
+          0xfa, 0xb6, 0xa8, 0x1a, 0xd8, 0xef, 0x70, 0xb3, 0xe3, 0xda, 0xb3, 0x18, 0xe1, 0x82, 0xf1, 0x5a, 0xa7, 0x3f, 0x18, 0xc0, 0xc0, 0x67, 0x52, 0x06,
+          0x30, 0xa4, 0x0a, 0xa1, 0xcf, 0x39, 0xa7, 0xbb, 0xdb, 0x36, 0x31, 0xe6, 0x32, 0x1e, 0xec, 0x79, 0x17, 0x9b, 0xfa, 0xae, 0x2e, 0xc5, 0x06, 0x60,
+          0x48, 0xb9, 0x05, 0xaa, 0xdd, 0xdd, 0xf1, 0xf0, 0x8d, 0x5c, 0x87, 0xb7, 0xed, 0x46, 0x35, 0xe0, 0x20, 0xd2, 0x67, 0x25, 0x1b, 0xed, 0x51, 0xc5,
+          0x1e, 0xdb, 0x01, 0x14, 0xa3, 0x0c, 0x86, 0x5a, 0x7c, 0x12, 0x42, 0x45, 0x38, 0x1e, 0xfe, 0xa8, 0x3b, 0xe8, 0x60, 0x22, 0x73, 0xf6, 0x46, 0xe9,
+          0xb4, 0x42, 0xdf, 0xff, 0xcd, 0xe6, 0xbb, 0x91, 0xaa, 0xbe, 0x1f, 0x37, 0x47, 0xac, 0x5e, 0xcb, 0x67, 0x71, 0x62, 0x02, 0x99, 0x2e, 0xa9, 0x10,
+          0xd4, 0xf1, 0x87, 0x3c, 0xbb, 0xa3, 0xdd, 0x80, 0x51, 0x0b, 0x5d, 0x42, 0xbb, 0x06, 0xeb, 0xf2, 0x5d, 0xea, 0x41, 0x41, 0xf1, 0x29, 0x82, 0x75,
+          0x07, 0xfa, 0x6a, 0x00, 0x48, 0x20, 0x6d, 0xe2, 0x0c, 0x88, 0x8e, 0xb9, 0x43, 0x2b, 0x37, 0x20, 0xac, 0x6d, 0x05, 0xf6, 0xe6, 0x3c, 0xc7, 0x80,
+          0x4f, 0xa5, 0x4c, 0x5f, 0xf6, 0x77, 0xa1, 0x76, 0x4b, 0x25, 0x4c, 0x22, 0x00, 0x38, 0x78, 0x75, 0x8f, 0x54, 0x29, 0x38, 0x6c, 0x59, 0xf1, 0x50,
+          0xd1, 0x63, 0x03, 0x18, 0x69, 0xcf, 0x0c, 0xd0, 0xea, 0x7a, 0x60, 0x8d, 0x1a, 0xba, 0xbf, 0x9d, 0x94, 0x20, 0xdb, 0x59, 0x2b, 0x0d, 0x15, 0x89,
+          0xd0, 0xe5, 0x83, 0xe6, 0x90, 0x42, 0x2b, 0x0a, 0xfb, 0xdf, 0xdb, 0x35, 0x74, 0x61, 0x86, 0xd4, 0xe0, 0xa1, 0xbc, 0x21, 0xa4, 0x89, 0x7a, 0x3e,
+          0x03, 0x98, 0x6f, 0x97, 0x81, 0x1b, 0x56, 0xd6, 0xa9, 0x7c, 0x30, 0x15, 0xb5, 0xa7, 0xe0, 0x93, 0x12, 0xca, 0x23, 0x24, 0x60, 0x0c, 0xd6, 0x4b,
+          0x2d, 0x8a, 0xab, 0x71, 0xc0, 0x78, 0xf8, 0x6e, 0x4c, 0x18, 0xfe, 0x26, 0x39, 0x0b, 0xc7, 0x68, 0x81, 0x1c, 0x19, 0x34, 0x76, 0x06, 0x28, 0x10,
+          0xb6, 0x18, 0xef, 0xd9, 0xad, 0x73, 0xcd, 0x58, 0xcc, 0xb8, 0xa3, 0x4e, 0xd8, 0xfb, 0xe7, 0x0c, 0x70, 0x67, 0x8f, 0x61, 0xe3, 0xd8, 0x60, 0x2d,
+          0xaf, 0x3d, 0xa9, 0xa0, 0x44, 0x2a, 0xd5, 0x97, 0x4f, 0xb3, 0x43, 0x08, 0xe5, 0xe1, 0x26, 0x00, 0xea, 0x84, 0x22, 0x42, 0x74, 0xdf, 0xec, 0xd0,
+          0xd0, 0xc1, 0xe9, 0xbd, 0x19, 0x2c, 0x32, 0x62, 0x01, 0x42, 0xe3, 0xc6, 0xf7, 0xbc, 0xa5, 0x6b, 0x8e, 0x58, 0x77, 0x7d, 0x0f, 0x20, 0x08, 0x41,
+          0x97, 0x3c, 0x29, 0xf6, 0x3e, 0x2b, 0x41, 0x78, 0x4f, 0xba, 0xb8, 0x96, 0x07, 0xe2, 0x85, 0xfa, 0x6c, 0xe5, 0xd4, 0xa1, 0x7e, 0x8d, 0x14, 0x85,
+          0x3e, 0xd9, 0x90, 0xb5, 0xba, 0x85, 0xae, 0x36, 0x77, 0xaf, 0x13, 0x4c, 0x8b, 0x0e, 0x3e, 0x7c, 0x1c, 0xe2, 0xcb, 0xd4, 0xc1, 0x56, 0xeb, 0x37,
+          0x33, 0xaa, 0x8b, 0x05, 0x9a, 0xfe, 0xe0, 0x8f, 0x34, 0xa9, 0xf6, 0x15, 0x12, 0x95, 0xe2, 0xfe, 0x0e, 0x3c, 0xdd, 0x41, 0x1c, 0x45, 0x49, 0xe3,
+          0xfd, 0xf4, 0xec, 0x44, 0xd5, 0xd0, 0xaa, 0x7d, 0xda, 0xd0, 0xe2, 0x4e, 0xdc, 0x58, 0x38, 0x67, 0xbf, 0xba, 0x9c, 0x36, 0xd3, 0x7f, 0xfb, 0xa2,
+          0x8a, 0xfc, 0xd3, 0x55, 0xc0, 0xf9, 0xe7, 0x64, 0x1f, 0x98, 0x25, 0x4b, 0x08, 0xd3, 0x42, 0x1d, 0x8b, 0xa1, 0x87, 0xd1, 0x9e, 0x00, 0xe3, 0x9f,
+          0xc5, 0x71, 0x7d, 0xe1, 0x17, 0xf6, 0xa2, 0x84, 0x5f, 0x96, 0x1d, 0x55, 0x53, 0xc4, 0x07, 0xf1, 0xd4, 0x24, 0x12, 0x26, 0x55, 0x81, 0xa8, 0x97,
+          0x59, 0x33, 0xbc, 0x14, 0xed, 0x1c, 0xa9, 0xb8, 0x32, 0x66, 0xd4, 0xe8, 0x5e, 0xa5, 0xa0, 0xb7, 0x78, 0x7a, 0x14, 0x4a, 0x55, 0xee, 0x65, 0x99,
+          0xc6, 0x47, 0xc8, 0x3e, 0xcc, 0x93, 0x2d, 0x53, 0x6f, 0x9d, 0x25, 0xf6, 0xde, 0x74, 0x18, 0x43, 0x78, 0x6c, 0x2f, 0x5f, 0xfa, 0x3e, 0xf6, 0x53,
+          0x04, 0x89, 0xcb, 0xdf, 0xce, 0x0b, 0xec, 0x7f, 0xfc, 0x68, 0x69, 0xdb, 0xc7, 0xa7, 0xa3, 0xb5, 0x4b, 0x17, 0x27, 0xe0, 0x4a, 0x7a, 0x50, 0x33,
+          0x46, 0xfa, 0xd3, 0x36, 0x63, 0xe0, 0x5b, 0xd7, 0xb5, 0x6a, 0x90, 0x81, 0xbf, 0x1f, 0x56, 0xef, 0x75, 0x9b, 0xdc, 0xe3, 0xa5, 0x77, 0x6b, 0x74,
+          0xdd, 0x58, 0xb3, 0xf2, 0x88, 0xff, 0x85, 0xc5, 0x46, 0xea, 0xd3, 0xe3, 0x03, 0x27, 0x67, 0x32, 0xdc, 0xf3, 0x08, 0xcc, 0xc2, 0x57, 0x63, 0xbe,
+          0x81, 0x31, 0x46, 0xa3, 0x34, 0x31, 0x4a, 0x94, 0x31, 0x2d, 0x41, 0xf2, 0xbe, 0xd1, 0x01, 0x0f, 0xd2, 0xa2, 0xca, 0x97, 0xbb, 0x5f, 0xf4, 0x8f,
+          0x8a, 0xc8, 0x2a, 0x49, 0x1c, 0x74, 0x67, 0x39, 0xa9, 0x17, 0xaa, 0x1a, 0xe7, 0x6a, 0x43, 0x80, 0x1c, 0x5e, 0x5d, 0xab, 0x11, 0x83, 0x1f, 0x3e,
+          0xb7, 0x9c, 0xa9, 0x7f, 0xfb, 0xa5, 0xde, 0x9e, 0xd4, 0xa2, 0x45, 0xfa, 0xfe, 0xdd, 0xe7, 0x8e, 0xda, 0x16, 0xe6, 0x0c, 0x5b, 0x99, 0x62, 0xaa,
+          0xaf, 0x13, 0x8a, 0x84, 0x02, 0x75, 0x1e, 0x6f, 0xc1, 0xcf, 0xc7, 0xe4, 0xe1, 0xf8, 0x06, 0x13, 0x4a, 0x6c, 0xa0, 0xb3, 0xec, 0xbc, 0xb7, 0x84,
+          0x34, 0xfe, 0x10, 0x96, 0xab, 0xfa, 0xb5, 0xbd, 0xa2, 0x84, 0x9d, 0xb6, 0xc3, 0xea, 0xe6, 0xea, 0xd3, 0x18, 0xf9, 0x26, 0x95, 0x3f, 0xfa, 0xf8,
+          0xaa, 0xc9, 0xb2, 0xdb, 0xe4, 0xc6, 0x43, 0x23, 0x5a, 0x08, 0xbd, 0x75, 0xce, 0x7e, 0x9f, 0x5e, 0xe5, 0xa0, 0xa7, 0x30, 0x8e, 0xe6, 0x57, 0x71,
+          0xca, 0xd8, 0xba, 0x2f, 0xbf, 0x24, 0xb8, 0x84, 0xed, 0x83, 0x14, 0x28, 0x4e, 0x67, 0xea, 0x3a, 0xec, 0x48, 0x16, 0x0f, 0x3c, 0x68, 0x00, 0x3c,
+          0x2a, 0x75, 0x0e, 0x29, 0x5a, 0x6d, 0xe9, 0x54, 0x0a, 0xe0, 0xc5, 0x75, 0x8a, 0xe8, 0x52, 0x42, 0xd1, 0x71, 0x21, 0x25, 0x79, 0x1d, 0xa3, 0x4d,
+          0x9d, 0x33, 0xf2, 0xcf, 0x43, 0x6b, 0x0f, 0x5f, 0xce, 0xc7, 0xbe, 0x51, 0xb3, 0x20, 0x3b, 0x78, 0x7d, 0x10, 0x77, 0x76, 0xfd, 0x8f, 0xc6, 0x7f,
+          0x14, 0x27, 0x10, 0x1a, 0xb2, 0x6a, 0x0d, 0x21, 0x11, 0x16, 0xf7, 0xa6, 0x1a, 0x78, 0xfa, 0x0a, 0x6c, 0x45, 0xdd, 0x3a, 0xc5, 0x40, 0x2e, 0xff,
+          0xe9, 0x1d, 0xbe, 0xc6, 0x66, 0x6c, 0x5b, 0x5a, 0x9d, 0x12, 0xfd, 0x8c, 0x77, 0x35, 0x2e, 0x25, 0x60, 0x65, 0x12, 0xff, 0x58, 0xfc, 0xee, 0x73,
+          0x8e, 0x16, 0xdd, 0x7e, 0x50, 0xac, 0xac, 0x84, 0x4e, 0x13, 0x57, 0xd2, 0x8f, 0x88, 0xa6, 0x2d, 0xa9, 0xf1, 0x42, 0xc6, 0x8b, 0x4f, 0xba, 0x67,
+          0x16, 0xa7, 0xf5, 0x37, 0x8a, 0x49, 0x7a, 0x5c, 0xc6, 0xaf, 0x4f, 0xb1, 0x98, 0x6a, 0x3f, 0x57, 0x10, 0x80, 0xa0, 0x76, 0xce, 0x4e, 0x8f, 0x78,
+          0x81, 0xaf, 0xb1, 0x79, 0x3f, 0xb4, 0x9d, 0x59, 0xf7, 0xf6, 0x6d, 0x85, 0x15, 0xf3, 0xf8, 0xac, 0x74, 0x73, 0xf1, 0x03, 0x37, 0xad, 0x0c, 0xc7,
+          0xe7, 0x5b, 0x4f, 0xe5, 0x1f, 0x7b, 0x69, 0xdf, 0x58, 0x01, 0x3b, 0xfc, 0x32, 0x0a, 0x9e, 0xd4, 0x8c, 0xbf, 0x99, 0xd3, 0x54, 0x94, 0x9f, 0xfd,
+          0x62, 0xb3, 0xf9, 0x8b, 0x7d, 0xcc, 0x84, 0x3d, 0x72, 0x30, 0x8b, 0x39, 0xa4, 0xaa, 0x7a, 0x77, 0x16, 0xf3, 0x9a, 0xce, 0xd0, 0x20, 0xfb, 0x22,
+          0xc0, 0x60, 0x15, 0x4e, 0xc6, 0x5c, 0x77, 0x4a, 0x5b, 0xa1, 0x59, 0xba, 0x1b, 0xa4, 0x17, 0x92, 0x97, 0x75, 0x8e, 0xa8, 0xff, 0x59, 0x5d, 0xad,
+          0x38, 0x98, 0x6a, 0xc1, 0xd7, 0x9c, 0x4a, 0x62, 0x9e, 0x90, 0x17, 0xf6, 0x9e, 0x8d, 0x72, 0xa8, 0x73, 0xde, 0x5f, 0x09, 0xee, 0xcd, 0x97, 0xb3,
+          0x08, 0x02, 0xd2, 0x33, 0x15, 0x66, 0x39, 0xfd, 0xa5, 0x55, 0xf7, 0x37, 0x60, 0x0f, 0x71, 0xfe, 0x6e, 0x8b, 0x42, 0xbe, 0x70, 0xb4, 0xaf, 0x2d,
+          0x88, 0x69, 0x38, 0xb3, 0x4c, 0x29, 0xb5, 0x75, 0xb2, 0xa6, 0xa2, 0x19, 0x9d, 0xea, 0x31, 0xf9, 0x75, 0xdc, 0x7c, 0xd9, 0xaa, 0x8e, 0xc2, 0x4f,
+          0x4c, 0xf1, 0x2b, 0xbe, 0x3f, 0x23, 0x8d, 0xb8, 0xc8, 0xe8, 0xac, 0x92, 0x2e, 0x7e, 0x4f, 0xa1, 0xea, 0x1f, 0xd0, 0x96, 0x58, 0xad, 0xd2, 0xb5,
+          0xea, 0x4f, 0xcc, 0x69, 0xe9, 0x10, 0x06, 0x96, 0x2e, 0x95, 0x84, 0x6c, 0x75, 0xeb, 0x73, 0x89, 0x8b, 0x6e, 0x45, 0xed, 0x21, 0xa7, 0xff, 0x01,
+          0xcf, 0xca, 0x55, 0x38, 0x7a, 0x87, 0x93, 0xce, 0xc9, 0x01, 0x9b, 0xf0, 0xd2, 0x8b, 0x3e, 0xb8, 0x0e, 0x20, 0x7a, 0xad, 0xea, 0x3a, 0xb1, 0xcf,
+          0xe5, 0x58, 0xe0, 0xd5, 0xdb, 0x52, 0xba, 0x6a, 0x24, 0x2c, 0x66, 0x29, 0x5e, 0xe9, 0x14, 0x80, 0xd3, 0x0d, 0x85, 0x5b, 0x65, 0x7b, 0x06, 0x4e,
+          0x8c, 0x20, 0xc0, 0x7b, 0xc3, 0x32, 0x2b, 0x4d, 0xce, 0xae, 0x27, 0x20, 0x88, 0x0c, 0x61, 0x60, 0xbf, 0xc6, 0x13, 0xf3, 0xdd, 0xcf, 0xef, 0x6c,
+          0x00, 0xfb, 0xbb, 0xc0, 0x60, 0xe3, 0x16, 0xcb, 0xfa, 0x17, 0xca, 0x93, 0x61, 0x70, 0x4f, 0xce, 0x15, 0x5f, 0x86, 0x64, 0x42, 0x65, 0xbf, 0x52,
+          0x62, 0xbf, 0x66, 0x77, 0x51, 0xb8, 0xdb, 0x61, 0x4a, 0xb1, 0x0d, 0x5b, 0xaa, 0xac, 0xf4, 0x7c, 0xc3, 0x03, 0xa2, 0x75, 0x78, 0x2c, 0x80, 0x19,
+          0x48, 0xb3, 0xdd, 0xad, 0x92, 0xf3, 0x62, 0x4c, 0x69, 0xec, 0x9b, 0x8a, 0x20, 0x30, 0x65, 0x97, 0xc8, 0x85, 0x9c, 0x1f, 0x26, 0xf8, 0x21, 0x62,
+          0x86, 0x14, 0x5a, 0x33, 0xfd, 0x94, 0x2d, 0xd0, 0x37, 0x3f, 0x58, 0x10, 0xf0, 0xba, 0x09, 0xf9, 0x76, 0x32, 0x33, 0xa2, 0xd9, 0xa8, 0x53, 0xe7,
+          0xbe, 0x46, 0x81, 0xc3, 0x40, 0xa6, 0xeb, 0x15, 0x8f, 0x43, 0xa2, 0xae, 0x65, 0xb6, 0xb6, 0x66, 0x4a, 0xcd, 0xbb, 0x3b, 0x3f, 0x89, 0x80, 0x05,
+          0xa1, 0x83, 0x3f, 0x52, 0xf3, 0x4e, 0x95, 0x08, 0x5d, 0x70, 0x1d, 0x0e, 0x54, 0x94, 0x58, 0x1d, 0xd5, 0x06, 0xfc, 0xfc, 0x77, 0x4a, 0x10, 0x18,
+          0xf5, 0xb9, 0x71, 0x46, 0x7d, 0x43, 0x52, 0xa0, 0x1d, 0x6b, 0x9f, 0x36, 0xe8, 0xd7, 0x42, 0x0d, 0xcb, 0x09, 0x54, 0xb2, 0xdd, 0xe6, 0x12, 0xbf,
+          0x63, 0xc3, 0xa1, 0x71, 0x4e, 0x33, 0xbc, 0x36, 0xa8, 0x67, 0xbf, 0x22, 0xb1, 0x3b, 0xaa, 0x92, 0x69, 0x6e, 0x46, 0x01, 0x67, 0x86, 0xf7, 0xc2,
+          0xf6, 0x22, 0x62, 0xf8, 0xdf, 0x39, 0x95, 0x45, 0x2d, 0x11, 0x86, 0xb9, 0x32, 0x09, 0xc2, 0xf1, 0x6b, 0xd9, 0xd4, 0xe0, 0x65, 0xd7, 0xfd, 0xad,
+          0xa9, 0xe2, 0x91, 0xab, 0x41, 0x9e, 0x0e, 0xfa, 0xe1, 0x2b, 0x2b, 0xc5, 0x8e, 0xee, 0xd9, 0x4f, 0x92, 0x38, 0x3e, 0xfb, 0xed, 0x0c, 0x33, 0xfe,
+          0xc5, 0x7b, 0x10, 0x2b, 0xc2, 0x2e, 0xff, 0x39, 0x54, 0xd9, 0xea, 0x90, 0x25, 0xc6, 0xb0, 0x1f, 0x44, 0x5b, 0xe3, 0x9b, 0x13, 0x8c, 0x03, 0xbb,
+          0x73, 0xee, 0x08, 0x55, 0xd6, 0x5a, 0x2c, 0x9d, 0x92, 0xb8, 0x7d, 0x95, 0xad, 0x78, 0xe9, 0xfd, 0x16, 0x71, 0xc0, 0xeb, 0xcb, 0x8d, 0x54, 0xb9,
+          0xb2, 0xf3, 0x0b, 0x35, 0xea, 0xaa, 0xeb, 0xb7, 0xff, 0x64, 0x6c, 0x18, 0x5b, 0x7a, 0x70, 0x5c, 0x6b, 0x2c, 0xb7, 0x18, 0xd9, 0x60, 0x86, 0xdc,
+          0x8a, 0x0a, 0x46, 0xe5, 0x50, 0x38, 0x60, 0xf1, 0xc2, 0x39, 0x43, 0xef, 0x8b, 0x38, 0x64, 0xd7, 0xdf, 0x64, 0xbe, 0x10, 0xdb, 0x10, 0xdb, 0xb0,
+          0xc7, 0x08, 0x28, 0x2d, 0xe8, 0x3b, 0xe9, 0x33, 0xd5, 0xed, 0x8e, 0x88, 0xd1, 0xc4, 0xfa, 0xa3, 0x77, 0xfe, 0x33, 0xca, 0xe3, 0xed, 0xaa, 0x72,
+          0x94, 0xdb, 0x9b, 0x1a, 0x00, 0xdd, 0x93, 0xc3, 0x71, 0x6f, 0xf8, 0x91, 0x75, 0x52, 0xe3, 0xf3, 0xdb, 0x0b, 0xaf, 0xab, 0x78, 0x17, 0xfa, 0xbc,
+          0x11, 0x67, 0xa9, 0xce, 0x3f, 0x73, 0x5c, 0xf3, 0x8e, 0x80, 0x81, 0x02, 0x52, 0xf5, 0x4a, 0x6c, 0x12, 0x21, 0xe0, 0x51, 0x2e, 0x17, 0xe5, 0xdd,
+          0x3f, 0x89, 0x67, 0x2d, 0xac, 0x58, 0x89, 0x64, 0xb0, 0x53, 0x04, 0x0b, 0xb6, 0x56, 0x9a, 0x24, 0x18, 0x0e, 0x0d, 0x98, 0xcf, 0x91, 0x41, 0x04,
+          0x18, 0x82, 0xbb, 0xf2, 0x04, 0x64, 0xb1, 0x7e, 0x11, 0x78, 0x8a, 0xf6, 0xd4, 0x85, 0x93, 0x22, 0x48, 0xe5, 0x4b, 0xf0, 0x25, 0x15, 0x2a, 0xf7,
+          0xe0, 0x32, 0xbd, 0xb9, 0x21, 0xa6, 0x9c, 0x10, 0xad, 0xf8, 0xb4, 0x25, 0xa3, 0x1e, 0x28, 0x93, 0x31, 0x1c, 0xe2, 0x24, 0x18, 0xd7, 0x4f, 0x0f,
+          0xb7, 0x68, 0x88, 0x3d, 0xf8, 0xe2, 0xf2, 0xdf, 0xb7, 0xf3, 0xad, 0xa7, 0x7d, 0x9d, 0x26, 0x63, 0xc4, 0x56, 0x9b, 0x8b, 0xa1, 0x80, 0x4c, 0xb7,
+          0x2e, 0x1b, 0x20, 0x59, 0xbb, 0xb2, 0x0b, 0x7d, 0xe8, 0xb8, 0x6c, 0x86, 0x1b, 0x0a, 0xb8, 0x18, 0xa9, 0x6b, 0x86, 0x19, 0x8a, 0xe9, 0x4a, 0x8b,
+          0x66, 0x62, 0x5e, 0xf8, 0xa8, 0x42, 0x8f, 0xf1, 0xc9, 0x25, 0x27, 0xe0, 0xc9, 0x1d, 0xe1, 0x71, 0xf3, 0x6f, 0x11, 0x3e, 0x6a, 0xc6, 0xd3, 0xcd,
+          0x61, 0x45, 0x8d, 0x1c, 0x10, 0x83, 0xa8, 0x43, 0x6d, 0xd7, 0x08, 0x25, 0xf1, 0xb1, 0x34, 0x80, 0x25, 0xdb, 0xed, 0x97, 0x01, 0x3b, 0x92, 0x21,
+          0x4b, 0xe5, 0x20, 0x67, 0x00, 0x1b, 0xae, 0xc0, 0x32, 0xa4, 0x87, 0xcb, 0x18, 0x3c, 0xb5, 0x55, 0x92, 0x5f, 0xea, 0x69, 0x4d, 0xb8, 0x96, 0x23,
+          0xf1, 0x1b, 0xff, 0x4f, 0xdf, 0xf4, 0x73, 0x91, 0x7c, 0xfa, 0x87, 0x62, 0xf6, 0x80, 0xcb, 0x9c, 0xef, 0x7a, 0x68, 0x1d, 0x2b, 0x27, 0xd8, 0xd3,
+          0xcf, 0x95, 0x9b, 0x69, 0xa7, 0x57, 0xe4, 0x6f, 0x08, 0xd0, 0xa5, 0x03, 0xe8, 0x4e, 0xc0, 0xbe, 0xd4, 0xaf, 0xac, 0x32, 0x31, 0x18, 0x71, 0xc4,
+          0x9b, 0x94, 0xaf, 0xe5, 0x29, 0xa9, 0x23, 0x66, 0x09, 0xd1, 0x4d, 0x7d, 0xe3, 0x26, 0x2a, 0x22, 0xfc, 0xe4, 0x38, 0xf6, 0x63, 0x13, 0xa8, 0x7e,
+          0x9c, 0x12, 0x49, 0x57, 0x29, 0x3a, 0x66, 0x48, 0x76, 0xf1, 0xbf, 0xed, 0xf8, 0x45, 0x09, 0xa4, 0xdd, 0x43, 0x16, 0x26, 0xcc, 0x7a, 0xe7, 0x24,
+          0x1f, 0x3b, 0xd9, 0xb9, 0x1b, 0xbf, 0xe2, 0x01, 0xe9, 0xe6, 0x20, 0x41, 0x49, 0x47, 0xeb, 0x3d, 0xe2, 0x46, 0x00, 0xc4, 0x9a, 0xf9, 0xce, 0x30,
+          0xe5, 0x5d, 0x0f, 0xef, 0x70, 0x51, 0xfe, 0xcc, 0xbc, 0x9f, 0x2f, 0x79, 0x69, 0x1b, 0x60, 0xe8, 0x2f, 0x41, 0x24, 0x94, 0x1c, 0x1b, 0x1e, 0x72,
+          0x5f, 0x44, 0x58, 0x06, 0x80, 0x77, 0xed, 0x73, 0xf4, 0x84, 0x57, 0xaf, 0x2b, 0xe4, 0x7b, 0xf9, 0xc9, 0x5b, 0x86, 0x98, 0x5b, 0xe7, 0xbd, 0x19,
+          0xb6, 0x4d, 0xf6, 0x96, 0x3f, 0x45, 0x19, 0xf5, 0x2a, 0x8b, 0x88, 0xa0, 0xa6, 0x35, 0x48, 0x9b, 0x09, 0x51, 0x8d, 0xb2, 0x51, 0x6b, 0x85, 0xea,
+          0xa0, 0xce, 0xc6, 0xb0, 0xd9, 0x53, 0x93, 0x36, 0xca, 0x85, 0x54, 0x99, 0x6c, 0xa3, 0x29, 0xc0, 0xf5, 0xfe, 0x01, 0xe0, 0x45, 0x6b, 0x7a, 0x7c,
+          0x9d, 0x5b, 0xae, 0xad, 0xea, 0x2e, 0x10, 0xa1, 0xba, 0x4c, 0xd4, 0x31, 0x33, 0x70, 0x72, 0x29, 0x28, 0x5d, 0x37, 0x90, 0x7c, 0x8d, 0x99, 0x14,
+          0x58, 0x8b, 0x83, 0xae, 0x77, 0x07, 0x36, 0x01, 0x41, 0xca, 0xba, 0xa2, 0x9e, 0x7c, 0xf0, 0x34, 0x04, 0x05, 0x0a, 0xf5, 0x93, 0x82, 0x8b, 0xd4,
+          0x8d, 0xd5, 0x65, 0x30, 0x19, 0x83, 0xc3, 0x2a, 0xfd, 0x96, 0xe8, 0x85, 0x19, 0xa9, 0xaf, 0x4f, 0x95, 0x58, 0xe4, 0xa1, 0xc5, 0x82, 0xa0, 0x72,
+          0x22, 0x37, 0x42, 0x65, 0xf7, 0x41, 0x3a, 0xe4, 0x3d, 0x30, 0x25, 0xd9, 0x69, 0xda, 0x80, 0xe9, 0x1d, 0xc5, 0xbb, 0xd0, 0x38, 0x3a, 0x64, 0xe1,
+          0x0c, 0x48, 0x72, 0xe2, 0xa4, 0x07, 0x59, 0xd8, 0x9f, 0xda, 0x5e, 0xe2, 0xde, 0x5b, 0xed, 0xe0, 0x5f, 0x06, 0xc6, 0x36, 0x22, 0x94, 0xae, 0x6f,
+          0xea, 0x50, 0x2c, 0xac, 0xcf, 0xb5, 0x73, 0x65, 0xdb, 0xe0, 0x0c, 0x44, 0xe3, 0x8b, 0xe2, 0x65, 0xe8, 0xf0, 0xb1, 0xeb, 0xbb, 0x72, 0x62, 0x94,
+          0xf9, 0x8a, 0x6b, 0xfe, 0x0a, 0x35, 0x61, 0x77, 0x4f, 0x8e, 0x64, 0xc7, 0x0b, 0xec, 0x5b, 0x9a, 0x92, 0x04, 0x8b, 0x10, 0x53, 0x23, 0x2e, 0x18,
+          0x75, 0x0b, 0x1b, 0xd3, 0x01, 0x1e, 0xa5, 0x18, 0xb9, 0xfb, 0x5f, 0x1a, 0x48, 0xc2, 0xa8, 0x9e, 0xf1, 0x2b, 0x43, 0x2c, 0x78, 0xc3, 0x5d, 0xf9,
+          0x81, 0xb9, 0x83, 0x3f, 0xa4, 0xaa, 0xac, 0xed, 0xdd, 0x6d, 0x36, 0x61, 0x1b, 0x8c, 0x5f, 0xfd, 0xba, 0x2b, 0x8c, 0x02, 0x37, 0xdc, 0xcd, 0x3b,
+          0xdb, 0xaa, 0x94, 0xe7, 0xf0, 0x2c, 0xb3, 0xc6, 0xa1, 0xd5, 0x42, 0x12, 0x27, 0xb6, 0x48, 0xaa, 0xe9, 0x13, 0xd2, 0x49, 0x79, 0xbe, 0x94, 0x29,
+          0x5a, 0xa2, 0xb7, 0xbd, 0xc0, 0x1b, 0xed, 0x8b, 0xbb, 0xc5, 0x98, 0xaa, 0xb9, 0xa0, 0x22, 0xf3, 0x90, 0xdd, 0x12, 0xcd, 0xd6, 0x61, 0x3b, 0x0b,
+          0x57, 0xbe, 0xb1, 0xbb, 0x8a, 0xcc, 0x01, 0xbf, 0x26, 0xa0, 0x7c, 0xa1, 0xf6, 0x7c, 0xfb, 0x0e, 0x4b, 0xfe, 0xe4, 0xf3, 0xae, 0xf3, 0x33, 0xd3,
+          0x3b, 0x50, 0xe9, 0x6f, 0x40, 0xfb, 0x1a, 0x89, 0xaa, 0xce, 0x6d, 0xe5, 0xd0, 0xce, 0x52, 0x76, 0x07, 0x6d, 0x43, 0xb7, 0x57, 0x5e, 0x2a, 0xfd,
+          0xfb, 0x2a, 0x2f, 0xc6, 0x97, 0x87, 0x3a, 0x33, 0xc1, 0x9d, 0x2c, 0x6f, 0x3c, 0x33, 0xc0, 0x3d, 0xe2, 0xd2, 0x46, 0xab, 0xfc, 0xe2, 0x43, 0x2c,
+          0xde, 0x45, 0x40, 0x53, 0xe1, 0xe5, 0x35, 0x6e, 0x2d, 0xa0, 0x85, 0x3a, 0xb7, 0x0b, 0x69, 0xf9, 0x6e, 0x48, 0x92, 0xb3, 0x7b, 0xdb, 0xd2, 0x42,
+          0x5e, 0xdc, 0x07, 0x0d, 0xfb, 0x5a, 0x7b, 0x01, 0x45, 0x73, 0xab, 0xb5, 0xe4, 0x7e, 0x4f, 0x86, 0x3b, 0xef, 0x94, 0x12, 0xb7, 0xd6, 0xb8, 0x64,
+          0x27, 0x9c, 0xc8, 0x8e, 0x8f, 0xbb, 0x71, 0x4b, 0xaa, 0xe0, 0xd0, 0x06, 0xf6, 0xd3, 0xe4, 0x2c, 0x62, 0x26, 0x36, 0x8f, 0x6c, 0xa4, 0x9f, 0x1e,
+          0x4e, 0x2b, 0x53, 0xbd, 0x79, 0xf0, 0xc1, 0xa6, 0x6d, 0x30, 0x2b, 0x03, 0xed, 0x93, 0x49, 0xbc, 0x17, 0x2b, 0xc7, 0x85, 0xcb, 0x31, 0xf5, 0xde,
+          0x18, 0x5f, 0xee, 0x73, 0x87, 0xd8, 0x10, 0x7c, 0x2b, 0x3e, 0xae, 0x48, 0x42, 0x8e, 0x91, 0xde, 0x92, 0xc0, 0x39, 0xed, 0x63, 0xb3, 0x48, 0xb0,
+          0x5c, 0x8c, 0xea, 0xb8, 0x28, 0xb8, 0xc4, 0x7c, 0x3d, 0x76, 0x3d, 0xbe, 0xe2, 0x7c, 0x23, 0x2b, 0x42, 0x87, 0xab, 0x99, 0x1b, 0xcf, 0x54, 0xc1,
+          0xf6, 0x4c, 0x76, 0x27, 0x23, 0x02, 0x40, 0x1b, 0x02, 0x21, 0x8a, 0x03, 0xfc, 0x0c, 0xf6, 0x0d, 0xb6, 0x3d, 0xfd, 0x12, 0x29, 0x59, 0xad, 0x49,
+          0xb2, 0x71, 0x2e, 0x58, 0x2e, 0x1c, 0x36, 0x03, 0x65, 0x59, 0x8f, 0x87, 0x9e, 0xab, 0x79, 0x43, 0x8d, 0x18, 0xb9, 0xbc, 0x74, 0x70, 0x3e, 0x53,
+          0x2b, 0xf5, 0x1b, 0x51, 0xc8, 0x38, 0xdd, 0x36, 0x15, 0x60, 0xb1, 0x1a, 0x8d, 0x3f, 0x9b, 0xc1, 0x76, 0xd1, 0xe7, 0xfe, 0x46, 0xfc, 0x45, 0x3a,
+          0x50, 0xcd, 0x49, 0x18, 0x98, 0x0f, 0x4e, 0x53, 0x1a, 0x59, 0xcc, 0x66, 0xac, 0x4b, 0x79, 0x19, 0x53, 0x16, 0xeb, 0xd5, 0xd2, 0x8b, 0xe5, 0xb1,
+          0x1a, 0xc0, 0xb2, 0x20, 0x96, 0x67, 0x27, 0xc2, 0x4f, 0xa2, 0x95, 0x28, 0xa6, 0x2c, 0x5f, 0x8d, 0x3f, 0x5b, 0x34, 0xbd, 0x3f, 0xca, 0x54, 0x28,
+          0x15, 0x3f, 0x41, 0xf1, 0xf1, 0x6f, 0x1c, 0x83, 0xd9, 0x43, 0x47, 0xb9, 0xf7, 0xd9, 0xb2, 0x20, 0x93, 0xc9, 0x9e, 0x0f, 0x81, 0x7f, 0x78, 0x38,
+          0xda, 0x24, 0xf8, 0xd8, 0x63, 0xba, 0x2e, 0x65, 0x04, 0xd2, 0x0b, 0xa9, 0xd5, 0xcd, 0xef, 0xfa, 0x09, 0xdc, 0xb2, 0xb6, 0xfd, 0x82, 0x03, 0x03,
+          0x26, 0x32, 0x13, 0x2b, 0x4e, 0x5e, 0x91, 0x4d, 0xfa, 0xf1, 0x24, 0xde, 0xdf, 0xc8, 0x98, 0xff, 0x7c, 0xf3, 0x2d, 0x9e, 0x7b, 0xb4, 0xe4, 0x6b,
+          0xd1, 0x75, 0x29, 0x29, 0x6c, 0x3d, 0x49, 0xab, 0x52, 0x54, 0x64, 0xd7, 0xd5, 0xeb, 0xa3, 0x59, 0x7e, 0xc0, 0xa9, 0x9f, 0x51, 0xd7, 0xc8, 0x9b,
+          0xbf, 0x10, 0x50, 0xa7, 0x47, 0x23, 0x23, 0xa4, 0xf2, 0x35, 0x90, 0x3c, 0xc0, 0xff, 0x8c, 0xcc, 0xea, 0xf7, 0xf2, 0xe5, 0x28, 0x91, 0x3c, 0x52,
+          0x59, 0xb2, 0x42, 0x66, 0x53, 0xbe, 0x81, 0xfe, 0x04, 0x1e, 0xd0, 0xc6, 0xa9, 0xe1, 0xbc, 0xfb, 0x33, 0xa5, 0xca, 0x07, 0x1b, 0x8a, 0xb8, 0x6b,
+          0x65, 0x99, 0x45, 0xb7, 0xe4, 0x09, 0x7a, 0x0c, 0xdc, 0x02, 0x23, 0x46, 0xb8, 0x08, 0x8c, 0xe7, 0x98, 0x37, 0x4e, 0xc2, 0x39, 0xcf, 0xc8, 0x90,
+          0x55, 0xf7, 0x09, 0x47, 0x27, 0x26, 0x39, 0x75, 0xaa, 0x7f, 0x89, 0x1b, 0x36, 0x3b, 0xc6, 0x00, 0xe7, 0x6c, 0x70, 0x1c, 0xc4, 0xc4, 0xd8, 0xe2,
+          0x5e, 0x20, 0xe4, 0xc2, 0x7d, 0x36, 0x32, 0x73, 0x69, 0x2d, 0x22, 0xc4, 0xcd, 0x98, 0xe0, 0x81, 0x18, 0x25, 0xa5, 0x6e, 0x35, 0x86, 0x77, 0x50,
+          0xd5, 0x98, 0x0a, 0xc8, 0x95, 0xcc, 0x43, 0x1a, 0x07, 0x5b, 0x42, 0x93, 0xe0, 0xf1, 0x63, 0x57, 0xa9, 0x70, 0xcf, 0x10, 0xe9, 0xe1, 0x9c, 0xc7,
+          0x6a, 0x1a, 0x11, 0xcc, 0x15, 0xdf, 0xbf, 0x7c, 0x2a, 0x85, 0xc9, 0x1d, 0x0b, 0x0f, 0x86, 0xe0, 0x32, 0x2a, 0x4c, 0x91, 0x87, 0x34, 0xe4, 0x3b,
+          0x3b, 0x00, 0x40, 0x24, 0x0e, 0x63, 0xcd, 0x9e, 0xa4, 0xdc, 0x4d, 0xe1, 0x1c, 0x99, 0x69, 0x5d, 0x9a, 0xf8, 0xfd, 0x8b, 0x10, 0x80, 0x8e, 0xb4,
+          0x29, 0x00, 0x9e, 0x70, 0x61, 0x03, 0x3a, 0x35, 0x76, 0xbc, 0xbf, 0x91, 0xfd, 0x61, 0x2b, 0xdc, 0x33, 0xf0, 0x54, 0x60, 0x8a, 0x99, 0xbf, 0x24,
+          0x0f, 0xbf, 0xd6, 0xef, 0xc0, 0x09, 0xb8, 0x5a, 0xeb, 0xaf, 0xb3, 0xa9, 0x15, 0xaa, 0x21, 0xef, 0x84, 0x99, 0x4e, 0xed, 0xa0, 0x93, 0x3a, 0x2a,
+          0x07, 0x3a, 0x9d, 0x95, 0x63, 0xc7, 0x29, 0xe3, 0xad, 0xe3, 0x4c, 0x25, 0x19, 0x50, 0x7b, 0x03, 0x04, 0x10, 0x6f, 0x06, 0xb1, 0xee, 0xef, 0xee,
+          0x39, 0x9b, 0x44, 0xdb, 0x7a, 0x0b, 0xab, 0x71, 0x1c, 0xbf, 0x1f, 0x4a, 0xbd, 0x1c, 0xb7, 0xe0, 0xec, 0x05, 0x6c, 0xd0, 0x64, 0x46, 0x21, 0xd5,
+          0xb9, 0xb4, 0x13, 0x5e, 0x45, 0xa0, 0xb6, 0x49, 0xc2, 0xf0, 0xac, 0x24, 0x14, 0x3a, 0xa1, 0x04, 0xb4, 0xf8, 0x4c, 0x27, 0x56, 0xe1, 0x19, 0x0e,
+          0x31, 0xd4, 0x58, 0x57, 0x3e, 0xd7, 0xd6, 0xad, 0x95, 0x4a, 0xd3, 0xd0, 0x51, 0xb1, 0x8e, 0xb9, 0xe3, 0x38, 0xb8, 0xc5, 0xe4, 0x65, 0x06, 0x62,
+          0x73, 0xef, 0xe7, 0x82, 0x36, 0x9f, 0x10, 0xfe, 0x51, 0x4f, 0xfc, 0x0a, 0x37, 0x0b, 0xa0, 0x03, 0x0b, 0x62, 0x24, 0xc8, 0xe5, 0x9e, 0x51, 0xff,
+          0xe9, 0x38, 0x6e, 0x56, 0xf8, 0x51, 0x44, 0xee, 0x66, 0xb5, 0x84, 0xcc, 0xb6, 0xd5, 0x17, 0x54, 0xf7, 0x36, 0x80, 0xa6, 0x6d, 0xea, 0x13, 0x8e,
+          0xa0, 0x93, 0x71, 0xae, 0x3b, 0x51, 0x53, 0x1d, 0xbf, 0x69, 0xc2, 0x82, 0xb2, 0xc9, 0x3a, 0xf2, 0xee, 0x5f, 0x66, 0x19, 0xaf, 0x8d, 0xbb, 0x09,
+          0x21, 0xe5, 0x6c, 0xca, 0x2a, 0x78, 0xdc, 0x54, 0xa4, 0x7b, 0x2a, 0x42, 0xf0, 0x63, 0x7a, 0x7a, 0x10, 0x10, 0x22, 0x4b, 0x1c, 0xdf, 0xfb, 0xe8,
+          0x28, 0xb3, 0x01, 0x61, 0x6c, 0x84, 0x27, 0x7a, 0x11, 0xa8, 0x4c, 0xad, 0x9d, 0xc3, 0xf0, 0x1f, 0x5e, 0x0d, 0xb8, 0x41, 0x28, 0xac, 0xc7, 0xff,
+          0x5a, 0x3a, 0x24, 0xe9, 0xa0, 0x67, 0x50, 0xa4, 0x19, 0xbf, 0xb2, 0x2e, 0xe6, 0xcc, 0x1e, 0x75, 0x6a, 0x73, 0x63, 0xd6, 0x68, 0x8b, 0xd6, 0x5f,
+          0xb4, 0xd4, 0x47, 0x4a, 0x71, 0x22, 0xb3, 0x0c, 0x17, 0x78, 0x1f, 0xba, 0x3b, 0xa8, 0x3a, 0x51, 0x45, 0xaf, 0x87, 0x88, 0x7e, 0x4c, 0x1b, 0xfd,
+          0x4c, 0xde, 0x88, 0x30, 0x28, 0x38, 0x44, 0x6e, 0xe9, 0x2b, 0x9c, 0x5c, 0xac, 0x42, 0x89, 0x96, 0xa5, 0x96, 0x78, 0x3a, 0xc0, 0xba, 0x07, 0x77,
+          0xf1, 0xf5, 0x28, 0x8f, 0x63, 0xee, 0x8c, 0xd2, 0x9e, 0x9c, 0x44, 0xf4, 0xef, 0x4a, 0x56, 0x1f, 0x6a, 0x75, 0x26, 0xbc, 0x26, 0xde, 0x67, 0x0f,
+          0x7a, 0xaa, 0x5f, 0x16, 0x50, 0xac, 0xe0, 0x00, 0x02, 0x1f, 0xd2, 0x39, 0x8e, 0x0b, 0x6f, 0x0a, 0x07, 0xeb, 0x0b, 0x68, 0x25, 0x4f, 0xaa, 0x8b,
+          0x58, 0x4b, 0x04, 0xbe, 0x3c, 0x1a, 0xf4, 0x46, 0xec, 0xfb, 0xa5, 0x5a, 0xe2, 0xa8, 0x20, 0x64, 0x8a, 0xf9, 0x4f, 0xa2, 0x08, 0x0a, 0x80, 0x70,
+          0x32, 0xec, 0x5a, 0x2e, 0x35, 0xb4, 0x1c, 0x80, 0x7e, 0x7a, 0x83, 0x9a, 0x65, 0xb0, 0xa4, 0x88, 0xa7, 0xbb, 0xe4, 0xb1, 0xbf, 0xd6, 0xa5, 0x0a,
+          0x30, 0x9b, 0x16, 0xd6, 0xa2, 0x41, 0x11, 0xae, 0xa7, 0x54, 0x04, 0x80, 0xd3, 0x5d, 0xc7, 0xaf, 0x98, 0x38, 0x84, 0xf1, 0xe8, 0x07, 0xfe, 0x87,
+          0xe3, 0x9c, 0xce, 0x3f, 0x6f, 0x1c, 0x87, 0xde, 0x3a, 0x0b, 0xbe, 0xd3, 0x43, 0xbc, 0xba, 0x8d, 0x55, 0xf0, 0x41, 0x23, 0xef, 0xc5, 0x21, 0x00,
+          0x32, 0xe5, 0x85, 0x4a, 0xf2, 0x7d, 0x52, 0x05, 0xa5, 0x06, 0xb7, 0x49, 0xb3, 0xdd, 0xa9, 0xa7, 0xa2, 0x92, 0x48, 0xf8, 0x44, 0x43, 0xd9, 0xe1,
+          0xe2, 0xaf, 0xde, 0x30, 0x54, 0xeb, 0x83, 0xb3, 0x88, 0xa9, 0x26, 0x8e, 0xa4, 0x1b, 0x35, 0x93, 0xea, 0x53, 0xda, 0x14, 0x56, 0xe0, 0x48, 0x72,
+          0xd9, 0x19, 0x95, 0xa1, 0x34, 0xa3, 0x4e, 0x2f, 0x6a, 0xd3, 0x54, 0xba, 0x0c, 0x8c, 0x04, 0x44, 0x24, 0xee, 0xde, 0x5d, 0xdd, 0x97, 0x05, 0x2c,
+          0x32, 0xcb, 0x63, 0x03, 0xea, 0x0f, 0xd0, 0x10, 0xe4, 0x5a, 0xc4, 0xfe, 0x21, 0x91, 0xaf, 0x2b, 0x04, 0xf5, 0x74, 0xf4, 0x0d, 0xb2, 0x99, 0xf3,
+          0x6c, 0xa9, 0x9f, 0x03, 0x5b, 0x37, 0xc3, 0xf2, 0x8a, 0x45, 0x22, 0x4d, 0x36, 0xdb, 0x63, 0xfa, 0xa2, 0xda, 0x8a, 0x39, 0x26, 0x18, 0xc9, 0xdb,
+          0x82, 0x20, 0x13, 0xf9, 0xdc, 0x2c, 0x21, 0xdb, 0x04, 0x7b, 0x28, 0xdf, 0x51, 0x7d, 0x1f, 0xe4, 0xa5, 0x80, 0x12, 0x17, 0x3d, 0xaf, 0xde, 0x90,
+          0x67, 0x08, 0xdd, 0x8b, 0xf7, 0x32, 0x44, 0x7a, 0x88, 0xee, 0x36, 0x73, 0x4e, 0x73, 0xdd, 0x65, 0xe3, 0x72, 0xcf, 0xa4, 0x3d, 0xd4, 0x3c, 0x96,
+          0x2d, 0xfc, 0x5a, 0xe8, 0x79, 0x89, 0xbd, 0xba, 0xdc, 0x1a, 0x10, 0xe1, 0xb2, 0x49, 0xed, 0xb2, 0x55, 0x65, 0x9b, 0x44, 0xb3, 0xc8, 0x0b, 0x09,
+          0x3d, 0xdc, 0x96, 0x62, 0xb2, 0x8c, 0xc4, 0xe4, 0x91, 0x67, 0x15, 0x38, 0xbb, 0x55, 0x73, 0xb5, 0x02, 0xf7, 0x20, 0x0b, 0xf9, 0x32, 0x65, 0x16,
+          0x3d, 0x7d, 0xf5, 0x17, 0x88, 0x7c, 0x44, 0x1f, 0x57, 0xd2, 0xcf, 0x04, 0xc0, 0x9a, 0x66, 0xc9, 0xe5, 0x04, 0x24, 0xa3, 0xcb, 0x01, 0x7d, 0x1f,
+          0x34, 0xea, 0x56, 0xf6, 0x46, 0xfa, 0x0f, 0x9a, 0xcf, 0x84, 0x00, 0x33, 0xa6, 0xfa, 0xca, 0x0d, 0x12, 0xb8, 0x78, 0x9f, 0xea, 0x62, 0x25, 0x1e,
+          0xbc, 0xe9, 0x9f, 0xf6, 0x4e, 0x16, 0x95, 0x16, 0x1f, 0x9f, 0xac, 0x85, 0x6a, 0x61, 0xb7, 0x8c, 0x85, 0x86, 0x84, 0xb6, 0x6d, 0x74, 0x13, 0xdf,
+          0x67, 0x01, 0x44, 0xe4, 0x46, 0x36, 0x35, 0x13, 0xd1, 0x9b, 0x2a, 0xc3, 0x34, 0x11, 0xf3, 0x5c, 0x2b, 0x04, 0x7e, 0x32, 0xe4, 0x3e, 0x34, 0x00,
+          0x4b, 0xda, 0xfc, 0x21, 0x4e, 0x4c, 0xeb, 0xa4, 0x09, 0x20, 0xfa, 0xc1, 0x3e, 0xbd, 0x54, 0xd3, 0xa5, 0x8f, 0xb2, 0xfd, 0x61, 0xe7, 0x90, 0xac,
+          0x2e, 0x3c, 0x0b, 0x1c, 0xe3, 0xba, 0xce, 0xe6, 0x1c, 0x5a, 0x0d, 0x26, 0xb7, 0x19, 0x80, 0x48, 0x27, 0x04, 0xb2, 0xa4, 0xd5, 0xf2, 0x2f, 0x31,
+          0x01, 0xf4, 0xf1, 0x0b, 0xc2, 0x58, 0x6f, 0xab, 0xa7, 0x73, 0x5a, 0xa0, 0x56, 0x63, 0x84, 0x28, 0x88, 0x39, 0x19, 0xdd, 0xbe, 0x55, 0x20, 0x05,
+          0x0f, 0x63, 0xe3, 0x53, 0x31, 0x7f, 0x19, 0xd8, 0x49, 0x05, 0x82, 0xdf, 0xde, 0x49, 0x09, 0x5a, 0xef, 0x29, 0x84, 0x19, 0x00, 0xc1, 0x5e, 0x1b,
+          0x54, 0x80, 0x7f, 0x43, 0xa9, 0xc6, 0x9e, 0x05, 0x84, 0x31, 0x29, 0x78, 0xd5, 0xef, 0x4e, 0x73, 0xeb, 0x99, 0x5c, 0x37, 0x26, 0xa8, 0xec, 0xfb,
+          0x31, 0x19, 0x55, 0x84, 0x2f, 0x8f, 0x19, 0xa1, 0xfc, 0xf2, 0x9a, 0x33, 0xa0, 0xf2, 0x3a, 0x59, 0x80, 0x14, 0x02, 0x03, 0x92, 0x70, 0xf0, 0x5f,
+          0x52, 0x1a, 0xdf, 0xde, 0x8f, 0x9a, 0xf5, 0xf7, 0x01, 0x8f, 0x59, 0x94, 0x02, 0xa5, 0x43, 0x09, 0x7b, 0x84, 0x43, 0x09, 0x71, 0x91, 0xf3, 0x8d,
+          0x43, 0xbd, 0x49, 0x5a, 0x3d, 0xa5, 0x1c, 0xaa, 0xa8, 0xbd, 0xae, 0x7b, 0xbe, 0xc4, 0x64, 0x6b, 0x75, 0x4b, 0x7b, 0xb1, 0xff, 0xc0, 0xef, 0xbf,
+          0x53, 0xfe, 0xb1, 0x1f, 0x7f, 0xee, 0x80, 0x61, 0xef, 0x3e, 0x74, 0x0e, 0xef, 0x35, 0xc4, 0xd2, 0xf0, 0x11, 0xe1, 0x95, 0x5d, 0x65, 0xd8, 0xa3,
+          0x02, 0x5e, 0x26, 0xd8, 0x1e, 0xf1, 0xb9, 0xe3, 0x7c, 0xd4, 0x83, 0x19, 0xe1, 0xa5, 0x41, 0x9c, 0xe2, 0x69, 0x97, 0x10, 0x31, 0xc7, 0x66, 0x64,
+          0x84, 0xd2, 0xbe, 0xc6, 0x32, 0x90, 0x3a, 0x51, 0x66, 0x37, 0xab, 0x58, 0x05, 0xdc, 0x36, 0x9f, 0x64, 0xf2, 0x89, 0x2a, 0xc9, 0x4e, 0xc3, 0x41,
+          0x3c, 0x85, 0x25, 0x28, 0x45, 0x12, 0xef, 0xed, 0x98, 0xe8, 0x32, 0xe1, 0x74, 0x82, 0x0d, 0x68, 0x08, 0x26, 0x8c, 0x58, 0xbc, 0xc8, 0x66, 0x46,
+          0xc4, 0x58, 0xd9, 0x16, 0xb7, 0x79, 0x68, 0x2a, 0xdc, 0x94, 0x4f, 0x4b, 0xb6, 0x75, 0xe1, 0x32, 0x55, 0x75, 0xab, 0x5a, 0x06, 0x59, 0x5b, 0xf7,
+          0xc4, 0xf4, 0x1e, 0x07, 0xfe, 0xb3, 0x39, 0x2d, 0x7e, 0xaa, 0x07, 0x6d, 0x8f, 0x1f, 0x9e, 0x56, 0xd6, 0xa5, 0x7a, 0x2b, 0x82, 0xf8, 0xe4, 0xe3,
+          0x8b, 0xde, 0xb3, 0xe4, 0x75, 0xd1, 0x9f, 0xed, 0x48, 0xa5, 0x6d, 0xb5, 0xb7, 0xd0, 0xab, 0x6f, 0xe9, 0x12, 0x38, 0xd8, 0xec, 0xc5, 0x59, 0xfd,
+          0x8d, 0x06, 0xfb, 0x55, 0x1a, 0x8e, 0x87, 0x09, 0xc2, 0xce, 0x89, 0xf6, 0x98, 0x79, 0xc6, 0xc5, 0x9c, 0x2f, 0x9b, 0xea, 0x92, 0x2a, 0x69, 0x3c,
+          0xd9, 0xab, 0x6d, 0x3d, 0x7b, 0x85, 0x33, 0x36, 0xb6, 0xe6, 0x62, 0x7d, 0x27, 0x90, 0x1e, 0xb4, 0x94, 0x1e, 0xf0, 0x93, 0xa5, 0x4c, 0x83, 0xd1,
+          0x3b, 0x05, 0x36, 0xcd, 0x0c, 0xfd, 0x49, 0x28, 0x17, 0xad, 0x6f, 0x02, 0x6a, 0xb1, 0x43, 0x1e, 0x16, 0x52, 0x1e, 0x38, 0x74, 0x3d, 0x96, 0x40,
+          0xec, 0x00, 0xbd, 0x69, 0x93, 0xc6, 0x61, 0x6b, 0x38, 0x59, 0x4d, 0xfd, 0x0c, 0x5d, 0x14, 0x2d, 0x59, 0x69, 0x68, 0x21, 0xbe, 0x5f, 0x8f, 0x49,
+          0xe3, 0xc3, 0x62, 0x65, 0xb6, 0x15, 0x9c, 0x98, 0xc1, 0xee, 0x0d, 0x00, 0x63, 0xd5, 0x51, 0x28, 0x59, 0xc3, 0x8b, 0x9b, 0xee, 0xb4, 0x75, 0x1c,
+          0x9e, 0x33, 0x79, 0x5f, 0xe8, 0xc2, 0x4f, 0x1a, 0x0a, 0x12, 0x1b, 0xf8, 0x16, 0x95, 0xa9, 0xe5, 0x59, 0xf5, 0xb0, 0x75, 0x1b, 0xd9, 0xe8, 0xe5,
+          0x11, 0x9d, 0x0a, 0x27, 0x44, 0x05, 0x3c, 0xab, 0xea, 0xa2, 0x21, 0xfb, 0x93, 0x81, 0x13, 0x29, 0x6b, 0x14, 0x07, 0x53, 0x19, 0xbc, 0xc5, 0x10,
+          0xb7, 0x0d, 0x88, 0xce, 0xa2, 0x46, 0x42, 0x50, 0xa5, 0xad, 0x3e, 0xdc, 0xba, 0xc3, 0xee, 0xd5, 0x0c, 0x98, 0xb5, 0x66, 0x5a, 0x61, 0xcb, 0x4c,
+          0xc1, 0x83, 0x99, 0x58, 0x38, 0xf7, 0xb3, 0xc4, 0x61, 0x61, 0xbd, 0x86, 0x8d, 0x32, 0xcd, 0xe5, 0x72, 0x72, 0x61, 0x04, 0x56, 0xc5, 0x84, 0xa1,
+          0x1d, 0x5b, 0x1b, 0x5d, 0xc7, 0xf5, 0xb3, 0x80, 0xb7, 0x1c, 0x6d, 0x44, 0xda, 0xad, 0xf5, 0x57, 0x6c, 0x50, 0xff, 0x71, 0x62, 0x90, 0xc5, 0x13,
+          0x38, 0x5d, 0x70, 0xeb, 0x21, 0x85, 0xaf, 0x70, 0xbc, 0xdb, 0x81, 0xb8, 0xac, 0xea, 0xdd, 0x2b, 0x27, 0x6e, 0xc6, 0xca, 0xdb, 0x39, 0xa6, 0x0f,
+          0x53, 0xf7, 0x75, 0x15, 0x0b, 0x15, 0x81, 0x45, 0xaa, 0x2d, 0x31, 0xa3, 0x6d, 0xdc, 0xd8, 0x2e, 0x90, 0x36, 0xd0, 0x9f, 0x19, 0x94, 0x6d, 0x0b,
+          0xea, 0x1f, 0xca, 0xe3, 0x9c, 0x15, 0x07, 0x73, 0xc3, 0x1c, 0xf1, 0x88, 0x1e, 0x86, 0xb0, 0x53, 0x54, 0xe0, 0x8d, 0x19, 0x37, 0xea, 0x60, 0x5e,
+          0x6c, 0x86, 0x89, 0xbd, 0xa9, 0x71, 0xad, 0x0a, 0x92, 0x36, 0xcc, 0xbf, 0xb4, 0xe9, 0x2f, 0x45, 0xee, 0xac, 0x25, 0x24, 0x14, 0x86, 0x4c, 0x86,
+          0x50, 0x3a, 0x18, 0xa8, 0x0d, 0x37, 0x88, 0x33, 0xbd, 0x8f, 0xfc, 0xda, 0xc0, 0x8a, 0xfd, 0x03, 0xf4, 0x91, 0xaf, 0x10, 0xdf, 0xc4, 0x87, 0x62,
+          0x30, 0xc5, 0x30, 0xa2, 0x10, 0x95, 0x5f, 0x43, 0xb0, 0xdc, 0x78, 0x95, 0x60, 0xa4, 0xc2, 0x5f, 0x29, 0xa7, 0x6d, 0xaa, 0xc9, 0x96, 0xc2, 0x9b,
+          0x65, 0xc6, 0xf9, 0x93, 0xe3, 0x0b, 0x2d, 0xc1, 0x2f, 0x32, 0x8e, 0xe2, 0x68, 0xd9, 0x56, 0x3c, 0x7e, 0xa9, 0xdf, 0x6b, 0xb8, 0x58, 0x5d, 0x5a,
+          0x17, 0x63, 0xa5, 0x3f, 0xe8, 0x8e, 0xcd, 0x83, 0x87, 0x21, 0x03, 0x0a, 0x06, 0xbf, 0xfa, 0xa8, 0xc3, 0xd4, 0xbf, 0x86, 0x09, 0xe4, 0x60, 0x87,
+          0x23, 0x4b, 0xc0, 0x7c, 0x50, 0x5f, 0xa2, 0x6f, 0xb7, 0xba, 0x2f, 0x3a, 0x19, 0x63, 0xaf, 0x1a, 0x31, 0x54, 0x5e, 0xa2, 0x64, 0x81, 0x6a, 0x56,
+          0xdc, 0xb2, 0x12, 0x4c, 0xdf, 0xa9, 0x66, 0x7c, 0x44, 0x3c, 0x6a, 0xca, 0x7d, 0x64, 0x43, 0xe4, 0xa9, 0x61, 0x0a, 0xa8, 0x91, 0x7c, 0x06, 0x4a,
+          0xf3, 0x42, 0x3c, 0x4b, 0x39, 0x86, 0x43, 0x37, 0xd4, 0xa1, 0x52, 0x14, 0x31, 0xd8, 0x0e, 0x1a, 0xca, 0x87, 0x8f, 0xa4, 0x23, 0x9d, 0xe5, 0x32,
+          0x24, 0xc0, 0xf1, 0xb1, 0x31, 0x6b, 0xbc, 0xa8, 0xad, 0x9d, 0xac, 0xf2, 0xa2, 0x5b, 0xd9, 0x8e, 0x13, 0xaf, 0x38, 0x5b, 0x26, 0xe6, 0x30, 0xf0,
+          0x90, 0x15, 0x25, 0x63, 0xa2, 0x11, 0x89, 0x51, 0x83, 0xc6, 0x4c, 0x0c, 0x6e, 0x4b, 0xd0, 0x8d, 0x3a, 0xbf, 0x22, 0x52, 0x55, 0x65, 0xb2, 0x75,
+          0x71, 0x23, 0xe1, 0xb2, 0x41, 0xd6, 0x7c, 0x69, 0xa6, 0x6f, 0x37, 0x43, 0xa8, 0xc6, 0xff, 0x4a, 0x60, 0x51, 0xc0, 0xdd, 0xca, 0x4a, 0x4e, 0xca,
+          0xd4, 0xf0, 0xc8, 0xc1, 0x02, 0x0e, 0x2f, 0xf2, 0xed, 0x54, 0xbb, 0x78, 0x90, 0xde, 0x82, 0x6f, 0xe1, 0xcc, 0x13, 0x87, 0xeb, 0xa7, 0xad, 0x0a,
+          0x9b, 0x01, 0xc5, 0x8d, 0x5b, 0x7b, 0x83, 0xf8, 0xaa, 0x0c, 0x7f, 0x8f, 0x05, 0xa7, 0xdb, 0x83, 0xce, 0xad, 0xd6, 0x86, 0x6c, 0x04, 0xdf, 0x0a,
+          0x2d, 0xd4, 0x46, 0x53, 0x24, 0xb2, 0x6f, 0xdf, 0xc2, 0x3a, 0xef, 0x44, 0x16, 0x65, 0xc4, 0x74, 0xd4, 0x70, 0xff, 0x55, 0x0c, 0xc0, 0xe0, 0x8c,
+          0xc6, 0x6a, 0xa9, 0xbe, 0xb8, 0x9c, 0xcf, 0xeb, 0x67, 0x5b, 0xd6, 0xd7, 0x61, 0xfb, 0xff, 0x6a, 0x0d, 0xe4, 0xc0, 0xf0, 0x52, 0x92, 0x05, 0x33,
+          0x3c, 0x57, 0x27, 0xab, 0x48, 0x40, 0xfe, 0x84, 0x4f, 0x79, 0x07, 0xa5, 0x77, 0x26, 0x59, 0x37, 0x01, 0xa6, 0x46, 0xb4, 0x33, 0xe6, 0xc9, 0xda,
+          0x84, 0x83, 0xd4, 0xda, 0xe8, 0x3e, 0x63, 0x57, 0x5b, 0x0b, 0xf9, 0xae, 0x51, 0x0b, 0x53, 0x76, 0xfc, 0xd2, 0x2d, 0x46, 0x0f, 0x90, 0xf1, 0x15,
+          0xaf, 0xf2, 0xd1, 0x14, 0xc2, 0x34, 0x9b, 0x3a, 0xcf, 0x68, 0xbe, 0x41, 0x1b, 0x26, 0xb8, 0x13, 0x3b, 0xf4, 0x47, 0xd1, 0x3d, 0xa2, 0x3d, 0x9b,
+          0xae, 0x62, 0x57, 0x38, 0x1a, 0x45, 0x37, 0xe5, 0x31, 0x75, 0x27, 0xda, 0x89, 0xcd, 0x21, 0x59, 0x65, 0x21, 0xd7, 0x65, 0x0b, 0xd8, 0x6c, 0x2a,
+          0x00, 0x41, 0x4e, 0xea, 0xcb, 0xaf, 0x43, 0x2e, 0x8f, 0xaa, 0xd1, 0x3e, 0x90, 0x85, 0xb2, 0x80, 0x4e, 0x50, 0xde, 0x3a, 0x0c, 0xd4, 0x8f, 0xf7,
+          0x66, 0x45, 0x43, 0x3f, 0xc5, 0xcc, 0x44, 0x1c, 0x31, 0x8b, 0x92, 0x6e, 0xd6, 0x92, 0xd6, 0x96, 0xe7, 0x0f, 0x6e, 0xcb, 0x0a, 0x81, 0x67, 0xb8,
+          0x63, 0x8e, 0x02, 0x35, 0x3d, 0x85, 0x30, 0x9a, 0xce, 0xbf, 0xc1, 0x6b, 0x60, 0xc5, 0x33, 0x4b, 0xdb, 0x52, 0x03, 0xc6, 0xba, 0xde, 0x14, 0x20,
+          0x2b, 0xb1, 0xef, 0xbd, 0xe2, 0x27, 0x8d, 0x97, 0x71, 0xbd, 0x0e, 0x59, 0xfc, 0x6f, 0x72, 0xc2, 0x15, 0x44, 0x87, 0x37, 0x58, 0x21, 0x03, 0x08,
+          0x3d, 0x72, 0x50, 0x83, 0xec, 0x26, 0x5b, 0xa1, 0xdb, 0xfd, 0xa3, 0x1a, 0x54, 0x27, 0x6a, 0xa2, 0x9b, 0xc2, 0xc0, 0x7e, 0xad, 0x13, 0x8e, 0x99,
+          0x01, 0x51, 0xbf, 0xa6, 0x39, 0xf5, 0x36, 0xe4, 0xef, 0xaa, 0x94, 0x5e, 0x8c, 0x12, 0x03, 0x79, 0xdb, 0x09, 0x6b, 0xdc, 0x4f, 0x6b, 0xa2, 0xea,
+          0x67, 0x7c, 0x30, 0xbd, 0x7f, 0xfb, 0x63, 0x2f, 0x2f, 0x1c, 0x06, 0x39, 0x2c, 0xf7, 0xf3, 0xe5, 0x87, 0x20, 0xd7, 0x8c, 0x65, 0x19, 0x31, 0x14,
+          0xbd, 0x29, 0x16, 0xc2, 0x82, 0x10, 0xe8, 0x97, 0x78, 0xce, 0x20, 0x12, 0x97, 0xa2, 0x59, 0x0b, 0x7f, 0xaf, 0x22, 0xb8, 0xcc, 0x2b, 0xce, 0xb1,
+          0x46, 0x95, 0xe5, 0x98, 0x2f, 0xdd, 0x44, 0x67, 0xba, 0xb6, 0xe6, 0xa1, 0x4b, 0x9d, 0x1c, 0x94, 0xd6, 0x20, 0x98, 0xbf, 0xd1, 0x72, 0x7d, 0x05,
+          0x9a, 0x7c, 0xf5, 0xb8, 0xdc, 0x23, 0x89, 0x29, 0xec, 0xac, 0x42, 0xf1, 0x58, 0x07, 0xa8, 0x5a, 0x3e, 0xde, 0xe7, 0x7c, 0x0f, 0x7b, 0x47, 0x5a,
+          0xe1, 0x12, 0x6d, 0x6e, 0x3f, 0xa7, 0x0e, 0xb5, 0xf7, 0x40, 0x76, 0x3e, 0xe0, 0x0f, 0x66, 0x04, 0x88, 0xc4, 0x49, 0x6b, 0x56, 0x0f, 0x6a, 0xdd,
+          0xcc, 0x01, 0x71, 0x29, 0x6f, 0x08, 0x0d, 0xda, 0xd5, 0xaf, 0xcf, 0x9d, 0xc1, 0x6a, 0x8b, 0x7d, 0xca, 0x4d, 0x8b, 0x18, 0x23, 0x04, 0x4d, 0x80,
+          0x6c, 0x8d, 0x5e, 0xf9, 0xfe, 0x4c, 0xfc, 0xa6, 0x61, 0x1b, 0x8c, 0x36, 0x3c, 0xda, 0xd4, 0x36, 0x54, 0xf9, 0xea, 0xbb, 0x17, 0xef, 0xb8, 0xc0,
+          0x0f, 0xef, 0xd2, 0xf0, 0xdc, 0x66, 0x77, 0xec, 0x6e, 0x1f, 0x1b, 0x26, 0xb2, 0x9b, 0x60, 0x42, 0x35, 0x31, 0xbb, 0x68, 0x4b, 0x25, 0xd3, 0x82,
+          0x0d, 0xbd, 0xd9, 0xc4, 0x91, 0x39, 0xbe, 0xc8, 0xe7, 0x64, 0x36, 0x42, 0xba, 0x83, 0x18, 0x5d, 0xa7, 0x3e, 0x2a, 0xcc, 0x1d, 0x4c, 0x82, 0x54,
+          0xf0, 0x3a, 0x1d, 0x02, 0x15, 0xd3, 0x26, 0x46, 0x58, 0xf3, 0x78, 0x8a, 0xa4, 0x6a, 0x99, 0xec, 0x5e, 0x9f, 0x3b, 0x9a, 0x2e, 0xa9, 0x46, 0xa4,
+          0x13, 0x27, 0x70, 0xb5, 0xdd, 0x4f, 0xa2, 0xb8, 0x99, 0xf9, 0x84, 0x0a, 0x61, 0x45, 0xc9, 0x95, 0x6a, 0x9d, 0x17, 0x7c, 0x9a, 0x85, 0x5d, 0x05,
+          0x09, 0x17, 0xfd, 0xe0, 0xe4, 0x4b, 0x31, 0xac, 0x26, 0x10, 0xfb, 0x64, 0x1d, 0xbc, 0x9d, 0x8c, 0xd7, 0xd7, 0xfb, 0xb5, 0x22, 0x58, 0x72, 0x12,
+          0x4d, 0x07, 0x28, 0x9f, 0x0c, 0xaa, 0x8f, 0x5d, 0x4b, 0x0b, 0x3d, 0x35, 0xfa, 0x2a, 0x03, 0xc8, 0xbc, 0x47, 0xc3, 0xab, 0xd8, 0xaf, 0x5f, 0x55,
+          0x34, 0x55, 0xc5, 0x4b, 0x9e, 0x65, 0x2c, 0x3f, 0xb0, 0x42, 0x0c, 0x85, 0x48, 0x88, 0x63, 0xb0, 0x49, 0xdc, 0x13, 0x92, 0x53, 0x8b, 0xde, 0x3c,
+          0x76, 0xc5, 0x95, 0xdd, 0xa4, 0x59, 0x5d, 0x1a, 0xc0, 0x76, 0xc6, 0xb5, 0x1d, 0xec, 0x1c, 0x2e, 0xee, 0xc8, 0xfa, 0xc2, 0x9b, 0xfb, 0x67, 0xc6,
+          0xe1, 0x01, 0x39, 0x3c, 0x4e, 0x74, 0xd9, 0x44, 0xfc, 0xe5, 0xed, 0xd9, 0x05, 0x21, 0xc3, 0xe8, 0x9c, 0x18, 0x70, 0x5c, 0x75, 0x53, 0x09, 0xe0,
+          0x57, 0xb8, 0x0d, 0x24, 0x64, 0x1e, 0x31, 0x84, 0xd6, 0x20, 0xb2, 0xf7, 0x69, 0x6a, 0xbf, 0x72, 0xad, 0xa0, 0x23, 0xa2, 0x99, 0xd3, 0x4e, 0xc7,
+          0x49, 0x6f, 0xe9, 0x4d, 0x4c, 0xa0, 0xa5, 0xe5, 0xdc, 0xb9, 0xd8, 0xd9, 0x9e, 0xc6, 0xfa, 0x64, 0x0f, 0x1d, 0xe4, 0x65, 0x7f, 0xc3, 0x58, 0xb4,
+          0xce, 0xc1, 0xbc, 0x13, 0xf7, 0x0e, 0xaa, 0xe5, 0xf7, 0x75, 0x02, 0x82, 0xb5, 0x45, 0x03, 0x87, 0x50, 0xc7, 0x9d, 0xb0, 0x81, 0x26, 0x92, 0x66,
+          0x5d, 0x56, 0x4c, 0xcc, 0x03, 0x0c, 0x51, 0x9d, 0xfb, 0x68, 0x7b, 0x2f, 0x40, 0xc5, 0x13, 0xe2, 0x3c, 0x38, 0x26, 0x33, 0xa2, 0xdd, 0x69, 0x5c,
+          0xcb, 0x3f, 0x3d, 0x81, 0xe5, 0x0e, 0xc3, 0x62, 0x8f, 0x8c, 0x3b, 0xe5, 0x06, 0xb6, 0x03, 0xe5, 0x1e, 0x26, 0x5d, 0x39, 0x9c, 0xfb, 0x01, 0x78,
+          0x22, 0x20, 0x7d, 0x1c, 0x78, 0xc9, 0x75, 0xdd, 0x51, 0xb3, 0x29, 0x99, 0xcd, 0x75, 0xf2, 0x85, 0x95, 0x7e, 0x4d, 0xa0, 0x3a, 0x01, 0xd2, 0xb0,
+          0x05, 0x02, 0x61, 0x82, 0xc7, 0x91, 0x58, 0xa5, 0x5d, 0xc0, 0xb1, 0xd9, 0x4f, 0x7c, 0xc2, 0x53, 0xdb, 0xdb, 0xb6, 0x63, 0x59, 0xcd, 0x6e, 0x84,
+          0xf0, 0x69, 0x1e, 0xca, 0xb8, 0x58, 0x2c, 0xae, 0xcd, 0xe0, 0xbb, 0x3a, 0x4a, 0x2e, 0x9a, 0x92, 0xce, 0x4d, 0x3a, 0xf3, 0xdc, 0x9c, 0x6d, 0xe9,
+          0xd7, 0x31, 0xc6, 0xb2, 0xbd, 0x1b, 0x15, 0x8e, 0x95, 0x87, 0xe1, 0xeb, 0x27, 0xc8, 0xe0, 0xa2, 0x64, 0xe1, 0xe2, 0x62, 0xb6, 0x84, 0x31, 0x1a,
+          0xe4, 0x45, 0xac, 0xf7, 0xfd, 0xc1, 0x5a, 0x13, 0x84, 0xca, 0x55, 0x8e, 0x66, 0xa0, 0x6a, 0x93, 0x3b, 0x17, 0x33, 0xa4, 0x47, 0x17, 0x96, 0xb5,
+          0x2e, 0xe4, 0xea, 0x7f, 0x62, 0x5e, 0x8f, 0xb0, 0x13, 0xe7, 0x65, 0x90, 0xc7, 0x11, 0xed, 0xeb, 0x89, 0xc1, 0xb4, 0x65, 0x92, 0x58, 0x4f, 0xcf,
+          0x01, 0x39, 0xbd, 0x4a, 0x03, 0x29, 0x35, 0x6a, 0x9e, 0xc1, 0xba, 0x47, 0x3c, 0x96, 0xd1, 0xbe, 0xa3, 0xd7, 0x2f, 0x07, 0x8a, 0x36, 0x65, 0xdd,
+          0xd8, 0x99, 0x4b, 0x24, 0x18, 0x50, 0xed, 0xd5, 0xd6, 0x38, 0xac, 0x5b, 0x6b, 0xd4, 0x62, 0x43, 0x7d, 0xf4, 0xe4, 0x38, 0xc3, 0x79, 0xb0, 0xb7,
+          0x0d, 0x07, 0xb8, 0x2d, 0xfe, 0x4d, 0x0b, 0x99, 0x85, 0x43, 0xba, 0x95, 0x1c, 0x1c, 0x22, 0x8e, 0xbe, 0x8e, 0x07, 0x05, 0x42, 0xb9, 0x93, 0x43,
+          0x0d, 0xc4, 0x06, 0x31, 0xf4, 0xbd, 0xd0, 0x68, 0x74, 0x78, 0x95, 0x4b, 0x94, 0xab, 0x9c, 0xa1, 0xe5, 0xfb, 0x68, 0x3a, 0xb6, 0xfe, 0x0c, 0x26,
+          0xfa, 0x69, 0xc2, 0xb5, 0x74, 0x20, 0x2e, 0x16, 0x60, 0x9b, 0x95, 0x5e, 0x24, 0x44, 0xd4, 0xe9, 0x97, 0xf9, 0x68, 0x09, 0x4b, 0xe9, 0x51, 0xc3,
+          0xab, 0xe0, 0xde, 0xbb, 0xf3, 0x01, 0xc9, 0x2a, 0x82, 0x0c, 0x8d, 0x57, 0x70, 0xa1, 0x81, 0x8c, 0xb2, 0x18, 0xa0, 0x48, 0xd4, 0x4b, 0x55, 0xbb,
+          0xf5, 0x48, 0x53, 0x68, 0x90, 0xd6, 0xf1, 0x35, 0x28, 0xd4, 0x16, 0xed, 0xba, 0x00, 0x43, 0x21, 0x58, 0xa7, 0x9c, 0x43, 0x7f, 0x37, 0x16, 0x7d,
+          0x42, 0x6c, 0xcb, 0x17, 0x5f, 0x67, 0xed, 0x94, 0xd6, 0x7d, 0xed, 0x45, 0xca, 0x54, 0xee, 0x8a, 0x5d, 0x88, 0x4d, 0xa4, 0xfe, 0xd7, 0x2b, 0x18,
+          0xdb, 0xbc, 0xd2, 0xab, 0xb6, 0x67, 0xd6, 0x87, 0x93, 0x5b, 0xac, 0x5b, 0x98, 0xb2, 0x06, 0x76, 0xaa, 0x7a, 0x86, 0x3e, 0x44, 0xd5, 0x13, 0xe9,
+          0x26, 0xa6, 0xc1, 0xcd, 0x3d, 0x84, 0x82, 0xd2, 0x1f, 0x4f, 0xdb, 0xc2, 0xa0, 0x05, 0xfc, 0x9c, 0x9c, 0x61, 0xb3, 0x32, 0x0b, 0x05, 0xc4, 0x6b,
+          0x81, 0x8a, 0x4b, 0x60, 0xc9, 0x70, 0x5c, 0x03, 0xc4, 0x50, 0xe4, 0xe9, 0xde, 0x5f, 0x50, 0x19, 0xe1, 0x31, 0x8d, 0x56, 0x64, 0xb2, 0x28, 0x7a,
+          0x24, 0x11, 0x9d, 0x1c, 0xad, 0x5c, 0x5d, 0x38, 0xd1, 0xb9, 0xab, 0xbe, 0x1c, 0xeb, 0x9b, 0x27, 0xf3, 0x27, 0x3e, 0x95, 0xed, 0x8f, 0xb8, 0x74,
+          0xa0, 0xff, 0x85, 0x8b, 0xca, 0x49, 0x57, 0xc9, 0x63, 0xdb, 0x16, 0x99, 0x5b, 0x9e, 0xdd, 0xb4, 0xa6, 0x70, 0x24, 0x4c, 0xe4, 0x09, 0x6f, 0x0e,
+          0x13, 0x62, 0xf5, 0xe2, 0x7c, 0x82, 0x48, 0x1c, 0xf2, 0x21, 0x4f, 0x60, 0x3a, 0x26, 0x3d, 0x60, 0x22, 0x7b, 0x55, 0x2f, 0x33, 0x91, 0xe5, 0xaa,
+          0x96, 0x79, 0x6c, 0x08, 0x03, 0xc7, 0xac, 0xe9, 0x66, 0xf1, 0x7d, 0xb0, 0x98, 0xa6, 0x5e, 0x2a, 0xae, 0xe1, 0x02, 0xab, 0xac, 0xc9, 0x24, 0x5b,
+          0xb2, 0x8d, 0xfb, 0x5c, 0xf5, 0x91, 0x3d, 0x9f, 0x25, 0x39, 0xcb, 0x76, 0x4b, 0xbd, 0xda, 0xbe, 0xf0, 0x62, 0x91, 0x54, 0x44, 0x94, 0x7f, 0x83,
+          0xf3, 0xb4, 0x69, 0x3d, 0x0d, 0xba, 0x24, 0x2d, 0xa1, 0xcc, 0x29, 0x68, 0xe6, 0x46, 0x0d, 0xd2, 0xf5, 0xf0, 0xfc, 0x75, 0x8e, 0x23, 0x20, 0x63,
+          0xa7, 0xeb, 0x81, 0x5f, 0xa1, 0x07, 0x2e, 0x6b, 0x97, 0xb5, 0x2a, 0xd9, 0xbb, 0xd6, 0x1c, 0x40, 0xad, 0x9b, 0x48, 0x1c, 0x49, 0xb7, 0x49, 0xb0,
+          0x53, 0x71, 0x32, 0xdd, 0xfa, 0x64, 0xa3, 0xb1, 0x29, 0xa5, 0xe2, 0x91, 0xb4, 0xd5, 0x23, 0x4a, 0x1c, 0xb2, 0x90, 0x32, 0x7d, 0xc6, 0xdb, 0x78,
+          0xe8, 0xab, 0x0f, 0x96, 0x04, 0x82, 0x00, 0x37, 0x72, 0x57, 0xe9, 0xe6, 0xe2, 0xb9, 0x3d, 0x64, 0x9e, 0x02, 0x77, 0x18, 0x1e, 0xb5, 0x91, 0x86,
+          0x23, 0x25, 0x8a, 0x33, 0x3a, 0x6f, 0x10, 0x1e, 0x95, 0x96, 0x05, 0x18, 0x0b, 0x46, 0xa7, 0xb4, 0x37, 0x82, 0xe1, 0x72, 0x19, 0xb8, 0x4e, 0x7f,
+          0x7d, 0x3b, 0xf1, 0xa8, 0x64, 0x64, 0xa7, 0x4c, 0x1d, 0x13, 0x01, 0x3f, 0x78, 0x61, 0x6f, 0xd0, 0x0e, 0xdb, 0xf6, 0x63, 0xf3, 0xcf, 0xba, 0x1a,
+          0x3e, 0x53, 0x7d, 0xf1, 0xa4, 0xf0, 0x80, 0xff, 0xb6, 0x3a, 0x70, 0x9e, 0x3e, 0xa0, 0xbd, 0x6e, 0x3d, 0x39, 0xa8, 0x26, 0x98, 0x69, 0x66, 0x79,
+          0xda, 0xc9, 0xd4, 0x51, 0x61, 0xfd, 0x8c, 0x93, 0x0d, 0x86, 0x8d, 0x43, 0xb5, 0x1c, 0xc3, 0xf3, 0x30, 0xfc, 0x22, 0xff, 0x83, 0xf3, 0x2f, 0xd1,
+          0xae, 0xe3, 0xd1, 0xba, 0x32, 0x29, 0x69, 0x6e, 0xbf, 0x22, 0x9c, 0x15, 0xc4, 0xe4, 0xc0, 0x1c, 0xf2, 0x33, 0x5d, 0x48, 0x7a, 0xa4, 0x12, 0xdd,
+          0x6c, 0x06, 0x39, 0x58, 0x37, 0x93, 0x57, 0xd9, 0x85, 0x46, 0xe3, 0x70, 0x9c, 0x2b, 0xbf, 0xf8, 0x02, 0x08, 0x9e, 0x7a, 0x8f, 0x88, 0x8e, 0xe9,
+          0xac, 0x43, 0xa5, 0x30, 0x67, 0x0a, 0x21, 0xd5, 0xbd, 0xc9, 0x74, 0xe7, 0x01, 0x2f, 0x10, 0x28, 0xa2, 0x8b, 0xa5, 0xfb, 0x47, 0xda, 0x07, 0x45,
+          0x7f, 0x7f, 0xf1, 0xd8, 0x76, 0x1c, 0x10, 0xf2, 0x09, 0x8a, 0xd8, 0xee, 0x8b, 0xb3, 0x05, 0x7a, 0x97, 0x6a, 0x0a, 0x75, 0x6e, 0x13, 0x6c, 0xb7,
+          0x99, 0xb8, 0x27, 0x3a, 0xb5, 0x17, 0x45, 0x39, 0xec, 0x34, 0x3a, 0x5a, 0x42, 0x5c, 0x44, 0x41, 0x5b, 0x08, 0xeb, 0xca, 0xd1, 0x09, 0x75, 0x78,
+          0x23, 0xe9, 0x8a, 0x95, 0x5d, 0x55, 0x80, 0x6c, 0x9e, 0x9b, 0x42, 0xb7, 0x3e, 0x3b, 0x02, 0xf7, 0xb8, 0xf8, 0x18, 0x59, 0xd2, 0x0f, 0x39, 0x61,
+          0x00, 0x4b, 0x56, 0xe7, 0x57, 0x95, 0x95, 0xc4, 0x3f, 0xee, 0xc8, 0xa1, 0x5b, 0xf5, 0xc7, 0x18, 0xfc, 0xaa, 0x01, 0x47, 0x4a, 0x41, 0xc4, 0x59,
+          0xa4, 0x96, 0x22, 0xc2, 0x29, 0xb2, 0x79, 0xa0, 0x5f, 0x04, 0x13, 0x61, 0x6b, 0xc3, 0xcb, 0xb0, 0x29, 0xca, 0xdd, 0xba, 0xeb, 0x39, 0x66, 0x01,
+          0x3b, 0x5f, 0x75, 0xee, 0x78, 0x51, 0x12, 0xc1, 0xad, 0x4f, 0x69, 0x0f, 0xe5, 0x6f, 0x79, 0x1f, 0x52, 0x22, 0x59, 0x8a, 0x45, 0x3c, 0x53, 0x77,
+          0x30, 0xb7, 0x33, 0x72, 0x3a, 0x45, 0x51, 0x92, 0x11, 0x7d, 0x66, 0x47, 0xdb, 0x73, 0x73, 0xe4, 0x0d, 0xdc, 0xab, 0xa8, 0x44, 0xdf, 0x99, 0x96,
+          0x59, 0xe9, 0xf0, 0x05, 0x1c, 0x0c, 0x78, 0x9a, 0xdd, 0xc9, 0xa8, 0x02, 0xc8, 0x46, 0x3d, 0x41, 0x2a, 0x15, 0x32, 0xe2, 0x5b, 0x10, 0x03, 0x66,
+          0x8a, 0x03, 0x71, 0x90, 0x5c, 0xda, 0x7b, 0x3c, 0xc9, 0x3d, 0x9e, 0x61, 0x5d, 0x94, 0xe2, 0x47, 0x73, 0x9b, 0x88, 0x87, 0xc6, 0xb3, 0xaa, 0xf3,
+          0xd8, 0xf2, 0xb9, 0x07, 0xc2, 0x58, 0x9f, 0x86, 0x08, 0x2c, 0xe0, 0x6c, 0xef, 0x78, 0x71, 0x78, 0x87, 0x93, 0x51, 0x99, 0xf1, 0x52, 0xab, 0xf6,
+          0xc7, 0x64, 0x24, 0xc2, 0xdb, 0x50, 0x36, 0x7e, 0x68, 0x82, 0x2a, 0x29, 0x3c, 0xdd, 0xce, 0x23, 0x90, 0x91, 0x5e, 0x8a, 0x07, 0x0c, 0x43, 0x50,
+          0xce, 0x1c, 0x99, 0x3e, 0x70, 0x65, 0x5a, 0x5d, 0x44, 0x26, 0x50, 0x31, 0x20, 0xf2, 0x14, 0xc0, 0xb0, 0x9e, 0x08, 0x44, 0xf1, 0x68, 0xb8, 0xbb,
+          0x26, 0xc8, 0x19, 0xd2, 0xc7, 0x96, 0x80, 0x07, 0xc1, 0x44, 0x98, 0x68, 0x98, 0xff, 0x99, 0xba, 0xab, 0xac, 0x53, 0x9e, 0xc0, 0xce, 0xad, 0x98,
+          0xb5, 0xab, 0x51, 0xab, 0xd2, 0xec, 0x4f, 0x42, 0xfe, 0xb3, 0x70, 0xfd, 0x4d, 0x70, 0x4e, 0xfa, 0x21, 0x16, 0xe3, 0x8f, 0x0f, 0x8c, 0xd5, 0x34,
+          0xdb, 0x35, 0xe5, 0x07, 0xf4, 0x5e, 0xbb, 0xa9, 0x6b, 0x00, 0xc9, 0x4c, 0x66, 0x9b, 0xbb, 0xd5, 0x7b, 0x7d, 0x82, 0xba, 0x1a, 0x47, 0x8f, 0x67,
+          0xf6, 0x0f, 0x17, 0x39, 0x05, 0xc8, 0x3d, 0xfb, 0x69, 0x5c, 0xa9, 0x3b, 0xf0, 0x5d, 0x94, 0x06, 0xd2, 0x81, 0x10, 0x54, 0x1a, 0x12, 0xb5, 0xe2,
+          0x1a, 0x72, 0x96, 0x0c, 0x30, 0x21, 0xa0, 0xfb, 0x30, 0x17, 0x56, 0xca, 0x13, 0x8a, 0xa4, 0x50, 0xcc, 0xa7, 0x98, 0x49, 0x71, 0xd4, 0xbb, 0x2e,
+          0xa6, 0x27, 0x6e, 0x7c, 0x5a, 0xe2, 0x5c, 0xf6, 0x4b, 0xea, 0x8b, 0xfe, 0x35, 0x03, 0xd3, 0x1b, 0xec, 0x0b, 0x4f, 0xbd, 0x8e, 0xd3, 0x56, 0x56,
+          0xfc, 0x12, 0x24, 0x4b, 0x8c, 0x55, 0xc6, 0x9d, 0x8c, 0x5c, 0x42, 0x07, 0xa1, 0xd2, 0x3a, 0xc4, 0x38, 0xac, 0xe7, 0x07, 0xea, 0x75, 0x3b, 0xf3,
+          0x3f, 0x55, 0x55, 0x85, 0x08, 0x15, 0x8a, 0x90, 0xa3, 0xdd, 0x4b, 0xaa, 0xe9, 0x46, 0x15, 0x7c, 0x46, 0xab, 0x32, 0x1c, 0x1e, 0xf1, 0x07, 0x39,
+          0x16, 0xe5, 0x1f, 0xa2, 0x61, 0x06, 0xf4, 0xa8, 0x6d, 0x79, 0x45, 0xc9, 0x37, 0x73, 0x7c, 0x90, 0x4f, 0x1a, 0xa3, 0xfb, 0x80, 0x77, 0x14, 0x6b,
+          0x8f, 0x31, 0xd0, 0x80, 0x40, 0x4e, 0x4a, 0xa9, 0xd8, 0xfa, 0x72, 0x71, 0xa2, 0xf8, 0xe8, 0x50, 0x62, 0x19, 0x42, 0x84, 0x12, 0xee, 0x21, 0xec,
+          0xf2, 0x8a, 0x16, 0x00, 0x56, 0xb1, 0xcb, 0xc8, 0x6c, 0x13, 0x6c, 0x92, 0xaa, 0xdc, 0x0a, 0xbd, 0xbf, 0x5d, 0x21, 0xfd, 0x4e, 0x79, 0xc5, 0xc4,
+          0xed, 0x88, 0x2a, 0xf3, 0x5a, 0x2e, 0x1d, 0x5d, 0x37, 0xf6, 0x12, 0xa1, 0xf1, 0x94, 0xdd, 0x3b, 0x24, 0xbb, 0x8e, 0x33, 0x77, 0xb7, 0xde, 0x98,
+          0xd5, 0x3f, 0x42, 0x85, 0x94, 0xd0, 0xc7, 0x1f, 0xac, 0x6d, 0x1c, 0x09, 0xfe, 0x9e, 0x16, 0x22, 0x24, 0x2e, 0x37, 0xb6, 0xfe, 0x69, 0x4e, 0xeb,
+          0x95, 0x01, 0x1a, 0xff, 0x6e, 0xa1, 0x93, 0x30, 0x55, 0xf4, 0x87, 0x77, 0x33, 0x1c, 0x7f, 0x0e, 0x63, 0xb9, 0xcb, 0x32, 0x14, 0x2c, 0x68, 0x3f,
+          0x20, 0xdc, 0xf1, 0xdd, 0x7c, 0x5b, 0xc5, 0x95, 0x25, 0xf6, 0x59, 0xfc, 0xa1, 0x41, 0xde, 0x58, 0x77, 0x45, 0x4a, 0x37, 0x56, 0xd8, 0xa7, 0x22,
+          0xd5, 0xc9, 0x66, 0x53, 0x4f, 0x98, 0xac, 0xa9, 0xf0, 0x46, 0xa4, 0x3a, 0x86, 0xe7, 0x16, 0x2e, 0x41, 0xfd, 0x3d, 0xff, 0x3e, 0x0b, 0xdc, 0xe5,
+          0xec, 0xed, 0xde, 0xb0, 0x04, 0xd9, 0x0c, 0x0a, 0x55, 0xfe, 0x67, 0x92, 0x68, 0x19, 0x3e, 0xa7, 0x0f, 0x36, 0xf2, 0xe1, 0x59, 0xfe, 0x7b, 0x64,
+          0x72, 0x67, 0xfc, 0x4b, 0x06, 0x4b, 0xfc, 0xcd, 0x10, 0x35, 0x73, 0x22, 0xb4, 0xa9, 0x8a, 0xb3, 0x0d, 0x1f, 0xea, 0xc0, 0x66, 0x59, 0x72, 0xdf,
+          0x73, 0x57, 0x60, 0x37, 0xec, 0x8b, 0x2c, 0x74, 0xe8, 0x4a, 0xe0, 0x51, 0x20, 0xc3, 0x41, 0x93, 0x06, 0xc8, 0x21, 0x09, 0x68, 0xca, 0xc6, 0xb4,
+          0x06, 0x82, 0xbf, 0xf6, 0xe9, 0xea, 0xbf, 0x9b, 0xa7, 0xf5, 0x5d, 0xda, 0x11, 0xa2, 0xb1, 0x51, 0x1e, 0x47, 0xa6, 0xfb, 0xe9, 0x5c, 0x62, 0x87,
+          0x9a, 0x48, 0x3d, 0xc0, 0x7e, 0xd6, 0x80, 0x83, 0xd1, 0xd4, 0x04, 0x04, 0x92, 0x5c, 0xd0, 0x06, 0x70, 0x8a, 0x8f, 0xc0, 0x06, 0xfc, 0xca, 0x92,
+          0xc2, 0x7f, 0x47, 0x32, 0xaf, 0x76, 0xf6, 0xc5, 0xae, 0x51, 0x47, 0xe8, 0xd5, 0x77, 0x84, 0xc9, 0xb4, 0xc2, 0x36, 0xc6, 0x1e, 0x68, 0xa0, 0xed,
+          0x17, 0x71, 0x74, 0x97, 0x41, 0x07, 0x1a, 0x03, 0x5e, 0xca, 0x74, 0x0b, 0x7c, 0xba, 0x6c, 0xa8, 0x38, 0x0f, 0x66, 0x6b, 0xb4, 0xe5, 0xc9, 0xa3,
+          0xfc, 0x89, 0xaa, 0xb8, 0xaf, 0xb8, 0x47, 0x5c, 0xd1, 0x88, 0x6e, 0x7a, 0x10, 0x04, 0x67, 0xc2, 0x6f, 0xb1, 0xba, 0x28, 0x3b, 0x23, 0x26, 0xad,
+          0x18, 0x44, 0xaa, 0x48, 0x00, 0x3c, 0xe4, 0xb0, 0xfc, 0x00, 0x78, 0xb7, 0xec, 0x7f, 0x55, 0x83, 0xe9, 0x42, 0x18, 0xa0, 0x6e, 0xbe, 0x06, 0x14,
+          0x45, 0x41, 0xb8, 0x27, 0x97, 0xcd, 0x60, 0x9b, 0x49, 0x09, 0xb1, 0xdf, 0x8a, 0xdc, 0xb0, 0x0b, 0x6e, 0xae, 0xda, 0x11, 0x74, 0xf1, 0xbe, 0x22,
+          0x18, 0xaa, 0x22, 0xb0, 0xde, 0xdb, 0x3d, 0xd0, 0x04, 0x78, 0xb8, 0x59, 0x4a, 0x59, 0xf7, 0x5c, 0xb2, 0x8a, 0x02, 0x82, 0xbe, 0x22, 0xad, 0x53,
+          0xd5, 0xdb, 0xbb, 0x9f, 0x7a, 0xa3, 0xf5, 0x0a, 0xa4, 0x20, 0x4e, 0xfb, 0xb0, 0xea, 0xb3, 0x43, 0x4e, 0x4b, 0x92, 0x10, 0x44, 0xd0, 0x47, 0xd1,
+          0x28, 0xc0, 0x4b, 0xa6, 0x61, 0xd2, 0x00, 0x26, 0xc4, 0x45, 0x79, 0x56, 0x78, 0x1c, 0x36, 0x23, 0x5e, 0x98, 0xd5, 0x9e, 0xab, 0xfe, 0x05, 0xa7,
+          0x8c, 0x13, 0x21, 0x1c, 0x9f, 0xf6, 0x5b, 0xf3, 0x50, 0xc8, 0x7e, 0x9b, 0xa7, 0xea, 0x3d, 0x00, 0x0e, 0xb0, 0x66, 0xd2, 0x69, 0x2b, 0x90, 0xaa,
+          0x94, 0x75, 0x32, 0x72, 0x05, 0x27, 0xa5, 0xf3, 0xe2, 0xd9, 0x5c, 0x23, 0x2b, 0xd3, 0xbe, 0x43, 0x0a, 0x43, 0x60, 0x7b, 0xa4, 0x67, 0x2a, 0x0c,
+          0xa8, 0xd1, 0xe2, 0xc8, 0x5d, 0x6b, 0x31, 0x03, 0xbb, 0xf8, 0xc6, 0x59, 0xce, 0xe2, 0x43, 0x8d, 0x46, 0xb2, 0xff, 0x05, 0xf1, 0x4f, 0x1e, 0x52,
+          0x69, 0xef, 0xc3, 0x8a, 0xcd, 0x0d, 0xfb, 0x77, 0xb1, 0x10, 0xd2, 0x2c, 0x6b, 0xb4, 0x42, 0x1e, 0x08, 0x2f, 0xf9, 0xe0, 0x76, 0xfc, 0x48, 0x54,
+          0x8b, 0xc2, 0xf8, 0xdb, 0x52, 0x8f, 0x98, 0x79, 0xf3, 0x60, 0xc5, 0x93, 0x1b, 0x1c, 0xd8, 0xe5, 0x14, 0x94, 0xd6, 0x9d, 0x85, 0x24, 0x8c, 0xe2,
+          0x10, 0x1c, 0x5a, 0xcf, 0x35, 0x3d, 0x0c, 0xc7, 0xde, 0x5c, 0x57, 0x0a, 0x69, 0x72, 0x04, 0x96, 0xcf, 0x18, 0x04, 0x85, 0x49, 0x5c, 0xb6, 0x93,
+          0xbd, 0x74, 0x86, 0xc1, 0x78, 0xb6, 0x82, 0xce, 0x5f, 0xe1, 0x9c, 0x90, 0x6c, 0xde, 0x8a, 0xd5, 0x2d, 0xf3, 0x02, 0x64, 0xe9, 0x7a, 0xf1, 0x9e,
+          0x9b, 0x15, 0x97, 0xff, 0xf2, 0x82, 0x5b, 0xbf, 0x56, 0xc6, 0x7b, 0xdc, 0x6b, 0x77, 0x2e, 0xf8, 0x0d, 0x3c, 0x81, 0x8a, 0x9d, 0xab, 0xf6, 0xeb,
+          0x7c, 0xb2, 0x72, 0x0b, 0xba, 0x3a, 0x47, 0x8f, 0xf3, 0xa6, 0x42, 0x30, 0xcf, 0x09, 0x2a, 0x6d, 0x2c, 0xfd, 0x67, 0x0f, 0x8e, 0x6a, 0x58, 0x84,
+          0x99, 0x60, 0xa4, 0xd4, 0x2f, 0xe1, 0x69, 0x68, 0xff, 0x0b, 0x47, 0xa7, 0x4b, 0x05, 0xe6, 0x45, 0xb5, 0x76, 0xb5, 0xf8, 0x1a, 0x18, 0x85, 0x28,
+          0xe1, 0x13, 0xcc, 0x1a, 0xde, 0x9a, 0xab, 0x16, 0xbc, 0x5e, 0x1d, 0xa6, 0x05, 0x9f, 0x2f, 0xf5, 0xd4, 0x3a, 0x45, 0x6e, 0xf5, 0xb7, 0x0c, 0x39,
+          0x71, 0x2b, 0x30, 0xc2, 0x85, 0xdf, 0xe2, 0x8f, 0xcb, 0x8d, 0xbf, 0x89, 0x62, 0x56, 0xf6, 0xd0, 0xd1, 0xf8, 0x2f, 0x5b, 0xf2, 0xa8, 0x8c, 0xdf,
+          0x56, 0x43, 0xcd, 0xff, 0xe6, 0x53, 0xf2, 0xc2, 0xe2, 0x7a, 0x38, 0x2e, 0x63, 0x9e, 0x62, 0xf1, 0x8e, 0x4f, 0xa7, 0xbe, 0xcf, 0xcd, 0xe3, 0x40,
+          0x41, 0x2c, 0x22, 0xd1, 0xd4, 0x6c, 0x0e, 0x88, 0xf9, 0xea, 0x48, 0xe3, 0x30, 0xf2, 0xfe, 0x04, 0x6a, 0xef, 0xfc, 0x1d, 0x08, 0x4d, 0x7b, 0x67,
+          0x71, 0x05, 0xc0, 0xe9, 0x73, 0xf3, 0xe5, 0xf4, 0xfc, 0xfd, 0xb7, 0x63, 0x98, 0xe7, 0xcf, 0x32, 0xdc, 0xdf, 0x73, 0xfd, 0x78, 0xdd, 0x78, 0x1a,
+          0x02, 0x72, 0x11, 0x45, 0x03, 0x02, 0xad, 0xef, 0x5c, 0x8a, 0xd4, 0xca, 0xab, 0xcc, 0xe8, 0x4b, 0x60, 0x93, 0x81, 0x1a, 0xb3, 0x7a, 0x68, 0xa3,
+          0xf5, 0x2d, 0x64, 0x15, 0x44, 0x5b, 0x50, 0x28, 0x6d, 0x3c, 0x87, 0x07, 0x04, 0xb2, 0xf7, 0x29, 0x32, 0xce, 0xeb, 0x11, 0xa0, 0xdb, 0x8d, 0xab,
+          0xc5, 0x4f, 0xce, 0x07, 0x36, 0xef, 0x4d, 0xa1, 0x9d, 0x4e, 0x76, 0x4f, 0xe9, 0x6d, 0x1d, 0xa7, 0x65, 0x4d, 0xb2, 0x4a, 0xd4, 0x49, 0x3c, 0xf3,
+          0xd4, 0x92, 0xc9, 0xb3, 0x07, 0x67, 0xab, 0x64, 0x3d, 0xf9, 0xa0, 0xe0, 0xf1, 0x20, 0x90, 0xfd, 0x8d, 0x5d, 0x15, 0x43, 0xa6, 0xc4, 0x77, 0x06,
+          0x27, 0x18, 0x29, 0xf2, 0x76, 0x1d, 0x62, 0x21, 0xc7, 0x7e, 0x1d, 0x56, 0xe0, 0x6b, 0x9b, 0x78, 0x2d, 0x86, 0xc6, 0x65, 0x3f, 0x9e, 0x53, 0x9a,
+          0x28, 0x3f, 0x62, 0x53, 0xd8, 0x82, 0x1d, 0x60, 0x24, 0x74, 0x9b, 0xbf, 0x1a, 0x41, 0xa3, 0x6c, 0x55, 0x68, 0xad, 0x5b, 0x76, 0x45, 0xfe, 0x91,
+          0x30, 0xcc, 0xdf, 0x09, 0x7c, 0xc4, 0x87, 0xcc, 0x76, 0x23, 0x23, 0xc7, 0x26, 0x6d, 0x21, 0xe3, 0xe2, 0x6b, 0xc4, 0xd6, 0xf8, 0x46, 0x51, 0xc3,
+          0xfc, 0xbd, 0x88, 0xac, 0xbf, 0x60, 0x47, 0xfd, 0x8d, 0xec, 0x84, 0x71, 0x44, 0x34, 0xf1, 0xc7, 0x6b, 0x70, 0x6c, 0xc4, 0x41, 0x84, 0x2a, 0x76,
+          0xa2, 0x11, 0xae, 0xd4, 0xbc, 0xc9, 0x8e, 0x23, 0x35, 0x8d, 0x12, 0x64, 0x17, 0x63, 0xbb, 0x1a, 0xac, 0xec, 0x46, 0x94, 0xe7, 0x96, 0xdf, 0xc8,
+          0xcf, 0x99, 0xe3, 0x34, 0xe0, 0x1b, 0x45, 0x6c, 0x1f, 0xb6, 0xaa, 0xc2, 0x27, 0x99, 0xe2, 0xf2, 0x5d, 0x15, 0x0a, 0xbd, 0x63, 0xad, 0x91, 0xea,
+          0xa4, 0xa2, 0x18, 0x8d, 0x90, 0xd1, 0x9b, 0x98, 0xed, 0x97, 0x8a, 0x3c, 0x58, 0xf9, 0x37, 0xcc, 0x70, 0x64, 0x7b, 0x0f, 0x81, 0x38, 0x7c, 0xab,
+          0x82, 0xec, 0xef, 0x03, 0xc6, 0xfc, 0x7a, 0x43, 0x61, 0xc6, 0xaa, 0xc5, 0xfc, 0x2b, 0xf3, 0xa4, 0x6f, 0x2e, 0xe9, 0xd8, 0xc7, 0x71, 0x73, 0xe3,
+          0x66, 0x8d, 0x71, 0x2d, 0x26, 0x39, 0xfe, 0xbc, 0xe6, 0xf0, 0xaf, 0x96, 0x21, 0xf1, 0x46, 0x36, 0x1b, 0x3e, 0x9e, 0x0a, 0x9c, 0x1b, 0xf6, 0x87,
+          0xce, 0x3e, 0x08, 0x27, 0xb0, 0x67, 0x02, 0x25, 0xed, 0x8a, 0xf4, 0xc5, 0x74, 0x77, 0x61, 0xbb, 0xe1, 0x44, 0x06, 0x60, 0xcc, 0x9f, 0xd2, 0x78,
+          0x83, 0xb4, 0x7b, 0xfa, 0x5f, 0x7f, 0xe6, 0x3d, 0x7b, 0x55, 0x0d, 0xf3, 0xa4, 0x35, 0xf4, 0x12, 0xa6, 0x3c, 0x39, 0x00, 0x23, 0xcb, 0x71, 0x8f,
+          0xea, 0x08, 0x52, 0x3b, 0x9b, 0x46, 0xf5, 0x9b, 0xff, 0x4c, 0x4f, 0x74, 0x0e, 0x0a, 0xe5, 0x42, 0xc9, 0x9d, 0x8e, 0xdf, 0xb9, 0x94, 0xa1, 0xb9,
+          0xa1, 0x8e, 0xd9, 0x43, 0x02, 0x4e, 0x16, 0xab, 0x2c, 0x73, 0x51, 0x66, 0x69, 0x63, 0xb4, 0x7c, 0x00, 0x55, 0x27, 0xaa, 0x72, 0xaa, 0xbe, 0xc9,
+          0x6f, 0xa5, 0x4c, 0xf0, 0x36, 0x43, 0x74, 0x9b, 0x89, 0x5c, 0xb7, 0xd9, 0x3e, 0x33, 0x7c, 0x37, 0xb5, 0x58, 0xda, 0xa0, 0x63, 0x18, 0xcc, 0x12,
+          0x85, 0x58, 0x30, 0x5f, 0xb8, 0x48, 0x88, 0x53, 0x6d, 0x1f, 0x25, 0x94, 0x34, 0xce, 0x8d, 0xa6, 0x46, 0xff, 0x95, 0x7c, 0x06, 0xe0, 0x7e, 0xd3,
+          0x81, 0x93, 0x36, 0xbe, 0x0d, 0x65, 0x7f, 0xc3, 0xd9, 0xec, 0x0e, 0xf5, 0x9c, 0xb4, 0xa8, 0xf6, 0x2d, 0x26, 0xf3, 0x18, 0xe7, 0x84, 0xa2, 0x48,
+          0xc6, 0x42, 0x3d, 0xbd, 0xdc, 0x95, 0xfd, 0xe1, 0x1c, 0x82, 0xc4, 0xae, 0x21, 0x84, 0x4f, 0x14, 0xb7, 0x98, 0x0f, 0xa7, 0x1b, 0x63, 0xf5, 0x36,
+          0xf8, 0x39, 0xb6, 0xd4, 0xd3, 0x9b, 0xe3, 0x33, 0x3b, 0xf3, 0xa8, 0x6a, 0xfe, 0x6c, 0xa2, 0x08, 0x9c, 0x45, 0x9a, 0x57, 0xa7, 0x31, 0x75, 0xd8,
+          0xf0, 0x75, 0x5b, 0x81, 0x43, 0x1b, 0x26, 0x55, 0x95, 0x95, 0xb9, 0x7a, 0xe3, 0x5e, 0xc5, 0x45, 0xf9, 0x21, 0xca, 0x0d, 0xa4, 0x6a, 0xb3, 0x23,
+          0xa6, 0x89, 0x23, 0x28, 0x2d, 0xa4, 0x43, 0xba, 0xf1, 0xfb, 0xac, 0xb6, 0xe9, 0x3f, 0x49, 0xab, 0x9b, 0xcf, 0xca, 0x73, 0x96, 0x9d, 0x2e, 0xca,
+          0xa0, 0x4e, 0xe2, 0xbc, 0xd5, 0x76, 0xe1, 0xd7, 0x3c, 0x9c, 0xea, 0xd7, 0x5e, 0xb0, 0xc2, 0xf4, 0x00, 0x83, 0x0a, 0x02, 0x95, 0x45, 0x1b, 0xf2,
+          0x34, 0xb3, 0xdb, 0xd6, 0x67, 0x35, 0x88, 0xa1, 0xb5, 0x1a, 0xa1, 0xef, 0xdb, 0x9f, 0xd6, 0xaf, 0x52, 0x85, 0x82, 0x87, 0x0a, 0x10, 0x83, 0xe6,
+          0xbd, 0x23, 0x72, 0x38, 0x55, 0x21, 0xf5, 0x07, 0x23, 0xe8, 0xe1, 0x3e, 0x13, 0x4c, 0xb4, 0x81, 0x90, 0x5f, 0x0f, 0x39, 0xff, 0x84, 0xba, 0x0f,
+          0x29, 0x97, 0x12, 0x84, 0x4d, 0xaf, 0x05, 0x28, 0xaf, 0xbf, 0x66, 0x6e, 0xd1, 0xb4, 0x57, 0x82, 0x12, 0xac, 0x31, 0x07, 0xc5, 0x33, 0xf5, 0x03,
+          0x85, 0x29, 0x83, 0x41, 0x36, 0x8c, 0x1d, 0x24, 0x79, 0x4c, 0x3d, 0xfd, 0xb1, 0x91, 0xeb, 0x9f, 0x2d, 0x1f, 0xcf, 0xc1, 0xcc, 0x9f, 0xd3, 0x0d,
+          0x88, 0xd3, 0x5f, 0x00, 0x63, 0xf0, 0x02, 0xb5, 0xc4, 0x22, 0x77, 0x3b, 0xd7, 0x1b, 0xc8, 0x4d, 0x75, 0xd9, 0xa5, 0xaf, 0xf7, 0x1f, 0xe6, 0xf9,
+          0xf2, 0x67, 0x5c, 0xd5, 0x4e, 0x05, 0x78, 0x56, 0x06, 0xc9, 0x0c, 0x25, 0x9f, 0xf7, 0xa1, 0xaf, 0xc8, 0xef, 0xc8, 0x5e, 0x77, 0x29, 0x1f, 0xdf,
+          0x2d, 0xf4, 0xfd, 0xb0, 0xf1, 0x01, 0x66, 0xb9, 0xa3, 0x0f, 0xd8, 0x22, 0x7a, 0xbc, 0xe2, 0xf6, 0xf7, 0xb8, 0x55, 0xef, 0xcd, 0xe9, 0x83, 0x14,
+          0x20, 0x39, 0x7b, 0xce, 0x3d, 0x03, 0x9d, 0xf4, 0x01, 0xcd, 0x2f, 0xb2, 0x07, 0x87, 0x49, 0xcc, 0xa8, 0xd9, 0xe7, 0x8b, 0x2d, 0x6f, 0x1e, 0xfe,
+          0xe5, 0x8e, 0x3c, 0xbe, 0x59, 0x93, 0xef, 0x0d, 0x17, 0xbf, 0x23, 0x8f, 0x3b, 0x19, 0x69, 0x8e, 0x13, 0x89, 0xaf, 0x2f, 0xb2, 0xe8, 0x91, 0x96,
+          0x6e, 0x3b, 0x29, 0xfb, 0x20, 0x29, 0x14, 0x42, 0x10, 0x62, 0x42, 0x5d, 0xe9, 0xb1, 0xa9, 0x2c, 0xdb, 0x39, 0xd0, 0x74, 0x2d, 0xde, 0x28, 0x4f,
+          0xa0, 0xb6, 0x2c, 0xc8, 0x2e, 0xef, 0x39, 0x6a, 0x1c, 0x3f, 0x28, 0xfb, 0x77, 0x61, 0x43, 0x4a, 0x08, 0xd7, 0x81, 0x3b, 0xd2, 0x53, 0xc6, 0xeb,
+          0x1f, 0xaa, 0x69, 0x79, 0xb9, 0xa3, 0x87, 0x31, 0xe7, 0xeb, 0x77, 0xee, 0x20, 0x83, 0x46, 0x77, 0x2e, 0x2a, 0x8c, 0x6a, 0x95, 0x78, 0xbc, 0xfa,
+          0x06, 0x04, 0x6d, 0x0e, 0x39, 0x61, 0xa0, 0x94, 0x34, 0xd5, 0xb6, 0xe4, 0x5f, 0xfe, 0xe4, 0x9b, 0xcb, 0xf2, 0xdf, 0x88, 0x20, 0xa6, 0x7d, 0x55,
+          0x90, 0xae, 0x6c, 0x13, 0xbb, 0x42, 0xf4, 0xb9, 0xe0, 0xd3, 0xc7, 0xd0, 0x2f, 0x74, 0xd4, 0xbc, 0x06, 0x40, 0xae, 0x90, 0xdb, 0x6a, 0xfb, 0xa5,
+          0x0c, 0xb3, 0xb7, 0x3b, 0xd8, 0x77, 0x6a, 0x50, 0x77, 0x7f, 0x5d, 0xf0, 0x42, 0x9c, 0x90, 0xa1, 0xdc, 0x56, 0x29, 0x46, 0xc5, 0x1c, 0x12, 0xef,
+          0xe3, 0x38, 0x81, 0x83, 0x46, 0x80, 0x84, 0x4d, 0xc5, 0x1e, 0xf7, 0x6b, 0xe0, 0xe1, 0x60, 0x44, 0x60, 0x04, 0xff, 0x00, 0xf1, 0x60, 0x76, 0x5b,
+          0x65, 0x86, 0xa5, 0x61, 0xac, 0xd8, 0x19, 0x55, 0xec, 0xf4, 0x80, 0x87, 0x74, 0x46, 0xb6, 0x5b, 0xc8, 0x4e, 0x54, 0x5c, 0x0b, 0x84, 0xec, 0x6d,
+          0xbf, 0x5b, 0xb7, 0x3c, 0xc8, 0x09, 0x3d, 0x4b, 0x32, 0xc4, 0xa7, 0x82, 0xd6, 0xb4, 0xc5, 0xcf, 0xd7, 0x3a, 0x2b, 0x28, 0x4c, 0x8b, 0x7e, 0x6a,
+          0xf8, 0xbd, 0x64, 0x09, 0x16, 0xa3, 0x50, 0x6b, 0x81, 0xc1, 0xfe, 0xc4, 0xef, 0xd0, 0xa5, 0x80, 0x47, 0xfa, 0x52, 0xca, 0xd0, 0xa2, 0x10, 0x21,
+          0xc0, 0x68, 0x13, 0x13, 0xc6, 0x5c, 0x4f, 0x3a, 0x94, 0xf7, 0xcd, 0x74, 0x6a, 0x26, 0xe9, 0x93, 0xda, 0xdb, 0x45, 0x6e, 0xa1, 0x6f, 0xdc, 0x99,
+          0x54, 0x75, 0x28, 0xe3, 0xda, 0x34, 0x96, 0xd5, 0x25, 0xbc, 0xa1, 0x02, 0x74, 0xac, 0x74, 0x96, 0x9a, 0xb1, 0xce, 0x6c, 0x53, 0x37, 0x62, 0x9e,
+          0x7b, 0x54, 0x9f, 0x8e, 0xb2, 0x43, 0xc3, 0xfa, 0x59, 0xe3, 0x99, 0xe2, 0x2f, 0xea, 0x27, 0xde, 0x4d, 0xed, 0xf5, 0xfd, 0x48, 0x10, 0x7a, 0xe2,
+          0x53, 0xb7, 0xba, 0x25, 0x36, 0xef, 0x02, 0x03, 0x1d, 0x74, 0x62, 0x83, 0x05, 0x1d, 0x0c, 0x1f, 0x16, 0xaa, 0xc6, 0x64, 0xc2, 0x5e, 0x37, 0x8d,
+          0xd1, 0x8d, 0x7d, 0xf2, 0xd2, 0x85, 0xcc, 0xdc, 0x39, 0x22, 0x64, 0xe0, 0x8c, 0x03, 0xcd, 0xd5, 0xbc, 0xc2, 0x54, 0x35, 0x7e, 0x57, 0xac, 0x6a,
+          0xe9, 0xf6, 0x8b, 0x80, 0x07, 0xfd, 0x7a, 0xae, 0x88, 0xb0, 0x61, 0x68, 0x45, 0x7f, 0xc1, 0xf9, 0xf0, 0x24, 0xb2, 0x26, 0x0d, 0x54, 0x46, 0xd2,
+          0xd1, 0x09, 0x61, 0x23, 0x39, 0x10, 0x81, 0xc1, 0x68, 0x3c, 0x21, 0x03, 0x2b, 0x48, 0xde, 0x07, 0x55, 0xf7, 0x73, 0x51, 0x74, 0x22, 0xed, 0xbd,
+          0x0a, 0x69, 0x63, 0x2c, 0x0a, 0xa3, 0x1c, 0x42, 0x3d, 0x8c, 0x93, 0x0f, 0x48, 0x89, 0x14, 0xd7, 0x72, 0xf2, 0x5f, 0x29, 0x57, 0xb9, 0x9e, 0xe8,
+          0xf5, 0xed, 0x87, 0xdd, 0xc1, 0x0d, 0x58, 0xa6, 0x7b, 0xdb, 0x1d, 0x82, 0x7c, 0x84, 0x93, 0xfd, 0xe1, 0x76, 0xb9, 0xdc, 0xd5, 0xb4, 0x52, 0xf2,
+          0x70, 0x41, 0xd1, 0x18, 0x5a, 0xba, 0xb1, 0x56, 0x44, 0x5b, 0x9b, 0x5d, 0xf4, 0xb5, 0xea, 0x22, 0x32, 0xf6, 0x07, 0x93, 0x04, 0x1b, 0xf1, 0x99,
+          0x0f, 0x11, 0x2c, 0x9e, 0xd1, 0xb8, 0x30, 0x62, 0x94, 0xb3, 0x5b, 0x21, 0x38, 0x18, 0xcf, 0x6a, 0xbe, 0xff, 0xce, 0xb4, 0x93, 0x2d, 0xd1, 0xc9,
+          0xdb, 0x83, 0x8f, 0x42, 0xf9, 0xf8, 0x13, 0xc9, 0xe3, 0xaa, 0x05, 0x1b, 0x6a, 0x90, 0x53, 0xff, 0xa6, 0x5b, 0xec, 0xb1, 0x0a, 0x7a, 0x35, 0xf0,
+          0xd3, 0x4c, 0xc5, 0xa6, 0xb7, 0x84, 0x60, 0x06, 0x0d, 0x00, 0xe3, 0xa7, 0x6d, 0x44, 0xaa, 0x3a, 0x6c, 0x4e, 0x93, 0x12, 0xbc, 0xf9, 0xd4, 0x33,
+          0x4d, 0xac, 0xe9, 0xf0, 0xa4, 0xd8, 0x93, 0x9e, 0x78, 0xd8, 0xce, 0x65, 0xc1, 0x2f, 0xe5, 0xe1, 0xa3, 0xad, 0x32, 0x1e, 0x96, 0xc2, 0xea, 0x5e,
+          0xe1, 0x50, 0x61, 0xea, 0x31, 0x3a, 0xf3, 0x12, 0x7e, 0x43, 0xa5, 0xbf, 0xb3, 0x82, 0x0c, 0xde, 0x69, 0x13, 0x13, 0x68, 0x1f, 0xa6, 0x15, 0x01,
+          0xbd, 0x8f, 0xee, 0x72, 0xb4, 0x6c, 0x0e, 0x86, 0x9f, 0x4a, 0x18, 0xbd, 0x33, 0xdb, 0x7e, 0x9a, 0x89, 0xb3, 0x07, 0xaf, 0x5a, 0x9a, 0xc6, 0x02,
+          0xda, 0x0b, 0xa1, 0x56, 0xcc, 0x3b, 0x3d, 0x0a, 0xc3, 0x53, 0x46, 0x5c, 0x55, 0x51, 0x67, 0x61, 0x45, 0xa7, 0xdb, 0x11, 0x86, 0xdd, 0xa8, 0x61,
+          0xd3, 0xa4, 0x7a, 0xe6, 0x59, 0xf1, 0x83, 0xc3, 0x1c, 0x07, 0x7e, 0x1b, 0xbb, 0x72, 0x10, 0x43, 0x84, 0x78, 0xd5, 0x57, 0x5a, 0x67, 0x16, 0x98,
+          0xfe, 0x9a, 0xc2, 0xe8, 0x57, 0xe1, 0x91, 0xbe, 0xbd, 0x64, 0x6c, 0xbd, 0xeb, 0xe8, 0xab, 0xfb, 0x51, 0x66, 0xb4, 0x0b, 0x64, 0x1e, 0x07, 0xc9,
+          0x83, 0xdf, 0x1f, 0x7f, 0x7d, 0x44, 0x75, 0x53, 0xc6, 0x30, 0x1a, 0x14, 0x59, 0x24, 0x18, 0xcd, 0x91, 0x52, 0xdd, 0x11, 0xb6, 0x6c, 0xdc, 0xd7,
+          0x19, 0xb2, 0x30, 0xba, 0x73, 0xf9, 0x50, 0x07, 0xbe, 0xa1, 0x37, 0x39, 0xee, 0xdc, 0xbf, 0xd2, 0x8c, 0xa2, 0xe3, 0xe7, 0xe9, 0x13, 0x91, 0x7b,
+          0xbd, 0x21, 0x9d, 0xa2, 0x0b, 0xbe, 0xe2, 0xb1, 0x26, 0xac, 0x3c, 0x71, 0xec, 0x47, 0xa8, 0x61, 0x6c, 0xd9, 0x46, 0x8b, 0x5b, 0x33, 0x7d, 0x55,
+          0x63, 0xd7, 0xb5, 0x20, 0xdb, 0x51, 0x13, 0xe2, 0xb7, 0xe9, 0xbb, 0x7e, 0x77, 0xdc, 0x2a, 0x65, 0x7c, 0xdf, 0x10, 0xcb, 0x32, 0x53, 0x05, 0x56,
+          0xd2, 0x31, 0xbe, 0x19, 0x59, 0xc7, 0x6a, 0xe8, 0x79, 0xaf, 0x83, 0x6d, 0x47, 0xa0, 0x03, 0x2b, 0x4b, 0x30, 0x3a, 0x54, 0x87, 0x3f, 0x78, 0x31,
+          0x32, 0x15, 0x15, 0x81, 0xe5, 0xe6, 0xa3, 0x67, 0x03, 0xb0, 0x60, 0x0d, 0xf2, 0x16, 0x18, 0x4d, 0xc0, 0x14, 0xed, 0x16, 0x45, 0x63, 0x0e, 0x21,
+          0x97, 0x0f, 0xd5, 0xf1, 0xfb, 0xd9, 0xce, 0x84, 0x7b, 0xaf, 0x31, 0x82, 0xa5, 0xbd, 0x89, 0x8d, 0x28, 0x8c, 0x89, 0x21, 0x5f, 0xda, 0x99, 0xfb,
+          0x38, 0x51, 0x85, 0x60, 0x5a, 0xb4, 0xdc, 0x3b, 0xf0, 0xc6, 0x53, 0x53, 0x6f, 0x4f, 0xe8, 0x7b, 0xa9, 0x75, 0xb5, 0x54, 0xdb, 0x5a, 0x75, 0x0d,
+          0x27, 0x03, 0x80, 0x7e, 0x94, 0x3d, 0x3b, 0x72, 0x13, 0x8d, 0xa5, 0x1a, 0x20, 0x16, 0x5c, 0x1d, 0x2b, 0x43, 0x5d, 0x79, 0xae, 0x51, 0x81, 0xd1,
+          0x51, 0xee, 0x10, 0x22, 0x1a, 0x58, 0x85, 0xc5, 0xba, 0x35, 0x7c, 0xa7, 0x1b, 0xd0, 0x26, 0x3e, 0x91, 0xda, 0x01, 0xcb, 0xc2, 0x00, 0x94, 0xaa,
+          0x11, 0x92, 0xe3, 0x82, 0xaa, 0x01, 0x28, 0x8c, 0xa6, 0xee, 0xb8, 0xe3, 0x3e, 0xe6, 0x04, 0x80, 0x3f, 0x2f, 0x49, 0x9b, 0x0d, 0xe6, 0xfc, 0xbd,
+          0xe5, 0x6c, 0x63, 0xcc, 0x20, 0x43, 0xc9, 0x0d, 0xf9, 0xd7, 0xb2, 0x6a, 0xe7, 0x2c, 0x8d, 0xc5, 0x37, 0xd4, 0x6d, 0xad, 0x07, 0xe7, 0xc9, 0x28,
+          0x3a, 0xdd, 0xa1, 0x5c, 0x2a, 0xd7, 0xa6, 0x1c, 0x33, 0x78, 0xe5, 0xae, 0x62, 0xba, 0xe4, 0xc9, 0xa1, 0xd9, 0xef, 0x6e, 0x6d, 0x67, 0x9c, 0x15,
+          0x3f, 0xd0, 0x5e, 0xaa, 0x98, 0x01, 0x8d, 0xf9, 0x26, 0xe7, 0x8b, 0x5f, 0xea, 0xe7, 0xf7, 0x48, 0x7b, 0x6c, 0xa5, 0x77, 0x1f, 0x2f, 0x51, 0xd8,
+          0xf5, 0xc1, 0xc5, 0x2f, 0x4e, 0x53, 0x90, 0xd0, 0x66, 0x97, 0x64, 0xe6, 0x9b, 0x23, 0x94, 0x9a, 0x83, 0x9a, 0x80, 0x4f, 0x0f, 0x5e, 0x8a, 0x45,
+          0x3f, 0xd6, 0x22, 0x4d, 0xe6, 0xcf, 0x1f, 0xef, 0x90, 0x0e, 0xe3, 0x83, 0x79, 0x2c, 0x13, 0xf5, 0x9c, 0xeb, 0x28, 0x7e, 0xdb, 0xd2, 0xcf, 0xa9,
+          0xec, 0x43, 0x8b, 0xc2, 0x42, 0xbb, 0xe2, 0xd0, 0x7f, 0x0b, 0xf1, 0x7a, 0xf1, 0xeb, 0xaf, 0xcd, 0x7c, 0x37, 0xef, 0xd6, 0xfd, 0xc0, 0xca, 0x76,
+          0xa4, 0x73, 0xe6, 0xc3, 0x89, 0xcd, 0xac, 0x60, 0x73, 0xd5, 0x1b, 0x72, 0x29, 0x53, 0xc4, 0x85, 0xc8, 0x91, 0x46, 0x22, 0xb5, 0x22, 0xa2, 0xa6,
+          0x4e, 0x91, 0x3b, 0xb2, 0xc0, 0x55, 0x1a, 0x8c, 0xb6, 0x2a, 0x69, 0x48, 0x91, 0x8d, 0xca, 0xd7, 0xce, 0x13, 0x92, 0xb2, 0xd3, 0x8a, 0x01, 0x25,
+          0x2b, 0x98, 0x70, 0xc9, 0x1f, 0xce, 0x50, 0x88, 0x72, 0xd4, 0xb9, 0x91, 0xa1, 0x4d, 0x2a, 0x1a, 0x43, 0xba, 0x5a, 0x00, 0x29, 0x89, 0xeb, 0x31,
+          0xd7, 0xdb, 0xa5, 0x2c, 0xe3, 0xa6, 0xc1, 0x56, 0xc0, 0x8b, 0x7c, 0x08, 0x0b, 0xfb, 0xe7, 0x7e, 0x2e, 0xa8, 0xce, 0x67, 0xf7, 0x3f, 0xaf, 0xd4,
+          0xa9, 0x75, 0x94, 0x38, 0xab, 0x0f, 0x5b, 0xb3, 0xd1, 0xac, 0x70, 0x87, 0xf4, 0x10, 0x13, 0x72, 0xef, 0x1d, 0x8a, 0x7e, 0xc2, 0x69, 0x43, 0x07,
+          0x50, 0xe0, 0xfe, 0xdf, 0xb7, 0x25, 0x39, 0x36, 0x69, 0xfe, 0xa8, 0xcf, 0x29, 0x14, 0xe4, 0xe4, 0xda, 0x6e, 0x5a, 0x26, 0xed, 0xea, 0x66, 0x16,
+          0x90, 0xa0, 0x4d, 0x42, 0xd3, 0x6d, 0x92, 0x26, 0x42, 0x6c, 0xfd, 0xb3, 0x23, 0x4f, 0x49, 0x8b, 0x78, 0x5f, 0xb3, 0x42, 0x9a, 0xc8, 0xbb, 0xd3,
+          0x29, 0xd2, 0x5f, 0xe6, 0x7c, 0xcd, 0x14, 0xe6, 0xc8, 0x0a, 0x5f, 0x6a, 0xa1, 0x85, 0xe9, 0x16, 0x4d, 0x92, 0xe7, 0x61, 0x92, 0xd3, 0xa0, 0x09,
+          0x94, 0x93, 0x58, 0x36, 0x12, 0x4a, 0x2f, 0x52, 0x28, 0x8c, 0x5e, 0x0f, 0xa8, 0xdc, 0xa0, 0x65, 0x0e, 0xf7, 0x22, 0xb8, 0xd4, 0xe4, 0x47, 0x9a,
+          0x7f, 0x78, 0xf3, 0xf2, 0x7d, 0x15, 0xd7, 0xcb, 0x87, 0x53, 0x3f, 0x87, 0x71, 0xb9, 0xe3, 0xfa, 0x1f, 0x1f, 0xf1, 0xcc, 0x4b, 0xcf, 0x43, 0xab,
+          0x00, 0x0b, 0xe3, 0x36, 0x60, 0x83, 0x8a, 0x8e, 0x99, 0x32, 0xa6, 0x49, 0xd2, 0x57, 0xf9, 0xc3, 0xaf, 0x25, 0x71, 0xfc, 0x4c, 0x3c, 0x78, 0xc0,
+          0xb1, 0x84, 0x15, 0xc3, 0x59, 0x92, 0xfa, 0x9a, 0x4f, 0xca, 0xdf, 0x0e, 0x87, 0x9a, 0xd4, 0x8c, 0x38, 0x94, 0x7c, 0xcf, 0xad, 0x02, 0xd3, 0x0b,
+          0x56, 0x93, 0xac, 0xc2, 0x2c, 0x33, 0xcd, 0xde, 0x01, 0xce, 0x61, 0x36, 0x5a, 0xc9, 0x5e, 0x09, 0xb8, 0x25, 0x07, 0xca, 0x7c, 0x2a, 0x51, 0xa8,
+          0x68, 0x0f, 0x30, 0x83, 0x39, 0x68, 0x62, 0x56, 0x24, 0xff, 0x3f, 0x6b, 0x26, 0xd7, 0x6c, 0xca, 0xfd, 0x30, 0x75, 0x3f, 0xc3, 0x75, 0x17, 0x7f,
+          0x6e, 0xfa, 0x84, 0xf3, 0x8b, 0x68, 0xc6, 0x16, 0xbd, 0x06, 0x23, 0x77, 0x35, 0x61, 0xcf, 0x52, 0x3f, 0xca, 0x7b, 0x7c, 0xed, 0x0b, 0x3b, 0x82,
+          0x74, 0x9b, 0xd9, 0xed, 0x1d, 0x27, 0xe0, 0x5f, 0xd8, 0xa2, 0xcd, 0xf0, 0x1e, 0x05, 0x75, 0x83, 0x4e, 0x59, 0x0c, 0x9c, 0x1e, 0xea, 0x97, 0xa0,
+          0xff, 0x70, 0x29, 0xff, 0x71, 0x28, 0x6b, 0x41, 0x2b, 0xee, 0xb8, 0xf3, 0x9d, 0xef, 0xe1, 0xdd, 0xa9, 0x50, 0xf0, 0xb2, 0x32, 0x47, 0x25, 0xd4,
+          0x91, 0xd8, 0x42, 0x3d, 0x14, 0x95, 0x69, 0x87, 0xb4, 0x13, 0x6f, 0xde, 0x15, 0x6e, 0xa8, 0x2b, 0x61, 0xbc, 0x48, 0x22, 0x80, 0x0a, 0x83, 0xd2,
+          0x9c, 0xcd, 0xcd, 0xa1, 0x79, 0xf1, 0x85, 0x37, 0xe4, 0x2a, 0x71, 0xb8, 0x8c, 0x07, 0xa9, 0xb8, 0xf3, 0x5d, 0x80, 0xce, 0xad, 0xcd, 0x6d, 0xd6,
+          0x03, 0x06, 0x5f, 0x96, 0xe3, 0x36, 0x9b, 0x25, 0x32, 0xa2, 0xe8, 0x37, 0x9e, 0x7f, 0xc8, 0xcc, 0xd8, 0xfd, 0x48, 0xe2, 0x24, 0x89, 0x37, 0x30,
+          0x9d, 0x20, 0xde, 0x87, 0x36, 0x6f, 0x0a, 0xe9, 0xfa, 0xd1, 0x8d, 0xca, 0x70, 0x44, 0x13, 0xb7, 0x21, 0x63, 0x3d, 0xa8, 0x49, 0x5e, 0x08, 0x38,
+          0xe7, 0x9e, 0x9a, 0x45, 0xc1, 0x35, 0x42, 0x9f, 0xa3, 0x97, 0xbf, 0xda, 0xdc, 0x70, 0x0c, 0x0e, 0xbc, 0x67, 0xa1, 0xe8, 0xb7, 0xd3, 0xf8, 0xf3,
+          0x77, 0xdf, 0xf0, 0x94, 0xf7, 0xa7, 0x26, 0xcf, 0x6e, 0xcf, 0xe7, 0x7d, 0x88, 0x9f, 0x75, 0xba, 0x05, 0xc4, 0x05, 0x5b, 0x78, 0xae, 0x1a, 0xda,
+          0x6a, 0xd0, 0x78, 0x5c, 0x51, 0x6d, 0x1e, 0xbf, 0x13, 0x89, 0xcc, 0x10, 0x5c, 0x7f, 0xf8, 0x40, 0x1b, 0x4c, 0xfa, 0xe5, 0x1f, 0x5c, 0x93, 0xbf,
+          0x9d, 0xa8, 0x0c, 0xff, 0x13, 0x30, 0x87, 0xf0, 0x78, 0xa3, 0x5b, 0x6c, 0x84, 0x16, 0x0b, 0x86, 0xf8, 0x6c, 0x6c, 0xcc, 0x58, 0x44, 0x15, 0xcd,
+          0x2c, 0xcd, 0x1c, 0x65, 0x68, 0x13, 0xbe, 0xdb, 0x46, 0x84, 0x5f, 0x06, 0xb3, 0xe2, 0xa4, 0x07, 0xc0, 0xd1, 0xd7, 0x02, 0xfb, 0xe0, 0xa8, 0x93,
+          0x7a, 0xbe, 0xe8, 0xba, 0x0c, 0x7e, 0x7b, 0x48, 0xf7, 0xf9, 0x61, 0x3f, 0x35, 0x0e, 0x89, 0xea, 0xd5, 0xe7, 0xb5, 0x7d, 0x3f, 0x1b, 0xed, 0x9d,
+          0xe5, 0x22, 0x4b, 0x76, 0x87, 0x0f, 0x0f, 0xa2, 0x47, 0xc2, 0xe6, 0x0f, 0xcc, 0x3e, 0xed, 0xe0, 0xfd, 0xd4, 0xc0, 0xd2, 0x4a, 0x78, 0xc2, 0xe0,
+          0x37, 0x3a, 0xd0, 0xc7, 0x55, 0xcf, 0x4d, 0xa6, 0x12, 0x98, 0xee, 0xc8, 0x88, 0xc1, 0xd6, 0x70, 0x0b, 0x66, 0x03, 0x12, 0x07, 0xe1, 0xc7, 0x15,
+          0x35, 0x65, 0x3b, 0xd6, 0x12, 0xd9, 0x9b, 0xd2, 0x9e, 0xe9, 0x6f, 0x51, 0xa7, 0xae, 0x3e, 0x47, 0xb0, 0x15, 0x60, 0xd6, 0x71, 0xb1, 0x16, 0x29,
+          0x98, 0x46, 0x3e, 0x46, 0x86, 0x85, 0x1c, 0x55, 0xec, 0x64, 0x9a, 0x38, 0x04, 0xbb, 0xe4, 0x76, 0xe6, 0x0f, 0x34, 0xe1, 0x82, 0x34, 0xae, 0x8c,
+          0x16, 0x13, 0x4d, 0xbf, 0x4c, 0xdd, 0xcb, 0xf2, 0x5f, 0xf3, 0x5b, 0x78, 0xf3, 0x39, 0x56, 0x19, 0x2f, 0x61, 0x1f, 0xc0, 0x83, 0x43, 0xcf, 0x11,
+          0x79, 0x90, 0xc2, 0xfe, 0x0c, 0xcc, 0xb7, 0xe3, 0xb4, 0xd1, 0xa8, 0x8d, 0x38, 0x8d, 0xe5, 0x00, 0x8f, 0x7d, 0x48, 0x49, 0x09, 0xf4, 0x74, 0xe6,
+          0xae, 0x01, 0xc9, 0x2f, 0x49, 0x4e, 0x2b, 0xc3, 0xfc, 0x74, 0x3a, 0xdb, 0x52, 0xbf, 0xb6, 0x1f, 0x87, 0xe7, 0xfe, 0xe3, 0x86, 0x2c, 0x98, 0x71,
+          0x91, 0x45, 0xce, 0x5d, 0xc3, 0x2d, 0x06, 0x5f, 0x72, 0x7b, 0x6e, 0xb9, 0x37, 0x2c, 0x31, 0x42, 0xfc, 0x67, 0x3c, 0x36, 0xea, 0x56, 0xdd, 0x7e,
+          0x70, 0x39, 0x09, 0x22, 0x0d, 0x6c, 0xa3, 0xe2, 0xe8, 0xab, 0x8a, 0xc5, 0xbe, 0xc3, 0x9c, 0x37, 0xa9, 0xd0, 0xb7, 0x96, 0x20, 0x60, 0x4e, 0x98,
+          0x93, 0x20, 0x8c, 0xd2, 0xf2, 0x80, 0xe9, 0x3e, 0xd0, 0xca, 0xc2, 0xb1, 0x59, 0xd9, 0x6c, 0xb9, 0x07, 0xe3, 0x74, 0x30, 0x4e, 0x22, 0xdd, 0xb7,
+          0x72, 0xfe, 0x7f, 0xc6, 0x4a, 0x0b, 0x32, 0x62, 0x99, 0x33, 0x27, 0x79, 0xec, 0xfa, 0x8f, 0xf3, 0x8e, 0xfb, 0xad, 0xa2, 0xdd, 0xc0, 0x49, 0x5e,
+          0x8d, 0x52, 0x3b, 0x0e, 0x0d, 0x78, 0x16, 0xbb, 0x9b, 0x3b, 0xc7, 0x7e, 0xe1, 0x1e, 0x9f, 0x38, 0x57, 0x67, 0x41, 0x58, 0x94, 0x18, 0x8f, 0x06,
+          0xc5, 0xad, 0x87, 0xfe, 0x75, 0x92, 0x3f, 0x59, 0xc0, 0x8f, 0x0d, 0x2a, 0x65, 0xca, 0xa9, 0x53, 0x8d, 0x4e, 0xda, 0x76, 0x07, 0x9a, 0xb7, 0xfd,
+          0xf7, 0x32, 0x2e, 0xaa, 0xf5, 0x79, 0x76, 0xe3, 0xf2, 0xa7, 0x42, 0x83, 0x27, 0xdb, 0x43, 0x28, 0xec, 0x00, 0x69, 0x52, 0x5b, 0x29, 0x1f, 0xe5,
+          0x1d, 0xb2, 0x27, 0xb4, 0xfc, 0x67, 0xde, 0xcc, 0x62, 0x91, 0x7b, 0x7e, 0xda, 0x44, 0xf9, 0x9f, 0x68, 0xaa, 0x83, 0x34, 0x71, 0x9a, 0xbd, 0x80,
+          0xc2, 0xac, 0xe8, 0xdb, 0xeb, 0xee, 0x76, 0x7a, 0x1e, 0x13, 0xdc, 0xcd, 0xc3, 0x2b, 0xd3, 0x4d, 0x00, 0x35, 0x28, 0x42, 0x0f, 0x01, 0xf4, 0x3d,
+          0x44, 0xb0, 0x66, 0x96, 0xcd, 0x1b, 0x5b, 0xf2, 0xca, 0xca, 0xca, 0x13, 0x56, 0x0c, 0x60, 0xce, 0x0c, 0x88, 0x08, 0x30, 0x67, 0x33, 0x62, 0x57,
+          0x43, 0xb4, 0x0f, 0x88, 0xc5, 0x60, 0x7a, 0x79, 0x41, 0xe6, 0xc5, 0x02, 0x2b, 0xd1, 0x4f, 0xc2, 0x4c, 0x7d, 0x65, 0xfa, 0xd6, 0x93, 0x9f, 0xfa,
+          0x17, 0xad, 0x9d, 0x69, 0xab, 0x79, 0x45, 0xae, 0x48, 0x32, 0x43, 0x00, 0x54, 0xdf, 0xd5, 0x74, 0x90, 0x34, 0xdb, 0xbf, 0xf2, 0xe8, 0xf9, 0xad,
+          0xc3, 0xf7, 0x03, 0xc0, 0xe4, 0x1f, 0x31, 0x69, 0xb1, 0xd1, 0x84, 0x97, 0x4f, 0xfe, 0x10, 0xab, 0x7f, 0x94, 0xa4, 0xc4, 0xfa, 0x81, 0xf1, 0x1b,
+          0xe9, 0xa2, 0x64, 0x61, 0xf9, 0xca, 0x2a, 0x5b, 0xb7, 0x7c, 0x00, 0x7b, 0x5d, 0x83, 0xc5, 0x1e, 0xbf, 0x6b, 0x0f, 0x34, 0x6c, 0x74, 0x60, 0x52,
+          0x1a, 0xd0, 0x8e, 0x29, 0xcf, 0x79, 0xc5, 0xfe, 0xb3, 0x9e, 0xbe, 0xc7, 0x39, 0x8c, 0x63, 0x76, 0x3e, 0x96, 0x00, 0x4f, 0x1c, 0xc1, 0x00, 0x5f,
+          0x5d, 0x07, 0xc5, 0x7f, 0xb7, 0x6e, 0xfd, 0xf4, 0x5b, 0xae, 0x84, 0xb7, 0xe3, 0xb2, 0x78, 0xd8, 0xc4, 0x8d, 0x05, 0xf5, 0x1a, 0xc0, 0xda, 0xec,
+          0xcb, 0xe3, 0xc0, 0x19, 0x3a, 0xbf, 0xde, 0x39, 0xcf, 0xd3, 0xf4, 0xdc, 0x8b, 0xee, 0xbf, 0x64, 0x18, 0x88, 0xff, 0xe0, 0xb8, 0x1d, 0xa5, 0x00,
+          0xd9, 0x06, 0x2a, 0xe9, 0xd7, 0x62, 0xb1, 0xa8, 0x8c, 0xa2, 0xde, 0x89, 0x9a, 0x2e, 0x7f, 0x4c, 0x59, 0x5a, 0xd8, 0x75, 0x1d, 0xca, 0x75, 0xd8,
+          0x6c, 0x44, 0x2e, 0xcd, 0x2b, 0x5a, 0xf5, 0xb8, 0xc8, 0x5d, 0x53, 0x21, 0xd1, 0x93, 0x09, 0x7d, 0x0b, 0x67, 0x9f, 0xb8, 0xc1, 0xf6, 0xb3, 0xeb,
+          0xcc, 0x63, 0x12, 0x8e, 0xb1, 0xba, 0xf9, 0x21, 0xdc, 0xd7, 0x6a, 0x39, 0xff, 0xa5, 0x00, 0x34, 0x5b, 0x67, 0x86, 0xd8, 0xcd, 0x83, 0xf0, 0x7f,
+          0x6c, 0x38, 0x6b, 0xf0, 0x07, 0xcd, 0x69, 0x41, 0x0c, 0xc9, 0x87, 0xde, 0xf5, 0xf2, 0x44, 0x87, 0x09, 0xb3, 0x45, 0x6e, 0x69, 0xd7, 0x06, 0xb0,
+          0x3f, 0xd1, 0x1b, 0x3c, 0x20, 0x4a, 0x5e, 0x6a, 0x35, 0x6a, 0x9b, 0xac, 0x57, 0x64, 0x07, 0x33, 0x15, 0x9e, 0x6a, 0xf9, 0xdc, 0x89, 0xc0, 0x75,
+          0x90, 0x98, 0x1f, 0x6f, 0x7e, 0xbc, 0x51, 0x5e, 0x1a, 0xdb, 0x45, 0x1e, 0x88, 0xc0, 0x1b, 0x1a, 0x8f, 0xc5, 0x8d, 0x2b, 0x5b, 0x57, 0x4b, 0x5d,
+          0x89, 0xa9, 0xd3, 0x1a, 0x08, 0xf6, 0xb2, 0x8d, 0xc3, 0xbb, 0xe7, 0x48, 0x66, 0xf5, 0xc0, 0xf8, 0x47, 0xa3, 0x67, 0xb9, 0x76, 0xe2, 0x1c, 0x1f,
+          0x6d, 0xd4, 0x2d, 0xda, 0xe5, 0x95, 0xc8, 0x1b, 0x12, 0x26, 0x1b, 0xbc, 0x63, 0xa2, 0xfc, 0xbd, 0x6a, 0x6d, 0x0f, 0xbe, 0x98, 0xc5, 0xf0, 0xb0,
+          0x0d, 0x9b, 0x8d, 0xa3, 0x52, 0x59, 0xf6, 0xed, 0x32, 0x4e, 0x18, 0x04, 0xf0, 0x94, 0xbe, 0x8b, 0x0c, 0x92, 0x64, 0xe2, 0x9f, 0xb3, 0x64, 0xa2,
+          0x65, 0xeb, 0xa0, 0xf3, 0xf3, 0x32, 0xe8, 0xa3, 0x7e, 0x26, 0x1d, 0xa1, 0xd7, 0xed, 0x43, 0xc2, 0x8f, 0x37, 0x2f, 0xc3, 0x88, 0xc4, 0x94, 0x4c,
+          0x52, 0x69, 0x1c, 0x47, 0xcb, 0xeb, 0x46, 0x03, 0x66, 0xba, 0xb1, 0x03, 0x6d, 0x8b, 0x28, 0x73, 0xb8, 0xeb, 0x05, 0x80, 0x51, 0xee, 0x93, 0x8c,
+          0x7d, 0xaf, 0x78, 0x9b, 0x85, 0xb5, 0x78, 0xf8, 0x86, 0xd6, 0x09, 0x19, 0x47, 0xcc, 0x4f, 0x53, 0xc5, 0xcd, 0x79, 0x2d, 0xb1, 0x2f, 0x2e, 0xbb,
+          0x32, 0x58, 0xcc, 0xf6, 0x21, 0x08, 0x97, 0x7d, 0xe8, 0x7c, 0x4b, 0xae, 0x95, 0x59, 0x5d, 0xbf, 0xb9, 0x7f, 0xba, 0x49, 0x58, 0x9d, 0xe9, 0xd0,
+          0x00, 0x5b, 0x60, 0x58, 0x17, 0x8b, 0x51, 0x19, 0x38, 0x4b, 0x09, 0xf0, 0x47, 0x9f, 0x7d, 0xd8, 0xf9, 0x8f, 0x9f, 0x7f, 0xe8, 0xbc, 0x8b, 0x44,
+          0x1e, 0x3f, 0x53, 0xfb, 0x38, 0xa4, 0x50, 0xc1, 0x54, 0x91, 0xda, 0xf7, 0x49, 0xed, 0xe2, 0xd8, 0x27, 0x25, 0x9e, 0xd1, 0x61, 0x1c, 0x24, 0x5b,
+          0x24, 0x96, 0xf9, 0x27, 0x41, 0x00, 0x16, 0x7a, 0x75, 0xab, 0x0c, 0x2b, 0xc5, 0xc4, 0x87, 0x0a, 0xfb, 0x4d, 0x08, 0x03, 0x1b, 0x90, 0x61, 0x7c,
+          0x76, 0x56, 0x2d, 0xef, 0x2b, 0xf9, 0xf6, 0xab, 0x3d, 0x61, 0xb8, 0x04, 0xf2, 0x55, 0x3e, 0x57, 0x58, 0xa3, 0x28, 0x5e, 0x5a, 0xde, 0x5c, 0xae,
+          0x15, 0x71, 0x07, 0x9b, 0x91, 0x23, 0x0b, 0xb9, 0xbc, 0x7b, 0x12, 0xf9, 0x63, 0xe6, 0x3f, 0x76, 0x16, 0x87, 0x61, 0xee, 0x9e, 0x8b, 0x03, 0x2b,
+          0xbe, 0xca, 0xd5, 0x91, 0x79, 0xd6, 0xac, 0x99, 0x5f, 0xf8, 0x25, 0xaa, 0x2e, 0xe5, 0xb8, 0x54, 0x25, 0x48, 0x2b, 0x2e, 0xae, 0xfc, 0x86, 0x09,
+          0x57, 0xe8, 0xe4, 0xc3, 0x5e, 0xbe, 0x74, 0xd9, 0x14, 0xc1, 0xf4, 0x21, 0x97, 0x21, 0x52, 0x1e, 0x02, 0xe5, 0x1c, 0x97, 0x9d, 0x56, 0x04, 0x4e,
+          0xec, 0x09, 0x81, 0x0a, 0xda, 0xfe, 0xdf, 0x6e, 0xb4, 0xc6, 0x60, 0x6f, 0xf6, 0x80, 0xe0, 0x73, 0x20, 0x78, 0xc1, 0x10, 0x7c, 0x78, 0x66, 0x1e,
+          0x6c, 0xda, 0xf2, 0x44, 0xfa, 0x54, 0x2f, 0x27, 0x57, 0xb7, 0xd6, 0x4c, 0x87, 0x38, 0xf0, 0xa2, 0xd0, 0x72, 0x7c, 0x6f, 0xdb, 0x4e, 0xb6, 0x12,
+          0x6e, 0xc7, 0x7f, 0x4f, 0xdf, 0xb2, 0x52, 0x18, 0x08, 0x95, 0x8e, 0xeb, 0xf9, 0x0a, 0x31, 0xe4, 0x1c, 0x75, 0xc7, 0xc7, 0xf1, 0x72, 0xc2, 0xf0,
+          0x55, 0xcf, 0xe9, 0x9b, 0x94, 0xee, 0xfe, 0xd9, 0xeb, 0x89, 0xb6, 0xaf, 0x50, 0x95, 0xb0, 0x25, 0xa8, 0x58, 0xa1, 0xea, 0x04, 0x1b, 0x4f, 0xe5,
+          0x2c, 0xc5, 0xc6, 0x3a, 0x50, 0xdf, 0xfc, 0xc6, 0x63, 0x4b, 0xd8, 0x96, 0xb5, 0xea, 0xd6, 0x9d, 0xab, 0xd8, 0x14, 0x7f, 0xf4, 0xee, 0xf8, 0xf6,
+          0x22, 0x6f, 0xf0, 0x75, 0x9e, 0x20, 0xd5, 0x30, 0x5d, 0xc2, 0xc6, 0x4c, 0x2c, 0xe3, 0xc0, 0x17, 0x6c, 0x27, 0x22, 0xb3, 0x49, 0x66, 0xbe, 0xad,
+          0x29, 0x1a, 0x0c, 0xe3, 0x5e, 0x38, 0x81, 0xfd, 0x6d, 0xe5, 0xf5, 0x21, 0xd0, 0xc8, 0x40, 0x84, 0xa8, 0x65, 0xff, 0x2b, 0x8c, 0x51, 0xc9, 0x92,
+          0x4c, 0x9c, 0x09, 0x57, 0x7b, 0x86, 0x4d, 0x29, 0x2c, 0xe2, 0x38, 0x70, 0x24, 0xfe, 0x93, 0x48, 0xe1, 0x9b, 0xdc, 0x22, 0x6a, 0xae, 0x15, 0xc3,
+          0xa9, 0xe3, 0xc3, 0x9f, 0xbb, 0x06, 0x98, 0x75, 0xe7, 0x26, 0x8f, 0x18, 0xf0, 0x1e, 0x88, 0xf9, 0x48, 0x17, 0x2e, 0xd9, 0x22, 0x2a, 0x17, 0x42,
+          0x6f, 0xa1, 0x10, 0xa2, 0xd7, 0x81, 0x18, 0x51, 0x7c, 0xfd, 0x0b, 0xe7, 0xe3, 0x2f, 0x8e, 0x07, 0xeb, 0xaa, 0x44, 0x57, 0x17, 0x9b, 0xcb, 0xca,
+          0x01, 0x4b, 0x91, 0x43, 0xfa, 0x2d, 0xd3, 0x0a, 0x5d, 0x7a, 0xed, 0x85, 0xc7, 0x22, 0x36, 0xe8, 0xe1, 0xa6, 0x99, 0xb2, 0x4e, 0xda, 0x7f, 0x6c,
+          0xf3, 0x8f, 0x67, 0x9f, 0x8d, 0xc5, 0x35, 0x9a, 0xec, 0xc0, 0x04, 0xfe, 0xb5, 0x3c, 0x9b, 0xcf, 0x3d, 0xa0, 0xb9, 0x13, 0xc4, 0x6a, 0xd0, 0xdb,
+          0xc0, 0xf3, 0xd3, 0x26, 0xa6, 0x9f, 0x36, 0x2c, 0x72, 0x69, 0x25, 0xda, 0xc2, 0x61, 0xf7, 0x20, 0xdc, 0x50, 0xa0, 0x9f, 0x2f, 0x25, 0x0a, 0xb4,
+          0xd7, 0x2f, 0x07, 0x66, 0xcc, 0xc3, 0x96, 0x12, 0xf0, 0x84, 0xbd, 0x79, 0xbb, 0x9d, 0x0d, 0x9b, 0x6e, 0x35, 0x55, 0xbd, 0x72, 0x7f, 0x8e, 0x34,
+          0x32, 0xaa, 0x8d, 0x4c, 0x79, 0x9b, 0xdc, 0x18, 0x79, 0xa3, 0x3d, 0x4c, 0x9e, 0x6f, 0xc7, 0xcc, 0x09, 0x7d, 0xa8, 0xfe, 0xfa, 0x3d, 0x29, 0x41,
+          0x0f, 0xb0, 0x36, 0x40, 0xb7, 0x4e, 0x41, 0x96, 0x2e, 0x24, 0x15, 0xe3, 0xef, 0x47, 0xea, 0xf8, 0x44, 0x48, 0x95, 0xb1, 0x7e, 0xca, 0x06, 0x2e,
+          0x11, 0xca, 0xa6, 0xa8, 0x3d, 0x3a, 0xf2, 0x7f, 0xc5, 0xeb, 0xc1, 0x7a, 0xe5, 0x1a, 0x96, 0x42, 0xab, 0xa9, 0x64, 0x4a, 0x3f, 0xad, 0xda, 0x82,
+          0x8e, 0xdf, 0x20, 0xc1, 0xc0, 0x53, 0x6a, 0x7d, 0x06, 0x38, 0x8e, 0x56, 0x2f, 0xa0, 0x6b, 0xb1, 0x14, 0xba, 0xd3, 0xd2, 0xf0, 0x35, 0x1a, 0x62,
+          0xcb, 0x3b, 0x02, 0x48, 0xa0, 0x3f, 0x42, 0xcf, 0x35, 0x51, 0xdc, 0x61, 0x0b, 0x42, 0xa3, 0xad, 0xae, 0xe7, 0x0c, 0x88, 0x95, 0x64, 0xed, 0x8f,
+          0xcb, 0x39, 0x97, 0xc7, 0x86, 0xf0, 0xdc, 0x66, 0x07, 0x77, 0x38, 0x42, 0x72, 0x56, 0xa0, 0xc0, 0x64, 0xb3, 0x7c, 0x82, 0x93, 0xba, 0x07, 0x7b,
+          0x07, 0x17, 0xff, 0x92, 0x56, 0x2a, 0x39, 0x0f, 0x1b, 0x34, 0xf3, 0x40, 0x38, 0x1e, 0x7b, 0x4f, 0x27, 0x43, 0x27, 0xf0, 0xc8, 0x8d, 0xe4, 0x2b,
+          0x1f, 0x61, 0x35, 0xce, 0x43, 0xfa, 0x4c, 0x22, 0x21, 0x3c, 0x0f, 0xea, 0x58, 0x71, 0x1e, 0xb6, 0x41, 0x41, 0x44, 0x75, 0x0c, 0xb9, 0x11, 0x67,
+          0xd5, 0xcc, 0xd4, 0xdb, 0x37, 0x62, 0x4b, 0x6d, 0x4f, 0x27, 0xa2, 0xa3, 0x53, 0x98, 0x15, 0x30, 0x28, 0x63, 0x88, 0xb3, 0x14, 0x0f, 0x34, 0x80,
+          0xb5, 0xa6, 0x15, 0xa9, 0x87, 0x1a, 0x95, 0x79, 0x1f, 0x1b, 0x23, 0x80, 0xb5, 0x9a, 0x3d, 0x55, 0x80, 0x1b, 0x1a, 0x92, 0xd2, 0x1b, 0x8f, 0x6f,
+          0x83, 0xde, 0x7a, 0x85, 0x3b, 0x5f, 0xb0, 0x28, 0x85, 0x7c, 0x88, 0xd9, 0x36, 0x3d, 0xae, 0x9a, 0x01, 0x2b, 0x6e, 0xdc, 0xe4, 0x51, 0x92, 0xb1,
+          0xdb, 0xee, 0x74, 0x9f, 0x44, 0x9e, 0xc5, 0x0a, 0xf8, 0xf0, 0x81, 0x37, 0x44, 0xd9, 0x44, 0xb0, 0x79, 0x83, 0x14, 0xa1, 0xf2, 0xc1, 0x48, 0x41,
+          0x09, 0xc5, 0x25, 0x84, 0x10, 0xe4, 0xc1, 0xdb, 0xc6, 0xc9, 0x40, 0x6c, 0x69, 0x1f, 0x9f, 0x49, 0x2f, 0x50, 0x3f, 0x01, 0x1d, 0x68, 0xd0, 0x63,
+          0x30, 0x21, 0x7b, 0xe5, 0x09, 0x61, 0x91, 0xb9, 0x30, 0x05, 0xd6, 0xea, 0x2b, 0xa7, 0xb4, 0x7d, 0x98, 0x1d, 0x1f, 0xf1, 0xbd, 0xfb, 0x0d, 0xbd,
+          0xd1, 0x35, 0xe3, 0x14, 0xd2, 0x35, 0x5a, 0x4d, 0x85, 0x0e, 0x7a, 0x9e, 0x3b, 0xb3, 0x54, 0x8d, 0xeb, 0xa2, 0x25, 0x62, 0xba, 0xfd, 0x95, 0x40,
+          0x57, 0xee, 0xfd, 0xa2, 0x57, 0x4b, 0xcb, 0x8d, 0x10, 0x96, 0x0a, 0xd5, 0xd3, 0x45, 0x85, 0x01, 0x5e, 0x4e, 0xe0, 0xee, 0xdc, 0xe1, 0x44, 0xe9,
+          0xb8, 0x45, 0x1a, 0xc0, 0xa2, 0xed, 0x09, 0x2d, 0x11, 0xb7, 0xf1, 0x3e, 0xaf, 0xa9, 0xeb, 0x9d, 0x0f, 0xdc, 0xe0, 0x17, 0x9a, 0x0c, 0x6d, 0xd6,
+          0x92, 0x1e, 0xa8, 0x8e, 0x5a, 0xbc, 0x45, 0xd9, 0xfd, 0xdb, 0x18, 0x49, 0x81, 0xf7, 0x94, 0xad, 0x7b, 0x85, 0x61, 0x67, 0x7b, 0x69, 0x4a, 0xa5,
+          0xae, 0x32, 0xea, 0xd9, 0x9d, 0x02, 0x7d, 0xa3, 0x9e, 0xbe, 0x08, 0xee, 0xb6, 0xb7, 0xac, 0x63, 0x50, 0x7b, 0x6a, 0xe6, 0xdf, 0xe9, 0x4d, 0x19,
+          0xfd, 0x3a, 0x15, 0xc9, 0x19, 0xda, 0xd4, 0x31, 0x9a, 0xb6, 0x57, 0x78, 0x07, 0x3b, 0x9e, 0x56, 0x9c, 0x69, 0x61, 0xc1, 0xef, 0x64, 0xef, 0x67,
+          0x2c, 0xf4, 0x85, 0xb9, 0xd9, 0x8a, 0x04, 0x08, 0x1f, 0x1e, 0x0f, 0x87, 0xb4, 0x77, 0xe3, 0x50, 0xb4, 0xb9, 0xfa, 0xf1, 0xea, 0x83, 0x88, 0x15,
+          0x21, 0xc3, 0xff, 0x30, 0xb5, 0x11, 0x17, 0xe5, 0x88, 0x9f, 0xcf, 0xa0, 0x3b, 0xb1, 0xc9, 0x7d, 0x7e, 0x98, 0x19, 0x84, 0xc3, 0x65, 0xb8, 0xe8,
+          0xd5, 0x5c, 0xd2, 0x87, 0x73, 0xdb, 0x5d, 0x6a, 0x4c, 0xaa, 0x0f, 0xd6, 0x42, 0x9e, 0xa5, 0xf9, 0xa4, 0x4f, 0xc8, 0x2f, 0x26, 0xef, 0x60, 0x42,
+          0xdd, 0x9e, 0x2e, 0xf6, 0xf2, 0x7e, 0xf4, 0xc5, 0xb7, 0x5b, 0x88, 0x58, 0x67, 0xd1, 0xde, 0xe8, 0xfa, 0xad, 0xeb, 0xba, 0x7c, 0x6c, 0xf7, 0xb0,
+          0x2a, 0xc7, 0x1f, 0x7b, 0xb2, 0x06, 0x1e, 0xcb, 0x60, 0xb2, 0x11, 0x92, 0xe8, 0xdf, 0xb1, 0x6b, 0xf4, 0x65, 0xdc, 0xb8, 0x97, 0x51, 0x00, 0x3c,
+          0xf2, 0x86, 0xeb, 0x2f, 0xed, 0x92, 0x6f, 0xc5, 0x8c, 0x1c, 0x02, 0x26, 0xca, 0xb8, 0xbf, 0x7d, 0xb5, 0x61, 0x2f, 0xb5, 0x95, 0xc7, 0x1f, 0x28,
+          0xd2, 0x43, 0x1c, 0x3f, 0x77, 0xbd, 0x3e, 0x3c, 0x29, 0x8c, 0x78, 0xbd, 0x47, 0x99, 0x2b, 0x0a, 0x7b, 0xce, 0xef, 0x1a, 0x03, 0x09, 0xba, 0x05,
+          0x5f, 0x67, 0x5b, 0x0c, 0x28, 0x78, 0xcc, 0x96, 0x20, 0x4d, 0xe6, 0x8a, 0xd9, 0xdd, 0x76, 0x21, 0x1e, 0x1d, 0x46, 0xa7, 0x7f, 0xfd, 0x69, 0xdc,
+          0xa0, 0x78, 0xdf, 0xfd, 0xff, 0x17, 0x4d, 0x92, 0xf6, 0xc8, 0xc0, 0xbd, 0xe0, 0x6e, 0x61, 0x3d, 0x36, 0x63, 0xa8, 0xbf, 0x0f, 0x66, 0xb0, 0x9c,
+          0x05, 0x2d, 0x7c, 0xc1, 0xa5, 0xf9, 0x47, 0x3a, 0x85, 0x29, 0x1e, 0xcf, 0xe8, 0x56, 0x8f, 0xf6, 0x48, 0xf2, 0xfe, 0x26, 0x3a, 0xd0, 0x78, 0xec,
+          0x5d, 0x4d, 0x78, 0x0b, 0x59, 0xbd, 0x22, 0x11, 0xc5, 0x67, 0x94, 0xa0, 0x90, 0x03, 0xfa, 0x02, 0xd0, 0xbe, 0x21, 0xe3, 0xf4, 0x33, 0xe5, 0xaf,
+          0x77, 0x6b, 0x54, 0x81, 0x57, 0x83, 0xc7, 0x2d, 0xbb, 0xe2, 0x99, 0x87, 0x02, 0xfc, 0x5f, 0x41, 0x5a, 0x9a, 0x95, 0x4e, 0x00, 0x27, 0xe5, 0xdc,
+          0xae, 0x47, 0xf5, 0x5d, 0x97, 0x68, 0xe8, 0xc0, 0x04, 0x05, 0x2c, 0x98, 0xf8, 0x21, 0x08, 0xa1, 0x66, 0x30, 0xc5, 0x3a, 0xe8, 0x77, 0xed, 0x2b,
+          0xda, 0x29, 0x9a, 0xac, 0x70, 0xea, 0xea, 0x7c, 0x35, 0x58, 0x2c, 0x4d, 0x6a, 0x67, 0x1c, 0x1c, 0x49, 0xe2, 0x17, 0x17, 0xf7, 0x44, 0xde, 0x9d,
+          0xca, 0x67, 0x30, 0x54, 0xa2, 0x0c, 0x87, 0x6c, 0x47, 0xd6, 0xa5, 0x0c, 0x4a, 0x6b, 0x8a, 0xaa, 0xa4, 0x1d, 0x5f, 0x10, 0xed, 0xa1, 0x67, 0x2a,
+          0x9e, 0x4a, 0x80, 0x87, 0x04, 0xfb, 0x74, 0x58, 0x11, 0x92, 0x52, 0x30, 0xd7, 0x7d, 0x65, 0x40, 0xc4, 0xae, 0xe8, 0xaf, 0x7a, 0x30, 0xad, 0x47,
+          0x7b, 0x0f, 0xbe, 0x06, 0x0b, 0x02, 0x62, 0x2f, 0xc1, 0x69, 0xf5, 0xe9, 0xdf, 0xd3, 0x5b, 0xf3, 0xf4, 0xa5, 0x7c, 0x1c, 0xea, 0x90, 0x2a, 0xe8,
+          0xf8, 0x4f, 0x08, 0x8e, 0x8a, 0xa7, 0x76, 0x60, 0x5c, 0x88, 0x7e, 0xf7, 0x72, 0xee, 0xcc, 0xed, 0x15, 0xc3, 0x3e, 0x9b, 0xd9, 0xb2, 0x3f, 0x80,
+          0x38, 0x9d, 0xbf, 0x3d, 0x8e, 0x33, 0x6d, 0xf8, 0x2f, 0xf1, 0x54, 0xb4, 0x80, 0x13, 0x6d, 0x8c, 0x63, 0x70, 0xa0, 0x9f, 0x33, 0x4f, 0xce, 0x9f,
+          0xaf, 0x5d, 0xcd, 0xa5, 0x3d, 0x62, 0x4c, 0x92, 0xed, 0xa1, 0xfb, 0x0e, 0x81, 0x75, 0x2d, 0x97, 0x06, 0xb6, 0xc2, 0xcd, 0x9b, 0x8c, 0x60, 0x7a,
+          0xde, 0x93, 0x52, 0x7a, 0x52, 0x01, 0x6a, 0xba, 0x50, 0xb4, 0x58, 0xe1, 0x6a, 0xe7, 0x0e, 0x80, 0x30, 0xa3, 0x8a, 0x6c, 0xac, 0xa0, 0x96, 0xba,
+          0xd7, 0x19, 0x8f, 0x06, 0x47, 0x2a, 0xb3, 0x67, 0x43, 0x51, 0xfa, 0xca, 0x8d, 0xd6, 0x52, 0xce, 0x49, 0x72, 0x18, 0x5c, 0xea, 0xea, 0x06, 0x86,
+          0x7d, 0xac, 0x00, 0x6d, 0x29, 0xde, 0xc6, 0x7d, 0x69, 0xe8, 0xad, 0x25, 0xee, 0x7f, 0xc2, 0x1a, 0xdb, 0x66, 0xba, 0x04, 0xe7, 0x90, 0xc2, 0x5a,
+          0x2a, 0x50, 0x07, 0xd1, 0x73, 0x2a, 0x1b, 0x5a, 0x16, 0x9d, 0xd4, 0xf5, 0x49, 0xe0, 0xe1, 0xfa, 0xc7, 0x2d, 0xc7, 0x7d, 0x13, 0x5f, 0x91, 0x0b,
+          0x9f, 0xfa, 0x8e, 0x37, 0x0b, 0xfa, 0x11, 0x48, 0x7a, 0xab, 0x8d, 0x2c, 0x06, 0xcf, 0x85, 0x1e, 0xcd, 0xa0, 0xfe, 0x6c, 0x6b, 0xc9, 0x60, 0xa0,
+          0xb7, 0x27, 0x44, 0xda, 0xa7, 0x9b, 0x06, 0x84, 0x76, 0xb5, 0xd3, 0x46, 0x01, 0xe8, 0xe5, 0xa7, 0xa0, 0x16, 0x65, 0x60, 0xb7, 0x83, 0x7c, 0x01,
+          0x20, 0xb7, 0x71, 0x32, 0xb5, 0x2e, 0xf2, 0xe3, 0x20, 0x6b, 0x99, 0x8a, 0x22, 0x5e, 0x46, 0x5f, 0xe3, 0xa8, 0x3e, 0xbe, 0x29, 0xfe, 0x8c, 0x7a,
+          0xfd, 0xec, 0xa2, 0xf2, 0x77, 0xdf, 0xf9, 0x67, 0x19, 0x5d, 0xa6, 0xcf, 0x11, 0xbd, 0x78, 0x46, 0x0c, 0x39, 0x03, 0x79, 0x22, 0x59, 0xb7, 0xd1,
+          0x72, 0x8e, 0xca, 0xa7, 0x60, 0xb7, 0x3b, 0xd4, 0x43, 0x27, 0xb1, 0x99, 0xfc, 0x63, 0xf7, 0x57, 0xd8, 0xc9, 0x67, 0xfd, 0x24, 0x2f, 0x27, 0xba,
+          0xe9, 0x74, 0x8e, 0xf7, 0x75, 0xc2, 0x09, 0x1e, 0xdf, 0xfe, 0x7f, 0x6e, 0xe5, 0xf7, 0xe3, 0x5f, 0xbb, 0xec, 0xfb, 0xcc, 0xc5, 0x09, 0x4d, 0x54,
+          0x78, 0xe1, 0x43, 0xa0, 0x32, 0x6f, 0x3c, 0x7e, 0x6e, 0xae, 0x2d, 0xa7, 0xc7, 0x1a, 0x13, 0x6d, 0x3e, 0x76, 0xa6, 0xa5, 0xea, 0x15, 0xb2, 0xfa,
+          0xac, 0x90, 0x16, 0xb9, 0x06, 0x5d, 0x8a, 0xbb, 0x28, 0xee, 0x47, 0x38, 0x13, 0x39, 0xca, 0xaf, 0x45, 0xd1, 0x7e, 0x6e, 0x19, 0x8f, 0x9c, 0x2e,
+          0x45, 0xe7, 0x05, 0xbd, 0xe7, 0xde, 0x59, 0xc1, 0x61, 0xed, 0xf0, 0x7e, 0x6c, 0xbd, 0xb9, 0xd8, 0x1b, 0xf4, 0x38, 0x2a, 0x98, 0x50, 0xbb, 0xa5,
+          0x46, 0x87, 0x29, 0x2b, 0x54, 0xfe, 0x66, 0xe0, 0xd6, 0x8b, 0xbd, 0x50, 0x71, 0x4b, 0x05, 0x30, 0x9b, 0x46, 0xee, 0x62, 0x59, 0xec, 0x57, 0xea,
+          0xca, 0xfc, 0xd2, 0x83, 0x26, 0xe5, 0x02, 0x62, 0xaa, 0x62, 0xbd, 0x58, 0xae, 0x89, 0xd6, 0xda, 0xe0, 0x98, 0x9f, 0xc9, 0x74, 0x45, 0x45, 0xa1,
+          0x25, 0xf7, 0x0d, 0x03, 0xb5, 0x2c, 0x91, 0xad, 0x45, 0xf7, 0x94, 0x10, 0x0e, 0xb0, 0xe2, 0x40, 0x03, 0xc3, 0xcb, 0x5d, 0xe3, 0x43, 0x7f, 0xde,
+          0x17, 0x82, 0x85, 0x26, 0x4d, 0x8a, 0xa6, 0xc8, 0x39, 0xf7, 0xd3, 0xc7, 0x9b, 0xc6, 0x00, 0xec, 0x5d, 0x33, 0xcf, 0x46, 0xd0, 0xce, 0x51, 0x47,
+          0xcf, 0x4d, 0x54, 0x90, 0x51, 0x64, 0x28, 0x46, 0x8a, 0x29, 0x6b, 0x8f, 0x4c, 0xe1, 0x5e, 0x5c, 0x9a, 0xac, 0x9e, 0xea, 0xe5, 0x19, 0x76, 0x8e,
+          0x07, 0x5c, 0xad, 0xac, 0x8b, 0xbb, 0x4e, 0x90, 0x48, 0x50, 0xf6, 0xd3, 0x11, 0x88, 0x28, 0x81, 0x6a, 0xdc, 0x82, 0xfd, 0xbf, 0x8e, 0x88, 0xa7,
+          0x4b, 0xab, 0xe3, 0x31, 0xb9, 0xc6, 0xe5, 0x90, 0xe1, 0xb0, 0x73, 0xa4, 0x62, 0xe1, 0x4f, 0xcb, 0x5a, 0x2f, 0x55, 0xb0, 0x27, 0x6c, 0x4d, 0x9d,
+          0xba, 0x11, 0x30, 0x88, 0xc1, 0x35, 0x6d, 0x54, 0xc3, 0x6e, 0x35, 0x5a, 0x9b, 0x4b, 0x95, 0xd3, 0x4a, 0x80, 0x6a, 0x1b, 0x27, 0xf9, 0xf4, 0x50,
+          0x89, 0x31, 0xff, 0xcc, 0x37, 0xb3, 0x96, 0x9f, 0x0d, 0x42, 0x68, 0x03, 0xfb, 0x33, 0xaf, 0xec, 0xea, 0x68, 0x5c, 0xa1, 0x34, 0xd6, 0xdb, 0x3a,
+          0xe6, 0x30, 0xf2, 0x22, 0x48, 0x47, 0xcc, 0xcd, 0x08, 0x4b, 0x95, 0x41, 0x4c, 0x4a, 0xa8, 0x27, 0x25, 0xc4, 0xfc, 0xe5, 0x89, 0xd4, 0xfa, 0xcf,
+          0xeb, 0x46, 0x97, 0xfe, 0x7b, 0x45, 0xfe, 0xf3, 0x0e, 0xfb, 0x4a, 0x7d, 0xa1, 0x95, 0x39, 0xa0, 0x35, 0x60, 0xe9, 0xc3, 0x64, 0x4d, 0x5e, 0x07,
+          0x24, 0xa2, 0xb5, 0x82, 0x33, 0xa9, 0xe0, 0x5b, 0xa6, 0x46, 0x70, 0x4a, 0x90, 0x69, 0x20, 0x5a, 0x8b, 0xf8, 0xd9, 0x27, 0xa9, 0x15, 0x94, 0x37,
+          0xa3, 0x37, 0x22, 0x01, 0x91, 0xcb, 0xd0, 0x44, 0xc5, 0x28, 0x72, 0x66, 0x72, 0x8f, 0xc9, 0xa8, 0x15, 0x71, 0x9e, 0x70, 0xac, 0x78, 0xb9, 0x08,
+          0x44, 0x92, 0xd3, 0xbd, 0x02, 0x32, 0x67, 0x5d, 0xca, 0x64, 0x27, 0xc8, 0x2e, 0xb6, 0xc3, 0xc5, 0x37, 0xc3, 0x0a, 0x1f, 0x8b, 0x6f, 0x88, 0x50,
+          0x37, 0xb6, 0x0e, 0x5b, 0x01, 0xab, 0x73, 0x44, 0xc9, 0xaa, 0x50, 0x69, 0xab, 0x58, 0x82, 0x26, 0xdc, 0xa0, 0xc0, 0xe2, 0x12, 0xfd, 0xc4, 0xa3,
+          0x4b, 0xd5, 0x4e, 0xdd, 0x01, 0xb8, 0x83, 0x40, 0x33, 0x7d, 0x21, 0x2e, 0x5c, 0xbb, 0x9f, 0xd0, 0x6e, 0x2e, 0x8d, 0x86, 0x14, 0xd1, 0xec, 0x4c,
+          0xe5, 0x0e, 0x09, 0xb7, 0x59, 0xf4, 0xd9, 0xc0, 0x8e, 0x81, 0xc9, 0xc0, 0x9c, 0x5a, 0x77, 0xf4, 0x62, 0x47, 0xef, 0x50, 0x41, 0x46, 0x4f, 0x64,
+          0xea, 0xcc, 0x66, 0xa8, 0x12, 0x5f, 0xb0, 0xf1, 0x98, 0x5e, 0xc7, 0x4a, 0x17, 0xd6, 0x37, 0xf3, 0x2f, 0x51, 0xd8, 0x73, 0xd1, 0xeb, 0xfe, 0x2d,
+          0x01, 0xd4, 0xf4, 0x14, 0xb9, 0xc8, 0x38, 0xcf, 0xc8, 0xe5, 0x2c, 0xca, 0x7f, 0x87, 0xcd, 0xde, 0x28, 0xee, 0xda, 0xe5, 0xa5, 0xfa, 0xea, 0x86,
+          0x5d, 0x5c, 0xbe, 0x90, 0xc7, 0xeb, 0xac, 0xac, 0x93, 0x42, 0xa5, 0x3b, 0x46, 0xb5, 0xbb, 0x3f, 0x44, 0x52, 0xc7, 0x42, 0xac, 0xc3, 0xf5, 0xec,
+          0x77, 0xa9, 0x82, 0xef, 0x2b, 0xb2, 0x35, 0xbc, 0x87, 0x0e, 0xe9, 0xf0, 0x3b, 0x4d, 0x25, 0xd7, 0xcc, 0x44, 0xb5, 0x2f, 0x80, 0x60, 0x96, 0x20,
+          0x8f, 0xe3, 0x9b, 0xac, 0x35, 0x06, 0x63, 0x1a, 0xda, 0x48, 0x23, 0x39, 0xdc, 0xe0, 0x40, 0xc5, 0xb7, 0xba, 0x5a, 0xc8, 0x4a, 0xa3, 0x2d, 0xab,
+          0xa5, 0x37, 0xd6, 0xe6, 0xbf, 0xa2, 0x8f, 0x0f, 0x98, 0x29, 0x06, 0x11, 0x13, 0x45, 0xb6, 0x07, 0x58, 0x81, 0x90, 0x20, 0x9b, 0x29, 0x10, 0x38,
+          0x49, 0x61, 0xfb, 0x7d, 0xfc, 0x93, 0x7c, 0x74, 0xe2, 0xe4, 0x03, 0x3e, 0x23, 0x8a, 0xef, 0xba, 0x85, 0xb7, 0x81, 0x66, 0xa0, 0x54, 0x4c, 0xf8,
+          0x5b, 0xac, 0x84, 0x07, 0x71, 0x50, 0x04, 0xc9, 0x3d, 0x96, 0x2c, 0x55, 0xeb, 0x47, 0x1d, 0x46, 0x52, 0x2a, 0xb1, 0x96, 0x1b, 0x8a, 0x71, 0x90,
+          0xd8, 0x0c, 0x6c, 0x61, 0xa9, 0x54, 0xa2, 0x3a, 0x2e, 0xd9, 0xce, 0x15, 0x0a, 0x23, 0x4f, 0xa8, 0x25, 0xab, 0xfc, 0xd9, 0x23, 0x2d, 0x32, 0x08,
+          0x9a, 0x2f, 0xb2, 0xcc, 0x67, 0x6f, 0xaa, 0x0e, 0x07, 0xe9, 0x91, 0xda, 0x84, 0xa0, 0xbd, 0xdc, 0xb2, 0x4d, 0x16, 0x9e, 0x47, 0xe0, 0xe1, 0x94,
+          0x40, 0x6e, 0xaa, 0x38, 0x5d, 0x89, 0x47, 0x1a, 0xf2, 0x3b, 0xca, 0xb9, 0x28, 0xb3, 0xea, 0x37, 0x75, 0x95, 0x28, 0x2d, 0xa7, 0x8c, 0x8d, 0x58,
+          0x6f, 0xdf, 0x05, 0x31, 0x40, 0x8a, 0x8d, 0xe8, 0x32, 0x5b, 0x12, 0x8a, 0xed, 0x91, 0x71, 0x47, 0x3e, 0x59, 0x81, 0x13, 0x6f, 0x76, 0x3e, 0xaa,
+          0xb6, 0x04, 0xdc, 0x1f, 0x27, 0x25, 0x35, 0xe7, 0x3b, 0x75, 0x1f, 0x0e, 0xff, 0x09, 0xf8, 0x1a, 0xb9, 0x27, 0x47, 0x8a, 0x95, 0x50, 0xc8, 0xd6,
+          0x4f, 0x22, 0x2f, 0x7f, 0x7f, 0x36, 0xaa, 0xfd, 0xed, 0xb3, 0xb3, 0xf8, 0xfb, 0xe7, 0xa1, 0x4a, 0x7e, 0x7c, 0xf5, 0x93, 0xe0, 0xee, 0xdf, 0xe1,
+          0x2a, 0xc3, 0xc6, 0x25, 0x47, 0x61, 0x52, 0x6f, 0xad, 0xe9, 0x6f, 0xc1, 0xe5, 0x4e, 0xb3, 0xb3, 0x9c, 0x13, 0x2a, 0xa1, 0x41, 0x6c, 0xe7, 0x44,
+          0x87, 0xfc, 0x09, 0x97, 0x14, 0x74, 0x79, 0xe2, 0xc3, 0x03, 0x49, 0x19, 0x82, 0x0b, 0x99, 0xd4, 0x21, 0x79, 0x5f, 0x74, 0xfc, 0xc1, 0x54, 0x70,
+          0x0f, 0xa6, 0x7c, 0xb4, 0x1b, 0x33, 0x1a, 0x86, 0xad, 0x2b, 0x39, 0xc3, 0xa9, 0x44, 0x87, 0xe7, 0x32, 0x51, 0xe3, 0xd1, 0x72, 0x41, 0x85, 0x3f,
+          0xe7, 0x4f, 0xaa, 0xc9, 0xb0, 0x69, 0xab, 0x22, 0x17, 0x1b, 0x05, 0x36, 0x9c, 0xc9, 0x46, 0xed, 0x35, 0xde, 0x34, 0x4c, 0xec, 0xbb, 0x46, 0xe3,
+          0xd7, 0x79, 0x2a, 0x96, 0xaf, 0xa2, 0x88, 0x5a, 0x10, 0xf6, 0x87, 0xf1, 0x4a, 0x29, 0xd0, 0x70, 0x1f, 0xd5, 0xec, 0x7a, 0x69, 0x5b, 0x79, 0x19,
+          0x99, 0xb7, 0x47, 0xb1, 0x07, 0xe8, 0x33, 0x5c, 0x7d, 0x2e, 0xd3, 0xce, 0x82, 0x76, 0xf2, 0x0d, 0xa6, 0x26, 0x32, 0x07, 0x3d, 0x91, 0x35, 0x53,
+          0x57, 0xa9, 0x0c, 0x03, 0xc0, 0xc7, 0xaf, 0x55, 0x15, 0xfb, 0xd1, 0x9d, 0x04, 0xcb, 0xcc, 0xdb, 0xa3, 0x9b, 0x47, 0xa3, 0x87, 0x75, 0x60, 0xac,
+          0x16, 0xd8, 0xbc, 0x35, 0x26, 0xb3, 0x8b, 0x14, 0x3d, 0x44, 0x15, 0xfe, 0xf2, 0xc5, 0xf0, 0x2f, 0xd1, 0x3a, 0x2f, 0xfa, 0x0d, 0x5b, 0x20, 0x09,
+          0x55, 0x8e, 0x11, 0xe1, 0x8a, 0x8d, 0xa4, 0xbf, 0x0a, 0x9a, 0xf9, 0x4f, 0xcf, 0xe4, 0x52, 0xe4, 0xe1, 0xa6, 0xbf, 0xd9, 0xd9, 0x91, 0xd4, 0xb1,
+          0x5b, 0x09, 0x58, 0x97, 0x18, 0xf4, 0xa4, 0x39, 0x7c, 0x21, 0xb4, 0xb9, 0xa3, 0x9e, 0x51, 0x77, 0xc9, 0xee, 0xb2, 0x30, 0xc2, 0xe9, 0xfb, 0xf3,
+          0x86, 0x07, 0x32, 0xbc, 0x73, 0x42, 0x9f, 0x31, 0xfa, 0x7b, 0xf5, 0x59, 0x69, 0x8f, 0x6d, 0x00, 0x18, 0xf3, 0xbf, 0x9d, 0x2e, 0x75, 0xf8, 0xb0,
+          0xf0, 0xde, 0x24, 0x74, 0x9a, 0x44, 0xbc, 0xc8, 0x9d, 0x82, 0x49, 0xc2, 0x35, 0x4d, 0x2c, 0xb4, 0xd2, 0x97, 0x02, 0xff, 0xd2, 0x09, 0x58, 0xc5,
+          0x9f, 0xbf, 0xbe, 0xd1, 0x98, 0x57, 0x17, 0xad, 0x29, 0xcb, 0xc5, 0x20, 0x99, 0x9e, 0x30, 0x7b, 0xb2, 0xc3, 0xca, 0x3f, 0xae, 0x47, 0xfa, 0xe1,
+          0x6e, 0x4d, 0xd1, 0x51, 0xdd, 0x5a, 0x85, 0xb7, 0x14, 0x7e, 0x0a, 0xef, 0x5b, 0xd9, 0xf1, 0xae, 0xc1, 0xb6, 0xa2, 0x70, 0x6e, 0x0d, 0xf1, 0x52,
+          0xd7, 0xa4, 0x90, 0xc4, 0x56, 0xa5, 0xe4, 0xc2, 0xc4, 0xe2, 0x3d, 0x7a, 0x5c, 0xfb, 0x27, 0x49, 0xe0, 0x9f, 0xaa, 0x37, 0xc0, 0x06, 0xef, 0xb7,
+          0x62, 0xc1, 0x2f, 0x9f, 0xe8, 0xa0, 0x84, 0xe1, 0xb9, 0xca, 0x10, 0x63, 0xe6, 0x5b, 0x83, 0xcd, 0x9d, 0x4d, 0x6c, 0x0a, 0x4a, 0x16, 0xdb, 0xe2,
+          0x85, 0x50, 0x88, 0x2d, 0x8d, 0x9d, 0xe0, 0x78, 0xb0, 0x8d, 0x7b, 0xf6, 0xc0, 0x48, 0xa7, 0x8d, 0x23, 0x4b, 0x7b, 0xde, 0x3b, 0xde, 0x26, 0x4b,
+          0x77, 0x7b, 0x19, 0xb2, 0x19, 0xc6, 0x18, 0xdd, 0xbb, 0x87, 0xb1, 0x95, 0xf6, 0xe5, 0xfe, 0x47, 0x20, 0x4f, 0x9f, 0x39, 0x68, 0xd2, 0x5b, 0x75,
+          0xa6, 0x1b, 0x99, 0xac, 0xd8, 0xaa, 0xf2, 0x21, 0x7b, 0x33, 0xf7, 0x3d, 0xb6, 0x06, 0x6c, 0x30, 0xea, 0xf9, 0x0c, 0x65, 0x9a, 0xd9, 0xfb, 0x57,
+          0x17, 0x6f, 0x5a, 0x96, 0x45, 0x95, 0x30, 0x7b, 0x92, 0xd5, 0x64, 0x72, 0xe1, 0x63, 0x21, 0xb6, 0xf3, 0x43, 0xe3, 0x3f, 0xaf, 0x7e, 0x5e, 0x95,
+          0x5d, 0x21, 0x22, 0x96, 0xd3, 0x39, 0xb7, 0x08, 0x98, 0x7b, 0xdd, 0x88, 0x29, 0x1b, 0x0a, 0x5a, 0xcc, 0xc5, 0xa6, 0xd1, 0xb4, 0x0b, 0x88, 0x99,
+          0xbe, 0x52, 0x3c, 0x63, 0xf6, 0xe8, 0xbb, 0x74, 0xd7, 0xb0, 0xcf, 0x64, 0x4e, 0x65, 0x5f, 0xd0, 0x5d, 0x7e, 0x02, 0xf3, 0x67, 0xcd, 0xfb, 0x72,
+          0x1e, 0xc2, 0x19, 0x8f, 0x30, 0xa1, 0xb2, 0xa8, 0x05, 0xc7, 0xa8, 0xcd, 0x00, 0x82, 0x7e, 0x41, 0xc4, 0xae, 0xbd, 0x38, 0x08, 0xa9, 0x66, 0x9e,
+          0xc6, 0x52, 0xf0, 0x3d, 0xfe, 0x7a, 0x65, 0x53, 0xb9, 0x3e, 0xb5, 0x74, 0xcb, 0x71, 0xe6, 0xc8, 0xf8, 0xf4, 0xd1, 0xa7, 0x0f, 0x5e, 0xfa, 0xef,
+          0x20, 0xba, 0x4e, 0x6b, 0x0d, 0x2f, 0x27, 0x31, 0x3f, 0x73, 0xcd, 0x6a, 0x19, 0xcc, 0x42, 0x10, 0x33, 0x25, 0x30, 0x59, 0x5f, 0xc2, 0xb6, 0x64,
+          0xea, 0x30, 0x4c, 0x64, 0x4e, 0xbc, 0x92, 0xc7, 0x76, 0xcd, 0xba, 0xd8, 0x4e, 0xa9, 0xc1, 0x48, 0xe0, 0x4c, 0x29, 0xc2, 0xc9, 0xbc, 0xe3, 0x72,
+          0x25, 0x73, 0xaa, 0x27, 0xeb, 0x75, 0x22, 0x27, 0x01, 0x5e, 0xf5, 0xda, 0x21, 0x97, 0x71, 0xe2, 0x54, 0xa4, 0xf4, 0xfc, 0xae, 0x04, 0x5a, 0x9d,
+          0xc3, 0xb1, 0x60, 0xd6, 0xfc, 0xae, 0x86, 0x75, 0xf5, 0xfe, 0xc8, 0x95, 0xeb, 0x81, 0x84, 0xbb, 0xe0, 0x88, 0xde, 0xce, 0xb7, 0x2b, 0xf4, 0x3c,
+          0xe0, 0x98, 0x98, 0xfd, 0xc2, 0x04, 0xdd, 0x88, 0xeb, 0x75, 0xeb, 0xd5, 0xd9, 0x11, 0x5c, 0xdc, 0x66, 0xeb, 0x1f, 0x57, 0xa8, 0x00, 0xf1, 0xe0,
+          0xc3, 0x4a, 0x3e, 0x56, 0x21, 0xaa, 0xdd, 0x85, 0xca, 0x5e, 0xa4, 0xac, 0xe2, 0x0a, 0x6d, 0x7b, 0x85, 0x37, 0x3e, 0xa8, 0x93, 0x15, 0x80, 0x71,
+          0x67, 0xac, 0x2b, 0x93, 0xc3, 0xce, 0xd6, 0x32, 0x07, 0xc6, 0x1f, 0xac, 0x41, 0x91, 0x18, 0x18, 0x5e, 0x6f, 0x36, 0x15, 0xdf, 0x1d, 0x4e, 0x1d,
+          0x22, 0x7d, 0x11, 0x81, 0x8c, 0x94, 0x75, 0xb5, 0xbf, 0x6c, 0x49, 0xdd, 0x55, 0x18, 0x5b, 0x7c, 0xd1, 0x66, 0x59, 0xf8, 0xe6, 0x44, 0xa8, 0x79,
+          0xa3, 0x68, 0xea, 0x5b, 0x54, 0x1a, 0x4b, 0xaa, 0xcb, 0xb4, 0x3f, 0x60, 0xb1, 0x8a, 0x60, 0x36, 0x3f, 0x45, 0xcb, 0x44, 0x59, 0x5d, 0x59, 0xc5,
+          0x11, 0x11, 0xdf, 0xe5, 0x6e, 0x0e, 0x15, 0x3f, 0xe1, 0x35, 0xa9, 0xf3, 0x6d, 0xab, 0x89, 0xc2, 0x52, 0xb6, 0x2d, 0x8e, 0xa8, 0x9d, 0x3f, 0x5c,
+          0xac, 0xe9, 0x2e, 0xf0, 0x95, 0x5a, 0x75, 0x18, 0xf3, 0xcc, 0x4d, 0x45, 0x88, 0xe4, 0x6d, 0x01, 0xf0, 0xe5, 0xa4, 0xe2, 0x40, 0x80, 0xb5, 0x78,
+          0x24, 0xd5, 0x23, 0x53, 0xa1, 0xfc, 0x4b, 0x40, 0xc6, 0x43, 0x22, 0x35, 0x39, 0xc8, 0xb9, 0x12, 0x28, 0x59, 0x1c, 0x13, 0x81, 0xb1, 0xc3, 0x1d,
+          0x54, 0x57, 0xdd, 0xcd, 0x44, 0x74, 0x09, 0x84, 0x23, 0x38, 0x66, 0x3f, 0x02, 0x74, 0x74, 0x71, 0xa3, 0xf4, 0x35, 0xe7, 0x33, 0x47, 0xb5, 0x07,
+          0x83, 0x4c, 0x8c, 0xae, 0x74, 0x73, 0xed, 0x52, 0x06, 0x0f, 0x56, 0x0e, 0xdd, 0x72, 0x00, 0x23, 0xa8, 0x1a, 0x70, 0xc5, 0x5b, 0xf4, 0x5d, 0xcd,
+          0x87, 0x80, 0x2a, 0x0f, 0x8b, 0x5d, 0x9d, 0x26, 0x03, 0x20, 0x0b, 0x70, 0xdc, 0xb0, 0x35, 0xd5, 0x7d, 0x47, 0x9e, 0xbb, 0x62, 0xd2, 0x91, 0xe8,
+          0x8e, 0x83, 0xa6, 0x7c, 0x34, 0x07, 0xa6, 0x3e, 0x9b, 0x3d, 0xed, 0x5c, 0xe9, 0x44, 0x73, 0x7e, 0xa0, 0xa3, 0xbb, 0x9c, 0x18, 0x82, 0x5e, 0xae,
+          0xa5, 0xb7, 0xd0, 0x1f, 0xa2, 0xee, 0x46, 0xc2, 0xf9, 0x15, 0x58, 0x36, 0x8d, 0x8e, 0xbb, 0x84, 0x59, 0x93, 0xcc, 0xda, 0x41, 0xcc, 0xff, 0x81,
+          0x26, 0xef, 0xfe, 0x47, 0x69, 0xe9, 0x6b, 0x93, 0xf5, 0x78, 0xb1, 0xf0, 0xbb, 0xf2, 0x79, 0x05, 0x96, 0xa4, 0xe1, 0xf1, 0xcf, 0x97, 0x78, 0x99,
+          0x65, 0x8e, 0xaa, 0x95, 0xdb, 0x6d, 0x54, 0xc3, 0x63, 0xaa, 0x44, 0xda, 0xb8, 0xeb, 0x70, 0x6d, 0x4c, 0x45, 0x2f, 0x44, 0x36, 0xa8, 0x4b, 0xd7,
+          0xa4, 0x10, 0x5f, 0x3e, 0x5b, 0xb2, 0x6e, 0xf2, 0xac, 0x49, 0x26, 0x1d, 0xea, 0x97, 0x6e, 0x58, 0x81, 0xce, 0x87, 0xec, 0xe2, 0x2d, 0x07, 0xdb,
+          0xc7, 0xb6, 0xbf, 0xcc, 0xb7, 0x59, 0x7e, 0x74, 0xc7, 0x9c, 0x79, 0x88, 0x63, 0x75, 0x8e, 0x81, 0x8a, 0xe9, 0x4a, 0x2f, 0xf9, 0x9e, 0x74, 0xac,
+          0x0d, 0xdc, 0xe7, 0xcc, 0x98, 0x84, 0xc5, 0xe5, 0xbf, 0x25, 0x5f, 0xba, 0xcd, 0xee, 0x86, 0x91, 0xb5, 0xf1, 0xa9, 0x06, 0x22, 0x30, 0x3f, 0x4f,
+          0xe0, 0x8c, 0xa5, 0xb6, 0xa2, 0x10, 0xee, 0xdc, 0xd3, 0x4d, 0x4b, 0x58, 0xda, 0x81, 0x4b, 0xc1, 0x77, 0xca, 0xb5, 0xbf, 0x84, 0xee, 0xd7, 0x0f,
+          0xe5, 0x7c, 0xa7, 0x79, 0x5d, 0x85, 0xcb, 0x16, 0xfb, 0xd7, 0x7c, 0x80, 0x7f, 0xba, 0x7f, 0xd8, 0xd6, 0x9d, 0xf6, 0x05, 0xd0, 0xcc, 0x2e, 0xf9,
+          0x05, 0x6d, 0xc7, 0x83, 0x1e, 0xe3, 0xfb, 0x77, 0xe5, 0x88, 0xdf, 0x79, 0x8c, 0x65, 0xdc, 0xe5, 0x37, 0x75, 0xa7, 0xcf, 0xe9, 0x69, 0x00, 0xf4,
+          0x07, 0x02, 0x76, 0xed, 0x13, 0xe5, 0x3c, 0x4f, 0xf3, 0x82, 0xc6, 0xf2, 0x1f, 0x30, 0xc1, 0xdc, 0x2e, 0x05, 0x50, 0xfd, 0x65, 0xc2, 0x0b, 0x34,
+          0x35, 0xf7, 0x04, 0x58, 0xf9, 0x09, 0x82, 0xef, 0xfe, 0xd4, 0x4e, 0xef, 0x9c, 0xbb, 0xf0, 0xdf, 0x0b, 0xe1, 0xb2, 0xab, 0x17, 0xb6, 0xe1, 0xf1,
+          0xe9, 0xbf, 0xe0, 0x0f, 0xf3, 0x1c, 0xff, 0xf3, 0x78, 0xcc, 0x73, 0x74, 0x75, 0xa7, 0xcf, 0xec, 0x74, 0x00, 0x89, 0x07, 0x04, 0xec, 0xf0, 0x63,
+          0xba, 0x2d, 0xe9, 0xa1, 0xb1, 0x61, 0xbb, 0xf8, 0xd2, 0x62, 0x9f, 0xee, 0xfb, 0x01, 0xd4, 0xf8, 0x04, 0x95, 0xc3, 0x70, 0xe7, 0xe5, 0x13, 0x10,
+          0xb4, 0x85, 0x40, 0xc8, 0x2e, 0xe6, 0x76, 0x4e, 0x7a, 0x85, 0x9e, 0x06, 0x9f, 0x38, 0x04, 0xe2, 0xac, 0x2f, 0xda, 0x42, 0xe3, 0x65, 0x4b, 0xe8,
+          0x60, 0x9e, 0x37, 0xa0, 0xd8, 0xfb, 0x23, 0x4e, 0x10, 0xb5, 0xc3, 0xef, 0x57, 0x00, 0xa1, 0xbf, 0x91, 0xb7, 0xef, 0x76, 0x3c, 0xe3, 0xe4, 0xfb,
+          0x96, 0x53, 0x9f, 0x59, 0x4e, 0x44, 0x39, 0x81, 0x3e, 0x84, 0x17, 0x1a, 0xcf, 0xae, 0x81, 0x4e, 0x16, 0xd7, 0x43, 0x90, 0x90, 0xa6, 0x8f, 0xd4,
+          0x02, 0x23, 0x7a, 0xb3, 0x9f, 0x92, 0x87, 0x5d, 0xef, 0x38, 0xb7, 0x05, 0x5b, 0xd0, 0xf7, 0xa2, 0x3b, 0xfe, 0x0b, 0xd6, 0x7e, 0x15, 0x9f, 0xf9,
+          0xb3, 0x58, 0xc6, 0x1d, 0x89, 0xee, 0x99, 0x63, 0x01, 0x6e, 0x1a, 0xa7, 0x03, 0x73, 0x8c, 0x38, 0x1b, 0x50, 0xdf, 0xe6, 0x4c, 0xf4, 0xcd, 0x5f,
+          0x75, 0x34, 0xed, 0xac, 0x5c, 0x9f, 0x53, 0x6f, 0x33, 0x1b, 0x64, 0x6c, 0x64, 0x1d, 0xd3, 0xe3, 0x50, 0x3d, 0x08, 0x60, 0xe5, 0xff, 0xf1, 0x14,
+          0xa7, 0xa9, 0xbb, 0xbf, 0x26, 0x05, 0x7b, 0x8c, 0x1a, 0x83, 0xc7, 0xfc, 0x34, 0xbb, 0xc5, 0xc9, 0xb8, 0xb4, 0xf9, 0x5f, 0x23, 0x29, 0x48, 0x9d,
+          0xa5, 0x40, 0x89, 0x26, 0x7d, 0xe0, 0x33, 0xca, 0x83, 0xa2, 0xb2, 0x70, 0x2f, 0xc7, 0x49, 0x95, 0x59, 0xe2, 0xcc, 0x31, 0x2a, 0x09, 0x3b, 0x6c,
+          0xf9, 0xa3, 0xaa, 0x5f, 0xaf, 0xd8, 0x66, 0x97, 0xb4, 0x21, 0x79, 0x88, 0xc5, 0x07, 0xf7, 0xbd, 0xd5, 0x51, 0xd1, 0x2f, 0x76, 0xb8, 0xe9, 0x5b,
+          0x58, 0x6c, 0x9e, 0xae, 0x4e, 0x88, 0x72, 0xb9, 0x84, 0x54, 0xb1, 0xa7, 0xb7, 0x25, 0xe9, 0xc5, 0x21, 0x1a, 0xa4, 0x60, 0x18, 0x9f, 0x64, 0x36,
+          0xfd, 0xc9, 0x81, 0x3c, 0xf9, 0xf4, 0x33, 0x04, 0x1a, 0xbe, 0x8f, 0x32, 0x3f, 0x68, 0x66, 0x5b, 0x3e, 0x28, 0xff, 0x14, 0x29, 0x67, 0xfe, 0xa2,
+          0xd0, 0x8c, 0x52, 0x74, 0x92, 0x55, 0x7a, 0x13, 0x75, 0xf0, 0xe5, 0xb8, 0x9f, 0x64, 0xad, 0x4c, 0x19, 0x2f, 0x5f, 0x3f, 0x5e, 0x6c, 0xf7, 0x53,
+          0xac, 0x4d, 0x09, 0x7d, 0x6f, 0x56, 0x08, 0x67, 0x6f, 0x18, 0x0a, 0xdc, 0xc9, 0x75, 0xb8, 0xed, 0xd9, 0x80, 0x8b, 0x3d, 0x59, 0x77, 0x92, 0x3f,
+          0x51, 0x16, 0x2c, 0xb9, 0x11, 0x2c, 0x54, 0xf5, 0x97, 0x7b, 0xec, 0x3b, 0x95, 0x03, 0xf5, 0x7e, 0x0e, 0x62, 0x7d, 0xca, 0x9f, 0xf8, 0x33, 0x9e,
+          0x57, 0xdb, 0x55, 0x92, 0xa2, 0xdb, 0xe5, 0xfb, 0xed, 0x48, 0x8c, 0xb2, 0x14, 0x2e, 0xe3, 0x75, 0xd6, 0xf8, 0x6f, 0xd0, 0x6d, 0x7f, 0x1c, 0xcd,
+          0x61, 0x82, 0x83, 0xfa, 0xe4, 0xa0, 0x07, 0x1b, 0x1f, 0xd4, 0x1e, 0xee, 0x3c, 0xf2, 0x24, 0xb6, 0x73, 0x81, 0x04, 0xc9, 0xe7, 0xed, 0x04, 0x80,
+          0xe4, 0x72, 0xab, 0x98, 0x75, 0xd8, 0x4f, 0x3c, 0xdd, 0x79, 0x92, 0x81, 0x72, 0xce, 0x94, 0x6f, 0x61, 0x6c, 0x3f, 0xad, 0x05, 0x4c, 0x0d, 0x6f,
+          0x86, 0x30, 0x2b, 0x46, 0xea, 0x44, 0x81, 0x17, 0x18, 0x88, 0x70, 0x87, 0x82, 0x30, 0x80, 0x1e, 0x0e, 0xc8, 0x48, 0x0e, 0x04, 0x21, 0x58, 0x9b,
+          0x28, 0x11, 0x32, 0x1c, 0xb8, 0x79, 0xd9, 0xc5, 0xce, 0x29, 0xcb, 0x24, 0x67, 0xe2, 0x70, 0x0f, 0x3a, 0x57, 0xa4, 0x29, 0x4e, 0x96, 0x14, 0x25,
+          0xfa, 0x0f, 0xa9, 0x4c, 0xf5, 0x5f, 0x16, 0x3a, 0xee, 0xba, 0x57, 0xef, 0x40, 0x9b, 0x76, 0xbd, 0xd1, 0xf5, 0xa4, 0x61, 0x2c, 0x30, 0x5d, 0x11,
+          0x50, 0x04, 0x8d, 0x05, 0xa3, 0x90, 0x36, 0x7d, 0x60, 0x5a, 0x8b, 0xd4, 0x7d, 0x6b, 0xdd, 0x89, 0x87, 0xb4, 0x1b, 0x3c, 0x68, 0xa4, 0x42, 0x4f,
+          0x48, 0xb8, 0x73, 0x6f, 0xa8, 0x3f, 0xd5, 0x3b, 0x63, 0x14, 0x98, 0xf6, 0xce, 0x3d, 0xa1, 0x81, 0xe9, 0x9e, 0x99, 0xa8, 0x4e, 0x54, 0x5f, 0x3f,
+          0x30, 0x76, 0x43, 0x9c, 0x07, 0xc4, 0xf5, 0xa4, 0x16, 0x7c, 0x4a, 0xec, 0xa1, 0xa8, 0x42, 0x4c, 0x80, 0x9d, 0xe4, 0x7d, 0x33, 0x5c, 0xb5, 0x55,
+          0x01, 0x49, 0xbb, 0xa2, 0x71, 0xc0, 0x9d, 0xff, 0xa9, 0xed, 0xc5, 0x18, 0xf5, 0x79, 0xff, 0x29, 0x82, 0xac, 0x1f, 0xae, 0xd6, 0x59, 0x01, 0x75,
+          0x0c, 0xeb, 0x2d, 0xa2, 0xfa, 0x33, 0xd5, 0xb9, 0x1e, 0x82, 0x21, 0x9a, 0xf4, 0x5b, 0xcf, 0x6c, 0xf7, 0x08, 0x71, 0x53, 0x45, 0x29, 0x60, 0x99,
+          0x28, 0x59, 0xe8, 0x71, 0xe3, 0x52, 0xa1, 0x69, 0x09, 0xd7, 0xe3, 0x16, 0x40, 0x22, 0x52, 0x2e, 0x28, 0x80, 0xe2, 0xc7, 0xe2, 0x4a, 0x45, 0x0f,
+          0x1a, 0x38, 0x30, 0x24, 0x9f, 0xba, 0x96, 0xc2, 0x03, 0x94, 0x74, 0xd8, 0x84, 0xb4, 0xd6, 0xd1, 0xc7, 0xb5, 0x70, 0x21, 0xda, 0x52, 0x87, 0x9f,
+          0x71, 0xeb, 0xae, 0xea, 0x33, 0x6d, 0xa1, 0xb0, 0xb6, 0xc1, 0x3b, 0xdf, 0x5d, 0xb7, 0x18, 0x92, 0x6f, 0x81, 0xf0, 0x71, 0xbb, 0xc4, 0x3d, 0xf5,
+          0x32, 0x30, 0x23, 0x4a, 0x01, 0x4d, 0x43, 0xcf, 0x37, 0x84, 0x95, 0x56, 0x8e, 0x2b, 0x97, 0x90, 0xee, 0xf3, 0xf7, 0xc5, 0x60, 0xad, 0x99, 0x8f,
+          0x77, 0x12, 0x5b, 0xc8, 0xca, 0xca, 0x87, 0xcc, 0x89, 0xc2, 0xf9, 0x8d, 0xc6, 0x93, 0x4e, 0x75, 0x4c, 0x6c, 0x53, 0xf3, 0x63, 0x70, 0x0e, 0xc4,
+          0xec, 0xa8, 0x43, 0x9a, 0x0c, 0xc7, 0x6c, 0xa4, 0x79, 0x33, 0xac, 0x74, 0x3a, 0x2c, 0xff, 0x4e, 0xf1, 0xfd, 0xe3, 0xec, 0x89, 0x7b, 0x0d, 0x7c,
+          0xfc, 0xcd, 0xb2, 0xca, 0xe1, 0x8b, 0x61, 0x75, 0x70, 0xb7, 0xe8, 0x16, 0xce, 0x2e, 0xb7, 0x2f, 0x39, 0x67, 0x7f, 0x52, 0x9f, 0x8b, 0x41, 0xef,
+          0xe9, 0x98, 0xf7, 0x15, 0x9a, 0x99, 0x3c, 0xed, 0x0f, 0x63, 0xf1, 0xfb, 0x23, 0x2c, 0x4e, 0xa5, 0x94, 0x34, 0x49, 0xa7, 0x6d, 0x43, 0x69, 0xa2,
+          0x6f, 0x4f, 0x9b, 0x96, 0x87, 0x1e, 0x6c, 0x8f, 0x84, 0x63, 0x23, 0x50, 0x9e, 0x7b, 0x9e, 0xa8, 0x87, 0xfc, 0xa7, 0x76, 0x26, 0xe7, 0x9b, 0xe0,
+          0x19, 0xab, 0x5d, 0xc5, 0x9b, 0x2b, 0x8b, 0x07, 0x6d, 0x86, 0xdc, 0xb5, 0x92, 0xba, 0x2b, 0x9a, 0x68, 0x17, 0x29, 0x2f, 0xf9, 0x64, 0xf6, 0xd6,
+          0x8e, 0xc4, 0x32, 0x45, 0x72, 0x9a, 0x49, 0xab, 0x7b, 0x6c, 0x05, 0x21, 0xf9, 0xa2, 0x87, 0xd5, 0xfa, 0x6c, 0x98, 0x8f, 0x4c, 0x16, 0xb0, 0xfe,
+          0x93, 0xf7, 0xaf, 0xb2, 0x8c, 0x46, 0x50, 0x33, 0x2c, 0xd2, 0x38, 0x4b, 0xe2, 0x50, 0x2a, 0x44, 0x67, 0x6c, 0x41, 0x41, 0x1a, 0xd9, 0x5a, 0x17,
+          0x19, 0x1c, 0x3f, 0x74, 0xf3, 0x47, 0x2e, 0x05, 0x64, 0xc2, 0x34, 0xeb, 0xb6, 0xd2, 0xce, 0x70, 0xbb, 0xba, 0x4f, 0x80, 0x0c, 0xb9, 0x61, 0xb2,
+          0xc9, 0x23, 0x84, 0x45, 0xcc, 0x00, 0xe2, 0xad, 0x54, 0xec, 0x36, 0xef, 0xc8, 0x29, 0xbc, 0xa9, 0x4e, 0xc6, 0xc2, 0x99, 0xce, 0x87, 0x07, 0xe7,
+          0xa1, 0x84, 0x6e, 0x20, 0xde, 0x16, 0x68, 0x15, 0x96, 0xc7, 0xa8, 0x13, 0xd2, 0x35, 0x4c, 0x67, 0xdc, 0x57, 0x37, 0xae, 0xc5, 0xe0, 0xef, 0xda,
+          0xc7, 0x34, 0xa0, 0x1c, 0xa7, 0x17, 0x69, 0xf6, 0x31, 0xdf, 0xa1, 0x14, 0xfd, 0x45, 0x32, 0xee, 0xbd, 0x86, 0xb6, 0xca, 0xe0, 0x2a, 0xaa, 0x97,
+          0x95, 0x0c, 0xd7, 0x07, 0xb2, 0xed, 0x84, 0x83, 0xc9, 0xb9, 0xf7, 0x7d, 0x36, 0x4f, 0xd7, 0xcb, 0x7b, 0xec, 0xcf, 0x06, 0x73, 0x38, 0xe0, 0xfa,
+          0x81, 0x66, 0x64, 0x56, 0xb0, 0x42, 0x84, 0xf7, 0x44, 0x0d, 0xa1, 0xe8, 0x96, 0xcc, 0x78, 0x60, 0xbf, 0x96, 0x47, 0x55, 0x71, 0x3d, 0x71, 0xb9,
+          0x75, 0x54, 0x5d, 0x18, 0xe9, 0x1f, 0x63, 0x4c, 0xfc, 0xb2, 0x62, 0x4a, 0xb1, 0x9f, 0x40, 0x98, 0xd0, 0xf1, 0xb5, 0xb4, 0xf7, 0xc7, 0x86, 0xb9,
+          0x6c, 0xb3, 0xd3, 0x2d, 0x01, 0xf6, 0x51, 0x24, 0x08, 0x25, 0x26, 0x74, 0x73, 0xd3, 0xdf, 0x71, 0xd7, 0xc0, 0x7a, 0xe7, 0xe5, 0x40, 0x52, 0x17,
+          0x72, 0xb6, 0x22, 0xc0, 0xa6, 0x96, 0xbc, 0xce, 0x67, 0xee, 0xfd, 0xd0, 0xb1, 0x60, 0x3b, 0xf3, 0xd6, 0x5a, 0x1f, 0x4f, 0x62, 0xc2, 0x79, 0x64,
+          0x77, 0x36, 0xc2, 0x6d, 0x28, 0x08, 0x1d, 0xbf, 0xe5, 0x6f, 0x97, 0x1c, 0x69, 0x32, 0x0b, 0x27, 0x9d, 0x6f, 0x6d, 0xaf, 0xd1, 0xce, 0xb1, 0x20,
+          0x5c, 0x1c, 0xbf, 0xe5, 0x6f, 0xe4, 0xbb, 0xa6, 0xc8, 0x2f, 0x4f, 0xa6, 0x96, 0xc6, 0x13, 0xdf, 0xcc, 0x4e, 0x9b, 0xbb, 0xf3, 0x01, 0xe4, 0xc1,
+          0x0f, 0x4b, 0x79, 0x40, 0xd9, 0xe6, 0x84, 0x1f, 0xac, 0x0f, 0xe9, 0xed, 0x88, 0x01, 0xe1, 0x50, 0x86, 0x94, 0xc5, 0x8e, 0xd3, 0xa6, 0xaa, 0xa1,
+          0xeb, 0x88, 0x98, 0x7e, 0xee, 0xdc, 0xb9, 0x26, 0xd3, 0x7b, 0xe0, 0x9c, 0xc8, 0x7e, 0x9a, 0x72, 0x05, 0x16, 0xf5, 0xbe, 0x35, 0x5a, 0xf8, 0x0e,
+          0xe5, 0xfc, 0xbf, 0xe8, 0xf3, 0x16, 0xe7, 0x5f, 0x5b, 0x98, 0x86, 0x1e, 0xcd, 0xb5, 0x6a, 0x04, 0x46, 0x77, 0x01, 0x63, 0xb4, 0x03, 0x97, 0x39,
+          0xf3, 0x03, 0xfc, 0x5e, 0xb9, 0x38, 0x24, 0xc6, 0xe7, 0x6d, 0x6c, 0xd4, 0x8d, 0x11, 0xf1, 0x74, 0x27, 0x3a, 0x15, 0xfe, 0xf4, 0x8a, 0x92, 0xa8,
+          0x37, 0x02, 0x56, 0x29, 0x44, 0x3a, 0x21, 0x12, 0x6f, 0x1a, 0xc7, 0x61, 0xb2, 0x82, 0x92, 0xb1, 0xf6, 0x93, 0x2e, 0x27, 0xfa, 0x59, 0x6c, 0x95,
+          0x86, 0xf2, 0xc0, 0x64, 0xd6, 0x6f, 0x45, 0xf6, 0x75, 0x3d, 0x50, 0xf1, 0x58, 0x4f, 0x77, 0x9a, 0x09, 0x3b, 0x6b, 0xdc, 0x93, 0xcc, 0x9c, 0x0d,
+          0xe1, 0x31, 0x1a, 0x42, 0x40, 0xe0, 0x2f, 0xf4, 0x8c, 0x7c, 0x37, 0x6e, 0x24, 0xd1, 0xa0, 0x8a, 0x4c, 0xe0, 0x19, 0xcd, 0x74, 0x87, 0xcd, 0xf3,
+          0xf6, 0xe6, 0x49, 0x56, 0x08, 0x14, 0xa7, 0x7b, 0xec, 0x1e, 0xb5, 0x6a, 0x42, 0x4a, 0xd5, 0x6e, 0x53, 0xa9, 0x3c, 0x0d, 0x24, 0xe9, 0x50, 0x34,
+          0x94, 0x17, 0x5f, 0xd0, 0xad, 0xc6, 0xa1, 0x30, 0x82, 0xda, 0x0a, 0x67, 0xf7, 0x29, 0x52, 0x33, 0x50, 0xa3, 0x44, 0xbb, 0xc3, 0x5e, 0xa0, 0x5f,
+          0xc3, 0x71, 0xd5, 0x37, 0x1c, 0xdb, 0x0a, 0x6d, 0xa1, 0x9b, 0xdf, 0xbc, 0x8d, 0xda, 0x4f, 0xe4, 0x03, 0x2f, 0xe8, 0x39, 0xf0, 0x85, 0xd3, 0x10,
+          0x64, 0x18, 0x7b, 0xe3, 0x84, 0x99, 0xb3, 0xfc, 0xb7, 0xc2, 0x0d, 0x54, 0xab, 0x15, 0xba, 0x09, 0x73, 0x84, 0xb9, 0x45, 0x63, 0x13, 0x13, 0xe1,
+          0xb4, 0x65, 0x15, 0x47, 0x8b, 0xe3, 0xaa, 0xbc, 0x58, 0xac, 0xf2, 0xef, 0x60, 0x2b, 0xac, 0x33, 0x6f, 0x83, 0xb3, 0xef, 0x30, 0x35, 0x3d, 0xc5,
+          0x58, 0x51, 0x8d, 0xa7, 0xa5, 0x1c, 0x4b, 0xea, 0x31, 0x90, 0x95, 0xa6, 0x22, 0x33, 0x25, 0x59, 0x13, 0xe5, 0x66, 0xd7, 0x7d, 0x9e, 0x0e, 0x38,
+          0x33, 0x2d, 0x90, 0x9d, 0xc6, 0x9c, 0x74, 0xc1, 0x3c, 0xe5, 0xa8, 0x7c, 0x16, 0x88, 0x89, 0x46, 0x44, 0xb8, 0xd9, 0xf4, 0xe2, 0xb3, 0x88, 0xb2,
+          0x74, 0x36, 0x08, 0x90, 0x71, 0xa7, 0x5a, 0x94, 0x5b, 0x0c, 0x43, 0xdb, 0xe6, 0x37, 0x2a, 0xa1, 0xb3, 0x86, 0xad, 0x66, 0x17, 0x8f, 0x9f, 0xa1,
+          0xee, 0xcd, 0x4f, 0x43, 0xa7, 0x65, 0xb0, 0x4a, 0x3a, 0xdc, 0x6d, 0x3a, 0xb4, 0xd9, 0xa9, 0x8c, 0xe5, 0x51, 0xea, 0x16, 0x78, 0xbd, 0x75, 0xee,
+          0x9d, 0x43, 0xf6, 0xa8, 0x2d, 0x6d, 0x8d, 0x99, 0xfc, 0xc0, 0xc4, 0x10, 0xf3, 0x14, 0x09, 0x07, 0xed, 0x45, 0x9f, 0x6f, 0x39, 0x56, 0xc8, 0x7e,
+          0xa0, 0xc2, 0x54, 0xfa, 0xd7, 0x4b, 0x1d, 0x3b, 0xcb, 0xe2, 0xcc, 0xe2, 0xef, 0x1b, 0x49, 0x9e, 0xeb, 0x60, 0xb6, 0x5e, 0xbf, 0xb4, 0xa4, 0x5e,
+          0x92, 0x25, 0x69, 0xfc, 0x9d, 0x64, 0xa2, 0x28, 0x3b, 0x12, 0x6c, 0xe0, 0x7e, 0xb9, 0x5a, 0x78, 0xde, 0xa7, 0xe4, 0xb3, 0xfe, 0x0b, 0x81, 0x3b,
+          0x49, 0x6a, 0x7a, 0x68, 0x6c, 0x9e, 0xf1, 0x67, 0x36, 0x59, 0x89, 0x62, 0xc3, 0xc8, 0xca, 0x45, 0xbb, 0x5e, 0x46, 0x77, 0x2a, 0x75, 0x5c, 0x96,
+          0x83, 0xaf, 0xed, 0x52, 0x3a, 0x53, 0xed, 0x04, 0x05, 0x14, 0xc2, 0x80, 0xd6, 0x5f, 0x1c, 0x37, 0xb9, 0x5c, 0x87, 0x35, 0x76, 0x11, 0xa7, 0xb8,
+          0x9b, 0xfb, 0xb1, 0x3f, 0x05, 0x0b, 0x45, 0x95, 0x9a, 0x2c, 0x8e, 0x31, 0xdd, 0x6a, 0x9b, 0x5f, 0xcf, 0x56, 0x39, 0xea, 0xf7, 0xbc, 0x19, 0x2e,
+          0x93, 0xdf, 0xf7, 0xbc, 0xf4, 0xd1, 0x22, 0x59, 0xb5, 0xec, 0xdc, 0xfe, 0xb8, 0x39, 0xd9, 0xcc, 0x41, 0x46, 0x07, 0xda, 0xff, 0xa1, 0xb5, 0x1f,
+          0xa1, 0x02, 0x1b, 0x5f, 0x22, 0xed, 0xd0, 0x1e, 0xd8, 0x2a, 0x22, 0x5f, 0x44, 0xab, 0x2a, 0xa9, 0xee, 0x86, 0xeb, 0x6f, 0x3f, 0x50, 0x71, 0x36,
+          0x66, 0xa7, 0xf8, 0x1f, 0x70, 0x38, 0x8b, 0x5b, 0xfa, 0x84, 0x98, 0x5d, 0x2e, 0x95, 0xa5, 0x6f, 0x67, 0xf4, 0x35, 0xee, 0x18, 0x83, 0x96, 0x42,
+          0x44, 0x9f, 0x9f, 0x58, 0x03, 0xb3, 0xdf, 0x7d, 0x6e, 0xe4, 0x13, 0x53, 0xfc, 0xe7, 0x76, 0x12, 0xc5, 0x84, 0xe7, 0xd9, 0x1e, 0xf8, 0x1a, 0xf0,
+          0xd4, 0x6d, 0xd7, 0x04, 0x8f, 0x0e, 0x80, 0xf0, 0xd6, 0xbb, 0x12, 0x0c, 0xb6, 0xb8, 0xa8, 0xfd, 0x71, 0xd4, 0xdc, 0x24, 0xe0, 0x86, 0xf6, 0x97,
+          0x89, 0x40, 0x25, 0x57, 0x9e, 0xa3, 0x2a, 0x2e, 0xf3, 0x14, 0x79, 0x13, 0xbb, 0x07, 0xc6, 0x4d, 0x59, 0x73, 0xe0, 0x5e, 0x60, 0x65, 0x4c, 0x0d,
+          0x88, 0xce, 0xbf, 0x92, 0x80, 0xf8, 0x00, 0xd5, 0x5d, 0x5f, 0x12, 0xea, 0x3c, 0x51, 0xb5, 0xbb, 0xab, 0x42, 0xd9, 0xb0, 0x85, 0x95, 0xf8, 0x16,
+          0xea, 0x74, 0x8f, 0x87, 0x4a, 0x21, 0xc2, 0xb9, 0xc5, 0xa4, 0x5f, 0x7f, 0x48, 0x2e, 0x1a, 0x75, 0xfe, 0xf6, 0xca, 0x95, 0xec, 0x2f, 0xd9, 0x71,
+          0xf8, 0x30, 0xad, 0x69, 0x0e, 0x3b, 0x4c, 0xd2, 0xfc, 0xa8, 0xcd, 0xae, 0x3d, 0x1a, 0x19, 0x4e, 0x7f, 0xed, 0x8e, 0xa4, 0x29, 0xa2, 0x3c, 0xf3,
+          0xea, 0x65, 0x51, 0x2f, 0x32, 0x58, 0x24, 0xbf, 0x39, 0x7c, 0x67, 0x02, 0xb3, 0x9d, 0x79, 0x3d, 0x9b, 0x84, 0x9c, 0xbd, 0x68, 0x29, 0x33, 0x95,
+          0xbf, 0xab, 0xa0, 0xef, 0xd5, 0xaf, 0x1e, 0xdf, 0x3e, 0x5a, 0x41, 0x3c, 0x8d, 0x58, 0x44, 0x7c, 0x7e, 0xe7, 0xb1, 0xd2, 0x78, 0x86, 0x4e, 0x4e,
+          0x93, 0x67, 0x89, 0x94, 0xf7, 0x61, 0x85, 0x34, 0x0e, 0x85, 0xb5, 0xe8, 0x3b, 0x53, 0x44, 0x0f, 0x63, 0xaf, 0xb4, 0x43, 0x1b, 0x8c, 0x79, 0x9c,
+          0xc9, 0xd9, 0x6e, 0xee, 0xb1, 0x38, 0x04, 0xdd, 0xc9, 0x72, 0x78, 0xc3, 0x45, 0xef, 0xde, 0xb1, 0x51, 0xa9, 0x3a, 0xec, 0xde, 0x97, 0x86, 0x6c,
+          0xa8, 0xe4, 0x57, 0x06, 0x4f, 0x98, 0xb9, 0x3b, 0xd5, 0xaf, 0x5c, 0xb7, 0x8f, 0x2d, 0x4d, 0xe1, 0xcf, 0x6a, 0x4c, 0xe8, 0x33, 0x37, 0x6f, 0x82,
+          0xba, 0xb0, 0x05, 0x91, 0x47, 0xba, 0xbf, 0x17, 0xa2, 0x11, 0x1d, 0xd7, 0xb6, 0x00, 0x31, 0x64, 0x5a, 0x05, 0x50, 0x8a, 0x5c, 0x9d, 0x3b, 0x39,
+          0x9e, 0xed, 0xb5, 0x86, 0xbe, 0x6c, 0x17, 0xbc, 0x57, 0xe5, 0x7e, 0x63, 0xdf, 0xe7, 0x32, 0x5f, 0x82, 0x44, 0x1d, 0x56, 0xbf, 0xce, 0x3c, 0x35,
+          0xec, 0x77, 0x2f, 0xdb, 0xd7, 0x59, 0xcf, 0xbd, 0x06, 0x2b, 0xe6, 0x2a, 0x7d, 0x16, 0x31, 0xa2, 0xac, 0x7d, 0x4e, 0x98, 0xf1, 0xcb, 0x2d, 0xca,
+          0x46, 0x9f, 0x0b, 0x0e, 0x97, 0xe6, 0x80, 0xbc, 0xb1, 0xbb, 0x63, 0x6a, 0x28, 0xa6, 0x32, 0xfd, 0xd6, 0x38, 0x2b, 0x00, 0x8b, 0xec, 0xe0, 0x37,
+          0xbb, 0x0a, 0xc5, 0x96, 0xdc, 0x5d, 0x26, 0x06, 0x8a, 0x55, 0xa2, 0x75, 0x49, 0x86, 0x9d, 0x6f, 0x2e, 0xf2, 0xa2, 0xaa, 0x03, 0x28, 0xcb, 0x72,
+          0xd5, 0xde, 0x2b, 0xe7, 0xd1, 0xc4, 0x0d, 0x90, 0xa4, 0x5d, 0x41, 0x7e, 0xeb, 0x72, 0x49, 0x8b, 0x3f, 0xc0, 0xf7, 0x31, 0xb5, 0xca, 0x36, 0xfa,
+          0x80, 0x7a, 0xcb, 0xed, 0xef, 0x1d, 0x91, 0x82, 0x45, 0x24, 0xbf, 0xf0, 0xad, 0x91, 0x12, 0xae, 0x05, 0xdd, 0x90, 0x30, 0x2b, 0x82, 0xa7, 0x42,
+          0xee, 0x35, 0x56, 0x8c, 0x72, 0x01, 0x51, 0x43, 0x19, 0xbe, 0x70, 0x30, 0xd3, 0x53, 0x2c, 0x74, 0x9c, 0x31, 0xf2, 0xac, 0x85, 0x63, 0xcf, 0x9b,
+          0x34, 0x70, 0x58, 0x71, 0x62, 0xa0, 0x1f, 0x9a, 0x9c, 0xe5, 0x07, 0x15, 0xbf, 0x95, 0xb2, 0x22, 0x44, 0xf6, 0x3e, 0xa4, 0xc8, 0x0e, 0x96, 0xc3,
+          0x1d, 0x34, 0xf9, 0x0e, 0xac, 0xfd, 0x40, 0xff, 0x39, 0x4f, 0x97, 0x77, 0x9c, 0x58, 0x3d, 0x9c, 0x1a, 0x70, 0x4d, 0x0d, 0xe5, 0x03, 0x72, 0xb3,
+          0x6c, 0x45, 0x3b, 0xea, 0x28, 0x33, 0x10, 0xc3, 0x7e, 0x59, 0xc5, 0xa7, 0xb7, 0xa3, 0x39, 0xbd, 0xfa, 0xbc, 0x44, 0xae, 0x5c, 0x61, 0xe7, 0xc7,
+          0xbc, 0x1e, 0xff, 0x71, 0xf2, 0x05, 0x09, 0xb6, 0xfb, 0x6d, 0xfc, 0xfd, 0xb1, 0x2b, 0x66, 0xeb, 0x55, 0xf2, 0xc1, 0x05, 0xcd, 0xbc, 0xf6, 0x36,
+          0xf7, 0x98, 0x20, 0x8d, 0x47, 0xc6, 0x93, 0x8c, 0x11, 0x52, 0x7e, 0x47, 0xcc, 0xfc, 0x68, 0x21, 0x0d, 0xd2, 0x51, 0x1c, 0x08, 0xb5, 0x37, 0x74,
+          0x92, 0x8d, 0xe1, 0x80, 0xf5, 0xbc, 0x97, 0x73, 0xee, 0x0c, 0x9e, 0x77, 0x72, 0x58, 0xe1, 0x44, 0xd9, 0x25, 0xec, 0xfd, 0x96, 0x8b, 0xf2, 0xc3,
+          0xe9, 0xef, 0x35, 0x72, 0x4a, 0x47, 0xa4, 0x2d, 0x6e, 0xa5, 0x69, 0x81, 0xc9, 0x78, 0x3a, 0xdb, 0x95, 0x9c, 0xa0, 0x34, 0x23, 0x6e, 0x84, 0x31,
+          0x3c, 0x16, 0x37, 0x72, 0xd8, 0x5b, 0x36, 0xac, 0x9a, 0x55, 0xec, 0xbc, 0xf1, 0xcd, 0xfc, 0xbb, 0x0d, 0x0d, 0xf7, 0xad, 0x35, 0x46, 0x25, 0x9b,
+          0x9d, 0xe5, 0xb9, 0xb5, 0x07, 0x55, 0xd8, 0x44, 0x86, 0x4f, 0x05, 0xfa, 0x65, 0xc1, 0x04, 0x4a, 0xfd, 0xe8, 0x16, 0xe7, 0x0c, 0x80, 0x7a, 0xda,
+          0xaf, 0xf1, 0x45, 0xfa, 0x5d, 0x5f, 0xbe, 0xab, 0x65, 0xe2, 0xe8, 0x6c, 0x77, 0x4e, 0xc6, 0x16, 0x33, 0xbb, 0x5e, 0xc7, 0x14, 0xae, 0xa3, 0x53,
+          0x1f, 0x7c, 0x15, 0x05, 0x23, 0x53, 0xfd, 0x94, 0xa6, 0x0a, 0x03, 0x0e, 0xaa, 0x20, 0xf0, 0x6a, 0x94, 0x43, 0xe1, 0xef, 0xf5, 0x91, 0x23, 0x5c,
+          0x0b, 0x8e, 0xd9, 0xf4, 0xf0, 0xe3, 0xc0, 0x8c, 0x51, 0x72, 0xd6, 0x3f, 0x5f, 0x27, 0x50, 0x99, 0x99, 0x5f, 0xe5, 0x4f, 0x52, 0x6c, 0x24, 0xd9,
+          0xad, 0x23, 0x60, 0x95, 0x86, 0x19, 0x67, 0xd2, 0x5d, 0x9b, 0xf5, 0x1a, 0x4f, 0xd9, 0x22, 0xed, 0x0e, 0x66, 0x53, 0x73, 0x0d, 0x03, 0x60, 0x4a,
+          0xec, 0xd5, 0x6b, 0x98, 0x1e, 0xcc, 0x8b, 0x32, 0xcc, 0xab, 0x3c, 0xa0, 0x91, 0x8c, 0xe4, 0x69, 0xd1, 0xa7, 0x32, 0x2f, 0x5d, 0x03, 0xbd, 0xb7,
+          0x79, 0x61, 0xa0, 0x73, 0xaa, 0x8c, 0xbc, 0x69, 0x51, 0xa8, 0xd3, 0xca, 0x3b, 0x6a, 0xb6, 0x5d, 0x30, 0xd7, 0x8e, 0x3b, 0xb0, 0xd9, 0xf3, 0x0e,
+          0x11, 0x94, 0x0f, 0x27, 0x08, 0x6a, 0x20, 0x38, 0x7b, 0xaa, 0x00, 0x00, 0xa7, 0x4e, 0x1a, 0x58, 0x90, 0xbc, 0x31, 0x6b, 0x7c, 0xed, 0x5b, 0x1f,
+          0x6c, 0xe9, 0x12, 0xde, 0x9e, 0x47, 0x89, 0x87, 0x25, 0xb5, 0x47, 0x7c, 0xfc, 0x49, 0xba, 0x12, 0x49, 0x88, 0x6f, 0xe0, 0x9a, 0x70, 0x3e, 0x7d,
+          0x3a, 0x25, 0xf1, 0x1d, 0xb5, 0x6b, 0x7c, 0x7e, 0xc0, 0xbf, 0xca, 0x67, 0xb3, 0xe8, 0x24, 0x41, 0xa4, 0x61, 0x0e, 0x03, 0xab, 0xab, 0x46, 0x6a,
+          0xfa, 0xd5, 0xf5, 0x9a, 0xba, 0x3b, 0x01, 0x92, 0x4e, 0x9f, 0xcd, 0xdb, 0x28, 0xf3, 0x4c, 0xaf, 0x9e, 0x74, 0x47, 0xbc, 0x3a, 0x3d, 0x80, 0x19,
+          0x99, 0x0e, 0x36, 0xbb, 0xc3, 0x69, 0x30, 0x9d, 0x24, 0x1c, 0x4f, 0x98, 0x89, 0x46, 0x74, 0x0f, 0x24, 0x97, 0x4c, 0xab, 0x37, 0x95, 0x2a, 0x5d,
+          0x37, 0x9e, 0x7e, 0x53, 0x2d, 0x0b, 0x37, 0x39, 0x98, 0x84, 0xee, 0x76, 0x25, 0xde, 0x83, 0x69, 0xee, 0x42, 0x14, 0x76, 0x56, 0x5d, 0xd9, 0xbd,
+          0xed, 0x8b, 0x9a, 0x4d, 0xa5, 0xb3, 0x67, 0xa8, 0xfe, 0x7b, 0x97, 0x19, 0x31, 0x3a, 0x15, 0xb2, 0xc9, 0xbb, 0x9e, 0x60, 0x71, 0xf9, 0x41, 0xb2,
+          0xb5, 0x1c, 0xfc, 0x13, 0x21, 0x14, 0x32, 0x6e, 0x11, 0x12, 0x77, 0x06, 0xdb, 0x30, 0x3f, 0x02, 0x84, 0x09, 0x55, 0x0c, 0x7c, 0xc8, 0x2d, 0xbc,
+          0xa5, 0x83, 0x3c, 0x3d, 0xfd, 0xa1, 0x42, 0xa8, 0xf9, 0x11, 0xee, 0x19, 0xc8, 0x25, 0xa6, 0x71, 0x5b, 0x0b, 0x4f, 0x00, 0x92, 0x04, 0x5a, 0x74,
+          0xff, 0x93, 0x92, 0xc9, 0xa1, 0x63, 0xf5, 0x06, 0x72, 0xf8, 0xc9, 0x5f, 0x0c, 0x8f, 0xbf, 0xb5, 0x2e, 0x3d, 0x58, 0x61, 0x89, 0xe9, 0x74, 0xa1,
+          0x86, 0x43, 0x10, 0xee, 0x1b, 0x54, 0xfa, 0x1a, 0xa9, 0xe5, 0xc9, 0x13, 0x22, 0xc1, 0x0a, 0x5d, 0x1f, 0x5f, 0x58, 0x74, 0xb6, 0x07, 0xb3, 0xc2,
+          0xda, 0xb8, 0xf0, 0x51, 0xfd, 0x44, 0x2b, 0xd1, 0xcf, 0x69, 0xd2, 0xe2, 0x53, 0xfb, 0x61, 0xdd, 0x78, 0xee, 0xbc, 0xff, 0x95, 0x58, 0x93, 0x3d,
+          0x2f, 0x3a, 0xe8, 0xc8, 0xb8, 0x16, 0x2f, 0x10, 0x54, 0x89, 0x74, 0x8d, 0x78, 0xf7, 0x60, 0xa5, 0xe7, 0x76, 0xba, 0x71, 0x3f, 0xef, 0xcc, 0x9b,
+          0xdb, 0x47, 0x05, 0xd3, 0xc2, 0x43, 0x51, 0xe7, 0x25, 0x9b, 0x76, 0x44, 0x4e, 0x1f, 0xbb, 0xc3, 0x39, 0x75, 0x12, 0x7a, 0xe4, 0x05, 0xeb, 0xe1,
+          0xdc, 0x7c, 0xa5, 0xea, 0x4e, 0xca, 0xd1, 0xf3, 0xaa, 0xf6, 0xc1, 0xdd, 0xd7, 0x96, 0xaf, 0x90, 0x86, 0xee, 0x02, 0x78, 0x38, 0x4c, 0x12, 0x9c,
+          0x19, 0x6c, 0xef, 0xb4, 0x54, 0xa3, 0x5b, 0xfa, 0x7b, 0xb0, 0x96, 0x99, 0xb0, 0xea, 0x9e, 0xaf, 0xe1, 0x57, 0x70, 0xd1, 0x59, 0x66, 0x87, 0x05,
+          0x85, 0x20, 0x7b, 0xda, 0x6d, 0x0d, 0xe8, 0x1a, 0xf7, 0x66, 0x84, 0x32, 0x8f, 0x9e, 0x7b, 0xd5, 0x10, 0xb5, 0x45, 0x69, 0x21, 0x13, 0x5d, 0x15,
+          0x94, 0x1a, 0x12, 0x77, 0x93, 0x23, 0x8f, 0x8f, 0xaa, 0x75, 0xa7, 0x92, 0x2f, 0x1b, 0x7f, 0x74, 0xb1, 0xae, 0xf0, 0x45, 0x6c, 0x65, 0x42, 0xaa,
+          0x37, 0x79, 0xc4, 0x67, 0xca, 0x4d, 0xc2, 0x5d, 0xa7, 0x2e, 0x2c, 0x1d, 0x91, 0x10, 0x12, 0x36, 0x48, 0xe5, 0xce, 0x75, 0xdf, 0x45, 0x12, 0x8e,
+          0xe9, 0xa1, 0x2b, 0x65, 0xa1, 0x9d, 0xe1, 0x66, 0x28, 0x84, 0x8d, 0x01, 0x88, 0x26, 0xfb, 0x6b, 0x48, 0x8e, 0x94, 0x25, 0xdd, 0x31, 0xca, 0x82,
+          0x12, 0x3f, 0x40, 0xf4, 0xa8, 0x83, 0xd7, 0xf8, 0x1e, 0x85, 0x99, 0xc2, 0x9e, 0x03, 0x88, 0xbb, 0xb0, 0x55, 0x27, 0xf3, 0x3a, 0xe7, 0xcf, 0x35,
+          0xdb, 0x88, 0x3b, 0xba, 0x15, 0x42, 0xa3, 0x9a, 0xa3, 0xeb, 0x8a, 0x71, 0x70, 0x68, 0x12, 0xf5, 0x8e, 0xaf, 0x1e, 0xc2, 0x88, 0xe1, 0x08, 0x50,
+          0x7b, 0x32, 0x26, 0x83, 0x6d, 0xb4, 0x14, 0xb0, 0x8a, 0x24, 0xe5, 0x5b, 0xdd, 0x67, 0xa5, 0x69, 0x6d, 0x27, 0x38, 0x12, 0x42, 0xb5, 0x4b, 0xcf,
+          0xb7, 0x8c, 0x59, 0x26, 0x8f, 0x71, 0xd7, 0xee, 0x4d, 0xaf, 0x09, 0xcc, 0x8f, 0x89, 0xbb, 0x83, 0x85, 0xb1, 0x84, 0xca, 0xd9, 0x08, 0x95, 0x67,
+          0xc7, 0xea, 0x24, 0x49, 0x9a, 0x38, 0x5d, 0x02, 0x96, 0x98, 0x8f, 0x13, 0x7a, 0x58, 0x2a, 0x82, 0x21, 0xaa, 0xe8, 0x12, 0x44, 0xf6, 0xf1, 0x6d,
+          0x46, 0x7d, 0x4e, 0x3d, 0x17, 0x18, 0xb2, 0x32, 0xb0, 0x15, 0xf8, 0x7b, 0xa0, 0x28, 0xd6, 0xa9, 0xc7, 0xeb, 0xf1, 0xfe, 0xeb, 0xbe, 0x59, 0x7a,
+          0x1a, 0xfa, 0x96, 0x85, 0x66, 0x40, 0x65, 0x84, 0x20, 0xea, 0x2f, 0xe6, 0xaa, 0x78, 0x37, 0x33, 0xaa, 0x67, 0x31, 0xad, 0xc9, 0x96, 0xf4, 0x10,
+          0xc0, 0xac, 0xb8, 0x6a, 0x48, 0xe9, 0xae, 0x4a, 0x70, 0x47, 0x34, 0xed, 0xa3, 0xfd, 0x90, 0xef, 0x43, 0x84, 0x79, 0x7a, 0x0e, 0x41, 0xab, 0x00,
+          0x20, 0x44, 0x77, 0x19, 0xa6, 0xa8, 0xb6, 0xfa, 0x53, 0xce, 0x5c, 0x03, 0x00, 0x06, 0x39, 0x31, 0x59, 0x15, 0xd2, 0xbf, 0xb5, 0xd0, 0xd6, 0xc3,
+          0xb7, 0xf9, 0x51, 0x06, 0x6c, 0x17, 0xa3, 0x3e, 0xa1, 0x6a, 0x60, 0x4f, 0x45, 0x5b, 0x85, 0xd6, 0xf4, 0x6e, 0x20, 0x7a, 0xdc, 0x60, 0xa0, 0xd4,
+          0x0d, 0x48, 0x31, 0x31, 0x17, 0x91, 0x2e, 0x71, 0x02, 0xbc, 0xde, 0xe2, 0x84, 0x81, 0x23, 0x4e, 0xf1, 0x38, 0x97, 0x47, 0x4b, 0x93, 0xe4, 0xc8,
+          0x8a, 0x4d, 0xb1, 0x5f, 0xb5, 0x96, 0xac, 0xcc, 0x6d, 0xd0, 0x2f, 0xe2, 0xc4, 0x20, 0xb1, 0xc5, 0x3d, 0x1d, 0x61, 0xc0, 0xca, 0x55, 0xd3, 0xff,
+          0x18, 0xfa, 0x8c, 0x79, 0xb4, 0xc0, 0x2a, 0x3d, 0x25, 0x31, 0x6f, 0xa2, 0x6b, 0xe7, 0xb2, 0xa7, 0xfd, 0x22, 0xd5, 0xa1, 0xbb, 0x79, 0xbe, 0xe1,
+          0xe0, 0x5f, 0x20, 0xc4, 0x44, 0xb8, 0xcd, 0x9d, 0x20, 0x28, 0x02, 0x5b, 0xf8, 0xcc, 0x4f, 0x6e, 0x60, 0xfd, 0x26, 0x3c, 0xfc, 0xd9, 0xab, 0x75,
+          0xe6, 0x9d, 0x26, 0x69, 0x8e, 0xeb, 0x13, 0x9b, 0xc8, 0xd1, 0x5d, 0xa6, 0x4c, 0xd2, 0xb7, 0xb9, 0x09, 0xa0, 0x79, 0xa2, 0x66, 0x4e, 0x55, 0x4e,
+          0x0f, 0xf8, 0xfc, 0x92, 0x95, 0xa2, 0xd6, 0x38, 0xf3, 0xeb, 0x0d, 0x43, 0xeb, 0xab, 0x6c, 0x3a, 0xb1, 0x82, 0x43, 0x02, 0x46, 0x56, 0x2b, 0x71,
+          0x19, 0xaa, 0x5b, 0x5d, 0x06, 0x58, 0x27, 0xf5, 0x1b, 0x91, 0x34, 0xc4, 0xf0, 0x78, 0x49, 0x82, 0x63, 0xd8, 0xf2, 0xef, 0x90, 0xad, 0xd8, 0x68,
+          0x1c, 0xf5, 0x78, 0xe4, 0x05, 0xd6, 0xe2, 0xaa, 0x31, 0x77, 0xbd, 0xa5, 0xe6, 0x3f, 0xee, 0x09, 0x9c, 0xc4, 0x10, 0xfa, 0xc8, 0xe4, 0xa2, 0x1e,
+          0xb5, 0x0b, 0x2d, 0xe8, 0xe6, 0x7b, 0x40, 0x51, 0x65, 0xf4, 0x54, 0xfd, 0xb9, 0xbd, 0xd3, 0x93, 0x1c, 0x13, 0xbd, 0x76, 0xdd, 0x40, 0xa9, 0x4f,
+          0x30, 0xbc, 0x4e, 0x6e, 0x74, 0x2c, 0xa1, 0xa4, 0x3b, 0x14, 0xe1, 0x60, 0x37, 0x40, 0x5f, 0x93, 0xfb, 0xa8, 0xe9, 0x99, 0xad, 0x7b, 0x41, 0x6f,
+          0xa4, 0xb5, 0x89, 0x0e, 0x67, 0x5a, 0xc6, 0xcd, 0x20, 0x96, 0x6e, 0x8d, 0x87, 0xc4, 0xa6, 0x01, 0x7e, 0xd5, 0x61, 0xd5, 0x51, 0xa2, 0x9b, 0x0e,
+          0xf3, 0x70, 0x8a, 0xc7, 0x31, 0x26, 0x92, 0x34, 0xe0, 0x04, 0x4e, 0xaa, 0x96, 0x3b, 0xdc, 0x5d, 0x76, 0xe0, 0x86, 0xa5, 0x93, 0xb5, 0xf9, 0x88,
+          0x38, 0x99, 0x0d, 0x56, 0x81, 0x83, 0xc3, 0xbf, 0x31, 0x34, 0xe8, 0x1b, 0x4a, 0x87, 0x3c, 0x67, 0x21, 0xa5, 0x90, 0xa2, 0xe3, 0xc3, 0x91, 0x24,
+          0x3c, 0x90, 0x32, 0x13, 0x10, 0x11, 0xbe, 0x6d, 0xf7, 0xe2, 0x32, 0xaf, 0xef, 0x98, 0xe8, 0xf3, 0x31, 0x3a, 0x39, 0xc0, 0x11, 0xf4, 0x82, 0x92,
+          0x44, 0xe3, 0x6d, 0xad, 0x20, 0x4a, 0x94, 0x20, 0x0a, 0x75, 0x42, 0xcb, 0xea, 0xcd, 0x85, 0xa7, 0x43, 0x78, 0x99, 0x09, 0x75, 0xcc, 0x5b, 0xf8,
+          0xfc, 0x16, 0x9c, 0xeb, 0xcc, 0x1e, 0x00, 0x7c, 0xa5, 0x16, 0x3c, 0x67, 0xb3, 0x03, 0xff, 0x32, 0xcf, 0xd8, 0xeb, 0xb0, 0x5a, 0x99, 0xa5, 0x1f,
+          0x9d, 0xfd, 0xe8, 0xdc, 0xc5, 0xa4, 0x2f, 0xa1, 0x46, 0xff, 0xac, 0x70, 0xfe, 0x5f, 0xee, 0xeb, 0xcc, 0xa9, 0x11, 0xfe, 0x2c, 0x77, 0xff, 0xbf,
+          0xdc, 0xb4, 0xfd, 0xdd, 0x70, 0x28, 0x67, 0xf6, 0x85, 0xfd, 0xcc, 0xfd, 0x59, 0xfb, 0x30, 0xf7, 0x48, 0xf6, 0xa7, 0x0e, 0xdc, 0x10, 0x1c, 0x21,
+          0x0c, 0x63, 0x02, 0x12, 0x30, 0xc4, 0x64, 0xa4, 0x50, 0xd6, 0x06, 0xd9, 0x14, 0x5d, 0xa4, 0x66, 0x29, 0x54, 0x86, 0x46, 0x05, 0xac, 0x07, 0xf0,
+          0x14, 0x3e, 0x80, 0xe2, 0xbc, 0x64, 0xcb, 0x7d, 0x29, 0x46, 0xf9, 0xc3, 0xc4, 0x7f, 0xe2, 0xa9, 0x9e, 0x07, 0x0d, 0xf8, 0x8b, 0xd9, 0xf1, 0xe7,
+          0xd6, 0xc7, 0x0f, 0xf5, 0x9b, 0xcf, 0xd4, 0x15, 0x7e, 0x45, 0x22, 0x2e, 0x9f, 0x1c, 0x0c, 0xf9, 0x56, 0x3f, 0x9d, 0x2a, 0x24, 0xf1, 0x6a, 0x0c,
+          0x6d, 0xaa, 0xfa, 0x10, 0x37, 0xf9, 0x60, 0xd7, 0x40, 0xfb, 0x62, 0x5c, 0x6b, 0xdc, 0x56, 0xa0, 0xc4, 0x74, 0x63, 0x4d, 0x43, 0xdd, 0x2c, 0x18,
+          0x82, 0x49, 0x63, 0x48, 0xf4, 0xc8, 0x44, 0xae, 0x0e, 0xab, 0x76, 0x6e, 0xe6, 0xf7, 0x12, 0xde, 0xf5, 0x6e, 0x49, 0x6d, 0x56, 0x35, 0xcf, 0x79,
+          0xf9, 0x70, 0x00, 0x53, 0x12, 0x57, 0x09, 0xf6, 0x76, 0xe0, 0x27, 0x96, 0x06, 0x3d, 0x90, 0xf0, 0x5d, 0xbd, 0xc4, 0xe2, 0x99, 0xd6, 0xf2, 0x4b,
+          0xd7, 0x40, 0xf1, 0xf7, 0x75, 0x46, 0x65, 0x8e, 0x3d, 0x01, 0x20, 0x24, 0x54, 0x27, 0x5b, 0x4f, 0x28, 0x17, 0x96, 0xe7, 0x4a, 0x15, 0x15, 0xae,
+          0x68, 0x9a, 0xfe, 0x5c, 0xb5, 0x45, 0xbb, 0x96, 0x6b, 0xad, 0xbd, 0x57, 0xcf, 0xcb, 0x33, 0x32, 0x09, 0x75, 0xe6, 0x43, 0xd4, 0x16, 0xdd, 0xd3,
+          0xe3, 0xd8, 0x6f, 0x40, 0xd7, 0xa3, 0xc6, 0x95, 0x8c, 0x32, 0x37, 0x05, 0x24, 0x35, 0x56, 0x19, 0xff, 0x0b, 0xc6, 0xb3, 0xc7, 0xfa, 0xae, 0xcd,
+          0xad, 0xca, 0xd1, 0x99, 0x85, 0x49, 0x9e, 0x4e, 0x1f, 0x50, 0x83, 0x86, 0x70, 0x5f, 0x02, 0x37, 0x40, 0xc8, 0x3b, 0x1b, 0x01, 0x58, 0x84, 0xa5,
+          0x61, 0x61, 0x0f, 0xfc, 0xb7, 0x90, 0xc8, 0xec, 0xc6, 0x95, 0x1d, 0x1c, 0x51, 0xe3, 0x1d, 0x05, 0xa7, 0xb7, 0xa8, 0x47, 0x0c, 0x47, 0x60, 0x1e,
+          0x14, 0x92, 0xb9, 0x67, 0xfd, 0x00, 0x39, 0x1e, 0x36, 0xd7, 0x81, 0x8f, 0x96, 0x76, 0x48, 0xce, 0xf3, 0x1d, 0x0a, 0x31, 0xf1, 0x43, 0xde, 0xe6,
+          0x4c, 0xa0, 0x5f, 0xb2, 0xf0, 0xbe, 0x00, 0x9d, 0x5c, 0x40, 0xdd, 0xe7, 0xd2, 0x3a, 0xd6, 0xbe, 0xca, 0xe1, 0xbd, 0x87, 0x87, 0x15, 0x41, 0x14,
+          0x32, 0xa9, 0x6a, 0x90, 0x3c, 0xa8, 0xac, 0x7d, 0xa9, 0x6c, 0xf0, 0xbc, 0xaa, 0x81, 0x4a, 0x67, 0x21, 0xf4, 0x67, 0x7b, 0xb1, 0x66, 0xc4, 0x50,
+          0xa0, 0xae, 0x26, 0x80, 0x73, 0xd3, 0x2e, 0x95, 0x7d, 0xf4, 0x8e, 0xec, 0x16, 0xd2, 0xb7, 0xb0, 0x56, 0xa9, 0x7a, 0x7a, 0xe3, 0x50, 0x28, 0x90,
+          0x03, 0xcb, 0xe7, 0xa4, 0x6a, 0x0d, 0x17, 0x7a, 0x93, 0x2b, 0xd8, 0x6c, 0xa8, 0xe4, 0x8f, 0x23, 0x1c, 0x34, 0x83, 0xa4, 0x12, 0x35, 0x49, 0x08,
+          0xeb, 0xb5, 0x9e, 0xd0, 0x4f, 0xbb, 0xa0, 0x77, 0x02, 0x9c, 0x28, 0x04, 0x25, 0x01, 0xfd, 0x7b, 0xf8, 0x91, 0x82, 0x29, 0x39, 0xf1, 0xd0, 0x62,
+          0xe7, 0x01, 0x76, 0x82, 0xd3, 0x70, 0x3b, 0xd9, 0x91, 0x43, 0x97, 0x1c, 0x89, 0x6e, 0xc2, 0x92, 0x6c, 0x8e, 0xee, 0xfb, 0x77, 0xb2, 0x0e, 0x03,
+          0x41, 0x8f, 0xfb, 0x58, 0xd4, 0x83, 0xc0, 0x26, 0x3d, 0x52, 0xde, 0x88, 0xd9, 0xa6, 0xf7, 0x37, 0x4c, 0xb4, 0x1f, 0x72, 0x72, 0x6f, 0xbd, 0xc6,
+          0xc6, 0x6d, 0x93, 0x3d, 0x1c, 0x43, 0x3c, 0x18, 0x57, 0x28, 0x7d, 0xd4, 0x15, 0x22, 0x59, 0x80, 0x3e, 0x82, 0x1f, 0x0f, 0xd0, 0x58, 0x5b, 0x9f,
+          0x54, 0x61, 0x57, 0x5a, 0x72, 0x31, 0x4e, 0x3c, 0x6f, 0x45, 0x2d, 0xda, 0x16, 0xf0, 0x7c, 0x9c, 0xc1, 0x6f, 0xf1, 0x4f, 0x48, 0xf1, 0x3c, 0xbc,
+          0xa2, 0x86, 0x7f, 0x48, 0x49, 0xba, 0x09, 0xad, 0xc0, 0x4d, 0x46, 0xf3, 0x53, 0xbc, 0x36, 0xe2, 0xb1, 0x51, 0xb5, 0x72, 0xe1, 0xfb, 0x33, 0x8a,
+          0xe4, 0xec, 0xa7, 0x8a, 0x9c, 0x36, 0x10, 0x31, 0x6d, 0x4a, 0xa9, 0x5a, 0xbb, 0x68, 0x56, 0x0e, 0xc1, 0x9f, 0x27, 0xa8, 0xde, 0xda, 0x1c, 0x1f,
+          0xa1, 0x40, 0xa4, 0x2e, 0x1f, 0xad, 0x48, 0xa8, 0xbd, 0x01, 0x13, 0x64, 0x7e, 0xde, 0x9b, 0x4c, 0xd7, 0x47, 0xab, 0xe1, 0x4c, 0xec, 0xaa, 0x49,
+          0x73, 0x49, 0xa0, 0xe4, 0x7c, 0xa7, 0x91, 0xc1, 0x52, 0x63, 0xb5, 0xaf, 0x0f, 0x82, 0xf5, 0xc9, 0x74, 0xea, 0x30, 0xde, 0xda, 0x82, 0x9e, 0x26,
+          0xec, 0xec, 0x75, 0xda, 0x9b, 0xeb, 0x3d, 0xed, 0xa3, 0x9e, 0x72, 0xa0, 0x22, 0xad, 0x31, 0x3e, 0x82, 0x5d, 0x64, 0x1e, 0xbb, 0x1f, 0xbf, 0x3e,
+          0xc5, 0x1d, 0xea, 0x26, 0xc2, 0x5c, 0x64, 0xce, 0xaa, 0x4c, 0x74, 0x4b, 0x01, 0x18, 0x4f, 0x98, 0x7b, 0x2d, 0x4e, 0xdf, 0x1a, 0x4a, 0x08, 0xb0,
+          0x9f, 0x2f, 0x8a, 0x43, 0x0c, 0xbf, 0x3f, 0xd0, 0xe0, 0xce, 0x4c, 0x5b, 0xde, 0x96, 0xad, 0x5a, 0x41, 0xf7, 0x07, 0x04, 0x68, 0x0c, 0xb4, 0x73,
+          0x8c, 0x15, 0x44, 0x46, 0x16, 0xb9, 0x3f, 0xb1, 0x52, 0xe0, 0x27, 0x70, 0x86, 0x2f, 0x8e, 0x25, 0xbb, 0x4b, 0xcd, 0x4e, 0x95, 0x5f, 0x5d, 0x10,
+          0x17, 0xde, 0x43, 0x04, 0x20, 0x6f, 0x2c, 0x30, 0x9a, 0xe6, 0x93, 0x76, 0xd2, 0x49, 0x8e, 0xf4, 0x87, 0xf4, 0x48, 0x13, 0x1e, 0x7e, 0x8d, 0xf7,
+          0x92, 0xa6, 0xb4, 0x53, 0xd3, 0xdc, 0x64, 0x2f, 0xa5, 0x8f, 0x2f, 0x7e, 0x3c, 0x01, 0xab, 0xd6, 0xbd, 0x66, 0xc0, 0xf0, 0xe3, 0xe2, 0x46, 0x64,
+          0xed, 0xfc, 0xcd, 0x1c, 0x81, 0x6b, 0x81, 0x22, 0x26, 0x20, 0x74, 0x27, 0x39, 0x94, 0x56, 0x46, 0x53, 0x3d, 0x03, 0xe3, 0x08, 0x8e, 0x36, 0x8c,
+          0x9f, 0x80, 0xca, 0x03, 0x8b, 0xcf, 0xa3, 0x21, 0xf5, 0x6b, 0xdc, 0xcc, 0xb3, 0x6c, 0xdb, 0x8e, 0x31, 0x21, 0x4f, 0xeb, 0x9a, 0xee, 0x06, 0x16,
+          0x5c, 0x34, 0x4e, 0xaa, 0x2a, 0xc7, 0x98, 0x81, 0x0e, 0x78, 0x43, 0x28, 0x0e, 0x78, 0xc7, 0x71, 0xa8, 0xae, 0xa8, 0xfa, 0x78, 0xa8, 0x37, 0x48,
+          0x8e, 0xb8, 0x52, 0x83, 0x0c, 0x39, 0x2d, 0x36, 0x59, 0xe0, 0x43, 0xfc, 0xfc, 0xeb, 0xb7, 0x96, 0x26, 0xfc, 0xdb, 0x6e, 0x07, 0x3e, 0xe6, 0x3d,
+          0x8f, 0xc1, 0x2d, 0x21, 0xeb, 0x59, 0xba, 0x80, 0xa0, 0x11, 0xad, 0xbb, 0xc5, 0xeb, 0xf5, 0x1d, 0xc8, 0xf4, 0xa9, 0x3c, 0x51, 0xe7, 0x4b, 0xba,
+          0xba, 0xd0, 0x67, 0x5a, 0x84, 0x68, 0xed, 0x33, 0x12, 0x7e, 0x07, 0x8d, 0x10, 0x4b, 0x77, 0x2f, 0xe6, 0x4e, 0x79, 0x38, 0x45, 0xec, 0xe8, 0xa8,
+          0x29, 0x5b, 0xbc, 0x27, 0x0c, 0x80, 0x9f, 0x13, 0x5a, 0x69, 0x79, 0xdc, 0xcd, 0xe8, 0xcb, 0x87, 0xfd, 0xc7, 0x53, 0xff, 0x7f, 0xdb, 0x8d, 0x29,
+          0xd3, 0xbf, 0x3f, 0xfd, 0x14, 0xc8, 0x1a, 0x9c, 0xfe, 0x83, 0x1d, 0x53, 0x0a, 0x9c, 0x17, 0xde, 0x44, 0xcd, 0xd7, 0x99, 0xc8, 0xe5, 0x00, 0x4d,
+          0xbb, 0x39, 0x75, 0xc9, 0xa7, 0x30, 0xe9, 0xe4, 0x5d, 0x1c, 0x1c, 0xf1, 0x93, 0x7c, 0x60, 0xab, 0xfd, 0x42, 0x70, 0x6f, 0x2e, 0xad, 0xf1, 0x39,
+          0xa0, 0xb0, 0x9f, 0xac, 0x42, 0xa6, 0xb9, 0x47, 0xad, 0x34, 0xf5, 0x8d, 0x75, 0xe1, 0x1f, 0xdc, 0x8c, 0x02, 0xb7, 0x35, 0x21, 0x6b, 0xa4, 0x41,
+          0x60, 0x7e, 0x1e, 0xcf, 0xa1, 0x3d, 0x80, 0xbc, 0x1e, 0xf3, 0xe1, 0xc6, 0xd1, 0x26, 0x17, 0x88, 0x37, 0x1e, 0x53, 0xc2, 0x7e, 0x5e, 0x34, 0x2f,
+          0xe8, 0xec, 0x2e, 0xbc, 0x36, 0x9e, 0x5c, 0x30, 0x88, 0x14, 0x48, 0x5d, 0xe2, 0x96, 0x72, 0xa1, 0xec, 0xb6, 0x8a, 0x2c, 0x9e, 0xd8, 0x79, 0x1b,
+          0xb3, 0x06, 0xbb, 0x02, 0x03, 0x87, 0xad, 0xe9, 0xbb, 0x07, 0x78, 0x79, 0x7a, 0x50, 0xab, 0x8d, 0x87, 0x42, 0x38, 0xbf, 0x05, 0x01, 0xdd, 0x69,
+          0x74, 0xa0, 0x90, 0x0a, 0x1d, 0xd4, 0x22, 0xe8, 0xec, 0x41, 0x5a, 0x3d, 0x62, 0xd6, 0x48, 0xb6, 0xc0, 0x62, 0xa8, 0xdd, 0x7e, 0xc5, 0x00, 0xe2,
+          0x74, 0x20, 0xab, 0x7c, 0x2a, 0xc3, 0x37, 0x2e, 0xa3, 0x3e, 0xad, 0x96, 0x30, 0xfe, 0xcb, 0x28, 0x00, 0x90, 0x00, 0xb7, 0x92, 0xce, 0x61, 0x4a,
+          0xdf, 0x95, 0xd5, 0xb2, 0x43, 0x27, 0x13, 0x7e, 0x16, 0xa1, 0x72, 0xc9, 0x0c, 0xee, 0x4d, 0x0f, 0xc6, 0x9a, 0x0d, 0x9c, 0xdc, 0x7d, 0x28, 0x28,
+          0xef, 0x12, 0x64, 0xf7, 0xdd, 0xbc, 0x4e, 0x89, 0xa7, 0xcf, 0x0b, 0xe5, 0x3a, 0x19, 0x48, 0x09, 0x0f, 0x05, 0x16, 0xba, 0xa1, 0xa3, 0x08, 0x3b,
+          0x11, 0x01, 0x07, 0xd4, 0xd6, 0x65, 0x38, 0x69, 0x04, 0x68, 0xa4, 0x3b, 0x18, 0xce, 0x49, 0x71, 0xbb, 0x82, 0x50, 0x78, 0x56, 0x87, 0x11, 0x76,
+          0x21, 0x79, 0x53, 0x69, 0xf8, 0x4d, 0x0e, 0x56, 0x83, 0x46, 0x1c, 0x5f, 0xb5, 0xb8, 0x42, 0x74, 0x5c, 0x42, 0xc5, 0xd0, 0x43, 0x26, 0xb6, 0x4b,
+          0x10, 0x9a, 0xc2, 0xad, 0x9e, 0xbb, 0xb5, 0xc0, 0x51, 0x9d, 0xce, 0x51, 0x82, 0xe3, 0xac, 0xf8, 0x5e, 0x06, 0x36, 0x97, 0x0e, 0x0a, 0x64, 0xb9,
+          0x06, 0x08, 0x50, 0x87, 0x04, 0x21, 0x94, 0x6c, 0x12, 0x54, 0xfe, 0x08, 0x82, 0xb0, 0xbc, 0xe4, 0x91, 0xa0, 0xe4, 0x61, 0xce, 0x95, 0x43, 0xb6,
+          0xa2, 0x95, 0x7e, 0x60, 0xf2, 0x59, 0xd3, 0xbc, 0x7c, 0xcc, 0x5d, 0xcd, 0x72, 0x74, 0x78, 0xce, 0x0c, 0x72, 0x86, 0x37, 0xb9, 0x1d, 0xd0, 0x91,
+          0x86, 0xe8, 0x4a, 0xcb, 0xaa, 0xce, 0xfb, 0xc6, 0xd9, 0x6d, 0x17, 0x89, 0xca, 0x3e, 0xd1, 0x7f, 0x98, 0x2b, 0x02, 0x74, 0x45, 0x6b, 0xfc, 0xf0,
+          0x78, 0xc4, 0x52, 0xe8, 0xed, 0x80, 0x80, 0x51, 0x4f, 0x96, 0x62, 0xbc, 0x27, 0x9d, 0x96, 0x32, 0x5b, 0xcb, 0xa9, 0x84, 0x25, 0xc0, 0xa9, 0xca,
+          0x32, 0xa1, 0x2e, 0x62, 0xa8, 0x8b, 0x15, 0xdc, 0x08, 0x86, 0xc6, 0x4e, 0x63, 0x11, 0x02, 0x7c, 0x4f, 0x85, 0x65, 0x99, 0x80, 0x61, 0x4d, 0xad,
+          0xf1, 0x04, 0xec, 0x7e, 0x7a, 0x71, 0xb4, 0xf6, 0xc7, 0xbc, 0x8f, 0xcf, 0x4a, 0xad, 0x18, 0xb5, 0x3c, 0x43, 0x92, 0xc4, 0x61, 0x61, 0x9b, 0xeb,
+          0x48, 0x66, 0x08, 0xf1, 0x47, 0x67, 0x9b, 0x9d, 0x8b, 0xb6, 0x57, 0xcd, 0xe5, 0x4a, 0x83, 0xba, 0x90, 0xa3, 0xbc, 0xf1, 0x6a, 0x1f, 0x39, 0x33,
+          0x7f, 0x08, 0xb6, 0x36, 0xaf, 0x13, 0xd6, 0x0f, 0xea, 0x08, 0x62, 0xea, 0xa6, 0xcd, 0xe6, 0xd6, 0xd0, 0x4c, 0x1a, 0x3f, 0xc8, 0x21, 0x23, 0xfc,
+          0xee, 0xa6, 0xb2, 0xb1, 0x25, 0xe6, 0x5b, 0x3d, 0x1b, 0x30, 0x29, 0xe2, 0x25, 0xdb, 0xb2, 0xc5, 0xf5, 0x86, 0xc4, 0xd1, 0x3e, 0x14, 0x02, 0xec,
+          0x29, 0x3b, 0x7e, 0x3a, 0x8d, 0x25, 0xe5, 0x3a, 0x65, 0xc4, 0x8d, 0x3b, 0x41, 0x8e, 0x2c, 0x39, 0x97, 0x94, 0xbd, 0xe6, 0x52, 0x8d, 0x0d, 0xea,
+          0xd8, 0x86, 0xe0, 0xdb, 0x65, 0x88, 0xe0, 0xb4, 0xbd, 0xc2, 0x35, 0xdf, 0xde, 0x77, 0xa7, 0x55, 0x09, 0x3a, 0x0a, 0x12, 0x38, 0xd4, 0x97, 0x96,
+          0x24, 0x82, 0x36, 0x26, 0x36, 0xbd, 0x7e, 0xa2, 0xe5, 0x77, 0x80, 0x41, 0x3f, 0x64, 0xc3, 0x2b, 0xfd, 0xf0, 0xb7, 0x0d, 0x79, 0x8e, 0x4f, 0x39,
+          0x7c, 0x53, 0xf6, 0x4d, 0x28, 0xce, 0xf6, 0xd9, 0x81, 0xa8, 0x78, 0x40, 0x89, 0xaa, 0x2d, 0xb9, 0xd5, 0xb3, 0x76, 0xdc, 0xdc, 0x3f, 0xd6, 0xaa,
+          0x0f, 0x5a, 0xfe, 0x23, 0x5b, 0x8d, 0x9c, 0xf4, 0xd2, 0x10, 0xb5, 0x2a, 0xae, 0x85, 0xf0, 0x63, 0xe8, 0xa7, 0x83, 0xa3, 0xaa, 0x41, 0x96, 0x61,
+          0xbf, 0xac, 0x10, 0x95, 0xf8, 0xe5, 0x06, 0x33, 0x87, 0x74, 0xa6, 0x33, 0x90, 0x13, 0x79, 0xc7, 0xaa, 0xe7, 0xf7, 0xbb, 0x43, 0x5a, 0xba, 0xa9,
+          0x1b, 0x99, 0x3a, 0xac, 0x83, 0xfc, 0xb3, 0x51, 0x70, 0x23, 0xe8, 0x7e, 0x68, 0xb8, 0x6a, 0xaf, 0xe8, 0x8a, 0xa5, 0xda, 0x01, 0x1c, 0x13, 0x22,
+          0x6e, 0x04, 0x9c, 0xe9, 0xdc, 0xef, 0x1d, 0x11, 0xae, 0x8b, 0x66, 0xae, 0x00, 0xb9, 0xef, 0x33, 0xec, 0xbf, 0x4b, 0x6e, 0x70, 0x83, 0xe0, 0x24,
+          0x83, 0x41, 0xdf, 0xbf, 0x47, 0x1b, 0xfa, 0xb6, 0x01, 0x75, 0xc2, 0xdc, 0x16, 0x36, 0x41, 0x16, 0xcd, 0x91, 0x01, 0x0e, 0xfa, 0x06, 0x1b, 0xed,
+          0x9a, 0x7a, 0x41, 0xc7, 0x54, 0x69, 0x2d, 0x93, 0x2a, 0x93, 0x39, 0x30, 0x56, 0x0e, 0x58, 0x9e, 0xaf, 0x0f, 0xca, 0x87, 0xa8, 0xe6, 0x4d, 0x3e,
+          0xfe, 0x6f, 0x30, 0x00, 0xcb, 0x14, 0x3d, 0x03, 0x25, 0xee, 0x5f, 0xd1, 0x4f, 0xaf, 0x1f, 0x0e, 0x10, 0xcf, 0x1d, 0xf1, 0x51, 0xd5, 0x5f, 0x0b,
+          0x49, 0xd7, 0x01, 0x21, 0x05, 0x38, 0xfc, 0x5f, 0x76, 0x6c, 0xd5, 0xd5, 0x83, 0x39, 0x36, 0xcf, 0x3e, 0x68, 0xd9, 0x84, 0x78, 0x4c, 0x45, 0x61,
+          0x32, 0x31, 0x81, 0x54, 0xc3, 0xeb, 0x98, 0xc4, 0x30, 0xd3, 0x06, 0x2a, 0xd0, 0xd3, 0x67, 0x9c, 0xd7, 0x55, 0x00, 0x03, 0x7c, 0x10, 0xe2, 0x23,
+          0xb2, 0x30, 0x2e, 0xc1, 0xab, 0x82, 0x7c, 0x77, 0x3b, 0x3e, 0x0a, 0x6a, 0x28, 0x45, 0xd8, 0xf3, 0x0b, 0x82, 0x8d, 0xa8, 0xdf, 0xde, 0xc4, 0x46,
+          0xb6, 0x82, 0xb7, 0x9e, 0x9c, 0xb6, 0xb2, 0x68, 0xad, 0x4d, 0x4c, 0x70, 0xd4, 0x6a, 0x48, 0x72, 0x54, 0x30, 0x0d, 0xd2, 0xa2, 0x5a, 0x5f, 0x91,
+          0x66, 0x70, 0xb1, 0x58, 0x35, 0x46, 0x4a, 0x0e, 0x5b, 0x92, 0x29, 0x42, 0x44, 0x97, 0xc0, 0x9a, 0xf0, 0x80, 0x9d, 0xca, 0x80, 0x37, 0x4c, 0xcb,
+          0x04, 0x65, 0x88, 0x0e, 0xf8, 0xd7, 0x56, 0x63, 0x40, 0xe5, 0x5e, 0xc1, 0x27, 0x37, 0xeb, 0x0e, 0xe3, 0x90, 0x5c, 0x45, 0x5a, 0x37, 0x32, 0x83,
+          0x52, 0x2f, 0x32, 0x87, 0x8b, 0x68, 0x63, 0xd7, 0x72, 0xb0, 0x28, 0x3b, 0x42, 0x33, 0x49, 0x65, 0x45, 0x3f, 0xcf, 0x9f, 0x4a, 0x5d, 0x03, 0xbd,
+          0xc9, 0x0d, 0xfe, 0xf4, 0x68, 0xc0, 0x79, 0x6b, 0xf8, 0x40, 0x38, 0x08, 0x59, 0x1d, 0x25, 0x5e, 0xf9, 0x93, 0x26, 0x97, 0xa7, 0xa3, 0x09, 0x69,
+          0x44, 0xa0, 0x74, 0x4c, 0x13, 0xcc, 0x34, 0x53, 0xd1, 0x02, 0xf3, 0x55, 0xf5, 0x58, 0xcd, 0xd7, 0xb9, 0x18, 0x46, 0x89, 0xa8, 0x89, 0xd5, 0x1e,
+          0x34, 0x5d, 0x3f, 0x22, 0x0b, 0x81, 0x5c, 0x9e, 0x55, 0xde, 0x09, 0xf7, 0x96, 0xa2, 0x49, 0x67, 0x4d, 0x8d, 0xce, 0xd5, 0xfd, 0x05, 0x9c, 0x2a,
+          0x42, 0x03, 0x4e, 0xe4, 0xa3, 0x11, 0x06, 0x08, 0x3e, 0xad, 0xca, 0x9e, 0x75, 0x98, 0x68, 0xe1, 0x8b, 0x88, 0x14, 0x6f, 0x5c, 0x31, 0x9f, 0x20,
+          0x8d, 0x88, 0x49, 0xb3, 0x0e, 0x4f, 0x9a, 0x41, 0x08, 0x52, 0xf7, 0xe2, 0x1e, 0x3a, 0x80, 0x87, 0x2c, 0xe0, 0x6a, 0xcb, 0x55, 0x75, 0x80, 0x38,
+          0x6d, 0xd3, 0xeb, 0x4a, 0x76, 0x93, 0xcb, 0x53, 0x13, 0x94, 0x18, 0x96, 0x70, 0x30, 0xc3, 0x3b, 0x0f, 0xad, 0x87, 0xb9, 0x99, 0x5c, 0xfa, 0x16,
+          0x3b, 0x28, 0x8e, 0xfd, 0xf8, 0x78, 0x85, 0xc7, 0xef, 0xc4, 0xce, 0x3e, 0x59, 0x00, 0x57, 0x94, 0x7f, 0x6e, 0x8b, 0xa4, 0x90, 0x5f, 0xfd, 0x7d,
+          0x61, 0xd0, 0x26, 0x8f, 0x89, 0xbf, 0x9a, 0xef, 0x12, 0x29, 0x81, 0xaa, 0x02, 0x24, 0x89, 0xe3, 0xb9, 0xf1, 0xd0, 0x64, 0x84, 0x11, 0x7d, 0x08,
+          0x30, 0x40, 0x2d, 0xca, 0x1c, 0x32, 0x58, 0xc8, 0x53, 0x79, 0x3a, 0xab, 0xc5, 0x68, 0x53, 0xf4, 0xd6, 0x35, 0xe5, 0xb0, 0x1e, 0x25, 0x31, 0x78,
+          0x2b, 0x06, 0x10, 0xd8, 0x8f, 0x57, 0xbb, 0xb0, 0x7e, 0x52, 0x95, 0x96, 0x23, 0x1d, 0xb0, 0xb2, 0x01, 0xda, 0xf2, 0x0a, 0x1c, 0x4a, 0x6f, 0x99,
+          0x0c, 0x93, 0xb5, 0x72, 0xe0, 0x1d, 0xbf, 0xca, 0xdf, 0xe1, 0x41, 0x3d, 0x2f, 0x5e, 0x73, 0x27, 0xe0, 0x19, 0x2d, 0x0d, 0x7d, 0x5f, 0xed, 0xee,
+          0x55, 0x95, 0x19, 0x43, 0x2d, 0x18, 0x9a, 0x0a, 0x47, 0xf9, 0xb3, 0x0e, 0x00, 0xd7, 0x36, 0x5d, 0x5b, 0x85, 0x30, 0xb2, 0xa7, 0xb1, 0x43, 0x3f,
+          0x96, 0xa4, 0xac, 0x4a, 0x6d, 0xe6, 0xe4, 0x1c, 0x8f, 0x75, 0x35, 0x92, 0xbc, 0x00, 0xcd, 0xd9, 0x2a, 0xf9, 0x70, 0x35, 0x10, 0x7e, 0xc7, 0x5f,
+          0xfa, 0x3a, 0x34, 0xd2, 0xaa, 0x14, 0xfa, 0x00, 0x30, 0x8f, 0x0d, 0x6b, 0xb4, 0xb9, 0x6c, 0xf3, 0xd4, 0xcb, 0xbd, 0x6a, 0xfb, 0xd5, 0xed, 0x5c,
+          0x47, 0xb4, 0xb3, 0x83, 0xda, 0xea, 0xaf, 0x60, 0x73, 0xfa, 0xc9, 0xb0, 0x07, 0xfc, 0xd1, 0x67, 0xaf, 0xe8, 0x24, 0x7f, 0x9d, 0xdd, 0x79, 0xfa,
+          0xaf, 0x05, 0x26, 0x7f, 0x8a, 0x34, 0xaa, 0x2d, 0x43, 0xbe, 0xdc, 0xe9, 0xc8, 0x57, 0xc2, 0x8c, 0xd6, 0xa7, 0x7f, 0xbf, 0x8c, 0x57, 0x17, 0x5c,
+          0x41, 0xfb, 0x85, 0x6b, 0x6b, 0x9a, 0x2d, 0x97, 0x3d, 0x9c, 0x13, 0x44, 0x71, 0xcb, 0xd2, 0xef, 0x69, 0x47, 0xca, 0x59, 0x44, 0x7e, 0xc0, 0xd5,
+          0x5e, 0x25, 0x49, 0x84, 0x74, 0x66, 0x08, 0x88, 0xcc, 0x91, 0xaa, 0xbe, 0xdb, 0x46, 0xfb, 0x26, 0x41, 0xc3, 0x8b, 0xee, 0xe1, 0x2a, 0x5d, 0x44,
+          0xd7, 0x68, 0xcd, 0x78, 0x01, 0xa7, 0x70, 0x63, 0x90, 0x8f, 0xe0, 0xbc, 0x4b, 0x26, 0x42, 0xe3, 0x06, 0x31, 0xae, 0x5b, 0xfa, 0xab, 0x1d, 0xa3,
+          0x24, 0x38, 0x00, 0x0b, 0xfc, 0x5c, 0xd9, 0x53, 0x10, 0x5d, 0xec, 0x11, 0x9b, 0x16, 0x7a, 0xb3, 0xf2, 0xb4, 0xe7, 0x03, 0x60, 0x9a, 0x5b, 0x74,
+          0x79, 0x3c, 0xec, 0xe6, 0x04, 0x11, 0xe9, 0x87, 0x87, 0x19, 0xac, 0xec, 0x1b, 0x3a, 0x59, 0x61, 0x4a, 0x55, 0xfa, 0xf7, 0x13, 0xcb, 0xd5, 0x0d,
+          0x92, 0x90, 0xa5, 0x8e, 0x05, 0xa9, 0x46, 0xd6, 0x70, 0xed, 0x7a, 0x06, 0x92, 0x70, 0x3e, 0x44, 0x4b, 0x67, 0xa0, 0x3a, 0x65, 0xab, 0x9c, 0x34,
+          0xc1, 0x58, 0x62, 0xac, 0x87, 0xe8, 0xa6, 0x96, 0x56, 0x6c, 0x47, 0x21, 0x37, 0x5e, 0x6a, 0xc4, 0xaa, 0x38, 0x01, 0x51, 0xc0, 0xca, 0x8d, 0xfd,
+          0xc6, 0x5d, 0x5e, 0x7e, 0x27, 0x21, 0x8f, 0x97, 0x2c, 0xcd, 0x26, 0xb0, 0x3e, 0x0e, 0x23, 0xeb, 0x2f, 0xc5, 0x08, 0x4b, 0x59, 0x9b, 0x58, 0x05,
+          0xfa, 0x88, 0x8c, 0x2e, 0xe1, 0xe7, 0xf4, 0x56, 0x95, 0x18, 0x63, 0x3c, 0xc7, 0x6a, 0x60, 0x9b, 0x45, 0x17, 0x98, 0x27, 0xad, 0x65, 0xd2, 0x14,
+          0xe5, 0x2c, 0xb2, 0x7d, 0xb5, 0x70, 0x82, 0xf1, 0xd2, 0x49, 0xd6, 0xb0, 0x5d, 0x3e, 0x43, 0x47, 0xcd, 0x80, 0xfe, 0x40, 0x39, 0x96, 0x14, 0x67,
+          0x1e, 0xf7, 0x88, 0x7e, 0xe9, 0xd8, 0xf3, 0xc5, 0xa1, 0x33, 0xd1, 0xcf, 0xe7, 0x53, 0x99, 0xd5, 0x83, 0xc1, 0xe2, 0xf8, 0x86, 0x1a, 0x1a, 0x28,
+          0xfc, 0xfb, 0x2b, 0xac, 0x00, 0x87, 0xaa, 0x96, 0x28, 0xff, 0x61, 0x77, 0x30, 0x74, 0x15, 0x88, 0xfc, 0x71, 0x6f, 0x14, 0xb5, 0xd5, 0x75, 0x01,
+          0xac, 0x8e, 0xdd, 0x35, 0xff, 0x47, 0x41, 0x1b, 0x7a, 0x6d, 0x0f, 0x0e, 0xbc, 0xc4, 0xc1, 0x2e, 0xd2, 0x8c, 0x08, 0x1b, 0xe6, 0x97, 0xa3, 0xee,
+          0xf8, 0x87, 0x10, 0x04, 0xc1, 0x83, 0x58, 0xe8, 0x4b, 0x92, 0x05, 0x50, 0x9f, 0x89, 0xd2, 0x4c, 0x9c, 0x97, 0xbe, 0xdd, 0x35, 0x76, 0xe9, 0x45,
+          0x3d, 0x6c, 0x9e, 0x1b, 0x4a, 0x97, 0xe7, 0x39, 0x44, 0xd5, 0x63, 0x87, 0x94, 0x2e, 0xb4, 0x0f, 0xe7, 0x5a, 0x7c, 0x8e, 0x5b, 0x08, 0xf9, 0xa6,
+          0x5c, 0x1d, 0xd2, 0x53, 0xbe, 0x56, 0x1f, 0x9d, 0xe0, 0xd2, 0x89, 0xa3, 0xb6, 0x00, 0xcb, 0x27, 0x4d, 0x74, 0x78, 0x85, 0x04, 0x70, 0xaf, 0x69,
+          0x8f, 0x6f, 0x45, 0x56, 0x9d, 0x1a, 0x90, 0xd5, 0x7e, 0x30, 0x66, 0x61, 0x07, 0x0a, 0x9c, 0x27, 0xea, 0x07, 0x78, 0x27, 0x64, 0x09, 0x5c, 0xac,
+          0xf1, 0xcf, 0xd2, 0x78, 0xfa, 0x1a, 0x36, 0xcb, 0xf9, 0x18, 0x78, 0xab, 0x9e, 0x1f, 0xa7, 0xa5, 0x70, 0x87, 0x5e, 0x6a, 0x53, 0x62, 0xb2, 0xea,
+          0x02, 0xa5, 0xa3, 0x79, 0x38, 0x82, 0x03, 0x29, 0x8b, 0xb6, 0x18, 0x0f, 0x8d, 0x21, 0x12, 0xf1, 0x5c, 0x7d, 0x9e, 0xb2, 0xb4, 0x51, 0xe3, 0x8d,
+          0x66, 0xa5, 0x78, 0xb6, 0x26, 0x52, 0x4c, 0x9b, 0xba, 0xb0, 0x1f, 0xb9, 0xf8, 0x8d, 0xe6, 0x01, 0xcc, 0xc5, 0x5d, 0x23, 0xd7, 0x89, 0x5e, 0x27,
+          0x09, 0xa2, 0x77, 0xe7, 0xfc, 0x5c, 0x63, 0x48, 0xa5, 0xc2, 0x22, 0x85, 0xc7, 0x7b, 0xd9, 0x09, 0xaf, 0x63, 0xe5, 0x2c, 0x37, 0x92, 0x9e, 0x28,
+          0x20, 0xd7, 0x08, 0x26, 0xfe, 0xdc, 0x16, 0xda, 0xd6, 0xa9, 0xdf, 0x4e, 0x3a, 0x41, 0x9b, 0x0c, 0xd1, 0x4c, 0xd7, 0x96, 0x15, 0xd9, 0xfe, 0xaa,
+          0x8b, 0x98, 0x00, 0xe4, 0x49, 0x26, 0xc1, 0x5f, 0x09, 0x50, 0xfe, 0x91, 0x88, 0x1a, 0x56, 0x3d, 0xe5, 0x51, 0xfe, 0x7e, 0xdd, 0xc0, 0x3b, 0x28,
+          0x79, 0x35, 0x72, 0xa2, 0xd2, 0xd2, 0x8c, 0x6a, 0xd0, 0x52, 0x74, 0x9f, 0x49, 0x52, 0xb0, 0x8f, 0x42, 0x30, 0x1e, 0xda, 0x2c, 0xaf, 0xf5, 0xe4,
+          0xd0, 0xfc, 0xb1, 0x01, 0xfc, 0x1f, 0x7c, 0x38, 0x86, 0x13, 0xcf, 0xbd, 0x94, 0xf8, 0xbc, 0x49, 0x37, 0x0e, 0xa1, 0x7d, 0x03, 0x40, 0x9e, 0x25,
+          0x24, 0xd5, 0x37, 0x66, 0x08, 0xb3, 0x1e, 0xc2, 0x64, 0x02, 0xc3, 0x91, 0x3b, 0xfb, 0x26, 0x31, 0xc6, 0x88, 0x16, 0x41, 0x7c, 0x21, 0x04, 0x05,
+          0x05, 0x28, 0x3e, 0xeb, 0x6b, 0xb6, 0xe5, 0x0b, 0xfd, 0x1c, 0xd3, 0x71, 0xcb, 0x59, 0xeb, 0x01, 0xea, 0x62, 0x8c, 0x2d, 0xe9, 0x0d, 0x53, 0x87,
+          0x0c, 0xef, 0xe4, 0xec, 0x4c, 0x47, 0xe6, 0xa5, 0x12, 0xc7, 0x1c, 0x54, 0x07, 0x6b, 0x90, 0x32, 0xd2, 0xe8, 0xad, 0x73, 0x3f, 0xe7, 0x34, 0x79,
+          0xa6, 0x24, 0x2c, 0x04, 0xb6, 0xee, 0x22, 0x0f, 0x95, 0x13, 0xd1, 0x1e, 0x79, 0xd9, 0x85, 0x28, 0x9b, 0x6a, 0x47, 0xb0, 0x81, 0xd5, 0x05, 0xa8,
+          0x71, 0x43, 0x98, 0xf6, 0x86, 0x9b, 0x5e, 0x1b, 0x38, 0xd7, 0x52, 0x84, 0xbf, 0x38, 0xc9, 0x3a, 0x8c, 0x60, 0x0d, 0xa2, 0xc5, 0x12, 0x88, 0x70,
+          0x2a, 0x83, 0xb8, 0x72, 0x14, 0x38, 0xb2, 0x4c, 0x77, 0x59, 0x57, 0x3b, 0xb2, 0xad, 0x5b, 0x09, 0x69, 0x39, 0x4e, 0x6c, 0xfb, 0x2e, 0xd2, 0x00,
+          0xfe, 0xa6, 0xe3, 0xee, 0xee, 0x43, 0x81, 0xc0, 0xa0, 0x9e, 0x03, 0xa4, 0x90, 0x63, 0x1e, 0x09, 0xc5, 0x46, 0xef, 0x19, 0x21, 0xef, 0x00, 0x25,
+          0x7e, 0xeb, 0x6d, 0x60, 0x4c, 0x71, 0x68, 0xd9, 0x95, 0x2d, 0x52, 0x0d, 0x0a, 0x43, 0xc2, 0xe2, 0xd2, 0x9b, 0xf7, 0xd9, 0x4f, 0x32, 0xcf, 0x17,
+          0x0b, 0x63, 0xf9, 0x85, 0xa7, 0x7c, 0x3e, 0x09, 0xe3, 0xc9, 0x39, 0x77, 0xf1, 0x22, 0x5c, 0x44, 0x3c, 0xd7, 0xea, 0x4b, 0x6f, 0x28, 0xa3, 0xa1,
+          0xc4, 0x5b, 0x34, 0x8c, 0x65, 0x19, 0xc0, 0x8e, 0xfa, 0x57, 0xab, 0x6c, 0x06, 0xd5, 0x06, 0xe8, 0xbf, 0x9c, 0x8d, 0xe9, 0x75, 0x0f, 0x90, 0x6c,
+          0x4a, 0x9e, 0xf5, 0x1c, 0xa6, 0x21, 0xe0, 0x27, 0x7b, 0x26, 0xbc, 0x00, 0x26, 0xda, 0x91, 0xeb, 0x02, 0xba, 0x77, 0xa3, 0x6a, 0x50, 0xf1, 0x20,
+          0x15, 0x4e, 0x11, 0xab, 0x63, 0xf3, 0x86, 0x41, 0x41, 0xc7, 0xd0, 0x9b, 0xed, 0x94, 0xd2, 0x6e, 0xc2, 0x68, 0x50, 0x67, 0x02, 0xbf, 0x47, 0xf0,
+          0x49, 0x86, 0xca, 0x61, 0x86, 0xd4, 0x93, 0x16, 0x8c, 0x8f, 0xb0, 0xdf, 0x6c, 0xaa, 0x88, 0x45, 0x7d, 0x26, 0x47, 0x9f, 0x4c, 0x09, 0xdc, 0xa0,
+          0x00, 0xc9, 0x98, 0x2f, 0x16, 0x4a, 0x24, 0xf2, 0xc0, 0x8c, 0xe1, 0x3b, 0x17, 0xf4, 0xb3, 0x20, 0xc9, 0x65, 0x01, 0xe3, 0x12, 0x6a, 0x5c, 0xb8,
+          0x04, 0x1e, 0x9e, 0x3a, 0xb2, 0x82, 0xac, 0xb7, 0xee, 0x7a, 0xd1, 0x71, 0xbb, 0x45, 0x01, 0xe7, 0x76, 0xf6, 0x5e, 0x49, 0x71, 0x27, 0xca, 0x25,
+          0x5e, 0x69, 0x48, 0xe5, 0x30, 0x9d, 0xd5, 0x90, 0xf4, 0xb6, 0x93, 0x08, 0xf5, 0x03, 0x93, 0x7f, 0x62, 0x37, 0xbc, 0xcd, 0xb8, 0x89, 0x1a, 0xae,
+          0xd1, 0x98, 0x49, 0x83, 0xe7, 0x8c, 0xee, 0x85, 0xa3, 0xa0, 0x2e, 0x3c, 0xc1, 0x1b, 0x3d, 0x6c, 0xbd, 0x5c, 0x47, 0xce, 0xf9, 0xc6, 0xb5, 0xc3,
+          0xc6, 0x9e, 0x73, 0x2c, 0xe8, 0x22, 0x04, 0x9b, 0x2f, 0xbd, 0x9b, 0xc5, 0x61, 0x08, 0xe9, 0x11, 0x3a, 0x37, 0x92, 0xaa, 0x0a, 0xbf, 0x1d, 0x37,
+          0x2c, 0x37, 0x00, 0xd6, 0x0e, 0x8c, 0x07, 0x23, 0x5e, 0xd5, 0xf7, 0x36, 0xa9, 0x80, 0x37, 0xa9, 0xe1, 0x74, 0x2c, 0x6e, 0x96, 0x47, 0xae, 0xa6,
+          0xe0, 0xc3, 0x51, 0xba, 0xd2, 0xe6, 0x95, 0x19, 0x44, 0x97, 0xa1, 0x64, 0xe4, 0x4d, 0xea, 0x31, 0xd2, 0x44, 0x96, 0x80, 0xdd, 0x78, 0xba, 0x56,
+          0x9c, 0xea, 0x5e, 0x86, 0xa8, 0x68, 0x05, 0x22, 0xe6, 0x69, 0xcb, 0xc4, 0x5a, 0xc6, 0xfc, 0x0e, 0xe4, 0x28, 0x9c, 0x49, 0x6f, 0xb2, 0x10, 0x53,
+          0x26, 0x63, 0xbe, 0xa6, 0x9a, 0x50, 0xc2, 0x82, 0x98, 0xe1, 0x57, 0x91, 0x02, 0x1f, 0x51, 0xe6, 0x63, 0x10, 0xa9, 0x1c, 0xee, 0x81, 0x3c, 0xe0,
+          0x1f, 0xd7, 0xc7, 0x40, 0xd0, 0xb0, 0x1e, 0x37, 0xda, 0xba, 0x07, 0xac, 0x8e, 0x26, 0x00, 0x44, 0x43, 0x52, 0x65, 0xa2, 0xd7, 0xab, 0x4e, 0x9a,
+          0xf8, 0xb1, 0xe3, 0x10, 0xe5, 0xf4, 0x42, 0x04, 0x54, 0xba, 0x8e, 0xc6, 0x6c, 0x0f, 0xde, 0x99, 0xef, 0x42, 0x06, 0x41, 0x31, 0x11, 0x51, 0x10,
+          0xaf, 0x18, 0xb9, 0x86, 0xcd, 0x15, 0xf5, 0xcd, 0xf9, 0x96, 0x04, 0xd3, 0xd0, 0x41, 0x9d, 0xa0, 0x5a, 0x39, 0x6c, 0x30, 0x69, 0x0f, 0xba, 0x4d,
+          0x4d, 0xfb, 0x73, 0x50, 0x43, 0xe2, 0xdb, 0x04, 0x42, 0x99, 0x19, 0xe8, 0x6c, 0x0e, 0x26, 0x33, 0x3e, 0x06, 0xd8, 0xb0, 0x14, 0x37, 0x71, 0x1f,
+          0x63, 0x0d, 0xf6, 0x5f, 0x80, 0xce, 0x0b, 0xae, 0x25, 0x66, 0x8c, 0x75, 0xb2, 0x1e, 0x55, 0x05, 0xa3, 0x8d, 0x33, 0x94, 0xc7, 0x9e, 0x8e, 0x46,
+          0xac, 0x38, 0xd5, 0xdb, 0x17, 0x00, 0x5a, 0x5c, 0x2e, 0x14, 0x20, 0x55, 0xcb, 0xc8, 0x67, 0x94, 0x68, 0xfd, 0x24, 0xb0, 0x98, 0x4b, 0x4c, 0x8f,
+          0xa9, 0x32, 0xc2, 0xc3, 0xd4, 0xbd, 0x7f, 0x16, 0xe8, 0x01, 0x1c, 0x02, 0x62, 0x52, 0x25, 0x2f, 0xc8, 0xe0, 0x4f, 0x40, 0x2c, 0xe2, 0x0e, 0x9e,
+          0x84, 0x3c, 0x1c, 0x6c, 0x3a, 0x5c, 0x69, 0xab, 0x26, 0x45, 0xf2, 0x5c, 0xdd, 0xc1, 0x9a, 0x3e, 0xc7, 0x73, 0xdb, 0xc2, 0xa4, 0xb6, 0x89, 0x11,
+          0x64, 0x1f, 0x29, 0x36, 0x8e, 0xc1, 0x6c, 0xda, 0x4a, 0x86, 0x73, 0xbe, 0xf8, 0x2e, 0xf6, 0x59, 0xc0, 0xd7, 0xd4, 0x95, 0x0a, 0xce, 0xc8, 0xf7,
+          0xa0, 0xb5, 0xc3, 0x94, 0xe0, 0xc6, 0x7a, 0x6f, 0xd7, 0x02, 0x38, 0xee, 0xe5, 0x2a, 0x44, 0x43, 0x63, 0xe5, 0xa4, 0xab, 0xe7, 0x3a, 0xd3, 0x8c,
+          0x6a, 0x26, 0xc8, 0xd1, 0xf9, 0x40, 0xb4, 0xf6, 0x9b, 0xc5, 0xae, 0x27, 0x11, 0x15, 0x93, 0xb7, 0x2c, 0x66, 0x24, 0x2d, 0x1b, 0x01, 0x6f, 0x23,
+          0x97, 0x3a, 0x18, 0x00, 0xf0, 0x1a, 0x34, 0x56, 0x8e, 0x09, 0xc7, 0x31, 0x29, 0xb6, 0x3f, 0x31, 0x36, 0x38, 0xce, 0xeb, 0x02, 0xe2, 0x1d, 0xad,
+          0x84, 0x9c, 0xde, 0xd6, 0x53, 0xc4, 0x97, 0xf9, 0x98, 0x18, 0x5d, 0xcc, 0xc0, 0x51, 0xb0, 0x09, 0xfe, 0xa5, 0x6a, 0x25, 0x8f, 0x3b, 0x20, 0xf0,
+          0x79, 0x2b, 0xcf, 0xe5, 0x09, 0x5a, 0x1d, 0x07, 0xb9, 0xcf, 0x83, 0xde, 0x16, 0x98, 0xb7, 0xc4, 0x0c, 0x11, 0xef, 0x91, 0x1b, 0x60, 0x10, 0xd3,
+          0x83, 0x20, 0x08, 0xbd, 0x0a, 0x92, 0x9c, 0xad, 0xb9, 0xaa, 0x81, 0xa9, 0xb1, 0x87, 0xbf, 0x04, 0xbf, 0x34, 0xde, 0x60, 0x5e, 0x24, 0xe7, 0x7e,
+          0x9f, 0xc2, 0x98, 0xca, 0x65, 0x72, 0xd9, 0xe6, 0x0e, 0x8d, 0x41, 0x5a, 0x27, 0x08, 0x18, 0x48, 0x36, 0x67, 0x12, 0x35, 0xc8, 0xf4, 0xb3, 0xfc,
+          0x86, 0x51, 0xc1, 0x14, 0x7c, 0xf8, 0x66, 0xa6, 0xeb, 0xc5, 0xba, 0xa7, 0x2e, 0x5f, 0x44, 0x39, 0x22, 0xad, 0xca, 0xb2, 0x49, 0xc4, 0xdb, 0x1e,
+          0x04, 0x98, 0xe6, 0x03, 0xef, 0x33, 0x7f, 0xcf, 0xa0, 0xb4, 0x3e, 0xd5, 0x94, 0x8a, 0x8a, 0x6f, 0x34, 0x13, 0xff, 0xb3, 0x5b, 0x41, 0x17, 0x8d,
+          0x77, 0x8c, 0x26, 0x1a, 0x6d, 0x4f, 0x08, 0xb1, 0x1b, 0xfd, 0xb2, 0xa9, 0x1e, 0x8c, 0x19, 0x6a, 0x44, 0xd5, 0xb4, 0x26, 0x38, 0x4a, 0xf9, 0xc0,
+          0xd3, 0xb8, 0xa6, 0x4b, 0x25, 0x17, 0xfe, 0x15, 0x01, 0x41, 0x6a, 0x91, 0xf4, 0x11, 0x56, 0xf4, 0x2e, 0xd7, 0xf2, 0xb5, 0x1f, 0x5e, 0x9a, 0xa2,
+          0x49, 0x69, 0xac, 0xa0, 0x68, 0x96, 0x5c, 0x4f, 0xe0, 0x09, 0xbf, 0x4e, 0x54, 0x61, 0x6a, 0x1c, 0x35, 0xfb, 0x06, 0x7c, 0xc2, 0x91, 0x63, 0xb7,
+          0x4c, 0xa3, 0xc0, 0x29, 0x68, 0xba, 0x36, 0x2f, 0x8c, 0x1a, 0xfd, 0x6e, 0x67, 0x9f, 0x47, 0xd5, 0xd4, 0x8c, 0x25, 0xe7, 0x9c, 0xaa, 0x61, 0xf5,
+          0x1c, 0xb7, 0xd6, 0xe6, 0x56, 0xf3, 0xef, 0xec, 0xc4, 0x89, 0x13, 0xa3, 0xa3, 0xd7, 0x33, 0x5f, 0xa0, 0xfd, 0x75, 0x26, 0xe6, 0xa0, 0x4a, 0x35,
+          0x9a, 0xd4, 0x41, 0x9b, 0x30, 0x80, 0x33, 0xb4, 0x34, 0xb7, 0x16, 0xa2, 0x21, 0xa8, 0xbe, 0xe9, 0x09, 0x8f, 0x02, 0x27, 0x2f, 0x1b, 0xa3, 0x67,
+          0x24, 0x68, 0x1d, 0xb0, 0xe7, 0x65, 0x32, 0xd0, 0xad, 0xef, 0x4a, 0x61, 0xeb, 0x1b, 0x13, 0x6a, 0x9c, 0x0c, 0x1c, 0x8a, 0x8f, 0x01, 0x9d, 0x3b,
+          0x86, 0xef, 0x26, 0xa0, 0x3f, 0xd2, 0xb1, 0xff, 0x65, 0x27, 0x02, 0xeb, 0x1f, 0xd3, 0xa0, 0xd3, 0x4a, 0x98, 0x50, 0x82, 0xe1, 0x2c, 0xfe, 0xdc,
+          0xed, 0xe6, 0xe3, 0x6d, 0xff, 0xfe, 0x78, 0x7b, 0xa7, 0x0f, 0x27, 0x59, 0xc5, 0x71, 0xc7, 0x80, 0x08, 0xa8, 0xe9, 0x0e, 0xe4, 0x4f, 0xf8, 0x84,
+          0xa4, 0xd0, 0x88, 0x5e, 0x12, 0xab, 0xe1, 0x90, 0x80, 0x98, 0x08, 0x14, 0x99, 0xdc, 0x02, 0x9f, 0x53, 0x15, 0x5c, 0xc9, 0x8f, 0xad, 0xd4, 0x60,
+          0xef, 0x7f, 0xa3, 0x73, 0x79, 0xc5, 0xdb, 0x57, 0xb2, 0xab, 0x02, 0x97, 0x3a, 0xfc, 0xc9, 0x55, 0xf2, 0x23, 0xa1, 0xf5, 0xcf, 0x1e, 0x71, 0xe2,
+          0x20, 0x7b, 0x7a, 0x7e, 0x20, 0xe3, 0xbd, 0x28, 0xad, 0x5d, 0x88, 0xf2, 0xd8, 0x0f, 0x17, 0xc2, 0xfb, 0x14, 0x89, 0x98, 0x2c, 0xb5, 0xcf, 0x23,
+          0x05, 0x1a, 0xa6, 0xa0, 0x93, 0xac, 0x0f, 0x41, 0xbb, 0x00, 0x62, 0x95, 0x0a, 0xb8, 0x2e, 0xe7, 0x51, 0xd8, 0x05, 0xc9, 0xf6, 0x9e, 0xed, 0xc0,
+          0x66, 0x67, 0x55, 0x42, 0x9d, 0xd2, 0xd4, 0x03, 0x85, 0xa5, 0x54, 0x3a, 0x8d, 0xc4, 0x20, 0x05, 0x7e, 0x5c, 0x86, 0xbd, 0x8c, 0x29, 0xa0, 0x61,
+          0x6d, 0xac, 0x01, 0xed, 0x3b, 0x31, 0x25, 0x86, 0x01, 0xec, 0x68, 0x64, 0xe9, 0x24, 0x07, 0x47, 0xec, 0x11, 0xbd, 0x2d, 0x9a, 0x11, 0xbd, 0xde,
+          0xe2, 0x99, 0xf3, 0xf0, 0x3b, 0xee, 0xb7, 0x43, 0x42, 0x10, 0x28, 0x55, 0xfd, 0x10, 0x0d, 0x67, 0x5c, 0x84, 0xb6, 0xd0, 0x7b, 0x92, 0x53, 0x83,
+          0x94, 0x41, 0xea, 0xb1, 0x71, 0x73, 0x5e, 0x14, 0x17, 0xff, 0x15, 0xc4, 0x09, 0x71, 0x6d, 0x7b, 0x02, 0x22, 0xb7, 0x76, 0x0c, 0xfd, 0x70, 0x08,
+          0x38, 0x91, 0x0e, 0x7c, 0x35, 0x53, 0x18, 0x7e, 0xf3, 0x63, 0xcb, 0xca, 0xb7, 0x29, 0x56, 0x02, 0x29, 0x3c, 0x1a, 0x58, 0xd3, 0x24, 0x45, 0x66,
+          0xdc, 0x64, 0x00, 0x58, 0x26, 0x2e, 0x0b, 0x1d, 0x61, 0x5d, 0xd7, 0x48, 0x6a, 0xe7, 0x58, 0xe6, 0x2d, 0x5f, 0x17, 0xef, 0x1d, 0xf5, 0xd0, 0xc6,
+          0x16, 0x5f, 0x99, 0xed, 0x78, 0xbc, 0xe5, 0x06, 0xf3, 0xe1, 0x11, 0xd3, 0x8f, 0x3a, 0x53, 0x65, 0x64, 0xff, 0xbc, 0x38, 0xc4, 0xd3, 0x6b, 0x8f,
+          0x7d, 0x9c, 0xb2, 0xc0, 0x75, 0x0f, 0xa0, 0x3c, 0xb5, 0x89, 0x53, 0x00, 0x27, 0x26, 0x41, 0xfe, 0x55, 0x9c, 0xc0, 0x1e, 0xf4, 0x86, 0xcc, 0x14,
+          0xb1, 0x7c, 0x42, 0x36, 0xb6, 0xea, 0x38, 0x31, 0xa6, 0x82, 0x14, 0xb4, 0x47, 0x0e, 0xef, 0xcf, 0x16, 0x37, 0x1f, 0x1f, 0x7c, 0xf9, 0xd8, 0xfe,
+          0xc5, 0x60, 0x38, 0x0d, 0x30, 0x68, 0xd5, 0x4f, 0x73, 0xfa, 0x40, 0x9c, 0x3e, 0x68, 0xbd, 0xf3, 0xc7, 0xe3, 0xda, 0xc2, 0xf1, 0xe2, 0x28, 0xfb,
+          0x85, 0xf6, 0x87, 0xae, 0xd3, 0x5d, 0x5f, 0x0c, 0x21, 0xc7, 0x39, 0xdb, 0x8f, 0xa7, 0xdb, 0x7d, 0x94, 0xca, 0xe1, 0x1f, 0x7b, 0x07, 0xa6, 0xba,
+          0xaf, 0xac, 0x91, 0xe6, 0x8b, 0xc2, 0x3d, 0x03, 0xfe, 0xb9, 0x33, 0xf2, 0xb6, 0x16, 0x85, 0x69, 0xc8, 0x55, 0x18, 0xd3, 0xd8, 0x33, 0x08, 0x24,
+          0xf1, 0x75, 0xf4, 0x54, 0x81, 0x3f, 0x6b, 0x70, 0x91, 0xf7, 0xd8, 0x4f, 0x27, 0xf5, 0xd4, 0xc7, 0x41, 0x2d, 0x17, 0xfb, 0x36, 0x4d, 0xee, 0xfc,
+          0xa3, 0x37, 0x8c, 0x11, 0x6b, 0xef, 0x45, 0x0f, 0xd9, 0x7e, 0x77, 0x99, 0xd3, 0x11, 0x7c, 0x76, 0xc0, 0x6b, 0x37, 0x8c, 0x5b, 0xff, 0xed, 0xd0,
+          0xcb, 0xe0, 0xbe, 0x38, 0xee, 0xd0, 0xf3, 0x5d, 0x7a, 0xc3, 0x38, 0x86, 0xee, 0x10, 0x3c, 0x76, 0xc7, 0x65, 0xf6, 0x60, 0xa0, 0xe6, 0xeb, 0xb7,
+          0xb0, 0xe0, 0x8b, 0x40, 0xab, 0xbf, 0x5e, 0x4b, 0xa2, 0x92, 0x4b, 0xf4, 0x91, 0xf0, 0x6b, 0x17, 0x10, 0x47, 0x66, 0x1f, 0x33, 0x76, 0xa2, 0x34,
+          0x55, 0xad, 0x3e, 0x8f, 0x8e, 0xd7, 0x9f, 0xc0, 0xbe, 0x0e, 0xce, 0x2e, 0xa0, 0xc4, 0x09, 0x75, 0x6f, 0x5d, 0xe3, 0xb7, 0x8b, 0x17, 0xce, 0x7e,
+          0xcc, 0x64, 0x8d, 0x3d, 0x3b, 0x13, 0xda, 0xe6, 0xf1, 0x47, 0xa2, 0xd9, 0xa4, 0x75, 0x09, 0xa2, 0x51, 0x13, 0x4d, 0xe4, 0x42, 0xa1, 0xba, 0x88,
+          0xe1, 0xbe, 0x71, 0x0a, 0xa3, 0x60, 0x16, 0x43, 0x77, 0x08, 0x1e, 0xba, 0xe3, 0xb2, 0x0b, 0x77, 0x73, 0xa1, 0xd5, 0xd1, 0xef, 0xf4, 0x1d, 0xea,
+          0xfa, 0xdb, 0x5e, 0x77, 0xed, 0x8e, 0xb7, 0xb8, 0x7f, 0xe3, 0x15, 0x7e, 0xe2, 0x35, 0x72, 0x1f, 0xbd, 0x03, 0x66, 0xfe, 0xfe, 0xc2, 0xa1, 0x43,
+          0xc0, 0x17, 0x20, 0x0d, 0x02, 0x86, 0xa8, 0x6e, 0x75, 0x84, 0xde, 0x27, 0x6d, 0x27, 0x4b, 0x8c, 0x7f, 0xf8, 0x7e, 0xf1, 0x5c, 0x5e, 0x88, 0x84,
+          0xf8, 0x07, 0x5c, 0xa7, 0xb7, 0x1d, 0xc8, 0x1e, 0x7f, 0x60, 0x45, 0x96, 0x20, 0x7f, 0xe0, 0x85, 0x66, 0xe6, 0x05, 0xa1, 0x9e, 0x0b, 0x9c, 0x39,
+          0xbd, 0xa8, 0x88, 0x78, 0xc7, 0xf7, 0xd8, 0x1d, 0x72, 0x0d, 0xe5, 0x06, 0xee, 0x08, 0x20, 0xce, 0x87, 0xa4, 0xc3, 0x9e, 0x4e, 0x0e, 0x8d, 0x2b,
+          0x8c, 0xd5, 0xe5, 0xc7, 0xfb, 0x20, 0xd7, 0x06, 0xc9, 0x3d, 0x33, 0x34, 0x6a, 0x74, 0xbc, 0x86, 0x33, 0x65, 0x8e, 0x4b, 0xe2, 0xa5, 0xc4, 0x86,
+          0xa9, 0x5f, 0xb1, 0xc4, 0xdf, 0xf3, 0x7c, 0x63, 0x1a, 0x7c, 0x8d, 0x64, 0x1d, 0x6f, 0xdf, 0x26, 0x10, 0xf0, 0x88, 0xcf, 0x47, 0x40, 0x8f, 0xbc,
+          0x31, 0x67, 0x89, 0x60, 0x84, 0xbd, 0x9f, 0xf4, 0x49, 0xa3, 0xe3, 0xed, 0x2b, 0x48, 0xf7, 0xa6, 0x93, 0x17, 0x0d, 0x48, 0x74, 0xa0, 0x61, 0x94,
+          0xcd, 0x0e, 0x96, 0xfd, 0x2b, 0xa7, 0x6f, 0x00, 0x74, 0xb0, 0xe0, 0x0d, 0x43, 0x74, 0x3e, 0x75, 0x53, 0xd8, 0xd8, 0xff, 0xdd, 0x7d, 0x37, 0xa4,
+          0x47, 0x2d, 0x34, 0xdc, 0x21, 0x7f, 0xa6, 0xc7, 0xf7, 0x4b, 0xb2, 0x28, 0x3b, 0x06, 0x04, 0x1a, 0x92, 0x2b, 0x3c, 0xe1, 0x03, 0xce, 0x1a, 0x12,
+          0x27, 0x71, 0xdb, 0x90, 0x94, 0x76, 0xe0, 0x20, 0xd4, 0x7d, 0x77, 0xbe, 0xfd, 0x65, 0x1b, 0x93, 0x94, 0xd0, 0x32, 0x04, 0xde, 0x3e, 0xa6, 0xbc,
+          0x91, 0xbd, 0xbb, 0xf4, 0x38, 0x8d, 0xf4, 0x2d, 0x4c, 0xd9, 0x98, 0x2c, 0xa7, 0xc1, 0x7d, 0x38, 0x6a, 0x1a, 0xf3, 0x4f, 0x32, 0x31, 0x9f, 0x31,
+          0x94, 0xf0, 0x70, 0xa1, 0x13, 0xde, 0x3b, 0xa6, 0xa8, 0x5d, 0xaf, 0x0d, 0xaf, 0xa6, 0x1a, 0x45, 0x76, 0xdd, 0xf7, 0x63, 0xd2, 0x53, 0xd3, 0x86,
+          0xaf, 0x0d, 0x9a, 0x53, 0x67, 0x2e, 0x21, 0xf9, 0x07, 0xb1, 0x99, 0xd4, 0x19, 0x43, 0xdf, 0x45, 0xdc, 0x84, 0xdf, 0x20, 0x2d, 0x10, 0x6f, 0x58,
+          0xe8, 0x63, 0xe2, 0x10, 0xb7, 0x5c, 0xf4, 0xc6, 0x0d, 0x60, 0x81, 0x91, 0x18, 0x49, 0x50, 0xee, 0x4a, 0x9c, 0x52, 0x54, 0xf2, 0x66, 0x86, 0x99,
+          0x9a, 0x85, 0xd9, 0x04, 0x2b, 0x23, 0xfb, 0x12, 0x9d, 0x7a, 0x04, 0x87, 0xc4, 0xa7, 0x9d, 0x9c, 0x6f, 0xdb, 0x96, 0x20, 0x09, 0x22, 0x17, 0x50,
+          0x40, 0xfb, 0xc9, 0x6a, 0x69, 0x0b, 0xfd, 0xe3, 0x6d, 0x56, 0xca, 0x2c, 0xb2, 0x13, 0x33, 0x08, 0x3c, 0x04, 0x63, 0x7f, 0x48, 0x3b, 0xaa, 0xf2,
+          0x42, 0xd1, 0x13, 0xd9, 0xcf, 0x05, 0x50, 0x2a, 0x0c, 0xe7, 0x2a, 0x82, 0xed, 0x7a, 0x4c, 0x48, 0x9f, 0x5a, 0x63, 0xa9, 0x99, 0x84, 0xd6, 0x4b,
+          0xf3, 0x3b, 0x65, 0xb9, 0x99, 0x2b, 0x0c, 0x20, 0xf1, 0x82, 0x90, 0xd1, 0x97, 0x0e, 0xa8, 0x8c, 0x62, 0x79, 0x2b, 0x7f, 0x8e, 0xbe, 0x35, 0x07,
+          0x95, 0x2a, 0x36, 0xe7, 0x00, 0x94, 0x6d, 0x7e, 0x2f, 0x7f, 0x79, 0x97, 0x15, 0xb0, 0xca, 0x92, 0x3a, 0xef, 0x1b, 0x87, 0x33, 0x62, 0xa3, 0x4f,
+          0x3a, 0xa7, 0x93, 0x1a, 0x76, 0x49, 0xa7, 0x05, 0x58, 0x59, 0x08, 0x83, 0xce, 0x6d, 0x11, 0x9a, 0x81, 0xea, 0x69, 0x96, 0x47, 0xfd, 0xf4, 0xbc,
+          0x5d, 0x0a, 0xda, 0xb5, 0x0e, 0x7a, 0xe9, 0xcf, 0xd6, 0xe8, 0x26, 0xdd, 0x16, 0x13, 0x54, 0x67, 0x9c, 0x90, 0xf8, 0x3b, 0xc8, 0x61, 0xee, 0xeb,
+          0x6c, 0x83, 0x56, 0x40, 0x7d, 0x7f, 0x69, 0xb7, 0x96, 0x4a, 0x07, 0xc3, 0x5d, 0x47, 0x8a, 0x9a, 0xc0, 0x5f, 0xa3, 0xee, 0x1a, 0xd8, 0x5a, 0xeb,
+          0x4c, 0x5e, 0xbc, 0xc8, 0x61, 0xb3, 0x09, 0xdd, 0x00, 0x90, 0xf7, 0xe8, 0xef, 0xd4, 0x47, 0xbe, 0x90, 0xbb, 0x10, 0xc6, 0x16, 0xb9, 0x0d, 0x8d,
+          0xaa, 0x7e, 0xc6, 0xd0, 0xb2, 0x30, 0xd8, 0x6d, 0x04, 0x04, 0x3d, 0xf7, 0xdd, 0x8e, 0x65, 0xcc, 0x6e, 0x08, 0x88, 0xd7, 0x6f, 0x35, 0xd6, 0x45,
+          0x10, 0x09, 0x2e, 0xf7, 0xa5, 0xd2, 0x17, 0x3f, 0x3b, 0xba, 0x70, 0xe8, 0x72, 0x5d, 0x1a, 0x1b, 0x85, 0x4f, 0x5f, 0xb6, 0x02, 0xa8, 0x3b, 0x9e,
+          0x05, 0x51, 0x9a, 0x86, 0x7d, 0x1d, 0xe6, 0xb1, 0x29, 0xba, 0x32, 0xbd, 0x32, 0x5d, 0x68, 0x97, 0xc3, 0xe2, 0xa0, 0x3c, 0xef, 0x0a, 0x4c, 0x2a,
+          0x78, 0xec, 0xe0, 0xc8, 0x97, 0x72, 0xbe, 0x53, 0x68, 0x9b, 0x73, 0xa5, 0xb9, 0xad, 0xec, 0x02, 0x87, 0xb9, 0x6d, 0x98, 0xd3, 0xca, 0x24, 0x1b,
+          0xb3, 0xa4, 0xc8, 0x0a, 0x7b, 0x16, 0xe6, 0xa7, 0x71, 0x9d, 0x53, 0x33, 0x57, 0xe0, 0x19, 0xec, 0x71, 0xe1, 0x79, 0x48, 0x0f, 0x70, 0x5f, 0x14,
+          0x70, 0xdf, 0x63, 0x81, 0xbd, 0x9b, 0x5a, 0x8f, 0x9d, 0xe0, 0xa8, 0x7d, 0x91, 0x80, 0xf4, 0xad, 0x57, 0x2b, 0xfb, 0x22, 0x96, 0xba, 0x47, 0x00,
+          0xd0, 0x96, 0x2c, 0x6a, 0x2d, 0x05, 0x74, 0xb8, 0xcf, 0x5d, 0xbd, 0x62, 0x6e, 0x1a, 0xd4, 0xed, 0x5d, 0xe8, 0x40, 0x46, 0xb7, 0xfc, 0x76, 0x9b,
+          0x96, 0xee, 0xb2, 0xab, 0xa3, 0xcf, 0x48, 0x6c, 0xa2, 0xb7, 0xc7, 0x1d, 0x85, 0x5d, 0x34, 0xf6, 0xa2, 0x73, 0x3e, 0x6d, 0xdf, 0x73, 0x13, 0x3a,
+          0x19, 0x04, 0x41, 0xd0, 0xed, 0x91, 0x62, 0x7f, 0x76, 0xe0, 0x5e, 0x43, 0x0f, 0x92, 0x88, 0x73, 0x1b, 0xaa, 0xb7, 0x76, 0x49, 0xfb, 0xf0, 0xb5,
+          0xca, 0x26, 0x5d, 0x8c, 0xba, 0xe7, 0x29, 0x58, 0xdb, 0xac, 0x8f, 0x82, 0x2d, 0x92, 0x05, 0xa1, 0x03, 0x76, 0x67, 0xcb, 0xdc, 0x2f, 0x4c, 0x1b,
+          0xe4, 0xfe, 0x38, 0x0a, 0x8f, 0xfd, 0x7c, 0x17, 0xad, 0x11, 0x26, 0x35, 0xbd, 0x65, 0x02, 0xf3, 0x89, 0x6d, 0x14, 0x52, 0xc7, 0xad, 0x75, 0x3b,
+          0x75, 0x3a, 0xd8, 0x8b, 0x30, 0x4c, 0x97, 0x55, 0x3a, 0xab, 0xf6, 0xf1, 0x8f, 0x07, 0xea, 0xd0, 0x7d, 0xf6, 0xbd, 0xa4, 0x0c, 0x13, 0x97, 0x41,
+          0x01, 0x3a, 0xda, 0x2b, 0x27, 0xc2, 0x6c, 0x48, 0xf9, 0x02, 0x72, 0xbe, 0xcd, 0x62, 0x7e, 0x7c, 0xbd, 0x31, 0xb8, 0x95, 0x29, 0x89, 0xb8, 0x5b,
+          0x3b, 0x1a, 0x0d, 0xa3, 0x97, 0x38, 0x15, 0x4f, 0xa5, 0xd5, 0xd6, 0x98, 0x34, 0xca, 0x75, 0x01, 0x89, 0x0a, 0xa5, 0x68, 0xaa, 0x10, 0x37, 0x6e,
+          0x3a, 0xc9, 0x24, 0xc1, 0x6c, 0x33, 0x7a, 0x57, 0x11, 0xa6, 0xc3, 0x00, 0xc9, 0x28, 0x84, 0x09, 0x98, 0x38, 0xa5, 0x47, 0x14, 0x5b, 0x78, 0xd6,
+          0x44, 0x93, 0xb3, 0x7e, 0xf6, 0x99, 0x07, 0x49, 0xaf, 0x63, 0xe9, 0x10, 0x75, 0x8d, 0xf1, 0x26, 0x68, 0xad, 0xb7, 0x8f, 0x37, 0xa5, 0xf2, 0x24,
+          0xc6, 0xfb, 0x9a, 0xdb, 0xd9, 0x48, 0x40, 0x1d, 0xa7, 0x53, 0xb2, 0x76, 0x16, 0x96, 0xb0, 0xbc, 0x77, 0x9d, 0xee, 0x2b, 0x58, 0xf0, 0xb9, 0x70,
+          0xa6, 0x27, 0x58, 0x4e, 0x07, 0x21, 0x17, 0x98, 0x6f, 0x39, 0xe8, 0xa2, 0x35, 0xbc, 0x54, 0x71, 0x97, 0x8e, 0xe2, 0x51, 0x8b, 0x5a, 0x6d, 0xa6,
+          0xad, 0x56, 0x04, 0x53, 0xbd, 0x7d, 0xb5, 0x16, 0x9f, 0x75, 0xef, 0x50, 0x89, 0xde, 0x88, 0x84, 0x2d, 0x8e, 0x13, 0x6c, 0xaa, 0xb2, 0x59, 0xc8,
+          0x15, 0x12, 0x92, 0xf6, 0x8d, 0x33, 0x37, 0x03, 0x8e, 0x45, 0x90, 0x96, 0x65, 0xbc, 0x9d, 0x52, 0x8d, 0x54, 0xbb, 0xb2, 0x16, 0x67, 0x6d, 0xb8,
+          0x9f, 0xe5, 0x6d, 0xa4, 0x9a, 0x6a, 0xf6, 0xf7, 0xcc, 0x45, 0x8c, 0xd5, 0xa9, 0x6d, 0x59, 0xc8, 0xd7, 0x17, 0xbb, 0x9b, 0x94, 0xc0, 0x4e, 0xcb,
+          0x9f, 0xff, 0x08, 0x8c, 0x28, 0x3d, 0xb5, 0x84, 0x70, 0xde, 0xd9, 0x87, 0x3e, 0xab, 0xaa, 0x00, 0xee, 0x5a, 0xad, 0xff, 0x8a, 0x92, 0x35, 0x48,
+          0x36, 0x38, 0x1d, 0x55, 0xae, 0xc1, 0xdd, 0x10, 0x08, 0xe2, 0xda, 0xa7, 0x68, 0x11, 0xf0, 0x93, 0x23, 0x4d, 0x37, 0xb2, 0xa1, 0xda, 0x58, 0xe7,
+          0xd5, 0xdf, 0xbf, 0x9f, 0xeb, 0x0f, 0xf2, 0xd8, 0xb3, 0x4f, 0x7d, 0xaf, 0x55, 0x1f, 0x6d, 0xee, 0x2c, 0x2f, 0x00, 0x99, 0xf1, 0x21, 0x09, 0x09,
+          0x49, 0x38, 0xe7, 0x79, 0x69, 0x7f, 0x95, 0x5d, 0x39, 0x83, 0x1c, 0x86, 0x33, 0x98, 0x04, 0x78, 0xe2, 0x3b, 0xb1, 0xca, 0xe9, 0x8b, 0x2d, 0xfa,
+          0x67, 0x8a, 0x34, 0x9f, 0x30, 0x4d, 0x07, 0x8f, 0x96, 0xe1, 0x92, 0x0d, 0x98, 0xc3, 0xe7, 0x0a, 0xb3, 0xc7, 0x9d, 0xfa, 0x92, 0x88, 0xe5, 0x7c,
+          0x1d, 0xf1, 0x1b, 0x4c, 0x4f, 0xe9, 0x1a, 0x91, 0x92, 0xb0, 0xe2, 0xd7, 0x25, 0x40, 0xf4, 0xdf, 0x82, 0x46, 0x90, 0x39, 0x53, 0xec, 0x16, 0xa6,
+          0xa2, 0x8e, 0xb6, 0x59, 0x65, 0xd7, 0x33, 0x46, 0x7e, 0xe7, 0xae, 0xa8, 0x70, 0x28, 0x91, 0xec, 0x40, 0x8a, 0x74, 0x13, 0xcf, 0x6c, 0x40, 0xd7,
+          0x8f, 0xbe, 0x38, 0xdf, 0x9a, 0xbe, 0xd1, 0xa7, 0x48, 0xfc, 0xc5, 0x54, 0x90, 0xfe, 0xd5, 0xa0, 0x20, 0xab, 0x6b, 0x4c, 0xf8, 0xff, 0x5a, 0x00,
+          0x99, 0x8a, 0x6a, 0x82, 0x5a, 0xaf, 0x17, 0x3d, 0x42, 0xdd, 0x79, 0x84, 0x1f, 0x91, 0xa7, 0x8b, 0xdb, 0xbe, 0x8c, 0xe8, 0x24, 0x94, 0xf1, 0x41,
+          0x37, 0xd7, 0x1c, 0xb1, 0x03, 0x88, 0xd3, 0xd3, 0x89, 0x3a, 0xbb, 0x97, 0xe9, 0xe8, 0x43, 0x9d, 0x9a, 0x82, 0x12, 0x17, 0x52, 0x4e, 0x3f, 0x62,
+          0xd6, 0x00, 0x48, 0xfe, 0x8d, 0x45, 0x73, 0x33, 0x50, 0xc4, 0xc8, 0xac, 0xe2, 0xf3, 0x64, 0x73, 0x31, 0x17, 0x00, 0xd1, 0x45, 0x88, 0x7f, 0x2a,
+          0x16, 0x04, 0xa0, 0x21, 0x81, 0x50, 0x42, 0xce, 0x34, 0xad, 0x27, 0x8c, 0xe4, 0xd2, 0x3c, 0xda, 0x9f, 0x29, 0x51, 0x65, 0x6c, 0x3f, 0x26, 0xfe,
+          0x98, 0x8e, 0x2a, 0x0f, 0x32, 0x7d, 0xae, 0x9c, 0xc3, 0x5b, 0x1e, 0x77, 0x03, 0xaa, 0xd4, 0xd0, 0x44, 0xb7, 0x3e, 0x49, 0x4b, 0x16, 0x61, 0x6a,
+          0x71, 0x39, 0xf8, 0x0d, 0x46, 0xd8, 0xab, 0x17, 0x14, 0x0e, 0x67, 0x1b, 0x82, 0x25, 0x1d, 0x79, 0xfb, 0x75, 0x73, 0x61, 0x68, 0xe0, 0x02, 0x43,
+          0x3c, 0xe8, 0x19, 0xb7, 0x03, 0xab, 0x1e, 0x5b, 0xc2, 0x9a, 0x53, 0xaf, 0x26, 0x02, 0x08, 0x17, 0x44, 0x99, 0x57, 0x3b, 0xc9, 0xc2, 0x22, 0x35,
+          0xae, 0x73, 0x79, 0x9c, 0xc4, 0x67, 0x13, 0x55, 0x40, 0x44, 0x64, 0x95, 0x7a, 0xb8, 0xd9, 0xdb, 0x82, 0xf9, 0xa0, 0x03, 0x15, 0xe2, 0x13, 0x0d,
+          0x66, 0xec, 0xdf, 0xf9, 0x87, 0xcd, 0xc2, 0x15, 0x2f, 0x63, 0x10, 0xeb, 0xd5, 0x51, 0xd0, 0x68, 0xfa, 0x66, 0x07, 0x43, 0x73, 0x68, 0xaa, 0x52,
+          0xbf, 0xe9, 0x90, 0x0d, 0xc6, 0xb8, 0x16, 0xc4, 0xae, 0x48, 0x5e, 0x78, 0xb9, 0x51, 0x60, 0x21, 0xdc, 0x47, 0x4f, 0x6d, 0x03, 0x9d, 0xd0, 0x62,
+          0x63, 0x55, 0x76, 0x6f, 0xa6, 0x64, 0x46, 0x6e, 0x76, 0xf6, 0x16, 0xd7, 0x66, 0xb2, 0xc1, 0x98, 0x68, 0x42, 0x1e, 0xbd, 0xcc, 0xb0, 0x95, 0xbb,
+          0x3d, 0x01, 0x2a, 0x24, 0x85, 0xc4, 0x07, 0x7b, 0x78, 0xec, 0x39, 0x3b, 0xfe, 0xac, 0x15, 0x35, 0x6b, 0x69, 0x8b, 0xb9, 0xc2, 0x58, 0x18, 0x2e,
+          0x72, 0x3e, 0x2e, 0x5a, 0x90, 0x36, 0x77, 0xfd, 0x66, 0xcb, 0x5b, 0x1a, 0x31, 0x30, 0x26, 0xd5, 0xc7, 0xa1, 0xae, 0x2f, 0xbf, 0xb0, 0xa1, 0x19,
+          0xf5, 0xb7, 0x71, 0x45, 0x22, 0x6e, 0xc6, 0x26, 0x40, 0x56, 0x6d, 0x1d, 0x56, 0xc5, 0xb9, 0x55, 0xbd, 0x05, 0x14, 0x54, 0x21, 0x6c, 0x9a, 0x52,
+          0x64, 0x75, 0x88, 0xe1, 0x55, 0x3c, 0x9a, 0xf7, 0x8f, 0x48, 0x43, 0x29, 0xed, 0xb7, 0xe0, 0x81, 0xe1, 0x1e, 0xe3, 0x75, 0xfd, 0xd8, 0xdd, 0x68,
+          0x10, 0x16, 0xf7, 0xdd, 0xac, 0xbb, 0x2f, 0xb5, 0xb1, 0x49, 0x91, 0x9f, 0x98, 0x19, 0xda, 0x96, 0xe1, 0x5d, 0x9a, 0x02, 0x9b, 0x3c, 0x61, 0xcf,
+          0x4a, 0x16, 0x68, 0x31, 0x32, 0xc2, 0x21, 0x86, 0x34, 0xfe, 0x33, 0x1c, 0x3f, 0xe8, 0x81, 0x2d, 0xd0, 0x35, 0x0d, 0x29, 0x63, 0xca, 0x2a, 0x72,
+          0x96, 0x9d, 0x47, 0x01, 0x68, 0x9d, 0xa4, 0xa0, 0xdd, 0x27, 0x8d, 0x1a, 0xeb, 0xd6, 0x46, 0x52, 0xd4, 0x4d, 0xb9, 0x28, 0x32, 0x8d, 0x09, 0x6b,
+          0x3f, 0x7f, 0xb9, 0x1a, 0x48, 0x0b, 0xbf, 0x33, 0xbd, 0x53, 0xd8, 0x5c, 0x5f, 0xa0, 0x22, 0xa7, 0xf1, 0xc5, 0xa2, 0xee, 0x6e, 0x0a, 0x2d, 0x46,
+          0x5b, 0x06, 0x39, 0xb3, 0xbd, 0x1c, 0xda, 0x4c, 0x48, 0x6b, 0xa4, 0xf8, 0xc5, 0x41, 0xe0, 0xf4, 0xf8, 0xba, 0xfc, 0x19, 0xd1, 0x6c, 0x80, 0x18,
+          0xbf, 0x11, 0xe2, 0x9d, 0xcf, 0x8c, 0x28, 0x38, 0xe2, 0xa5, 0x50, 0x7b, 0x6a, 0xff, 0xd5, 0x95, 0x01, 0xbd, 0x35, 0x70, 0xdd, 0x2d, 0x76, 0x2c,
+          0xda, 0xe6, 0xa8, 0x3a, 0x6e, 0x39, 0x52, 0x9f, 0xcd, 0x84, 0x2b, 0x90, 0xb7, 0x1f, 0xe6, 0x0c, 0x7c, 0xb4, 0x61, 0xb3, 0xb0, 0xe9, 0x4d, 0x1c,
+          0x40, 0xee, 0xae, 0xb1, 0x73, 0x8c, 0x3c, 0x8f, 0x1f, 0x94, 0x2b, 0x61, 0xe6, 0xb2, 0x03, 0x8d, 0x1c, 0xbf, 0xc5, 0x08, 0x09, 0x49, 0xe2, 0x51,
+          0x17, 0x22, 0x61, 0xfe, 0x52, 0xf3, 0x41, 0x52, 0x58, 0xa4, 0xf9, 0x39, 0x0a, 0x9b, 0xf0, 0xea, 0x8b, 0x02, 0x0c, 0x13, 0x0f, 0xd8, 0x07, 0x92,
+          0xc2, 0x40, 0x55, 0x05, 0x91, 0x94, 0x62, 0x3a, 0x7e, 0x6e, 0xf1, 0xca, 0x4c, 0xb2, 0x15, 0x93, 0x8d, 0x63, 0x58, 0x15, 0x48, 0x10, 0xe0, 0x01,
+          0x81, 0x25, 0x63, 0x53, 0x0e, 0xa5, 0x0d, 0x04, 0xad, 0xa8, 0x4a, 0x1b, 0x4b, 0xd1, 0x53, 0xc6, 0xde, 0x51, 0xfd, 0xda, 0x80, 0xf5, 0xbc, 0xbb,
+          0x39, 0x28, 0xa8, 0xeb, 0x6e, 0x86, 0xb8, 0x54, 0x5a, 0x02, 0x50, 0x75, 0x83, 0xda, 0xe2, 0x65, 0xfb, 0xa1, 0x2c, 0x83, 0x33, 0x1f, 0xda, 0x8b,
+          0xe6, 0x62, 0x46, 0xb2, 0x07, 0x34, 0x55, 0x7a, 0xb8, 0x28, 0x4c, 0xa7, 0x94, 0xa5, 0xa0, 0xb3, 0x68, 0x92, 0x15, 0x0b, 0x20, 0xe9, 0x21, 0x95,
+          0x45, 0xd3, 0x33, 0x9a, 0xcd, 0xcf, 0x75, 0x35, 0x1a, 0x7a, 0x88, 0xf9, 0xfc, 0x10, 0x15, 0x3f, 0xd2, 0x4b, 0x88, 0xe0, 0x57, 0x2b, 0x3c, 0xd2,
+          0x4b, 0xc3, 0x74, 0x16, 0x0c, 0x12, 0x8f, 0xa6, 0x07, 0x66, 0xf0, 0x23, 0x20, 0xf5, 0x5b, 0x86, 0xce, 0x73, 0x59, 0x22, 0x93, 0x4f, 0x2e, 0xef,
+          0x57, 0x80, 0x89, 0x84, 0xd9, 0x0f, 0xd3, 0x3f, 0xd8, 0x37, 0x22, 0x04, 0x62, 0x7d, 0xa4, 0x57, 0xb0, 0x7e, 0x24, 0x3b, 0xdb, 0x25, 0xb2, 0x30,
+          0x81, 0x70, 0x41, 0xfa, 0xb9, 0x1c, 0xbc, 0xb3, 0xdf, 0xd1, 0xc1, 0x3a, 0xc3, 0x01, 0x15, 0xc2, 0x04, 0x84, 0x14, 0xcb, 0x70, 0x69, 0xb6, 0x7a,
+          0xe6, 0x35, 0x81, 0x25, 0xcd, 0x11, 0xb1, 0x7d, 0x77, 0x56, 0xba, 0xac, 0x8d, 0xc7, 0xae, 0x18, 0x6e, 0xfc, 0xae, 0x9c, 0x24, 0xf4, 0xe7, 0x83,
+          0xba, 0x24, 0xf4, 0xf1, 0xc1, 0x54, 0xd3, 0xc7, 0x84, 0x11, 0x7d, 0x18, 0x60, 0x31, 0x81, 0x44, 0xdb, 0x19, 0xfa, 0x63, 0x11, 0xee, 0x5f, 0xb2,
+          0xb2, 0xa5, 0x3c, 0x5a, 0xfd, 0x1a, 0x1c, 0x36, 0x05, 0xf6, 0xb0, 0x74, 0xc8, 0xe0, 0xb8, 0x2e, 0xc0, 0x9a, 0x47, 0x4c, 0x74, 0xf2, 0xbc, 0xde,
+          0x50, 0x85, 0x7e, 0x8d, 0x5a, 0xf6, 0x88, 0x87, 0x9e, 0x7b, 0xb1, 0x8e, 0xf0, 0x09, 0xc3, 0xfd, 0x89, 0x95, 0xf7, 0x7f, 0x9d, 0x7f, 0xaf, 0x2b,
+          0x28, 0x4d, 0x0a, 0xce, 0x41, 0xe4, 0x24, 0xdd, 0x1c, 0x44, 0xc5, 0xa1, 0x09, 0x31, 0x4e, 0x10, 0x2d, 0x03, 0x4b, 0x48, 0xa8, 0x4b, 0x7e, 0xd8,
+          0xf5, 0x23, 0xb4, 0xe7, 0x90, 0xa3, 0x0a, 0xd4, 0x61, 0x0d, 0xd0, 0x88, 0xb8, 0x76, 0x22, 0xf4, 0xc3, 0x21, 0x91, 0xcd, 0x4a, 0xd3, 0xc0, 0x67,
+          0xa4, 0x90, 0xee, 0x86, 0x6b, 0x06, 0x72, 0x25, 0x10, 0xe7, 0xa1, 0x5d, 0x95, 0xb1, 0xfc, 0x4d, 0x85, 0x01, 0xbf, 0x2f, 0xd3, 0x55, 0xe3, 0xe4,
+          0xcd, 0xc1, 0xf5, 0x83, 0x33, 0x55, 0x26, 0x21, 0x7d, 0x00, 0xee, 0x9f, 0x70, 0x33, 0x39, 0x90, 0xbf, 0x48, 0x07, 0x38, 0xff, 0x4b, 0xf0, 0xb1,
+          0x4d, 0xbb, 0xe8, 0x32, 0xf7, 0xcb, 0x2d, 0x19, 0x93, 0x1e, 0x40, 0x8e, 0x55, 0x5b, 0x3f, 0x39, 0x97, 0x6d, 0xd5, 0xf1, 0x55, 0x26, 0xe8, 0x07,
+          0x95, 0x9f, 0xb4, 0xef, 0xb5, 0xe7, 0x69, 0x6c, 0x9d, 0x96, 0x21, 0xe9, 0xc6, 0xe4, 0x11, 0xf8, 0x15, 0xc1, 0x99, 0xd9, 0x59, 0xb9, 0xf2, 0x5f,
+          0xd0, 0x3d, 0x87, 0xcc, 0x58, 0x6e, 0x61, 0xb2, 0x1a, 0x98, 0x26, 0x0f, 0x27, 0x6a, 0xa2, 0xd2, 0xaf, 0x79, 0x72, 0xca, 0x1e, 0x21, 0x2c, 0x9f,
+          0x81, 0x6c, 0x67, 0x28, 0x58, 0xb4, 0x4d, 0x0f, 0x22, 0x19, 0xd6, 0x98, 0x69, 0x0e, 0x80, 0xf3, 0xdc, 0xf8, 0xc9, 0xcf, 0x71, 0xf0, 0x79, 0x2e,
+          0xf2, 0x4c, 0xf7, 0x22, 0x77, 0x5c, 0x01, 0x79, 0x2e, 0x26, 0x67, 0xb2, 0xd3, 0xa6, 0xcf, 0x31, 0xae, 0x9a, 0x70, 0xd3, 0x4b, 0x0a, 0xeb, 0x40,
+          0x3d, 0x7e, 0x94, 0x29, 0xfa, 0xf4, 0x19, 0x47, 0x50, 0x15, 0x30, 0x9c, 0xce, 0x78, 0xd4, 0x53, 0x2b, 0xe7, 0x35, 0x18, 0xc0, 0x38, 0x99, 0xba,
+          0x89, 0xe8, 0x0e, 0xd8, 0xe4, 0xe2, 0x01, 0x0a, 0xde, 0xf1, 0x39, 0x00, 0x2a, 0x12, 0x2e, 0x4c, 0x90, 0xa8, 0x0e, 0x2a, 0x45, 0x0b, 0xc0, 0xf6,
+          0x6d, 0xe2, 0xf6, 0x4c, 0x96, 0x6f, 0x2e, 0x4d, 0x06, 0xcc, 0x26, 0xd3, 0x1c, 0x10, 0xde, 0x01, 0xb9, 0x02, 0x0b, 0xbf, 0xe5, 0x62, 0x6b, 0x8d,
+          0xe3, 0x2a, 0x3d, 0x40, 0x4e, 0x57, 0xef, 0x9c, 0xb9, 0x72, 0xc2, 0x6f, 0xcf, 0xd8, 0xc4, 0x95, 0x23, 0x66, 0x2b, 0xf4, 0xb0, 0x1d, 0x72, 0x63,
+          0x86, 0x2d, 0xe8, 0x60, 0x98, 0xcd, 0x75, 0xdc, 0x7a, 0xb9, 0x83, 0xa5, 0xa7, 0xa4, 0x8d, 0x61, 0x28, 0xa1, 0x5e, 0xac, 0x9d, 0xd8, 0x96, 0x5e,
+          0x8b, 0x74, 0x37, 0x69, 0xd0, 0x9f, 0x68, 0x6e, 0xc3, 0xbe, 0x8f, 0xc3, 0x06, 0xed, 0x5e, 0x5a, 0x17, 0xa8, 0x5e, 0xb9, 0x1a, 0x89, 0x07, 0x6b,
+          0x98, 0xee, 0x66, 0x68, 0x3d, 0x9c, 0x06, 0x56, 0x0d, 0xa6, 0x26, 0x6d, 0xb5, 0xc3, 0x18, 0x6f, 0x3b, 0xfe, 0xbc, 0xe0, 0xf5, 0x6a, 0x39, 0x8b,
+          0x0a, 0x9b, 0x66, 0xa9, 0x27, 0x79, 0xaf, 0x97, 0xdb, 0xcb, 0x64, 0x92, 0x2a, 0xd9, 0xe4, 0x54, 0x71, 0xe8, 0x70, 0xd5, 0x84, 0xb7, 0x38, 0x6e,
+          0x1e, 0x0a, 0x31, 0x5c, 0x64, 0x55, 0xa0, 0x44, 0x15, 0xfa, 0xb2, 0x39, 0x62, 0xd8, 0x05, 0x13, 0x3f, 0xc6, 0x0c, 0x0c, 0x4b, 0x1a, 0x79, 0x2e,
+          0xe4, 0x37, 0x1b, 0x8f, 0x31, 0xe3, 0x0b, 0xa9, 0x49, 0xe8, 0xd6, 0x8a, 0x13, 0xa3, 0x0b, 0xb7, 0x33, 0x6d, 0xab, 0xc7, 0x98, 0x2a, 0x6a, 0x39,
+          0x71, 0xaa, 0x6a, 0xc1, 0x13, 0xa8, 0xcf, 0x6b, 0x97, 0x74, 0x42, 0xc3, 0xf9, 0xcc, 0x81, 0x15, 0x70, 0x7a, 0xef, 0xca, 0xff, 0x15, 0xf5, 0x62,
+          0x57, 0x1e, 0x4d, 0x87, 0xde, 0x78, 0xc9, 0xc0, 0x13, 0xae, 0xd3, 0x00, 0x08, 0xb3, 0x02, 0xe2, 0xe5, 0xd1, 0x1b, 0x01, 0x97, 0x62, 0xe1, 0x9f,
+          0x26, 0x09, 0x9b, 0xe3, 0xf4, 0xd8, 0x76, 0x4b, 0x56, 0x1b, 0xc5, 0xb3, 0x52, 0x4a, 0x87, 0xc3, 0x56, 0x08, 0x0c, 0x88, 0x0c, 0x56, 0x31, 0x10,
+          0x05, 0xd1, 0x8f, 0xb9, 0xe6, 0x92, 0x95, 0x14, 0x65, 0xc2, 0x2f, 0xf2, 0x88, 0xee, 0x3a, 0x34, 0x22, 0x66, 0x3e, 0x41, 0xa0, 0xf0, 0xbd, 0x40,
+          0x6c, 0x41, 0x66, 0x55, 0x7d, 0xc4, 0x86, 0x66, 0x9b, 0x07, 0xd9, 0xbc, 0x98, 0xa2, 0x52, 0xc1, 0x38, 0x3f, 0xe6, 0x02, 0x3c, 0xe8, 0xd2, 0x2a,
+          0xd4, 0x44, 0xe9, 0x22, 0x27, 0x55, 0xb7, 0x2b, 0x32, 0x39, 0x6f, 0x1c, 0xdd, 0x7f, 0x20, 0x12, 0xa9, 0x5e, 0xf8, 0x69, 0x69, 0x3b, 0xd3, 0x57,
+          0x31, 0x5e, 0x07, 0x54, 0xd5, 0x9b, 0xcc, 0xa2, 0x68, 0x0f, 0xe8, 0xbc, 0x39, 0x8c, 0x41, 0x03, 0xa3, 0xa4, 0x44, 0x69, 0x68, 0x1c, 0xf8, 0x76,
+          0x4f, 0x65, 0x3f, 0x0a, 0x4f, 0x3c, 0x9a, 0x52, 0x88, 0x5c, 0x16, 0xbe, 0x0c, 0x4b, 0xb8, 0xf5, 0xe6, 0xa5, 0x82, 0x25, 0x96, 0x08, 0x40, 0x3a,
+          0x26, 0x00, 0xdc, 0x29, 0x5e, 0x1a, 0x37, 0x78, 0xd5, 0xf1, 0x68, 0x36, 0xef, 0x71, 0xc6, 0xe3, 0x5a, 0x6e, 0x12, 0x93, 0x93, 0xc9, 0xb7, 0x9d,
+          0xd7, 0x85, 0x3b, 0x96, 0xbe, 0xb5, 0xb2, 0xcb, 0x6c, 0x36, 0x67, 0x23, 0x31, 0xee, 0x4d, 0x46, 0x2f, 0xbc, 0x8e, 0xf3, 0xac, 0x8d, 0xea, 0xe6,
+          0x75, 0x46, 0x6d, 0x05, 0x71, 0xbf, 0x3a, 0x5e, 0x9d, 0xcc, 0xb2, 0x6a, 0xaf, 0x46, 0x1e, 0x78, 0xa7, 0x6b, 0x28, 0xb0, 0x19, 0xa3, 0xa8, 0x58,
+          0xfc, 0x16, 0x0a, 0x04, 0x4e, 0xa8, 0x52, 0x78, 0xc9, 0xe8, 0x47, 0x69, 0xec, 0x54, 0xd0, 0xf9, 0x97, 0x45, 0x8b, 0xd2, 0x71, 0x64, 0x40, 0x21,
+          0x51, 0x48, 0xab, 0x62, 0x21, 0x5f, 0x27, 0x69, 0xfe, 0xa0, 0xb2, 0xa6, 0x2b, 0xf2, 0xdf, 0x10, 0x99, 0xfb, 0x5e, 0x1b, 0x60, 0xbb, 0x21, 0x23,
+          0xef, 0x41, 0x65, 0x40, 0xd4, 0xe1, 0x1c, 0x50, 0x2d, 0x5b, 0xdd, 0x2d, 0xed, 0x62, 0x4a, 0xec, 0xc6, 0xc6, 0x7a, 0x9e, 0x0a, 0x9d, 0x4b, 0x24,
+          0xc2, 0xa1, 0xf2, 0x5e, 0x98, 0xf8, 0x7d, 0x85, 0x01, 0xf5, 0x69, 0x7b, 0x7f, 0xbf, 0x70, 0x6b, 0xbf, 0x87, 0x20, 0x1d, 0x1e, 0x09, 0x15, 0x22,
+          0x0b, 0xdc, 0x92, 0xad, 0x74, 0x83, 0xe2, 0x20, 0xec, 0x5b, 0xfd, 0x91, 0x20, 0x57, 0x87, 0x06, 0x79, 0x77, 0x32, 0x0e, 0x98, 0x9e, 0x6f, 0x8b,
+          0xce, 0xf5, 0x9a, 0x67, 0x8b, 0xac, 0x2a, 0xfd, 0x90, 0x51, 0x3d, 0x6f, 0x43, 0x21, 0xc8, 0x5c, 0xeb, 0x85, 0xe4, 0x7a, 0x9f, 0x98, 0x91, 0x8a,
+          0x80, 0xc9, 0x38, 0x13, 0x15, 0x8d, 0x28, 0x8e, 0x18, 0xf0, 0x23, 0x24, 0x92, 0x2c, 0xec, 0xd8, 0x6f, 0x44, 0xe8, 0x1d, 0x37, 0xb9, 0xe0, 0x17,
+          0x22, 0xe1, 0x18, 0x37, 0xb4, 0x49, 0x1b, 0x10, 0x22, 0xee, 0xd9, 0x1c, 0x36, 0x6c, 0x76, 0x53, 0x13, 0xf1, 0x2a, 0xe6, 0x48, 0x5e, 0x17, 0x9a,
+          0x26, 0x14, 0x07, 0x24, 0x65, 0xf4, 0xb9, 0x87, 0x12, 0x1e, 0x91, 0xd0, 0x7f, 0x24, 0x59, 0x13, 0xe9, 0xf3, 0x68, 0xa2, 0xa3, 0x48, 0xd9, 0xe4,
+          0x6c, 0x24, 0x6c, 0x21, 0x50, 0x24, 0x84, 0x93, 0xcd, 0xa3, 0xcb, 0x4c, 0x21, 0x19, 0xd8, 0x66, 0xd1, 0xd5, 0xf9, 0x0a, 0x63, 0x64, 0x05, 0x8d,
+          0xd4, 0xfb, 0x14, 0x0b, 0x99, 0x78, 0xea, 0x7e, 0x36, 0xae, 0xc2, 0xc2, 0x07, 0x22, 0xf8, 0x7a, 0x09, 0xd9, 0x15, 0x8e, 0x00, 0x0b, 0x63, 0xd7,
+          0xb9, 0x24, 0x06, 0xcc, 0x2f, 0xae, 0x9f, 0x89, 0x13, 0x4b, 0x06, 0x69, 0xa3, 0x1d, 0x6e, 0x0a, 0xe7, 0xba, 0xf0, 0x90, 0xaa, 0xce, 0xaf, 0x02,
+          0x33, 0x77, 0xf1, 0xe3, 0xa3, 0xa3, 0x38, 0xf3, 0xe7, 0x0c, 0x0c, 0x55, 0xf6, 0x9b, 0xcb, 0xf6, 0xd8, 0xd4, 0x8e, 0x96, 0xd5, 0x24, 0xee, 0x2f,
+          0xfc, 0x7f, 0xcf, 0xc3, 0x6e, 0x4f, 0xa4, 0x64, 0xc5, 0xab, 0x02, 0x8f, 0x74, 0x7c, 0x8d, 0x58, 0x44, 0x3b, 0x66, 0x7c, 0x70, 0x0c, 0xfc, 0x3d,
+          0x40, 0x89, 0xc2, 0x60, 0xfa, 0x13, 0x04, 0x40, 0x39, 0x35, 0x8a, 0xd0, 0x8c, 0xed, 0x84, 0x3a, 0x49, 0x72, 0x34, 0x11, 0x9e, 0xa2, 0xb3, 0x13,
+          0xf5, 0x50, 0x15, 0x7e, 0x41, 0x95, 0x3f, 0xff, 0x97, 0x50, 0x24, 0xd0, 0x2e, 0x81, 0x61, 0x21, 0x1a, 0x5b, 0x22, 0xd8, 0x09, 0xa0, 0x51, 0x8f,
+          0xf0, 0x64, 0x93, 0x07, 0xcb, 0x43, 0x41, 0x9c, 0x80, 0xfa, 0x0f, 0x99, 0x7e, 0xf7, 0x35, 0xb4, 0x8a, 0x49, 0x2d, 0x35, 0x87, 0xc5, 0x73, 0xca,
+          0xb0, 0xd0, 0xf4, 0x7a, 0x85, 0xcf, 0xbc, 0xf3, 0x30, 0x8d, 0xa8, 0x0b, 0xef, 0x85, 0xcf, 0xf7, 0x90, 0x27, 0x72, 0x8b, 0xe4, 0x1a, 0x50, 0xb3,
+          0xdd, 0x75, 0x56, 0xf5, 0x98, 0x81, 0x19, 0x3c, 0x12, 0x0d, 0xbd, 0x16, 0x7d, 0x74, 0x5f, 0x9f, 0xf9, 0x2c, 0xea, 0xfc, 0x8e, 0x3f, 0x73, 0xb2,
+          0xe7, 0x27, 0xf6, 0xaa, 0xca, 0x68, 0x28, 0xb7, 0xbc, 0xec, 0x56, 0xe2, 0xba, 0xfe, 0x72, 0x6a, 0x4f, 0xdf, 0x00, 0x76, 0x2c, 0x80, 0x40, 0xcd,
+          0xc4, 0x3a, 0xd7, 0x12, 0xb0, 0x2f, 0x66, 0xc9, 0x9b, 0xfa, 0xf3, 0x5a, 0x0d, 0x51, 0x8c, 0x45, 0x42, 0xbe, 0x71, 0xed, 0xd8, 0xab, 0xec, 0x54,
+          0x5a, 0x52, 0x58, 0x90, 0xf6, 0xd6, 0xb5, 0xe5, 0x63, 0x1d, 0x5d, 0x59, 0x4d, 0x42, 0x9e, 0x56, 0x2e, 0x54, 0x08, 0x2b, 0x2c, 0x6d, 0xec, 0x87,
+          0x2b, 0x44, 0x24, 0x4b, 0x35, 0x4c, 0xba, 0x56, 0xe3, 0x9a, 0x1c, 0xbf, 0xb3, 0x7d, 0x69, 0x1a, 0xb0, 0xea, 0xc9, 0xa6, 0x0a, 0x61, 0x08, 0x32,
+          0x99, 0x43, 0x67, 0x85, 0xa8, 0x1d, 0xd1, 0x09, 0x16, 0x84, 0x7d, 0xd7, 0x73, 0x1c, 0xe2, 0x80, 0xce, 0xfc, 0x30, 0x9c, 0x18, 0x8d, 0xd2, 0xce,
+          0x8f, 0x17, 0x08, 0x14, 0xf6, 0x87, 0x99, 0x79, 0xdb, 0x0b, 0xb2, 0x9c, 0x15, 0x5a, 0x4a, 0x11, 0x5f, 0x84, 0x89, 0x38, 0x33, 0x07, 0xd5, 0xf3,
+          0x52, 0x5e, 0xd3, 0x32, 0xad, 0x4f, 0xef, 0x20, 0xd6, 0x12, 0x3f, 0xa6, 0xd0, 0xd2, 0x70, 0x39, 0xb1, 0xf3, 0xde, 0x75, 0x7f, 0x66, 0xca, 0xb8,
+          0xb7, 0x68, 0x0f, 0xbf, 0x47, 0xb6, 0x62, 0xdb, 0xf2, 0x07, 0xe0, 0x10, 0xaa, 0x76, 0x95, 0xf3, 0xd2, 0xbe, 0xf7, 0x9c, 0x13, 0xdd, 0x89, 0xce,
+          0x7f, 0xc1, 0x26, 0xe1, 0x80, 0x06, 0x9a, 0x30, 0xa9, 0xf8, 0xee, 0x59, 0x14, 0x7d, 0x3c, 0x6f, 0xfa, 0x5a, 0xd2, 0x88, 0x49, 0x1c, 0x62, 0x5a,
+          0x9d, 0x3f, 0x1b, 0xd6, 0x99, 0xcb, 0xbb, 0x87, 0xdd, 0x69, 0xce, 0x2d, 0xcb, 0xbb, 0xb5, 0x11, 0x96, 0x2e, 0x53, 0xa1, 0x1d, 0xb5, 0x77, 0xa6,
+          0x2e, 0x9c, 0xe5, 0x38, 0x22, 0x6d, 0xe1, 0x44, 0x9c, 0x2b, 0x7e, 0x73, 0x9e, 0xba, 0xfb, 0x4f, 0x66, 0x6c, 0x34, 0x2c, 0xc4, 0x53, 0xb7, 0xc1,
+          0x4f, 0x33, 0xf6, 0x7a, 0x0f, 0x3f, 0xd9, 0xd2, 0xbd, 0xd5, 0x54, 0x14, 0x31, 0x21, 0x2b, 0xd7, 0x44, 0x85, 0xb7, 0x28, 0x79, 0x1a, 0x33, 0x1f,
+          0xab, 0x2e, 0x9c, 0xba, 0xcc, 0xc4, 0x29, 0x4f, 0x38, 0x7f, 0x0c, 0x82, 0x49, 0x86, 0x6a, 0xaf, 0x2b, 0x2b, 0xc3, 0x24, 0x5d, 0x00, 0xc2, 0xa2,
+          0x47, 0xd4, 0x81, 0x63, 0x17, 0x57, 0xb4, 0x81, 0xe8, 0xc4, 0xa6, 0xe1, 0xbb, 0xa8, 0x5a, 0x59, 0x1e, 0x41, 0x2d, 0x8c, 0x93, 0xea, 0xbc, 0x22,
+          0x52, 0xfe, 0xd3, 0x8b, 0xa3, 0x8b, 0x45, 0x71, 0x62, 0xfb, 0xf9, 0x75, 0x28, 0xb4, 0x39, 0x1f, 0x37, 0x50, 0x11, 0xa5, 0x1b, 0x03, 0xf2, 0xf4,
+          0x4b, 0x72, 0xa0, 0x51, 0xd4, 0xb7, 0x4f, 0x8f, 0xa1, 0xf8, 0xf9, 0x1d, 0xbb, 0x01, 0xe5, 0xc4, 0x24, 0x58, 0xb5, 0x19, 0x76, 0x12, 0x88, 0xa7,
+          0xd3, 0x50, 0x77, 0xc2, 0x10, 0xbc, 0xbe, 0xa8, 0x20, 0xf7, 0xea, 0x1c, 0x0e, 0x5b, 0x94, 0xeb, 0x34, 0x55, 0x60, 0xf5, 0xd2, 0x72, 0x33, 0x50,
+          0x5a, 0x4c, 0x76, 0x03, 0x7c, 0xe8, 0x58, 0x13, 0x66, 0x46, 0x26, 0xb2, 0xe2, 0xfc, 0x17, 0x2d, 0x14, 0xd7, 0xde, 0xa8, 0x49, 0x34, 0xc4, 0xd4,
+          0xeb, 0x4f, 0x8c, 0x48, 0xc1, 0xa1, 0x61, 0xd5, 0x91, 0xdb, 0x5f, 0x3d, 0x01, 0xaf, 0x35, 0x0c, 0x83, 0x35, 0x12, 0x6c, 0x1c, 0x4b, 0x2c, 0x32,
+          0x80, 0xbd, 0xb2, 0x5a, 0xae, 0x72, 0xd2, 0x91, 0x01, 0xa0, 0xab, 0xb0, 0xa1, 0x79, 0xe3, 0x22, 0xc8, 0xfd, 0x8d, 0x66, 0x0b, 0x3a, 0x9b, 0x5b,
+          0x1d, 0xca, 0x8c, 0x1d, 0x72, 0x41, 0x03, 0x7c, 0x6d, 0xe3, 0xe2, 0xa7, 0xaf, 0x9d, 0x40, 0x1f, 0x23, 0x39, 0x80, 0xe7, 0xb1, 0x5d, 0xc3, 0x9e,
+          0x7d, 0x31, 0xc4, 0x07, 0x50, 0x24, 0x6c, 0xac, 0xed, 0x6a, 0x36, 0xbf, 0xa5, 0x0c, 0x96, 0x69, 0xe3, 0x56, 0x9d, 0x87, 0xb9, 0xf7, 0x71, 0xc3,
+          0xaa, 0x4a, 0x51, 0x0c, 0xae, 0xc0, 0x53, 0x62, 0x6f, 0xc9, 0x74, 0x10, 0x7c, 0xce, 0x64, 0xc8, 0x4b, 0x77, 0x18, 0xa1, 0x3d, 0x61, 0x4d, 0x12,
+          0x4a, 0x3d, 0xd0, 0xfc, 0x6b, 0xc9, 0x2c, 0xdb, 0x18, 0x9b, 0xab, 0xd4, 0x40, 0x27, 0xd8, 0x35, 0x70, 0xaf, 0x7b, 0x9a, 0x5b, 0xb9, 0x8d, 0xe9,
+          0x9c, 0x69, 0xf7, 0xc5, 0x6e, 0x3c, 0xa9, 0x81, 0x75, 0x8d, 0x2d, 0x73, 0xb3, 0x9b, 0xaa, 0x56, 0xa4, 0x72, 0xb0, 0xe8, 0x33, 0x60, 0x22, 0x70,
+          0xec, 0xb4, 0x42, 0x8d, 0xe9, 0xaf, 0x31, 0xdc, 0x51, 0x3a, 0x2c, 0xae, 0x35, 0x7c, 0xfb, 0x9a, 0x6a, 0x1c, 0x98, 0x4c, 0xe6, 0x70, 0x64, 0x3e,
+          0x52, 0xc2, 0x2d, 0x21, 0x78, 0x6f, 0x4f, 0x79, 0xf6, 0xa7, 0x1c, 0x12, 0x22, 0x87, 0x3d, 0x28, 0x97, 0xa2, 0x42, 0x91, 0x07, 0xc9, 0x0b, 0x24,
+          0x04, 0xd4, 0xfc, 0x3d, 0xa3, 0xe1, 0xab, 0x5f, 0x6f, 0xfe, 0x4c, 0x2d, 0xea, 0x79, 0x72, 0xb7, 0xfb, 0xc7, 0x9f, 0xab, 0xb3, 0x7e, 0x91, 0xdc,
+          0xed, 0xff, 0xf1, 0x17, 0xea, 0x7c, 0x7d, 0x99, 0xdc, 0x95, 0xff, 0xf8, 0x4b, 0x75, 0x7f, 0x78, 0x95, 0xdc, 0x54, 0xff, 0xf8, 0x2b, 0xf5, 0xdf,
+          0xfc, 0x3a, 0xb9, 0x3b, 0xfc, 0xe3, 0xaf, 0xd5, 0x83, 0xed, 0x9b, 0xe4, 0xee, 0xf8, 0x8f, 0xbf, 0x51, 0x0f, 0xc9, 0xdb, 0x7b, 0x9f, 0x64, 0xf4,
+          0xb6, 0x47, 0xd3, 0xa3, 0xda, 0xa1, 0xc7, 0xdb, 0x49, 0x38, 0xa8, 0x2b, 0x97, 0xf3, 0xd0, 0xa4, 0xa7, 0x13, 0x56, 0x67, 0x84, 0x77, 0xd7, 0x0f,
+          0xe7, 0x8f, 0x34, 0x5d, 0x07, 0x9d, 0x77, 0x53, 0xeb, 0x9e, 0xae, 0x9f, 0x8a, 0xa1, 0x43, 0xec, 0x8e, 0x0b, 0x10, 0x8f, 0x7d, 0x6c, 0x0a, 0x5f,
+          0x5d, 0xd1, 0x51, 0x99, 0x1f, 0xdd, 0x94, 0xb9, 0xd7, 0x34, 0xf0, 0x5c, 0xe1, 0x2c, 0xd5, 0x36, 0xe4, 0x6c, 0xd0, 0x60, 0xf5, 0xa9, 0xde, 0xa4,
+          0x3b, 0xe8, 0x95, 0x3d, 0x48, 0x66, 0x80, 0xee, 0x75, 0x3a, 0xed, 0xda, 0xe4, 0x1c, 0xcb, 0x49, 0x59, 0x25, 0x4b, 0x17, 0x31, 0xa4, 0x07, 0xde,
+          0xcc, 0x28, 0x3a, 0x35, 0xfd, 0xb2, 0x5a, 0x55, 0x25, 0x5c, 0x4d, 0x09, 0x57, 0x70, 0x85, 0xd9, 0x7c, 0x0c, 0xce, 0xc4, 0xae, 0x1b, 0xaf, 0xe9,
+          0x41, 0xe5, 0x3d, 0x03, 0x76, 0x5f, 0x99, 0x44, 0x04, 0x25, 0xc9, 0xe4, 0x46, 0xfa, 0x1a, 0x91, 0xe0, 0x37, 0x90, 0x7e, 0x32, 0xb6, 0xeb, 0x6b,
+          0x10, 0x2a, 0xdf, 0x25, 0x61, 0xb5, 0x2d, 0x13, 0xbd, 0xe2, 0x7b, 0xd0, 0x74, 0xd5, 0xbe, 0xeb, 0xca, 0xf0, 0x6d, 0x89, 0xaf, 0xd6, 0x7f, 0x5f,
+          0xe8, 0x5b, 0xcd, 0x92, 0x7b, 0xcf, 0x35, 0xaa, 0x5a, 0x43, 0x2e, 0xa7, 0x5e, 0x11, 0x3e, 0xac, 0xa2, 0x08, 0x56, 0x09, 0x64, 0x9b, 0xb9, 0x79,
+          0xba, 0x3f, 0x12, 0xb4, 0x7a, 0x70, 0x85, 0xcc, 0xf2, 0x61, 0xf0, 0x56, 0x4c, 0x1c, 0x3b, 0x5c, 0x87, 0x31, 0x82, 0x12, 0x59, 0x79, 0xef, 0xb2,
+          0x0e, 0x6d, 0x85, 0x8d, 0x35, 0x36, 0x0f, 0x98, 0x55, 0x5c, 0x65, 0xf1, 0x38, 0xa1, 0x4d, 0x7e, 0x1d, 0x52, 0x4a, 0x77, 0xb9, 0x0a, 0xfd, 0x3e,
+          0xc0, 0xb4, 0x0e, 0x1a, 0xb8, 0xae, 0x29, 0xcd, 0xbc, 0x61, 0xfb, 0x06, 0xd9, 0xa1, 0x17, 0xbe, 0xd3, 0xb6, 0xb0, 0x00, 0xc4, 0x9e, 0xdc, 0x20,
+          0x6b, 0x25, 0xac, 0xfb, 0xfa, 0x35, 0x03, 0xce, 0xdc, 0xc6, 0xa0, 0x54, 0x9a, 0x04, 0x1d, 0x95, 0x85, 0x42, 0xae, 0x2f, 0x5c, 0x09, 0x51, 0xaa,
+          0x9e, 0xfa, 0xf5, 0xa8, 0xee, 0x1d, 0x4f, 0x44, 0x09, 0xd3, 0xae, 0xb9, 0x3f, 0x69, 0xb6, 0x83, 0x89, 0x67, 0xaf, 0x92, 0xf3, 0xd3, 0xcd, 0xf7,
+          0x71, 0x31, 0xa2, 0x55, 0xa1, 0x7a, 0x49, 0x00, 0x1a, 0xda, 0x3e, 0xa3, 0x46, 0x95, 0x68, 0xa0, 0x7b, 0x5c, 0x7c, 0x97, 0xa6, 0xee, 0xe1, 0x32,
+          0x34, 0xc7, 0xae, 0xeb, 0xe7, 0x9e, 0x2e, 0x2d, 0xef, 0x00, 0x3a, 0x74, 0xde, 0x5b, 0x88, 0x64, 0x23, 0x53, 0xa8, 0xb5, 0xc1, 0xb1, 0xa7, 0x76,
+          0xb1, 0xb9, 0x37, 0x25, 0x2d, 0x40, 0x84, 0x6f, 0x69, 0x48, 0x4e, 0xe2, 0x3d, 0xed, 0x9d, 0x96, 0xce, 0x40, 0xa4, 0xd8, 0x30, 0x08, 0xd6, 0x5c,
+          0x2d, 0x17, 0x62, 0x0b, 0xde, 0xc1, 0x77, 0x93, 0x14, 0xae, 0x8a, 0x64, 0x08, 0xd6, 0xf7, 0x13, 0xd6, 0x54, 0x3f, 0xc2, 0xf7, 0x35, 0x49, 0x26,
+          0x94, 0xfe, 0x2f, 0x18, 0xd3, 0xd1, 0xb4, 0xed, 0x8d, 0xf3, 0xec, 0xb6, 0x40, 0x93, 0x3d, 0xc8, 0x08, 0x6b, 0x63, 0xbe, 0x15, 0xcb, 0xad, 0x11,
+          0x77, 0x96, 0x14, 0x67, 0x1b, 0x06, 0xe1, 0x80, 0x3c, 0x44, 0xf0, 0xae, 0x23, 0x84, 0xc3, 0xb1, 0xcd, 0x1e, 0x53, 0x89, 0xb7, 0x7f, 0xe7, 0xb5,
+          0x1e, 0x3b, 0xbd, 0x53, 0xe9, 0x7f, 0x6f, 0xff, 0x83, 0xb7, 0x4f, 0x01, 0x68, 0x4d, 0x74, 0x58, 0x86, 0x64, 0x89, 0x64, 0xda, 0x63, 0x83, 0xac,
+          0x02, 0xc9, 0xd5, 0xe1, 0x68, 0xd7, 0x22, 0x1b, 0x0f, 0x33, 0x1e, 0xf0, 0xfc, 0x7a, 0x0d, 0x20, 0x3a, 0xe7, 0xa8, 0x7e, 0xe9, 0x95, 0xae, 0xa7,
+          0x1e, 0x02, 0xda, 0x7b, 0xb3, 0x9c, 0x5a, 0x4d, 0xcb, 0x1e, 0xab, 0xa1, 0xec, 0x65, 0x20, 0x84, 0x07, 0x07, 0x9a, 0x9d, 0x11, 0x87, 0xa4, 0xb1,
+          0x16, 0xc1, 0x79, 0x1e, 0xd0, 0xd4, 0xb3, 0x4d, 0x69, 0xf8, 0x83, 0xbe, 0x81, 0x2d, 0x21, 0xd9, 0x39, 0x0d, 0x4d, 0x96, 0x9b, 0xb8, 0x85, 0x78,
+          0xf2, 0xd0, 0x1e, 0xb8, 0x81, 0x67, 0x80, 0x93, 0x29, 0x4a, 0xe6, 0x25, 0x14, 0xfe, 0xda, 0x14, 0x24, 0xdf, 0x9c, 0xbc, 0x91, 0x54, 0x69, 0x62,
+          0xd8, 0x04, 0x31, 0xd4, 0x05, 0xda, 0x5e, 0xc2, 0xf9, 0x79, 0xa0, 0xe1, 0x0d, 0x86, 0xbf, 0x74, 0xbf, 0x89, 0x0a, 0x92, 0x94, 0xfb, 0x1c, 0x36,
+          0x15, 0x69, 0x1a, 0x99, 0x83, 0xf4, 0x88, 0xb1, 0xd7, 0x07, 0xed, 0x81, 0xd5, 0x4e, 0xa9, 0xbe, 0xe9, 0xd9, 0xc8, 0xb0, 0xca, 0x3a, 0xb3, 0xaa,
+          0xbc, 0xc8, 0xf9, 0x92, 0xc2, 0xa1, 0xc3, 0x66, 0x0e, 0x99, 0xf5, 0x1b, 0xe7, 0xeb, 0xb5, 0x18, 0x6e, 0x3d, 0xf9, 0xd5, 0xb6, 0x61, 0x8d, 0x62,
+          0xb5, 0xec, 0x77, 0x94, 0xd7, 0xd8, 0x66, 0x6e, 0xbc, 0x89, 0xa3, 0xf1, 0xd8, 0xf2, 0x83, 0x1c, 0x4c, 0xa6, 0xa7, 0x9b, 0x7f, 0x3d, 0x80, 0x96,
+          0x55, 0x42, 0x8d, 0x31, 0x82, 0x0c, 0x4b, 0xdd, 0xc6, 0x6a, 0x16, 0x77, 0xa0, 0xfd, 0xf6, 0x94, 0xe7, 0xc7, 0x8b, 0x12, 0x0b, 0x11, 0x23, 0x43,
+          0x41, 0x8f, 0x8d, 0x1d, 0xdb, 0x48, 0x9f, 0xef, 0x4e, 0x58, 0xd9, 0xb8, 0x1a, 0xac, 0xee, 0x4b, 0x9a, 0x2e, 0xf2, 0xb9, 0x65, 0x02, 0x68, 0xbb,
+          0x33, 0xf6, 0x25, 0xe5, 0x74, 0xef, 0x24, 0x8f, 0x00, 0x20, 0x21, 0xe4, 0xf2, 0x2e, 0x3c, 0x37, 0x27, 0xa0, 0x2f, 0x11, 0x67, 0xee, 0xb2, 0x93,
+          0x26, 0x3e, 0x26, 0x6b, 0x5f, 0xcc, 0xe4, 0xa4, 0x82, 0x04, 0x4f, 0xf6, 0xc8, 0xb8, 0x5d, 0x02, 0x22, 0x0e, 0x1b, 0xc5, 0x0c, 0x13, 0xd6, 0xc0,
+          0xe2, 0x1b, 0x53, 0xdf, 0x22, 0x04, 0x27, 0xbd, 0x40, 0xb6, 0x6f, 0x3e, 0x4e, 0x1c, 0xaf, 0xf0, 0x8f, 0x66, 0xb9, 0x2a, 0x45, 0x05, 0xe3, 0x98,
+          0xf1, 0x27, 0xfe, 0xa7, 0x0e, 0x69, 0xca, 0x45, 0x23, 0x14, 0xdc, 0x36, 0x74, 0xc0, 0xe2, 0x80, 0x74, 0x80, 0x12, 0xae, 0xcd, 0xaa, 0x6d, 0xd1,
+          0x77, 0x39, 0x36, 0xaa, 0x52, 0x5b, 0x76, 0x9c, 0x0e, 0xe0, 0xb2, 0x59, 0x97, 0x0b, 0x39, 0xfe, 0x05, 0x2c, 0x1f, 0x82, 0x37, 0x15, 0x03, 0x37,
+          0xd8, 0x7d, 0xa7, 0x7a, 0x31, 0xa5, 0xe0, 0x14, 0x2e, 0x99, 0xf4, 0x52, 0xa3, 0x03, 0x78, 0xd7, 0xe6, 0x4a, 0xb9, 0x00, 0xda, 0x0c, 0x61, 0xcf,
+          0x63, 0x2f, 0x40, 0x1b, 0x78, 0x33, 0x77, 0x25, 0xb2, 0x8e, 0xba, 0x1d, 0xbe, 0x04, 0x6d, 0x50, 0x02, 0x55, 0xed, 0x44, 0xc6, 0x1c, 0x9b, 0x2d,
+          0xb0, 0xf0, 0x77, 0x9d, 0x79, 0xcf, 0x7d, 0xc9, 0x08, 0xdc, 0x2b, 0xf3, 0xf6, 0xa3, 0x56, 0x9d, 0xa1, 0x06, 0x56, 0x06, 0x59, 0xe9, 0x77, 0x6f,
+          0x00, 0x05, 0xb9, 0xd0, 0x02, 0x09, 0x10, 0xde, 0x52, 0xfe, 0xcb, 0x33, 0x6d, 0xff, 0x8a, 0xc0, 0x79, 0xb0, 0x73, 0xa3, 0x58, 0xdb, 0xab, 0x56,
+          0x94, 0x32, 0x7e, 0x42, 0x57, 0x2a, 0x1a, 0x68, 0x05, 0x68, 0xc1, 0x6c, 0x91, 0x99, 0xb5, 0x06, 0x81, 0x61, 0x63, 0xb3, 0x7f, 0x3f, 0x5e, 0x82,
+          0xda, 0x6a, 0x67, 0xef, 0xb4, 0x1e, 0x74, 0xa8, 0xcf, 0x70, 0x9d, 0xd6, 0x67, 0x35, 0xc7, 0x61, 0x94, 0x4a, 0xaa, 0x4a, 0xe7, 0x6f, 0xaa, 0x3a,
+          0xe6, 0x92, 0xfe, 0xa0, 0xe4, 0xe1, 0x4e, 0xb9, 0xc4, 0x81, 0x11, 0x3a, 0x35, 0x81, 0xe2, 0x29, 0xa8, 0xf4, 0xe9, 0x20, 0x17, 0xfe, 0x2b, 0x5a,
+          0xea, 0xe7, 0x9d, 0x86, 0x85, 0x0a, 0xe1, 0xbc, 0x40, 0x42, 0x8e, 0x56, 0x11, 0x6b, 0xce, 0x75, 0xe2, 0x92, 0x43, 0x66, 0x16, 0xa2, 0x91, 0x2b,
+          0x12, 0x28, 0x62, 0xcc, 0x7d, 0x6e, 0x6b, 0x88, 0x9f, 0x7a, 0x2b, 0xb7, 0x1c, 0x29, 0xe3, 0x60, 0x0e, 0x12, 0x3a, 0x23, 0xc9, 0x26, 0x54, 0x09,
+          0x98, 0xdc, 0x00, 0xc4, 0x72, 0x76, 0x46, 0x7a, 0x48, 0xa2, 0x8a, 0xc3, 0x71, 0x3c, 0x5b, 0x5e, 0x90, 0x73, 0xb3, 0xbb, 0x75, 0x73, 0x84, 0x47,
+          0x1f, 0x78, 0xb3, 0x0a, 0x30, 0xa7, 0x51, 0x95, 0x20, 0x9e, 0x55, 0xc4, 0x1c, 0x52, 0xb9, 0x78, 0xa0, 0xfa, 0x5c, 0xf3, 0xbe, 0xd3, 0x16, 0x2b,
+          0x2c, 0xd8, 0xdd, 0xf6, 0x86, 0x31, 0xc9, 0x88, 0xf9, 0x4e, 0xcf, 0x4e, 0x5a, 0xfd, 0x15, 0x9e, 0xb6, 0x97, 0x8b, 0xe9, 0x24, 0x98, 0xaa, 0x6e,
+          0x45, 0x92, 0x04, 0xb2, 0x48, 0xc0, 0x30, 0x23, 0x16, 0xba, 0x97, 0xf3, 0xe7, 0x54, 0x4c, 0xc5, 0x00, 0xd1, 0x0b, 0x15, 0x58, 0xe7, 0x27, 0x19,
+          0x87, 0x61, 0x6c, 0xcf, 0x83, 0xba, 0x13, 0x2e, 0xe0, 0xe2, 0x28, 0x09, 0x25, 0x0f, 0x7e, 0xb0, 0x40, 0xae, 0x09, 0xb0, 0x7b, 0x3d, 0x8e, 0x5e,
+          0x30, 0x9f, 0xc9, 0x3f, 0xda, 0x8b, 0x35, 0x4b, 0x71, 0xb2, 0xfc, 0x57, 0xa9, 0x4a, 0x3a, 0x8a, 0x27, 0x2e, 0x3a, 0x2f, 0x67, 0x18, 0x94, 0x2e,
+          0x01, 0xd2, 0x22, 0xbc, 0xf3, 0x71, 0x4e, 0xe3, 0x1b, 0xd2, 0x55, 0x07, 0xb3, 0x6a, 0xae, 0x9b, 0x34, 0xae, 0x47, 0xd2, 0xd8, 0x33, 0x12, 0x19,
+          0xbe, 0x1f, 0xd2, 0xa9, 0xec, 0xe7, 0xe9, 0x08, 0x23, 0x24, 0xcf, 0x0c, 0x8d, 0x2f, 0xc8, 0x4a, 0xea, 0x87, 0x26, 0xe3, 0xc8, 0xa0, 0x25, 0xf9,
+          0xb6, 0xab, 0xc7, 0x0c, 0x36, 0xa1, 0xca, 0xdd, 0x40, 0xb1, 0xdd, 0xa8, 0x13, 0x56, 0x90, 0xdf, 0xb9, 0x50, 0x5d, 0xd0, 0x3a, 0x02, 0x31, 0x67,
+          0x67, 0x18, 0x68, 0x1d, 0x7f, 0x39, 0x8e, 0x31, 0x4a, 0x71, 0xba, 0x18, 0x65, 0xdd, 0xcf, 0x78, 0x4f, 0x18, 0xc0, 0x67, 0x4c, 0xc7, 0x39, 0x93,
+          0xb1, 0x2f, 0x63, 0x0f, 0xd4, 0x41, 0xab, 0x79, 0x90, 0xfd, 0xb4, 0xa5, 0xec, 0x3f, 0xf1, 0xaa, 0xd1, 0xe9, 0xa2, 0xbc, 0x95, 0x9f, 0xdf, 0x98,
+          0xc7, 0x01, 0x5f, 0xe2, 0x93, 0xa4, 0x01, 0x14, 0x3c, 0x71, 0xea, 0xfe, 0x9d, 0xdf, 0x00, 0x20, 0xaa, 0x1a, 0x0f, 0x23, 0xa9, 0x87, 0xc3, 0x9a,
+          0x36, 0x78, 0x2d, 0xd0, 0x42, 0x21, 0xc3, 0x0c, 0x1e, 0xdf, 0x08, 0x58, 0x7b, 0x24, 0x37, 0xd5, 0x50, 0xb9, 0x38, 0xa9, 0x73, 0x8d, 0x27, 0xb2,
+          0x0f, 0x75, 0xf1, 0xd1, 0x89, 0x68, 0x49, 0x39, 0xf0, 0xda, 0x00, 0x72, 0x18, 0x02, 0x2f, 0x8c, 0x9f, 0x64, 0xe8, 0xeb, 0x17, 0x70, 0x0e, 0x52,
+          0x54, 0xe3, 0x07, 0x16, 0x22, 0x9a, 0xec, 0x47, 0x92, 0xd0, 0x57, 0x6d, 0x42, 0xed, 0x0f, 0xd3, 0x30, 0xdf, 0xb8, 0x82, 0xc8, 0x4e, 0xf3, 0x8a,
+          0x84, 0x23, 0xc5, 0x21, 0x78, 0x2a, 0xdc, 0xf0, 0x99, 0xe4, 0x11, 0x34, 0x8a, 0x22, 0xc1, 0x43, 0x47, 0x31, 0xf6, 0x66, 0x63, 0x8f, 0x37, 0x5e,
+          0x2b, 0x53, 0xcb, 0xab, 0x5d, 0xa9, 0xad, 0xde, 0x44, 0x31, 0xed, 0x18, 0x51, 0x72, 0x5f, 0xd1, 0xe6, 0x6d, 0x34, 0x7b, 0x32, 0x8e, 0x95, 0x60,
+          0x9a, 0x66, 0xe5, 0xe8, 0xe3, 0xa9, 0xe6, 0x23, 0x4c, 0xc0, 0xa5, 0x88, 0xb3, 0x03, 0x72, 0x81, 0x70, 0x46, 0xf5, 0xeb, 0xbf, 0xf2, 0x30, 0x07,
+          0x26, 0x86, 0x9d, 0x37, 0x46, 0xb5, 0xd4, 0xc0, 0x64, 0xf1, 0x2a, 0x60, 0x08, 0xd2, 0x88, 0xc8, 0x4f, 0x98, 0x35, 0xce, 0x25, 0x15, 0x9e, 0xda,
+          0x3c, 0x7a, 0x6d, 0x92, 0xc5, 0x7b, 0x34, 0x3c, 0x77, 0xdd, 0x94, 0x47, 0xe6, 0x2f, 0xd4, 0x10, 0xef, 0x15, 0xfa, 0x67, 0x12, 0x4d, 0x07, 0x78,
+          0x3c, 0x01, 0x54, 0x18, 0x8f, 0x95, 0x59, 0xd9, 0x35, 0x39, 0xc4, 0xee, 0xc4, 0x2e, 0x84, 0xb5, 0xa3, 0xa3, 0x09, 0x52, 0x83, 0x62, 0x86, 0x21,
+          0xcd, 0x51, 0x12, 0x7f, 0x5e, 0x97, 0xdb, 0x6c, 0x66, 0x5a, 0x37, 0xc9, 0xa7, 0xc6, 0x3e, 0x1d, 0x98, 0x59, 0x80, 0xeb, 0x74, 0x3d, 0x95, 0x4b,
+          0x46, 0x72, 0x48, 0x1a, 0x7f, 0xe2, 0x54, 0x91, 0x84, 0xb4, 0x13, 0x89, 0xa3, 0x3c, 0xf6, 0x5e, 0x05, 0x0e, 0x12, 0xd1, 0x50, 0x78, 0x30, 0x01,
+          0x35, 0xde, 0x43, 0x4c, 0x03, 0xe9, 0x87, 0xce, 0xa7, 0xc5, 0x25, 0xf4, 0x2b, 0x12, 0x0d, 0xd6, 0x50, 0x39, 0x15, 0xc1, 0x41, 0x75, 0x06, 0x87,
+          0xd3, 0xa4, 0x27, 0x86, 0x93, 0x11, 0x2a, 0x50, 0x98, 0x32, 0x25, 0x30, 0x4e, 0xb1, 0x82, 0xb9, 0x14, 0xc6, 0x3e, 0x38, 0x36, 0x95, 0xd0, 0x27,
+          0x10, 0x48, 0x71, 0xb8, 0xbc, 0x3b, 0x15, 0xcd, 0x67, 0x2c, 0xd2, 0x22, 0x58, 0x08, 0x9c, 0x06, 0x85, 0xe4, 0x9a, 0xe2, 0x24, 0xc2, 0x53, 0x4b,
+          0x86, 0x9e, 0x35, 0x34, 0xc6, 0x77, 0xa8, 0x3d, 0x7f, 0x24, 0xbe, 0x59, 0x78, 0x8c, 0xc7, 0xdb, 0xe7, 0x31, 0x94, 0xf4, 0xff, 0xb0, 0xf1, 0xf0,
+          0x79, 0x8a, 0x56, 0x78, 0x75, 0xc7, 0x5b, 0x61, 0xe3, 0xfb, 0x9c, 0x02, 0xda, 0x09, 0x4a, 0x97, 0xe3, 0xa9, 0xa6, 0x17, 0x79, 0xcf, 0x3e, 0xf8,
+          0x32, 0xfe, 0xf5, 0x11, 0xd1, 0xf2, 0x1d, 0xa2, 0x2e, 0x1d, 0x82, 0xd3, 0x95, 0x81, 0x1a, 0xa2, 0x2f, 0xf5, 0x40, 0x82, 0x3c, 0x26, 0x27, 0x99,
+          0xec, 0xe6, 0x4c, 0x7e, 0x8f, 0xc2, 0x8f, 0x03, 0x41, 0xca, 0xed, 0xb8, 0x5c, 0x43, 0xc0, 0x84, 0x46, 0xea, 0x37, 0x39, 0x86, 0xc3, 0xc2, 0x3b,
+          0x36, 0x0d, 0x8c, 0xec, 0xb5, 0xc9, 0x5a, 0x22, 0xa5, 0x2d, 0xc3, 0x99, 0x67, 0x0d, 0x52, 0x40, 0xf4, 0xc6, 0x7d, 0x76, 0xf3, 0xf0, 0x0e, 0xed,
+          0x8d, 0x27, 0x35, 0xb9, 0x71, 0xc9, 0x81, 0x5a, 0xa8, 0xcd, 0x5f, 0x91, 0x69, 0xf5, 0xea, 0x08, 0x77, 0x04, 0x8b, 0xcc, 0xf1, 0x7b, 0xa8, 0x8b,
+          0x09, 0x5c, 0x9e, 0xdc, 0x60, 0xf4, 0xb2, 0x1b, 0x74, 0xf1, 0x62, 0xff, 0xd7, 0xf9, 0xe4, 0xf4, 0x51, 0x87, 0x0a, 0xdf, 0xdb, 0xef, 0x43, 0x25,
+          0xcd, 0x24, 0x57, 0x0b, 0x2f, 0x88, 0xc3, 0x31, 0xbd, 0x06, 0xc8, 0x84, 0xf7, 0xf5, 0x12, 0x7f, 0xf2, 0xe0, 0x5a, 0xe5, 0x76, 0x5f, 0x7f, 0x1f,
+          0xac, 0x46, 0xab, 0x9c, 0xc5, 0xe7, 0xb2, 0x79, 0x14, 0x2f, 0x21, 0xe0, 0xcc, 0x12, 0x42, 0x0e, 0x12, 0xed, 0x3f, 0x9c, 0xfa, 0x48, 0x70, 0x04,
+          0xc4, 0x96, 0xe5, 0x3c, 0x1c, 0x53, 0x79, 0xd4, 0x57, 0x69, 0x62, 0x00, 0xe3, 0x46, 0x1b, 0x0c, 0xa0, 0x61, 0xab, 0xad, 0x25, 0xe2, 0xdc, 0x12,
+          0x04, 0xcf, 0xa6, 0xf6, 0x88, 0x8f, 0x8b, 0x8f, 0x10, 0xac, 0x08, 0xb1, 0x92, 0xbf, 0x7d, 0x51, 0xbe, 0x35, 0xb3, 0x28, 0x2f, 0x91, 0x83, 0xef,
+          0x64, 0x99, 0xfb, 0xea, 0xb2, 0xb4, 0xe8, 0xb8, 0xbe, 0xc4, 0xf1, 0x01, 0x49, 0x2f, 0x04, 0x5b, 0x60, 0xaf, 0x5b, 0x29, 0xf0, 0x97, 0xad, 0xc0,
+          0x9c, 0x3c, 0x82, 0x49, 0xed, 0x2d, 0x34, 0x98, 0xf9, 0x72, 0x39, 0x2a, 0xd4, 0x68, 0xec, 0x05, 0x5d, 0x17, 0x45, 0x42, 0x27, 0x2e, 0x15, 0xb0,
+          0xfa, 0x66, 0x33, 0xe4, 0x0f, 0xd5, 0xea, 0x0e, 0x13, 0x2e, 0xcc, 0x2c, 0xa3, 0x20, 0x6d, 0x05, 0x04, 0x9a, 0xf8, 0xe3, 0x06, 0xff, 0xdb, 0x2c,
+          0xc1, 0x3c, 0xa9, 0xd4, 0xc4, 0xfa, 0xe9, 0x79, 0xa0, 0x9b, 0x28, 0x60, 0x7e, 0xce, 0x8c, 0x3d, 0x36, 0x17, 0x47, 0x64, 0x8a, 0x5c, 0xbc, 0x92,
+          0xab, 0x94, 0x59, 0x7e, 0xcb, 0x52, 0xc4, 0x39, 0xaf, 0x4a, 0xc2, 0xaa, 0x91, 0xc1, 0x87, 0x48, 0xfd, 0xe1, 0xa2, 0xb9, 0xb1, 0xaf, 0x97, 0xa6,
+          0x8a, 0xc6, 0x42, 0xc0, 0x14, 0xab, 0x64, 0x72, 0xa4, 0xb3, 0xdb, 0x9f, 0x16, 0x4d, 0xfa, 0xf3, 0xfe, 0x4c, 0x11, 0x23, 0x1f, 0xc0, 0xe0, 0x70,
+          0x74, 0xdc, 0xda, 0xc9, 0x2d, 0xad, 0xb1, 0x05, 0x3e, 0x6f, 0x34, 0x8d, 0x7d, 0xa7, 0x2a, 0x72, 0x54, 0x75, 0xb0, 0xfd, 0xba, 0x9f, 0xa2, 0x74,
+          0xd1, 0x0b, 0x6f, 0xba, 0xe1, 0x52, 0x68, 0x13, 0x1f, 0xbc, 0x6e, 0xdc, 0x0d, 0xe2, 0x34, 0xb2, 0x50, 0x04, 0x52, 0x30, 0x31, 0x2b, 0xed, 0xb5,
+          0xf2, 0xd8, 0x1e, 0x2b, 0xc7, 0x62, 0xbd, 0x75, 0xce, 0xfe, 0xcf, 0xe9, 0xe1, 0x5f, 0x5a, 0x3b, 0x25, 0x28, 0x29, 0xac, 0xdf, 0x1a, 0x38, 0xf1,
+          0xfd, 0x4b, 0x5e, 0x6d, 0x0c, 0x76, 0xe7, 0x43, 0x8f, 0xf1, 0xdf, 0xb7, 0x15, 0x67, 0xd8, 0xe6, 0xb2, 0xb5, 0xdd, 0xda, 0xeb, 0xfd, 0x52, 0xbd,
+          0x4f, 0xc6, 0x82, 0x99, 0x6d, 0x64, 0x54, 0xb0, 0x3d, 0xa2, 0x42, 0x7c, 0x14, 0x86, 0x08, 0x42, 0x1a, 0xbd, 0x45, 0xee, 0x37, 0xc1, 0xdf, 0x6c,
+          0x23, 0xc8, 0x4f, 0xa9, 0xe5, 0xb4, 0x99, 0xc4, 0xdd, 0x8a, 0x0a, 0xd2, 0x37, 0x53, 0xd4, 0x4d, 0x2c, 0x5c, 0x8f, 0xc1, 0x7a, 0xae, 0x7e, 0xf0,
+          0x31, 0xca, 0xde, 0x2a, 0xba, 0x81, 0x4f, 0x40, 0x58, 0x51, 0xd3, 0x28, 0x14, 0xcc, 0x1d, 0xeb, 0x19, 0xdb, 0x75, 0x7a, 0x25, 0x61, 0x48, 0x4d,
+          0x2b, 0xe1, 0xe1, 0x10, 0x06, 0x01, 0x12, 0x39, 0xba, 0x1c, 0x3b, 0xa8, 0x8c, 0x9b, 0x7c, 0x09, 0x10, 0xc1, 0xe4, 0xb7, 0x73, 0x99, 0xbd, 0x41,
+          0xfb, 0xff, 0xc0, 0xbf, 0x0a, 0xfb, 0x47, 0x53, 0x71, 0x47, 0x1e, 0x0e, 0x78, 0xea, 0xbf, 0x71, 0x04, 0x29, 0x7c, 0xca, 0x53, 0xac, 0x69, 0xda,
+          0xcb, 0x31, 0x77, 0x99, 0xe9, 0x1e, 0x53, 0x42, 0x9a, 0x2e, 0xda, 0x9e, 0xb1, 0x40, 0xc9, 0x2f, 0x8d, 0x5e, 0x29, 0xe3, 0x9d, 0xd6, 0xc1, 0x89,
+          0x00, 0xb7, 0xd4, 0x21, 0x93, 0x3a, 0x8a, 0xe5, 0xc7, 0x89, 0x8c, 0xc8, 0x5d, 0x27, 0x91, 0x39, 0x2b, 0xef, 0xad, 0xb9, 0x47, 0xc9, 0x9e, 0xca,
+          0xa5, 0x7d, 0xec, 0xc5, 0x3c, 0xd8, 0xf8, 0x02, 0x77, 0x30, 0x24, 0x3b, 0x3a, 0xb6, 0xab, 0x69, 0xaa, 0x74, 0x80, 0xad, 0xb8, 0x48, 0xdf, 0xf0,
+          0x7c, 0x51, 0x4c, 0xda, 0x50, 0x2d, 0x8b, 0x55, 0x30, 0xef, 0x0b, 0x19, 0x5b, 0xe9, 0x2f, 0xd9, 0x97, 0x28, 0x6d, 0x9f, 0xe0, 0xe7, 0xd5, 0x85,
+          0x15, 0x34, 0xe8, 0x7a, 0x58, 0x32, 0xee, 0x04, 0x30, 0x63, 0x8d, 0x11, 0x8a, 0x7a, 0x84, 0x02, 0x3a, 0x38, 0x42, 0x66, 0xdf, 0x06, 0xf6, 0x13,
+          0x04, 0xe9, 0xaf, 0x62, 0xb7, 0xda, 0x71, 0x58, 0x51, 0xb0, 0x5d, 0xe0, 0x34, 0xa0, 0x94, 0x69, 0x21, 0x81, 0x08, 0x1f, 0xe4, 0xad, 0x00, 0x3c,
+          0xd8, 0x5c, 0x67, 0xb5, 0xbe, 0xfe, 0xae, 0xfc, 0x35, 0xbb, 0xcf, 0x20, 0x22, 0x2f, 0x4e, 0x55, 0xdf, 0x86, 0x8d, 0x04, 0x52, 0x11, 0x3c, 0x8d,
+          0xeb, 0xbd, 0xdf, 0xbc, 0x6d, 0xf0, 0x32, 0x59, 0x80, 0x98, 0x37, 0xa6, 0x5e, 0x65, 0x1d, 0x3c, 0x0e, 0xdd, 0x70, 0x63, 0x8a, 0x56, 0x9c, 0xd9,
+          0x08, 0x31, 0xa4, 0xb3, 0x2a, 0x9e, 0x79, 0xd3, 0x20, 0x56, 0x5c, 0xed, 0x56, 0x39, 0x6e, 0x77, 0xdf, 0x56, 0x7b, 0x64, 0xf5, 0xa7, 0x76, 0x05,
+          0x1f, 0x27, 0x33, 0xf3, 0x4d, 0xf6, 0xf1, 0x91, 0x8d, 0xcb, 0xe6, 0xb5, 0x77, 0x79, 0x19, 0x1c, 0x2f, 0x49, 0xd8, 0x4e, 0x3d, 0x62, 0xdd, 0x69,
+          0xf0, 0x20, 0x2e, 0x57, 0x38, 0x91, 0xdd, 0x88, 0xcc, 0x0b, 0x35, 0x42, 0xf3, 0xf9, 0x50, 0x04, 0x91, 0xc0, 0xa4, 0x36, 0xba, 0xb4, 0xf1, 0x6d,
+          0x9b, 0xd9, 0x6a, 0x3d, 0x52, 0xc1, 0xe1, 0xe5, 0x8c, 0xfb, 0x8b, 0xe5, 0xba, 0xe3, 0x6b, 0xa6, 0xbc, 0x57, 0x79, 0xde, 0xe4, 0x06, 0x74, 0x44,
+          0x57, 0xd7, 0x83, 0x34, 0xfb, 0xdb, 0xaf, 0x86, 0xd8, 0x88, 0x75, 0x74, 0x88, 0xd0, 0x13, 0x00, 0xa3, 0xdc, 0x15, 0x17, 0x4b, 0x7d, 0x89, 0x40,
+          0xe2, 0x57, 0xb2, 0x68, 0x95, 0x66, 0xad, 0xa4, 0x08, 0x8e, 0xda, 0x14, 0x53, 0x92, 0xd0, 0xec, 0xf6, 0x53, 0x4e, 0xdb, 0x40, 0x3f, 0x34, 0x55,
+          0xb6, 0x1a, 0x6e, 0x97, 0x7e, 0xa8, 0x98, 0xa7, 0xe9, 0x41, 0x57, 0x56, 0x83, 0x1e, 0x67, 0x5d, 0x5d, 0x24, 0x36, 0xbd, 0x26, 0xa1, 0xfe, 0xf8,
+          0xe4, 0x86, 0xbc, 0x51, 0x43, 0x2c, 0xa8, 0xa8, 0xad, 0xbf, 0x81, 0x38, 0x45, 0x53, 0xc7, 0x9a, 0x5a, 0xa5, 0x20, 0x27, 0x49, 0xf3, 0x19, 0xbc,
+          0x16, 0x06, 0x9e, 0x7f, 0x67, 0xa1, 0x7c, 0xc4, 0x89, 0xc3, 0xd4, 0x6f, 0xde, 0x46, 0x74, 0xaa, 0xaf, 0x16, 0x1b, 0xfa, 0xea, 0x7b, 0xd6, 0x04,
+          0x3a, 0x5c, 0x72, 0x47, 0x22, 0x5e, 0x55, 0x8d, 0x4c, 0x2c, 0xe1, 0xae, 0x66, 0x8c, 0xe6, 0x2e, 0xec, 0xe5, 0x52, 0x2f, 0x72, 0x24, 0xde, 0x44,
+          0x06, 0x2e, 0xce, 0x9e, 0x73, 0x39, 0x3f, 0xa4, 0xab, 0xdb, 0x79, 0x13, 0xcd, 0x17, 0x38, 0xc2, 0x92, 0xd3, 0xbe, 0x68, 0xdc, 0xb7, 0x68, 0x05,
+          0xb9, 0x2c, 0x68, 0xba, 0xbc, 0x1c, 0x54, 0xbf, 0x2e, 0x8a, 0x05, 0xf6, 0xb0, 0xc1, 0x09, 0xa4, 0xe0, 0x40, 0x1e, 0x0e, 0x28, 0xb2, 0x2f, 0x5f,
+          0x7c, 0x2a, 0x24, 0x4e, 0xc0, 0x3e, 0x9b, 0x0d, 0xef, 0x9e, 0x48, 0x05, 0x89, 0x88, 0x02, 0xe3, 0xcc, 0xd7, 0xf2, 0x8c, 0x2f, 0x65, 0x86, 0x1f,
+          0xd3, 0x31, 0x53, 0xb0, 0x64, 0xc0, 0xf2, 0x91, 0xe8, 0x9d, 0x0b, 0x9f, 0x86, 0xce, 0x46, 0xe5, 0x3e, 0x5e, 0x3a, 0xa8, 0xd1, 0xa2, 0xec, 0x66,
+          0x06, 0xe1, 0x08, 0x08, 0x82, 0x08, 0x63, 0x91, 0x6d, 0x1e, 0x93, 0x61, 0x60, 0x2c, 0xf0, 0xb5, 0x8d, 0x27, 0x32, 0x3f, 0x53, 0xa7, 0xda, 0xe9,
+          0x2f, 0xda, 0xa5, 0x1e, 0xc4, 0xfa, 0x38, 0xcc, 0xf4, 0x73, 0xe2, 0xec, 0x6a, 0xe6, 0x4b, 0x3b, 0x9a, 0x44, 0xa5, 0xe9, 0xe6, 0xed, 0x01, 0xa5,
+          0xe2, 0x3b, 0x88, 0x04, 0xfd, 0xfd, 0xe5, 0xbb, 0x4d, 0xaf, 0xfa, 0xee, 0x52, 0x25, 0xfb, 0xe9, 0x7f, 0xe2, 0x53, 0x50, 0xc1, 0x2b, 0xf0, 0xf3,
+          0xda, 0xc9, 0x75, 0x5e, 0xce, 0x23, 0x1e, 0x3e, 0x57, 0x39, 0xa9, 0xf9, 0x47, 0x4e, 0x31, 0x21, 0xe7, 0x78, 0x6c, 0xee, 0xd5, 0x25, 0x18, 0x95,
+          0x78, 0x3d, 0xc3, 0x2e, 0x3c, 0x61, 0x3f, 0x58, 0x74, 0xf7, 0xd7, 0xe6, 0xab, 0x54, 0x05, 0x79, 0xcb, 0xb5, 0xe2, 0xa1, 0xfb, 0x3f, 0x79, 0x77,
+          0xba, 0x2b, 0x9c, 0xbf, 0x49, 0xbd, 0x07, 0x5f, 0x34, 0x58, 0xf1, 0xf4, 0xb4, 0x7d, 0xdc, 0xdf, 0xf4, 0x17, 0xbb, 0x08, 0xb9, 0xb5, 0xbf, 0xac,
+          0xfc, 0xd2, 0xe3, 0xc9, 0xdb, 0x98, 0xe6, 0x2b, 0x47, 0xec, 0x83, 0xd4, 0x17, 0x00, 0x30, 0x1e, 0x7b, 0x6d, 0xc1, 0xe8, 0xa0, 0x0f, 0xed, 0x7a,
+          0x25, 0x53, 0x0e, 0x1f, 0x23, 0x6c, 0x8d, 0xd3, 0xde, 0x03, 0xa6, 0x5b, 0xf8, 0x1e, 0xdd, 0xde, 0xac, 0xc5, 0xf5, 0xea, 0xf7, 0xeb, 0x40, 0xc4,
+          0x87, 0x67, 0x8b, 0xdd, 0x5a, 0xf0, 0xa3, 0xf0, 0xf9, 0xc8, 0x56, 0x3c, 0x9e, 0xf8, 0xc2, 0xa5, 0x6e, 0xc6, 0x4f, 0x71, 0x12, 0xde, 0xfb, 0x7c,
+          0xf2, 0xab, 0x12, 0x3d, 0x37, 0xcf, 0x7b, 0xe7, 0x5c, 0xad, 0xe2, 0x59, 0x2d, 0xd8, 0x7e, 0xca, 0xda, 0x2c, 0x96, 0x0c, 0x7e, 0xf9, 0xe2, 0xb7,
+          0xb3, 0x20, 0x84, 0x64, 0x48, 0xea, 0x99, 0xce, 0x44, 0xcf, 0xc8, 0x2c, 0x1e, 0x35, 0xc1, 0x86, 0x0c, 0x68, 0x71, 0xd1, 0xeb, 0x9f, 0x98, 0xdd,
+          0x1d, 0xf4, 0xe4, 0x2b, 0xd8, 0x9b, 0xb6, 0xe9, 0xce, 0xf4, 0x85, 0xeb, 0x35, 0xe9, 0xe9, 0x22, 0x21, 0x6c, 0xef, 0x84, 0x6a, 0x42, 0xf3, 0x89,
+          0xef, 0x8f, 0x56, 0xe2, 0x30, 0xdc, 0xaf, 0x72, 0xe0, 0xdd, 0x7b, 0x7c, 0xdd, 0xa9, 0xb2, 0x18, 0xe7, 0x96, 0x92, 0x02, 0x9b, 0xaf, 0xf7, 0x72,
+          0xc9, 0x27, 0x87, 0xd1, 0xad, 0xeb, 0x37, 0xc0, 0x09, 0x53, 0x20, 0x3d, 0x56, 0x79, 0xc4, 0xb3, 0x9c, 0xed, 0xdd, 0x56, 0x99, 0xad, 0xe2, 0x09,
+          0x9f, 0xe2, 0xbf, 0x22, 0x3e, 0x20, 0xbd, 0x96, 0x56, 0x79, 0x6b, 0xe6, 0x1f, 0x64, 0x41, 0xf2, 0x16, 0x64, 0x7c, 0xd7, 0x1d, 0x09, 0x8b, 0xf2,
+          0x31, 0x7a, 0x9d, 0x94, 0x83, 0xfc, 0x70, 0xfa, 0x0b, 0xc9, 0x8e, 0x7b, 0x4e, 0x82, 0x5f, 0x45, 0x57, 0x16, 0x3a, 0x0b, 0x6d, 0x74, 0xc9, 0x28,
+          0x90, 0x3a, 0xdf, 0xff, 0x21, 0xc0, 0x6a, 0xea, 0xe9, 0x46, 0x7c, 0x8b, 0x41, 0xca, 0xde, 0x1c, 0xe1, 0x70, 0x6f, 0x20, 0x92, 0xc2, 0x62, 0x45,
+          0x3e, 0xed, 0xa8, 0x35, 0x05, 0x07, 0x81, 0xd2, 0x08, 0x3f, 0xe3, 0x90, 0x12, 0x1e, 0x53, 0x0e, 0x4f, 0xdf, 0x1a, 0x62, 0x42, 0xde, 0x13, 0xf4,
+          0xa7, 0x28, 0x50, 0x49, 0x55, 0xdf, 0x4d, 0x96, 0xc9, 0x3d, 0x2b, 0x2a, 0xb1, 0x7f, 0x00, 0x2d, 0x4e, 0x0a, 0x04, 0xac, 0x2c, 0xb1, 0x4b, 0xfb,
+          0xb4, 0xa2, 0x0c, 0xb3, 0x7c, 0x7a, 0xf4, 0xaf, 0x0d, 0xef, 0xe7, 0x88, 0x57, 0xaa, 0x1b, 0xed, 0x95, 0x6a, 0x27, 0xb0, 0xd3, 0xf2, 0x95, 0xed,
+          0xbf, 0xad, 0x50, 0x0b, 0x2a, 0x8a, 0xab, 0xfa, 0x2d, 0xf7, 0x5c, 0x31, 0xed, 0x3f, 0x9e, 0x3f, 0x10, 0x53, 0xb3, 0x3c, 0x3c, 0x11, 0x50, 0xa2,
+          0x1d, 0xc0, 0x9d, 0x38, 0xea, 0xb0, 0x37, 0xfc, 0x7c, 0xfb, 0x68, 0x60, 0xc9, 0x70, 0x3d, 0xc3, 0xca, 0xe0, 0xd7, 0x19, 0x9d, 0xfb, 0xa9, 0x38,
+          0x5a, 0xef, 0xec, 0xd6, 0x28, 0x8a, 0xde, 0x79, 0x51, 0x89, 0x5d, 0x7b, 0x1a, 0xd6, 0xa8, 0x65, 0xbc, 0xd9, 0x7d, 0x59, 0x09, 0x95, 0xdc, 0x3f,
+          0x2e, 0xe0, 0xcc, 0x53, 0x6b, 0xae, 0x0d, 0xfa, 0xdb, 0x92, 0xa6, 0x32, 0xb2, 0xdb, 0xd2, 0xf5, 0x04, 0x41, 0x1f, 0x90, 0xcb, 0x1b, 0x35, 0x9d,
+          0x3d, 0xa6, 0xfd, 0x08, 0xdc, 0xe0, 0xb6, 0x5b, 0xf7, 0xb3, 0x1f, 0x4c, 0x26, 0x2b, 0xd4, 0x5d, 0x70, 0x3d, 0xb7, 0xac, 0x20, 0x35, 0x27, 0x29,
+          0x20, 0xbe, 0x8a, 0x4b, 0x1e, 0x0c, 0xf3, 0xfe, 0x00, 0x24, 0x0f, 0x82, 0x79, 0xca, 0xc3, 0x5e, 0x06, 0x7e, 0x61, 0x42, 0x06, 0x49, 0x98, 0x9a,
+          0x8e, 0x2a, 0x26, 0xb5, 0xd1, 0x0e, 0x6c, 0xac, 0xe7, 0x0e, 0x51, 0x63, 0x03, 0x5f, 0xef, 0x56, 0x53, 0x21, 0x9d, 0x93, 0x40, 0xe5, 0xa9, 0x78,
+          0x28, 0x41, 0xd0, 0x00, 0xe3, 0x4a, 0x0b, 0x04, 0xa4, 0xfd, 0xb5, 0x37, 0xd4, 0xa6, 0x0e, 0x0e, 0xef, 0x1c, 0x07, 0x52, 0x40, 0x4a, 0x6e, 0xf9,
+          0x52, 0x44, 0xab, 0x46, 0xd7, 0x49, 0xb4, 0xc3, 0xe3, 0x64, 0x8a, 0x59, 0xa5, 0x3b, 0x6a, 0x3a, 0xf6, 0x95, 0x3f, 0xda, 0xbd, 0xbf, 0xb8, 0x73,
+          0xf5, 0x44, 0x68, 0x74, 0x5b, 0x9c, 0x3c, 0x73, 0x85, 0x2a, 0xa8, 0xce, 0x58, 0x29, 0xe9, 0x2a, 0x69, 0x96, 0xf3, 0x47, 0x27, 0x04, 0x20, 0x5b,
+          0x79, 0x02, 0x89, 0x7c, 0x50, 0x2a, 0x59, 0x21, 0x1a, 0xfe, 0x3e, 0x15, 0x7f, 0x08, 0xdd, 0x41, 0xc2, 0x5f, 0x60, 0xa5, 0x79, 0xcd, 0x2d, 0x25,
+          0xd5, 0x07, 0xee, 0xef, 0x63, 0x25, 0xa4, 0xf9, 0xab, 0x28, 0xc9, 0xc6, 0xbf, 0x95, 0x25, 0x25, 0xcb, 0xbc, 0xfa, 0xfb, 0x20, 0x97, 0xfc, 0xd2,
+          0x8e, 0x4a, 0xfd, 0xcd, 0xd3, 0x27, 0xe2, 0x7e, 0x5f, 0xc5, 0xd6, 0xa7, 0xdb, 0x7f, 0x72, 0xd7, 0xaf, 0x16, 0x31, 0xce, 0xb7, 0xbf, 0x77, 0x9e,
+          0x5d, 0x81, 0xe7, 0xe7, 0x8a, 0xde, 0xdd, 0xe7, 0x6b, 0xdf, 0x99, 0xd8, 0xce, 0x57, 0xb0, 0xc1, 0x0a, 0xb1, 0x85, 0x2c, 0xf3, 0x75, 0x8a, 0x9a,
+          0x87, 0x5a, 0xee, 0x53, 0xf2, 0x68, 0xf6, 0xb4, 0x6c, 0xe2, 0x9b, 0x19, 0x85, 0xcc, 0x2c, 0x07, 0xf8, 0x56, 0x57, 0x16, 0xb1, 0xd6, 0xee, 0xff,
+          0x5f, 0xac, 0x04, 0xfd, 0x00, 0xa6, 0xbb, 0xfd, 0x80, 0x4a, 0xbb, 0xff, 0x80, 0x9a, 0xe3, 0xfc, 0x54, 0x8a, 0x94, 0xa2, 0x8b, 0x72, 0xdb, 0x95,
+          0x87, 0x02, 0x48, 0x21, 0x17, 0x31, 0x91, 0xe5, 0x1a, 0x73, 0x31, 0x99, 0x24, 0xd0, 0x14, 0x0a, 0xec, 0x14, 0x55, 0xac, 0x66, 0x44, 0x77, 0x02,
+          0x97, 0xa0, 0x0b, 0x5a, 0x2c, 0xeb, 0xc5, 0x52, 0x00, 0x99, 0xdd, 0x80, 0x0a, 0x70, 0x3c, 0x16, 0xbf, 0x09, 0x80, 0x91, 0x56, 0xb1, 0xf3, 0x03,
+          0xcf, 0x24, 0x5d, 0x4c, 0x1b, 0xb0, 0xbb, 0xbc, 0xe2, 0x8f, 0xdf, 0x96, 0x73, 0x56, 0xc4, 0x65, 0xb9, 0x63, 0x75, 0x90, 0x2d, 0x56, 0xd3, 0x2c,
+          0xad, 0x6a, 0x4a, 0xec, 0xc8, 0x03, 0xfb, 0x3b, 0x7c, 0x52, 0xbb, 0xf9, 0x55, 0xf3, 0xb7, 0x6a, 0x5b, 0xa8, 0xb3, 0x93, 0x2e, 0x99, 0xd0, 0xb2,
+          0x60, 0x56, 0x55, 0xfd, 0x2e, 0x80, 0x11, 0x9a, 0x0c, 0xb0, 0xad, 0xaa, 0x76, 0xc8, 0x9a, 0x83, 0x61, 0x38, 0x27, 0x92, 0x83, 0x4e, 0x38, 0x8f,
+          0x83, 0xc8, 0x32, 0xbb, 0xbe, 0x87, 0x70, 0x27, 0x0d, 0xb1, 0xb3, 0x9e, 0x3c, 0x0c, 0x02, 0xd3, 0xac, 0x52, 0x10, 0x07, 0xe6, 0xba, 0xc5, 0x1f,
+          0xe7, 0x26, 0x5e, 0x88, 0x7a, 0x4a, 0x46, 0x75, 0xb4, 0x64, 0x3f, 0x79, 0x31, 0x71, 0x43, 0x7a, 0x04, 0x26, 0x80, 0x7a, 0x4e, 0xa3, 0x78, 0x5e,
+          0xd7, 0x10, 0x26, 0x95, 0x87, 0x8a, 0x2e, 0x2e, 0x7d, 0xa7, 0x5d, 0xa8, 0x0b, 0xf7, 0xa2, 0x38, 0xee, 0x37, 0x0b, 0xed, 0x7d, 0x44, 0xba, 0xdb,
+          0x30, 0x8f, 0xfa, 0x6a, 0x5e, 0x6b, 0x76, 0x02, 0x9d, 0xbd, 0x6e, 0x84, 0xdd, 0x16, 0xf1, 0x92, 0xd2, 0xfd, 0x3f, 0xff, 0xdf, 0xa4, 0xc0, 0x8f,
+          0xc1, 0x87, 0xdc, 0xf8, 0x7b, 0x26, 0x8f, 0x20, 0xfd, 0x60, 0x33, 0x7d, 0x47, 0x25, 0xd7, 0x4e, 0xd4, 0xd7, 0x38, 0x53, 0x00, 0xf7, 0xd8, 0xc7,
+          0x8e, 0xf5, 0x6a, 0x1b, 0x71, 0x64, 0xbd, 0x7c, 0xd7, 0xa0, 0x86, 0xbe, 0xba, 0xaf, 0x8d, 0x6e, 0x6f, 0xd3, 0xf3, 0x8e, 0xae, 0x01, 0x98, 0xef,
+          0x51, 0x80, 0xcc, 0xf4, 0x78, 0x26, 0x30, 0xad, 0x16, 0xd2, 0xcd, 0xeb, 0xf7, 0x03, 0x62, 0x7c, 0x67, 0xac, 0xaa, 0xce, 0xcf, 0x46, 0xba, 0x5a,
+          0x91, 0xf9, 0x1f, 0x36, 0x27, 0x7e, 0x10, 0x0f, 0xe9, 0xde, 0xab, 0x1f, 0xfa, 0xbd, 0x2a, 0x6e, 0x1d, 0x32, 0xbb, 0xff, 0xc8, 0xef, 0x9a, 0xb4,
+          0xfa, 0x6a, 0x36, 0xe1, 0xdd, 0x67, 0xec, 0xdc, 0xeb, 0x1c, 0x0a, 0x8f, 0x33, 0x5a, 0xae, 0x49, 0x9b, 0xfd, 0xa1, 0xd5, 0x1f, 0x7f, 0x54, 0x83,
+          0xab, 0xae, 0x6c, 0x90, 0xc7, 0x72, 0xdd, 0xb0, 0xff, 0x4c, 0x66, 0xa6, 0xcb, 0x2d, 0x77, 0x3c, 0x5e, 0x78, 0x8c, 0x8e, 0xcb, 0x4b, 0xf6, 0xf3,
+          0x33, 0x3c, 0xee, 0x38, 0x4b, 0xe3, 0x8e, 0xb3, 0x28, 0xee, 0xfc, 0xbc, 0x88, 0x8b, 0x65, 0x4a, 0xd1, 0x91, 0x2b, 0xd1, 0xa0, 0xcd, 0xd6, 0x49,
+          0x41, 0x93, 0x59, 0xde, 0xb9, 0x8b, 0xa9, 0x71, 0x75, 0xaa, 0xe7, 0xa8, 0xbb, 0x1d, 0x95, 0xd2, 0x05, 0x8a, 0x8e, 0x8d, 0xf3, 0xac, 0x86, 0x9b,
+          0xe1, 0xa5, 0x97, 0xf9, 0x99, 0x85, 0x76, 0x1a, 0x2e, 0xa1, 0x1d, 0xe1, 0xc3, 0x59, 0xbd, 0x43, 0x42, 0xec, 0xd8, 0x74, 0x28, 0xfe, 0x7e, 0x35,
+          0x44, 0x1a, 0x4b, 0xff, 0x03, 0x8b, 0x12, 0x75, 0xd5, 0x3c, 0x27, 0x3f, 0x44, 0x5d, 0x6e, 0xe1, 0x93, 0x05, 0x09, 0x63, 0xde, 0x79, 0x06, 0xb3,
+          0xd5, 0x8a, 0xda, 0x01, 0x78, 0x74, 0xfd, 0x5c, 0xa0, 0x15, 0x47, 0x93, 0xda, 0x5c, 0x8a, 0x0b, 0xef, 0xec, 0x43, 0xcc, 0x6f, 0xd8, 0x75, 0xbe,
+          0x9e, 0x7a, 0x41, 0x32, 0x9c, 0x6d, 0x25, 0xb3, 0xaf, 0xe4, 0x35, 0x42, 0x7d, 0x4b, 0xa3, 0xce, 0xba, 0xe8, 0x93, 0x03, 0xce, 0x34, 0x15, 0x7f,
+          0x73, 0x46, 0x90, 0x53, 0x3b, 0x69, 0xfd, 0x11, 0x16, 0x95, 0x3d, 0xba, 0xdb, 0x19, 0x07, 0xb7, 0x57, 0x9d, 0x31, 0x15, 0xfe, 0x6a, 0x90, 0xfb,
+          0x78, 0xd9, 0x06, 0xb8, 0xc7, 0xd0, 0x66, 0xe6, 0x03, 0x5e, 0x94, 0x50, 0xa2, 0x1d, 0x99, 0x29, 0xd6, 0xc9, 0xd1, 0x37, 0x7d, 0xd3, 0x37, 0x50,
+          0x4e, 0x11, 0xe9, 0x40, 0xec, 0x06, 0x2c, 0xf6, 0xf3, 0xe3, 0x8c, 0x0f, 0xcd, 0x6e, 0x53, 0xe7, 0xa5, 0x08, 0xe0, 0x92, 0xc5, 0x07, 0x9b, 0x3f,
+          0x95, 0xe1, 0x92, 0xe6, 0x79, 0x68, 0x7d, 0x8b, 0x95, 0xf3, 0x0b, 0xdf, 0xc6, 0x6f, 0x1a, 0x5c, 0x3e, 0xe8, 0x12, 0x3d, 0xe3, 0xa0, 0x77, 0xda,
+          0xb8, 0xac, 0x6b, 0x8c, 0x99, 0x93, 0xf7, 0x95, 0x77, 0x8a, 0xef, 0x95, 0x77, 0x8d, 0xe7, 0x95, 0x61, 0x87, 0xda, 0x71, 0x18, 0xdd, 0xde, 0x25,
+          0x3b, 0x95, 0x42, 0x37, 0x82, 0x64, 0xb4, 0xab, 0x29, 0xf2, 0xb7, 0x4d, 0x0d, 0xb7, 0x20, 0x06, 0x14, 0x13, 0x7b, 0xee, 0x04, 0x87, 0x2b, 0x0b,
+          0xea, 0x89, 0xd5, 0x7a, 0xfa, 0x0c, 0x55, 0x29, 0x58, 0x76, 0x05, 0x3e, 0x99, 0x7e, 0xa0, 0xd8, 0x20, 0x97, 0x2e, 0x2f, 0xff, 0xf2, 0x30, 0xda,
+          0x47, 0xf4, 0xdd, 0xb4, 0x7e, 0xd3, 0x73, 0x17, 0x02, 0xea, 0x7d, 0x77, 0xa7, 0x82, 0xc1, 0x43, 0xd3, 0x70, 0x8b, 0x7e, 0x53, 0x64, 0x17, 0xc3,
+          0x81, 0x9a, 0xea, 0xfe, 0xd4, 0x39, 0x99, 0xac, 0xfa, 0x9b, 0x27, 0x7c, 0x50, 0x3d, 0x37, 0xef, 0x53, 0xb3, 0x8b, 0xfb, 0xc6, 0x8d, 0x41, 0x7a,
+          0x93, 0x2c, 0x8c, 0xfb, 0xff, 0xfe, 0x95, 0xa0, 0x1f, 0xd5, 0x0a, 0xab, 0x92, 0x8b, 0xd7, 0x33, 0xbc, 0xaf, 0x03, 0x26, 0x67, 0xfd, 0x5a, 0x5d,
+          0xba, 0xd8, 0x54, 0xe8, 0x9a, 0x07, 0xce, 0xcc, 0xfb, 0x37, 0x4a, 0xc5, 0xff, 0x11, 0x86, 0x9b, 0x77, 0x62, 0xdd, 0x3d, 0xb4, 0xaf, 0xa5, 0xff,
+          0x72, 0x5c, 0x92, 0x7c, 0x98, 0x6b, 0xe2, 0xb9, 0xe4, 0xa2, 0x23, 0x0b, 0x1e, 0xcc, 0x25, 0x56, 0xc4, 0x95, 0x4c, 0x88, 0x3b, 0xb8, 0x10, 0x8f,
+          0xb5, 0xf0, 0xae, 0x62, 0xb9, 0x48, 0x0c, 0xed, 0x7c, 0x0c, 0x34, 0x92, 0x17, 0xc6, 0xdc, 0x85, 0xa0, 0x35, 0xd0, 0xc7, 0xa9, 0x43, 0x3a, 0xa9,
+          0x02, 0x55, 0x91, 0xe8, 0x1e, 0x0c, 0xb0, 0xa7, 0xe9, 0x1f, 0x21, 0x83, 0xa3, 0x00, 0xf7, 0xba, 0x0a, 0xad, 0x72, 0xee, 0xe6, 0x70, 0xc6, 0x26,
+          0x76, 0x4a, 0x36, 0x62, 0x67, 0x3d, 0xe8, 0xdd, 0xb1, 0xbc, 0xfe, 0x01, 0xb3, 0xe8, 0xa7, 0x8b, 0xf2, 0x8b, 0xb3, 0x65, 0xa9, 0xc6, 0x3a, 0xeb,
+          0xd3, 0x19, 0xf9, 0x16, 0xa4, 0x43, 0x63, 0x59, 0xdf, 0xc4, 0x9e, 0x68, 0x6a, 0x36, 0x17, 0x86, 0x3f, 0x23, 0x59, 0x89, 0x02, 0x04, 0x2d, 0x7b,
+          0xf0, 0x49, 0x35, 0xb6, 0x0c, 0x0c, 0xa5, 0xc1, 0x36, 0x7b, 0xad, 0xb0, 0x20, 0x2b, 0xdc, 0xb4, 0xff, 0x80, 0x7d, 0x7b, 0xf7, 0x2f, 0x62, 0xbf,
+          0xb8, 0xf3, 0xf7, 0x85, 0xf9, 0x7b, 0x59, 0xbf, 0x1c, 0x8a, 0x36, 0x85, 0x47, 0x2e, 0x5a, 0xef, 0x4d, 0x7e, 0xdd, 0x54, 0x13, 0x83, 0x39, 0x5d,
+          0x7f, 0x81, 0xfb, 0xcf, 0x12, 0xb5, 0x26, 0xa7, 0x8f, 0x36, 0x06, 0x16, 0x82, 0xe8, 0x47, 0xef, 0x83, 0xb7, 0x1c, 0x2a, 0xca, 0x0f, 0x6e, 0x34,
+          0x34, 0x46, 0xbc, 0x46, 0x24, 0x72, 0xb4, 0xb9, 0x89, 0xd8, 0xaa, 0x88, 0x9a, 0x3f, 0x88, 0x77, 0x6e, 0x63, 0x1c, 0x96, 0xa1, 0xdf, 0x41, 0x98,
+          0xcd, 0xb4, 0xe3, 0xc8, 0xa0, 0x44, 0x0f, 0x72, 0x56, 0x49, 0x39, 0xf6, 0x4a, 0x18, 0xdc, 0x42, 0xc1, 0x03, 0xd5, 0x7d, 0x30, 0x8d, 0xbe, 0xf4,
+          0x72, 0x80, 0xd9, 0xdf, 0x79, 0xad, 0xe1, 0x7a, 0x4f, 0x25, 0xee, 0x71, 0xc2, 0xbd, 0x33, 0x63, 0x9e, 0xc5, 0x52, 0x04, 0xdf, 0x71, 0x91, 0x4c,
+          0x21, 0x82, 0x00, 0x50, 0x9b, 0x3e, 0xba, 0xbf, 0x3c, 0x2b, 0x68, 0x2b, 0xd3, 0x13, 0x61, 0xca, 0x11, 0xe6, 0xee, 0xe5, 0x83, 0x80, 0xa2, 0x39,
+          0xdc, 0xf1, 0x87, 0x99, 0xec, 0xb0, 0x77, 0x13, 0xcd, 0xb8, 0xc1, 0xb2, 0x92, 0x9f, 0x5c, 0xab, 0x89, 0xa5, 0x7b, 0xa4, 0x96, 0xca, 0xf2, 0x44,
+          0x73, 0x94, 0xfa, 0x93, 0x9d, 0x0d, 0xda, 0x47, 0x09, 0x95, 0x06, 0xbf, 0x09, 0x7b, 0xd5, 0xe6, 0x23, 0xc5, 0x58, 0xc6, 0x93, 0xb1, 0x8c, 0x97,
+          0x60, 0x6b, 0x27, 0x50, 0x3c, 0x40, 0x20, 0x29, 0xc7, 0xc5, 0x60, 0x67, 0xf3, 0x86, 0xc5, 0x38, 0x40, 0x55, 0x3a, 0x2e, 0x6a, 0x56, 0x47, 0xe4,
+          0xd3, 0xea, 0x62, 0x69, 0x40, 0xa6, 0xaf, 0x90, 0xb4, 0xba, 0xe3, 0xba, 0x4a, 0xa5, 0xeb, 0x2f, 0x7a, 0xdd, 0xcd, 0x63, 0x79, 0xbb, 0x09, 0xf3,
+          0xe1, 0x09, 0x93, 0xaa, 0x39, 0x62, 0xef, 0x71, 0x86, 0x8f, 0x23, 0x4d, 0xaf, 0x96, 0xf7, 0x60, 0x23, 0x4c, 0x4b, 0x0c, 0x06, 0xa6, 0xaf, 0x79,
+          0x60, 0x8b, 0x6d, 0xf0, 0x03, 0xd8, 0x7e, 0x7c, 0xb0, 0xd2, 0x0f, 0x4f, 0x35, 0x3e, 0xf0, 0xc2, 0x4d, 0x62, 0x0b, 0x95, 0xac, 0x7b, 0xed, 0x9b,
+          0xb2, 0x17, 0x37, 0xde, 0xea, 0x68, 0x8f, 0x84, 0xc5, 0x2c, 0x0d, 0x82, 0x26, 0x37, 0x4e, 0x68, 0xc0, 0x43, 0x1f, 0x1f, 0xc0, 0xef, 0xff, 0x3e,
+          0x78, 0xfb, 0xff, 0xe0, 0xe8, 0x76, 0xd0, 0x3c, 0x86, 0x39, 0xae, 0x8b, 0x3b, 0x0f, 0xa9, 0xc8, 0x5a, 0x72, 0x8e, 0x56, 0x71, 0x3a, 0xd5, 0xf7,
+          0xfa, 0x6b, 0x6f, 0x57, 0x35, 0x98, 0x7c, 0x7f, 0xe1, 0xf9, 0x88, 0x16, 0xe4, 0x45, 0xe1, 0x9d, 0xb8, 0xbc, 0x36, 0x10, 0x8f, 0xcc, 0x38, 0xf7,
+          0xd3, 0x9e, 0x63, 0xd6, 0x7d, 0xfc, 0x3d, 0x07, 0xf6, 0xdc, 0xa4, 0x1a, 0x7d, 0x60, 0xa2, 0xed, 0xea, 0x78, 0x25, 0xbe, 0xb3, 0x2f, 0xdf, 0xef,
+          0xc3, 0xc4, 0x2c, 0x38, 0xbe, 0xef, 0x94, 0xda, 0x54, 0x02, 0x47, 0x35, 0xb1, 0x49, 0xee, 0xdd, 0x7c, 0x94, 0xf3, 0x4a, 0x50, 0xfd, 0x15, 0x2f,
+          0xcf, 0xec, 0x1c, 0x37, 0x53, 0xc0, 0x34, 0xc3, 0xad, 0xa5, 0x5f, 0xed, 0x24, 0x7c, 0xb7, 0xfb, 0x26, 0xba, 0x61, 0xff, 0xc1, 0x0e, 0xdf, 0x1a,
+          0x7e, 0x3a, 0xb1, 0xb9, 0xee, 0x23, 0x1d, 0x2e, 0x7f, 0x55, 0x4e, 0xc0, 0x30, 0xed, 0x14, 0xdd, 0x46, 0x18, 0x10, 0x97, 0x10, 0xb1, 0xfd, 0xbc,
+          0xfc, 0x56, 0x12, 0x64, 0xff, 0xff, 0x54, 0x0e, 0x88, 0x0e, 0x37, 0x05, 0x2e, 0xa3, 0xd5, 0x9f, 0xff, 0x69, 0x88, 0xaf, 0x21, 0xdc, 0x12, 0x6b,
+          0xab, 0x11, 0x3a, 0x80, 0xf5, 0x34, 0xa4, 0x54, 0x4f, 0x33, 0x82, 0x7e, 0xba, 0xc3, 0x3b, 0xef, 0xcc, 0x90, 0x7f, 0x4c, 0x2a, 0x7a, 0xb3, 0x05,
+          0x48, 0x27, 0xcf, 0x20, 0x19, 0x10, 0x3e, 0x68, 0x49, 0xe5, 0x77, 0x84, 0x4b, 0xc3, 0xb6, 0x35, 0x9c, 0xcc, 0xc1, 0x1a, 0x64, 0x34, 0x4c, 0x70,
+          0x20, 0x5e, 0xa8, 0x42, 0x07, 0xef, 0x63, 0xb6, 0x3e, 0x05, 0x53, 0x65, 0xe1, 0x92, 0xb1, 0x04, 0x0d, 0x60, 0x05, 0x66, 0xec, 0x8c, 0xdd, 0x8c,
+          0x1b, 0x69, 0xaf, 0x37, 0x3a, 0x68, 0xfb, 0x6b, 0x1c, 0x64, 0x63, 0x12, 0xe8, 0xc6, 0x57, 0xed, 0x33, 0xd2, 0x84, 0x9a, 0x03, 0x87, 0x0e, 0x9d,
+          0xe6, 0x59, 0xe3, 0x98, 0x93, 0xf2, 0x97, 0x30, 0xff, 0x6e, 0xe1, 0x0d, 0xaa, 0x47, 0x0f, 0x2c, 0x9b, 0xef, 0x31, 0x74, 0xd2, 0x69, 0x8d, 0x4f,
+          0x52, 0xfe, 0x12, 0xe6, 0xef, 0xda, 0x57, 0xac, 0xe6, 0x43, 0x49, 0xac, 0x50, 0x8e, 0x34, 0xdc, 0x30, 0x7e, 0x01, 0x2b, 0x9a, 0xb0, 0x6c, 0xde,
+          0x89, 0xcf, 0x97, 0xad, 0xe9, 0x5f, 0x90, 0xce, 0x8f, 0x3b, 0xe7, 0x1a, 0x9b, 0xe2, 0x12, 0x61, 0xb3, 0xba, 0xc5, 0x09, 0xe2, 0x58, 0xbc, 0x67,
+          0x36, 0xf5, 0x8e, 0x44, 0x26, 0x73, 0xaf, 0x9b, 0x55, 0x4d, 0xa8, 0xc7, 0xf4, 0xf1, 0xd4, 0x48, 0xfc, 0x32, 0x9a, 0x82, 0xc7, 0x47, 0x54, 0x13,
+          0xd8, 0xa9, 0x56, 0xfc, 0x5b, 0xe4, 0x2d, 0x5a, 0x63, 0x60, 0xe2, 0xf6, 0x80, 0x09, 0x02, 0xc9, 0x99, 0x9d, 0xdb, 0x80, 0x2a, 0x02, 0x1e, 0xf3,
+          0xf8, 0xf3, 0x03, 0xca, 0x48, 0xf9, 0xcb, 0x54, 0xa8, 0x67, 0x07, 0xe8, 0xa3, 0xef, 0x57, 0x11, 0xbd, 0x6b, 0xfe, 0x09, 0x43, 0x1f, 0x00, 0x55,
+          0xf5, 0x1a, 0x24, 0xf1, 0xe5, 0x82, 0xe7, 0x39, 0x6d, 0xc2, 0x9b, 0x38, 0x83, 0x70, 0x95, 0x86, 0xfb, 0x05, 0xc9, 0x0d, 0xfd, 0xb8, 0xb9, 0x66,
+          0xbc, 0x63, 0x56, 0x27, 0x44, 0xd0, 0xfc, 0xce, 0xe6, 0x48, 0x85, 0x9d, 0xcc, 0x0c, 0x91, 0xec, 0x4c, 0x8e, 0x50, 0xa8, 0x01, 0xe5, 0xf2, 0x2a,
+          0xdf, 0x69, 0xeb, 0x9c, 0xdd, 0xea, 0x60, 0xc5, 0x5b, 0xb5, 0x03, 0x46, 0xbc, 0x14, 0x12, 0xf9, 0x6c, 0xde, 0x14, 0x44, 0xbb, 0x44, 0xa8, 0x32,
+          0xbc, 0x86, 0x89, 0xd7, 0x3c, 0x8e, 0x97, 0xa4, 0xc1, 0x37, 0x9a, 0x72, 0x63, 0xc9, 0x4c, 0x95, 0xa3, 0xa6, 0x07, 0x4a, 0x40, 0xf6, 0xdc, 0x28,
+          0x19, 0xa5, 0xf7, 0x83, 0xba, 0x3f, 0x21, 0x4d, 0x11, 0x7d, 0x46, 0x78, 0xea, 0xa1, 0x0b, 0x90, 0xf9, 0xd5, 0x71, 0x6e, 0x54, 0x2d, 0xaa, 0xd6,
+          0x96, 0x44, 0xbc, 0x29, 0x50, 0x97, 0x56, 0xa0, 0x53, 0x1c, 0x89, 0x01, 0xed, 0xf6, 0x07, 0x03, 0x41, 0x36, 0xa8, 0x0f, 0x21, 0x16, 0x5b, 0xdd,
+          0x2d, 0xff, 0xbb, 0x1c, 0x42, 0x93, 0xdb, 0x7f, 0xc5, 0x39, 0xa3, 0xe4, 0xfa, 0xe5, 0x78, 0x64, 0x86, 0x71, 0x6b, 0x20, 0x9b, 0x64, 0x87, 0x34,
+          0x69, 0x84, 0x70, 0x73, 0x06, 0x42, 0x28, 0x6a, 0x65, 0x36, 0x47, 0xe0, 0xfa, 0x94, 0x7d, 0xb0, 0x1a, 0x9e, 0x81, 0xfb, 0xe7, 0xf2, 0x01, 0x28,
+          0x72, 0x51, 0x55, 0x2c, 0x89, 0xaf, 0x7b, 0x19, 0x3e, 0x8a, 0x28, 0x7e, 0x94, 0x37, 0x1e, 0x83, 0x01, 0x25, 0x87, 0x85, 0xf1, 0x89, 0x17, 0xbf,
+          0xc5, 0xcd, 0x36, 0x77, 0xb9, 0xc3, 0x21, 0x64, 0x3e, 0xc3, 0x62, 0x8a, 0x30, 0xaa, 0x17, 0x1b, 0x9c, 0xb2, 0xf2, 0xef, 0xc9, 0x11, 0xd5, 0x45,
+          0xce, 0x67, 0x37, 0xc8, 0xb3, 0x62, 0x4e, 0xd7, 0xc7, 0xb7, 0x3b, 0x65, 0xbe, 0x87, 0x27, 0x92, 0x42, 0xe7, 0x0f, 0x9d, 0x86, 0xdf, 0x4e, 0xac,
+          0xfa, 0x07, 0x8e, 0x70, 0x98, 0x42, 0xe4, 0x73, 0xa8, 0x73, 0x91, 0x4e, 0xc7, 0xa7, 0x1b, 0x5d, 0xe4, 0x2a, 0x4e, 0xec, 0xf7, 0x91, 0x2e, 0x1a,
+          0x39, 0xbb, 0xdf, 0x8c, 0x56, 0x9b, 0x85, 0xf6, 0xea, 0xba, 0xda, 0xe9, 0x36, 0x0c, 0xe8, 0x25, 0x9d, 0xa4, 0xf5, 0xfb, 0x5d, 0x8e, 0x2f, 0xf3,
+          0xc9, 0x08, 0x8a, 0x26, 0xf3, 0x29, 0x44, 0x41, 0xaf, 0x88, 0xbe, 0x9c, 0xf4, 0xd1, 0x04, 0xd5, 0x32, 0x72, 0x9e, 0x91, 0x6e, 0xb1, 0x04, 0x21,
+          0xfc, 0x50, 0xe0, 0xeb, 0x22, 0x83, 0x75, 0x99, 0x48, 0x91, 0x4e, 0x0f, 0xfa, 0x50, 0xd8, 0x9a, 0x1e, 0xa3, 0x0b, 0xa6, 0x80, 0x22, 0x42, 0x96,
+          0x15, 0x52, 0xf1, 0x23, 0x31, 0xa7, 0x81, 0x1c, 0xf1, 0x47, 0x31, 0x73, 0xba, 0xe6, 0x97, 0x74, 0xdc, 0x71, 0x4f, 0x17, 0x8f, 0xa2, 0x11, 0x4b,
+          0x99, 0xa1, 0x7e, 0x0c, 0x20, 0x9e, 0xef, 0x66, 0x8c, 0x32, 0x35, 0x44, 0xee, 0x29, 0x05, 0xf3, 0xac, 0xa1, 0x33, 0xbd, 0x6d, 0x8e, 0x02, 0x67,
+          0xa2, 0xca, 0xf5, 0x61, 0xbd, 0x8b, 0x5c, 0x86, 0x07, 0xf5, 0x10, 0x3b, 0x5c, 0x48, 0x92, 0x7f, 0x67, 0x44, 0xff, 0xcd, 0xe4, 0x93, 0x0b, 0x0e,
+          0xab, 0xee, 0x35, 0x0d, 0xf4, 0xd5, 0x08, 0xe5, 0x91, 0xd1, 0xbc, 0x32, 0x6d, 0xe9, 0xc9, 0x6d, 0x80, 0x3c, 0x3b, 0x7d, 0x54, 0xa5, 0x46, 0xc8,
+          0x8c, 0x2b, 0x9d, 0x9f, 0x39, 0xae, 0x97, 0x7e, 0xe8, 0x3a, 0xaa, 0xe4, 0x17, 0x8d, 0x3e, 0x55, 0x74, 0x6a, 0x95, 0x53, 0x57, 0xfb, 0x1e, 0xac,
+          0x23, 0xfd, 0xd4, 0x00, 0x18, 0x62, 0x09, 0x31, 0xe4, 0x7a, 0xd0, 0x0c, 0x72, 0x59, 0xbd, 0x3a, 0xf0, 0xf4, 0x09, 0x97, 0xbc, 0x8a, 0x12, 0xfe,
+          0x9b, 0x57, 0xf4, 0x6d, 0xa2, 0xa9, 0xa4, 0x6a, 0xac, 0xbe, 0xff, 0xc2, 0x92, 0xa8, 0xe4, 0x2a, 0x2e, 0x59, 0x17, 0xaf, 0x57, 0xb0, 0x08, 0x14,
+          0x97, 0xee, 0xea, 0xff, 0xd3, 0xc2, 0xd8, 0x88, 0x79, 0x2c, 0xdc, 0xcf, 0xfe, 0x4a, 0x35, 0x73, 0x25, 0x17, 0x01, 0x27, 0x6b, 0x6f, 0x28, 0x02,
+          0x69, 0x53, 0xa9, 0x80, 0x33, 0xc7, 0xfa, 0x4d, 0x8e, 0x44, 0x7a, 0x99, 0x8a, 0x0e, 0xb0, 0x0c, 0xee, 0x55, 0x44, 0x5d, 0x07, 0x03, 0x4b, 0x79,
+          0xc7, 0xf3, 0xd4, 0xb8, 0xa0, 0x37, 0xb9, 0x19, 0xa6, 0x7b, 0x2f, 0x5d, 0xec, 0x3b, 0x22, 0x12, 0xd4, 0x67, 0x97, 0x8e, 0xad, 0x33, 0x44, 0x8f,
+          0xce, 0x8e, 0xb6, 0xc6, 0x50, 0x9e, 0x0d, 0x6c, 0xb8, 0x69, 0x86, 0x06, 0x32, 0xd8, 0xcc, 0xa8, 0x62, 0x36, 0x39, 0x47, 0x66, 0x3f, 0x63, 0x1d,
+          0x77, 0x7e, 0x72, 0xdf, 0xf1, 0xda, 0x69, 0x85, 0xd8, 0x05, 0xcd, 0xcb, 0xce, 0xc7, 0x6c, 0x82, 0xa6, 0x2b, 0x2f, 0xee, 0xe4, 0xdc, 0x27, 0x54,
+          0x48, 0x53, 0x92, 0xa4, 0x97, 0x83, 0x4f, 0xd7, 0x51, 0x6d, 0xf2, 0x1f, 0xa0, 0x60, 0x66, 0x39, 0xb3, 0xab, 0xcc, 0xce, 0xdb, 0x1e, 0x1f, 0xc5,
+          0x40, 0x9a, 0xef, 0xc0, 0x59, 0x2c, 0x57, 0xb9, 0xe4, 0xe6, 0xf6, 0x89, 0x30, 0x35, 0xbe, 0xca, 0x84, 0x95, 0xfb, 0x02, 0xe8, 0xa8, 0x07, 0x20,
+          0xae, 0x9f, 0x4e, 0xc2, 0x45, 0xd3, 0xf9, 0x21, 0x4b, 0xcc, 0x26, 0xc9, 0x68, 0xfb, 0x3e, 0xe4, 0x60, 0xaa, 0xdc, 0xb1, 0x0c, 0xcb, 0x8d, 0xbb,
+          0x9a, 0x8e, 0x66, 0xa4, 0x21, 0x64, 0x1b, 0xee, 0xdf, 0xd5, 0x84, 0x94, 0x7d, 0x11, 0x38, 0x6e, 0xf2, 0x7b, 0x54, 0x0f, 0x12, 0xcf, 0x17, 0xed,
+          0x28, 0xa8, 0x7f, 0x55, 0x12, 0x82, 0x5b, 0x02, 0xdf, 0xae, 0xa4, 0x07, 0xba, 0x44, 0xca, 0xd2, 0xdc, 0xc1, 0xa7, 0xee, 0x0a, 0x79, 0xf6, 0x2c,
+          0xc6, 0x48, 0x2c, 0xc6, 0x62, 0x98, 0x56, 0xfc, 0x86, 0x04, 0x79, 0x53, 0xc1, 0xa9, 0x97, 0xfa, 0x04, 0x99, 0xb1, 0xde, 0x2a, 0x01, 0xa1, 0x0a,
+          0x48, 0x41, 0x3f, 0x31, 0xd3, 0xed, 0x44, 0x94, 0x40, 0x78, 0x2e, 0x6a, 0x80, 0x7c, 0xc2, 0x83, 0xb9, 0xa0, 0xa2, 0xeb, 0xcf, 0x75, 0xc7, 0xd4,
+          0x58, 0x23, 0x1e, 0x5f, 0x12, 0xd2, 0x6d, 0x7c, 0x22, 0x78, 0x32, 0x8d, 0xae, 0x82, 0x19, 0x2a, 0xeb, 0x32, 0x6c, 0x6e, 0x1b, 0x75, 0x28, 0x81,
+          0x79, 0x0a, 0xf9, 0xb3, 0xb8, 0x5d, 0x0d, 0x57, 0x04, 0x52, 0x8d, 0xaa, 0xbf, 0x04, 0xa6, 0xfd, 0xf4, 0xa9, 0x26, 0xb7, 0x54, 0xa7, 0x72, 0xba,
+          0x18, 0x81, 0x32, 0x82, 0x9b, 0x83, 0x73, 0xd3, 0xf8, 0x58, 0x7c, 0x51, 0x63, 0x90, 0x77, 0xaf, 0x17, 0x73, 0x80, 0x87, 0x47, 0x92, 0x62, 0xc9,
+          0xb2, 0x20, 0x24, 0x8b, 0x2c, 0x92, 0xa4, 0xbe, 0x93, 0x8c, 0x92, 0x2d, 0x43, 0x34, 0x68, 0x51, 0x66, 0x9b, 0xef, 0x3f, 0xa4, 0xcc, 0x56, 0x3d,
+          0x07, 0x64, 0x9f, 0xe3, 0xbd, 0xac, 0xa3, 0x7b, 0x52, 0xc7, 0x94, 0x0d, 0x66, 0x30, 0x5a, 0x5b, 0xb7, 0xa2, 0xea, 0x8e, 0x4d, 0xea, 0x9f, 0xb5,
+          0xb9, 0x04, 0xdf, 0xb2, 0x3c, 0xdd, 0x7b, 0x39, 0x1b, 0xf2, 0x01, 0x27, 0x09, 0x88, 0xeb, 0xef, 0x27, 0x6a, 0x72, 0x2c, 0x6a, 0x8d, 0x8d, 0x82,
+          0xed, 0x34, 0x67, 0x71, 0x75, 0x42, 0xb1, 0x76, 0x46, 0xd0, 0xb9, 0xb6, 0xb1, 0xb9, 0xd5, 0x2a, 0xd6, 0x2b, 0x79, 0xc5, 0x1a, 0xd4, 0xb4, 0x86,
+          0xb6, 0x59, 0x96, 0x8c, 0xe8, 0x14, 0x32, 0xf3, 0x64, 0x30, 0xdd, 0x55, 0x40, 0xd3, 0xd6, 0x80, 0xf0, 0x8a, 0xd4, 0xeb, 0xaf, 0x91, 0xc4, 0x5c,
+          0xef, 0x30, 0x46, 0xea, 0x0f, 0xb0, 0xf2, 0x35, 0x07, 0xb9, 0x04, 0xc8, 0x3f, 0x98, 0x22, 0xc8, 0xfd, 0xaf, 0x27, 0x00, 0x98, 0xbc, 0x77, 0x79,
+          0xd5, 0x83, 0x2f, 0x4a, 0xa3, 0x04, 0xed, 0x86, 0x5b, 0x02, 0x78, 0xe9, 0x7e, 0xea, 0x9d, 0x61, 0x2d, 0x86, 0xca, 0x8f, 0x21, 0xf4, 0xa4, 0x15,
+          0x89, 0xaa, 0x2b, 0x3f, 0x15, 0x26, 0xef, 0x00, 0x4f, 0x92, 0xfd, 0x37, 0x78, 0x4e, 0xa9, 0x81, 0x20, 0x5f, 0x0b, 0xe5, 0xfa, 0xcb, 0xee, 0x53,
+          0xf0, 0xc3, 0x50, 0xfd, 0x05, 0x02, 0x5a, 0x23, 0xa1, 0xe8, 0xbb, 0xce, 0x2f, 0xb0, 0xcb, 0xcf, 0x1b, 0x57, 0x02, 0x3e, 0xfe, 0x50, 0xe2, 0x7e,
+          0x1b, 0x17, 0x3d, 0xf7, 0x47, 0x89, 0x65, 0x6d, 0xb6, 0x92, 0xfe, 0xc5, 0x99, 0xfe, 0xe5, 0x33, 0xe5, 0x5a, 0xef, 0x71, 0xf6, 0xe3, 0x61, 0xa3,
+          0x79, 0x3c, 0x8f, 0x96, 0xb7, 0x70, 0x6b, 0xd0, 0x18, 0x13, 0xfd, 0x39, 0x1a, 0xbf, 0xa0, 0x7c, 0x0f, 0x22, 0xf6, 0x66, 0xb9, 0x69, 0x52, 0x49,
+          0x08, 0x47, 0x7a, 0xc0, 0x38, 0xe8, 0xbe, 0x12, 0x28, 0x95, 0x58, 0x21, 0x28, 0x8c, 0xdf, 0xaa, 0xb4, 0xd8, 0x67, 0x41, 0xca, 0x40, 0xc4, 0xa2,
+          0x3b, 0xe8, 0xb5, 0xde, 0x13, 0xda, 0x3b, 0x58, 0xc7, 0xfe, 0xee, 0x90, 0xeb, 0xec, 0xf2, 0x20, 0x15, 0x35, 0x96, 0xc5, 0x82, 0xea, 0x55, 0x3a,
+          0xb8, 0xab, 0xe2, 0xbe, 0x29, 0x78, 0x99, 0xd4, 0xeb, 0xe0, 0x9d, 0xf7, 0x40, 0x4a, 0x4b, 0xaa, 0x1b, 0xe8, 0xe0, 0x77, 0xd8, 0xd6, 0x37, 0xd6,
+          0x16, 0xb4, 0x89, 0xf5, 0x77, 0xa5, 0x39, 0x5c, 0x40, 0xe5, 0xd0, 0x85, 0xcb, 0x7b, 0xb0, 0xea, 0xba, 0x05, 0xc0, 0xf6, 0x4b, 0x0b, 0xd9, 0x91,
+          0x70, 0x12, 0x89, 0x31, 0x74, 0xe0, 0xd8, 0x78, 0x00, 0x9d, 0xf6, 0x9e, 0xf1, 0x9a, 0x4a, 0x24, 0x26, 0x2c, 0xba, 0x93, 0x92, 0x76, 0x1b, 0x53,
+          0x09, 0x67, 0x9d, 0xea, 0x00, 0x7e, 0x7d, 0xfe, 0xe9, 0x5f, 0x8f, 0x4c, 0xb1, 0xfd, 0xba, 0x9a, 0x14, 0xce, 0x85, 0x96, 0xdd, 0x0b, 0xab, 0x0e,
+          0xd7, 0x67, 0x86, 0x6a, 0x8a, 0xb3, 0x89, 0x00, 0xc7, 0x63, 0x36, 0x75, 0xc9, 0x05, 0xcb, 0x90, 0x57, 0x87, 0xba, 0x1c, 0xe2, 0x52, 0x68, 0x3b,
+          0x1c, 0xd2, 0x4e, 0x1b, 0xca, 0x72, 0x02, 0xa9, 0xaf, 0x3d, 0x51, 0x60, 0x98, 0x5e, 0x2b, 0xa7, 0x16, 0x4b, 0xb5, 0x77, 0xd6, 0x01, 0x11, 0x8c,
+          0x4d, 0x97, 0xbf, 0x0c, 0x61, 0x2a, 0x2d, 0xd8, 0x44, 0x78, 0x57, 0x67, 0x8c, 0xf0, 0x31, 0x5b, 0x42, 0xfd, 0x45, 0xf1, 0xf4, 0x99, 0xad, 0x26,
+          0x1a, 0x4b, 0xf4, 0x9f, 0xef, 0xbf, 0x7d, 0x68, 0xf3, 0x52, 0x14, 0xf7, 0xe8, 0x7c, 0xc1, 0x72, 0x70, 0x2c, 0xf0, 0xa7, 0x97, 0xf0, 0x6b, 0xb9,
+          0x94, 0x82, 0x46, 0x3d, 0xc9, 0xac, 0x50, 0x1d, 0x3b, 0x68, 0xb4, 0x88, 0x28, 0x22, 0xbe, 0xc1, 0x19, 0x49, 0x20, 0x25, 0xe5, 0x16, 0x59, 0xb8,
+          0x7b, 0x19, 0x06, 0xf0, 0x31, 0xe1, 0x22, 0x47, 0x94, 0x10, 0x7a, 0x55, 0x49, 0xf0, 0x95, 0xc5, 0x3f, 0x5d, 0xcf, 0x88, 0xa3, 0xe7, 0x3b, 0x73,
+          0xc1, 0x38, 0xe9, 0x4a, 0x7a, 0x02, 0x7d, 0xe7, 0x7b, 0x6f, 0x69, 0x10, 0x00, 0x87, 0xdf, 0x5b, 0xbb, 0xa8, 0x07, 0xa8, 0xa8, 0x21, 0x53, 0x60,
+          0x88, 0x7c, 0xb7, 0xde, 0x37, 0x94, 0x55, 0xdd, 0xf5, 0xa5, 0x19, 0x41, 0xbe, 0x90, 0x04, 0x1c, 0x53, 0x8f, 0xfd, 0x0a, 0x11, 0x4b, 0xb6, 0x9e,
+          0x2c, 0xa0, 0x9f, 0x9e, 0xe9, 0x5f, 0x3e, 0xd3, 0x4f, 0xcc, 0xf4, 0x53, 0x33, 0x09, 0x2f, 0x0b, 0x01, 0xec, 0x70, 0x39, 0xa8, 0x43, 0x5c, 0x74,
+          0x63, 0x20, 0x1f, 0x91, 0x4b, 0x1f, 0x4d, 0x49, 0x68, 0xba, 0xe1, 0x48, 0x78, 0x5e, 0xcf, 0x6b, 0xb6, 0xd2, 0xeb, 0x3e, 0x10, 0x92, 0xef, 0xfa,
+          0xe5, 0xb3, 0xec, 0x92, 0x58, 0xfa, 0x06, 0x19, 0x91, 0x87, 0x71, 0x93, 0xaa, 0x24, 0x0e, 0x90, 0x90, 0xe5, 0x47, 0xa5, 0xd7, 0x2e, 0xb7, 0x25,
+          0x94, 0x11, 0x36, 0x54, 0x2a, 0x62, 0x4f, 0x80, 0x32, 0x2a, 0x23, 0x0a, 0x85, 0x0d, 0xe9, 0x79, 0x40, 0xef, 0x42, 0x38, 0x24, 0x22, 0x78, 0x12,
+          0x59, 0xd5, 0xfd, 0x15, 0xf9, 0x83, 0x8d, 0xdb, 0x19, 0xff, 0xc8, 0xa2, 0x14, 0x34, 0x88, 0xf1, 0x13, 0x6e, 0x7e, 0x9f, 0x4c, 0xf5, 0xaa, 0xc2,
+          0xfc, 0x9c, 0x3b, 0x64, 0x43, 0x08, 0xde, 0xb3, 0x14, 0x42, 0xe3, 0x66, 0x3a, 0xf5, 0xca, 0x49, 0x34, 0xfd, 0x1a, 0xa7, 0x63, 0x9a, 0xf9, 0xb1,
+          0xdd, 0x1f, 0x6a, 0x25, 0x8f, 0x75, 0x33, 0x4d, 0x67, 0x56, 0xa5, 0x7f, 0xed, 0x29, 0x68, 0x20, 0xff, 0x91, 0x89, 0x29, 0xc6, 0x2d, 0x7e, 0xaa,
+          0xfa, 0xe3, 0xcd, 0x0c, 0x94, 0xd5, 0x70, 0x92, 0x75, 0x90, 0x4a, 0xa3, 0x89, 0x1d, 0x9a, 0xaa, 0x32, 0xd7, 0xb0, 0x32, 0x52, 0xe7, 0xf6, 0xb3,
+          0xd9, 0x64, 0x31, 0xac, 0x67, 0x21, 0xe1, 0xae, 0x45, 0xb7, 0x46, 0x83, 0x80, 0xc2, 0xc9, 0xde, 0x07, 0x61, 0x9d, 0xdf, 0x07, 0x3b, 0x72, 0x0a,
+          0x10, 0xd2, 0x89, 0x51, 0x37, 0x7e, 0xc9, 0xba, 0xfd, 0xab, 0xc4, 0x8f, 0xfe, 0x1d, 0xa2, 0xe0, 0x16, 0x8d, 0x83, 0xe0, 0x12, 0x91, 0x4d, 0xbb,
+          0x3c, 0x24, 0xc2, 0x34, 0x25, 0xec, 0xdf, 0xad, 0x95, 0x87, 0xa9, 0x61, 0x1a, 0xe5, 0x9a, 0x22, 0xe6, 0x5a, 0x14, 0x93, 0x32, 0xbf, 0x26, 0x7d,
+          0x19, 0x7c, 0x35, 0x31, 0xf9, 0x8b, 0x45, 0xf2, 0x54, 0x66, 0xd2, 0xa4, 0x48, 0x60, 0xba, 0x81, 0x4e, 0x63, 0x6b, 0xf8, 0xd3, 0xfb, 0xdc, 0xaa,
+          0x57, 0x34, 0x67, 0x07, 0x4b, 0x47, 0xce, 0xa7, 0x58, 0x76, 0x6b, 0xd1, 0xfc, 0x70, 0x35, 0x4e, 0x90, 0x72, 0x86, 0x9a, 0x08, 0xc6, 0x82, 0xc7,
+          0x10, 0xa1, 0x43, 0xc2, 0x21, 0x47, 0x99, 0x65, 0xcc, 0xf6, 0x33, 0x79, 0xfd, 0xf7, 0x46, 0xc0, 0x35, 0xd4, 0xf5, 0x12, 0xfe, 0x41, 0x95, 0x14,
+          0x4a, 0x47, 0xd9, 0x21, 0xf8, 0xd1, 0xfa, 0xd4, 0x91, 0xfd, 0x50, 0x38, 0x1f, 0x41, 0x2b, 0x2d, 0xf8, 0xab, 0xbf, 0xec, 0xbe, 0xd4, 0xd2, 0x9a,
+          0xf0, 0x1c, 0xab, 0xe7, 0x4f, 0x60, 0x52, 0xa2, 0x4d, 0x8c, 0x1e, 0x73, 0x47, 0x9c, 0x29, 0x33, 0x5c, 0x52, 0x63, 0x0b, 0x35, 0x4c, 0xea, 0xa1,
+          0x9d, 0x55, 0xc5, 0x52, 0x41, 0xd1, 0xba, 0x75, 0x8e, 0x9c, 0x73, 0x77, 0x76, 0xfd, 0xf4, 0x61, 0x49, 0xfe, 0x90, 0x2b, 0xbd, 0x58, 0x74, 0x0e,
+          0x6b, 0xaa, 0x80, 0x41, 0x02, 0x76, 0x3a, 0xaf, 0xee, 0xa1, 0x8f, 0x16, 0xee, 0x1b, 0x2d, 0xb2, 0x0a, 0x67, 0x4b, 0x0d, 0x9b, 0x09, 0x20, 0x4d,
+          0xdd, 0xb2, 0xc1, 0x5f, 0x4d, 0x17, 0x26, 0x16, 0xcf, 0x4e, 0xfa, 0xe0, 0xaf, 0xa8, 0x0b, 0x7f, 0xe2, 0xe9, 0xcb, 0xc8, 0x04, 0x79, 0x7c, 0xe3,
+          0x77, 0xee, 0x0e, 0x87, 0xcb, 0x9d, 0xcd, 0xdd, 0x87, 0xcb, 0x5e, 0x0e, 0xd8, 0xbf, 0xed, 0x0c};
     };
 
     struct JasmineFavicon {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{1162};
-        static constexpr std::array<uint64_t, 146> data{
-          0xb1682e1891547002, 0x80bf5ae0ce157351, 0x818ed508db83a512, 0x0f8ac29d7b347335, 0x00a7db016375c8de,
-          0x3be06a54ef6d3c91, 0x50730ba119f32500, 0x3fb8fd3410aafab1, 0xed43a8f0b601bf65, 0x113b71856db0b1af,
-          0x4081caa6d01e096d, 0xb25ddb430f7faa5e, 0xb231f881f4658e6e, 0x0c9696d6ba595bb4, 0x0a6975ea561ee161,
-          0x466817f4f26bb4b3, 0x6490e00d78000080, 0x24272ba99e352926, 0x5888cb4896ed8973, 0x701555454da9ff19,
-          0x01fef3b946eb23ca, 0xfc1ab4b09c31ad7f, 0x420919e969d1ca6d, 0x034aab8e2aa99f57, 0x2dac15528bdf84fe,
-          0x6adaa3fb6c0d6eb5, 0xd819ec29b145a382, 0xe9075c77c8c10a23, 0xc18d19dac19e1ccb, 0x506ba4046794cda8,
-          0xc21051269da05521, 0xc6483a43b4546737, 0xd4e4bca1101ad5e2, 0x1010b0693b5955d4, 0x21cbe86480908960,
-          0x53ceb06961515d94, 0x87f4ae540aa2da19, 0x0d9e60f625d76fa3, 0x22199fe1aa6b798f, 0x0348dd01b465e824,
-          0x6952d4c015f09a4b, 0x3db5b7f8feffc73a, 0x0db81dc6dc4c59e3, 0xb7f3af0720c28432, 0x0e4d941555d34dcb,
-          0x765ccf0fe234cbcb, 0xaa6efa719a97753b, 0xcefb79bf5f5c424a, 0x5a46565e51495945, 0x55534b47574fdfc0,
-          0xd0c8d8c4d4dcc212, 0xf8ebb78dad9dbd83, 0xb3ab9ba78faf9f7f, 0x4060f00947a2b178, 0x229dcd154ae54ab5,
-          0x566f345bed4eb7d7, 0x1f0cc793e96cbede, 0x6c77fbd3e57abb3f, 0x5fefcff7f71f1e1d, 0x9b989c9a7e776676,
-          0x6e7e6169757d6373, 0x6b7b67776f1f74f8, 0xe7f8e4f4ece2f2ea, 0xfae6f6fee1f1e9f9, 0xede3f3ebe7ef3fdd,
-          0x466c690000dc464e, 0x524cd3cbd87ee9d2, 0x204e8d30f2f17e4e, 0x53435a0a3ce546df, 0xb252f24d088a5240,
-          0x9cd4974c4052d283, 0x962a89f4563d14f1, 0x9de48c6fd150fea3, 0x8f6ff39eff3dd635, 0xe00a332fc7f7db5e,
-          0xe3f8fa5a80a6fba5, 0xf11f8cfea5ea607d, 0x640ffccc3f691c26, 0x86d7ca2a1700e86f, 0x1e553507c79bd60f,
-          0x242dbc5664b1bba8, 0x8107c927ddd994e7, 0xa177d90f67137197, 0x4d62f3e3a304104f, 0x1d5ed3c7d25504a2,
-          0x637a0311c512321f, 0x8a79ba03618b9eea, 0xee0af16d62ca1b4d, 0x9772b6c883366ded, 0xf9380e2436318b4a,
-          0xd7857e55a7e1fdc0, 0x279e0187f4f76738, 0x2923b925ee492ce3, 0xe413dce0c4497e27, 0x601308ee09aca0cc,
-          0x744336966d2d1612, 0x6f6e87a1ee027719, 0x55446d07ed7c5547, 0x38c583455cb2a6c9, 0xf6064ffc9c04d1a8,
-          0xa2b27f87e0e832ca, 0x30d56d507c23686d, 0x294b4fd0b805c6dd, 0xc6b8a125d4629fcd, 0xb80e201de7312eb2,
-          0xe2bf296cab92b350, 0xcab9a8886c83b75a, 0x6ec392d4e3c8e943, 0xa8ac436b009f2959, 0x60d3a8388596a90c,
-          0xb0d3aaa1b1e56374, 0x8d7f869b3f95e338, 0xdfd4f4ef23fa2c57, 0xefc2ccf74309f91a, 0x7c117022e643598e,
-          0x57fcda26910e3497, 0x5b24e8c34a67c223, 0x573e1cd4dd085845, 0x60aade745725bb73, 0x4cb32b821d831883,
-          0x13837b1b963c87f0, 0xf0e41e5c8bf60a4d, 0x1b4f405aae831678, 0x70a05b26bd9862cd, 0x15e20f7e59fcbf10,
-          0xb2ebd5583b002f8a, 0x723ad19c3263e32e, 0x12d2c92f0fe419c8, 0x85dcb685e411d028, 0xc137c836d84fce59,
-          0x27f456d43fa6a4ec, 0xd0403406f1379c13, 0xb96c049cdd9fb37f, 0x493f3eda60c05160, 0x5817503100650f31,
-          0xa5f06b00dcaff2f8, 0xe45cb127a21b452d, 0xb2893c2ea7d5401b, 0xe830b817e64cab1a, 0x28ef58127b85f977,
-          0xbcb5210619a800f1, 0x4242d102efa09306, 0x9a3220ae571e0474, 0xbae9ea33ba1bf802, 0xd6859c94b26483b8,
-          0x6908000000000000};
+        static constexpr std::string_view etag{"\"57c5140ea8d6f1c8\""};
+        static constexpr std::array<uint8_t, 1162> data{
+          0xb1, 0x68, 0x2e, 0x18, 0x91, 0x54, 0x70, 0x02, 0x80, 0xbf, 0x5a, 0xe0, 0xce, 0x15, 0x73, 0x51, 0x81, 0x8e, 0xd5, 0x08, 0xdb, 0x83, 0xa5, 0x12,
+          0x0f, 0x8a, 0xc2, 0x9d, 0x7b, 0x34, 0x73, 0x35, 0x00, 0xa7, 0xdb, 0x01, 0x63, 0x75, 0xc8, 0xde, 0x3b, 0xe0, 0x6a, 0x54, 0xef, 0x6d, 0x3c, 0x91,
+          0x50, 0x73, 0x0b, 0xa1, 0x19, 0xf3, 0x25, 0x00, 0x3f, 0xb8, 0xfd, 0x34, 0x10, 0xaa, 0xfa, 0xb1, 0xed, 0x43, 0xa8, 0xf0, 0xb6, 0x01, 0xbf, 0x65,
+          0x11, 0x3b, 0x71, 0x85, 0x6d, 0xb0, 0xb1, 0xaf, 0x40, 0x81, 0xca, 0xa6, 0xd0, 0x1e, 0x09, 0x6d, 0xb2, 0x5d, 0xdb, 0x43, 0x0f, 0x7f, 0xaa, 0x5e,
+          0xb2, 0x31, 0xf8, 0x81, 0xf4, 0x65, 0x8e, 0x6e, 0x0c, 0x96, 0x96, 0xd6, 0xba, 0x59, 0x5b, 0xb4, 0x0a, 0x69, 0x75, 0xea, 0x56, 0x1e, 0xe1, 0x61,
+          0x46, 0x68, 0x17, 0xf4, 0xf2, 0x6b, 0xb4, 0xb3, 0x64, 0x90, 0xe0, 0x0d, 0x78, 0x00, 0x00, 0x80, 0x24, 0x27, 0x2b, 0xa9, 0x9e, 0x35, 0x29, 0x26,
+          0x58, 0x88, 0xcb, 0x48, 0x96, 0xed, 0x89, 0x73, 0x70, 0x15, 0x55, 0x45, 0x4d, 0xa9, 0xff, 0x19, 0x01, 0xfe, 0xf3, 0xb9, 0x46, 0xeb, 0x23, 0xca,
+          0xfc, 0x1a, 0xb4, 0xb0, 0x9c, 0x31, 0xad, 0x7f, 0x42, 0x09, 0x19, 0xe9, 0x69, 0xd1, 0xca, 0x6d, 0x03, 0x4a, 0xab, 0x8e, 0x2a, 0xa9, 0x9f, 0x57,
+          0x2d, 0xac, 0x15, 0x52, 0x8b, 0xdf, 0x84, 0xfe, 0x6a, 0xda, 0xa3, 0xfb, 0x6c, 0x0d, 0x6e, 0xb5, 0xd8, 0x19, 0xec, 0x29, 0xb1, 0x45, 0xa3, 0x82,
+          0xe9, 0x07, 0x5c, 0x77, 0xc8, 0xc1, 0x0a, 0x23, 0xc1, 0x8d, 0x19, 0xda, 0xc1, 0x9e, 0x1c, 0xcb, 0x50, 0x6b, 0xa4, 0x04, 0x67, 0x94, 0xcd, 0xa8,
+          0xc2, 0x10, 0x51, 0x26, 0x9d, 0xa0, 0x55, 0x21, 0xc6, 0x48, 0x3a, 0x43, 0xb4, 0x54, 0x67, 0x37, 0xd4, 0xe4, 0xbc, 0xa1, 0x10, 0x1a, 0xd5, 0xe2,
+          0x10, 0x10, 0xb0, 0x69, 0x3b, 0x59, 0x55, 0xd4, 0x21, 0xcb, 0xe8, 0x64, 0x80, 0x90, 0x89, 0x60, 0x53, 0xce, 0xb0, 0x69, 0x61, 0x51, 0x5d, 0x94,
+          0x87, 0xf4, 0xae, 0x54, 0x0a, 0xa2, 0xda, 0x19, 0x0d, 0x9e, 0x60, 0xf6, 0x25, 0xd7, 0x6f, 0xa3, 0x22, 0x19, 0x9f, 0xe1, 0xaa, 0x6b, 0x79, 0x8f,
+          0x03, 0x48, 0xdd, 0x01, 0xb4, 0x65, 0xe8, 0x24, 0x69, 0x52, 0xd4, 0xc0, 0x15, 0xf0, 0x9a, 0x4b, 0x3d, 0xb5, 0xb7, 0xf8, 0xfe, 0xff, 0xc7, 0x3a,
+          0x0d, 0xb8, 0x1d, 0xc6, 0xdc, 0x4c, 0x59, 0xe3, 0xb7, 0xf3, 0xaf, 0x07, 0x20, 0xc2, 0x84, 0x32, 0x0e, 0x4d, 0x94, 0x15, 0x55, 0xd3, 0x4d, 0xcb,
+          0x76, 0x5c, 0xcf, 0x0f, 0xe2, 0x34, 0xcb, 0xcb, 0xaa, 0x6e, 0xfa, 0x71, 0x9a, 0x97, 0x75, 0x3b, 0xce, 0xfb, 0x79, 0xbf, 0x5f, 0x5c, 0x42, 0x4a,
+          0x5a, 0x46, 0x56, 0x5e, 0x51, 0x49, 0x59, 0x45, 0x55, 0x53, 0x4b, 0x47, 0x57, 0x4f, 0xdf, 0xc0, 0xd0, 0xc8, 0xd8, 0xc4, 0xd4, 0xdc, 0xc2, 0x12,
+          0xf8, 0xeb, 0xb7, 0x8d, 0xad, 0x9d, 0xbd, 0x83, 0xb3, 0xab, 0x9b, 0xa7, 0x8f, 0xaf, 0x9f, 0x7f, 0x40, 0x60, 0xf0, 0x09, 0x47, 0xa2, 0xb1, 0x78,
+          0x22, 0x9d, 0xcd, 0x15, 0x4a, 0xe5, 0x4a, 0xb5, 0x56, 0x6f, 0x34, 0x5b, 0xed, 0x4e, 0xb7, 0xd7, 0x1f, 0x0c, 0xc7, 0x93, 0xe9, 0x6c, 0xbe, 0xde,
+          0x6c, 0x77, 0xfb, 0xd3, 0xe5, 0x7a, 0xbb, 0x3f, 0x5f, 0xef, 0xcf, 0xf7, 0xf7, 0x1f, 0x1e, 0x1d, 0x9b, 0x98, 0x9c, 0x9a, 0x7e, 0x77, 0x66, 0x76,
+          0x6e, 0x7e, 0x61, 0x69, 0x75, 0x7d, 0x63, 0x73, 0x6b, 0x7b, 0x67, 0x77, 0x6f, 0x1f, 0x74, 0xf8, 0xe7, 0xf8, 0xe4, 0xf4, 0xec, 0xe2, 0xf2, 0xea,
+          0xfa, 0xe6, 0xf6, 0xfe, 0xe1, 0xf1, 0xe9, 0xf9, 0xed, 0xe3, 0xf3, 0xeb, 0xe7, 0xef, 0x3f, 0xdd, 0x46, 0x6c, 0x69, 0x00, 0x00, 0xdc, 0x46, 0x4e,
+          0x52, 0x4c, 0xd3, 0xcb, 0xd8, 0x7e, 0xe9, 0xd2, 0x20, 0x4e, 0x8d, 0x30, 0xf2, 0xf1, 0x7e, 0x4e, 0x53, 0x43, 0x5a, 0x0a, 0x3c, 0xe5, 0x46, 0xdf,
+          0xb2, 0x52, 0xf2, 0x4d, 0x08, 0x8a, 0x52, 0x40, 0x9c, 0xd4, 0x97, 0x4c, 0x40, 0x52, 0xd2, 0x83, 0x96, 0x2a, 0x89, 0xf4, 0x56, 0x3d, 0x14, 0xf1,
+          0x9d, 0xe4, 0x8c, 0x6f, 0xd1, 0x50, 0xfe, 0xa3, 0x8f, 0x6f, 0xf3, 0x9e, 0xff, 0x3d, 0xd6, 0x35, 0xe0, 0x0a, 0x33, 0x2f, 0xc7, 0xf7, 0xdb, 0x5e,
+          0xe3, 0xf8, 0xfa, 0x5a, 0x80, 0xa6, 0xfb, 0xa5, 0xf1, 0x1f, 0x8c, 0xfe, 0xa5, 0xea, 0x60, 0x7d, 0x64, 0x0f, 0xfc, 0xcc, 0x3f, 0x69, 0x1c, 0x26,
+          0x86, 0xd7, 0xca, 0x2a, 0x17, 0x00, 0xe8, 0x6f, 0x1e, 0x55, 0x35, 0x07, 0xc7, 0x9b, 0xd6, 0x0f, 0x24, 0x2d, 0xbc, 0x56, 0x64, 0xb1, 0xbb, 0xa8,
+          0x81, 0x07, 0xc9, 0x27, 0xdd, 0xd9, 0x94, 0xe7, 0xa1, 0x77, 0xd9, 0x0f, 0x67, 0x13, 0x71, 0x97, 0x4d, 0x62, 0xf3, 0xe3, 0xa3, 0x04, 0x10, 0x4f,
+          0x1d, 0x5e, 0xd3, 0xc7, 0xd2, 0x55, 0x04, 0xa2, 0x63, 0x7a, 0x03, 0x11, 0xc5, 0x12, 0x32, 0x1f, 0x8a, 0x79, 0xba, 0x03, 0x61, 0x8b, 0x9e, 0xea,
+          0xee, 0x0a, 0xf1, 0x6d, 0x62, 0xca, 0x1b, 0x4d, 0x97, 0x72, 0xb6, 0xc8, 0x83, 0x36, 0x6d, 0xed, 0xf9, 0x38, 0x0e, 0x24, 0x36, 0x31, 0x8b, 0x4a,
+          0xd7, 0x85, 0x7e, 0x55, 0xa7, 0xe1, 0xfd, 0xc0, 0x27, 0x9e, 0x01, 0x87, 0xf4, 0xf7, 0x67, 0x38, 0x29, 0x23, 0xb9, 0x25, 0xee, 0x49, 0x2c, 0xe3,
+          0xe4, 0x13, 0xdc, 0xe0, 0xc4, 0x49, 0x7e, 0x27, 0x60, 0x13, 0x08, 0xee, 0x09, 0xac, 0xa0, 0xcc, 0x74, 0x43, 0x36, 0x96, 0x6d, 0x2d, 0x16, 0x12,
+          0x6f, 0x6e, 0x87, 0xa1, 0xee, 0x02, 0x77, 0x19, 0x55, 0x44, 0x6d, 0x07, 0xed, 0x7c, 0x55, 0x47, 0x38, 0xc5, 0x83, 0x45, 0x5c, 0xb2, 0xa6, 0xc9,
+          0xf6, 0x06, 0x4f, 0xfc, 0x9c, 0x04, 0xd1, 0xa8, 0xa2, 0xb2, 0x7f, 0x87, 0xe0, 0xe8, 0x32, 0xca, 0x30, 0xd5, 0x6d, 0x50, 0x7c, 0x23, 0x68, 0x6d,
+          0x29, 0x4b, 0x4f, 0xd0, 0xb8, 0x05, 0xc6, 0xdd, 0xc6, 0xb8, 0xa1, 0x25, 0xd4, 0x62, 0x9f, 0xcd, 0xb8, 0x0e, 0x20, 0x1d, 0xe7, 0x31, 0x2e, 0xb2,
+          0xe2, 0xbf, 0x29, 0x6c, 0xab, 0x92, 0xb3, 0x50, 0xca, 0xb9, 0xa8, 0x88, 0x6c, 0x83, 0xb7, 0x5a, 0x6e, 0xc3, 0x92, 0xd4, 0xe3, 0xc8, 0xe9, 0x43,
+          0xa8, 0xac, 0x43, 0x6b, 0x00, 0x9f, 0x29, 0x59, 0x60, 0xd3, 0xa8, 0x38, 0x85, 0x96, 0xa9, 0x0c, 0xb0, 0xd3, 0xaa, 0xa1, 0xb1, 0xe5, 0x63, 0x74,
+          0x8d, 0x7f, 0x86, 0x9b, 0x3f, 0x95, 0xe3, 0x38, 0xdf, 0xd4, 0xf4, 0xef, 0x23, 0xfa, 0x2c, 0x57, 0xef, 0xc2, 0xcc, 0xf7, 0x43, 0x09, 0xf9, 0x1a,
+          0x7c, 0x11, 0x70, 0x22, 0xe6, 0x43, 0x59, 0x8e, 0x57, 0xfc, 0xda, 0x26, 0x91, 0x0e, 0x34, 0x97, 0x5b, 0x24, 0xe8, 0xc3, 0x4a, 0x67, 0xc2, 0x23,
+          0x57, 0x3e, 0x1c, 0xd4, 0xdd, 0x08, 0x58, 0x45, 0x60, 0xaa, 0xde, 0x74, 0x57, 0x25, 0xbb, 0x73, 0x4c, 0xb3, 0x2b, 0x82, 0x1d, 0x83, 0x18, 0x83,
+          0x13, 0x83, 0x7b, 0x1b, 0x96, 0x3c, 0x87, 0xf0, 0xf0, 0xe4, 0x1e, 0x5c, 0x8b, 0xf6, 0x0a, 0x4d, 0x1b, 0x4f, 0x40, 0x5a, 0xae, 0x83, 0x16, 0x78,
+          0x70, 0xa0, 0x5b, 0x26, 0xbd, 0x98, 0x62, 0xcd, 0x15, 0xe2, 0x0f, 0x7e, 0x59, 0xfc, 0xbf, 0x10, 0xb2, 0xeb, 0xd5, 0x58, 0x3b, 0x00, 0x2f, 0x8a,
+          0x72, 0x3a, 0xd1, 0x9c, 0x32, 0x63, 0xe3, 0x2e, 0x12, 0xd2, 0xc9, 0x2f, 0x0f, 0xe4, 0x19, 0xc8, 0x85, 0xdc, 0xb6, 0x85, 0xe4, 0x11, 0xd0, 0x28,
+          0xc1, 0x37, 0xc8, 0x36, 0xd8, 0x4f, 0xce, 0x59, 0x27, 0xf4, 0x56, 0xd4, 0x3f, 0xa6, 0xa4, 0xec, 0xd0, 0x40, 0x34, 0x06, 0xf1, 0x37, 0x9c, 0x13,
+          0xb9, 0x6c, 0x04, 0x9c, 0xdd, 0x9f, 0xb3, 0x7f, 0x49, 0x3f, 0x3e, 0xda, 0x60, 0xc0, 0x51, 0x60, 0x58, 0x17, 0x50, 0x31, 0x00, 0x65, 0x0f, 0x31,
+          0xa5, 0xf0, 0x6b, 0x00, 0xdc, 0xaf, 0xf2, 0xf8, 0xe4, 0x5c, 0xb1, 0x27, 0xa2, 0x1b, 0x45, 0x2d, 0xb2, 0x89, 0x3c, 0x2e, 0xa7, 0xd5, 0x40, 0x1b,
+          0xe8, 0x30, 0xb8, 0x17, 0xe6, 0x4c, 0xab, 0x1a, 0x28, 0xef, 0x58, 0x12, 0x7b, 0x85, 0xf9, 0x77, 0xbc, 0xb5, 0x21, 0x06, 0x19, 0xa8, 0x00, 0xf1,
+          0x42, 0x42, 0xd1, 0x02, 0xef, 0xa0, 0x93, 0x06, 0x9a, 0x32, 0x20, 0xae, 0x57, 0x1e, 0x04, 0x74, 0xba, 0xe9, 0xea, 0x33, 0xba, 0x1b, 0xf8, 0x02,
+          0xd6, 0x85, 0x9c, 0x94, 0xb2, 0x64, 0x83, 0xb8, 0x69, 0x08};
     };
 
     struct JasmineHtml {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{5166};
-        static constexpr std::array<uint64_t, 646> data{
-          0xf1d06903605590c9, 0xbd5b3851ddee266a, 0x7936693aafe03789, 0xe0e197aa772ea79f, 0x652001e9f5582ba3,
-          0x636cdbcd930db169, 0x09d2039c4e435453, 0x45d875a5392779a5, 0xf4350fab80b837f4, 0xb2cdb64e49b72f06,
-          0x374375f8f24a391c, 0x6830346d9614109d, 0x09d2c385c59c42e9, 0x17270a8514c6acda, 0x5bbd5fd65001262c,
-          0x804425008585c856, 0x757685c67e37b7df, 0x19d35955fd66e6cd, 0xeee9d6ca588b451d, 0xe487a810da3b413d,
-          0xc4567d6ae7a6ea7e, 0x2d21847c24a1583b, 0xded7b5c7e2af7714, 0x2b3d9636b9a93ddf, 0x70fd3743ed23ea70,
-          0x5708d1df70c7a2e0, 0xed6af9e7c04c8866, 0x4179fcc4979c3148, 0x7ffa264a5af9bd21, 0xad45cf1639f78482,
-          0x66625337712055da, 0x7a4551375eecdb54, 0x9be6915898d85b5f, 0xa5ad1a639e46adab, 0x8fb010201aa3daf3,
-          0x5cf6b3e4814bf166, 0x9f2faaa575f9fbb4, 0xa0a1583bd6888197, 0xbd151f3e21fa2726, 0x2c77b443169f2de3,
-          0x108505ee51ce8401, 0xfd39bb1b237de875, 0xc7f16d77561f2c1b, 0xef82fc7b7062303c, 0xed248f265e9f9c0a,
-          0xf1e1332165f54131, 0x28a991d0a422acd6, 0x96c7371b26865e36, 0x0741dacc8d402f69, 0x1af938c0c675d793,
-          0xdb63467a7bbbfb7e, 0xd9a5e6c8baee41fd, 0xe354de2f6240f9e2, 0x07763817af8c9155, 0xe4ffec80cd5e48e3,
-          0x101e37070c543c05, 0xbadbdd6a5ac8de40, 0xe3ff392e1cae66dd, 0xc36ada7167bcc837, 0xff8972975741e748,
-          0xe7f143d37cf28b60, 0x1c554fdd356bf50e, 0x073c59686cf6a679, 0x7aee25f40b0b9bc9, 0x0bdf1d6779d780e9,
-          0x0f2aac1cfc633deb, 0x513e115050880390, 0x2c7edeaa7c95aede, 0x23afc78f1ff007fe, 0x23ef9ffe208eebb4,
-          0xfcdcff70c096a781, 0xa8d9f3e789b07b0b, 0xb12260b2ecdea70c, 0xa91cafd9cf3a8f02, 0x3bf84f8b386e45db,
-          0x322931a46a37309a, 0xd8526762e58b176d, 0xd99b3e17fb772c57, 0x6a26e846598debad, 0x5bd5ff5f3dcd77d3,
-          0xb40052454b6dedc0, 0x6b59cde395af591e, 0x6ab280bfe3203048, 0x9ff598fed3e75daa, 0xec1c89666b793556,
-          0xba678610afe05075, 0x494bcdea9f08807d, 0xc2bee1178dab6062, 0x18713abe0b3a1314, 0xb2c00a778455153d,
-          0x55b154d02ad8142d, 0x80bbeb309e515b39, 0xdc7b83ca3b036946, 0xff3518708bbaa528, 0xb08d8ab0857eba8c,
-          0x7e556c207ec46da6, 0xf5a80a5548f04eb3, 0xb18e137630c88fdc, 0x0941d06c5f377417, 0x4ba0cad672687a9c,
-          0x99051c94079bde39, 0xd10cd0771a407708, 0x19781f9554d225ce, 0x25fafa29966181c1, 0xbe4a6d5d3ee00294,
-          0x8a0014fcfae634ce, 0x220a5e0c15ba22af, 0x14bff677c2cb4203, 0x8e65c753160ee414, 0xbc09e37c7572826b,
-          0x005e695a4a47ec20, 0x78c0eeb5a50c4125, 0xdf19267cb461fb5a, 0xbce5a6284bd8bc7e, 0x7ee671ad90abf01e,
-          0x66b6e1e306c5539a, 0xb54c550911a9d967, 0x03f7e31167dca289, 0xce245301c8c5f6d1, 0xdde89f0116e9de0a,
-          0x468c3e57477fb7f1, 0xe986ee8445bc8b44, 0xb7967a83658a86fa, 0xb83e8f32ab0eab2d, 0xc543ab363b278e62,
-          0x4f7be675c12ceafb, 0xa8ea6ce69534370f, 0xfa33f11b0bdcf9aa, 0x5f83cd8de3104482, 0x68712bb98d703e33,
-          0x70ee834d49b84604, 0x4f2bf614b0f88026, 0x47bb86bc298d1349, 0xa49b85daf6b338f8, 0xf958651eedb22544,
-          0xb316ed48c2dd1c6d, 0x89e92a2261b155fc, 0x909e3fbb2341d695, 0x4d39d1344729e537, 0x4949db5c7a201b51,
-          0x388f43e10a63f1e1, 0x07ae15dcbb40ba70, 0x232ddaffc7333c5b, 0x418e9b5ca25bd97c, 0xbe57eeea26c0ca53,
-          0x7e421f16a1e4e961, 0x7a2990061061d236, 0x26fb3841cdaf36d7, 0x97ad607795eb5037, 0xdb651386d609ac57,
-          0xec4de8a569014eb3, 0xd3044ac3fe3452e8, 0xd0f695b3883958b4, 0xd4d80c315f4eb78d, 0x9792a6e6b6a5fdad,
-          0xe5ae580aef33b376, 0x79c0f5ba2310ad78, 0x9c87a4a7a675f965, 0xa7fa2f4bc454781d, 0x55658f819bbed51d,
-          0x8a656443eda3d04c, 0x0b83caad68055a82, 0x4ade2dbc7780aa2d, 0x18fcf552c26c2772, 0x90b91179e7815ca2,
-          0xd87690b55523e4e8, 0x58f2a60264002975, 0x1bfcec101fc468fa, 0xa41ab9fb0e57cd5d, 0xcf0309254bcacad2,
-          0x778625c257a0556a, 0x75c2df7f44efdc83, 0x32d895bee340b230, 0xd87f237769f64144, 0x1c0e758e7947d220,
-          0xb05430c3d6d4ca13, 0x89f6852fbf356afe, 0xf319d827441fe9b0, 0x93d47855044dc97c, 0x85ad631436dd0fcd,
-          0x907136c7ee8a1e0c, 0x2023c4226bc998a1, 0xef10cf702671aa51, 0x4ddc98ef55c04404, 0x16df8c8723fe3434,
-          0x856b9b78b6856b2e, 0x81c2e2f7480c3516, 0x5f4a94a31f5402b2, 0x7a9a6ca41783e960, 0x24d73677053795fe,
-          0xafb8943174243830, 0x7d72856eecd98795, 0xae173993f59f4b78, 0x828f3c6fd29903b2, 0x7322e58b141d85b5,
-          0x1cdb36fbdab82872, 0xb59bbd598b682b78, 0xa6ef4f0ef3a2c0b0, 0x0b221faeca3b62c2, 0x488bdb6f16466b33,
-          0xc84e7ad5ed690d90, 0x8351513d6cd360f9, 0x8a4061f2a1376444, 0xb2c7062cc9af501b, 0x0439d51a93218783,
-          0xbe2bc9c82d39003d, 0x28a98a78485996c5, 0x46cf858ee6fa275d, 0xe57eebd8e30d8df7, 0x92629a25d306a866,
-          0x9b82beab0068590d, 0xd9b04f849abb369d, 0x372fa45166898286, 0xb82271c8f0edf46e, 0x74fd57ce50a40855,
-          0xce60240700d28b1c, 0xc8d19abe46742141, 0x11e675a9edf89488, 0x824a46c6e5ee1ebd, 0xd37bd93284b7bceb,
-          0x43d62ecefab815ae, 0xbf04bb2b971cdf91, 0x227c921b8effd881, 0x25f887a16d156c3d, 0x057419de1263f60f,
-          0x4ecf6f7672f315ab, 0xe5ebdec621b78a24, 0xc2f01365fb054e79, 0x9e50446975e8c01c, 0x1cdbdfcb60d8afd1,
-          0xdeba9d9e9928836a, 0xfc752045b0489edf, 0x80d43cc8359667aa, 0x30be0732473ea5c7, 0x533ce5db7a9732ff,
-          0x460091f4f31e615a, 0xf65f3695361e316b, 0x616ac45b7917e525, 0x09f85e8d914419e0, 0x442dfeedcb9377c7,
-          0x6ac978efbde5a4fe, 0x23213b205398de90, 0x2b18ae46436a0b66, 0x8d50649581d2e5a3, 0xbe01236d972ac492,
-          0xdd5ed03b20ec05f4, 0x286643af4bcc23a1, 0x8ec17f639f546cf8, 0xd951a0c4dfe20f95, 0x133ef3b6e2fee078,
-          0xb7b9a7c3926ab28c, 0x18d19fdbe6c2e810, 0x2efc8a838b880ecb, 0x41bfdb1241ea9e8c, 0x38220938178432ed,
-          0x5f97bcdb463dd2d5, 0x8ef7420f111da5cd, 0x67e20c4cc51952a2, 0x49e6bdfe35ba1bc3, 0xf9d938357fe93bae,
-          0x49964faf63d3886f, 0xc96c90170b09e914, 0xe37beab060a83021, 0x67b5e215150cb7e7, 0xdd65b38bc42292dc,
-          0xd99df08f72008788, 0x8970f73544994350, 0x4919e37edc6a78fb, 0x60f8eb5d5da7d7ef, 0x144c2530da7ff192,
-          0x25c572c29715116e, 0x5964c8a8134f81e5, 0x90dd7ede1768b784, 0x6fae3da5f90594f0, 0xa20462ef714ac37a,
-          0x8aeb50a4e3a25b1b, 0xd199ba856b5b05ae, 0x82bea1509d9dbbef, 0xc64845b13cf2b0b8, 0xbb72059ffad39f90,
-          0xb4dbe82dc695c2ac, 0x33b87a81650a3ff4, 0x6e1260fa10c81145, 0xf44f3a5b2c74fae0, 0x719b18352a1004dc,
-          0xb23456cd1a776afa, 0x4854b04a31f92de3, 0xd0778ddc5bd9c784, 0xba2a9b7641c74a0b, 0xba05d8a13585880a,
-          0x7c174525110cc92f, 0x1a6ce2150bbcff70, 0xd456878b4cd7ab82, 0x05dd64e12a0d0899, 0x8d5478c674c05f76,
-          0x3122dc76f2b3a665, 0xe329fb12a7f49091, 0x21c97cc93a1ba017, 0x84dab9f9dc353e76, 0x1f67314b395581de,
-          0x4692acb281565e9b, 0x508a06feaec22751, 0x14c593f293fe0561, 0x32735534fa8b44b6, 0xfd08853f6f40a890,
-          0x802aa9b5c71b7431, 0xfe205a7638550771, 0xb4f31dbdb3f959c1, 0x2ed08c61c29cd7c0, 0xc169e0405080e483,
-          0x23b5f98679923557, 0x433e3ec2d6772299, 0x8ab96f71acfd7005, 0xe660dda9ed8dfc81, 0x6596c98e487aecf0,
-          0x8e595a04e5450f1e, 0x5e69fd59af290f09, 0x06587cdfc009c27c, 0xba7095b89e2cb55f, 0xfd0c5b9ef8f2b891,
-          0x67f019154bc4d75a, 0x03169ab61ff443d5, 0x5fbb200ba39332ea, 0x96c6ca85745ca139, 0x98e8b46e62020bc5,
-          0x4e1f37615a2d9c23, 0x0697547b50858eef, 0x8bce5ed5490f792d, 0xe5c9c46a1ce3961e, 0x8455b5311dcb90e0,
-          0xffaea841f72ee447, 0x2c95e84bd208f3f8, 0x0185f78014360e2f, 0x7b17ae69662374f6, 0xeb2231cfe2b27bb6,
-          0x78f4e6fe44700f35, 0xdc3f1d70dcde2dd7, 0x85913cef60abc5ea, 0x1610d827b51b552c, 0x6ffee80f142ce502,
-          0x9bf5e29b826c7747, 0x15716f7d33900d76, 0xbf9c229876662516, 0xe80865584de484d2, 0xd061a62d8c2dbce2,
-          0x8cb33915f543698d, 0x020a36c87806969a, 0xd41f8c7919051cd4, 0xa1b56a386eca8696, 0xc423af7b149eb51b,
-          0x65802aafef88f508, 0x07d60f8194423a19, 0xded04985da47a958, 0x6b3e898649d97a29, 0x2bdea6f5ead242ee,
-          0xc604fa74884822dc, 0x4e466b7f799a547c, 0xe9992ad3dcb28cc8, 0xaea25fb6f8bff854, 0xabf834b50f03d271,
-          0x57d88e2b773f7645, 0xacb6d51669beb6e3, 0x07b54ca8d7709965, 0xc8759bb79fec8575, 0x09638556bbc7010a,
-          0xf2296c7bb2aaa715, 0x520e62228833eef4, 0xbcdd1ceb1de9e2b6, 0xf036f741ab443713, 0xa3b37e0c1a81c7d6,
-          0x7c4a8a75abea2eea, 0xbded3c783d2c88e7, 0x526a048890ae1e1f, 0x70c378bf9e425d99, 0xf9b3b77158ab4832,
-          0x56db2f28bffb56ed, 0x2eedc1d0407097f7, 0xbaf99d3319e67c54, 0x0a1dc3fcc21c2704, 0x9e52d3273653c6bc,
-          0xffe2c575d152bb41, 0xaf0fe4409a984d9c, 0xac837ed738e77133, 0x0bed32398c45778f, 0x5dd7be47c85dfe77,
-          0x3cbf7200c5e87c15, 0x097c75afc8f3b523, 0x5c41d20a5158bd58, 0xcb2ed26c7e697742, 0x63d3975d3390af0d,
-          0x8593b5c616589a24, 0x818a50378e574ded, 0x9f43b74ddcd9a96b, 0x2b5b4e8729eeecdb, 0x58e817cfe614a664,
-          0xc1c2ce20cc94a706, 0x6ae09c10c3d95bb6, 0x0945feea31687425, 0xbdf806d5220fa1d1, 0x9d9fb861168f966b,
-          0x6ad4c114dff31dda, 0xa35d90d86ec9ebbd, 0x67331bf753730632, 0x3f464cb2e0768ae5, 0x2cae76126efad3a6,
-          0x7002df046f7ed191, 0x8c9c12cfb7ca36b2, 0x21d97dac20da26b7, 0x9f0bea75434b8102, 0x9e9be00b7df3c405,
-          0x4f6bc3e110c628d0, 0xe5554939cdf8c1f7, 0xfdbc2adebfb18e53, 0x0b8c9f6fc5379d08, 0x377170400ff995cb,
-          0x3647708ba3ef64dd, 0x894b40636058e397, 0x64c0be201244347d, 0xb1b84bf2fde3f3d1, 0x0d8df19237a7b1eb,
-          0x7e7273cce2e4c7a9, 0xe60216796786b2cc, 0xb0063aadb952fada, 0x2fff10a943977861, 0x9f432c49046a789e,
-          0xe84e507bf7757534, 0x3c9cb7c922840039, 0xe0a62c30f1f0be15, 0xaf915d846d483e77, 0xecffc4a17717a7c1,
-          0xfbcc30da217537a5, 0xfb90d53085bf9551, 0x3c29cabdbfac4a25, 0x84d2763fa81cd88f, 0x4bf004ab18e4f2ec,
-          0x7aadd5f2c6101db0, 0x8017a9332433ec86, 0x150e2e7966e79223, 0x16303499fe2f4c34, 0x3e533779f875f9aa,
-          0x97b361cec6a0eff9, 0x752a1af34cb2b8d4, 0xe8934fea49bb8662, 0xb3e8fe4cedb3bd5a, 0xfbd5f0e667f6fbfa,
-          0x74654ac3eb83799b, 0xd8f592e2e0635c0b, 0x31285b1dacac3b5f, 0x8828349cf91b7b7f, 0x9d9a99d47016a04f,
-          0x5222341b815dea5f, 0x9a83e5b1e1aa99ee, 0x31c5057daa29cbf7, 0x3be9dd4e3b0eaa00, 0xafabdff7002f97da,
-          0x99af484129596e7f, 0x9dde9f31dc9672de, 0x3360156f187ebcc2, 0x8b1f4bd2f0bee9c4, 0xf3f8a405e4e0f7b8,
-          0x807539052ff277b9, 0x5cf93ab5a44036a3, 0x591bbb58e04afbca, 0x09fcb07b649a9314, 0x8b5116ad69e692cf,
-          0xbf1680e45c7e655c, 0x0c9ff00a9e36b595, 0x85391ed0a658435f, 0xb9d47067f620b812, 0x44ec6a7826109696,
-          0x15b42ac71070000f, 0x04d7733b96a669d1, 0x16d7703d7bd330e8, 0x46c72d097abf3914, 0xdbf2cfe86ebe0415,
-          0x6b73f7cc976d183c, 0xeaf3dc437f44c15c, 0xac123a04db33e2f1, 0xfa4752a0a7c3d566, 0x2210a828545cc378,
-          0x1d176965c6d84356, 0x5e3736ed92ed586f, 0x8cc48b9cb8b33c39, 0x728d2e3fb7d10bb3, 0x84eb6aedb6bd5abd,
-          0x633023fdc5db9ab6, 0xc5376afa11c2ce83, 0xc86dd2aec17eac27, 0x7c3ffde46f79216d, 0xe8cabbe84ea06003,
-          0x89121698550e8569, 0x79656b381658dea5, 0xa00fdac0ab7945ed, 0x16324236b89c03f2, 0x09cc50b73aebbf9c,
-          0x4f909e66c921bae0, 0x1869992038e7a3c8, 0xacd4682ab0c5ef14, 0xa83075ae26d11ecb, 0x90b1258eef6cb6e9,
-          0x28c0a558038ef486, 0xe9fab5eda269970f, 0xb8b162ff45792947, 0x1eee2700f4185dd7, 0x66e8919e338f18b4,
-          0x5b8e479aa870d5a5, 0xe7d2afc9ed4cb0df, 0xbe144f5e9578b3bb, 0x47d0b09fcd15065c, 0x2fa6de39d5892a7f,
-          0x1c664a80023a6e49, 0xb1da3745c0e0ccfe, 0xede912ead91ea61b, 0xd5d31b56fa74b742, 0x822cac6028eb5ceb,
-          0x42ac9178331e8d46, 0xd1ddccf9ec6e3c2e, 0x567bd7554bcd3dc5, 0x746f695c7fc7aa79, 0xb4b0f6cf3b35811a,
-          0x0ea61aa14cacff38, 0xa378422d8df60897, 0x86ae4960577b5c98, 0x5b2413415b8faeb2, 0x1bb2e39c14b21cc7,
-          0xb0301f5e10996e68, 0x4495bd1a92de6522, 0x7025ab2c01c29935, 0xddbfac27c1f994b2, 0x8a1211978545f572,
-          0x7e12985db3199e65, 0x255fba8ecd7e95d1, 0xbb8a35f699cc90f9, 0x831af744f70e5bd5, 0x0c1d918ae82d1845,
-          0xb447706b669d5d1d, 0xaa2b3290ab64ff9a, 0x5e35a83517a3b9af, 0x0fb5ffa7bcce9f96, 0xef663daad5247e99,
-          0x593cc544429d61e3, 0x503df9e3b00905ff, 0x692e957714da768b, 0x9e848bd466a9eeb6, 0x40899aea63f7f670,
-          0x9c5431a537d13047, 0x29b5daac6e4bbf3e, 0x4b81fc46a4be62e7, 0xc6087901c268be0a, 0x0adeed888f63a0ae,
-          0x68ac180ea85b4bf0, 0x10b0b42a424f1275, 0x41d8c31d0dae26be, 0xbb58a444e8b63215, 0x40026885bbff6b32,
-          0x83fbf40245529644, 0x8122678ec575396d, 0x190ce9684599718a, 0x49ccf3cd56edb79e, 0x821c39358f5cebb7,
-          0xf09e921dae97403e, 0x52b1e26c9ff77f16, 0x93266e49f7109270, 0x2e300f028133262b, 0x68aafd9f96a56757,
-          0x28ebb9d9e6d6f28f, 0xffc998f719ef9d5c, 0x3b381659117d48ad, 0xfc9fe7c83296d3f1, 0xe4e2bc0724d78f9c,
-          0x15d8ccccdb5edcb3, 0x191ccec8aae7494d, 0x515afa36a11ed7cf, 0x84e7a1f68f9f9fbf, 0x61102364ab12d3a7,
-          0x12be08b062662236, 0xaf9b8962d7eba25e, 0x4efa3e075426bf24, 0x15240d9ff544764a, 0x5512a79cc6194e68,
-          0x565600d778737cda, 0xe2f1b8a960ce7ac9, 0x7a9761adfc4d0c4b, 0x75b0a082fe413e59, 0xd6d38daf295690ce,
-          0x2949345150f2d525, 0xfe56820ab7645399, 0x4dd3c7f6ebf9e67d, 0x30b06f9f992dffc6, 0x06852db1b91681a1,
-          0x97de05d33cccca7f, 0xe3999dcd17ff764a, 0x1f9f5c34e6f9f7c3, 0xff07f3b268d706e6, 0xf3c389d41d5dd877,
-          0x5b18fc2c2fc76bf2, 0x84bff19844c41149, 0x8d5a0b786513fb81, 0xee6d8337a36f41c4, 0x183be31bd9f4cfde,
-          0x5b48eba429123af5, 0xa7b1753d4bc3cb6e, 0x2df280ba6ed71434, 0x2bc4473c62819956, 0x56dbeb443711e79a,
-          0xb06749b9c44e2654, 0xfabd4b5b0d54f3fd, 0xe4a71f4becddf66c, 0x492d5a7fd40dd502, 0x3d59ed4fdb528c79,
-          0x1cc73f0532beb735, 0x62f6bd85a4dc68f4, 0x8443558432aa6bc9, 0xda79d92de17a9c34, 0xe7e5039b4ef54125,
-          0xa242406254553eeb, 0x82e213bec2282484, 0xdd04b3d90f01ff7d, 0x2f37a20357eefee0, 0xcd3a33e56dd0af9e,
-          0xadfc9f05ca0f9c56, 0xb6b0b6ba0ae85636, 0x8594baa92f459812, 0x7219ba6d2953a4b9, 0xecf8ca01e6e1370b,
-          0xb9b73d683ac9eec3, 0x064836405032a3ad, 0xdbc5c3ac09b28516, 0xc44220e3b740ef5c, 0x6c33144a7746077a,
-          0xab3f3c09258a1463, 0xe3e4b10779564cdc, 0xed03766d56fd12c0, 0x446c8d52dfd1bceb, 0xb5a89eb7a6de88dd,
-          0x86d56061d4e23093, 0x8d7ae13abc327115, 0xbd763a63fee49985, 0x0e8f2f7fc2b838dc, 0x9f55cd5a0b1adc88,
-          0xa424f2880a85ed72, 0xdd0edad7ea0790ec, 0x01861ea37a5d1cb7, 0xfc39abc6a47d3871, 0xfecd37bb2d9a7675,
-          0xc21197a2fa0d0000};
+        static constexpr std::string_view etag{"\"6f48fcf0b001ded6\""};
+        static constexpr std::array<uint8_t, 5166> data{
+          0xf1, 0xd0, 0x69, 0x03, 0x60, 0x55, 0x90, 0xc9, 0xbd, 0x5b, 0x38, 0x51, 0xdd, 0xee, 0x26, 0x6a, 0x79, 0x36, 0x69, 0x3a, 0xaf, 0xe0, 0x37, 0x89,
+          0xe0, 0xe1, 0x97, 0xaa, 0x77, 0x2e, 0xa7, 0x9f, 0x65, 0x20, 0x01, 0xe9, 0xf5, 0x58, 0x2b, 0xa3, 0x63, 0x6c, 0xdb, 0xcd, 0x93, 0x0d, 0xb1, 0x69,
+          0x09, 0xd2, 0x03, 0x9c, 0x4e, 0x43, 0x54, 0x53, 0x45, 0xd8, 0x75, 0xa5, 0x39, 0x27, 0x79, 0xa5, 0xf4, 0x35, 0x0f, 0xab, 0x80, 0xb8, 0x37, 0xf4,
+          0xb2, 0xcd, 0xb6, 0x4e, 0x49, 0xb7, 0x2f, 0x06, 0x37, 0x43, 0x75, 0xf8, 0xf2, 0x4a, 0x39, 0x1c, 0x68, 0x30, 0x34, 0x6d, 0x96, 0x14, 0x10, 0x9d,
+          0x09, 0xd2, 0xc3, 0x85, 0xc5, 0x9c, 0x42, 0xe9, 0x17, 0x27, 0x0a, 0x85, 0x14, 0xc6, 0xac, 0xda, 0x5b, 0xbd, 0x5f, 0xd6, 0x50, 0x01, 0x26, 0x2c,
+          0x80, 0x44, 0x25, 0x00, 0x85, 0x85, 0xc8, 0x56, 0x75, 0x76, 0x85, 0xc6, 0x7e, 0x37, 0xb7, 0xdf, 0x19, 0xd3, 0x59, 0x55, 0xfd, 0x66, 0xe6, 0xcd,
+          0xee, 0xe9, 0xd6, 0xca, 0x58, 0x8b, 0x45, 0x1d, 0xe4, 0x87, 0xa8, 0x10, 0xda, 0x3b, 0x41, 0x3d, 0xc4, 0x56, 0x7d, 0x6a, 0xe7, 0xa6, 0xea, 0x7e,
+          0x2d, 0x21, 0x84, 0x7c, 0x24, 0xa1, 0x58, 0x3b, 0xde, 0xd7, 0xb5, 0xc7, 0xe2, 0xaf, 0x77, 0x14, 0x2b, 0x3d, 0x96, 0x36, 0xb9, 0xa9, 0x3d, 0xdf,
+          0x70, 0xfd, 0x37, 0x43, 0xed, 0x23, 0xea, 0x70, 0x57, 0x08, 0xd1, 0xdf, 0x70, 0xc7, 0xa2, 0xe0, 0xed, 0x6a, 0xf9, 0xe7, 0xc0, 0x4c, 0x88, 0x66,
+          0x41, 0x79, 0xfc, 0xc4, 0x97, 0x9c, 0x31, 0x48, 0x7f, 0xfa, 0x26, 0x4a, 0x5a, 0xf9, 0xbd, 0x21, 0xad, 0x45, 0xcf, 0x16, 0x39, 0xf7, 0x84, 0x82,
+          0x66, 0x62, 0x53, 0x37, 0x71, 0x20, 0x55, 0xda, 0x7a, 0x45, 0x51, 0x37, 0x5e, 0xec, 0xdb, 0x54, 0x9b, 0xe6, 0x91, 0x58, 0x98, 0xd8, 0x5b, 0x5f,
+          0xa5, 0xad, 0x1a, 0x63, 0x9e, 0x46, 0xad, 0xab, 0x8f, 0xb0, 0x10, 0x20, 0x1a, 0xa3, 0xda, 0xf3, 0x5c, 0xf6, 0xb3, 0xe4, 0x81, 0x4b, 0xf1, 0x66,
+          0x9f, 0x2f, 0xaa, 0xa5, 0x75, 0xf9, 0xfb, 0xb4, 0xa0, 0xa1, 0x58, 0x3b, 0xd6, 0x88, 0x81, 0x97, 0xbd, 0x15, 0x1f, 0x3e, 0x21, 0xfa, 0x27, 0x26,
+          0x2c, 0x77, 0xb4, 0x43, 0x16, 0x9f, 0x2d, 0xe3, 0x10, 0x85, 0x05, 0xee, 0x51, 0xce, 0x84, 0x01, 0xfd, 0x39, 0xbb, 0x1b, 0x23, 0x7d, 0xe8, 0x75,
+          0xc7, 0xf1, 0x6d, 0x77, 0x56, 0x1f, 0x2c, 0x1b, 0xef, 0x82, 0xfc, 0x7b, 0x70, 0x62, 0x30, 0x3c, 0xed, 0x24, 0x8f, 0x26, 0x5e, 0x9f, 0x9c, 0x0a,
+          0xf1, 0xe1, 0x33, 0x21, 0x65, 0xf5, 0x41, 0x31, 0x28, 0xa9, 0x91, 0xd0, 0xa4, 0x22, 0xac, 0xd6, 0x96, 0xc7, 0x37, 0x1b, 0x26, 0x86, 0x5e, 0x36,
+          0x07, 0x41, 0xda, 0xcc, 0x8d, 0x40, 0x2f, 0x69, 0x1a, 0xf9, 0x38, 0xc0, 0xc6, 0x75, 0xd7, 0x93, 0xdb, 0x63, 0x46, 0x7a, 0x7b, 0xbb, 0xfb, 0x7e,
+          0xd9, 0xa5, 0xe6, 0xc8, 0xba, 0xee, 0x41, 0xfd, 0xe3, 0x54, 0xde, 0x2f, 0x62, 0x40, 0xf9, 0xe2, 0x07, 0x76, 0x38, 0x17, 0xaf, 0x8c, 0x91, 0x55,
+          0xe4, 0xff, 0xec, 0x80, 0xcd, 0x5e, 0x48, 0xe3, 0x10, 0x1e, 0x37, 0x07, 0x0c, 0x54, 0x3c, 0x05, 0xba, 0xdb, 0xdd, 0x6a, 0x5a, 0xc8, 0xde, 0x40,
+          0xe3, 0xff, 0x39, 0x2e, 0x1c, 0xae, 0x66, 0xdd, 0xc3, 0x6a, 0xda, 0x71, 0x67, 0xbc, 0xc8, 0x37, 0xff, 0x89, 0x72, 0x97, 0x57, 0x41, 0xe7, 0x48,
+          0xe7, 0xf1, 0x43, 0xd3, 0x7c, 0xf2, 0x8b, 0x60, 0x1c, 0x55, 0x4f, 0xdd, 0x35, 0x6b, 0xf5, 0x0e, 0x07, 0x3c, 0x59, 0x68, 0x6c, 0xf6, 0xa6, 0x79,
+          0x7a, 0xee, 0x25, 0xf4, 0x0b, 0x0b, 0x9b, 0xc9, 0x0b, 0xdf, 0x1d, 0x67, 0x79, 0xd7, 0x80, 0xe9, 0x0f, 0x2a, 0xac, 0x1c, 0xfc, 0x63, 0x3d, 0xeb,
+          0x51, 0x3e, 0x11, 0x50, 0x50, 0x88, 0x03, 0x90, 0x2c, 0x7e, 0xde, 0xaa, 0x7c, 0x95, 0xae, 0xde, 0x23, 0xaf, 0xc7, 0x8f, 0x1f, 0xf0, 0x07, 0xfe,
+          0x23, 0xef, 0x9f, 0xfe, 0x20, 0x8e, 0xeb, 0xb4, 0xfc, 0xdc, 0xff, 0x70, 0xc0, 0x96, 0xa7, 0x81, 0xa8, 0xd9, 0xf3, 0xe7, 0x89, 0xb0, 0x7b, 0x0b,
+          0xb1, 0x22, 0x60, 0xb2, 0xec, 0xde, 0xa7, 0x0c, 0xa9, 0x1c, 0xaf, 0xd9, 0xcf, 0x3a, 0x8f, 0x02, 0x3b, 0xf8, 0x4f, 0x8b, 0x38, 0x6e, 0x45, 0xdb,
+          0x32, 0x29, 0x31, 0xa4, 0x6a, 0x37, 0x30, 0x9a, 0xd8, 0x52, 0x67, 0x62, 0xe5, 0x8b, 0x17, 0x6d, 0xd9, 0x9b, 0x3e, 0x17, 0xfb, 0x77, 0x2c, 0x57,
+          0x6a, 0x26, 0xe8, 0x46, 0x59, 0x8d, 0xeb, 0xad, 0x5b, 0xd5, 0xff, 0x5f, 0x3d, 0xcd, 0x77, 0xd3, 0xb4, 0x00, 0x52, 0x45, 0x4b, 0x6d, 0xed, 0xc0,
+          0x6b, 0x59, 0xcd, 0xe3, 0x95, 0xaf, 0x59, 0x1e, 0x6a, 0xb2, 0x80, 0xbf, 0xe3, 0x20, 0x30, 0x48, 0x9f, 0xf5, 0x98, 0xfe, 0xd3, 0xe7, 0x5d, 0xaa,
+          0xec, 0x1c, 0x89, 0x66, 0x6b, 0x79, 0x35, 0x56, 0xba, 0x67, 0x86, 0x10, 0xaf, 0xe0, 0x50, 0x75, 0x49, 0x4b, 0xcd, 0xea, 0x9f, 0x08, 0x80, 0x7d,
+          0xc2, 0xbe, 0xe1, 0x17, 0x8d, 0xab, 0x60, 0x62, 0x18, 0x71, 0x3a, 0xbe, 0x0b, 0x3a, 0x13, 0x14, 0xb2, 0xc0, 0x0a, 0x77, 0x84, 0x55, 0x15, 0x3d,
+          0x55, 0xb1, 0x54, 0xd0, 0x2a, 0xd8, 0x14, 0x2d, 0x80, 0xbb, 0xeb, 0x30, 0x9e, 0x51, 0x5b, 0x39, 0xdc, 0x7b, 0x83, 0xca, 0x3b, 0x03, 0x69, 0x46,
+          0xff, 0x35, 0x18, 0x70, 0x8b, 0xba, 0xa5, 0x28, 0xb0, 0x8d, 0x8a, 0xb0, 0x85, 0x7e, 0xba, 0x8c, 0x7e, 0x55, 0x6c, 0x20, 0x7e, 0xc4, 0x6d, 0xa6,
+          0xf5, 0xa8, 0x0a, 0x55, 0x48, 0xf0, 0x4e, 0xb3, 0xb1, 0x8e, 0x13, 0x76, 0x30, 0xc8, 0x8f, 0xdc, 0x09, 0x41, 0xd0, 0x6c, 0x5f, 0x37, 0x74, 0x17,
+          0x4b, 0xa0, 0xca, 0xd6, 0x72, 0x68, 0x7a, 0x9c, 0x99, 0x05, 0x1c, 0x94, 0x07, 0x9b, 0xde, 0x39, 0xd1, 0x0c, 0xd0, 0x77, 0x1a, 0x40, 0x77, 0x08,
+          0x19, 0x78, 0x1f, 0x95, 0x54, 0xd2, 0x25, 0xce, 0x25, 0xfa, 0xfa, 0x29, 0x96, 0x61, 0x81, 0xc1, 0xbe, 0x4a, 0x6d, 0x5d, 0x3e, 0xe0, 0x02, 0x94,
+          0x8a, 0x00, 0x14, 0xfc, 0xfa, 0xe6, 0x34, 0xce, 0x22, 0x0a, 0x5e, 0x0c, 0x15, 0xba, 0x22, 0xaf, 0x14, 0xbf, 0xf6, 0x77, 0xc2, 0xcb, 0x42, 0x03,
+          0x8e, 0x65, 0xc7, 0x53, 0x16, 0x0e, 0xe4, 0x14, 0xbc, 0x09, 0xe3, 0x7c, 0x75, 0x72, 0x82, 0x6b, 0x00, 0x5e, 0x69, 0x5a, 0x4a, 0x47, 0xec, 0x20,
+          0x78, 0xc0, 0xee, 0xb5, 0xa5, 0x0c, 0x41, 0x25, 0xdf, 0x19, 0x26, 0x7c, 0xb4, 0x61, 0xfb, 0x5a, 0xbc, 0xe5, 0xa6, 0x28, 0x4b, 0xd8, 0xbc, 0x7e,
+          0x7e, 0xe6, 0x71, 0xad, 0x90, 0xab, 0xf0, 0x1e, 0x66, 0xb6, 0xe1, 0xe3, 0x06, 0xc5, 0x53, 0x9a, 0xb5, 0x4c, 0x55, 0x09, 0x11, 0xa9, 0xd9, 0x67,
+          0x03, 0xf7, 0xe3, 0x11, 0x67, 0xdc, 0xa2, 0x89, 0xce, 0x24, 0x53, 0x01, 0xc8, 0xc5, 0xf6, 0xd1, 0xdd, 0xe8, 0x9f, 0x01, 0x16, 0xe9, 0xde, 0x0a,
+          0x46, 0x8c, 0x3e, 0x57, 0x47, 0x7f, 0xb7, 0xf1, 0xe9, 0x86, 0xee, 0x84, 0x45, 0xbc, 0x8b, 0x44, 0xb7, 0x96, 0x7a, 0x83, 0x65, 0x8a, 0x86, 0xfa,
+          0xb8, 0x3e, 0x8f, 0x32, 0xab, 0x0e, 0xab, 0x2d, 0xc5, 0x43, 0xab, 0x36, 0x3b, 0x27, 0x8e, 0x62, 0x4f, 0x7b, 0xe6, 0x75, 0xc1, 0x2c, 0xea, 0xfb,
+          0xa8, 0xea, 0x6c, 0xe6, 0x95, 0x34, 0x37, 0x0f, 0xfa, 0x33, 0xf1, 0x1b, 0x0b, 0xdc, 0xf9, 0xaa, 0x5f, 0x83, 0xcd, 0x8d, 0xe3, 0x10, 0x44, 0x82,
+          0x68, 0x71, 0x2b, 0xb9, 0x8d, 0x70, 0x3e, 0x33, 0x70, 0xee, 0x83, 0x4d, 0x49, 0xb8, 0x46, 0x04, 0x4f, 0x2b, 0xf6, 0x14, 0xb0, 0xf8, 0x80, 0x26,
+          0x47, 0xbb, 0x86, 0xbc, 0x29, 0x8d, 0x13, 0x49, 0xa4, 0x9b, 0x85, 0xda, 0xf6, 0xb3, 0x38, 0xf8, 0xf9, 0x58, 0x65, 0x1e, 0xed, 0xb2, 0x25, 0x44,
+          0xb3, 0x16, 0xed, 0x48, 0xc2, 0xdd, 0x1c, 0x6d, 0x89, 0xe9, 0x2a, 0x22, 0x61, 0xb1, 0x55, 0xfc, 0x90, 0x9e, 0x3f, 0xbb, 0x23, 0x41, 0xd6, 0x95,
+          0x4d, 0x39, 0xd1, 0x34, 0x47, 0x29, 0xe5, 0x37, 0x49, 0x49, 0xdb, 0x5c, 0x7a, 0x20, 0x1b, 0x51, 0x38, 0x8f, 0x43, 0xe1, 0x0a, 0x63, 0xf1, 0xe1,
+          0x07, 0xae, 0x15, 0xdc, 0xbb, 0x40, 0xba, 0x70, 0x23, 0x2d, 0xda, 0xff, 0xc7, 0x33, 0x3c, 0x5b, 0x41, 0x8e, 0x9b, 0x5c, 0xa2, 0x5b, 0xd9, 0x7c,
+          0xbe, 0x57, 0xee, 0xea, 0x26, 0xc0, 0xca, 0x53, 0x7e, 0x42, 0x1f, 0x16, 0xa1, 0xe4, 0xe9, 0x61, 0x7a, 0x29, 0x90, 0x06, 0x10, 0x61, 0xd2, 0x36,
+          0x26, 0xfb, 0x38, 0x41, 0xcd, 0xaf, 0x36, 0xd7, 0x97, 0xad, 0x60, 0x77, 0x95, 0xeb, 0x50, 0x37, 0xdb, 0x65, 0x13, 0x86, 0xd6, 0x09, 0xac, 0x57,
+          0xec, 0x4d, 0xe8, 0xa5, 0x69, 0x01, 0x4e, 0xb3, 0xd3, 0x04, 0x4a, 0xc3, 0xfe, 0x34, 0x52, 0xe8, 0xd0, 0xf6, 0x95, 0xb3, 0x88, 0x39, 0x58, 0xb4,
+          0xd4, 0xd8, 0x0c, 0x31, 0x5f, 0x4e, 0xb7, 0x8d, 0x97, 0x92, 0xa6, 0xe6, 0xb6, 0xa5, 0xfd, 0xad, 0xe5, 0xae, 0x58, 0x0a, 0xef, 0x33, 0xb3, 0x76,
+          0x79, 0xc0, 0xf5, 0xba, 0x23, 0x10, 0xad, 0x78, 0x9c, 0x87, 0xa4, 0xa7, 0xa6, 0x75, 0xf9, 0x65, 0xa7, 0xfa, 0x2f, 0x4b, 0xc4, 0x54, 0x78, 0x1d,
+          0x55, 0x65, 0x8f, 0x81, 0x9b, 0xbe, 0xd5, 0x1d, 0x8a, 0x65, 0x64, 0x43, 0xed, 0xa3, 0xd0, 0x4c, 0x0b, 0x83, 0xca, 0xad, 0x68, 0x05, 0x5a, 0x82,
+          0x4a, 0xde, 0x2d, 0xbc, 0x77, 0x80, 0xaa, 0x2d, 0x18, 0xfc, 0xf5, 0x52, 0xc2, 0x6c, 0x27, 0x72, 0x90, 0xb9, 0x11, 0x79, 0xe7, 0x81, 0x5c, 0xa2,
+          0xd8, 0x76, 0x90, 0xb5, 0x55, 0x23, 0xe4, 0xe8, 0x58, 0xf2, 0xa6, 0x02, 0x64, 0x00, 0x29, 0x75, 0x1b, 0xfc, 0xec, 0x10, 0x1f, 0xc4, 0x68, 0xfa,
+          0xa4, 0x1a, 0xb9, 0xfb, 0x0e, 0x57, 0xcd, 0x5d, 0xcf, 0x03, 0x09, 0x25, 0x4b, 0xca, 0xca, 0xd2, 0x77, 0x86, 0x25, 0xc2, 0x57, 0xa0, 0x55, 0x6a,
+          0x75, 0xc2, 0xdf, 0x7f, 0x44, 0xef, 0xdc, 0x83, 0x32, 0xd8, 0x95, 0xbe, 0xe3, 0x40, 0xb2, 0x30, 0xd8, 0x7f, 0x23, 0x77, 0x69, 0xf6, 0x41, 0x44,
+          0x1c, 0x0e, 0x75, 0x8e, 0x79, 0x47, 0xd2, 0x20, 0xb0, 0x54, 0x30, 0xc3, 0xd6, 0xd4, 0xca, 0x13, 0x89, 0xf6, 0x85, 0x2f, 0xbf, 0x35, 0x6a, 0xfe,
+          0xf3, 0x19, 0xd8, 0x27, 0x44, 0x1f, 0xe9, 0xb0, 0x93, 0xd4, 0x78, 0x55, 0x04, 0x4d, 0xc9, 0x7c, 0x85, 0xad, 0x63, 0x14, 0x36, 0xdd, 0x0f, 0xcd,
+          0x90, 0x71, 0x36, 0xc7, 0xee, 0x8a, 0x1e, 0x0c, 0x20, 0x23, 0xc4, 0x22, 0x6b, 0xc9, 0x98, 0xa1, 0xef, 0x10, 0xcf, 0x70, 0x26, 0x71, 0xaa, 0x51,
+          0x4d, 0xdc, 0x98, 0xef, 0x55, 0xc0, 0x44, 0x04, 0x16, 0xdf, 0x8c, 0x87, 0x23, 0xfe, 0x34, 0x34, 0x85, 0x6b, 0x9b, 0x78, 0xb6, 0x85, 0x6b, 0x2e,
+          0x81, 0xc2, 0xe2, 0xf7, 0x48, 0x0c, 0x35, 0x16, 0x5f, 0x4a, 0x94, 0xa3, 0x1f, 0x54, 0x02, 0xb2, 0x7a, 0x9a, 0x6c, 0xa4, 0x17, 0x83, 0xe9, 0x60,
+          0x24, 0xd7, 0x36, 0x77, 0x05, 0x37, 0x95, 0xfe, 0xaf, 0xb8, 0x94, 0x31, 0x74, 0x24, 0x38, 0x30, 0x7d, 0x72, 0x85, 0x6e, 0xec, 0xd9, 0x87, 0x95,
+          0xae, 0x17, 0x39, 0x93, 0xf5, 0x9f, 0x4b, 0x78, 0x82, 0x8f, 0x3c, 0x6f, 0xd2, 0x99, 0x03, 0xb2, 0x73, 0x22, 0xe5, 0x8b, 0x14, 0x1d, 0x85, 0xb5,
+          0x1c, 0xdb, 0x36, 0xfb, 0xda, 0xb8, 0x28, 0x72, 0xb5, 0x9b, 0xbd, 0x59, 0x8b, 0x68, 0x2b, 0x78, 0xa6, 0xef, 0x4f, 0x0e, 0xf3, 0xa2, 0xc0, 0xb0,
+          0x0b, 0x22, 0x1f, 0xae, 0xca, 0x3b, 0x62, 0xc2, 0x48, 0x8b, 0xdb, 0x6f, 0x16, 0x46, 0x6b, 0x33, 0xc8, 0x4e, 0x7a, 0xd5, 0xed, 0x69, 0x0d, 0x90,
+          0x83, 0x51, 0x51, 0x3d, 0x6c, 0xd3, 0x60, 0xf9, 0x8a, 0x40, 0x61, 0xf2, 0xa1, 0x37, 0x64, 0x44, 0xb2, 0xc7, 0x06, 0x2c, 0xc9, 0xaf, 0x50, 0x1b,
+          0x04, 0x39, 0xd5, 0x1a, 0x93, 0x21, 0x87, 0x83, 0xbe, 0x2b, 0xc9, 0xc8, 0x2d, 0x39, 0x00, 0x3d, 0x28, 0xa9, 0x8a, 0x78, 0x48, 0x59, 0x96, 0xc5,
+          0x46, 0xcf, 0x85, 0x8e, 0xe6, 0xfa, 0x27, 0x5d, 0xe5, 0x7e, 0xeb, 0xd8, 0xe3, 0x0d, 0x8d, 0xf7, 0x92, 0x62, 0x9a, 0x25, 0xd3, 0x06, 0xa8, 0x66,
+          0x9b, 0x82, 0xbe, 0xab, 0x00, 0x68, 0x59, 0x0d, 0xd9, 0xb0, 0x4f, 0x84, 0x9a, 0xbb, 0x36, 0x9d, 0x37, 0x2f, 0xa4, 0x51, 0x66, 0x89, 0x82, 0x86,
+          0xb8, 0x22, 0x71, 0xc8, 0xf0, 0xed, 0xf4, 0x6e, 0x74, 0xfd, 0x57, 0xce, 0x50, 0xa4, 0x08, 0x55, 0xce, 0x60, 0x24, 0x07, 0x00, 0xd2, 0x8b, 0x1c,
+          0xc8, 0xd1, 0x9a, 0xbe, 0x46, 0x74, 0x21, 0x41, 0x11, 0xe6, 0x75, 0xa9, 0xed, 0xf8, 0x94, 0x88, 0x82, 0x4a, 0x46, 0xc6, 0xe5, 0xee, 0x1e, 0xbd,
+          0xd3, 0x7b, 0xd9, 0x32, 0x84, 0xb7, 0xbc, 0xeb, 0x43, 0xd6, 0x2e, 0xce, 0xfa, 0xb8, 0x15, 0xae, 0xbf, 0x04, 0xbb, 0x2b, 0x97, 0x1c, 0xdf, 0x91,
+          0x22, 0x7c, 0x92, 0x1b, 0x8e, 0xff, 0xd8, 0x81, 0x25, 0xf8, 0x87, 0xa1, 0x6d, 0x15, 0x6c, 0x3d, 0x05, 0x74, 0x19, 0xde, 0x12, 0x63, 0xf6, 0x0f,
+          0x4e, 0xcf, 0x6f, 0x76, 0x72, 0xf3, 0x15, 0xab, 0xe5, 0xeb, 0xde, 0xc6, 0x21, 0xb7, 0x8a, 0x24, 0xc2, 0xf0, 0x13, 0x65, 0xfb, 0x05, 0x4e, 0x79,
+          0x9e, 0x50, 0x44, 0x69, 0x75, 0xe8, 0xc0, 0x1c, 0x1c, 0xdb, 0xdf, 0xcb, 0x60, 0xd8, 0xaf, 0xd1, 0xde, 0xba, 0x9d, 0x9e, 0x99, 0x28, 0x83, 0x6a,
+          0xfc, 0x75, 0x20, 0x45, 0xb0, 0x48, 0x9e, 0xdf, 0x80, 0xd4, 0x3c, 0xc8, 0x35, 0x96, 0x67, 0xaa, 0x30, 0xbe, 0x07, 0x32, 0x47, 0x3e, 0xa5, 0xc7,
+          0x53, 0x3c, 0xe5, 0xdb, 0x7a, 0x97, 0x32, 0xff, 0x46, 0x00, 0x91, 0xf4, 0xf3, 0x1e, 0x61, 0x5a, 0xf6, 0x5f, 0x36, 0x95, 0x36, 0x1e, 0x31, 0x6b,
+          0x61, 0x6a, 0xc4, 0x5b, 0x79, 0x17, 0xe5, 0x25, 0x09, 0xf8, 0x5e, 0x8d, 0x91, 0x44, 0x19, 0xe0, 0x44, 0x2d, 0xfe, 0xed, 0xcb, 0x93, 0x77, 0xc7,
+          0x6a, 0xc9, 0x78, 0xef, 0xbd, 0xe5, 0xa4, 0xfe, 0x23, 0x21, 0x3b, 0x20, 0x53, 0x98, 0xde, 0x90, 0x2b, 0x18, 0xae, 0x46, 0x43, 0x6a, 0x0b, 0x66,
+          0x8d, 0x50, 0x64, 0x95, 0x81, 0xd2, 0xe5, 0xa3, 0xbe, 0x01, 0x23, 0x6d, 0x97, 0x2a, 0xc4, 0x92, 0xdd, 0x5e, 0xd0, 0x3b, 0x20, 0xec, 0x05, 0xf4,
+          0x28, 0x66, 0x43, 0xaf, 0x4b, 0xcc, 0x23, 0xa1, 0x8e, 0xc1, 0x7f, 0x63, 0x9f, 0x54, 0x6c, 0xf8, 0xd9, 0x51, 0xa0, 0xc4, 0xdf, 0xe2, 0x0f, 0x95,
+          0x13, 0x3e, 0xf3, 0xb6, 0xe2, 0xfe, 0xe0, 0x78, 0xb7, 0xb9, 0xa7, 0xc3, 0x92, 0x6a, 0xb2, 0x8c, 0x18, 0xd1, 0x9f, 0xdb, 0xe6, 0xc2, 0xe8, 0x10,
+          0x2e, 0xfc, 0x8a, 0x83, 0x8b, 0x88, 0x0e, 0xcb, 0x41, 0xbf, 0xdb, 0x12, 0x41, 0xea, 0x9e, 0x8c, 0x38, 0x22, 0x09, 0x38, 0x17, 0x84, 0x32, 0xed,
+          0x5f, 0x97, 0xbc, 0xdb, 0x46, 0x3d, 0xd2, 0xd5, 0x8e, 0xf7, 0x42, 0x0f, 0x11, 0x1d, 0xa5, 0xcd, 0x67, 0xe2, 0x0c, 0x4c, 0xc5, 0x19, 0x52, 0xa2,
+          0x49, 0xe6, 0xbd, 0xfe, 0x35, 0xba, 0x1b, 0xc3, 0xf9, 0xd9, 0x38, 0x35, 0x7f, 0xe9, 0x3b, 0xae, 0x49, 0x96, 0x4f, 0xaf, 0x63, 0xd3, 0x88, 0x6f,
+          0xc9, 0x6c, 0x90, 0x17, 0x0b, 0x09, 0xe9, 0x14, 0xe3, 0x7b, 0xea, 0xb0, 0x60, 0xa8, 0x30, 0x21, 0x67, 0xb5, 0xe2, 0x15, 0x15, 0x0c, 0xb7, 0xe7,
+          0xdd, 0x65, 0xb3, 0x8b, 0xc4, 0x22, 0x92, 0xdc, 0xd9, 0x9d, 0xf0, 0x8f, 0x72, 0x00, 0x87, 0x88, 0x89, 0x70, 0xf7, 0x35, 0x44, 0x99, 0x43, 0x50,
+          0x49, 0x19, 0xe3, 0x7e, 0xdc, 0x6a, 0x78, 0xfb, 0x60, 0xf8, 0xeb, 0x5d, 0x5d, 0xa7, 0xd7, 0xef, 0x14, 0x4c, 0x25, 0x30, 0xda, 0x7f, 0xf1, 0x92,
+          0x25, 0xc5, 0x72, 0xc2, 0x97, 0x15, 0x11, 0x6e, 0x59, 0x64, 0xc8, 0xa8, 0x13, 0x4f, 0x81, 0xe5, 0x90, 0xdd, 0x7e, 0xde, 0x17, 0x68, 0xb7, 0x84,
+          0x6f, 0xae, 0x3d, 0xa5, 0xf9, 0x05, 0x94, 0xf0, 0xa2, 0x04, 0x62, 0xef, 0x71, 0x4a, 0xc3, 0x7a, 0x8a, 0xeb, 0x50, 0xa4, 0xe3, 0xa2, 0x5b, 0x1b,
+          0xd1, 0x99, 0xba, 0x85, 0x6b, 0x5b, 0x05, 0xae, 0x82, 0xbe, 0xa1, 0x50, 0x9d, 0x9d, 0xbb, 0xef, 0xc6, 0x48, 0x45, 0xb1, 0x3c, 0xf2, 0xb0, 0xb8,
+          0xbb, 0x72, 0x05, 0x9f, 0xfa, 0xd3, 0x9f, 0x90, 0xb4, 0xdb, 0xe8, 0x2d, 0xc6, 0x95, 0xc2, 0xac, 0x33, 0xb8, 0x7a, 0x81, 0x65, 0x0a, 0x3f, 0xf4,
+          0x6e, 0x12, 0x60, 0xfa, 0x10, 0xc8, 0x11, 0x45, 0xf4, 0x4f, 0x3a, 0x5b, 0x2c, 0x74, 0xfa, 0xe0, 0x71, 0x9b, 0x18, 0x35, 0x2a, 0x10, 0x04, 0xdc,
+          0xb2, 0x34, 0x56, 0xcd, 0x1a, 0x77, 0x6a, 0xfa, 0x48, 0x54, 0xb0, 0x4a, 0x31, 0xf9, 0x2d, 0xe3, 0xd0, 0x77, 0x8d, 0xdc, 0x5b, 0xd9, 0xc7, 0x84,
+          0xba, 0x2a, 0x9b, 0x76, 0x41, 0xc7, 0x4a, 0x0b, 0xba, 0x05, 0xd8, 0xa1, 0x35, 0x85, 0x88, 0x0a, 0x7c, 0x17, 0x45, 0x25, 0x11, 0x0c, 0xc9, 0x2f,
+          0x1a, 0x6c, 0xe2, 0x15, 0x0b, 0xbc, 0xff, 0x70, 0xd4, 0x56, 0x87, 0x8b, 0x4c, 0xd7, 0xab, 0x82, 0x05, 0xdd, 0x64, 0xe1, 0x2a, 0x0d, 0x08, 0x99,
+          0x8d, 0x54, 0x78, 0xc6, 0x74, 0xc0, 0x5f, 0x76, 0x31, 0x22, 0xdc, 0x76, 0xf2, 0xb3, 0xa6, 0x65, 0xe3, 0x29, 0xfb, 0x12, 0xa7, 0xf4, 0x90, 0x91,
+          0x21, 0xc9, 0x7c, 0xc9, 0x3a, 0x1b, 0xa0, 0x17, 0x84, 0xda, 0xb9, 0xf9, 0xdc, 0x35, 0x3e, 0x76, 0x1f, 0x67, 0x31, 0x4b, 0x39, 0x55, 0x81, 0xde,
+          0x46, 0x92, 0xac, 0xb2, 0x81, 0x56, 0x5e, 0x9b, 0x50, 0x8a, 0x06, 0xfe, 0xae, 0xc2, 0x27, 0x51, 0x14, 0xc5, 0x93, 0xf2, 0x93, 0xfe, 0x05, 0x61,
+          0x32, 0x73, 0x55, 0x34, 0xfa, 0x8b, 0x44, 0xb6, 0xfd, 0x08, 0x85, 0x3f, 0x6f, 0x40, 0xa8, 0x90, 0x80, 0x2a, 0xa9, 0xb5, 0xc7, 0x1b, 0x74, 0x31,
+          0xfe, 0x20, 0x5a, 0x76, 0x38, 0x55, 0x07, 0x71, 0xb4, 0xf3, 0x1d, 0xbd, 0xb3, 0xf9, 0x59, 0xc1, 0x2e, 0xd0, 0x8c, 0x61, 0xc2, 0x9c, 0xd7, 0xc0,
+          0xc1, 0x69, 0xe0, 0x40, 0x50, 0x80, 0xe4, 0x83, 0x23, 0xb5, 0xf9, 0x86, 0x79, 0x92, 0x35, 0x57, 0x43, 0x3e, 0x3e, 0xc2, 0xd6, 0x77, 0x22, 0x99,
+          0x8a, 0xb9, 0x6f, 0x71, 0xac, 0xfd, 0x70, 0x05, 0xe6, 0x60, 0xdd, 0xa9, 0xed, 0x8d, 0xfc, 0x81, 0x65, 0x96, 0xc9, 0x8e, 0x48, 0x7a, 0xec, 0xf0,
+          0x8e, 0x59, 0x5a, 0x04, 0xe5, 0x45, 0x0f, 0x1e, 0x5e, 0x69, 0xfd, 0x59, 0xaf, 0x29, 0x0f, 0x09, 0x06, 0x58, 0x7c, 0xdf, 0xc0, 0x09, 0xc2, 0x7c,
+          0xba, 0x70, 0x95, 0xb8, 0x9e, 0x2c, 0xb5, 0x5f, 0xfd, 0x0c, 0x5b, 0x9e, 0xf8, 0xf2, 0xb8, 0x91, 0x67, 0xf0, 0x19, 0x15, 0x4b, 0xc4, 0xd7, 0x5a,
+          0x03, 0x16, 0x9a, 0xb6, 0x1f, 0xf4, 0x43, 0xd5, 0x5f, 0xbb, 0x20, 0x0b, 0xa3, 0x93, 0x32, 0xea, 0x96, 0xc6, 0xca, 0x85, 0x74, 0x5c, 0xa1, 0x39,
+          0x98, 0xe8, 0xb4, 0x6e, 0x62, 0x02, 0x0b, 0xc5, 0x4e, 0x1f, 0x37, 0x61, 0x5a, 0x2d, 0x9c, 0x23, 0x06, 0x97, 0x54, 0x7b, 0x50, 0x85, 0x8e, 0xef,
+          0x8b, 0xce, 0x5e, 0xd5, 0x49, 0x0f, 0x79, 0x2d, 0xe5, 0xc9, 0xc4, 0x6a, 0x1c, 0xe3, 0x96, 0x1e, 0x84, 0x55, 0xb5, 0x31, 0x1d, 0xcb, 0x90, 0xe0,
+          0xff, 0xae, 0xa8, 0x41, 0xf7, 0x2e, 0xe4, 0x47, 0x2c, 0x95, 0xe8, 0x4b, 0xd2, 0x08, 0xf3, 0xf8, 0x01, 0x85, 0xf7, 0x80, 0x14, 0x36, 0x0e, 0x2f,
+          0x7b, 0x17, 0xae, 0x69, 0x66, 0x23, 0x74, 0xf6, 0xeb, 0x22, 0x31, 0xcf, 0xe2, 0xb2, 0x7b, 0xb6, 0x78, 0xf4, 0xe6, 0xfe, 0x44, 0x70, 0x0f, 0x35,
+          0xdc, 0x3f, 0x1d, 0x70, 0xdc, 0xde, 0x2d, 0xd7, 0x85, 0x91, 0x3c, 0xef, 0x60, 0xab, 0xc5, 0xea, 0x16, 0x10, 0xd8, 0x27, 0xb5, 0x1b, 0x55, 0x2c,
+          0x6f, 0xfe, 0xe8, 0x0f, 0x14, 0x2c, 0xe5, 0x02, 0x9b, 0xf5, 0xe2, 0x9b, 0x82, 0x6c, 0x77, 0x47, 0x15, 0x71, 0x6f, 0x7d, 0x33, 0x90, 0x0d, 0x76,
+          0xbf, 0x9c, 0x22, 0x98, 0x76, 0x66, 0x25, 0x16, 0xe8, 0x08, 0x65, 0x58, 0x4d, 0xe4, 0x84, 0xd2, 0xd0, 0x61, 0xa6, 0x2d, 0x8c, 0x2d, 0xbc, 0xe2,
+          0x8c, 0xb3, 0x39, 0x15, 0xf5, 0x43, 0x69, 0x8d, 0x02, 0x0a, 0x36, 0xc8, 0x78, 0x06, 0x96, 0x9a, 0xd4, 0x1f, 0x8c, 0x79, 0x19, 0x05, 0x1c, 0xd4,
+          0xa1, 0xb5, 0x6a, 0x38, 0x6e, 0xca, 0x86, 0x96, 0xc4, 0x23, 0xaf, 0x7b, 0x14, 0x9e, 0xb5, 0x1b, 0x65, 0x80, 0x2a, 0xaf, 0xef, 0x88, 0xf5, 0x08,
+          0x07, 0xd6, 0x0f, 0x81, 0x94, 0x42, 0x3a, 0x19, 0xde, 0xd0, 0x49, 0x85, 0xda, 0x47, 0xa9, 0x58, 0x6b, 0x3e, 0x89, 0x86, 0x49, 0xd9, 0x7a, 0x29,
+          0x2b, 0xde, 0xa6, 0xf5, 0xea, 0xd2, 0x42, 0xee, 0xc6, 0x04, 0xfa, 0x74, 0x88, 0x48, 0x22, 0xdc, 0x4e, 0x46, 0x6b, 0x7f, 0x79, 0x9a, 0x54, 0x7c,
+          0xe9, 0x99, 0x2a, 0xd3, 0xdc, 0xb2, 0x8c, 0xc8, 0xae, 0xa2, 0x5f, 0xb6, 0xf8, 0xbf, 0xf8, 0x54, 0xab, 0xf8, 0x34, 0xb5, 0x0f, 0x03, 0xd2, 0x71,
+          0x57, 0xd8, 0x8e, 0x2b, 0x77, 0x3f, 0x76, 0x45, 0xac, 0xb6, 0xd5, 0x16, 0x69, 0xbe, 0xb6, 0xe3, 0x07, 0xb5, 0x4c, 0xa8, 0xd7, 0x70, 0x99, 0x65,
+          0xc8, 0x75, 0x9b, 0xb7, 0x9f, 0xec, 0x85, 0x75, 0x09, 0x63, 0x85, 0x56, 0xbb, 0xc7, 0x01, 0x0a, 0xf2, 0x29, 0x6c, 0x7b, 0xb2, 0xaa, 0xa7, 0x15,
+          0x52, 0x0e, 0x62, 0x22, 0x88, 0x33, 0xee, 0xf4, 0xbc, 0xdd, 0x1c, 0xeb, 0x1d, 0xe9, 0xe2, 0xb6, 0xf0, 0x36, 0xf7, 0x41, 0xab, 0x44, 0x37, 0x13,
+          0xa3, 0xb3, 0x7e, 0x0c, 0x1a, 0x81, 0xc7, 0xd6, 0x7c, 0x4a, 0x8a, 0x75, 0xab, 0xea, 0x2e, 0xea, 0xbd, 0xed, 0x3c, 0x78, 0x3d, 0x2c, 0x88, 0xe7,
+          0x52, 0x6a, 0x04, 0x88, 0x90, 0xae, 0x1e, 0x1f, 0x70, 0xc3, 0x78, 0xbf, 0x9e, 0x42, 0x5d, 0x99, 0xf9, 0xb3, 0xb7, 0x71, 0x58, 0xab, 0x48, 0x32,
+          0x56, 0xdb, 0x2f, 0x28, 0xbf, 0xfb, 0x56, 0xed, 0x2e, 0xed, 0xc1, 0xd0, 0x40, 0x70, 0x97, 0xf7, 0xba, 0xf9, 0x9d, 0x33, 0x19, 0xe6, 0x7c, 0x54,
+          0x0a, 0x1d, 0xc3, 0xfc, 0xc2, 0x1c, 0x27, 0x04, 0x9e, 0x52, 0xd3, 0x27, 0x36, 0x53, 0xc6, 0xbc, 0xff, 0xe2, 0xc5, 0x75, 0xd1, 0x52, 0xbb, 0x41,
+          0xaf, 0x0f, 0xe4, 0x40, 0x9a, 0x98, 0x4d, 0x9c, 0xac, 0x83, 0x7e, 0xd7, 0x38, 0xe7, 0x71, 0x33, 0x0b, 0xed, 0x32, 0x39, 0x8c, 0x45, 0x77, 0x8f,
+          0x5d, 0xd7, 0xbe, 0x47, 0xc8, 0x5d, 0xfe, 0x77, 0x3c, 0xbf, 0x72, 0x00, 0xc5, 0xe8, 0x7c, 0x15, 0x09, 0x7c, 0x75, 0xaf, 0xc8, 0xf3, 0xb5, 0x23,
+          0x5c, 0x41, 0xd2, 0x0a, 0x51, 0x58, 0xbd, 0x58, 0xcb, 0x2e, 0xd2, 0x6c, 0x7e, 0x69, 0x77, 0x42, 0x63, 0xd3, 0x97, 0x5d, 0x33, 0x90, 0xaf, 0x0d,
+          0x85, 0x93, 0xb5, 0xc6, 0x16, 0x58, 0x9a, 0x24, 0x81, 0x8a, 0x50, 0x37, 0x8e, 0x57, 0x4d, 0xed, 0x9f, 0x43, 0xb7, 0x4d, 0xdc, 0xd9, 0xa9, 0x6b,
+          0x2b, 0x5b, 0x4e, 0x87, 0x29, 0xee, 0xec, 0xdb, 0x58, 0xe8, 0x17, 0xcf, 0xe6, 0x14, 0xa6, 0x64, 0xc1, 0xc2, 0xce, 0x20, 0xcc, 0x94, 0xa7, 0x06,
+          0x6a, 0xe0, 0x9c, 0x10, 0xc3, 0xd9, 0x5b, 0xb6, 0x09, 0x45, 0xfe, 0xea, 0x31, 0x68, 0x74, 0x25, 0xbd, 0xf8, 0x06, 0xd5, 0x22, 0x0f, 0xa1, 0xd1,
+          0x9d, 0x9f, 0xb8, 0x61, 0x16, 0x8f, 0x96, 0x6b, 0x6a, 0xd4, 0xc1, 0x14, 0xdf, 0xf3, 0x1d, 0xda, 0xa3, 0x5d, 0x90, 0xd8, 0x6e, 0xc9, 0xeb, 0xbd,
+          0x67, 0x33, 0x1b, 0xf7, 0x53, 0x73, 0x06, 0x32, 0x3f, 0x46, 0x4c, 0xb2, 0xe0, 0x76, 0x8a, 0xe5, 0x2c, 0xae, 0x76, 0x12, 0x6e, 0xfa, 0xd3, 0xa6,
+          0x70, 0x02, 0xdf, 0x04, 0x6f, 0x7e, 0xd1, 0x91, 0x8c, 0x9c, 0x12, 0xcf, 0xb7, 0xca, 0x36, 0xb2, 0x21, 0xd9, 0x7d, 0xac, 0x20, 0xda, 0x26, 0xb7,
+          0x9f, 0x0b, 0xea, 0x75, 0x43, 0x4b, 0x81, 0x02, 0x9e, 0x9b, 0xe0, 0x0b, 0x7d, 0xf3, 0xc4, 0x05, 0x4f, 0x6b, 0xc3, 0xe1, 0x10, 0xc6, 0x28, 0xd0,
+          0xe5, 0x55, 0x49, 0x39, 0xcd, 0xf8, 0xc1, 0xf7, 0xfd, 0xbc, 0x2a, 0xde, 0xbf, 0xb1, 0x8e, 0x53, 0x0b, 0x8c, 0x9f, 0x6f, 0xc5, 0x37, 0x9d, 0x08,
+          0x37, 0x71, 0x70, 0x40, 0x0f, 0xf9, 0x95, 0xcb, 0x36, 0x47, 0x70, 0x8b, 0xa3, 0xef, 0x64, 0xdd, 0x89, 0x4b, 0x40, 0x63, 0x60, 0x58, 0xe3, 0x97,
+          0x64, 0xc0, 0xbe, 0x20, 0x12, 0x44, 0x34, 0x7d, 0xb1, 0xb8, 0x4b, 0xf2, 0xfd, 0xe3, 0xf3, 0xd1, 0x0d, 0x8d, 0xf1, 0x92, 0x37, 0xa7, 0xb1, 0xeb,
+          0x7e, 0x72, 0x73, 0xcc, 0xe2, 0xe4, 0xc7, 0xa9, 0xe6, 0x02, 0x16, 0x79, 0x67, 0x86, 0xb2, 0xcc, 0xb0, 0x06, 0x3a, 0xad, 0xb9, 0x52, 0xfa, 0xda,
+          0x2f, 0xff, 0x10, 0xa9, 0x43, 0x97, 0x78, 0x61, 0x9f, 0x43, 0x2c, 0x49, 0x04, 0x6a, 0x78, 0x9e, 0xe8, 0x4e, 0x50, 0x7b, 0xf7, 0x75, 0x75, 0x34,
+          0x3c, 0x9c, 0xb7, 0xc9, 0x22, 0x84, 0x00, 0x39, 0xe0, 0xa6, 0x2c, 0x30, 0xf1, 0xf0, 0xbe, 0x15, 0xaf, 0x91, 0x5d, 0x84, 0x6d, 0x48, 0x3e, 0x77,
+          0xec, 0xff, 0xc4, 0xa1, 0x77, 0x17, 0xa7, 0xc1, 0xfb, 0xcc, 0x30, 0xda, 0x21, 0x75, 0x37, 0xa5, 0xfb, 0x90, 0xd5, 0x30, 0x85, 0xbf, 0x95, 0x51,
+          0x3c, 0x29, 0xca, 0xbd, 0xbf, 0xac, 0x4a, 0x25, 0x84, 0xd2, 0x76, 0x3f, 0xa8, 0x1c, 0xd8, 0x8f, 0x4b, 0xf0, 0x04, 0xab, 0x18, 0xe4, 0xf2, 0xec,
+          0x7a, 0xad, 0xd5, 0xf2, 0xc6, 0x10, 0x1d, 0xb0, 0x80, 0x17, 0xa9, 0x33, 0x24, 0x33, 0xec, 0x86, 0x15, 0x0e, 0x2e, 0x79, 0x66, 0xe7, 0x92, 0x23,
+          0x16, 0x30, 0x34, 0x99, 0xfe, 0x2f, 0x4c, 0x34, 0x3e, 0x53, 0x37, 0x79, 0xf8, 0x75, 0xf9, 0xaa, 0x97, 0xb3, 0x61, 0xce, 0xc6, 0xa0, 0xef, 0xf9,
+          0x75, 0x2a, 0x1a, 0xf3, 0x4c, 0xb2, 0xb8, 0xd4, 0xe8, 0x93, 0x4f, 0xea, 0x49, 0xbb, 0x86, 0x62, 0xb3, 0xe8, 0xfe, 0x4c, 0xed, 0xb3, 0xbd, 0x5a,
+          0xfb, 0xd5, 0xf0, 0xe6, 0x67, 0xf6, 0xfb, 0xfa, 0x74, 0x65, 0x4a, 0xc3, 0xeb, 0x83, 0x79, 0x9b, 0xd8, 0xf5, 0x92, 0xe2, 0xe0, 0x63, 0x5c, 0x0b,
+          0x31, 0x28, 0x5b, 0x1d, 0xac, 0xac, 0x3b, 0x5f, 0x88, 0x28, 0x34, 0x9c, 0xf9, 0x1b, 0x7b, 0x7f, 0x9d, 0x9a, 0x99, 0xd4, 0x70, 0x16, 0xa0, 0x4f,
+          0x52, 0x22, 0x34, 0x1b, 0x81, 0x5d, 0xea, 0x5f, 0x9a, 0x83, 0xe5, 0xb1, 0xe1, 0xaa, 0x99, 0xee, 0x31, 0xc5, 0x05, 0x7d, 0xaa, 0x29, 0xcb, 0xf7,
+          0x3b, 0xe9, 0xdd, 0x4e, 0x3b, 0x0e, 0xaa, 0x00, 0xaf, 0xab, 0xdf, 0xf7, 0x00, 0x2f, 0x97, 0xda, 0x99, 0xaf, 0x48, 0x41, 0x29, 0x59, 0x6e, 0x7f,
+          0x9d, 0xde, 0x9f, 0x31, 0xdc, 0x96, 0x72, 0xde, 0x33, 0x60, 0x15, 0x6f, 0x18, 0x7e, 0xbc, 0xc2, 0x8b, 0x1f, 0x4b, 0xd2, 0xf0, 0xbe, 0xe9, 0xc4,
+          0xf3, 0xf8, 0xa4, 0x05, 0xe4, 0xe0, 0xf7, 0xb8, 0x80, 0x75, 0x39, 0x05, 0x2f, 0xf2, 0x77, 0xb9, 0x5c, 0xf9, 0x3a, 0xb5, 0xa4, 0x40, 0x36, 0xa3,
+          0x59, 0x1b, 0xbb, 0x58, 0xe0, 0x4a, 0xfb, 0xca, 0x09, 0xfc, 0xb0, 0x7b, 0x64, 0x9a, 0x93, 0x14, 0x8b, 0x51, 0x16, 0xad, 0x69, 0xe6, 0x92, 0xcf,
+          0xbf, 0x16, 0x80, 0xe4, 0x5c, 0x7e, 0x65, 0x5c, 0x0c, 0x9f, 0xf0, 0x0a, 0x9e, 0x36, 0xb5, 0x95, 0x85, 0x39, 0x1e, 0xd0, 0xa6, 0x58, 0x43, 0x5f,
+          0xb9, 0xd4, 0x70, 0x67, 0xf6, 0x20, 0xb8, 0x12, 0x44, 0xec, 0x6a, 0x78, 0x26, 0x10, 0x96, 0x96, 0x15, 0xb4, 0x2a, 0xc7, 0x10, 0x70, 0x00, 0x0f,
+          0x04, 0xd7, 0x73, 0x3b, 0x96, 0xa6, 0x69, 0xd1, 0x16, 0xd7, 0x70, 0x3d, 0x7b, 0xd3, 0x30, 0xe8, 0x46, 0xc7, 0x2d, 0x09, 0x7a, 0xbf, 0x39, 0x14,
+          0xdb, 0xf2, 0xcf, 0xe8, 0x6e, 0xbe, 0x04, 0x15, 0x6b, 0x73, 0xf7, 0xcc, 0x97, 0x6d, 0x18, 0x3c, 0xea, 0xf3, 0xdc, 0x43, 0x7f, 0x44, 0xc1, 0x5c,
+          0xac, 0x12, 0x3a, 0x04, 0xdb, 0x33, 0xe2, 0xf1, 0xfa, 0x47, 0x52, 0xa0, 0xa7, 0xc3, 0xd5, 0x66, 0x22, 0x10, 0xa8, 0x28, 0x54, 0x5c, 0xc3, 0x78,
+          0x1d, 0x17, 0x69, 0x65, 0xc6, 0xd8, 0x43, 0x56, 0x5e, 0x37, 0x36, 0xed, 0x92, 0xed, 0x58, 0x6f, 0x8c, 0xc4, 0x8b, 0x9c, 0xb8, 0xb3, 0x3c, 0x39,
+          0x72, 0x8d, 0x2e, 0x3f, 0xb7, 0xd1, 0x0b, 0xb3, 0x84, 0xeb, 0x6a, 0xed, 0xb6, 0xbd, 0x5a, 0xbd, 0x63, 0x30, 0x23, 0xfd, 0xc5, 0xdb, 0x9a, 0xb6,
+          0xc5, 0x37, 0x6a, 0xfa, 0x11, 0xc2, 0xce, 0x83, 0xc8, 0x6d, 0xd2, 0xae, 0xc1, 0x7e, 0xac, 0x27, 0x7c, 0x3f, 0xfd, 0xe4, 0x6f, 0x79, 0x21, 0x6d,
+          0xe8, 0xca, 0xbb, 0xe8, 0x4e, 0xa0, 0x60, 0x03, 0x89, 0x12, 0x16, 0x98, 0x55, 0x0e, 0x85, 0x69, 0x79, 0x65, 0x6b, 0x38, 0x16, 0x58, 0xde, 0xa5,
+          0xa0, 0x0f, 0xda, 0xc0, 0xab, 0x79, 0x45, 0xed, 0x16, 0x32, 0x42, 0x36, 0xb8, 0x9c, 0x03, 0xf2, 0x09, 0xcc, 0x50, 0xb7, 0x3a, 0xeb, 0xbf, 0x9c,
+          0x4f, 0x90, 0x9e, 0x66, 0xc9, 0x21, 0xba, 0xe0, 0x18, 0x69, 0x99, 0x20, 0x38, 0xe7, 0xa3, 0xc8, 0xac, 0xd4, 0x68, 0x2a, 0xb0, 0xc5, 0xef, 0x14,
+          0xa8, 0x30, 0x75, 0xae, 0x26, 0xd1, 0x1e, 0xcb, 0x90, 0xb1, 0x25, 0x8e, 0xef, 0x6c, 0xb6, 0xe9, 0x28, 0xc0, 0xa5, 0x58, 0x03, 0x8e, 0xf4, 0x86,
+          0xe9, 0xfa, 0xb5, 0xed, 0xa2, 0x69, 0x97, 0x0f, 0xb8, 0xb1, 0x62, 0xff, 0x45, 0x79, 0x29, 0x47, 0x1e, 0xee, 0x27, 0x00, 0xf4, 0x18, 0x5d, 0xd7,
+          0x66, 0xe8, 0x91, 0x9e, 0x33, 0x8f, 0x18, 0xb4, 0x5b, 0x8e, 0x47, 0x9a, 0xa8, 0x70, 0xd5, 0xa5, 0xe7, 0xd2, 0xaf, 0xc9, 0xed, 0x4c, 0xb0, 0xdf,
+          0xbe, 0x14, 0x4f, 0x5e, 0x95, 0x78, 0xb3, 0xbb, 0x47, 0xd0, 0xb0, 0x9f, 0xcd, 0x15, 0x06, 0x5c, 0x2f, 0xa6, 0xde, 0x39, 0xd5, 0x89, 0x2a, 0x7f,
+          0x1c, 0x66, 0x4a, 0x80, 0x02, 0x3a, 0x6e, 0x49, 0xb1, 0xda, 0x37, 0x45, 0xc0, 0xe0, 0xcc, 0xfe, 0xed, 0xe9, 0x12, 0xea, 0xd9, 0x1e, 0xa6, 0x1b,
+          0xd5, 0xd3, 0x1b, 0x56, 0xfa, 0x74, 0xb7, 0x42, 0x82, 0x2c, 0xac, 0x60, 0x28, 0xeb, 0x5c, 0xeb, 0x42, 0xac, 0x91, 0x78, 0x33, 0x1e, 0x8d, 0x46,
+          0xd1, 0xdd, 0xcc, 0xf9, 0xec, 0x6e, 0x3c, 0x2e, 0x56, 0x7b, 0xd7, 0x55, 0x4b, 0xcd, 0x3d, 0xc5, 0x74, 0x6f, 0x69, 0x5c, 0x7f, 0xc7, 0xaa, 0x79,
+          0xb4, 0xb0, 0xf6, 0xcf, 0x3b, 0x35, 0x81, 0x1a, 0x0e, 0xa6, 0x1a, 0xa1, 0x4c, 0xac, 0xff, 0x38, 0xa3, 0x78, 0x42, 0x2d, 0x8d, 0xf6, 0x08, 0x97,
+          0x86, 0xae, 0x49, 0x60, 0x57, 0x7b, 0x5c, 0x98, 0x5b, 0x24, 0x13, 0x41, 0x5b, 0x8f, 0xae, 0xb2, 0x1b, 0xb2, 0xe3, 0x9c, 0x14, 0xb2, 0x1c, 0xc7,
+          0xb0, 0x30, 0x1f, 0x5e, 0x10, 0x99, 0x6e, 0x68, 0x44, 0x95, 0xbd, 0x1a, 0x92, 0xde, 0x65, 0x22, 0x70, 0x25, 0xab, 0x2c, 0x01, 0xc2, 0x99, 0x35,
+          0xdd, 0xbf, 0xac, 0x27, 0xc1, 0xf9, 0x94, 0xb2, 0x8a, 0x12, 0x11, 0x97, 0x85, 0x45, 0xf5, 0x72, 0x7e, 0x12, 0x98, 0x5d, 0xb3, 0x19, 0x9e, 0x65,
+          0x25, 0x5f, 0xba, 0x8e, 0xcd, 0x7e, 0x95, 0xd1, 0xbb, 0x8a, 0x35, 0xf6, 0x99, 0xcc, 0x90, 0xf9, 0x83, 0x1a, 0xf7, 0x44, 0xf7, 0x0e, 0x5b, 0xd5,
+          0x0c, 0x1d, 0x91, 0x8a, 0xe8, 0x2d, 0x18, 0x45, 0xb4, 0x47, 0x70, 0x6b, 0x66, 0x9d, 0x5d, 0x1d, 0xaa, 0x2b, 0x32, 0x90, 0xab, 0x64, 0xff, 0x9a,
+          0x5e, 0x35, 0xa8, 0x35, 0x17, 0xa3, 0xb9, 0xaf, 0x0f, 0xb5, 0xff, 0xa7, 0xbc, 0xce, 0x9f, 0x96, 0xef, 0x66, 0x3d, 0xaa, 0xd5, 0x24, 0x7e, 0x99,
+          0x59, 0x3c, 0xc5, 0x44, 0x42, 0x9d, 0x61, 0xe3, 0x50, 0x3d, 0xf9, 0xe3, 0xb0, 0x09, 0x05, 0xff, 0x69, 0x2e, 0x95, 0x77, 0x14, 0xda, 0x76, 0x8b,
+          0x9e, 0x84, 0x8b, 0xd4, 0x66, 0xa9, 0xee, 0xb6, 0x40, 0x89, 0x9a, 0xea, 0x63, 0xf7, 0xf6, 0x70, 0x9c, 0x54, 0x31, 0xa5, 0x37, 0xd1, 0x30, 0x47,
+          0x29, 0xb5, 0xda, 0xac, 0x6e, 0x4b, 0xbf, 0x3e, 0x4b, 0x81, 0xfc, 0x46, 0xa4, 0xbe, 0x62, 0xe7, 0xc6, 0x08, 0x79, 0x01, 0xc2, 0x68, 0xbe, 0x0a,
+          0x0a, 0xde, 0xed, 0x88, 0x8f, 0x63, 0xa0, 0xae, 0x68, 0xac, 0x18, 0x0e, 0xa8, 0x5b, 0x4b, 0xf0, 0x10, 0xb0, 0xb4, 0x2a, 0x42, 0x4f, 0x12, 0x75,
+          0x41, 0xd8, 0xc3, 0x1d, 0x0d, 0xae, 0x26, 0xbe, 0xbb, 0x58, 0xa4, 0x44, 0xe8, 0xb6, 0x32, 0x15, 0x40, 0x02, 0x68, 0x85, 0xbb, 0xff, 0x6b, 0x32,
+          0x83, 0xfb, 0xf4, 0x02, 0x45, 0x52, 0x96, 0x44, 0x81, 0x22, 0x67, 0x8e, 0xc5, 0x75, 0x39, 0x6d, 0x19, 0x0c, 0xe9, 0x68, 0x45, 0x99, 0x71, 0x8a,
+          0x49, 0xcc, 0xf3, 0xcd, 0x56, 0xed, 0xb7, 0x9e, 0x82, 0x1c, 0x39, 0x35, 0x8f, 0x5c, 0xeb, 0xb7, 0xf0, 0x9e, 0x92, 0x1d, 0xae, 0x97, 0x40, 0x3e,
+          0x52, 0xb1, 0xe2, 0x6c, 0x9f, 0xf7, 0x7f, 0x16, 0x93, 0x26, 0x6e, 0x49, 0xf7, 0x10, 0x92, 0x70, 0x2e, 0x30, 0x0f, 0x02, 0x81, 0x33, 0x26, 0x2b,
+          0x68, 0xaa, 0xfd, 0x9f, 0x96, 0xa5, 0x67, 0x57, 0x28, 0xeb, 0xb9, 0xd9, 0xe6, 0xd6, 0xf2, 0x8f, 0xff, 0xc9, 0x98, 0xf7, 0x19, 0xef, 0x9d, 0x5c,
+          0x3b, 0x38, 0x16, 0x59, 0x11, 0x7d, 0x48, 0xad, 0xfc, 0x9f, 0xe7, 0xc8, 0x32, 0x96, 0xd3, 0xf1, 0xe4, 0xe2, 0xbc, 0x07, 0x24, 0xd7, 0x8f, 0x9c,
+          0x15, 0xd8, 0xcc, 0xcc, 0xdb, 0x5e, 0xdc, 0xb3, 0x19, 0x1c, 0xce, 0xc8, 0xaa, 0xe7, 0x49, 0x4d, 0x51, 0x5a, 0xfa, 0x36, 0xa1, 0x1e, 0xd7, 0xcf,
+          0x84, 0xe7, 0xa1, 0xf6, 0x8f, 0x9f, 0x9f, 0xbf, 0x61, 0x10, 0x23, 0x64, 0xab, 0x12, 0xd3, 0xa7, 0x12, 0xbe, 0x08, 0xb0, 0x62, 0x66, 0x22, 0x36,
+          0xaf, 0x9b, 0x89, 0x62, 0xd7, 0xeb, 0xa2, 0x5e, 0x4e, 0xfa, 0x3e, 0x07, 0x54, 0x26, 0xbf, 0x24, 0x15, 0x24, 0x0d, 0x9f, 0xf5, 0x44, 0x76, 0x4a,
+          0x55, 0x12, 0xa7, 0x9c, 0xc6, 0x19, 0x4e, 0x68, 0x56, 0x56, 0x00, 0xd7, 0x78, 0x73, 0x7c, 0xda, 0xe2, 0xf1, 0xb8, 0xa9, 0x60, 0xce, 0x7a, 0xc9,
+          0x7a, 0x97, 0x61, 0xad, 0xfc, 0x4d, 0x0c, 0x4b, 0x75, 0xb0, 0xa0, 0x82, 0xfe, 0x41, 0x3e, 0x59, 0xd6, 0xd3, 0x8d, 0xaf, 0x29, 0x56, 0x90, 0xce,
+          0x29, 0x49, 0x34, 0x51, 0x50, 0xf2, 0xd5, 0x25, 0xfe, 0x56, 0x82, 0x0a, 0xb7, 0x64, 0x53, 0x99, 0x4d, 0xd3, 0xc7, 0xf6, 0xeb, 0xf9, 0xe6, 0x7d,
+          0x30, 0xb0, 0x6f, 0x9f, 0x99, 0x2d, 0xff, 0xc6, 0x06, 0x85, 0x2d, 0xb1, 0xb9, 0x16, 0x81, 0xa1, 0x97, 0xde, 0x05, 0xd3, 0x3c, 0xcc, 0xca, 0x7f,
+          0xe3, 0x99, 0x9d, 0xcd, 0x17, 0xff, 0x76, 0x4a, 0x1f, 0x9f, 0x5c, 0x34, 0xe6, 0xf9, 0xf7, 0xc3, 0xff, 0x07, 0xf3, 0xb2, 0x68, 0xd7, 0x06, 0xe6,
+          0xf3, 0xc3, 0x89, 0xd4, 0x1d, 0x5d, 0xd8, 0x77, 0x5b, 0x18, 0xfc, 0x2c, 0x2f, 0xc7, 0x6b, 0xf2, 0x84, 0xbf, 0xf1, 0x98, 0x44, 0xc4, 0x11, 0x49,
+          0x8d, 0x5a, 0x0b, 0x78, 0x65, 0x13, 0xfb, 0x81, 0xee, 0x6d, 0x83, 0x37, 0xa3, 0x6f, 0x41, 0xc4, 0x18, 0x3b, 0xe3, 0x1b, 0xd9, 0xf4, 0xcf, 0xde,
+          0x5b, 0x48, 0xeb, 0xa4, 0x29, 0x12, 0x3a, 0xf5, 0xa7, 0xb1, 0x75, 0x3d, 0x4b, 0xc3, 0xcb, 0x6e, 0x2d, 0xf2, 0x80, 0xba, 0x6e, 0xd7, 0x14, 0x34,
+          0x2b, 0xc4, 0x47, 0x3c, 0x62, 0x81, 0x99, 0x56, 0x56, 0xdb, 0xeb, 0x44, 0x37, 0x11, 0xe7, 0x9a, 0xb0, 0x67, 0x49, 0xb9, 0xc4, 0x4e, 0x26, 0x54,
+          0xfa, 0xbd, 0x4b, 0x5b, 0x0d, 0x54, 0xf3, 0xfd, 0xe4, 0xa7, 0x1f, 0x4b, 0xec, 0xdd, 0xf6, 0x6c, 0x49, 0x2d, 0x5a, 0x7f, 0xd4, 0x0d, 0xd5, 0x02,
+          0x3d, 0x59, 0xed, 0x4f, 0xdb, 0x52, 0x8c, 0x79, 0x1c, 0xc7, 0x3f, 0x05, 0x32, 0xbe, 0xb7, 0x35, 0x62, 0xf6, 0xbd, 0x85, 0xa4, 0xdc, 0x68, 0xf4,
+          0x84, 0x43, 0x55, 0x84, 0x32, 0xaa, 0x6b, 0xc9, 0xda, 0x79, 0xd9, 0x2d, 0xe1, 0x7a, 0x9c, 0x34, 0xe7, 0xe5, 0x03, 0x9b, 0x4e, 0xf5, 0x41, 0x25,
+          0xa2, 0x42, 0x40, 0x62, 0x54, 0x55, 0x3e, 0xeb, 0x82, 0xe2, 0x13, 0xbe, 0xc2, 0x28, 0x24, 0x84, 0xdd, 0x04, 0xb3, 0xd9, 0x0f, 0x01, 0xff, 0x7d,
+          0x2f, 0x37, 0xa2, 0x03, 0x57, 0xee, 0xfe, 0xe0, 0xcd, 0x3a, 0x33, 0xe5, 0x6d, 0xd0, 0xaf, 0x9e, 0xad, 0xfc, 0x9f, 0x05, 0xca, 0x0f, 0x9c, 0x56,
+          0xb6, 0xb0, 0xb6, 0xba, 0x0a, 0xe8, 0x56, 0x36, 0x85, 0x94, 0xba, 0xa9, 0x2f, 0x45, 0x98, 0x12, 0x72, 0x19, 0xba, 0x6d, 0x29, 0x53, 0xa4, 0xb9,
+          0xec, 0xf8, 0xca, 0x01, 0xe6, 0xe1, 0x37, 0x0b, 0xb9, 0xb7, 0x3d, 0x68, 0x3a, 0xc9, 0xee, 0xc3, 0x06, 0x48, 0x36, 0x40, 0x50, 0x32, 0xa3, 0xad,
+          0xdb, 0xc5, 0xc3, 0xac, 0x09, 0xb2, 0x85, 0x16, 0xc4, 0x42, 0x20, 0xe3, 0xb7, 0x40, 0xef, 0x5c, 0x6c, 0x33, 0x14, 0x4a, 0x77, 0x46, 0x07, 0x7a,
+          0xab, 0x3f, 0x3c, 0x09, 0x25, 0x8a, 0x14, 0x63, 0xe3, 0xe4, 0xb1, 0x07, 0x79, 0x56, 0x4c, 0xdc, 0xed, 0x03, 0x76, 0x6d, 0x56, 0xfd, 0x12, 0xc0,
+          0x44, 0x6c, 0x8d, 0x52, 0xdf, 0xd1, 0xbc, 0xeb, 0xb5, 0xa8, 0x9e, 0xb7, 0xa6, 0xde, 0x88, 0xdd, 0x86, 0xd5, 0x60, 0x61, 0xd4, 0xe2, 0x30, 0x93,
+          0x8d, 0x7a, 0xe1, 0x3a, 0xbc, 0x32, 0x71, 0x15, 0xbd, 0x76, 0x3a, 0x63, 0xfe, 0xe4, 0x99, 0x85, 0x0e, 0x8f, 0x2f, 0x7f, 0xc2, 0xb8, 0x38, 0xdc,
+          0x9f, 0x55, 0xcd, 0x5a, 0x0b, 0x1a, 0xdc, 0x88, 0xa4, 0x24, 0xf2, 0x88, 0x0a, 0x85, 0xed, 0x72, 0xdd, 0x0e, 0xda, 0xd7, 0xea, 0x07, 0x90, 0xec,
+          0x01, 0x86, 0x1e, 0xa3, 0x7a, 0x5d, 0x1c, 0xb7, 0xfc, 0x39, 0xab, 0xc6, 0xa4, 0x7d, 0x38, 0x71, 0xfe, 0xcd, 0x37, 0xbb, 0x2d, 0x9a, 0x76, 0x75,
+          0xc2, 0x11, 0x97, 0xa2, 0xfa, 0x0d};
     };
+
+    static constexpr std::array<std::string_view, 6> files{"jasmine/4.6.0/jasmine_favicon.png", "jasmine/4.6.0/jasmine.css",
+                                                           "jasmine/4.6.0/jasmine.js",          "jasmine/4.6.0/jasmine-html.js",
+                                                           "jasmine/4.6.0/boot0.js",            "jasmine/4.6.0/boot1.js"};
+    static constexpr std::array<StaticHeaders, 6> headers{StaticHeaders::of<JasmineFavicon>(files[0]), StaticHeaders::of<JasmineCss>(files[1]),
+                                                          StaticHeaders::of<JasmineJs>(files[2]), StaticHeaders::of<JasmineHtml>(files[3]),
+                                                          StaticHeaders::of<Boot0>(files[4]), StaticHeaders::of<Boot1>(files[5])};
+
+    static File fileAt(size_t index) {
+        switch (index) {
+        case 0: return File{JasmineFavicon{}, headersAt(0)};
+        case 1: return File{JasmineCss{}, headersAt(1)};
+        case 2: return File{JasmineJs{}, headersAt(2)};
+        case 3: return File{JasmineHtml{}, headersAt(3)};
+        case 4: return File{Boot0{}, headersAt(4)};
+        default: return File{Boot1{}, headersAt(5)};
+        }
+    }
+
+    static constexpr std::string_view headersAt(size_t index) { return headers[index].view(); }
+
+    static std::optional<File> open(std::filesystem::path file) {
+        auto found = std::ranges::find(files, file.relative_path().generic_string());
+        if (found == files.end()) return {};
+        return fileAt(static_cast<size_t>(found - files.begin()));
+    }
 };
 
 } // namespace webfront::fs
@@ -4,22 +4,193 @@
 #pragma once
 
 #include "FileSystem.hpp"
+#include <chrono>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#if defined(__linux__)
+#include <array>
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace webfront::fs {
 
 namespace detail {
+
+#if defined(__linux__)
+/// @brief Reports, from its own thread, the files and directories created, modified, moved or deleted under a directory tree (inotify).
+class TreeWatcher {
+public:
+    using Callback = std::function<void(const std::filesystem::path&)>;
+
+    TreeWatcher(std::filesystem::path root, Callback onChange)
+        : rootPath(std::move(root)), callback(std::move(onChange)), inotifyFd(inotify_init1(IN_CLOEXEC | IN_NONBLOCK)), wakeFd(eventfd(0, EFD_CLOEXEC)) {
+        if (inotifyFd < 0 || wakeFd < 0) return;
+        addTree({});
+        thread = std::jthread([this] { run(); });
+    }
+    ~TreeWatcher() {
+        if (thread.joinable()) {
+            uint64_t wake = 1;
+            [[maybe_unused]] auto written = ::write(wakeFd, &wake, sizeof(wake));
+            thread.join();
+        }
+        if (inotifyFd >= 0) ::close(inotifyFd);
+        if (wakeFd >= 0) ::close(wakeFd);
+    }
+    TreeWatcher(const TreeWatcher&) = delete;
+    TreeWatcher(TreeWatcher&&) = delete;
+    TreeWatcher& operator=(const TreeWatcher&) = delete;
+    TreeWatcher& operator=(TreeWatcher&&) = delete;
+
+    [[nodiscard]] bool isWatching() const { return thread.joinable(); }
+
+private:
+    static constexpr uint32_t eventsMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB;
+    std::filesystem::path rootPath;
+    Callback callback;
+    int inotifyFd, wakeFd;
+    std::map<int, std::filesystem::path> directories; // Watch descriptor -> directory relative to rootPath
+    std::jthread thread;
+
+    void addTree(const std::filesystem::path& directory) {
+        addDirectory(directory);
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(rootPath / directory, std::filesystem::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec))
+            if (it->is_directory(ec)) addDirectory(it->path().lexically_relative(rootPath));
+    }
+
+    void addDirectory(const std::filesystem::path& directory) {
+        auto wd = inotify_add_watch(inotifyFd, (rootPath / directory).c_str(), eventsMask);
+        if (wd >= 0) directories[wd] = directory == "." ? std::filesystem::path{} : directory;
+    }
+
+    void run() {
+        alignas(inotify_event) std::array<char, 4096> buffer;
+        std::array<pollfd, 2> fds{{{inotifyFd, POLLIN, 0}, {wakeFd, POLLIN, 0}}};
+        for (;;) {
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+            if (fds[1].revents != 0) return;
+
+            ssize_t length;
+            while ((length = ::read(inotifyFd, buffer.data(), buffer.size())) > 0) {
+                for (ssize_t offset = 0; offset < length;) {
+                    auto event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                    handle(*event);
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                }
+            }
+        }
+    }
+
+    void handle(const inotify_event& event) {
+        if (event.mask & IN_Q_OVERFLOW) return callback({}); // Events were lost : anything may have changed
+        auto directory = directories.find(event.wd);
+        if (directory == directories.end()) return;
+        if (event.mask & IN_IGNORED) {
+            directories.erase(directory);
+            return;
+        }
+
+        auto path = event.len > 0 ? directory->second / event.name : directory->second;
+        if ((event.mask & IN_ISDIR) && (event.mask & (IN_CREATE | IN_MOVED_TO))) addTree(path);
+        callback(path);
+    }
+};
+#endif
+
 /// @brief Low-level implementation of a native file system.
 class NativeRawFS {
 public:
     std::optional<File> open(std::filesystem::path path) {
         std::ifstream file;
         file.open(rootPath / path, std::ios::binary);
-        if (file.is_open()) return File{std::move(file)};
+        if (!file.is_open()) return {};
+        std::error_code ec;
+        auto size = std::filesystem::file_size(rootPath / path, ec);
+        if (ec) return File{std::move(file)};
+        File opened{std::move(file), static_cast<size_t>(size)};
+        auto modificationTime = std::filesystem::last_write_time(rootPath / path, ec);
+        if (!ec) opened.setModified(std::filesystem::file_time_type::clock::to_sys(modificationTime));
+        return opened;
+    }
+
+    /// Opens the precompressed sibling of path ("app.js.br", "app.js.gz") whose coding comes first in encodings, path itself when
+    /// identity comes first or no sibling exists. A sibling older than path is stale and ignored.
+    std::optional<File> open(const std::filesystem::path& path, std::span<const std::string_view> encodings) {
+        return negotiate(path, encodings, [this](const std::filesystem::path& variant) { return NativeRawFS::open(variant); });
+    }
+
+    /// @return the file name extension of the precompressed siblings of the coding, empty if it has none
+    static constexpr std::string_view siblingExtension(std::string_view coding) {
+        if (coding == "br") return ".br";
+        if (coding == "gzip") return ".gz";
         return {};
     }
+
+    /// Reports the changes of the files under the document root (inotify on Linux).
+    /// @return false if the platform does not notify file changes
+    bool watch(std::function<void(const std::filesystem::path&)> onChange) {
+#if defined(__linux__)
+        watcher = std::make_unique<TreeWatcher>(rootPath, std::move(onChange));
+        return watcher->isWatching();
+#else
+        return false;
+#endif
+    }
+
 protected:
     std::filesystem::path rootPath;
+
+    template<typename Opener>
+    std::optional<File> negotiate(const std::filesystem::path& path, std::span<const std::string_view> encodings, Opener openVariant) {
+        std::optional<std::filesystem::file_time_type> modified; // Of path, read once a sibling is found
+        for (auto encoding : encodings) {
+            if (encoding.empty()) break;
+            auto extension = siblingExtension(encoding);
+            if (extension.empty()) continue;
+            auto sibling = path;
+            sibling += extension;
+            std::error_code ec;
+            auto siblingModified = std::filesystem::last_write_time(rootPath / sibling, ec);
+            if (ec) continue;
+            if (!modified) modified = std::filesystem::last_write_time(rootPath / path, ec);
+            if (ec) modified = std::filesystem::file_time_type::min();
+            if (siblingModified < *modified) continue;
+            if (auto file = openVariant(sibling)) {
+                file->setEncoding(encoding);
+                return file;
+            }
+        }
+        return openVariant(path);
+    }
+
+private:
+#if defined(__linux__)
+    std::unique_ptr<TreeWatcher> watcher;
+#endif
 };
 } // namespace detail
 
@@ -31,4 +202,107 @@ class NativeDebugFS : public detail::NativeRawFS {
     }
 };
 
-} // namespace webfront::fs
\ No newline at end of file
+/// @brief Native file system serving its files without copying them through the server : a file up to mappedSizeLimit is mapped
+/// read-only once and its mapping is shared by the requests until the file changes, a larger one is sent by the kernel straight from
+/// the page cache (sendfile). Files should be replaced (renamed over) rather than truncated while being served.
+/// Falls back to NativeDebugFS streams on the platforms without mmap and sendfile.
+class NativeMappedFS : public detail::NativeRawFS {
+public:
+    static constexpr size_t defaultMappedSizeLimit = 256 * 1024;
+
+    explicit NativeMappedFS(std::filesystem::path docRoot, size_t mappedSizeLimit = defaultMappedSizeLimit) : mappedLimit(mappedSizeLimit) {
+        rootPath = docRoot;
+    }
+
+#if defined(__linux__)
+    std::optional<File> open(std::filesystem::path path) {
+        auto fullPath = (rootPath / path).string();
+        struct stat status;
+        if (::stat(fullPath.c_str(), &status) != 0 || !S_ISREG(status.st_mode)) return {};
+        auto size = static_cast<size_t>(status.st_size);
+        if (size > mappedLimit) return openDescriptor(fullPath);
+
+        Stamp stamp{status.st_ino, size, status.st_mtim.tv_sec, status.st_mtim.tv_nsec};
+        {
+            std::shared_lock lock(mutex);
+            if (auto mapped = mappings.find(fullPath); mapped != mappings.end() && mapped->second->stamp == stamp)
+                return modified(File{mapped->second->bytes(), mapped->second}, status);
+        }
+        auto mapping = map(fullPath, stamp);
+        if (!mapping) return {};
+        std::scoped_lock lock(mutex);
+        if (mappings.size() >= mappingsCapacity) mappings.clear();
+        mappings.insert_or_assign(std::move(fullPath), mapping);
+        return modified(File{mapping->bytes(), std::move(mapping)}, status);
+    }
+
+    std::optional<File> open(const std::filesystem::path& path, std::span<const std::string_view> encodings) {
+        return negotiate(path, encodings, [this](const std::filesystem::path& variant) { return open(variant); });
+    }
+
+private:
+    static constexpr size_t mappingsCapacity = 1024; // Unmaps everything above : the address space used stays bounded
+
+    /// Identity of a file's content : a file changed in place or replaced is mapped again
+    struct Stamp {
+        ino_t inode;
+        size_t size;
+        time_t seconds;
+        long nanoseconds;
+        bool operator==(const Stamp&) const = default;
+    };
+
+    struct Mapping {
+        Stamp stamp;
+        void* address;
+        Mapping(Stamp fileStamp, void* mappedAddress) : stamp(fileStamp), address(mappedAddress) {}
+        ~Mapping() {
+            if (address != nullptr) ::munmap(address, stamp.size);
+        }
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+        [[nodiscard]] std::span<const std::byte> bytes() const { return {static_cast<const std::byte*>(address), address ? stamp.size : 0}; }
+    };
+
+    size_t mappedLimit;
+    std::shared_mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const Mapping>> mappings;
+
+    static std::shared_ptr<const Mapping> map(const std::string& fullPath, Stamp stamp) {
+        if (stamp.size == 0) return std::make_shared<const Mapping>(stamp, nullptr);
+        auto fd = ::open(fullPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return {};
+        auto address = ::mmap(nullptr, stamp.size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping keeps the file open
+        if (address == MAP_FAILED) return {};
+        return std::make_shared<const Mapping>(stamp, address);
+    }
+
+    static std::optional<File> openDescriptor(const std::string& fullPath) {
+        auto fd = ::open(fullPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return {};
+        struct stat status;
+        if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+            ::close(fd);
+            return {};
+        }
+        return modified(File{std::shared_ptr<const FileDescriptor>(new FileDescriptor{fd, static_cast<size_t>(status.st_size)},
+                                                                    [](const FileDescriptor* descriptor) {
+                                                                        ::close(descriptor->handle);
+                                                                        delete descriptor;
+                                                                    })},
+                        status);
+    }
+
+    static File modified(File file, const struct stat& status) {
+        using namespace std::chrono;
+        file.setModified(system_clock::time_point{duration_cast<system_clock::duration>(seconds{status.st_mtim.tv_sec} + nanoseconds{status.st_mtim.tv_nsec})});
+        return file;
+    }
+#else
+private:
+    [[maybe_unused]] size_t mappedLimit;
+#endif
+};
+
+} // namespace webfront::fs
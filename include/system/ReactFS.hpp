@@ -16,1050 +16,1746 @@ class ReactFS {
     ReactFS& operator=(const ReactFS&) = default;
     ReactFS& operator=(ReactFS&&) = default;
 
-    static std::optional<File> open(std::filesystem::path file) {
-        auto filename = file.relative_path().string();
-        if (filename == "react@18/umd/react.production.min.js") return File(React{});
-        if (filename == "react-dom@18/umd/react-dom.production.min.js") return File{ReactDom{}};
-        return {};
-    }
-
     struct React {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{3761};
-        static constexpr std::array<uint64_t, 471> data{
-          0xe1804f01e01c705b, 0xe64b682ba87ff434, 0x17bfa0f1e72784ce, 0x8d9064d66a5ba902, 0xed60f1fbf6244968,
-          0x1a1d52bacbd6eaef, 0xe7a5a9a96cf7d222, 0xf8ec4c2f735c3715, 0x213ace2156d03936, 0xe0d7727df75c4e3f,
-          0xac66958cacf3456d, 0xea7503210b644c52, 0x63a95a56f53b083b, 0xe01cd18b1ab3766b, 0x97fc343851ce3a7f,
-          0x0afcbfa566e04a76, 0x1a2b1d868540f9c9, 0x8f5f18b3fefc99ff, 0x343bd2fa56adac4b, 0x95dc754ea953acf7,
-          0x56a7036ba529b531, 0x251d5e4529302834, 0x8437762814c696dc, 0x6d58168cefeb9731, 0xade9f5c6ae860001,
-          0x4286a2f5ff257dfc, 0xdbe946b726c0f42e, 0xbb8bc55ce9afc462, 0x9c62e3915c1a5eb5, 0xe0d1c702d4c46ac1,
-          0xcde894f84a1d0765, 0x6588f2081c83bce8, 0x83b4d2e99e7c7d17, 0x195e2240c3cfb430, 0xc85b780f721dad46,
-          0x121f4506551e1271, 0xaeef1c5c123f80f7, 0x9f18defb69b1f853, 0x165ec29c218822dc, 0x5452aaabe435784a,
-          0x6bd5148233082472, 0x27fb09d02eb240aa, 0xe3c1b04b8e2f7b31, 0xfe95d9d50e3c89c0, 0xd7551734037f64f1,
-          0x7b532dfa340bcec5, 0x3228f512b1c5ba1f, 0xa3142f0d2ae1e7cd, 0x0208e5064df89428, 0x85f7262bfa570568,
-          0x0e00f8870c74abb5, 0x6db7cfef8d6d626d, 0x6d7aefbc5d545e5d, 0x988b33276ba876c6, 0x10b4917bd301120d,
-          0x02c7019eb35e0bca, 0x0c5e4bcb4297faa0, 0x8fd3f37758116778, 0x31efcd1dbe0f3d44, 0x16e6fc5f8eb0fb8f,
-          0x0fe5c435f917466a, 0xd54b62f131dffd59, 0x30047c7e4f08e393, 0x8758c540f2e8492f, 0x8ae2d9d01adcb524,
-          0xd2d2fb7dffedb384, 0x8abe4f2011accfd8, 0xc76f1223b4ee8d1c, 0x3bd7a7dfb3b37507, 0x5fc741b778210490,
-          0xbfd6821a2e974cc2, 0xfe30692fcb6f5101, 0x656ebc4d31453081, 0xc55b1a103847c9ea, 0xfce5fd1701e425e9,
-          0x97507c8a70dcfc05, 0xf6998f3e0dff82f0, 0x16764c37c0a46d66, 0x0a90ce584d870941, 0x4bdb144000ef864c,
-          0x88bca403af3eedf0, 0x76a5d23479ceb79f, 0x63d0f75f660efa98, 0x1dcb739d353b9d41, 0x878f632e166b0b2d,
-          0xac3cbd26049c32ff, 0xc910cf9144d170e4, 0x0a1546445146be12, 0xb56de7be7b127871, 0x34f936265d1b7c45,
-          0x1a11ff8744a97922, 0x535dac515725d542, 0x040b9101102edd46, 0xb076f4a14f2ab20c, 0x7fc6a3faf33298b4,
-          0x624ac8ac2e355cb4, 0x18853a25c1f0c9c4, 0x6b12f56f30ab0c42, 0x459f5d643ab327c9, 0xe616417af3121a46,
-          0xea6c048c1bea9cce, 0xe9422986f402353a, 0x551fcece669561db, 0x0c84fdb2539a92f3, 0xe441aaa48262e703,
-          0x7c0ac453250ec24f, 0xcd73b033ba838561, 0xfda0320b796e0b33, 0x0aad04382e354752, 0xea39b8b4fa5b74ac,
-          0xed4f7602b5743810, 0x24942815ab8a43d4, 0x3909472973241b34, 0x3230128a287771d2, 0x94564cd7d226b1a2,
-          0x070a2305d6691334, 0xb55e55a882dbc340, 0x645c29dd3a01ddb2, 0x1baa2ced99046959, 0x16279ae675d2afd7,
-          0xa0d5b0926a2ac5d3, 0x5c7996f81f8b2c10, 0xe594bc0e67e77492, 0x8c993bc131291665, 0x90f32e80bc201f6a,
-          0xa3b0606bd39b8614, 0x6160a1850bc32a9e, 0x14d30930078d4bb2, 0x099ccb034b8d96b5, 0x84567dca58ea057c,
-          0x1b550bb24c0e2021, 0xca5e0a2c9c869430, 0xc3e31fe99bac101f, 0x744840af1f9722a4, 0xcb5d46afe8b7602c,
-          0x7efaeabb4baac12d, 0x804e68a012d2101f, 0x0e83dd6e03050186, 0x9964fc8fc2c34b78, 0x45a50ea8475d08c3,
-          0xcbe758da54d5891a, 0x021db55dab084ac6, 0xb39a009c7b95a6a0, 0x9552596d1513ec63, 0xecf6373d818d6c87,
-          0x52994d6427cb01c8, 0x1b25ecb6257ef0ac, 0x81901f63ae71ce6f, 0xe9bd39f5db6594c6, 0x7af2e985b4249bb1,
-          0xe4aa7986574525f4, 0x4a4350a708db0833, 0xb8d2b7dc107e4d9f, 0xcbb9231572c60633, 0x51687c9e21516486,
-          0x4e820b45e853f811, 0xf934a969d0d1b548, 0x72e0fc228406615a, 0xd8988006784a6bb8, 0x9c4b9249825998ef,
-          0x82b604283a3a65ea, 0x9f46028d6af2ac88, 0x904635a336a6d04e, 0x7b0483b97d1cfc95, 0x6a0a6f5d3187b47c,
-          0x9e9f420b8d2f4c7e, 0x43dd662c2170665d, 0x88d0337d4d236e0e, 0xcc2818477f18ef15, 0x2e520b63975935f9,
-          0x12a3c91fbeb053ae, 0x06ac29fa61014340, 0xc97cacf74e73500a, 0xa591674284851599, 0xdc603622098d6e8d,
-          0xbc749e36c98bcfe7, 0x559c1a1138a572b0, 0x5438ea2ec8ca2522, 0x55289b6dafdc1768, 0x7ae3454ffa7da060,
-          0x40065448159ebdd4, 0x9065c1f35361dec5, 0x1c97d030003efb9b, 0x8d84a235e83d7f6c, 0xbb0c530c8a30dba4,
-          0x22d11f5d2f1a627b, 0xfe395c8b19b95c6b, 0x12e54ae7f4b9a0d1, 0x69522f06303df239, 0x2a9278918ee4e643,
-          0xb81d83ccf8745c36, 0xa014b6561596c729, 0x19392dbfd997d2c6, 0x0880b3e92cfa2464, 0x5299a8f58a92be90,
-          0x8b3e199208948fd2, 0x25e4da9ce2667de0, 0x5269824bb8c2362e, 0x6461e6a4afe082d2, 0x78ae6f2352574494,
-          0xe3cfb5c5a421ce5f, 0x87316c801beaa752, 0x76a59730ab93be8c, 0x6e7fc379db806759, 0x258322f3aa8f8314,
-          0xaabcfecabf119ac6, 0x4eba37366458c7a2, 0xa88a94903567c734, 0x1511005144c92758, 0x1caa10dbfa85a5ed,
-          0xedb562d4ffe6aa22, 0x18d22432134152d7, 0xa70d3d57a26853eb, 0xed4c4126b1ef64b3, 0x30abb196f86185a8,
-          0xf3c5a5117ea19b77, 0x99ae31825115d37a, 0x5c2986ee5f0e95da, 0xd2f362ee0269c513, 0x5903a3b8ca24b2fe,
-          0xab574b676553579a, 0x5ceebb0c3c7f4f6c, 0xd96f1ad8af111f3a, 0x880c61d475197f64, 0x436fd6989b880968,
-          0x2e2ddb2c94e7fadf, 0x8d0865ab84b9801f, 0x9ae827817a064103, 0x496ecf3aa0711872, 0x967588cabacc4d2e,
-          0xb99575c4cd1979df, 0x5f4bb29c1efc9a96, 0x6327f75cadcc79d6, 0x29b7b0ace6be8fcb, 0xb2ce68ef73b24e66,
-          0xd6f96aec9f553eeb, 0xe2f1e0ffbfc5db27, 0xa1909fa27b09e5dd, 0x10e663b8b31fe8a5, 0x46b39bfed8366138,
-          0xc033013391c26302, 0xe4a3bfbfcae5624a, 0x325ededda5bbffd8, 0x6fc95ba42571b401, 0xafa03b094b33cdfb,
-          0xa228957712196d5f, 0x6785290ce3c81414, 0x075ca68bc4a49ba6, 0xbe88941f2e317229, 0x51a01f806f5d27ec,
-          0x9ca30dad98499c06, 0x1946c798ec8a7222, 0x3ee6a543620f8106, 0x24ba91c40471b998, 0x9668bd013a521a27,
-          0x28902566cb70440a, 0xdb859abef5ef40e0, 0xc0f78c87b844c518, 0xe1f4484710e288ec, 0xa387323ac6ace5ca,
-          0xdb4ce30d2306cee3, 0x1396775ba95a4a97, 0x98beb2052257c8fe, 0xae112a0ae1b11942, 0x36e95882f68f86a5,
-          0x1e91a5d6ebc33499, 0xe0cf834e5ef78f57, 0x66d503a6f68f525b, 0xbe3f0da2c184059e, 0xa94309264f9c1f37,
-          0x75eb6ee9d650a396, 0xb98196e3cab14b9a, 0xdeb096f9c6d61d9b, 0x141af1e170c3e1b6, 0x216b5bd67fcb60d9,
-          0xb6f78e36ad02c458, 0x135cbcadf737ec60, 0xbab22ff9cbc11f87, 0x5b56393a82b96688, 0xf17d7af18eff2d99,
-          0xd107838965577d46, 0x34de843256fc0fb2, 0x1914d28b0e732846, 0x469bfb8e648f2ce8, 0x78f3429e889ad686,
-          0x359a5f8c47ee792f, 0xd3d904a41597771b, 0xbdae9fb9bd0c312c, 0x209c932527301ae5, 0xe43e5dfd3d8a3319,
-          0xe71a282d6d384b12, 0x8fdc949ed6e7abbd, 0xaae243a458771660, 0xf3c84f64a215d21e, 0x8411806e7d36d5fd,
-          0xc8f8637cbcdeb024, 0x5c99893da111f9c8, 0x414a6644c30d8656, 0xed2439f78c70b74c, 0x13c38807d896b064,
-          0xb7b7adbebb3ce4df, 0x7b6957ed9fb06f95, 0x9b1279b86d8f428c, 0x631a818c988f37fd, 0x6fb8a1946146aa59,
-          0x0936dfd6d6f4ce3d, 0xf615e7b9e042756a, 0x2434e7cb0d68dc61, 0x43970f69d3eebee7, 0xba93739b729e57d4,
-          0xd678afdd1e415e13, 0xc5a6eb09ce016063, 0x6ae6108ba6b3c96b, 0x4603779e405f534d, 0x24b813eb07da8c76,
-          0x74543d2dca6835fd, 0xc36ceb6d5a6ce9fe, 0x84d18bdbbae673d5, 0xf850cd3fe75be5f6, 0xa50770a5f580a1a6,
-          0xc9dd2d2fd435a101, 0xc5e2fd4b5e3cda24, 0x81c1464f073d2fc6, 0x63559ed064fc1792, 0xfc025a24843f4e6c,
-          0xe96e155a50cd66cd, 0xc8c1bb03b67f0e70, 0x05161faf5c975896, 0x4513fc7627cad5a5, 0x6236609629a446c5,
-          0xa0f235cd1bcff757, 0xb41aeb303bd5fe3b, 0x493aecf3be8cc734, 0x2f4eb5de2eaf0b71, 0x7eb756bbceb68a53,
-          0x59a0ba5c79cba688, 0x38d7e7890a4ac4a0, 0x0af036cc545222d6, 0x5410ff2a7f4dadf0, 0x1757015ae30b9867,
-          0x312060d9a447df5e, 0x0b07d0d692159eef, 0x9d17129ac7d7f3c1, 0x019111a674babf32, 0x7e6f767e01a88e01,
-          0x4c497114a8712beb, 0x5dcf6f8300c54c0f, 0xc86f1395fb19ab5a, 0xd147a63390333db0, 0x23ac4359885c1db6,
-          0xeaa74fd5496726a3, 0x6785e0e88be33e24, 0xba897ff27eda3f4a, 0xb66604dcd30a4357, 0x8c2cf0e8e185e798,
-          0x46ef3060ed74d603, 0x7f8ab997f58b254f, 0x6c2c07415118c0c3, 0xf5c554d33c09826e, 0x68266890dea8a365,
-          0xe224f3e0e72fa659, 0x44b792c5ef4d3aad, 0x8a7a54ffcac8de96, 0x80e25eac11d729f7, 0xc5daf3bef41477f2,
-          0x693de8176943b395, 0xf9f455040070d0d9, 0xff75b7bcb3f9d2ce, 0xb77e1a5c5aa4a2fa, 0xc87f32af736fc1ed,
-          0xfcc833e510ba7514, 0x07978e2ae741306e, 0xb7d4d173de227bf2, 0xdbf6f8ca88c022ab, 0x1373842a5b3c9942,
-          0xe2dfa0a7b96af344, 0x495489149964fb34, 0x68749299cde01c02, 0xdf9cae07360263d8, 0x922fdffc00cb0fb8,
-          0xb72c5a11eb4029e7, 0x320ea9afabc94f8c, 0x005fab8b05e21b1b, 0x48fed66dd60a8424, 0x25203f650abb5a7c,
-          0x43066e7cdf420f7a, 0x194d2d6f5d88d491, 0x71f203600495a60c, 0xfdc9b5e750668fe5, 0x4efe0f2450cc6f60,
-          0xd1d1cb7cebb49d9c, 0xceeb5d7fdf6ea7df, 0xf2fbd3afdd52a2e5, 0x7c63c0ad266a3cb2, 0x90eef3df6ae6d6d7,
-          0xb9ac14a7e91d2717, 0xe638d0cac4c5f5c8, 0xead5cfbd31f13338, 0x60928a0e1c009c03, 0xb832e709913a3629,
-          0xda618776ca1bea25, 0xf927db48da69d726, 0x2ff765d5c9576978, 0xa32f1fbcd0298f61, 0xc8753a198d473a43,
-          0x034a749996b57eb4, 0x387bd16be45aca4c, 0x77d2ba810d9ff622, 0x6cdade679a250ae7, 0x89d105f746a81f4b,
-          0xf21234255da97579, 0x5f60e132d9b385e0, 0xeaee5a18436cbee8, 0x4f148b2dc5533e5a, 0x912e32cceb0cc3ad,
-          0x3ca70bdea55c34ce, 0x64df557e5ccd86ef, 0x816b547abc9810ef, 0x4f4c495e46eca610, 0x9f07e7c9e184eb62,
-          0xb1db4f5c9518f908, 0x4558311e117ea94e, 0xe960783e1b57e781, 0x15a6b8aa5b4546a3, 0xa7468e23c714478c,
-          0xd1908b398e9a2067, 0xd48482c7b97c8f7a, 0x6384b9a9470d8a25, 0x671d3044c28480bb, 0x119e77b8709ba66b,
-          0xd1dc210037b399ef, 0x63b016407b6af2ba, 0x296646a5f26eec26, 0x917cef8459d4ce8e, 0xc75bac75e6febde5,
-          0xc585da29b4c95f53, 0xb87d7a8c419d9b9e, 0xecf7e361e63b1da9, 0x7be58482a70a937f, 0xd83ead35a0b7c627,
-          0x7c28ea9195c2867a, 0x8a7478c096236646, 0x4beaa5ec63c8d626, 0x0cc641bddf047bac, 0xa226bf2bdb2383b3,
-          0xf7add0e6b57549d9, 0x9a6ab2367b21876c, 0x0934110577f2bb9b, 0x36d56ec1a00c7006, 0x8528dc8dc8fd85b0,
-          0x55c0171bf88c3505, 0x5bec047371734d95, 0xdf43456186d022c2, 0x5df50d9b3d04cedd, 0x413225f6cbb08e17,
-          0x840a2040ef73eebc, 0x1592707f86b6decb, 0x81c31910e109ed3d, 0xb31ad00c9f115728, 0xa3a8709782c363d3,
-          0x8238bed471231a02, 0x05821a41bfdf0bb7, 0x2e0be70943f0167a, 0xd8198a3b706c2b7c, 0xab65dafd85902ca0,
-          0x4aa6eeefac18598d, 0x0dea365caaddf796, 0xf43bf9841b990e8d, 0x758b56e61d4c8f6e, 0xd825610071db2ea4,
-          0x0000000000000000};
+        static constexpr std::string_view etag{"\"e3df98448c0a167f\""};
+        static constexpr std::array<uint8_t, 3761> data{
+          0xe1, 0x80, 0x4f, 0x01, 0xe0, 0x1c, 0x70, 0x5b, 0xe6, 0x4b, 0x68, 0x2b, 0xa8, 0x7f, 0xf4, 0x34, 0x17, 0xbf, 0xa0, 0xf1, 0xe7, 0x27, 0x84, 0xce,
+          0x8d, 0x90, 0x64, 0xd6, 0x6a, 0x5b, 0xa9, 0x02, 0xed, 0x60, 0xf1, 0xfb, 0xf6, 0x24, 0x49, 0x68, 0x1a, 0x1d, 0x52, 0xba, 0xcb, 0xd6, 0xea, 0xef,
+          0xe7, 0xa5, 0xa9, 0xa9, 0x6c, 0xf7, 0xd2, 0x22, 0xf8, 0xec, 0x4c, 0x2f, 0x73, 0x5c, 0x37, 0x15, 0x21, 0x3a, 0xce, 0x21, 0x56, 0xd0, 0x39, 0x36,
+          0xe0, 0xd7, 0x72, 0x7d, 0xf7, 0x5c, 0x4e, 0x3f, 0xac, 0x66, 0x95, 0x8c, 0xac, 0xf3, 0x45, 0x6d, 0xea, 0x75, 0x03, 0x21, 0x0b, 0x64, 0x4c, 0x52,
+          0x63, 0xa9, 0x5a, 0x56, 0xf5, 0x3b, 0x08, 0x3b, 0xe0, 0x1c, 0xd1, 0x8b, 0x1a, 0xb3, 0x76, 0x6b, 0x97, 0xfc, 0x34, 0x38, 0x51, 0xce, 0x3a, 0x7f,
+          0x0a, 0xfc, 0xbf, 0xa5, 0x66, 0xe0, 0x4a, 0x76, 0x1a, 0x2b, 0x1d, 0x86, 0x85, 0x40, 0xf9, 0xc9, 0x8f, 0x5f, 0x18, 0xb3, 0xfe, 0xfc, 0x99, 0xff,
+          0x34, 0x3b, 0xd2, 0xfa, 0x56, 0xad, 0xac, 0x4b, 0x95, 0xdc, 0x75, 0x4e, 0xa9, 0x53, 0xac, 0xf7, 0x56, 0xa7, 0x03, 0x6b, 0xa5, 0x29, 0xb5, 0x31,
+          0x25, 0x1d, 0x5e, 0x45, 0x29, 0x30, 0x28, 0x34, 0x84, 0x37, 0x76, 0x28, 0x14, 0xc6, 0x96, 0xdc, 0x6d, 0x58, 0x16, 0x8c, 0xef, 0xeb, 0x97, 0x31,
+          0xad, 0xe9, 0xf5, 0xc6, 0xae, 0x86, 0x00, 0x01, 0x42, 0x86, 0xa2, 0xf5, 0xff, 0x25, 0x7d, 0xfc, 0xdb, 0xe9, 0x46, 0xb7, 0x26, 0xc0, 0xf4, 0x2e,
+          0xbb, 0x8b, 0xc5, 0x5c, 0xe9, 0xaf, 0xc4, 0x62, 0x9c, 0x62, 0xe3, 0x91, 0x5c, 0x1a, 0x5e, 0xb5, 0xe0, 0xd1, 0xc7, 0x02, 0xd4, 0xc4, 0x6a, 0xc1,
+          0xcd, 0xe8, 0x94, 0xf8, 0x4a, 0x1d, 0x07, 0x65, 0x65, 0x88, 0xf2, 0x08, 0x1c, 0x83, 0xbc, 0xe8, 0x83, 0xb4, 0xd2, 0xe9, 0x9e, 0x7c, 0x7d, 0x17,
+          0x19, 0x5e, 0x22, 0x40, 0xc3, 0xcf, 0xb4, 0x30, 0xc8, 0x5b, 0x78, 0x0f, 0x72, 0x1d, 0xad, 0x46, 0x12, 0x1f, 0x45, 0x06, 0x55, 0x1e, 0x12, 0x71,
+          0xae, 0xef, 0x1c, 0x5c, 0x12, 0x3f, 0x80, 0xf7, 0x9f, 0x18, 0xde, 0xfb, 0x69, 0xb1, 0xf8, 0x53, 0x16, 0x5e, 0xc2, 0x9c, 0x21, 0x88, 0x22, 0xdc,
+          0x54, 0x52, 0xaa, 0xab, 0xe4, 0x35, 0x78, 0x4a, 0x6b, 0xd5, 0x14, 0x82, 0x33, 0x08, 0x24, 0x72, 0x27, 0xfb, 0x09, 0xd0, 0x2e, 0xb2, 0x40, 0xaa,
+          0xe3, 0xc1, 0xb0, 0x4b, 0x8e, 0x2f, 0x7b, 0x31, 0xfe, 0x95, 0xd9, 0xd5, 0x0e, 0x3c, 0x89, 0xc0, 0xd7, 0x55, 0x17, 0x34, 0x03, 0x7f, 0x64, 0xf1,
+          0x7b, 0x53, 0x2d, 0xfa, 0x34, 0x0b, 0xce, 0xc5, 0x32, 0x28, 0xf5, 0x12, 0xb1, 0xc5, 0xba, 0x1f, 0xa3, 0x14, 0x2f, 0x0d, 0x2a, 0xe1, 0xe7, 0xcd,
+          0x02, 0x08, 0xe5, 0x06, 0x4d, 0xf8, 0x94, 0x28, 0x85, 0xf7, 0x26, 0x2b, 0xfa, 0x57, 0x05, 0x68, 0x0e, 0x00, 0xf8, 0x87, 0x0c, 0x74, 0xab, 0xb5,
+          0x6d, 0xb7, 0xcf, 0xef, 0x8d, 0x6d, 0x62, 0x6d, 0x6d, 0x7a, 0xef, 0xbc, 0x5d, 0x54, 0x5e, 0x5d, 0x98, 0x8b, 0x33, 0x27, 0x6b, 0xa8, 0x76, 0xc6,
+          0x10, 0xb4, 0x91, 0x7b, 0xd3, 0x01, 0x12, 0x0d, 0x02, 0xc7, 0x01, 0x9e, 0xb3, 0x5e, 0x0b, 0xca, 0x0c, 0x5e, 0x4b, 0xcb, 0x42, 0x97, 0xfa, 0xa0,
+          0x8f, 0xd3, 0xf3, 0x77, 0x58, 0x11, 0x67, 0x78, 0x31, 0xef, 0xcd, 0x1d, 0xbe, 0x0f, 0x3d, 0x44, 0x16, 0xe6, 0xfc, 0x5f, 0x8e, 0xb0, 0xfb, 0x8f,
+          0x0f, 0xe5, 0xc4, 0x35, 0xf9, 0x17, 0x46, 0x6a, 0xd5, 0x4b, 0x62, 0xf1, 0x31, 0xdf, 0xfd, 0x59, 0x30, 0x04, 0x7c, 0x7e, 0x4f, 0x08, 0xe3, 0x93,
+          0x87, 0x58, 0xc5, 0x40, 0xf2, 0xe8, 0x49, 0x2f, 0x8a, 0xe2, 0xd9, 0xd0, 0x1a, 0xdc, 0xb5, 0x24, 0xd2, 0xd2, 0xfb, 0x7d, 0xff, 0xed, 0xb3, 0x84,
+          0x8a, 0xbe, 0x4f, 0x20, 0x11, 0xac, 0xcf, 0xd8, 0xc7, 0x6f, 0x12, 0x23, 0xb4, 0xee, 0x8d, 0x1c, 0x3b, 0xd7, 0xa7, 0xdf, 0xb3, 0xb3, 0x75, 0x07,
+          0x5f, 0xc7, 0x41, 0xb7, 0x78, 0x21, 0x04, 0x90, 0xbf, 0xd6, 0x82, 0x1a, 0x2e, 0x97, 0x4c, 0xc2, 0xfe, 0x30, 0x69, 0x2f, 0xcb, 0x6f, 0x51, 0x01,
+          0x65, 0x6e, 0xbc, 0x4d, 0x31, 0x45, 0x30, 0x81, 0xc5, 0x5b, 0x1a, 0x10, 0x38, 0x47, 0xc9, 0xea, 0xfc, 0xe5, 0xfd, 0x17, 0x01, 0xe4, 0x25, 0xe9,
+          0x97, 0x50, 0x7c, 0x8a, 0x70, 0xdc, 0xfc, 0x05, 0xf6, 0x99, 0x8f, 0x3e, 0x0d, 0xff, 0x82, 0xf0, 0x16, 0x76, 0x4c, 0x37, 0xc0, 0xa4, 0x6d, 0x66,
+          0x0a, 0x90, 0xce, 0x58, 0x4d, 0x87, 0x09, 0x41, 0x4b, 0xdb, 0x14, 0x40, 0x00, 0xef, 0x86, 0x4c, 0x88, 0xbc, 0xa4, 0x03, 0xaf, 0x3e, 0xed, 0xf0,
+          0x76, 0xa5, 0xd2, 0x34, 0x79, 0xce, 0xb7, 0x9f, 0x63, 0xd0, 0xf7, 0x5f, 0x66, 0x0e, 0xfa, 0x98, 0x1d, 0xcb, 0x73, 0x9d, 0x35, 0x3b, 0x9d, 0x41,
+          0x87, 0x8f, 0x63, 0x2e, 0x16, 0x6b, 0x0b, 0x2d, 0xac, 0x3c, 0xbd, 0x26, 0x04, 0x9c, 0x32, 0xff, 0xc9, 0x10, 0xcf, 0x91, 0x44, 0xd1, 0x70, 0xe4,
+          0x0a, 0x15, 0x46, 0x44, 0x51, 0x46, 0xbe, 0x12, 0xb5, 0x6d, 0xe7, 0xbe, 0x7b, 0x12, 0x78, 0x71, 0x34, 0xf9, 0x36, 0x26, 0x5d, 0x1b, 0x7c, 0x45,
+          0x1a, 0x11, 0xff, 0x87, 0x44, 0xa9, 0x79, 0x22, 0x53, 0x5d, 0xac, 0x51, 0x57, 0x25, 0xd5, 0x42, 0x04, 0x0b, 0x91, 0x01, 0x10, 0x2e, 0xdd, 0x46,
+          0xb0, 0x76, 0xf4, 0xa1, 0x4f, 0x2a, 0xb2, 0x0c, 0x7f, 0xc6, 0xa3, 0xfa, 0xf3, 0x32, 0x98, 0xb4, 0x62, 0x4a, 0xc8, 0xac, 0x2e, 0x35, 0x5c, 0xb4,
+          0x18, 0x85, 0x3a, 0x25, 0xc1, 0xf0, 0xc9, 0xc4, 0x6b, 0x12, 0xf5, 0x6f, 0x30, 0xab, 0x0c, 0x42, 0x45, 0x9f, 0x5d, 0x64, 0x3a, 0xb3, 0x27, 0xc9,
+          0xe6, 0x16, 0x41, 0x7a, 0xf3, 0x12, 0x1a, 0x46, 0xea, 0x6c, 0x04, 0x8c, 0x1b, 0xea, 0x9c, 0xce, 0xe9, 0x42, 0x29, 0x86, 0xf4, 0x02, 0x35, 0x3a,
+          0x55, 0x1f, 0xce, 0xce, 0x66, 0x95, 0x61, 0xdb, 0x0c, 0x84, 0xfd, 0xb2, 0x53, 0x9a, 0x92, 0xf3, 0xe4, 0x41, 0xaa, 0xa4, 0x82, 0x62, 0xe7, 0x03,
+          0x7c, 0x0a, 0xc4, 0x53, 0x25, 0x0e, 0xc2, 0x4f, 0xcd, 0x73, 0xb0, 0x33, 0xba, 0x83, 0x85, 0x61, 0xfd, 0xa0, 0x32, 0x0b, 0x79, 0x6e, 0x0b, 0x33,
+          0x0a, 0xad, 0x04, 0x38, 0x2e, 0x35, 0x47, 0x52, 0xea, 0x39, 0xb8, 0xb4, 0xfa, 0x5b, 0x74, 0xac, 0xed, 0x4f, 0x76, 0x02, 0xb5, 0x74, 0x38, 0x10,
+          0x24, 0x94, 0x28, 0x15, 0xab, 0x8a, 0x43, 0xd4, 0x39, 0x09, 0x47, 0x29, 0x73, 0x24, 0x1b, 0x34, 0x32, 0x30, 0x12, 0x8a, 0x28, 0x77, 0x71, 0xd2,
+          0x94, 0x56, 0x4c, 0xd7, 0xd2, 0x26, 0xb1, 0xa2, 0x07, 0x0a, 0x23, 0x05, 0xd6, 0x69, 0x13, 0x34, 0xb5, 0x5e, 0x55, 0xa8, 0x82, 0xdb, 0xc3, 0x40,
+          0x64, 0x5c, 0x29, 0xdd, 0x3a, 0x01, 0xdd, 0xb2, 0x1b, 0xaa, 0x2c, 0xed, 0x99, 0x04, 0x69, 0x59, 0x16, 0x27, 0x9a, 0xe6, 0x75, 0xd2, 0xaf, 0xd7,
+          0xa0, 0xd5, 0xb0, 0x92, 0x6a, 0x2a, 0xc5, 0xd3, 0x5c, 0x79, 0x96, 0xf8, 0x1f, 0x8b, 0x2c, 0x10, 0xe5, 0x94, 0xbc, 0x0e, 0x67, 0xe7, 0x74, 0x92,
+          0x8c, 0x99, 0x3b, 0xc1, 0x31, 0x29, 0x16, 0x65, 0x90, 0xf3, 0x2e, 0x80, 0xbc, 0x20, 0x1f, 0x6a, 0xa3, 0xb0, 0x60, 0x6b, 0xd3, 0x9b, 0x86, 0x14,
+          0x61, 0x60, 0xa1, 0x85, 0x0b, 0xc3, 0x2a, 0x9e, 0x14, 0xd3, 0x09, 0x30, 0x07, 0x8d, 0x4b, 0xb2, 0x09, 0x9c, 0xcb, 0x03, 0x4b, 0x8d, 0x96, 0xb5,
+          0x84, 0x56, 0x7d, 0xca, 0x58, 0xea, 0x05, 0x7c, 0x1b, 0x55, 0x0b, 0xb2, 0x4c, 0x0e, 0x20, 0x21, 0xca, 0x5e, 0x0a, 0x2c, 0x9c, 0x86, 0x94, 0x30,
+          0xc3, 0xe3, 0x1f, 0xe9, 0x9b, 0xac, 0x10, 0x1f, 0x74, 0x48, 0x40, 0xaf, 0x1f, 0x97, 0x22, 0xa4, 0xcb, 0x5d, 0x46, 0xaf, 0xe8, 0xb7, 0x60, 0x2c,
+          0x7e, 0xfa, 0xea, 0xbb, 0x4b, 0xaa, 0xc1, 0x2d, 0x80, 0x4e, 0x68, 0xa0, 0x12, 0xd2, 0x10, 0x1f, 0x0e, 0x83, 0xdd, 0x6e, 0x03, 0x05, 0x01, 0x86,
+          0x99, 0x64, 0xfc, 0x8f, 0xc2, 0xc3, 0x4b, 0x78, 0x45, 0xa5, 0x0e, 0xa8, 0x47, 0x5d, 0x08, 0xc3, 0xcb, 0xe7, 0x58, 0xda, 0x54, 0xd5, 0x89, 0x1a,
+          0x02, 0x1d, 0xb5, 0x5d, 0xab, 0x08, 0x4a, 0xc6, 0xb3, 0x9a, 0x00, 0x9c, 0x7b, 0x95, 0xa6, 0xa0, 0x95, 0x52, 0x59, 0x6d, 0x15, 0x13, 0xec, 0x63,
+          0xec, 0xf6, 0x37, 0x3d, 0x81, 0x8d, 0x6c, 0x87, 0x52, 0x99, 0x4d, 0x64, 0x27, 0xcb, 0x01, 0xc8, 0x1b, 0x25, 0xec, 0xb6, 0x25, 0x7e, 0xf0, 0xac,
+          0x81, 0x90, 0x1f, 0x63, 0xae, 0x71, 0xce, 0x6f, 0xe9, 0xbd, 0x39, 0xf5, 0xdb, 0x65, 0x94, 0xc6, 0x7a, 0xf2, 0xe9, 0x85, 0xb4, 0x24, 0x9b, 0xb1,
+          0xe4, 0xaa, 0x79, 0x86, 0x57, 0x45, 0x25, 0xf4, 0x4a, 0x43, 0x50, 0xa7, 0x08, 0xdb, 0x08, 0x33, 0xb8, 0xd2, 0xb7, 0xdc, 0x10, 0x7e, 0x4d, 0x9f,
+          0xcb, 0xb9, 0x23, 0x15, 0x72, 0xc6, 0x06, 0x33, 0x51, 0x68, 0x7c, 0x9e, 0x21, 0x51, 0x64, 0x86, 0x4e, 0x82, 0x0b, 0x45, 0xe8, 0x53, 0xf8, 0x11,
+          0xf9, 0x34, 0xa9, 0x69, 0xd0, 0xd1, 0xb5, 0x48, 0x72, 0xe0, 0xfc, 0x22, 0x84, 0x06, 0x61, 0x5a, 0xd8, 0x98, 0x80, 0x06, 0x78, 0x4a, 0x6b, 0xb8,
+          0x9c, 0x4b, 0x92, 0x49, 0x82, 0x59, 0x98, 0xef, 0x82, 0xb6, 0x04, 0x28, 0x3a, 0x3a, 0x65, 0xea, 0x9f, 0x46, 0x02, 0x8d, 0x6a, 0xf2, 0xac, 0x88,
+          0x90, 0x46, 0x35, 0xa3, 0x36, 0xa6, 0xd0, 0x4e, 0x7b, 0x04, 0x83, 0xb9, 0x7d, 0x1c, 0xfc, 0x95, 0x6a, 0x0a, 0x6f, 0x5d, 0x31, 0x87, 0xb4, 0x7c,
+          0x9e, 0x9f, 0x42, 0x0b, 0x8d, 0x2f, 0x4c, 0x7e, 0x43, 0xdd, 0x66, 0x2c, 0x21, 0x70, 0x66, 0x5d, 0x88, 0xd0, 0x33, 0x7d, 0x4d, 0x23, 0x6e, 0x0e,
+          0xcc, 0x28, 0x18, 0x47, 0x7f, 0x18, 0xef, 0x15, 0x2e, 0x52, 0x0b, 0x63, 0x97, 0x59, 0x35, 0xf9, 0x12, 0xa3, 0xc9, 0x1f, 0xbe, 0xb0, 0x53, 0xae,
+          0x06, 0xac, 0x29, 0xfa, 0x61, 0x01, 0x43, 0x40, 0xc9, 0x7c, 0xac, 0xf7, 0x4e, 0x73, 0x50, 0x0a, 0xa5, 0x91, 0x67, 0x42, 0x84, 0x85, 0x15, 0x99,
+          0xdc, 0x60, 0x36, 0x22, 0x09, 0x8d, 0x6e, 0x8d, 0xbc, 0x74, 0x9e, 0x36, 0xc9, 0x8b, 0xcf, 0xe7, 0x55, 0x9c, 0x1a, 0x11, 0x38, 0xa5, 0x72, 0xb0,
+          0x54, 0x38, 0xea, 0x2e, 0xc8, 0xca, 0x25, 0x22, 0x55, 0x28, 0x9b, 0x6d, 0xaf, 0xdc, 0x17, 0x68, 0x7a, 0xe3, 0x45, 0x4f, 0xfa, 0x7d, 0xa0, 0x60,
+          0x40, 0x06, 0x54, 0x48, 0x15, 0x9e, 0xbd, 0xd4, 0x90, 0x65, 0xc1, 0xf3, 0x53, 0x61, 0xde, 0xc5, 0x1c, 0x97, 0xd0, 0x30, 0x00, 0x3e, 0xfb, 0x9b,
+          0x8d, 0x84, 0xa2, 0x35, 0xe8, 0x3d, 0x7f, 0x6c, 0xbb, 0x0c, 0x53, 0x0c, 0x8a, 0x30, 0xdb, 0xa4, 0x22, 0xd1, 0x1f, 0x5d, 0x2f, 0x1a, 0x62, 0x7b,
+          0xfe, 0x39, 0x5c, 0x8b, 0x19, 0xb9, 0x5c, 0x6b, 0x12, 0xe5, 0x4a, 0xe7, 0xf4, 0xb9, 0xa0, 0xd1, 0x69, 0x52, 0x2f, 0x06, 0x30, 0x3d, 0xf2, 0x39,
+          0x2a, 0x92, 0x78, 0x91, 0x8e, 0xe4, 0xe6, 0x43, 0xb8, 0x1d, 0x83, 0xcc, 0xf8, 0x74, 0x5c, 0x36, 0xa0, 0x14, 0xb6, 0x56, 0x15, 0x96, 0xc7, 0x29,
+          0x19, 0x39, 0x2d, 0xbf, 0xd9, 0x97, 0xd2, 0xc6, 0x08, 0x80, 0xb3, 0xe9, 0x2c, 0xfa, 0x24, 0x64, 0x52, 0x99, 0xa8, 0xf5, 0x8a, 0x92, 0xbe, 0x90,
+          0x8b, 0x3e, 0x19, 0x92, 0x08, 0x94, 0x8f, 0xd2, 0x25, 0xe4, 0xda, 0x9c, 0xe2, 0x66, 0x7d, 0xe0, 0x52, 0x69, 0x82, 0x4b, 0xb8, 0xc2, 0x36, 0x2e,
+          0x64, 0x61, 0xe6, 0xa4, 0xaf, 0xe0, 0x82, 0xd2, 0x78, 0xae, 0x6f, 0x23, 0x52, 0x57, 0x44, 0x94, 0xe3, 0xcf, 0xb5, 0xc5, 0xa4, 0x21, 0xce, 0x5f,
+          0x87, 0x31, 0x6c, 0x80, 0x1b, 0xea, 0xa7, 0x52, 0x76, 0xa5, 0x97, 0x30, 0xab, 0x93, 0xbe, 0x8c, 0x6e, 0x7f, 0xc3, 0x79, 0xdb, 0x80, 0x67, 0x59,
+          0x25, 0x83, 0x22, 0xf3, 0xaa, 0x8f, 0x83, 0x14, 0xaa, 0xbc, 0xfe, 0xca, 0xbf, 0x11, 0x9a, 0xc6, 0x4e, 0xba, 0x37, 0x36, 0x64, 0x58, 0xc7, 0xa2,
+          0xa8, 0x8a, 0x94, 0x90, 0x35, 0x67, 0xc7, 0x34, 0x15, 0x11, 0x00, 0x51, 0x44, 0xc9, 0x27, 0x58, 0x1c, 0xaa, 0x10, 0xdb, 0xfa, 0x85, 0xa5, 0xed,
+          0xed, 0xb5, 0x62, 0xd4, 0xff, 0xe6, 0xaa, 0x22, 0x18, 0xd2, 0x24, 0x32, 0x13, 0x41, 0x52, 0xd7, 0xa7, 0x0d, 0x3d, 0x57, 0xa2, 0x68, 0x53, 0xeb,
+          0xed, 0x4c, 0x41, 0x26, 0xb1, 0xef, 0x64, 0xb3, 0x30, 0xab, 0xb1, 0x96, 0xf8, 0x61, 0x85, 0xa8, 0xf3, 0xc5, 0xa5, 0x11, 0x7e, 0xa1, 0x9b, 0x77,
+          0x99, 0xae, 0x31, 0x82, 0x51, 0x15, 0xd3, 0x7a, 0x5c, 0x29, 0x86, 0xee, 0x5f, 0x0e, 0x95, 0xda, 0xd2, 0xf3, 0x62, 0xee, 0x02, 0x69, 0xc5, 0x13,
+          0x59, 0x03, 0xa3, 0xb8, 0xca, 0x24, 0xb2, 0xfe, 0xab, 0x57, 0x4b, 0x67, 0x65, 0x53, 0x57, 0x9a, 0x5c, 0xee, 0xbb, 0x0c, 0x3c, 0x7f, 0x4f, 0x6c,
+          0xd9, 0x6f, 0x1a, 0xd8, 0xaf, 0x11, 0x1f, 0x3a, 0x88, 0x0c, 0x61, 0xd4, 0x75, 0x19, 0x7f, 0x64, 0x43, 0x6f, 0xd6, 0x98, 0x9b, 0x88, 0x09, 0x68,
+          0x2e, 0x2d, 0xdb, 0x2c, 0x94, 0xe7, 0xfa, 0xdf, 0x8d, 0x08, 0x65, 0xab, 0x84, 0xb9, 0x80, 0x1f, 0x9a, 0xe8, 0x27, 0x81, 0x7a, 0x06, 0x41, 0x03,
+          0x49, 0x6e, 0xcf, 0x3a, 0xa0, 0x71, 0x18, 0x72, 0x96, 0x75, 0x88, 0xca, 0xba, 0xcc, 0x4d, 0x2e, 0xb9, 0x95, 0x75, 0xc4, 0xcd, 0x19, 0x79, 0xdf,
+          0x5f, 0x4b, 0xb2, 0x9c, 0x1e, 0xfc, 0x9a, 0x96, 0x63, 0x27, 0xf7, 0x5c, 0xad, 0xcc, 0x79, 0xd6, 0x29, 0xb7, 0xb0, 0xac, 0xe6, 0xbe, 0x8f, 0xcb,
+          0xb2, 0xce, 0x68, 0xef, 0x73, 0xb2, 0x4e, 0x66, 0xd6, 0xf9, 0x6a, 0xec, 0x9f, 0x55, 0x3e, 0xeb, 0xe2, 0xf1, 0xe0, 0xff, 0xbf, 0xc5, 0xdb, 0x27,
+          0xa1, 0x90, 0x9f, 0xa2, 0x7b, 0x09, 0xe5, 0xdd, 0x10, 0xe6, 0x63, 0xb8, 0xb3, 0x1f, 0xe8, 0xa5, 0x46, 0xb3, 0x9b, 0xfe, 0xd8, 0x36, 0x61, 0x38,
+          0xc0, 0x33, 0x01, 0x33, 0x91, 0xc2, 0x63, 0x02, 0xe4, 0xa3, 0xbf, 0xbf, 0xca, 0xe5, 0x62, 0x4a, 0x32, 0x5e, 0xde, 0xdd, 0xa5, 0xbb, 0xff, 0xd8,
+          0x6f, 0xc9, 0x5b, 0xa4, 0x25, 0x71, 0xb4, 0x01, 0xaf, 0xa0, 0x3b, 0x09, 0x4b, 0x33, 0xcd, 0xfb, 0xa2, 0x28, 0x95, 0x77, 0x12, 0x19, 0x6d, 0x5f,
+          0x67, 0x85, 0x29, 0x0c, 0xe3, 0xc8, 0x14, 0x14, 0x07, 0x5c, 0xa6, 0x8b, 0xc4, 0xa4, 0x9b, 0xa6, 0xbe, 0x88, 0x94, 0x1f, 0x2e, 0x31, 0x72, 0x29,
+          0x51, 0xa0, 0x1f, 0x80, 0x6f, 0x5d, 0x27, 0xec, 0x9c, 0xa3, 0x0d, 0xad, 0x98, 0x49, 0x9c, 0x06, 0x19, 0x46, 0xc7, 0x98, 0xec, 0x8a, 0x72, 0x22,
+          0x3e, 0xe6, 0xa5, 0x43, 0x62, 0x0f, 0x81, 0x06, 0x24, 0xba, 0x91, 0xc4, 0x04, 0x71, 0xb9, 0x98, 0x96, 0x68, 0xbd, 0x01, 0x3a, 0x52, 0x1a, 0x27,
+          0x28, 0x90, 0x25, 0x66, 0xcb, 0x70, 0x44, 0x0a, 0xdb, 0x85, 0x9a, 0xbe, 0xf5, 0xef, 0x40, 0xe0, 0xc0, 0xf7, 0x8c, 0x87, 0xb8, 0x44, 0xc5, 0x18,
+          0xe1, 0xf4, 0x48, 0x47, 0x10, 0xe2, 0x88, 0xec, 0xa3, 0x87, 0x32, 0x3a, 0xc6, 0xac, 0xe5, 0xca, 0xdb, 0x4c, 0xe3, 0x0d, 0x23, 0x06, 0xce, 0xe3,
+          0x13, 0x96, 0x77, 0x5b, 0xa9, 0x5a, 0x4a, 0x97, 0x98, 0xbe, 0xb2, 0x05, 0x22, 0x57, 0xc8, 0xfe, 0xae, 0x11, 0x2a, 0x0a, 0xe1, 0xb1, 0x19, 0x42,
+          0x36, 0xe9, 0x58, 0x82, 0xf6, 0x8f, 0x86, 0xa5, 0x1e, 0x91, 0xa5, 0xd6, 0xeb, 0xc3, 0x34, 0x99, 0xe0, 0xcf, 0x83, 0x4e, 0x5e, 0xf7, 0x8f, 0x57,
+          0x66, 0xd5, 0x03, 0xa6, 0xf6, 0x8f, 0x52, 0x5b, 0xbe, 0x3f, 0x0d, 0xa2, 0xc1, 0x84, 0x05, 0x9e, 0xa9, 0x43, 0x09, 0x26, 0x4f, 0x9c, 0x1f, 0x37,
+          0x75, 0xeb, 0x6e, 0xe9, 0xd6, 0x50, 0xa3, 0x96, 0xb9, 0x81, 0x96, 0xe3, 0xca, 0xb1, 0x4b, 0x9a, 0xde, 0xb0, 0x96, 0xf9, 0xc6, 0xd6, 0x1d, 0x9b,
+          0x14, 0x1a, 0xf1, 0xe1, 0x70, 0xc3, 0xe1, 0xb6, 0x21, 0x6b, 0x5b, 0xd6, 0x7f, 0xcb, 0x60, 0xd9, 0xb6, 0xf7, 0x8e, 0x36, 0xad, 0x02, 0xc4, 0x58,
+          0x13, 0x5c, 0xbc, 0xad, 0xf7, 0x37, 0xec, 0x60, 0xba, 0xb2, 0x2f, 0xf9, 0xcb, 0xc1, 0x1f, 0x87, 0x5b, 0x56, 0x39, 0x3a, 0x82, 0xb9, 0x66, 0x88,
+          0xf1, 0x7d, 0x7a, 0xf1, 0x8e, 0xff, 0x2d, 0x99, 0xd1, 0x07, 0x83, 0x89, 0x65, 0x57, 0x7d, 0x46, 0x34, 0xde, 0x84, 0x32, 0x56, 0xfc, 0x0f, 0xb2,
+          0x19, 0x14, 0xd2, 0x8b, 0x0e, 0x73, 0x28, 0x46, 0x46, 0x9b, 0xfb, 0x8e, 0x64, 0x8f, 0x2c, 0xe8, 0x78, 0xf3, 0x42, 0x9e, 0x88, 0x9a, 0xd6, 0x86,
+          0x35, 0x9a, 0x5f, 0x8c, 0x47, 0xee, 0x79, 0x2f, 0xd3, 0xd9, 0x04, 0xa4, 0x15, 0x97, 0x77, 0x1b, 0xbd, 0xae, 0x9f, 0xb9, 0xbd, 0x0c, 0x31, 0x2c,
+          0x20, 0x9c, 0x93, 0x25, 0x27, 0x30, 0x1a, 0xe5, 0xe4, 0x3e, 0x5d, 0xfd, 0x3d, 0x8a, 0x33, 0x19, 0xe7, 0x1a, 0x28, 0x2d, 0x6d, 0x38, 0x4b, 0x12,
+          0x8f, 0xdc, 0x94, 0x9e, 0xd6, 0xe7, 0xab, 0xbd, 0xaa, 0xe2, 0x43, 0xa4, 0x58, 0x77, 0x16, 0x60, 0xf3, 0xc8, 0x4f, 0x64, 0xa2, 0x15, 0xd2, 0x1e,
+          0x84, 0x11, 0x80, 0x6e, 0x7d, 0x36, 0xd5, 0xfd, 0xc8, 0xf8, 0x63, 0x7c, 0xbc, 0xde, 0xb0, 0x24, 0x5c, 0x99, 0x89, 0x3d, 0xa1, 0x11, 0xf9, 0xc8,
+          0x41, 0x4a, 0x66, 0x44, 0xc3, 0x0d, 0x86, 0x56, 0xed, 0x24, 0x39, 0xf7, 0x8c, 0x70, 0xb7, 0x4c, 0x13, 0xc3, 0x88, 0x07, 0xd8, 0x96, 0xb0, 0x64,
+          0xb7, 0xb7, 0xad, 0xbe, 0xbb, 0x3c, 0xe4, 0xdf, 0x7b, 0x69, 0x57, 0xed, 0x9f, 0xb0, 0x6f, 0x95, 0x9b, 0x12, 0x79, 0xb8, 0x6d, 0x8f, 0x42, 0x8c,
+          0x63, 0x1a, 0x81, 0x8c, 0x98, 0x8f, 0x37, 0xfd, 0x6f, 0xb8, 0xa1, 0x94, 0x61, 0x46, 0xaa, 0x59, 0x09, 0x36, 0xdf, 0xd6, 0xd6, 0xf4, 0xce, 0x3d,
+          0xf6, 0x15, 0xe7, 0xb9, 0xe0, 0x42, 0x75, 0x6a, 0x24, 0x34, 0xe7, 0xcb, 0x0d, 0x68, 0xdc, 0x61, 0x43, 0x97, 0x0f, 0x69, 0xd3, 0xee, 0xbe, 0xe7,
+          0xba, 0x93, 0x73, 0x9b, 0x72, 0x9e, 0x57, 0xd4, 0xd6, 0x78, 0xaf, 0xdd, 0x1e, 0x41, 0x5e, 0x13, 0xc5, 0xa6, 0xeb, 0x09, 0xce, 0x01, 0x60, 0x63,
+          0x6a, 0xe6, 0x10, 0x8b, 0xa6, 0xb3, 0xc9, 0x6b, 0x46, 0x03, 0x77, 0x9e, 0x40, 0x5f, 0x53, 0x4d, 0x24, 0xb8, 0x13, 0xeb, 0x07, 0xda, 0x8c, 0x76,
+          0x74, 0x54, 0x3d, 0x2d, 0xca, 0x68, 0x35, 0xfd, 0xc3, 0x6c, 0xeb, 0x6d, 0x5a, 0x6c, 0xe9, 0xfe, 0x84, 0xd1, 0x8b, 0xdb, 0xba, 0xe6, 0x73, 0xd5,
+          0xf8, 0x50, 0xcd, 0x3f, 0xe7, 0x5b, 0xe5, 0xf6, 0xa5, 0x07, 0x70, 0xa5, 0xf5, 0x80, 0xa1, 0xa6, 0xc9, 0xdd, 0x2d, 0x2f, 0xd4, 0x35, 0xa1, 0x01,
+          0xc5, 0xe2, 0xfd, 0x4b, 0x5e, 0x3c, 0xda, 0x24, 0x81, 0xc1, 0x46, 0x4f, 0x07, 0x3d, 0x2f, 0xc6, 0x63, 0x55, 0x9e, 0xd0, 0x64, 0xfc, 0x17, 0x92,
+          0xfc, 0x02, 0x5a, 0x24, 0x84, 0x3f, 0x4e, 0x6c, 0xe9, 0x6e, 0x15, 0x5a, 0x50, 0xcd, 0x66, 0xcd, 0xc8, 0xc1, 0xbb, 0x03, 0xb6, 0x7f, 0x0e, 0x70,
+          0x05, 0x16, 0x1f, 0xaf, 0x5c, 0x97, 0x58, 0x96, 0x45, 0x13, 0xfc, 0x76, 0x27, 0xca, 0xd5, 0xa5, 0x62, 0x36, 0x60, 0x96, 0x29, 0xa4, 0x46, 0xc5,
+          0xa0, 0xf2, 0x35, 0xcd, 0x1b, 0xcf, 0xf7, 0x57, 0xb4, 0x1a, 0xeb, 0x30, 0x3b, 0xd5, 0xfe, 0x3b, 0x49, 0x3a, 0xec, 0xf3, 0xbe, 0x8c, 0xc7, 0x34,
+          0x2f, 0x4e, 0xb5, 0xde, 0x2e, 0xaf, 0x0b, 0x71, 0x7e, 0xb7, 0x56, 0xbb, 0xce, 0xb6, 0x8a, 0x53, 0x59, 0xa0, 0xba, 0x5c, 0x79, 0xcb, 0xa6, 0x88,
+          0x38, 0xd7, 0xe7, 0x89, 0x0a, 0x4a, 0xc4, 0xa0, 0x0a, 0xf0, 0x36, 0xcc, 0x54, 0x52, 0x22, 0xd6, 0x54, 0x10, 0xff, 0x2a, 0x7f, 0x4d, 0xad, 0xf0,
+          0x17, 0x57, 0x01, 0x5a, 0xe3, 0x0b, 0x98, 0x67, 0x31, 0x20, 0x60, 0xd9, 0xa4, 0x47, 0xdf, 0x5e, 0x0b, 0x07, 0xd0, 0xd6, 0x92, 0x15, 0x9e, 0xef,
+          0x9d, 0x17, 0x12, 0x9a, 0xc7, 0xd7, 0xf3, 0xc1, 0x01, 0x91, 0x11, 0xa6, 0x74, 0xba, 0xbf, 0x32, 0x7e, 0x6f, 0x76, 0x7e, 0x01, 0xa8, 0x8e, 0x01,
+          0x4c, 0x49, 0x71, 0x14, 0xa8, 0x71, 0x2b, 0xeb, 0x5d, 0xcf, 0x6f, 0x83, 0x00, 0xc5, 0x4c, 0x0f, 0xc8, 0x6f, 0x13, 0x95, 0xfb, 0x19, 0xab, 0x5a,
+          0xd1, 0x47, 0xa6, 0x33, 0x90, 0x33, 0x3d, 0xb0, 0x23, 0xac, 0x43, 0x59, 0x88, 0x5c, 0x1d, 0xb6, 0xea, 0xa7, 0x4f, 0xd5, 0x49, 0x67, 0x26, 0xa3,
+          0x67, 0x85, 0xe0, 0xe8, 0x8b, 0xe3, 0x3e, 0x24, 0xba, 0x89, 0x7f, 0xf2, 0x7e, 0xda, 0x3f, 0x4a, 0xb6, 0x66, 0x04, 0xdc, 0xd3, 0x0a, 0x43, 0x57,
+          0x8c, 0x2c, 0xf0, 0xe8, 0xe1, 0x85, 0xe7, 0x98, 0x46, 0xef, 0x30, 0x60, 0xed, 0x74, 0xd6, 0x03, 0x7f, 0x8a, 0xb9, 0x97, 0xf5, 0x8b, 0x25, 0x4f,
+          0x6c, 0x2c, 0x07, 0x41, 0x51, 0x18, 0xc0, 0xc3, 0xf5, 0xc5, 0x54, 0xd3, 0x3c, 0x09, 0x82, 0x6e, 0x68, 0x26, 0x68, 0x90, 0xde, 0xa8, 0xa3, 0x65,
+          0xe2, 0x24, 0xf3, 0xe0, 0xe7, 0x2f, 0xa6, 0x59, 0x44, 0xb7, 0x92, 0xc5, 0xef, 0x4d, 0x3a, 0xad, 0x8a, 0x7a, 0x54, 0xff, 0xca, 0xc8, 0xde, 0x96,
+          0x80, 0xe2, 0x5e, 0xac, 0x11, 0xd7, 0x29, 0xf7, 0xc5, 0xda, 0xf3, 0xbe, 0xf4, 0x14, 0x77, 0xf2, 0x69, 0x3d, 0xe8, 0x17, 0x69, 0x43, 0xb3, 0x95,
+          0xf9, 0xf4, 0x55, 0x04, 0x00, 0x70, 0xd0, 0xd9, 0xff, 0x75, 0xb7, 0xbc, 0xb3, 0xf9, 0xd2, 0xce, 0xb7, 0x7e, 0x1a, 0x5c, 0x5a, 0xa4, 0xa2, 0xfa,
+          0xc8, 0x7f, 0x32, 0xaf, 0x73, 0x6f, 0xc1, 0xed, 0xfc, 0xc8, 0x33, 0xe5, 0x10, 0xba, 0x75, 0x14, 0x07, 0x97, 0x8e, 0x2a, 0xe7, 0x41, 0x30, 0x6e,
+          0xb7, 0xd4, 0xd1, 0x73, 0xde, 0x22, 0x7b, 0xf2, 0xdb, 0xf6, 0xf8, 0xca, 0x88, 0xc0, 0x22, 0xab, 0x13, 0x73, 0x84, 0x2a, 0x5b, 0x3c, 0x99, 0x42,
+          0xe2, 0xdf, 0xa0, 0xa7, 0xb9, 0x6a, 0xf3, 0x44, 0x49, 0x54, 0x89, 0x14, 0x99, 0x64, 0xfb, 0x34, 0x68, 0x74, 0x92, 0x99, 0xcd, 0xe0, 0x1c, 0x02,
+          0xdf, 0x9c, 0xae, 0x07, 0x36, 0x02, 0x63, 0xd8, 0x92, 0x2f, 0xdf, 0xfc, 0x00, 0xcb, 0x0f, 0xb8, 0xb7, 0x2c, 0x5a, 0x11, 0xeb, 0x40, 0x29, 0xe7,
+          0x32, 0x0e, 0xa9, 0xaf, 0xab, 0xc9, 0x4f, 0x8c, 0x00, 0x5f, 0xab, 0x8b, 0x05, 0xe2, 0x1b, 0x1b, 0x48, 0xfe, 0xd6, 0x6d, 0xd6, 0x0a, 0x84, 0x24,
+          0x25, 0x20, 0x3f, 0x65, 0x0a, 0xbb, 0x5a, 0x7c, 0x43, 0x06, 0x6e, 0x7c, 0xdf, 0x42, 0x0f, 0x7a, 0x19, 0x4d, 0x2d, 0x6f, 0x5d, 0x88, 0xd4, 0x91,
+          0x71, 0xf2, 0x03, 0x60, 0x04, 0x95, 0xa6, 0x0c, 0xfd, 0xc9, 0xb5, 0xe7, 0x50, 0x66, 0x8f, 0xe5, 0x4e, 0xfe, 0x0f, 0x24, 0x50, 0xcc, 0x6f, 0x60,
+          0xd1, 0xd1, 0xcb, 0x7c, 0xeb, 0xb4, 0x9d, 0x9c, 0xce, 0xeb, 0x5d, 0x7f, 0xdf, 0x6e, 0xa7, 0xdf, 0xf2, 0xfb, 0xd3, 0xaf, 0xdd, 0x52, 0xa2, 0xe5,
+          0x7c, 0x63, 0xc0, 0xad, 0x26, 0x6a, 0x3c, 0xb2, 0x90, 0xee, 0xf3, 0xdf, 0x6a, 0xe6, 0xd6, 0xd7, 0xb9, 0xac, 0x14, 0xa7, 0xe9, 0x1d, 0x27, 0x17,
+          0xe6, 0x38, 0xd0, 0xca, 0xc4, 0xc5, 0xf5, 0xc8, 0xea, 0xd5, 0xcf, 0xbd, 0x31, 0xf1, 0x33, 0x38, 0x60, 0x92, 0x8a, 0x0e, 0x1c, 0x00, 0x9c, 0x03,
+          0xb8, 0x32, 0xe7, 0x09, 0x91, 0x3a, 0x36, 0x29, 0xda, 0x61, 0x87, 0x76, 0xca, 0x1b, 0xea, 0x25, 0xf9, 0x27, 0xdb, 0x48, 0xda, 0x69, 0xd7, 0x26,
+          0x2f, 0xf7, 0x65, 0xd5, 0xc9, 0x57, 0x69, 0x78, 0xa3, 0x2f, 0x1f, 0xbc, 0xd0, 0x29, 0x8f, 0x61, 0xc8, 0x75, 0x3a, 0x19, 0x8d, 0x47, 0x3a, 0x43,
+          0x03, 0x4a, 0x74, 0x99, 0x96, 0xb5, 0x7e, 0xb4, 0x38, 0x7b, 0xd1, 0x6b, 0xe4, 0x5a, 0xca, 0x4c, 0x77, 0xd2, 0xba, 0x81, 0x0d, 0x9f, 0xf6, 0x22,
+          0x6c, 0xda, 0xde, 0x67, 0x9a, 0x25, 0x0a, 0xe7, 0x89, 0xd1, 0x05, 0xf7, 0x46, 0xa8, 0x1f, 0x4b, 0xf2, 0x12, 0x34, 0x25, 0x5d, 0xa9, 0x75, 0x79,
+          0x5f, 0x60, 0xe1, 0x32, 0xd9, 0xb3, 0x85, 0xe0, 0xea, 0xee, 0x5a, 0x18, 0x43, 0x6c, 0xbe, 0xe8, 0x4f, 0x14, 0x8b, 0x2d, 0xc5, 0x53, 0x3e, 0x5a,
+          0x91, 0x2e, 0x32, 0xcc, 0xeb, 0x0c, 0xc3, 0xad, 0x3c, 0xa7, 0x0b, 0xde, 0xa5, 0x5c, 0x34, 0xce, 0x64, 0xdf, 0x55, 0x7e, 0x5c, 0xcd, 0x86, 0xef,
+          0x81, 0x6b, 0x54, 0x7a, 0xbc, 0x98, 0x10, 0xef, 0x4f, 0x4c, 0x49, 0x5e, 0x46, 0xec, 0xa6, 0x10, 0x9f, 0x07, 0xe7, 0xc9, 0xe1, 0x84, 0xeb, 0x62,
+          0xb1, 0xdb, 0x4f, 0x5c, 0x95, 0x18, 0xf9, 0x08, 0x45, 0x58, 0x31, 0x1e, 0x11, 0x7e, 0xa9, 0x4e, 0xe9, 0x60, 0x78, 0x3e, 0x1b, 0x57, 0xe7, 0x81,
+          0x15, 0xa6, 0xb8, 0xaa, 0x5b, 0x45, 0x46, 0xa3, 0xa7, 0x46, 0x8e, 0x23, 0xc7, 0x14, 0x47, 0x8c, 0xd1, 0x90, 0x8b, 0x39, 0x8e, 0x9a, 0x20, 0x67,
+          0xd4, 0x84, 0x82, 0xc7, 0xb9, 0x7c, 0x8f, 0x7a, 0x63, 0x84, 0xb9, 0xa9, 0x47, 0x0d, 0x8a, 0x25, 0x67, 0x1d, 0x30, 0x44, 0xc2, 0x84, 0x80, 0xbb,
+          0x11, 0x9e, 0x77, 0xb8, 0x70, 0x9b, 0xa6, 0x6b, 0xd1, 0xdc, 0x21, 0x00, 0x37, 0xb3, 0x99, 0xef, 0x63, 0xb0, 0x16, 0x40, 0x7b, 0x6a, 0xf2, 0xba,
+          0x29, 0x66, 0x46, 0xa5, 0xf2, 0x6e, 0xec, 0x26, 0x91, 0x7c, 0xef, 0x84, 0x59, 0xd4, 0xce, 0x8e, 0xc7, 0x5b, 0xac, 0x75, 0xe6, 0xfe, 0xbd, 0xe5,
+          0xc5, 0x85, 0xda, 0x29, 0xb4, 0xc9, 0x5f, 0x53, 0xb8, 0x7d, 0x7a, 0x8c, 0x41, 0x9d, 0x9b, 0x9e, 0xec, 0xf7, 0xe3, 0x61, 0xe6, 0x3b, 0x1d, 0xa9,
+          0x7b, 0xe5, 0x84, 0x82, 0xa7, 0x0a, 0x93, 0x7f, 0xd8, 0x3e, 0xad, 0x35, 0xa0, 0xb7, 0xc6, 0x27, 0x7c, 0x28, 0xea, 0x91, 0x95, 0xc2, 0x86, 0x7a,
+          0x8a, 0x74, 0x78, 0xc0, 0x96, 0x23, 0x66, 0x46, 0x4b, 0xea, 0xa5, 0xec, 0x63, 0xc8, 0xd6, 0x26, 0x0c, 0xc6, 0x41, 0xbd, 0xdf, 0x04, 0x7b, 0xac,
+          0xa2, 0x26, 0xbf, 0x2b, 0xdb, 0x23, 0x83, 0xb3, 0xf7, 0xad, 0xd0, 0xe6, 0xb5, 0x75, 0x49, 0xd9, 0x9a, 0x6a, 0xb2, 0x36, 0x7b, 0x21, 0x87, 0x6c,
+          0x09, 0x34, 0x11, 0x05, 0x77, 0xf2, 0xbb, 0x9b, 0x36, 0xd5, 0x6e, 0xc1, 0xa0, 0x0c, 0x70, 0x06, 0x85, 0x28, 0xdc, 0x8d, 0xc8, 0xfd, 0x85, 0xb0,
+          0x55, 0xc0, 0x17, 0x1b, 0xf8, 0x8c, 0x35, 0x05, 0x5b, 0xec, 0x04, 0x73, 0x71, 0x73, 0x4d, 0x95, 0xdf, 0x43, 0x45, 0x61, 0x86, 0xd0, 0x22, 0xc2,
+          0x5d, 0xf5, 0x0d, 0x9b, 0x3d, 0x04, 0xce, 0xdd, 0x41, 0x32, 0x25, 0xf6, 0xcb, 0xb0, 0x8e, 0x17, 0x84, 0x0a, 0x20, 0x40, 0xef, 0x73, 0xee, 0xbc,
+          0x15, 0x92, 0x70, 0x7f, 0x86, 0xb6, 0xde, 0xcb, 0x81, 0xc3, 0x19, 0x10, 0xe1, 0x09, 0xed, 0x3d, 0xb3, 0x1a, 0xd0, 0x0c, 0x9f, 0x11, 0x57, 0x28,
+          0xa3, 0xa8, 0x70, 0x97, 0x82, 0xc3, 0x63, 0xd3, 0x82, 0x38, 0xbe, 0xd4, 0x71, 0x23, 0x1a, 0x02, 0x05, 0x82, 0x1a, 0x41, 0xbf, 0xdf, 0x0b, 0xb7,
+          0x2e, 0x0b, 0xe7, 0x09, 0x43, 0xf0, 0x16, 0x7a, 0xd8, 0x19, 0x8a, 0x3b, 0x70, 0x6c, 0x2b, 0x7c, 0xab, 0x65, 0xda, 0xfd, 0x85, 0x90, 0x2c, 0xa0,
+          0x4a, 0xa6, 0xee, 0xef, 0xac, 0x18, 0x59, 0x8d, 0x0d, 0xea, 0x36, 0x5c, 0xaa, 0xdd, 0xf7, 0x96, 0xf4, 0x3b, 0xf9, 0x84, 0x1b, 0x99, 0x0e, 0x8d,
+          0x75, 0x8b, 0x56, 0xe6, 0x1d, 0x4c, 0x8f, 0x6e, 0xd8, 0x25, 0x61, 0x00, 0x71, 0xdb, 0x2e, 0xa4, 0x00};
     };
 
     struct ReactDom {
         static constexpr std::string_view encoding{"br"};
         static constexpr size_t dataSize{37235};
-        static constexpr std::array<uint64_t, 4655> data{
-          0x5329035220373d16, 0xe80e2054dedeeb14, 0x1da861e3c000735a, 0x1984aa97e28dd1a4, 0xfe4a24b1a57657b1,
-          0x8461f1c6d8f1868d, 0x097cc54f56d5dcf8, 0x8f335ffc2e7721f6, 0x1bf42afc1008f1c7, 0x43ecf29719566ff1,
-          0xe60af964de154c26, 0x0fb486f37021a8dc, 0x03bd9341236dd2e7, 0xc04995ea2677833f, 0xd53f1009ae548874,
-          0xf6e8d6fd5b686115, 0xe038f9100969a38b, 0xa789665a55d3fe04, 0x794e426202b82bc7, 0x2bbaff6e3fe432b5,
-          0xc73f7f6afdf3f3c5, 0x6a9b7d116e6c3b6e, 0xb89c6b9ab1e3b631, 0xf165340f49081951, 0x56924b9aef97e6ee,
-          0x73b9cdbcbc8fc2c6, 0x20d99b4211a5f629, 0x2e8be34d6b02f8ff, 0xd4f42b4a7b45f196, 0xaed15bc6e763f4ac,
-          0x49c26100709328b7, 0x35b6ff9f95f4ff3f, 0x6dd6fe6f562d7592, 0x164c4b1476e3e991, 0x7381c9866c9874ef,
-          0x7def7d5582ec6aaa, 0x0e86af52fdcc7f12, 0xc96ea9c5772e9d2e, 0xdccafac85800248f, 0xb276d066d9cafc92,
-          0xecb2bdec816c9681, 0xc780f1b2aaa64756, 0x5fe9f5ecbfffa6da, 0xd7af4414afe74247, 0x9e65bfb7a7af8b9d,
-          0xae4e0a2bee2c8230, 0x60444ae6581b48ba, 0x19477c562dcb1097, 0x99e83e175cab8a45, 0xa202e46d66f9ae37,
-          0x96ed5d96f3fbbb2e, 0x37b33ee0fd09b05f, 0xaa2d0ec109b243fe, 0xa9a3da96340c62c6, 0x0cb8dedf57a9d9cc,
-          0x9e5985856253ec6d, 0x9b7d3f5ca60090b2, 0xdadebbfbe4ab2f17, 0xd67feffdd7c855ac, 0xac655485022c8000,
-          0xa34991b408820a53, 0x14fb2f59546616d8, 0x5d954077148a6c9b, 0x84e4085252d814bb, 0x1d232f272d5ed759,
-          0x8f3397f3be9de676, 0xf3cca9edd3692cc7, 0xb2a0a0283e2d3bcf, 0x36b93bc569dd960c, 0x50fad4783e32841c,
-          0xf77d1353bf716235, 0x3e9bfd1bf104299e, 0xe023642b5d455564, 0x4b7ad60720b665bd, 0x43f1c99d99acb24d,
-          0x029bfc5355830163, 0x1bff18492deefc6f, 0x4cab696e37669399, 0x93222022d582ff91, 0x17bdfc75d9b94fee,
-          0x7fe597734b076a0d, 0x3dbd7c9f57aaa215, 0xacdc7fa4ee101f4a, 0x086b0d35118a9c41, 0x2de90c7fcbb47c02,
-          0x19b14822ba212fb3, 0x218540abd1d6da46, 0x5b512442a1c11616, 0x452e7c12453bde92, 0x246be3125c2f6018,
-          0x6b3bfe5a695f7617, 0x8afc0bc817edfa99, 0x9ff99f9ebb0df981, 0x3334779b4fbd81b3, 0xec649ffefab55077,
-          0xf1efa2f6abf81641, 0x5d79f8326bd625d5, 0x372b755dee4a4c3f, 0x9110a4279e3b40ba, 0x6ce6a9c16948664a,
-          0x5062ff6265aa321a, 0x35600cac99b0f8ec, 0x0dfcd1e48f3eaeca, 0xe756c550bc0d7097, 0x5775286f1fc66475,
-          0xa687c3372aefbc9d, 0x477af1c2e7862992, 0xaa22268cd9e762b1, 0xa0e6cf032865cf5d, 0x21aef07fe7ce395f,
-          0x1edbe1775cb7be2c, 0xcb16b52064fdbc78, 0xfbdf3c73e3225ab4, 0xa967de66f1f8feba, 0xcc56b78b9649fc9a,
-          0x86f57f9672c1afec, 0x716dad71e71bafda, 0x08f2ccae6b1bf685, 0x52eff63fc2225e42, 0x14954f6127c15e55,
-          0xa25f9cd40656a7a9, 0x2677b1f8f3b49cc2, 0xbb9bfdb7d9b972c0, 0x2f1e0b55d54ad45c, 0x413ae1bee106953b,
-          0xfc5d47c0547f58ac, 0xb87509070cbb5491, 0x8aebd9c135bfa401, 0xe3c2c0fad5a0493c, 0x13592e2edfb71b98,
-          0x1bb853fd37e810ea, 0xdc68c5a58d16c815, 0xb61112aa26e79c96, 0x0bbc224ddb553fbf, 0x77679c60d453235f,
-          0x965e94585dd9665a, 0xb6b845f6f15673ed, 0x94c08776ea568512, 0x116a236aa4e8e2ee, 0x628bc2e8811b61c7,
-          0xe962071d6d9e933c, 0xce87b6360a7835e8, 0x3962691ee6d19b08, 0xbef1f5e01000aad1, 0xaf47e864adc12b56,
-          0x822c5d08e94e2484, 0xfaa3bb1fc603a5c3, 0xe957e625d4d1dd89, 0x0f13fb79d5250565, 0x1a69d2a5899086b8,
-          0xa4efe8149820e126, 0x3e03ae7f68673cfb, 0xedfad9fbe75b78db, 0xa03e16fdfe351c26, 0xe77652367a99aeb1,
-          0x3b9cd5fac188d886, 0x56e35c39ac59aacc, 0xfd706bde6608b686, 0x1e66e6905335e596, 0x22035e7d34ed76ac,
-          0x4de95de66b104e15, 0x800a19d13b9b7aea, 0xc6ee53fbb87ca1dd, 0x2be66db0ed2e9683, 0x4694d3d53e2e3366,
-          0xfb3f8570f4a67578, 0x773a457e2da8f9ee, 0x078e450395165d2f, 0xbc00bfcf773bccd3, 0xaa489eb3c3c29959,
-          0xae4dfca1b906c2bb, 0xfb62aa6bc1e9c96b, 0x3fa3b74febbaee80, 0xe45ab76980444417, 0x0c3b8c879ef6924d,
-          0xc29accfa2a3175d1, 0xd778ac5b4a0ad9fa, 0xbf42baac16592a47, 0xeabd390efeded92c, 0x81b79b2371ff6ab2,
-          0x97282b575f11a7d8, 0xcbd1701ade02416c, 0x551e788f2226e493, 0xf39ee0d96337540e, 0xf5145b49cdfadb15,
-          0x19b16ca9ac7755e9, 0x3d0e13c1b28ac3f2, 0xe2f979043a0d08fb, 0x4f05624b88436c9b, 0xc3e2507e7567f1a5,
-          0xedebf1dc571b6d60, 0xcd7a7b50226328d1, 0xbb78de74120ca286, 0xea75dede6eb13f3f, 0x5eaf8fd7fefcb10b,
-          0x067dd4ae09fe9ca6, 0xc6a28a58365feaed, 0xf318c484754de1d7, 0xf6c78f65f7d313e1, 0xcbec64ae3e58d540,
-          0x1a5a466a5505b453, 0x9e877eb788cb22c2, 0x5171787faa88ee0f, 0xe7c5d6abd0a2b505, 0xaf2724a0d0385d78,
-          0xabd8616fe0fdb461, 0x152841cbf9b788c0, 0x1bd4bf5a99d394c0, 0x801eaaa2d653048a, 0x7ba6d260c9813f89,
-          0x43c5e5c3327a60b7, 0x89284cd131687f1f, 0x2d735f681ad6509a, 0x6d7680befa8ff01e, 0xcc04fe655866a75b,
-          0x172b50551c115cc0, 0x2c52f52ffc06ab85, 0x9a26f665a47651f2, 0xbcdad531044a5d39, 0x4b2809a146a2a633,
-          0x485ca114b45a8229, 0xb5340806782d23b0, 0xbf7ec635d2f39682, 0x9eb8ff8f98edea72, 0x02afae4f68873c3e,
-          0xad5d0cfde8faf654, 0xdd884d75f4f9c84f, 0xd59a2428ae3a07c8, 0x975bdccd872d3da7, 0x57db6346938f87ae,
-          0x35e7edb037c47912, 0x846585151f81796b, 0x862fb3fe5f272d7c, 0x6fb3d534c6294328, 0x96d5847134643ae5,
-          0x179597c697cf28c4, 0xb50993c074fb3cc3, 0x89ad5e9684f74b33, 0x5652992855ae7e49, 0xea52de5552f62590,
-          0x8550d2f720004a44, 0xddc962ef6bfe03bc, 0xac6ca60950a51209, 0xa7efcb6394873b68, 0xd5fdc4d9b3f08779,
-          0x7bd5a3dd66f93794, 0x3fe3d36bb5c092d5, 0xfffbc47786d6c192, 0x53ec38221d059dc2, 0x55b3175e18884d80,
-          0xcbdb0e164220cc61, 0xe206479e43776a0f, 0xca6163b9e9c95535, 0xceaeb60d0abaae58, 0x1530bbb3500116d9,
-          0x3b4b96e53b0a7210, 0x29da4302b8fee69f, 0x7a5fce0faae77864, 0x8707f5a5d7e3b2d0, 0x8173c3fe695eb54b,
-          0xfa15e3029344fa98, 0xf74c389cf2f6c234, 0xf34a3a58072a4fcc, 0x4acd4f2bc6f4fcb8, 0xcf2220270cff4140,
-          0xb6ec146e766c92d1, 0xabfe9a243b4d1b80, 0xdc1deb0fafbc2f5e, 0x0f0cc1150703c4ff, 0xe3081c4680a18689,
-          0x5adb42455096ae5b, 0x251cb578e381ef50, 0x679bb467dc38ae64, 0x9978aefde1731663, 0x6526085962bbc892,
-          0x7ae3c9655b37effd, 0x784e40f71eee7d9d, 0xecd6d75617f8f648, 0x1b13e4771481f0bf, 0xda51f980a3d64b6c,
-          0x0dc500dfe41c3182, 0x31ee1549eadb3da7, 0x370c230dfe4ac9fd, 0x0a81d43bdee5279a, 0xedee00e5fcad3fbd,
-          0x360d80ccff36f127, 0x1ad790458fe96982, 0xff8b42d4c51887fd, 0x10435d4f723dc72a, 0x95d1e924f6ec23e3,
-          0xb9ef62b86b8ccab5, 0xc35e1f9afbf94628, 0x5d174b16e0a69772, 0x8c049cd39577b16b, 0x4793410f51ad1024,
-          0x6f73024389a3a972, 0x9b42f896bb934098, 0xabc1fbc6563c0f2b, 0x9335175abea4dbb5, 0x7dec5a3f8d729dc3,
-          0x45f02492ee398578, 0x1c7d80a1daef8056, 0x9fe74f6c9924038a, 0x4d3e29d79e685008, 0xa42ad9267dc653fe,
-          0xbe09ab92b98b1e6f, 0x41e9a137104e9c50, 0xaaaed5e0ae012a0f, 0xa782b55e3f9c7601, 0xaafdd91d5dcd0e51,
-          0x07d3af48855f9e85, 0xa14f516c9e14cb58, 0x0955cf02295a7eb8, 0xa45a27d4c2f4db53, 0x1865b588034717fd,
-          0x2d15d934ed8eb7a5, 0x0b6ce0111ca96c1d, 0x236bcce0b4c7c07c, 0x7814fba156945f9e, 0x5deac7f1e1d07ac1,
-          0xc84f44325fcad574, 0x6ee8b150351018c4, 0x648e44b8fb3a134a, 0x1475e4a70c85d711, 0xe5fb51c94a36ae79,
-          0x19d74ad800f2190a, 0x766002a571b21e40, 0xee75ab85d0432654, 0x05eb8db657121adc, 0x5a40906934e1c423,
-          0x2b357b1339a62920, 0xe02295ab8e7e2410, 0x5c692c920cadfb06, 0xae90e2c975c03673, 0xea13d4a622653b02,
-          0x09645cda8a794e72, 0xb8e04abf3ca549d3, 0x310435670d2c4bbe, 0xf15bed5488d904fc, 0x46100553b5230537,
-          0xc9f52811d83952ae, 0x1889f272e0554f58, 0x45656f44d3cb8b5a, 0xa61dc078c7d0da3a, 0x914989351e94873b,
-          0xa457b251fec25087, 0x264c111e38adeb17, 0x6bf9c25ca45ce85c, 0x26046a000b4482fc, 0x1e4bdf0d42f9c1c2,
-          0xc94e95dc2393b541, 0x302eabb4e287021f, 0x2d826e416281798c, 0x395ad18662305ca1, 0x115b4c8af21dc70d,
-          0x29b92ac429e00540, 0x0ff3e2612e19d812, 0x2de7be9bcd100523, 0xf2857f1a9425a85c, 0xd6986c5894a1cd3b,
-          0x342a9d8ec5ccd0f9, 0x6c24092d7bac631b, 0x642545f53de3180a, 0xb23fa49c22ea1b06, 0x90d2e4775a42325b,
-          0x5a51d735f026cdd1, 0xb6ed0543128bd664, 0xcb17e69ab43f84ca, 0x68e473bb017600c6, 0x0712c85522cf2236,
-          0x79a43457f57f14ac, 0xb9a5a82d4d6b9487, 0x48ad5656b60c80dd, 0x24734a3db5c1eda1, 0x72abf18ea8636b7e,
-          0x00499a9bc484f58c, 0xa8d04a984d9c0549, 0x35987e772a7c52c9, 0x743465e0b6b47449, 0xfab20e4b044a8b46,
-          0xd2b840af3b7f3cc1, 0x9fe31aa5b45d94e7, 0x28496c241be91b41, 0x92a5115d88fd0d22, 0xe961893598d8f752,
-          0x062a9f15cf9d22b4, 0x1fc565600d3072b4, 0x97197b03680d7340, 0x3961b7c699abfd79, 0xf9456868e88a9f5c,
-          0x8fbf6c5a13227489, 0x0ae4036121e73e74, 0xae3787a4813872ce, 0x66f93ec0c8f508f2, 0x81c84f2c5fdc2476,
-          0xb1497fd69a30d7df, 0x661bcacfc2220f3e, 0xaea1128e9765fc88, 0x9ee1aafc02ef089f, 0x5b71d0a806e0ae5c,
-          0x9feecf5ba9f364fc, 0x8c5cb4a87c50b2a2, 0x958b7e2ab851d053, 0x2ab77f0424531d03, 0x64087f2d8028cbb8,
-          0x8857ce759dd4461c, 0xad4815fed63a5bb3, 0x1210f12055c1b15c, 0xfb7f6e322286b11c, 0xdd93408c214b6af6,
-          0x58e1ac08637629f0, 0xd2e175c5c783e8e4, 0x56db3c1ff1ba7b23, 0xa41c1352953aa394, 0x57213b08676959e2,
-          0xc202e59415376050, 0x58c8c04b82f9a5a6, 0xe2b5841a13e4a870, 0x7c5e13a4d7b8653b, 0xe39f6b6f97241a9a,
-          0x2b1bc2344d20cdaf, 0x48f0cc471121c02a, 0x2a1d8ead376b4665, 0x51ca940d3af289f1, 0xce66eb5b35a46638,
-          0xb7952840942788ad, 0xedbd2d4535dc04ba, 0xb6c46556eda1b389, 0xb4f94a10da3125a1, 0x45c68a2caa322b2b,
-          0x51350e7753a68690, 0x9777b165feb5afae, 0x842e1460a2e4f41b, 0x3241a0c4bc1753d4, 0x711488a6b43604ac,
-          0xcc7b917a04ffbf7a, 0x3f0d1d4b9b2d1b84, 0x325b46fe8fad17b5, 0xd58a8354e91d11b1, 0xf5f52e7b1ba80a4f,
-          0xa0a16a827ec5ef98, 0x865f068b0f591f3f, 0x8a73d5ab53e990bb, 0xe8faf87518fcb854, 0xb90eab4f3443091f,
-          0x2e9496a9ccfd45a1, 0x8132ad314e2aab45, 0xd2e0d7438b9770f9, 0x0fe33cdc26221780, 0x5de21ac023b0cf9e,
-          0xb81b09b12a7f68a6, 0x2980a85ffbb20a86, 0x73bf41e6a01193cb, 0xddebb98e2d997536, 0xb69fc31bd5967928,
-          0x52717bddae2af273, 0x4b8334531696f8c3, 0x0de37d8d71c0952a, 0x5c0c7d599395a6a6, 0x8fcfb7d68163c072,
-          0x18fc367a6972b0f9, 0x9a2f9651d1742e8b, 0xe1ed5ef9dfdfa945, 0x44f940b4b36fae64, 0x5e1eb8fdf64af01d,
-          0x758d4eb8aa4673cd, 0xa6b122c95dddae51, 0x689bd9d85287bec9, 0xcf282114549db77c, 0x17d0a801d8b97089,
-          0x819367ed98180dd9, 0xaabdccf2e0637bfa, 0x0c471f1da2f12c57, 0xd13e930f42389e5f, 0xf6afaf9702897af5,
-          0x45097052cbadec5d, 0x6a3ca24fa203a2e0, 0x3a9b932103c703fb, 0x0fea3f9ad69078ee, 0x0e035c8df74f0f65,
-          0x8a0910e3688e4846, 0xadfc882aa6c433c0, 0x27048bc2459a9f17, 0x6e37f7a5d5c124fe, 0x05a01385fb41d49d,
-          0x6f7ea4a07858a01b, 0x7278698caa2ffd9a, 0x88f521f3a3ff229c, 0xf35f1caa0dea0a63, 0x0d29829d4f3887c3,
-          0xfaf517018624d960, 0x6c50c3b61a840a5b, 0x9f69a057ad3f37d8, 0x95b2e476fd97cee3, 0x32e2e475ca891fc7,
-          0xe1555e45d4d8e031, 0x48b0b9a554c80846, 0x7bc8a2e3da6e83f6, 0xdf869a10a8de8eaa, 0xb614f46854d01079,
-          0x714ba08414d13b2a, 0x195b685d615cc516, 0xfa3c34c7a47adb69, 0x6dde5524848d3570, 0x37946c5abfd9ed80,
-          0x60412186cef64861, 0x5e88c9b39d529cca, 0x1feb470ab37078cf, 0x9ee795519416b46f, 0xe35894f6ea629b4a,
-          0x09df8834214e31ad, 0x43b39aef12fe0b5f, 0x2f900c8a1243cf2a, 0x9b7a19a728330d5c, 0xade544ea8cda9ab9,
-          0x31275d3201adcf59, 0x384b4ca48203e5fa, 0x05dc7ba2ce930ac9, 0x634df7c9743f3e71, 0x6bb39d104bade16d,
-          0x77269c5844de2c3f, 0x217d05393b34f394, 0x461f4c72ace12df2, 0x474c95dfffd43948, 0x3ed1c9e84455309e,
-          0x16cd5ac7d9c6c35f, 0xb7806f315e522de4, 0xdad65f3ce0606bf5, 0xc62a74cdb601863d, 0xec8b6e7fa3e2cbb4,
-          0xdd36a439cf81c462, 0x2b1306ac23866012, 0x4a01e97174af2c67, 0x4850a4eba14cf4ba, 0xc62aa08c39bca058,
-          0x8ee7ee53db347f89, 0x97820ddd2cc168d1, 0x65fd6510cd36b5a6, 0x41ae3f74c3c37929, 0xc662a2016d108bc2,
-          0x0363c3c31bd1afc6, 0xf6fcae1148cce56e, 0x236e313daeec6e4a, 0x1a614850185e7338, 0x1b746f0298c1f86b,
-          0x78016da80e27a26c, 0x03c5d70145686163, 0x9ef2e88bc4ba3fe7, 0x9e6d111c887d027e, 0xd42d81b497846d5c,
-          0x41cc4d4bd1eb8546, 0x7465b4148548bc20, 0x02426b11be0a43d1, 0xbcfb86a1253284df, 0x328c823e99d65eb8,
-          0x2366345c2295d1e3, 0x794c4a6c34cd58d5, 0x1aedab947542c22a, 0x068cf467d9e5795a, 0xbb61d4894d18f441,
-          0xbe63437d70f584c4, 0xd51313631454262e, 0xbc0dc5b7d16c6b72, 0x5c9d3f2ddaa70c94, 0x365d65a8daa3e31f,
-          0x8650c4911e93f2d1, 0x61368024cd966526, 0x6b94fb064cd9786e, 0x147d3baf4eb6b1c6, 0xb53b01b3438844e9,
-          0x6814d9061cb267d7, 0xad0020caf47be6ae, 0x8331bfef638471b9, 0x4b23dc5851bdbdc8, 0x9c738f1a5b3d000e,
-          0xb843abde0efa5ec0, 0x9c971b44c7811244, 0x1b15837545c33b68, 0x4d71ffc4e2c597f3, 0x053e37f8b85cd368,
-          0x34728336f3262fff, 0x1f6332b63af6b7f6, 0xd5dba9ba32c02091, 0x549ad3199df3199f, 0x1b456330bf0e0806,
-          0xc0ae84b6446ddcbb, 0xa9e3e70f696d1faa, 0xa262b61969b7d80d, 0xf69de7b23a642efd, 0x6663d934ed6dd96c,
-          0xb5da72414cb87f5d, 0xd0a6e2cb55555dc7, 0xf0efa28fdadbf5ec, 0xec52c9fede5fe0fc, 0xeabb3ad05dacb78c,
-          0xdd796ad8d66e7cdd, 0xd17aef2acb4eb35a, 0xddcdf353ea696177, 0xc61d7e8e18b3da4e, 0x315747cbf20b1ca3,
-          0xac1626f5cf1b6ed5, 0x6b04f3071a79aa5a, 0x3bdb790ae9fc495e, 0x3c9fbb7597817551, 0x1565a387e9535358,
-          0xd10f6dd9a09ef274, 0xee058ad65c737c0a, 0xf97289d136648117, 0x7a0de61b0c07ea5d, 0x2a6d6594c2e157d7,
-          0x9c4275f2e52639fd, 0x6f43f1e7ec4ba19f, 0xd0abaa489afdb511, 0x09f4752624355784, 0x83a7922a9ec94e36,
-          0x1a9734cf1b282247, 0x2b486310c2c83fd3, 0x8aa9d580ab1c4b55, 0x71c05425fbcb1287, 0x493bb4f3042eda55,
-          0x91d2c708a914014d, 0xc73cf2fd2f395449, 0xdabb1164fe36d6a7, 0xfd2112f88edd19d5, 0x0834d6fe3992492d,
-          0x9ac5a87706723bac, 0xa070daf52fd90ec5, 0xa01126fdd1164a7e, 0x96ab7fa8a658c4f9, 0x9dc4da20cd9bf85c,
-          0x570e67769662f57b, 0x6b08edff2ff8bcfe, 0xc597d7c39692494c, 0x4d52691242a3cc71, 0x48246a6ca63e1dab,
-          0x772e815964681103, 0x31a3a107f1ea40e0, 0x41452c0c29ed372b, 0x32bed0f39113957e, 0x3d7b82df89fe8dcc,
-          0xc48927e3a82facfa, 0x94751897b56e918c, 0xee5c1e77f466964b, 0xc2d7f631114154fd, 0x0b4edacb91f4c710,
-          0xb8e8932fa2d3d649, 0x551cc5b5e6aa94bb, 0x628f147fd9d7a854, 0x2bb0d5f304a7e06d, 0xce35cef58b7f756d,
-          0x52df39d75c797a80, 0x98d06bc729aa7c81, 0x029f32f77657ff41, 0x343990731f956286, 0x45cbc97e0db6df27,
-          0xa682215c672765a4, 0x04e6931bb6e447d4, 0x80947c6a76c09450, 0xd88e9d608ef78c50, 0x195d149fbb3c25f2,
-          0x21e97f0a454f6723, 0x058b65416e463fd9, 0x4b8aafb3510f3cf0, 0x5a838b307e14b2e0, 0xa24a400f12977086,
-          0xf45a7f4225cf5971, 0x5489b7f0e0e0e3d2, 0xa4fdb4b92289e57e, 0x25fdd1a52fa7d1a2, 0xc444a43bd98bd728,
-          0xfcaee18abfa585a7, 0x74c4c1c6e136a058, 0xd93894faa86d838b, 0xc6eb56d295f8e7f3, 0xdd85329f20e76450,
-          0xbddd47535a1410a3, 0x6b01c2d9fb328b6a, 0xbf355138ea382fa8, 0x72e5f965acfc0c7c, 0x01ec7ba18167d947,
-          0xbd6f99248a1abc32, 0x93bdfcdc0abf9896, 0xac9fc087a52e48c6, 0x06db5154e1d91c4f, 0xfff0aa5acc5a077f,
-          0x60e6485f3cc66bc1, 0x96c3335d3d06cde1, 0x132735b8494e591e, 0xa6f945413c767e30, 0x1f5db400e4a30f2c,
-          0xc52bbce05de9b43d, 0x8ea6c4a1ac48e404, 0x8b33efbd376deebb, 0xdd9cdc5af1305397, 0x77ce70d5e0573e86,
-          0x2788bcd18aabaaa7, 0x1f677f448140f6a2, 0x37a9651fa3c3b2b7, 0xd2f384623926635d, 0xb449a85c1aee659a,
-          0xca08e224b538c9ee, 0x9b3d42d30967a0b5, 0xa914fcc136aa4f4b, 0x9ceb373e559f97b8, 0x309f24f380b77512,
-          0x63f8e273109e4e80, 0x151188e3aaba2823, 0x811db6a5323464f0, 0xe1c99c2c3509d222, 0x48b64dbccc5ec354,
-          0x576f1b36a1d69be4, 0xf2e8ee9b06ea216c, 0x2960dfd927138a06, 0xa9ee63b1414947d4, 0x2b9c58af16e3ef1d,
-          0x783f0759421b1bcf, 0xfbe834e30ca2e095, 0xc0f5bd12fae00686, 0xd5c48dfcc4991b3c, 0x16ae00adf9fc2d53,
-          0xaa38221be2cade6b, 0xf60d7df6c79f9582, 0xa85e14a82457c5d6, 0x5c916998fc327abd, 0xe7f1072d170f612e,
-          0xf338c9334f91a032, 0xc5108fa01b6846aa, 0x14c404a81ca17bdb, 0x104a6ba7178b2c44, 0x2640b245af1c5c48,
-          0x6026140e2a254128, 0x1a16578e58db2617, 0x923c329e519df66a, 0x381e0f6340948e0c, 0x949359f1386f3ca8,
-          0xfb83ab90a2e49933, 0x242479674b48d547, 0x64fa33e7d5f3c5ce, 0x672eaa17b3172283, 0x76d3477ffcea1fd8,
-          0x4af34445c335b96a, 0x4acc58501ad34a83, 0x1fe05882ec7f49c6, 0x766227b9d8e790ce, 0x156bcdfa86f4d8d6,
-          0xb309df741367957e, 0x26daa4b9ade06596, 0x64eaf67b395a04b9, 0xa8959796494b22af, 0x328d1371e64e9af2,
-          0xcc45f5429985c9a0, 0x56888f076828f197, 0xe7396038baa409c3, 0x027477be35036f01, 0xf2e10cce8cfcd55c,
-          0x44bd241e4e2339c1, 0x6afeebba7e2b29da, 0x74b712be2239aa7c, 0xeac2333ffb210b07, 0x9b7cef12f9508885,
-          0x02be6a418b8fee82, 0x1c5b135a256e5b5a, 0xf3ee4b36f4f38958, 0xcba765ce514e43a4, 0x7e679ef5740e78f0,
-          0xeaed05e65fb2251a, 0x7419438e5e9cef70, 0xdb2dd3f975952886, 0xe9be0ed3bcf25f5b, 0x9fceb9097555b875,
-          0x4005a1a7454bec49, 0xf15f32121e1c841c, 0x04c3050c18eec42c, 0x672efe5d4e9ccd0f, 0x1bb5d5b03b907d75,
-          0x7094ea71ab7f19bd, 0x7a21b85f60322a4c, 0xad42ac80862a622e, 0x58d270c44c085698, 0x8e3c5c0ae812737d,
-          0xd1ba5e111264f526, 0x7eab2349415a769f, 0xaa41ddef10478764, 0x91f9dabf6410c33e, 0xc36758297cf9a70a,
-          0x08421bac059140bc, 0x8eb3c8c4cb8e62d5, 0xcee575b5fd753c1f, 0x84afff776982b583, 0x12b7f772cd0d5e91,
-          0x147fb5ce97bf293b, 0x26a88463aefc17c4, 0x35c9af6ebebc8a33, 0x5255405a92ba8cbf, 0x5c7a24d202ab2946,
-          0x84d8a74cbbfea497, 0x61da6bfdda4de148, 0xd5d4d97de5a13c45, 0x4a40494ca488b064, 0x75bdd37dd215a2ba,
-          0xda6db3109a994e20, 0x978a49505429c6f9, 0xaf7e47315406120c, 0x0a2c94caa0239244, 0xee878da04a9b624f,
-          0x4c5a4c8cfe400954, 0xf28a42b2842032a9, 0x08d2adf8cca6f414, 0xa09910827970621e, 0x13ad24217911a2ca,
-          0xc8046f1bff92f50c, 0x41372850d878d422, 0x9312b2fcb0779085, 0xe4377387595333f7, 0x90978fc3d265b6f7,
-          0xa9f99bad994ee9ba, 0xd628fa4b2aa0c831, 0x3db5688e8200399d, 0x0a0e292b72d0d44f, 0x36a83ef1691add09,
-          0x5bef4352424e3687, 0x07f5b5ecdc878aca, 0xe6e94013665f4a2f, 0xcf9850f922c72998, 0x3bcaa68bb7a25add,
-          0x844bbc50cc12bb89, 0xd682bf114c864ed1, 0x6db840b33349e145, 0xdddbec15f91b26d1, 0xe42f61b01d869406,
-          0x55ae534f09b29e9e, 0xee3a8f00651498a1, 0xdad353347a8dd1a6, 0x3d777959d153f95a, 0x8eb8617b32892db9,
-          0x54a31be0765991db, 0x3c254d4454ce86f6, 0x494aa4174580d7af, 0x88302450385a52b5, 0xc9a645d811432c9c,
-          0x42d7910a305a6d52, 0x6600d9115dc96176, 0x0ea044c6ea636c96, 0xfe87b3629d1a6904, 0xd0cb1fd370512091,
-          0x4fc48f817ca01906, 0xa4efa4bf239f51b9, 0xc8a0aa69fd317942, 0x3b4d6505aac183f7, 0xea08c9d111a8b701,
-          0xad17680ac3888970, 0xa71e7eff852575a1, 0x0a18c8f196fc9410, 0xc9bb760dd5cc9816, 0x99690ec9aabe8b77,
-          0x0a033980f8efab66, 0x99fd6bfaa0b6a7e8, 0x459e2d4ba7cd228c, 0x8d97d725b2384b70, 0x9e7e71d5fa777937,
-          0x1021a5c99402b199, 0x04ba5e06270bb3da, 0x26ea2ae5106ac279, 0xb440814baa922761, 0x13a922f0d56cb6d0,
-          0x90d4c2919e5c93d5, 0xe2acf8f2a82b51ac, 0x8993844555ab8f79, 0x366f127a2aaf5e57, 0xa3f6ae17469f3bb5,
-          0xfd1adce6228f0b64, 0xaf6039c690b18dee, 0x9b58a6b0f7bb5d07, 0xb41f9255af015415, 0xf8025b5ed7f4be08,
-          0xd2676e1ebd747055, 0xf8ac4ee9b43294b9, 0x81c5234f7715edb6, 0xba18118b9a12736b, 0x8d079b4feb5cd964,
-          0x7134e2f4769bad81, 0x280b95d4b2dadab7, 0x395084323629d26c, 0xc2367a094e181c96, 0x87f514a79a7022c5,
-          0x9301507be307efe0, 0x7d391532d18d8071, 0x1c7827503a0ed03f, 0xc6da90e2d4fb8c46, 0x982aa401487c3782,
-          0xae3bc984f709b5e2, 0xe8505d56bf335398, 0x49eb0b7d37860079, 0xde17fc634fd8f6a2, 0x7610b5e37570d6d0,
-          0x75d911d9c92f5421, 0x40d318f0d7dca0d6, 0x48b1c6c66fa22066, 0xfaa53ffcc45f274b, 0x195ec795678a65ac,
-          0x9b670b99399e80f5, 0x34d457671264ad60, 0x3dcb718aea7e98d5, 0x231bdf27b710971a, 0x7e5be1b1a97c5099,
-          0xe937f0b6874c08cf, 0x32e07cbef1aaa0dd, 0x0cb87506d916b947, 0xc1042309b208b455, 0xc343a65e86a05ec9,
-          0xe2fd8bb306ab7636, 0xf520ed3ce7eff6fc, 0x4c25cf3e5dd64179, 0x962e2671d9a2ba93, 0xd3b21bc1b964a9c4,
-          0x113f4a73fbad3228, 0xa96d052e9df7427b, 0x28302651f2588bba, 0x91a7eceabff5d306, 0x9389cfa091c7d886,
-          0xcf1adb5630ab80ab, 0x3a71ed3014b15b03, 0xdd7f70af05049cc3, 0xc1316acaa286c568, 0xcb184fa6e0d1c5f1,
-          0x2e28c9a5f653ad46, 0x5b1c077f3c0c6319, 0x31c92cf318518370, 0x604b909d9717d67d, 0x3325d0cd543e4996,
-          0x6f7d9142fb6478ae, 0xbb4ce376d20d0744, 0x252f7a45ae416314, 0xbdd345fedd90d0cd, 0xb89d2c0cff47aefe,
-          0xe3f3047d3b11be5f, 0x00c9f30dfb8794c0, 0x82e8b086b97f0e2d, 0x3b8f0877f0e4c869, 0x097c5537f085fa8e,
-          0xaadc06878e26a835, 0x8c126de67e289647, 0x58d9f03ad6257adc, 0x624015676b6e91e3, 0x61b490e5b9f68e33,
-          0x98977c6342d2599f, 0xbda767082de6a429, 0xe436e445ed54702e, 0xe9b0f84448909a12, 0x3a1bf53e79aa6bba,
-          0x84509b5cc37d1f26, 0xf6304613051419c1, 0xa247c441f9bb17c2, 0xd4900326f9dc0057, 0xc53576883a266ec3,
-          0xecf0397b56d06082, 0x49a4b0d9062d85a9, 0xe78fea54d6d3708e, 0xe59e6d38c23d26ae, 0x24148a20a51a44a9,
-          0xdf1bf58a9225eb8d, 0xc175cc1e5c3b6bd0, 0xf0f17d1e9d972c3c, 0x9ee72270c40770c9, 0x5d360a1d60f27d00,
-          0x523ae5253abdabdd, 0x15977f13e7efc4a7, 0x781ad8b9f6b4933f, 0x9ede955bb0427c8a, 0x31215d4d4e0af04e,
-          0x2d659a4d9dc1be9b, 0xbfc3a0f3414bb012, 0xdac5845462495f27, 0xb4d93b28d233a07a, 0x0dd119d5cf55ab52,
-          0xb2ba6cf748259433, 0x4a52dae54471f9b2, 0x015e59f69ef4ebc9, 0xdd214d24887e9da0, 0x023226843d61dc48,
-          0x72a8a8cd7dbb4273, 0x5bcc34f39f0a91a7, 0xfa2608818fb879ad, 0xd3bf48aab975170b, 0x8a0cce50532f0e93,
-          0x566c21731899d67e, 0xa22bc27bb7dbc352, 0x7c7fc5c75e81a343, 0xa317ca195010e90f, 0x0b6f12988132de75,
-          0xd583e372b87c332f, 0x1f522ebcf22cb229, 0x291e3fa28f6a8262, 0xa077c73a4c8e5aa6, 0x390f1c3cb1e1ee43,
-          0x20bf4676b1490032, 0xc625b5f770867616, 0xce2316ff35881778, 0xb584748532c72f6d, 0xe303948673afb384,
-          0xa70e899defdb3bd9, 0x3b4d803e7f6b40cd, 0xcc8598a0a83840fe, 0xbf48cf87d0deb3c6, 0xa4e8cbbd7765a377,
-          0x437565713b0116f7, 0x46967a6d278effab, 0x818a04a03dd93261, 0x0393ab5765fb7136, 0x9ec32db18c2bffb0,
-          0x0fa22992389e3d85, 0xd26784419d0cff45, 0x978d0bc6c55aee7a, 0x93a0261ecd221e78, 0xe17fba84eee59c40,
-          0x8ed908072e3bb842, 0x0e76132a38b6cd13, 0xfa04699f3ede7820, 0xecd76165b278e884, 0x4589b131d7ced3b7,
-          0xa2832f4814beb050, 0x144f482e64a79a59, 0x836fb319d928219b, 0x97909e42b42b61bb, 0x05f0b44db712231a,
-          0x255187dbcf33a026, 0x5ece8590616e548f, 0x8032269ac86ecce5, 0x9eaaf261d89df638, 0xc99d9e94361332ee,
-          0x1ce598157930ea47, 0xe52e2369c2e5af6a, 0x3e81f72f11e0c00b, 0x8b5fbcf6dae3e3a2, 0xf635bfaf2e4596bf,
-          0x8531d64af87914b5, 0x948b057456c1836a, 0x21fbab7ad7153209, 0xaa36fb0c42ceb297, 0x2aa6ca6d0bc016e8,
-          0x6013c3ec8a38e7d8, 0x717f53814ecbb9cf, 0x1dabb1ed4d906bb6, 0x39d933ceb5408569, 0x75cbc65a732b66f8,
-          0x6da65958a6f732b7, 0xdcbbcc31eef67cd4, 0x52955159696352b3, 0x66cf22cb8bf761a4, 0x65421f754bf539de,
-          0xc7ddbe63de47dc1e, 0xa8c1765485b72fe2, 0x7e4ad89b703f314e, 0x92fb297b9ef3193b, 0xded141ba4e15871a,
-          0x9b271b9211491f9f, 0x96562d1d6b439ee7, 0xf8368110638ef473, 0xcbe9d5be7e070df2, 0xefa66c846a75d72f,
-          0xd27af00fcfdd58bd, 0x8be3d23aad7a496f, 0x25faf3d3c52b7e1e, 0x962627b66ceeb434, 0x66de17a433ac4303,
-          0x72f4397564d7141e, 0x09940fd24b044806, 0x4c8ccbd56dc826b6, 0x76e363c7b0ec5a43, 0xafa502c4c623b868,
-          0x40ef61a1c86710ae, 0x788959e82fe37d5a, 0x95c04bbe81a2d8c1, 0xc67938a52053465c, 0x134bd2c0c98a2369,
-          0x8e44b188b8618a44, 0x21b022305ae97430, 0xe004d00fe807f691, 0x0c659e3356021996, 0x19ed76842c68395b,
-          0x6299cb16017be39d, 0x87306121381b8679, 0x275c0f02686078cb, 0x0b5dc5894d877d67, 0x7f85d89c64258c72,
-          0x0bb2aef674d23f73, 0x302b1e6959e06ffa, 0xa8d4056e81296bd1, 0xfd9cdb7340bd705e, 0x6a4510ce970d6487,
-          0x2e98e6d961ee1bc7, 0x3349992075c8c25b, 0x773e1a8cf9fc2590, 0xdf89779c54293203, 0x8bc8f7d9153d704f,
-          0xd6b24f7bfac8338b, 0xa2c013e24a27712e, 0xc8d367e47497f2bc, 0x5791ce76921eb86d, 0x789f37bafe0453fd,
-          0xe20d26a4618bcc1d, 0x7042a1268f875017, 0x4fbff20a8cbf8035, 0x97db2a13fb8b7e49, 0x1128eba18ac0eac1,
-          0xed7b891ec16422ba, 0x8493661a846f86e9, 0xff7bd915927a7a96, 0x074f47b947181ca8, 0xf0f2193937949cb9,
-          0x6b0537f4b22307e7, 0x5d96a5229bb220fc, 0xe4e875eb9b87d329, 0x4ad4515354c31309, 0xd8f2694460cd5c04,
-          0x8d4d97125f2b86f0, 0x2ef8829582b04cfa, 0xb791f00ae494db00, 0x498b83ba3ba863ba, 0xac3c77c4914ae585,
-          0xc7d988662db9426b, 0x6ecd536d93b5eff5, 0xe2d9245a208a0266, 0xd3d67d74bc03bf1f, 0x88d81731a91030c2,
-          0x8e6b8eb85b596b65, 0x658736980234129f, 0xe83a962311cf0ca6, 0x4bdb876c7adfd314, 0xba65263482ca8c7d,
-          0xe11f230c97dab0e8, 0x481ef73d9e865cc1, 0x58b9e679ccd2bc01, 0xd96451d207d350e1, 0x56ddf858331ac52e,
-          0x08ef81f3464cac95, 0x34613eacfcb36138, 0xec9764d4425e40c2, 0xf3f69f3a61ddd06b, 0x6388589a9cb4228b,
-          0xad07ae9d05e2d36d, 0x0c7c28ec26665091, 0x6a03e6f050d144e0, 0x296bead09f66c1e5, 0xa92a6dc757ae8ff8,
-          0xc01d0020dae7a068, 0x12d542d621a02008, 0x951e1e716dbe0e0a, 0x71d287a6d2033a44, 0xd007c777e8f02b41,
-          0xf8e3efd754e8932f, 0x790346490fd05a0d, 0x3c6fb39b083ed262, 0x422941859b0b5f9a, 0x1f577361f8d189a7,
-          0xae85af5e523d0e77, 0x0dd152d7162214c5, 0x709ba3b430361ea5, 0xfa110938becf2db9, 0xb9c8b09b8fe26155,
-          0xcc4adde25af269e6, 0x39a1a57835ce1609, 0xb173e3f2ec594f01, 0xa5f81929c3aec7bc, 0xba6db906fab7c2b9,
-          0x8ba9c92caddc5c66, 0x20f4260b9434234a, 0x278f4515d7052f2a, 0x091d295671e5fac2, 0x32212d5217a602f4,
-          0x50bcd07ab698d2c4, 0xd9c8853db4c9526c, 0xe2e142ffa7aa172b, 0xd436a8e3cc0bd75a, 0xad20f3507dbdf926,
-          0xe9aef73b25c721f3, 0x5c8b66e4f8afb992, 0x4f8de648112aa75f, 0x2461fc569fdd2e09, 0x9d311e37f2f0bd70,
-          0x267f1c5bc43b7038, 0xfe85bcc174dcdbf0, 0xa95e45a5a874dee4, 0x30552b7377fbdc9c, 0x5bef140d023a4ba6,
-          0xf665a90620fe65e0, 0x2e80ab581d5b096b, 0xc5e3cf0b59996c58, 0xf9ced51e143ca358, 0xc0675dab53eb7ed8,
-          0xa90e6ef2e86c6dd2, 0x64e8d466952b6da6, 0xa6f7baa95182b50b, 0xa276e070de4fb120, 0x7ba7e58c74afb2ad,
-          0xc7b77d336defed47, 0xec4aa7835f74f1e9, 0xc2aaf874902ef42b, 0xbb1ce577ab65e83f, 0x3654998acd8d2d8e,
-          0x6172bb0e28ce4b80, 0xd37e4d736d6b0f7a, 0x8a87c6ee8618c5b5, 0xede10db32dfccb56, 0x875345829924df4e,
-          0xc7c1a7a371c4bd0d, 0xb25322f33909a6ad, 0x6f3b6b081639a0f1, 0x9b210806f9d24029, 0x2fb327d4fc2b0b12,
-          0x258a531c4af0fe65, 0xf9b4173b3cfe0688, 0x7caadec7a7e38a38, 0x32476106929268a1, 0x4cc861791bd454d9,
-          0x3b989e5b43b81eda, 0xb5d12085e0aa2c5b, 0xb6d584ff4f9026f4, 0x30c3db4372eaa395, 0xd04dbddf6d20add4,
-          0x7fc8c5574fe569c3, 0xa4143f5951cefb09, 0xa932ae18540d2b75, 0x90cfab823692dbe1, 0x1128df1c44179dad,
-          0xf56dc78b6ffcdda0, 0xcce8a7fd6ae2ccaf, 0xe52b727e081b4e7e, 0xe0fb5e72204bdfa9, 0xc049d4021595cd8a,
-          0xc2ecf956f5730f4a, 0xb35595a4555cff3b, 0x6877f76fc3ea56d3, 0xa91c585afedbe9a5, 0xa957554ff2e8ebab,
-          0x7459a542393db3a2, 0xbc77ef76829447a6, 0x05a444b7d55a2d54, 0x40e9d464dd34e966, 0x9d62744e66b5b188,
-          0x21b99cee8f7d87c2, 0x4eeeb8ccf788ff14, 0x4dc2baa16e2cdde6, 0x1fbd79e66d77c858, 0xdfdcd2b237d6b885,
-          0xe56f0b68bb3fed8a, 0x1ccbc303310d416c, 0xfa3d5ba46f09b38b, 0x508d37a06dddc6a6, 0xe7763df6ec606b68,
-          0xd4036e23f3ad7675, 0x1545864c015cd12d, 0x121f35e583e1dae6, 0x6fff518fbffbefe7, 0xda61c61cdfbb66c6,
-          0x0d0140d2ee6ddb2a, 0x6a2851366b652c13, 0x148cad9a03d9355b, 0x1a56b1373312d65e, 0xee0b275b84c1db58,
-          0xcd9474d5750efa4f, 0xe0ad7e4338fd5bad, 0xaa2e21f7d095c0bd, 0x8081fa3998c4f72a, 0x9f61b6cabe1df95e,
-          0x97c4ea727a53607f, 0x442b66d4ea72fdf7, 0x5a045a2e30b475a1, 0x3991b9a3099d1e28, 0x57cc508b4a98ecc5,
-          0x3d23d5ce48b5f3a3, 0x2f2eb36767dc3337, 0xc2c94c9ce6aa4ff3, 0x03937902f1d305a2, 0xc879ceb153d7c8a7,
-          0xe5d41825d3b9a452, 0x11b4d1f5e03e2a71, 0x71d0692edfa88b11, 0x542ab3648b2c77ad, 0xeb59dbd6249fe9d1,
-          0x0438f0d6ec424f52, 0xc4c5b97010447294, 0x7b31b8d03cbc4d5f, 0x03fa2f865d32ba80, 0x1833ca5f94c440ed,
-          0x5b8b5095b119f78b, 0x665a84e83a074c52, 0xe91a090db30a7864, 0xd9b2a3cadc9a57c6, 0x71e5a80aa11e65be,
-          0x076adbb62d7834be, 0x18c05ce3c3dd2073, 0x92eb756fcc5158fc, 0x41d42eecfd5963fe, 0xb299bdd0e4f91139,
-          0x9cc982fe4fc913f7, 0xafadf2c3cc630cf3, 0x5f71ff881088eae1, 0x749d7258249713e4, 0x482ee8abb6c7a34c,
-          0xda0928082c8fb51b, 0xc25e7fe71e1859cd, 0x1de5aa1db7a83b9d, 0xdd24f757840d7886, 0x6c43a35cc7836b5a,
-          0xa5f1790136afc2a4, 0x74a9d2fad8be0be5, 0x2da192921d26c1d2, 0x89b982b71b6074ec, 0x806283791b0f6428,
-          0xe539b82275588d3c, 0x6fb6877d17f5b4cb, 0xcd3188ed5770bb27, 0x17df18a5e091eb4d, 0xc89b2c8e19018944,
-          0xfdb8276c651c1404, 0x53048354845d62f9, 0xbb9530e72fdbec9c, 0x835d72fcecf504ce, 0x98ef9d9faa6babfa,
-          0x6cff0ca7e2f8f652, 0xf52f3eac5c663784, 0xefa732942b2a52d7, 0x813e41d34739a286, 0x8701284cbb1bd976,
-          0xd7cc0a77d45d47f1, 0xec102e68158ba730, 0x2dc8922bce6ddd2a, 0x857f9c42b15a46d2, 0xdadb8259cb973d40,
-          0x74aab3a81b4d96c5, 0x488f4a376d3a3371, 0xf39a91be1d98a83e, 0x04631cc885fbcba5, 0xcbec1f39298464e6,
-          0x4af1a21bc3676cd8, 0xc3ec451607e0f4e1, 0x7f827a75897af6dd, 0xc3b275dc1381595e, 0xa533a72cc6dd2947,
-          0x720535495a1744a6, 0x5679417a04da2455, 0x2dba99549049029e, 0xb05029c27b54a600, 0x4e760f8bd44b9117,
-          0x41ecedcf81d746c4, 0x163eb15c4fc644dd, 0x322528aa1588a1fc, 0x1b1fd8d9bfa5555a, 0x3c333c4d9bc8530c,
-          0x3d09195e5b0a3917, 0x3117ecce1bcdf93e, 0x77cb42c6aed3b1af, 0xf7b8e127645edcbf, 0xc765b52a8a31da37,
-          0x4f2eec7131bb6198, 0x1dc98473590ecfe5, 0x5810d1ae53a9b301, 0x2f021486b759a65d, 0x8bb89884387bd684,
-          0x0848152d5f626878, 0x3fabb8f7581e5f93, 0x04943cb4b7472d3b, 0xa4b35b7cff87e047, 0x1bcb17228d27f10d,
-          0x68aa7b1962b4dc09, 0xd8e78346df578ea0, 0xec0788064119899e, 0xa991b6d47225a2c6, 0x393ae9a948cde501,
-          0x0c4d5279b6247447, 0xdbdb4de43ab3dcda, 0x4a5b4fcf6b1b0270, 0xff7377fca2cb7c6d, 0xd96ab723a4308d44,
-          0x748f475cb4b02bb9, 0xbadcd0cf60f0df17, 0x60bebf274cc06a29, 0xee406ce3817e47ef, 0x9afed15796d177d0,
-          0x32295bc89ad1a2d8, 0xb0a9efd00636dea7, 0xe1fdfe0b26cb2dee, 0x9a22d88b689c4174, 0xacbe8719eebbdbcf,
-          0x7815412d2e5bc99d, 0x1754086c921fa6bb, 0x6618b5cf153cef8e, 0xf7ec6c23a10d9562, 0xa9d33677772d758b,
-          0xfcfc2ef20b48960f, 0x771b9459983e1ac6, 0x9fcd932b98ebae30, 0x31fc9ef9b087a9e5, 0x5dffc8894faa7b48,
-          0x03b208746bb03bf9, 0xd35d6400b39e83cb, 0x0d8cdd829d2cd615, 0x4c171e946de53d59, 0x0782a850c0afda9b,
-          0xcc643a3e9f40bb08, 0xe5d4d1fff08b90f8, 0xfb8acf4e6b868768, 0x8b064df36e6447b8, 0x612ef97eda03aebf,
-          0x7231fbb95ccfb1ea, 0xdcbcd1cd2cc4f55c, 0x58c6fb8d7feebaae, 0x6faad9b53dc467ed, 0xfe950f2d1e9a505a,
-          0x0a831e4c9068b78a, 0x364c0210d793fe20, 0xf96edb645db43533, 0xab3dea94a6b606bc, 0x4262e15bfb53fb63,
-          0xcd145259a2af2ddd, 0x13fa3db8fc2a064a, 0xb697c74b0e7fd21c, 0x7b904d71f0a92313, 0xefe047897d282e91,
-          0xef819f61e8bace02, 0x525b718c7feecdf5, 0x1228fa7a2d112707, 0x5a34680fe791d1f0, 0x0dbac85caedb0b0f,
-          0xb85ea9de70432c53, 0x05b68b6bad38ec1f, 0x79687ffa8fa6eb7a, 0x64a7420cd3691ffb, 0xf85c724f977aae23,
-          0xee2fdd56bcc258c2, 0x453664c10ee1f7a9, 0x82bf42ebc951b0e4, 0xa755317a6e3d21da, 0xa7f5346077315064,
-          0xb4904620ac63908a, 0x3a133073c25ce624, 0x50a65269f6c08e04, 0x07e9ef0341da8291, 0x9f325966d4b2010b,
-          0x6799267be9951192, 0xac85f15fdcd32a38, 0xaa76004e61903bcd, 0x34bd3c8b16ca5e06, 0x49dca2c02edd3b4c,
-          0xd6104a9edf927d15, 0x46749f46bab6dcca, 0xbaab2db1fad33cb4, 0x7c319a7d0f7cb534, 0x2bfb28e3462639f5,
-          0x235a4aa4dfe9f4e3, 0x47db16bfff622edf, 0x2f63fffa339c5a17, 0xbd996c12cf783b96, 0x3ca9a4c6a11b037b,
-          0x4ac14c3d0df4e893, 0xabf240bba9c221dc, 0x50d02d5988c45611, 0x79729ff5d1e76e82, 0x1fdd14a5c709f515,
-          0x253b300cde197bf7, 0x8fc9f09810f43ea9, 0xc48435a615cc450e, 0xdd38cfaf304b4556, 0x24f2deb69af3ec8f,
-          0x1a9fc54b2c0412cf, 0x3680cf691caa6425, 0x73a7aca2a88a1e95, 0xf1a4b4b4d44ec292, 0xcd48d436d179fe13,
-          0x95c8cf65f8c7a7d5, 0xdfd77ba4553cd883, 0x5e10696c3304dd9e, 0xbd55c48d676cc053, 0xb5afea558a89b98a,
-          0xf269a91bb42c71c6, 0x57dadcf46f1de632, 0x29e3420943d0a94f, 0xabc6a22623c5c4b6, 0xa881a84b7101d2cf,
-          0x1ae188f3d367d475, 0xa44fc22fa49f8016, 0x59644431c4457400, 0xd3fa6c94f6c05a8a, 0x941531cd3f30903e,
-          0xda2fc1053c12bf59, 0xa37033dcc3e1b088, 0x049e741ab2813de6, 0xfdec6d2715fdf35b, 0xab5cd91ce1639b42,
-          0xd39a5de25a407713, 0x436fe950f66e084f, 0x06531b217babb496, 0x59efd23d95e66de6, 0x64a979a701415e16,
-          0x82f230b7ac349174, 0x88505ded7051308c, 0x90a8a0807c5c7fc5, 0x12a0ea2aa44036ca, 0x22e7f554fd71fdd2,
-          0x7244ddcd8dee3158, 0xcf92fbb9c7bd31ef, 0xee6789bdb88f458d, 0xf289552cb1b87dcd, 0x22cf723e82aa8e25,
-          0x3ebcada40646ddbf, 0x3cdd0a954e09d9d1, 0xdb4bf5caf659cec2, 0x790bc86e909d3468, 0xb94aa139c3f377b3,
-          0x1031046f609ed727, 0x71f7b66b87ca4a6e, 0x60bb4b4d9138f83a, 0xf2d16d65e533d136, 0xed570e0e06d34652,
-          0xdb910d4045a61817, 0xa968ffd2721fdb04, 0x4b357c6db8488351, 0x91c70a1b4859c99d, 0x6cec88e0ffd2bbb9,
-          0x503fc6e38d8f28c4, 0xdd1cdc44cb501cf0, 0x063e6f394a533d2b, 0x38aa78f612c8ad47, 0x294ac5f9c7960fdb,
-          0xfd5b786ca5a36298, 0x37c2ccdd276a7a6b, 0x8e0772f29cac15fc, 0x20f761316ed14d8c, 0xcb76b4252f06cb99,
-          0x6d959c7a069462cd, 0x49012779cab80a50, 0xad43327a5aeebb88, 0xa6ecd084a8f3b56e, 0xeb42ea663dcd595b,
-          0x4bbeb7b336354dc9, 0xf81ced017e0d2ba0, 0xb1fb362d5987b6c2, 0x2ff206005356f4f4, 0x1ce65cd1bedb705a,
-          0x77e37f159770d96f, 0xc40f358e711f6598, 0xd646b92df49ff268, 0x9d5774e7f1e478d0, 0xcb24a22865307853,
-          0x0f021e36ede4f0b0, 0x19c33e19b626f273, 0xf67c0bf9439b0938, 0xba024305995178e2, 0x08fd3b389d1eb1f7,
-          0x061a6050c4486dbb, 0x700797506daeb1a8, 0xc12ab4e0a793a9e6, 0x18795cca63b858dd, 0xa69a0a51649d7ca5,
-          0x0005e9feb2ec2b16, 0x1c877c5eac914712, 0x679ef295e48215cb, 0x1956e8585a07f4db, 0x42d6aabdb528b92d,
-          0x617430e3ea884907, 0x31a030d057e57543, 0xbe9c1a96e40b5cd0, 0x41aa7298785614cd, 0xe20fe591bf1881ea,
-          0xc952c0762de37ce6, 0xf24186cd7b443d4e, 0x1af1d5a72216af90, 0x32adce7739ec79a6, 0x514f7eeb50dec49c,
-          0x87b59247ee832a82, 0x73608bf286920ddb, 0x943fd4ccc8bc36df, 0xa1b428be5734d9da, 0x3e08cb6922893d67,
-          0x38ab06036c1ee0c0, 0x5850d93d513697d5, 0x480be7a23ccf7927, 0x0b57f38795152ae9, 0xd2c3e550a27c53d8,
-          0x83e78be24cbd9f53, 0x5c69f854e04aea96, 0x361d81868aa52a9a, 0xea91daa76f48f0b8, 0xb02ac9ef98d100e6,
-          0x1a449d3f6f4e049f, 0x07f10c8f5348aff4, 0xa523f5fed8f9149e, 0x70e6d0a259738b83, 0x05459e9d6e14fead,
-          0xbb5d4f8e4cb7b28c, 0xcb0fa5de3e6d7271, 0x57904af80850e644, 0x255778b167d6b305, 0x89109a5543675957,
-          0x3296c9274a2cfb0b, 0x7cfda936a77d1dd2, 0xcfea10a15fd47213, 0x94a5c5ef149485b6, 0x842d6991081b7ec9,
-          0x0607be148b0c4609, 0x21a4799721338dd0, 0x6ac3e5572ad573bc, 0x663356bf71ee2128, 0x1d9d073c75496e4a,
-          0x7d54c2669c3dd788, 0x33cf9c1a91085aca, 0x775cdd3b73cf97b7, 0xd16a1a9828ab2d00, 0x712add0fe28844f3,
-          0x9f14af25983e66b6, 0xd34ab4a184214cb6, 0xb50402a85df5dd91, 0x91121cd1e5b8ecbd, 0x426f3656ee214626,
-          0x1f69589992df5459, 0x3afdcb14851205a5, 0x0351956dae2fed0f, 0xcd61e467358a1213, 0xd550a12b9a318dc0,
-          0x5f44ebbc32633672, 0x2398c9a5b49035c1, 0xed955dd6a9ce25fc, 0xd5aa3c8236eb7233, 0x5d216a9b4fab1467,
-          0x5504beeaedb8cefd, 0x3f10319667fca152, 0xe44269c56916c017, 0x939830e42f57d9ee, 0x484985d999eba43e,
-          0x605fa90f389ed6fd, 0x397e59ab00e68538, 0x36203a74b6c90abf, 0x71fdce94aad58025, 0x27be7afa84ab0fa1,
-          0xdd77646832ad58a4, 0x083e23487e906e29, 0x6326b8d6a8ace838, 0x6640cb4f23d49929, 0x4b3932b5bc6daaa4,
-          0x5ebb817229be1a0a, 0x67724039066a78b4, 0xdca0f5a14aaf4ac9, 0x367d0e2eb52e62f8, 0xeb2a62c5f83013ed,
-          0x261f4a602e648bff, 0xe348c23610c7f60e, 0x7dab3e1f9ffd6cf6, 0x7b1328d4c59d07dc, 0xa102b6145d4fdded,
-          0x2c048e5af39ae3ac, 0xf790c0258a756c7e, 0x5d948ebb8ad016ed, 0x0b2aa8b9d77c2ab1, 0x8466ddc3060695d1,
-          0x97e339df8d647bce, 0xbf5fe92a3533c1bc, 0x8f8863e62493450a, 0x639c2de29d617e0a, 0x15128f7e1eecf534,
-          0x079cbdae1aa61e7f, 0x700761dafc89f3f9, 0xa8c1ec78b81e215c, 0x761e13315efd2471, 0xdd21b43c5a8066ed,
-          0x37e138648f349636, 0x36dfc75c75f7c4ee, 0xf4c6d809f23c4273, 0xbca3c39b80829bb4, 0x7c61e467d9a793c9,
-          0x22826bca347a847a, 0x11438de844cd22f0, 0x03e64ae1bfd59ef5, 0xb21bb45d612ba0ec, 0x1db5c665365f3214,
-          0x839087ef2c245f05, 0xa1c9cd855bde77bf, 0xed16577b02b1664f, 0x10a8ff312a5e4f58, 0xc2ee14a999d2b93d,
-          0x277bf8c254e3cab2, 0xbe0c4fe7117d186b, 0x21ed8c9ab93d23c0, 0x4a67f691f06531bc, 0x6332579190ed821e,
-          0xb33a613d308eda8e, 0xc1bdcac7ed36aef2, 0x5bf55eba3c7cc0ed, 0x779f81ccfb641f3c, 0xc5ec61eddfcae6ae,
-          0xf4ee505ca136b335, 0xf2a94dbb277ed7da, 0xf114a93014743a08, 0x81dd994f08d690d3, 0x196e7a61c50ac459,
-          0xc5fa6e0e78d21458, 0x56fe0d2ff81f81ab, 0xc740c3bb157b0925, 0x9174a083dc10494a, 0x213f978ec2b3e60d,
-          0x4192bdfb81ef24cf, 0x0b0e6b025718ee8b, 0xf5425d5de9ba6dc6, 0x2cb8f32e2d5f348a, 0x25fd8fc466545efd,
-          0xfbc082d3742e1315, 0xb7a25d951eab46a5, 0x095c1778e1983699, 0x4926478f0d33b3fd, 0x69503d62f5c7ad3f,
-          0xe33b10afbe52792e, 0xa98f72ad442e9e1e, 0x6c384006e1375c28, 0x3af73be5ab5c3012, 0x140f5a5bb7e44f3d,
-          0x11bbb73ce340eeeb, 0x4c2b56a506661c29, 0x99a59f999a5fcb66, 0xc5109c752f8c014b, 0xb2200f38b6181770,
-          0xde9407f67d906586, 0x0ed0d3664f1cf337, 0xa35b1826d37941f0, 0x5da552404290d539, 0x2e3639941b0277a8,
-          0x80868fcd4d52f58e, 0xec947126b190ee65, 0xe06d46fa20ab1a1a, 0xe0e44d3589371cbc, 0xd84e6febea1dd369,
-          0xe31691c03147d251, 0x5f091486e81ad969, 0x7d16f3fd257b5621, 0x5b1eb60aa92c76d9, 0x580435fc4a0c16e9,
-          0x8ad8b1c904679bb5, 0x0ba4dec96388dd2c, 0xb668ad90c37585e4, 0x15322280a0678698, 0x061eeb64a8c68372,
-          0xc0e65e4dc04e020a, 0xf4923270da1ff937, 0x8866b1ebc1d7142c, 0x31533d151aec5447, 0x9ef1ba9303a7ef6f,
-          0xac2574dae189e341, 0x3bb8f4bc1052b729, 0x6309d3f1ce2b5dc3, 0x5458ace660048b85, 0x2b2d8cf98c30a14f,
-          0xe5a9d05e29715764, 0x8b6a6c1320bc9b94, 0x4473f3fd4d261647, 0x14f70bb4573fc1b0, 0xbcdd7a2bd21f25fd,
-          0x4fb2e7a482f50e0e, 0x9219e66299236c43, 0x36f3de939fda57de, 0xf13a53837b366a0f, 0xa9578dfd9f560a40,
-          0x2917f9b398ec2a09, 0xaa6dad220fd2a89d, 0x60bbb12f8f386986, 0x552ec53f29213cb8, 0x45a19f7b122c150d,
-          0x391953f99e55fea3, 0x16426b6a30fe045c, 0xdcdc88b50ba8fa0f, 0x30ea154b5a8aa92e, 0x81f74cce51439b06,
-          0x45d23818612c2b88, 0x905dba9a7521a5e3, 0x929a23b29190b8b0, 0x0644d54a77a1249c, 0xa7799da804a09ee2,
-          0x502a3cf4372789d1, 0xec92d3f17bac08fa, 0x17307a26bd5362cc, 0x99ab86c3628ad072, 0xa9c354c1843811cd,
-          0x95fbb1979a595ed2, 0xe698f87882ff20a3, 0x02cf2e81f3cfa6d8, 0xe779de9636dd15d9, 0x9381fe4192fba7d2,
-          0xe1ea04de38216e92, 0x05f333bda47c1a15, 0x93f136199da5d19c, 0xbbe6c5a574f1134d, 0xdd5252e9b3a1adff,
-          0x3aae31eb18c2c48a, 0x243c71850d1bff25, 0x594d560e904c051c, 0xacf259218e1506e8, 0x7f5cf6e56f8512cf,
-          0xe087e582dc8d1271, 0xfc25c2be9bf9063a, 0x70a4b2658a053dc2, 0x073f873041ec97ca, 0x9a80dec902f186d0,
-          0xde5d5e593af16aca, 0x8fab5b59227d73fc, 0x1949b4a90b12975b, 0xe4d933efcb9b3f5a, 0xf6b7f12661df308f,
-          0x62be0b81cc630af6, 0x45708939301962c7, 0xeb60aaa2965a0824, 0x4f40765266026460, 0xd503939f8c8e3e27,
-          0xf10e4e313aece66a, 0x9fb0438ba708f245, 0x85bd2bc8a31fdceb, 0xd303dca9e9cda336, 0xdd74d2e98bc1c44e,
-          0xc5f31469b97d6f09, 0x9892efe6df91c62a, 0xafabdf4205775eb4, 0x9daedc7b4a7bd5f9, 0x7a15ab695764de6e,
-          0x41b9da6535abd262, 0x4c6ec420033bc784, 0x6d8c29dcdd919799, 0x99feee8e19ddf9fb, 0xcf0b34eb50bf55af,
-          0x57e8a06237fccc5f, 0xbbfcce44e6b9e8f5, 0x0cddebf9fc9b5126, 0xae7bfc9dd701ae83, 0x080643cbe5357472,
-          0xa2c5e631cb3481f7, 0x23bb7390f86736fc, 0xf0592db571249c89, 0xdb7c565b950ed3b9, 0xff8c7774aad50f7a,
-          0xe65f108bb11a1f39, 0xeee366f8dce96f99, 0xffec41d4e9e37ef4, 0x262f56f5f042bcc2, 0x88068fb812603f52,
-          0x42373b293aac49d3, 0x0cceebbc2ea51de8, 0xeb7f27804bf5c19a, 0x96040981d54b56c8, 0x1ccf093cecaa0630,
-          0xe4fdd01d34e7bbd6, 0x812b9086b916549a, 0xec737de0d20194f6, 0x51a45f17a571d992, 0x613e3861a9b11266,
-          0x527acfe923abba90, 0xce8f60848a2dfa37, 0xc09d9d84f5d9928c, 0xdd4c5ca835c681ec, 0xe326e678d7878397,
-          0x03ac6a5b597e46ab, 0xba943a366f38c0c9, 0x99658a889d09df41, 0x0786923e48994ba6, 0x78d3f163965b498c,
-          0x1e03c63c4fc74112, 0x72a9be93cddbc68a, 0x8e16534c9f45d861, 0x7d58982a592025d0, 0x0e73da38fc5186bd,
-          0x733d664e0bcd5253, 0x74e93d69f184372c, 0xce93a9d3db9cc5da, 0x438b9a528f58b7da, 0xd1f94bec49cfa9a5,
-          0xab3cab4b6a4f0bc1, 0x66b31d9a70b49164, 0x2599a275164b760b, 0x9c61e128e763c8fc, 0xc703374df90932be,
-          0xb23b10a8244b76a1, 0x743735cb47badb40, 0x62e107aaf5997dd7, 0x4c14a19fdb871578, 0xd30b7037998178c6,
-          0xc8efa8fd2bb4a97d, 0x44a48da0a803cf36, 0xf52335ba451fe79b, 0xc1ba5110c78f30b1, 0xa84d004cfdb19214,
-          0xf17a108d802552cb, 0x00a42400b61e6790, 0xf5221c7cf56377e1, 0x795d6a0dc40d1e3f, 0x151cdd4f4ea38a8b,
-          0x4240ed7213143a4e, 0x84dbd6f96fe60221, 0x39494a2d87883d4b, 0x7157658c44385959, 0xe3bdf588599ab8b6,
-          0xa75cf4134af6b352, 0x1d5900a3b2de4d35, 0xf8e908d43594bf9b, 0x0822a8a8d0c06900, 0x482184498de7f242,
-          0x687422eab9a9cf25, 0xeb0426e1cd454682, 0xd557c21be920c5f4, 0x4646abcd5c039ad6, 0xcf39fbc74877acea,
-          0xb904dc08fafd3e60, 0xba30ccda91023ad6, 0xc15364637bb20d33, 0xf79918cdc5c51ada, 0xc707e1efae0d8f85,
-          0x89b822fd50fae958, 0x5a895b2f3fae6b18, 0xef932b5468ff600b, 0xd9a4b532d0a5b020, 0xe55af9d451758825,
-          0xa7ad7d9dbf185799, 0x75088a32ad85dfa2, 0x238241b8425902af, 0xf57a3a8a32aa502d, 0x2d9125eb55958ccb,
-          0x764d1a23dad93012, 0x741c6bde4b183b6b, 0x79988b8922f6496e, 0x182cfca9f274f7e2, 0x1e00750009efb0e7,
-          0x077244f10f8a7839, 0x03af63f7eabdba44, 0xe7e45cf1741fda3b, 0x5ac8d47b9aa7326b, 0x0711294afc656366,
-          0x6b608140afd5e985, 0x0d425dea35751c0b, 0x46af2b4313415831, 0xfacde521aeb2764a, 0x29f153485673a041,
-          0xb4987def25325fd1, 0xc638f48caac37b30, 0xcc788b375b36c4dc, 0x698bfbfd647db485, 0x40bf9005f545cde2,
-          0xc0b6223b4653cf85, 0xa3118399f8cbe269, 0xd232952293eae654, 0x9e0adc3b3a46d935, 0x1f087a2a1041a97f,
-          0x0a21f22b22dc9ae3, 0xae60ea0e46231de4, 0x4d8e4d3c407f5adc, 0xec84a783c76b817b, 0x2c718643416a2911,
-          0xa8c4d9791dd084af, 0x65566c7641988d20, 0xd05fba3e75e66871, 0x841092f1927c7c61, 0xdb3c48f3b26d7b62,
-          0xf5fba72f0287f976, 0x0a61123baa6cc742, 0x9f8e0986cfde239d, 0x8949f9d3e24790a0, 0x41a889ba95915a37,
-          0xc9303a2f69c2049f, 0x4d86679984d3fb81, 0x48422cdef55d4bdb, 0x732beae6860f0702, 0x61eefa10a32b9ef2,
-          0xf39db43adcf57bf6, 0x927545df354639aa, 0x7c6bf8bcd3c89c38, 0x969df18b0e1ddb45, 0x547701bc1fd6befa,
-          0xa68fd6dcf9cb8442, 0x46a0b6875591b15a, 0xc788fac88f4896af, 0x15cf9f48f8f91b29, 0x614a7dc5cecd1eee,
-          0x6dea5ad48933b514, 0x7d3b8c4ccddc864c, 0x7220a2e1a40fcc21, 0xf9904ff92440c24f, 0x81695a810a447ae7,
-          0x901d550f55ccd345, 0xc09588da30d9c72e, 0x5a7bbe43527324b3, 0x29938be66f08f750, 0x5c1ca194c7bda9bd,
-          0x45fe6b2860619451, 0x7ac5a8ba089dda67, 0xc67bf0f808f2bd4d, 0x82ae4f94469a3d94, 0x041568d512bb5083,
-          0x4c47c233c227d51c, 0xb3c717a552d7f1ee, 0x1562144f10ebd752, 0xc0ee844a89a788d3, 0xed1145d684237d89,
-          0x03d36738c19cede8, 0xaa646bbc9fcc2058, 0x07381d6938633859, 0x1977ecb19c45895b, 0xb802fd6c4f684208,
-          0x00a233588f9a23c5, 0x2fdcb8b4254689dc, 0x11e61ac4b370997b, 0x1ef309ddf25f76d7, 0x52c374d8bb02192d,
-          0x63ca1a896fe32d02, 0xbf80de59228754c3, 0xd477b432cd0f9c46, 0x46dd2895b74517f9, 0x22225e1716ec62e0,
-          0xd27df035cfa9cf0a, 0x8dd984273c6e799b, 0xd8a7acc64233d52e, 0xa2e6541fb537116a, 0x093b169820e7c551,
-          0xd2c7a54a78c10752, 0xd0d915431b73c49c, 0x4f3f4d7dcddda1fc, 0x684eb5031acbaa2c, 0x70d61217bfa0f088,
-          0xf88c2538da54e3cc, 0xde3b00c46a0a4b69, 0x87c9599d84babbc5, 0x8a78aaf641940ded, 0x587501a0f3eed1d5,
-          0x25542d8ad8371a9c, 0xf4324215240f98ab, 0xab83fe513fa8b16b, 0x9dae04890ba0b46a, 0x52b7f7bc7f679f5e,
-          0x50db8e62a4e7add1, 0xebc1f2b1ee1dfebf, 0x83d6a2ff13acbd89, 0x6ccb65706b037f07, 0xe565e50ce208d057,
-          0x42ae568e6a39db72, 0xce26faca28e05ad4, 0xded0878bcc153ba4, 0x27f3c8f613bbe586, 0x8853df8cf4659871,
-          0xa24f95c034846792, 0x739f14edc3135544, 0x8ae0469cbece9922, 0xcc66072a0fe5c679, 0x8521c84b8ea864e7,
-          0xb178076db89573a2, 0xe6830ef2dc7285d9, 0x5a1c0063580740bc, 0x4e844d09a401c38b, 0xe7a85c573491b510,
-          0x8fff2ad66d72ab0d, 0xeb809c2a27469c4c, 0x3be742c19bbf1f7b, 0x2efd3e6d0dab6f4b, 0xbd2cb636fb3a9062,
-          0xfc5003f86812a356, 0x754d76f8e6da884a, 0x8300992ce0d1701e, 0xf6f01113bd71f6b8, 0x6126076a95a8e040,
-          0x6d6ceb11ed00744c, 0x0cc1cd5db688f7d2, 0x10fdeed12ab4aec0, 0x28dc686931fbd570, 0x86113b52e9fa4b19,
-          0xc30c822cd6a5ed8a, 0x6718f94c5c7095c9, 0x8286ae286f15ccf7, 0xbb04bd052965f59c, 0xfd5ea5c8ac51b0e3,
-          0xd0a9c55685025e94, 0xd96ad12aa49b540c, 0x159128213a1265c2, 0x8788cf89badf5dd5, 0xb86cd950c67d1cd9,
-          0x4cde7976110b9ac7, 0x5bcccfbde47e2dd1, 0xf9c4381b7b5a551d, 0xd277f4b47cf9ac67, 0x3c20043b15874a64,
-          0xd359fbf7d573a336, 0x7d4f9e381110257d, 0x9bdda091db9c1569, 0xc826f633e24f2334, 0x4610fd3abf01d2f5,
-          0x863da728faa3b2af, 0x60be0eb2aa5dbeac, 0x5bcf15c28749f2ad, 0xefe7980a64423f1b, 0xeec7f1bfeb591fc2,
-          0x16aadaa53a8199fc, 0x1784becd411cf26d, 0x2e7628074031610d, 0x917a59796f587612, 0xcef74497238fc7c6,
-          0x32bfd5d90c7f6bf6, 0x21a87eab7796a430, 0x3b43106732e3731e, 0xa59dc1e46366b2a8, 0xcfbaba7c1ace89f1,
-          0x4baabaae71ff80ef, 0x5ae6d11efb909b8a, 0xabaafcfef8d358c4, 0xa197cc141b42ad9c, 0xee5b4cfa68cbec29,
-          0x0447872534a379d5, 0x40c57fd62b199d75, 0xc24b7e3ffa405d9e, 0xfa4a45a32edd41cf, 0x9a77a0b6eb2ce763,
-          0x13574da9e284e757, 0x7903eb4c95bf1ba0, 0xbf64fb5fbd7df6d6, 0x45f79ba63dbd7056, 0x6104476958457aa2,
-          0x37e1ff9f724dfadc, 0x4777db6ddf0e6c38, 0x8e7f86dd0a38837e, 0x78c105f04156d281, 0xa92cc97267c77142,
-          0x172adfe309630dcc, 0x29d4b720aee41552, 0x1e23d635f22fff15, 0x58114856b675af41, 0x327f88242b1a3d46,
-          0x5534b99d09861059, 0xb9e80dfbf7ee0dd9, 0x6f27fe5e65722086, 0x05997ed7ef1ed164, 0xd95a29be207953d1,
-          0xc7737f95fdcbc1b2, 0xadb0e2ebb05c710a, 0x920c41902a50a3d5, 0x53f050acbec82bdd, 0x135c9f0227a57767,
-          0xb8f9f22a75ebc551, 0xcb8b26afb581abe1, 0xd7db508d9a305661, 0x10d99467c01ced85, 0xb9c52b32fb74b83c,
-          0x9a5de54f787c4d65, 0x5514a5dbfc87884d, 0x6a6709eb87d119ce, 0xe4fb2878bcb59da2, 0x4aa168861192acda,
-          0xc5fb03602f316024, 0x04b1e3936a48ed01, 0x607426e4b1f00612, 0xe071e4899e6dc087, 0xc8fa208c89de4a13,
-          0x643940d6ea5998de, 0x156ef7e3649be5b9, 0x3a598b3a8d04a119, 0x85d2d7d6b886e9e0, 0xd63b803c2959d418,
-          0xc102130a4f48b61b, 0xba9b0ceb415542e3, 0x6ad7c55607f486ca, 0x85ca3fdf9b7465dd, 0xb0c5152d6328259b,
-          0xa9daf0faf9e80eb5, 0x3d2a16d14fb60437, 0x56e1ad0573da8e60, 0x6d056b3032f88aa9, 0xf987799ff518d48c,
-          0x67926391abdd35dd, 0x404549923ac37547, 0x73266ed1f922d256, 0x85560084e516e9e6, 0x9ac7ecd08c1a024c,
-          0x813ead76ecfb88b2, 0xe084ce70d50f35b2, 0xf58946133f9f1863, 0xf542cdd5105ed16d, 0xcaa66fc2e70bbadb,
-          0x464ef8b8c69b1893, 0x25c808007fcbe8a1, 0x785042b760adcf86, 0x99e97ad250da1ef1, 0x676dd540cd39f2ca,
-          0x1b9011e722d29942, 0x35bd90384a306b84, 0x754d1667a42e3d5a, 0xd55103790e36741b, 0x4663160613822294,
-          0x2e31ccd99b22e182, 0xe0bc92e0b2b319b5, 0x1fed56608579054f, 0x8e0485a40ed52aad, 0xb19902ea51e717b7,
-          0x86bee8f5fbee5d06, 0x8dd32c9774fa53f8, 0x06bd495ee7e45bb2, 0xac9d174100c436d7, 0x0727a82ff19e7cb7,
-          0x02e40f0a90fdeea3, 0x8851774aece02eca, 0x9a58f8154e82792b, 0x6948a593cecf300e, 0xc8cce8610d843aa0,
-          0x333503067fc1fc22, 0x23efdd82ce1643de, 0xc5c5468a579f334a, 0x6c2232b9de33023a, 0xbdaf29fc197c092b,
-          0xa014234b810f6520, 0x28a17cbfc8bebb02, 0xb11a582725bda6a5, 0x3b5952bc55ad6015, 0x5e107176eee2947b,
-          0x72c46591fb5e46b6, 0xec16be3d49b06035, 0x1802908063eea58b, 0x92bdcd015c750ad7, 0x2a0eb86166d30789,
-          0x890e736011c77b0a, 0x43be8eb8b2fb2cc5, 0x54cd8c25a5517e57, 0x256f3c040aa1a008, 0xf358a5f6ec37516c,
-          0x9392bcec1066eabc, 0x93270eec0f16a146, 0xe8610f5ce4a66321, 0x09c36f70fe7782e5, 0x8469d12d84527eef,
-          0x38e28c3338f208a3, 0x4802aa46ba4abdd8, 0xb437c8c836b92e00, 0x2c5675850b3e834d, 0xb0cddc44e5bc4da5,
-          0x340cb456787e176d, 0x0b09e8c475e287c2, 0x04f1b4984fdd54a6, 0x6359b8a99216a320, 0xa567cba53ef29d45,
-          0x8889c46d59f0d845, 0x642e71427e1f51bc, 0xdeaa674492e2d474, 0xe78895b5481de68d, 0xe858d7c0534a397e,
-          0xd249dce58af37c32, 0xc994df508e8afce9, 0xd1ed2d72304a2e38, 0xfb62db72169df1da, 0x93752df73c9cd824,
-          0xc924ef8b66b3addf, 0xd7681bda5af03853, 0xfddb6b6667072729, 0x53ec0dce99e3447c, 0x8ab4b45afc45eaf9,
-          0x719cb03fe13e8d95, 0x76be198be20f96bc, 0x6d411145b25c5cad, 0xfb4196221d9779a6, 0x135c56ffbe543263,
-          0x3e115bd7d13a65f4, 0x4a230cc6af435c79, 0xac26907240274abf, 0x9887bea954bd1d53, 0x2573984b51f45546,
-          0x225739dfb608f3e1, 0x03a18c6e5832cc84, 0x30dc4fb4bc7db4e3, 0xed892c7f57d9cd29, 0xdcfd05612edc8cda,
-          0x0649c0ec7f668a93, 0x6f6aca4ab94473c0, 0xb5dba39aba8dc3a1, 0xc47ed88426c528c4, 0x581f3cf224aba141,
-          0xeb1db6d97e2401fb, 0x78e0ea473fd5f461, 0xb778f05a08cfd13f, 0xbe724436d53e45bf, 0xc90df5d789141989,
-          0xf901ab98b26fd13e, 0xaa3118561cca3b5f, 0x9e44b9f91f1c9e81, 0xabd3259bdac60ddf, 0xd82962feafb963e5,
-          0x2ed7a5a0f7a135b9, 0x3826a4741a0e1052, 0x9b992c018570ad25, 0x78ce15a2dd22ba2a, 0x0fd2c275a31dcd73,
-          0x8b3252dfc5e3495c, 0xd334abda48077626, 0x8c078232e5d13b57, 0x8602ab7d21a0800e, 0xbb4226ce63e238ee,
-          0x5fb6bd996fafeadf, 0xc3b605a11203938d, 0xf0ee924701b96a36, 0x498d066e0689595f, 0x9045d1990e98f721,
-          0xd1076e76aceead04, 0x1b681748cd472a25, 0x03959b26b34e1f9f, 0x88d363dcef6f0e8f, 0xcc89d5da463a2768,
-          0x23c3c093d147dabb, 0x4c0ff3fccd40f08c, 0x78b3691795a561c8, 0x92dbe9a3eac96893, 0x19b2411a52889e97,
-          0xb0a4e5694d4f8d5e, 0xb5327558385d740e, 0xa978e06bb2f1b45d, 0x5651757fc3174f42, 0x1e84f917a3c7dd02,
-          0x8f9450c97492233a, 0xc8d0100330269a10, 0x90561b344855f0a1, 0xd67a6ca86011045b, 0x643368e874004729,
-          0xab55720ca00c786b, 0x33402cebcc2c0d23, 0x8714298bb4eae593, 0xdbdd9684c4641fb8, 0x5340670e3688547d,
-          0x776555b069c836a3, 0x616e009e6820998d, 0xca5c4cd0d88a83e4, 0x3946298e62c310d1, 0x47f4b15c6a06fecb,
-          0xfb1484ea7380ceca, 0x05248feb9fa9c7e7, 0xfbe01307402466b5, 0xb76b387c401d111c, 0xe668ed84035545d0,
-          0x1a1dfeee42342ba9, 0x9614c7773553a805, 0xa4986e985c0516f7, 0x8bd8d8c46ccfe0f6, 0x7fb42a2337b827c2,
-          0xb2f9fa61ecdbf68d, 0xaaf7837ccfe549bc, 0x0de67eedb3d6205e, 0xe7bbd99b87a59776, 0x1d1e714e43951997,
-          0x929ea3615b7c3b1e, 0xe1db424238ff3931, 0x14e95b9798653a24, 0x75b66aa07c8693a5, 0xad8c4673de31ad38,
-          0x72cb788eacac0bc0, 0xb9cdff1c994b656a, 0xc589fd51108181b3, 0xe9837ef322f64789, 0x5cf201b31abff696,
-          0xe251e77be2609244, 0x8233c2a489f5dd22, 0x501183d554b1821a, 0x95e066eef0151514, 0x7d21e2e982dae249,
-          0xb74b358095a11545, 0xa186ff90bd468754, 0xd0b8fcaf38089676, 0x1e8871a1a86b8d8a, 0x4ed81f2397a60ea5,
-          0xce35b170f833332f, 0x4b8ac9f7a5bad2b9, 0x2aa0f14d6a87f17d, 0x854077475b22546e, 0x562a1ff300ca38cb,
-          0x4121cd71ba11fcac, 0xd73c739eb5f4489f, 0xef32a4491294e80f, 0xb9738d950cf8b954, 0x4e2a4a9a92932d69,
-          0xe5e47475f87eb34a, 0xda1efa3e55414739, 0x6a19c99fdacbaa8b, 0x15e4baf0b0f1843d, 0x606e6568c725784b,
-          0x8594fe45d8368c61, 0xf411c8757327246e, 0x3bac7c1e7799d404, 0x6ee6d67319cba926, 0xc11e885f557de91a,
-          0x0706667e50cfcba9, 0xead5aa4a05ab775e, 0xf64adf59dff9ffc8, 0x2573bce4abe4d874, 0xd2203a8c6b51e938,
-          0x8be430ab75b5d9ec, 0x0b1dc032b2554abc, 0xc3d44b93c3a3e900, 0xb4da6f95eb45e194, 0x9309b4a327375181,
-          0xef8865ae79be2bc1, 0xa329af076a177747, 0xecf902b266ed6d32, 0xa6176e73c91f678e, 0x66d117ce70dc7b80,
-          0x8fa4b041dba38ad9, 0x0c4246df22be6d5a, 0xc5f82ca0b8b8b621, 0xaa08de5ad6f27ddc, 0x43334ba9b6f2b738,
-          0xf0793e3471c11a38, 0x6b95ee1c05cfd950, 0x558fedda2cd66b21, 0xe7932839e5a3c355, 0x5760b048a5f22d0e,
-          0x35b6522dbfa93c8a, 0xecd25f60f4f90d6c, 0x9f3fd67d33383df8, 0x64aa0ede53f707bd, 0xb40bb7f9f830ba6d,
-          0x7407d733ef5e053f, 0xd4cfaa22db08dd5a, 0xfeaa88f7695fd091, 0x163f8e1a91df1cc1, 0x73f81a938b291c6c,
-          0x8658e33c507f7db3, 0x0a077d5a9201cb4e, 0x6508c6d2aa2af6c6, 0x672cc9a36e889866, 0x58c948708e264095,
-          0x3403bb0de03a890c, 0x522f538cb97a092e, 0xa300ff0d85dd029f, 0x6839ce5611cf8445, 0xf03d21005ccc707c,
-          0x06af4b631ef391ed, 0xd03191f81fede383, 0xfa3a90ce9d93b6bb, 0x6ef9d5993c27afaa, 0x304f4d47c655acf1,
-          0xfbdcb65ab9a21d02, 0x94f7327f8fa25e11, 0x908a399406561b80, 0x10f63c09a178b84b, 0x78f430631f8fcc50,
-          0x8e35327e56cc0d3c, 0xbee28d501cee11dc, 0x72487dafb5ba7d0e, 0x429042aa07457349, 0x5357bf186bc3b207,
-          0x8a919f78f152d975, 0x7cc61b8914d4330e, 0x4eff863cd831fec8, 0xab2e1a79b8588031, 0x77110c0d93353577,
-          0x55a02e341b5cd823, 0x040da6c02147ebca, 0xc97ddc9fd3e8ff66, 0x30aafe5b40b99279, 0xec0181318c72aca0,
-          0x7468c8193a8b4e3d, 0x21a449a5749a19e3, 0x39a69ed5492cc49c, 0x070271b5cea39653, 0x862fa414a2d24f45,
-          0xdbb4429c59b7b58c, 0x6db73a8b656cd89a, 0x646a7d3c37cc1057, 0x113675cd693cde40, 0xb9194eefce9c8e3d,
-          0x70bcbae9c7bae155, 0xca7d54b63d6ff1b1, 0xb318afbb33816483, 0x75631c8858193176, 0x29fd4a1f8de07d84,
-          0xe7ee7ea671362d33, 0x9bc924c40cc5776b, 0x7d5f7993e8b43c33, 0x240442f771e1f332, 0xc9b5d4e28148b7a0,
-          0x58a31e773116d8d6, 0x4b4206d1de0c038c, 0xe30576591a77d77d, 0xeb4e768ba9826f2e, 0x02c1efec532eae73,
-          0xf661f9be849eda2f, 0x55e87506df8b705a, 0x54ef6e044393d7c1, 0x5d39e378a57a9e81, 0x6de35be609cf3467,
-          0x628c3e2bc8b83d1d, 0xbc6b46950f103f80, 0xa8ced515fa227bbb, 0x569cac56c8ede8b9, 0x792e51c3e7ac0cbb,
-          0x380ca4eff9958941, 0x52e02955cfaca586, 0x2d0e6d2a97331672, 0xac69a10aad346406, 0x032c6831d9ad3b0b,
-          0x1775b78dbbbd34fe, 0xf4ca950472c602a8, 0xcb0c616e068f46d1, 0xc090ea32922dd4e2, 0xf2c87e504d3adbc6,
-          0xe13ba21d1d81b8b6, 0x2035ce3809b6ac17, 0xa32cc0e54d3b7a71, 0x9ad5a3a63a581efb, 0xc0e037d5dabda446,
-          0xc7bef7535f4ee2ac, 0x17df967b733b99de, 0x1654bce53332f343, 0xb66d69bff0d7143b, 0xd21d0989c404a05f,
-          0xcbf5639250a34cec, 0x52721a57dace9d10, 0xb53f2b4e3c6d949a, 0x2e290906965f0ab5, 0xbe90669499982f89,
-          0x28f1ed61f6eb0c6a, 0xb6f132b1f16e23f2, 0x0d12b160969e6b41, 0x335ec994d5d1e579, 0x7b116d06e6d568b2,
-          0x6e9afc7cbd52e045, 0xcbc965697a74b262, 0xec3751ad2b16c667, 0x1eeba80fc1cbfedf, 0xf38742e66676dc64,
-          0x764fa31f636a16e5, 0x0ac606da11ccd28c, 0x38cdeca1b2b252d7, 0x136043b097a82300, 0xfb0b1bbac6b13b9e,
-          0xf5efe6f4c2f0c8d3, 0x746f04e8a5e3f81e, 0x29abc6a726b5ea1f, 0x1750105129110680, 0x0da488b09bf00948,
-          0xe51d8b3b7d3bcfff, 0xf8d036969dca7e72, 0xdd046906c5e3d217, 0xd09c6ec661128f0d, 0x757ee69535d46274,
-          0x01def50587817bb5, 0x2c4e6cffb1ff01fa, 0xd1a5490cce88694f, 0x8b5371221589c00e, 0x0897c2b415a312d9,
-          0x36d9600ecb109a88, 0xf9c500330a0d11f0, 0xeabc0e1a64dbf2c2, 0x774f9364d7c54216, 0xfda9e9d7475f8495,
-          0xfcba70bfa30620cb, 0xfa2a7a260043dd0b, 0x436e5a793767d724, 0xbada1a956ae2850b, 0x301632a007ec5ee4,
-          0x20abaf4edfa3823b, 0xd414d5ffaf7cffdc, 0x80f22255d9be6182, 0x1b1bf64dd8776f8d, 0x7075d0d7603faa68,
-          0x8b4eb30bbfc59146, 0x077f0d3cd57f4efc, 0xedf14b0a1cca2f44, 0x2245077c59bcc60b, 0x39e1de12b71142de,
-          0x90ae388a1cf9aa3d, 0x7976b6eec8059f4e, 0xdcd2b94d137dd000, 0x1f385681373053dc, 0x1f47604da120607d,
-          0x223ee264b69ce1ea, 0xcee575de861ff188, 0xc1dc1b01a9441715, 0x4d3f6e2d700d07e9, 0x42f88fe2dd06497b,
-          0x4ca00471b640e89b, 0x5d64e9f33bc8ff75, 0xbf480db25cf8f2f4, 0xb7df7eb778c83304, 0xf25a6972a4dfc654,
-          0xf1fb35f84d7ee683, 0x5e262f479f6eff72, 0x4555fd94626833c2, 0xe04b19d8927527f7, 0x4b3d155c1f6c7c6a,
-          0x1dc2fb4046879b54, 0xb66fbc5d112e7751, 0xce5ec58ac587522b, 0x296450885a44fc57, 0x2e04fa65e66e816c,
-          0x39fe0238f8c1702c, 0xd7671b5ed29c9fad, 0x4a9dfbf37637bb04, 0xa805db94be14e02d, 0xed25014234ea3159,
-          0x16f45c7c1e7a4a66, 0xeb4ce9fd165056d4, 0x96c079401718f2ee, 0xdd6e17e885083b7c, 0xe96bf3f595c00a18,
-          0xc7277a5c7628e4bf, 0x6ccc3fe32012d048, 0x7dafa2fc5221c9d0, 0x07ef1d44fe4a26aa, 0x522e34dcb041938d,
-          0x81494634f29e220b, 0x5c727eb3665c5566, 0x2d1513e14e1e27ae, 0x3a6135bc3679a416, 0xd9ca9d20ac171984,
-          0xf893a54cc1b7022b, 0x52591356f72adbca, 0x227d13316234a08a, 0x67341b42e5ce4a68, 0x4e8b4d16461faa2d,
-          0x090affd7393c7156, 0x6154c5fb603b51a9, 0x224dbcc5c3468635, 0xdca4a711a9e50484, 0xc24e1b8ae3b7daa3,
-          0xba922b6a11bb1d71, 0x042a9b922868e1b5, 0xcd1a8c54b07b0ce8, 0xc62d3b1836e2a278, 0x8062b4566a610964,
-          0x9420d78a5789bd6b, 0x0c69df7ccd118219, 0xb87336065b15337a, 0xe08a15a6b0c63c19, 0x153763c8b28b0ca5,
-          0xdef73d46f6f1d1cc, 0x2b261455b9222d4d, 0xa4d282b954b965a0, 0xb150a1c66d37ebd3, 0x3ef841197cbef55a,
-          0x7881eba89d49675a, 0x673e1874a5436ca1, 0xc7c8e73e40b929e4, 0xe126382e74404d51, 0x93b63b3a90fd7be5,
-          0xda09fb21cd582abd, 0xdb43eb3588a1af10, 0xe8d98489f8c8b973, 0x506cc9cfe0dcd798, 0x779bdb30dd417124,
-          0xf74e38a4a1d6a116, 0x45fd0bce70145387, 0x4554c4a896b4405f, 0xd1051f272ad78581, 0x80758eb2cbdf8cda,
-          0x384346e4dc601264, 0x9e6278421599ff38, 0x9cb05d5c70c73e2a, 0xc31c41d9a0f4b4eb, 0xe8b3741744eaa04f,
-          0x453a8a093fe4051b, 0xfd67861c82400425, 0xc869c1283e5489e8, 0x2713f612607c48d6, 0x28e959d44b04b511,
-          0x93c2b56b615e641e, 0x48951bced880abb6, 0xa0b596a1105ba314, 0x222ba8590e8e6a70, 0x796fa2ea97d9bd40,
-          0xbbd2500d03b51016, 0xf5718d5e9452018f, 0x1840275ad442004d, 0x194862eff060c28c, 0x4b2150bd881f8fc3,
-          0xca332f16f35fcc0e, 0x036c7667193dd1e0, 0xd4554e1f66d8fda3, 0x190c045d136d983a, 0xe8bda6685eb97a17,
-          0x81dcf1eec3e6fcd3, 0xbdf432691656ba54, 0x99e71ba7809d3c60, 0xe444d4c6a5a6216b, 0xcea95b40b4d64e93,
-          0xd382463f397af115, 0x19982300a102b71b, 0x0d88d167c7e1db86, 0xeb4c34fda18f114e, 0x87c91f45e09c200d,
-          0xeaa947fbd5e0f1a7, 0x3e2b4b1f9c17e58c, 0xbbeebb6cde668f06, 0xf9297b97ccd97e4c, 0x88c3e62014e45de6,
-          0xd014e45b0953c8f4, 0xc40d2991c8cfcfee, 0x25c841b6c640ac95, 0x6493de431102a76b, 0x3f94cb7bf265eec6,
-          0x383d58fea8e91e34, 0xec0cca3588827375, 0xc29b553f7eab7de6, 0x594ae0c324b33033, 0x2e20ccb7110a6418,
-          0xbb1ff73dcfc87a17, 0xb6161b8deaccc8ec, 0x6b2e080b441e89b8, 0x0263bfabcc1f1474, 0x22b16b8f36c954ee,
-          0x1f541ed8a87c8dbd, 0xa737abbe87b00411, 0xa25020484f3265d8, 0x80319437a2d46aa6, 0x1cfd6604133f3387,
-          0xad064749b64ce5c7, 0xbd61894595cb3aad, 0xe017b764b44b47cc, 0x6ad2fb95e9c61468, 0x5a0f7e5d359cca1b,
-          0xa52858009da75132, 0x83754329dddcf80c, 0x36077b16da845dce, 0x1c5668930263f896, 0xd8e272cda936b553,
-          0x09eb7605734fb6a6, 0xe53275c807869ab5, 0x3c6dd858a66aa594, 0x2540c3ee203d16d4, 0xc2820112348647ba,
-          0xc096783465679f9d, 0x1b7c06ad05fcdb22, 0xfa383200a382762e, 0x9fc35b53f9d31e01, 0x5b780fd3159642bc,
-          0x91cdac3f1c348503, 0xbb33f7ad2c44233f, 0x634bc39ce6f62eac, 0x3e876efc5971a64e, 0x739ce0c8bc39783c,
-          0x19af398e007857f4, 0xa7be28a96f74138b, 0x45ca2c37c87aab0a, 0x9e14f43469bdb01f, 0x89c153429b352018,
-          0x557991075f302969, 0x885640fc7cf97e7c, 0x1c688fd50e15ad62, 0x66bedf76e852036c, 0xd0736a6ff93536b0,
-          0xad9da4090a137d2f, 0x894580f3f53742bf, 0x1495c050921734b3, 0x64666ebbdada494a, 0x127625a8b9bc514d,
-          0x93b585c4c09aecd5, 0x2f9aae352ea824cb, 0x424ada613bd0801f, 0xd1c8a3e00e638b22, 0x363270ce359925f1,
-          0x1179ebe530fe2108, 0xff2e27e2c5151dd4, 0x80b3795ec5829c2b, 0xf3cafb410d282454, 0x71b7896b37810ef1,
-          0x9cbfb4b2c3195d8a, 0xdde094d1d3e31080, 0xfdc3cbaefcaf8bce, 0x510af2bded927aaa, 0x02e10e6f9aa9a3a6,
-          0x3cd7dd70a9a6df07, 0x45cc833cfbb0359b, 0x4d10b8255e072aea, 0x1ebaec04767066ae, 0x0fade9a35b9363d5,
-          0xf48a1500243b4b08, 0xeed9614f83d0350b, 0x5d2ef42ddbb5c259, 0x3ab054783b3ac94c, 0xb5b3b0737f4c435f,
-          0x6b0c3ae8e01790a5, 0xd07f5549ecca444c, 0xbf668c450275a287, 0x2034a63421b6f83c, 0xace6fe974a743811,
-          0x011c16d5eae5ebc6, 0xc2090a1b9d17f4a1, 0x1592dbdbda2ac617, 0x6134121de74f4986, 0xa0a99da6ed68fada,
-          0xe161277f8d73c0f4, 0xe78e3e1910969b74, 0x49e08baf923d61e1, 0xf1a83b7190079ac7, 0x586d9cd4e7e97fff,
-          0x14c7f0ce36b841b2, 0x170c92d9c0ad727b, 0x13b10faa85825f46, 0xa626ec894b14a6da, 0xf49dd98c09204790,
-          0x4c6a91e458db00eb, 0x35c2205dcbfcae45, 0xd6ae17e5fb279cb7, 0x963c88d059cc1583, 0x2cbc7e04308ce31f,
-          0xf77f61f99741c7a0, 0x2529ee49b3a62497, 0x5d297292dec757c1, 0x2cd34ac922160ca8, 0x9654a1b631c93442,
-          0x390495d894b12876, 0x86b18b04e00d2952, 0x00bf715ea2f93484, 0x003ca05c703946be, 0xbba95deb8e63632b,
-          0x6200e6f8d9b22485, 0x23d938bc2dae3e8b, 0x009d9dd0bfc3acab, 0xa308992f9bd5c6b5, 0x330b1c3b73e36fbf,
-          0x961276e541a70389, 0xe8dcaf4e51632af7, 0x7f4dc5ca342ca8a5, 0x97ac08def5b40728, 0x1998f04518b41b35,
-          0xfd60458c45d95d0b, 0x60968e497d55448b, 0x64ccf6939fa627ef, 0xf991e1c4e9e16c80, 0xc70cb00966de487f,
-          0xf5f13cedb6c147be, 0xa580c2255b336b76, 0xd30c445162bc3aa2, 0xd2a72aa79c69b6e6, 0xe6ca89d57365812b,
-          0x378d3a44444a3f06, 0xe4f8c13fc44b16ce, 0xa451ca796ea03f22, 0x10a7666899286a8f, 0x82f28e1a5ad52836,
-          0x7f46a29979834a36, 0xecc8eddc2aa9f3ac, 0x66f1b2793030d616, 0xb53263074d6ba69c, 0xc6b235c591e642d5,
-          0x4175b35769775165, 0xcb0122efa5e4ebba, 0xa472376e5e16b726, 0x04392292bb91eabc, 0x64eca194c9a1b08b,
-          0x97938480dea84e18, 0x2a944ae1dad09ca3, 0x97c7f20845e5e8cb, 0x920b5488aadd8812, 0xfb4ffcc21a9f458a,
-          0x95af8853284e66ff, 0x243e38fe4104e22e, 0xaef6eb6dc7671062, 0x1337ed323a248fe5, 0x45b6e377cb61f861,
-          0x69544ecfb3c07a33, 0xf126170ffb4cc897, 0xdd0c13e3ba931767, 0x51e3a4cae270d6b9, 0x4b2516550d807be2,
-          0x2f56e21a9c849093, 0x6a97ebd766c4a4d5, 0x7a5961dfa9b6f044, 0xb5b9c0081d4a4678, 0xe516dde3c03bc7fb,
-          0xa1946a5964c1bb02, 0xf76f1ed71320d591, 0xe3e4c51b3bcec238, 0xb94558ba45a20bbc, 0xed59705cb26d96ee,
-          0xb77e459c9ac517fc, 0x7e2bb8d5b7a35ab7, 0x8bffdd2ba93b5bb2, 0x6b25562170f7aa17, 0x44e9c34f52cf4f7c,
-          0x3da78a54d33c76ca, 0x7456ed160d6ffcb1, 0x0fb9dbc5e1d5538d, 0x8343596f1c4b303b, 0xf77e13ff33cafff0,
-          0x888c9d5fa1a6fbd1, 0x5ea3bc9d5dd03e86, 0x76547a57bbe9c330, 0xb5277188e14104a9, 0xbcf1952e848c8b5d,
-          0xdb9afdc1963cc085, 0x14d9a977d9f890a6, 0xe39cd623d3f283a1, 0x9b68e9650c899ea3, 0xb021f43fed0bd9eb,
-          0xbff6d598b9ea2aac, 0x258abe30d60fb534, 0xac0a7135583159ed, 0xbfdf6c5a50e20175, 0x9fce174407734918,
-          0x47ca353cfae92178, 0x0173b68b1f27dd93, 0x03fd5296a80e5cd8, 0xe74e96880005b550, 0x7425d44dd94bb67e,
-          0xce1373860b63a24e, 0x96d2ff293e413b71, 0x391936379b96ab5e, 0x26ef22c69a4658aa, 0x49bed5fab607ccbe,
-          0x87b27c65e6ba3313, 0x60180111a76a523d, 0x290a393fe9f00ddf, 0x6cd0207a52878b0b, 0x5b1f3e44d2eed83c,
-          0x78495f13261fe0e4, 0xa6d317ccd2ae28cd, 0xe195cfdf540c00f7, 0x65bb6c99992cd995, 0x0dc5c42637764eac,
-          0x7d95f6845caa31f6, 0x0bde1fa6b42efa0d, 0xeae3ab3e1366fbd1, 0x47fd37f36cb5b7bc, 0x67a3dac18984381b,
-          0xafd80d760b050063, 0x0b88a52d83abfd88, 0x18d08fd10feaf5a3, 0x5bae363d968b425d, 0x64a97eb4b55740cd,
-          0xcd0b8d014c755e44, 0x4c55294aeac4fbcb, 0x7afc45b637885576, 0x9b05662da493c4cd, 0x51651d6e3521d408,
-          0xeb5684ab82f3eaa5, 0xb18b607556aacf52, 0x5ca3c163e73746db, 0xc423c71ee935c7a5, 0x1357ae6548563226,
-          0x54c6242e414883c1, 0x18ac036847ad4536, 0xcd0582609bbdb9ef, 0x360ee744a4418c67, 0xf38aa958295da9e9,
-          0xaae5c1fcaddad04f, 0xa064d151136d5614, 0x2beee2b032c75b97, 0xe5effff1168a7645, 0xa5a5004a93938b5c,
-          0x415cec3be6727d94, 0x9b1693cf55436132, 0x1700285e19817ca7, 0xf39ce9bef4a956ce, 0x775d965d2f229e5a,
-          0x4c609798ce79edbe, 0xd899566f197da610, 0x3f4aba49b1a214a4, 0xb391670be46d8ca2, 0x9348f0f9ebe0b84b,
-          0xea2351c83999a7b7, 0xec363307dd588656, 0x48511047d0bb3175, 0xab6e53e1b0e18c7a, 0x676b5daf6a6a1d3a,
-          0xbcafc5b324a509dc, 0xfad4e96e65bbb757, 0x1b820cfcd40ff387, 0x09b89008e89f0aae, 0x484ac30a20f3404d,
-          0xa482d7bbb95f924f, 0xa0dae3d67353f813, 0xbc529c213b37320f, 0x74e389384c3af528, 0xc149a7416a8a9ef6,
-          0xd54de440ec848271, 0x8121379def22becf, 0x368bf1493473974a, 0x810a5daba987c998, 0x4794c6a520bbf930,
-          0xebeb462d162a618c, 0x6e96854afb5ea0ec, 0x48a9fa3a9b91aa27, 0x833d48d2b3f4520d, 0xc45fabc5a8d45a55,
-          0x23c676af495d638c, 0x52b7b0492a576b06, 0x5a1dfbe026a7d7f0, 0x289f77b4d0fa9508, 0x37d07a08593a68fd,
-          0xe65436c9359b0874, 0x07956734e7a704ea, 0xb4219f743ce33c93, 0xfe378cd76ff2c22a, 0xe5d1bdc039d3a26d,
-          0xec89d1bcf977df5e, 0x5d114675ddc5f7b8, 0x1468545eb4fab7e1, 0xd2682e998295d231, 0xbe6fb67b5a5eb712,
-          0x6adb6472e1c2ba5e, 0xc2394a8e9da8e6f1, 0x41cfc91998db1c56, 0x73e971eba561e97a, 0xbeae399a07af72b5,
-          0x9a4014cf717d4e71, 0x396a04d3ced599da, 0x79435fb6783eec35, 0x7191cc4ad17915b4, 0x611dece2e129b42b,
-          0xa8ac7c50f7d3557d, 0x898a49cded803e47, 0x477d919c2629dcd2, 0x8339ecb61192ec7e, 0xe57980875de65a8e,
-          0xb943bdfa0da8ef1c, 0xf1c096fea331fd39, 0xfdf398000860912e, 0xa52a3a9db4a34523, 0xa65b8761681655e6,
-          0xd07b1d607aaf568a, 0x42be7642a6f66963, 0x6fc301b4dc2aef07, 0x45f9b384d031373b, 0x2210e3dea19a996b,
-          0x75acadb76c5a9385, 0xd1795fb42262b846, 0x7aba26a5a87cd279, 0xe616df7ff6191dad, 0xa751eb1cb4194ecc,
-          0x18e3de42b363c797, 0x9b31b111c0b6e7db, 0xc4e4db6aff9934aa, 0xe5a786382b3ebfb4, 0x273a6092828f673c,
-          0x1a33a2823e3f3f6b, 0x884ab083328cdeee, 0x1d092a23ba868d8e, 0x5e77403d6e285827, 0xab2c56bb1101f56a,
-          0x8b6749e7bb718e15, 0x1444b7899f45b2d5, 0xa57329329622f582, 0x2b8eb2356ad1e3dd, 0xc31a29409ffe6757,
-          0x8c4bbf11126a353b, 0x389e0080923ff1d4, 0xf04dab6298ad8fde, 0xff202784ba39e0bf, 0x6c4529869ce58384,
-          0x00e753164c832460, 0x0200aa2803a683b7, 0x3333dffce910830a, 0x074632084c0ca83e, 0x99ac7d9d795440c9,
-          0xf4665c84dd796dc4, 0x638f1a6456ae87d3, 0x03f7e8d55d48e6b4, 0x2f3d396c66fce247, 0xcf33947aab7e2bb4,
-          0x945300869c860258, 0x12d564a66e42df52, 0x4abc54a46741203b, 0xc3e505c7ee6121a2, 0xdd08d97c4033c5a2,
-          0xaf1dc641a33e5ad2, 0xe2a744e3a684b810, 0x3b965801a5502833, 0x4a7087dd25a4c8a0, 0x32355952fd93b9c6,
-          0x291f6939a1545a6a, 0xc60e914db2110591, 0xb05707c61ee9ffeb, 0x614988e0a7ad1701, 0xecb515659412272b,
-          0xaa1a8d764458dbbb, 0xeca8260e2d458b93, 0x6663c5c16973e645, 0x1589560c1714ba59, 0x38f91de28c139e40,
-          0xfe38784e48eed25a, 0x4bdeb89f031cc633, 0xc1a30cdd9a570ed8, 0x50b3e592b278d60f, 0x6dcd4d4d0ea90867,
-          0x62eaee1c2b78f323, 0x565b36716b7ed78a, 0x2f28c61cc3f60a9a, 0xf804d75ac6cd8e2d, 0x65276cdbae1527d7,
-          0xebfe86bb1631c53a, 0xf3bacc2bdb67127a, 0xffe90d9a46bf9483, 0x70cd8ee5e7e63be6, 0x556596ed302d1fde,
-          0x7c57827eec2b884e, 0xd7dffd70551f63eb, 0xe8f6507c979bc14d, 0x639ecdbec9577083, 0xd8b5000bab75557f,
-          0xe0805702523c02a0, 0x868bb1b669efa666, 0x196da4c38fef818d, 0xdb555e5b92ca5c39, 0x5635f81aed5f45a9,
-          0x4d6e058defc42201, 0x8a1e25acf8cf1cec, 0x9560e4c2ba3abc6e, 0xcf269558bb15ee9d, 0xc606f8748b51159a,
-          0xacd51e4a38850cd0, 0x4845b2e12aea3598, 0xb59b4d36d42762fc, 0xbd0e91663eda907c, 0x488940340e185477,
-          0x04aebbfbfef14ba3, 0xfc22658484f7a2e2, 0x51804518028ab154, 0x247f46cc0d03aac5, 0xc8b2195e878343f0,
-          0xc478c756f5f080a5, 0xf5e078c75e134f3e, 0x5c35bf1a1f606778, 0xb8b79a23b662c0c0, 0xad434c6f75f67ad7,
-          0x30611083bf1bf1d9, 0x0f137b49bbfb1508, 0xcc24ac0f11fbd97c, 0x81ed978bf46a0df9, 0xc0c9c31270658c10,
-          0xce498f19c4ecb3bb, 0x631a65a270974a1c, 0x27cb4289cce576fb, 0xd9afbf8f7041d403, 0xab8ae76a064b1f3b,
-          0xb4add92d81495c43, 0x8b066d01d5a52f48, 0xdad837e04ef33eb1, 0xa1e33b6ee3f6d0d5, 0xb6a5f3158e151c68,
-          0x5cc0ff185d9a9f20, 0xc6418c6ffedd6270, 0xcf1eb39c359a1a8f, 0x729d7afdb0818925, 0x7b17976232e20359,
-          0xb626226edb42d76d, 0xdd134d540787f14f, 0x713cf9bbf96fd044, 0xd67015da7de268a9, 0xc8c306090afe0bbb,
-          0xc96100762916e329, 0x3943b2ad0eee3544, 0xea0e6d122dbb0de4, 0xa5fa7af487163619, 0x47276642bed06e8e,
-          0xa0de36e05f0eee94, 0xe1908d70696d5463, 0x2edc08f87153e608, 0xcf38573ce6001db9, 0x199dde8eac3e6b2a,
-          0xfc0be3a615b71239, 0x3eef39b2571b571e, 0xa10140ae20cc01ac, 0xfe2809c5749d1c44, 0x3ee5ddf6debad8f2,
-          0xa2846bc0081b3503, 0xde2daa85025bcf78, 0x2a1a683be572d53a, 0x2e2a9e768a138de1, 0x66b6b222e0636a7a,
-          0xa88e02cf2d5d4bdf, 0x70236f37c58b8b9c, 0xb134102adec2026a, 0xc5c84b73e200fa2e, 0x321d2d7dd2e4f844,
-          0x64d8cb2f97989a64, 0xc1a8f23b02515046, 0x9fbe57c2e756adf2, 0x792e5b37d6c64fbd, 0xf4a2e5df0de13998,
-          0xdb2ccff6fec117bf, 0x1ef462cd56d48778, 0xb9a6f1d3ab81fdf4, 0xe751d082f17f7878, 0x993aa04ec6f2df62,
-          0x48ea8afb07063a3b, 0x49a4e5e25ccfe35c, 0x1595acd804e8c4b9, 0x514bcdb51d8d8498, 0x9e1e62483992ca8c,
-          0x6b858c647996f2aa, 0x12c8bc719ac62405, 0xefb861ad7fd43515, 0xe28e3376feaea01f, 0x7f92beceee195742,
-          0xc6bfc211ab2fff17, 0x9f13600f41feb336, 0xaf7579fa5812255c, 0x71ab1a6d2226e8ff, 0xd28442face8e93d4,
-          0x7562073c96629961, 0x8d39990d4792dbbd, 0x0de32ed833aadcbb, 0x99fdee8f0f127d03, 0x5d05e8fb0acff987,
-          0x4d210eadc0d1f597, 0x25fdf13e6269ea4b, 0x8b6c67caa4cc995e, 0x6fd2f42329c76996, 0x8af6afde8379f12e,
-          0x748778ce9561bdd0, 0xa21bac0e21ca0a28, 0x8d1ce5ae2a617bb5, 0x52af1417ea502a4a, 0x015c2fa76b0cf121,
-          0xb14bc0c554c5aefd, 0x39629663610ad313, 0xd3d2dc532a750c85, 0x98b58035176b638c, 0x4cc89cbf18328f05,
-          0xf758a1c9b73aad1c, 0xe9287b8d7b4b357a, 0x63055e99db07e601, 0xeebc3965eddf9942, 0x48aa755cf534d1a1,
-          0xd11da3aaada72d1a, 0x8b44a8afc33a8f18, 0x769f0ee45ced7789, 0x799747946fa1ebd8, 0x2af9748ae5864087,
-          0x239943396c5c6b2a, 0x38fab1229991699d, 0xa307713050fc99cc, 0x37b7366e71f1d68c, 0x09cf93888302cf5b,
-          0xad9def86618340db, 0xaaff6c8b53c8195d, 0xb2a9e76261e2cb66, 0x98af6d81f506f034, 0xdec954c3f4914dbc,
-          0x428cfce00fc10a7b, 0x634326e8978dec56, 0x9b2ff23e5cfd1188, 0xa6e96c10e7ccdef5, 0x545215635738b7c7,
-          0x50dfef38b46762c7, 0x5cd9c33faaa6a0d8, 0xbbaa66bd688cb1aa, 0x3d04fbd53de2a580, 0x75960b7973583fa4,
-          0xa0668682a39b4ef5, 0x3eec1899f4eb6b4a, 0x9cf851f9f341f1f9, 0x67130190854ec04c, 0xb7f8f1ee8f0b0e0c,
-          0x1f743d1845f46343, 0x9b1bdac588ff7bc4, 0x1fac4a9bc6189efd, 0x85712e3191bbe515, 0xbb4ee1c2ad52a3aa,
-          0xf4e3f84390296b20, 0x689ebd95c97cce7a, 0x265d2a1ec018c391, 0x46d61e3194cd075c, 0x26ecd518c8c3cdba,
-          0x352050cab04258bb, 0xc06f2b50ce0f58ae, 0x12367c6d70c45c12, 0x25915b946c641804, 0xd5e3e661224f2b35,
-          0x9015073251cb9f83, 0x85223a5d2eef2861, 0x4c15230e448b9187, 0x45909f9659592892, 0x6bb60769c791baf3,
-          0x60b881f4f69e9d7a, 0x2742ee7cc61b761a, 0x29ef50a3bc0be735, 0xdfe0ef0dea647c35, 0xb28b4092ecad7941,
-          0xd1a098094ae3832a, 0x30fe0187b82c88f9, 0x6b70983c8b1a03ba, 0x0eb37af39db97a63, 0xe2226078e407c460,
-          0x394dc115d83cbf30, 0x8401fd53bc8f0267, 0x0f6ee4f6cca80455, 0x73fbeeb1404ccd7e, 0xdb8be38158fa2dfb,
-          0xe34276040eacfaac, 0x30898a7b6a16bed3, 0x54f373d59b8e3595, 0x80881734e9ac0f7e, 0x2824ac33822b5025,
-          0x5b1e0593fe2385ca, 0xacea0ec4d0520dcb, 0x05e2c18f844487b6, 0xbc9ff0131b73921b, 0x58f9708e2e50d65f,
-          0xd682b1bb4f81c913, 0x933965a1ad670fdf, 0xa8cac34aef9c9fcc, 0x2f1ab639accafd96, 0xafa1ffc050dee72d,
-          0x3f4c8fe1aa90cdba, 0x2a0f6d77125bfafa, 0x6a8da41a63a8a53a, 0xaa70c64a8564ba94, 0x7b0ca55155d38b5b,
-          0xbf4f0568331ecb3a, 0x98ea6f66273476d7, 0x96af2ab81ab33c70, 0xbb0a9a67957a6bbf, 0x2767392958aa5e35,
-          0xd6ce57618c7a58a3, 0x73dbfda6878d0dcb, 0x97077f962cacdbc7, 0x40ac136723fc6ad1, 0xd5ac943a791c28a1,
-          0x3f39ee0819571101, 0xd81208d27243c658, 0x7616cfcee8933ace, 0xf89e5563bc5407b3, 0x2971e97d75de6c38,
-          0x7b477831763b34af, 0x01f523311289eaa4, 0xa0eafa20bd77611d, 0x5a63c1464e71aef6, 0x3602a21dc3847d0c,
-          0xa3322e95b3088d59, 0x480bb1fdb1f67790, 0xd158d509cb8c5737, 0x25af03a83f325aa8, 0x7934b4d4d379b4e7,
-          0x991a69797e6d454b, 0x01bcba16039ad0ef, 0xcfe47b7bcdde19fe, 0x6142cf4398e7b08e, 0x4a80823a81329bbd,
-          0xdc373d7c4d2b219b, 0x72b00c1ca0fb9366, 0xc4507a3717cdca68, 0x7a597a9acb58a89c, 0x0fd71f194631bab7,
-          0xbfcad80cc25d428c, 0x33a8af68fa48771d, 0x1d6fc22005724aa6, 0x3f68342b9dec76db, 0xd4c8d2412a0851f5,
-          0xabad452e0977c5de, 0x56559e261a190b44, 0x1a53b1a44da0903f, 0x557373a2a3997477, 0xf7b037ddcaaaae1e,
-          0x583460d6560f625c, 0x4b1ae08539da2916, 0x5d923a27a782ee34, 0x1b480e939b6dc834, 0xfa0e4dcbcefe210e,
-          0xa3d3c0aacbe2b35e, 0x2cb0ccf9f949be6a, 0x90417e389886310a, 0x79b17f16310d4d22, 0x7af9dc758af17800,
-          0xd21f7faac957b338, 0xe0fd126847463b75, 0x63650991f4af4710, 0x9bc03726912f8b1d, 0x2dbca9f5debae963,
-          0xe54e72394a060fe8, 0x0513afad8cd8fd94, 0x7e37841bf587439b, 0x7386f1aa8ff45adc, 0xe34eb8135db30251,
-          0x514b6a40d694fcdc, 0x2f0ec717a2d8204c, 0x5703cdca66bdc019, 0x908cc18dd077151c, 0x0359c11c662262fc,
-          0x258566a4df5f457e, 0xaa8bd9f5f6ac6717, 0x54f75e4972033844, 0x84acca0acbc4cb74, 0xf968891b33103a31,
-          0x4b96373792764ed6, 0x2af4ef60a95cab92, 0xbc1e90cfc616b19d, 0x764b37b3638f9b44, 0x921711318ef38711,
-          0xc9c1d1b6fd455664, 0xdbe3085955c46dd8, 0x29f53236505c0ee3, 0x23e1d9e68293de67, 0x4340bf14263f3815,
-          0x5f70f1f41816d75d, 0x297ea2b20e51566b, 0x2a6ff357a71622ed, 0xeba81ca959e5b815, 0x0eb818e77b8b3baa,
-          0x567565d8e0e3fc6a, 0x15fd7e424e509cdb, 0xcaeafc38b28b3823, 0x219cd99d29639e61, 0x8a29c4df937b9a30,
-          0xf02883f6a3bbd403, 0x581bc9be79e40d34, 0xd4df336a13d996ab, 0x530ee899d41cae35, 0x2b239c31a477531d,
-          0x918e558a7db4b9ca, 0x76727ddcf1812378, 0x4b9a7acffb05a756, 0x6a3b1c940cd356df, 0x19c4036f29481e33,
-          0x83d333dce715072c, 0x9cbf299b2df80c7d, 0x8a4fdbe0f3f9ae7d, 0xe47c64a3df5cbf60, 0x53e01dc9dacf4253,
-          0xb1874edcae1e1b7e, 0xc1842dd34875fe48, 0xd992541faecd798e, 0x131ce50cb3e87486, 0x73c31aab1dcedbca,
-          0x05a9fb06e246201e, 0xc31deb557d4c731c, 0xf8118c39184b79bf, 0xb36f5e5dbe0a935d, 0x8cf6c2f3f2d38dc4,
-          0x93f72dd83f3c6561, 0xb042fa032048b1ed, 0x6dd3a7e68caa0851, 0xc062895b107b8e88, 0x25d96b7e0c8ae05f,
-          0x70d185b146619dce, 0xd57bdd5f25c6b2a2, 0x7eb962eae6e07bdd, 0x02aabbb7f7642f37, 0x6504edd914200e1d,
-          0xac8091efdd563cd1, 0x660eb719baac40b8, 0x8b14da3db3e15f79, 0x55d1673749453c95, 0x2e8e2fe49c8060e0,
-          0xe9eb33390e245537, 0x4faf2c5af6ecdaa0, 0x180eea73eccee9fa, 0x3af3b9c6b8ff3af2, 0x94cb75751c934ace,
-          0x11eabdfdd0b26d31, 0xec069cafb79e8936, 0x2a72643cb27137ac, 0x62f4c85c3d3d4031, 0x1359465b8100862c,
-          0x17d49c3d3f4c6b81, 0x4677333434aaa73c, 0x469348138292e113, 0x735072cae9b919de, 0x173784d808ad37af,
-          0x749b072129448182, 0xdb0bbc2021b21aec, 0x4b3ff17d54dc9a41, 0x6c213ab668c9b3ac, 0xb092521d9211b2ca,
-          0xf45ad90b3fdaf9a2, 0xc5772e5961198b61, 0xf88336e36ff64124, 0xa57de1823e325d40, 0x0eb632aa25b22abb,
-          0x5bab938a0a68ac13, 0x9f823f7a60e36fa5, 0x4b14ff58c953e12a, 0x0169608b7ac31c0c, 0x83b48d4ec7d65f68,
-          0xcced37dc07db75f4, 0xc544f34b6d772368, 0xd40912d05b490989, 0x41efebafe263969f, 0x18ee341cd9951944,
-          0xb5e2789cbba644a3, 0x08149ddc2c384251, 0x40b8c46cdb192dc3, 0x342331ae19b77cff, 0x56c5432bf08458d9,
-          0xe71a83f133e2b6a6, 0x9e75d2e0299226e3, 0xa0a198918341938a, 0x3f3ede692466f49b, 0xf4b30aec491806af,
-          0x2655a58864b697ce, 0x7329d433b398dae6, 0xed8bc045755f29a1, 0x434a42f2e2c98d3b, 0x4aecebcd1d63ba91,
-          0x59905933d6c19422, 0xb39506c1f40e1721, 0xf6855c928b30f60f, 0x952654a8d41ce06d, 0x127a79f8b6094539,
-          0xba33b13cf8faddd7, 0x6d350d44fc86880d, 0x9cd8c2b6ae91464d, 0xe8ab4f78451637d5, 0xdfbb667503242801,
-          0x075379faf1a87b66, 0x3dfd10d4a22dcbde, 0x3e80dcfe9756c8b4, 0x1f358188bce90b71, 0xea57c2d8bfd67b69,
-          0x9e31e3e752b9c88e, 0xbd8bf96ba9fef863, 0x6f5e19e4512e54ec, 0xd04ee621a5a6d21d, 0x9b966929bb78debc,
-          0xe0cdd4785fdc2e22, 0xfec7d745fce83da6, 0xb4349abf4695fa22, 0xbb3054479b7473d7, 0x65951b7a1b7ec23c,
-          0x7daad944d4155569, 0x5a87060a2b4d83cd, 0x22c4f04f0dec440e, 0xdca11aad55643b76, 0x5675d61d3291ceda,
-          0x2e9dee61b4bc815e, 0x8cb094ed28c77cd0, 0x67f85af11803392e, 0xb63d2b64b6bc31e2, 0x7e262fadf8d57ff2,
-          0x6711f03c7374a941, 0xa77d45b89f537220, 0x9676822b0d4f28bb, 0x04d96c68d11bd8dc, 0x8cdaab2433d40f2b,
-          0xeb297a672e187225, 0x3a277dc0e1b2c9ad, 0x4aa96e1e71822bf4, 0xfe5ddd12cc14e928, 0xb4cc165afa8093d4,
-          0xbcd4f19d3b345fd0, 0xd00a1edbc56bdb2b, 0x32ebeacacccadf9a, 0xa9ae8d4d7ee943b1, 0x9500d2cc4c8d07dd,
-          0x9f68488ed795a3a9, 0xbdcc4f9329e81fc3, 0x2855ad6c3da007e4, 0xe15c7ca21320a330, 0x73d83aec16c6baea,
-          0xe43c9a7597bbe199, 0x1a881dc71a61b12a, 0xb7728cafb628ba70, 0xbb3cb4f377e74893, 0x210fd5819292d4a1,
-          0xe1b9a86d98850c62, 0x196fc7cc23414317, 0x5c2885f8542da6f0, 0x943a61571e009794, 0x30f2b62b622c68d1,
-          0x33bbf3e2c1f37650, 0x4728f1da7bd6836b, 0x2e6b926547d70c7d, 0xcb3f9198c5582c71, 0xc0bec5d942099cea,
-          0x0b99a4b5db14dc27, 0x13dabe80d4246bc2, 0xd67930d0eb3077f5, 0x30e998365f617159, 0xbdda6797c921c7de,
-          0x0299148d17ef2746, 0x2bd84b8cab771b5c, 0xeb08bac55a6bde7c, 0xc5cde80d57c234a6, 0x917caaeb15220e79,
-          0x2365fd24bc8a4462, 0x8394beafe74e0bdd, 0xb380c55d05036bd7, 0x64644efdf3466d56, 0xed12f4adbdfd8e4e,
-          0xdf2039f80ab82171, 0xe4604c13e3784716, 0xbdf8747826920060, 0x5b597e5968af2b57, 0x49865a142fbe9397,
-          0x3d43f1c1047447c9, 0x8e7b4a82028639a2, 0xcfe2bc70a8d43377, 0xee2a982a3fc80b58, 0x0435de1ba768ee3a,
-          0xb32a0e8ad0face5c, 0xcfe79e89c79eebf5, 0xeeec100ff3622c1f, 0x673d816de71e1b60, 0x9a902e615112eb97,
-          0x28b90266b99b5986, 0xa4f18e65aedda5da, 0x464db0ce0be303bf, 0x990c4a38fe726746, 0x3616a5ace2efcfcf,
-          0xccf2a8c79e828e5e, 0x608d09f76d609dea, 0xce60020cd4bf6b1c, 0xf581e72b0b0ff2e4, 0xbfee9ae20ad56a00,
-          0x6a070c17495eb4c2, 0xea1a5eb845dbece8, 0x4b688df712299452, 0x97af51b93417c846, 0x5acbfe96cd3eebc4,
-          0x669f4aebfdc9c283, 0xff004a42fe52733a, 0x1bcba3b7e1c9a1c4, 0xaded4923e86af0e5, 0x5b4f25a5c7a364a4,
-          0xe9ba2032ac6ca672, 0x43837f5b27869cb3, 0x0065146cf75d7fd1, 0xa0cd70f51e1960ff, 0x445156bc6c330837,
-          0xf79443d31d9d2527, 0xa357fc30615dd7d1, 0xf7cb8b8624099dd4, 0xbe37cd59236d662d, 0x900ce0d113336752,
-          0x92fa39095285c935, 0xd2c50ceedbd9c913, 0x37d1813c38d6f464, 0xac06074236a4cb21, 0x2668d1503947a044,
-          0x196a9b2a80e6e433, 0x7bb893d5091ce8e5, 0x3c8bd5b3ebff32dc, 0x4698aa8506ec8bb7, 0xb5c729dcf4bf01bf,
-          0x24962f6c41858ae9, 0xf1f6dffd4eb69e59, 0x500cbaa159657a87, 0x1b9706c5d44429ea, 0x1765b2a33f7e7dff,
-          0xe787d76fbfc4a7f3, 0xff06a6ba9ff8b694, 0x7cde98fcade5eabd, 0x7a7fbfde1fbdcf3a, 0x8b67fff317f7def8,
-          0xe56e79fe57e64fd5, 0x57eff3336cd9fd55, 0xc64bf289bf3e767f, 0xf8b9df16571a7ffd, 0xe92df9fbdfdfba7f,
-          0x1fdd7f79cfe8d1e7, 0x26fbef493fdd76d9, 0x8fea0adfaec5def8, 0xb81953c087f5db97, 0xf7d8fd5ae78b34d7,
-          0x8b2b57d7b8e0049f, 0xbd595e5645e285dd, 0xb8b42b732e1546b9, 0x4c4f362e961b0ec0, 0x227c572e63e0c0a5,
-          0xa2299f5fcdde4800, 0xdfbce53886798e9d, 0xa33877c8c20f21b0, 0x2bbb1de27ea03ee8, 0x4db85a020442ded9,
-          0x8b1d029338001304, 0xc439d69f9e9cf5d5, 0x4f2b7d7ba1adc77c, 0x91470466e2b5fdde, 0xd75726a478b7b8a8,
-          0x0281a347b098f583, 0xc4dda9bbeef55b82, 0xa84dd5c705a64108, 0x26357b39b0e616c2, 0x69c57779598dec2a,
-          0x3d1301cbcc7a8b43, 0xa0d03b0cb50d8488, 0x0b0362275bcd6700, 0x5a039199c21a5417, 0x401b6f70e3589792,
-          0x8fe088599ed088c9, 0x2f6013c447650186, 0x80ec4ec210444e4e, 0x3cda5ca3fb433da1, 0x9bf3f88d4921045b,
-          0x582826a2a30202b0, 0xf6ec0c73149e1752, 0xa04bd42cff84092e, 0x2aa5089880015b19, 0x846a6e5d3b30e8a0,
-          0x426d4104d1a4cfd0, 0x12ab475d8702de9c, 0x73d2f262c57d335d, 0xf52dfb8b8f89bd1f, 0xa1839e02cbb7bc92,
-          0xbef1032f20c7af65, 0xd64292902742e84a, 0x0eae9ef36d4979ba, 0x52a63b5a8cad18f9, 0xe2b6bf6c28955dfa,
-          0x8750cf5b2992009d, 0x506b60c56ef1bbdd, 0x8a15f87fb3c750fb, 0xfbffd5f5a71776e0, 0x9d3fe9418f3f75e1,
-          0x35068a15faaafb51, 0x6dfca26012fb354e, 0x8928dc005c685ec1, 0xb79c3ce088b68386, 0x44520f651dc9ef7b,
-          0x80fdac52d4d33af4, 0x141470d7e0cddb77, 0x9a48af73885bf7ea, 0x4af99e56eec003b8, 0x66dcb8f43d270e3e,
-          0x9b67dec5295f351c, 0xe26d99f1a0f1a9e7, 0xae286f07df1c60a3, 0x5900fdcc84796a22, 0x93a569705ae2a758,
-          0xdecaa3eb4586bd0f, 0xf25d6535b7347bb5, 0x9e955c423dc98cd1, 0x9bef12091dc8874e, 0x2c15779c8c87e98d,
-          0x4d5c420b04127778, 0x911dbd5326829553, 0x3fa082148aed20b6, 0x98a107e390849b8d, 0x661ad1ccbfa8bdb6,
-          0x64acf74e526b219a, 0xce1116ad44178839, 0x2f3bcc24cd4b2fa2, 0x512375016804bda8, 0x465919ee09d6a6a1,
-          0x07bb111b0b967252, 0x5a64d454d30ab25d, 0xa2d180c5cb821a74, 0x0041a7c3263189b0, 0x71c4e054e7bd0226,
-          0xc37e47e343a495a8, 0x17f3718042fd1417, 0xba2c87ee24edbcd6, 0x23e26443d113401e, 0xd2da901742d16404,
-          0xe4087b6526a71d4a, 0x669fccab0d3feda1, 0x94b462dc4b924936, 0x9c7b11106a6b78bb, 0x167b4fe11e5f1bb1,
-          0x427d591e4c42a353, 0x606bc178057c3d08, 0xe9e8f2f847487502, 0x0fb726e1a8c02905, 0x672cbe6b2fef0c75,
-          0x367645bdd33fb213, 0x25b86a7344f2ce10, 0x1985e7757e806082, 0xa3161d07282df448, 0x8fc14f5d339e610f,
-          0x6d41b37301507b08, 0xd588e32f68aa2ba5, 0xfefc719355a7352b, 0xad8888a5df0c630e, 0xdea5aafd0a689843,
-          0x7efdb673a1820462, 0x2982f5c715940280, 0xbefe46bb4cb3f265, 0x6f4a057dbec240dd, 0x543d0b0904890e02,
-          0x5c8610f5e88143a1, 0x93ec26cb7f588300, 0x8b91a68c4bbe1e82, 0xa3080e4990f503d9, 0xa6cbe2d6359acac7,
-          0xc97c3022467493a2, 0xcf7e2967c1e18843, 0xd1eb56088ba4457e, 0xbfc30322d242a4be, 0xef8a8c0ec8ec80fb,
-          0x27daacc664be24f1, 0xc1863c6c4da76430, 0x2493ade57884cf2c, 0x448c5a9886700092, 0xe581af8588216520,
-          0xe844f5bae46033d5, 0x2014f896528e6806, 0x7964ddacbb96e414, 0x882eebe75b91890f, 0x1e255b52504e6bfd,
-          0xfc9624a77aebad93, 0x7d9e2a623727e39d, 0x72c738999c75b22d, 0x8d5e4bed21c7b22e, 0x7f4b6b040a6b15cb,
-          0x1322b6f6019057da, 0x410e35506e83b0f8, 0xf7fa3dd221aa6003, 0xb12b86802105243e, 0x6e9704c54476c1c0,
-          0x02029290a927631c, 0x4f53225bd3c6e34c, 0x07d93024ce60e018, 0xf7961ea56173074f, 0xa419fd9af0d6f822,
-          0xa37c76002fb647c7, 0xfdfaf205636fd7e2, 0x674e373640cad187, 0x0c27aac497ca7196, 0x51fa49e61b4a6c33,
-          0x6e504ef979510ade, 0xa57115d452432550, 0x5ef46a29e39064c7, 0x33286b95080ab88b, 0xc0d77f6bdada6474,
-          0xef9ce2add53ee8c2, 0x51fcfbccc5857f4c, 0xce17d013e7a9e6c9, 0xe1b77ba2c3cad8d6, 0x48599903f66e9bd5,
-          0x1582af927f9229f4, 0x53b5e592cf474fc4, 0x44b232de004bd71b, 0x894f7f2087613e67, 0xe91710cb324b0f22,
-          0x9e4988b4ac9fdbf5, 0xed9277180d5fa194, 0x45dcc6b9c1480eb4, 0x13bab50f8cb640e0, 0x2df9050f22d50448,
-          0x399d9f5f5ac3a565, 0x1d014054d32419c1, 0x0d87c7fde7c9a13d, 0xb3008927e2eacef7, 0xcdd6d0fc42689cd0,
-          0x30cce3195698aa13, 0xa43fd1892931bd94, 0x5cddd5531f0cd143, 0xa27329bfa0ca95e2, 0x7983d092f5f72d74,
-          0xc15251baaf8dadf9, 0xc5349d3688e8b41c, 0xfca1210d0fa900bf, 0xf8c503bf4482c27b, 0xe88043c41f2f0e0f,
-          0x7551dfe36b518ab2, 0x020be6031e2b7506, 0x36d4b590408e29be, 0xffde49b202fcfe4b, 0x8c0018ddaa2a6e22,
-          0xbd94992b06092595, 0x4b44d7d53b468fa3, 0x51041c163d71731c, 0x5c911a45d16cf5db, 0xa81e3b8d4b1b5021,
-          0xa112b7011506813a, 0x896f00344797af59, 0x7f1f8cc6ecf60025, 0x82e7ba0d2ee864fb, 0x2afd408712c3a3a7,
-          0x08e6d4b92e99d1c8, 0x17e09f1025a2d0d8, 0x9f6a1bbda0e0e541, 0x5a5e18b7f50aae45, 0x44fa6034d42e54dc,
-          0xa18e4de2cfcf043e, 0x200b0107fc159fdb, 0x72fe2c78b950c971, 0xf60a6e150498b1c4, 0x17e66ec1a2dcd040,
-          0xf31be8d2df82b6d0, 0x2d6c468f8d93d949, 0xc959f823fa716aee, 0xe55984148dc58b9d, 0xf2e62370fefa18ae,
-          0x3de9f54ca5d7770c, 0x4f2e4c4507350da5, 0x32bca2862214bcc0, 0x3b720ebb99a4811e, 0x82f8fd2a4cc5a924,
-          0x925f9aeec5bba207, 0xa0472014b58bcf1c, 0x598ace69072c0c3a, 0x39179fc8af8be514, 0xbc21c53af6c9331f,
-          0x2607e05aa5b8d0d3, 0xb1b4b90b16fb9fb7, 0xcd0432f9cfc24473, 0xc4cd621fbecacf05, 0x6e544cf618e78f04,
-          0xbc8741f4336a8123, 0x7a83c6b75903b4ca, 0xfd5ae4404cbe1f71, 0x0aeea420aee87283, 0xa51f1b9fb3f03673,
-          0x3a928655cc62453e, 0x753141ba55fc38e2, 0x8e2b869db5304198, 0xe5dd67188ce3fbfb, 0x1b2eab131eef79fb,
-          0x3db7a86d4923c13b, 0x1e677ce41d8351ca, 0x062f88664b602b0a, 0xf878adc952487b14, 0x60e15de644d3b517,
-          0x37a767c92c6b34c2, 0x0e7a849ba5da1c62, 0xd4b140b5cd8750f5, 0xe2ebebeb8af8b3c7, 0x7a2f7c4155029b61,
-          0x63badf03b5d133d8, 0xf9a181976bc68695, 0x6d672ced9ef8ad7e, 0xf8303abb6def29e1, 0x093a387f9d4aab60,
-          0x623816a1dc429704, 0x6e5997c27fc85ce1, 0x25fbc15c1e4916c1, 0x332ea3fad209df27, 0x3940597ad46fa2a8,
-          0x1b8ca25202543303, 0x8dda341e94477462, 0x8b5c9a138af1e450, 0x83dbc654b11508bd, 0x2dd302f4fc0b5c93,
-          0x21e06d2ab5df0014, 0x39a4a5b296aedf8e, 0x7345ad8088967449, 0xde606d4558e01bf8, 0x71556be1d3b29c7d,
-          0x8cc6952d0dd8682b, 0x26354400c6d495a0, 0x03123f2e1b80d6d3, 0x85448988ed061bab, 0x3118b666afc62d19,
-          0x8d376bd3eb8f5e56, 0xa74633100678a303, 0x69104b15cc5f6073, 0xed610e8d9846a45a, 0x819d8ed99e96fc64,
-          0xc6da8cd59f7591e4, 0xfd9148ef04022702, 0xcfc4d8a639120913, 0x2ccbdb17196e8cf0, 0x86cd6f05f7851a04,
-          0xdf3e041751e8b67e, 0x43ae2eb21250370c, 0x927030d2a4f74c30, 0x717c1cfb56d01917, 0x76a6d345cf6a55ca,
-          0xb199f32de9639791, 0xfc7e20858192104f, 0xa6825f3e905b1638, 0x4ab5df414f2cbb35, 0x01a63958101311bc,
-          0xf058a811701993eb, 0x4aa0ff55c220326d, 0x4e9fb92410882c7c, 0x7539d3e70813a19a, 0xb81b5bf50f156107,
-          0x335dd9d20808b3d6, 0xc69c7c637149e055, 0x65824622520989cc, 0x9c8e638f27cab12d, 0x0616b06c85eee876,
-          0x7c245123543918dd, 0xd640ead17b77a9c3, 0xd825727200a8a2ee, 0x74b05e9e5497e23a, 0x6a1dd8a241858e3e,
-          0x8e5d56cb45a10020, 0x592636f9b4ceaf2e, 0x47ceb361428a1ee8, 0xfcc226ba0e9bfe08, 0x5773e90cc15047ff,
-          0x646efa0b893cfc93, 0x61a1c2d7b1d906e8, 0x5d40ec036fb41724, 0xa003e422b729de73, 0x7ddd5727d626c2a6,
-          0xe6397525158048a3, 0x015e0d04dc238853, 0xb0eae753ae2abeeb, 0x889fc6c348bf71be, 0x4288bc3c04300f09,
-          0xf629f6bbebd71783, 0x55466b066854b47a, 0xde0d44372f08c20a, 0x6f48ac8c136853b6, 0x408077df642a7cfd,
-          0x1568009a67fdbded, 0xdf81d64810ba1aa8, 0x71f19e47d7021157, 0xb08e9c0668cb3ac8, 0xe9848f5a7d7746a3,
-          0xaf049ce9df93d0fa, 0x69f4d8b382da1866, 0xa4d7ed2df1d5c61a, 0xbe497f46f08dc319, 0x479b68f855d3e526,
-          0x765af7faa6982cdf, 0x2df7c9fe28f1e7cf, 0xe837bed519a722a0, 0xfdf59e6956dc70ba, 0xf3f9bd93f60d62d7,
-          0x2aabae57066eadac, 0xb9adf2caed95d7ee, 0xa8fce94e77fd31e5, 0xca1b571a2df715ad, 0x48c55c5df6a53b7b,
-          0x2aec447014d4c575, 0xbaa78e5f30720b68, 0x733dd66b5f8d01f2, 0x4e5b0896dd0a90a7, 0x2bdcc5110be4cb26,
-          0x080ba61d209ff86e, 0xb4912bedd49c3f7b, 0x69b021bfcc3cee09, 0xb5e3ea3d1d362aa2, 0xf106e732bda8e23f,
-          0xc444a1d43db99d21, 0x650d68421068723c, 0x4383fac2a3d0240a, 0x1fabc264df55d40d, 0x07138a09a73c1d66,
-          0x3871516537402bc6, 0x830e48403b58e894, 0x717ac4df8da6df8f, 0xe2015648cdaddb64, 0x4a9b801f1146a3c1,
-          0xad530e3ef3fc2394, 0x035a15df3c33dc5c, 0x6d36221e3c6257ce, 0xed1d6392c7f7bc83, 0x72ad7a88c539f521,
-          0xa18886984e174ab1, 0x74442241e1df94ca, 0x6e472bf1c74fd258, 0x5257e43341dc862e, 0xfc1a7cdf6ae9eeb3,
-          0xb95bc6e8a96ff472, 0x74c7aeb9085a39ee, 0xad3191618ebbb02f, 0xf18d7711db849bcf, 0x2997947abd1981da,
-          0x51c85d952b42dad7, 0xe4cac27659a2a00c, 0xc6482a92b7323b12, 0x9dac628b5bb80e90, 0xbdbb58d585f18278,
-          0xa9589763eb58d395, 0x47ef8c07910bea09, 0x3ad36ef13fed66af, 0xdddfe81a7a1dbe5e, 0x5c7978035f100832,
-          0x28e2b5420b0ca25b, 0x787eb050902af362, 0x85ea429ae47afa0b, 0xc8ca39b5da9d72c4, 0x83d14bd48b4e6a32,
-          0xe3fc9d5fe05f536e, 0x84de923e3cf6377b, 0x4d13b6d6c8bf4e91, 0x73794d8d759687b5, 0xee2b41a8e75008e0,
-          0xbc311debb5345ae4, 0xac6c31b07c54c4e6, 0x053342bdef792e01, 0xcad6f900480548e0, 0x895fac81a278495a,
-          0xee8a1794e6422ece, 0x110ed5acc9d55872, 0xb63d69d43b6895b5, 0xd3e53cef57a8e867, 0x548f7a59b60ccc72,
-          0x1db5a331157a3db2, 0x03bb45be8237bbb6, 0x6c18fbbd0f706d3d, 0x94cbb326cd25e3eb, 0x1facc7e479b844d1,
-          0xeaed9f2126f2e20a, 0xbef3d1639afab7c9, 0xe0d13be638dfc84b, 0x1608d6407dbe2602, 0x93e98fd8c1911fc9,
-          0xece99453710e763d, 0x973a4aa1a69a8cc9, 0x95c8bbf628060bd6, 0x9c38209b875e98d2, 0x64ee34cf025c560e,
-          0x4f5f1281270f65cd, 0xcdeb52fbcd6a7972, 0xe06ec98937b6a4b0, 0x8b2847b7999432d9, 0x22149ec866ca6e16,
-          0xa5d32d46e5a00cd2, 0x875c65335ae685a5, 0x561404b2dd82298a, 0xc2e1b0008224a4ea, 0x880ea0a3d7cc902b,
-          0x8f17b4a09db336aa, 0xdf62725d8ce19678, 0x3810469a3e490308, 0x0d3314efe65c08c8, 0xe480ffc3bb1c0f88,
-          0xf920a379dd49019a, 0x65c257eb5d0a6756, 0xf9222dfe5a628279, 0x188045f8c7bab699, 0x9ddff6af9791e135,
-          0x2378f195adc748f5, 0x4c227e22e58f5035, 0x3e459e49789b8932, 0xf78bf328b66d83ff, 0xfd361144ac23f712,
-          0x353c68a8a9f131e8, 0x01295a50374c28ac, 0x20b728bfc13bcc18, 0x7cb61e3d5b06a8e9, 0x0e1b15120ca261a9,
-          0xb29e75547b0b2f62, 0x8a3fbac31f7dd76f, 0x097ca2d8df04ad0d, 0xf37a109c52a4a43b, 0x8cd1356a9e391cda,
-          0x064a51da9951c021, 0x8be721c40c2f3419, 0x32a3bb5cb0ea0a29, 0xe98eba21a0a25847, 0x5494084627742d21,
-          0xb8d4f29b320144a0, 0xf9caf89f7cbc90b1, 0xf2533cd03ed74c86, 0x5d1fa1a633954084, 0x89a6732fe8928f63,
-          0x47a6eef5d349c18d, 0x8f6baffb8620af20, 0x08b1978712168960, 0x0928a85044b50810, 0xc0a00ca2fb25dc61,
-          0xf3564da8777e197b, 0x0142347efa492fa3, 0xaf981840f333900d, 0xb489b70ed551083b, 0x9abfa4c38a36c8a7,
-          0x9968a0d15b879310, 0xdbfec75aa4feac14, 0x4c9cecd0f5e49390, 0x2545334ba1d59762, 0xeb94df692233a6e6,
-          0x9aa40e4c1560564b, 0xcbf8a4ec57d6d0a0, 0x83311378703d75fa, 0x5016be911a338394, 0x4816b40b0f406e55,
-          0xd56294292b7726a5, 0xd866ac39c1bae9cd, 0xa6b4d201b318d4d4, 0xfc9da1077a1d86c1, 0x7fe17e290624397c,
-          0xeb42c327110eb917, 0x394a9b32726071d2, 0x5bf4e5338d87bfe0, 0x5819ac1eb5eec3ce, 0x6cd3fbadbaa73af3,
-          0xa2d21e9f3d473d0f, 0xbefd7876d491b512, 0xa66096823230a6c1, 0xbbd5949057c57cfd, 0x859af83eabb54b12,
-          0x96fc09edf2ef50ef, 0xd568bdd76ae467fe, 0x9c3dc2eefad78ffd, 0x7f2ccbd5deefccd3, 0x473f7f82c73e2675,
-          0xba358978e84cec7d, 0x1b3160e53a613399, 0x25abafbbe77226d3, 0x80161ecd8e83a7fd, 0x1661a7e6961be651,
-          0x39c1b73c1d38a900, 0xe0c8fd2a633d3c67, 0x9ee1beadcf6d61cf, 0x2515e1de9495712f, 0x61ba00545f8dc4fa,
-          0xdfe68fbbc56f83af, 0x94dd6f9e43adbdaa, 0xe128775ff059b8f8, 0x46d693001ce0063f, 0x8f4fc07b9bd124c7,
-          0xe78ee93d1a8e5f0c, 0x970493e0fc251dc4, 0x811e8d3b2f21fb67, 0x32a7fe21a0a6afdf, 0x9c08365033ee041b,
-          0x8e84d8345123b905, 0xab6ce2bef4dba302, 0xceea6c07eb99447f, 0xeb1d1455e8b1753d, 0xb66d3fdf1cea6201,
-          0xb5108e558e3b5455, 0xbdf32edcb1f73d99, 0x12aa469e0d26beeb, 0x77383b4fd2a579dc, 0x8e1eabdaf678d712,
-          0xd4a4ebfaa4d45ef1, 0x2652bb397c141035, 0xa8cb7a3ece08359d, 0x0a5b7ec230eca99f, 0xd8dc49df5dc4a149,
-          0x42685eb4b292313f, 0x8515e2c393989f90, 0x06809dccabfcce20, 0x788fec16c6603c74, 0xbcba1f7a48c7dda3,
-          0x13ce93bc00f7bfa6, 0x3d06e11398874a85, 0x343a7ae98d8d9772, 0x3a90f1bf215c0fc0, 0x80e39a7224fd39e5,
-          0x6b9566b922ef2373, 0x55323d802bc8a064, 0xe4731e3fa3983fca, 0x26977f9ec2476a56, 0x386222ddee38d2d8,
-          0x4dc2d6b8c07c6437, 0xb5f7d3f37ce35d4d, 0xc2a3b78a53e96116, 0x8cf0f6e2e85f77db, 0xb35ea5c6db496838,
-          0xd2e838058b257f28, 0xcd470f5363a0a2bb, 0xfc7a3a838b5f79a9, 0x9ba35c5dda54d69f, 0xdb4624fe6880d6f8,
-          0x893d47c2cff33fb4, 0x4bdb6f28869a862c, 0x8ed82048c4ae97dd, 0x82ff852bb400c4f1, 0x25f00e5dd6b5fc0b,
-          0x76cbc0abf8038f09, 0xbad83e8f8d1eba6b, 0xfbbe6d3e94223645, 0xa01d5885c25cdd9f, 0xb60f13393c42e504,
-          0xb2372dcaad1cce2d, 0x3edfcac7a3b56c3b, 0x6dbb43dbcbfcbed3, 0x1d4f26961417516f, 0xb9ec72e3559e6b97,
-          0x61aea1797453e73d, 0x9f6ad6a3bcf997d4, 0xee8ce80a1a535d58, 0x7b1189664aa63528, 0x61970f0b587ce7dd,
-          0xcc9739cf0c618808, 0x0579579797c93ef8, 0x25ae6b1c66401d46, 0x51cbfcf574872a45, 0x1c78962f56fd1b06,
-          0xc74760184c0e9e00, 0x9f505e82a54899f7, 0xa5c0848f0223cc29, 0xd15684291f81531e, 0xcb1e6adea35a675b,
-          0xc1ca2616d31c9c92, 0x6bde4f3e7850a1b4, 0xffed24b0493cfcee, 0xa5083b0294448804, 0x5d1b981961f86fed,
-          0x90865f56462f823d, 0x712a20c38324691e, 0xf6d4804fcfd0a1ee, 0x5134fb0a6337660b, 0x2e3b54d42634a4b3,
-          0x2850ffd847c9e79b, 0x14fc332b87683cd5, 0x88357c94adbbe461, 0x6760e7c5f4c44732, 0x44056aa69d4092f8,
-          0x2e5e1e0fab190e75, 0x74724475002ccf13, 0x6d4e835da97c16d0, 0xd8556e3fe5405ac1, 0x031f7a7af981f89f,
-          0x4b0c7431bbd1599a, 0x4078d1d6f58745f6, 0xf509055eb853969f, 0x7b7de2b5705c6d88, 0xa4aeb1f630e1fccb,
-          0xc0339b3889627f70, 0x53f4dff276ddf378, 0xd0a7e5cfa59d3b2f, 0xa542c7f0a6f23a9b, 0x354b8d6ab64be8e6,
-          0x66c550ef0f2cdeba, 0x2e71b7cc14af7a03, 0x7aaa891cdd8a1376, 0x84413cec2218a621, 0x1429d39f118cfb58,
-          0x9410b796c5a25f06, 0xdfa8f77bcc9a7a4f, 0x48fea6cf7c38a1f2, 0xe93d07d85d4fd841, 0xa6f9fcbbce3ded62,
-          0x7bac9d05e2e1d4df, 0xbc874b7eebf9fa92, 0xe2ba210aff339721, 0x72eaf151280013be, 0x6a2ff8adbc9a9dcd,
-          0x46ad78865c4be9ff, 0x1645161a2843fa65, 0xad927e278cc67245, 0x97be10b757da8c52, 0x189d45e87ba220c8,
-          0xa519d43f97a6799a, 0xcf3c7646d3582edb, 0x20b78cdcda5cc838, 0x882156b6bf0dc7c7, 0x35430e01b95f0b0a,
-          0xee40f967e680ae9d, 0x51ee7aa2bc9d064e, 0x40a048171c0d78c1, 0x61d1726297bc2bd0, 0x410fc50a5321e075,
-          0x8b31db6615f16b4d, 0x290ebe586117e97f, 0xbed4a89d58532a89, 0xff11f642c8784947, 0x82a095c4095649e9,
-          0x519945e7a68674e6, 0x2c90597748a35f45, 0x88b2964bf4906035, 0x1ca2e26f6bba2113, 0x498854c6f04e5fbf,
-          0x8d34f87169a14a54, 0x3a09cc50ff244cf0, 0x868c0645b6703269, 0xd1b4747292e8a796, 0xa017aa7d0ed4e883,
-          0x1c1983546f8a15b0, 0x92749613043e5a46, 0xc079e52d535ab0b0, 0x877c388252c1dda2, 0x2052578929ccbd64,
-          0x3269eac01ef6f45c, 0x7698484fbcca7616, 0x9433f719837e0886, 0xa725ba1c223c8d59, 0x37c31afcebcd82e7,
-          0x206b53824ab472bf, 0x7222c4d97695023f, 0xc5eb32ac0c982a82, 0x815babf9f4986156, 0xcca79ac26a83d6cc,
-          0x4b0fb3f02621aa38, 0xd1943ea6ed821054, 0x2c9642a0d74621a0, 0xf734f77d79d9860a, 0x45a336487e3a94c5,
-          0x47a7b03e9224a239, 0xe5e09f329cd09578, 0x43087c0beee14fba, 0xa3bce769975725f5, 0xfb5632e2db659f5a,
-          0x8ccf3fc7ef6e695c, 0x3e7aa8adc5dc7df2, 0xba97eec065079af3, 0x602fed1d4adbb1b6, 0x5cd69965762c1dc5,
-          0x729d9d2becbd5b9e, 0x616210dd60b63c3d, 0xb7f9b1bb08a7ff9c, 0x0f7879cbef6bae43, 0xe33f76dd696f9a63,
-          0xb700c665ccb3acf9, 0xde5ec49f0d0dc4df, 0x7807b29780381c1e, 0x2608dfa9b7a3f6ab, 0xe929d298caceb2b9,
-          0x828752b133afdaad, 0x82342fbca2e92fcd, 0xc2c0a4e12ac0fa13, 0xa3485b366505984f, 0x4ff302fee15ec139,
-          0x7f36b6989038be1b, 0x0d9c5d812e662a74, 0x2d6bfae4b1039dd2, 0x1f9d22e18f2b33f8, 0x17822d10e0d58cc4,
-          0x9ad0bb3be40a758f, 0xd5870332751ca294, 0x2b885f0b1df979d9, 0x8514ce121199aa3a, 0x815808cd07d9472f,
-          0xab2e50c2fe2570bb, 0x54b026a1c205a46d, 0xaf29578eac407799, 0xd505382bb56d4216, 0xe93c2b4a037c32f1,
-          0x7027967913ad2b49, 0xcb87924006e128f6, 0xa0453965d18b5e87, 0xea6107587e15a81b, 0xfbb2374bb5c47d54,
-          0x2c894a010bfa248e, 0xa89cee44c7a206b0, 0x038c68fe4ba18adf, 0x149cb4fe38e0407e, 0x5c4d051b645c820f,
-          0x760239448b62e290, 0xfcca91ed6d23319f, 0x44e17aed5a4004ae, 0xc56eda34ec014ed5, 0x7e03730330849994,
-          0x579d534519259c86, 0x5072aa0d2e6d1f14, 0x7d114a1df0f9dc48, 0xbefc2fa9bd9fb2bd, 0x112deb15e8bff0e5,
-          0xa555e1cf63a317f1, 0xf16c402256057501, 0xa3422728e1227499, 0xa28bfdbe1f613cb4, 0x2e0c02180ac37464,
-          0xd05b4732273ebfdd, 0x25099fefcfe7d569, 0x21dfee0754c862b1, 0x26f73135c0d7fb5b, 0x7820c04fc7902dda,
-          0x4c5dc01a1797ed4c, 0x973df19f77f3c9ba, 0x28392284cf742275, 0xeb0ac41557f659f1, 0x2cd64868f401afba,
-          0x29200957294e38d2, 0xcc52b76a1e7d5ed3, 0x41320858102fb448, 0x4e950c62e86337b7, 0xd7ea938e92f71494,
-          0x89094f1f9c176075, 0x34beb851caa46057, 0x6802ac852f77d123, 0xbc58921b4f21e104, 0x59a7080b06ebc654,
-          0x152bb1e53601df0e, 0xf144d687944917bb, 0x9a9bcda2fa1ba107, 0x9a64e007a886bb74, 0x7321499243285770,
-          0x6bf3d9e45fc5ece4, 0x2f6d377359a26078, 0x22746483956667ec, 0xfee71e7cbe2cceff, 0x92e8be1e6b3f33bc,
-          0x4527d2e67468f803, 0xe711cc8b06c12150, 0xfb25815ad2a4e70c, 0x1eab5b2fa9df7762, 0x3091e0ab88f6a4a4,
-          0x267ef927c358ac48, 0x2bb78af21ad6cdb7, 0x0e93c3c442566140, 0xab3093cd1b5f2669, 0x6510baade240151f,
-          0xba8688fbc08c4641, 0x7920a753755443b5, 0x3799d02cd624bbd9, 0x6a22a94095f48a64, 0xd492c98762199d40,
-          0x0b41fc32139d309f, 0xd6c21939045e0f45, 0x40c5b4e5cd002eec, 0x9c025bcbd8d61393, 0x45a9c1a34ce12c19,
-          0xb3e7bd278bba6474, 0x90cfc8e0e59ddc11, 0xb81942dffc38fb8a, 0xfd552c5732de3db7, 0x31bc875c5bc402ef,
-          0x938ce7f48a4ed739, 0x0edb78d166e3013b, 0x44fa8fba2c03afdf, 0xdd9ce7cb7bbb2b9e, 0xfda9a3733ae74598,
-          0xb85ffcc45c0421cb, 0x89bca08d4d5560cc, 0xfd8a24235b8c159b, 0xa8d5e170eda64204, 0xc34b4a236397c830,
-          0x9772c80b0dc70b6d, 0x0d6d354dacf349fd, 0x590a37cb5b7b1e2d, 0x35d9a6ecf225ed99, 0x35d5db235a3cd492,
-          0xa90517288c489b10, 0xb033b5332a62fa74, 0x81794a9a416bea4f, 0x4157554c466a281f, 0x281dedb0dab52f4b,
-          0xd7b1e52317c93b08, 0x7178235a8d813868, 0x93cd4cad94c644b4, 0x958782120f767016, 0x4c39de46cfc16d29,
-          0xebb19cc3212dd085, 0xef3fe319ba5392f0, 0x71fa8d66080e3533, 0xe541e7371607a5fd, 0x72e6f6b34ce08a8b,
-          0xb3603ac796e5d8fe, 0x30e4c0bc172d7098, 0x10f7d9647af3a160, 0x3817ae483b11b325, 0x3eb87ec54900a286,
-          0x254178888036b8ed, 0x0097e14979afce0b, 0x7a099b5e9d16789b, 0xcac9e0d4f7cb614d, 0xcc3f371ddd49ee00,
-          0x64ac2d004033ca68, 0x1b3f3f66b45fe815, 0x599aa92e8d83e359, 0x86e67ed0d9043ced, 0x55cbbc5ddff5d42c,
-          0x40d321e7f4c54a07, 0x712d7864457e9ee1, 0x86936ea8d08db6d4, 0x4c844db25eb600d1, 0x30c7c58d2e48fbed,
-          0xfa3101d9c6a75ea5, 0x7efdc5ba160c41de, 0x405ab15ca125fc30, 0xa7d4f7dbb8df718b, 0xc380f4cfe1d70ccd,
-          0xb14b7d34eb17a13e, 0x4f5abfb2e7121c84, 0x6fd7ecda4a0aab0e, 0xc0b24b010af73c70, 0x26b6cbc4fa65dd5a,
-          0xeaa1dc03bb50cda7, 0xa30c8ab9502adfbc, 0x90222cd63c084108, 0xa28c6fe1121d20d7, 0x8e3b755c71eebfc6,
-          0x019a066b9860bd8b, 0xd67184d9ef2bddee, 0x1552d18dd3a5a775, 0x5c858c30767d8efb, 0x9805b7b284e928cd,
-          0xeac10981eb19fe71, 0x3189711c3c010db3, 0xcaa5472d00aa2e37, 0x3e3619414c85dd59, 0x4aa992f36701a63e,
-          0x42d169b22abe7ab7, 0x9adc431f39e9c2f6, 0xc2f92fb1d904b1df, 0x44a7701f2c049d7e, 0xb0afac06bb855455,
-          0x5c0a3b75b4c762da, 0x76be724ea2bba214, 0x1e9a8580bd577d41, 0x028f4d0308dafe06, 0xec3924b23d7003f5,
-          0xffa9fe2613c7e4ad, 0xb2def8b9f13e36f3, 0x09147ada865f4fcd, 0xa1dd357e04323b24, 0xceef759e9e7499da,
-          0xadb66ff640b06bfa, 0x5e9005583266dc4b, 0x79cc0794be7ed3be, 0x6bdaefd7e7671206, 0x9945f0081aafe417,
-          0x189fe47c4f0f72aa, 0x8f9ca037f15ad564, 0x71a37acded1223a0, 0xa625c4fc328f487f, 0x5128a6d3cdb8900a,
-          0x3ec4a624294b45d6, 0xf5766a5a6e876c83, 0x1ec937fbdd15cef9, 0xcbd00903c7295e95, 0x2516411ac1c327fb,
-          0x368a7687376b631c, 0xd2b7c393c1edfc22, 0x02c0f34d92f4bb72, 0x5434342b96baf006, 0x20e1af8ee827afd5,
-          0x1dcffacc6f0af4c2, 0x6ff73ff2ee5b7fb8, 0x260fbefd6e5baa01, 0x791f693d459ee0cf, 0xddc9edd5ba6e15e4,
-          0xbb0f300504b52250, 0x65ac6adb3e353f3e, 0x306bc64a53c49a9a, 0x3c28898944a9c19b, 0x02c40842bc22a31a,
-          0x94defeed685c4ca2, 0x54d5e98e84af8533, 0x5936ae5d533af8b4, 0x10ef962efcdf7479, 0xed8f3f257ffba9bf,
-          0xfeddab59951b8f37, 0x74ab5adcc2ccfe87, 0xbbda163707e2bb10, 0x96af71b39737021d, 0x6d0fc5be08bd333a,
-          0x2ee8cdf4c02b9ffe, 0x35403bf6d51ef3e9, 0xe7e4292419853569, 0x2c7070a60729b938, 0x4493b2a7b01dfdbf,
-          0x46a685b0807bd04b, 0x0aaee1d439b218e3, 0x6430a6e11cf86247, 0x016512f3e69275db, 0x3016d126b39d57b4,
-          0x7e0f1731b139249e, 0x7f6b91ee51472248, 0xa0b36c3d51a8a67d, 0x369e0368b5c27176, 0x6f97912cb6db01e0,
-          0xf1ce77f531412463, 0xdbc343dbf23625c1, 0xab640860c75cb300, 0x304362e29e4e6d35, 0xa30e41c120432a9c,
-          0x7fcfc1fd01a7dee3, 0xcd47c126d65f5f86, 0xa74dd86c079fc68a, 0xad09891401b716da, 0x7e35479fcc59c74f,
-          0x891fbcac7356d4ea, 0xb4cb4cfff4645fa5, 0x622c8aeba31965e5, 0xc2a6751e1149fe60, 0x87304f57805a5f4b,
-          0x737422b4882c499f, 0xb54227409f9587e2, 0xe78204b11e9808aa, 0xe4c9f099d53e80b2, 0x031542d705fcf416,
-          0xae40803571c84e0a, 0x833e4f413a128f52, 0xcb78f50e74cadf5b, 0xcb927ef4f44696b1, 0xa4122558c72dabea,
-          0xb1079339065f62e7, 0xfa6644e600f06e77, 0x655f873fc0ea5b1c, 0xa17ab79f04b02453, 0x2a529a010d226eaa,
-          0xb85d11aa358f9233, 0xd05101787ac437f7, 0x6eaae33f8c54dd33, 0xe83ec4d1de825535, 0x0944bb3d611dcc39,
-          0x433cbfbb20cb54bc, 0x44952cc366ffce5c, 0xf2a92d06d44d3cab, 0x4ce1fd49e9b062e1, 0x9ade100000000000};
+        static constexpr std::string_view etag{"\"8d10fba9ff5228b3\""};
+        static constexpr std::array<uint8_t, 37235> data{
+          0x53, 0x29, 0x03, 0x52, 0x20, 0x37, 0x3d, 0x16, 0xe8, 0x0e, 0x20, 0x54, 0xde, 0xde, 0xeb, 0x14, 0x1d, 0xa8, 0x61, 0xe3, 0xc0, 0x00, 0x73, 0x5a,
+          0x19, 0x84, 0xaa, 0x97, 0xe2, 0x8d, 0xd1, 0xa4, 0xfe, 0x4a, 0x24, 0xb1, 0xa5, 0x76, 0x57, 0xb1, 0x84, 0x61, 0xf1, 0xc6, 0xd8, 0xf1, 0x86, 0x8d,
+          0x09, 0x7c, 0xc5, 0x4f, 0x56, 0xd5, 0xdc, 0xf8, 0x8f, 0x33, 0x5f, 0xfc, 0x2e, 0x77, 0x21, 0xf6, 0x1b, 0xf4, 0x2a, 0xfc, 0x10, 0x08, 0xf1, 0xc7,
+          0x43, 0xec, 0xf2, 0x97, 0x19, 0x56, 0x6f, 0xf1, 0xe6, 0x0a, 0xf9, 0x64, 0xde, 0x15, 0x4c, 0x26, 0x0f, 0xb4, 0x86, 0xf3, 0x70, 0x21, 0xa8, 0xdc,
+          0x03, 0xbd, 0x93, 0x41, 0x23, 0x6d, 0xd2, 0xe7, 0xc0, 0x49, 0x95, 0xea, 0x26, 0x77, 0x83, 0x3f, 0xd5, 0x3f, 0x10, 0x09, 0xae, 0x54, 0x88, 0x74,
+          0xf6, 0xe8, 0xd6, 0xfd, 0x5b, 0x68, 0x61, 0x15, 0xe0, 0x38, 0xf9, 0x10, 0x09, 0x69, 0xa3, 0x8b, 0xa7, 0x89, 0x66, 0x5a, 0x55, 0xd3, 0xfe, 0x04,
+          0x79, 0x4e, 0x42, 0x62, 0x02, 0xb8, 0x2b, 0xc7, 0x2b, 0xba, 0xff, 0x6e, 0x3f, 0xe4, 0x32, 0xb5, 0xc7, 0x3f, 0x7f, 0x6a, 0xfd, 0xf3, 0xf3, 0xc5,
+          0x6a, 0x9b, 0x7d, 0x11, 0x6e, 0x6c, 0x3b, 0x6e, 0xb8, 0x9c, 0x6b, 0x9a, 0xb1, 0xe3, 0xb6, 0x31, 0xf1, 0x65, 0x34, 0x0f, 0x49, 0x08, 0x19, 0x51,
+          0x56, 0x92, 0x4b, 0x9a, 0xef, 0x97, 0xe6, 0xee, 0x73, 0xb9, 0xcd, 0xbc, 0xbc, 0x8f, 0xc2, 0xc6, 0x20, 0xd9, 0x9b, 0x42, 0x11, 0xa5, 0xf6, 0x29,
+          0x2e, 0x8b, 0xe3, 0x4d, 0x6b, 0x02, 0xf8, 0xff, 0xd4, 0xf4, 0x2b, 0x4a, 0x7b, 0x45, 0xf1, 0x96, 0xae, 0xd1, 0x5b, 0xc6, 0xe7, 0x63, 0xf4, 0xac,
+          0x49, 0xc2, 0x61, 0x00, 0x70, 0x93, 0x28, 0xb7, 0x35, 0xb6, 0xff, 0x9f, 0x95, 0xf4, 0xff, 0x3f, 0x6d, 0xd6, 0xfe, 0x6f, 0x56, 0x2d, 0x75, 0x92,
+          0x16, 0x4c, 0x4b, 0x14, 0x76, 0xe3, 0xe9, 0x91, 0x73, 0x81, 0xc9, 0x86, 0x6c, 0x98, 0x74, 0xef, 0x7d, 0xef, 0x7d, 0x55, 0x82, 0xec, 0x6a, 0xaa,
+          0x0e, 0x86, 0xaf, 0x52, 0xfd, 0xcc, 0x7f, 0x12, 0xc9, 0x6e, 0xa9, 0xc5, 0x77, 0x2e, 0x9d, 0x2e, 0xdc, 0xca, 0xfa, 0xc8, 0x58, 0x00, 0x24, 0x8f,
+          0xb2, 0x76, 0xd0, 0x66, 0xd9, 0xca, 0xfc, 0x92, 0xec, 0xb2, 0xbd, 0xec, 0x81, 0x6c, 0x96, 0x81, 0xc7, 0x80, 0xf1, 0xb2, 0xaa, 0xa6, 0x47, 0x56,
+          0x5f, 0xe9, 0xf5, 0xec, 0xbf, 0xff, 0xa6, 0xda, 0xd7, 0xaf, 0x44, 0x14, 0xaf, 0xe7, 0x42, 0x47, 0x9e, 0x65, 0xbf, 0xb7, 0xa7, 0xaf, 0x8b, 0x9d,
+          0xae, 0x4e, 0x0a, 0x2b, 0xee, 0x2c, 0x82, 0x30, 0x60, 0x44, 0x4a, 0xe6, 0x58, 0x1b, 0x48, 0xba, 0x19, 0x47, 0x7c, 0x56, 0x2d, 0xcb, 0x10, 0x97,
+          0x99, 0xe8, 0x3e, 0x17, 0x5c, 0xab, 0x8a, 0x45, 0xa2, 0x02, 0xe4, 0x6d, 0x66, 0xf9, 0xae, 0x37, 0x96, 0xed, 0x5d, 0x96, 0xf3, 0xfb, 0xbb, 0x2e,
+          0x37, 0xb3, 0x3e, 0xe0, 0xfd, 0x09, 0xb0, 0x5f, 0xaa, 0x2d, 0x0e, 0xc1, 0x09, 0xb2, 0x43, 0xfe, 0xa9, 0xa3, 0xda, 0x96, 0x34, 0x0c, 0x62, 0xc6,
+          0x0c, 0xb8, 0xde, 0xdf, 0x57, 0xa9, 0xd9, 0xcc, 0x9e, 0x59, 0x85, 0x85, 0x62, 0x53, 0xec, 0x6d, 0x9b, 0x7d, 0x3f, 0x5c, 0xa6, 0x00, 0x90, 0xb2,
+          0xda, 0xde, 0xbb, 0xfb, 0xe4, 0xab, 0x2f, 0x17, 0xd6, 0x7f, 0xef, 0xfd, 0xd7, 0xc8, 0x55, 0xac, 0xac, 0x65, 0x54, 0x85, 0x02, 0x2c, 0x80, 0x00,
+          0xa3, 0x49, 0x91, 0xb4, 0x08, 0x82, 0x0a, 0x53, 0x14, 0xfb, 0x2f, 0x59, 0x54, 0x66, 0x16, 0xd8, 0x5d, 0x95, 0x40, 0x77, 0x14, 0x8a, 0x6c, 0x9b,
+          0x84, 0xe4, 0x08, 0x52, 0x52, 0xd8, 0x14, 0xbb, 0x1d, 0x23, 0x2f, 0x27, 0x2d, 0x5e, 0xd7, 0x59, 0x8f, 0x33, 0x97, 0xf3, 0xbe, 0x9d, 0xe6, 0x76,
+          0xf3, 0xcc, 0xa9, 0xed, 0xd3, 0x69, 0x2c, 0xc7, 0xb2, 0xa0, 0xa0, 0x28, 0x3e, 0x2d, 0x3b, 0xcf, 0x36, 0xb9, 0x3b, 0xc5, 0x69, 0xdd, 0x96, 0x0c,
+          0x50, 0xfa, 0xd4, 0x78, 0x3e, 0x32, 0x84, 0x1c, 0xf7, 0x7d, 0x13, 0x53, 0xbf, 0x71, 0x62, 0x35, 0x3e, 0x9b, 0xfd, 0x1b, 0xf1, 0x04, 0x29, 0x9e,
+          0xe0, 0x23, 0x64, 0x2b, 0x5d, 0x45, 0x55, 0x64, 0x4b, 0x7a, 0xd6, 0x07, 0x20, 0xb6, 0x65, 0xbd, 0x43, 0xf1, 0xc9, 0x9d, 0x99, 0xac, 0xb2, 0x4d,
+          0x02, 0x9b, 0xfc, 0x53, 0x55, 0x83, 0x01, 0x63, 0x1b, 0xff, 0x18, 0x49, 0x2d, 0xee, 0xfc, 0x6f, 0x4c, 0xab, 0x69, 0x6e, 0x37, 0x66, 0x93, 0x99,
+          0x93, 0x22, 0x20, 0x22, 0xd5, 0x82, 0xff, 0x91, 0x17, 0xbd, 0xfc, 0x75, 0xd9, 0xb9, 0x4f, 0xee, 0x7f, 0xe5, 0x97, 0x73, 0x4b, 0x07, 0x6a, 0x0d,
+          0x3d, 0xbd, 0x7c, 0x9f, 0x57, 0xaa, 0xa2, 0x15, 0xac, 0xdc, 0x7f, 0xa4, 0xee, 0x10, 0x1f, 0x4a, 0x08, 0x6b, 0x0d, 0x35, 0x11, 0x8a, 0x9c, 0x41,
+          0x2d, 0xe9, 0x0c, 0x7f, 0xcb, 0xb4, 0x7c, 0x02, 0x19, 0xb1, 0x48, 0x22, 0xba, 0x21, 0x2f, 0xb3, 0x21, 0x85, 0x40, 0xab, 0xd1, 0xd6, 0xda, 0x46,
+          0x5b, 0x51, 0x24, 0x42, 0xa1, 0xc1, 0x16, 0x16, 0x45, 0x2e, 0x7c, 0x12, 0x45, 0x3b, 0xde, 0x92, 0x24, 0x6b, 0xe3, 0x12, 0x5c, 0x2f, 0x60, 0x18,
+          0x6b, 0x3b, 0xfe, 0x5a, 0x69, 0x5f, 0x76, 0x17, 0x8a, 0xfc, 0x0b, 0xc8, 0x17, 0xed, 0xfa, 0x99, 0x9f, 0xf9, 0x9f, 0x9e, 0xbb, 0x0d, 0xf9, 0x81,
+          0x33, 0x34, 0x77, 0x9b, 0x4f, 0xbd, 0x81, 0xb3, 0xec, 0x64, 0x9f, 0xfe, 0xfa, 0xb5, 0x50, 0x77, 0xf1, 0xef, 0xa2, 0xf6, 0xab, 0xf8, 0x16, 0x41,
+          0x5d, 0x79, 0xf8, 0x32, 0x6b, 0xd6, 0x25, 0xd5, 0x37, 0x2b, 0x75, 0x5d, 0xee, 0x4a, 0x4c, 0x3f, 0x91, 0x10, 0xa4, 0x27, 0x9e, 0x3b, 0x40, 0xba,
+          0x6c, 0xe6, 0xa9, 0xc1, 0x69, 0x48, 0x66, 0x4a, 0x50, 0x62, 0xff, 0x62, 0x65, 0xaa, 0x32, 0x1a, 0x35, 0x60, 0x0c, 0xac, 0x99, 0xb0, 0xf8, 0xec,
+          0x0d, 0xfc, 0xd1, 0xe4, 0x8f, 0x3e, 0xae, 0xca, 0xe7, 0x56, 0xc5, 0x50, 0xbc, 0x0d, 0x70, 0x97, 0x57, 0x75, 0x28, 0x6f, 0x1f, 0xc6, 0x64, 0x75,
+          0xa6, 0x87, 0xc3, 0x37, 0x2a, 0xef, 0xbc, 0x9d, 0x47, 0x7a, 0xf1, 0xc2, 0xe7, 0x86, 0x29, 0x92, 0xaa, 0x22, 0x26, 0x8c, 0xd9, 0xe7, 0x62, 0xb1,
+          0xa0, 0xe6, 0xcf, 0x03, 0x28, 0x65, 0xcf, 0x5d, 0x21, 0xae, 0xf0, 0x7f, 0xe7, 0xce, 0x39, 0x5f, 0x1e, 0xdb, 0xe1, 0x77, 0x5c, 0xb7, 0xbe, 0x2c,
+          0xcb, 0x16, 0xb5, 0x20, 0x64, 0xfd, 0xbc, 0x78, 0xfb, 0xdf, 0x3c, 0x73, 0xe3, 0x22, 0x5a, 0xb4, 0xa9, 0x67, 0xde, 0x66, 0xf1, 0xf8, 0xfe, 0xba,
+          0xcc, 0x56, 0xb7, 0x8b, 0x96, 0x49, 0xfc, 0x9a, 0x86, 0xf5, 0x7f, 0x96, 0x72, 0xc1, 0xaf, 0xec, 0x71, 0x6d, 0xad, 0x71, 0xe7, 0x1b, 0xaf, 0xda,
+          0x08, 0xf2, 0xcc, 0xae, 0x6b, 0x1b, 0xf6, 0x85, 0x52, 0xef, 0xf6, 0x3f, 0xc2, 0x22, 0x5e, 0x42, 0x14, 0x95, 0x4f, 0x61, 0x27, 0xc1, 0x5e, 0x55,
+          0xa2, 0x5f, 0x9c, 0xd4, 0x06, 0x56, 0xa7, 0xa9, 0x26, 0x77, 0xb1, 0xf8, 0xf3, 0xb4, 0x9c, 0xc2, 0xbb, 0x9b, 0xfd, 0xb7, 0xd9, 0xb9, 0x72, 0xc0,
+          0x2f, 0x1e, 0x0b, 0x55, 0xd5, 0x4a, 0xd4, 0x5c, 0x41, 0x3a, 0xe1, 0xbe, 0xe1, 0x06, 0x95, 0x3b, 0xfc, 0x5d, 0x47, 0xc0, 0x54, 0x7f, 0x58, 0xac,
+          0xb8, 0x75, 0x09, 0x07, 0x0c, 0xbb, 0x54, 0x91, 0x8a, 0xeb, 0xd9, 0xc1, 0x35, 0xbf, 0xa4, 0x01, 0xe3, 0xc2, 0xc0, 0xfa, 0xd5, 0xa0, 0x49, 0x3c,
+          0x13, 0x59, 0x2e, 0x2e, 0xdf, 0xb7, 0x1b, 0x98, 0x1b, 0xb8, 0x53, 0xfd, 0x37, 0xe8, 0x10, 0xea, 0xdc, 0x68, 0xc5, 0xa5, 0x8d, 0x16, 0xc8, 0x15,
+          0xb6, 0x11, 0x12, 0xaa, 0x26, 0xe7, 0x9c, 0x96, 0x0b, 0xbc, 0x22, 0x4d, 0xdb, 0x55, 0x3f, 0xbf, 0x77, 0x67, 0x9c, 0x60, 0xd4, 0x53, 0x23, 0x5f,
+          0x96, 0x5e, 0x94, 0x58, 0x5d, 0xd9, 0x66, 0x5a, 0xb6, 0xb8, 0x45, 0xf6, 0xf1, 0x56, 0x73, 0xed, 0x94, 0xc0, 0x87, 0x76, 0xea, 0x56, 0x85, 0x12,
+          0x11, 0x6a, 0x23, 0x6a, 0xa4, 0xe8, 0xe2, 0xee, 0x62, 0x8b, 0xc2, 0xe8, 0x81, 0x1b, 0x61, 0xc7, 0xe9, 0x62, 0x07, 0x1d, 0x6d, 0x9e, 0x93, 0x3c,
+          0xce, 0x87, 0xb6, 0x36, 0x0a, 0x78, 0x35, 0xe8, 0x39, 0x62, 0x69, 0x1e, 0xe6, 0xd1, 0x9b, 0x08, 0xbe, 0xf1, 0xf5, 0xe0, 0x10, 0x00, 0xaa, 0xd1,
+          0xaf, 0x47, 0xe8, 0x64, 0xad, 0xc1, 0x2b, 0x56, 0x82, 0x2c, 0x5d, 0x08, 0xe9, 0x4e, 0x24, 0x84, 0xfa, 0xa3, 0xbb, 0x1f, 0xc6, 0x03, 0xa5, 0xc3,
+          0xe9, 0x57, 0xe6, 0x25, 0xd4, 0xd1, 0xdd, 0x89, 0x0f, 0x13, 0xfb, 0x79, 0xd5, 0x25, 0x05, 0x65, 0x1a, 0x69, 0xd2, 0xa5, 0x89, 0x90, 0x86, 0xb8,
+          0xa4, 0xef, 0xe8, 0x14, 0x98, 0x20, 0xe1, 0x26, 0x3e, 0x03, 0xae, 0x7f, 0x68, 0x67, 0x3c, 0xfb, 0xed, 0xfa, 0xd9, 0xfb, 0xe7, 0x5b, 0x78, 0xdb,
+          0xa0, 0x3e, 0x16, 0xfd, 0xfe, 0x35, 0x1c, 0x26, 0xe7, 0x76, 0x52, 0x36, 0x7a, 0x99, 0xae, 0xb1, 0x3b, 0x9c, 0xd5, 0xfa, 0xc1, 0x88, 0xd8, 0x86,
+          0x56, 0xe3, 0x5c, 0x39, 0xac, 0x59, 0xaa, 0xcc, 0xfd, 0x70, 0x6b, 0xde, 0x66, 0x08, 0xb6, 0x86, 0x1e, 0x66, 0xe6, 0x90, 0x53, 0x35, 0xe5, 0x96,
+          0x22, 0x03, 0x5e, 0x7d, 0x34, 0xed, 0x76, 0xac, 0x4d, 0xe9, 0x5d, 0xe6, 0x6b, 0x10, 0x4e, 0x15, 0x80, 0x0a, 0x19, 0xd1, 0x3b, 0x9b, 0x7a, 0xea,
+          0xc6, 0xee, 0x53, 0xfb, 0xb8, 0x7c, 0xa1, 0xdd, 0x2b, 0xe6, 0x6d, 0xb0, 0xed, 0x2e, 0x96, 0x83, 0x46, 0x94, 0xd3, 0xd5, 0x3e, 0x2e, 0x33, 0x66,
+          0xfb, 0x3f, 0x85, 0x70, 0xf4, 0xa6, 0x75, 0x78, 0x77, 0x3a, 0x45, 0x7e, 0x2d, 0xa8, 0xf9, 0xee, 0x07, 0x8e, 0x45, 0x03, 0x95, 0x16, 0x5d, 0x2f,
+          0xbc, 0x00, 0xbf, 0xcf, 0x77, 0x3b, 0xcc, 0xd3, 0xaa, 0x48, 0x9e, 0xb3, 0xc3, 0xc2, 0x99, 0x59, 0xae, 0x4d, 0xfc, 0xa1, 0xb9, 0x06, 0xc2, 0xbb,
+          0xfb, 0x62, 0xaa, 0x6b, 0xc1, 0xe9, 0xc9, 0x6b, 0x3f, 0xa3, 0xb7, 0x4f, 0xeb, 0xba, 0xee, 0x80, 0xe4, 0x5a, 0xb7, 0x69, 0x80, 0x44, 0x44, 0x17,
+          0x0c, 0x3b, 0x8c, 0x87, 0x9e, 0xf6, 0x92, 0x4d, 0xc2, 0x9a, 0xcc, 0xfa, 0x2a, 0x31, 0x75, 0xd1, 0xd7, 0x78, 0xac, 0x5b, 0x4a, 0x0a, 0xd9, 0xfa,
+          0xbf, 0x42, 0xba, 0xac, 0x16, 0x59, 0x2a, 0x47, 0xea, 0xbd, 0x39, 0x0e, 0xfe, 0xde, 0xd9, 0x2c, 0x81, 0xb7, 0x9b, 0x23, 0x71, 0xff, 0x6a, 0xb2,
+          0x97, 0x28, 0x2b, 0x57, 0x5f, 0x11, 0xa7, 0xd8, 0xcb, 0xd1, 0x70, 0x1a, 0xde, 0x02, 0x41, 0x6c, 0x55, 0x1e, 0x78, 0x8f, 0x22, 0x26, 0xe4, 0x93,
+          0xf3, 0x9e, 0xe0, 0xd9, 0x63, 0x37, 0x54, 0x0e, 0xf5, 0x14, 0x5b, 0x49, 0xcd, 0xfa, 0xdb, 0x15, 0x19, 0xb1, 0x6c, 0xa9, 0xac, 0x77, 0x55, 0xe9,
+          0x3d, 0x0e, 0x13, 0xc1, 0xb2, 0x8a, 0xc3, 0xf2, 0xe2, 0xf9, 0x79, 0x04, 0x3a, 0x0d, 0x08, 0xfb, 0x4f, 0x05, 0x62, 0x4b, 0x88, 0x43, 0x6c, 0x9b,
+          0xc3, 0xe2, 0x50, 0x7e, 0x75, 0x67, 0xf1, 0xa5, 0xed, 0xeb, 0xf1, 0xdc, 0x57, 0x1b, 0x6d, 0x60, 0xcd, 0x7a, 0x7b, 0x50, 0x22, 0x63, 0x28, 0xd1,
+          0xbb, 0x78, 0xde, 0x74, 0x12, 0x0c, 0xa2, 0x86, 0xea, 0x75, 0xde, 0xde, 0x6e, 0xb1, 0x3f, 0x3f, 0x5e, 0xaf, 0x8f, 0xd7, 0xfe, 0xfc, 0xb1, 0x0b,
+          0x06, 0x7d, 0xd4, 0xae, 0x09, 0xfe, 0x9c, 0xa6, 0xc6, 0xa2, 0x8a, 0x58, 0x36, 0x5f, 0xea, 0xed, 0xf3, 0x18, 0xc4, 0x84, 0x75, 0x4d, 0xe1, 0xd7,
+          0xf6, 0xc7, 0x8f, 0x65, 0xf7, 0xd3, 0x13, 0xe1, 0xcb, 0xec, 0x64, 0xae, 0x3e, 0x58, 0xd5, 0x40, 0x1a, 0x5a, 0x46, 0x6a, 0x55, 0x05, 0xb4, 0x53,
+          0x9e, 0x87, 0x7e, 0xb7, 0x88, 0xcb, 0x22, 0xc2, 0x51, 0x71, 0x78, 0x7f, 0xaa, 0x88, 0xee, 0x0f, 0xe7, 0xc5, 0xd6, 0xab, 0xd0, 0xa2, 0xb5, 0x05,
+          0xaf, 0x27, 0x24, 0xa0, 0xd0, 0x38, 0x5d, 0x78, 0xab, 0xd8, 0x61, 0x6f, 0xe0, 0xfd, 0xb4, 0x61, 0x15, 0x28, 0x41, 0xcb, 0xf9, 0xb7, 0x88, 0xc0,
+          0x1b, 0xd4, 0xbf, 0x5a, 0x99, 0xd3, 0x94, 0xc0, 0x80, 0x1e, 0xaa, 0xa2, 0xd6, 0x53, 0x04, 0x8a, 0x7b, 0xa6, 0xd2, 0x60, 0xc9, 0x81, 0x3f, 0x89,
+          0x43, 0xc5, 0xe5, 0xc3, 0x32, 0x7a, 0x60, 0xb7, 0x89, 0x28, 0x4c, 0xd1, 0x31, 0x68, 0x7f, 0x1f, 0x2d, 0x73, 0x5f, 0x68, 0x1a, 0xd6, 0x50, 0x9a,
+          0x6d, 0x76, 0x80, 0xbe, 0xfa, 0x8f, 0xf0, 0x1e, 0xcc, 0x04, 0xfe, 0x65, 0x58, 0x66, 0xa7, 0x5b, 0x17, 0x2b, 0x50, 0x55, 0x1c, 0x11, 0x5c, 0xc0,
+          0x2c, 0x52, 0xf5, 0x2f, 0xfc, 0x06, 0xab, 0x85, 0x9a, 0x26, 0xf6, 0x65, 0xa4, 0x76, 0x51, 0xf2, 0xbc, 0xda, 0xd5, 0x31, 0x04, 0x4a, 0x5d, 0x39,
+          0x4b, 0x28, 0x09, 0xa1, 0x46, 0xa2, 0xa6, 0x33, 0x48, 0x5c, 0xa1, 0x14, 0xb4, 0x5a, 0x82, 0x29, 0xb5, 0x34, 0x08, 0x06, 0x78, 0x2d, 0x23, 0xb0,
+          0xbf, 0x7e, 0xc6, 0x35, 0xd2, 0xf3, 0x96, 0x82, 0x9e, 0xb8, 0xff, 0x8f, 0x98, 0xed, 0xea, 0x72, 0x02, 0xaf, 0xae, 0x4f, 0x68, 0x87, 0x3c, 0x3e,
+          0xad, 0x5d, 0x0c, 0xfd, 0xe8, 0xfa, 0xf6, 0x54, 0xdd, 0x88, 0x4d, 0x75, 0xf4, 0xf9, 0xc8, 0x4f, 0xd5, 0x9a, 0x24, 0x28, 0xae, 0x3a, 0x07, 0xc8,
+          0x97, 0x5b, 0xdc, 0xcd, 0x87, 0x2d, 0x3d, 0xa7, 0x57, 0xdb, 0x63, 0x46, 0x93, 0x8f, 0x87, 0xae, 0x35, 0xe7, 0xed, 0xb0, 0x37, 0xc4, 0x79, 0x12,
+          0x84, 0x65, 0x85, 0x15, 0x1f, 0x81, 0x79, 0x6b, 0x86, 0x2f, 0xb3, 0xfe, 0x5f, 0x27, 0x2d, 0x7c, 0x6f, 0xb3, 0xd5, 0x34, 0xc6, 0x29, 0x43, 0x28,
+          0x96, 0xd5, 0x84, 0x71, 0x34, 0x64, 0x3a, 0xe5, 0x17, 0x95, 0x97, 0xc6, 0x97, 0xcf, 0x28, 0xc4, 0xb5, 0x09, 0x93, 0xc0, 0x74, 0xfb, 0x3c, 0xc3,
+          0x89, 0xad, 0x5e, 0x96, 0x84, 0xf7, 0x4b, 0x33, 0x56, 0x52, 0x99, 0x28, 0x55, 0xae, 0x7e, 0x49, 0xea, 0x52, 0xde, 0x55, 0x52, 0xf6, 0x25, 0x90,
+          0x85, 0x50, 0xd2, 0xf7, 0x20, 0x00, 0x4a, 0x44, 0xdd, 0xc9, 0x62, 0xef, 0x6b, 0xfe, 0x03, 0xbc, 0xac, 0x6c, 0xa6, 0x09, 0x50, 0xa5, 0x12, 0x09,
+          0xa7, 0xef, 0xcb, 0x63, 0x94, 0x87, 0x3b, 0x68, 0xd5, 0xfd, 0xc4, 0xd9, 0xb3, 0xf0, 0x87, 0x79, 0x7b, 0xd5, 0xa3, 0xdd, 0x66, 0xf9, 0x37, 0x94,
+          0x3f, 0xe3, 0xd3, 0x6b, 0xb5, 0xc0, 0x92, 0xd5, 0xff, 0xfb, 0xc4, 0x77, 0x86, 0xd6, 0xc1, 0x92, 0x53, 0xec, 0x38, 0x22, 0x1d, 0x05, 0x9d, 0xc2,
+          0x55, 0xb3, 0x17, 0x5e, 0x18, 0x88, 0x4d, 0x80, 0xcb, 0xdb, 0x0e, 0x16, 0x42, 0x20, 0xcc, 0x61, 0xe2, 0x06, 0x47, 0x9e, 0x43, 0x77, 0x6a, 0x0f,
+          0xca, 0x61, 0x63, 0xb9, 0xe9, 0xc9, 0x55, 0x35, 0xce, 0xae, 0xb6, 0x0d, 0x0a, 0xba, 0xae, 0x58, 0x15, 0x30, 0xbb, 0xb3, 0x50, 0x01, 0x16, 0xd9,
+          0x3b, 0x4b, 0x96, 0xe5, 0x3b, 0x0a, 0x72, 0x10, 0x29, 0xda, 0x43, 0x02, 0xb8, 0xfe, 0xe6, 0x9f, 0x7a, 0x5f, 0xce, 0x0f, 0xaa, 0xe7, 0x78, 0x64,
+          0x87, 0x07, 0xf5, 0xa5, 0xd7, 0xe3, 0xb2, 0xd0, 0x81, 0x73, 0xc3, 0xfe, 0x69, 0x5e, 0xb5, 0x4b, 0xfa, 0x15, 0xe3, 0x02, 0x93, 0x44, 0xfa, 0x98,
+          0xf7, 0x4c, 0x38, 0x9c, 0xf2, 0xf6, 0xc2, 0x34, 0xf3, 0x4a, 0x3a, 0x58, 0x07, 0x2a, 0x4f, 0xcc, 0x4a, 0xcd, 0x4f, 0x2b, 0xc6, 0xf4, 0xfc, 0xb8,
+          0xcf, 0x22, 0x20, 0x27, 0x0c, 0xff, 0x41, 0x40, 0xb6, 0xec, 0x14, 0x6e, 0x76, 0x6c, 0x92, 0xd1, 0xab, 0xfe, 0x9a, 0x24, 0x3b, 0x4d, 0x1b, 0x80,
+          0xdc, 0x1d, 0xeb, 0x0f, 0xaf, 0xbc, 0x2f, 0x5e, 0x0f, 0x0c, 0xc1, 0x15, 0x07, 0x03, 0xc4, 0xff, 0xe3, 0x08, 0x1c, 0x46, 0x80, 0xa1, 0x86, 0x89,
+          0x5a, 0xdb, 0x42, 0x45, 0x50, 0x96, 0xae, 0x5b, 0x25, 0x1c, 0xb5, 0x78, 0xe3, 0x81, 0xef, 0x50, 0x67, 0x9b, 0xb4, 0x67, 0xdc, 0x38, 0xae, 0x64,
+          0x99, 0x78, 0xae, 0xfd, 0xe1, 0x73, 0x16, 0x63, 0x65, 0x26, 0x08, 0x59, 0x62, 0xbb, 0xc8, 0x92, 0x7a, 0xe3, 0xc9, 0x65, 0x5b, 0x37, 0xef, 0xfd,
+          0x78, 0x4e, 0x40, 0xf7, 0x1e, 0xee, 0x7d, 0x9d, 0xec, 0xd6, 0xd7, 0x56, 0x17, 0xf8, 0xf6, 0x48, 0x1b, 0x13, 0xe4, 0x77, 0x14, 0x81, 0xf0, 0xbf,
+          0xda, 0x51, 0xf9, 0x80, 0xa3, 0xd6, 0x4b, 0x6c, 0x0d, 0xc5, 0x00, 0xdf, 0xe4, 0x1c, 0x31, 0x82, 0x31, 0xee, 0x15, 0x49, 0xea, 0xdb, 0x3d, 0xa7,
+          0x37, 0x0c, 0x23, 0x0d, 0xfe, 0x4a, 0xc9, 0xfd, 0x0a, 0x81, 0xd4, 0x3b, 0xde, 0xe5, 0x27, 0x9a, 0xed, 0xee, 0x00, 0xe5, 0xfc, 0xad, 0x3f, 0xbd,
+          0x36, 0x0d, 0x80, 0xcc, 0xff, 0x36, 0xf1, 0x27, 0x1a, 0xd7, 0x90, 0x45, 0x8f, 0xe9, 0x69, 0x82, 0xff, 0x8b, 0x42, 0xd4, 0xc5, 0x18, 0x87, 0xfd,
+          0x10, 0x43, 0x5d, 0x4f, 0x72, 0x3d, 0xc7, 0x2a, 0x95, 0xd1, 0xe9, 0x24, 0xf6, 0xec, 0x23, 0xe3, 0xb9, 0xef, 0x62, 0xb8, 0x6b, 0x8c, 0xca, 0xb5,
+          0xc3, 0x5e, 0x1f, 0x9a, 0xfb, 0xf9, 0x46, 0x28, 0x5d, 0x17, 0x4b, 0x16, 0xe0, 0xa6, 0x97, 0x72, 0x8c, 0x04, 0x9c, 0xd3, 0x95, 0x77, 0xb1, 0x6b,
+          0x47, 0x93, 0x41, 0x0f, 0x51, 0xad, 0x10, 0x24, 0x6f, 0x73, 0x02, 0x43, 0x89, 0xa3, 0xa9, 0x72, 0x9b, 0x42, 0xf8, 0x96, 0xbb, 0x93, 0x40, 0x98,
+          0xab, 0xc1, 0xfb, 0xc6, 0x56, 0x3c, 0x0f, 0x2b, 0x93, 0x35, 0x17, 0x5a, 0xbe, 0xa4, 0xdb, 0xb5, 0x7d, 0xec, 0x5a, 0x3f, 0x8d, 0x72, 0x9d, 0xc3,
+          0x45, 0xf0, 0x24, 0x92, 0xee, 0x39, 0x85, 0x78, 0x1c, 0x7d, 0x80, 0xa1, 0xda, 0xef, 0x80, 0x56, 0x9f, 0xe7, 0x4f, 0x6c, 0x99, 0x24, 0x03, 0x8a,
+          0x4d, 0x3e, 0x29, 0xd7, 0x9e, 0x68, 0x50, 0x08, 0xa4, 0x2a, 0xd9, 0x26, 0x7d, 0xc6, 0x53, 0xfe, 0xbe, 0x09, 0xab, 0x92, 0xb9, 0x8b, 0x1e, 0x6f,
+          0x41, 0xe9, 0xa1, 0x37, 0x10, 0x4e, 0x9c, 0x50, 0xaa, 0xae, 0xd5, 0xe0, 0xae, 0x01, 0x2a, 0x0f, 0xa7, 0x82, 0xb5, 0x5e, 0x3f, 0x9c, 0x76, 0x01,
+          0xaa, 0xfd, 0xd9, 0x1d, 0x5d, 0xcd, 0x0e, 0x51, 0x07, 0xd3, 0xaf, 0x48, 0x85, 0x5f, 0x9e, 0x85, 0xa1, 0x4f, 0x51, 0x6c, 0x9e, 0x14, 0xcb, 0x58,
+          0x09, 0x55, 0xcf, 0x02, 0x29, 0x5a, 0x7e, 0xb8, 0xa4, 0x5a, 0x27, 0xd4, 0xc2, 0xf4, 0xdb, 0x53, 0x18, 0x65, 0xb5, 0x88, 0x03, 0x47, 0x17, 0xfd,
+          0x2d, 0x15, 0xd9, 0x34, 0xed, 0x8e, 0xb7, 0xa5, 0x0b, 0x6c, 0xe0, 0x11, 0x1c, 0xa9, 0x6c, 0x1d, 0x23, 0x6b, 0xcc, 0xe0, 0xb4, 0xc7, 0xc0, 0x7c,
+          0x78, 0x14, 0xfb, 0xa1, 0x56, 0x94, 0x5f, 0x9e, 0x5d, 0xea, 0xc7, 0xf1, 0xe1, 0xd0, 0x7a, 0xc1, 0xc8, 0x4f, 0x44, 0x32, 0x5f, 0xca, 0xd5, 0x74,
+          0x6e, 0xe8, 0xb1, 0x50, 0x35, 0x10, 0x18, 0xc4, 0x64, 0x8e, 0x44, 0xb8, 0xfb, 0x3a, 0x13, 0x4a, 0x14, 0x75, 0xe4, 0xa7, 0x0c, 0x85, 0xd7, 0x11,
+          0xe5, 0xfb, 0x51, 0xc9, 0x4a, 0x36, 0xae, 0x79, 0x19, 0xd7, 0x4a, 0xd8, 0x00, 0xf2, 0x19, 0x0a, 0x76, 0x60, 0x02, 0xa5, 0x71, 0xb2, 0x1e, 0x40,
+          0xee, 0x75, 0xab, 0x85, 0xd0, 0x43, 0x26, 0x54, 0x05, 0xeb, 0x8d, 0xb6, 0x57, 0x12, 0x1a, 0xdc, 0x5a, 0x40, 0x90, 0x69, 0x34, 0xe1, 0xc4, 0x23,
+          0x2b, 0x35, 0x7b, 0x13, 0x39, 0xa6, 0x29, 0x20, 0xe0, 0x22, 0x95, 0xab, 0x8e, 0x7e, 0x24, 0x10, 0x5c, 0x69, 0x2c, 0x92, 0x0c, 0xad, 0xfb, 0x06,
+          0xae, 0x90, 0xe2, 0xc9, 0x75, 0xc0, 0x36, 0x73, 0xea, 0x13, 0xd4, 0xa6, 0x22, 0x65, 0x3b, 0x02, 0x09, 0x64, 0x5c, 0xda, 0x8a, 0x79, 0x4e, 0x72,
+          0xb8, 0xe0, 0x4a, 0xbf, 0x3c, 0xa5, 0x49, 0xd3, 0x31, 0x04, 0x35, 0x67, 0x0d, 0x2c, 0x4b, 0xbe, 0xf1, 0x5b, 0xed, 0x54, 0x88, 0xd9, 0x04, 0xfc,
+          0x46, 0x10, 0x05, 0x53, 0xb5, 0x23, 0x05, 0x37, 0xc9, 0xf5, 0x28, 0x11, 0xd8, 0x39, 0x52, 0xae, 0x18, 0x89, 0xf2, 0x72, 0xe0, 0x55, 0x4f, 0x58,
+          0x45, 0x65, 0x6f, 0x44, 0xd3, 0xcb, 0x8b, 0x5a, 0xa6, 0x1d, 0xc0, 0x78, 0xc7, 0xd0, 0xda, 0x3a, 0x91, 0x49, 0x89, 0x35, 0x1e, 0x94, 0x87, 0x3b,
+          0xa4, 0x57, 0xb2, 0x51, 0xfe, 0xc2, 0x50, 0x87, 0x26, 0x4c, 0x11, 0x1e, 0x38, 0xad, 0xeb, 0x17, 0x6b, 0xf9, 0xc2, 0x5c, 0xa4, 0x5c, 0xe8, 0x5c,
+          0x26, 0x04, 0x6a, 0x00, 0x0b, 0x44, 0x82, 0xfc, 0x1e, 0x4b, 0xdf, 0x0d, 0x42, 0xf9, 0xc1, 0xc2, 0xc9, 0x4e, 0x95, 0xdc, 0x23, 0x93, 0xb5, 0x41,
+          0x30, 0x2e, 0xab, 0xb4, 0xe2, 0x87, 0x02, 0x1f, 0x2d, 0x82, 0x6e, 0x41, 0x62, 0x81, 0x79, 0x8c, 0x39, 0x5a, 0xd1, 0x86, 0x62, 0x30, 0x5c, 0xa1,
+          0x11, 0x5b, 0x4c, 0x8a, 0xf2, 0x1d, 0xc7, 0x0d, 0x29, 0xb9, 0x2a, 0xc4, 0x29, 0xe0, 0x05, 0x40, 0x0f, 0xf3, 0xe2, 0x61, 0x2e, 0x19, 0xd8, 0x12,
+          0x2d, 0xe7, 0xbe, 0x9b, 0xcd, 0x10, 0x05, 0x23, 0xf2, 0x85, 0x7f, 0x1a, 0x94, 0x25, 0xa8, 0x5c, 0xd6, 0x98, 0x6c, 0x58, 0x94, 0xa1, 0xcd, 0x3b,
+          0x34, 0x2a, 0x9d, 0x8e, 0xc5, 0xcc, 0xd0, 0xf9, 0x6c, 0x24, 0x09, 0x2d, 0x7b, 0xac, 0x63, 0x1b, 0x64, 0x25, 0x45, 0xf5, 0x3d, 0xe3, 0x18, 0x0a,
+          0xb2, 0x3f, 0xa4, 0x9c, 0x22, 0xea, 0x1b, 0x06, 0x90, 0xd2, 0xe4, 0x77, 0x5a, 0x42, 0x32, 0x5b, 0x5a, 0x51, 0xd7, 0x35, 0xf0, 0x26, 0xcd, 0xd1,
+          0xb6, 0xed, 0x05, 0x43, 0x12, 0x8b, 0xd6, 0x64, 0xcb, 0x17, 0xe6, 0x9a, 0xb4, 0x3f, 0x84, 0xca, 0x68, 0xe4, 0x73, 0xbb, 0x01, 0x76, 0x00, 0xc6,
+          0x07, 0x12, 0xc8, 0x55, 0x22, 0xcf, 0x22, 0x36, 0x79, 0xa4, 0x34, 0x57, 0xf5, 0x7f, 0x14, 0xac, 0xb9, 0xa5, 0xa8, 0x2d, 0x4d, 0x6b, 0x94, 0x87,
+          0x48, 0xad, 0x56, 0x56, 0xb6, 0x0c, 0x80, 0xdd, 0x24, 0x73, 0x4a, 0x3d, 0xb5, 0xc1, 0xed, 0xa1, 0x72, 0xab, 0xf1, 0x8e, 0xa8, 0x63, 0x6b, 0x7e,
+          0x00, 0x49, 0x9a, 0x9b, 0xc4, 0x84, 0xf5, 0x8c, 0xa8, 0xd0, 0x4a, 0x98, 0x4d, 0x9c, 0x05, 0x49, 0x35, 0x98, 0x7e, 0x77, 0x2a, 0x7c, 0x52, 0xc9,
+          0x74, 0x34, 0x65, 0xe0, 0xb6, 0xb4, 0x74, 0x49, 0xfa, 0xb2, 0x0e, 0x4b, 0x04, 0x4a, 0x8b, 0x46, 0xd2, 0xb8, 0x40, 0xaf, 0x3b, 0x7f, 0x3c, 0xc1,
+          0x9f, 0xe3, 0x1a, 0xa5, 0xb4, 0x5d, 0x94, 0xe7, 0x28, 0x49, 0x6c, 0x24, 0x1b, 0xe9, 0x1b, 0x41, 0x92, 0xa5, 0x11, 0x5d, 0x88, 0xfd, 0x0d, 0x22,
+          0xe9, 0x61, 0x89, 0x35, 0x98, 0xd8, 0xf7, 0x52, 0x06, 0x2a, 0x9f, 0x15, 0xcf, 0x9d, 0x22, 0xb4, 0x1f, 0xc5, 0x65, 0x60, 0x0d, 0x30, 0x72, 0xb4,
+          0x97, 0x19, 0x7b, 0x03, 0x68, 0x0d, 0x73, 0x40, 0x39, 0x61, 0xb7, 0xc6, 0x99, 0xab, 0xfd, 0x79, 0xf9, 0x45, 0x68, 0x68, 0xe8, 0x8a, 0x9f, 0x5c,
+          0x8f, 0xbf, 0x6c, 0x5a, 0x13, 0x22, 0x74, 0x89, 0x0a, 0xe4, 0x03, 0x61, 0x21, 0xe7, 0x3e, 0x74, 0xae, 0x37, 0x87, 0xa4, 0x81, 0x38, 0x72, 0xce,
+          0x66, 0xf9, 0x3e, 0xc0, 0xc8, 0xf5, 0x08, 0xf2, 0x81, 0xc8, 0x4f, 0x2c, 0x5f, 0xdc, 0x24, 0x76, 0xb1, 0x49, 0x7f, 0xd6, 0x9a, 0x30, 0xd7, 0xdf,
+          0x66, 0x1b, 0xca, 0xcf, 0xc2, 0x22, 0x0f, 0x3e, 0xae, 0xa1, 0x12, 0x8e, 0x97, 0x65, 0xfc, 0x88, 0x9e, 0xe1, 0xaa, 0xfc, 0x02, 0xef, 0x08, 0x9f,
+          0x5b, 0x71, 0xd0, 0xa8, 0x06, 0xe0, 0xae, 0x5c, 0x9f, 0xee, 0xcf, 0x5b, 0xa9, 0xf3, 0x64, 0xfc, 0x8c, 0x5c, 0xb4, 0xa8, 0x7c, 0x50, 0xb2, 0xa2,
+          0x95, 0x8b, 0x7e, 0x2a, 0xb8, 0x51, 0xd0, 0x53, 0x2a, 0xb7, 0x7f, 0x04, 0x24, 0x53, 0x1d, 0x03, 0x64, 0x08, 0x7f, 0x2d, 0x80, 0x28, 0xcb, 0xb8,
+          0x88, 0x57, 0xce, 0x75, 0x9d, 0xd4, 0x46, 0x1c, 0xad, 0x48, 0x15, 0xfe, 0xd6, 0x3a, 0x5b, 0xb3, 0x12, 0x10, 0xf1, 0x20, 0x55, 0xc1, 0xb1, 0x5c,
+          0xfb, 0x7f, 0x6e, 0x32, 0x22, 0x86, 0xb1, 0x1c, 0xdd, 0x93, 0x40, 0x8c, 0x21, 0x4b, 0x6a, 0xf6, 0x58, 0xe1, 0xac, 0x08, 0x63, 0x76, 0x29, 0xf0,
+          0xd2, 0xe1, 0x75, 0xc5, 0xc7, 0x83, 0xe8, 0xe4, 0x56, 0xdb, 0x3c, 0x1f, 0xf1, 0xba, 0x7b, 0x23, 0xa4, 0x1c, 0x13, 0x52, 0x95, 0x3a, 0xa3, 0x94,
+          0x57, 0x21, 0x3b, 0x08, 0x67, 0x69, 0x59, 0xe2, 0xc2, 0x02, 0xe5, 0x94, 0x15, 0x37, 0x60, 0x50, 0x58, 0xc8, 0xc0, 0x4b, 0x82, 0xf9, 0xa5, 0xa6,
+          0xe2, 0xb5, 0x84, 0x1a, 0x13, 0xe4, 0xa8, 0x70, 0x7c, 0x5e, 0x13, 0xa4, 0xd7, 0xb8, 0x65, 0x3b, 0xe3, 0x9f, 0x6b, 0x6f, 0x97, 0x24, 0x1a, 0x9a,
+          0x2b, 0x1b, 0xc2, 0x34, 0x4d, 0x20, 0xcd, 0xaf, 0x48, 0xf0, 0xcc, 0x47, 0x11, 0x21, 0xc0, 0x2a, 0x2a, 0x1d, 0x8e, 0xad, 0x37, 0x6b, 0x46, 0x65,
+          0x51, 0xca, 0x94, 0x0d, 0x3a, 0xf2, 0x89, 0xf1, 0xce, 0x66, 0xeb, 0x5b, 0x35, 0xa4, 0x66, 0x38, 0xb7, 0x95, 0x28, 0x40, 0x94, 0x27, 0x88, 0xad,
+          0xed, 0xbd, 0x2d, 0x45, 0x35, 0xdc, 0x04, 0xba, 0xb6, 0xc4, 0x65, 0x56, 0xed, 0xa1, 0xb3, 0x89, 0xb4, 0xf9, 0x4a, 0x10, 0xda, 0x31, 0x25, 0xa1,
+          0x45, 0xc6, 0x8a, 0x2c, 0xaa, 0x32, 0x2b, 0x2b, 0x51, 0x35, 0x0e, 0x77, 0x53, 0xa6, 0x86, 0x90, 0x97, 0x77, 0xb1, 0x65, 0xfe, 0xb5, 0xaf, 0xae,
+          0x84, 0x2e, 0x14, 0x60, 0xa2, 0xe4, 0xf4, 0x1b, 0x32, 0x41, 0xa0, 0xc4, 0xbc, 0x17, 0x53, 0xd4, 0x71, 0x14, 0x88, 0xa6, 0xb4, 0x36, 0x04, 0xac,
+          0xcc, 0x7b, 0x91, 0x7a, 0x04, 0xff, 0xbf, 0x7a, 0x3f, 0x0d, 0x1d, 0x4b, 0x9b, 0x2d, 0x1b, 0x84, 0x32, 0x5b, 0x46, 0xfe, 0x8f, 0xad, 0x17, 0xb5,
+          0xd5, 0x8a, 0x83, 0x54, 0xe9, 0x1d, 0x11, 0xb1, 0xf5, 0xf5, 0x2e, 0x7b, 0x1b, 0xa8, 0x0a, 0x4f, 0xa0, 0xa1, 0x6a, 0x82, 0x7e, 0xc5, 0xef, 0x98,
+          0x86, 0x5f, 0x06, 0x8b, 0x0f, 0x59, 0x1f, 0x3f, 0x8a, 0x73, 0xd5, 0xab, 0x53, 0xe9, 0x90, 0xbb, 0xe8, 0xfa, 0xf8, 0x75, 0x18, 0xfc, 0xb8, 0x54,
+          0xb9, 0x0e, 0xab, 0x4f, 0x34, 0x43, 0x09, 0x1f, 0x2e, 0x94, 0x96, 0xa9, 0xcc, 0xfd, 0x45, 0xa1, 0x81, 0x32, 0xad, 0x31, 0x4e, 0x2a, 0xab, 0x45,
+          0xd2, 0xe0, 0xd7, 0x43, 0x8b, 0x97, 0x70, 0xf9, 0x0f, 0xe3, 0x3c, 0xdc, 0x26, 0x22, 0x17, 0x80, 0x5d, 0xe2, 0x1a, 0xc0, 0x23, 0xb0, 0xcf, 0x9e,
+          0xb8, 0x1b, 0x09, 0xb1, 0x2a, 0x7f, 0x68, 0xa6, 0x29, 0x80, 0xa8, 0x5f, 0xfb, 0xb2, 0x0a, 0x86, 0x73, 0xbf, 0x41, 0xe6, 0xa0, 0x11, 0x93, 0xcb,
+          0xdd, 0xeb, 0xb9, 0x8e, 0x2d, 0x99, 0x75, 0x36, 0xb6, 0x9f, 0xc3, 0x1b, 0xd5, 0x96, 0x79, 0x28, 0x52, 0x71, 0x7b, 0xdd, 0xae, 0x2a, 0xf2, 0x73,
+          0x4b, 0x83, 0x34, 0x53, 0x16, 0x96, 0xf8, 0xc3, 0x0d, 0xe3, 0x7d, 0x8d, 0x71, 0xc0, 0x95, 0x2a, 0x5c, 0x0c, 0x7d, 0x59, 0x93, 0x95, 0xa6, 0xa6,
+          0x8f, 0xcf, 0xb7, 0xd6, 0x81, 0x63, 0xc0, 0x72, 0x18, 0xfc, 0x36, 0x7a, 0x69, 0x72, 0xb0, 0xf9, 0x9a, 0x2f, 0x96, 0x51, 0xd1, 0x74, 0x2e, 0x8b,
+          0xe1, 0xed, 0x5e, 0xf9, 0xdf, 0xdf, 0xa9, 0x45, 0x44, 0xf9, 0x40, 0xb4, 0xb3, 0x6f, 0xae, 0x64, 0x5e, 0x1e, 0xb8, 0xfd, 0xf6, 0x4a, 0xf0, 0x1d,
+          0x75, 0x8d, 0x4e, 0xb8, 0xaa, 0x46, 0x73, 0xcd, 0xa6, 0xb1, 0x22, 0xc9, 0x5d, 0xdd, 0xae, 0x51, 0x68, 0x9b, 0xd9, 0xd8, 0x52, 0x87, 0xbe, 0xc9,
+          0xcf, 0x28, 0x21, 0x14, 0x54, 0x9d, 0xb7, 0x7c, 0x17, 0xd0, 0xa8, 0x01, 0xd8, 0xb9, 0x70, 0x89, 0x81, 0x93, 0x67, 0xed, 0x98, 0x18, 0x0d, 0xd9,
+          0xaa, 0xbd, 0xcc, 0xf2, 0xe0, 0x63, 0x7b, 0xfa, 0x0c, 0x47, 0x1f, 0x1d, 0xa2, 0xf1, 0x2c, 0x57, 0xd1, 0x3e, 0x93, 0x0f, 0x42, 0x38, 0x9e, 0x5f,
+          0xf6, 0xaf, 0xaf, 0x97, 0x02, 0x89, 0x7a, 0xf5, 0x45, 0x09, 0x70, 0x52, 0xcb, 0xad, 0xec, 0x5d, 0x6a, 0x3c, 0xa2, 0x4f, 0xa2, 0x03, 0xa2, 0xe0,
+          0x3a, 0x9b, 0x93, 0x21, 0x03, 0xc7, 0x03, 0xfb, 0x0f, 0xea, 0x3f, 0x9a, 0xd6, 0x90, 0x78, 0xee, 0x0e, 0x03, 0x5c, 0x8d, 0xf7, 0x4f, 0x0f, 0x65,
+          0x8a, 0x09, 0x10, 0xe3, 0x68, 0x8e, 0x48, 0x46, 0xad, 0xfc, 0x88, 0x2a, 0xa6, 0xc4, 0x33, 0xc0, 0x27, 0x04, 0x8b, 0xc2, 0x45, 0x9a, 0x9f, 0x17,
+          0x6e, 0x37, 0xf7, 0xa5, 0xd5, 0xc1, 0x24, 0xfe, 0x05, 0xa0, 0x13, 0x85, 0xfb, 0x41, 0xd4, 0x9d, 0x6f, 0x7e, 0xa4, 0xa0, 0x78, 0x58, 0xa0, 0x1b,
+          0x72, 0x78, 0x69, 0x8c, 0xaa, 0x2f, 0xfd, 0x9a, 0x88, 0xf5, 0x21, 0xf3, 0xa3, 0xff, 0x22, 0x9c, 0xf3, 0x5f, 0x1c, 0xaa, 0x0d, 0xea, 0x0a, 0x63,
+          0x0d, 0x29, 0x82, 0x9d, 0x4f, 0x38, 0x87, 0xc3, 0xfa, 0xf5, 0x17, 0x01, 0x86, 0x24, 0xd9, 0x60, 0x6c, 0x50, 0xc3, 0xb6, 0x1a, 0x84, 0x0a, 0x5b,
+          0x9f, 0x69, 0xa0, 0x57, 0xad, 0x3f, 0x37, 0xd8, 0x95, 0xb2, 0xe4, 0x76, 0xfd, 0x97, 0xce, 0xe3, 0x32, 0xe2, 0xe4, 0x75, 0xca, 0x89, 0x1f, 0xc7,
+          0xe1, 0x55, 0x5e, 0x45, 0xd4, 0xd8, 0xe0, 0x31, 0x48, 0xb0, 0xb9, 0xa5, 0x54, 0xc8, 0x08, 0x46, 0x7b, 0xc8, 0xa2, 0xe3, 0xda, 0x6e, 0x83, 0xf6,
+          0xdf, 0x86, 0x9a, 0x10, 0xa8, 0xde, 0x8e, 0xaa, 0xb6, 0x14, 0xf4, 0x68, 0x54, 0xd0, 0x10, 0x79, 0x71, 0x4b, 0xa0, 0x84, 0x14, 0xd1, 0x3b, 0x2a,
+          0x19, 0x5b, 0x68, 0x5d, 0x61, 0x5c, 0xc5, 0x16, 0xfa, 0x3c, 0x34, 0xc7, 0xa4, 0x7a, 0xdb, 0x69, 0x6d, 0xde, 0x55, 0x24, 0x84, 0x8d, 0x35, 0x70,
+          0x37, 0x94, 0x6c, 0x5a, 0xbf, 0xd9, 0xed, 0x80, 0x60, 0x41, 0x21, 0x86, 0xce, 0xf6, 0x48, 0x61, 0x5e, 0x88, 0xc9, 0xb3, 0x9d, 0x52, 0x9c, 0xca,
+          0x1f, 0xeb, 0x47, 0x0a, 0xb3, 0x70, 0x78, 0xcf, 0x9e, 0xe7, 0x95, 0x51, 0x94, 0x16, 0xb4, 0x6f, 0xe3, 0x58, 0x94, 0xf6, 0xea, 0x62, 0x9b, 0x4a,
+          0x09, 0xdf, 0x88, 0x34, 0x21, 0x4e, 0x31, 0xad, 0x43, 0xb3, 0x9a, 0xef, 0x12, 0xfe, 0x0b, 0x5f, 0x2f, 0x90, 0x0c, 0x8a, 0x12, 0x43, 0xcf, 0x2a,
+          0x9b, 0x7a, 0x19, 0xa7, 0x28, 0x33, 0x0d, 0x5c, 0xad, 0xe5, 0x44, 0xea, 0x8c, 0xda, 0x9a, 0xb9, 0x31, 0x27, 0x5d, 0x32, 0x01, 0xad, 0xcf, 0x59,
+          0x38, 0x4b, 0x4c, 0xa4, 0x82, 0x03, 0xe5, 0xfa, 0x05, 0xdc, 0x7b, 0xa2, 0xce, 0x93, 0x0a, 0xc9, 0x63, 0x4d, 0xf7, 0xc9, 0x74, 0x3f, 0x3e, 0x71,
+          0x6b, 0xb3, 0x9d, 0x10, 0x4b, 0xad, 0xe1, 0x6d, 0x77, 0x26, 0x9c, 0x58, 0x44, 0xde, 0x2c, 0x3f, 0x21, 0x7d, 0x05, 0x39, 0x3b, 0x34, 0xf3, 0x94,
+          0x46, 0x1f, 0x4c, 0x72, 0xac, 0xe1, 0x2d, 0xf2, 0x47, 0x4c, 0x95, 0xdf, 0xff, 0xd4, 0x39, 0x48, 0x3e, 0xd1, 0xc9, 0xe8, 0x44, 0x55, 0x30, 0x9e,
+          0x16, 0xcd, 0x5a, 0xc7, 0xd9, 0xc6, 0xc3, 0x5f, 0xb7, 0x80, 0x6f, 0x31, 0x5e, 0x52, 0x2d, 0xe4, 0xda, 0xd6, 0x5f, 0x3c, 0xe0, 0x60, 0x6b, 0xf5,
+          0xc6, 0x2a, 0x74, 0xcd, 0xb6, 0x01, 0x86, 0x3d, 0xec, 0x8b, 0x6e, 0x7f, 0xa3, 0xe2, 0xcb, 0xb4, 0xdd, 0x36, 0xa4, 0x39, 0xcf, 0x81, 0xc4, 0x62,
+          0x2b, 0x13, 0x06, 0xac, 0x23, 0x86, 0x60, 0x12, 0x4a, 0x01, 0xe9, 0x71, 0x74, 0xaf, 0x2c, 0x67, 0x48, 0x50, 0xa4, 0xeb, 0xa1, 0x4c, 0xf4, 0xba,
+          0xc6, 0x2a, 0xa0, 0x8c, 0x39, 0xbc, 0xa0, 0x58, 0x8e, 0xe7, 0xee, 0x53, 0xdb, 0x34, 0x7f, 0x89, 0x97, 0x82, 0x0d, 0xdd, 0x2c, 0xc1, 0x68, 0xd1,
+          0x65, 0xfd, 0x65, 0x10, 0xcd, 0x36, 0xb5, 0xa6, 0x41, 0xae, 0x3f, 0x74, 0xc3, 0xc3, 0x79, 0x29, 0xc6, 0x62, 0xa2, 0x01, 0x6d, 0x10, 0x8b, 0xc2,
+          0x03, 0x63, 0xc3, 0xc3, 0x1b, 0xd1, 0xaf, 0xc6, 0xf6, 0xfc, 0xae, 0x11, 0x48, 0xcc, 0xe5, 0x6e, 0x23, 0x6e, 0x31, 0x3d, 0xae, 0xec, 0x6e, 0x4a,
+          0x1a, 0x61, 0x48, 0x50, 0x18, 0x5e, 0x73, 0x38, 0x1b, 0x74, 0x6f, 0x02, 0x98, 0xc1, 0xf8, 0x6b, 0x78, 0x01, 0x6d, 0xa8, 0x0e, 0x27, 0xa2, 0x6c,
+          0x03, 0xc5, 0xd7, 0x01, 0x45, 0x68, 0x61, 0x63, 0x9e, 0xf2, 0xe8, 0x8b, 0xc4, 0xba, 0x3f, 0xe7, 0x9e, 0x6d, 0x11, 0x1c, 0x88, 0x7d, 0x02, 0x7e,
+          0xd4, 0x2d, 0x81, 0xb4, 0x97, 0x84, 0x6d, 0x5c, 0x41, 0xcc, 0x4d, 0x4b, 0xd1, 0xeb, 0x85, 0x46, 0x74, 0x65, 0xb4, 0x14, 0x85, 0x48, 0xbc, 0x20,
+          0x02, 0x42, 0x6b, 0x11, 0xbe, 0x0a, 0x43, 0xd1, 0xbc, 0xfb, 0x86, 0xa1, 0x25, 0x32, 0x84, 0xdf, 0x32, 0x8c, 0x82, 0x3e, 0x99, 0xd6, 0x5e, 0xb8,
+          0x23, 0x66, 0x34, 0x5c, 0x22, 0x95, 0xd1, 0xe3, 0x79, 0x4c, 0x4a, 0x6c, 0x34, 0xcd, 0x58, 0xd5, 0x1a, 0xed, 0xab, 0x94, 0x75, 0x42, 0xc2, 0x2a,
+          0x06, 0x8c, 0xf4, 0x67, 0xd9, 0xe5, 0x79, 0x5a, 0xbb, 0x61, 0xd4, 0x89, 0x4d, 0x18, 0xf4, 0x41, 0xbe, 0x63, 0x43, 0x7d, 0x70, 0xf5, 0x84, 0xc4,
+          0xd5, 0x13, 0x13, 0x63, 0x14, 0x54, 0x26, 0x2e, 0xbc, 0x0d, 0xc5, 0xb7, 0xd1, 0x6c, 0x6b, 0x72, 0x5c, 0x9d, 0x3f, 0x2d, 0xda, 0xa7, 0x0c, 0x94,
+          0x36, 0x5d, 0x65, 0xa8, 0xda, 0xa3, 0xe3, 0x1f, 0x86, 0x50, 0xc4, 0x91, 0x1e, 0x93, 0xf2, 0xd1, 0x61, 0x36, 0x80, 0x24, 0xcd, 0x96, 0x65, 0x26,
+          0x6b, 0x94, 0xfb, 0x06, 0x4c, 0xd9, 0x78, 0x6e, 0x14, 0x7d, 0x3b, 0xaf, 0x4e, 0xb6, 0xb1, 0xc6, 0xb5, 0x3b, 0x01, 0xb3, 0x43, 0x88, 0x44, 0xe9,
+          0x68, 0x14, 0xd9, 0x06, 0x1c, 0xb2, 0x67, 0xd7, 0xad, 0x00, 0x20, 0xca, 0xf4, 0x7b, 0xe6, 0xae, 0x83, 0x31, 0xbf, 0xef, 0x63, 0x84, 0x71, 0xb9,
+          0x4b, 0x23, 0xdc, 0x58, 0x51, 0xbd, 0xbd, 0xc8, 0x9c, 0x73, 0x8f, 0x1a, 0x5b, 0x3d, 0x00, 0x0e, 0xb8, 0x43, 0xab, 0xde, 0x0e, 0xfa, 0x5e, 0xc0,
+          0x9c, 0x97, 0x1b, 0x44, 0xc7, 0x81, 0x12, 0x44, 0x1b, 0x15, 0x83, 0x75, 0x45, 0xc3, 0x3b, 0x68, 0x4d, 0x71, 0xff, 0xc4, 0xe2, 0xc5, 0x97, 0xf3,
+          0x05, 0x3e, 0x37, 0xf8, 0xb8, 0x5c, 0xd3, 0x68, 0x34, 0x72, 0x83, 0x36, 0xf3, 0x26, 0x2f, 0xff, 0x1f, 0x63, 0x32, 0xb6, 0x3a, 0xf6, 0xb7, 0xf6,
+          0xd5, 0xdb, 0xa9, 0xba, 0x32, 0xc0, 0x20, 0x91, 0x54, 0x9a, 0xd3, 0x19, 0x9d, 0xf3, 0x19, 0x9f, 0x1b, 0x45, 0x63, 0x30, 0xbf, 0x0e, 0x08, 0x06,
+          0xc0, 0xae, 0x84, 0xb6, 0x44, 0x6d, 0xdc, 0xbb, 0xa9, 0xe3, 0xe7, 0x0f, 0x69, 0x6d, 0x1f, 0xaa, 0xa2, 0x62, 0xb6, 0x19, 0x69, 0xb7, 0xd8, 0x0d,
+          0xf6, 0x9d, 0xe7, 0xb2, 0x3a, 0x64, 0x2e, 0xfd, 0x66, 0x63, 0xd9, 0x34, 0xed, 0x6d, 0xd9, 0x6c, 0xb5, 0xda, 0x72, 0x41, 0x4c, 0xb8, 0x7f, 0x5d,
+          0xd0, 0xa6, 0xe2, 0xcb, 0x55, 0x55, 0x5d, 0xc7, 0xf0, 0xef, 0xa2, 0x8f, 0xda, 0xdb, 0xf5, 0xec, 0xec, 0x52, 0xc9, 0xfe, 0xde, 0x5f, 0xe0, 0xfc,
+          0xea, 0xbb, 0x3a, 0xd0, 0x5d, 0xac, 0xb7, 0x8c, 0xdd, 0x79, 0x6a, 0xd8, 0xd6, 0x6e, 0x7c, 0xdd, 0xd1, 0x7a, 0xef, 0x2a, 0xcb, 0x4e, 0xb3, 0x5a,
+          0xdd, 0xcd, 0xf3, 0x53, 0xea, 0x69, 0x61, 0x77, 0xc6, 0x1d, 0x7e, 0x8e, 0x18, 0xb3, 0xda, 0x4e, 0x31, 0x57, 0x47, 0xcb, 0xf2, 0x0b, 0x1c, 0xa3,
+          0xac, 0x16, 0x26, 0xf5, 0xcf, 0x1b, 0x6e, 0xd5, 0x6b, 0x04, 0xf3, 0x07, 0x1a, 0x79, 0xaa, 0x5a, 0x3b, 0xdb, 0x79, 0x0a, 0xe9, 0xfc, 0x49, 0x5e,
+          0x3c, 0x9f, 0xbb, 0x75, 0x97, 0x81, 0x75, 0x51, 0x15, 0x65, 0xa3, 0x87, 0xe9, 0x53, 0x53, 0x58, 0xd1, 0x0f, 0x6d, 0xd9, 0xa0, 0x9e, 0xf2, 0x74,
+          0xee, 0x05, 0x8a, 0xd6, 0x5c, 0x73, 0x7c, 0x0a, 0xf9, 0x72, 0x89, 0xd1, 0x36, 0x64, 0x81, 0x17, 0x7a, 0x0d, 0xe6, 0x1b, 0x0c, 0x07, 0xea, 0x5d,
+          0x2a, 0x6d, 0x65, 0x94, 0xc2, 0xe1, 0x57, 0xd7, 0x9c, 0x42, 0x75, 0xf2, 0xe5, 0x26, 0x39, 0xfd, 0x6f, 0x43, 0xf1, 0xe7, 0xec, 0x4b, 0xa1, 0x9f,
+          0xd0, 0xab, 0xaa, 0x48, 0x9a, 0xfd, 0xb5, 0x11, 0x09, 0xf4, 0x75, 0x26, 0x24, 0x35, 0x57, 0x84, 0x83, 0xa7, 0x92, 0x2a, 0x9e, 0xc9, 0x4e, 0x36,
+          0x1a, 0x97, 0x34, 0xcf, 0x1b, 0x28, 0x22, 0x47, 0x2b, 0x48, 0x63, 0x10, 0xc2, 0xc8, 0x3f, 0xd3, 0x8a, 0xa9, 0xd5, 0x80, 0xab, 0x1c, 0x4b, 0x55,
+          0x71, 0xc0, 0x54, 0x25, 0xfb, 0xcb, 0x12, 0x87, 0x49, 0x3b, 0xb4, 0xf3, 0x04, 0x2e, 0xda, 0x55, 0x91, 0xd2, 0xc7, 0x08, 0xa9, 0x14, 0x01, 0x4d,
+          0xc7, 0x3c, 0xf2, 0xfd, 0x2f, 0x39, 0x54, 0x49, 0xda, 0xbb, 0x11, 0x64, 0xfe, 0x36, 0xd6, 0xa7, 0xfd, 0x21, 0x12, 0xf8, 0x8e, 0xdd, 0x19, 0xd5,
+          0x08, 0x34, 0xd6, 0xfe, 0x39, 0x92, 0x49, 0x2d, 0x9a, 0xc5, 0xa8, 0x77, 0x06, 0x72, 0x3b, 0xac, 0xa0, 0x70, 0xda, 0xf5, 0x2f, 0xd9, 0x0e, 0xc5,
+          0xa0, 0x11, 0x26, 0xfd, 0xd1, 0x16, 0x4a, 0x7e, 0x96, 0xab, 0x7f, 0xa8, 0xa6, 0x58, 0xc4, 0xf9, 0x9d, 0xc4, 0xda, 0x20, 0xcd, 0x9b, 0xf8, 0x5c,
+          0x57, 0x0e, 0x67, 0x76, 0x96, 0x62, 0xf5, 0x7b, 0x6b, 0x08, 0xed, 0xff, 0x2f, 0xf8, 0xbc, 0xfe, 0xc5, 0x97, 0xd7, 0xc3, 0x96, 0x92, 0x49, 0x4c,
+          0x4d, 0x52, 0x69, 0x12, 0x42, 0xa3, 0xcc, 0x71, 0x48, 0x24, 0x6a, 0x6c, 0xa6, 0x3e, 0x1d, 0xab, 0x77, 0x2e, 0x81, 0x59, 0x64, 0x68, 0x11, 0x03,
+          0x31, 0xa3, 0xa1, 0x07, 0xf1, 0xea, 0x40, 0xe0, 0x41, 0x45, 0x2c, 0x0c, 0x29, 0xed, 0x37, 0x2b, 0x32, 0xbe, 0xd0, 0xf3, 0x91, 0x13, 0x95, 0x7e,
+          0x3d, 0x7b, 0x82, 0xdf, 0x89, 0xfe, 0x8d, 0xcc, 0xc4, 0x89, 0x27, 0xe3, 0xa8, 0x2f, 0xac, 0xfa, 0x94, 0x75, 0x18, 0x97, 0xb5, 0x6e, 0x91, 0x8c,
+          0xee, 0x5c, 0x1e, 0x77, 0xf4, 0x66, 0x96, 0x4b, 0xc2, 0xd7, 0xf6, 0x31, 0x11, 0x41, 0x54, 0xfd, 0x0b, 0x4e, 0xda, 0xcb, 0x91, 0xf4, 0xc7, 0x10,
+          0xb8, 0xe8, 0x93, 0x2f, 0xa2, 0xd3, 0xd6, 0x49, 0x55, 0x1c, 0xc5, 0xb5, 0xe6, 0xaa, 0x94, 0xbb, 0x62, 0x8f, 0x14, 0x7f, 0xd9, 0xd7, 0xa8, 0x54,
+          0x2b, 0xb0, 0xd5, 0xf3, 0x04, 0xa7, 0xe0, 0x6d, 0xce, 0x35, 0xce, 0xf5, 0x8b, 0x7f, 0x75, 0x6d, 0x52, 0xdf, 0x39, 0xd7, 0x5c, 0x79, 0x7a, 0x80,
+          0x98, 0xd0, 0x6b, 0xc7, 0x29, 0xaa, 0x7c, 0x81, 0x02, 0x9f, 0x32, 0xf7, 0x76, 0x57, 0xff, 0x41, 0x34, 0x39, 0x90, 0x73, 0x1f, 0x95, 0x62, 0x86,
+          0x45, 0xcb, 0xc9, 0x7e, 0x0d, 0xb6, 0xdf, 0x27, 0xa6, 0x82, 0x21, 0x5c, 0x67, 0x27, 0x65, 0xa4, 0x04, 0xe6, 0x93, 0x1b, 0xb6, 0xe4, 0x47, 0xd4,
+          0x80, 0x94, 0x7c, 0x6a, 0x76, 0xc0, 0x94, 0x50, 0xd8, 0x8e, 0x9d, 0x60, 0x8e, 0xf7, 0x8c, 0x50, 0x19, 0x5d, 0x14, 0x9f, 0xbb, 0x3c, 0x25, 0xf2,
+          0x21, 0xe9, 0x7f, 0x0a, 0x45, 0x4f, 0x67, 0x23, 0x05, 0x8b, 0x65, 0x41, 0x6e, 0x46, 0x3f, 0xd9, 0x4b, 0x8a, 0xaf, 0xb3, 0x51, 0x0f, 0x3c, 0xf0,
+          0x5a, 0x83, 0x8b, 0x30, 0x7e, 0x14, 0xb2, 0xe0, 0xa2, 0x4a, 0x40, 0x0f, 0x12, 0x97, 0x70, 0x86, 0xf4, 0x5a, 0x7f, 0x42, 0x25, 0xcf, 0x59, 0x71,
+          0x54, 0x89, 0xb7, 0xf0, 0xe0, 0xe0, 0xe3, 0xd2, 0xa4, 0xfd, 0xb4, 0xb9, 0x22, 0x89, 0xe5, 0x7e, 0x25, 0xfd, 0xd1, 0xa5, 0x2f, 0xa7, 0xd1, 0xa2,
+          0xc4, 0x44, 0xa4, 0x3b, 0xd9, 0x8b, 0xd7, 0x28, 0xfc, 0xae, 0xe1, 0x8a, 0xbf, 0xa5, 0x85, 0xa7, 0x74, 0xc4, 0xc1, 0xc6, 0xe1, 0x36, 0xa0, 0x58,
+          0xd9, 0x38, 0x94, 0xfa, 0xa8, 0x6d, 0x83, 0x8b, 0xc6, 0xeb, 0x56, 0xd2, 0x95, 0xf8, 0xe7, 0xf3, 0xdd, 0x85, 0x32, 0x9f, 0x20, 0xe7, 0x64, 0x50,
+          0xbd, 0xdd, 0x47, 0x53, 0x5a, 0x14, 0x10, 0xa3, 0x6b, 0x01, 0xc2, 0xd9, 0xfb, 0x32, 0x8b, 0x6a, 0xbf, 0x35, 0x51, 0x38, 0xea, 0x38, 0x2f, 0xa8,
+          0x72, 0xe5, 0xf9, 0x65, 0xac, 0xfc, 0x0c, 0x7c, 0x01, 0xec, 0x7b, 0xa1, 0x81, 0x67, 0xd9, 0x47, 0xbd, 0x6f, 0x99, 0x24, 0x8a, 0x1a, 0xbc, 0x32,
+          0x93, 0xbd, 0xfc, 0xdc, 0x0a, 0xbf, 0x98, 0x96, 0xac, 0x9f, 0xc0, 0x87, 0xa5, 0x2e, 0x48, 0xc6, 0x06, 0xdb, 0x51, 0x54, 0xe1, 0xd9, 0x1c, 0x4f,
+          0xff, 0xf0, 0xaa, 0x5a, 0xcc, 0x5a, 0x07, 0x7f, 0x60, 0xe6, 0x48, 0x5f, 0x3c, 0xc6, 0x6b, 0xc1, 0x96, 0xc3, 0x33, 0x5d, 0x3d, 0x06, 0xcd, 0xe1,
+          0x13, 0x27, 0x35, 0xb8, 0x49, 0x4e, 0x59, 0x1e, 0xa6, 0xf9, 0x45, 0x41, 0x3c, 0x76, 0x7e, 0x30, 0x1f, 0x5d, 0xb4, 0x00, 0xe4, 0xa3, 0x0f, 0x2c,
+          0xc5, 0x2b, 0xbc, 0xe0, 0x5d, 0xe9, 0xb4, 0x3d, 0x8e, 0xa6, 0xc4, 0xa1, 0xac, 0x48, 0xe4, 0x04, 0x8b, 0x33, 0xef, 0xbd, 0x37, 0x6d, 0xee, 0xbb,
+          0xdd, 0x9c, 0xdc, 0x5a, 0xf1, 0x30, 0x53, 0x97, 0x77, 0xce, 0x70, 0xd5, 0xe0, 0x57, 0x3e, 0x86, 0x27, 0x88, 0xbc, 0xd1, 0x8a, 0xab, 0xaa, 0xa7,
+          0x1f, 0x67, 0x7f, 0x44, 0x81, 0x40, 0xf6, 0xa2, 0x37, 0xa9, 0x65, 0x1f, 0xa3, 0xc3, 0xb2, 0xb7, 0xd2, 0xf3, 0x84, 0x62, 0x39, 0x26, 0x63, 0x5d,
+          0xb4, 0x49, 0xa8, 0x5c, 0x1a, 0xee, 0x65, 0x9a, 0xca, 0x08, 0xe2, 0x24, 0xb5, 0x38, 0xc9, 0xee, 0x9b, 0x3d, 0x42, 0xd3, 0x09, 0x67, 0xa0, 0xb5,
+          0xa9, 0x14, 0xfc, 0xc1, 0x36, 0xaa, 0x4f, 0x4b, 0x9c, 0xeb, 0x37, 0x3e, 0x55, 0x9f, 0x97, 0xb8, 0x30, 0x9f, 0x24, 0xf3, 0x80, 0xb7, 0x75, 0x12,
+          0x63, 0xf8, 0xe2, 0x73, 0x10, 0x9e, 0x4e, 0x80, 0x15, 0x11, 0x88, 0xe3, 0xaa, 0xba, 0x28, 0x23, 0x81, 0x1d, 0xb6, 0xa5, 0x32, 0x34, 0x64, 0xf0,
+          0xe1, 0xc9, 0x9c, 0x2c, 0x35, 0x09, 0xd2, 0x22, 0x48, 0xb6, 0x4d, 0xbc, 0xcc, 0x5e, 0xc3, 0x54, 0x57, 0x6f, 0x1b, 0x36, 0xa1, 0xd6, 0x9b, 0xe4,
+          0xf2, 0xe8, 0xee, 0x9b, 0x06, 0xea, 0x21, 0x6c, 0x29, 0x60, 0xdf, 0xd9, 0x27, 0x13, 0x8a, 0x06, 0xa9, 0xee, 0x63, 0xb1, 0x41, 0x49, 0x47, 0xd4,
+          0x2b, 0x9c, 0x58, 0xaf, 0x16, 0xe3, 0xef, 0x1d, 0x78, 0x3f, 0x07, 0x59, 0x42, 0x1b, 0x1b, 0xcf, 0xfb, 0xe8, 0x34, 0xe3, 0x0c, 0xa2, 0xe0, 0x95,
+          0xc0, 0xf5, 0xbd, 0x12, 0xfa, 0xe0, 0x06, 0x86, 0xd5, 0xc4, 0x8d, 0xfc, 0xc4, 0x99, 0x1b, 0x3c, 0x16, 0xae, 0x00, 0xad, 0xf9, 0xfc, 0x2d, 0x53,
+          0xaa, 0x38, 0x22, 0x1b, 0xe2, 0xca, 0xde, 0x6b, 0xf6, 0x0d, 0x7d, 0xf6, 0xc7, 0x9f, 0x95, 0x82, 0xa8, 0x5e, 0x14, 0xa8, 0x24, 0x57, 0xc5, 0xd6,
+          0x5c, 0x91, 0x69, 0x98, 0xfc, 0x32, 0x7a, 0xbd, 0xe7, 0xf1, 0x07, 0x2d, 0x17, 0x0f, 0x61, 0x2e, 0xf3, 0x38, 0xc9, 0x33, 0x4f, 0x91, 0xa0, 0x32,
+          0xc5, 0x10, 0x8f, 0xa0, 0x1b, 0x68, 0x46, 0xaa, 0x14, 0xc4, 0x04, 0xa8, 0x1c, 0xa1, 0x7b, 0xdb, 0x10, 0x4a, 0x6b, 0xa7, 0x17, 0x8b, 0x2c, 0x44,
+          0x26, 0x40, 0xb2, 0x45, 0xaf, 0x1c, 0x5c, 0x48, 0x60, 0x26, 0x14, 0x0e, 0x2a, 0x25, 0x41, 0x28, 0x1a, 0x16, 0x57, 0x8e, 0x58, 0xdb, 0x26, 0x17,
+          0x92, 0x3c, 0x32, 0x9e, 0x51, 0x9d, 0xf6, 0x6a, 0x38, 0x1e, 0x0f, 0x63, 0x40, 0x94, 0x8e, 0x0c, 0x94, 0x93, 0x59, 0xf1, 0x38, 0x6f, 0x3c, 0xa8,
+          0xfb, 0x83, 0xab, 0x90, 0xa2, 0xe4, 0x99, 0x33, 0x24, 0x24, 0x79, 0x67, 0x4b, 0x48, 0xd5, 0x47, 0x64, 0xfa, 0x33, 0xe7, 0xd5, 0xf3, 0xc5, 0xce,
+          0x67, 0x2e, 0xaa, 0x17, 0xb3, 0x17, 0x22, 0x83, 0x76, 0xd3, 0x47, 0x7f, 0xfc, 0xea, 0x1f, 0xd8, 0x4a, 0xf3, 0x44, 0x45, 0xc3, 0x35, 0xb9, 0x6a,
+          0x4a, 0xcc, 0x58, 0x50, 0x1a, 0xd3, 0x4a, 0x83, 0x1f, 0xe0, 0x58, 0x82, 0xec, 0x7f, 0x49, 0xc6, 0x76, 0x62, 0x27, 0xb9, 0xd8, 0xe7, 0x90, 0xce,
+          0x15, 0x6b, 0xcd, 0xfa, 0x86, 0xf4, 0xd8, 0xd6, 0xb3, 0x09, 0xdf, 0x74, 0x13, 0x67, 0x95, 0x7e, 0x26, 0xda, 0xa4, 0xb9, 0xad, 0xe0, 0x65, 0x96,
+          0x64, 0xea, 0xf6, 0x7b, 0x39, 0x5a, 0x04, 0xb9, 0xa8, 0x95, 0x97, 0x96, 0x49, 0x4b, 0x22, 0xaf, 0x32, 0x8d, 0x13, 0x71, 0xe6, 0x4e, 0x9a, 0xf2,
+          0xcc, 0x45, 0xf5, 0x42, 0x99, 0x85, 0xc9, 0xa0, 0x56, 0x88, 0x8f, 0x07, 0x68, 0x28, 0xf1, 0x97, 0xe7, 0x39, 0x60, 0x38, 0xba, 0xa4, 0x09, 0xc3,
+          0x02, 0x74, 0x77, 0xbe, 0x35, 0x03, 0x6f, 0x01, 0xf2, 0xe1, 0x0c, 0xce, 0x8c, 0xfc, 0xd5, 0x5c, 0x44, 0xbd, 0x24, 0x1e, 0x4e, 0x23, 0x39, 0xc1,
+          0x6a, 0xfe, 0xeb, 0xba, 0x7e, 0x2b, 0x29, 0xda, 0x74, 0xb7, 0x12, 0xbe, 0x22, 0x39, 0xaa, 0x7c, 0xea, 0xc2, 0x33, 0x3f, 0xfb, 0x21, 0x0b, 0x07,
+          0x9b, 0x7c, 0xef, 0x12, 0xf9, 0x50, 0x88, 0x85, 0x02, 0xbe, 0x6a, 0x41, 0x8b, 0x8f, 0xee, 0x82, 0x1c, 0x5b, 0x13, 0x5a, 0x25, 0x6e, 0x5b, 0x5a,
+          0xf3, 0xee, 0x4b, 0x36, 0xf4, 0xf3, 0x89, 0x58, 0xcb, 0xa7, 0x65, 0xce, 0x51, 0x4e, 0x43, 0xa4, 0x7e, 0x67, 0x9e, 0xf5, 0x74, 0x0e, 0x78, 0xf0,
+          0xea, 0xed, 0x05, 0xe6, 0x5f, 0xb2, 0x25, 0x1a, 0x74, 0x19, 0x43, 0x8e, 0x5e, 0x9c, 0xef, 0x70, 0xdb, 0x2d, 0xd3, 0xf9, 0x75, 0x95, 0x28, 0x86,
+          0xe9, 0xbe, 0x0e, 0xd3, 0xbc, 0xf2, 0x5f, 0x5b, 0x9f, 0xce, 0xb9, 0x09, 0x75, 0x55, 0xb8, 0x75, 0x40, 0x05, 0xa1, 0xa7, 0x45, 0x4b, 0xec, 0x49,
+          0xf1, 0x5f, 0x32, 0x12, 0x1e, 0x1c, 0x84, 0x1c, 0x04, 0xc3, 0x05, 0x0c, 0x18, 0xee, 0xc4, 0x2c, 0x67, 0x2e, 0xfe, 0x5d, 0x4e, 0x9c, 0xcd, 0x0f,
+          0x1b, 0xb5, 0xd5, 0xb0, 0x3b, 0x90, 0x7d, 0x75, 0x70, 0x94, 0xea, 0x71, 0xab, 0x7f, 0x19, 0xbd, 0x7a, 0x21, 0xb8, 0x5f, 0x60, 0x32, 0x2a, 0x4c,
+          0xad, 0x42, 0xac, 0x80, 0x86, 0x2a, 0x62, 0x2e, 0x58, 0xd2, 0x70, 0xc4, 0x4c, 0x08, 0x56, 0x98, 0x8e, 0x3c, 0x5c, 0x0a, 0xe8, 0x12, 0x73, 0x7d,
+          0xd1, 0xba, 0x5e, 0x11, 0x12, 0x64, 0xf5, 0x26, 0x7e, 0xab, 0x23, 0x49, 0x41, 0x5a, 0x76, 0x9f, 0xaa, 0x41, 0xdd, 0xef, 0x10, 0x47, 0x87, 0x64,
+          0x91, 0xf9, 0xda, 0xbf, 0x64, 0x10, 0xc3, 0x3e, 0xc3, 0x67, 0x58, 0x29, 0x7c, 0xf9, 0xa7, 0x0a, 0x08, 0x42, 0x1b, 0xac, 0x05, 0x91, 0x40, 0xbc,
+          0x8e, 0xb3, 0xc8, 0xc4, 0xcb, 0x8e, 0x62, 0xd5, 0xce, 0xe5, 0x75, 0xb5, 0xfd, 0x75, 0x3c, 0x1f, 0x84, 0xaf, 0xff, 0x77, 0x69, 0x82, 0xb5, 0x83,
+          0x12, 0xb7, 0xf7, 0x72, 0xcd, 0x0d, 0x5e, 0x91, 0x14, 0x7f, 0xb5, 0xce, 0x97, 0xbf, 0x29, 0x3b, 0x26, 0xa8, 0x84, 0x63, 0xae, 0xfc, 0x17, 0xc4,
+          0x35, 0xc9, 0xaf, 0x6e, 0xbe, 0xbc, 0x8a, 0x33, 0x52, 0x55, 0x40, 0x5a, 0x92, 0xba, 0x8c, 0xbf, 0x5c, 0x7a, 0x24, 0xd2, 0x02, 0xab, 0x29, 0x46,
+          0x84, 0xd8, 0xa7, 0x4c, 0xbb, 0xfe, 0xa4, 0x97, 0x61, 0xda, 0x6b, 0xfd, 0xda, 0x4d, 0xe1, 0x48, 0xd5, 0xd4, 0xd9, 0x7d, 0xe5, 0xa1, 0x3c, 0x45,
+          0x4a, 0x40, 0x49, 0x4c, 0xa4, 0x88, 0xb0, 0x64, 0x75, 0xbd, 0xd3, 0x7d, 0xd2, 0x15, 0xa2, 0xba, 0xda, 0x6d, 0xb3, 0x10, 0x9a, 0x99, 0x4e, 0x20,
+          0x97, 0x8a, 0x49, 0x50, 0x54, 0x29, 0xc6, 0xf9, 0xaf, 0x7e, 0x47, 0x31, 0x54, 0x06, 0x12, 0x0c, 0x0a, 0x2c, 0x94, 0xca, 0xa0, 0x23, 0x92, 0x44,
+          0xee, 0x87, 0x8d, 0xa0, 0x4a, 0x9b, 0x62, 0x4f, 0x4c, 0x5a, 0x4c, 0x8c, 0xfe, 0x40, 0x09, 0x54, 0xf2, 0x8a, 0x42, 0xb2, 0x84, 0x20, 0x32, 0xa9,
+          0x08, 0xd2, 0xad, 0xf8, 0xcc, 0xa6, 0xf4, 0x14, 0xa0, 0x99, 0x10, 0x82, 0x79, 0x70, 0x62, 0x1e, 0x13, 0xad, 0x24, 0x21, 0x79, 0x11, 0xa2, 0xca,
+          0xc8, 0x04, 0x6f, 0x1b, 0xff, 0x92, 0xf5, 0x0c, 0x41, 0x37, 0x28, 0x50, 0xd8, 0x78, 0xd4, 0x22, 0x93, 0x12, 0xb2, 0xfc, 0xb0, 0x77, 0x90, 0x85,
+          0xe4, 0x37, 0x73, 0x87, 0x59, 0x53, 0x33, 0xf7, 0x90, 0x97, 0x8f, 0xc3, 0xd2, 0x65, 0xb6, 0xf7, 0xa9, 0xf9, 0x9b, 0xad, 0x99, 0x4e, 0xe9, 0xba,
+          0xd6, 0x28, 0xfa, 0x4b, 0x2a, 0xa0, 0xc8, 0x31, 0x3d, 0xb5, 0x68, 0x8e, 0x82, 0x00, 0x39, 0x9d, 0x0a, 0x0e, 0x29, 0x2b, 0x72, 0xd0, 0xd4, 0x4f,
+          0x36, 0xa8, 0x3e, 0xf1, 0x69, 0x1a, 0xdd, 0x09, 0x5b, 0xef, 0x43, 0x52, 0x42, 0x4e, 0x36, 0x87, 0x07, 0xf5, 0xb5, 0xec, 0xdc, 0x87, 0x8a, 0xca,
+          0xe6, 0xe9, 0x40, 0x13, 0x66, 0x5f, 0x4a, 0x2f, 0xcf, 0x98, 0x50, 0xf9, 0x22, 0xc7, 0x29, 0x98, 0x3b, 0xca, 0xa6, 0x8b, 0xb7, 0xa2, 0x5a, 0xdd,
+          0x84, 0x4b, 0xbc, 0x50, 0xcc, 0x12, 0xbb, 0x89, 0xd6, 0x82, 0xbf, 0x11, 0x4c, 0x86, 0x4e, 0xd1, 0x6d, 0xb8, 0x40, 0xb3, 0x33, 0x49, 0xe1, 0x45,
+          0xdd, 0xdb, 0xec, 0x15, 0xf9, 0x1b, 0x26, 0xd1, 0xe4, 0x2f, 0x61, 0xb0, 0x1d, 0x86, 0x94, 0x06, 0x55, 0xae, 0x53, 0x4f, 0x09, 0xb2, 0x9e, 0x9e,
+          0xee, 0x3a, 0x8f, 0x00, 0x65, 0x14, 0x98, 0xa1, 0xda, 0xd3, 0x53, 0x34, 0x7a, 0x8d, 0xd1, 0xa6, 0x3d, 0x77, 0x79, 0x59, 0xd1, 0x53, 0xf9, 0x5a,
+          0x8e, 0xb8, 0x61, 0x7b, 0x32, 0x89, 0x2d, 0xb9, 0x54, 0xa3, 0x1b, 0xe0, 0x76, 0x59, 0x91, 0xdb, 0x3c, 0x25, 0x4d, 0x44, 0x54, 0xce, 0x86, 0xf6,
+          0x49, 0x4a, 0xa4, 0x17, 0x45, 0x80, 0xd7, 0xaf, 0x88, 0x30, 0x24, 0x50, 0x38, 0x5a, 0x52, 0xb5, 0xc9, 0xa6, 0x45, 0xd8, 0x11, 0x43, 0x2c, 0x9c,
+          0x42, 0xd7, 0x91, 0x0a, 0x30, 0x5a, 0x6d, 0x52, 0x66, 0x00, 0xd9, 0x11, 0x5d, 0xc9, 0x61, 0x76, 0x0e, 0xa0, 0x44, 0xc6, 0xea, 0x63, 0x6c, 0x96,
+          0xfe, 0x87, 0xb3, 0x62, 0x9d, 0x1a, 0x69, 0x04, 0xd0, 0xcb, 0x1f, 0xd3, 0x70, 0x51, 0x20, 0x91, 0x4f, 0xc4, 0x8f, 0x81, 0x7c, 0xa0, 0x19, 0x06,
+          0xa4, 0xef, 0xa4, 0xbf, 0x23, 0x9f, 0x51, 0xb9, 0xc8, 0xa0, 0xaa, 0x69, 0xfd, 0x31, 0x79, 0x42, 0x3b, 0x4d, 0x65, 0x05, 0xaa, 0xc1, 0x83, 0xf7,
+          0xea, 0x08, 0xc9, 0xd1, 0x11, 0xa8, 0xb7, 0x01, 0xad, 0x17, 0x68, 0x0a, 0xc3, 0x88, 0x89, 0x70, 0xa7, 0x1e, 0x7e, 0xff, 0x85, 0x25, 0x75, 0xa1,
+          0x0a, 0x18, 0xc8, 0xf1, 0x96, 0xfc, 0x94, 0x10, 0xc9, 0xbb, 0x76, 0x0d, 0xd5, 0xcc, 0x98, 0x16, 0x99, 0x69, 0x0e, 0xc9, 0xaa, 0xbe, 0x8b, 0x77,
+          0x0a, 0x03, 0x39, 0x80, 0xf8, 0xef, 0xab, 0x66, 0x99, 0xfd, 0x6b, 0xfa, 0xa0, 0xb6, 0xa7, 0xe8, 0x45, 0x9e, 0x2d, 0x4b, 0xa7, 0xcd, 0x22, 0x8c,
+          0x8d, 0x97, 0xd7, 0x25, 0xb2, 0x38, 0x4b, 0x70, 0x9e, 0x7e, 0x71, 0xd5, 0xfa, 0x77, 0x79, 0x37, 0x10, 0x21, 0xa5, 0xc9, 0x94, 0x02, 0xb1, 0x99,
+          0x04, 0xba, 0x5e, 0x06, 0x27, 0x0b, 0xb3, 0xda, 0x26, 0xea, 0x2a, 0xe5, 0x10, 0x6a, 0xc2, 0x79, 0xb4, 0x40, 0x81, 0x4b, 0xaa, 0x92, 0x27, 0x61,
+          0x13, 0xa9, 0x22, 0xf0, 0xd5, 0x6c, 0xb6, 0xd0, 0x90, 0xd4, 0xc2, 0x91, 0x9e, 0x5c, 0x93, 0xd5, 0xe2, 0xac, 0xf8, 0xf2, 0xa8, 0x2b, 0x51, 0xac,
+          0x89, 0x93, 0x84, 0x45, 0x55, 0xab, 0x8f, 0x79, 0x36, 0x6f, 0x12, 0x7a, 0x2a, 0xaf, 0x5e, 0x57, 0xa3, 0xf6, 0xae, 0x17, 0x46, 0x9f, 0x3b, 0xb5,
+          0xfd, 0x1a, 0xdc, 0xe6, 0x22, 0x8f, 0x0b, 0x64, 0xaf, 0x60, 0x39, 0xc6, 0x90, 0xb1, 0x8d, 0xee, 0x9b, 0x58, 0xa6, 0xb0, 0xf7, 0xbb, 0x5d, 0x07,
+          0xb4, 0x1f, 0x92, 0x55, 0xaf, 0x01, 0x54, 0x15, 0xf8, 0x02, 0x5b, 0x5e, 0xd7, 0xf4, 0xbe, 0x08, 0xd2, 0x67, 0x6e, 0x1e, 0xbd, 0x74, 0x70, 0x55,
+          0xf8, 0xac, 0x4e, 0xe9, 0xb4, 0x32, 0x94, 0xb9, 0x81, 0xc5, 0x23, 0x4f, 0x77, 0x15, 0xed, 0xb6, 0xba, 0x18, 0x11, 0x8b, 0x9a, 0x12, 0x73, 0x6b,
+          0x8d, 0x07, 0x9b, 0x4f, 0xeb, 0x5c, 0xd9, 0x64, 0x71, 0x34, 0xe2, 0xf4, 0x76, 0x9b, 0xad, 0x81, 0x28, 0x0b, 0x95, 0xd4, 0xb2, 0xda, 0xda, 0xb7,
+          0x39, 0x50, 0x84, 0x32, 0x36, 0x29, 0xd2, 0x6c, 0xc2, 0x36, 0x7a, 0x09, 0x4e, 0x18, 0x1c, 0x96, 0x87, 0xf5, 0x14, 0xa7, 0x9a, 0x70, 0x22, 0xc5,
+          0x93, 0x01, 0x50, 0x7b, 0xe3, 0x07, 0xef, 0xe0, 0x7d, 0x39, 0x15, 0x32, 0xd1, 0x8d, 0x80, 0x71, 0x1c, 0x78, 0x27, 0x50, 0x3a, 0x0e, 0xd0, 0x3f,
+          0xc6, 0xda, 0x90, 0xe2, 0xd4, 0xfb, 0x8c, 0x46, 0x98, 0x2a, 0xa4, 0x01, 0x48, 0x7c, 0x37, 0x82, 0xae, 0x3b, 0xc9, 0x84, 0xf7, 0x09, 0xb5, 0xe2,
+          0xe8, 0x50, 0x5d, 0x56, 0xbf, 0x33, 0x53, 0x98, 0x49, 0xeb, 0x0b, 0x7d, 0x37, 0x86, 0x00, 0x79, 0xde, 0x17, 0xfc, 0x63, 0x4f, 0xd8, 0xf6, 0xa2,
+          0x76, 0x10, 0xb5, 0xe3, 0x75, 0x70, 0xd6, 0xd0, 0x75, 0xd9, 0x11, 0xd9, 0xc9, 0x2f, 0x54, 0x21, 0x40, 0xd3, 0x18, 0xf0, 0xd7, 0xdc, 0xa0, 0xd6,
+          0x48, 0xb1, 0xc6, 0xc6, 0x6f, 0xa2, 0x20, 0x66, 0xfa, 0xa5, 0x3f, 0xfc, 0xc4, 0x5f, 0x27, 0x4b, 0x19, 0x5e, 0xc7, 0x95, 0x67, 0x8a, 0x65, 0xac,
+          0x9b, 0x67, 0x0b, 0x99, 0x39, 0x9e, 0x80, 0xf5, 0x34, 0xd4, 0x57, 0x67, 0x12, 0x64, 0xad, 0x60, 0x3d, 0xcb, 0x71, 0x8a, 0xea, 0x7e, 0x98, 0xd5,
+          0x23, 0x1b, 0xdf, 0x27, 0xb7, 0x10, 0x97, 0x1a, 0x7e, 0x5b, 0xe1, 0xb1, 0xa9, 0x7c, 0x50, 0x99, 0xe9, 0x37, 0xf0, 0xb6, 0x87, 0x4c, 0x08, 0xcf,
+          0x32, 0xe0, 0x7c, 0xbe, 0xf1, 0xaa, 0xa0, 0xdd, 0x0c, 0xb8, 0x75, 0x06, 0xd9, 0x16, 0xb9, 0x47, 0xc1, 0x04, 0x23, 0x09, 0xb2, 0x08, 0xb4, 0x55,
+          0xc3, 0x43, 0xa6, 0x5e, 0x86, 0xa0, 0x5e, 0xc9, 0xe2, 0xfd, 0x8b, 0xb3, 0x06, 0xab, 0x76, 0x36, 0xf5, 0x20, 0xed, 0x3c, 0xe7, 0xef, 0xf6, 0xfc,
+          0x4c, 0x25, 0xcf, 0x3e, 0x5d, 0xd6, 0x41, 0x79, 0x96, 0x2e, 0x26, 0x71, 0xd9, 0xa2, 0xba, 0x93, 0xd3, 0xb2, 0x1b, 0xc1, 0xb9, 0x64, 0xa9, 0xc4,
+          0x11, 0x3f, 0x4a, 0x73, 0xfb, 0xad, 0x32, 0x28, 0xa9, 0x6d, 0x05, 0x2e, 0x9d, 0xf7, 0x42, 0x7b, 0x28, 0x30, 0x26, 0x51, 0xf2, 0x58, 0x8b, 0xba,
+          0x91, 0xa7, 0xec, 0xea, 0xbf, 0xf5, 0xd3, 0x06, 0x93, 0x89, 0xcf, 0xa0, 0x91, 0xc7, 0xd8, 0x86, 0xcf, 0x1a, 0xdb, 0x56, 0x30, 0xab, 0x80, 0xab,
+          0x3a, 0x71, 0xed, 0x30, 0x14, 0xb1, 0x5b, 0x03, 0xdd, 0x7f, 0x70, 0xaf, 0x05, 0x04, 0x9c, 0xc3, 0xc1, 0x31, 0x6a, 0xca, 0xa2, 0x86, 0xc5, 0x68,
+          0xcb, 0x18, 0x4f, 0xa6, 0xe0, 0xd1, 0xc5, 0xf1, 0x2e, 0x28, 0xc9, 0xa5, 0xf6, 0x53, 0xad, 0x46, 0x5b, 0x1c, 0x07, 0x7f, 0x3c, 0x0c, 0x63, 0x19,
+          0x31, 0xc9, 0x2c, 0xf3, 0x18, 0x51, 0x83, 0x70, 0x60, 0x4b, 0x90, 0x9d, 0x97, 0x17, 0xd6, 0x7d, 0x33, 0x25, 0xd0, 0xcd, 0x54, 0x3e, 0x49, 0x96,
+          0x6f, 0x7d, 0x91, 0x42, 0xfb, 0x64, 0x78, 0xae, 0xbb, 0x4c, 0xe3, 0x76, 0xd2, 0x0d, 0x07, 0x44, 0x25, 0x2f, 0x7a, 0x45, 0xae, 0x41, 0x63, 0x14,
+          0xbd, 0xd3, 0x45, 0xfe, 0xdd, 0x90, 0xd0, 0xcd, 0xb8, 0x9d, 0x2c, 0x0c, 0xff, 0x47, 0xae, 0xfe, 0xe3, 0xf3, 0x04, 0x7d, 0x3b, 0x11, 0xbe, 0x5f,
+          0x00, 0xc9, 0xf3, 0x0d, 0xfb, 0x87, 0x94, 0xc0, 0x82, 0xe8, 0xb0, 0x86, 0xb9, 0x7f, 0x0e, 0x2d, 0x3b, 0x8f, 0x08, 0x77, 0xf0, 0xe4, 0xc8, 0x69,
+          0x09, 0x7c, 0x55, 0x37, 0xf0, 0x85, 0xfa, 0x8e, 0xaa, 0xdc, 0x06, 0x87, 0x8e, 0x26, 0xa8, 0x35, 0x8c, 0x12, 0x6d, 0xe6, 0x7e, 0x28, 0x96, 0x47,
+          0x58, 0xd9, 0xf0, 0x3a, 0xd6, 0x25, 0x7a, 0xdc, 0x62, 0x40, 0x15, 0x67, 0x6b, 0x6e, 0x91, 0xe3, 0x61, 0xb4, 0x90, 0xe5, 0xb9, 0xf6, 0x8e, 0x33,
+          0x98, 0x97, 0x7c, 0x63, 0x42, 0xd2, 0x59, 0x9f, 0xbd, 0xa7, 0x67, 0x08, 0x2d, 0xe6, 0xa4, 0x29, 0xe4, 0x36, 0xe4, 0x45, 0xed, 0x54, 0x70, 0x2e,
+          0xe9, 0xb0, 0xf8, 0x44, 0x48, 0x90, 0x9a, 0x12, 0x3a, 0x1b, 0xf5, 0x3e, 0x79, 0xaa, 0x6b, 0xba, 0x84, 0x50, 0x9b, 0x5c, 0xc3, 0x7d, 0x1f, 0x26,
+          0xf6, 0x30, 0x46, 0x13, 0x05, 0x14, 0x19, 0xc1, 0xa2, 0x47, 0xc4, 0x41, 0xf9, 0xbb, 0x17, 0xc2, 0xd4, 0x90, 0x03, 0x26, 0xf9, 0xdc, 0x00, 0x57,
+          0xc5, 0x35, 0x76, 0x88, 0x3a, 0x26, 0x6e, 0xc3, 0xec, 0xf0, 0x39, 0x7b, 0x56, 0xd0, 0x60, 0x82, 0x49, 0xa4, 0xb0, 0xd9, 0x06, 0x2d, 0x85, 0xa9,
+          0xe7, 0x8f, 0xea, 0x54, 0xd6, 0xd3, 0x70, 0x8e, 0xe5, 0x9e, 0x6d, 0x38, 0xc2, 0x3d, 0x26, 0xae, 0x24, 0x14, 0x8a, 0x20, 0xa5, 0x1a, 0x44, 0xa9,
+          0xdf, 0x1b, 0xf5, 0x8a, 0x92, 0x25, 0xeb, 0x8d, 0xc1, 0x75, 0xcc, 0x1e, 0x5c, 0x3b, 0x6b, 0xd0, 0xf0, 0xf1, 0x7d, 0x1e, 0x9d, 0x97, 0x2c, 0x3c,
+          0x9e, 0xe7, 0x22, 0x70, 0xc4, 0x07, 0x70, 0xc9, 0x5d, 0x36, 0x0a, 0x1d, 0x60, 0xf2, 0x7d, 0x00, 0x52, 0x3a, 0xe5, 0x25, 0x3a, 0xbd, 0xab, 0xdd,
+          0x15, 0x97, 0x7f, 0x13, 0xe7, 0xef, 0xc4, 0xa7, 0x78, 0x1a, 0xd8, 0xb9, 0xf6, 0xb4, 0x93, 0x3f, 0x9e, 0xde, 0x95, 0x5b, 0xb0, 0x42, 0x7c, 0x8a,
+          0x31, 0x21, 0x5d, 0x4d, 0x4e, 0x0a, 0xf0, 0x4e, 0x2d, 0x65, 0x9a, 0x4d, 0x9d, 0xc1, 0xbe, 0x9b, 0xbf, 0xc3, 0xa0, 0xf3, 0x41, 0x4b, 0xb0, 0x12,
+          0xda, 0xc5, 0x84, 0x54, 0x62, 0x49, 0x5f, 0x27, 0xb4, 0xd9, 0x3b, 0x28, 0xd2, 0x33, 0xa0, 0x7a, 0x0d, 0xd1, 0x19, 0xd5, 0xcf, 0x55, 0xab, 0x52,
+          0xb2, 0xba, 0x6c, 0xf7, 0x48, 0x25, 0x94, 0x33, 0x4a, 0x52, 0xda, 0xe5, 0x44, 0x71, 0xf9, 0xb2, 0x01, 0x5e, 0x59, 0xf6, 0x9e, 0xf4, 0xeb, 0xc9,
+          0xdd, 0x21, 0x4d, 0x24, 0x88, 0x7e, 0x9d, 0xa0, 0x02, 0x32, 0x26, 0x84, 0x3d, 0x61, 0xdc, 0x48, 0x72, 0xa8, 0xa8, 0xcd, 0x7d, 0xbb, 0x42, 0x73,
+          0x5b, 0xcc, 0x34, 0xf3, 0x9f, 0x0a, 0x91, 0xa7, 0xfa, 0x26, 0x08, 0x81, 0x8f, 0xb8, 0x79, 0xad, 0xd3, 0xbf, 0x48, 0xaa, 0xb9, 0x75, 0x17, 0x0b,
+          0x8a, 0x0c, 0xce, 0x50, 0x53, 0x2f, 0x0e, 0x93, 0x56, 0x6c, 0x21, 0x73, 0x18, 0x99, 0xd6, 0x7e, 0xa2, 0x2b, 0xc2, 0x7b, 0xb7, 0xdb, 0xc3, 0x52,
+          0x7c, 0x7f, 0xc5, 0xc7, 0x5e, 0x81, 0xa3, 0x43, 0xa3, 0x17, 0xca, 0x19, 0x50, 0x10, 0xe9, 0x0f, 0x0b, 0x6f, 0x12, 0x98, 0x81, 0x32, 0xde, 0x75,
+          0xd5, 0x83, 0xe3, 0x72, 0xb8, 0x7c, 0x33, 0x2f, 0x1f, 0x52, 0x2e, 0xbc, 0xf2, 0x2c, 0xb2, 0x29, 0x29, 0x1e, 0x3f, 0xa2, 0x8f, 0x6a, 0x82, 0x62,
+          0xa0, 0x77, 0xc7, 0x3a, 0x4c, 0x8e, 0x5a, 0xa6, 0x39, 0x0f, 0x1c, 0x3c, 0xb1, 0xe1, 0xee, 0x43, 0x20, 0xbf, 0x46, 0x76, 0xb1, 0x49, 0x00, 0x32,
+          0xc6, 0x25, 0xb5, 0xf7, 0x70, 0x86, 0x76, 0x16, 0xce, 0x23, 0x16, 0xff, 0x35, 0x88, 0x17, 0x78, 0xb5, 0x84, 0x74, 0x85, 0x32, 0xc7, 0x2f, 0x6d,
+          0xe3, 0x03, 0x94, 0x86, 0x73, 0xaf, 0xb3, 0x84, 0xa7, 0x0e, 0x89, 0x9d, 0xef, 0xdb, 0x3b, 0xd9, 0x3b, 0x4d, 0x80, 0x3e, 0x7f, 0x6b, 0x40, 0xcd,
+          0xcc, 0x85, 0x98, 0xa0, 0xa8, 0x38, 0x40, 0xfe, 0xbf, 0x48, 0xcf, 0x87, 0xd0, 0xde, 0xb3, 0xc6, 0xa4, 0xe8, 0xcb, 0xbd, 0x77, 0x65, 0xa3, 0x77,
+          0x43, 0x75, 0x65, 0x71, 0x3b, 0x01, 0x16, 0xf7, 0x46, 0x96, 0x7a, 0x6d, 0x27, 0x8e, 0xff, 0xab, 0x81, 0x8a, 0x04, 0xa0, 0x3d, 0xd9, 0x32, 0x61,
+          0x03, 0x93, 0xab, 0x57, 0x65, 0xfb, 0x71, 0x36, 0x9e, 0xc3, 0x2d, 0xb1, 0x8c, 0x2b, 0xff, 0xb0, 0x0f, 0xa2, 0x29, 0x92, 0x38, 0x9e, 0x3d, 0x85,
+          0xd2, 0x67, 0x84, 0x41, 0x9d, 0x0c, 0xff, 0x45, 0x97, 0x8d, 0x0b, 0xc6, 0xc5, 0x5a, 0xee, 0x7a, 0x93, 0xa0, 0x26, 0x1e, 0xcd, 0x22, 0x1e, 0x78,
+          0xe1, 0x7f, 0xba, 0x84, 0xee, 0xe5, 0x9c, 0x40, 0x8e, 0xd9, 0x08, 0x07, 0x2e, 0x3b, 0xb8, 0x42, 0x0e, 0x76, 0x13, 0x2a, 0x38, 0xb6, 0xcd, 0x13,
+          0xfa, 0x04, 0x69, 0x9f, 0x3e, 0xde, 0x78, 0x20, 0xec, 0xd7, 0x61, 0x65, 0xb2, 0x78, 0xe8, 0x84, 0x45, 0x89, 0xb1, 0x31, 0xd7, 0xce, 0xd3, 0xb7,
+          0xa2, 0x83, 0x2f, 0x48, 0x14, 0xbe, 0xb0, 0x50, 0x14, 0x4f, 0x48, 0x2e, 0x64, 0xa7, 0x9a, 0x59, 0x83, 0x6f, 0xb3, 0x19, 0xd9, 0x28, 0x21, 0x9b,
+          0x97, 0x90, 0x9e, 0x42, 0xb4, 0x2b, 0x61, 0xbb, 0x05, 0xf0, 0xb4, 0x4d, 0xb7, 0x12, 0x23, 0x1a, 0x25, 0x51, 0x87, 0xdb, 0xcf, 0x33, 0xa0, 0x26,
+          0x5e, 0xce, 0x85, 0x90, 0x61, 0x6e, 0x54, 0x8f, 0x80, 0x32, 0x26, 0x9a, 0xc8, 0x6e, 0xcc, 0xe5, 0x9e, 0xaa, 0xf2, 0x61, 0xd8, 0x9d, 0xf6, 0x38,
+          0xc9, 0x9d, 0x9e, 0x94, 0x36, 0x13, 0x32, 0xee, 0x1c, 0xe5, 0x98, 0x15, 0x79, 0x30, 0xea, 0x47, 0xe5, 0x2e, 0x23, 0x69, 0xc2, 0xe5, 0xaf, 0x6a,
+          0x3e, 0x81, 0xf7, 0x2f, 0x11, 0xe0, 0xc0, 0x0b, 0x8b, 0x5f, 0xbc, 0xf6, 0xda, 0xe3, 0xe3, 0xa2, 0xf6, 0x35, 0xbf, 0xaf, 0x2e, 0x45, 0x96, 0xbf,
+          0x85, 0x31, 0xd6, 0x4a, 0xf8, 0x79, 0x14, 0xb5, 0x94, 0x8b, 0x05, 0x74, 0x56, 0xc1, 0x83, 0x6a, 0x21, 0xfb, 0xab, 0x7a, 0xd7, 0x15, 0x32, 0x09,
+          0xaa, 0x36, 0xfb, 0x0c, 0x42, 0xce, 0xb2, 0x97, 0x2a, 0xa6, 0xca, 0x6d, 0x0b, 0xc0, 0x16, 0xe8, 0x60, 0x13, 0xc3, 0xec, 0x8a, 0x38, 0xe7, 0xd8,
+          0x71, 0x7f, 0x53, 0x81, 0x4e, 0xcb, 0xb9, 0xcf, 0x1d, 0xab, 0xb1, 0xed, 0x4d, 0x90, 0x6b, 0xb6, 0x39, 0xd9, 0x33, 0xce, 0xb5, 0x40, 0x85, 0x69,
+          0x75, 0xcb, 0xc6, 0x5a, 0x73, 0x2b, 0x66, 0xf8, 0x6d, 0xa6, 0x59, 0x58, 0xa6, 0xf7, 0x32, 0xb7, 0xdc, 0xbb, 0xcc, 0x31, 0xee, 0xf6, 0x7c, 0xd4,
+          0x52, 0x95, 0x51, 0x59, 0x69, 0x63, 0x52, 0xb3, 0x66, 0xcf, 0x22, 0xcb, 0x8b, 0xf7, 0x61, 0xa4, 0x65, 0x42, 0x1f, 0x75, 0x4b, 0xf5, 0x39, 0xde,
+          0xc7, 0xdd, 0xbe, 0x63, 0xde, 0x47, 0xdc, 0x1e, 0xa8, 0xc1, 0x76, 0x54, 0x85, 0xb7, 0x2f, 0xe2, 0x7e, 0x4a, 0xd8, 0x9b, 0x70, 0x3f, 0x31, 0x4e,
+          0x92, 0xfb, 0x29, 0x7b, 0x9e, 0xf3, 0x19, 0x3b, 0xde, 0xd1, 0x41, 0xba, 0x4e, 0x15, 0x87, 0x1a, 0x9b, 0x27, 0x1b, 0x92, 0x11, 0x49, 0x1f, 0x9f,
+          0x96, 0x56, 0x2d, 0x1d, 0x6b, 0x43, 0x9e, 0xe7, 0xf8, 0x36, 0x81, 0x10, 0x63, 0x8e, 0xf4, 0x73, 0xcb, 0xe9, 0xd5, 0xbe, 0x7e, 0x07, 0x0d, 0xf2,
+          0xef, 0xa6, 0x6c, 0x84, 0x6a, 0x75, 0xd7, 0x2f, 0xd2, 0x7a, 0xf0, 0x0f, 0xcf, 0xdd, 0x58, 0xbd, 0x8b, 0xe3, 0xd2, 0x3a, 0xad, 0x7a, 0x49, 0x6f,
+          0x25, 0xfa, 0xf3, 0xd3, 0xc5, 0x2b, 0x7e, 0x1e, 0x96, 0x26, 0x27, 0xb6, 0x6c, 0xee, 0xb4, 0x34, 0x66, 0xde, 0x17, 0xa4, 0x33, 0xac, 0x43, 0x03,
+          0x72, 0xf4, 0x39, 0x75, 0x64, 0xd7, 0x14, 0x1e, 0x09, 0x94, 0x0f, 0xd2, 0x4b, 0x04, 0x48, 0x06, 0x4c, 0x8c, 0xcb, 0xd5, 0x6d, 0xc8, 0x26, 0xb6,
+          0x76, 0xe3, 0x63, 0xc7, 0xb0, 0xec, 0x5a, 0x43, 0xaf, 0xa5, 0x02, 0xc4, 0xc6, 0x23, 0xb8, 0x68, 0x40, 0xef, 0x61, 0xa1, 0xc8, 0x67, 0x10, 0xae,
+          0x78, 0x89, 0x59, 0xe8, 0x2f, 0xe3, 0x7d, 0x5a, 0x95, 0xc0, 0x4b, 0xbe, 0x81, 0xa2, 0xd8, 0xc1, 0xc6, 0x79, 0x38, 0xa5, 0x20, 0x53, 0x46, 0x5c,
+          0x13, 0x4b, 0xd2, 0xc0, 0xc9, 0x8a, 0x23, 0x69, 0x8e, 0x44, 0xb1, 0x88, 0xb8, 0x61, 0x8a, 0x44, 0x21, 0xb0, 0x22, 0x30, 0x5a, 0xe9, 0x74, 0x30,
+          0xe0, 0x04, 0xd0, 0x0f, 0xe8, 0x07, 0xf6, 0x91, 0x0c, 0x65, 0x9e, 0x33, 0x56, 0x02, 0x19, 0x96, 0x19, 0xed, 0x76, 0x84, 0x2c, 0x68, 0x39, 0x5b,
+          0x62, 0x99, 0xcb, 0x16, 0x01, 0x7b, 0xe3, 0x9d, 0x87, 0x30, 0x61, 0x21, 0x38, 0x1b, 0x86, 0x79, 0x27, 0x5c, 0x0f, 0x02, 0x68, 0x60, 0x78, 0xcb,
+          0x0b, 0x5d, 0xc5, 0x89, 0x4d, 0x87, 0x7d, 0x67, 0x7f, 0x85, 0xd8, 0x9c, 0x64, 0x25, 0x8c, 0x72, 0x0b, 0xb2, 0xae, 0xf6, 0x74, 0xd2, 0x3f, 0x73,
+          0x30, 0x2b, 0x1e, 0x69, 0x59, 0xe0, 0x6f, 0xfa, 0xa8, 0xd4, 0x05, 0x6e, 0x81, 0x29, 0x6b, 0xd1, 0xfd, 0x9c, 0xdb, 0x73, 0x40, 0xbd, 0x70, 0x5e,
+          0x6a, 0x45, 0x10, 0xce, 0x97, 0x0d, 0x64, 0x87, 0x2e, 0x98, 0xe6, 0xd9, 0x61, 0xee, 0x1b, 0xc7, 0x33, 0x49, 0x99, 0x20, 0x75, 0xc8, 0xc2, 0x5b,
+          0x77, 0x3e, 0x1a, 0x8c, 0xf9, 0xfc, 0x25, 0x90, 0xdf, 0x89, 0x77, 0x9c, 0x54, 0x29, 0x32, 0x03, 0x8b, 0xc8, 0xf7, 0xd9, 0x15, 0x3d, 0x70, 0x4f,
+          0xd6, 0xb2, 0x4f, 0x7b, 0xfa, 0xc8, 0x33, 0x8b, 0xa2, 0xc0, 0x13, 0xe2, 0x4a, 0x27, 0x71, 0x2e, 0xc8, 0xd3, 0x67, 0xe4, 0x74, 0x97, 0xf2, 0xbc,
+          0x57, 0x91, 0xce, 0x76, 0x92, 0x1e, 0xb8, 0x6d, 0x78, 0x9f, 0x37, 0xba, 0xfe, 0x04, 0x53, 0xfd, 0xe2, 0x0d, 0x26, 0xa4, 0x61, 0x8b, 0xcc, 0x1d,
+          0x70, 0x42, 0xa1, 0x26, 0x8f, 0x87, 0x50, 0x17, 0x4f, 0xbf, 0xf2, 0x0a, 0x8c, 0xbf, 0x80, 0x35, 0x97, 0xdb, 0x2a, 0x13, 0xfb, 0x8b, 0x7e, 0x49,
+          0x11, 0x28, 0xeb, 0xa1, 0x8a, 0xc0, 0xea, 0xc1, 0xed, 0x7b, 0x89, 0x1e, 0xc1, 0x64, 0x22, 0xba, 0x84, 0x93, 0x66, 0x1a, 0x84, 0x6f, 0x86, 0xe9,
+          0xff, 0x7b, 0xd9, 0x15, 0x92, 0x7a, 0x7a, 0x96, 0x07, 0x4f, 0x47, 0xb9, 0x47, 0x18, 0x1c, 0xa8, 0xf0, 0xf2, 0x19, 0x39, 0x37, 0x94, 0x9c, 0xb9,
+          0x6b, 0x05, 0x37, 0xf4, 0xb2, 0x23, 0x07, 0xe7, 0x5d, 0x96, 0xa5, 0x22, 0x9b, 0xb2, 0x20, 0xfc, 0xe4, 0xe8, 0x75, 0xeb, 0x9b, 0x87, 0xd3, 0x29,
+          0x4a, 0xd4, 0x51, 0x53, 0x54, 0xc3, 0x13, 0x09, 0xd8, 0xf2, 0x69, 0x44, 0x60, 0xcd, 0x5c, 0x04, 0x8d, 0x4d, 0x97, 0x12, 0x5f, 0x2b, 0x86, 0xf0,
+          0x2e, 0xf8, 0x82, 0x95, 0x82, 0xb0, 0x4c, 0xfa, 0xb7, 0x91, 0xf0, 0x0a, 0xe4, 0x94, 0xdb, 0x00, 0x49, 0x8b, 0x83, 0xba, 0x3b, 0xa8, 0x63, 0xba,
+          0xac, 0x3c, 0x77, 0xc4, 0x91, 0x4a, 0xe5, 0x85, 0xc7, 0xd9, 0x88, 0x66, 0x2d, 0xb9, 0x42, 0x6b, 0x6e, 0xcd, 0x53, 0x6d, 0x93, 0xb5, 0xef, 0xf5,
+          0xe2, 0xd9, 0x24, 0x5a, 0x20, 0x8a, 0x02, 0x66, 0xd3, 0xd6, 0x7d, 0x74, 0xbc, 0x03, 0xbf, 0x1f, 0x88, 0xd8, 0x17, 0x31, 0xa9, 0x10, 0x30, 0xc2,
+          0x8e, 0x6b, 0x8e, 0xb8, 0x5b, 0x59, 0x6b, 0x65, 0x65, 0x87, 0x36, 0x98, 0x02, 0x34, 0x12, 0x9f, 0xe8, 0x3a, 0x96, 0x23, 0x11, 0xcf, 0x0c, 0xa6,
+          0x4b, 0xdb, 0x87, 0x6c, 0x7a, 0xdf, 0xd3, 0x14, 0xba, 0x65, 0x26, 0x34, 0x82, 0xca, 0x8c, 0x7d, 0xe1, 0x1f, 0x23, 0x0c, 0x97, 0xda, 0xb0, 0xe8,
+          0x48, 0x1e, 0xf7, 0x3d, 0x9e, 0x86, 0x5c, 0xc1, 0x58, 0xb9, 0xe6, 0x79, 0xcc, 0xd2, 0xbc, 0x01, 0xd9, 0x64, 0x51, 0xd2, 0x07, 0xd3, 0x50, 0xe1,
+          0x56, 0xdd, 0xf8, 0x58, 0x33, 0x1a, 0xc5, 0x2e, 0x08, 0xef, 0x81, 0xf3, 0x46, 0x4c, 0xac, 0x95, 0x34, 0x61, 0x3e, 0xac, 0xfc, 0xb3, 0x61, 0x38,
+          0xec, 0x97, 0x64, 0xd4, 0x42, 0x5e, 0x40, 0xc2, 0xf3, 0xf6, 0x9f, 0x3a, 0x61, 0xdd, 0xd0, 0x6b, 0x63, 0x88, 0x58, 0x9a, 0x9c, 0xb4, 0x22, 0x8b,
+          0xad, 0x07, 0xae, 0x9d, 0x05, 0xe2, 0xd3, 0x6d, 0x0c, 0x7c, 0x28, 0xec, 0x26, 0x66, 0x50, 0x91, 0x6a, 0x03, 0xe6, 0xf0, 0x50, 0xd1, 0x44, 0xe0,
+          0x29, 0x6b, 0xea, 0xd0, 0x9f, 0x66, 0xc1, 0xe5, 0xa9, 0x2a, 0x6d, 0xc7, 0x57, 0xae, 0x8f, 0xf8, 0xc0, 0x1d, 0x00, 0x20, 0xda, 0xe7, 0xa0, 0x68,
+          0x12, 0xd5, 0x42, 0xd6, 0x21, 0xa0, 0x20, 0x08, 0x95, 0x1e, 0x1e, 0x71, 0x6d, 0xbe, 0x0e, 0x0a, 0x71, 0xd2, 0x87, 0xa6, 0xd2, 0x03, 0x3a, 0x44,
+          0xd0, 0x07, 0xc7, 0x77, 0xe8, 0xf0, 0x2b, 0x41, 0xf8, 0xe3, 0xef, 0xd7, 0x54, 0xe8, 0x93, 0x2f, 0x79, 0x03, 0x46, 0x49, 0x0f, 0xd0, 0x5a, 0x0d,
+          0x3c, 0x6f, 0xb3, 0x9b, 0x08, 0x3e, 0xd2, 0x62, 0x42, 0x29, 0x41, 0x85, 0x9b, 0x0b, 0x5f, 0x9a, 0x1f, 0x57, 0x73, 0x61, 0xf8, 0xd1, 0x89, 0xa7,
+          0xae, 0x85, 0xaf, 0x5e, 0x52, 0x3d, 0x0e, 0x77, 0x0d, 0xd1, 0x52, 0xd7, 0x16, 0x22, 0x14, 0xc5, 0x70, 0x9b, 0xa3, 0xb4, 0x30, 0x36, 0x1e, 0xa5,
+          0xfa, 0x11, 0x09, 0x38, 0xbe, 0xcf, 0x2d, 0xb9, 0xb9, 0xc8, 0xb0, 0x9b, 0x8f, 0xe2, 0x61, 0x55, 0xcc, 0x4a, 0xdd, 0xe2, 0x5a, 0xf2, 0x69, 0xe6,
+          0x39, 0xa1, 0xa5, 0x78, 0x35, 0xce, 0x16, 0x09, 0xb1, 0x73, 0xe3, 0xf2, 0xec, 0x59, 0x4f, 0x01, 0xa5, 0xf8, 0x19, 0x29, 0xc3, 0xae, 0xc7, 0xbc,
+          0xba, 0x6d, 0xb9, 0x06, 0xfa, 0xb7, 0xc2, 0xb9, 0x8b, 0xa9, 0xc9, 0x2c, 0xad, 0xdc, 0x5c, 0x66, 0x20, 0xf4, 0x26, 0x0b, 0x94, 0x34, 0x23, 0x4a,
+          0x27, 0x8f, 0x45, 0x15, 0xd7, 0x05, 0x2f, 0x2a, 0x09, 0x1d, 0x29, 0x56, 0x71, 0xe5, 0xfa, 0xc2, 0x32, 0x21, 0x2d, 0x52, 0x17, 0xa6, 0x02, 0xf4,
+          0x50, 0xbc, 0xd0, 0x7a, 0xb6, 0x98, 0xd2, 0xc4, 0xd9, 0xc8, 0x85, 0x3d, 0xb4, 0xc9, 0x52, 0x6c, 0xe2, 0xe1, 0x42, 0xff, 0xa7, 0xaa, 0x17, 0x2b,
+          0xd4, 0x36, 0xa8, 0xe3, 0xcc, 0x0b, 0xd7, 0x5a, 0xad, 0x20, 0xf3, 0x50, 0x7d, 0xbd, 0xf9, 0x26, 0xe9, 0xae, 0xf7, 0x3b, 0x25, 0xc7, 0x21, 0xf3,
+          0x5c, 0x8b, 0x66, 0xe4, 0xf8, 0xaf, 0xb9, 0x92, 0x4f, 0x8d, 0xe6, 0x48, 0x11, 0x2a, 0xa7, 0x5f, 0x24, 0x61, 0xfc, 0x56, 0x9f, 0xdd, 0x2e, 0x09,
+          0x9d, 0x31, 0x1e, 0x37, 0xf2, 0xf0, 0xbd, 0x70, 0x26, 0x7f, 0x1c, 0x5b, 0xc4, 0x3b, 0x70, 0x38, 0xfe, 0x85, 0xbc, 0xc1, 0x74, 0xdc, 0xdb, 0xf0,
+          0xa9, 0x5e, 0x45, 0xa5, 0xa8, 0x74, 0xde, 0xe4, 0x30, 0x55, 0x2b, 0x73, 0x77, 0xfb, 0xdc, 0x9c, 0x5b, 0xef, 0x14, 0x0d, 0x02, 0x3a, 0x4b, 0xa6,
+          0xf6, 0x65, 0xa9, 0x06, 0x20, 0xfe, 0x65, 0xe0, 0x2e, 0x80, 0xab, 0x58, 0x1d, 0x5b, 0x09, 0x6b, 0xc5, 0xe3, 0xcf, 0x0b, 0x59, 0x99, 0x6c, 0x58,
+          0xf9, 0xce, 0xd5, 0x1e, 0x14, 0x3c, 0xa3, 0x58, 0xc0, 0x67, 0x5d, 0xab, 0x53, 0xeb, 0x7e, 0xd8, 0xa9, 0x0e, 0x6e, 0xf2, 0xe8, 0x6c, 0x6d, 0xd2,
+          0x64, 0xe8, 0xd4, 0x66, 0x95, 0x2b, 0x6d, 0xa6, 0xa6, 0xf7, 0xba, 0xa9, 0x51, 0x82, 0xb5, 0x0b, 0xa2, 0x76, 0xe0, 0x70, 0xde, 0x4f, 0xb1, 0x20,
+          0x7b, 0xa7, 0xe5, 0x8c, 0x74, 0xaf, 0xb2, 0xad, 0xc7, 0xb7, 0x7d, 0x33, 0x6d, 0xef, 0xed, 0x47, 0xec, 0x4a, 0xa7, 0x83, 0x5f, 0x74, 0xf1, 0xe9,
+          0xc2, 0xaa, 0xf8, 0x74, 0x90, 0x2e, 0xf4, 0x2b, 0xbb, 0x1c, 0xe5, 0x77, 0xab, 0x65, 0xe8, 0x3f, 0x36, 0x54, 0x99, 0x8a, 0xcd, 0x8d, 0x2d, 0x8e,
+          0x61, 0x72, 0xbb, 0x0e, 0x28, 0xce, 0x4b, 0x80, 0xd3, 0x7e, 0x4d, 0x73, 0x6d, 0x6b, 0x0f, 0x7a, 0x8a, 0x87, 0xc6, 0xee, 0x86, 0x18, 0xc5, 0xb5,
+          0xed, 0xe1, 0x0d, 0xb3, 0x2d, 0xfc, 0xcb, 0x56, 0x87, 0x53, 0x45, 0x82, 0x99, 0x24, 0xdf, 0x4e, 0xc7, 0xc1, 0xa7, 0xa3, 0x71, 0xc4, 0xbd, 0x0d,
+          0xb2, 0x53, 0x22, 0xf3, 0x39, 0x09, 0xa6, 0xad, 0x6f, 0x3b, 0x6b, 0x08, 0x16, 0x39, 0xa0, 0xf1, 0x9b, 0x21, 0x08, 0x06, 0xf9, 0xd2, 0x40, 0x29,
+          0x2f, 0xb3, 0x27, 0xd4, 0xfc, 0x2b, 0x0b, 0x12, 0x25, 0x8a, 0x53, 0x1c, 0x4a, 0xf0, 0xfe, 0x65, 0xf9, 0xb4, 0x17, 0x3b, 0x3c, 0xfe, 0x06, 0x88,
+          0x7c, 0xaa, 0xde, 0xc7, 0xa7, 0xe3, 0x8a, 0x38, 0x32, 0x47, 0x61, 0x06, 0x92, 0x92, 0x68, 0xa1, 0x4c, 0xc8, 0x61, 0x79, 0x1b, 0xd4, 0x54, 0xd9,
+          0x3b, 0x98, 0x9e, 0x5b, 0x43, 0xb8, 0x1e, 0xda, 0xb5, 0xd1, 0x20, 0x85, 0xe0, 0xaa, 0x2c, 0x5b, 0xb6, 0xd5, 0x84, 0xff, 0x4f, 0x90, 0x26, 0xf4,
+          0x30, 0xc3, 0xdb, 0x43, 0x72, 0xea, 0xa3, 0x95, 0xd0, 0x4d, 0xbd, 0xdf, 0x6d, 0x20, 0xad, 0xd4, 0x7f, 0xc8, 0xc5, 0x57, 0x4f, 0xe5, 0x69, 0xc3,
+          0xa4, 0x14, 0x3f, 0x59, 0x51, 0xce, 0xfb, 0x09, 0xa9, 0x32, 0xae, 0x18, 0x54, 0x0d, 0x2b, 0x75, 0x90, 0xcf, 0xab, 0x82, 0x36, 0x92, 0xdb, 0xe1,
+          0x11, 0x28, 0xdf, 0x1c, 0x44, 0x17, 0x9d, 0xad, 0xf5, 0x6d, 0xc7, 0x8b, 0x6f, 0xfc, 0xdd, 0xa0, 0xcc, 0xe8, 0xa7, 0xfd, 0x6a, 0xe2, 0xcc, 0xaf,
+          0xe5, 0x2b, 0x72, 0x7e, 0x08, 0x1b, 0x4e, 0x7e, 0xe0, 0xfb, 0x5e, 0x72, 0x20, 0x4b, 0xdf, 0xa9, 0xc0, 0x49, 0xd4, 0x02, 0x15, 0x95, 0xcd, 0x8a,
+          0xc2, 0xec, 0xf9, 0x56, 0xf5, 0x73, 0x0f, 0x4a, 0xb3, 0x55, 0x95, 0xa4, 0x55, 0x5c, 0xff, 0x3b, 0x68, 0x77, 0xf7, 0x6f, 0xc3, 0xea, 0x56, 0xd3,
+          0xa9, 0x1c, 0x58, 0x5a, 0xfe, 0xdb, 0xe9, 0xa5, 0xa9, 0x57, 0x55, 0x4f, 0xf2, 0xe8, 0xeb, 0xab, 0x74, 0x59, 0xa5, 0x42, 0x39, 0x3d, 0xb3, 0xa2,
+          0xbc, 0x77, 0xef, 0x76, 0x82, 0x94, 0x47, 0xa6, 0x05, 0xa4, 0x44, 0xb7, 0xd5, 0x5a, 0x2d, 0x54, 0x40, 0xe9, 0xd4, 0x64, 0xdd, 0x34, 0xe9, 0x66,
+          0x9d, 0x62, 0x74, 0x4e, 0x66, 0xb5, 0xb1, 0x88, 0x21, 0xb9, 0x9c, 0xee, 0x8f, 0x7d, 0x87, 0xc2, 0x4e, 0xee, 0xb8, 0xcc, 0xf7, 0x88, 0xff, 0x14,
+          0x4d, 0xc2, 0xba, 0xa1, 0x6e, 0x2c, 0xdd, 0xe6, 0x1f, 0xbd, 0x79, 0xe6, 0x6d, 0x77, 0xc8, 0x58, 0xdf, 0xdc, 0xd2, 0xb2, 0x37, 0xd6, 0xb8, 0x85,
+          0xe5, 0x6f, 0x0b, 0x68, 0xbb, 0x3f, 0xed, 0x8a, 0x1c, 0xcb, 0xc3, 0x03, 0x31, 0x0d, 0x41, 0x6c, 0xfa, 0x3d, 0x5b, 0xa4, 0x6f, 0x09, 0xb3, 0x8b,
+          0x50, 0x8d, 0x37, 0xa0, 0x6d, 0xdd, 0xc6, 0xa6, 0xe7, 0x76, 0x3d, 0xf6, 0xec, 0x60, 0x6b, 0x68, 0xd4, 0x03, 0x6e, 0x23, 0xf3, 0xad, 0x76, 0x75,
+          0x15, 0x45, 0x86, 0x4c, 0x01, 0x5c, 0xd1, 0x2d, 0x12, 0x1f, 0x35, 0xe5, 0x83, 0xe1, 0xda, 0xe6, 0x6f, 0xff, 0x51, 0x8f, 0xbf, 0xfb, 0xef, 0xe7,
+          0xda, 0x61, 0xc6, 0x1c, 0xdf, 0xbb, 0x66, 0xc6, 0x0d, 0x01, 0x40, 0xd2, 0xee, 0x6d, 0xdb, 0x2a, 0x6a, 0x28, 0x51, 0x36, 0x6b, 0x65, 0x2c, 0x13,
+          0x14, 0x8c, 0xad, 0x9a, 0x03, 0xd9, 0x35, 0x5b, 0x1a, 0x56, 0xb1, 0x37, 0x33, 0x12, 0xd6, 0x5e, 0xee, 0x0b, 0x27, 0x5b, 0x84, 0xc1, 0xdb, 0x58,
+          0xcd, 0x94, 0x74, 0xd5, 0x75, 0x0e, 0xfa, 0x4f, 0xe0, 0xad, 0x7e, 0x43, 0x38, 0xfd, 0x5b, 0xad, 0xaa, 0x2e, 0x21, 0xf7, 0xd0, 0x95, 0xc0, 0xbd,
+          0x80, 0x81, 0xfa, 0x39, 0x98, 0xc4, 0xf7, 0x2a, 0x9f, 0x61, 0xb6, 0xca, 0xbe, 0x1d, 0xf9, 0x5e, 0x97, 0xc4, 0xea, 0x72, 0x7a, 0x53, 0x60, 0x7f,
+          0x44, 0x2b, 0x66, 0xd4, 0xea, 0x72, 0xfd, 0xf7, 0x5a, 0x04, 0x5a, 0x2e, 0x30, 0xb4, 0x75, 0xa1, 0x39, 0x91, 0xb9, 0xa3, 0x09, 0x9d, 0x1e, 0x28,
+          0x57, 0xcc, 0x50, 0x8b, 0x4a, 0x98, 0xec, 0xc5, 0x3d, 0x23, 0xd5, 0xce, 0x48, 0xb5, 0xf3, 0xa3, 0x2f, 0x2e, 0xb3, 0x67, 0x67, 0xdc, 0x33, 0x37,
+          0xc2, 0xc9, 0x4c, 0x9c, 0xe6, 0xaa, 0x4f, 0xf3, 0x03, 0x93, 0x79, 0x02, 0xf1, 0xd3, 0x05, 0xa2, 0xc8, 0x79, 0xce, 0xb1, 0x53, 0xd7, 0xc8, 0xa7,
+          0xe5, 0xd4, 0x18, 0x25, 0xd3, 0xb9, 0xa4, 0x52, 0x11, 0xb4, 0xd1, 0xf5, 0xe0, 0x3e, 0x2a, 0x71, 0x71, 0xd0, 0x69, 0x2e, 0xdf, 0xa8, 0x8b, 0x11,
+          0x54, 0x2a, 0xb3, 0x64, 0x8b, 0x2c, 0x77, 0xad, 0xeb, 0x59, 0xdb, 0xd6, 0x24, 0x9f, 0xe9, 0xd1, 0x04, 0x38, 0xf0, 0xd6, 0xec, 0x42, 0x4f, 0x52,
+          0xc4, 0xc5, 0xb9, 0x70, 0x10, 0x44, 0x72, 0x94, 0x7b, 0x31, 0xb8, 0xd0, 0x3c, 0xbc, 0x4d, 0x5f, 0x03, 0xfa, 0x2f, 0x86, 0x5d, 0x32, 0xba, 0x80,
+          0x18, 0x33, 0xca, 0x5f, 0x94, 0xc4, 0x40, 0xed, 0x5b, 0x8b, 0x50, 0x95, 0xb1, 0x19, 0xf7, 0x8b, 0x66, 0x5a, 0x84, 0xe8, 0x3a, 0x07, 0x4c, 0x52,
+          0xe9, 0x1a, 0x09, 0x0d, 0xb3, 0x0a, 0x78, 0x64, 0xd9, 0xb2, 0xa3, 0xca, 0xdc, 0x9a, 0x57, 0xc6, 0x71, 0xe5, 0xa8, 0x0a, 0xa1, 0x1e, 0x65, 0xbe,
+          0x07, 0x6a, 0xdb, 0xb6, 0x2d, 0x78, 0x34, 0xbe, 0x18, 0xc0, 0x5c, 0xe3, 0xc3, 0xdd, 0x20, 0x73, 0x92, 0xeb, 0x75, 0x6f, 0xcc, 0x51, 0x58, 0xfc,
+          0x41, 0xd4, 0x2e, 0xec, 0xfd, 0x59, 0x63, 0xfe, 0xb2, 0x99, 0xbd, 0xd0, 0xe4, 0xf9, 0x11, 0x39, 0x9c, 0xc9, 0x82, 0xfe, 0x4f, 0xc9, 0x13, 0xf7,
+          0xaf, 0xad, 0xf2, 0xc3, 0xcc, 0x63, 0x0c, 0xf3, 0x5f, 0x71, 0xff, 0x88, 0x10, 0x88, 0xea, 0xe1, 0x74, 0x9d, 0x72, 0x58, 0x24, 0x97, 0x13, 0xe4,
+          0x48, 0x2e, 0xe8, 0xab, 0xb6, 0xc7, 0xa3, 0x4c, 0xda, 0x09, 0x28, 0x08, 0x2c, 0x8f, 0xb5, 0x1b, 0xc2, 0x5e, 0x7f, 0xe7, 0x1e, 0x18, 0x59, 0xcd,
+          0x1d, 0xe5, 0xaa, 0x1d, 0xb7, 0xa8, 0x3b, 0x9d, 0xdd, 0x24, 0xf7, 0x57, 0x84, 0x0d, 0x78, 0x86, 0x6c, 0x43, 0xa3, 0x5c, 0xc7, 0x83, 0x6b, 0x5a,
+          0xa5, 0xf1, 0x79, 0x01, 0x36, 0xaf, 0xc2, 0xa4, 0x74, 0xa9, 0xd2, 0xfa, 0xd8, 0xbe, 0x0b, 0xe5, 0x2d, 0xa1, 0x92, 0x92, 0x1d, 0x26, 0xc1, 0xd2,
+          0x89, 0xb9, 0x82, 0xb7, 0x1b, 0x60, 0x74, 0xec, 0x80, 0x62, 0x83, 0x79, 0x1b, 0x0f, 0x64, 0x28, 0xe5, 0x39, 0xb8, 0x22, 0x75, 0x58, 0x8d, 0x3c,
+          0x6f, 0xb6, 0x87, 0x7d, 0x17, 0xf5, 0xb4, 0xcb, 0xcd, 0x31, 0x88, 0xed, 0x57, 0x70, 0xbb, 0x27, 0x17, 0xdf, 0x18, 0xa5, 0xe0, 0x91, 0xeb, 0x4d,
+          0xc8, 0x9b, 0x2c, 0x8e, 0x19, 0x01, 0x89, 0x44, 0xfd, 0xb8, 0x27, 0x6c, 0x65, 0x1c, 0x14, 0x04, 0x53, 0x04, 0x83, 0x54, 0x84, 0x5d, 0x62, 0xf9,
+          0xbb, 0x95, 0x30, 0xe7, 0x2f, 0xdb, 0xec, 0x9c, 0x83, 0x5d, 0x72, 0xfc, 0xec, 0xf5, 0x04, 0xce, 0x98, 0xef, 0x9d, 0x9f, 0xaa, 0x6b, 0xab, 0xfa,
+          0x6c, 0xff, 0x0c, 0xa7, 0xe2, 0xf8, 0xf6, 0x52, 0xf5, 0x2f, 0x3e, 0xac, 0x5c, 0x66, 0x37, 0x84, 0xef, 0xa7, 0x32, 0x94, 0x2b, 0x2a, 0x52, 0xd7,
+          0x81, 0x3e, 0x41, 0xd3, 0x47, 0x39, 0xa2, 0x86, 0x87, 0x01, 0x28, 0x4c, 0xbb, 0x1b, 0xd9, 0x76, 0xd7, 0xcc, 0x0a, 0x77, 0xd4, 0x5d, 0x47, 0xf1,
+          0xec, 0x10, 0x2e, 0x68, 0x15, 0x8b, 0xa7, 0x30, 0x2d, 0xc8, 0x92, 0x2b, 0xce, 0x6d, 0xdd, 0x2a, 0x85, 0x7f, 0x9c, 0x42, 0xb1, 0x5a, 0x46, 0xd2,
+          0xda, 0xdb, 0x82, 0x59, 0xcb, 0x97, 0x3d, 0x40, 0x74, 0xaa, 0xb3, 0xa8, 0x1b, 0x4d, 0x96, 0xc5, 0x48, 0x8f, 0x4a, 0x37, 0x6d, 0x3a, 0x33, 0x71,
+          0xf3, 0x9a, 0x91, 0xbe, 0x1d, 0x98, 0xa8, 0x3e, 0x04, 0x63, 0x1c, 0xc8, 0x85, 0xfb, 0xcb, 0xa5, 0xcb, 0xec, 0x1f, 0x39, 0x29, 0x84, 0x64, 0xe6,
+          0x4a, 0xf1, 0xa2, 0x1b, 0xc3, 0x67, 0x6c, 0xd8, 0xc3, 0xec, 0x45, 0x16, 0x07, 0xe0, 0xf4, 0xe1, 0x7f, 0x82, 0x7a, 0x75, 0x89, 0x7a, 0xf6, 0xdd,
+          0xc3, 0xb2, 0x75, 0xdc, 0x13, 0x81, 0x59, 0x5e, 0xa5, 0x33, 0xa7, 0x2c, 0xc6, 0xdd, 0x29, 0x47, 0x72, 0x05, 0x35, 0x49, 0x5a, 0x17, 0x44, 0xa6,
+          0x56, 0x79, 0x41, 0x7a, 0x04, 0xda, 0x24, 0x55, 0x2d, 0xba, 0x99, 0x54, 0x90, 0x49, 0x02, 0x9e, 0xb0, 0x50, 0x29, 0xc2, 0x7b, 0x54, 0xa6, 0x00,
+          0x4e, 0x76, 0x0f, 0x8b, 0xd4, 0x4b, 0x91, 0x17, 0x41, 0xec, 0xed, 0xcf, 0x81, 0xd7, 0x46, 0xc4, 0x16, 0x3e, 0xb1, 0x5c, 0x4f, 0xc6, 0x44, 0xdd,
+          0x32, 0x25, 0x28, 0xaa, 0x15, 0x88, 0xa1, 0xfc, 0x1b, 0x1f, 0xd8, 0xd9, 0xbf, 0xa5, 0x55, 0x5a, 0x3c, 0x33, 0x3c, 0x4d, 0x9b, 0xc8, 0x53, 0x0c,
+          0x3d, 0x09, 0x19, 0x5e, 0x5b, 0x0a, 0x39, 0x17, 0x31, 0x17, 0xec, 0xce, 0x1b, 0xcd, 0xf9, 0x3e, 0x77, 0xcb, 0x42, 0xc6, 0xae, 0xd3, 0xb1, 0xaf,
+          0xf7, 0xb8, 0xe1, 0x27, 0x64, 0x5e, 0xdc, 0xbf, 0xc7, 0x65, 0xb5, 0x2a, 0x8a, 0x31, 0xda, 0x37, 0x4f, 0x2e, 0xec, 0x71, 0x31, 0xbb, 0x61, 0x98,
+          0x1d, 0xc9, 0x84, 0x73, 0x59, 0x0e, 0xcf, 0xe5, 0x58, 0x10, 0xd1, 0xae, 0x53, 0xa9, 0xb3, 0x01, 0x2f, 0x02, 0x14, 0x86, 0xb7, 0x59, 0xa6, 0x5d,
+          0x8b, 0xb8, 0x98, 0x84, 0x38, 0x7b, 0xd6, 0x84, 0x08, 0x48, 0x15, 0x2d, 0x5f, 0x62, 0x68, 0x78, 0x3f, 0xab, 0xb8, 0xf7, 0x58, 0x1e, 0x5f, 0x93,
+          0x04, 0x94, 0x3c, 0xb4, 0xb7, 0x47, 0x2d, 0x3b, 0xa4, 0xb3, 0x5b, 0x7c, 0xff, 0x87, 0xe0, 0x47, 0x1b, 0xcb, 0x17, 0x22, 0x8d, 0x27, 0xf1, 0x0d,
+          0x68, 0xaa, 0x7b, 0x19, 0x62, 0xb4, 0xdc, 0x09, 0xd8, 0xe7, 0x83, 0x46, 0xdf, 0x57, 0x8e, 0xa0, 0xec, 0x07, 0x88, 0x06, 0x41, 0x19, 0x89, 0x9e,
+          0xa9, 0x91, 0xb6, 0xd4, 0x72, 0x25, 0xa2, 0xc6, 0x39, 0x3a, 0xe9, 0xa9, 0x48, 0xcd, 0xe5, 0x01, 0x0c, 0x4d, 0x52, 0x79, 0xb6, 0x24, 0x74, 0x47,
+          0xdb, 0xdb, 0x4d, 0xe4, 0x3a, 0xb3, 0xdc, 0xda, 0x4a, 0x5b, 0x4f, 0xcf, 0x6b, 0x1b, 0x02, 0x70, 0xff, 0x73, 0x77, 0xfc, 0xa2, 0xcb, 0x7c, 0x6d,
+          0xd9, 0x6a, 0xb7, 0x23, 0xa4, 0x30, 0x8d, 0x44, 0x74, 0x8f, 0x47, 0x5c, 0xb4, 0xb0, 0x2b, 0xb9, 0xba, 0xdc, 0xd0, 0xcf, 0x60, 0xf0, 0xdf, 0x17,
+          0x60, 0xbe, 0xbf, 0x27, 0x4c, 0xc0, 0x6a, 0x29, 0xee, 0x40, 0x6c, 0xe3, 0x81, 0x7e, 0x47, 0xef, 0x9a, 0xfe, 0xd1, 0x57, 0x96, 0xd1, 0x77, 0xd0,
+          0x32, 0x29, 0x5b, 0xc8, 0x9a, 0xd1, 0xa2, 0xd8, 0xb0, 0xa9, 0xef, 0xd0, 0x06, 0x36, 0xde, 0xa7, 0xe1, 0xfd, 0xfe, 0x0b, 0x26, 0xcb, 0x2d, 0xee,
+          0x9a, 0x22, 0xd8, 0x8b, 0x68, 0x9c, 0x41, 0x74, 0xac, 0xbe, 0x87, 0x19, 0xee, 0xbb, 0xdb, 0xcf, 0x78, 0x15, 0x41, 0x2d, 0x2e, 0x5b, 0xc9, 0x9d,
+          0x17, 0x54, 0x08, 0x6c, 0x92, 0x1f, 0xa6, 0xbb, 0x66, 0x18, 0xb5, 0xcf, 0x15, 0x3c, 0xef, 0x8e, 0xf7, 0xec, 0x6c, 0x23, 0xa1, 0x0d, 0x95, 0x62,
+          0xa9, 0xd3, 0x36, 0x77, 0x77, 0x2d, 0x75, 0x8b, 0xfc, 0xfc, 0x2e, 0xf2, 0x0b, 0x48, 0x96, 0x0f, 0x77, 0x1b, 0x94, 0x59, 0x98, 0x3e, 0x1a, 0xc6,
+          0x9f, 0xcd, 0x93, 0x2b, 0x98, 0xeb, 0xae, 0x30, 0x31, 0xfc, 0x9e, 0xf9, 0xb0, 0x87, 0xa9, 0xe5, 0x5d, 0xff, 0xc8, 0x89, 0x4f, 0xaa, 0x7b, 0x48,
+          0x03, 0xb2, 0x08, 0x74, 0x6b, 0xb0, 0x3b, 0xf9, 0xd3, 0x5d, 0x64, 0x00, 0xb3, 0x9e, 0x83, 0xcb, 0x0d, 0x8c, 0xdd, 0x82, 0x9d, 0x2c, 0xd6, 0x15,
+          0x4c, 0x17, 0x1e, 0x94, 0x6d, 0xe5, 0x3d, 0x59, 0x07, 0x82, 0xa8, 0x50, 0xc0, 0xaf, 0xda, 0x9b, 0xcc, 0x64, 0x3a, 0x3e, 0x9f, 0x40, 0xbb, 0x08,
+          0xe5, 0xd4, 0xd1, 0xff, 0xf0, 0x8b, 0x90, 0xf8, 0xfb, 0x8a, 0xcf, 0x4e, 0x6b, 0x86, 0x87, 0x68, 0x8b, 0x06, 0x4d, 0xf3, 0x6e, 0x64, 0x47, 0xb8,
+          0x61, 0x2e, 0xf9, 0x7e, 0xda, 0x03, 0xae, 0xbf, 0x72, 0x31, 0xfb, 0xb9, 0x5c, 0xcf, 0xb1, 0xea, 0xdc, 0xbc, 0xd1, 0xcd, 0x2c, 0xc4, 0xf5, 0x5c,
+          0x58, 0xc6, 0xfb, 0x8d, 0x7f, 0xee, 0xba, 0xae, 0x6f, 0xaa, 0xd9, 0xb5, 0x3d, 0xc4, 0x67, 0xed, 0xfe, 0x95, 0x0f, 0x2d, 0x1e, 0x9a, 0x50, 0x5a,
+          0x0a, 0x83, 0x1e, 0x4c, 0x90, 0x68, 0xb7, 0x8a, 0x36, 0x4c, 0x02, 0x10, 0xd7, 0x93, 0xfe, 0x20, 0xf9, 0x6e, 0xdb, 0x64, 0x5d, 0xb4, 0x35, 0x33,
+          0xab, 0x3d, 0xea, 0x94, 0xa6, 0xb6, 0x06, 0xbc, 0x42, 0x62, 0xe1, 0x5b, 0xfb, 0x53, 0xfb, 0x63, 0xcd, 0x14, 0x52, 0x59, 0xa2, 0xaf, 0x2d, 0xdd,
+          0x13, 0xfa, 0x3d, 0xb8, 0xfc, 0x2a, 0x06, 0x4a, 0xb6, 0x97, 0xc7, 0x4b, 0x0e, 0x7f, 0xd2, 0x1c, 0x7b, 0x90, 0x4d, 0x71, 0xf0, 0xa9, 0x23, 0x13,
+          0xef, 0xe0, 0x47, 0x89, 0x7d, 0x28, 0x2e, 0x91, 0xef, 0x81, 0x9f, 0x61, 0xe8, 0xba, 0xce, 0x02, 0x52, 0x5b, 0x71, 0x8c, 0x7f, 0xee, 0xcd, 0xf5,
+          0x12, 0x28, 0xfa, 0x7a, 0x2d, 0x11, 0x27, 0x07, 0x5a, 0x34, 0x68, 0x0f, 0xe7, 0x91, 0xd1, 0xf0, 0x0d, 0xba, 0xc8, 0x5c, 0xae, 0xdb, 0x0b, 0x0f,
+          0xb8, 0x5e, 0xa9, 0xde, 0x70, 0x43, 0x2c, 0x53, 0x05, 0xb6, 0x8b, 0x6b, 0xad, 0x38, 0xec, 0x1f, 0x79, 0x68, 0x7f, 0xfa, 0x8f, 0xa6, 0xeb, 0x7a,
+          0x64, 0xa7, 0x42, 0x0c, 0xd3, 0x69, 0x1f, 0xfb, 0xf8, 0x5c, 0x72, 0x4f, 0x97, 0x7a, 0xae, 0x23, 0xee, 0x2f, 0xdd, 0x56, 0xbc, 0xc2, 0x58, 0xc2,
+          0x45, 0x36, 0x64, 0xc1, 0x0e, 0xe1, 0xf7, 0xa9, 0x82, 0xbf, 0x42, 0xeb, 0xc9, 0x51, 0xb0, 0xe4, 0xa7, 0x55, 0x31, 0x7a, 0x6e, 0x3d, 0x21, 0xda,
+          0xa7, 0xf5, 0x34, 0x60, 0x77, 0x31, 0x50, 0x64, 0xb4, 0x90, 0x46, 0x20, 0xac, 0x63, 0x90, 0x8a, 0x3a, 0x13, 0x30, 0x73, 0xc2, 0x5c, 0xe6, 0x24,
+          0x50, 0xa6, 0x52, 0x69, 0xf6, 0xc0, 0x8e, 0x04, 0x07, 0xe9, 0xef, 0x03, 0x41, 0xda, 0x82, 0x91, 0x9f, 0x32, 0x59, 0x66, 0xd4, 0xb2, 0x01, 0x0b,
+          0x67, 0x99, 0x26, 0x7b, 0xe9, 0x95, 0x11, 0x92, 0xac, 0x85, 0xf1, 0x5f, 0xdc, 0xd3, 0x2a, 0x38, 0xaa, 0x76, 0x00, 0x4e, 0x61, 0x90, 0x3b, 0xcd,
+          0x34, 0xbd, 0x3c, 0x8b, 0x16, 0xca, 0x5e, 0x06, 0x49, 0xdc, 0xa2, 0xc0, 0x2e, 0xdd, 0x3b, 0x4c, 0xd6, 0x10, 0x4a, 0x9e, 0xdf, 0x92, 0x7d, 0x15,
+          0x46, 0x74, 0x9f, 0x46, 0xba, 0xb6, 0xdc, 0xca, 0xba, 0xab, 0x2d, 0xb1, 0xfa, 0xd3, 0x3c, 0xb4, 0x7c, 0x31, 0x9a, 0x7d, 0x0f, 0x7c, 0xb5, 0x34,
+          0x2b, 0xfb, 0x28, 0xe3, 0x46, 0x26, 0x39, 0xf5, 0x23, 0x5a, 0x4a, 0xa4, 0xdf, 0xe9, 0xf4, 0xe3, 0x47, 0xdb, 0x16, 0xbf, 0xff, 0x62, 0x2e, 0xdf,
+          0x2f, 0x63, 0xff, 0xfa, 0x33, 0x9c, 0x5a, 0x17, 0xbd, 0x99, 0x6c, 0x12, 0xcf, 0x78, 0x3b, 0x96, 0x3c, 0xa9, 0xa4, 0xc6, 0xa1, 0x1b, 0x03, 0x7b,
+          0x4a, 0xc1, 0x4c, 0x3d, 0x0d, 0xf4, 0xe8, 0x93, 0xab, 0xf2, 0x40, 0xbb, 0xa9, 0xc2, 0x21, 0xdc, 0x50, 0xd0, 0x2d, 0x59, 0x88, 0xc4, 0x56, 0x11,
+          0x79, 0x72, 0x9f, 0xf5, 0xd1, 0xe7, 0x6e, 0x82, 0x1f, 0xdd, 0x14, 0xa5, 0xc7, 0x09, 0xf5, 0x15, 0x25, 0x3b, 0x30, 0x0c, 0xde, 0x19, 0x7b, 0xf7,
+          0x8f, 0xc9, 0xf0, 0x98, 0x10, 0xf4, 0x3e, 0xa9, 0xc4, 0x84, 0x35, 0xa6, 0x15, 0xcc, 0x45, 0x0e, 0xdd, 0x38, 0xcf, 0xaf, 0x30, 0x4b, 0x45, 0x56,
+          0x24, 0xf2, 0xde, 0xb6, 0x9a, 0xf3, 0xec, 0x8f, 0x1a, 0x9f, 0xc5, 0x4b, 0x2c, 0x04, 0x12, 0xcf, 0x36, 0x80, 0xcf, 0x69, 0x1c, 0xaa, 0x64, 0x25,
+          0x73, 0xa7, 0xac, 0xa2, 0xa8, 0x8a, 0x1e, 0x95, 0xf1, 0xa4, 0xb4, 0xb4, 0xd4, 0x4e, 0xc2, 0x92, 0xcd, 0x48, 0xd4, 0x36, 0xd1, 0x79, 0xfe, 0x13,
+          0x95, 0xc8, 0xcf, 0x65, 0xf8, 0xc7, 0xa7, 0xd5, 0xdf, 0xd7, 0x7b, 0xa4, 0x55, 0x3c, 0xd8, 0x83, 0x5e, 0x10, 0x69, 0x6c, 0x33, 0x04, 0xdd, 0x9e,
+          0xbd, 0x55, 0xc4, 0x8d, 0x67, 0x6c, 0xc0, 0x53, 0xb5, 0xaf, 0xea, 0x55, 0x8a, 0x89, 0xb9, 0x8a, 0xf2, 0x69, 0xa9, 0x1b, 0xb4, 0x2c, 0x71, 0xc6,
+          0x57, 0xda, 0xdc, 0xf4, 0x6f, 0x1d, 0xe6, 0x32, 0x29, 0xe3, 0x42, 0x09, 0x43, 0xd0, 0xa9, 0x4f, 0xab, 0xc6, 0xa2, 0x26, 0x23, 0xc5, 0xc4, 0xb6,
+          0xa8, 0x81, 0xa8, 0x4b, 0x71, 0x01, 0xd2, 0xcf, 0x1a, 0xe1, 0x88, 0xf3, 0xd3, 0x67, 0xd4, 0x75, 0xa4, 0x4f, 0xc2, 0x2f, 0xa4, 0x9f, 0x80, 0x16,
+          0x59, 0x64, 0x44, 0x31, 0xc4, 0x45, 0x74, 0x00, 0xd3, 0xfa, 0x6c, 0x94, 0xf6, 0xc0, 0x5a, 0x8a, 0x94, 0x15, 0x31, 0xcd, 0x3f, 0x30, 0x90, 0x3e,
+          0xda, 0x2f, 0xc1, 0x05, 0x3c, 0x12, 0xbf, 0x59, 0xa3, 0x70, 0x33, 0xdc, 0xc3, 0xe1, 0xb0, 0x88, 0x04, 0x9e, 0x74, 0x1a, 0xb2, 0x81, 0x3d, 0xe6,
+          0xfd, 0xec, 0x6d, 0x27, 0x15, 0xfd, 0xf3, 0x5b, 0xab, 0x5c, 0xd9, 0x1c, 0xe1, 0x63, 0x9b, 0x42, 0xd3, 0x9a, 0x5d, 0xe2, 0x5a, 0x40, 0x77, 0x13,
+          0x43, 0x6f, 0xe9, 0x50, 0xf6, 0x6e, 0x08, 0x4f, 0x06, 0x53, 0x1b, 0x21, 0x7b, 0xab, 0xb4, 0x96, 0x59, 0xef, 0xd2, 0x3d, 0x95, 0xe6, 0x6d, 0xe6,
+          0x64, 0xa9, 0x79, 0xa7, 0x01, 0x41, 0x5e, 0x16, 0x82, 0xf2, 0x30, 0xb7, 0xac, 0x34, 0x91, 0x74, 0x88, 0x50, 0x5d, 0xed, 0x70, 0x51, 0x30, 0x8c,
+          0x90, 0xa8, 0xa0, 0x80, 0x7c, 0x5c, 0x7f, 0xc5, 0x12, 0xa0, 0xea, 0x2a, 0xa4, 0x40, 0x36, 0xca, 0x22, 0xe7, 0xf5, 0x54, 0xfd, 0x71, 0xfd, 0xd2,
+          0x72, 0x44, 0xdd, 0xcd, 0x8d, 0xee, 0x31, 0x58, 0xcf, 0x92, 0xfb, 0xb9, 0xc7, 0xbd, 0x31, 0xef, 0xee, 0x67, 0x89, 0xbd, 0xb8, 0x8f, 0x45, 0x8d,
+          0xf2, 0x89, 0x55, 0x2c, 0xb1, 0xb8, 0x7d, 0xcd, 0x22, 0xcf, 0x72, 0x3e, 0x82, 0xaa, 0x8e, 0x25, 0x3e, 0xbc, 0xad, 0xa4, 0x06, 0x46, 0xdd, 0xbf,
+          0x3c, 0xdd, 0x0a, 0x95, 0x4e, 0x09, 0xd9, 0xd1, 0xdb, 0x4b, 0xf5, 0xca, 0xf6, 0x59, 0xce, 0xc2, 0x79, 0x0b, 0xc8, 0x6e, 0x90, 0x9d, 0x34, 0x68,
+          0xb9, 0x4a, 0xa1, 0x39, 0xc3, 0xf3, 0x77, 0xb3, 0x10, 0x31, 0x04, 0x6f, 0x60, 0x9e, 0xd7, 0x27, 0x71, 0xf7, 0xb6, 0x6b, 0x87, 0xca, 0x4a, 0x6e,
+          0x60, 0xbb, 0x4b, 0x4d, 0x91, 0x38, 0xf8, 0x3a, 0xf2, 0xd1, 0x6d, 0x65, 0xe5, 0x33, 0xd1, 0x36, 0xed, 0x57, 0x0e, 0x0e, 0x06, 0xd3, 0x46, 0x52,
+          0xdb, 0x91, 0x0d, 0x40, 0x45, 0xa6, 0x18, 0x17, 0xa9, 0x68, 0xff, 0xd2, 0x72, 0x1f, 0xdb, 0x04, 0x4b, 0x35, 0x7c, 0x6d, 0xb8, 0x48, 0x83, 0x51,
+          0x91, 0xc7, 0x0a, 0x1b, 0x48, 0x59, 0xc9, 0x9d, 0x6c, 0xec, 0x88, 0xe0, 0xff, 0xd2, 0xbb, 0xb9, 0x50, 0x3f, 0xc6, 0xe3, 0x8d, 0x8f, 0x28, 0xc4,
+          0xdd, 0x1c, 0xdc, 0x44, 0xcb, 0x50, 0x1c, 0xf0, 0x06, 0x3e, 0x6f, 0x39, 0x4a, 0x53, 0x3d, 0x2b, 0x38, 0xaa, 0x78, 0xf6, 0x12, 0xc8, 0xad, 0x47,
+          0x29, 0x4a, 0xc5, 0xf9, 0xc7, 0x96, 0x0f, 0xdb, 0xfd, 0x5b, 0x78, 0x6c, 0xa5, 0xa3, 0x62, 0x98, 0x37, 0xc2, 0xcc, 0xdd, 0x27, 0x6a, 0x7a, 0x6b,
+          0x8e, 0x07, 0x72, 0xf2, 0x9c, 0xac, 0x15, 0xfc, 0x20, 0xf7, 0x61, 0x31, 0x6e, 0xd1, 0x4d, 0x8c, 0xcb, 0x76, 0xb4, 0x25, 0x2f, 0x06, 0xcb, 0x99,
+          0x6d, 0x95, 0x9c, 0x7a, 0x06, 0x94, 0x62, 0xcd, 0x49, 0x01, 0x27, 0x79, 0xca, 0xb8, 0x0a, 0x50, 0xad, 0x43, 0x32, 0x7a, 0x5a, 0xee, 0xbb, 0x88,
+          0xa6, 0xec, 0xd0, 0x84, 0xa8, 0xf3, 0xb5, 0x6e, 0xeb, 0x42, 0xea, 0x66, 0x3d, 0xcd, 0x59, 0x5b, 0x4b, 0xbe, 0xb7, 0xb3, 0x36, 0x35, 0x4d, 0xc9,
+          0xf8, 0x1c, 0xed, 0x01, 0x7e, 0x0d, 0x2b, 0xa0, 0xb1, 0xfb, 0x36, 0x2d, 0x59, 0x87, 0xb6, 0xc2, 0x2f, 0xf2, 0x06, 0x00, 0x53, 0x56, 0xf4, 0xf4,
+          0x1c, 0xe6, 0x5c, 0xd1, 0xbe, 0xdb, 0x70, 0x5a, 0x77, 0xe3, 0x7f, 0x15, 0x97, 0x70, 0xd9, 0x6f, 0xc4, 0x0f, 0x35, 0x8e, 0x71, 0x1f, 0x65, 0x98,
+          0xd6, 0x46, 0xb9, 0x2d, 0xf4, 0x9f, 0xf2, 0x68, 0x9d, 0x57, 0x74, 0xe7, 0xf1, 0xe4, 0x78, 0xd0, 0xcb, 0x24, 0xa2, 0x28, 0x65, 0x30, 0x78, 0x53,
+          0x0f, 0x02, 0x1e, 0x36, 0xed, 0xe4, 0xf0, 0xb0, 0x19, 0xc3, 0x3e, 0x19, 0xb6, 0x26, 0xf2, 0x73, 0xf6, 0x7c, 0x0b, 0xf9, 0x43, 0x9b, 0x09, 0x38,
+          0xba, 0x02, 0x43, 0x05, 0x99, 0x51, 0x78, 0xe2, 0x08, 0xfd, 0x3b, 0x38, 0x9d, 0x1e, 0xb1, 0xf7, 0x06, 0x1a, 0x60, 0x50, 0xc4, 0x48, 0x6d, 0xbb,
+          0x70, 0x07, 0x97, 0x50, 0x6d, 0xae, 0xb1, 0xa8, 0xc1, 0x2a, 0xb4, 0xe0, 0xa7, 0x93, 0xa9, 0xe6, 0x18, 0x79, 0x5c, 0xca, 0x63, 0xb8, 0x58, 0xdd,
+          0xa6, 0x9a, 0x0a, 0x51, 0x64, 0x9d, 0x7c, 0xa5, 0x00, 0x05, 0xe9, 0xfe, 0xb2, 0xec, 0x2b, 0x16, 0x1c, 0x87, 0x7c, 0x5e, 0xac, 0x91, 0x47, 0x12,
+          0x67, 0x9e, 0xf2, 0x95, 0xe4, 0x82, 0x15, 0xcb, 0x19, 0x56, 0xe8, 0x58, 0x5a, 0x07, 0xf4, 0xdb, 0x42, 0xd6, 0xaa, 0xbd, 0xb5, 0x28, 0xb9, 0x2d,
+          0x61, 0x74, 0x30, 0xe3, 0xea, 0x88, 0x49, 0x07, 0x31, 0xa0, 0x30, 0xd0, 0x57, 0xe5, 0x75, 0x43, 0xbe, 0x9c, 0x1a, 0x96, 0xe4, 0x0b, 0x5c, 0xd0,
+          0x41, 0xaa, 0x72, 0x98, 0x78, 0x56, 0x14, 0xcd, 0xe2, 0x0f, 0xe5, 0x91, 0xbf, 0x18, 0x81, 0xea, 0xc9, 0x52, 0xc0, 0x76, 0x2d, 0xe3, 0x7c, 0xe6,
+          0xf2, 0x41, 0x86, 0xcd, 0x7b, 0x44, 0x3d, 0x4e, 0x1a, 0xf1, 0xd5, 0xa7, 0x22, 0x16, 0xaf, 0x90, 0x32, 0xad, 0xce, 0x77, 0x39, 0xec, 0x79, 0xa6,
+          0x51, 0x4f, 0x7e, 0xeb, 0x50, 0xde, 0xc4, 0x9c, 0x87, 0xb5, 0x92, 0x47, 0xee, 0x83, 0x2a, 0x82, 0x73, 0x60, 0x8b, 0xf2, 0x86, 0x92, 0x0d, 0xdb,
+          0x94, 0x3f, 0xd4, 0xcc, 0xc8, 0xbc, 0x36, 0xdf, 0xa1, 0xb4, 0x28, 0xbe, 0x57, 0x34, 0xd9, 0xda, 0x3e, 0x08, 0xcb, 0x69, 0x22, 0x89, 0x3d, 0x67,
+          0x38, 0xab, 0x06, 0x03, 0x6c, 0x1e, 0xe0, 0xc0, 0x58, 0x50, 0xd9, 0x3d, 0x51, 0x36, 0x97, 0xd5, 0x48, 0x0b, 0xe7, 0xa2, 0x3c, 0xcf, 0x79, 0x27,
+          0x0b, 0x57, 0xf3, 0x87, 0x95, 0x15, 0x2a, 0xe9, 0xd2, 0xc3, 0xe5, 0x50, 0xa2, 0x7c, 0x53, 0xd8, 0x83, 0xe7, 0x8b, 0xe2, 0x4c, 0xbd, 0x9f, 0x53,
+          0x5c, 0x69, 0xf8, 0x54, 0xe0, 0x4a, 0xea, 0x96, 0x36, 0x1d, 0x81, 0x86, 0x8a, 0xa5, 0x2a, 0x9a, 0xea, 0x91, 0xda, 0xa7, 0x6f, 0x48, 0xf0, 0xb8,
+          0xb0, 0x2a, 0xc9, 0xef, 0x98, 0xd1, 0x00, 0xe6, 0x1a, 0x44, 0x9d, 0x3f, 0x6f, 0x4e, 0x04, 0x9f, 0x07, 0xf1, 0x0c, 0x8f, 0x53, 0x48, 0xaf, 0xf4,
+          0xa5, 0x23, 0xf5, 0xfe, 0xd8, 0xf9, 0x14, 0x9e, 0x70, 0xe6, 0xd0, 0xa2, 0x59, 0x73, 0x8b, 0x83, 0x05, 0x45, 0x9e, 0x9d, 0x6e, 0x14, 0xfe, 0xad,
+          0xbb, 0x5d, 0x4f, 0x8e, 0x4c, 0xb7, 0xb2, 0x8c, 0xcb, 0x0f, 0xa5, 0xde, 0x3e, 0x6d, 0x72, 0x71, 0x57, 0x90, 0x4a, 0xf8, 0x08, 0x50, 0xe6, 0x44,
+          0x25, 0x57, 0x78, 0xb1, 0x67, 0xd6, 0xb3, 0x05, 0x89, 0x10, 0x9a, 0x55, 0x43, 0x67, 0x59, 0x57, 0x32, 0x96, 0xc9, 0x27, 0x4a, 0x2c, 0xfb, 0x0b,
+          0x7c, 0xfd, 0xa9, 0x36, 0xa7, 0x7d, 0x1d, 0xd2, 0xcf, 0xea, 0x10, 0xa1, 0x5f, 0xd4, 0x72, 0x13, 0x94, 0xa5, 0xc5, 0xef, 0x14, 0x94, 0x85, 0xb6,
+          0x84, 0x2d, 0x69, 0x91, 0x08, 0x1b, 0x7e, 0xc9, 0x06, 0x07, 0xbe, 0x14, 0x8b, 0x0c, 0x46, 0x09, 0x21, 0xa4, 0x79, 0x97, 0x21, 0x33, 0x8d, 0xd0,
+          0x6a, 0xc3, 0xe5, 0x57, 0x2a, 0xd5, 0x73, 0xbc, 0x66, 0x33, 0x56, 0xbf, 0x71, 0xee, 0x21, 0x28, 0x1d, 0x9d, 0x07, 0x3c, 0x75, 0x49, 0x6e, 0x4a,
+          0x7d, 0x54, 0xc2, 0x66, 0x9c, 0x3d, 0xd7, 0x88, 0x33, 0xcf, 0x9c, 0x1a, 0x91, 0x08, 0x5a, 0xca, 0x77, 0x5c, 0xdd, 0x3b, 0x73, 0xcf, 0x97, 0xb7,
+          0xd1, 0x6a, 0x1a, 0x98, 0x28, 0xab, 0x2d, 0x00, 0x71, 0x2a, 0xdd, 0x0f, 0xe2, 0x88, 0x44, 0xf3, 0x9f, 0x14, 0xaf, 0x25, 0x98, 0x3e, 0x66, 0xb6,
+          0xd3, 0x4a, 0xb4, 0xa1, 0x84, 0x21, 0x4c, 0xb6, 0xb5, 0x04, 0x02, 0xa8, 0x5d, 0xf5, 0xdd, 0x91, 0x91, 0x12, 0x1c, 0xd1, 0xe5, 0xb8, 0xec, 0xbd,
+          0x42, 0x6f, 0x36, 0x56, 0xee, 0x21, 0x46, 0x26, 0x1f, 0x69, 0x58, 0x99, 0x92, 0xdf, 0x54, 0x59, 0x3a, 0xfd, 0xcb, 0x14, 0x85, 0x12, 0x05, 0xa5,
+          0x03, 0x51, 0x95, 0x6d, 0xae, 0x2f, 0xed, 0x0f, 0xcd, 0x61, 0xe4, 0x67, 0x35, 0x8a, 0x12, 0x13, 0xd5, 0x50, 0xa1, 0x2b, 0x9a, 0x31, 0x8d, 0xc0,
+          0x5f, 0x44, 0xeb, 0xbc, 0x32, 0x63, 0x36, 0x72, 0x23, 0x98, 0xc9, 0xa5, 0xb4, 0x90, 0x35, 0xc1, 0xed, 0x95, 0x5d, 0xd6, 0xa9, 0xce, 0x25, 0xfc,
+          0xd5, 0xaa, 0x3c, 0x82, 0x36, 0xeb, 0x72, 0x33, 0x5d, 0x21, 0x6a, 0x9b, 0x4f, 0xab, 0x14, 0x67, 0x55, 0x04, 0xbe, 0xea, 0xed, 0xb8, 0xce, 0xfd,
+          0x3f, 0x10, 0x31, 0x96, 0x67, 0xfc, 0xa1, 0x52, 0xe4, 0x42, 0x69, 0xc5, 0x69, 0x16, 0xc0, 0x17, 0x93, 0x98, 0x30, 0xe4, 0x2f, 0x57, 0xd9, 0xee,
+          0x48, 0x49, 0x85, 0xd9, 0x99, 0xeb, 0xa4, 0x3e, 0x60, 0x5f, 0xa9, 0x0f, 0x38, 0x9e, 0xd6, 0xfd, 0x39, 0x7e, 0x59, 0xab, 0x00, 0xe6, 0x85, 0x38,
+          0x36, 0x20, 0x3a, 0x74, 0xb6, 0xc9, 0x0a, 0xbf, 0x71, 0xfd, 0xce, 0x94, 0xaa, 0xd5, 0x80, 0x25, 0x27, 0xbe, 0x7a, 0xfa, 0x84, 0xab, 0x0f, 0xa1,
+          0xdd, 0x77, 0x64, 0x68, 0x32, 0xad, 0x58, 0xa4, 0x08, 0x3e, 0x23, 0x48, 0x7e, 0x90, 0x6e, 0x29, 0x63, 0x26, 0xb8, 0xd6, 0xa8, 0xac, 0xe8, 0x38,
+          0x66, 0x40, 0xcb, 0x4f, 0x23, 0xd4, 0x99, 0x29, 0x4b, 0x39, 0x32, 0xb5, 0xbc, 0x6d, 0xaa, 0xa4, 0x5e, 0xbb, 0x81, 0x72, 0x29, 0xbe, 0x1a, 0x0a,
+          0x67, 0x72, 0x40, 0x39, 0x06, 0x6a, 0x78, 0xb4, 0xdc, 0xa0, 0xf5, 0xa1, 0x4a, 0xaf, 0x4a, 0xc9, 0x36, 0x7d, 0x0e, 0x2e, 0xb5, 0x2e, 0x62, 0xf8,
+          0xeb, 0x2a, 0x62, 0xc5, 0xf8, 0x30, 0x13, 0xed, 0x26, 0x1f, 0x4a, 0x60, 0x2e, 0x64, 0x8b, 0xff, 0xe3, 0x48, 0xc2, 0x36, 0x10, 0xc7, 0xf6, 0x0e,
+          0x7d, 0xab, 0x3e, 0x1f, 0x9f, 0xfd, 0x6c, 0xf6, 0x7b, 0x13, 0x28, 0xd4, 0xc5, 0x9d, 0x07, 0xdc, 0xa1, 0x02, 0xb6, 0x14, 0x5d, 0x4f, 0xdd, 0xed,
+          0x2c, 0x04, 0x8e, 0x5a, 0xf3, 0x9a, 0xe3, 0xac, 0xf7, 0x90, 0xc0, 0x25, 0x8a, 0x75, 0x6c, 0x7e, 0x5d, 0x94, 0x8e, 0xbb, 0x8a, 0xd0, 0x16, 0xed,
+          0x0b, 0x2a, 0xa8, 0xb9, 0xd7, 0x7c, 0x2a, 0xb1, 0x84, 0x66, 0xdd, 0xc3, 0x06, 0x06, 0x95, 0xd1, 0x97, 0xe3, 0x39, 0xdf, 0x8d, 0x64, 0x7b, 0xce,
+          0xbf, 0x5f, 0xe9, 0x2a, 0x35, 0x33, 0xc1, 0xbc, 0x8f, 0x88, 0x63, 0xe6, 0x24, 0x93, 0x45, 0x0a, 0x63, 0x9c, 0x2d, 0xe2, 0x9d, 0x61, 0x7e, 0x0a,
+          0x15, 0x12, 0x8f, 0x7e, 0x1e, 0xec, 0xf5, 0x34, 0x07, 0x9c, 0xbd, 0xae, 0x1a, 0xa6, 0x1e, 0x7f, 0x70, 0x07, 0x61, 0xda, 0xfc, 0x89, 0xf3, 0xf9,
+          0xa8, 0xc1, 0xec, 0x78, 0xb8, 0x1e, 0x21, 0x5c, 0x76, 0x1e, 0x13, 0x31, 0x5e, 0xfd, 0x24, 0x71, 0xdd, 0x21, 0xb4, 0x3c, 0x5a, 0x80, 0x66, 0xed,
+          0x37, 0xe1, 0x38, 0x64, 0x8f, 0x34, 0x96, 0x36, 0x36, 0xdf, 0xc7, 0x5c, 0x75, 0xf7, 0xc4, 0xee, 0xf4, 0xc6, 0xd8, 0x09, 0xf2, 0x3c, 0x42, 0x73,
+          0xbc, 0xa3, 0xc3, 0x9b, 0x80, 0x82, 0x9b, 0xb4, 0x7c, 0x61, 0xe4, 0x67, 0xd9, 0xa7, 0x93, 0xc9, 0x22, 0x82, 0x6b, 0xca, 0x34, 0x7a, 0x84, 0x7a,
+          0x11, 0x43, 0x8d, 0xe8, 0x44, 0xcd, 0x22, 0xf0, 0x03, 0xe6, 0x4a, 0xe1, 0xbf, 0xd5, 0x9e, 0xf5, 0xb2, 0x1b, 0xb4, 0x5d, 0x61, 0x2b, 0xa0, 0xec,
+          0x1d, 0xb5, 0xc6, 0x65, 0x36, 0x5f, 0x32, 0x14, 0x83, 0x90, 0x87, 0xef, 0x2c, 0x24, 0x5f, 0x05, 0xa1, 0xc9, 0xcd, 0x85, 0x5b, 0xde, 0x77, 0xbf,
+          0xed, 0x16, 0x57, 0x7b, 0x02, 0xb1, 0x66, 0x4f, 0x10, 0xa8, 0xff, 0x31, 0x2a, 0x5e, 0x4f, 0x58, 0xc2, 0xee, 0x14, 0xa9, 0x99, 0xd2, 0xb9, 0x3d,
+          0x27, 0x7b, 0xf8, 0xc2, 0x54, 0xe3, 0xca, 0xb2, 0xbe, 0x0c, 0x4f, 0xe7, 0x11, 0x7d, 0x18, 0x6b, 0x21, 0xed, 0x8c, 0x9a, 0xb9, 0x3d, 0x23, 0xc0,
+          0x4a, 0x67, 0xf6, 0x91, 0xf0, 0x65, 0x31, 0xbc, 0x63, 0x32, 0x57, 0x91, 0x90, 0xed, 0x82, 0x1e, 0xb3, 0x3a, 0x61, 0x3d, 0x30, 0x8e, 0xda, 0x8e,
+          0xc1, 0xbd, 0xca, 0xc7, 0xed, 0x36, 0xae, 0xf2, 0x5b, 0xf5, 0x5e, 0xba, 0x3c, 0x7c, 0xc0, 0xed, 0x77, 0x9f, 0x81, 0xcc, 0xfb, 0x64, 0x1f, 0x3c,
+          0xc5, 0xec, 0x61, 0xed, 0xdf, 0xca, 0xe6, 0xae, 0xf4, 0xee, 0x50, 0x5c, 0xa1, 0x36, 0xb3, 0x35, 0xf2, 0xa9, 0x4d, 0xbb, 0x27, 0x7e, 0xd7, 0xda,
+          0xf1, 0x14, 0xa9, 0x30, 0x14, 0x74, 0x3a, 0x08, 0x81, 0xdd, 0x99, 0x4f, 0x08, 0xd6, 0x90, 0xd3, 0x19, 0x6e, 0x7a, 0x61, 0xc5, 0x0a, 0xc4, 0x59,
+          0xc5, 0xfa, 0x6e, 0x0e, 0x78, 0xd2, 0x14, 0x58, 0x56, 0xfe, 0x0d, 0x2f, 0xf8, 0x1f, 0x81, 0xab, 0xc7, 0x40, 0xc3, 0xbb, 0x15, 0x7b, 0x09, 0x25,
+          0x91, 0x74, 0xa0, 0x83, 0xdc, 0x10, 0x49, 0x4a, 0x21, 0x3f, 0x97, 0x8e, 0xc2, 0xb3, 0xe6, 0x0d, 0x41, 0x92, 0xbd, 0xfb, 0x81, 0xef, 0x24, 0xcf,
+          0x0b, 0x0e, 0x6b, 0x02, 0x57, 0x18, 0xee, 0x8b, 0xf5, 0x42, 0x5d, 0x5d, 0xe9, 0xba, 0x6d, 0xc6, 0x2c, 0xb8, 0xf3, 0x2e, 0x2d, 0x5f, 0x34, 0x8a,
+          0x25, 0xfd, 0x8f, 0xc4, 0x66, 0x54, 0x5e, 0xfd, 0xfb, 0xc0, 0x82, 0xd3, 0x74, 0x2e, 0x13, 0x15, 0xb7, 0xa2, 0x5d, 0x95, 0x1e, 0xab, 0x46, 0xa5,
+          0x09, 0x5c, 0x17, 0x78, 0xe1, 0x98, 0x36, 0x99, 0x49, 0x26, 0x47, 0x8f, 0x0d, 0x33, 0xb3, 0xfd, 0x69, 0x50, 0x3d, 0x62, 0xf5, 0xc7, 0xad, 0x3f,
+          0xe3, 0x3b, 0x10, 0xaf, 0xbe, 0x52, 0x79, 0x2e, 0xa9, 0x8f, 0x72, 0xad, 0x44, 0x2e, 0x9e, 0x1e, 0x6c, 0x38, 0x40, 0x06, 0xe1, 0x37, 0x5c, 0x28,
+          0x3a, 0xf7, 0x3b, 0xe5, 0xab, 0x5c, 0x30, 0x12, 0x14, 0x0f, 0x5a, 0x5b, 0xb7, 0xe4, 0x4f, 0x3d, 0x11, 0xbb, 0xb7, 0x3c, 0xe3, 0x40, 0xee, 0xeb,
+          0x4c, 0x2b, 0x56, 0xa5, 0x06, 0x66, 0x1c, 0x29, 0x99, 0xa5, 0x9f, 0x99, 0x9a, 0x5f, 0xcb, 0x66, 0xc5, 0x10, 0x9c, 0x75, 0x2f, 0x8c, 0x01, 0x4b,
+          0xb2, 0x20, 0x0f, 0x38, 0xb6, 0x18, 0x17, 0x70, 0xde, 0x94, 0x07, 0xf6, 0x7d, 0x90, 0x65, 0x86, 0x0e, 0xd0, 0xd3, 0x66, 0x4f, 0x1c, 0xf3, 0x37,
+          0xa3, 0x5b, 0x18, 0x26, 0xd3, 0x79, 0x41, 0xf0, 0x5d, 0xa5, 0x52, 0x40, 0x42, 0x90, 0xd5, 0x39, 0x2e, 0x36, 0x39, 0x94, 0x1b, 0x02, 0x77, 0xa8,
+          0x80, 0x86, 0x8f, 0xcd, 0x4d, 0x52, 0xf5, 0x8e, 0xec, 0x94, 0x71, 0x26, 0xb1, 0x90, 0xee, 0x65, 0xe0, 0x6d, 0x46, 0xfa, 0x20, 0xab, 0x1a, 0x1a,
+          0xe0, 0xe4, 0x4d, 0x35, 0x89, 0x37, 0x1c, 0xbc, 0xd8, 0x4e, 0x6f, 0xeb, 0xea, 0x1d, 0xd3, 0x69, 0xe3, 0x16, 0x91, 0xc0, 0x31, 0x47, 0xd2, 0x51,
+          0x5f, 0x09, 0x14, 0x86, 0xe8, 0x1a, 0xd9, 0x69, 0x7d, 0x16, 0xf3, 0xfd, 0x25, 0x7b, 0x56, 0x21, 0x5b, 0x1e, 0xb6, 0x0a, 0xa9, 0x2c, 0x76, 0xd9,
+          0x58, 0x04, 0x35, 0xfc, 0x4a, 0x0c, 0x16, 0xe9, 0x8a, 0xd8, 0xb1, 0xc9, 0x04, 0x67, 0x9b, 0xb5, 0x0b, 0xa4, 0xde, 0xc9, 0x63, 0x88, 0xdd, 0x2c,
+          0xb6, 0x68, 0xad, 0x90, 0xc3, 0x75, 0x85, 0xe4, 0x15, 0x32, 0x22, 0x80, 0xa0, 0x67, 0x86, 0x98, 0x06, 0x1e, 0xeb, 0x64, 0xa8, 0xc6, 0x83, 0x72,
+          0xc0, 0xe6, 0x5e, 0x4d, 0xc0, 0x4e, 0x02, 0x0a, 0xf4, 0x92, 0x32, 0x70, 0xda, 0x1f, 0xf9, 0x37, 0x88, 0x66, 0xb1, 0xeb, 0xc1, 0xd7, 0x14, 0x2c,
+          0x31, 0x53, 0x3d, 0x15, 0x1a, 0xec, 0x54, 0x47, 0x9e, 0xf1, 0xba, 0x93, 0x03, 0xa7, 0xef, 0x6f, 0xac, 0x25, 0x74, 0xda, 0xe1, 0x89, 0xe3, 0x41,
+          0x3b, 0xb8, 0xf4, 0xbc, 0x10, 0x52, 0xb7, 0x29, 0x63, 0x09, 0xd3, 0xf1, 0xce, 0x2b, 0x5d, 0xc3, 0x54, 0x58, 0xac, 0xe6, 0x60, 0x04, 0x8b, 0x85,
+          0x2b, 0x2d, 0x8c, 0xf9, 0x8c, 0x30, 0xa1, 0x4f, 0xe5, 0xa9, 0xd0, 0x5e, 0x29, 0x71, 0x57, 0x64, 0x8b, 0x6a, 0x6c, 0x13, 0x20, 0xbc, 0x9b, 0x94,
+          0x44, 0x73, 0xf3, 0xfd, 0x4d, 0x26, 0x16, 0x47, 0x14, 0xf7, 0x0b, 0xb4, 0x57, 0x3f, 0xc1, 0xb0, 0xbc, 0xdd, 0x7a, 0x2b, 0xd2, 0x1f, 0x25, 0xfd,
+          0x4f, 0xb2, 0xe7, 0xa4, 0x82, 0xf5, 0x0e, 0x0e, 0x92, 0x19, 0xe6, 0x62, 0x99, 0x23, 0x6c, 0x43, 0x36, 0xf3, 0xde, 0x93, 0x9f, 0xda, 0x57, 0xde,
+          0xf1, 0x3a, 0x53, 0x83, 0x7b, 0x36, 0x6a, 0x0f, 0xa9, 0x57, 0x8d, 0xfd, 0x9f, 0x56, 0x0a, 0x40, 0x29, 0x17, 0xf9, 0xb3, 0x98, 0xec, 0x2a, 0x09,
+          0xaa, 0x6d, 0xad, 0x22, 0x0f, 0xd2, 0xa8, 0x9d, 0x60, 0xbb, 0xb1, 0x2f, 0x8f, 0x38, 0x69, 0x86, 0x55, 0x2e, 0xc5, 0x3f, 0x29, 0x21, 0x3c, 0xb8,
+          0x45, 0xa1, 0x9f, 0x7b, 0x12, 0x2c, 0x15, 0x0d, 0x39, 0x19, 0x53, 0xf9, 0x9e, 0x55, 0xfe, 0xa3, 0x16, 0x42, 0x6b, 0x6a, 0x30, 0xfe, 0x04, 0x5c,
+          0xdc, 0xdc, 0x88, 0xb5, 0x0b, 0xa8, 0xfa, 0x0f, 0x30, 0xea, 0x15, 0x4b, 0x5a, 0x8a, 0xa9, 0x2e, 0x81, 0xf7, 0x4c, 0xce, 0x51, 0x43, 0x9b, 0x06,
+          0x45, 0xd2, 0x38, 0x18, 0x61, 0x2c, 0x2b, 0x88, 0x90, 0x5d, 0xba, 0x9a, 0x75, 0x21, 0xa5, 0xe3, 0x92, 0x9a, 0x23, 0xb2, 0x91, 0x90, 0xb8, 0xb0,
+          0x06, 0x44, 0xd5, 0x4a, 0x77, 0xa1, 0x24, 0x9c, 0xa7, 0x79, 0x9d, 0xa8, 0x04, 0xa0, 0x9e, 0xe2, 0x50, 0x2a, 0x3c, 0xf4, 0x37, 0x27, 0x89, 0xd1,
+          0xec, 0x92, 0xd3, 0xf1, 0x7b, 0xac, 0x08, 0xfa, 0x17, 0x30, 0x7a, 0x26, 0xbd, 0x53, 0x62, 0xcc, 0x99, 0xab, 0x86, 0xc3, 0x62, 0x8a, 0xd0, 0x72,
+          0xa9, 0xc3, 0x54, 0xc1, 0x84, 0x38, 0x11, 0xcd, 0x95, 0xfb, 0xb1, 0x97, 0x9a, 0x59, 0x5e, 0xd2, 0xe6, 0x98, 0xf8, 0x78, 0x82, 0xff, 0x20, 0xa3,
+          0x02, 0xcf, 0x2e, 0x81, 0xf3, 0xcf, 0xa6, 0xd8, 0xe7, 0x79, 0xde, 0x96, 0x36, 0xdd, 0x15, 0xd9, 0x93, 0x81, 0xfe, 0x41, 0x92, 0xfb, 0xa7, 0xd2,
+          0xe1, 0xea, 0x04, 0xde, 0x38, 0x21, 0x6e, 0x92, 0x05, 0xf3, 0x33, 0xbd, 0xa4, 0x7c, 0x1a, 0x15, 0x93, 0xf1, 0x36, 0x19, 0x9d, 0xa5, 0xd1, 0x9c,
+          0xbb, 0xe6, 0xc5, 0xa5, 0x74, 0xf1, 0x13, 0x4d, 0xdd, 0x52, 0x52, 0xe9, 0xb3, 0xa1, 0xad, 0xff, 0x3a, 0xae, 0x31, 0xeb, 0x18, 0xc2, 0xc4, 0x8a,
+          0x24, 0x3c, 0x71, 0x85, 0x0d, 0x1b, 0xff, 0x25, 0x59, 0x4d, 0x56, 0x0e, 0x90, 0x4c, 0x05, 0x1c, 0xac, 0xf2, 0x59, 0x21, 0x8e, 0x15, 0x06, 0xe8,
+          0x7f, 0x5c, 0xf6, 0xe5, 0x6f, 0x85, 0x12, 0xcf, 0xe0, 0x87, 0xe5, 0x82, 0xdc, 0x8d, 0x12, 0x71, 0xfc, 0x25, 0xc2, 0xbe, 0x9b, 0xf9, 0x06, 0x3a,
+          0x70, 0xa4, 0xb2, 0x65, 0x8a, 0x05, 0x3d, 0xc2, 0x07, 0x3f, 0x87, 0x30, 0x41, 0xec, 0x97, 0xca, 0x9a, 0x80, 0xde, 0xc9, 0x02, 0xf1, 0x86, 0xd0,
+          0xde, 0x5d, 0x5e, 0x59, 0x3a, 0xf1, 0x6a, 0xca, 0x8f, 0xab, 0x5b, 0x59, 0x22, 0x7d, 0x73, 0xfc, 0x19, 0x49, 0xb4, 0xa9, 0x0b, 0x12, 0x97, 0x5b,
+          0xe4, 0xd9, 0x33, 0xef, 0xcb, 0x9b, 0x3f, 0x5a, 0xf6, 0xb7, 0xf1, 0x26, 0x61, 0xdf, 0x30, 0x8f, 0x62, 0xbe, 0x0b, 0x81, 0xcc, 0x63, 0x0a, 0xf6,
+          0x45, 0x70, 0x89, 0x39, 0x30, 0x19, 0x62, 0xc7, 0xeb, 0x60, 0xaa, 0xa2, 0x96, 0x5a, 0x08, 0x24, 0x4f, 0x40, 0x76, 0x52, 0x66, 0x02, 0x64, 0x60,
+          0xd5, 0x03, 0x93, 0x9f, 0x8c, 0x8e, 0x3e, 0x27, 0xf1, 0x0e, 0x4e, 0x31, 0x3a, 0xec, 0xe6, 0x6a, 0x9f, 0xb0, 0x43, 0x8b, 0xa7, 0x08, 0xf2, 0x45,
+          0x85, 0xbd, 0x2b, 0xc8, 0xa3, 0x1f, 0xdc, 0xeb, 0xd3, 0x03, 0xdc, 0xa9, 0xe9, 0xcd, 0xa3, 0x36, 0xdd, 0x74, 0xd2, 0xe9, 0x8b, 0xc1, 0xc4, 0x4e,
+          0xc5, 0xf3, 0x14, 0x69, 0xb9, 0x7d, 0x6f, 0x09, 0x98, 0x92, 0xef, 0xe6, 0xdf, 0x91, 0xc6, 0x2a, 0xaf, 0xab, 0xdf, 0x42, 0x05, 0x77, 0x5e, 0xb4,
+          0x9d, 0xae, 0xdc, 0x7b, 0x4a, 0x7b, 0xd5, 0xf9, 0x7a, 0x15, 0xab, 0x69, 0x57, 0x64, 0xde, 0x6e, 0x41, 0xb9, 0xda, 0x65, 0x35, 0xab, 0xd2, 0x62,
+          0x4c, 0x6e, 0xc4, 0x20, 0x03, 0x3b, 0xc7, 0x84, 0x6d, 0x8c, 0x29, 0xdc, 0xdd, 0x91, 0x97, 0x99, 0x99, 0xfe, 0xee, 0x8e, 0x19, 0xdd, 0xf9, 0xfb,
+          0xcf, 0x0b, 0x34, 0xeb, 0x50, 0xbf, 0x55, 0xaf, 0x57, 0xe8, 0xa0, 0x62, 0x37, 0xfc, 0xcc, 0x5f, 0xbb, 0xfc, 0xce, 0x44, 0xe6, 0xb9, 0xe8, 0xf5,
+          0x0c, 0xdd, 0xeb, 0xf9, 0xfc, 0x9b, 0x51, 0x26, 0xae, 0x7b, 0xfc, 0x9d, 0xd7, 0x01, 0xae, 0x83, 0x08, 0x06, 0x43, 0xcb, 0xe5, 0x35, 0x74, 0x72,
+          0xa2, 0xc5, 0xe6, 0x31, 0xcb, 0x34, 0x81, 0xf7, 0x23, 0xbb, 0x73, 0x90, 0xf8, 0x67, 0x36, 0xfc, 0xf0, 0x59, 0x2d, 0xb5, 0x71, 0x24, 0x9c, 0x89,
+          0xdb, 0x7c, 0x56, 0x5b, 0x95, 0x0e, 0xd3, 0xb9, 0xff, 0x8c, 0x77, 0x74, 0xaa, 0xd5, 0x0f, 0x7a, 0xe6, 0x5f, 0x10, 0x8b, 0xb1, 0x1a, 0x1f, 0x39,
+          0xee, 0xe3, 0x66, 0xf8, 0xdc, 0xe9, 0x6f, 0x99, 0xff, 0xec, 0x41, 0xd4, 0xe9, 0xe3, 0x7e, 0xf4, 0x26, 0x2f, 0x56, 0xf5, 0xf0, 0x42, 0xbc, 0xc2,
+          0x88, 0x06, 0x8f, 0xb8, 0x12, 0x60, 0x3f, 0x52, 0x42, 0x37, 0x3b, 0x29, 0x3a, 0xac, 0x49, 0xd3, 0x0c, 0xce, 0xeb, 0xbc, 0x2e, 0xa5, 0x1d, 0xe8,
+          0xeb, 0x7f, 0x27, 0x80, 0x4b, 0xf5, 0xc1, 0x9a, 0x96, 0x04, 0x09, 0x81, 0xd5, 0x4b, 0x56, 0xc8, 0x1c, 0xcf, 0x09, 0x3c, 0xec, 0xaa, 0x06, 0x30,
+          0xe4, 0xfd, 0xd0, 0x1d, 0x34, 0xe7, 0xbb, 0xd6, 0x81, 0x2b, 0x90, 0x86, 0xb9, 0x16, 0x54, 0x9a, 0xec, 0x73, 0x7d, 0xe0, 0xd2, 0x01, 0x94, 0xf6,
+          0x51, 0xa4, 0x5f, 0x17, 0xa5, 0x71, 0xd9, 0x92, 0x61, 0x3e, 0x38, 0x61, 0xa9, 0xb1, 0x12, 0x66, 0x52, 0x7a, 0xcf, 0xe9, 0x23, 0xab, 0xba, 0x90,
+          0xce, 0x8f, 0x60, 0x84, 0x8a, 0x2d, 0xfa, 0x37, 0xc0, 0x9d, 0x9d, 0x84, 0xf5, 0xd9, 0x92, 0x8c, 0xdd, 0x4c, 0x5c, 0xa8, 0x35, 0xc6, 0x81, 0xec,
+          0xe3, 0x26, 0xe6, 0x78, 0xd7, 0x87, 0x83, 0x97, 0x03, 0xac, 0x6a, 0x5b, 0x59, 0x7e, 0x46, 0xab, 0xba, 0x94, 0x3a, 0x36, 0x6f, 0x38, 0xc0, 0xc9,
+          0x99, 0x65, 0x8a, 0x88, 0x9d, 0x09, 0xdf, 0x41, 0x07, 0x86, 0x92, 0x3e, 0x48, 0x99, 0x4b, 0xa6, 0x78, 0xd3, 0xf1, 0x63, 0x96, 0x5b, 0x49, 0x8c,
+          0x1e, 0x03, 0xc6, 0x3c, 0x4f, 0xc7, 0x41, 0x12, 0x72, 0xa9, 0xbe, 0x93, 0xcd, 0xdb, 0xc6, 0x8a, 0x8e, 0x16, 0x53, 0x4c, 0x9f, 0x45, 0xd8, 0x61,
+          0x7d, 0x58, 0x98, 0x2a, 0x59, 0x20, 0x25, 0xd0, 0x0e, 0x73, 0xda, 0x38, 0xfc, 0x51, 0x86, 0xbd, 0x73, 0x3d, 0x66, 0x4e, 0x0b, 0xcd, 0x52, 0x53,
+          0x74, 0xe9, 0x3d, 0x69, 0xf1, 0x84, 0x37, 0x2c, 0xce, 0x93, 0xa9, 0xd3, 0xdb, 0x9c, 0xc5, 0xda, 0x43, 0x8b, 0x9a, 0x52, 0x8f, 0x58, 0xb7, 0xda,
+          0xd1, 0xf9, 0x4b, 0xec, 0x49, 0xcf, 0xa9, 0xa5, 0xab, 0x3c, 0xab, 0x4b, 0x6a, 0x4f, 0x0b, 0xc1, 0x66, 0xb3, 0x1d, 0x9a, 0x70, 0xb4, 0x91, 0x64,
+          0x25, 0x99, 0xa2, 0x75, 0x16, 0x4b, 0x76, 0x0b, 0x9c, 0x61, 0xe1, 0x28, 0xe7, 0x63, 0xc8, 0xfc, 0xc7, 0x03, 0x37, 0x4d, 0xf9, 0x09, 0x32, 0xbe,
+          0xb2, 0x3b, 0x10, 0xa8, 0x24, 0x4b, 0x76, 0xa1, 0x74, 0x37, 0x35, 0xcb, 0x47, 0xba, 0xdb, 0x40, 0x62, 0xe1, 0x07, 0xaa, 0xf5, 0x99, 0x7d, 0xd7,
+          0x4c, 0x14, 0xa1, 0x9f, 0xdb, 0x87, 0x15, 0x78, 0xd3, 0x0b, 0x70, 0x37, 0x99, 0x81, 0x78, 0xc6, 0xc8, 0xef, 0xa8, 0xfd, 0x2b, 0xb4, 0xa9, 0x7d,
+          0x44, 0xa4, 0x8d, 0xa0, 0xa8, 0x03, 0xcf, 0x36, 0xf5, 0x23, 0x35, 0xba, 0x45, 0x1f, 0xe7, 0x9b, 0xc1, 0xba, 0x51, 0x10, 0xc7, 0x8f, 0x30, 0xb1,
+          0xa8, 0x4d, 0x00, 0x4c, 0xfd, 0xb1, 0x92, 0x14, 0xf1, 0x7a, 0x10, 0x8d, 0x80, 0x25, 0x52, 0xcb, 0x00, 0xa4, 0x24, 0x00, 0xb6, 0x1e, 0x67, 0x90,
+          0xf5, 0x22, 0x1c, 0x7c, 0xf5, 0x63, 0x77, 0xe1, 0x79, 0x5d, 0x6a, 0x0d, 0xc4, 0x0d, 0x1e, 0x3f, 0x15, 0x1c, 0xdd, 0x4f, 0x4e, 0xa3, 0x8a, 0x8b,
+          0x42, 0x40, 0xed, 0x72, 0x13, 0x14, 0x3a, 0x4e, 0x84, 0xdb, 0xd6, 0xf9, 0x6f, 0xe6, 0x02, 0x21, 0x39, 0x49, 0x4a, 0x2d, 0x87, 0x88, 0x3d, 0x4b,
+          0x71, 0x57, 0x65, 0x8c, 0x44, 0x38, 0x59, 0x59, 0xe3, 0xbd, 0xf5, 0x88, 0x59, 0x9a, 0xb8, 0xb6, 0xa7, 0x5c, 0xf4, 0x13, 0x4a, 0xf6, 0xb3, 0x52,
+          0x1d, 0x59, 0x00, 0xa3, 0xb2, 0xde, 0x4d, 0x35, 0xf8, 0xe9, 0x08, 0xd4, 0x35, 0x94, 0xbf, 0x9b, 0x08, 0x22, 0xa8, 0xa8, 0xd0, 0xc0, 0x69, 0x00,
+          0x48, 0x21, 0x84, 0x49, 0x8d, 0xe7, 0xf2, 0x42, 0x68, 0x74, 0x22, 0xea, 0xb9, 0xa9, 0xcf, 0x25, 0xeb, 0x04, 0x26, 0xe1, 0xcd, 0x45, 0x46, 0x82,
+          0xd5, 0x57, 0xc2, 0x1b, 0xe9, 0x20, 0xc5, 0xf4, 0x46, 0x46, 0xab, 0xcd, 0x5c, 0x03, 0x9a, 0xd6, 0xcf, 0x39, 0xfb, 0xc7, 0x48, 0x77, 0xac, 0xea,
+          0xb9, 0x04, 0xdc, 0x08, 0xfa, 0xfd, 0x3e, 0x60, 0xba, 0x30, 0xcc, 0xda, 0x91, 0x02, 0x3a, 0xd6, 0xc1, 0x53, 0x64, 0x63, 0x7b, 0xb2, 0x0d, 0x33,
+          0xf7, 0x99, 0x18, 0xcd, 0xc5, 0xc5, 0x1a, 0xda, 0xc7, 0x07, 0xe1, 0xef, 0xae, 0x0d, 0x8f, 0x85, 0x89, 0xb8, 0x22, 0xfd, 0x50, 0xfa, 0xe9, 0x58,
+          0x5a, 0x89, 0x5b, 0x2f, 0x3f, 0xae, 0x6b, 0x18, 0xef, 0x93, 0x2b, 0x54, 0x68, 0xff, 0x60, 0x0b, 0xd9, 0xa4, 0xb5, 0x32, 0xd0, 0xa5, 0xb0, 0x20,
+          0xe5, 0x5a, 0xf9, 0xd4, 0x51, 0x75, 0x88, 0x25, 0xa7, 0xad, 0x7d, 0x9d, 0xbf, 0x18, 0x57, 0x99, 0x75, 0x08, 0x8a, 0x32, 0xad, 0x85, 0xdf, 0xa2,
+          0x23, 0x82, 0x41, 0xb8, 0x42, 0x59, 0x02, 0xaf, 0xf5, 0x7a, 0x3a, 0x8a, 0x32, 0xaa, 0x50, 0x2d, 0x2d, 0x91, 0x25, 0xeb, 0x55, 0x95, 0x8c, 0xcb,
+          0x76, 0x4d, 0x1a, 0x23, 0xda, 0xd9, 0x30, 0x12, 0x74, 0x1c, 0x6b, 0xde, 0x4b, 0x18, 0x3b, 0x6b, 0x79, 0x98, 0x8b, 0x89, 0x22, 0xf6, 0x49, 0x6e,
+          0x18, 0x2c, 0xfc, 0xa9, 0xf2, 0x74, 0xf7, 0xe2, 0x1e, 0x00, 0x75, 0x00, 0x09, 0xef, 0xb0, 0xe7, 0x07, 0x72, 0x44, 0xf1, 0x0f, 0x8a, 0x78, 0x39,
+          0x03, 0xaf, 0x63, 0xf7, 0xea, 0xbd, 0xba, 0x44, 0xe7, 0xe4, 0x5c, 0xf1, 0x74, 0x1f, 0xda, 0x3b, 0x5a, 0xc8, 0xd4, 0x7b, 0x9a, 0xa7, 0x32, 0x6b,
+          0x07, 0x11, 0x29, 0x4a, 0xfc, 0x65, 0x63, 0x66, 0x6b, 0x60, 0x81, 0x40, 0xaf, 0xd5, 0xe9, 0x85, 0x0d, 0x42, 0x5d, 0xea, 0x35, 0x75, 0x1c, 0x0b,
+          0x46, 0xaf, 0x2b, 0x43, 0x13, 0x41, 0x58, 0x31, 0xfa, 0xcd, 0xe5, 0x21, 0xae, 0xb2, 0x76, 0x4a, 0x29, 0xf1, 0x53, 0x48, 0x56, 0x73, 0xa0, 0x41,
+          0xb4, 0x98, 0x7d, 0xef, 0x25, 0x32, 0x5f, 0xd1, 0xc6, 0x38, 0xf4, 0x8c, 0xaa, 0xc3, 0x7b, 0x30, 0xcc, 0x78, 0x8b, 0x37, 0x5b, 0x36, 0xc4, 0xdc,
+          0x69, 0x8b, 0xfb, 0xfd, 0x64, 0x7d, 0xb4, 0x85, 0x40, 0xbf, 0x90, 0x05, 0xf5, 0x45, 0xcd, 0xe2, 0xc0, 0xb6, 0x22, 0x3b, 0x46, 0x53, 0xcf, 0x85,
+          0xa3, 0x11, 0x83, 0x99, 0xf8, 0xcb, 0xe2, 0x69, 0xd2, 0x32, 0x95, 0x22, 0x93, 0xea, 0xe6, 0x54, 0x9e, 0x0a, 0xdc, 0x3b, 0x3a, 0x46, 0xd9, 0x35,
+          0x1f, 0x08, 0x7a, 0x2a, 0x10, 0x41, 0xa9, 0x7f, 0x0a, 0x21, 0xf2, 0x2b, 0x22, 0xdc, 0x9a, 0xe3, 0xae, 0x60, 0xea, 0x0e, 0x46, 0x23, 0x1d, 0xe4,
+          0x4d, 0x8e, 0x4d, 0x3c, 0x40, 0x7f, 0x5a, 0xdc, 0xec, 0x84, 0xa7, 0x83, 0xc7, 0x6b, 0x81, 0x7b, 0x2c, 0x71, 0x86, 0x43, 0x41, 0x6a, 0x29, 0x11,
+          0xa8, 0xc4, 0xd9, 0x79, 0x1d, 0xd0, 0x84, 0xaf, 0x65, 0x56, 0x6c, 0x76, 0x41, 0x98, 0x8d, 0x20, 0xd0, 0x5f, 0xba, 0x3e, 0x75, 0xe6, 0x68, 0x71,
+          0x84, 0x10, 0x92, 0xf1, 0x92, 0x7c, 0x7c, 0x61, 0xdb, 0x3c, 0x48, 0xf3, 0xb2, 0x6d, 0x7b, 0x62, 0xf5, 0xfb, 0xa7, 0x2f, 0x02, 0x87, 0xf9, 0x76,
+          0x0a, 0x61, 0x12, 0x3b, 0xaa, 0x6c, 0xc7, 0x42, 0x9f, 0x8e, 0x09, 0x86, 0xcf, 0xde, 0x23, 0x9d, 0x89, 0x49, 0xf9, 0xd3, 0xe2, 0x47, 0x90, 0xa0,
+          0x41, 0xa8, 0x89, 0xba, 0x95, 0x91, 0x5a, 0x37, 0xc9, 0x30, 0x3a, 0x2f, 0x69, 0xc2, 0x04, 0x9f, 0x4d, 0x86, 0x67, 0x99, 0x84, 0xd3, 0xfb, 0x81,
+          0x48, 0x42, 0x2c, 0xde, 0xf5, 0x5d, 0x4b, 0xdb, 0x73, 0x2b, 0xea, 0xe6, 0x86, 0x0f, 0x07, 0x02, 0x61, 0xee, 0xfa, 0x10, 0xa3, 0x2b, 0x9e, 0xf2,
+          0xf3, 0x9d, 0xb4, 0x3a, 0xdc, 0xf5, 0x7b, 0xf6, 0x92, 0x75, 0x45, 0xdf, 0x35, 0x46, 0x39, 0xaa, 0x7c, 0x6b, 0xf8, 0xbc, 0xd3, 0xc8, 0x9c, 0x38,
+          0x96, 0x9d, 0xf1, 0x8b, 0x0e, 0x1d, 0xdb, 0x45, 0x54, 0x77, 0x01, 0xbc, 0x1f, 0xd6, 0xbe, 0xfa, 0xa6, 0x8f, 0xd6, 0xdc, 0xf9, 0xcb, 0x84, 0x42,
+          0x46, 0xa0, 0xb6, 0x87, 0x55, 0x91, 0xb1, 0x5a, 0xc7, 0x88, 0xfa, 0xc8, 0x8f, 0x48, 0x96, 0xaf, 0x15, 0xcf, 0x9f, 0x48, 0xf8, 0xf9, 0x1b, 0x29,
+          0x61, 0x4a, 0x7d, 0xc5, 0xce, 0xcd, 0x1e, 0xee, 0x6d, 0xea, 0x5a, 0xd4, 0x89, 0x33, 0xb5, 0x14, 0x7d, 0x3b, 0x8c, 0x4c, 0xcd, 0xdc, 0x86, 0x4c,
+          0x72, 0x20, 0xa2, 0xe1, 0xa4, 0x0f, 0xcc, 0x21, 0xf9, 0x90, 0x4f, 0xf9, 0x24, 0x40, 0xc2, 0x4f, 0x81, 0x69, 0x5a, 0x81, 0x0a, 0x44, 0x7a, 0xe7,
+          0x90, 0x1d, 0x55, 0x0f, 0x55, 0xcc, 0xd3, 0x45, 0xc0, 0x95, 0x88, 0xda, 0x30, 0xd9, 0xc7, 0x2e, 0x5a, 0x7b, 0xbe, 0x43, 0x52, 0x73, 0x24, 0xb3,
+          0x29, 0x93, 0x8b, 0xe6, 0x6f, 0x08, 0xf7, 0x50, 0x5c, 0x1c, 0xa1, 0x94, 0xc7, 0xbd, 0xa9, 0xbd, 0x45, 0xfe, 0x6b, 0x28, 0x60, 0x61, 0x94, 0x51,
+          0x7a, 0xc5, 0xa8, 0xba, 0x08, 0x9d, 0xda, 0x67, 0xc6, 0x7b, 0xf0, 0xf8, 0x08, 0xf2, 0xbd, 0x4d, 0x82, 0xae, 0x4f, 0x94, 0x46, 0x9a, 0x3d, 0x94,
+          0x04, 0x15, 0x68, 0xd5, 0x12, 0xbb, 0x50, 0x83, 0x4c, 0x47, 0xc2, 0x33, 0xc2, 0x27, 0xd5, 0x1c, 0xb3, 0xc7, 0x17, 0xa5, 0x52, 0xd7, 0xf1, 0xee,
+          0x15, 0x62, 0x14, 0x4f, 0x10, 0xeb, 0xd7, 0x52, 0xc0, 0xee, 0x84, 0x4a, 0x89, 0xa7, 0x88, 0xd3, 0xed, 0x11, 0x45, 0xd6, 0x84, 0x23, 0x7d, 0x89,
+          0x03, 0xd3, 0x67, 0x38, 0xc1, 0x9c, 0xed, 0xe8, 0xaa, 0x64, 0x6b, 0xbc, 0x9f, 0xcc, 0x20, 0x58, 0x07, 0x38, 0x1d, 0x69, 0x38, 0x63, 0x38, 0x59,
+          0x19, 0x77, 0xec, 0xb1, 0x9c, 0x45, 0x89, 0x5b, 0xb8, 0x02, 0xfd, 0x6c, 0x4f, 0x68, 0x42, 0x08, 0x00, 0xa2, 0x33, 0x58, 0x8f, 0x9a, 0x23, 0xc5,
+          0x2f, 0xdc, 0xb8, 0xb4, 0x25, 0x46, 0x89, 0xdc, 0x11, 0xe6, 0x1a, 0xc4, 0xb3, 0x70, 0x99, 0x7b, 0x1e, 0xf3, 0x09, 0xdd, 0xf2, 0x5f, 0x76, 0xd7,
+          0x52, 0xc3, 0x74, 0xd8, 0xbb, 0x02, 0x19, 0x2d, 0x63, 0xca, 0x1a, 0x89, 0x6f, 0xe3, 0x2d, 0x02, 0xbf, 0x80, 0xde, 0x59, 0x22, 0x87, 0x54, 0xc3,
+          0xd4, 0x77, 0xb4, 0x32, 0xcd, 0x0f, 0x9c, 0x46, 0x46, 0xdd, 0x28, 0x95, 0xb7, 0x45, 0x17, 0xf9, 0x22, 0x22, 0x5e, 0x17, 0x16, 0xec, 0x62, 0xe0,
+          0xd2, 0x7d, 0xf0, 0x35, 0xcf, 0xa9, 0xcf, 0x0a, 0x8d, 0xd9, 0x84, 0x27, 0x3c, 0x6e, 0x79, 0x9b, 0xd8, 0xa7, 0xac, 0xc6, 0x42, 0x33, 0xd5, 0x2e,
+          0xa2, 0xe6, 0x54, 0x1f, 0xb5, 0x37, 0x11, 0x6a, 0x09, 0x3b, 0x16, 0x98, 0x20, 0xe7, 0xc5, 0x51, 0xd2, 0xc7, 0xa5, 0x4a, 0x78, 0xc1, 0x07, 0x52,
+          0xd0, 0xd9, 0x15, 0x43, 0x1b, 0x73, 0xc4, 0x9c, 0x4f, 0x3f, 0x4d, 0x7d, 0xcd, 0xdd, 0xa1, 0xfc, 0x68, 0x4e, 0xb5, 0x03, 0x1a, 0xcb, 0xaa, 0x2c,
+          0x70, 0xd6, 0x12, 0x17, 0xbf, 0xa0, 0xf0, 0x88, 0xf8, 0x8c, 0x25, 0x38, 0xda, 0x54, 0xe3, 0xcc, 0xde, 0x3b, 0x00, 0xc4, 0x6a, 0x0a, 0x4b, 0x69,
+          0x87, 0xc9, 0x59, 0x9d, 0x84, 0xba, 0xbb, 0xc5, 0x8a, 0x78, 0xaa, 0xf6, 0x41, 0x94, 0x0d, 0xed, 0x58, 0x75, 0x01, 0xa0, 0xf3, 0xee, 0xd1, 0xd5,
+          0x25, 0x54, 0x2d, 0x8a, 0xd8, 0x37, 0x1a, 0x9c, 0xf4, 0x32, 0x42, 0x15, 0x24, 0x0f, 0x98, 0xab, 0xab, 0x83, 0xfe, 0x51, 0x3f, 0xa8, 0xb1, 0x6b,
+          0x9d, 0xae, 0x04, 0x89, 0x0b, 0xa0, 0xb4, 0x6a, 0x52, 0xb7, 0xf7, 0xbc, 0x7f, 0x67, 0x9f, 0x5e, 0x50, 0xdb, 0x8e, 0x62, 0xa4, 0xe7, 0xad, 0xd1,
+          0xeb, 0xc1, 0xf2, 0xb1, 0xee, 0x1d, 0xfe, 0xbf, 0x83, 0xd6, 0xa2, 0xff, 0x13, 0xac, 0xbd, 0x89, 0x6c, 0xcb, 0x65, 0x70, 0x6b, 0x03, 0x7f, 0x07,
+          0xe5, 0x65, 0xe5, 0x0c, 0xe2, 0x08, 0xd0, 0x57, 0x42, 0xae, 0x56, 0x8e, 0x6a, 0x39, 0xdb, 0x72, 0xce, 0x26, 0xfa, 0xca, 0x28, 0xe0, 0x5a, 0xd4,
+          0xde, 0xd0, 0x87, 0x8b, 0xcc, 0x15, 0x3b, 0xa4, 0x27, 0xf3, 0xc8, 0xf6, 0x13, 0xbb, 0xe5, 0x86, 0x88, 0x53, 0xdf, 0x8c, 0xf4, 0x65, 0x98, 0x71,
+          0xa2, 0x4f, 0x95, 0xc0, 0x34, 0x84, 0x67, 0x92, 0x73, 0x9f, 0x14, 0xed, 0xc3, 0x13, 0x55, 0x44, 0x8a, 0xe0, 0x46, 0x9c, 0xbe, 0xce, 0x99, 0x22,
+          0xcc, 0x66, 0x07, 0x2a, 0x0f, 0xe5, 0xc6, 0x79, 0x85, 0x21, 0xc8, 0x4b, 0x8e, 0xa8, 0x64, 0xe7, 0xb1, 0x78, 0x07, 0x6d, 0xb8, 0x95, 0x73, 0xa2,
+          0xe6, 0x83, 0x0e, 0xf2, 0xdc, 0x72, 0x85, 0xd9, 0x5a, 0x1c, 0x00, 0x63, 0x58, 0x07, 0x40, 0xbc, 0x4e, 0x84, 0x4d, 0x09, 0xa4, 0x01, 0xc3, 0x8b,
+          0xe7, 0xa8, 0x5c, 0x57, 0x34, 0x91, 0xb5, 0x10, 0x8f, 0xff, 0x2a, 0xd6, 0x6d, 0x72, 0xab, 0x0d, 0xeb, 0x80, 0x9c, 0x2a, 0x27, 0x46, 0x9c, 0x4c,
+          0x3b, 0xe7, 0x42, 0xc1, 0x9b, 0xbf, 0x1f, 0x7b, 0x2e, 0xfd, 0x3e, 0x6d, 0x0d, 0xab, 0x6f, 0x4b, 0xbd, 0x2c, 0xb6, 0x36, 0xfb, 0x3a, 0x90, 0x62,
+          0xfc, 0x50, 0x03, 0xf8, 0x68, 0x12, 0xa3, 0x56, 0x75, 0x4d, 0x76, 0xf8, 0xe6, 0xda, 0x88, 0x4a, 0x83, 0x00, 0x99, 0x2c, 0xe0, 0xd1, 0x70, 0x1e,
+          0xf6, 0xf0, 0x11, 0x13, 0xbd, 0x71, 0xf6, 0xb8, 0x61, 0x26, 0x07, 0x6a, 0x95, 0xa8, 0xe0, 0x40, 0x6d, 0x6c, 0xeb, 0x11, 0xed, 0x00, 0x74, 0x4c,
+          0x0c, 0xc1, 0xcd, 0x5d, 0xb6, 0x88, 0xf7, 0xd2, 0x10, 0xfd, 0xee, 0xd1, 0x2a, 0xb4, 0xae, 0xc0, 0x28, 0xdc, 0x68, 0x69, 0x31, 0xfb, 0xd5, 0x70,
+          0x86, 0x11, 0x3b, 0x52, 0xe9, 0xfa, 0x4b, 0x19, 0xc3, 0x0c, 0x82, 0x2c, 0xd6, 0xa5, 0xed, 0x8a, 0x67, 0x18, 0xf9, 0x4c, 0x5c, 0x70, 0x95, 0xc9,
+          0x82, 0x86, 0xae, 0x28, 0x6f, 0x15, 0xcc, 0xf7, 0xbb, 0x04, 0xbd, 0x05, 0x29, 0x65, 0xf5, 0x9c, 0xfd, 0x5e, 0xa5, 0xc8, 0xac, 0x51, 0xb0, 0xe3,
+          0xd0, 0xa9, 0xc5, 0x56, 0x85, 0x02, 0x5e, 0x94, 0xd9, 0x6a, 0xd1, 0x2a, 0xa4, 0x9b, 0x54, 0x0c, 0x15, 0x91, 0x28, 0x21, 0x3a, 0x12, 0x65, 0xc2,
+          0x87, 0x88, 0xcf, 0x89, 0xba, 0xdf, 0x5d, 0xd5, 0xb8, 0x6c, 0xd9, 0x50, 0xc6, 0x7d, 0x1c, 0xd9, 0x4c, 0xde, 0x79, 0x76, 0x11, 0x0b, 0x9a, 0xc7,
+          0x5b, 0xcc, 0xcf, 0xbd, 0xe4, 0x7e, 0x2d, 0xd1, 0xf9, 0xc4, 0x38, 0x1b, 0x7b, 0x5a, 0x55, 0x1d, 0xd2, 0x77, 0xf4, 0xb4, 0x7c, 0xf9, 0xac, 0x67,
+          0x3c, 0x20, 0x04, 0x3b, 0x15, 0x87, 0x4a, 0x64, 0xd3, 0x59, 0xfb, 0xf7, 0xd5, 0x73, 0xa3, 0x36, 0x7d, 0x4f, 0x9e, 0x38, 0x11, 0x10, 0x25, 0x7d,
+          0x9b, 0xdd, 0xa0, 0x91, 0xdb, 0x9c, 0x15, 0x69, 0xc8, 0x26, 0xf6, 0x33, 0xe2, 0x4f, 0x23, 0x34, 0x46, 0x10, 0xfd, 0x3a, 0xbf, 0x01, 0xd2, 0xf5,
+          0x86, 0x3d, 0xa7, 0x28, 0xfa, 0xa3, 0xb2, 0xaf, 0x60, 0xbe, 0x0e, 0xb2, 0xaa, 0x5d, 0xbe, 0xac, 0x5b, 0xcf, 0x15, 0xc2, 0x87, 0x49, 0xf2, 0xad,
+          0xef, 0xe7, 0x98, 0x0a, 0x64, 0x42, 0x3f, 0x1b, 0xee, 0xc7, 0xf1, 0xbf, 0xeb, 0x59, 0x1f, 0xc2, 0x16, 0xaa, 0xda, 0xa5, 0x3a, 0x81, 0x99, 0xfc,
+          0x17, 0x84, 0xbe, 0xcd, 0x41, 0x1c, 0xf2, 0x6d, 0x2e, 0x76, 0x28, 0x07, 0x40, 0x31, 0x61, 0x0d, 0x91, 0x7a, 0x59, 0x79, 0x6f, 0x58, 0x76, 0x12,
+          0xce, 0xf7, 0x44, 0x97, 0x23, 0x8f, 0xc7, 0xc6, 0x32, 0xbf, 0xd5, 0xd9, 0x0c, 0x7f, 0x6b, 0xf6, 0x21, 0xa8, 0x7e, 0xab, 0x77, 0x96, 0xa4, 0x30,
+          0x3b, 0x43, 0x10, 0x67, 0x32, 0xe3, 0x73, 0x1e, 0xa5, 0x9d, 0xc1, 0xe4, 0x63, 0x66, 0xb2, 0xa8, 0xcf, 0xba, 0xba, 0x7c, 0x1a, 0xce, 0x89, 0xf1,
+          0x4b, 0xaa, 0xba, 0xae, 0x71, 0xff, 0x80, 0xef, 0x5a, 0xe6, 0xd1, 0x1e, 0xfb, 0x90, 0x9b, 0x8a, 0xab, 0xaa, 0xfc, 0xfe, 0xf8, 0xd3, 0x58, 0xc4,
+          0xa1, 0x97, 0xcc, 0x14, 0x1b, 0x42, 0xad, 0x9c, 0xee, 0x5b, 0x4c, 0xfa, 0x68, 0xcb, 0xec, 0x29, 0x04, 0x47, 0x87, 0x25, 0x34, 0xa3, 0x79, 0xd5,
+          0x40, 0xc5, 0x7f, 0xd6, 0x2b, 0x19, 0x9d, 0x75, 0xc2, 0x4b, 0x7e, 0x3f, 0xfa, 0x40, 0x5d, 0x9e, 0xfa, 0x4a, 0x45, 0xa3, 0x2e, 0xdd, 0x41, 0xcf,
+          0x9a, 0x77, 0xa0, 0xb6, 0xeb, 0x2c, 0xe7, 0x63, 0x13, 0x57, 0x4d, 0xa9, 0xe2, 0x84, 0xe7, 0x57, 0x79, 0x03, 0xeb, 0x4c, 0x95, 0xbf, 0x1b, 0xa0,
+          0xbf, 0x64, 0xfb, 0x5f, 0xbd, 0x7d, 0xf6, 0xd6, 0x45, 0xf7, 0x9b, 0xa6, 0x3d, 0xbd, 0x70, 0x56, 0x61, 0x04, 0x47, 0x69, 0x58, 0x45, 0x7a, 0xa2,
+          0x37, 0xe1, 0xff, 0x9f, 0x72, 0x4d, 0xfa, 0xdc, 0x47, 0x77, 0xdb, 0x6d, 0xdf, 0x0e, 0x6c, 0x38, 0x8e, 0x7f, 0x86, 0xdd, 0x0a, 0x38, 0x83, 0x7e,
+          0x78, 0xc1, 0x05, 0xf0, 0x41, 0x56, 0xd2, 0x81, 0xa9, 0x2c, 0xc9, 0x72, 0x67, 0xc7, 0x71, 0x42, 0x17, 0x2a, 0xdf, 0xe3, 0x09, 0x63, 0x0d, 0xcc,
+          0x29, 0xd4, 0xb7, 0x20, 0xae, 0xe4, 0x15, 0x52, 0x1e, 0x23, 0xd6, 0x35, 0xf2, 0x2f, 0xff, 0x15, 0x58, 0x11, 0x48, 0x56, 0xb6, 0x75, 0xaf, 0x41,
+          0x32, 0x7f, 0x88, 0x24, 0x2b, 0x1a, 0x3d, 0x46, 0x55, 0x34, 0xb9, 0x9d, 0x09, 0x86, 0x10, 0x59, 0xb9, 0xe8, 0x0d, 0xfb, 0xf7, 0xee, 0x0d, 0xd9,
+          0x6f, 0x27, 0xfe, 0x5e, 0x65, 0x72, 0x20, 0x86, 0x05, 0x99, 0x7e, 0xd7, 0xef, 0x1e, 0xd1, 0x64, 0xd9, 0x5a, 0x29, 0xbe, 0x20, 0x79, 0x53, 0xd1,
+          0xc7, 0x73, 0x7f, 0x95, 0xfd, 0xcb, 0xc1, 0xb2, 0xad, 0xb0, 0xe2, 0xeb, 0xb0, 0x5c, 0x71, 0x0a, 0x92, 0x0c, 0x41, 0x90, 0x2a, 0x50, 0xa3, 0xd5,
+          0x53, 0xf0, 0x50, 0xac, 0xbe, 0xc8, 0x2b, 0xdd, 0x13, 0x5c, 0x9f, 0x02, 0x27, 0xa5, 0x77, 0x67, 0xb8, 0xf9, 0xf2, 0x2a, 0x75, 0xeb, 0xc5, 0x51,
+          0xcb, 0x8b, 0x26, 0xaf, 0xb5, 0x81, 0xab, 0xe1, 0xd7, 0xdb, 0x50, 0x8d, 0x9a, 0x30, 0x56, 0x61, 0x10, 0xd9, 0x94, 0x67, 0xc0, 0x1c, 0xed, 0x85,
+          0xb9, 0xc5, 0x2b, 0x32, 0xfb, 0x74, 0xb8, 0x3c, 0x9a, 0x5d, 0xe5, 0x4f, 0x78, 0x7c, 0x4d, 0x65, 0x55, 0x14, 0xa5, 0xdb, 0xfc, 0x87, 0x88, 0x4d,
+          0x6a, 0x67, 0x09, 0xeb, 0x87, 0xd1, 0x19, 0xce, 0xe4, 0xfb, 0x28, 0x78, 0xbc, 0xb5, 0x9d, 0xa2, 0x4a, 0xa1, 0x68, 0x86, 0x11, 0x92, 0xac, 0xda,
+          0xc5, 0xfb, 0x03, 0x60, 0x2f, 0x31, 0x60, 0x24, 0x04, 0xb1, 0xe3, 0x93, 0x6a, 0x48, 0xed, 0x01, 0x60, 0x74, 0x26, 0xe4, 0xb1, 0xf0, 0x06, 0x12,
+          0xe0, 0x71, 0xe4, 0x89, 0x9e, 0x6d, 0xc0, 0x87, 0xc8, 0xfa, 0x20, 0x8c, 0x89, 0xde, 0x4a, 0x13, 0x64, 0x39, 0x40, 0xd6, 0xea, 0x59, 0x98, 0xde,
+          0x15, 0x6e, 0xf7, 0xe3, 0x64, 0x9b, 0xe5, 0xb9, 0x3a, 0x59, 0x8b, 0x3a, 0x8d, 0x04, 0xa1, 0x19, 0x85, 0xd2, 0xd7, 0xd6, 0xb8, 0x86, 0xe9, 0xe0,
+          0xd6, 0x3b, 0x80, 0x3c, 0x29, 0x59, 0xd4, 0x18, 0xc1, 0x02, 0x13, 0x0a, 0x4f, 0x48, 0xb6, 0x1b, 0xba, 0x9b, 0x0c, 0xeb, 0x41, 0x55, 0x42, 0xe3,
+          0x6a, 0xd7, 0xc5, 0x56, 0x07, 0xf4, 0x86, 0xca, 0x85, 0xca, 0x3f, 0xdf, 0x9b, 0x74, 0x65, 0xdd, 0xb0, 0xc5, 0x15, 0x2d, 0x63, 0x28, 0x25, 0x9b,
+          0xa9, 0xda, 0xf0, 0xfa, 0xf9, 0xe8, 0x0e, 0xb5, 0x3d, 0x2a, 0x16, 0xd1, 0x4f, 0xb6, 0x04, 0x37, 0x56, 0xe1, 0xad, 0x05, 0x73, 0xda, 0x8e, 0x60,
+          0x6d, 0x05, 0x6b, 0x30, 0x32, 0xf8, 0x8a, 0xa9, 0xf9, 0x87, 0x79, 0x9f, 0xf5, 0x18, 0xd4, 0x8c, 0x67, 0x92, 0x63, 0x91, 0xab, 0xdd, 0x35, 0xdd,
+          0x40, 0x45, 0x49, 0x92, 0x3a, 0xc3, 0x75, 0x47, 0x73, 0x26, 0x6e, 0xd1, 0xf9, 0x22, 0xd2, 0x56, 0x85, 0x56, 0x00, 0x84, 0xe5, 0x16, 0xe9, 0xe6,
+          0x9a, 0xc7, 0xec, 0xd0, 0x8c, 0x1a, 0x02, 0x4c, 0x81, 0x3e, 0xad, 0x76, 0xec, 0xfb, 0x88, 0xb2, 0xe0, 0x84, 0xce, 0x70, 0xd5, 0x0f, 0x35, 0xb2,
+          0xf5, 0x89, 0x46, 0x13, 0x3f, 0x9f, 0x18, 0x63, 0xf5, 0x42, 0xcd, 0xd5, 0x10, 0x5e, 0xd1, 0x6d, 0xca, 0xa6, 0x6f, 0xc2, 0xe7, 0x0b, 0xba, 0xdb,
+          0x46, 0x4e, 0xf8, 0xb8, 0xc6, 0x9b, 0x18, 0x93, 0x25, 0xc8, 0x08, 0x00, 0x7f, 0xcb, 0xe8, 0xa1, 0x78, 0x50, 0x42, 0xb7, 0x60, 0xad, 0xcf, 0x86,
+          0x99, 0xe9, 0x7a, 0xd2, 0x50, 0xda, 0x1e, 0xf1, 0x67, 0x6d, 0xd5, 0x40, 0xcd, 0x39, 0xf2, 0xca, 0x1b, 0x90, 0x11, 0xe7, 0x22, 0xd2, 0x99, 0x42,
+          0x35, 0xbd, 0x90, 0x38, 0x4a, 0x30, 0x6b, 0x84, 0x75, 0x4d, 0x16, 0x67, 0xa4, 0x2e, 0x3d, 0x5a, 0xd5, 0x51, 0x03, 0x79, 0x0e, 0x36, 0x74, 0x1b,
+          0x46, 0x63, 0x16, 0x06, 0x13, 0x82, 0x22, 0x94, 0x2e, 0x31, 0xcc, 0xd9, 0x9b, 0x22, 0xe1, 0x82, 0xe0, 0xbc, 0x92, 0xe0, 0xb2, 0xb3, 0x19, 0xb5,
+          0x1f, 0xed, 0x56, 0x60, 0x85, 0x79, 0x05, 0x4f, 0x8e, 0x04, 0x85, 0xa4, 0x0e, 0xd5, 0x2a, 0xad, 0xb1, 0x99, 0x02, 0xea, 0x51, 0xe7, 0x17, 0xb7,
+          0x86, 0xbe, 0xe8, 0xf5, 0xfb, 0xee, 0x5d, 0x06, 0x8d, 0xd3, 0x2c, 0x97, 0x74, 0xfa, 0x53, 0xf8, 0x06, 0xbd, 0x49, 0x5e, 0xe7, 0xe4, 0x5b, 0xb2,
+          0xac, 0x9d, 0x17, 0x41, 0x00, 0xc4, 0x36, 0xd7, 0x07, 0x27, 0xa8, 0x2f, 0xf1, 0x9e, 0x7c, 0xb7, 0x02, 0xe4, 0x0f, 0x0a, 0x90, 0xfd, 0xee, 0xa3,
+          0x88, 0x51, 0x77, 0x4a, 0xec, 0xe0, 0x2e, 0xca, 0x9a, 0x58, 0xf8, 0x15, 0x4e, 0x82, 0x79, 0x2b, 0x69, 0x48, 0xa5, 0x93, 0xce, 0xcf, 0x30, 0x0e,
+          0xc8, 0xcc, 0xe8, 0x61, 0x0d, 0x84, 0x3a, 0xa0, 0x33, 0x35, 0x03, 0x06, 0x7f, 0xc1, 0xfc, 0x22, 0x23, 0xef, 0xdd, 0x82, 0xce, 0x16, 0x43, 0xde,
+          0xc5, 0xc5, 0x46, 0x8a, 0x57, 0x9f, 0x33, 0x4a, 0x6c, 0x22, 0x32, 0xb9, 0xde, 0x33, 0x02, 0x3a, 0xbd, 0xaf, 0x29, 0xfc, 0x19, 0x7c, 0x09, 0x2b,
+          0xa0, 0x14, 0x23, 0x4b, 0x81, 0x0f, 0x65, 0x20, 0x28, 0xa1, 0x7c, 0xbf, 0xc8, 0xbe, 0xbb, 0x02, 0xb1, 0x1a, 0x58, 0x27, 0x25, 0xbd, 0xa6, 0xa5,
+          0x3b, 0x59, 0x52, 0xbc, 0x55, 0xad, 0x60, 0x15, 0x5e, 0x10, 0x71, 0x76, 0xee, 0xe2, 0x94, 0x7b, 0x72, 0xc4, 0x65, 0x91, 0xfb, 0x5e, 0x46, 0xb6,
+          0xec, 0x16, 0xbe, 0x3d, 0x49, 0xb0, 0x60, 0x35, 0x18, 0x02, 0x90, 0x80, 0x63, 0xee, 0xa5, 0x8b, 0x92, 0xbd, 0xcd, 0x01, 0x5c, 0x75, 0x0a, 0xd7,
+          0x2a, 0x0e, 0xb8, 0x61, 0x66, 0xd3, 0x07, 0x89, 0x89, 0x0e, 0x73, 0x60, 0x11, 0xc7, 0x7b, 0x0a, 0x43, 0xbe, 0x8e, 0xb8, 0xb2, 0xfb, 0x2c, 0xc5,
+          0x54, 0xcd, 0x8c, 0x25, 0xa5, 0x51, 0x7e, 0x57, 0x25, 0x6f, 0x3c, 0x04, 0x0a, 0xa1, 0xa0, 0x08, 0xf3, 0x58, 0xa5, 0xf6, 0xec, 0x37, 0x51, 0x6c,
+          0x93, 0x92, 0xbc, 0xec, 0x10, 0x66, 0xea, 0xbc, 0x93, 0x27, 0x0e, 0xec, 0x0f, 0x16, 0xa1, 0x46, 0xe8, 0x61, 0x0f, 0x5c, 0xe4, 0xa6, 0x63, 0x21,
+          0x09, 0xc3, 0x6f, 0x70, 0xfe, 0x77, 0x82, 0xe5, 0x84, 0x69, 0xd1, 0x2d, 0x84, 0x52, 0x7e, 0xef, 0x38, 0xe2, 0x8c, 0x33, 0x38, 0xf2, 0x08, 0xa3,
+          0x48, 0x02, 0xaa, 0x46, 0xba, 0x4a, 0xbd, 0xd8, 0xb4, 0x37, 0xc8, 0xc8, 0x36, 0xb9, 0x2e, 0x00, 0x2c, 0x56, 0x75, 0x85, 0x0b, 0x3e, 0x83, 0x4d,
+          0xb0, 0xcd, 0xdc, 0x44, 0xe5, 0xbc, 0x4d, 0xa5, 0x34, 0x0c, 0xb4, 0x56, 0x78, 0x7e, 0x17, 0x6d, 0x0b, 0x09, 0xe8, 0xc4, 0x75, 0xe2, 0x87, 0xc2,
+          0x04, 0xf1, 0xb4, 0x98, 0x4f, 0xdd, 0x54, 0xa6, 0x63, 0x59, 0xb8, 0xa9, 0x92, 0x16, 0xa3, 0x20, 0xa5, 0x67, 0xcb, 0xa5, 0x3e, 0xf2, 0x9d, 0x45,
+          0x88, 0x89, 0xc4, 0x6d, 0x59, 0xf0, 0xd8, 0x45, 0x64, 0x2e, 0x71, 0x42, 0x7e, 0x1f, 0x51, 0xbc, 0xde, 0xaa, 0x67, 0x44, 0x92, 0xe2, 0xd4, 0x74,
+          0xe7, 0x88, 0x95, 0xb5, 0x48, 0x1d, 0xe6, 0x8d, 0xe8, 0x58, 0xd7, 0xc0, 0x53, 0x4a, 0x39, 0x7e, 0xd2, 0x49, 0xdc, 0xe5, 0x8a, 0xf3, 0x7c, 0x32,
+          0xc9, 0x94, 0xdf, 0x50, 0x8e, 0x8a, 0xfc, 0xe9, 0xd1, 0xed, 0x2d, 0x72, 0x30, 0x4a, 0x2e, 0x38, 0xfb, 0x62, 0xdb, 0x72, 0x16, 0x9d, 0xf1, 0xda,
+          0x93, 0x75, 0x2d, 0xf7, 0x3c, 0x9c, 0xd8, 0x24, 0xc9, 0x24, 0xef, 0x8b, 0x66, 0xb3, 0xad, 0xdf, 0xd7, 0x68, 0x1b, 0xda, 0x5a, 0xf0, 0x38, 0x53,
+          0xfd, 0xdb, 0x6b, 0x66, 0x67, 0x07, 0x27, 0x29, 0x53, 0xec, 0x0d, 0xce, 0x99, 0xe3, 0x44, 0x7c, 0x8a, 0xb4, 0xb4, 0x5a, 0xfc, 0x45, 0xea, 0xf9,
+          0x71, 0x9c, 0xb0, 0x3f, 0xe1, 0x3e, 0x8d, 0x95, 0x76, 0xbe, 0x19, 0x8b, 0xe2, 0x0f, 0x96, 0xbc, 0x6d, 0x41, 0x11, 0x45, 0xb2, 0x5c, 0x5c, 0xad,
+          0xfb, 0x41, 0x96, 0x22, 0x1d, 0x97, 0x79, 0xa6, 0x13, 0x5c, 0x56, 0xff, 0xbe, 0x54, 0x32, 0x63, 0x3e, 0x11, 0x5b, 0xd7, 0xd1, 0x3a, 0x65, 0xf4,
+          0x4a, 0x23, 0x0c, 0xc6, 0xaf, 0x43, 0x5c, 0x79, 0xac, 0x26, 0x90, 0x72, 0x40, 0x27, 0x4a, 0xbf, 0x98, 0x87, 0xbe, 0xa9, 0x54, 0xbd, 0x1d, 0x53,
+          0x25, 0x73, 0x98, 0x4b, 0x51, 0xf4, 0x55, 0x46, 0x22, 0x57, 0x39, 0xdf, 0xb6, 0x08, 0xf3, 0xe1, 0x03, 0xa1, 0x8c, 0x6e, 0x58, 0x32, 0xcc, 0x84,
+          0x30, 0xdc, 0x4f, 0xb4, 0xbc, 0x7d, 0xb4, 0xe3, 0xed, 0x89, 0x2c, 0x7f, 0x57, 0xd9, 0xcd, 0x29, 0xdc, 0xfd, 0x05, 0x61, 0x2e, 0xdc, 0x8c, 0xda,
+          0x06, 0x49, 0xc0, 0xec, 0x7f, 0x66, 0x8a, 0x93, 0x6f, 0x6a, 0xca, 0x4a, 0xb9, 0x44, 0x73, 0xc0, 0xb5, 0xdb, 0xa3, 0x9a, 0xba, 0x8d, 0xc3, 0xa1,
+          0xc4, 0x7e, 0xd8, 0x84, 0x26, 0xc5, 0x28, 0xc4, 0x58, 0x1f, 0x3c, 0xf2, 0x24, 0xab, 0xa1, 0x41, 0xeb, 0x1d, 0xb6, 0xd9, 0x7e, 0x24, 0x01, 0xfb,
+          0x78, 0xe0, 0xea, 0x47, 0x3f, 0xd5, 0xf4, 0x61, 0xb7, 0x78, 0xf0, 0x5a, 0x08, 0xcf, 0xd1, 0x3f, 0xbe, 0x72, 0x44, 0x36, 0xd5, 0x3e, 0x45, 0xbf,
+          0xc9, 0x0d, 0xf5, 0xd7, 0x89, 0x14, 0x19, 0x89, 0xf9, 0x01, 0xab, 0x98, 0xb2, 0x6f, 0xd1, 0x3e, 0xaa, 0x31, 0x18, 0x56, 0x1c, 0xca, 0x3b, 0x5f,
+          0x9e, 0x44, 0xb9, 0xf9, 0x1f, 0x1c, 0x9e, 0x81, 0xab, 0xd3, 0x25, 0x9b, 0xda, 0xc6, 0x0d, 0xdf, 0xd8, 0x29, 0x62, 0xfe, 0xaf, 0xb9, 0x63, 0xe5,
+          0x2e, 0xd7, 0xa5, 0xa0, 0xf7, 0xa1, 0x35, 0xb9, 0x38, 0x26, 0xa4, 0x74, 0x1a, 0x0e, 0x10, 0x52, 0x9b, 0x99, 0x2c, 0x01, 0x85, 0x70, 0xad, 0x25,
+          0x78, 0xce, 0x15, 0xa2, 0xdd, 0x22, 0xba, 0x2a, 0x0f, 0xd2, 0xc2, 0x75, 0xa3, 0x1d, 0xcd, 0x73, 0x8b, 0x32, 0x52, 0xdf, 0xc5, 0xe3, 0x49, 0x5c,
+          0xd3, 0x34, 0xab, 0xda, 0x48, 0x07, 0x76, 0x26, 0x8c, 0x07, 0x82, 0x32, 0xe5, 0xd1, 0x3b, 0x57, 0x86, 0x02, 0xab, 0x7d, 0x21, 0xa0, 0x80, 0x0e,
+          0xbb, 0x42, 0x26, 0xce, 0x63, 0xe2, 0x38, 0xee, 0x5f, 0xb6, 0xbd, 0x99, 0x6f, 0xaf, 0xea, 0xdf, 0xc3, 0xb6, 0x05, 0xa1, 0x12, 0x03, 0x93, 0x8d,
+          0xf0, 0xee, 0x92, 0x47, 0x01, 0xb9, 0x6a, 0x36, 0x49, 0x8d, 0x06, 0x6e, 0x06, 0x89, 0x59, 0x5f, 0x90, 0x45, 0xd1, 0x99, 0x0e, 0x98, 0xf7, 0x21,
+          0xd1, 0x07, 0x6e, 0x76, 0xac, 0xee, 0xad, 0x04, 0x1b, 0x68, 0x17, 0x48, 0xcd, 0x47, 0x2a, 0x25, 0x03, 0x95, 0x9b, 0x26, 0xb3, 0x4e, 0x1f, 0x9f,
+          0x88, 0xd3, 0x63, 0xdc, 0xef, 0x6f, 0x0e, 0x8f, 0xcc, 0x89, 0xd5, 0xda, 0x46, 0x3a, 0x27, 0x68, 0x23, 0xc3, 0xc0, 0x93, 0xd1, 0x47, 0xda, 0xbb,
+          0x4c, 0x0f, 0xf3, 0xfc, 0xcd, 0x40, 0xf0, 0x8c, 0x78, 0xb3, 0x69, 0x17, 0x95, 0xa5, 0x61, 0xc8, 0x92, 0xdb, 0xe9, 0xa3, 0xea, 0xc9, 0x68, 0x93,
+          0x19, 0xb2, 0x41, 0x1a, 0x52, 0x88, 0x9e, 0x97, 0xb0, 0xa4, 0xe5, 0x69, 0x4d, 0x4f, 0x8d, 0x5e, 0xb5, 0x32, 0x75, 0x58, 0x38, 0x5d, 0x74, 0x0e,
+          0xa9, 0x78, 0xe0, 0x6b, 0xb2, 0xf1, 0xb4, 0x5d, 0x56, 0x51, 0x75, 0x7f, 0xc3, 0x17, 0x4f, 0x42, 0x1e, 0x84, 0xf9, 0x17, 0xa3, 0xc7, 0xdd, 0x02,
+          0x8f, 0x94, 0x50, 0xc9, 0x74, 0x92, 0x23, 0x3a, 0xc8, 0xd0, 0x10, 0x03, 0x30, 0x26, 0x9a, 0x10, 0x90, 0x56, 0x1b, 0x34, 0x48, 0x55, 0xf0, 0xa1,
+          0xd6, 0x7a, 0x6c, 0xa8, 0x60, 0x11, 0x04, 0x5b, 0x64, 0x33, 0x68, 0xe8, 0x74, 0x00, 0x47, 0x29, 0xab, 0x55, 0x72, 0x0c, 0xa0, 0x0c, 0x78, 0x6b,
+          0x33, 0x40, 0x2c, 0xeb, 0xcc, 0x2c, 0x0d, 0x23, 0x87, 0x14, 0x29, 0x8b, 0xb4, 0xea, 0xe5, 0x93, 0xdb, 0xdd, 0x96, 0x84, 0xc4, 0x64, 0x1f, 0xb8,
+          0x53, 0x40, 0x67, 0x0e, 0x36, 0x88, 0x54, 0x7d, 0x77, 0x65, 0x55, 0xb0, 0x69, 0xc8, 0x36, 0xa3, 0x61, 0x6e, 0x00, 0x9e, 0x68, 0x20, 0x99, 0x8d,
+          0xca, 0x5c, 0x4c, 0xd0, 0xd8, 0x8a, 0x83, 0xe4, 0x39, 0x46, 0x29, 0x8e, 0x62, 0xc3, 0x10, 0xd1, 0x47, 0xf4, 0xb1, 0x5c, 0x6a, 0x06, 0xfe, 0xcb,
+          0xfb, 0x14, 0x84, 0xea, 0x73, 0x80, 0xce, 0xca, 0x05, 0x24, 0x8f, 0xeb, 0x9f, 0xa9, 0xc7, 0xe7, 0xfb, 0xe0, 0x13, 0x07, 0x40, 0x24, 0x66, 0xb5,
+          0xb7, 0x6b, 0x38, 0x7c, 0x40, 0x1d, 0x11, 0x1c, 0xe6, 0x68, 0xed, 0x84, 0x03, 0x55, 0x45, 0xd0, 0x1a, 0x1d, 0xfe, 0xee, 0x42, 0x34, 0x2b, 0xa9,
+          0x96, 0x14, 0xc7, 0x77, 0x35, 0x53, 0xa8, 0x05, 0xa4, 0x98, 0x6e, 0x98, 0x5c, 0x05, 0x16, 0xf7, 0x8b, 0xd8, 0xd8, 0xc4, 0x6c, 0xcf, 0xe0, 0xf6,
+          0x7f, 0xb4, 0x2a, 0x23, 0x37, 0xb8, 0x27, 0xc2, 0xb2, 0xf9, 0xfa, 0x61, 0xec, 0xdb, 0xf6, 0x8d, 0xaa, 0xf7, 0x83, 0x7c, 0xcf, 0xe5, 0x49, 0xbc,
+          0x0d, 0xe6, 0x7e, 0xed, 0xb3, 0xd6, 0x20, 0x5e, 0xe7, 0xbb, 0xd9, 0x9b, 0x87, 0xa5, 0x97, 0x76, 0x1d, 0x1e, 0x71, 0x4e, 0x43, 0x95, 0x19, 0x97,
+          0x92, 0x9e, 0xa3, 0x61, 0x5b, 0x7c, 0x3b, 0x1e, 0xe1, 0xdb, 0x42, 0x42, 0x38, 0xff, 0x39, 0x31, 0x14, 0xe9, 0x5b, 0x97, 0x98, 0x65, 0x3a, 0x24,
+          0x75, 0xb6, 0x6a, 0xa0, 0x7c, 0x86, 0x93, 0xa5, 0xad, 0x8c, 0x46, 0x73, 0xde, 0x31, 0xad, 0x38, 0x72, 0xcb, 0x78, 0x8e, 0xac, 0xac, 0x0b, 0xc0,
+          0xb9, 0xcd, 0xff, 0x1c, 0x99, 0x4b, 0x65, 0x6a, 0xc5, 0x89, 0xfd, 0x51, 0x10, 0x81, 0x81, 0xb3, 0xe9, 0x83, 0x7e, 0xf3, 0x22, 0xf6, 0x47, 0x89,
+          0x5c, 0xf2, 0x01, 0xb3, 0x1a, 0xbf, 0xf6, 0x96, 0xe2, 0x51, 0xe7, 0x7b, 0xe2, 0x60, 0x92, 0x44, 0x82, 0x33, 0xc2, 0xa4, 0x89, 0xf5, 0xdd, 0x22,
+          0x50, 0x11, 0x83, 0xd5, 0x54, 0xb1, 0x82, 0x1a, 0x95, 0xe0, 0x66, 0xee, 0xf0, 0x15, 0x15, 0x14, 0x7d, 0x21, 0xe2, 0xe9, 0x82, 0xda, 0xe2, 0x49,
+          0xb7, 0x4b, 0x35, 0x80, 0x95, 0xa1, 0x15, 0x45, 0xa1, 0x86, 0xff, 0x90, 0xbd, 0x46, 0x87, 0x54, 0xd0, 0xb8, 0xfc, 0xaf, 0x38, 0x08, 0x96, 0x76,
+          0x1e, 0x88, 0x71, 0xa1, 0xa8, 0x6b, 0x8d, 0x8a, 0x4e, 0xd8, 0x1f, 0x23, 0x97, 0xa6, 0x0e, 0xa5, 0xce, 0x35, 0xb1, 0x70, 0xf8, 0x33, 0x33, 0x2f,
+          0x4b, 0x8a, 0xc9, 0xf7, 0xa5, 0xba, 0xd2, 0xb9, 0x2a, 0xa0, 0xf1, 0x4d, 0x6a, 0x87, 0xf1, 0x7d, 0x85, 0x40, 0x77, 0x47, 0x5b, 0x22, 0x54, 0x6e,
+          0x56, 0x2a, 0x1f, 0xf3, 0x00, 0xca, 0x38, 0xcb, 0x41, 0x21, 0xcd, 0x71, 0xba, 0x11, 0xfc, 0xac, 0xd7, 0x3c, 0x73, 0x9e, 0xb5, 0xf4, 0x48, 0x9f,
+          0xef, 0x32, 0xa4, 0x49, 0x12, 0x94, 0xe8, 0x0f, 0xb9, 0x73, 0x8d, 0x95, 0x0c, 0xf8, 0xb9, 0x54, 0x4e, 0x2a, 0x4a, 0x9a, 0x92, 0x93, 0x2d, 0x69,
+          0xe5, 0xe4, 0x74, 0x75, 0xf8, 0x7e, 0xb3, 0x4a, 0xda, 0x1e, 0xfa, 0x3e, 0x55, 0x41, 0x47, 0x39, 0x6a, 0x19, 0xc9, 0x9f, 0xda, 0xcb, 0xaa, 0x8b,
+          0x15, 0xe4, 0xba, 0xf0, 0xb0, 0xf1, 0x84, 0x3d, 0x60, 0x6e, 0x65, 0x68, 0xc7, 0x25, 0x78, 0x4b, 0x85, 0x94, 0xfe, 0x45, 0xd8, 0x36, 0x8c, 0x61,
+          0xf4, 0x11, 0xc8, 0x75, 0x73, 0x27, 0x24, 0x6e, 0x3b, 0xac, 0x7c, 0x1e, 0x77, 0x99, 0xd4, 0x04, 0x6e, 0xe6, 0xd6, 0x73, 0x19, 0xcb, 0xa9, 0x26,
+          0xc1, 0x1e, 0x88, 0x5f, 0x55, 0x7d, 0xe9, 0x1a, 0x07, 0x06, 0x66, 0x7e, 0x50, 0xcf, 0xcb, 0xa9, 0xea, 0xd5, 0xaa, 0x4a, 0x05, 0xab, 0x77, 0x5e,
+          0xf6, 0x4a, 0xdf, 0x59, 0xdf, 0xf9, 0xff, 0xc8, 0x25, 0x73, 0xbc, 0xe4, 0xab, 0xe4, 0xd8, 0x74, 0xd2, 0x20, 0x3a, 0x8c, 0x6b, 0x51, 0xe9, 0x38,
+          0x8b, 0xe4, 0x30, 0xab, 0x75, 0xb5, 0xd9, 0xec, 0x0b, 0x1d, 0xc0, 0x32, 0xb2, 0x55, 0x4a, 0xbc, 0xc3, 0xd4, 0x4b, 0x93, 0xc3, 0xa3, 0xe9, 0x00,
+          0xb4, 0xda, 0x6f, 0x95, 0xeb, 0x45, 0xe1, 0x94, 0x93, 0x09, 0xb4, 0xa3, 0x27, 0x37, 0x51, 0x81, 0xef, 0x88, 0x65, 0xae, 0x79, 0xbe, 0x2b, 0xc1,
+          0xa3, 0x29, 0xaf, 0x07, 0x6a, 0x17, 0x77, 0x47, 0xec, 0xf9, 0x02, 0xb2, 0x66, 0xed, 0x6d, 0x32, 0xa6, 0x17, 0x6e, 0x73, 0xc9, 0x1f, 0x67, 0x8e,
+          0x66, 0xd1, 0x17, 0xce, 0x70, 0xdc, 0x7b, 0x80, 0x8f, 0xa4, 0xb0, 0x41, 0xdb, 0xa3, 0x8a, 0xd9, 0x0c, 0x42, 0x46, 0xdf, 0x22, 0xbe, 0x6d, 0x5a,
+          0xc5, 0xf8, 0x2c, 0xa0, 0xb8, 0xb8, 0xb6, 0x21, 0xaa, 0x08, 0xde, 0x5a, 0xd6, 0xf2, 0x7d, 0xdc, 0x43, 0x33, 0x4b, 0xa9, 0xb6, 0xf2, 0xb7, 0x38,
+          0xf0, 0x79, 0x3e, 0x34, 0x71, 0xc1, 0x1a, 0x38, 0x6b, 0x95, 0xee, 0x1c, 0x05, 0xcf, 0xd9, 0x50, 0x55, 0x8f, 0xed, 0xda, 0x2c, 0xd6, 0x6b, 0x21,
+          0xe7, 0x93, 0x28, 0x39, 0xe5, 0xa3, 0xc3, 0x55, 0x57, 0x60, 0xb0, 0x48, 0xa5, 0xf2, 0x2d, 0x0e, 0x35, 0xb6, 0x52, 0x2d, 0xbf, 0xa9, 0x3c, 0x8a,
+          0xec, 0xd2, 0x5f, 0x60, 0xf4, 0xf9, 0x0d, 0x6c, 0x9f, 0x3f, 0xd6, 0x7d, 0x33, 0x38, 0x3d, 0xf8, 0x64, 0xaa, 0x0e, 0xde, 0x53, 0xf7, 0x07, 0xbd,
+          0xb4, 0x0b, 0xb7, 0xf9, 0xf8, 0x30, 0xba, 0x6d, 0x74, 0x07, 0xd7, 0x33, 0xef, 0x5e, 0x05, 0x3f, 0xd4, 0xcf, 0xaa, 0x22, 0xdb, 0x08, 0xdd, 0x5a,
+          0xfe, 0xaa, 0x88, 0xf7, 0x69, 0x5f, 0xd0, 0x91, 0x16, 0x3f, 0x8e, 0x1a, 0x91, 0xdf, 0x1c, 0xc1, 0x73, 0xf8, 0x1a, 0x93, 0x8b, 0x29, 0x1c, 0x6c,
+          0x86, 0x58, 0xe3, 0x3c, 0x50, 0x7f, 0x7d, 0xb3, 0x0a, 0x07, 0x7d, 0x5a, 0x92, 0x01, 0xcb, 0x4e, 0x65, 0x08, 0xc6, 0xd2, 0xaa, 0x2a, 0xf6, 0xc6,
+          0x67, 0x2c, 0xc9, 0xa3, 0x6e, 0x88, 0x98, 0x66, 0x58, 0xc9, 0x48, 0x70, 0x8e, 0x26, 0x40, 0x95, 0x34, 0x03, 0xbb, 0x0d, 0xe0, 0x3a, 0x89, 0x0c,
+          0x52, 0x2f, 0x53, 0x8c, 0xb9, 0x7a, 0x09, 0x2e, 0xa3, 0x00, 0xff, 0x0d, 0x85, 0xdd, 0x02, 0x9f, 0x68, 0x39, 0xce, 0x56, 0x11, 0xcf, 0x84, 0x45,
+          0xf0, 0x3d, 0x21, 0x00, 0x5c, 0xcc, 0x70, 0x7c, 0x06, 0xaf, 0x4b, 0x63, 0x1e, 0xf3, 0x91, 0xed, 0xd0, 0x31, 0x91, 0xf8, 0x1f, 0xed, 0xe3, 0x83,
+          0xfa, 0x3a, 0x90, 0xce, 0x9d, 0x93, 0xb6, 0xbb, 0x6e, 0xf9, 0xd5, 0x99, 0x3c, 0x27, 0xaf, 0xaa, 0x30, 0x4f, 0x4d, 0x47, 0xc6, 0x55, 0xac, 0xf1,
+          0xfb, 0xdc, 0xb6, 0x5a, 0xb9, 0xa2, 0x1d, 0x02, 0x94, 0xf7, 0x32, 0x7f, 0x8f, 0xa2, 0x5e, 0x11, 0x90, 0x8a, 0x39, 0x94, 0x06, 0x56, 0x1b, 0x80,
+          0x10, 0xf6, 0x3c, 0x09, 0xa1, 0x78, 0xb8, 0x4b, 0x78, 0xf4, 0x30, 0x63, 0x1f, 0x8f, 0xcc, 0x50, 0x8e, 0x35, 0x32, 0x7e, 0x56, 0xcc, 0x0d, 0x3c,
+          0xbe, 0xe2, 0x8d, 0x50, 0x1c, 0xee, 0x11, 0xdc, 0x72, 0x48, 0x7d, 0xaf, 0xb5, 0xba, 0x7d, 0x0e, 0x42, 0x90, 0x42, 0xaa, 0x07, 0x45, 0x73, 0x49,
+          0x53, 0x57, 0xbf, 0x18, 0x6b, 0xc3, 0xb2, 0x07, 0x8a, 0x91, 0x9f, 0x78, 0xf1, 0x52, 0xd9, 0x75, 0x7c, 0xc6, 0x1b, 0x89, 0x14, 0xd4, 0x33, 0x0e,
+          0x4e, 0xff, 0x86, 0x3c, 0xd8, 0x31, 0xfe, 0xc8, 0xab, 0x2e, 0x1a, 0x79, 0xb8, 0x58, 0x80, 0x31, 0x77, 0x11, 0x0c, 0x0d, 0x93, 0x35, 0x35, 0x77,
+          0x55, 0xa0, 0x2e, 0x34, 0x1b, 0x5c, 0xd8, 0x23, 0x04, 0x0d, 0xa6, 0xc0, 0x21, 0x47, 0xeb, 0xca, 0xc9, 0x7d, 0xdc, 0x9f, 0xd3, 0xe8, 0xff, 0x66,
+          0x30, 0xaa, 0xfe, 0x5b, 0x40, 0xb9, 0x92, 0x79, 0xec, 0x01, 0x81, 0x31, 0x8c, 0x72, 0xac, 0xa0, 0x74, 0x68, 0xc8, 0x19, 0x3a, 0x8b, 0x4e, 0x3d,
+          0x21, 0xa4, 0x49, 0xa5, 0x74, 0x9a, 0x19, 0xe3, 0x39, 0xa6, 0x9e, 0xd5, 0x49, 0x2c, 0xc4, 0x9c, 0x07, 0x02, 0x71, 0xb5, 0xce, 0xa3, 0x96, 0x53,
+          0x86, 0x2f, 0xa4, 0x14, 0xa2, 0xd2, 0x4f, 0x45, 0xdb, 0xb4, 0x42, 0x9c, 0x59, 0xb7, 0xb5, 0x8c, 0x6d, 0xb7, 0x3a, 0x8b, 0x65, 0x6c, 0xd8, 0x9a,
+          0x64, 0x6a, 0x7d, 0x3c, 0x37, 0xcc, 0x10, 0x57, 0x11, 0x36, 0x75, 0xcd, 0x69, 0x3c, 0xde, 0x40, 0xb9, 0x19, 0x4e, 0xef, 0xce, 0x9c, 0x8e, 0x3d,
+          0x70, 0xbc, 0xba, 0xe9, 0xc7, 0xba, 0xe1, 0x55, 0xca, 0x7d, 0x54, 0xb6, 0x3d, 0x6f, 0xf1, 0xb1, 0xb3, 0x18, 0xaf, 0xbb, 0x33, 0x81, 0x64, 0x83,
+          0x75, 0x63, 0x1c, 0x88, 0x58, 0x19, 0x31, 0x76, 0x29, 0xfd, 0x4a, 0x1f, 0x8d, 0xe0, 0x7d, 0x84, 0xe7, 0xee, 0x7e, 0xa6, 0x71, 0x36, 0x2d, 0x33,
+          0x9b, 0xc9, 0x24, 0xc4, 0x0c, 0xc5, 0x77, 0x6b, 0x7d, 0x5f, 0x79, 0x93, 0xe8, 0xb4, 0x3c, 0x33, 0x24, 0x04, 0x42, 0xf7, 0x71, 0xe1, 0xf3, 0x32,
+          0xc9, 0xb5, 0xd4, 0xe2, 0x81, 0x48, 0xb7, 0xa0, 0x58, 0xa3, 0x1e, 0x77, 0x31, 0x16, 0xd8, 0xd6, 0x4b, 0x42, 0x06, 0xd1, 0xde, 0x0c, 0x03, 0x8c,
+          0xe3, 0x05, 0x76, 0x59, 0x1a, 0x77, 0xd7, 0x7d, 0xeb, 0x4e, 0x76, 0x8b, 0xa9, 0x82, 0x6f, 0x2e, 0x02, 0xc1, 0xef, 0xec, 0x53, 0x2e, 0xae, 0x73,
+          0xf6, 0x61, 0xf9, 0xbe, 0x84, 0x9e, 0xda, 0x2f, 0x55, 0xe8, 0x75, 0x06, 0xdf, 0x8b, 0x70, 0x5a, 0x54, 0xef, 0x6e, 0x04, 0x43, 0x93, 0xd7, 0xc1,
+          0x5d, 0x39, 0xe3, 0x78, 0xa5, 0x7a, 0x9e, 0x81, 0x6d, 0xe3, 0x5b, 0xe6, 0x09, 0xcf, 0x34, 0x67, 0x62, 0x8c, 0x3e, 0x2b, 0xc8, 0xb8, 0x3d, 0x1d,
+          0xbc, 0x6b, 0x46, 0x95, 0x0f, 0x10, 0x3f, 0x80, 0xa8, 0xce, 0xd5, 0x15, 0xfa, 0x22, 0x7b, 0xbb, 0x56, 0x9c, 0xac, 0x56, 0xc8, 0xed, 0xe8, 0xb9,
+          0x79, 0x2e, 0x51, 0xc3, 0xe7, 0xac, 0x0c, 0xbb, 0x38, 0x0c, 0xa4, 0xef, 0xf9, 0x95, 0x89, 0x41, 0x52, 0xe0, 0x29, 0x55, 0xcf, 0xac, 0xa5, 0x86,
+          0x2d, 0x0e, 0x6d, 0x2a, 0x97, 0x33, 0x16, 0x72, 0xac, 0x69, 0xa1, 0x0a, 0xad, 0x34, 0x64, 0x06, 0x03, 0x2c, 0x68, 0x31, 0xd9, 0xad, 0x3b, 0x0b,
+          0x17, 0x75, 0xb7, 0x8d, 0xbb, 0xbd, 0x34, 0xfe, 0xf4, 0xca, 0x95, 0x04, 0x72, 0xc6, 0x02, 0xa8, 0xcb, 0x0c, 0x61, 0x6e, 0x06, 0x8f, 0x46, 0xd1,
+          0xc0, 0x90, 0xea, 0x32, 0x92, 0x2d, 0xd4, 0xe2, 0xf2, 0xc8, 0x7e, 0x50, 0x4d, 0x3a, 0xdb, 0xc6, 0xe1, 0x3b, 0xa2, 0x1d, 0x1d, 0x81, 0xb8, 0xb6,
+          0x20, 0x35, 0xce, 0x38, 0x09, 0xb6, 0xac, 0x17, 0xa3, 0x2c, 0xc0, 0xe5, 0x4d, 0x3b, 0x7a, 0x71, 0x9a, 0xd5, 0xa3, 0xa6, 0x3a, 0x58, 0x1e, 0xfb,
+          0xc0, 0xe0, 0x37, 0xd5, 0xda, 0xbd, 0xa4, 0x46, 0xc7, 0xbe, 0xf7, 0x53, 0x5f, 0x4e, 0xe2, 0xac, 0x17, 0xdf, 0x96, 0x7b, 0x73, 0x3b, 0x99, 0xde,
+          0x16, 0x54, 0xbc, 0xe5, 0x33, 0x32, 0xf3, 0x43, 0xb6, 0x6d, 0x69, 0xbf, 0xf0, 0xd7, 0x14, 0x3b, 0xd2, 0x1d, 0x09, 0x89, 0xc4, 0x04, 0xa0, 0x5f,
+          0xcb, 0xf5, 0x63, 0x92, 0x50, 0xa3, 0x4c, 0xec, 0x52, 0x72, 0x1a, 0x57, 0xda, 0xce, 0x9d, 0x10, 0xb5, 0x3f, 0x2b, 0x4e, 0x3c, 0x6d, 0x94, 0x9a,
+          0x2e, 0x29, 0x09, 0x06, 0x96, 0x5f, 0x0a, 0xb5, 0xbe, 0x90, 0x66, 0x94, 0x99, 0x98, 0x2f, 0x89, 0x28, 0xf1, 0xed, 0x61, 0xf6, 0xeb, 0x0c, 0x6a,
+          0xb6, 0xf1, 0x32, 0xb1, 0xf1, 0x6e, 0x23, 0xf2, 0x0d, 0x12, 0xb1, 0x60, 0x96, 0x9e, 0x6b, 0x41, 0x33, 0x5e, 0xc9, 0x94, 0xd5, 0xd1, 0xe5, 0x79,
+          0x7b, 0x11, 0x6d, 0x06, 0xe6, 0xd5, 0x68, 0xb2, 0x6e, 0x9a, 0xfc, 0x7c, 0xbd, 0x52, 0xe0, 0x45, 0xcb, 0xc9, 0x65, 0x69, 0x7a, 0x74, 0xb2, 0x62,
+          0xec, 0x37, 0x51, 0xad, 0x2b, 0x16, 0xc6, 0x67, 0x1e, 0xeb, 0xa8, 0x0f, 0xc1, 0xcb, 0xfe, 0xdf, 0xf3, 0x87, 0x42, 0xe6, 0x66, 0x76, 0xdc, 0x64,
+          0x76, 0x4f, 0xa3, 0x1f, 0x63, 0x6a, 0x16, 0xe5, 0x0a, 0xc6, 0x06, 0xda, 0x11, 0xcc, 0xd2, 0x8c, 0x38, 0xcd, 0xec, 0xa1, 0xb2, 0xb2, 0x52, 0xd7,
+          0x13, 0x60, 0x43, 0xb0, 0x97, 0xa8, 0x23, 0x00, 0xfb, 0x0b, 0x1b, 0xba, 0xc6, 0xb1, 0x3b, 0x9e, 0xf5, 0xef, 0xe6, 0xf4, 0xc2, 0xf0, 0xc8, 0xd3,
+          0x74, 0x6f, 0x04, 0xe8, 0xa5, 0xe3, 0xf8, 0x1e, 0x29, 0xab, 0xc6, 0xa7, 0x26, 0xb5, 0xea, 0x1f, 0x17, 0x50, 0x10, 0x51, 0x29, 0x11, 0x06, 0x80,
+          0x0d, 0xa4, 0x88, 0xb0, 0x9b, 0xf0, 0x09, 0x48, 0xe5, 0x1d, 0x8b, 0x3b, 0x7d, 0x3b, 0xcf, 0xff, 0xf8, 0xd0, 0x36, 0x96, 0x9d, 0xca, 0x7e, 0x72,
+          0xdd, 0x04, 0x69, 0x06, 0xc5, 0xe3, 0xd2, 0x17, 0xd0, 0x9c, 0x6e, 0xc6, 0x61, 0x12, 0x8f, 0x0d, 0x75, 0x7e, 0xe6, 0x95, 0x35, 0xd4, 0x62, 0x74,
+          0x01, 0xde, 0xf5, 0x05, 0x87, 0x81, 0x7b, 0xb5, 0x2c, 0x4e, 0x6c, 0xff, 0xb1, 0xff, 0x01, 0xfa, 0xd1, 0xa5, 0x49, 0x0c, 0xce, 0x88, 0x69, 0x4f,
+          0x8b, 0x53, 0x71, 0x22, 0x15, 0x89, 0xc0, 0x0e, 0x08, 0x97, 0xc2, 0xb4, 0x15, 0xa3, 0x12, 0xd9, 0x36, 0xd9, 0x60, 0x0e, 0xcb, 0x10, 0x9a, 0x88,
+          0xf9, 0xc5, 0x00, 0x33, 0x0a, 0x0d, 0x11, 0xf0, 0xea, 0xbc, 0x0e, 0x1a, 0x64, 0xdb, 0xf2, 0xc2, 0x77, 0x4f, 0x93, 0x64, 0xd7, 0xc5, 0x42, 0x16,
+          0xfd, 0xa9, 0xe9, 0xd7, 0x47, 0x5f, 0x84, 0x95, 0xfc, 0xba, 0x70, 0xbf, 0xa3, 0x06, 0x20, 0xcb, 0xfa, 0x2a, 0x7a, 0x26, 0x00, 0x43, 0xdd, 0x0b,
+          0x43, 0x6e, 0x5a, 0x79, 0x37, 0x67, 0xd7, 0x24, 0xba, 0xda, 0x1a, 0x95, 0x6a, 0xe2, 0x85, 0x0b, 0x30, 0x16, 0x32, 0xa0, 0x07, 0xec, 0x5e, 0xe4,
+          0x20, 0xab, 0xaf, 0x4e, 0xdf, 0xa3, 0x82, 0x3b, 0xd4, 0x14, 0xd5, 0xff, 0xaf, 0x7c, 0xff, 0xdc, 0x80, 0xf2, 0x22, 0x55, 0xd9, 0xbe, 0x61, 0x82,
+          0x1b, 0x1b, 0xf6, 0x4d, 0xd8, 0x77, 0x6f, 0x8d, 0x70, 0x75, 0xd0, 0xd7, 0x60, 0x3f, 0xaa, 0x68, 0x8b, 0x4e, 0xb3, 0x0b, 0xbf, 0xc5, 0x91, 0x46,
+          0x07, 0x7f, 0x0d, 0x3c, 0xd5, 0x7f, 0x4e, 0xfc, 0xed, 0xf1, 0x4b, 0x0a, 0x1c, 0xca, 0x2f, 0x44, 0x22, 0x45, 0x07, 0x7c, 0x59, 0xbc, 0xc6, 0x0b,
+          0x39, 0xe1, 0xde, 0x12, 0xb7, 0x11, 0x42, 0xde, 0x90, 0xae, 0x38, 0x8a, 0x1c, 0xf9, 0xaa, 0x3d, 0x79, 0x76, 0xb6, 0xee, 0xc8, 0x05, 0x9f, 0x4e,
+          0xdc, 0xd2, 0xb9, 0x4d, 0x13, 0x7d, 0xd0, 0x00, 0x1f, 0x38, 0x56, 0x81, 0x37, 0x30, 0x53, 0xdc, 0x1f, 0x47, 0x60, 0x4d, 0xa1, 0x20, 0x60, 0x7d,
+          0x22, 0x3e, 0xe2, 0x64, 0xb6, 0x9c, 0xe1, 0xea, 0xce, 0xe5, 0x75, 0xde, 0x86, 0x1f, 0xf1, 0x88, 0xc1, 0xdc, 0x1b, 0x01, 0xa9, 0x44, 0x17, 0x15,
+          0x4d, 0x3f, 0x6e, 0x2d, 0x70, 0x0d, 0x07, 0xe9, 0x42, 0xf8, 0x8f, 0xe2, 0xdd, 0x06, 0x49, 0x7b, 0x4c, 0xa0, 0x04, 0x71, 0xb6, 0x40, 0xe8, 0x9b,
+          0x5d, 0x64, 0xe9, 0xf3, 0x3b, 0xc8, 0xff, 0x75, 0xbf, 0x48, 0x0d, 0xb2, 0x5c, 0xf8, 0xf2, 0xf4, 0xb7, 0xdf, 0x7e, 0xb7, 0x78, 0xc8, 0x33, 0x04,
+          0xf2, 0x5a, 0x69, 0x72, 0xa4, 0xdf, 0xc6, 0x54, 0xf1, 0xfb, 0x35, 0xf8, 0x4d, 0x7e, 0xe6, 0x83, 0x5e, 0x26, 0x2f, 0x47, 0x9f, 0x6e, 0xff, 0x72,
+          0x45, 0x55, 0xfd, 0x94, 0x62, 0x68, 0x33, 0xc2, 0xe0, 0x4b, 0x19, 0xd8, 0x92, 0x75, 0x27, 0xf7, 0x4b, 0x3d, 0x15, 0x5c, 0x1f, 0x6c, 0x7c, 0x6a,
+          0x1d, 0xc2, 0xfb, 0x40, 0x46, 0x87, 0x9b, 0x54, 0xb6, 0x6f, 0xbc, 0x5d, 0x11, 0x2e, 0x77, 0x51, 0xce, 0x5e, 0xc5, 0x8a, 0xc5, 0x87, 0x52, 0x2b,
+          0x29, 0x64, 0x50, 0x88, 0x5a, 0x44, 0xfc, 0x57, 0x2e, 0x04, 0xfa, 0x65, 0xe6, 0x6e, 0x81, 0x6c, 0x39, 0xfe, 0x02, 0x38, 0xf8, 0xc1, 0x70, 0x2c,
+          0xd7, 0x67, 0x1b, 0x5e, 0xd2, 0x9c, 0x9f, 0xad, 0x4a, 0x9d, 0xfb, 0xf3, 0x76, 0x37, 0xbb, 0x04, 0xa8, 0x05, 0xdb, 0x94, 0xbe, 0x14, 0xe0, 0x2d,
+          0xed, 0x25, 0x01, 0x42, 0x34, 0xea, 0x31, 0x59, 0x16, 0xf4, 0x5c, 0x7c, 0x1e, 0x7a, 0x4a, 0x66, 0xeb, 0x4c, 0xe9, 0xfd, 0x16, 0x50, 0x56, 0xd4,
+          0x96, 0xc0, 0x79, 0x40, 0x17, 0x18, 0xf2, 0xee, 0xdd, 0x6e, 0x17, 0xe8, 0x85, 0x08, 0x3b, 0x7c, 0xe9, 0x6b, 0xf3, 0xf5, 0x95, 0xc0, 0x0a, 0x18,
+          0xc7, 0x27, 0x7a, 0x5c, 0x76, 0x28, 0xe4, 0xbf, 0x6c, 0xcc, 0x3f, 0xe3, 0x20, 0x12, 0xd0, 0x48, 0x7d, 0xaf, 0xa2, 0xfc, 0x52, 0x21, 0xc9, 0xd0,
+          0x07, 0xef, 0x1d, 0x44, 0xfe, 0x4a, 0x26, 0xaa, 0x52, 0x2e, 0x34, 0xdc, 0xb0, 0x41, 0x93, 0x8d, 0x81, 0x49, 0x46, 0x34, 0xf2, 0x9e, 0x22, 0x0b,
+          0x5c, 0x72, 0x7e, 0xb3, 0x66, 0x5c, 0x55, 0x66, 0x2d, 0x15, 0x13, 0xe1, 0x4e, 0x1e, 0x27, 0xae, 0x3a, 0x61, 0x35, 0xbc, 0x36, 0x79, 0xa4, 0x16,
+          0xd9, 0xca, 0x9d, 0x20, 0xac, 0x17, 0x19, 0x84, 0xf8, 0x93, 0xa5, 0x4c, 0xc1, 0xb7, 0x02, 0x2b, 0x52, 0x59, 0x13, 0x56, 0xf7, 0x2a, 0xdb, 0xca,
+          0x22, 0x7d, 0x13, 0x31, 0x62, 0x34, 0xa0, 0x8a, 0x67, 0x34, 0x1b, 0x42, 0xe5, 0xce, 0x4a, 0x68, 0x4e, 0x8b, 0x4d, 0x16, 0x46, 0x1f, 0xaa, 0x2d,
+          0x09, 0x0a, 0xff, 0xd7, 0x39, 0x3c, 0x71, 0x56, 0x61, 0x54, 0xc5, 0xfb, 0x60, 0x3b, 0x51, 0xa9, 0x22, 0x4d, 0xbc, 0xc5, 0xc3, 0x46, 0x86, 0x35,
+          0xdc, 0xa4, 0xa7, 0x11, 0xa9, 0xe5, 0x04, 0x84, 0xc2, 0x4e, 0x1b, 0x8a, 0xe3, 0xb7, 0xda, 0xa3, 0xba, 0x92, 0x2b, 0x6a, 0x11, 0xbb, 0x1d, 0x71,
+          0x04, 0x2a, 0x9b, 0x92, 0x28, 0x68, 0xe1, 0xb5, 0xcd, 0x1a, 0x8c, 0x54, 0xb0, 0x7b, 0x0c, 0xe8, 0xc6, 0x2d, 0x3b, 0x18, 0x36, 0xe2, 0xa2, 0x78,
+          0x80, 0x62, 0xb4, 0x56, 0x6a, 0x61, 0x09, 0x64, 0x94, 0x20, 0xd7, 0x8a, 0x57, 0x89, 0xbd, 0x6b, 0x0c, 0x69, 0xdf, 0x7c, 0xcd, 0x11, 0x82, 0x19,
+          0xb8, 0x73, 0x36, 0x06, 0x5b, 0x15, 0x33, 0x7a, 0xe0, 0x8a, 0x15, 0xa6, 0xb0, 0xc6, 0x3c, 0x19, 0x15, 0x37, 0x63, 0xc8, 0xb2, 0x8b, 0x0c, 0xa5,
+          0xde, 0xf7, 0x3d, 0x46, 0xf6, 0xf1, 0xd1, 0xcc, 0x2b, 0x26, 0x14, 0x55, 0xb9, 0x22, 0x2d, 0x4d, 0xa4, 0xd2, 0x82, 0xb9, 0x54, 0xb9, 0x65, 0xa0,
+          0xb1, 0x50, 0xa1, 0xc6, 0x6d, 0x37, 0xeb, 0xd3, 0x3e, 0xf8, 0x41, 0x19, 0x7c, 0xbe, 0xf5, 0x5a, 0x78, 0x81, 0xeb, 0xa8, 0x9d, 0x49, 0x67, 0x5a,
+          0x67, 0x3e, 0x18, 0x74, 0xa5, 0x43, 0x6c, 0xa1, 0xc7, 0xc8, 0xe7, 0x3e, 0x40, 0xb9, 0x29, 0xe4, 0xe1, 0x26, 0x38, 0x2e, 0x74, 0x40, 0x4d, 0x51,
+          0x93, 0xb6, 0x3b, 0x3a, 0x90, 0xfd, 0x7b, 0xe5, 0xda, 0x09, 0xfb, 0x21, 0xcd, 0x58, 0x2a, 0xbd, 0xdb, 0x43, 0xeb, 0x35, 0x88, 0xa1, 0xaf, 0x10,
+          0xe8, 0xd9, 0x84, 0x89, 0xf8, 0xc8, 0xb9, 0x73, 0x50, 0x6c, 0xc9, 0xcf, 0xe0, 0xdc, 0xd7, 0x98, 0x77, 0x9b, 0xdb, 0x30, 0xdd, 0x41, 0x71, 0x24,
+          0xf7, 0x4e, 0x38, 0xa4, 0xa1, 0xd6, 0xa1, 0x16, 0x45, 0xfd, 0x0b, 0xce, 0x70, 0x14, 0x53, 0x87, 0x45, 0x54, 0xc4, 0xa8, 0x96, 0xb4, 0x40, 0x5f,
+          0xd1, 0x05, 0x1f, 0x27, 0x2a, 0xd7, 0x85, 0x81, 0x80, 0x75, 0x8e, 0xb2, 0xcb, 0xdf, 0x8c, 0xda, 0x38, 0x43, 0x46, 0xe4, 0xdc, 0x60, 0x12, 0x64,
+          0x9e, 0x62, 0x78, 0x42, 0x15, 0x99, 0xff, 0x38, 0x9c, 0xb0, 0x5d, 0x5c, 0x70, 0xc7, 0x3e, 0x2a, 0xc3, 0x1c, 0x41, 0xd9, 0xa0, 0xf4, 0xb4, 0xeb,
+          0xe8, 0xb3, 0x74, 0x17, 0x44, 0xea, 0xa0, 0x4f, 0x45, 0x3a, 0x8a, 0x09, 0x3f, 0xe4, 0x05, 0x1b, 0xfd, 0x67, 0x86, 0x1c, 0x82, 0x40, 0x04, 0x25,
+          0xc8, 0x69, 0xc1, 0x28, 0x3e, 0x54, 0x89, 0xe8, 0x27, 0x13, 0xf6, 0x12, 0x60, 0x7c, 0x48, 0xd6, 0x28, 0xe9, 0x59, 0xd4, 0x4b, 0x04, 0xb5, 0x11,
+          0x93, 0xc2, 0xb5, 0x6b, 0x61, 0x5e, 0x64, 0x1e, 0x48, 0x95, 0x1b, 0xce, 0xd8, 0x80, 0xab, 0xb6, 0xa0, 0xb5, 0x96, 0xa1, 0x10, 0x5b, 0xa3, 0x14,
+          0x22, 0x2b, 0xa8, 0x59, 0x0e, 0x8e, 0x6a, 0x70, 0x79, 0x6f, 0xa2, 0xea, 0x97, 0xd9, 0xbd, 0x40, 0xbb, 0xd2, 0x50, 0x0d, 0x03, 0xb5, 0x10, 0x16,
+          0xf5, 0x71, 0x8d, 0x5e, 0x94, 0x52, 0x01, 0x8f, 0x18, 0x40, 0x27, 0x5a, 0xd4, 0x42, 0x00, 0x4d, 0x19, 0x48, 0x62, 0xef, 0xf0, 0x60, 0xc2, 0x8c,
+          0x4b, 0x21, 0x50, 0xbd, 0x88, 0x1f, 0x8f, 0xc3, 0xca, 0x33, 0x2f, 0x16, 0xf3, 0x5f, 0xcc, 0x0e, 0x03, 0x6c, 0x76, 0x67, 0x19, 0x3d, 0xd1, 0xe0,
+          0xd4, 0x55, 0x4e, 0x1f, 0x66, 0xd8, 0xfd, 0xa3, 0x19, 0x0c, 0x04, 0x5d, 0x13, 0x6d, 0x98, 0x3a, 0xe8, 0xbd, 0xa6, 0x68, 0x5e, 0xb9, 0x7a, 0x17,
+          0x81, 0xdc, 0xf1, 0xee, 0xc3, 0xe6, 0xfc, 0xd3, 0xbd, 0xf4, 0x32, 0x69, 0x16, 0x56, 0xba, 0x54, 0x99, 0xe7, 0x1b, 0xa7, 0x80, 0x9d, 0x3c, 0x60,
+          0xe4, 0x44, 0xd4, 0xc6, 0xa5, 0xa6, 0x21, 0x6b, 0xce, 0xa9, 0x5b, 0x40, 0xb4, 0xd6, 0x4e, 0x93, 0xd3, 0x82, 0x46, 0x3f, 0x39, 0x7a, 0xf1, 0x15,
+          0x19, 0x98, 0x23, 0x00, 0xa1, 0x02, 0xb7, 0x1b, 0x0d, 0x88, 0xd1, 0x67, 0xc7, 0xe1, 0xdb, 0x86, 0xeb, 0x4c, 0x34, 0xfd, 0xa1, 0x8f, 0x11, 0x4e,
+          0x87, 0xc9, 0x1f, 0x45, 0xe0, 0x9c, 0x20, 0x0d, 0xea, 0xa9, 0x47, 0xfb, 0xd5, 0xe0, 0xf1, 0xa7, 0x3e, 0x2b, 0x4b, 0x1f, 0x9c, 0x17, 0xe5, 0x8c,
+          0xbb, 0xee, 0xbb, 0x6c, 0xde, 0x66, 0x8f, 0x06, 0xf9, 0x29, 0x7b, 0x97, 0xcc, 0xd9, 0x7e, 0x4c, 0x88, 0xc3, 0xe6, 0x20, 0x14, 0xe4, 0x5d, 0xe6,
+          0xd0, 0x14, 0xe4, 0x5b, 0x09, 0x53, 0xc8, 0xf4, 0xc4, 0x0d, 0x29, 0x91, 0xc8, 0xcf, 0xcf, 0xee, 0x25, 0xc8, 0x41, 0xb6, 0xc6, 0x40, 0xac, 0x95,
+          0x64, 0x93, 0xde, 0x43, 0x11, 0x02, 0xa7, 0x6b, 0x3f, 0x94, 0xcb, 0x7b, 0xf2, 0x65, 0xee, 0xc6, 0x38, 0x3d, 0x58, 0xfe, 0xa8, 0xe9, 0x1e, 0x34,
+          0xec, 0x0c, 0xca, 0x35, 0x88, 0x82, 0x73, 0x75, 0xc2, 0x9b, 0x55, 0x3f, 0x7e, 0xab, 0x7d, 0xe6, 0x59, 0x4a, 0xe0, 0xc3, 0x24, 0xb3, 0x30, 0x33,
+          0x2e, 0x20, 0xcc, 0xb7, 0x11, 0x0a, 0x64, 0x18, 0xbb, 0x1f, 0xf7, 0x3d, 0xcf, 0xc8, 0x7a, 0x17, 0xb6, 0x16, 0x1b, 0x8d, 0xea, 0xcc, 0xc8, 0xec,
+          0x6b, 0x2e, 0x08, 0x0b, 0x44, 0x1e, 0x89, 0xb8, 0x02, 0x63, 0xbf, 0xab, 0xcc, 0x1f, 0x14, 0x74, 0x22, 0xb1, 0x6b, 0x8f, 0x36, 0xc9, 0x54, 0xee,
+          0x1f, 0x54, 0x1e, 0xd8, 0xa8, 0x7c, 0x8d, 0xbd, 0xa7, 0x37, 0xab, 0xbe, 0x87, 0xb0, 0x04, 0x11, 0xa2, 0x50, 0x20, 0x48, 0x4f, 0x32, 0x65, 0xd8,
+          0x80, 0x31, 0x94, 0x37, 0xa2, 0xd4, 0x6a, 0xa6, 0x1c, 0xfd, 0x66, 0x04, 0x13, 0x3f, 0x33, 0x87, 0xad, 0x06, 0x47, 0x49, 0xb6, 0x4c, 0xe5, 0xc7,
+          0xbd, 0x61, 0x89, 0x45, 0x95, 0xcb, 0x3a, 0xad, 0xe0, 0x17, 0xb7, 0x64, 0xb4, 0x4b, 0x47, 0xcc, 0x6a, 0xd2, 0xfb, 0x95, 0xe9, 0xc6, 0x14, 0x68,
+          0x5a, 0x0f, 0x7e, 0x5d, 0x35, 0x9c, 0xca, 0x1b, 0xa5, 0x28, 0x58, 0x00, 0x9d, 0xa7, 0x51, 0x32, 0x83, 0x75, 0x43, 0x29, 0xdd, 0xdc, 0xf8, 0x0c,
+          0x36, 0x07, 0x7b, 0x16, 0xda, 0x84, 0x5d, 0xce, 0x1c, 0x56, 0x68, 0x93, 0x02, 0x63, 0xf8, 0x96, 0xd8, 0xe2, 0x72, 0xcd, 0xa9, 0x36, 0xb5, 0x53,
+          0x09, 0xeb, 0x76, 0x05, 0x73, 0x4f, 0xb6, 0xa6, 0xe5, 0x32, 0x75, 0xc8, 0x07, 0x86, 0x9a, 0xb5, 0x3c, 0x6d, 0xd8, 0x58, 0xa6, 0x6a, 0xa5, 0x94,
+          0x25, 0x40, 0xc3, 0xee, 0x20, 0x3d, 0x16, 0xd4, 0xc2, 0x82, 0x01, 0x12, 0x34, 0x86, 0x47, 0xba, 0xc0, 0x96, 0x78, 0x34, 0x65, 0x67, 0x9f, 0x9d,
+          0x1b, 0x7c, 0x06, 0xad, 0x05, 0xfc, 0xdb, 0x22, 0xfa, 0x38, 0x32, 0x00, 0xa3, 0x82, 0x76, 0x2e, 0x9f, 0xc3, 0x5b, 0x53, 0xf9, 0xd3, 0x1e, 0x01,
+          0x5b, 0x78, 0x0f, 0xd3, 0x15, 0x96, 0x42, 0xbc, 0x91, 0xcd, 0xac, 0x3f, 0x1c, 0x34, 0x85, 0x03, 0xbb, 0x33, 0xf7, 0xad, 0x2c, 0x44, 0x23, 0x3f,
+          0x63, 0x4b, 0xc3, 0x9c, 0xe6, 0xf6, 0x2e, 0xac, 0x3e, 0x87, 0x6e, 0xfc, 0x59, 0x71, 0xa6, 0x4e, 0x73, 0x9c, 0xe0, 0xc8, 0xbc, 0x39, 0x78, 0x3c,
+          0x19, 0xaf, 0x39, 0x8e, 0x00, 0x78, 0x57, 0xf4, 0xa7, 0xbe, 0x28, 0xa9, 0x6f, 0x74, 0x13, 0x8b, 0x45, 0xca, 0x2c, 0x37, 0xc8, 0x7a, 0xab, 0x0a,
+          0x9e, 0x14, 0xf4, 0x34, 0x69, 0xbd, 0xb0, 0x1f, 0x89, 0xc1, 0x53, 0x42, 0x9b, 0x35, 0x20, 0x18, 0x55, 0x79, 0x91, 0x07, 0x5f, 0x30, 0x29, 0x69,
+          0x88, 0x56, 0x40, 0xfc, 0x7c, 0xf9, 0x7e, 0x7c, 0x1c, 0x68, 0x8f, 0xd5, 0x0e, 0x15, 0xad, 0x62, 0x66, 0xbe, 0xdf, 0x76, 0xe8, 0x52, 0x03, 0x6c,
+          0xd0, 0x73, 0x6a, 0x6f, 0xf9, 0x35, 0x36, 0xb0, 0xad, 0x9d, 0xa4, 0x09, 0x0a, 0x13, 0x7d, 0x2f, 0x89, 0x45, 0x80, 0xf3, 0xf5, 0x37, 0x42, 0xbf,
+          0x14, 0x95, 0xc0, 0x50, 0x92, 0x17, 0x34, 0xb3, 0x64, 0x66, 0x6e, 0xbb, 0xda, 0xda, 0x49, 0x4a, 0x12, 0x76, 0x25, 0xa8, 0xb9, 0xbc, 0x51, 0x4d,
+          0x93, 0xb5, 0x85, 0xc4, 0xc0, 0x9a, 0xec, 0xd5, 0x2f, 0x9a, 0xae, 0x35, 0x2e, 0xa8, 0x24, 0xcb, 0x42, 0x4a, 0xda, 0x61, 0x3b, 0xd0, 0x80, 0x1f,
+          0xd1, 0xc8, 0xa3, 0xe0, 0x0e, 0x63, 0x8b, 0x22, 0x36, 0x32, 0x70, 0xce, 0x35, 0x99, 0x25, 0xf1, 0x11, 0x79, 0xeb, 0xe5, 0x30, 0xfe, 0x21, 0x08,
+          0xff, 0x2e, 0x27, 0xe2, 0xc5, 0x15, 0x1d, 0xd4, 0x80, 0xb3, 0x79, 0x5e, 0xc5, 0x82, 0x9c, 0x2b, 0xf3, 0xca, 0xfb, 0x41, 0x0d, 0x28, 0x24, 0x54,
+          0x71, 0xb7, 0x89, 0x6b, 0x37, 0x81, 0x0e, 0xf1, 0x9c, 0xbf, 0xb4, 0xb2, 0xc3, 0x19, 0x5d, 0x8a, 0xdd, 0xe0, 0x94, 0xd1, 0xd3, 0xe3, 0x10, 0x80,
+          0xfd, 0xc3, 0xcb, 0xae, 0xfc, 0xaf, 0x8b, 0xce, 0x51, 0x0a, 0xf2, 0xbd, 0xed, 0x92, 0x7a, 0xaa, 0x02, 0xe1, 0x0e, 0x6f, 0x9a, 0xa9, 0xa3, 0xa6,
+          0x3c, 0xd7, 0xdd, 0x70, 0xa9, 0xa6, 0xdf, 0x07, 0x45, 0xcc, 0x83, 0x3c, 0xfb, 0xb0, 0x35, 0x9b, 0x4d, 0x10, 0xb8, 0x25, 0x5e, 0x07, 0x2a, 0xea,
+          0x1e, 0xba, 0xec, 0x04, 0x76, 0x70, 0x66, 0xae, 0x0f, 0xad, 0xe9, 0xa3, 0x5b, 0x93, 0x63, 0xd5, 0xf4, 0x8a, 0x15, 0x00, 0x24, 0x3b, 0x4b, 0x08,
+          0xee, 0xd9, 0x61, 0x4f, 0x83, 0xd0, 0x35, 0x0b, 0x5d, 0x2e, 0xf4, 0x2d, 0xdb, 0xb5, 0xc2, 0x59, 0x3a, 0xb0, 0x54, 0x78, 0x3b, 0x3a, 0xc9, 0x4c,
+          0xb5, 0xb3, 0xb0, 0x73, 0x7f, 0x4c, 0x43, 0x5f, 0x6b, 0x0c, 0x3a, 0xe8, 0xe0, 0x17, 0x90, 0xa5, 0xd0, 0x7f, 0x55, 0x49, 0xec, 0xca, 0x44, 0x4c,
+          0xbf, 0x66, 0x8c, 0x45, 0x02, 0x75, 0xa2, 0x87, 0x20, 0x34, 0xa6, 0x34, 0x21, 0xb6, 0xf8, 0x3c, 0xac, 0xe6, 0xfe, 0x97, 0x4a, 0x74, 0x38, 0x11,
+          0x01, 0x1c, 0x16, 0xd5, 0xea, 0xe5, 0xeb, 0xc6, 0xc2, 0x09, 0x0a, 0x1b, 0x9d, 0x17, 0xf4, 0xa1, 0x15, 0x92, 0xdb, 0xdb, 0xda, 0x2a, 0xc6, 0x17,
+          0x61, 0x34, 0x12, 0x1d, 0xe7, 0x4f, 0x49, 0x86, 0xa0, 0xa9, 0x9d, 0xa6, 0xed, 0x68, 0xfa, 0xda, 0xe1, 0x61, 0x27, 0x7f, 0x8d, 0x73, 0xc0, 0xf4,
+          0xe7, 0x8e, 0x3e, 0x19, 0x10, 0x96, 0x9b, 0x74, 0x49, 0xe0, 0x8b, 0xaf, 0x92, 0x3d, 0x61, 0xe1, 0xf1, 0xa8, 0x3b, 0x71, 0x90, 0x07, 0x9a, 0xc7,
+          0x58, 0x6d, 0x9c, 0xd4, 0xe7, 0xe9, 0x7f, 0xff, 0x14, 0xc7, 0xf0, 0xce, 0x36, 0xb8, 0x41, 0xb2, 0x17, 0x0c, 0x92, 0xd9, 0xc0, 0xad, 0x72, 0x7b,
+          0x13, 0xb1, 0x0f, 0xaa, 0x85, 0x82, 0x5f, 0x46, 0xa6, 0x26, 0xec, 0x89, 0x4b, 0x14, 0xa6, 0xda, 0xf4, 0x9d, 0xd9, 0x8c, 0x09, 0x20, 0x47, 0x90,
+          0x4c, 0x6a, 0x91, 0xe4, 0x58, 0xdb, 0x00, 0xeb, 0x35, 0xc2, 0x20, 0x5d, 0xcb, 0xfc, 0xae, 0x45, 0xd6, 0xae, 0x17, 0xe5, 0xfb, 0x27, 0x9c, 0xb7,
+          0x96, 0x3c, 0x88, 0xd0, 0x59, 0xcc, 0x15, 0x83, 0x2c, 0xbc, 0x7e, 0x04, 0x30, 0x8c, 0xe3, 0x1f, 0xf7, 0x7f, 0x61, 0xf9, 0x97, 0x41, 0xc7, 0xa0,
+          0x25, 0x29, 0xee, 0x49, 0xb3, 0xa6, 0x24, 0x97, 0x5d, 0x29, 0x72, 0x92, 0xde, 0xc7, 0x57, 0xc1, 0x2c, 0xd3, 0x4a, 0xc9, 0x22, 0x16, 0x0c, 0xa8,
+          0x96, 0x54, 0xa1, 0xb6, 0x31, 0xc9, 0x34, 0x42, 0x39, 0x04, 0x95, 0xd8, 0x94, 0xb1, 0x28, 0x76, 0x86, 0xb1, 0x8b, 0x04, 0xe0, 0x0d, 0x29, 0x52,
+          0x00, 0xbf, 0x71, 0x5e, 0xa2, 0xf9, 0x34, 0x84, 0x00, 0x3c, 0xa0, 0x5c, 0x70, 0x39, 0x46, 0xbe, 0xbb, 0xa9, 0x5d, 0xeb, 0x8e, 0x63, 0x63, 0x2b,
+          0x62, 0x00, 0xe6, 0xf8, 0xd9, 0xb2, 0x24, 0x85, 0x23, 0xd9, 0x38, 0xbc, 0x2d, 0xae, 0x3e, 0x8b, 0x00, 0x9d, 0x9d, 0xd0, 0xbf, 0xc3, 0xac, 0xab,
+          0xa3, 0x08, 0x99, 0x2f, 0x9b, 0xd5, 0xc6, 0xb5, 0x33, 0x0b, 0x1c, 0x3b, 0x73, 0xe3, 0x6f, 0xbf, 0x96, 0x12, 0x76, 0xe5, 0x41, 0xa7, 0x03, 0x89,
+          0xe8, 0xdc, 0xaf, 0x4e, 0x51, 0x63, 0x2a, 0xf7, 0x7f, 0x4d, 0xc5, 0xca, 0x34, 0x2c, 0xa8, 0xa5, 0x97, 0xac, 0x08, 0xde, 0xf5, 0xb4, 0x07, 0x28,
+          0x19, 0x98, 0xf0, 0x45, 0x18, 0xb4, 0x1b, 0x35, 0xfd, 0x60, 0x45, 0x8c, 0x45, 0xd9, 0x5d, 0x0b, 0x60, 0x96, 0x8e, 0x49, 0x7d, 0x55, 0x44, 0x8b,
+          0x64, 0xcc, 0xf6, 0x93, 0x9f, 0xa6, 0x27, 0xef, 0xf9, 0x91, 0xe1, 0xc4, 0xe9, 0xe1, 0x6c, 0x80, 0xc7, 0x0c, 0xb0, 0x09, 0x66, 0xde, 0x48, 0x7f,
+          0xf5, 0xf1, 0x3c, 0xed, 0xb6, 0xc1, 0x47, 0xbe, 0xa5, 0x80, 0xc2, 0x25, 0x5b, 0x33, 0x6b, 0x76, 0xd3, 0x0c, 0x44, 0x51, 0x62, 0xbc, 0x3a, 0xa2,
+          0xd2, 0xa7, 0x2a, 0xa7, 0x9c, 0x69, 0xb6, 0xe6, 0xe6, 0xca, 0x89, 0xd5, 0x73, 0x65, 0x81, 0x2b, 0x37, 0x8d, 0x3a, 0x44, 0x44, 0x4a, 0x3f, 0x06,
+          0xe4, 0xf8, 0xc1, 0x3f, 0xc4, 0x4b, 0x16, 0xce, 0xa4, 0x51, 0xca, 0x79, 0x6e, 0xa0, 0x3f, 0x22, 0x10, 0xa7, 0x66, 0x68, 0x99, 0x28, 0x6a, 0x8f,
+          0x82, 0xf2, 0x8e, 0x1a, 0x5a, 0xd5, 0x28, 0x36, 0x7f, 0x46, 0xa2, 0x99, 0x79, 0x83, 0x4a, 0x36, 0xec, 0xc8, 0xed, 0xdc, 0x2a, 0xa9, 0xf3, 0xac,
+          0x66, 0xf1, 0xb2, 0x79, 0x30, 0x30, 0xd6, 0x16, 0xb5, 0x32, 0x63, 0x07, 0x4d, 0x6b, 0xa6, 0x9c, 0xc6, 0xb2, 0x35, 0xc5, 0x91, 0xe6, 0x42, 0xd5,
+          0x41, 0x75, 0xb3, 0x57, 0x69, 0x77, 0x51, 0x65, 0xcb, 0x01, 0x22, 0xef, 0xa5, 0xe4, 0xeb, 0xba, 0xa4, 0x72, 0x37, 0x6e, 0x5e, 0x16, 0xb7, 0x26,
+          0x04, 0x39, 0x22, 0x92, 0xbb, 0x91, 0xea, 0xbc, 0x64, 0xec, 0xa1, 0x94, 0xc9, 0xa1, 0xb0, 0x8b, 0x97, 0x93, 0x84, 0x80, 0xde, 0xa8, 0x4e, 0x18,
+          0x2a, 0x94, 0x4a, 0xe1, 0xda, 0xd0, 0x9c, 0xa3, 0x97, 0xc7, 0xf2, 0x08, 0x45, 0xe5, 0xe8, 0xcb, 0x92, 0x0b, 0x54, 0x88, 0xaa, 0xdd, 0x88, 0x12,
+          0xfb, 0x4f, 0xfc, 0xc2, 0x1a, 0x9f, 0x45, 0x8a, 0x95, 0xaf, 0x88, 0x53, 0x28, 0x4e, 0x66, 0xff, 0x24, 0x3e, 0x38, 0xfe, 0x41, 0x04, 0xe2, 0x2e,
+          0xae, 0xf6, 0xeb, 0x6d, 0xc7, 0x67, 0x10, 0x62, 0x13, 0x37, 0xed, 0x32, 0x3a, 0x24, 0x8f, 0xe5, 0x45, 0xb6, 0xe3, 0x77, 0xcb, 0x61, 0xf8, 0x61,
+          0x69, 0x54, 0x4e, 0xcf, 0xb3, 0xc0, 0x7a, 0x33, 0xf1, 0x26, 0x17, 0x0f, 0xfb, 0x4c, 0xc8, 0x97, 0xdd, 0x0c, 0x13, 0xe3, 0xba, 0x93, 0x17, 0x67,
+          0x51, 0xe3, 0xa4, 0xca, 0xe2, 0x70, 0xd6, 0xb9, 0x4b, 0x25, 0x16, 0x55, 0x0d, 0x80, 0x7b, 0xe2, 0x2f, 0x56, 0xe2, 0x1a, 0x9c, 0x84, 0x90, 0x93,
+          0x6a, 0x97, 0xeb, 0xd7, 0x66, 0xc4, 0xa4, 0xd5, 0x7a, 0x59, 0x61, 0xdf, 0xa9, 0xb6, 0xf0, 0x44, 0xb5, 0xb9, 0xc0, 0x08, 0x1d, 0x4a, 0x46, 0x78,
+          0xe5, 0x16, 0xdd, 0xe3, 0xc0, 0x3b, 0xc7, 0xfb, 0xa1, 0x94, 0x6a, 0x59, 0x64, 0xc1, 0xbb, 0x02, 0xf7, 0x6f, 0x1e, 0xd7, 0x13, 0x20, 0xd5, 0x91,
+          0xe3, 0xe4, 0xc5, 0x1b, 0x3b, 0xce, 0xc2, 0x38, 0xb9, 0x45, 0x58, 0xba, 0x45, 0xa2, 0x0b, 0xbc, 0xed, 0x59, 0x70, 0x5c, 0xb2, 0x6d, 0x96, 0xee,
+          0xb7, 0x7e, 0x45, 0x9c, 0x9a, 0xc5, 0x17, 0xfc, 0x7e, 0x2b, 0xb8, 0xd5, 0xb7, 0xa3, 0x5a, 0xb7, 0x8b, 0xff, 0xdd, 0x2b, 0xa9, 0x3b, 0x5b, 0xb2,
+          0x6b, 0x25, 0x56, 0x21, 0x70, 0xf7, 0xaa, 0x17, 0x44, 0xe9, 0xc3, 0x4f, 0x52, 0xcf, 0x4f, 0x7c, 0x3d, 0xa7, 0x8a, 0x54, 0xd3, 0x3c, 0x76, 0xca,
+          0x74, 0x56, 0xed, 0x16, 0x0d, 0x6f, 0xfc, 0xb1, 0x0f, 0xb9, 0xdb, 0xc5, 0xe1, 0xd5, 0x53, 0x8d, 0x83, 0x43, 0x59, 0x6f, 0x1c, 0x4b, 0x30, 0x3b,
+          0xf7, 0x7e, 0x13, 0xff, 0x33, 0xca, 0xff, 0xf0, 0x88, 0x8c, 0x9d, 0x5f, 0xa1, 0xa6, 0xfb, 0xd1, 0x5e, 0xa3, 0xbc, 0x9d, 0x5d, 0xd0, 0x3e, 0x86,
+          0x76, 0x54, 0x7a, 0x57, 0xbb, 0xe9, 0xc3, 0x30, 0xb5, 0x27, 0x71, 0x88, 0xe1, 0x41, 0x04, 0xa9, 0xbc, 0xf1, 0x95, 0x2e, 0x84, 0x8c, 0x8b, 0x5d,
+          0xdb, 0x9a, 0xfd, 0xc1, 0x96, 0x3c, 0xc0, 0x85, 0x14, 0xd9, 0xa9, 0x77, 0xd9, 0xf8, 0x90, 0xa6, 0xe3, 0x9c, 0xd6, 0x23, 0xd3, 0xf2, 0x83, 0xa1,
+          0x9b, 0x68, 0xe9, 0x65, 0x0c, 0x89, 0x9e, 0xa3, 0xb0, 0x21, 0xf4, 0x3f, 0xed, 0x0b, 0xd9, 0xeb, 0xbf, 0xf6, 0xd5, 0x98, 0xb9, 0xea, 0x2a, 0xac,
+          0x25, 0x8a, 0xbe, 0x30, 0xd6, 0x0f, 0xb5, 0x34, 0xac, 0x0a, 0x71, 0x35, 0x58, 0x31, 0x59, 0xed, 0xbf, 0xdf, 0x6c, 0x5a, 0x50, 0xe2, 0x01, 0x75,
+          0x9f, 0xce, 0x17, 0x44, 0x07, 0x73, 0x49, 0x18, 0x47, 0xca, 0x35, 0x3c, 0xfa, 0xe9, 0x21, 0x78, 0x01, 0x73, 0xb6, 0x8b, 0x1f, 0x27, 0xdd, 0x93,
+          0x03, 0xfd, 0x52, 0x96, 0xa8, 0x0e, 0x5c, 0xd8, 0xe7, 0x4e, 0x96, 0x88, 0x00, 0x05, 0xb5, 0x50, 0x74, 0x25, 0xd4, 0x4d, 0xd9, 0x4b, 0xb6, 0x7e,
+          0xce, 0x13, 0x73, 0x86, 0x0b, 0x63, 0xa2, 0x4e, 0x96, 0xd2, 0xff, 0x29, 0x3e, 0x41, 0x3b, 0x71, 0x39, 0x19, 0x36, 0x37, 0x9b, 0x96, 0xab, 0x5e,
+          0x26, 0xef, 0x22, 0xc6, 0x9a, 0x46, 0x58, 0xaa, 0x49, 0xbe, 0xd5, 0xfa, 0xb6, 0x07, 0xcc, 0xbe, 0x87, 0xb2, 0x7c, 0x65, 0xe6, 0xba, 0x33, 0x13,
+          0x60, 0x18, 0x01, 0x11, 0xa7, 0x6a, 0x52, 0x3d, 0x29, 0x0a, 0x39, 0x3f, 0xe9, 0xf0, 0x0d, 0xdf, 0x6c, 0xd0, 0x20, 0x7a, 0x52, 0x87, 0x8b, 0x0b,
+          0x5b, 0x1f, 0x3e, 0x44, 0xd2, 0xee, 0xd8, 0x3c, 0x78, 0x49, 0x5f, 0x13, 0x26, 0x1f, 0xe0, 0xe4, 0xa6, 0xd3, 0x17, 0xcc, 0xd2, 0xae, 0x28, 0xcd,
+          0xe1, 0x95, 0xcf, 0xdf, 0x54, 0x0c, 0x00, 0xf7, 0x65, 0xbb, 0x6c, 0x99, 0x99, 0x2c, 0xd9, 0x95, 0x0d, 0xc5, 0xc4, 0x26, 0x37, 0x76, 0x4e, 0xac,
+          0x7d, 0x95, 0xf6, 0x84, 0x5c, 0xaa, 0x31, 0xf6, 0x0b, 0xde, 0x1f, 0xa6, 0xb4, 0x2e, 0xfa, 0x0d, 0xea, 0xe3, 0xab, 0x3e, 0x13, 0x66, 0xfb, 0xd1,
+          0x47, 0xfd, 0x37, 0xf3, 0x6c, 0xb5, 0xb7, 0xbc, 0x67, 0xa3, 0xda, 0xc1, 0x89, 0x84, 0x38, 0x1b, 0xaf, 0xd8, 0x0d, 0x76, 0x0b, 0x05, 0x00, 0x63,
+          0x0b, 0x88, 0xa5, 0x2d, 0x83, 0xab, 0xfd, 0x88, 0x18, 0xd0, 0x8f, 0xd1, 0x0f, 0xea, 0xf5, 0xa3, 0x5b, 0xae, 0x36, 0x3d, 0x96, 0x8b, 0x42, 0x5d,
+          0x64, 0xa9, 0x7e, 0xb4, 0xb5, 0x57, 0x40, 0xcd, 0xcd, 0x0b, 0x8d, 0x01, 0x4c, 0x75, 0x5e, 0x44, 0x4c, 0x55, 0x29, 0x4a, 0xea, 0xc4, 0xfb, 0xcb,
+          0x7a, 0xfc, 0x45, 0xb6, 0x37, 0x88, 0x55, 0x76, 0x9b, 0x05, 0x66, 0x2d, 0xa4, 0x93, 0xc4, 0xcd, 0x51, 0x65, 0x1d, 0x6e, 0x35, 0x21, 0xd4, 0x08,
+          0xeb, 0x56, 0x84, 0xab, 0x82, 0xf3, 0xea, 0xa5, 0xb1, 0x8b, 0x60, 0x75, 0x56, 0xaa, 0xcf, 0x52, 0x5c, 0xa3, 0xc1, 0x63, 0xe7, 0x37, 0x46, 0xdb,
+          0xc4, 0x23, 0xc7, 0x1e, 0xe9, 0x35, 0xc7, 0xa5, 0x13, 0x57, 0xae, 0x65, 0x48, 0x56, 0x32, 0x26, 0x54, 0xc6, 0x24, 0x2e, 0x41, 0x48, 0x83, 0xc1,
+          0x18, 0xac, 0x03, 0x68, 0x47, 0xad, 0x45, 0x36, 0xcd, 0x05, 0x82, 0x60, 0x9b, 0xbd, 0xb9, 0xef, 0x36, 0x0e, 0xe7, 0x44, 0xa4, 0x41, 0x8c, 0x67,
+          0xf3, 0x8a, 0xa9, 0x58, 0x29, 0x5d, 0xa9, 0xe9, 0xaa, 0xe5, 0xc1, 0xfc, 0xad, 0xda, 0xd0, 0x4f, 0xa0, 0x64, 0xd1, 0x51, 0x13, 0x6d, 0x56, 0x14,
+          0x2b, 0xee, 0xe2, 0xb0, 0x32, 0xc7, 0x5b, 0x97, 0xe5, 0xef, 0xff, 0xf1, 0x16, 0x8a, 0x76, 0x45, 0xa5, 0xa5, 0x00, 0x4a, 0x93, 0x93, 0x8b, 0x5c,
+          0x41, 0x5c, 0xec, 0x3b, 0xe6, 0x72, 0x7d, 0x94, 0x9b, 0x16, 0x93, 0xcf, 0x55, 0x43, 0x61, 0x32, 0x17, 0x00, 0x28, 0x5e, 0x19, 0x81, 0x7c, 0xa7,
+          0xf3, 0x9c, 0xe9, 0xbe, 0xf4, 0xa9, 0x56, 0xce, 0x77, 0x5d, 0x96, 0x5d, 0x2f, 0x22, 0x9e, 0x5a, 0x4c, 0x60, 0x97, 0x98, 0xce, 0x79, 0xed, 0xbe,
+          0xd8, 0x99, 0x56, 0x6f, 0x19, 0x7d, 0xa6, 0x10, 0x3f, 0x4a, 0xba, 0x49, 0xb1, 0xa2, 0x14, 0xa4, 0xb3, 0x91, 0x67, 0x0b, 0xe4, 0x6d, 0x8c, 0xa2,
+          0x93, 0x48, 0xf0, 0xf9, 0xeb, 0xe0, 0xb8, 0x4b, 0xea, 0x23, 0x51, 0xc8, 0x39, 0x99, 0xa7, 0xb7, 0xec, 0x36, 0x33, 0x07, 0xdd, 0x58, 0x86, 0x56,
+          0x48, 0x51, 0x10, 0x47, 0xd0, 0xbb, 0x31, 0x75, 0xab, 0x6e, 0x53, 0xe1, 0xb0, 0xe1, 0x8c, 0x7a, 0x67, 0x6b, 0x5d, 0xaf, 0x6a, 0x6a, 0x1d, 0x3a,
+          0xbc, 0xaf, 0xc5, 0xb3, 0x24, 0xa5, 0x09, 0xdc, 0xfa, 0xd4, 0xe9, 0x6e, 0x65, 0xbb, 0xb7, 0x57, 0x1b, 0x82, 0x0c, 0xfc, 0xd4, 0x0f, 0xf3, 0x87,
+          0x09, 0xb8, 0x90, 0x08, 0xe8, 0x9f, 0x0a, 0xae, 0x48, 0x4a, 0xc3, 0x0a, 0x20, 0xf3, 0x40, 0x4d, 0xa4, 0x82, 0xd7, 0xbb, 0xb9, 0x5f, 0x92, 0x4f,
+          0xa0, 0xda, 0xe3, 0xd6, 0x73, 0x53, 0xf8, 0x13, 0xbc, 0x52, 0x9c, 0x21, 0x3b, 0x37, 0x32, 0x0f, 0x74, 0xe3, 0x89, 0x38, 0x4c, 0x3a, 0xf5, 0x28,
+          0xc1, 0x49, 0xa7, 0x41, 0x6a, 0x8a, 0x9e, 0xf6, 0xd5, 0x4d, 0xe4, 0x40, 0xec, 0x84, 0x82, 0x71, 0x81, 0x21, 0x37, 0x9d, 0xef, 0x22, 0xbe, 0xcf,
+          0x36, 0x8b, 0xf1, 0x49, 0x34, 0x73, 0x97, 0x4a, 0x81, 0x0a, 0x5d, 0xab, 0xa9, 0x87, 0xc9, 0x98, 0x47, 0x94, 0xc6, 0xa5, 0x20, 0xbb, 0xf9, 0x30,
+          0xeb, 0xeb, 0x46, 0x2d, 0x16, 0x2a, 0x61, 0x8c, 0x6e, 0x96, 0x85, 0x4a, 0xfb, 0x5e, 0xa0, 0xec, 0x48, 0xa9, 0xfa, 0x3a, 0x9b, 0x91, 0xaa, 0x27,
+          0x83, 0x3d, 0x48, 0xd2, 0xb3, 0xf4, 0x52, 0x0d, 0xc4, 0x5f, 0xab, 0xc5, 0xa8, 0xd4, 0x5a, 0x55, 0x23, 0xc6, 0x76, 0xaf, 0x49, 0x5d, 0x63, 0x8c,
+          0x52, 0xb7, 0xb0, 0x49, 0x2a, 0x57, 0x6b, 0x06, 0x5a, 0x1d, 0xfb, 0xe0, 0x26, 0xa7, 0xd7, 0xf0, 0x28, 0x9f, 0x77, 0xb4, 0xd0, 0xfa, 0x95, 0x08,
+          0x37, 0xd0, 0x7a, 0x08, 0x59, 0x3a, 0x68, 0xfd, 0xe6, 0x54, 0x36, 0xc9, 0x35, 0x9b, 0x08, 0x74, 0x07, 0x95, 0x67, 0x34, 0xe7, 0xa7, 0x04, 0xea,
+          0xb4, 0x21, 0x9f, 0x74, 0x3c, 0xe3, 0x3c, 0x93, 0xfe, 0x37, 0x8c, 0xd7, 0x6f, 0xf2, 0xc2, 0x2a, 0xe5, 0xd1, 0xbd, 0xc0, 0x39, 0xd3, 0xa2, 0x6d,
+          0xec, 0x89, 0xd1, 0xbc, 0xf9, 0x77, 0xdf, 0x5e, 0x5d, 0x11, 0x46, 0x75, 0xdd, 0xc5, 0xf7, 0xb8, 0x14, 0x68, 0x54, 0x5e, 0xb4, 0xfa, 0xb7, 0xe1,
+          0xd2, 0x68, 0x2e, 0x99, 0x82, 0x95, 0xd2, 0x31, 0xbe, 0x6f, 0xb6, 0x7b, 0x5a, 0x5e, 0xb7, 0x12, 0x6a, 0xdb, 0x64, 0x72, 0xe1, 0xc2, 0xba, 0x5e,
+          0xc2, 0x39, 0x4a, 0x8e, 0x9d, 0xa8, 0xe6, 0xf1, 0x41, 0xcf, 0xc9, 0x19, 0x98, 0xdb, 0x1c, 0x56, 0x73, 0xe9, 0x71, 0xeb, 0xa5, 0x61, 0xe9, 0x7a,
+          0xbe, 0xae, 0x39, 0x9a, 0x07, 0xaf, 0x72, 0xb5, 0x9a, 0x40, 0x14, 0xcf, 0x71, 0x7d, 0x4e, 0x71, 0x39, 0x6a, 0x04, 0xd3, 0xce, 0xd5, 0x99, 0xda,
+          0x79, 0x43, 0x5f, 0xb6, 0x78, 0x3e, 0xec, 0x35, 0x71, 0x91, 0xcc, 0x4a, 0xd1, 0x79, 0x15, 0xb4, 0x61, 0x1d, 0xec, 0xe2, 0xe1, 0x29, 0xb4, 0x2b,
+          0xa8, 0xac, 0x7c, 0x50, 0xf7, 0xd3, 0x55, 0x7d, 0x89, 0x8a, 0x49, 0xcd, 0xed, 0x80, 0x3e, 0x47, 0x47, 0x7d, 0x91, 0x9c, 0x26, 0x29, 0xdc, 0xd2,
+          0x83, 0x39, 0xec, 0xb6, 0x11, 0x92, 0xec, 0x7e, 0xe5, 0x79, 0x80, 0x87, 0x5d, 0xe6, 0x5a, 0x8e, 0xb9, 0x43, 0xbd, 0xfa, 0x0d, 0xa8, 0xef, 0x1c,
+          0xf1, 0xc0, 0x96, 0xfe, 0xa3, 0x31, 0xfd, 0x39, 0xfd, 0xf3, 0x98, 0x00, 0x08, 0x60, 0x91, 0x2e, 0xa5, 0x2a, 0x3a, 0x9d, 0xb4, 0xa3, 0x45, 0x23,
+          0xa6, 0x5b, 0x87, 0x61, 0x68, 0x16, 0x55, 0xe6, 0xd0, 0x7b, 0x1d, 0x60, 0x7a, 0xaf, 0x56, 0x8a, 0x42, 0xbe, 0x76, 0x42, 0xa6, 0xf6, 0x69, 0x63,
+          0x6f, 0xc3, 0x01, 0xb4, 0xdc, 0x2a, 0xef, 0x07, 0x45, 0xf9, 0xb3, 0x84, 0xd0, 0x31, 0x37, 0x3b, 0x22, 0x10, 0xe3, 0xde, 0xa1, 0x9a, 0x99, 0x6b,
+          0x75, 0xac, 0xad, 0xb7, 0x6c, 0x5a, 0x93, 0x85, 0xd1, 0x79, 0x5f, 0xb4, 0x22, 0x62, 0xb8, 0x46, 0x7a, 0xba, 0x26, 0xa5, 0xa8, 0x7c, 0xd2, 0x79,
+          0xe6, 0x16, 0xdf, 0x7f, 0xf6, 0x19, 0x1d, 0xad, 0xa7, 0x51, 0xeb, 0x1c, 0xb4, 0x19, 0x4e, 0xcc, 0x18, 0xe3, 0xde, 0x42, 0xb3, 0x63, 0xc7, 0x97,
+          0x9b, 0x31, 0xb1, 0x11, 0xc0, 0xb6, 0xe7, 0xdb, 0xc4, 0xe4, 0xdb, 0x6a, 0xff, 0x99, 0x34, 0xaa, 0xe5, 0xa7, 0x86, 0x38, 0x2b, 0x3e, 0xbf, 0xb4,
+          0x27, 0x3a, 0x60, 0x92, 0x82, 0x8f, 0x67, 0x3c, 0x1a, 0x33, 0xa2, 0x82, 0x3e, 0x3f, 0x3f, 0x6b, 0x88, 0x4a, 0xb0, 0x83, 0x32, 0x8c, 0xde, 0xee,
+          0x1d, 0x09, 0x2a, 0x23, 0xba, 0x86, 0x8d, 0x8e, 0x5e, 0x77, 0x40, 0x3d, 0x6e, 0x28, 0x58, 0x27, 0xab, 0x2c, 0x56, 0xbb, 0x11, 0x01, 0xf5, 0x6a,
+          0x8b, 0x67, 0x49, 0xe7, 0xbb, 0x71, 0x8e, 0x15, 0x14, 0x44, 0xb7, 0x89, 0x9f, 0x45, 0xb2, 0xd5, 0xa5, 0x73, 0x29, 0x32, 0x96, 0x22, 0xf5, 0x82,
+          0x2b, 0x8e, 0xb2, 0x35, 0x6a, 0xd1, 0xe3, 0xdd, 0xc3, 0x1a, 0x29, 0x40, 0x9f, 0xfe, 0x67, 0x57, 0x8c, 0x4b, 0xbf, 0x11, 0x12, 0x6a, 0x35, 0x3b,
+          0x38, 0x9e, 0x00, 0x80, 0x92, 0x3f, 0xf1, 0xd4, 0xf0, 0x4d, 0xab, 0x62, 0x98, 0xad, 0x8f, 0xde, 0xff, 0x20, 0x27, 0x84, 0xba, 0x39, 0xe0, 0xbf,
+          0x6c, 0x45, 0x29, 0x86, 0x9c, 0xe5, 0x83, 0x84, 0x00, 0xe7, 0x53, 0x16, 0x4c, 0x83, 0x24, 0x60, 0x02, 0x00, 0xaa, 0x28, 0x03, 0xa6, 0x83, 0xb7,
+          0x33, 0x33, 0xdf, 0xfc, 0xe9, 0x10, 0x83, 0x0a, 0x07, 0x46, 0x32, 0x08, 0x4c, 0x0c, 0xa8, 0x3e, 0x99, 0xac, 0x7d, 0x9d, 0x79, 0x54, 0x40, 0xc9,
+          0xf4, 0x66, 0x5c, 0x84, 0xdd, 0x79, 0x6d, 0xc4, 0x63, 0x8f, 0x1a, 0x64, 0x56, 0xae, 0x87, 0xd3, 0x03, 0xf7, 0xe8, 0xd5, 0x5d, 0x48, 0xe6, 0xb4,
+          0x2f, 0x3d, 0x39, 0x6c, 0x66, 0xfc, 0xe2, 0x47, 0xcf, 0x33, 0x94, 0x7a, 0xab, 0x7e, 0x2b, 0xb4, 0x94, 0x53, 0x00, 0x86, 0x9c, 0x86, 0x02, 0x58,
+          0x12, 0xd5, 0x64, 0xa6, 0x6e, 0x42, 0xdf, 0x52, 0x4a, 0xbc, 0x54, 0xa4, 0x67, 0x41, 0x20, 0x3b, 0xc3, 0xe5, 0x05, 0xc7, 0xee, 0x61, 0x21, 0xa2,
+          0xdd, 0x08, 0xd9, 0x7c, 0x40, 0x33, 0xc5, 0xa2, 0xaf, 0x1d, 0xc6, 0x41, 0xa3, 0x3e, 0x5a, 0xd2, 0xe2, 0xa7, 0x44, 0xe3, 0xa6, 0x84, 0xb8, 0x10,
+          0x3b, 0x96, 0x58, 0x01, 0xa5, 0x50, 0x28, 0x33, 0x4a, 0x70, 0x87, 0xdd, 0x25, 0xa4, 0xc8, 0xa0, 0x32, 0x35, 0x59, 0x52, 0xfd, 0x93, 0xb9, 0xc6,
+          0x29, 0x1f, 0x69, 0x39, 0xa1, 0x54, 0x5a, 0x6a, 0xc6, 0x0e, 0x91, 0x4d, 0xb2, 0x11, 0x05, 0x91, 0xb0, 0x57, 0x07, 0xc6, 0x1e, 0xe9, 0xff, 0xeb,
+          0x61, 0x49, 0x88, 0xe0, 0xa7, 0xad, 0x17, 0x01, 0xec, 0xb5, 0x15, 0x65, 0x94, 0x12, 0x27, 0x2b, 0xaa, 0x1a, 0x8d, 0x76, 0x44, 0x58, 0xdb, 0xbb,
+          0xec, 0xa8, 0x26, 0x0e, 0x2d, 0x45, 0x8b, 0x93, 0x66, 0x63, 0xc5, 0xc1, 0x69, 0x73, 0xe6, 0x45, 0x15, 0x89, 0x56, 0x0c, 0x17, 0x14, 0xba, 0x59,
+          0x38, 0xf9, 0x1d, 0xe2, 0x8c, 0x13, 0x9e, 0x40, 0xfe, 0x38, 0x78, 0x4e, 0x48, 0xee, 0xd2, 0x5a, 0x4b, 0xde, 0xb8, 0x9f, 0x03, 0x1c, 0xc6, 0x33,
+          0xc1, 0xa3, 0x0c, 0xdd, 0x9a, 0x57, 0x0e, 0xd8, 0x50, 0xb3, 0xe5, 0x92, 0xb2, 0x78, 0xd6, 0x0f, 0x6d, 0xcd, 0x4d, 0x4d, 0x0e, 0xa9, 0x08, 0x67,
+          0x62, 0xea, 0xee, 0x1c, 0x2b, 0x78, 0xf3, 0x23, 0x56, 0x5b, 0x36, 0x71, 0x6b, 0x7e, 0xd7, 0x8a, 0x2f, 0x28, 0xc6, 0x1c, 0xc3, 0xf6, 0x0a, 0x9a,
+          0xf8, 0x04, 0xd7, 0x5a, 0xc6, 0xcd, 0x8e, 0x2d, 0x65, 0x27, 0x6c, 0xdb, 0xae, 0x15, 0x27, 0xd7, 0xeb, 0xfe, 0x86, 0xbb, 0x16, 0x31, 0xc5, 0x3a,
+          0xf3, 0xba, 0xcc, 0x2b, 0xdb, 0x67, 0x12, 0x7a, 0xff, 0xe9, 0x0d, 0x9a, 0x46, 0xbf, 0x94, 0x83, 0x70, 0xcd, 0x8e, 0xe5, 0xe7, 0xe6, 0x3b, 0xe6,
+          0x55, 0x65, 0x96, 0xed, 0x30, 0x2d, 0x1f, 0xde, 0x7c, 0x57, 0x82, 0x7e, 0xec, 0x2b, 0x88, 0x4e, 0xd7, 0xdf, 0xfd, 0x70, 0x55, 0x1f, 0x63, 0xeb,
+          0xe8, 0xf6, 0x50, 0x7c, 0x97, 0x9b, 0xc1, 0x4d, 0x63, 0x9e, 0xcd, 0xbe, 0xc9, 0x57, 0x70, 0x83, 0xd8, 0xb5, 0x00, 0x0b, 0xab, 0x75, 0x55, 0x7f,
+          0xe0, 0x80, 0x57, 0x02, 0x52, 0x3c, 0x02, 0xa0, 0x86, 0x8b, 0xb1, 0xb6, 0x69, 0xef, 0xa6, 0x66, 0x19, 0x6d, 0xa4, 0xc3, 0x8f, 0xef, 0x81, 0x8d,
+          0xdb, 0x55, 0x5e, 0x5b, 0x92, 0xca, 0x5c, 0x39, 0x56, 0x35, 0xf8, 0x1a, 0xed, 0x5f, 0x45, 0xa9, 0x4d, 0x6e, 0x05, 0x8d, 0xef, 0xc4, 0x22, 0x01,
+          0x8a, 0x1e, 0x25, 0xac, 0xf8, 0xcf, 0x1c, 0xec, 0x95, 0x60, 0xe4, 0xc2, 0xba, 0x3a, 0xbc, 0x6e, 0xcf, 0x26, 0x95, 0x58, 0xbb, 0x15, 0xee, 0x9d,
+          0xc6, 0x06, 0xf8, 0x74, 0x8b, 0x51, 0x15, 0x9a, 0xac, 0xd5, 0x1e, 0x4a, 0x38, 0x85, 0x0c, 0xd0, 0x48, 0x45, 0xb2, 0xe1, 0x2a, 0xea, 0x35, 0x98,
+          0xb5, 0x9b, 0x4d, 0x36, 0xd4, 0x27, 0x62, 0xfc, 0xbd, 0x0e, 0x91, 0x66, 0x3e, 0xda, 0x90, 0x7c, 0x48, 0x89, 0x40, 0x34, 0x0e, 0x18, 0x54, 0x77,
+          0x04, 0xae, 0xbb, 0xfb, 0xfe, 0xf1, 0x4b, 0xa3, 0xfc, 0x22, 0x65, 0x84, 0x84, 0xf7, 0xa2, 0xe2, 0x51, 0x80, 0x45, 0x18, 0x02, 0x8a, 0xb1, 0x54,
+          0x24, 0x7f, 0x46, 0xcc, 0x0d, 0x03, 0xaa, 0xc5, 0xc8, 0xb2, 0x19, 0x5e, 0x87, 0x83, 0x43, 0xf0, 0xc4, 0x78, 0xc7, 0x56, 0xf5, 0xf0, 0x80, 0xa5,
+          0xf5, 0xe0, 0x78, 0xc7, 0x5e, 0x13, 0x4f, 0x3e, 0x5c, 0x35, 0xbf, 0x1a, 0x1f, 0x60, 0x67, 0x78, 0xb8, 0xb7, 0x9a, 0x23, 0xb6, 0x62, 0xc0, 0xc0,
+          0xad, 0x43, 0x4c, 0x6f, 0x75, 0xf6, 0x7a, 0xd7, 0x30, 0x61, 0x10, 0x83, 0xbf, 0x1b, 0xf1, 0xd9, 0x0f, 0x13, 0x7b, 0x49, 0xbb, 0xfb, 0x15, 0x08,
+          0xcc, 0x24, 0xac, 0x0f, 0x11, 0xfb, 0xd9, 0x7c, 0x81, 0xed, 0x97, 0x8b, 0xf4, 0x6a, 0x0d, 0xf9, 0xc0, 0xc9, 0xc3, 0x12, 0x70, 0x65, 0x8c, 0x10,
+          0xce, 0x49, 0x8f, 0x19, 0xc4, 0xec, 0xb3, 0xbb, 0x63, 0x1a, 0x65, 0xa2, 0x70, 0x97, 0x4a, 0x1c, 0x27, 0xcb, 0x42, 0x89, 0xcc, 0xe5, 0x76, 0xfb,
+          0xd9, 0xaf, 0xbf, 0x8f, 0x70, 0x41, 0xd4, 0x03, 0xab, 0x8a, 0xe7, 0x6a, 0x06, 0x4b, 0x1f, 0x3b, 0xb4, 0xad, 0xd9, 0x2d, 0x81, 0x49, 0x5c, 0x43,
+          0x8b, 0x06, 0x6d, 0x01, 0xd5, 0xa5, 0x2f, 0x48, 0xda, 0xd8, 0x37, 0xe0, 0x4e, 0xf3, 0x3e, 0xb1, 0xa1, 0xe3, 0x3b, 0x6e, 0xe3, 0xf6, 0xd0, 0xd5,
+          0xb6, 0xa5, 0xf3, 0x15, 0x8e, 0x15, 0x1c, 0x68, 0x5c, 0xc0, 0xff, 0x18, 0x5d, 0x9a, 0x9f, 0x20, 0xc6, 0x41, 0x8c, 0x6f, 0xfe, 0xdd, 0x62, 0x70,
+          0xcf, 0x1e, 0xb3, 0x9c, 0x35, 0x9a, 0x1a, 0x8f, 0x72, 0x9d, 0x7a, 0xfd, 0xb0, 0x81, 0x89, 0x25, 0x7b, 0x17, 0x97, 0x62, 0x32, 0xe2, 0x03, 0x59,
+          0xb6, 0x26, 0x22, 0x6e, 0xdb, 0x42, 0xd7, 0x6d, 0xdd, 0x13, 0x4d, 0x54, 0x07, 0x87, 0xf1, 0x4f, 0x71, 0x3c, 0xf9, 0xbb, 0xf9, 0x6f, 0xd0, 0x44,
+          0xd6, 0x70, 0x15, 0xda, 0x7d, 0xe2, 0x68, 0xa9, 0xc8, 0xc3, 0x06, 0x09, 0x0a, 0xfe, 0x0b, 0xbb, 0xc9, 0x61, 0x00, 0x76, 0x29, 0x16, 0xe3, 0x29,
+          0x39, 0x43, 0xb2, 0xad, 0x0e, 0xee, 0x35, 0x44, 0xea, 0x0e, 0x6d, 0x12, 0x2d, 0xbb, 0x0d, 0xe4, 0xa5, 0xfa, 0x7a, 0xf4, 0x87, 0x16, 0x36, 0x19,
+          0x47, 0x27, 0x66, 0x42, 0xbe, 0xd0, 0x6e, 0x8e, 0xa0, 0xde, 0x36, 0xe0, 0x5f, 0x0e, 0xee, 0x94, 0xe1, 0x90, 0x8d, 0x70, 0x69, 0x6d, 0x54, 0x63,
+          0x2e, 0xdc, 0x08, 0xf8, 0x71, 0x53, 0xe6, 0x08, 0xcf, 0x38, 0x57, 0x3c, 0xe6, 0x00, 0x1d, 0xb9, 0x19, 0x9d, 0xde, 0x8e, 0xac, 0x3e, 0x6b, 0x2a,
+          0xfc, 0x0b, 0xe3, 0xa6, 0x15, 0xb7, 0x12, 0x39, 0x3e, 0xef, 0x39, 0xb2, 0x57, 0x1b, 0x57, 0x1e, 0xa1, 0x01, 0x40, 0xae, 0x20, 0xcc, 0x01, 0xac,
+          0xfe, 0x28, 0x09, 0xc5, 0x74, 0x9d, 0x1c, 0x44, 0x3e, 0xe5, 0xdd, 0xf6, 0xde, 0xba, 0xd8, 0xf2, 0xa2, 0x84, 0x6b, 0xc0, 0x08, 0x1b, 0x35, 0x03,
+          0xde, 0x2d, 0xaa, 0x85, 0x02, 0x5b, 0xcf, 0x78, 0x2a, 0x1a, 0x68, 0x3b, 0xe5, 0x72, 0xd5, 0x3a, 0x2e, 0x2a, 0x9e, 0x76, 0x8a, 0x13, 0x8d, 0xe1,
+          0x66, 0xb6, 0xb2, 0x22, 0xe0, 0x63, 0x6a, 0x7a, 0xa8, 0x8e, 0x02, 0xcf, 0x2d, 0x5d, 0x4b, 0xdf, 0x70, 0x23, 0x6f, 0x37, 0xc5, 0x8b, 0x8b, 0x9c,
+          0xb1, 0x34, 0x10, 0x2a, 0xde, 0xc2, 0x02, 0x6a, 0xc5, 0xc8, 0x4b, 0x73, 0xe2, 0x00, 0xfa, 0x2e, 0x32, 0x1d, 0x2d, 0x7d, 0xd2, 0xe4, 0xf8, 0x44,
+          0x64, 0xd8, 0xcb, 0x2f, 0x97, 0x98, 0x9a, 0x64, 0xc1, 0xa8, 0xf2, 0x3b, 0x02, 0x51, 0x50, 0x46, 0x9f, 0xbe, 0x57, 0xc2, 0xe7, 0x56, 0xad, 0xf2,
+          0x79, 0x2e, 0x5b, 0x37, 0xd6, 0xc6, 0x4f, 0xbd, 0xf4, 0xa2, 0xe5, 0xdf, 0x0d, 0xe1, 0x39, 0x98, 0xdb, 0x2c, 0xcf, 0xf6, 0xfe, 0xc1, 0x17, 0xbf,
+          0x1e, 0xf4, 0x62, 0xcd, 0x56, 0xd4, 0x87, 0x78, 0xb9, 0xa6, 0xf1, 0xd3, 0xab, 0x81, 0xfd, 0xf4, 0xe7, 0x51, 0xd0, 0x82, 0xf1, 0x7f, 0x78, 0x78,
+          0x99, 0x3a, 0xa0, 0x4e, 0xc6, 0xf2, 0xdf, 0x62, 0x48, 0xea, 0x8a, 0xfb, 0x07, 0x06, 0x3a, 0x3b, 0x49, 0xa4, 0xe5, 0xe2, 0x5c, 0xcf, 0xe3, 0x5c,
+          0x15, 0x95, 0xac, 0xd8, 0x04, 0xe8, 0xc4, 0xb9, 0x51, 0x4b, 0xcd, 0xb5, 0x1d, 0x8d, 0x84, 0x98, 0x9e, 0x1e, 0x62, 0x48, 0x39, 0x92, 0xca, 0x8c,
+          0x6b, 0x85, 0x8c, 0x64, 0x79, 0x96, 0xf2, 0xaa, 0x12, 0xc8, 0xbc, 0x71, 0x9a, 0xc6, 0x24, 0x05, 0xef, 0xb8, 0x61, 0xad, 0x7f, 0xd4, 0x35, 0x15,
+          0xe2, 0x8e, 0x33, 0x76, 0xfe, 0xae, 0xa0, 0x1f, 0x7f, 0x92, 0xbe, 0xce, 0xee, 0x19, 0x57, 0x42, 0xc6, 0xbf, 0xc2, 0x11, 0xab, 0x2f, 0xff, 0x17,
+          0x9f, 0x13, 0x60, 0x0f, 0x41, 0xfe, 0xb3, 0x36, 0xaf, 0x75, 0x79, 0xfa, 0x58, 0x12, 0x25, 0x5c, 0x71, 0xab, 0x1a, 0x6d, 0x22, 0x26, 0xe8, 0xff,
+          0xd2, 0x84, 0x42, 0xfa, 0xce, 0x8e, 0x93, 0xd4, 0x75, 0x62, 0x07, 0x3c, 0x96, 0x62, 0x99, 0x61, 0x8d, 0x39, 0x99, 0x0d, 0x47, 0x92, 0xdb, 0xbd,
+          0x0d, 0xe3, 0x2e, 0xd8, 0x33, 0xaa, 0xdc, 0xbb, 0x99, 0xfd, 0xee, 0x8f, 0x0f, 0x12, 0x7d, 0x03, 0x5d, 0x05, 0xe8, 0xfb, 0x0a, 0xcf, 0xf9, 0x87,
+          0x4d, 0x21, 0x0e, 0xad, 0xc0, 0xd1, 0xf5, 0x97, 0x25, 0xfd, 0xf1, 0x3e, 0x62, 0x69, 0xea, 0x4b, 0x8b, 0x6c, 0x67, 0xca, 0xa4, 0xcc, 0x99, 0x5e,
+          0x6f, 0xd2, 0xf4, 0x23, 0x29, 0xc7, 0x69, 0x96, 0x8a, 0xf6, 0xaf, 0xde, 0x83, 0x79, 0xf1, 0x2e, 0x74, 0x87, 0x78, 0xce, 0x95, 0x61, 0xbd, 0xd0,
+          0xa2, 0x1b, 0xac, 0x0e, 0x21, 0xca, 0x0a, 0x28, 0x8d, 0x1c, 0xe5, 0xae, 0x2a, 0x61, 0x7b, 0xb5, 0x52, 0xaf, 0x14, 0x17, 0xea, 0x50, 0x2a, 0x4a,
+          0x01, 0x5c, 0x2f, 0xa7, 0x6b, 0x0c, 0xf1, 0x21, 0xb1, 0x4b, 0xc0, 0xc5, 0x54, 0xc5, 0xae, 0xfd, 0x39, 0x62, 0x96, 0x63, 0x61, 0x0a, 0xd3, 0x13,
+          0xd3, 0xd2, 0xdc, 0x53, 0x2a, 0x75, 0x0c, 0x85, 0x98, 0xb5, 0x80, 0x35, 0x17, 0x6b, 0x63, 0x8c, 0x4c, 0xc8, 0x9c, 0xbf, 0x18, 0x32, 0x8f, 0x05,
+          0xf7, 0x58, 0xa1, 0xc9, 0xb7, 0x3a, 0xad, 0x1c, 0xe9, 0x28, 0x7b, 0x8d, 0x7b, 0x4b, 0x35, 0x7a, 0x63, 0x05, 0x5e, 0x99, 0xdb, 0x07, 0xe6, 0x01,
+          0xee, 0xbc, 0x39, 0x65, 0xed, 0xdf, 0x99, 0x42, 0x48, 0xaa, 0x75, 0x5c, 0xf5, 0x34, 0xd1, 0xa1, 0xd1, 0x1d, 0xa3, 0xaa, 0xad, 0xa7, 0x2d, 0x1a,
+          0x8b, 0x44, 0xa8, 0xaf, 0xc3, 0x3a, 0x8f, 0x18, 0x76, 0x9f, 0x0e, 0xe4, 0x5c, 0xed, 0x77, 0x89, 0x79, 0x97, 0x47, 0x94, 0x6f, 0xa1, 0xeb, 0xd8,
+          0x2a, 0xf9, 0x74, 0x8a, 0xe5, 0x86, 0x40, 0x87, 0x23, 0x99, 0x43, 0x39, 0x6c, 0x5c, 0x6b, 0x2a, 0x38, 0xfa, 0xb1, 0x22, 0x99, 0x91, 0x69, 0x9d,
+          0xa3, 0x07, 0x71, 0x30, 0x50, 0xfc, 0x99, 0xcc, 0x37, 0xb7, 0x36, 0x6e, 0x71, 0xf1, 0xd6, 0x8c, 0x09, 0xcf, 0x93, 0x88, 0x83, 0x02, 0xcf, 0x5b,
+          0xad, 0x9d, 0xef, 0x86, 0x61, 0x83, 0x40, 0xdb, 0xaa, 0xff, 0x6c, 0x8b, 0x53, 0xc8, 0x19, 0x5d, 0xb2, 0xa9, 0xe7, 0x62, 0x61, 0xe2, 0xcb, 0x66,
+          0x98, 0xaf, 0x6d, 0x81, 0xf5, 0x06, 0xf0, 0x34, 0xde, 0xc9, 0x54, 0xc3, 0xf4, 0x91, 0x4d, 0xbc, 0x42, 0x8c, 0xfc, 0xe0, 0x0f, 0xc1, 0x0a, 0x7b,
+          0x63, 0x43, 0x26, 0xe8, 0x97, 0x8d, 0xec, 0x56, 0x9b, 0x2f, 0xf2, 0x3e, 0x5c, 0xfd, 0x11, 0x88, 0xa6, 0xe9, 0x6c, 0x10, 0xe7, 0xcc, 0xde, 0xf5,
+          0x54, 0x52, 0x15, 0x63, 0x57, 0x38, 0xb7, 0xc7, 0x50, 0xdf, 0xef, 0x38, 0xb4, 0x67, 0x62, 0xc7, 0x5c, 0xd9, 0xc3, 0x3f, 0xaa, 0xa6, 0xa0, 0xd8,
+          0xbb, 0xaa, 0x66, 0xbd, 0x68, 0x8c, 0xb1, 0xaa, 0x3d, 0x04, 0xfb, 0xd5, 0x3d, 0xe2, 0xa5, 0x80, 0x75, 0x96, 0x0b, 0x79, 0x73, 0x58, 0x3f, 0xa4,
+          0xa0, 0x66, 0x86, 0x82, 0xa3, 0x9b, 0x4e, 0xf5, 0x3e, 0xec, 0x18, 0x99, 0xf4, 0xeb, 0x6b, 0x4a, 0x9c, 0xf8, 0x51, 0xf9, 0xf3, 0x41, 0xf1, 0xf9,
+          0x67, 0x13, 0x01, 0x90, 0x85, 0x4e, 0xc0, 0x4c, 0xb7, 0xf8, 0xf1, 0xee, 0x8f, 0x0b, 0x0e, 0x0c, 0x1f, 0x74, 0x3d, 0x18, 0x45, 0xf4, 0x63, 0x43,
+          0x9b, 0x1b, 0xda, 0xc5, 0x88, 0xff, 0x7b, 0xc4, 0x1f, 0xac, 0x4a, 0x9b, 0xc6, 0x18, 0x9e, 0xfd, 0x85, 0x71, 0x2e, 0x31, 0x91, 0xbb, 0xe5, 0x15,
+          0xbb, 0x4e, 0xe1, 0xc2, 0xad, 0x52, 0xa3, 0xaa, 0xf4, 0xe3, 0xf8, 0x43, 0x90, 0x29, 0x6b, 0x20, 0x68, 0x9e, 0xbd, 0x95, 0xc9, 0x7c, 0xce, 0x7a,
+          0x26, 0x5d, 0x2a, 0x1e, 0xc0, 0x18, 0xc3, 0x91, 0x46, 0xd6, 0x1e, 0x31, 0x94, 0xcd, 0x07, 0x5c, 0x26, 0xec, 0xd5, 0x18, 0xc8, 0xc3, 0xcd, 0xba,
+          0x35, 0x20, 0x50, 0xca, 0xb0, 0x42, 0x58, 0xbb, 0xc0, 0x6f, 0x2b, 0x50, 0xce, 0x0f, 0x58, 0xae, 0x12, 0x36, 0x7c, 0x6d, 0x70, 0xc4, 0x5c, 0x12,
+          0x25, 0x91, 0x5b, 0x94, 0x6c, 0x64, 0x18, 0x04, 0xd5, 0xe3, 0xe6, 0x61, 0x22, 0x4f, 0x2b, 0x35, 0x90, 0x15, 0x07, 0x32, 0x51, 0xcb, 0x9f, 0x83,
+          0x85, 0x22, 0x3a, 0x5d, 0x2e, 0xef, 0x28, 0x61, 0x4c, 0x15, 0x23, 0x0e, 0x44, 0x8b, 0x91, 0x87, 0x45, 0x90, 0x9f, 0x96, 0x59, 0x59, 0x28, 0x92,
+          0x6b, 0xb6, 0x07, 0x69, 0xc7, 0x91, 0xba, 0xf3, 0x60, 0xb8, 0x81, 0xf4, 0xf6, 0x9e, 0x9d, 0x7a, 0x27, 0x42, 0xee, 0x7c, 0xc6, 0x1b, 0x76, 0x1a,
+          0x29, 0xef, 0x50, 0xa3, 0xbc, 0x0b, 0xe7, 0x35, 0xdf, 0xe0, 0xef, 0x0d, 0xea, 0x64, 0x7c, 0x35, 0xb2, 0x8b, 0x40, 0x92, 0xec, 0xad, 0x79, 0x41,
+          0xd1, 0xa0, 0x98, 0x09, 0x4a, 0xe3, 0x83, 0x2a, 0x30, 0xfe, 0x01, 0x87, 0xb8, 0x2c, 0x88, 0xf9, 0x6b, 0x70, 0x98, 0x3c, 0x8b, 0x1a, 0x03, 0xba,
+          0x0e, 0xb3, 0x7a, 0xf3, 0x9d, 0xb9, 0x7a, 0x63, 0xe2, 0x22, 0x60, 0x78, 0xe4, 0x07, 0xc4, 0x60, 0x39, 0x4d, 0xc1, 0x15, 0xd8, 0x3c, 0xbf, 0x30,
+          0x84, 0x01, 0xfd, 0x53, 0xbc, 0x8f, 0x02, 0x67, 0x0f, 0x6e, 0xe4, 0xf6, 0xcc, 0xa8, 0x04, 0x55, 0x73, 0xfb, 0xee, 0xb1, 0x40, 0x4c, 0xcd, 0x7e,
+          0xdb, 0x8b, 0xe3, 0x81, 0x58, 0xfa, 0x2d, 0xfb, 0xe3, 0x42, 0x76, 0x04, 0x0e, 0xac, 0xfa, 0xac, 0x30, 0x89, 0x8a, 0x7b, 0x6a, 0x16, 0xbe, 0xd3,
+          0x54, 0xf3, 0x73, 0xd5, 0x9b, 0x8e, 0x35, 0x95, 0x80, 0x88, 0x17, 0x34, 0xe9, 0xac, 0x0f, 0x7e, 0x28, 0x24, 0xac, 0x33, 0x82, 0x2b, 0x50, 0x25,
+          0x5b, 0x1e, 0x05, 0x93, 0xfe, 0x23, 0x85, 0xca, 0xac, 0xea, 0x0e, 0xc4, 0xd0, 0x52, 0x0d, 0xcb, 0x05, 0xe2, 0xc1, 0x8f, 0x84, 0x44, 0x87, 0xb6,
+          0xbc, 0x9f, 0xf0, 0x13, 0x1b, 0x73, 0x92, 0x1b, 0x58, 0xf9, 0x70, 0x8e, 0x2e, 0x50, 0xd6, 0x5f, 0xd6, 0x82, 0xb1, 0xbb, 0x4f, 0x81, 0xc9, 0x13,
+          0x93, 0x39, 0x65, 0xa1, 0xad, 0x67, 0x0f, 0xdf, 0xa8, 0xca, 0xc3, 0x4a, 0xef, 0x9c, 0x9f, 0xcc, 0x2f, 0x1a, 0xb6, 0x39, 0xac, 0xca, 0xfd, 0x96,
+          0xaf, 0xa1, 0xff, 0xc0, 0x50, 0xde, 0xe7, 0x2d, 0x3f, 0x4c, 0x8f, 0xe1, 0xaa, 0x90, 0xcd, 0xba, 0x2a, 0x0f, 0x6d, 0x77, 0x12, 0x5b, 0xfa, 0xfa,
+          0x6a, 0x8d, 0xa4, 0x1a, 0x63, 0xa8, 0xa5, 0x3a, 0xaa, 0x70, 0xc6, 0x4a, 0x85, 0x64, 0xba, 0x94, 0x7b, 0x0c, 0xa5, 0x51, 0x55, 0xd3, 0x8b, 0x5b,
+          0xbf, 0x4f, 0x05, 0x68, 0x33, 0x1e, 0xcb, 0x3a, 0x98, 0xea, 0x6f, 0x66, 0x27, 0x34, 0x76, 0xd7, 0x96, 0xaf, 0x2a, 0xb8, 0x1a, 0xb3, 0x3c, 0x70,
+          0xbb, 0x0a, 0x9a, 0x67, 0x95, 0x7a, 0x6b, 0xbf, 0x27, 0x67, 0x39, 0x29, 0x58, 0xaa, 0x5e, 0x35, 0xd6, 0xce, 0x57, 0x61, 0x8c, 0x7a, 0x58, 0xa3,
+          0x73, 0xdb, 0xfd, 0xa6, 0x87, 0x8d, 0x0d, 0xcb, 0x97, 0x07, 0x7f, 0x96, 0x2c, 0xac, 0xdb, 0xc7, 0x40, 0xac, 0x13, 0x67, 0x23, 0xfc, 0x6a, 0xd1,
+          0xd5, 0xac, 0x94, 0x3a, 0x79, 0x1c, 0x28, 0xa1, 0x3f, 0x39, 0xee, 0x08, 0x19, 0x57, 0x11, 0x01, 0xd8, 0x12, 0x08, 0xd2, 0x72, 0x43, 0xc6, 0x58,
+          0x76, 0x16, 0xcf, 0xce, 0xe8, 0x93, 0x3a, 0xce, 0xf8, 0x9e, 0x55, 0x63, 0xbc, 0x54, 0x07, 0xb3, 0x29, 0x71, 0xe9, 0x7d, 0x75, 0xde, 0x6c, 0x38,
+          0x7b, 0x47, 0x78, 0x31, 0x76, 0x3b, 0x34, 0xaf, 0x01, 0xf5, 0x23, 0x31, 0x12, 0x89, 0xea, 0xa4, 0xa0, 0xea, 0xfa, 0x20, 0xbd, 0x77, 0x61, 0x1d,
+          0x5a, 0x63, 0xc1, 0x46, 0x4e, 0x71, 0xae, 0xf6, 0x36, 0x02, 0xa2, 0x1d, 0xc3, 0x84, 0x7d, 0x0c, 0xa3, 0x32, 0x2e, 0x95, 0xb3, 0x08, 0x8d, 0x59,
+          0x48, 0x0b, 0xb1, 0xfd, 0xb1, 0xf6, 0x77, 0x90, 0xd1, 0x58, 0xd5, 0x09, 0xcb, 0x8c, 0x57, 0x37, 0x25, 0xaf, 0x03, 0xa8, 0x3f, 0x32, 0x5a, 0xa8,
+          0x79, 0x34, 0xb4, 0xd4, 0xd3, 0x79, 0xb4, 0xe7, 0x99, 0x1a, 0x69, 0x79, 0x7e, 0x6d, 0x45, 0x4b, 0x01, 0xbc, 0xba, 0x16, 0x03, 0x9a, 0xd0, 0xef,
+          0xcf, 0xe4, 0x7b, 0x7b, 0xcd, 0xde, 0x19, 0xfe, 0x61, 0x42, 0xcf, 0x43, 0x98, 0xe7, 0xb0, 0x8e, 0x4a, 0x80, 0x82, 0x3a, 0x81, 0x32, 0x9b, 0xbd,
+          0xdc, 0x37, 0x3d, 0x7c, 0x4d, 0x2b, 0x21, 0x9b, 0x72, 0xb0, 0x0c, 0x1c, 0xa0, 0xfb, 0x93, 0x66, 0xc4, 0x50, 0x7a, 0x37, 0x17, 0xcd, 0xca, 0x68,
+          0x7a, 0x59, 0x7a, 0x9a, 0xcb, 0x58, 0xa8, 0x9c, 0x0f, 0xd7, 0x1f, 0x19, 0x46, 0x31, 0xba, 0xb7, 0xbf, 0xca, 0xd8, 0x0c, 0xc2, 0x5d, 0x42, 0x8c,
+          0x33, 0xa8, 0xaf, 0x68, 0xfa, 0x48, 0x77, 0x1d, 0x1d, 0x6f, 0xc2, 0x20, 0x05, 0x72, 0x4a, 0xa6, 0x3f, 0x68, 0x34, 0x2b, 0x9d, 0xec, 0x76, 0xdb,
+          0xd4, 0xc8, 0xd2, 0x41, 0x2a, 0x08, 0x51, 0xf5, 0xab, 0xad, 0x45, 0x2e, 0x09, 0x77, 0xc5, 0xde, 0x56, 0x55, 0x9e, 0x26, 0x1a, 0x19, 0x0b, 0x44,
+          0x1a, 0x53, 0xb1, 0xa4, 0x4d, 0xa0, 0x90, 0x3f, 0x55, 0x73, 0x73, 0xa2, 0xa3, 0x99, 0x74, 0x77, 0xf7, 0xb0, 0x37, 0xdd, 0xca, 0xaa, 0xae, 0x1e,
+          0x58, 0x34, 0x60, 0xd6, 0x56, 0x0f, 0x62, 0x5c, 0x4b, 0x1a, 0xe0, 0x85, 0x39, 0xda, 0x29, 0x16, 0x5d, 0x92, 0x3a, 0x27, 0xa7, 0x82, 0xee, 0x34,
+          0x1b, 0x48, 0x0e, 0x93, 0x9b, 0x6d, 0xc8, 0x34, 0xfa, 0x0e, 0x4d, 0xcb, 0xce, 0xfe, 0x21, 0x0e, 0xa3, 0xd3, 0xc0, 0xaa, 0xcb, 0xe2, 0xb3, 0x5e,
+          0x2c, 0xb0, 0xcc, 0xf9, 0xf9, 0x49, 0xbe, 0x6a, 0x90, 0x41, 0x7e, 0x38, 0x98, 0x86, 0x31, 0x0a, 0x79, 0xb1, 0x7f, 0x16, 0x31, 0x0d, 0x4d, 0x22,
+          0x7a, 0xf9, 0xdc, 0x75, 0x8a, 0xf1, 0x78, 0x00, 0xd2, 0x1f, 0x7f, 0xaa, 0xc9, 0x57, 0xb3, 0x38, 0xe0, 0xfd, 0x12, 0x68, 0x47, 0x46, 0x3b, 0x75,
+          0x63, 0x65, 0x09, 0x91, 0xf4, 0xaf, 0x47, 0x10, 0x9b, 0xc0, 0x37, 0x26, 0x91, 0x2f, 0x8b, 0x1d, 0x2d, 0xbc, 0xa9, 0xf5, 0xde, 0xba, 0xe9, 0x63,
+          0xe5, 0x4e, 0x72, 0x39, 0x4a, 0x06, 0x0f, 0xe8, 0x05, 0x13, 0xaf, 0xad, 0x8c, 0xd8, 0xfd, 0x94, 0x7e, 0x37, 0x84, 0x1b, 0xf5, 0x87, 0x43, 0x9b,
+          0x73, 0x86, 0xf1, 0xaa, 0x8f, 0xf4, 0x5a, 0xdc, 0xe3, 0x4e, 0xb8, 0x13, 0x5d, 0xb3, 0x02, 0x51, 0x51, 0x4b, 0x6a, 0x40, 0xd6, 0x94, 0xfc, 0xdc,
+          0x2f, 0x0e, 0xc7, 0x17, 0xa2, 0xd8, 0x20, 0x4c, 0x57, 0x03, 0xcd, 0xca, 0x66, 0xbd, 0xc0, 0x19, 0x90, 0x8c, 0xc1, 0x8d, 0xd0, 0x77, 0x15, 0x1c,
+          0x03, 0x59, 0xc1, 0x1c, 0x66, 0x22, 0x62, 0xfc, 0x25, 0x85, 0x66, 0xa4, 0xdf, 0x5f, 0x45, 0x7e, 0xaa, 0x8b, 0xd9, 0xf5, 0xf6, 0xac, 0x67, 0x17,
+          0x54, 0xf7, 0x5e, 0x49, 0x72, 0x03, 0x38, 0x44, 0x84, 0xac, 0xca, 0x0a, 0xcb, 0xc4, 0xcb, 0x74, 0xf9, 0x68, 0x89, 0x1b, 0x33, 0x10, 0x3a, 0x31,
+          0x4b, 0x96, 0x37, 0x37, 0x92, 0x76, 0x4e, 0xd6, 0x2a, 0xf4, 0xef, 0x60, 0xa9, 0x5c, 0xab, 0x92, 0xbc, 0x1e, 0x90, 0xcf, 0xc6, 0x16, 0xb1, 0x9d,
+          0x76, 0x4b, 0x37, 0xb3, 0x63, 0x8f, 0x9b, 0x44, 0x92, 0x17, 0x11, 0x31, 0x8e, 0xf3, 0x87, 0x11, 0xc9, 0xc1, 0xd1, 0xb6, 0xfd, 0x45, 0x56, 0x64,
+          0xdb, 0xe3, 0x08, 0x59, 0x55, 0xc4, 0x6d, 0xd8, 0x29, 0xf5, 0x32, 0x36, 0x50, 0x5c, 0x0e, 0xe3, 0x23, 0xe1, 0xd9, 0xe6, 0x82, 0x93, 0xde, 0x67,
+          0x43, 0x40, 0xbf, 0x14, 0x26, 0x3f, 0x38, 0x15, 0x5f, 0x70, 0xf1, 0xf4, 0x18, 0x16, 0xd7, 0x5d, 0x29, 0x7e, 0xa2, 0xb2, 0x0e, 0x51, 0x56, 0x6b,
+          0x2a, 0x6f, 0xf3, 0x57, 0xa7, 0x16, 0x22, 0xed, 0xeb, 0xa8, 0x1c, 0xa9, 0x59, 0xe5, 0xb8, 0x15, 0x0e, 0xb8, 0x18, 0xe7, 0x7b, 0x8b, 0x3b, 0xaa,
+          0x56, 0x75, 0x65, 0xd8, 0xe0, 0xe3, 0xfc, 0x6a, 0x15, 0xfd, 0x7e, 0x42, 0x4e, 0x50, 0x9c, 0xdb, 0xca, 0xea, 0xfc, 0x38, 0xb2, 0x8b, 0x38, 0x23,
+          0x21, 0x9c, 0xd9, 0x9d, 0x29, 0x63, 0x9e, 0x61, 0x8a, 0x29, 0xc4, 0xdf, 0x93, 0x7b, 0x9a, 0x30, 0xf0, 0x28, 0x83, 0xf6, 0xa3, 0xbb, 0xd4, 0x03,
+          0x58, 0x1b, 0xc9, 0xbe, 0x79, 0xe4, 0x0d, 0x34, 0xd4, 0xdf, 0x33, 0x6a, 0x13, 0xd9, 0x96, 0xab, 0x53, 0x0e, 0xe8, 0x99, 0xd4, 0x1c, 0xae, 0x35,
+          0x2b, 0x23, 0x9c, 0x31, 0xa4, 0x77, 0x53, 0x1d, 0x91, 0x8e, 0x55, 0x8a, 0x7d, 0xb4, 0xb9, 0xca, 0x76, 0x72, 0x7d, 0xdc, 0xf1, 0x81, 0x23, 0x78,
+          0x4b, 0x9a, 0x7a, 0xcf, 0xfb, 0x05, 0xa7, 0x56, 0x6a, 0x3b, 0x1c, 0x94, 0x0c, 0xd3, 0x56, 0xdf, 0x19, 0xc4, 0x03, 0x6f, 0x29, 0x48, 0x1e, 0x33,
+          0x83, 0xd3, 0x33, 0xdc, 0xe7, 0x15, 0x07, 0x2c, 0x9c, 0xbf, 0x29, 0x9b, 0x2d, 0xf8, 0x0c, 0x7d, 0x8a, 0x4f, 0xdb, 0xe0, 0xf3, 0xf9, 0xae, 0x7d,
+          0xe4, 0x7c, 0x64, 0xa3, 0xdf, 0x5c, 0xbf, 0x60, 0x53, 0xe0, 0x1d, 0xc9, 0xda, 0xcf, 0x42, 0x53, 0xb1, 0x87, 0x4e, 0xdc, 0xae, 0x1e, 0x1b, 0x7e,
+          0xc1, 0x84, 0x2d, 0xd3, 0x48, 0x75, 0xfe, 0x48, 0xd9, 0x92, 0x54, 0x1f, 0xae, 0xcd, 0x79, 0x8e, 0x13, 0x1c, 0xe5, 0x0c, 0xb3, 0xe8, 0x74, 0x86,
+          0x73, 0xc3, 0x1a, 0xab, 0x1d, 0xce, 0xdb, 0xca, 0x05, 0xa9, 0xfb, 0x06, 0xe2, 0x46, 0x20, 0x1e, 0xc3, 0x1d, 0xeb, 0x55, 0x7d, 0x4c, 0x73, 0x1c,
+          0xf8, 0x11, 0x8c, 0x39, 0x18, 0x4b, 0x79, 0xbf, 0xb3, 0x6f, 0x5e, 0x5d, 0xbe, 0x0a, 0x93, 0x5d, 0x8c, 0xf6, 0xc2, 0xf3, 0xf2, 0xd3, 0x8d, 0xc4,
+          0x93, 0xf7, 0x2d, 0xd8, 0x3f, 0x3c, 0x65, 0x61, 0xb0, 0x42, 0xfa, 0x03, 0x20, 0x48, 0xb1, 0xed, 0x6d, 0xd3, 0xa7, 0xe6, 0x8c, 0xaa, 0x08, 0x51,
+          0xc0, 0x62, 0x89, 0x5b, 0x10, 0x7b, 0x8e, 0x88, 0x25, 0xd9, 0x6b, 0x7e, 0x0c, 0x8a, 0xe0, 0x5f, 0x70, 0xd1, 0x85, 0xb1, 0x46, 0x61, 0x9d, 0xce,
+          0xd5, 0x7b, 0xdd, 0x5f, 0x25, 0xc6, 0xb2, 0xa2, 0x7e, 0xb9, 0x62, 0xea, 0xe6, 0xe0, 0x7b, 0xdd, 0x02, 0xaa, 0xbb, 0xb7, 0xf7, 0x64, 0x2f, 0x37,
+          0x65, 0x04, 0xed, 0xd9, 0x14, 0x20, 0x0e, 0x1d, 0xac, 0x80, 0x91, 0xef, 0xdd, 0x56, 0x3c, 0xd1, 0x66, 0x0e, 0xb7, 0x19, 0xba, 0xac, 0x40, 0xb8,
+          0x8b, 0x14, 0xda, 0x3d, 0xb3, 0xe1, 0x5f, 0x79, 0x55, 0xd1, 0x67, 0x37, 0x49, 0x45, 0x3c, 0x95, 0x2e, 0x8e, 0x2f, 0xe4, 0x9c, 0x80, 0x60, 0xe0,
+          0xe9, 0xeb, 0x33, 0x39, 0x0e, 0x24, 0x55, 0x37, 0x4f, 0xaf, 0x2c, 0x5a, 0xf6, 0xec, 0xda, 0xa0, 0x18, 0x0e, 0xea, 0x73, 0xec, 0xce, 0xe9, 0xfa,
+          0x3a, 0xf3, 0xb9, 0xc6, 0xb8, 0xff, 0x3a, 0xf2, 0x94, 0xcb, 0x75, 0x75, 0x1c, 0x93, 0x4a, 0xce, 0x11, 0xea, 0xbd, 0xfd, 0xd0, 0xb2, 0x6d, 0x31,
+          0xec, 0x06, 0x9c, 0xaf, 0xb7, 0x9e, 0x89, 0x36, 0x2a, 0x72, 0x64, 0x3c, 0xb2, 0x71, 0x37, 0xac, 0x62, 0xf4, 0xc8, 0x5c, 0x3d, 0x3d, 0x40, 0x31,
+          0x13, 0x59, 0x46, 0x5b, 0x81, 0x00, 0x86, 0x2c, 0x17, 0xd4, 0x9c, 0x3d, 0x3f, 0x4c, 0x6b, 0x81, 0x46, 0x77, 0x33, 0x34, 0x34, 0xaa, 0xa7, 0x3c,
+          0x46, 0x93, 0x48, 0x13, 0x82, 0x92, 0xe1, 0x13, 0x73, 0x50, 0x72, 0xca, 0xe9, 0xb9, 0x19, 0xde, 0x17, 0x37, 0x84, 0xd8, 0x08, 0xad, 0x37, 0xaf,
+          0x74, 0x9b, 0x07, 0x21, 0x29, 0x44, 0x81, 0x82, 0xdb, 0x0b, 0xbc, 0x20, 0x21, 0xb2, 0x1a, 0xec, 0x4b, 0x3f, 0xf1, 0x7d, 0x54, 0xdc, 0x9a, 0x41,
+          0x6c, 0x21, 0x3a, 0xb6, 0x68, 0xc9, 0xb3, 0xac, 0xb0, 0x92, 0x52, 0x1d, 0x92, 0x11, 0xb2, 0xca, 0xf4, 0x5a, 0xd9, 0x0b, 0x3f, 0xda, 0xf9, 0xa2,
+          0xc5, 0x77, 0x2e, 0x59, 0x61, 0x19, 0x8b, 0x61, 0xf8, 0x83, 0x36, 0xe3, 0x6f, 0xf6, 0x41, 0x24, 0xa5, 0x7d, 0xe1, 0x82, 0x3e, 0x32, 0x5d, 0x40,
+          0x0e, 0xb6, 0x32, 0xaa, 0x25, 0xb2, 0x2a, 0xbb, 0x5b, 0xab, 0x93, 0x8a, 0x0a, 0x68, 0xac, 0x13, 0x9f, 0x82, 0x3f, 0x7a, 0x60, 0xe3, 0x6f, 0xa5,
+          0x4b, 0x14, 0xff, 0x58, 0xc9, 0x53, 0xe1, 0x2a, 0x01, 0x69, 0x60, 0x8b, 0x7a, 0xc3, 0x1c, 0x0c, 0x83, 0xb4, 0x8d, 0x4e, 0xc7, 0xd6, 0x5f, 0x68,
+          0xcc, 0xed, 0x37, 0xdc, 0x07, 0xdb, 0x75, 0xf4, 0xc5, 0x44, 0xf3, 0x4b, 0x6d, 0x77, 0x23, 0x68, 0xd4, 0x09, 0x12, 0xd0, 0x5b, 0x49, 0x09, 0x89,
+          0x41, 0xef, 0xeb, 0xaf, 0xe2, 0x63, 0x96, 0x9f, 0x18, 0xee, 0x34, 0x1c, 0xd9, 0x95, 0x19, 0x44, 0xb5, 0xe2, 0x78, 0x9c, 0xbb, 0xa6, 0x44, 0xa3,
+          0x08, 0x14, 0x9d, 0xdc, 0x2c, 0x38, 0x42, 0x51, 0x40, 0xb8, 0xc4, 0x6c, 0xdb, 0x19, 0x2d, 0xc3, 0x34, 0x23, 0x31, 0xae, 0x19, 0xb7, 0x7c, 0xff,
+          0x56, 0xc5, 0x43, 0x2b, 0xf0, 0x84, 0x58, 0xd9, 0xe7, 0x1a, 0x83, 0xf1, 0x33, 0xe2, 0xb6, 0xa6, 0x9e, 0x75, 0xd2, 0xe0, 0x29, 0x92, 0x26, 0xe3,
+          0xa0, 0xa1, 0x98, 0x91, 0x83, 0x41, 0x93, 0x8a, 0x3f, 0x3e, 0xde, 0x69, 0x24, 0x66, 0xf4, 0x9b, 0xf4, 0xb3, 0x0a, 0xec, 0x49, 0x18, 0x06, 0xaf,
+          0x26, 0x55, 0xa5, 0x88, 0x64, 0xb6, 0x97, 0xce, 0x73, 0x29, 0xd4, 0x33, 0xb3, 0x98, 0xda, 0xe6, 0xed, 0x8b, 0xc0, 0x45, 0x75, 0x5f, 0x29, 0xa1,
+          0x43, 0x4a, 0x42, 0xf2, 0xe2, 0xc9, 0x8d, 0x3b, 0x4a, 0xec, 0xeb, 0xcd, 0x1d, 0x63, 0xba, 0x91, 0x59, 0x90, 0x59, 0x33, 0xd6, 0xc1, 0x94, 0x22,
+          0xb3, 0x95, 0x06, 0xc1, 0xf4, 0x0e, 0x17, 0x21, 0xf6, 0x85, 0x5c, 0x92, 0x8b, 0x30, 0xf6, 0x0f, 0x95, 0x26, 0x54, 0xa8, 0xd4, 0x1c, 0xe0, 0x6d,
+          0x12, 0x7a, 0x79, 0xf8, 0xb6, 0x09, 0x45, 0x39, 0xba, 0x33, 0xb1, 0x3c, 0xf8, 0xfa, 0xdd, 0xd7, 0x6d, 0x35, 0x0d, 0x44, 0xfc, 0x86, 0x88, 0x0d,
+          0x9c, 0xd8, 0xc2, 0xb6, 0xae, 0x91, 0x46, 0x4d, 0xe8, 0xab, 0x4f, 0x78, 0x45, 0x16, 0x37, 0xd5, 0xdf, 0xbb, 0x66, 0x75, 0x03, 0x24, 0x28, 0x01,
+          0x07, 0x53, 0x79, 0xfa, 0xf1, 0xa8, 0x7b, 0x66, 0x3d, 0xfd, 0x10, 0xd4, 0xa2, 0x2d, 0xcb, 0xde, 0x3e, 0x80, 0xdc, 0xfe, 0x97, 0x56, 0xc8, 0xb4,
+          0x1f, 0x35, 0x81, 0x88, 0xbc, 0xe9, 0x0b, 0x71, 0xea, 0x57, 0xc2, 0xd8, 0xbf, 0xd6, 0x7b, 0x69, 0x9e, 0x31, 0xe3, 0xe7, 0x52, 0xb9, 0xc8, 0x8e,
+          0xbd, 0x8b, 0xf9, 0x6b, 0xa9, 0xfe, 0xf8, 0x63, 0x6f, 0x5e, 0x19, 0xe4, 0x51, 0x2e, 0x54, 0xec, 0xd0, 0x4e, 0xe6, 0x21, 0xa5, 0xa6, 0xd2, 0x1d,
+          0x9b, 0x96, 0x69, 0x29, 0xbb, 0x78, 0xde, 0xbc, 0xe0, 0xcd, 0xd4, 0x78, 0x5f, 0xdc, 0x2e, 0x22, 0xfe, 0xc7, 0xd7, 0x45, 0xfc, 0xe8, 0x3d, 0xa6,
+          0xb4, 0x34, 0x9a, 0xbf, 0x46, 0x95, 0xfa, 0x22, 0xbb, 0x30, 0x54, 0x47, 0x9b, 0x74, 0x73, 0xd7, 0x65, 0x95, 0x1b, 0x7a, 0x1b, 0x7e, 0xc2, 0x3c,
+          0x7d, 0xaa, 0xd9, 0x44, 0xd4, 0x15, 0x55, 0x69, 0x5a, 0x87, 0x06, 0x0a, 0x2b, 0x4d, 0x83, 0xcd, 0x22, 0xc4, 0xf0, 0x4f, 0x0d, 0xec, 0x44, 0x0e,
+          0xdc, 0xa1, 0x1a, 0xad, 0x55, 0x64, 0x3b, 0x76, 0x56, 0x75, 0xd6, 0x1d, 0x32, 0x91, 0xce, 0xda, 0x2e, 0x9d, 0xee, 0x61, 0xb4, 0xbc, 0x81, 0x5e,
+          0x8c, 0xb0, 0x94, 0xed, 0x28, 0xc7, 0x7c, 0xd0, 0x67, 0xf8, 0x5a, 0xf1, 0x18, 0x03, 0x39, 0x2e, 0xb6, 0x3d, 0x2b, 0x64, 0xb6, 0xbc, 0x31, 0xe2,
+          0x7e, 0x26, 0x2f, 0xad, 0xf8, 0xd5, 0x7f, 0xf2, 0x67, 0x11, 0xf0, 0x3c, 0x73, 0x74, 0xa9, 0x41, 0xa7, 0x7d, 0x45, 0xb8, 0x9f, 0x53, 0x72, 0x20,
+          0x96, 0x76, 0x82, 0x2b, 0x0d, 0x4f, 0x28, 0xbb, 0x04, 0xd9, 0x6c, 0x68, 0xd1, 0x1b, 0xd8, 0xdc, 0x8c, 0xda, 0xab, 0x24, 0x33, 0xd4, 0x0f, 0x2b,
+          0xeb, 0x29, 0x7a, 0x67, 0x2e, 0x18, 0x72, 0x25, 0x3a, 0x27, 0x7d, 0xc0, 0xe1, 0xb2, 0xc9, 0xad, 0x4a, 0xa9, 0x6e, 0x1e, 0x71, 0x82, 0x2b, 0xf4,
+          0xfe, 0x5d, 0xdd, 0x12, 0xcc, 0x14, 0xe9, 0x28, 0xb4, 0xcc, 0x16, 0x5a, 0xfa, 0x80, 0x93, 0xd4, 0xbc, 0xd4, 0xf1, 0x9d, 0x3b, 0x34, 0x5f, 0xd0,
+          0xd0, 0x0a, 0x1e, 0xdb, 0xc5, 0x6b, 0xdb, 0x2b, 0x32, 0xeb, 0xea, 0xca, 0xcc, 0xca, 0xdf, 0x9a, 0xa9, 0xae, 0x8d, 0x4d, 0x7e, 0xe9, 0x43, 0xb1,
+          0x95, 0x00, 0xd2, 0xcc, 0x4c, 0x8d, 0x07, 0xdd, 0x9f, 0x68, 0x48, 0x8e, 0xd7, 0x95, 0xa3, 0xa9, 0xbd, 0xcc, 0x4f, 0x93, 0x29, 0xe8, 0x1f, 0xc3,
+          0x28, 0x55, 0xad, 0x6c, 0x3d, 0xa0, 0x07, 0xe4, 0xe1, 0x5c, 0x7c, 0xa2, 0x13, 0x20, 0xa3, 0x30, 0x73, 0xd8, 0x3a, 0xec, 0x16, 0xc6, 0xba, 0xea,
+          0xe4, 0x3c, 0x9a, 0x75, 0x97, 0xbb, 0xe1, 0x99, 0x1a, 0x88, 0x1d, 0xc7, 0x1a, 0x61, 0xb1, 0x2a, 0xb7, 0x72, 0x8c, 0xaf, 0xb6, 0x28, 0xba, 0x70,
+          0xbb, 0x3c, 0xb4, 0xf3, 0x77, 0xe7, 0x48, 0x93, 0x21, 0x0f, 0xd5, 0x81, 0x92, 0x92, 0xd4, 0xa1, 0xe1, 0xb9, 0xa8, 0x6d, 0x98, 0x85, 0x0c, 0x62,
+          0x19, 0x6f, 0xc7, 0xcc, 0x23, 0x41, 0x43, 0x17, 0x5c, 0x28, 0x85, 0xf8, 0x54, 0x2d, 0xa6, 0xf0, 0x94, 0x3a, 0x61, 0x57, 0x1e, 0x00, 0x97, 0x94,
+          0x30, 0xf2, 0xb6, 0x2b, 0x62, 0x2c, 0x68, 0xd1, 0x33, 0xbb, 0xf3, 0xe2, 0xc1, 0xf3, 0x76, 0x50, 0x47, 0x28, 0xf1, 0xda, 0x7b, 0xd6, 0x83, 0x6b,
+          0x2e, 0x6b, 0x92, 0x65, 0x47, 0xd7, 0x0c, 0x7d, 0xcb, 0x3f, 0x91, 0x98, 0xc5, 0x58, 0x2c, 0x71, 0xc0, 0xbe, 0xc5, 0xd9, 0x42, 0x09, 0x9c, 0xea,
+          0x0b, 0x99, 0xa4, 0xb5, 0xdb, 0x14, 0xdc, 0x27, 0x13, 0xda, 0xbe, 0x80, 0xd4, 0x24, 0x6b, 0xc2, 0xd6, 0x79, 0x30, 0xd0, 0xeb, 0x30, 0x77, 0xf5,
+          0x30, 0xe9, 0x98, 0x36, 0x5f, 0x61, 0x71, 0x59, 0xbd, 0xda, 0x67, 0x97, 0xc9, 0x21, 0xc7, 0xde, 0x02, 0x99, 0x14, 0x8d, 0x17, 0xef, 0x27, 0x46,
+          0x2b, 0xd8, 0x4b, 0x8c, 0xab, 0x77, 0x1b, 0x5c, 0xeb, 0x08, 0xba, 0xc5, 0x5a, 0x6b, 0xde, 0x7c, 0xc5, 0xcd, 0xe8, 0x0d, 0x57, 0xc2, 0x34, 0xa6,
+          0x91, 0x7c, 0xaa, 0xeb, 0x15, 0x22, 0x0e, 0x79, 0x23, 0x65, 0xfd, 0x24, 0xbc, 0x8a, 0x44, 0x62, 0x83, 0x94, 0xbe, 0xaf, 0xe7, 0x4e, 0x0b, 0xdd,
+          0xb3, 0x80, 0xc5, 0x5d, 0x05, 0x03, 0x6b, 0xd7, 0x64, 0x64, 0x4e, 0xfd, 0xf3, 0x46, 0x6d, 0x56, 0xed, 0x12, 0xf4, 0xad, 0xbd, 0xfd, 0x8e, 0x4e,
+          0xdf, 0x20, 0x39, 0xf8, 0x0a, 0xb8, 0x21, 0x71, 0xe4, 0x60, 0x4c, 0x13, 0xe3, 0x78, 0x47, 0x16, 0xbd, 0xf8, 0x74, 0x78, 0x26, 0x92, 0x00, 0x60,
+          0x5b, 0x59, 0x7e, 0x59, 0x68, 0xaf, 0x2b, 0x57, 0x49, 0x86, 0x5a, 0x14, 0x2f, 0xbe, 0x93, 0x97, 0x3d, 0x43, 0xf1, 0xc1, 0x04, 0x74, 0x47, 0xc9,
+          0x8e, 0x7b, 0x4a, 0x82, 0x02, 0x86, 0x39, 0xa2, 0xcf, 0xe2, 0xbc, 0x70, 0xa8, 0xd4, 0x33, 0x77, 0xee, 0x2a, 0x98, 0x2a, 0x3f, 0xc8, 0x0b, 0x58,
+          0x04, 0x35, 0xde, 0x1b, 0xa7, 0x68, 0xee, 0x3a, 0xb3, 0x2a, 0x0e, 0x8a, 0xd0, 0xfa, 0xce, 0x5c, 0xcf, 0xe7, 0x9e, 0x89, 0xc7, 0x9e, 0xeb, 0xf5,
+          0xee, 0xec, 0x10, 0x0f, 0xf3, 0x62, 0x2c, 0x1f, 0x67, 0x3d, 0x81, 0x6d, 0xe7, 0x1e, 0x1b, 0x60, 0x9a, 0x90, 0x2e, 0x61, 0x51, 0x12, 0xeb, 0x97,
+          0x28, 0xb9, 0x02, 0x66, 0xb9, 0x9b, 0x59, 0x86, 0xa4, 0xf1, 0x8e, 0x65, 0xae, 0xdd, 0xa5, 0xda, 0x46, 0x4d, 0xb0, 0xce, 0x0b, 0xe3, 0x03, 0xbf,
+          0x99, 0x0c, 0x4a, 0x38, 0xfe, 0x72, 0x67, 0x46, 0x36, 0x16, 0xa5, 0xac, 0xe2, 0xef, 0xcf, 0xcf, 0xcc, 0xf2, 0xa8, 0xc7, 0x9e, 0x82, 0x8e, 0x5e,
+          0x60, 0x8d, 0x09, 0xf7, 0x6d, 0x60, 0x9d, 0xea, 0xce, 0x60, 0x02, 0x0c, 0xd4, 0xbf, 0x6b, 0x1c, 0xf5, 0x81, 0xe7, 0x2b, 0x0b, 0x0f, 0xf2, 0xe4,
+          0xbf, 0xee, 0x9a, 0xe2, 0x0a, 0xd5, 0x6a, 0x00, 0x6a, 0x07, 0x0c, 0x17, 0x49, 0x5e, 0xb4, 0xc2, 0xea, 0x1a, 0x5e, 0xb8, 0x45, 0xdb, 0xec, 0xe8,
+          0x4b, 0x68, 0x8d, 0xf7, 0x12, 0x29, 0x94, 0x52, 0x97, 0xaf, 0x51, 0xb9, 0x34, 0x17, 0xc8, 0x46, 0x5a, 0xcb, 0xfe, 0x96, 0xcd, 0x3e, 0xeb, 0xc4,
+          0x66, 0x9f, 0x4a, 0xeb, 0xfd, 0xc9, 0xc2, 0x83, 0xff, 0x00, 0x4a, 0x42, 0xfe, 0x52, 0x73, 0x3a, 0x1b, 0xcb, 0xa3, 0xb7, 0xe1, 0xc9, 0xa1, 0xc4,
+          0xad, 0xed, 0x49, 0x23, 0xe8, 0x6a, 0xf0, 0xe5, 0x5b, 0x4f, 0x25, 0xa5, 0xc7, 0xa3, 0x64, 0xa4, 0xe9, 0xba, 0x20, 0x32, 0xac, 0x6c, 0xa6, 0x72,
+          0x43, 0x83, 0x7f, 0x5b, 0x27, 0x86, 0x9c, 0xb3, 0x00, 0x65, 0x14, 0x6c, 0xf7, 0x5d, 0x7f, 0xd1, 0xa0, 0xcd, 0x70, 0xf5, 0x1e, 0x19, 0x60, 0xff,
+          0x44, 0x51, 0x56, 0xbc, 0x6c, 0x33, 0x08, 0x37, 0xf7, 0x94, 0x43, 0xd3, 0x1d, 0x9d, 0x25, 0x27, 0xa3, 0x57, 0xfc, 0x30, 0x61, 0x5d, 0xd7, 0xd1,
+          0xf7, 0xcb, 0x8b, 0x86, 0x24, 0x09, 0x9d, 0xd4, 0xbe, 0x37, 0xcd, 0x59, 0x23, 0x6d, 0x66, 0x2d, 0x90, 0x0c, 0xe0, 0xd1, 0x13, 0x33, 0x67, 0x52,
+          0x92, 0xfa, 0x39, 0x09, 0x52, 0x85, 0xc9, 0x35, 0xd2, 0xc5, 0x0c, 0xee, 0xdb, 0xd9, 0xc9, 0x13, 0x37, 0xd1, 0x81, 0x3c, 0x38, 0xd6, 0xf4, 0x64,
+          0xac, 0x06, 0x07, 0x42, 0x36, 0xa4, 0xcb, 0x21, 0x26, 0x68, 0xd1, 0x50, 0x39, 0x47, 0xa0, 0x44, 0x19, 0x6a, 0x9b, 0x2a, 0x80, 0xe6, 0xe4, 0x33,
+          0x7b, 0xb8, 0x93, 0xd5, 0x09, 0x1c, 0xe8, 0xe5, 0x3c, 0x8b, 0xd5, 0xb3, 0xeb, 0xff, 0x32, 0xdc, 0x46, 0x98, 0xaa, 0x85, 0x06, 0xec, 0x8b, 0xb7,
+          0xb5, 0xc7, 0x29, 0xdc, 0xf4, 0xbf, 0x01, 0xbf, 0x24, 0x96, 0x2f, 0x6c, 0x41, 0x85, 0x8a, 0xe9, 0xf1, 0xf6, 0xdf, 0xfd, 0x4e, 0xb6, 0x9e, 0x59,
+          0x50, 0x0c, 0xba, 0xa1, 0x59, 0x65, 0x7a, 0x87, 0x1b, 0x97, 0x06, 0xc5, 0xd4, 0x44, 0x29, 0xea, 0x17, 0x65, 0xb2, 0xa3, 0x3f, 0x7e, 0x7d, 0xff,
+          0xe7, 0x87, 0xd7, 0x6f, 0xbf, 0xc4, 0xa7, 0xf3, 0xff, 0x06, 0xa6, 0xba, 0x9f, 0xf8, 0xb6, 0x94, 0x7c, 0xde, 0x98, 0xfc, 0xad, 0xe5, 0xea, 0xbd,
+          0x7a, 0x7f, 0xbf, 0xde, 0x1f, 0xbd, 0xcf, 0x3a, 0x8b, 0x67, 0xff, 0xf3, 0x17, 0xf7, 0xde, 0xf8, 0xe5, 0x6e, 0x79, 0xfe, 0x57, 0xe6, 0x4f, 0xd5,
+          0x57, 0xef, 0xf3, 0x33, 0x6c, 0xd9, 0xfd, 0x55, 0xc6, 0x4b, 0xf2, 0x89, 0xbf, 0x3e, 0x76, 0x7f, 0xf8, 0xb9, 0xdf, 0x16, 0x57, 0x1a, 0x7f, 0xfd,
+          0xe9, 0x2d, 0xf9, 0xfb, 0xdf, 0xdf, 0xba, 0x7f, 0x1f, 0xdd, 0x7f, 0x79, 0xcf, 0xe8, 0xd1, 0xe7, 0x26, 0xfb, 0xef, 0x49, 0x3f, 0xdd, 0x76, 0xd9,
+          0x8f, 0xea, 0x0a, 0xdf, 0xae, 0xc5, 0xde, 0xf8, 0xb8, 0x19, 0x53, 0xc0, 0x87, 0xf5, 0xdb, 0x97, 0xf7, 0xd8, 0xfd, 0x5a, 0xe7, 0x8b, 0x34, 0xd7,
+          0x8b, 0x2b, 0x57, 0xd7, 0xb8, 0xe0, 0x04, 0x9f, 0xbd, 0x59, 0x5e, 0x56, 0x45, 0xe2, 0x85, 0xdd, 0xb8, 0xb4, 0x2b, 0x73, 0x2e, 0x15, 0x46, 0xb9,
+          0x4c, 0x4f, 0x36, 0x2e, 0x96, 0x1b, 0x0e, 0xc0, 0x22, 0x7c, 0x57, 0x2e, 0x63, 0xe0, 0xc0, 0xa5, 0xa2, 0x29, 0x9f, 0x5f, 0xcd, 0xde, 0x48, 0x00,
+          0xdf, 0xbc, 0xe5, 0x38, 0x86, 0x79, 0x8e, 0x9d, 0xa3, 0x38, 0x77, 0xc8, 0xc2, 0x0f, 0x21, 0xb0, 0x2b, 0xbb, 0x1d, 0xe2, 0x7e, 0xa0, 0x3e, 0xe8,
+          0x4d, 0xb8, 0x5a, 0x02, 0x04, 0x42, 0xde, 0xd9, 0x8b, 0x1d, 0x02, 0x93, 0x38, 0x00, 0x13, 0x04, 0xc4, 0x39, 0xd6, 0x9f, 0x9e, 0x9c, 0xf5, 0xd5,
+          0x4f, 0x2b, 0x7d, 0x7b, 0xa1, 0xad, 0xc7, 0x7c, 0x91, 0x47, 0x04, 0x66, 0xe2, 0xb5, 0xfd, 0xde, 0xd7, 0x57, 0x26, 0xa4, 0x78, 0xb7, 0xb8, 0xa8,
+          0x02, 0x81, 0xa3, 0x47, 0xb0, 0x98, 0xf5, 0x83, 0xc4, 0xdd, 0xa9, 0xbb, 0xee, 0xf5, 0x5b, 0x82, 0xa8, 0x4d, 0xd5, 0xc7, 0x05, 0xa6, 0x41, 0x08,
+          0x26, 0x35, 0x7b, 0x39, 0xb0, 0xe6, 0x16, 0xc2, 0x69, 0xc5, 0x77, 0x79, 0x59, 0x8d, 0xec, 0x2a, 0x3d, 0x13, 0x01, 0xcb, 0xcc, 0x7a, 0x8b, 0x43,
+          0xa0, 0xd0, 0x3b, 0x0c, 0xb5, 0x0d, 0x84, 0x88, 0x0b, 0x03, 0x62, 0x27, 0x5b, 0xcd, 0x67, 0x00, 0x5a, 0x03, 0x91, 0x99, 0xc2, 0x1a, 0x54, 0x17,
+          0x40, 0x1b, 0x6f, 0x70, 0xe3, 0x58, 0x97, 0x92, 0x8f, 0xe0, 0x88, 0x59, 0x9e, 0xd0, 0x88, 0xc9, 0x2f, 0x60, 0x13, 0xc4, 0x47, 0x65, 0x01, 0x86,
+          0x80, 0xec, 0x4e, 0xc2, 0x10, 0x44, 0x4e, 0x4e, 0x3c, 0xda, 0x5c, 0xa3, 0xfb, 0x43, 0x3d, 0xa1, 0x9b, 0xf3, 0xf8, 0x8d, 0x49, 0x21, 0x04, 0x5b,
+          0x58, 0x28, 0x26, 0xa2, 0xa3, 0x02, 0x02, 0xb0, 0xf6, 0xec, 0x0c, 0x73, 0x14, 0x9e, 0x17, 0x52, 0xa0, 0x4b, 0xd4, 0x2c, 0xff, 0x84, 0x09, 0x2e,
+          0x2a, 0xa5, 0x08, 0x98, 0x80, 0x01, 0x5b, 0x19, 0x84, 0x6a, 0x6e, 0x5d, 0x3b, 0x30, 0xe8, 0xa0, 0x42, 0x6d, 0x41, 0x04, 0xd1, 0xa4, 0xcf, 0xd0,
+          0x12, 0xab, 0x47, 0x5d, 0x87, 0x02, 0xde, 0x9c, 0x73, 0xd2, 0xf2, 0x62, 0xc5, 0x7d, 0x33, 0x5d, 0xf5, 0x2d, 0xfb, 0x8b, 0x8f, 0x89, 0xbd, 0x1f,
+          0xa1, 0x83, 0x9e, 0x02, 0xcb, 0xb7, 0xbc, 0x92, 0xbe, 0xf1, 0x03, 0x2f, 0x20, 0xc7, 0xaf, 0x65, 0xd6, 0x42, 0x92, 0x90, 0x27, 0x42, 0xe8, 0x4a,
+          0x0e, 0xae, 0x9e, 0xf3, 0x6d, 0x49, 0x79, 0xba, 0x52, 0xa6, 0x3b, 0x5a, 0x8c, 0xad, 0x18, 0xf9, 0xe2, 0xb6, 0xbf, 0x6c, 0x28, 0x95, 0x5d, 0xfa,
+          0x87, 0x50, 0xcf, 0x5b, 0x29, 0x92, 0x00, 0x9d, 0x50, 0x6b, 0x60, 0xc5, 0x6e, 0xf1, 0xbb, 0xdd, 0x8a, 0x15, 0xf8, 0x7f, 0xb3, 0xc7, 0x50, 0xfb,
+          0xfb, 0xff, 0xd5, 0xf5, 0xa7, 0x17, 0x76, 0xe0, 0x9d, 0x3f, 0xe9, 0x41, 0x8f, 0x3f, 0x75, 0xe1, 0x35, 0x06, 0x8a, 0x15, 0xfa, 0xaa, 0xfb, 0x51,
+          0x6d, 0xfc, 0xa2, 0x60, 0x12, 0xfb, 0x35, 0x4e, 0x89, 0x28, 0xdc, 0x00, 0x5c, 0x68, 0x5e, 0xc1, 0xb7, 0x9c, 0x3c, 0xe0, 0x88, 0xb6, 0x83, 0x86,
+          0x44, 0x52, 0x0f, 0x65, 0x1d, 0xc9, 0xef, 0x7b, 0x80, 0xfd, 0xac, 0x52, 0xd4, 0xd3, 0x3a, 0xf4, 0x14, 0x14, 0x70, 0xd7, 0xe0, 0xcd, 0xdb, 0x77,
+          0x9a, 0x48, 0xaf, 0x73, 0x88, 0x5b, 0xf7, 0xea, 0x4a, 0xf9, 0x9e, 0x56, 0xee, 0xc0, 0x03, 0xb8, 0x66, 0xdc, 0xb8, 0xf4, 0x3d, 0x27, 0x0e, 0x3e,
+          0x9b, 0x67, 0xde, 0xc5, 0x29, 0x5f, 0x35, 0x1c, 0xe2, 0x6d, 0x99, 0xf1, 0xa0, 0xf1, 0xa9, 0xe7, 0xae, 0x28, 0x6f, 0x07, 0xdf, 0x1c, 0x60, 0xa3,
+          0x59, 0x00, 0xfd, 0xcc, 0x84, 0x79, 0x6a, 0x22, 0x93, 0xa5, 0x69, 0x70, 0x5a, 0xe2, 0xa7, 0x58, 0xde, 0xca, 0xa3, 0xeb, 0x45, 0x86, 0xbd, 0x0f,
+          0xf2, 0x5d, 0x65, 0x35, 0xb7, 0x34, 0x7b, 0xb5, 0x9e, 0x95, 0x5c, 0x42, 0x3d, 0xc9, 0x8c, 0xd1, 0x9b, 0xef, 0x12, 0x09, 0x1d, 0xc8, 0x87, 0x4e,
+          0x2c, 0x15, 0x77, 0x9c, 0x8c, 0x87, 0xe9, 0x8d, 0x4d, 0x5c, 0x42, 0x0b, 0x04, 0x12, 0x77, 0x78, 0x91, 0x1d, 0xbd, 0x53, 0x26, 0x82, 0x95, 0x53,
+          0x3f, 0xa0, 0x82, 0x14, 0x8a, 0xed, 0x20, 0xb6, 0x98, 0xa1, 0x07, 0xe3, 0x90, 0x84, 0x9b, 0x8d, 0x66, 0x1a, 0xd1, 0xcc, 0xbf, 0xa8, 0xbd, 0xb6,
+          0x64, 0xac, 0xf7, 0x4e, 0x52, 0x6b, 0x21, 0x9a, 0xce, 0x11, 0x16, 0xad, 0x44, 0x17, 0x88, 0x39, 0x2f, 0x3b, 0xcc, 0x24, 0xcd, 0x4b, 0x2f, 0xa2,
+          0x51, 0x23, 0x75, 0x01, 0x68, 0x04, 0xbd, 0xa8, 0x46, 0x59, 0x19, 0xee, 0x09, 0xd6, 0xa6, 0xa1, 0x07, 0xbb, 0x11, 0x1b, 0x0b, 0x96, 0x72, 0x52,
+          0x5a, 0x64, 0xd4, 0x54, 0xd3, 0x0a, 0xb2, 0x5d, 0xa2, 0xd1, 0x80, 0xc5, 0xcb, 0x82, 0x1a, 0x74, 0x00, 0x41, 0xa7, 0xc3, 0x26, 0x31, 0x89, 0xb0,
+          0x71, 0xc4, 0xe0, 0x54, 0xe7, 0xbd, 0x02, 0x26, 0xc3, 0x7e, 0x47, 0xe3, 0x43, 0xa4, 0x95, 0xa8, 0x17, 0xf3, 0x71, 0x80, 0x42, 0xfd, 0x14, 0x17,
+          0xba, 0x2c, 0x87, 0xee, 0x24, 0xed, 0xbc, 0xd6, 0x23, 0xe2, 0x64, 0x43, 0xd1, 0x13, 0x40, 0x1e, 0xd2, 0xda, 0x90, 0x17, 0x42, 0xd1, 0x64, 0x04,
+          0xe4, 0x08, 0x7b, 0x65, 0x26, 0xa7, 0x1d, 0x4a, 0x66, 0x9f, 0xcc, 0xab, 0x0d, 0x3f, 0xed, 0xa1, 0x94, 0xb4, 0x62, 0xdc, 0x4b, 0x92, 0x49, 0x36,
+          0x9c, 0x7b, 0x11, 0x10, 0x6a, 0x6b, 0x78, 0xbb, 0x16, 0x7b, 0x4f, 0xe1, 0x1e, 0x5f, 0x1b, 0xb1, 0x42, 0x7d, 0x59, 0x1e, 0x4c, 0x42, 0xa3, 0x53,
+          0x60, 0x6b, 0xc1, 0x78, 0x05, 0x7c, 0x3d, 0x08, 0xe9, 0xe8, 0xf2, 0xf8, 0x47, 0x48, 0x75, 0x02, 0x0f, 0xb7, 0x26, 0xe1, 0xa8, 0xc0, 0x29, 0x05,
+          0x67, 0x2c, 0xbe, 0x6b, 0x2f, 0xef, 0x0c, 0x75, 0x36, 0x76, 0x45, 0xbd, 0xd3, 0x3f, 0xb2, 0x13, 0x25, 0xb8, 0x6a, 0x73, 0x44, 0xf2, 0xce, 0x10,
+          0x19, 0x85, 0xe7, 0x75, 0x7e, 0x80, 0x60, 0x82, 0xa3, 0x16, 0x1d, 0x07, 0x28, 0x2d, 0xf4, 0x48, 0x8f, 0xc1, 0x4f, 0x5d, 0x33, 0x9e, 0x61, 0x0f,
+          0x6d, 0x41, 0xb3, 0x73, 0x01, 0x50, 0x7b, 0x08, 0xd5, 0x88, 0xe3, 0x2f, 0x68, 0xaa, 0x2b, 0xa5, 0xfe, 0xfc, 0x71, 0x93, 0x55, 0xa7, 0x35, 0x2b,
+          0xad, 0x88, 0x88, 0xa5, 0xdf, 0x0c, 0x63, 0x0e, 0xde, 0xa5, 0xaa, 0xfd, 0x0a, 0x68, 0x98, 0x43, 0x7e, 0xfd, 0xb6, 0x73, 0xa1, 0x82, 0x04, 0x62,
+          0x29, 0x82, 0xf5, 0xc7, 0x15, 0x94, 0x02, 0x80, 0xbe, 0xfe, 0x46, 0xbb, 0x4c, 0xb3, 0xf2, 0x65, 0x6f, 0x4a, 0x05, 0x7d, 0xbe, 0xc2, 0x40, 0xdd,
+          0x54, 0x3d, 0x0b, 0x09, 0x04, 0x89, 0x0e, 0x02, 0x5c, 0x86, 0x10, 0xf5, 0xe8, 0x81, 0x43, 0xa1, 0x93, 0xec, 0x26, 0xcb, 0x7f, 0x58, 0x83, 0x00,
+          0x8b, 0x91, 0xa6, 0x8c, 0x4b, 0xbe, 0x1e, 0x82, 0xa3, 0x08, 0x0e, 0x49, 0x90, 0xf5, 0x03, 0xd9, 0xa6, 0xcb, 0xe2, 0xd6, 0x35, 0x9a, 0xca, 0xc7,
+          0xc9, 0x7c, 0x30, 0x22, 0x46, 0x74, 0x93, 0xa2, 0xcf, 0x7e, 0x29, 0x67, 0xc1, 0xe1, 0x88, 0x43, 0xd1, 0xeb, 0x56, 0x08, 0x8b, 0xa4, 0x45, 0x7e,
+          0xbf, 0xc3, 0x03, 0x22, 0xd2, 0x42, 0xa4, 0xbe, 0xef, 0x8a, 0x8c, 0x0e, 0xc8, 0xec, 0x80, 0xfb, 0x27, 0xda, 0xac, 0xc6, 0x64, 0xbe, 0x24, 0xf1,
+          0xc1, 0x86, 0x3c, 0x6c, 0x4d, 0xa7, 0x64, 0x30, 0x24, 0x93, 0xad, 0xe5, 0x78, 0x84, 0xcf, 0x2c, 0x44, 0x8c, 0x5a, 0x98, 0x86, 0x70, 0x00, 0x92,
+          0xe5, 0x81, 0xaf, 0x85, 0x88, 0x21, 0x65, 0x20, 0xe8, 0x44, 0xf5, 0xba, 0xe4, 0x60, 0x33, 0xd5, 0x20, 0x14, 0xf8, 0x96, 0x52, 0x8e, 0x68, 0x06,
+          0x79, 0x64, 0xdd, 0xac, 0xbb, 0x96, 0xe4, 0x14, 0x88, 0x2e, 0xeb, 0xe7, 0x5b, 0x91, 0x89, 0x0f, 0x1e, 0x25, 0x5b, 0x52, 0x50, 0x4e, 0x6b, 0xfd,
+          0xfc, 0x96, 0x24, 0xa7, 0x7a, 0xeb, 0xad, 0x93, 0x7d, 0x9e, 0x2a, 0x62, 0x37, 0x27, 0xe3, 0x9d, 0x72, 0xc7, 0x38, 0x99, 0x9c, 0x75, 0xb2, 0x2d,
+          0x8d, 0x5e, 0x4b, 0xed, 0x21, 0xc7, 0xb2, 0x2e, 0x7f, 0x4b, 0x6b, 0x04, 0x0a, 0x6b, 0x15, 0xcb, 0x13, 0x22, 0xb6, 0xf6, 0x01, 0x90, 0x57, 0xda,
+          0x41, 0x0e, 0x35, 0x50, 0x6e, 0x83, 0xb0, 0xf8, 0xf7, 0xfa, 0x3d, 0xd2, 0x21, 0xaa, 0x60, 0x03, 0xb1, 0x2b, 0x86, 0x80, 0x21, 0x05, 0x24, 0x3e,
+          0x6e, 0x97, 0x04, 0xc5, 0x44, 0x76, 0xc1, 0xc0, 0x02, 0x02, 0x92, 0x90, 0xa9, 0x27, 0x63, 0x1c, 0x4f, 0x53, 0x22, 0x5b, 0xd3, 0xc6, 0xe3, 0x4c,
+          0x07, 0xd9, 0x30, 0x24, 0xce, 0x60, 0xe0, 0x18, 0xf7, 0x96, 0x1e, 0xa5, 0x61, 0x73, 0x07, 0x4f, 0xa4, 0x19, 0xfd, 0x9a, 0xf0, 0xd6, 0xf8, 0x22,
+          0xa3, 0x7c, 0x76, 0x00, 0x2f, 0xb6, 0x47, 0xc7, 0xfd, 0xfa, 0xf2, 0x05, 0x63, 0x6f, 0xd7, 0xe2, 0x67, 0x4e, 0x37, 0x36, 0x40, 0xca, 0xd1, 0x87,
+          0x0c, 0x27, 0xaa, 0xc4, 0x97, 0xca, 0x71, 0x96, 0x51, 0xfa, 0x49, 0xe6, 0x1b, 0x4a, 0x6c, 0x33, 0x6e, 0x50, 0x4e, 0xf9, 0x79, 0x51, 0x0a, 0xde,
+          0xa5, 0x71, 0x15, 0xd4, 0x52, 0x43, 0x25, 0x50, 0x5e, 0xf4, 0x6a, 0x29, 0xe3, 0x90, 0x64, 0xc7, 0x33, 0x28, 0x6b, 0x95, 0x08, 0x0a, 0xb8, 0x8b,
+          0xc0, 0xd7, 0x7f, 0x6b, 0xda, 0xda, 0x64, 0x74, 0xef, 0x9c, 0xe2, 0xad, 0xd5, 0x3e, 0xe8, 0xc2, 0x51, 0xfc, 0xfb, 0xcc, 0xc5, 0x85, 0x7f, 0x4c,
+          0xce, 0x17, 0xd0, 0x13, 0xe7, 0xa9, 0xe6, 0xc9, 0xe1, 0xb7, 0x7b, 0xa2, 0xc3, 0xca, 0xd8, 0xd6, 0x48, 0x59, 0x99, 0x03, 0xf6, 0x6e, 0x9b, 0xd5,
+          0x15, 0x82, 0xaf, 0x92, 0x7f, 0x92, 0x29, 0xf4, 0x53, 0xb5, 0xe5, 0x92, 0xcf, 0x47, 0x4f, 0xc4, 0x44, 0xb2, 0x32, 0xde, 0x00, 0x4b, 0xd7, 0x1b,
+          0x89, 0x4f, 0x7f, 0x20, 0x87, 0x61, 0x3e, 0x67, 0xe9, 0x17, 0x10, 0xcb, 0x32, 0x4b, 0x0f, 0x22, 0x9e, 0x49, 0x88, 0xb4, 0xac, 0x9f, 0xdb, 0xf5,
+          0xed, 0x92, 0x77, 0x18, 0x0d, 0x5f, 0xa1, 0x94, 0x45, 0xdc, 0xc6, 0xb9, 0xc1, 0x48, 0x0e, 0xb4, 0x13, 0xba, 0xb5, 0x0f, 0x8c, 0xb6, 0x40, 0xe0,
+          0x2d, 0xf9, 0x05, 0x0f, 0x22, 0xd5, 0x04, 0x48, 0x39, 0x9d, 0x9f, 0x5f, 0x5a, 0xc3, 0xa5, 0x65, 0x1d, 0x01, 0x40, 0x54, 0xd3, 0x24, 0x19, 0xc1,
+          0x0d, 0x87, 0xc7, 0xfd, 0xe7, 0xc9, 0xa1, 0x3d, 0xb3, 0x00, 0x89, 0x27, 0xe2, 0xea, 0xce, 0xf7, 0xcd, 0xd6, 0xd0, 0xfc, 0x42, 0x68, 0x9c, 0xd0,
+          0x30, 0xcc, 0xe3, 0x19, 0x56, 0x98, 0xaa, 0x13, 0xa4, 0x3f, 0xd1, 0x89, 0x29, 0x31, 0xbd, 0x94, 0x5c, 0xdd, 0xd5, 0x53, 0x1f, 0x0c, 0xd1, 0x43,
+          0xa2, 0x73, 0x29, 0xbf, 0xa0, 0xca, 0x95, 0xe2, 0x79, 0x83, 0xd0, 0x92, 0xf5, 0xf7, 0x2d, 0x74, 0xc1, 0x52, 0x51, 0xba, 0xaf, 0x8d, 0xad, 0xf9,
+          0xc5, 0x34, 0x9d, 0x36, 0x88, 0xe8, 0xb4, 0x1c, 0xfc, 0xa1, 0x21, 0x0d, 0x0f, 0xa9, 0x00, 0xbf, 0xf8, 0xc5, 0x03, 0xbf, 0x44, 0x82, 0xc2, 0x7b,
+          0xe8, 0x80, 0x43, 0xc4, 0x1f, 0x2f, 0x0e, 0x0f, 0x75, 0x51, 0xdf, 0xe3, 0x6b, 0x51, 0x8a, 0xb2, 0x02, 0x0b, 0xe6, 0x03, 0x1e, 0x2b, 0x75, 0x06,
+          0x36, 0xd4, 0xb5, 0x90, 0x40, 0x8e, 0x29, 0xbe, 0xff, 0xde, 0x49, 0xb2, 0x02, 0xfc, 0xfe, 0x4b, 0x8c, 0x00, 0x18, 0xdd, 0xaa, 0x2a, 0x6e, 0x22,
+          0xbd, 0x94, 0x99, 0x2b, 0x06, 0x09, 0x25, 0x95, 0x4b, 0x44, 0xd7, 0xd5, 0x3b, 0x46, 0x8f, 0xa3, 0x51, 0x04, 0x1c, 0x16, 0x3d, 0x71, 0x73, 0x1c,
+          0x5c, 0x91, 0x1a, 0x45, 0xd1, 0x6c, 0xf5, 0xdb, 0xa8, 0x1e, 0x3b, 0x8d, 0x4b, 0x1b, 0x50, 0x21, 0xa1, 0x12, 0xb7, 0x01, 0x15, 0x06, 0x81, 0x3a,
+          0x89, 0x6f, 0x00, 0x34, 0x47, 0x97, 0xaf, 0x59, 0x7f, 0x1f, 0x8c, 0xc6, 0xec, 0xf6, 0x00, 0x25, 0x82, 0xe7, 0xba, 0x0d, 0x2e, 0xe8, 0x64, 0xfb,
+          0x2a, 0xfd, 0x40, 0x87, 0x12, 0xc3, 0xa3, 0xa7, 0x08, 0xe6, 0xd4, 0xb9, 0x2e, 0x99, 0xd1, 0xc8, 0x17, 0xe0, 0x9f, 0x10, 0x25, 0xa2, 0xd0, 0xd8,
+          0x9f, 0x6a, 0x1b, 0xbd, 0xa0, 0xe0, 0xe5, 0x41, 0x5a, 0x5e, 0x18, 0xb7, 0xf5, 0x0a, 0xae, 0x45, 0x44, 0xfa, 0x60, 0x34, 0xd4, 0x2e, 0x54, 0xdc,
+          0xa1, 0x8e, 0x4d, 0xe2, 0xcf, 0xcf, 0x04, 0x3e, 0x20, 0x0b, 0x01, 0x07, 0xfc, 0x15, 0x9f, 0xdb, 0x72, 0xfe, 0x2c, 0x78, 0xb9, 0x50, 0xc9, 0x71,
+          0xf6, 0x0a, 0x6e, 0x15, 0x04, 0x98, 0xb1, 0xc4, 0x17, 0xe6, 0x6e, 0xc1, 0xa2, 0xdc, 0xd0, 0x40, 0xf3, 0x1b, 0xe8, 0xd2, 0xdf, 0x82, 0xb6, 0xd0,
+          0x2d, 0x6c, 0x46, 0x8f, 0x8d, 0x93, 0xd9, 0x49, 0xc9, 0x59, 0xf8, 0x23, 0xfa, 0x71, 0x6a, 0xee, 0xe5, 0x59, 0x84, 0x14, 0x8d, 0xc5, 0x8b, 0x9d,
+          0xf2, 0xe6, 0x23, 0x70, 0xfe, 0xfa, 0x18, 0xae, 0x3d, 0xe9, 0xf5, 0x4c, 0xa5, 0xd7, 0x77, 0x0c, 0x4f, 0x2e, 0x4c, 0x45, 0x07, 0x35, 0x0d, 0xa5,
+          0x32, 0xbc, 0xa2, 0x86, 0x22, 0x14, 0xbc, 0xc0, 0x3b, 0x72, 0x0e, 0xbb, 0x99, 0xa4, 0x81, 0x1e, 0x82, 0xf8, 0xfd, 0x2a, 0x4c, 0xc5, 0xa9, 0x24,
+          0x92, 0x5f, 0x9a, 0xee, 0xc5, 0xbb, 0xa2, 0x07, 0xa0, 0x47, 0x20, 0x14, 0xb5, 0x8b, 0xcf, 0x1c, 0x59, 0x8a, 0xce, 0x69, 0x07, 0x2c, 0x0c, 0x3a,
+          0x39, 0x17, 0x9f, 0xc8, 0xaf, 0x8b, 0xe5, 0x14, 0xbc, 0x21, 0xc5, 0x3a, 0xf6, 0xc9, 0x33, 0x1f, 0x26, 0x07, 0xe0, 0x5a, 0xa5, 0xb8, 0xd0, 0xd3,
+          0xb1, 0xb4, 0xb9, 0x0b, 0x16, 0xfb, 0x9f, 0xb7, 0xcd, 0x04, 0x32, 0xf9, 0xcf, 0xc2, 0x44, 0x73, 0xc4, 0xcd, 0x62, 0x1f, 0xbe, 0xca, 0xcf, 0x05,
+          0x6e, 0x54, 0x4c, 0xf6, 0x18, 0xe7, 0x8f, 0x04, 0xbc, 0x87, 0x41, 0xf4, 0x33, 0x6a, 0x81, 0x23, 0x7a, 0x83, 0xc6, 0xb7, 0x59, 0x03, 0xb4, 0xca,
+          0xfd, 0x5a, 0xe4, 0x40, 0x4c, 0xbe, 0x1f, 0x71, 0x0a, 0xee, 0xa4, 0x20, 0xae, 0xe8, 0x72, 0x83, 0xa5, 0x1f, 0x1b, 0x9f, 0xb3, 0xf0, 0x36, 0x73,
+          0x3a, 0x92, 0x86, 0x55, 0xcc, 0x62, 0x45, 0x3e, 0x75, 0x31, 0x41, 0xba, 0x55, 0xfc, 0x38, 0xe2, 0x8e, 0x2b, 0x86, 0x9d, 0xb5, 0x30, 0x41, 0x98,
+          0xe5, 0xdd, 0x67, 0x18, 0x8c, 0xe3, 0xfb, 0xfb, 0x1b, 0x2e, 0xab, 0x13, 0x1e, 0xef, 0x79, 0xfb, 0x3d, 0xb7, 0xa8, 0x6d, 0x49, 0x23, 0xc1, 0x3b,
+          0x1e, 0x67, 0x7c, 0xe4, 0x1d, 0x83, 0x51, 0xca, 0x06, 0x2f, 0x88, 0x66, 0x4b, 0x60, 0x2b, 0x0a, 0xf8, 0x78, 0xad, 0xc9, 0x52, 0x48, 0x7b, 0x14,
+          0x60, 0xe1, 0x5d, 0xe6, 0x44, 0xd3, 0xb5, 0x17, 0x37, 0xa7, 0x67, 0xc9, 0x2c, 0x6b, 0x34, 0xc2, 0x0e, 0x7a, 0x84, 0x9b, 0xa5, 0xda, 0x1c, 0x62,
+          0xd4, 0xb1, 0x40, 0xb5, 0xcd, 0x87, 0x50, 0xf5, 0xe2, 0xeb, 0xeb, 0xeb, 0x8a, 0xf8, 0xb3, 0xc7, 0x7a, 0x2f, 0x7c, 0x41, 0x55, 0x02, 0x9b, 0x61,
+          0x63, 0xba, 0xdf, 0x03, 0xb5, 0xd1, 0x33, 0xd8, 0xf9, 0xa1, 0x81, 0x97, 0x6b, 0xc6, 0x86, 0x95, 0x6d, 0x67, 0x2c, 0xed, 0x9e, 0xf8, 0xad, 0x7e,
+          0xf8, 0x30, 0x3a, 0xbb, 0x6d, 0xef, 0x29, 0xe1, 0x09, 0x3a, 0x38, 0x7f, 0x9d, 0x4a, 0xab, 0x60, 0x62, 0x38, 0x16, 0xa1, 0xdc, 0x42, 0x97, 0x04,
+          0x6e, 0x59, 0x97, 0xc2, 0x7f, 0xc8, 0x5c, 0xe1, 0x25, 0xfb, 0xc1, 0x5c, 0x1e, 0x49, 0x16, 0xc1, 0x33, 0x2e, 0xa3, 0xfa, 0xd2, 0x09, 0xdf, 0x27,
+          0x39, 0x40, 0x59, 0x7a, 0xd4, 0x6f, 0xa2, 0xa8, 0x1b, 0x8c, 0xa2, 0x52, 0x02, 0x54, 0x33, 0x03, 0x8d, 0xda, 0x34, 0x1e, 0x94, 0x47, 0x74, 0x62,
+          0x8b, 0x5c, 0x9a, 0x13, 0x8a, 0xf1, 0xe4, 0x50, 0x83, 0xdb, 0xc6, 0x54, 0xb1, 0x15, 0x08, 0xbd, 0x2d, 0xd3, 0x02, 0xf4, 0xfc, 0x0b, 0x5c, 0x93,
+          0x21, 0xe0, 0x6d, 0x2a, 0xb5, 0xdf, 0x00, 0x14, 0x39, 0xa4, 0xa5, 0xb2, 0x96, 0xae, 0xdf, 0x8e, 0x73, 0x45, 0xad, 0x80, 0x88, 0x96, 0x74, 0x49,
+          0xde, 0x60, 0x6d, 0x45, 0x58, 0xe0, 0x1b, 0xf8, 0x71, 0x55, 0x6b, 0xe1, 0xd3, 0xb2, 0x9c, 0x7d, 0x8c, 0xc6, 0x95, 0x2d, 0x0d, 0xd8, 0x68, 0x2b,
+          0x26, 0x35, 0x44, 0x00, 0xc6, 0xd4, 0x95, 0xa0, 0x03, 0x12, 0x3f, 0x2e, 0x1b, 0x80, 0xd6, 0xd3, 0x85, 0x44, 0x89, 0x88, 0xed, 0x06, 0x1b, 0xab,
+          0x31, 0x18, 0xb6, 0x66, 0xaf, 0xc6, 0x2d, 0x19, 0x8d, 0x37, 0x6b, 0xd3, 0xeb, 0x8f, 0x5e, 0x56, 0xa7, 0x46, 0x33, 0x10, 0x06, 0x78, 0xa3, 0x03,
+          0x69, 0x10, 0x4b, 0x15, 0xcc, 0x5f, 0x60, 0x73, 0xed, 0x61, 0x0e, 0x8d, 0x98, 0x46, 0xa4, 0x5a, 0x81, 0x9d, 0x8e, 0xd9, 0x9e, 0x96, 0xfc, 0x64,
+          0xc6, 0xda, 0x8c, 0xd5, 0x9f, 0x75, 0x91, 0xe4, 0xfd, 0x91, 0x48, 0xef, 0x04, 0x02, 0x27, 0x02, 0xcf, 0xc4, 0xd8, 0xa6, 0x39, 0x12, 0x09, 0x13,
+          0x2c, 0xcb, 0xdb, 0x17, 0x19, 0x6e, 0x8c, 0xf0, 0x86, 0xcd, 0x6f, 0x05, 0xf7, 0x85, 0x1a, 0x04, 0xdf, 0x3e, 0x04, 0x17, 0x51, 0xe8, 0xb6, 0x7e,
+          0x43, 0xae, 0x2e, 0xb2, 0x12, 0x50, 0x37, 0x0c, 0x92, 0x70, 0x30, 0xd2, 0xa4, 0xf7, 0x4c, 0x30, 0x71, 0x7c, 0x1c, 0xfb, 0x56, 0xd0, 0x19, 0x17,
+          0x76, 0xa6, 0xd3, 0x45, 0xcf, 0x6a, 0x55, 0xca, 0xb1, 0x99, 0xf3, 0x2d, 0xe9, 0x63, 0x97, 0x91, 0xfc, 0x7e, 0x20, 0x85, 0x81, 0x92, 0x10, 0x4f,
+          0xa6, 0x82, 0x5f, 0x3e, 0x90, 0x5b, 0x16, 0x38, 0x4a, 0xb5, 0xdf, 0x41, 0x4f, 0x2c, 0xbb, 0x35, 0x01, 0xa6, 0x39, 0x58, 0x10, 0x13, 0x11, 0xbc,
+          0xf0, 0x58, 0xa8, 0x11, 0x70, 0x19, 0x93, 0xeb, 0x4a, 0xa0, 0xff, 0x55, 0xc2, 0x20, 0x32, 0x6d, 0x4e, 0x9f, 0xb9, 0x24, 0x10, 0x88, 0x2c, 0x7c,
+          0x75, 0x39, 0xd3, 0xe7, 0x08, 0x13, 0xa1, 0x9a, 0xb8, 0x1b, 0x5b, 0xf5, 0x0f, 0x15, 0x61, 0x07, 0x33, 0x5d, 0xd9, 0xd2, 0x08, 0x08, 0xb3, 0xd6,
+          0xc6, 0x9c, 0x7c, 0x63, 0x71, 0x49, 0xe0, 0x55, 0x65, 0x82, 0x46, 0x22, 0x52, 0x09, 0x89, 0xcc, 0x9c, 0x8e, 0x63, 0x8f, 0x27, 0xca, 0xb1, 0x2d,
+          0x06, 0x16, 0xb0, 0x6c, 0x85, 0xee, 0xe8, 0x76, 0x7c, 0x24, 0x51, 0x23, 0x54, 0x39, 0x18, 0xdd, 0xd6, 0x40, 0xea, 0xd1, 0x7b, 0x77, 0xa9, 0xc3,
+          0xd8, 0x25, 0x72, 0x72, 0x00, 0xa8, 0xa2, 0xee, 0x74, 0xb0, 0x5e, 0x9e, 0x54, 0x97, 0xe2, 0x3a, 0x6a, 0x1d, 0xd8, 0xa2, 0x41, 0x85, 0x8e, 0x3e,
+          0x8e, 0x5d, 0x56, 0xcb, 0x45, 0xa1, 0x00, 0x20, 0x59, 0x26, 0x36, 0xf9, 0xb4, 0xce, 0xaf, 0x2e, 0x47, 0xce, 0xb3, 0x61, 0x42, 0x8a, 0x1e, 0xe8,
+          0xfc, 0xc2, 0x26, 0xba, 0x0e, 0x9b, 0xfe, 0x08, 0x57, 0x73, 0xe9, 0x0c, 0xc1, 0x50, 0x47, 0xff, 0x64, 0x6e, 0xfa, 0x0b, 0x89, 0x3c, 0xfc, 0x93,
+          0x61, 0xa1, 0xc2, 0xd7, 0xb1, 0xd9, 0x06, 0xe8, 0x5d, 0x40, 0xec, 0x03, 0x6f, 0xb4, 0x17, 0x24, 0xa0, 0x03, 0xe4, 0x22, 0xb7, 0x29, 0xde, 0x73,
+          0x7d, 0xdd, 0x57, 0x27, 0xd6, 0x26, 0xc2, 0xa6, 0xe6, 0x39, 0x75, 0x25, 0x15, 0x80, 0x48, 0xa3, 0x01, 0x5e, 0x0d, 0x04, 0xdc, 0x23, 0x88, 0x53,
+          0xb0, 0xea, 0xe7, 0x53, 0xae, 0x2a, 0xbe, 0xeb, 0x88, 0x9f, 0xc6, 0xc3, 0x48, 0xbf, 0x71, 0xbe, 0x42, 0x88, 0xbc, 0x3c, 0x04, 0x30, 0x0f, 0x09,
+          0xf6, 0x29, 0xf6, 0xbb, 0xeb, 0xd7, 0x17, 0x83, 0x55, 0x46, 0x6b, 0x06, 0x68, 0x54, 0xb4, 0x7a, 0xde, 0x0d, 0x44, 0x37, 0x2f, 0x08, 0xc2, 0x0a,
+          0x6f, 0x48, 0xac, 0x8c, 0x13, 0x68, 0x53, 0xb6, 0x40, 0x80, 0x77, 0xdf, 0x64, 0x2a, 0x7c, 0xfd, 0x15, 0x68, 0x00, 0x9a, 0x67, 0xfd, 0xbd, 0xed,
+          0xdf, 0x81, 0xd6, 0x48, 0x10, 0xba, 0x1a, 0xa8, 0x71, 0xf1, 0x9e, 0x47, 0xd7, 0x02, 0x11, 0x57, 0xb0, 0x8e, 0x9c, 0x06, 0x68, 0xcb, 0x3a, 0xc8,
+          0xe9, 0x84, 0x8f, 0x5a, 0x7d, 0x77, 0x46, 0xa3, 0xaf, 0x04, 0x9c, 0xe9, 0xdf, 0x93, 0xd0, 0xfa, 0x69, 0xf4, 0xd8, 0xb3, 0x82, 0xda, 0x18, 0x66,
+          0xa4, 0xd7, 0xed, 0x2d, 0xf1, 0xd5, 0xc6, 0x1a, 0xbe, 0x49, 0x7f, 0x46, 0xf0, 0x8d, 0xc3, 0x19, 0x47, 0x9b, 0x68, 0xf8, 0x55, 0xd3, 0xe5, 0x26,
+          0x76, 0x5a, 0xf7, 0xfa, 0xa6, 0x98, 0x2c, 0xdf, 0x2d, 0xf7, 0xc9, 0xfe, 0x28, 0xf1, 0xe7, 0xcf, 0xe8, 0x37, 0xbe, 0xd5, 0x19, 0xa7, 0x22, 0xa0,
+          0xfd, 0xf5, 0x9e, 0x69, 0x56, 0xdc, 0x70, 0xba, 0xf3, 0xf9, 0xbd, 0x93, 0xf6, 0x0d, 0x62, 0xd7, 0x2a, 0xab, 0xae, 0x57, 0x06, 0x6e, 0xad, 0xac,
+          0xb9, 0xad, 0xf2, 0xca, 0xed, 0x95, 0xd7, 0xee, 0xa8, 0xfc, 0xe9, 0x4e, 0x77, 0xfd, 0x31, 0xe5, 0xca, 0x1b, 0x57, 0x1a, 0x2d, 0xf7, 0x15, 0xad,
+          0x48, 0xc5, 0x5c, 0x5d, 0xf6, 0xa5, 0x3b, 0x7b, 0x2a, 0xec, 0x44, 0x70, 0x14, 0xd4, 0xc5, 0x75, 0xba, 0xa7, 0x8e, 0x5f, 0x30, 0x72, 0x0b, 0x68,
+          0x73, 0x3d, 0xd6, 0x6b, 0x5f, 0x8d, 0x01, 0xf2, 0x4e, 0x5b, 0x08, 0x96, 0xdd, 0x0a, 0x90, 0xa7, 0x2b, 0xdc, 0xc5, 0x11, 0x0b, 0xe4, 0xcb, 0x26,
+          0x08, 0x0b, 0xa6, 0x1d, 0x20, 0x9f, 0xf8, 0x6e, 0xb4, 0x91, 0x2b, 0xed, 0xd4, 0x9c, 0x3f, 0x7b, 0x69, 0xb0, 0x21, 0xbf, 0xcc, 0x3c, 0xee, 0x09,
+          0xb5, 0xe3, 0xea, 0x3d, 0x1d, 0x36, 0x2a, 0xa2, 0xf1, 0x06, 0xe7, 0x32, 0xbd, 0xa8, 0xe2, 0x3f, 0xc4, 0x44, 0xa1, 0xd4, 0x3d, 0xb9, 0x9d, 0x21,
+          0x65, 0x0d, 0x68, 0x42, 0x10, 0x68, 0x72, 0x3c, 0x43, 0x83, 0xfa, 0xc2, 0xa3, 0xd0, 0x24, 0x0a, 0x1f, 0xab, 0xc2, 0x64, 0xdf, 0x55, 0xd4, 0x0d,
+          0x07, 0x13, 0x8a, 0x09, 0xa7, 0x3c, 0x1d, 0x66, 0x38, 0x71, 0x51, 0x65, 0x37, 0x40, 0x2b, 0xc6, 0x83, 0x0e, 0x48, 0x40, 0x3b, 0x58, 0xe8, 0x94,
+          0x71, 0x7a, 0xc4, 0xdf, 0x8d, 0xa6, 0xdf, 0x8f, 0xe2, 0x01, 0x56, 0x48, 0xcd, 0xad, 0xdb, 0x64, 0x4a, 0x9b, 0x80, 0x1f, 0x11, 0x46, 0xa3, 0xc1,
+          0xad, 0x53, 0x0e, 0x3e, 0xf3, 0xfc, 0x23, 0x94, 0x03, 0x5a, 0x15, 0xdf, 0x3c, 0x33, 0xdc, 0x5c, 0x6d, 0x36, 0x22, 0x1e, 0x3c, 0x62, 0x57, 0xce,
+          0xed, 0x1d, 0x63, 0x92, 0xc7, 0xf7, 0xbc, 0x83, 0x72, 0xad, 0x7a, 0x88, 0xc5, 0x39, 0xf5, 0x21, 0xa1, 0x88, 0x86, 0x98, 0x4e, 0x17, 0x4a, 0xb1,
+          0x74, 0x44, 0x22, 0x41, 0xe1, 0xdf, 0x94, 0xca, 0x6e, 0x47, 0x2b, 0xf1, 0xc7, 0x4f, 0xd2, 0x58, 0x52, 0x57, 0xe4, 0x33, 0x41, 0xdc, 0x86, 0x2e,
+          0xfc, 0x1a, 0x7c, 0xdf, 0x6a, 0xe9, 0xee, 0xb3, 0xb9, 0x5b, 0xc6, 0xe8, 0xa9, 0x6f, 0xf4, 0x72, 0x74, 0xc7, 0xae, 0xb9, 0x08, 0x5a, 0x39, 0xee,
+          0xad, 0x31, 0x91, 0x61, 0x8e, 0xbb, 0xb0, 0x2f, 0xf1, 0x8d, 0x77, 0x11, 0xdb, 0x84, 0x9b, 0xcf, 0x29, 0x97, 0x94, 0x7a, 0xbd, 0x19, 0x81, 0xda,
+          0x51, 0xc8, 0x5d, 0x95, 0x2b, 0x42, 0xda, 0xd7, 0xe4, 0xca, 0xc2, 0x76, 0x59, 0xa2, 0xa0, 0x0c, 0xc6, 0x48, 0x2a, 0x92, 0xb7, 0x32, 0x3b, 0x12,
+          0x9d, 0xac, 0x62, 0x8b, 0x5b, 0xb8, 0x0e, 0x90, 0xbd, 0xbb, 0x58, 0xd5, 0x85, 0xf1, 0x82, 0x78, 0xa9, 0x58, 0x97, 0x63, 0xeb, 0x58, 0xd3, 0x95,
+          0x47, 0xef, 0x8c, 0x07, 0x91, 0x0b, 0xea, 0x09, 0x3a, 0xd3, 0x6e, 0xf1, 0x3f, 0xed, 0x66, 0xaf, 0xdd, 0xdf, 0xe8, 0x1a, 0x7a, 0x1d, 0xbe, 0x5e,
+          0x5c, 0x79, 0x78, 0x03, 0x5f, 0x10, 0x08, 0x32, 0x28, 0xe2, 0xb5, 0x42, 0x0b, 0x0c, 0xa2, 0x5b, 0x78, 0x7e, 0xb0, 0x50, 0x90, 0x2a, 0xf3, 0x62,
+          0x85, 0xea, 0x42, 0x9a, 0xe4, 0x7a, 0xfa, 0x0b, 0xc8, 0xca, 0x39, 0xb5, 0xda, 0x9d, 0x72, 0xc4, 0x83, 0xd1, 0x4b, 0xd4, 0x8b, 0x4e, 0x6a, 0x32,
+          0xe3, 0xfc, 0x9d, 0x5f, 0xe0, 0x5f, 0x53, 0x6e, 0x84, 0xde, 0x92, 0x3e, 0x3c, 0xf6, 0x37, 0x7b, 0x4d, 0x13, 0xb6, 0xd6, 0xc8, 0xbf, 0x4e, 0x91,
+          0x73, 0x79, 0x4d, 0x8d, 0x75, 0x96, 0x87, 0xb5, 0xee, 0x2b, 0x41, 0xa8, 0xe7, 0x50, 0x08, 0xe0, 0xbc, 0x31, 0x1d, 0xeb, 0xb5, 0x34, 0x5a, 0xe4,
+          0xac, 0x6c, 0x31, 0xb0, 0x7c, 0x54, 0xc4, 0xe6, 0x05, 0x33, 0x42, 0xbd, 0xef, 0x79, 0x2e, 0x01, 0xca, 0xd6, 0xf9, 0x00, 0x48, 0x05, 0x48, 0xe0,
+          0x89, 0x5f, 0xac, 0x81, 0xa2, 0x78, 0x49, 0x5a, 0xee, 0x8a, 0x17, 0x94, 0xe6, 0x42, 0x2e, 0xce, 0x11, 0x0e, 0xd5, 0xac, 0xc9, 0xd5, 0x58, 0x72,
+          0xb6, 0x3d, 0x69, 0xd4, 0x3b, 0x68, 0x95, 0xb5, 0xd3, 0xe5, 0x3c, 0xef, 0x57, 0xa8, 0xe8, 0x67, 0x54, 0x8f, 0x7a, 0x59, 0xb6, 0x0c, 0xcc, 0x72,
+          0x1d, 0xb5, 0xa3, 0x31, 0x15, 0x7a, 0x3d, 0xb2, 0x03, 0xbb, 0x45, 0xbe, 0x82, 0x37, 0xbb, 0xb6, 0x6c, 0x18, 0xfb, 0xbd, 0x0f, 0x70, 0x6d, 0x3d,
+          0x94, 0xcb, 0xb3, 0x26, 0xcd, 0x25, 0xe3, 0xeb, 0x1f, 0xac, 0xc7, 0xe4, 0x79, 0xb8, 0x44, 0xd1, 0xea, 0xed, 0x9f, 0x21, 0x26, 0xf2, 0xe2, 0x0a,
+          0xbe, 0xf3, 0xd1, 0x63, 0x9a, 0xfa, 0xb7, 0xc9, 0xe0, 0xd1, 0x3b, 0xe6, 0x38, 0xdf, 0xc8, 0x4b, 0x16, 0x08, 0xd6, 0x40, 0x7d, 0xbe, 0x26, 0x02,
+          0x93, 0xe9, 0x8f, 0xd8, 0xc1, 0x91, 0x1f, 0xc9, 0xec, 0xe9, 0x94, 0x53, 0x71, 0x0e, 0x76, 0x3d, 0x97, 0x3a, 0x4a, 0xa1, 0xa6, 0x9a, 0x8c, 0xc9,
+          0x95, 0xc8, 0xbb, 0xf6, 0x28, 0x06, 0x0b, 0xd6, 0x9c, 0x38, 0x20, 0x9b, 0x87, 0x5e, 0x98, 0xd2, 0x64, 0xee, 0x34, 0xcf, 0x02, 0x5c, 0x56, 0x0e,
+          0x4f, 0x5f, 0x12, 0x81, 0x27, 0x0f, 0x65, 0xcd, 0xcd, 0xeb, 0x52, 0xfb, 0xcd, 0x6a, 0x79, 0x72, 0xe0, 0x6e, 0xc9, 0x89, 0x37, 0xb6, 0xa4, 0xb0,
+          0x8b, 0x28, 0x47, 0xb7, 0x99, 0x94, 0x32, 0xd9, 0x22, 0x14, 0x9e, 0xc8, 0x66, 0xca, 0x6e, 0x16, 0xa5, 0xd3, 0x2d, 0x46, 0xe5, 0xa0, 0x0c, 0xd2,
+          0x87, 0x5c, 0x65, 0x33, 0x5a, 0xe6, 0x85, 0xa5, 0x56, 0x14, 0x04, 0xb2, 0xdd, 0x82, 0x29, 0x8a, 0xc2, 0xe1, 0xb0, 0x00, 0x82, 0x24, 0xa4, 0xea,
+          0x88, 0x0e, 0xa0, 0xa3, 0xd7, 0xcc, 0x90, 0x2b, 0x8f, 0x17, 0xb4, 0xa0, 0x9d, 0xb3, 0x36, 0xaa, 0xdf, 0x62, 0x72, 0x5d, 0x8c, 0xe1, 0x96, 0x78,
+          0x38, 0x10, 0x46, 0x9a, 0x3e, 0x49, 0x03, 0x08, 0x0d, 0x33, 0x14, 0xef, 0xe6, 0x5c, 0x08, 0xc8, 0xe4, 0x80, 0xff, 0xc3, 0xbb, 0x1c, 0x0f, 0x88,
+          0xf9, 0x20, 0xa3, 0x79, 0xdd, 0x49, 0x01, 0x9a, 0x65, 0xc2, 0x57, 0xeb, 0x5d, 0x0a, 0x67, 0x56, 0xf9, 0x22, 0x2d, 0xfe, 0x5a, 0x62, 0x82, 0x79,
+          0x18, 0x80, 0x45, 0xf8, 0xc7, 0xba, 0xb6, 0x99, 0x9d, 0xdf, 0xf6, 0xaf, 0x97, 0x91, 0xe1, 0x35, 0x23, 0x78, 0xf1, 0x95, 0xad, 0xc7, 0x48, 0xf5,
+          0x4c, 0x22, 0x7e, 0x22, 0xe5, 0x8f, 0x50, 0x35, 0x3e, 0x45, 0x9e, 0x49, 0x78, 0x9b, 0x89, 0x32, 0xf7, 0x8b, 0xf3, 0x28, 0xb6, 0x6d, 0x83, 0xff,
+          0xfd, 0x36, 0x11, 0x44, 0xac, 0x23, 0xf7, 0x12, 0x35, 0x3c, 0x68, 0xa8, 0xa9, 0xf1, 0x31, 0xe8, 0x01, 0x29, 0x5a, 0x50, 0x37, 0x4c, 0x28, 0xac,
+          0x20, 0xb7, 0x28, 0xbf, 0xc1, 0x3b, 0xcc, 0x18, 0x7c, 0xb6, 0x1e, 0x3d, 0x5b, 0x06, 0xa8, 0xe9, 0x0e, 0x1b, 0x15, 0x12, 0x0c, 0xa2, 0x61, 0xa9,
+          0xb2, 0x9e, 0x75, 0x54, 0x7b, 0x0b, 0x2f, 0x62, 0x8a, 0x3f, 0xba, 0xc3, 0x1f, 0x7d, 0xd7, 0x6f, 0x09, 0x7c, 0xa2, 0xd8, 0xdf, 0x04, 0xad, 0x0d,
+          0xf3, 0x7a, 0x10, 0x9c, 0x52, 0xa4, 0xa4, 0x3b, 0x8c, 0xd1, 0x35, 0x6a, 0x9e, 0x39, 0x1c, 0xda, 0x06, 0x4a, 0x51, 0xda, 0x99, 0x51, 0xc0, 0x21,
+          0x8b, 0xe7, 0x21, 0xc4, 0x0c, 0x2f, 0x34, 0x19, 0x32, 0xa3, 0xbb, 0x5c, 0xb0, 0xea, 0x0a, 0x29, 0xe9, 0x8e, 0xba, 0x21, 0xa0, 0xa2, 0x58, 0x47,
+          0x54, 0x94, 0x08, 0x46, 0x27, 0x74, 0x2d, 0x21, 0xb8, 0xd4, 0xf2, 0x9b, 0x32, 0x01, 0x44, 0xa0, 0xf9, 0xca, 0xf8, 0x9f, 0x7c, 0xbc, 0x90, 0xb1,
+          0xf2, 0x53, 0x3c, 0xd0, 0x3e, 0xd7, 0x4c, 0x86, 0x5d, 0x1f, 0xa1, 0xa6, 0x33, 0x95, 0x40, 0x84, 0x89, 0xa6, 0x73, 0x2f, 0xe8, 0x92, 0x8f, 0x63,
+          0x47, 0xa6, 0xee, 0xf5, 0xd3, 0x49, 0xc1, 0x8d, 0x8f, 0x6b, 0xaf, 0xfb, 0x86, 0x20, 0xaf, 0x20, 0x08, 0xb1, 0x97, 0x87, 0x12, 0x16, 0x89, 0x60,
+          0x09, 0x28, 0xa8, 0x50, 0x44, 0xb5, 0x08, 0x10, 0xc0, 0xa0, 0x0c, 0xa2, 0xfb, 0x25, 0xdc, 0x61, 0xf3, 0x56, 0x4d, 0xa8, 0x77, 0x7e, 0x19, 0x7b,
+          0x01, 0x42, 0x34, 0x7e, 0xfa, 0x49, 0x2f, 0xa3, 0xaf, 0x98, 0x18, 0x40, 0xf3, 0x33, 0x90, 0x0d, 0xb4, 0x89, 0xb7, 0x0e, 0xd5, 0x51, 0x08, 0x3b,
+          0x9a, 0xbf, 0xa4, 0xc3, 0x8a, 0x36, 0xc8, 0xa7, 0x99, 0x68, 0xa0, 0xd1, 0x5b, 0x87, 0x93, 0x10, 0xdb, 0xfe, 0xc7, 0x5a, 0xa4, 0xfe, 0xac, 0x14,
+          0x4c, 0x9c, 0xec, 0xd0, 0xf5, 0xe4, 0x93, 0x90, 0x25, 0x45, 0x33, 0x4b, 0xa1, 0xd5, 0x97, 0x62, 0xeb, 0x94, 0xdf, 0x69, 0x22, 0x33, 0xa6, 0xe6,
+          0x9a, 0xa4, 0x0e, 0x4c, 0x15, 0x60, 0x56, 0x4b, 0xcb, 0xf8, 0xa4, 0xec, 0x57, 0xd6, 0xd0, 0xa0, 0x83, 0x31, 0x13, 0x78, 0x70, 0x3d, 0x75, 0xfa,
+          0x50, 0x16, 0xbe, 0x91, 0x1a, 0x33, 0x83, 0x94, 0x48, 0x16, 0xb4, 0x0b, 0x0f, 0x40, 0x6e, 0x55, 0xd5, 0x62, 0x94, 0x29, 0x2b, 0x77, 0x26, 0xa5,
+          0xd8, 0x66, 0xac, 0x39, 0xc1, 0xba, 0xe9, 0xcd, 0xa6, 0xb4, 0xd2, 0x01, 0xb3, 0x18, 0xd4, 0xd4, 0xfc, 0x9d, 0xa1, 0x07, 0x7a, 0x1d, 0x86, 0xc1,
+          0x7f, 0xe1, 0x7e, 0x29, 0x06, 0x24, 0x39, 0x7c, 0xeb, 0x42, 0xc3, 0x27, 0x11, 0x0e, 0xb9, 0x17, 0x39, 0x4a, 0x9b, 0x32, 0x72, 0x60, 0x71, 0xd2,
+          0x5b, 0xf4, 0xe5, 0x33, 0x8d, 0x87, 0xbf, 0xe0, 0x58, 0x19, 0xac, 0x1e, 0xb5, 0xee, 0xc3, 0xce, 0x6c, 0xd3, 0xfb, 0xad, 0xba, 0xa7, 0x3a, 0xf3,
+          0xa2, 0xd2, 0x1e, 0x9f, 0x3d, 0x47, 0x3d, 0x0f, 0xbe, 0xfd, 0x78, 0x76, 0xd4, 0x91, 0xb5, 0x12, 0xa6, 0x60, 0x96, 0x82, 0x32, 0x30, 0xa6, 0xc1,
+          0xbb, 0xd5, 0x94, 0x90, 0x57, 0xc5, 0x7c, 0xfd, 0x85, 0x9a, 0xf8, 0x3e, 0xab, 0xb5, 0x4b, 0x12, 0x96, 0xfc, 0x09, 0xed, 0xf2, 0xef, 0x50, 0xef,
+          0xd5, 0x68, 0xbd, 0xd7, 0x6a, 0xe4, 0x67, 0xfe, 0x9c, 0x3d, 0xc2, 0xee, 0xfa, 0xd7, 0x8f, 0xfd, 0x7f, 0x2c, 0xcb, 0xd5, 0xde, 0xef, 0xcc, 0xd3,
+          0x47, 0x3f, 0x7f, 0x82, 0xc7, 0x3e, 0x26, 0x75, 0xba, 0x35, 0x89, 0x78, 0xe8, 0x4c, 0xec, 0x7d, 0x1b, 0x31, 0x60, 0xe5, 0x3a, 0x61, 0x33, 0x99,
+          0x25, 0xab, 0xaf, 0xbb, 0xe7, 0x72, 0x26, 0xd3, 0x80, 0x16, 0x1e, 0xcd, 0x8e, 0x83, 0xa7, 0xfd, 0x16, 0x61, 0xa7, 0xe6, 0x96, 0x1b, 0xe6, 0x51,
+          0x39, 0xc1, 0xb7, 0x3c, 0x1d, 0x38, 0xa9, 0x00, 0xe0, 0xc8, 0xfd, 0x2a, 0x63, 0x3d, 0x3c, 0x67, 0x9e, 0xe1, 0xbe, 0xad, 0xcf, 0x6d, 0x61, 0xcf,
+          0x25, 0x15, 0xe1, 0xde, 0x94, 0x95, 0x71, 0x2f, 0x61, 0xba, 0x00, 0x54, 0x5f, 0x8d, 0xc4, 0xfa, 0xdf, 0xe6, 0x8f, 0xbb, 0xc5, 0x6f, 0x83, 0xaf,
+          0x94, 0xdd, 0x6f, 0x9e, 0x43, 0xad, 0xbd, 0xaa, 0xe1, 0x28, 0x77, 0x5f, 0xf0, 0x59, 0xb8, 0xf8, 0x46, 0xd6, 0x93, 0x00, 0x1c, 0xe0, 0x06, 0x3f,
+          0x8f, 0x4f, 0xc0, 0x7b, 0x9b, 0xd1, 0x24, 0xc7, 0xe7, 0x8e, 0xe9, 0x3d, 0x1a, 0x8e, 0x5f, 0x0c, 0x97, 0x04, 0x93, 0xe0, 0xfc, 0x25, 0x1d, 0xc4,
+          0x81, 0x1e, 0x8d, 0x3b, 0x2f, 0x21, 0xfb, 0x67, 0x32, 0xa7, 0xfe, 0x21, 0xa0, 0xa6, 0xaf, 0xdf, 0x9c, 0x08, 0x36, 0x50, 0x33, 0xee, 0x04, 0x1b,
+          0x8e, 0x84, 0xd8, 0x34, 0x51, 0x23, 0xb9, 0x05, 0xab, 0x6c, 0xe2, 0xbe, 0xf4, 0xdb, 0xa3, 0x02, 0xce, 0xea, 0x6c, 0x07, 0xeb, 0x99, 0x44, 0x7f,
+          0xeb, 0x1d, 0x14, 0x55, 0xe8, 0xb1, 0x75, 0x3d, 0xb6, 0x6d, 0x3f, 0xdf, 0x1c, 0xea, 0x62, 0x01, 0xb5, 0x10, 0x8e, 0x55, 0x8e, 0x3b, 0x54, 0x55,
+          0xbd, 0xf3, 0x2e, 0xdc, 0xb1, 0xf7, 0x3d, 0x99, 0x12, 0xaa, 0x46, 0x9e, 0x0d, 0x26, 0xbe, 0xeb, 0x77, 0x38, 0x3b, 0x4f, 0xd2, 0xa5, 0x79, 0xdc,
+          0x8e, 0x1e, 0xab, 0xda, 0xf6, 0x78, 0xd7, 0x12, 0xd4, 0xa4, 0xeb, 0xfa, 0xa4, 0xd4, 0x5e, 0xf1, 0x26, 0x52, 0xbb, 0x39, 0x7c, 0x14, 0x10, 0x35,
+          0xa8, 0xcb, 0x7a, 0x3e, 0xce, 0x08, 0x35, 0x9d, 0x0a, 0x5b, 0x7e, 0xc2, 0x30, 0xec, 0xa9, 0x9f, 0xd8, 0xdc, 0x49, 0xdf, 0x5d, 0xc4, 0xa1, 0x49,
+          0x42, 0x68, 0x5e, 0xb4, 0xb2, 0x92, 0x31, 0x3f, 0x85, 0x15, 0xe2, 0xc3, 0x93, 0x98, 0x9f, 0x90, 0x06, 0x80, 0x9d, 0xcc, 0xab, 0xfc, 0xce, 0x20,
+          0x78, 0x8f, 0xec, 0x16, 0xc6, 0x60, 0x3c, 0x74, 0xbc, 0xba, 0x1f, 0x7a, 0x48, 0xc7, 0xdd, 0xa3, 0x13, 0xce, 0x93, 0xbc, 0x00, 0xf7, 0xbf, 0xa6,
+          0x3d, 0x06, 0xe1, 0x13, 0x98, 0x87, 0x4a, 0x85, 0x34, 0x3a, 0x7a, 0xe9, 0x8d, 0x8d, 0x97, 0x72, 0x3a, 0x90, 0xf1, 0xbf, 0x21, 0x5c, 0x0f, 0xc0,
+          0x80, 0xe3, 0x9a, 0x72, 0x24, 0xfd, 0x39, 0xe5, 0x6b, 0x95, 0x66, 0xb9, 0x22, 0xef, 0x23, 0x73, 0x55, 0x32, 0x3d, 0x80, 0x2b, 0xc8, 0xa0, 0x64,
+          0xe4, 0x73, 0x1e, 0x3f, 0xa3, 0x98, 0x3f, 0xca, 0x26, 0x97, 0x7f, 0x9e, 0xc2, 0x47, 0x6a, 0x56, 0x38, 0x62, 0x22, 0xdd, 0xee, 0x38, 0xd2, 0xd8,
+          0x4d, 0xc2, 0xd6, 0xb8, 0xc0, 0x7c, 0x64, 0x37, 0xb5, 0xf7, 0xd3, 0xf3, 0x7c, 0xe3, 0x5d, 0x4d, 0xc2, 0xa3, 0xb7, 0x8a, 0x53, 0xe9, 0x61, 0x16,
+          0x8c, 0xf0, 0xf6, 0xe2, 0xe8, 0x5f, 0x77, 0xdb, 0xb3, 0x5e, 0xa5, 0xc6, 0xdb, 0x49, 0x68, 0x38, 0xd2, 0xe8, 0x38, 0x05, 0x8b, 0x25, 0x7f, 0x28,
+          0xcd, 0x47, 0x0f, 0x53, 0x63, 0xa0, 0xa2, 0xbb, 0xfc, 0x7a, 0x3a, 0x83, 0x8b, 0x5f, 0x79, 0xa9, 0x9b, 0xa3, 0x5c, 0x5d, 0xda, 0x54, 0xd6, 0x9f,
+          0xdb, 0x46, 0x24, 0xfe, 0x68, 0x80, 0xd6, 0xf8, 0x89, 0x3d, 0x47, 0xc2, 0xcf, 0xf3, 0x3f, 0xb4, 0x4b, 0xdb, 0x6f, 0x28, 0x86, 0x9a, 0x86, 0x2c,
+          0x8e, 0xd8, 0x20, 0x48, 0xc4, 0xae, 0x97, 0xdd, 0x82, 0xff, 0x85, 0x2b, 0xb4, 0x00, 0xc4, 0xf1, 0x25, 0xf0, 0x0e, 0x5d, 0xd6, 0xb5, 0xfc, 0x0b,
+          0x76, 0xcb, 0xc0, 0xab, 0xf8, 0x03, 0x8f, 0x09, 0xba, 0xd8, 0x3e, 0x8f, 0x8d, 0x1e, 0xba, 0x6b, 0xfb, 0xbe, 0x6d, 0x3e, 0x94, 0x22, 0x36, 0x45,
+          0xa0, 0x1d, 0x58, 0x85, 0xc2, 0x5c, 0xdd, 0x9f, 0xb6, 0x0f, 0x13, 0x39, 0x3c, 0x42, 0xe5, 0x04, 0xb2, 0x37, 0x2d, 0xca, 0xad, 0x1c, 0xce, 0x2d,
+          0x3e, 0xdf, 0xca, 0xc7, 0xa3, 0xb5, 0x6c, 0x3b, 0x6d, 0xbb, 0x43, 0xdb, 0xcb, 0xfc, 0xbe, 0xd3, 0x1d, 0x4f, 0x26, 0x96, 0x14, 0x17, 0x51, 0x6f,
+          0xb9, 0xec, 0x72, 0xe3, 0x55, 0x9e, 0x6b, 0x97, 0x61, 0xae, 0xa1, 0x79, 0x74, 0x53, 0xe7, 0x3d, 0x9f, 0x6a, 0xd6, 0xa3, 0xbc, 0xf9, 0x97, 0xd4,
+          0xee, 0x8c, 0xe8, 0x0a, 0x1a, 0x53, 0x5d, 0x58, 0x7b, 0x11, 0x89, 0x66, 0x4a, 0xa6, 0x35, 0x28, 0x61, 0x97, 0x0f, 0x0b, 0x58, 0x7c, 0xe7, 0xdd,
+          0xcc, 0x97, 0x39, 0xcf, 0x0c, 0x61, 0x88, 0x08, 0x05, 0x79, 0x57, 0x97, 0x97, 0xc9, 0x3e, 0xf8, 0x25, 0xae, 0x6b, 0x1c, 0x66, 0x40, 0x1d, 0x46,
+          0x51, 0xcb, 0xfc, 0xf5, 0x74, 0x87, 0x2a, 0x45, 0x1c, 0x78, 0x96, 0x2f, 0x56, 0xfd, 0x1b, 0x06, 0xc7, 0x47, 0x60, 0x18, 0x4c, 0x0e, 0x9e, 0x00,
+          0x9f, 0x50, 0x5e, 0x82, 0xa5, 0x48, 0x99, 0xf7, 0xa5, 0xc0, 0x84, 0x8f, 0x02, 0x23, 0xcc, 0x29, 0xd1, 0x56, 0x84, 0x29, 0x1f, 0x81, 0x53, 0x1e,
+          0xcb, 0x1e, 0x6a, 0xde, 0xa3, 0x5a, 0x67, 0x5b, 0xc1, 0xca, 0x26, 0x16, 0xd3, 0x1c, 0x9c, 0x92, 0x6b, 0xde, 0x4f, 0x3e, 0x78, 0x50, 0xa1, 0xb4,
+          0xff, 0xed, 0x24, 0xb0, 0x49, 0x3c, 0xfc, 0xee, 0xa5, 0x08, 0x3b, 0x02, 0x94, 0x44, 0x88, 0x04, 0x5d, 0x1b, 0x98, 0x19, 0x61, 0xf8, 0x6f, 0xed,
+          0x90, 0x86, 0x5f, 0x56, 0x46, 0x2f, 0x82, 0x3d, 0x71, 0x2a, 0x20, 0xc3, 0x83, 0x24, 0x69, 0x1e, 0xf6, 0xd4, 0x80, 0x4f, 0xcf, 0xd0, 0xa1, 0xee,
+          0x51, 0x34, 0xfb, 0x0a, 0x63, 0x37, 0x66, 0x0b, 0x2e, 0x3b, 0x54, 0xd4, 0x26, 0x34, 0xa4, 0xb3, 0x28, 0x50, 0xff, 0xd8, 0x47, 0xc9, 0xe7, 0x9b,
+          0x14, 0xfc, 0x33, 0x2b, 0x87, 0x68, 0x3c, 0xd5, 0x88, 0x35, 0x7c, 0x94, 0xad, 0xbb, 0xe4, 0x61, 0x67, 0x60, 0xe7, 0xc5, 0xf4, 0xc4, 0x47, 0x32,
+          0x44, 0x05, 0x6a, 0xa6, 0x9d, 0x40, 0x92, 0xf8, 0x2e, 0x5e, 0x1e, 0x0f, 0xab, 0x19, 0x0e, 0x75, 0x74, 0x72, 0x44, 0x75, 0x00, 0x2c, 0xcf, 0x13,
+          0x6d, 0x4e, 0x83, 0x5d, 0xa9, 0x7c, 0x16, 0xd0, 0xd8, 0x55, 0x6e, 0x3f, 0xe5, 0x40, 0x5a, 0xc1, 0x03, 0x1f, 0x7a, 0x7a, 0xf9, 0x81, 0xf8, 0x9f,
+          0x4b, 0x0c, 0x74, 0x31, 0xbb, 0xd1, 0x59, 0x9a, 0x40, 0x78, 0xd1, 0xd6, 0xf5, 0x87, 0x45, 0xf6, 0xf5, 0x09, 0x05, 0x5e, 0xb8, 0x53, 0x96, 0x9f,
+          0x7b, 0x7d, 0xe2, 0xb5, 0x70, 0x5c, 0x6d, 0x88, 0xa4, 0xae, 0xb1, 0xf6, 0x30, 0xe1, 0xfc, 0xcb, 0xc0, 0x33, 0x9b, 0x38, 0x89, 0x62, 0x7f, 0x70,
+          0x53, 0xf4, 0xdf, 0xf2, 0x76, 0xdd, 0xf3, 0x78, 0xd0, 0xa7, 0xe5, 0xcf, 0xa5, 0x9d, 0x3b, 0x2f, 0xa5, 0x42, 0xc7, 0xf0, 0xa6, 0xf2, 0x3a, 0x9b,
+          0x35, 0x4b, 0x8d, 0x6a, 0xb6, 0x4b, 0xe8, 0xe6, 0x66, 0xc5, 0x50, 0xef, 0x0f, 0x2c, 0xde, 0xba, 0x2e, 0x71, 0xb7, 0xcc, 0x14, 0xaf, 0x7a, 0x03,
+          0x7a, 0xaa, 0x89, 0x1c, 0xdd, 0x8a, 0x13, 0x76, 0x84, 0x41, 0x3c, 0xec, 0x22, 0x18, 0xa6, 0x21, 0x14, 0x29, 0xd3, 0x9f, 0x11, 0x8c, 0xfb, 0x58,
+          0x94, 0x10, 0xb7, 0x96, 0xc5, 0xa2, 0x5f, 0x06, 0xdf, 0xa8, 0xf7, 0x7b, 0xcc, 0x9a, 0x7a, 0x4f, 0x48, 0xfe, 0xa6, 0xcf, 0x7c, 0x38, 0xa1, 0xf2,
+          0xe9, 0x3d, 0x07, 0xd8, 0x5d, 0x4f, 0xd8, 0x41, 0xa6, 0xf9, 0xfc, 0xbb, 0xce, 0x3d, 0xed, 0x62, 0x7b, 0xac, 0x9d, 0x05, 0xe2, 0xe1, 0xd4, 0xdf,
+          0xbc, 0x87, 0x4b, 0x7e, 0xeb, 0xf9, 0xfa, 0x92, 0xe2, 0xba, 0x21, 0x0a, 0xff, 0x33, 0x97, 0x21, 0x72, 0xea, 0xf1, 0x51, 0x28, 0x00, 0x13, 0xbe,
+          0x6a, 0x2f, 0xf8, 0xad, 0xbc, 0x9a, 0x9d, 0xcd, 0x46, 0xad, 0x78, 0x86, 0x5c, 0x4b, 0xe9, 0xff, 0x16, 0x45, 0x16, 0x1a, 0x28, 0x43, 0xfa, 0x65,
+          0xad, 0x92, 0x7e, 0x27, 0x8c, 0xc6, 0x72, 0x45, 0x97, 0xbe, 0x10, 0xb7, 0x57, 0xda, 0x8c, 0x52, 0x18, 0x9d, 0x45, 0xe8, 0x7b, 0xa2, 0x20, 0xc8,
+          0xa5, 0x19, 0xd4, 0x3f, 0x97, 0xa6, 0x79, 0x9a, 0xcf, 0x3c, 0x76, 0x46, 0xd3, 0x58, 0x2e, 0xdb, 0x20, 0xb7, 0x8c, 0xdc, 0xda, 0x5c, 0xc8, 0x38,
+          0x88, 0x21, 0x56, 0xb6, 0xbf, 0x0d, 0xc7, 0xc7, 0x35, 0x43, 0x0e, 0x01, 0xb9, 0x5f, 0x0b, 0x0a, 0xee, 0x40, 0xf9, 0x67, 0xe6, 0x80, 0xae, 0x9d,
+          0x51, 0xee, 0x7a, 0xa2, 0xbc, 0x9d, 0x06, 0x4e, 0x40, 0xa0, 0x48, 0x17, 0x1c, 0x0d, 0x78, 0xc1, 0x61, 0xd1, 0x72, 0x62, 0x97, 0xbc, 0x2b, 0xd0,
+          0x41, 0x0f, 0xc5, 0x0a, 0x53, 0x21, 0xe0, 0x75, 0x8b, 0x31, 0xdb, 0x66, 0x15, 0xf1, 0x6b, 0x4d, 0x29, 0x0e, 0xbe, 0x58, 0x61, 0x17, 0xe9, 0x7f,
+          0xbe, 0xd4, 0xa8, 0x9d, 0x58, 0x53, 0x2a, 0x89, 0xff, 0x11, 0xf6, 0x42, 0xc8, 0x78, 0x49, 0x47, 0x82, 0xa0, 0x95, 0xc4, 0x09, 0x56, 0x49, 0xe9,
+          0x51, 0x99, 0x45, 0xe7, 0xa6, 0x86, 0x74, 0xe6, 0x2c, 0x90, 0x59, 0x77, 0x48, 0xa3, 0x5f, 0x45, 0x88, 0xb2, 0x96, 0x4b, 0xf4, 0x90, 0x60, 0x35,
+          0x1c, 0xa2, 0xe2, 0x6f, 0x6b, 0xba, 0x21, 0x13, 0x49, 0x88, 0x54, 0xc6, 0xf0, 0x4e, 0x5f, 0xbf, 0x8d, 0x34, 0xf8, 0x71, 0x69, 0xa1, 0x4a, 0x54,
+          0x3a, 0x09, 0xcc, 0x50, 0xff, 0x24, 0x4c, 0xf0, 0x86, 0x8c, 0x06, 0x45, 0xb6, 0x70, 0x32, 0x69, 0xd1, 0xb4, 0x74, 0x72, 0x92, 0xe8, 0xa7, 0x96,
+          0xa0, 0x17, 0xaa, 0x7d, 0x0e, 0xd4, 0xe8, 0x83, 0x1c, 0x19, 0x83, 0x54, 0x6f, 0x8a, 0x15, 0xb0, 0x92, 0x74, 0x96, 0x13, 0x04, 0x3e, 0x5a, 0x46,
+          0xc0, 0x79, 0xe5, 0x2d, 0x53, 0x5a, 0xb0, 0xb0, 0x87, 0x7c, 0x38, 0x82, 0x52, 0xc1, 0xdd, 0xa2, 0x20, 0x52, 0x57, 0x89, 0x29, 0xcc, 0xbd, 0x64,
+          0x32, 0x69, 0xea, 0xc0, 0x1e, 0xf6, 0xf4, 0x5c, 0x76, 0x98, 0x48, 0x4f, 0xbc, 0xca, 0x76, 0x16, 0x94, 0x33, 0xf7, 0x19, 0x83, 0x7e, 0x08, 0x86,
+          0xa7, 0x25, 0xba, 0x1c, 0x22, 0x3c, 0x8d, 0x59, 0x37, 0xc3, 0x1a, 0xfc, 0xeb, 0xcd, 0x82, 0xe7, 0x20, 0x6b, 0x53, 0x82, 0x4a, 0xb4, 0x72, 0xbf,
+          0x72, 0x22, 0xc4, 0xd9, 0x76, 0x95, 0x02, 0x3f, 0xc5, 0xeb, 0x32, 0xac, 0x0c, 0x98, 0x2a, 0x82, 0x81, 0x5b, 0xab, 0xf9, 0xf4, 0x98, 0x61, 0x56,
+          0xcc, 0xa7, 0x9a, 0xc2, 0x6a, 0x83, 0xd6, 0xcc, 0x4b, 0x0f, 0xb3, 0xf0, 0x26, 0x21, 0xaa, 0x38, 0xd1, 0x94, 0x3e, 0xa6, 0xed, 0x82, 0x10, 0x54,
+          0x2c, 0x96, 0x42, 0xa0, 0xd7, 0x46, 0x21, 0xa0, 0xf7, 0x34, 0xf7, 0x7d, 0x79, 0xd9, 0x86, 0x0a, 0x45, 0xa3, 0x36, 0x48, 0x7e, 0x3a, 0x94, 0xc5,
+          0x47, 0xa7, 0xb0, 0x3e, 0x92, 0x24, 0xa2, 0x39, 0xe5, 0xe0, 0x9f, 0x32, 0x9c, 0xd0, 0x95, 0x78, 0x43, 0x08, 0x7c, 0x0b, 0xee, 0xe1, 0x4f, 0xba,
+          0xa3, 0xbc, 0xe7, 0x69, 0x97, 0x57, 0x25, 0xf5, 0xfb, 0x56, 0x32, 0xe2, 0xdb, 0x65, 0x9f, 0x5a, 0x8c, 0xcf, 0x3f, 0xc7, 0xef, 0x6e, 0x69, 0x5c,
+          0x3e, 0x7a, 0xa8, 0xad, 0xc5, 0xdc, 0x7d, 0xf2, 0xba, 0x97, 0xee, 0xc0, 0x65, 0x07, 0x9a, 0xf3, 0x60, 0x2f, 0xed, 0x1d, 0x4a, 0xdb, 0xb1, 0xb6,
+          0x5c, 0xd6, 0x99, 0x65, 0x76, 0x2c, 0x1d, 0xc5, 0x72, 0x9d, 0x9d, 0x2b, 0xec, 0xbd, 0x5b, 0x9e, 0x61, 0x62, 0x10, 0xdd, 0x60, 0xb6, 0x3c, 0x3d,
+          0xb7, 0xf9, 0xb1, 0xbb, 0x08, 0xa7, 0xff, 0x9c, 0x0f, 0x78, 0x79, 0xcb, 0xef, 0x6b, 0xae, 0x43, 0xe3, 0x3f, 0x76, 0xdd, 0x69, 0x6f, 0x9a, 0x63,
+          0xb7, 0x00, 0xc6, 0x65, 0xcc, 0xb3, 0xac, 0xf9, 0xde, 0x5e, 0xc4, 0x9f, 0x0d, 0x0d, 0xc4, 0xdf, 0x78, 0x07, 0xb2, 0x97, 0x80, 0x38, 0x1c, 0x1e,
+          0x26, 0x08, 0xdf, 0xa9, 0xb7, 0xa3, 0xf6, 0xab, 0xe9, 0x29, 0xd2, 0x98, 0xca, 0xce, 0xb2, 0xb9, 0x82, 0x87, 0x52, 0xb1, 0x33, 0xaf, 0xda, 0xad,
+          0x82, 0x34, 0x2f, 0xbc, 0xa2, 0xe9, 0x2f, 0xcd, 0xc2, 0xc0, 0xa4, 0xe1, 0x2a, 0xc0, 0xfa, 0x13, 0xa3, 0x48, 0x5b, 0x36, 0x65, 0x05, 0x98, 0x4f,
+          0x4f, 0xf3, 0x02, 0xfe, 0xe1, 0x5e, 0xc1, 0x39, 0x7f, 0x36, 0xb6, 0x98, 0x90, 0x38, 0xbe, 0x1b, 0x0d, 0x9c, 0x5d, 0x81, 0x2e, 0x66, 0x2a, 0x74,
+          0x2d, 0x6b, 0xfa, 0xe4, 0xb1, 0x03, 0x9d, 0xd2, 0x1f, 0x9d, 0x22, 0xe1, 0x8f, 0x2b, 0x33, 0xf8, 0x17, 0x82, 0x2d, 0x10, 0xe0, 0xd5, 0x8c, 0xc4,
+          0x9a, 0xd0, 0xbb, 0x3b, 0xe4, 0x0a, 0x75, 0x8f, 0xd5, 0x87, 0x03, 0x32, 0x75, 0x1c, 0xa2, 0x94, 0x2b, 0x88, 0x5f, 0x0b, 0x1d, 0xf9, 0x79, 0xd9,
+          0x85, 0x14, 0xce, 0x12, 0x11, 0x99, 0xaa, 0x3a, 0x81, 0x58, 0x08, 0xcd, 0x07, 0xd9, 0x47, 0x2f, 0xab, 0x2e, 0x50, 0xc2, 0xfe, 0x25, 0x70, 0xbb,
+          0x54, 0xb0, 0x26, 0xa1, 0xc2, 0x05, 0xa4, 0x6d, 0xaf, 0x29, 0x57, 0x8e, 0xac, 0x40, 0x77, 0x99, 0xd5, 0x05, 0x38, 0x2b, 0xb5, 0x6d, 0x42, 0x16,
+          0xe9, 0x3c, 0x2b, 0x4a, 0x03, 0x7c, 0x32, 0xf1, 0x70, 0x27, 0x96, 0x79, 0x13, 0xad, 0x2b, 0x49, 0xcb, 0x87, 0x92, 0x40, 0x06, 0xe1, 0x28, 0xf6,
+          0xa0, 0x45, 0x39, 0x65, 0xd1, 0x8b, 0x5e, 0x87, 0xea, 0x61, 0x07, 0x58, 0x7e, 0x15, 0xa8, 0x1b, 0xfb, 0xb2, 0x37, 0x4b, 0xb5, 0xc4, 0x7d, 0x54,
+          0x2c, 0x89, 0x4a, 0x01, 0x0b, 0xfa, 0x24, 0x8e, 0xa8, 0x9c, 0xee, 0x44, 0xc7, 0xa2, 0x06, 0xb0, 0x03, 0x8c, 0x68, 0xfe, 0x4b, 0xa1, 0x8a, 0xdf,
+          0x14, 0x9c, 0xb4, 0xfe, 0x38, 0xe0, 0x40, 0x7e, 0x5c, 0x4d, 0x05, 0x1b, 0x64, 0x5c, 0x82, 0x0f, 0x76, 0x02, 0x39, 0x44, 0x8b, 0x62, 0xe2, 0x90,
+          0xfc, 0xca, 0x91, 0xed, 0x6d, 0x23, 0x31, 0x9f, 0x44, 0xe1, 0x7a, 0xed, 0x5a, 0x40, 0x04, 0xae, 0xc5, 0x6e, 0xda, 0x34, 0xec, 0x01, 0x4e, 0xd5,
+          0x7e, 0x03, 0x73, 0x03, 0x30, 0x84, 0x99, 0x94, 0x57, 0x9d, 0x53, 0x45, 0x19, 0x25, 0x9c, 0x86, 0x50, 0x72, 0xaa, 0x0d, 0x2e, 0x6d, 0x1f, 0x14,
+          0x7d, 0x11, 0x4a, 0x1d, 0xf0, 0xf9, 0xdc, 0x48, 0xbe, 0xfc, 0x2f, 0xa9, 0xbd, 0x9f, 0xb2, 0xbd, 0x11, 0x2d, 0xeb, 0x15, 0xe8, 0xbf, 0xf0, 0xe5,
+          0xa5, 0x55, 0xe1, 0xcf, 0x63, 0xa3, 0x17, 0xf1, 0xf1, 0x6c, 0x40, 0x22, 0x56, 0x05, 0x75, 0x01, 0xa3, 0x42, 0x27, 0x28, 0xe1, 0x22, 0x74, 0x99,
+          0xa2, 0x8b, 0xfd, 0xbe, 0x1f, 0x61, 0x3c, 0xb4, 0x2e, 0x0c, 0x02, 0x18, 0x0a, 0xc3, 0x74, 0x64, 0xd0, 0x5b, 0x47, 0x32, 0x27, 0x3e, 0xbf, 0xdd,
+          0x25, 0x09, 0x9f, 0xef, 0xcf, 0xe7, 0xd5, 0x69, 0x21, 0xdf, 0xee, 0x07, 0x54, 0xc8, 0x62, 0xb1, 0x26, 0xf7, 0x31, 0x35, 0xc0, 0xd7, 0xfb, 0x5b,
+          0x78, 0x20, 0xc0, 0x4f, 0xc7, 0x90, 0x2d, 0xda, 0x4c, 0x5d, 0xc0, 0x1a, 0x17, 0x97, 0xed, 0x4c, 0x97, 0x3d, 0xf1, 0x9f, 0x77, 0xf3, 0xc9, 0xba,
+          0x28, 0x39, 0x22, 0x84, 0xcf, 0x74, 0x22, 0x75, 0xeb, 0x0a, 0xc4, 0x15, 0x57, 0xf6, 0x59, 0xf1, 0x2c, 0xd6, 0x48, 0x68, 0xf4, 0x01, 0xaf, 0xba,
+          0x29, 0x20, 0x09, 0x57, 0x29, 0x4e, 0x38, 0xd2, 0xcc, 0x52, 0xb7, 0x6a, 0x1e, 0x7d, 0x5e, 0xd3, 0x41, 0x32, 0x08, 0x58, 0x10, 0x2f, 0xb4, 0x48,
+          0x4e, 0x95, 0x0c, 0x62, 0xe8, 0x63, 0x37, 0xb7, 0xd7, 0xea, 0x93, 0x8e, 0x92, 0xf7, 0x14, 0x94, 0x89, 0x09, 0x4f, 0x1f, 0x9c, 0x17, 0x60, 0x75,
+          0x34, 0xbe, 0xb8, 0x51, 0xca, 0xa4, 0x60, 0x57, 0x68, 0x02, 0xac, 0x85, 0x2f, 0x77, 0xd1, 0x23, 0xbc, 0x58, 0x92, 0x1b, 0x4f, 0x21, 0xe1, 0x04,
+          0x59, 0xa7, 0x08, 0x0b, 0x06, 0xeb, 0xc6, 0x54, 0x15, 0x2b, 0xb1, 0xe5, 0x36, 0x01, 0xdf, 0x0e, 0xf1, 0x44, 0xd6, 0x87, 0x94, 0x49, 0x17, 0xbb,
+          0x9a, 0x9b, 0xcd, 0xa2, 0xfa, 0x1b, 0xa1, 0x07, 0x9a, 0x64, 0xe0, 0x07, 0xa8, 0x86, 0xbb, 0x74, 0x73, 0x21, 0x49, 0x92, 0x43, 0x28, 0x57, 0x70,
+          0x6b, 0xf3, 0xd9, 0xe4, 0x5f, 0xc5, 0xec, 0xe4, 0x2f, 0x6d, 0x37, 0x73, 0x59, 0xa2, 0x60, 0x78, 0x22, 0x74, 0x64, 0x83, 0x95, 0x66, 0x67, 0xec,
+          0xfe, 0xe7, 0x1e, 0x7c, 0xbe, 0x2c, 0xce, 0xff, 0x92, 0xe8, 0xbe, 0x1e, 0x6b, 0x3f, 0x33, 0xbc, 0x45, 0x27, 0xd2, 0xe6, 0x74, 0x68, 0xf8, 0x03,
+          0xe7, 0x11, 0xcc, 0x8b, 0x06, 0xc1, 0x21, 0x50, 0xfb, 0x25, 0x81, 0x5a, 0xd2, 0xa4, 0xe7, 0x0c, 0x1e, 0xab, 0x5b, 0x2f, 0xa9, 0xdf, 0x77, 0x62,
+          0x30, 0x91, 0xe0, 0xab, 0x88, 0xf6, 0xa4, 0xa4, 0x26, 0x7e, 0xf9, 0x27, 0xc3, 0x58, 0xac, 0x48, 0x2b, 0xb7, 0x8a, 0xf2, 0x1a, 0xd6, 0xcd, 0xb7,
+          0x0e, 0x93, 0xc3, 0xc4, 0x42, 0x56, 0x61, 0x40, 0xab, 0x30, 0x93, 0xcd, 0x1b, 0x5f, 0x26, 0x69, 0x65, 0x10, 0xba, 0xad, 0xe2, 0x40, 0x15, 0x1f,
+          0xba, 0x86, 0x88, 0xfb, 0xc0, 0x8c, 0x46, 0x41, 0x79, 0x20, 0xa7, 0x53, 0x75, 0x54, 0x43, 0xb5, 0x37, 0x99, 0xd0, 0x2c, 0xd6, 0x24, 0xbb, 0xd9,
+          0x6a, 0x22, 0xa9, 0x40, 0x95, 0xf4, 0x8a, 0x64, 0xd4, 0x92, 0xc9, 0x87, 0x62, 0x19, 0x9d, 0x40, 0x0b, 0x41, 0xfc, 0x32, 0x13, 0x9d, 0x30, 0x9f,
+          0xd6, 0xc2, 0x19, 0x39, 0x04, 0x5e, 0x0f, 0x45, 0x40, 0xc5, 0xb4, 0xe5, 0xcd, 0x00, 0x2e, 0xec, 0x9c, 0x02, 0x5b, 0xcb, 0xd8, 0xd6, 0x13, 0x93,
+          0x45, 0xa9, 0xc1, 0xa3, 0x4c, 0xe1, 0x2c, 0x19, 0xb3, 0xe7, 0xbd, 0x27, 0x8b, 0xba, 0x64, 0x74, 0x90, 0xcf, 0xc8, 0xe0, 0xe5, 0x9d, 0xdc, 0x11,
+          0xb8, 0x19, 0x42, 0xdf, 0xfc, 0x38, 0xfb, 0x8a, 0xfd, 0x55, 0x2c, 0x57, 0x32, 0xde, 0x3d, 0xb7, 0x31, 0xbc, 0x87, 0x5c, 0x5b, 0xc4, 0x02, 0xef,
+          0x93, 0x8c, 0xe7, 0xf4, 0x8a, 0x4e, 0xd7, 0x39, 0x0e, 0xdb, 0x78, 0xd1, 0x66, 0xe3, 0x01, 0x3b, 0x44, 0xfa, 0x8f, 0xba, 0x2c, 0x03, 0xaf, 0xdf,
+          0xdd, 0x9c, 0xe7, 0xcb, 0x7b, 0xbb, 0x2b, 0x9e, 0xfd, 0xa9, 0xa3, 0x73, 0x3a, 0xe7, 0x45, 0x98, 0xb8, 0x5f, 0xfc, 0xc4, 0x5c, 0x04, 0x21, 0xcb,
+          0x89, 0xbc, 0xa0, 0x8d, 0x4d, 0x55, 0x60, 0xcc, 0xfd, 0x8a, 0x24, 0x23, 0x5b, 0x8c, 0x15, 0x9b, 0xa8, 0xd5, 0xe1, 0x70, 0xed, 0xa6, 0x42, 0x04,
+          0xc3, 0x4b, 0x4a, 0x23, 0x63, 0x97, 0xc8, 0x30, 0x97, 0x72, 0xc8, 0x0b, 0x0d, 0xc7, 0x0b, 0x6d, 0x0d, 0x6d, 0x35, 0x4d, 0xac, 0xf3, 0x49, 0xfd,
+          0x59, 0x0a, 0x37, 0xcb, 0x5b, 0x7b, 0x1e, 0x2d, 0x35, 0xd9, 0xa6, 0xec, 0xf2, 0x25, 0xed, 0x99, 0x35, 0xd5, 0xdb, 0x23, 0x5a, 0x3c, 0xd4, 0x92,
+          0xa9, 0x05, 0x17, 0x28, 0x8c, 0x48, 0x9b, 0x10, 0xb0, 0x33, 0xb5, 0x33, 0x2a, 0x62, 0xfa, 0x74, 0x81, 0x79, 0x4a, 0x9a, 0x41, 0x6b, 0xea, 0x4f,
+          0x41, 0x57, 0x55, 0x4c, 0x46, 0x6a, 0x28, 0x1f, 0x28, 0x1d, 0xed, 0xb0, 0xda, 0xb5, 0x2f, 0x4b, 0xd7, 0xb1, 0xe5, 0x23, 0x17, 0xc9, 0x3b, 0x08,
+          0x71, 0x78, 0x23, 0x5a, 0x8d, 0x81, 0x38, 0x68, 0x93, 0xcd, 0x4c, 0xad, 0x94, 0xc6, 0x44, 0xb4, 0x95, 0x87, 0x82, 0x12, 0x0f, 0x76, 0x70, 0x16,
+          0x4c, 0x39, 0xde, 0x46, 0xcf, 0xc1, 0x6d, 0x29, 0xeb, 0xb1, 0x9c, 0xc3, 0x21, 0x2d, 0xd0, 0x85, 0xef, 0x3f, 0xe3, 0x19, 0xba, 0x53, 0x92, 0xf0,
+          0x71, 0xfa, 0x8d, 0x66, 0x08, 0x0e, 0x35, 0x33, 0xe5, 0x41, 0xe7, 0x37, 0x16, 0x07, 0xa5, 0xfd, 0x72, 0xe6, 0xf6, 0xb3, 0x4c, 0xe0, 0x8a, 0x8b,
+          0xb3, 0x60, 0x3a, 0xc7, 0x96, 0xe5, 0xd8, 0xfe, 0x30, 0xe4, 0xc0, 0xbc, 0x17, 0x2d, 0x70, 0x98, 0x10, 0xf7, 0xd9, 0x64, 0x7a, 0xf3, 0xa1, 0x60,
+          0x38, 0x17, 0xae, 0x48, 0x3b, 0x11, 0xb3, 0x25, 0x3e, 0xb8, 0x7e, 0xc5, 0x49, 0x00, 0xa2, 0x86, 0x25, 0x41, 0x78, 0x88, 0x80, 0x36, 0xb8, 0xed,
+          0x00, 0x97, 0xe1, 0x49, 0x79, 0xaf, 0xce, 0x0b, 0x7a, 0x09, 0x9b, 0x5e, 0x9d, 0x16, 0x78, 0x9b, 0xca, 0xc9, 0xe0, 0xd4, 0xf7, 0xcb, 0x61, 0x4d,
+          0xcc, 0x3f, 0x37, 0x1d, 0xdd, 0x49, 0xee, 0x00, 0x64, 0xac, 0x2d, 0x00, 0x40, 0x33, 0xca, 0x68, 0x1b, 0x3f, 0x3f, 0x66, 0xb4, 0x5f, 0xe8, 0x15,
+          0x59, 0x9a, 0xa9, 0x2e, 0x8d, 0x83, 0xe3, 0x59, 0x86, 0xe6, 0x7e, 0xd0, 0xd9, 0x04, 0x3c, 0xed, 0x55, 0xcb, 0xbc, 0x5d, 0xdf, 0xf5, 0xd4, 0x2c,
+          0x40, 0xd3, 0x21, 0xe7, 0xf4, 0xc5, 0x4a, 0x07, 0x71, 0x2d, 0x78, 0x64, 0x45, 0x7e, 0x9e, 0xe1, 0x86, 0x93, 0x6e, 0xa8, 0xd0, 0x8d, 0xb6, 0xd4,
+          0x4c, 0x84, 0x4d, 0xb2, 0x5e, 0xb6, 0x00, 0xd1, 0x30, 0xc7, 0xc5, 0x8d, 0x2e, 0x48, 0xfb, 0xed, 0xfa, 0x31, 0x01, 0xd9, 0xc6, 0xa7, 0x5e, 0xa5,
+          0x7e, 0xfd, 0xc5, 0xba, 0x16, 0x0c, 0x41, 0xde, 0x40, 0x5a, 0xb1, 0x5c, 0xa1, 0x25, 0xfc, 0x30, 0xa7, 0xd4, 0xf7, 0xdb, 0xb8, 0xdf, 0x71, 0x8b,
+          0xc3, 0x80, 0xf4, 0xcf, 0xe1, 0xd7, 0x0c, 0xcd, 0xb1, 0x4b, 0x7d, 0x34, 0xeb, 0x17, 0xa1, 0x3e, 0x4f, 0x5a, 0xbf, 0xb2, 0xe7, 0x12, 0x1c, 0x84,
+          0x6f, 0xd7, 0xec, 0xda, 0x4a, 0x0a, 0xab, 0x0e, 0xc0, 0xb2, 0x4b, 0x01, 0x0a, 0xf7, 0x3c, 0x70, 0x26, 0xb6, 0xcb, 0xc4, 0xfa, 0x65, 0xdd, 0x5a,
+          0xea, 0xa1, 0xdc, 0x03, 0xbb, 0x50, 0xcd, 0xa7, 0xa3, 0x0c, 0x8a, 0xb9, 0x50, 0x2a, 0xdf, 0xbc, 0x90, 0x22, 0x2c, 0xd6, 0x3c, 0x08, 0x41, 0x08,
+          0xa2, 0x8c, 0x6f, 0xe1, 0x12, 0x1d, 0x20, 0xd7, 0x8e, 0x3b, 0x75, 0x5c, 0x71, 0xee, 0xbf, 0xc6, 0x01, 0x9a, 0x06, 0x6b, 0x98, 0x60, 0xbd, 0x8b,
+          0xd6, 0x71, 0x84, 0xd9, 0xef, 0x2b, 0xdd, 0xee, 0x15, 0x52, 0xd1, 0x8d, 0xd3, 0xa5, 0xa7, 0x75, 0x5c, 0x85, 0x8c, 0x30, 0x76, 0x7d, 0x8e, 0xfb,
+          0x98, 0x05, 0xb7, 0xb2, 0x84, 0xe9, 0x28, 0xcd, 0xea, 0xc1, 0x09, 0x81, 0xeb, 0x19, 0xfe, 0x71, 0x31, 0x89, 0x71, 0x1c, 0x3c, 0x01, 0x0d, 0xb3,
+          0xca, 0xa5, 0x47, 0x2d, 0x00, 0xaa, 0x2e, 0x37, 0x3e, 0x36, 0x19, 0x41, 0x4c, 0x85, 0xdd, 0x59, 0x4a, 0xa9, 0x92, 0xf3, 0x67, 0x01, 0xa6, 0x3e,
+          0x42, 0xd1, 0x69, 0xb2, 0x2a, 0xbe, 0x7a, 0xb7, 0x9a, 0xdc, 0x43, 0x1f, 0x39, 0xe9, 0xc2, 0xf6, 0xc2, 0xf9, 0x2f, 0xb1, 0xd9, 0x04, 0xb1, 0xdf,
+          0x44, 0xa7, 0x70, 0x1f, 0x2c, 0x04, 0x9d, 0x7e, 0xb0, 0xaf, 0xac, 0x06, 0xbb, 0x85, 0x54, 0x55, 0x5c, 0x0a, 0x3b, 0x75, 0xb4, 0xc7, 0x62, 0xda,
+          0x76, 0xbe, 0x72, 0x4e, 0xa2, 0xbb, 0xa2, 0x14, 0x1e, 0x9a, 0x85, 0x80, 0xbd, 0x57, 0x7d, 0x41, 0x02, 0x8f, 0x4d, 0x03, 0x08, 0xda, 0xfe, 0x06,
+          0xec, 0x39, 0x24, 0xb2, 0x3d, 0x70, 0x03, 0xf5, 0xff, 0xa9, 0xfe, 0x26, 0x13, 0xc7, 0xe4, 0xad, 0xb2, 0xde, 0xf8, 0xb9, 0xf1, 0x3e, 0x36, 0xf3,
+          0x09, 0x14, 0x7a, 0xda, 0x86, 0x5f, 0x4f, 0xcd, 0xa1, 0xdd, 0x35, 0x7e, 0x04, 0x32, 0x3b, 0x24, 0xce, 0xef, 0x75, 0x9e, 0x9e, 0x74, 0x99, 0xda,
+          0xad, 0xb6, 0x6f, 0xf6, 0x40, 0xb0, 0x6b, 0xfa, 0x5e, 0x90, 0x05, 0x58, 0x32, 0x66, 0xdc, 0x4b, 0x79, 0xcc, 0x07, 0x94, 0xbe, 0x7e, 0xd3, 0xbe,
+          0x6b, 0xda, 0xef, 0xd7, 0xe7, 0x67, 0x12, 0x06, 0x99, 0x45, 0xf0, 0x08, 0x1a, 0xaf, 0xe4, 0x17, 0x18, 0x9f, 0xe4, 0x7c, 0x4f, 0x0f, 0x72, 0xaa,
+          0x8f, 0x9c, 0xa0, 0x37, 0xf1, 0x5a, 0xd5, 0x64, 0x71, 0xa3, 0x7a, 0xcd, 0xed, 0x12, 0x23, 0xa0, 0xa6, 0x25, 0xc4, 0xfc, 0x32, 0x8f, 0x48, 0x7f,
+          0x51, 0x28, 0xa6, 0xd3, 0xcd, 0xb8, 0x90, 0x0a, 0x3e, 0xc4, 0xa6, 0x24, 0x29, 0x4b, 0x45, 0xd6, 0xf5, 0x76, 0x6a, 0x5a, 0x6e, 0x87, 0x6c, 0x83,
+          0x1e, 0xc9, 0x37, 0xfb, 0xdd, 0x15, 0xce, 0xf9, 0xcb, 0xd0, 0x09, 0x03, 0xc7, 0x29, 0x5e, 0x95, 0x25, 0x16, 0x41, 0x1a, 0xc1, 0xc3, 0x27, 0xfb,
+          0x36, 0x8a, 0x76, 0x87, 0x37, 0x6b, 0x63, 0x1c, 0xd2, 0xb7, 0xc3, 0x93, 0xc1, 0xed, 0xfc, 0x22, 0x02, 0xc0, 0xf3, 0x4d, 0x92, 0xf4, 0xbb, 0x72,
+          0x54, 0x34, 0x34, 0x2b, 0x96, 0xba, 0xf0, 0x06, 0x20, 0xe1, 0xaf, 0x8e, 0xe8, 0x27, 0xaf, 0xd5, 0x1d, 0xcf, 0xfa, 0xcc, 0x6f, 0x0a, 0xf4, 0xc2,
+          0x6f, 0xf7, 0x3f, 0xf2, 0xee, 0x5b, 0x7f, 0xb8, 0x26, 0x0f, 0xbe, 0xfd, 0x6e, 0x5b, 0xaa, 0x01, 0x79, 0x1f, 0x69, 0x3d, 0x45, 0x9e, 0xe0, 0xcf,
+          0xdd, 0xc9, 0xed, 0xd5, 0xba, 0x6e, 0x15, 0xe4, 0xbb, 0x0f, 0x30, 0x05, 0x04, 0xb5, 0x22, 0x50, 0x65, 0xac, 0x6a, 0xdb, 0x3e, 0x35, 0x3f, 0x3e,
+          0x30, 0x6b, 0xc6, 0x4a, 0x53, 0xc4, 0x9a, 0x9a, 0x3c, 0x28, 0x89, 0x89, 0x44, 0xa9, 0xc1, 0x9b, 0x02, 0xc4, 0x08, 0x42, 0xbc, 0x22, 0xa3, 0x1a,
+          0x94, 0xde, 0xfe, 0xed, 0x68, 0x5c, 0x4c, 0xa2, 0x54, 0xd5, 0xe9, 0x8e, 0x84, 0xaf, 0x85, 0x33, 0x59, 0x36, 0xae, 0x5d, 0x53, 0x3a, 0xf8, 0xb4,
+          0x10, 0xef, 0x96, 0x2e, 0xfc, 0xdf, 0x74, 0x79, 0xed, 0x8f, 0x3f, 0x25, 0x7f, 0xfb, 0xa9, 0xbf, 0xfe, 0xdd, 0xab, 0x59, 0x95, 0x1b, 0x8f, 0x37,
+          0x74, 0xab, 0x5a, 0xdc, 0xc2, 0xcc, 0xfe, 0x87, 0xbb, 0xda, 0x16, 0x37, 0x07, 0xe2, 0xbb, 0x10, 0x96, 0xaf, 0x71, 0xb3, 0x97, 0x37, 0x02, 0x1d,
+          0x6d, 0x0f, 0xc5, 0xbe, 0x08, 0xbd, 0x33, 0x3a, 0x2e, 0xe8, 0xcd, 0xf4, 0xc0, 0x2b, 0x9f, 0xfe, 0x35, 0x40, 0x3b, 0xf6, 0xd5, 0x1e, 0xf3, 0xe9,
+          0xe7, 0xe4, 0x29, 0x24, 0x19, 0x85, 0x35, 0x69, 0x2c, 0x70, 0x70, 0xa6, 0x07, 0x29, 0xb9, 0x38, 0x44, 0x93, 0xb2, 0xa7, 0xb0, 0x1d, 0xfd, 0xbf,
+          0x46, 0xa6, 0x85, 0xb0, 0x80, 0x7b, 0xd0, 0x4b, 0x0a, 0xae, 0xe1, 0xd4, 0x39, 0xb2, 0x18, 0xe3, 0x64, 0x30, 0xa6, 0xe1, 0x1c, 0xf8, 0x62, 0x47,
+          0x01, 0x65, 0x12, 0xf3, 0xe6, 0x92, 0x75, 0xdb, 0x30, 0x16, 0xd1, 0x26, 0xb3, 0x9d, 0x57, 0xb4, 0x7e, 0x0f, 0x17, 0x31, 0xb1, 0x39, 0x24, 0x9e,
+          0x7f, 0x6b, 0x91, 0xee, 0x51, 0x47, 0x22, 0x48, 0xa0, 0xb3, 0x6c, 0x3d, 0x51, 0xa8, 0xa6, 0x7d, 0x36, 0x9e, 0x03, 0x68, 0xb5, 0xc2, 0x71, 0x76,
+          0x6f, 0x97, 0x91, 0x2c, 0xb6, 0xdb, 0x01, 0xe0, 0xf1, 0xce, 0x77, 0xf5, 0x31, 0x41, 0x24, 0x63, 0xdb, 0xc3, 0x43, 0xdb, 0xf2, 0x36, 0x25, 0xc1,
+          0xab, 0x64, 0x08, 0x60, 0xc7, 0x5c, 0xb3, 0x00, 0x30, 0x43, 0x62, 0xe2, 0x9e, 0x4e, 0x6d, 0x35, 0xa3, 0x0e, 0x41, 0xc1, 0x20, 0x43, 0x2a, 0x9c,
+          0x7f, 0xcf, 0xc1, 0xfd, 0x01, 0xa7, 0xde, 0xe3, 0xcd, 0x47, 0xc1, 0x26, 0xd6, 0x5f, 0x5f, 0x86, 0xa7, 0x4d, 0xd8, 0x6c, 0x07, 0x9f, 0xc6, 0x8a,
+          0xad, 0x09, 0x89, 0x14, 0x01, 0xb7, 0x16, 0xda, 0x7e, 0x35, 0x47, 0x9f, 0xcc, 0x59, 0xc7, 0x4f, 0x89, 0x1f, 0xbc, 0xac, 0x73, 0x56, 0xd4, 0xea,
+          0xb4, 0xcb, 0x4c, 0xff, 0xf4, 0x64, 0x5f, 0xa5, 0x62, 0x2c, 0x8a, 0xeb, 0xa3, 0x19, 0x65, 0xe5, 0xc2, 0xa6, 0x75, 0x1e, 0x11, 0x49, 0xfe, 0x60,
+          0x87, 0x30, 0x4f, 0x57, 0x80, 0x5a, 0x5f, 0x4b, 0x73, 0x74, 0x22, 0xb4, 0x88, 0x2c, 0x49, 0x9f, 0xb5, 0x42, 0x27, 0x40, 0x9f, 0x95, 0x87, 0xe2,
+          0xe7, 0x82, 0x04, 0xb1, 0x1e, 0x98, 0x08, 0xaa, 0xe4, 0xc9, 0xf0, 0x99, 0xd5, 0x3e, 0x80, 0xb2, 0x03, 0x15, 0x42, 0xd7, 0x05, 0xfc, 0xf4, 0x16,
+          0xae, 0x40, 0x80, 0x35, 0x71, 0xc8, 0x4e, 0x0a, 0x83, 0x3e, 0x4f, 0x41, 0x3a, 0x12, 0x8f, 0x52, 0xcb, 0x78, 0xf5, 0x0e, 0x74, 0xca, 0xdf, 0x5b,
+          0xcb, 0x92, 0x7e, 0xf4, 0xf4, 0x46, 0x96, 0xb1, 0xa4, 0x12, 0x25, 0x58, 0xc7, 0x2d, 0xab, 0xea, 0xb1, 0x07, 0x93, 0x39, 0x06, 0x5f, 0x62, 0xe7,
+          0xfa, 0x66, 0x44, 0xe6, 0x00, 0xf0, 0x6e, 0x77, 0x65, 0x5f, 0x87, 0x3f, 0xc0, 0xea, 0x5b, 0x1c, 0xa1, 0x7a, 0xb7, 0x9f, 0x04, 0xb0, 0x24, 0x53,
+          0x2a, 0x52, 0x9a, 0x01, 0x0d, 0x22, 0x6e, 0xaa, 0xb8, 0x5d, 0x11, 0xaa, 0x35, 0x8f, 0x92, 0x33, 0xd0, 0x51, 0x01, 0x78, 0x7a, 0xc4, 0x37, 0xf7,
+          0x6e, 0xaa, 0xe3, 0x3f, 0x8c, 0x54, 0xdd, 0x33, 0xe8, 0x3e, 0xc4, 0xd1, 0xde, 0x82, 0x55, 0x35, 0x09, 0x44, 0xbb, 0x3d, 0x61, 0x1d, 0xcc, 0x39,
+          0x43, 0x3c, 0xbf, 0xbb, 0x20, 0xcb, 0x54, 0xbc, 0x44, 0x95, 0x2c, 0xc3, 0x66, 0xff, 0xce, 0x5c, 0xf2, 0xa9, 0x2d, 0x06, 0xd4, 0x4d, 0x3c, 0xab,
+          0x4c, 0xe1, 0xfd, 0x49, 0xe9, 0xb0, 0x62, 0xe1, 0x9a, 0xde, 0x10};
     };
+
+    static constexpr std::array<std::string_view, 2> files{"react@18/umd/react.production.min.js", "react-dom@18/umd/react-dom.production.min.js"};
+    static constexpr std::array<StaticHeaders, 2> headers{StaticHeaders::of<React>(files[0]), StaticHeaders::of<ReactDom>(files[1])};
+
+    static File fileAt(size_t index) {
+        switch (index) {
+        case 0: return File{React{}, headersAt(0)};
+        default: return File{ReactDom{}, headersAt(1)};
+        }
+    }
+
+    static constexpr std::string_view headersAt(size_t index) { return headers[index].view(); }
+
+    static std::optional<File> open(std::filesystem::path file) {
+        auto found = std::ranges::find(files, file.relative_path().generic_string());
+        if (found == files.end()) return {};
+        return fileAt(static_cast<size_t>(found - files.begin()));
+    }
 };
 
 } // namespace webfront::fs
@@ -0,0 +1,361 @@
+/// @date 18/10/2026 14:27:05
+/// @author Ambroise Leclerc
+/// @brief Encoder of the DEFLATE (RFC1951) and gzip (RFC1952) formats, compressing the files sent with the gzip content coding
+#pragma once
+#include "Inflate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace webfront::utils {
+
+namespace details {
+class BitWriter {
+public:
+    explicit BitWriter(std::string& output) : bytes(output) {}
+
+    /// Appends the count low bits of value, LSB first
+    void put(uint32_t value, unsigned count) {
+        buffer |= static_cast<uint64_t>(value) << available;
+        available += count;
+        for (; available >= 8; available -= 8, buffer >>= 8) bytes.push_back(static_cast<char>(buffer & 0xFF));
+    }
+
+    /// Pads the current byte with zero bits
+    void align() {
+        if (available > 0) put(0, 8 - available);
+    }
+
+    /// Appends whole bytes : the writer must be aligned
+    void append(std::span<const std::byte> data) { bytes.append(reinterpret_cast<const char*>(data.data()), data.size()); }
+
+private:
+    std::string& bytes;
+    uint64_t buffer{0};
+    unsigned available{0};
+};
+
+/// Canonical Huffman code of a block (RFC1951 3.2.2), built from the frequencies of its symbols
+class PrefixCode {
+public:
+    PrefixCode() = default;
+
+    /// Lengths of a Huffman code of frequencies up to maxLength bits : the frequencies are flattened until the tree is shallow enough.
+    /// At least 2 symbols are coded, so that the code is complete.
+    PrefixCode(std::vector<uint32_t> frequencies, unsigned maxLength) : lengths(frequencies.size()) {
+        for (size_t symbol = 0; std::ranges::count_if(frequencies, [](auto frequency) { return frequency > 0; }) < 2; ++symbol)
+            frequencies[symbol] = std::max(frequencies[symbol], 1U);
+        while (!huffman(frequencies, maxLength))
+            for (auto& frequency : frequencies) frequency = (frequency + 1) / 2;
+        assignCodes();
+    }
+
+    explicit PrefixCode(std::span<const uint8_t> codeLengths) : lengths(codeLengths.begin(), codeLengths.end()) { assignCodes(); }
+
+    void put(BitWriter& writer, size_t symbol) const { writer.put(codes[symbol], lengths[symbol]); }
+    [[nodiscard]] unsigned length(size_t symbol) const { return lengths[symbol]; }
+
+    /// @return the count of symbols up to the last coded one, at least minimum
+    [[nodiscard]] size_t used(size_t minimum) const {
+        auto last = std::find_if(lengths.rbegin(), lengths.rend(), [](auto length) { return length != 0; });
+        return std::max(minimum, static_cast<size_t>(lengths.rend() - last));
+    }
+
+private:
+    std::vector<uint8_t> lengths;
+    std::vector<uint16_t> codes;
+
+    bool huffman(const std::vector<uint32_t>& frequencies, unsigned maxLength) {
+        struct Node {
+            uint64_t weight;
+            size_t left, right; // Children, or right is the symbol of a leaf (left == leaf)
+        };
+        constexpr auto leaf = static_cast<size_t>(-1);
+        std::vector<Node> nodes;
+        using Weighted = std::pair<uint64_t, size_t>;
+        std::priority_queue<Weighted, std::vector<Weighted>, std::greater<>> queue;
+        for (size_t symbol = 0; symbol < frequencies.size(); ++symbol)
+            if (frequencies[symbol] > 0) {
+                nodes.push_back({frequencies[symbol], leaf, symbol});
+                queue.emplace(frequencies[symbol], nodes.size() - 1);
+            }
+        while (queue.size() > 1) {
+            auto first = queue.top();
+            queue.pop();
+            auto second = queue.top();
+            queue.pop();
+            nodes.push_back({first.first + second.first, first.second, second.second});
+            queue.emplace(nodes.back().weight, nodes.size() - 1);
+        }
+        std::vector<uint8_t> depths(nodes.size()); // Children are before their parent : depths are set from the root down
+        std::ranges::fill(lengths, 0);
+        for (size_t node = nodes.size(); node-- > 0;) {
+            if (nodes[node].left != leaf) {
+                depths[nodes[node].left] = depths[nodes[node].right] = static_cast<uint8_t>(depths[node] + 1);
+            } else if ((lengths[nodes[node].right] = depths[node]) > maxLength)
+                return false;
+        }
+        return true;
+    }
+
+    void assignCodes() {
+        std::array<uint16_t, 16> counts{}, next{};
+        for (auto length : lengths) ++counts[length];
+        counts[0] = 0;
+        for (unsigned bits = 1; bits < next.size(); ++bits) next[bits] = static_cast<uint16_t>((next[bits - 1] + counts[bits - 1]) << 1);
+        codes.assign(lengths.size(), 0);
+        for (size_t symbol = 0; symbol < lengths.size(); ++symbol) {
+            if (lengths[symbol] == 0) continue;
+            uint16_t code = next[lengths[symbol]]++, reversed = 0; // Huffman codes are packed MSB first
+            for (unsigned bit = 0; bit < lengths[symbol]; ++bit) reversed = static_cast<uint16_t>(reversed << 1 | ((code >> bit) & 1));
+            codes[symbol] = reversed;
+        }
+    }
+};
+
+/// LZ77 matching on hash chains with lazy evaluation, each block being written with the smallest of the stored, fixed Huffman and
+/// dynamic Huffman encodings.
+class Deflater {
+public:
+    explicit Deflater(std::span<const std::byte> data) : input(data) {}
+
+    void run(BitWriter& writer) {
+        size_t position = 0, blockStart = 0;
+        Match lookahead{0, 0};
+        bool deferred = false; // lookahead is the match at position, found while evaluating the previous one
+        while (position < input.size()) {
+            auto match = deferred ? lookahead : longestMatch(position);
+            insert(position);
+            deferred = false;
+            if (match.length >= minMatch && match.length < lazyLength && position + 1 < input.size()) {
+                lookahead = longestMatch(position + 1);
+                deferred = lookahead.length > match.length;
+                if (deferred) match.length = 0; // A literal, then the longer match
+            }
+            if (match.length >= minMatch) {
+                tokens.push_back({static_cast<uint16_t>(match.length), static_cast<uint16_t>(match.distance)});
+                for (size_t next = position + 1; next < position + match.length; ++next) insert(next);
+                position += match.length;
+            } else
+                tokens.push_back({static_cast<uint16_t>(input[position++]), 0});
+            if (tokens.size() >= blockTokens && !deferred) {
+                writeBlock(writer, input.subspan(blockStart, position - blockStart), false);
+                blockStart = position;
+            }
+        }
+        writeBlock(writer, input.subspan(blockStart), true);
+        writer.align();
+    }
+
+private:
+    static constexpr size_t windowSize = 32768, minMatch = 3, maxMatch = 258, hashBits = 15;
+    static constexpr size_t maxChain = 128, niceLength = 128, lazyLength = 32, farDistance = 4096, blockTokens = 16384;
+    static constexpr size_t endOfBlock = 256;
+
+    struct Match {
+        size_t length, distance;
+    };
+    struct Token {
+        uint16_t value;    ///< Literal byte, or length of a match
+        uint16_t distance; ///< 0 for a literal
+    };
+
+    std::span<const std::byte> input;
+    std::vector<int32_t> heads = std::vector<int32_t>(size_t{1} << hashBits, -1), previous = std::vector<int32_t>(windowSize, -1);
+    std::vector<Token> tokens;
+
+    [[nodiscard]] size_t hashAt(size_t position) const {
+        auto bytes = static_cast<uint32_t>(input[position]) << 16 | static_cast<uint32_t>(input[position + 1]) << 8 |
+                     static_cast<uint32_t>(input[position + 2]);
+        return (bytes * 2654435761U) >> (32 - hashBits);
+    }
+
+    void insert(size_t position) {
+        if (position + minMatch > input.size()) return;
+        auto& head = heads[hashAt(position)];
+        previous[position % windowSize] = head;
+        head = static_cast<int32_t>(position);
+    }
+
+    [[nodiscard]] Match longestMatch(size_t position) const {
+        Match best{0, 0};
+        auto limit = std::min(maxMatch, input.size() - position);
+        if (limit < minMatch) return best;
+        auto candidate = heads[hashAt(position)];
+        for (size_t chain = 0; candidate >= 0 && chain < maxChain; ++chain, candidate = previous[static_cast<size_t>(candidate) % windowSize]) {
+            auto from = static_cast<size_t>(candidate);
+            if (position - from > windowSize) break;
+            if (input[from + best.length] != input[position + best.length]) continue;
+            size_t length = 0;
+            while (length < limit && input[from + length] == input[position + length]) ++length;
+            if (length > best.length) {
+                best = {length, position - from};
+                if (length >= std::min(niceLength, limit)) break;
+            }
+        }
+        if (best.length == minMatch && best.distance > farDistance) return {0, 0}; // Costs more than its 3 literals
+        return best;
+    }
+
+    static size_t codeIndex(std::span<const uint16_t> bases, size_t value) {
+        return static_cast<size_t>(std::upper_bound(bases.begin(), bases.end(), value) - bases.begin()) - 1;
+    }
+
+    void writeBlock(BitWriter& writer, std::span<const std::byte> raw, bool last) {
+        std::vector<uint32_t> literals(286), distances(30);
+        size_t extraBits = 0;
+        literals[endOfBlock] = 1;
+        for (auto token : tokens) {
+            if (token.distance == 0) {
+                ++literals[token.value];
+                continue;
+            }
+            auto length = codeIndex(lengthBase, token.value), distance = codeIndex(distanceBase, token.distance);
+            ++literals[257 + length];
+            ++distances[distance];
+            extraBits += static_cast<size_t>(lengthExtra[length] + distanceExtra[distance]);
+        }
+
+        PrefixCode literalsCode(literals, 15), distancesCode(distances, 15);
+        auto header = dynamicHeader(literalsCode, distancesCode);
+        const auto& [fixedLiterals, fixedDistances] = fixedCodes();
+        auto dynamicSize = 3 + header.size + extraBits + cost(literals, literalsCode) + cost(distances, distancesCode);
+        auto fixedSize = 3 + extraBits + cost(literals, fixedLiterals) + cost(distances, fixedDistances);
+        auto storedSize = (raw.size() + 5 * (raw.size() / 65535 + 1)) * 8 + 7;
+
+        if (storedSize <= std::min(dynamicSize, fixedSize)) {
+            size_t offset = 0;
+            do {
+                auto length = std::min<size_t>(65535, raw.size() - offset);
+                writer.put(last && offset + length == raw.size(), 1);
+                writer.put(0, 2);
+                writer.align();
+                writer.put(static_cast<uint32_t>(length), 16);
+                writer.put(static_cast<uint32_t>(~length & 0xFFFF), 16);
+                writer.append(raw.subspan(offset, length));
+                offset += length;
+            } while (offset < raw.size());
+        } else if (fixedSize <= dynamicSize) {
+            writer.put(last, 1);
+            writer.put(1, 2);
+            writeTokens(writer, fixedLiterals, fixedDistances);
+        } else {
+            writer.put(last, 1);
+            writer.put(2, 2);
+            writeHeader(writer, header);
+            writeTokens(writer, literalsCode, distancesCode);
+        }
+        tokens.clear();
+    }
+
+    void writeTokens(BitWriter& writer, const PrefixCode& literals, const PrefixCode& distances) const {
+        for (auto token : tokens) {
+            if (token.distance == 0) {
+                literals.put(writer, token.value);
+                continue;
+            }
+            auto length = codeIndex(lengthBase, token.value), distance = codeIndex(distanceBase, token.distance);
+            literals.put(writer, 257 + length);
+            writer.put(static_cast<uint32_t>(token.value - lengthBase[length]), lengthExtra[length]);
+            distances.put(writer, distance);
+            writer.put(static_cast<uint32_t>(token.distance - distanceBase[distance]), distanceExtra[distance]);
+        }
+        literals.put(writer, endOfBlock);
+    }
+
+    static size_t cost(const std::vector<uint32_t>& frequencies, const PrefixCode& code) {
+        size_t bits = 0;
+        for (size_t symbol = 0; symbol < frequencies.size(); ++symbol) bits += frequencies[symbol] * code.length(symbol);
+        return bits;
+    }
+
+    static const std::pair<PrefixCode, PrefixCode>& fixedCodes() {
+        static const auto codes = [] {
+            std::array<uint8_t, 288> literals{};
+            for (size_t symbol = 0; symbol < literals.size(); ++symbol) literals[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+            std::array<uint8_t, 30> distances{};
+            distances.fill(5);
+            return std::pair{PrefixCode{literals}, PrefixCode{distances}};
+        }();
+        return codes;
+    }
+
+    /// Code lengths of a dynamic block, run-length encoded with the code length alphabet (RFC1951 3.2.7)
+    struct DynamicHeader {
+        static constexpr std::array<uint8_t, 19> order{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+        static constexpr std::array<uint8_t, 3> repeatBits{2, 3, 7}; // Extra bits of the symbols 16, 17 and 18
+        size_t literalsCount, distancesCount, codeLengthsCount;
+        std::vector<std::pair<uint8_t, uint8_t>> symbols; // Code length symbol and the value of its extra bits
+        PrefixCode code;
+        size_t size;
+    };
+
+    static DynamicHeader dynamicHeader(const PrefixCode& literals, const PrefixCode& distances) {
+        DynamicHeader header{literals.used(257), distances.used(1), 0, {}, {}, 0};
+        std::vector<uint8_t> lengths;
+        for (size_t symbol = 0; symbol < header.literalsCount; ++symbol) lengths.push_back(static_cast<uint8_t>(literals.length(symbol)));
+        for (size_t symbol = 0; symbol < header.distancesCount; ++symbol) lengths.push_back(static_cast<uint8_t>(distances.length(symbol)));
+        for (size_t index = 0; index < lengths.size();) {
+            auto length = lengths[index];
+            size_t run = 1;
+            while (index + run < lengths.size() && lengths[index + run] == length) ++run;
+            index += run;
+            if (length == 0) {
+                for (; run >= 11; run -= std::min<size_t>(run, 138)) header.symbols.emplace_back(18, static_cast<uint8_t>(std::min<size_t>(run, 138) - 11));
+                if (run >= 3) header.symbols.emplace_back(17, static_cast<uint8_t>(std::exchange(run, 0) - 3));
+            } else {
+                header.symbols.emplace_back(length, 0);
+                for (--run; run >= 3; run -= std::min<size_t>(run, 6)) header.symbols.emplace_back(16, static_cast<uint8_t>(std::min<size_t>(run, 6) - 3));
+            }
+            for (; run > 0; --run) header.symbols.emplace_back(length, 0);
+        }
+
+        std::vector<uint32_t> frequencies(19);
+        for (auto [symbol, extra] : header.symbols) ++frequencies[symbol];
+        header.code = PrefixCode(frequencies, 7);
+        header.codeLengthsCount = DynamicHeader::order.size();
+        while (header.codeLengthsCount > 4 && header.code.length(DynamicHeader::order[header.codeLengthsCount - 1]) == 0) --header.codeLengthsCount;
+        header.size = 14 + 3 * header.codeLengthsCount;
+        for (auto [symbol, extra] : header.symbols) header.size += header.code.length(symbol) + (symbol >= 16 ? DynamicHeader::repeatBits[symbol - 16] : 0);
+        return header;
+    }
+
+    static void writeHeader(BitWriter& writer, const DynamicHeader& header) {
+        writer.put(static_cast<uint32_t>(header.literalsCount - 257), 5);
+        writer.put(static_cast<uint32_t>(header.distancesCount - 1), 5);
+        writer.put(static_cast<uint32_t>(header.codeLengthsCount - 4), 4);
+        for (size_t index = 0; index < header.codeLengthsCount; ++index) writer.put(header.code.length(DynamicHeader::order[index]), 3);
+        for (auto [symbol, extra] : header.symbols) {
+            header.code.put(writer, symbol);
+            if (symbol >= 16) writer.put(extra, DynamicHeader::repeatBits[symbol - 16]);
+        }
+    }
+};
+} // namespace details
+
+/// @return data compressed as a raw DEFLATE stream
+[[nodiscard]] inline std::string deflate(std::span<const std::byte> data) {
+    std::string output;
+    details::BitWriter writer(output);
+    details::Deflater(data).run(writer);
+    return output;
+}
+
+/// @return data compressed as a gzip member (gzip content coding), without file name nor modification time
+[[nodiscard]] inline std::string gzip(std::span<const std::byte> data) {
+    std::string output{"\x1F\x8B\x08\x00\x00\x00\x00\x00\x00\xFF", 10}; // Deflate method, no flags, unknown operating system
+    details::BitWriter writer(output);
+    details::Deflater(data).run(writer);
+    for (auto trailer : {details::crc32(data), static_cast<uint32_t>(data.size())}) writer.put(trailer, 32);
+    return output;
+}
+
+} // namespace webfront::utils
@@ -0,0 +1,287 @@
+/// @date 18/10/2026 09:12:40
+/// @author Ambroise Leclerc
+/// @brief Decoder of the DEFLATE (RFC1951), zlib (RFC1950) and gzip (RFC1952) formats, for the gzip and deflate content codings
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace webfront::utils {
+
+namespace details {
+/// Base values and extra bits of the length (257 to 285) and distance codes (RFC1951 3.2.5)
+inline constexpr std::array<uint16_t, 29> lengthBase{3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                                     31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+inline constexpr std::array<uint8_t, 29> lengthExtra{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+inline constexpr std::array<uint16_t, 30> distanceBase{1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+                                                       193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+inline constexpr std::array<uint8_t, 30> distanceExtra{0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+class BitReader {
+public:
+    explicit BitReader(std::span<const std::byte> input) : bytes(input) {}
+
+    /// @return the next count bits, LSB first, nullopt past the end of the input
+    std::optional<uint32_t> bits(unsigned count) {
+        while (available < count) {
+            if (next == bytes.size()) return {};
+            buffer |= static_cast<uint32_t>(bytes[next++]) << available;
+            available += 8;
+        }
+        auto value = buffer & ((1U << count) - 1);
+        buffer >>= count;
+        available -= count;
+        return value;
+    }
+
+    /// Drops the bits left in the current byte
+    void align() { buffer = available = 0; }
+
+    /// @return the bytes following the bits read so far
+    [[nodiscard]] std::span<const std::byte> remaining() const { return bytes.subspan(next); }
+    void skip(size_t count) { next += count; }
+
+private:
+    std::span<const std::byte> bytes;
+    size_t next{0};
+    uint32_t buffer{0};
+    unsigned available{0};
+};
+
+/// Canonical Huffman code, decoded bit by bit (RFC1951 3.2.2)
+class Huffman {
+public:
+    static constexpr unsigned maxBits = 15;
+
+    /// @return false if the code lengths are over-subscribed
+    bool build(std::span<const uint8_t> lengths) {
+        counts.fill(0);
+        for (auto length : lengths) ++counts[length];
+        int left = 1;
+        for (unsigned length = 1; length <= maxBits; ++length) {
+            left = (left << 1) - counts[length];
+            if (left < 0) return false;
+        }
+        std::array<uint16_t, maxBits + 2> offsets{};
+        for (unsigned length = 1; length <= maxBits; ++length) offsets[length + 1] = static_cast<uint16_t>(offsets[length] + counts[length]);
+        for (size_t symbol = 0; symbol < lengths.size(); ++symbol)
+            if (lengths[symbol] != 0) symbols[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+        return true;
+    }
+
+    std::optional<uint16_t> decode(BitReader& reader) const {
+        int code = 0, first = 0, index = 0;
+        for (unsigned length = 1; length <= maxBits; ++length) {
+            auto bit = reader.bits(1);
+            if (!bit) return {};
+            code |= static_cast<int>(*bit);
+            int count = counts[length];
+            if (code - count < first) return symbols[static_cast<size_t>(index + code - first)];
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        return {}; // Incomplete code
+    }
+
+private:
+    std::array<uint16_t, maxBits + 1> counts{};
+    std::array<uint16_t, 288> symbols{};
+};
+
+class Inflater {
+public:
+    Inflater(BitReader& bitReader, size_t sizeLimit) : reader(bitReader), limit(sizeLimit) {}
+
+    bool run(std::string& output) {
+        for (bool last = false; !last;) {
+            auto header = reader.bits(3);
+            if (!header) return false;
+            last = (*header & 1) != 0;
+            bool valid = false;
+            switch (*header >> 1) {
+            case 0: valid = stored(output); break;
+            case 1: valid = fixed(output); break;
+            case 2: valid = dynamic(output); break;
+            default: break;
+            }
+            if (!valid) return false;
+        }
+        reader.align();
+        return true;
+    }
+
+private:
+    BitReader& reader;
+    size_t limit;
+
+    bool stored(std::string& output) {
+        reader.align();
+        auto bytes = reader.remaining();
+        if (bytes.size() < 4) return false;
+        auto length = static_cast<size_t>(bytes[0]) | static_cast<size_t>(bytes[1]) << 8;
+        auto complement = static_cast<size_t>(bytes[2]) | static_cast<size_t>(bytes[3]) << 8;
+        if (length != (~complement & 0xFFFF) || bytes.size() < 4 + length || output.size() + length > limit) return false;
+        output.append(reinterpret_cast<const char*>(bytes.data() + 4), length);
+        reader.skip(4 + length);
+        return true;
+    }
+
+    bool fixed(std::string& output) {
+        static const auto codes = [] {
+            std::array<uint8_t, 288 + 30> lengths{};
+            for (size_t symbol = 0; symbol < 288; ++symbol) lengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+            for (size_t symbol = 288; symbol < lengths.size(); ++symbol) lengths[symbol] = 5;
+            std::pair<Huffman, Huffman> huffman;
+            huffman.first.build(std::span{lengths}.first(288));
+            huffman.second.build(std::span{lengths}.subspan(288));
+            return huffman;
+        }();
+        return inflateBlock(output, codes.first, codes.second);
+    }
+
+    bool dynamic(std::string& output) {
+        auto literalsCount = reader.bits(5), distancesCount = reader.bits(5), codeLengthsCount = reader.bits(4);
+        if (!codeLengthsCount || *literalsCount + 257 > 286 || *distancesCount + 1 > 30) return false;
+        static constexpr std::array<uint8_t, 19> order{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+        std::array<uint8_t, 19> codeLengths{};
+        for (size_t index = 0; index < *codeLengthsCount + 4; ++index) {
+            auto length = reader.bits(3);
+            if (!length) return false;
+            codeLengths[order[index]] = static_cast<uint8_t>(*length);
+        }
+        Huffman lengthsCode;
+        if (!lengthsCode.build(codeLengths)) return false;
+
+        std::array<uint8_t, 286 + 30> lengths{};
+        size_t count = *literalsCount + 257 + *distancesCount + 1;
+        for (size_t index = 0; index < count;) {
+            auto symbol = lengthsCode.decode(reader);
+            if (!symbol) return false;
+            if (*symbol < 16) {
+                lengths[index++] = static_cast<uint8_t>(*symbol);
+                continue;
+            }
+            uint8_t repeated = 0;
+            std::optional<uint32_t> repeat;
+            if (*symbol == 16) {
+                if (index == 0) return false;
+                repeated = lengths[index - 1];
+                if ((repeat = reader.bits(2))) *repeat += 3;
+            } else if (*symbol == 17) {
+                if ((repeat = reader.bits(3))) *repeat += 3;
+            } else if ((repeat = reader.bits(7)))
+                *repeat += 11;
+            if (!repeat || index + *repeat > count) return false;
+            for (uint32_t copy = 0; copy < *repeat; ++copy) lengths[index++] = repeated;
+        }
+        if (lengths[256] == 0) return false; // No end of block code
+        Huffman literals, distances;
+        return literals.build(std::span{lengths}.first(*literalsCount + 257)) &&
+               distances.build(std::span{lengths}.subspan(*literalsCount + 257, *distancesCount + 1)) && inflateBlock(output, literals, distances);
+    }
+
+    bool inflateBlock(std::string& output, const Huffman& literals, const Huffman& distances) {
+        while (true) {
+            auto symbol = literals.decode(reader);
+            if (!symbol) return false;
+            if (*symbol < 256) {
+                if (output.size() == limit) return false;
+                output.push_back(static_cast<char>(*symbol));
+                continue;
+            }
+            if (*symbol == 256) return true;
+            auto lengthIndex = static_cast<size_t>(*symbol - 257);
+            if (lengthIndex >= lengthBase.size()) return false;
+            auto lengthBits = reader.bits(lengthExtra[lengthIndex]);
+            auto distanceIndex = distances.decode(reader);
+            if (!lengthBits || !distanceIndex || *distanceIndex >= distanceBase.size()) return false;
+            auto distanceBits = reader.bits(distanceExtra[*distanceIndex]);
+            if (!distanceBits) return false;
+            size_t length = lengthBase[lengthIndex] + *lengthBits, distance = distanceBase[*distanceIndex] + *distanceBits;
+            if (distance > output.size() || output.size() + length > limit) return false;
+            for (auto from = output.size() - distance; length > 0; --length) output.push_back(output[from++]); // Copies may overlap
+        }
+    }
+};
+
+[[nodiscard]] constexpr uint32_t crc32(std::span<const std::byte> bytes) {
+    constexpr auto table = [] {
+        std::array<uint32_t, 256> crcs{};
+        for (uint32_t index = 0; index < 256; ++index) {
+            auto crc = index;
+            for (int bit = 0; bit < 8; ++bit) crc = (crc & 1) ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+            crcs[index] = crc;
+        }
+        return crcs;
+    }();
+    uint32_t crc = 0xFFFFFFFF;
+    for (auto byte : bytes) crc = table[(crc ^ static_cast<uint8_t>(byte)) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+inline uint32_t littleEndian32(std::span<const std::byte> bytes) {
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 |
+           static_cast<uint32_t>(bytes[3]) << 24;
+}
+} // namespace details
+
+/// @return the data of a raw DEFLATE stream, nullopt if it is invalid or inflates to more than sizeLimit bytes
+[[nodiscard]] inline std::optional<std::string> inflate(std::span<const std::byte> deflated, size_t sizeLimit = std::numeric_limits<size_t>::max()) {
+    details::BitReader reader(deflated);
+    std::string output;
+    if (!details::Inflater(reader, sizeLimit).run(output)) return {};
+    return output;
+}
+
+/// @return the data of a zlib stream (deflate content coding), nullopt if it is invalid or inflates to more than sizeLimit bytes
+[[nodiscard]] inline std::optional<std::string> unzlib(std::span<const std::byte> zlibbed, size_t sizeLimit = std::numeric_limits<size_t>::max()) {
+    if (zlibbed.size() < 6) return {};
+    auto method = static_cast<unsigned>(zlibbed[0]), flags = static_cast<unsigned>(zlibbed[1]);
+    if ((method & 0x0F) != 8 || ((method << 8) | flags) % 31 != 0 || (flags & 0x20) != 0) return {}; // Preset dictionaries are not used by HTTP
+    details::BitReader reader(zlibbed.subspan(2));
+    std::string output;
+    if (!details::Inflater(reader, sizeLimit).run(output) || reader.remaining().size() < 4) return {};
+    uint32_t a = 1, b = 0; // Adler-32
+    for (auto c : output) {
+        a = (a + static_cast<uint8_t>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    auto trailer = reader.remaining();
+    auto adler = static_cast<uint32_t>(trailer[0]) << 24 | static_cast<uint32_t>(trailer[1]) << 16 | static_cast<uint32_t>(trailer[2]) << 8 |
+                 static_cast<uint32_t>(trailer[3]);
+    if (adler != ((b << 16) | a)) return {};
+    return output;
+}
+
+/// @return the data of a gzip member (gzip content coding), nullopt if it is invalid or inflates to more than sizeLimit bytes
+[[nodiscard]] inline std::optional<std::string> gunzip(std::span<const std::byte> gzipped, size_t sizeLimit = std::numeric_limits<size_t>::max()) {
+    enum Flags : unsigned { headerCRC = 2, extra = 4, name = 8, comment = 16 };
+    if (gzipped.size() < 18 || gzipped[0] != std::byte{0x1F} || gzipped[1] != std::byte{0x8B} || gzipped[2] != std::byte{8}) return {};
+    auto flags = static_cast<unsigned>(gzipped[3]);
+    size_t next = 10;
+    if (flags & extra) next += 2 + (static_cast<size_t>(gzipped[10]) | static_cast<size_t>(gzipped[11]) << 8);
+    for (auto zeroTerminated : {name, comment}) {
+        if (!(flags & zeroTerminated)) continue;
+        while (next < gzipped.size() && gzipped[next] != std::byte{0}) ++next;
+        ++next;
+    }
+    if (flags & headerCRC) next += 2;
+    if (next >= gzipped.size()) return {};
+
+    details::BitReader reader(gzipped.subspan(next));
+    std::string output;
+    if (!details::Inflater(reader, sizeLimit).run(output) || reader.remaining().size() < 8) return {};
+    auto trailer = reader.remaining();
+    auto bytes = std::as_bytes(std::span{output});
+    if (details::littleEndian32(trailer) != details::crc32(bytes) || details::littleEndian32(trailer.subspan(4)) != static_cast<uint32_t>(output.size()))
+        return {};
+    return output;
+}
+
+} // namespace webfront::utils
@@ -0,0 +1,86 @@
+/// @date 20/10/2026 08:41:17
+/// @author Ambroise Leclerc
+/// @brief Intrusive doubly linked list : objects linked by a hook they hold, without any node allocation
+#pragma once
+#include <cstddef>
+
+namespace webfront::utils {
+
+/// Circular list of objects deriving from IntrusiveList<T>::Hook : linking and unlinking an object cost O(1) and allocate nothing. An object
+/// belongs to a single list at once and unlinks itself when destroyed. Not thread-safe : the owner of the list serializes its accesses.
+template<typename T>
+class IntrusiveList {
+public:
+    class Hook {
+    public:
+        Hook() = default;
+        ~Hook() { unlink(); }
+        Hook(const Hook&) = delete;
+        Hook(Hook&&) = delete;
+        Hook& operator=(const Hook&) = delete;
+        Hook& operator=(Hook&&) = delete;
+
+        [[nodiscard]] bool linked() const { return next != this; }
+
+    private:
+        friend class IntrusiveList;
+        Hook* previous{this};
+        Hook* next{this};
+
+        void unlink() {
+            previous->next = next;
+            next->previous = previous;
+            previous = next = this;
+        }
+        void linkBefore(Hook& position) {
+            previous = position.previous;
+            next = &position;
+            previous->next = this;
+            position.previous = this;
+        }
+    };
+
+    IntrusiveList() = default;
+    ~IntrusiveList() { clear(); }
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList(IntrusiveList&&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(IntrusiveList&&) = delete;
+
+    /// Links object at the end of the list : an object already in the list is moved to its end
+    void pushBack(T& object) {
+        Hook& hook = object;
+        if (hook.linked()) hook.unlink();
+        hook.linkBefore(sentinel);
+    }
+
+    /// Unlinks object from the list, if it is linked to it
+    void erase(T& object) {
+        Hook& hook = object;
+        if (hook.linked()) hook.unlink();
+    }
+
+    /// Unlinks all the objects
+    void clear() {
+        while (sentinel.linked()) sentinel.next->unlink();
+    }
+
+    /// Calls function(T&) on each object, in the order of their linking. function must not unlink them.
+    template<typename Function>
+    void forEach(Function&& function) {
+        for (auto hook = sentinel.next; hook != &sentinel; hook = hook->next) function(static_cast<T&>(*hook));
+    }
+
+    [[nodiscard]] bool empty() const { return !sentinel.linked(); }
+    /// @return the count of linked objects, counted in O(n) : objects destroyed while linked unlink themselves without the list knowing
+    [[nodiscard]] size_t size() const {
+        size_t count = 0;
+        for (auto hook = sentinel.next; hook != &sentinel; hook = hook->next) ++count;
+        return count;
+    }
+
+private:
+    Hook sentinel;
+};
+
+} // namespace webfront::utils
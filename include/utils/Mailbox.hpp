@@ -0,0 +1,67 @@
+/// @date 17/10/2026 10:24:51
+/// @author Ambroise Leclerc
+/// @brief Lock-free multiple producers single consumer queue of tasks : the mailbox of a thread owning its state
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace webfront::utils {
+
+/// Intrusive MPSC queue (Vyukov) : push() is wait-free for the producers, a single exchange of the head, and the consumer pops without
+/// any atomic read-modify-write. A push returns true when the consumer is to be woken up : once per batch of tasks, the consumer calling
+/// drain() when woken up. A task pushed while the consumer drains is run by this drain or by the following one.
+template<typename Task = std::function<void()>>
+class Mailbox {
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        Task task;
+    };
+
+public:
+    Mailbox() = default;
+    ~Mailbox() {
+        while (pop()) {}
+        if (tail != &stub) delete tail;
+    }
+    Mailbox(const Mailbox&) = delete;
+    Mailbox(Mailbox&&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+    Mailbox& operator=(Mailbox&&) = delete;
+
+    /// Can be called from any thread.
+    /// @return true if the consumer is to be woken up to drain() the mailbox : it has not been since its last drain
+    bool push(Task task) {
+        auto node = new Node{{nullptr}, std::move(task)};
+        auto previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+        return !wakeUpPending.exchange(true, std::memory_order_acq_rel);
+    }
+
+    /// Runs the tasks received, in the order of their push by each producer. Called by the consumer thread only.
+    /// @return the count of tasks run
+    size_t drain() {
+        wakeUpPending.exchange(false, std::memory_order_acq_rel); // The following pushes wake the consumer up again
+        size_t count = 0;
+        for (; pop(); ++count) std::exchange(tail->task, Task{})(); // Released before the next task runs
+        return count;
+    }
+
+private:
+    Node stub;
+    std::atomic<Node*> head{&stub}; // Last pushed node
+    Node* tail{&stub};              // Node of the last popped task (consumer only), its task already run
+    std::atomic<bool> wakeUpPending{false};
+
+    // Moves tail to the next node : @return false if there is none, or if its producer has not linked it yet (it wakes the consumer up)
+    bool pop() {
+        auto next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        if (tail != &stub) delete tail;
+        tail = next;
+        return true;
+    }
+};
+
+} // namespace webfront::utils
@@ -0,0 +1,97 @@
+/// @date 22/10/2026 09:47:03
+/// @author Ambroise Leclerc
+/// @brief Memory budget shared by the connections and links of a server, accounted by each one of them
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace webfront::utils {
+
+/// Bytes held by the connections and the WebSocket links of a server (buffers, payloads, pending writes), bounded by limit. Each holder
+/// reserves its bytes through its Account before allocating them, and releases them once freed : a refused reservation lets the holder
+/// apply backpressure or close itself, instead of allocating beyond the budget. Thread-safe.
+class MemoryBudget {
+public:
+    /// @param budgetLimit bytes reserved at once by all the accounts, 0 for no limit (the usage is accounted anyway)
+    explicit MemoryBudget(size_t budgetLimit = 0) : limitBytes(budgetLimit) {}
+    ~MemoryBudget() = default;
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget(MemoryBudget&&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(MemoryBudget&&) = delete;
+
+    /// Bytes reserved by a holder from a budget, up to its own limit. Released with the account. Thread-safe.
+    class Account {
+    public:
+        /// @param memoryBudget budget the bytes are reserved from, none for an account limited by accountLimit only
+        /// @param accountLimit bytes reserved at once by the account, 0 for no limit but the budget's
+        explicit Account(MemoryBudget* memoryBudget = nullptr, size_t accountLimit = 0) : budget(memoryBudget), limitBytes(accountLimit) {}
+        ~Account() { release(used()); }
+        Account(const Account&) = delete;
+        Account(Account&&) = delete;
+        Account& operator=(const Account&) = delete;
+        Account& operator=(Account&&) = delete;
+
+        /// @return true if bytes have been reserved, false if they would exceed the limit of the account or of the budget (nothing is reserved)
+        [[nodiscard]] bool reserve(size_t bytes) {
+            if (!take(usedBytes, bytes, limitBytes)) return false;
+            if (!budget || take(budget->usedBytes, bytes, budget->limitBytes)) return true;
+            usedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            budget->refusedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        /// Accounts bytes already allocated (e.g. the fixed buffers of the holder), whatever the limits : they count against the following
+        /// reservations
+        void charge(size_t bytes) {
+            usedBytes.fetch_add(bytes, std::memory_order_relaxed);
+            if (budget) budget->usedBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        /// Gives back bytes reserved or charged by the account
+        void release(size_t bytes) {
+            if (bytes == 0) return;
+            usedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            if (budget) budget->usedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        /// @return the bytes reserved by the account
+        [[nodiscard]] size_t used() const { return usedBytes.load(std::memory_order_relaxed); }
+        /// @return the limit of the account, 0 for none
+        [[nodiscard]] size_t limit() const { return limitBytes; }
+
+    private:
+        MemoryBudget* budget;
+        size_t limitBytes;
+        std::atomic<size_t> usedBytes{0};
+    };
+
+    /// @return the bytes reserved by all the accounts
+    [[nodiscard]] size_t used() const { return usedBytes.load(std::memory_order_relaxed); }
+    /// @return the limit of the budget, 0 for none
+    [[nodiscard]] size_t limit() const { return limitBytes; }
+    /// @return the bytes left to reserve, SIZE_MAX without limit
+    [[nodiscard]] size_t available() const {
+        if (limitBytes == 0) return SIZE_MAX;
+        auto bytes = used();
+        return bytes < limitBytes ? limitBytes - bytes : 0;
+    }
+    /// @return the count of reservations refused because the budget was exhausted
+    [[nodiscard]] size_t refusals() const { return refusedCount.load(std::memory_order_relaxed); }
+
+private:
+    size_t limitBytes;
+    std::atomic<size_t> usedBytes{0}, refusedCount{0};
+
+    // Adds bytes to counter unless it would exceed limit (0 for none)
+    static bool take(std::atomic<size_t>& counter, size_t bytes, size_t limit) {
+        auto current = counter.load(std::memory_order_relaxed);
+        do {
+            if (limit != 0 && (bytes > limit || current > limit - bytes)) return false;
+        } while (!counter.compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+        return true;
+    }
+};
+
+} // namespace webfront::utils
@@ -0,0 +1,106 @@
+/// @date 17/10/2026 19:12:37
+/// @author Ambroise Leclerc
+/// @brief Perfect hash table of strings known at compile time
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace webfront::utils {
+
+/// Maps N distinct keys to their index with a single hash of the looked up string and a single comparison (hash and displace :
+/// the keys are spread in buckets, then a seed is searched for each bucket placing all its keys in free slots).
+/// Built at compile time : @code static constexpr PerfectHash<3> hash{std::array<std::string_view, 3>{"a", "b", "c"}}; @endcode
+/// With ignoreCase, ASCII letters are folded by the hash and the comparison : find("content-type") finds "Content-Type".
+template<size_t N, bool ignoreCase = false>
+class PerfectHash {
+public:
+    static constexpr size_t bucketsCount = std::bit_ceil(N / 2 + 1);
+    static constexpr size_t slotsCount = std::bit_ceil(2 * N + 1);
+    static constexpr size_t npos = N;
+
+    constexpr explicit PerfectHash(const std::array<std::string_view, N>& hashedKeys) : keys(hashedKeys) {
+        std::array<size_t, N> order;    // Keys sorted by bucket, the most crowded buckets first
+        std::array<size_t, bucketsCount> bucketSizes{};
+        for (size_t index = 0; index < N; ++index) {
+            order[index] = index;
+            ++bucketSizes[bucketOf(hashOf(keys[index]))];
+        }
+        std::ranges::sort(order, [&](size_t a, size_t b) {
+            auto bucketA = bucketOf(hashOf(keys[a])), bucketB = bucketOf(hashOf(keys[b]));
+            return bucketSizes[bucketA] != bucketSizes[bucketB] ? bucketSizes[bucketA] > bucketSizes[bucketB] : bucketA < bucketB;
+        });
+
+        for (size_t first = 0; first < N;) {
+            auto bucket = bucketOf(hashOf(keys[order[first]]));
+            auto last = first + bucketSizes[bucket];
+            seeds[bucket] = placeBucket(std::span{order}.subspan(first, last - first));
+            first = last;
+        }
+    }
+
+    /// @return the index of key, npos if key is not one of the keys
+    [[nodiscard]] constexpr size_t find(std::string_view key) const {
+        if constexpr (N == 0) return npos;
+        else {
+            auto hash = hashOf(key);
+            auto index = slots[slotOf(hash, seeds[bucketOf(hash)])];
+            return index != 0 && equal(keys[index - 1], key) ? index - 1 : npos;
+        }
+    }
+
+private:
+    std::array<std::string_view, N> keys;
+    std::array<uint32_t, bucketsCount> seeds{};
+    std::array<uint32_t, slotsCount> slots{}; // Key index + 1, 0 for an empty slot
+
+    [[nodiscard]] static constexpr uint64_t hashOf(std::string_view key) {
+        uint64_t hash = 14695981039346656037ull; // FNV-1a
+        for (auto c : key) hash = (hash ^ fold(c)) * 1099511628211ull;
+        return hash;
+    }
+
+    [[nodiscard]] static constexpr uint8_t fold(char c) {
+        auto byte = static_cast<uint8_t>(c);
+        return ignoreCase && static_cast<uint8_t>(byte - 'A') < 26 ? static_cast<uint8_t>(byte | 0x20) : byte;
+    }
+
+    [[nodiscard]] static constexpr bool equal(std::string_view s1, std::string_view s2) {
+        return s1.size() == s2.size() && std::ranges::equal(s1, s2, [](char c1, char c2) { return fold(c1) == fold(c2); });
+    }
+
+    [[nodiscard]] static constexpr size_t bucketOf(uint64_t hash) { return (hash >> 32) & (bucketsCount - 1); }
+
+    [[nodiscard]] static constexpr size_t slotOf(uint64_t hash, uint32_t seed) {
+        hash ^= seed * 0x9e3779b97f4a7c15ull; // Murmur3 finalizer
+        hash = (hash ^ (hash >> 33)) * 0xff51afd7ed558ccdull;
+        hash = (hash ^ (hash >> 33)) * 0xc4ceb9fe1a85ec53ull;
+        return (hash ^ (hash >> 33)) & (slotsCount - 1);
+    }
+
+    constexpr uint32_t placeBucket(std::span<const size_t> bucketKeys) {
+        for (uint32_t seed = 0; seed < (1u << 20); ++seed) {
+            auto fits = [&] {
+                for (size_t index = 0; index < bucketKeys.size(); ++index) {
+                    auto slot = slotOf(hashOf(keys[bucketKeys[index]]), seed);
+                    if (slots[slot] != 0) return false;
+                    for (size_t previous = 0; previous < index; ++previous)
+                        if (slotOf(hashOf(keys[bucketKeys[previous]]), seed) == slot) return false;
+                }
+                return true;
+            };
+            if (fits()) {
+                for (auto key : bucketKeys) slots[slotOf(hashOf(keys[key]), seed)] = static_cast<uint32_t>(key + 1);
+                return seed;
+            }
+        }
+        throw std::logic_error("PerfectHash : duplicated keys");
+    }
+};
+
+} // namespace webfront::utils
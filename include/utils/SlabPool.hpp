@@ -0,0 +1,96 @@
+/// @date 20/10/2026 09:06:52
+/// @author Ambroise Leclerc
+/// @brief Slab pool of objects recycled instead of being destroyed, handed out by shared_ptr
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace webfront::utils {
+
+/// The objects are constructed in slabs of slabSize objects, a slab being allocated when no object is free. An object released by its
+/// last shared_ptr is not destroyed : its recycle() member, if any, is called and it is kept to be handed out again by acquire(), with
+/// the memory it holds (buffers, capacities of its containers). The control blocks of the shared_ptrs are pooled as well : once the pool
+/// has grown to the peak count of objects in use, acquiring and releasing them allocates nothing.
+/// Thread-safe : the objects may be released by any thread. The pool must outlive the objects it handed out.
+template<typename T, size_t slabSize = 64>
+class SlabPool {
+    struct Slab {
+        alignas(T) std::byte storage[sizeof(T) * slabSize];
+    };
+
+public:
+    SlabPool() = default;
+    ~SlabPool() {
+        for (size_t index = 0; index < slabs.size(); ++index) {
+            auto objects = reinterpret_cast<T*>(slabs[index]->storage);
+            std::destroy_n(objects, index + 1 == slabs.size() ? constructedInLast : slabSize);
+        }
+    }
+    SlabPool(const SlabPool&) = delete;
+    SlabPool(SlabPool&&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+    SlabPool& operator=(SlabPool&&) = delete;
+
+    /// @return a free object of the pool, or a new one constructed from args if there is none. A recycled object keeps the state left
+    /// by its recycle() : args are only used by the construction.
+    template<typename... Args>
+    [[nodiscard]] std::shared_ptr<T> acquire(Args&&... args) {
+        T* object;
+        {
+            std::scoped_lock lock(mutex);
+            if (free.empty())
+                object = construct(std::forward<Args>(args)...);
+            else {
+                object = free.back();
+                free.pop_back();
+            }
+        }
+        return std::shared_ptr<T>(object, Recycler{this}, std::pmr::polymorphic_allocator<std::byte>(&controlBlocks));
+    }
+
+    /// @return the count of objects constructed by the pool, in use or free
+    [[nodiscard]] size_t size() const {
+        std::scoped_lock lock(mutex);
+        return slabs.empty() ? 0 : (slabs.size() - 1) * slabSize + constructedInLast;
+    }
+
+    /// @return the count of free objects, to be recycled by the next acquisitions
+    [[nodiscard]] size_t available() const {
+        std::scoped_lock lock(mutex);
+        return free.size();
+    }
+
+private:
+    struct Recycler {
+        SlabPool* pool;
+        void operator()(T* object) const {
+            if constexpr (requires { object->recycle(); }) object->recycle();
+            std::scoped_lock lock(pool->mutex);
+            pool->free.push_back(object); // Reserved for all the objects of the slabs : does not throw
+        }
+    };
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Slab>> slabs;
+    size_t constructedInLast{slabSize}; // Objects constructed in the last slab
+    std::vector<T*> free;
+    std::pmr::synchronized_pool_resource controlBlocks;
+
+    template<typename... Args>
+    T* construct(Args&&... args) {
+        if (constructedInLast == slabSize) {
+            slabs.push_back(std::unique_ptr<Slab>(new Slab));
+            free.reserve(slabs.size() * slabSize);
+            constructedInLast = 0;
+        }
+        auto object = std::construct_at(reinterpret_cast<T*>(slabs.back()->storage) + constructedInLast, std::forward<Args>(args)...);
+        ++constructedInLast;
+        return object;
+    }
+};
+
+} // namespace webfront::utils
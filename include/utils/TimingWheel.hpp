@@ -0,0 +1,128 @@
+/// @date 19/10/2026 09:12:36
+/// @author Ambroise Leclerc
+/// @brief Hashed timing wheel : deadlines of many connections driven by a single periodic tick
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace webfront::utils {
+
+/// Timers are intrusive nodes linked in the slot of their deadline : arming, cancelling and re-arming a timer cost O(1) and a tick only
+/// visits the timers of its slot, whatever the count of armed timers. Deadlines beyond one turn of the wheel wait some rounds in their slot.
+/// The owner of the wheel calls advance() periodically (every tick period) : deadlines are accurate to one tick period.
+/// Thread-safe. The expiry functions are called by advance() under the lock of the wheel : they are expected to post their work to the
+/// executor of the timer's owner. A timer being destroyed waits for its running expiry function.
+class TimingWheel {
+    struct Link {
+        Link* previous{this};
+        Link* next{this};
+
+        [[nodiscard]] bool linked() const { return next != this; }
+        void unlink() {
+            previous->next = next;
+            next->previous = previous;
+            previous = next = this;
+        }
+        void linkBefore(Link& position) {
+            previous = position.previous;
+            next = &position;
+            previous->next = this;
+            position.previous = this;
+        }
+    };
+
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Timer : Link {
+    public:
+        explicit Timer(TimingWheel& timingWheel, std::function<void()> onExpiry = {}) : wheel(timingWheel), expiry(std::move(onExpiry)) {}
+        ~Timer() { cancel(); }
+        Timer(const Timer&) = delete;
+        Timer(Timer&&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        Timer& operator=(Timer&&) = delete;
+
+        /// Replaces the function called when the timer expires
+        void onExpiry(std::function<void()> function) {
+            std::scoped_lock lock(wheel.mutex);
+            expiry = std::move(function);
+        }
+
+        /// Arms the timer, replacing its previous deadline
+        void expiresAfter(Clock::duration delay) { wheel.arm(*this, delay); }
+
+        void cancel() {
+            std::scoped_lock lock(wheel.mutex);
+            unlink();
+        }
+
+        /// @return true if the timer is waiting for its deadline
+        [[nodiscard]] bool armed() const {
+            std::scoped_lock lock(wheel.mutex);
+            return linked();
+        }
+
+    private:
+        friend class TimingWheel;
+        TimingWheel& wheel;
+        std::function<void()> expiry;
+        size_t rounds{0}; // Turns of the wheel to wait in its slot before expiring
+    };
+
+    explicit TimingWheel(Clock::duration tickPeriod = std::chrono::milliseconds(100), size_t slotsCount = 512)
+        : period(tickPeriod), slots(slotsCount), nextTick(Clock::now() + period) {}
+    ~TimingWheel() = default;
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+
+    [[nodiscard]] Clock::duration tickPeriod() const { return period; }
+
+    /// Expires the timers whose deadline is reached at now, one slot per elapsed tick
+    void advance(Clock::time_point now = Clock::now()) {
+        std::scoped_lock lock(mutex);
+        for (; nextTick <= now; nextTick += period) {
+            cursor = (cursor + 1) % slots.size();
+            Link visiting; // The slot is moved aside : expiry functions may arm timers in it again
+            if (slots[cursor].linked()) {
+                visiting.linkBefore(slots[cursor]);
+                slots[cursor].unlink();
+            }
+            while (visiting.linked()) {
+                auto& timer = static_cast<Timer&>(*visiting.next);
+                timer.unlink();
+                if (timer.rounds > 0) {
+                    --timer.rounds;
+                    timer.linkBefore(slots[cursor]);
+                }
+                else if (timer.expiry)
+                    timer.expiry();
+            }
+        }
+    }
+
+private:
+    Clock::duration period;
+    std::vector<Link> slots; // Sentinels of the circular lists of timers
+    size_t cursor{0};        // Slot of the last tick
+    Clock::time_point nextTick;
+    mutable std::recursive_mutex mutex; // Expiry functions may re-arm their timer
+
+    void arm(Timer& timer, Clock::duration delay) {
+        auto ticks = std::max<Clock::rep>(1, (delay + period - Clock::duration(1)) / period);
+        std::scoped_lock lock(mutex);
+        auto count = static_cast<size_t>(ticks);
+        timer.unlink();
+        timer.rounds = (count - 1) / slots.size();
+        timer.linkBefore(slots[(cursor + count) % slots.size()]);
+    }
+};
+
+} // namespace webfront::utils
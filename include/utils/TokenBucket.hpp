@@ -0,0 +1,49 @@
+/// @date 21/10/2026 10:24:51
+/// @author Ambroise Leclerc
+/// @brief Token bucket : events admitted at a sustained rate, with bursts up to the capacity of the bucket
+#pragma once
+#include <algorithm>
+#include <chrono>
+
+namespace webfront::utils {
+
+/// The bucket is refilled with rate tokens per second up to its capacity (burst) : an event is admitted if it can take a token. Events
+/// spaced by more than 1/rate are always admitted, burst events at once are admitted by a full bucket. Not thread-safe.
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @param ratePerSecond tokens added every second
+    /// @param burst capacity of the bucket, full when created at now
+    TokenBucket(double ratePerSecond, double burst, Clock::time_point now = Clock::now())
+        : rate(ratePerSecond), capacity(burst), tokens(burst), refilled(now) {}
+
+    /// @return true if a token has been taken at now, false if the bucket is empty
+    bool take(Clock::time_point now = Clock::now()) {
+        refill(now);
+        if (tokens < 1) return false;
+        tokens -= 1;
+        return true;
+    }
+
+    /// @return the tokens in the bucket at now
+    [[nodiscard]] double available(Clock::time_point now = Clock::now()) {
+        refill(now);
+        return tokens;
+    }
+
+    /// @return the time of the last take() or available()
+    [[nodiscard]] Clock::time_point lastUse() const { return refilled; }
+
+private:
+    double rate, capacity, tokens;
+    Clock::time_point refilled;
+
+    void refill(Clock::time_point now) {
+        if (now <= refilled) return;
+        tokens = std::min(capacity, tokens + rate * std::chrono::duration<double>(now - refilled).count());
+        refilled = now;
+    }
+};
+
+} // namespace webfront::utils
@@ -6,6 +6,7 @@
 #include "../tooling/Logger.hpp"
 #include "Messages.hpp"
 
+#include <chrono>
 #include <cstddef>
 #include <optional>
 #include <span>
@@ -36,8 +37,11 @@ class WebLink {
     std::span<const std::byte> undecodedData; /// Data received but not yet consumed
 
 public:
-    WebLink(typename Net::Socket&& socket, WebLinkId webLinkId, std::function<void(WebLinkEvent)> eventHandler)
-        : ws(std::move(socket)), id(webLinkId), eventsHandler(eventHandler) {
+    /// @param limits memory limits of the link, accounted against their budget : a link exceeding them is closed
+    /// @param socketProfile socket profile of the messages sent without a profile of their own
+    WebLink(typename Net::Socket&& socket, WebLinkId webLinkId, std::function<void(WebLinkEvent)> eventHandler, utils::TimingWheel* timeouts = nullptr,
+            std::chrono::milliseconds pingInterval = {}, websocket::Limits limits = {}, std::optional<networking::SocketProfile> socketProfile = {})
+        : ws(std::move(socket), timeouts, pingInterval, limits, socketProfile), id(webLinkId), eventsHandler(eventHandler) {
         log::debug("New WebLink created with id:{}", id);
 
         ws.onMessage([this](std::string_view text) {
@@ -90,6 +94,12 @@ class WebLink {
             }
         });
 
+        // The handler is copied : the link is destroyed by it, being erased from its owner on Code::closed
+        ws.onClose([linkId = id, handler = eventsHandler](websocket::CloseEvent event) {
+            log::debug("WebLink {} closed : {} {}", linkId, event.status, event.reason);
+            handler({WebLinkEvent::Code::closed, linkId});
+        });
+
         ws.start();
     }
     WebLink(const WebLink&) = delete;
@@ -102,8 +112,21 @@ class WebLink {
         if (logSink) log::removeSinks(logSink.value());
     }
 
-    void sendCommand(auto message) { ws.write(message.header(), message.payload()); }
-    void sendFrame(websocket::Frame<Net> frame) { ws.write(std::move(frame)); }
+    /// @param profile socket profile of this class of messages, e.g. throughput for bulk data among the interactive commands
+    /// @return false if the message has been dropped, the memory budget being exhausted or the link closed for exceeding its own limit
+    bool sendCommand(auto message, std::optional<networking::SocketProfile> profile = {}) {
+        return ws.write(message.header(), message.payload(), profile);
+    }
+    bool sendFrame(websocket::Frame<Net> frame, std::optional<networking::SocketProfile> profile = {}) {
+        return ws.write(std::move(frame), profile);
+    }
+
+    /// @return the memory held by the link : reception buffer, message being received and messages waiting to be sent
+    [[nodiscard]] const utils::MemoryBudget::Account& memory() const { return ws.memory(); }
+
+    /// @return a function running tasks on the strand of the link, which closes it (see WebSocket::runner()) : the tasks are dropped once the
+    /// link is destroyed
+    [[nodiscard]] std::function<void(std::function<void()>)> runner() const { return ws.runner(); }
 };
 
 } // namespace webfront
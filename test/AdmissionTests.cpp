@@ -0,0 +1,97 @@
+#include <http/Admission.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+using namespace std::chrono_literals;
+using namespace webfront;
+using namespace webfront::http;
+
+SCENARIO("Admission") {
+    GIVEN("An admission control of 2 connections, without limit of requests") {
+        Admission admission(2, 0);
+
+        WHEN("Connections enter beyond the limit") {
+            auto first = admission.enterConnection();
+            auto second = admission.enterConnection();
+            auto third = admission.enterConnection();
+            THEN("The excess one gets an empty ticket") {
+                REQUIRE(first);
+                REQUIRE(second);
+                REQUIRE(!third);
+                REQUIRE(admission.connections() == 2);
+            }
+            THEN("A released ticket admits the next connection") {
+                first.release();
+                REQUIRE(admission.connections() == 1);
+                auto moved = std::move(second);
+                REQUIRE(admission.connections() == 1);
+                REQUIRE(admission.enterConnection());
+                REQUIRE(admission.connections() == 1); // The temporary ticket has been released
+            }
+        }
+
+        WHEN("Many requests enter") {
+            array<Admission::Ticket, 100> requests;
+            for (auto& request : requests) request = admission.enterRequest();
+            THEN("They are all admitted and counted") {
+                REQUIRE(requests.back());
+                REQUIRE(admission.requestsInFlight() == 100);
+            }
+        }
+    }
+}
+
+SCENARIO("ClientRates") {
+    auto start = utils::TokenBucket::Clock::now();
+    auto first = ClientRates::toAddress(array<uint8_t, 4>{192, 168, 0, 1});
+    auto second = ClientRates::toAddress(array<uint8_t, 4>{192, 168, 0, 2});
+
+    GIVEN("Rates of 1 connection per second with bursts of 2") {
+        ClientRates rates(1, 2);
+
+        WHEN("A client connects 3 times at once") {
+            THEN("Its third connection is refused, not the ones of another client") {
+                REQUIRE(rates.admit(first, start));
+                REQUIRE(rates.admit(first, start));
+                REQUIRE(!rates.admit(first, start));
+                REQUIRE(rates.admit(second, start));
+                REQUIRE(rates.admit(first, start + 1s));
+            }
+        }
+    }
+
+    GIVEN("Rates tracking 4 clients") {
+        ClientRates rates(1, 1, 4);
+        REQUIRE(rates.admit(first, start));
+        REQUIRE(!rates.admit(first, start));
+
+        WHEN("More clients connect") {
+            for (uint8_t client = 10; client < 20; ++client) REQUIRE(rates.admit(ClientRates::toAddress(array<uint8_t, 4>{10, 0, 0, client}), start + 1ms));
+            THEN("The least recently seen ones are forgotten, starting anew") { REQUIRE(rates.admit(first, start + 2ms)); }
+        }
+    }
+
+    GIVEN("Rates without limit") {
+        ClientRates rates(0, 1);
+        THEN("Every connection is admitted") {
+            for (size_t connection = 0; connection < 10; ++connection) REQUIRE(rates.admit(first, start));
+        }
+    }
+
+    GIVEN("IPv4 and IPv6 addresses") {
+        array<uint8_t, 16> v6{};
+        v6[0] = 192;
+        v6[1] = 168;
+        v6[3] = 1;
+        THEN("They are told apart") {
+            REQUIRE(ClientRates::toAddress(v6) != ClientRates::toAddress(array<uint8_t, 4>{192, 168, 0, 1}));
+            REQUIRE(ClientRates::toAddress(v6).back() == 6);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <http/Conditional.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+using namespace std;
+using namespace std::chrono;
+using namespace webfront::http;
+
+SCENARIO("HTTP dates") {
+    GIVEN("The date of RFC9110 examples") {
+        sys_seconds date = sys_days{1994y / November / 6} + 8h + 49min + 37s;
+        THEN("It is formatted as an IMF-fixdate and parsed back") {
+            REQUIRE(toHTTPDate(date) == "Sun, 06 Nov 1994 08:49:37 GMT");
+            REQUIRE(parseHTTPDate("Sun, 06 Nov 1994 08:49:37 GMT") == date);
+            REQUIRE(parseHTTPDate(toHTTPDate(sys_days{2026y / January / 1})) == sys_days{2026y / January / 1});
+        }
+        THEN("The obsolete formats and invalid dates are not parsed") {
+            REQUIRE_FALSE(parseHTTPDate("Sunday, 06-Nov-94 08:49:37 GMT").has_value());
+            REQUIRE_FALSE(parseHTTPDate("Sun Nov  6 08:49:37 1994").has_value());
+            REQUIRE_FALSE(parseHTTPDate("Sun, 31 Nov 1994 08:49:37 GMT").has_value());
+            REQUIRE_FALSE(parseHTTPDate("Sun, 06 Nov 1994 24:49:37 GMT").has_value());
+            REQUIRE_FALSE(parseHTTPDate("Sun, 06 Now 1994 08:49:37 GMT").has_value());
+            REQUIRE_FALSE(parseHTTPDate("").has_value());
+        }
+    }
+}
+
+SCENARIO("Conditional requests preconditions") {
+    sys_seconds modified = sys_days{2026y / October / 17} + 12h;
+    Validators validators{"\"5f3a-1c\"", modified};
+
+    GIVEN("If-None-Match field values") {
+        THEN("A matching entity tag of the list, weak or strong, or * means the client's copy is valid") {
+            REQUIRE(validators.notModified("\"5f3a-1c\"", {}));
+            REQUIRE(validators.notModified("\"other\", W/\"5f3a-1c\"", {}));
+            REQUIRE(validators.notModified(" *", {}));
+        }
+        THEN("Other entity tags do not match, If-Modified-Since being then ignored") {
+            REQUIRE_FALSE(validators.notModified("\"other\"", {}));
+            REQUIRE_FALSE(validators.notModified("\"other\"", toHTTPDate(modified)));
+            REQUIRE_FALSE(validators.notModified("5f3a-1c", {}));
+            REQUIRE_FALSE(Validators{"", modified}.notModified("\"5f3a-1c\"", {}));
+        }
+    }
+
+    GIVEN("If-Modified-Since field values") {
+        THEN("The file is not modified if it has not changed since the date") {
+            REQUIRE(validators.notModified({}, toHTTPDate(modified)));
+            REQUIRE(validators.notModified({}, toHTTPDate(modified + 1h)));
+            REQUIRE_FALSE(validators.notModified({}, toHTTPDate(modified - 1s)));
+            REQUIRE_FALSE(validators.notModified({}, "yesterday"));
+            REQUIRE_FALSE(Validators{"\"5f3a-1c\"", {}}.notModified({}, toHTTPDate(modified)));
+        }
+    }
+
+    GIVEN("If-Range field values") {
+        THEN("The range applies to a strongly matching entity tag or to the exact modification date") {
+            REQUIRE(validators.rangeApplies("\"5f3a-1c\""));
+            REQUIRE(validators.rangeApplies(toHTTPDate(modified)));
+            REQUIRE_FALSE(validators.rangeApplies("W/\"5f3a-1c\""));
+            REQUIRE_FALSE(validators.rangeApplies("\"other\""));
+            REQUIRE_FALSE(validators.rangeApplies(toHTTPDate(modified - 1s)));
+            REQUIRE_FALSE(validators.rangeApplies(""));
+        }
+    }
+}
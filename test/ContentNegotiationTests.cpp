@@ -0,0 +1,62 @@
+#include <http/ContentNegotiation.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace webfront::http;
+
+namespace {
+vector<string_view> preferred(optional<string_view> field) {
+    AcceptEncoding accepted{field};
+    vector<string_view> codings;
+    for (auto coding : accepted.preferred()) codings.push_back(coding);
+    return codings;
+}
+} // namespace
+
+SCENARIO("Accept-Encoding negotiation") {
+    GIVEN("Accept-Encoding fields with quality values") {
+        AcceptEncoding accepted{"gzip;q=0.8, br;q=1.0, identity;q=0.5, deflate;q=0"};
+        THEN("Each coding has its quality value, in thousandths") {
+            REQUIRE(accepted.quality("br") == 1000);
+            REQUIRE(accepted.quality("gzip") == 800);
+            REQUIRE(accepted.quality("") == 500);
+            REQUIRE(accepted.quality("deflate") == 0);
+            REQUIRE(accepted.quality("zstd") == 0);
+        }
+        THEN("The known codings are preferred by decreasing quality value") {
+            REQUIRE(preferred("gzip;q=0.8, br;q=1.0, identity;q=0.5") == vector<string_view>{"br", "gzip", ""});
+            REQUIRE(preferred("gzip, br;q=0.9") == vector<string_view>{"gzip", "", "br"});
+            REQUIRE(preferred("GZIP;Q=0.5, br") == vector<string_view>{"br", "", "gzip"});
+        }
+    }
+
+    GIVEN("Fields without quality values") {
+        THEN("Codings listed are equally preferred, smallest representations first") {
+            REQUIRE(preferred("gzip, deflate, br") == vector<string_view>{"br", "gzip", ""});
+            REQUIRE(preferred("gzip, deflate") == vector<string_view>{"gzip", ""});
+            REQUIRE(AcceptEncoding{"x-gzip"}.quality("gzip") == 1000);
+        }
+    }
+
+    GIVEN("Wildcards and refusals") {
+        THEN("* accepts the codings not listed, identity being refused only explicitly") {
+            REQUIRE(preferred("*") == vector<string_view>{"br", "gzip", ""});
+            REQUIRE(preferred("br, *;q=0") == vector<string_view>{"br"});
+            REQUIRE(preferred("identity;q=0, gzip") == vector<string_view>{"gzip"});
+            REQUIRE(preferred("") == vector<string_view>{""});
+        }
+        THEN("Without Accept-Encoding field only identity is selected") {
+            REQUIRE(preferred(nullopt) == vector<string_view>{""});
+            REQUIRE(AcceptEncoding{nullopt}.quality("gzip") == 0);
+        }
+        THEN("Invalid quality values are ignored") {
+            REQUIRE(AcceptEncoding{"gzip;q=2, br;q=0.1234, deflate;q=abc"}.quality("gzip") == 0);
+            REQUIRE(preferred("gzip;q=2") == vector<string_view>{""});
+        }
+    }
+}
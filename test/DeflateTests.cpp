@@ -0,0 +1,52 @@
+#include <system/IndexFS.hpp>
+#include <utils/Deflate.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+
+using namespace std;
+using namespace webfront;
+
+namespace {
+span<const byte> bytesOf(const string& text) { return as_bytes(span{text}); }
+} // namespace
+
+SCENARIO("Deflate") {
+    GIVEN("Texts of various redundancies") {
+        string repeated;
+        for (int index = 0; index < 10000; ++index) repeated += "WebFront " + to_string(index % 97) + ' ';
+        THEN("Their gzip members and raw DEFLATE streams are decoded back") {
+            for (auto& text : {""s, "a"s, "Hello WebFront"s, string(300000, '\0'), repeated}) {
+                REQUIRE(utils::gunzip(bytesOf(utils::gzip(bytesOf(text)))) == text);
+                REQUIRE(utils::inflate(bytesOf(utils::deflate(bytesOf(text)))) == text);
+            }
+            REQUIRE(utils::gzip(bytesOf(repeated)).size() < repeated.size() / 100);
+        }
+    }
+
+    GIVEN("A script") {
+        using Script = fs::IndexFS::WebFrontJs;
+        auto script = *utils::gunzip(as_bytes(span{Script::data}).first(Script::dataSize));
+        auto gzipped = utils::gzip(bytesOf(script));
+        THEN("It is compressed with dynamic Huffman codes as much as by the tool which embedded it") {
+            REQUIRE(utils::gunzip(bytesOf(gzipped)) == script);
+            REQUIRE(gzipped.size() <= Script::dataSize);
+        }
+    }
+
+    GIVEN("Random bytes followed by a text, longer than a block") {
+        mt19937 generator(2026);
+        string data(200000, '\0');
+        for (auto& c : data) c = static_cast<char>(generator());
+        for (int index = 0; index < 2000; ++index) data += "<div class=\"row\">" + to_string(index) + "</div>\n";
+        auto gzipped = utils::gzip(bytesOf(data));
+        THEN("The incompressible blocks are stored, the others compressed") {
+            REQUIRE(utils::gunzip(bytesOf(gzipped)) == data);
+            REQUIRE(gzipped.size() < 200000 + 200 + (data.size() - 200000) / 4);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include <FixtureFS.hpp>
+#include <utils/Inflate.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace webfront;
+
+// FixtureFS is generated by webfront_embed_assets() from test/embedded (see test/CMakeLists.txt)
+
+namespace {
+string readAll(fs::File& file) {
+    string content;
+    array<char, 64> buffer;
+    while (auto count = file.read(buffer)) content.append(buffer.data(), count);
+    return content;
+}
+
+constexpr array<string_view, 1> identityOnly{""};
+constexpr array<string_view, 1> gzipOnly{"gzip"};
+} // namespace
+
+SCENARIO("webfront_embed_assets") {
+    GIVEN("The fixture directory embedded as FixtureFS") {
+        fs::FixtureFS embeddedFS(".");
+
+        WHEN("opening the identity variant of the files") {
+            auto index = embeddedFS.open("index.html", identityOnly);
+            auto script = embeddedFS.open("js/app.js", identityOnly);
+            auto spaced = embeddedFS.open("read me.txt", identityOnly);
+            THEN("their content is the one of the fixture") {
+                REQUIRE(index.has_value());
+                REQUIRE(index->getEncoding().empty());
+                REQUIRE(readAll(*index).starts_with("<!DOCTYPE html>"));
+                REQUIRE(script.has_value());
+                REQUIRE(readAll(*script) == "console.log('WebFront fixture');\n");
+                REQUIRE(spaced.has_value());
+                REQUIRE(readAll(*spaced) == "Embedded with a space in its name\n");
+            }
+        }
+        WHEN("opening the gzip variant of a compressible file") {
+            auto identity = embeddedFS.open("index.html", identityOnly);
+            auto compressed = embeddedFS.open("index.html", gzipOnly);
+            THEN("it inflates to the identity one, if gzip was found at build time") {
+                REQUIRE(identity.has_value());
+                REQUIRE(compressed.has_value());
+                auto content = readAll(*identity);
+                if (compressed->getEncoding() == "gzip") {
+                    auto deflated = readAll(*compressed);
+                    REQUIRE(deflated.size() < content.size());
+                    REQUIRE(utils::gunzip(as_bytes(span{deflated})) == content);
+                } else
+                    REQUIRE(readAll(*compressed) == content);
+            }
+        }
+        WHEN("opening a file that is not in the fixture") {
+            THEN("it is not found") { REQUIRE_FALSE(embeddedFS.open("missing.html").has_value()); }
+        }
+    }
+}
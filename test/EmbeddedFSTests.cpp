@@ -0,0 +1,127 @@
+#include <system/EmbeddedFS.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace webfront;
+
+namespace {
+// Layout of a blob as generated by webfront_embed_assets() : variants sorted by path, then encoding
+constexpr string_view blobData{"<html>Index</html>" "INDEX.GZ" "INDEX.BR" "body{}" "APP.JS.GZ"};
+
+template<string_view const& Encoding>
+struct TestAssets {
+    static constexpr string_view encoding{Encoding};
+    static constexpr array<fs::EmbeddedAsset, 5> assets{
+      fs::EmbeddedAsset{"css/style.css", "", 34, 6},
+      fs::EmbeddedAsset{"index.html", "", 0, 18},
+      fs::EmbeddedAsset{"index.html", "br", 26, 8},
+      fs::EmbeddedAsset{"index.html", "gzip", 18, 8},
+      fs::EmbeddedAsset{"js/app.js", "gzip", 40, 9},
+    };
+    static span<const byte> blob() { return as_bytes(span{blobData}); }
+};
+
+constexpr string_view gzip{"gzip"}, brotli{"br"}, noEncoding{""};
+
+string readAll(fs::File& file) {
+    string content;
+    array<char, 4> buffer;
+    while (auto count = file.read(buffer)) content.append(buffer.data(), count);
+    return content;
+}
+} // namespace
+
+SCENARIO("EmbeddedFS") {
+    GIVEN("Assets served gzip encoded") {
+        fs::EmbeddedFS<TestAssets<gzip>> embeddedFS(".");
+
+        WHEN("opening a file having a gzip variant") {
+            auto file = embeddedFS.open("index.html");
+            THEN("the gzip variant is read") {
+                REQUIRE(file.has_value());
+                REQUIRE(file->getEncoding() == "gzip");
+                REQUIRE(readAll(*file) == "INDEX.GZ");
+            }
+        }
+        WHEN("opening a file by its absolute path") {
+            auto file = embeddedFS.open("/index.html");
+            THEN("it is found as well") {
+                REQUIRE(file.has_value());
+                REQUIRE(readAll(*file) == "INDEX.GZ");
+            }
+        }
+        WHEN("opening a file without gzip variant") {
+            auto file = embeddedFS.open("css/style.css");
+            THEN("the identity variant is read") {
+                REQUIRE(file.has_value());
+                REQUIRE(file->getEncoding().empty());
+                REQUIRE(readAll(*file) == "body{}");
+            }
+        }
+        WHEN("opening a file not embedded") {
+            THEN("no file is returned") {
+                REQUIRE_FALSE(embeddedFS.open("missing.html").has_value());
+                REQUIRE_FALSE(embeddedFS.open("index").has_value());
+            }
+        }
+    }
+
+    GIVEN("Assets served brotli encoded") {
+        fs::EmbeddedFS<TestAssets<brotli>> embeddedFS(".");
+        THEN("the br variant is read") {
+            auto file = embeddedFS.open("index.html");
+            REQUIRE(file.has_value());
+            REQUIRE(file->getEncoding() == "br");
+            REQUIRE(readAll(*file) == "INDEX.BR");
+        }
+    }
+
+    GIVEN("Assets served without encoding") {
+        fs::EmbeddedFS<TestAssets<noEncoding>> embeddedFS(".");
+        THEN("the identity variant is read") {
+            auto file = embeddedFS.open("index.html");
+            REQUIRE(file.has_value());
+            REQUIRE(file->getEncoding().empty());
+            REQUIRE(readAll(*file) == "<html>Index</html>");
+        }
+        THEN("a file embedded only encoded is not served") { REQUIRE_FALSE(embeddedFS.open("js/app.js").has_value()); }
+    }
+
+    GIVEN("Assets whose variant is negotiated") {
+        fs::EmbeddedFS<TestAssets<gzip>> embeddedFS(".");
+        static constexpr array<string_view, 3> brFirst{"br", "gzip", ""};
+        static constexpr array<string_view, 1> identityOnly{""};
+        THEN("the first variant embedded among the preferred encodings is read") {
+            auto brotliIndex = embeddedFS.open("index.html", brFirst);
+            auto identityIndex = embeddedFS.open("index.html", identityOnly);
+            auto style = embeddedFS.open("css/style.css", brFirst);
+            REQUIRE(readAll(*brotliIndex) == "INDEX.BR");
+            REQUIRE(readAll(*identityIndex) == "<html>Index</html>");
+            REQUIRE(readAll(*style) == "body{}");
+        }
+        THEN("the default variant is read if none of them has been embedded") {
+            REQUIRE(embeddedFS.open("js/app.js", identityOnly)->getEncoding() == "gzip");
+            REQUIRE(embeddedFS.open("index.html", {})->getEncoding() == "gzip");
+        }
+        THEN("the header lines of the files having several variants list Vary") {
+            REQUIRE(embeddedFS.open("index.html", identityOnly)->headers().find("Vary: Accept-Encoding\r\n") != string_view::npos);
+            REQUIRE(embeddedFS.open("css/style.css")->headers().find("Vary: ") == string_view::npos);
+        }
+    }
+
+    GIVEN("The assets table") {
+        using EmbeddedFS = fs::EmbeddedFS<TestAssets<gzip>>;
+        THEN("variants are looked up at compile time") {
+            STATIC_REQUIRE(EmbeddedFS::find("index.html", "br")->offset == 26);
+            STATIC_REQUIRE(EmbeddedFS::find("js/app.js", "gzip")->size == 9);
+            STATIC_REQUIRE(EmbeddedFS::find("js/app.js", "") == nullptr);
+            STATIC_REQUIRE(EmbeddedFS::find("zzz", "") == nullptr);
+        }
+    }
+}
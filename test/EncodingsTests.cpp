@@ -123,6 +123,15 @@ SCENARIO("Base64 encoding") {
     REQUIRE(base64::encodeInNetworkOrder(crypto::sha1("")) == "2jmj7l5rSw0yVb/vlWAYkK/YBwk=");
 }
 
+SCENARIO("Base64url decoding") {
+    REQUIRE(base64::decodeUrl("AAMAAABkAARAAAAAAAIAAAAA") == std::string("\0\3\0\0\0\x64\0\4\x40\0\0\0\0\2\0\0\0\0", 18));
+    REQUIRE(base64::decodeUrl("_-8") == "\xff\xef");
+    REQUIRE(base64::decodeUrl("_-8=") == "\xff\xef");
+    REQUIRE(base64::decodeUrl("") == "");
+    REQUIRE(!base64::decodeUrl("AAMAA"));
+    REQUIRE(!base64::decodeUrl("AA+/"));
+}
+
 SCENARIO("SHA1 hashing") {
     REQUIRE(crypto::sha1String("The quick brown fox jumps over the lazy dog") == "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12");
     REQUIRE(crypto::sha1String("The quick brown fox jumps over the lazy cog") == "de9f2c7fd25e1b3afad3e85a0bd17d9b100db4b3");
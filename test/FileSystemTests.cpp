@@ -4,7 +4,14 @@
 #include "Mocks.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace std;
 using namespace webfront;
@@ -118,4 +125,200 @@ SCENARIO("filesystem::Multi can combine multiple FileSystems") {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+template<typename KnownFiles>
+struct MockIndexedFS {
+    MockIndexedFS(filesystem::path) {}
+    static constexpr auto files = KnownFiles::files;
+    static fs::File fileAt(size_t index) {
+        openings.push_back(files[index]);
+        return fs::File{span<const byte>{}, KnownFiles::encoding};
+    }
+    static string_view headersAt(size_t index) { return KnownFiles::headers[index]; }
+    static optional<fs::File> open(filesystem::path) { return {}; } // Multi must not search the files of an Indexed FS
+    inline static vector<string_view> openings;
+};
+
+struct AppFiles {
+    static constexpr array<string_view, 3> files{"index.html", "js/app.js", "css/app.css"};
+    static constexpr array<string_view, 3> headers{"App: index\r\n", "App: js\r\n", "App: css\r\n"};
+    static constexpr string_view encoding{"br"};
+};
+struct LibFiles {
+    static constexpr array<string_view, 2> files{"lib.js", "index.html"};
+    static constexpr array<string_view, 2> headers{"Lib: js\r\n", "Lib: index\r\n"};
+    static constexpr string_view encoding{"gzip"};
+};
+using MockAppFS = MockIndexedFS<AppFiles>;
+using MockLibFS = MockIndexedFS<LibFiles>;
+
+template<bool watchable>
+struct MockDiskFS {
+    MockDiskFS(filesystem::path) {}
+    optional<fs::File> open(filesystem::path file) {
+        ++openings;
+        if (find(files.begin(), files.end(), file.relative_path().generic_string()) == files.end()) return {};
+        return fs::File{span<const byte>{}};
+    }
+    bool watch(function<void(const filesystem::path&)> onChange) requires watchable {
+        notify = std::move(onChange);
+        return true;
+    }
+    inline static int openings;
+    inline static vector<string> files;
+    inline static function<void(const filesystem::path&)> notify;
+};
+
+/// Watchable filesystem holding the precompressed siblings of files it does not have : served to the clients accepting their coding
+struct MockSiblingsFS {
+    MockSiblingsFS(filesystem::path) {}
+    optional<fs::File> open(filesystem::path file) { return open(file, {}); }
+    optional<fs::File> open(filesystem::path file, span<const string_view> encodings) {
+        ++openings;
+        if (file.relative_path().generic_string() != "lib.js" || ranges::find(encodings, "br") == encodings.end()) return {};
+        return fs::File{span<const byte>{}, string_view{"br"}};
+    }
+    bool watch(function<void(const filesystem::path&)>) { return true; }
+    inline static int openings;
+};
+
+SCENARIO("filesystem::Multi dispatches the files of Indexed filesystems at compile time") {
+    MockAppFS::openings.clear();
+    MockLibFS::openings.clear();
+    STATIC_REQUIRE(fs::Indexed<MockAppFS>);
+    STATIC_REQUIRE_FALSE(fs::Indexed<MockIndexFS>);
+
+    GIVEN("A Multi filesystem combining Indexed filesystems") {
+        fs::Multi<MockAppFS, MockLibFS> multi(".");
+        THEN("each file is opened from the first filesystem serving it") {
+            REQUIRE(multi.open("/index.html")->getEncoding() == "br");
+            REQUIRE(multi.open("lib.js")->getEncoding() == "gzip");
+            REQUIRE(multi.open("css/app.css").has_value());
+            REQUIRE(MockAppFS::openings == vector<string_view>{"index.html", "css/app.css"});
+            REQUIRE(MockLibFS::openings == vector<string_view>{"lib.js"});
+        }
+        THEN("unknown files are not found") {
+            REQUIRE_FALSE(multi.open("js/lib.js").has_value());
+            REQUIRE_FALSE(multi.open("index.htm").has_value());
+        }
+        THEN("the headers of the files are known without opening them") {
+            REQUIRE(multi.headersOf("index.html") == "App: index\r\n");
+            REQUIRE(multi.headersOf("/lib.js") == "Lib: js\r\n");
+            REQUIRE_FALSE(multi.headersOf("missing.js").has_value());
+            REQUIRE(MockAppFS::openings.empty());
+        }
+    }
+
+    GIVEN("A watchable filesystem in front of Indexed filesystems") {
+        using DiskFS = MockDiskFS<true>;
+        DiskFS::openings = 0;
+        DiskFS::files = {"local.txt"};
+        fs::Multi<DiskFS, MockAppFS, MockLibFS> multi(".");
+        vector<filesystem::path> changes;
+        REQUIRE(multi.watch([&](const filesystem::path& changed) { changes.push_back(changed); }));
+
+        WHEN("an embedded file is requested several times") {
+            for (int request = 0; request < 3; ++request) REQUIRE(multi.open("lib.js").has_value());
+            THEN("the watchable filesystem is only searched for the first request") {
+                REQUIRE(DiskFS::openings == 1);
+                REQUIRE(MockLibFS::openings.size() == 3);
+            }
+            THEN("its headers are known without searching the watchable filesystem") {
+                REQUIRE(multi.headersOf("lib.js") == "Lib: js\r\n");
+                REQUIRE(DiskFS::openings == 1);
+            }
+            AND_WHEN("a file changes") {
+                DiskFS::notify("lib.js");
+                DiskFS::files.push_back("lib.js");
+                THEN("the change is reported and the watchable filesystem is searched again") {
+                    REQUIRE(changes == vector<filesystem::path>{"lib.js"});
+                    REQUIRE(multi.open("lib.js").has_value());
+                    REQUIRE(DiskFS::openings == 2);
+                    REQUIRE(MockLibFS::openings.size() == 3);
+                }
+            }
+        }
+        THEN("the headers of an embedded file are unknown until the watchable filesystem has missed it") {
+            REQUIRE_FALSE(multi.headersOf("lib.js").has_value());
+        }
+        WHEN("an unknown file is requested several times") {
+            for (int request = 0; request < 3; ++request) REQUIRE_FALSE(multi.open("missing.txt").has_value());
+            THEN("its miss is remembered") { REQUIRE(DiskFS::openings == 1); }
+        }
+        WHEN("a file of the watchable filesystem is requested") {
+            REQUIRE(multi.open("local.txt").has_value());
+            REQUIRE(multi.open("local.txt").has_value());
+            THEN("it is opened each time") { REQUIRE(DiskFS::openings == 2); }
+        }
+    }
+
+    GIVEN("A watchable filesystem holding precompressed siblings in front of an Indexed filesystem") {
+        MockSiblingsFS::openings = 0;
+        fs::Multi<MockSiblingsFS, MockLibFS> multi(".");
+        constexpr array<string_view, 2> brotli{"br", "gzip"};
+
+        WHEN("a file missed without encoding is requested by a client accepting the coding of its sibling") {
+            REQUIRE(multi.open("lib.js")->getEncoding() == "gzip");
+            REQUIRE(multi.open("lib.js")->getEncoding() == "gzip");
+            THEN("the miss does not hide the sibling") {
+                REQUIRE(MockSiblingsFS::openings == 1);
+                REQUIRE(multi.headersOf("lib.js") == "Lib: js\r\n");
+                REQUIRE_FALSE(multi.headersOf("lib.js", brotli).has_value());
+                REQUIRE(multi.open("lib.js", brotli)->getEncoding() == "br");
+                REQUIRE(MockSiblingsFS::openings == 2);
+            }
+        }
+    }
+
+    GIVEN("A filesystem which cannot be watched in front of an Indexed filesystem") {
+        using DiskFS = MockDiskFS<false>;
+        DiskFS::openings = 0;
+        DiskFS::files = {"index.html"};
+        fs::Multi<DiskFS, MockAppFS> multi(".");
+
+        THEN("it is searched for every request and keeps its precedence") {
+            for (int request = 0; request < 3; ++request) REQUIRE(multi.open("js/app.js").has_value());
+            REQUIRE(multi.open("index.html")->getEncoding().empty());
+            REQUIRE(DiskFS::openings == 4);
+            REQUIRE(MockAppFS::openings.size() == 3);
+        }
+    }
+}
+
+struct EmbeddedData {
+    static constexpr size_t dataSize{11};
+    static constexpr array<uint8_t, 11> data{'e', 'm', 'b', 'e', 'd', 'd', 'e', 'd', ' ', 'j', 's'};
+    static constexpr string_view encoding{"gzip"};
+};
+
+SCENARIO("fs::StaticHeaders") {
+    STATIC_REQUIRE(fs::StaticHeaders{"js/app.js", 1234, "br", "\"a1\""}.view() ==
+                   "Content-Length: 1234\r\nContent-Type: application/javascript\r\nContent-Encoding: br\r\nETag: \"a1\"\r\nAccept-Ranges: bytes\r\n");
+    STATIC_REQUIRE(fs::StaticHeaders{"LICENSE", 0}.view() == "Content-Length: 0\r\nContent-Type: text/plain\r\nAccept-Ranges: bytes\r\n");
+    STATIC_REQUIRE(fs::StaticHeaders::of<EmbeddedData>("app.js").view() ==
+                   "Content-Length: 11\r\nContent-Type: application/javascript\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\n"
+                   "Accept-Ranges: bytes\r\n");
+}
+
+SCENARIO("fs::File gives contiguous access to in-memory data") {
+    GIVEN("A File of embedded data") {
+        fs::File file{EmbeddedData{}};
+
+        THEN("its bytes are reachable in place") {
+            REQUIRE(file.getEncoding() == "gzip");
+            REQUIRE(file.contiguous().data() == reinterpret_cast<const byte*>(EmbeddedData::data.data()));
+            REQUIRE(file.contiguous().size() == 11);
+        }
+        THEN("it can still be read by chunks") {
+            array<char, 8> buffer;
+            REQUIRE(file.read(buffer) == 8);
+            REQUIRE_FALSE(file.eof());
+            REQUIRE(string_view{buffer.data(), 8} == "embedded");
+            REQUIRE(file.read(buffer) == 3);
+            REQUIRE(file.eof());
+            REQUIRE(string_view{buffer.data(), 3} == " js");
+            REQUIRE(file.read(buffer) == 0);
+        }
+    }
+}
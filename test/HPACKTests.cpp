@@ -0,0 +1,144 @@
+#include <http/HPACK.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace webfront::http;
+
+namespace {
+string fromHex(string_view hex) {
+    string bytes;
+    for (size_t index = 0; index + 1 < hex.size(); index += 2) {
+        if (hex[index] == ' ') {
+            --index;
+            continue;
+        }
+        bytes += static_cast<char>(stoi(string(hex.substr(index, 2)), nullptr, 16));
+    }
+    return bytes;
+}
+
+using Fields = vector<pair<string, string>>;
+
+optional<Fields> decode(hpack::Decoder& decoder, string_view block) {
+    Fields fields;
+    if (!decoder.decode(block, [&](string_view name, string_view value) { fields.emplace_back(name, value); })) return {};
+    return fields;
+}
+} // namespace
+
+SCENARIO("HPACK primitives") {
+    GIVEN("Integers of RFC7541 C.1") {
+        THEN("They are encoded with their prefix and decoded back") {
+            string encoded;
+            hpack::encodeInteger(10, 5, 0xE0, encoded);
+            hpack::encodeInteger(1337, 5, 0, encoded);
+            hpack::encodeInteger(42, 8, 0, encoded);
+            REQUIRE(encoded == fromHex("ea 1f9a0a 2a"));
+            string_view data{encoded};
+            REQUIRE(hpack::decodeInteger(data, 5) == 10u);
+            REQUIRE(hpack::decodeInteger(data, 5) == 1337u);
+            REQUIRE(hpack::decodeInteger(data, 8) == 42u);
+            REQUIRE(data.empty());
+            string_view truncated{"\x1f\x9a"}, tooLarge{"\x1f\xff\xff\xff\xff\xff\x01"};
+            REQUIRE(!hpack::decodeInteger(truncated, 5));
+            REQUIRE(!hpack::decodeInteger(tooLarge, 5));
+        }
+    }
+
+    GIVEN("Strings of RFC7541 C.4 and C.6") {
+        THEN("Their Huffman code is the one of the RFC") {
+            for (auto [text, hex] : {pair{"www.example.com"sv, "f1e3c2e5f23a6ba0ab90f4ff"sv}, pair{"no-cache"sv, "a8eb10649cbf"sv},
+                                     pair{"custom-value"sv, "25a849e95bb8e8b4bf"sv},
+                                     pair{"Mon, 21 Oct 2013 20:13:21 GMT"sv, "d07abe941054d444a8200595040b8166e082a62d1bff"sv},
+                                     pair{"https://www.example.com"sv, "9d29ad171863c78f0b97c8e9ae82ae43d3"sv}}) {
+                string encoded;
+                hpack::huffman::encode(text, encoded);
+                REQUIRE(encoded == fromHex(hex));
+                REQUIRE(hpack::huffman::encodedSize(text) == encoded.size());
+                string decoded;
+                REQUIRE(hpack::huffman::decode(encoded, decoded));
+                REQUIRE(decoded == text);
+            }
+        }
+        THEN("Every octet is coded and decoded back") {
+            string all;
+            for (int c = 0; c < 256; ++c) all += static_cast<char>(c);
+            string encoded, decoded;
+            hpack::huffman::encode(all, encoded);
+            REQUIRE(hpack::huffman::decode(encoded, decoded));
+            REQUIRE(decoded == all);
+        }
+        THEN("Invalid paddings are detected") {
+            string decoded;
+            REQUIRE(!hpack::huffman::decode(fromHex("f1e3c2e5f23a6ba0ab90f4ff ff"), decoded)); // Padding longer than 7 bits
+            REQUIRE(!hpack::huffman::decode(fromHex("f1e3c2e5f23a6ba0ab90f4fe"), decoded));   // Padding not made of EOS bits
+            REQUIRE(!hpack::huffman::decode(fromHex("ffffffff"), decoded));                   // EOS
+        }
+    }
+}
+
+SCENARIO("HPACK header blocks") {
+    GIVEN("The requests of RFC7541 C.3 and C.4") {
+        hpack::Decoder decoder;
+        THEN("Their fields are decoded, the dynamic table being shared by the blocks") {
+            for (auto blocks : {vector<string_view>{"828684410f7777772e6578616d706c652e636f6d", "828684be58086e6f2d6361636865",
+                                                     "828785bf400a637573746f6d2d6b65790c637573746f6d2d76616c7565"},
+                                vector<string_view>{"828684418cf1e3c2e5f23a6ba0ab90f4ff", "828684be5886a8eb10649cbf",
+                                                     "828785bf408825a849e95ba97d7f8925a849e95bb8e8b4bf"}}) {
+                hpack::Decoder blocksDecoder;
+                REQUIRE(decode(blocksDecoder, fromHex(blocks[0])) ==
+                        Fields{{":method", "GET"}, {":scheme", "http"}, {":path", "/"}, {":authority", "www.example.com"}});
+                REQUIRE(decode(blocksDecoder, fromHex(blocks[1])) ==
+                        Fields{{":method", "GET"}, {":scheme", "http"}, {":path", "/"}, {":authority", "www.example.com"}, {"cache-control", "no-cache"}});
+                REQUIRE(decode(blocksDecoder, fromHex(blocks[2])) == Fields{{":method", "GET"},
+                                                                             {":scheme", "https"},
+                                                                             {":path", "/index.html"},
+                                                                             {":authority", "www.example.com"},
+                                                                             {"custom-key", "custom-value"}});
+            }
+        }
+        THEN("Invalid blocks are detected") {
+            REQUIRE(!decode(decoder, fromHex("be")));             // Index beyond the tables
+            REQUIRE(!decode(decoder, fromHex("80")));             // Index 0
+            REQUIRE(!decode(decoder, fromHex("3fe21f")));         // Table size update larger than the settings
+            REQUIRE(!decode(decoder, fromHex("82 20")));          // Table size update after a field
+            REQUIRE(!decode(decoder, fromHex("400a637573746f6d"))); // Truncated literal
+        }
+    }
+
+    GIVEN("An encoder and a decoder") {
+        hpack::Encoder encoder;
+        hpack::Decoder decoder;
+        Fields response{{":status", "200"}, {"content-type", "text/html"}, {"content-length", "1234"}, {"cache-control", "no-cache"}};
+        auto encode = [&encoder](const Fields& fields) {
+            string block;
+            for (auto& [name, value] : fields) encoder.encode(name, value, block);
+            return block;
+        };
+        THEN("Repeated fields are sent as indexes, the varying ones are not indexed") {
+            auto first = encode(response);
+            response[2].second = "5678";
+            auto second = encode(response);
+            REQUIRE(decode(decoder, first) ==
+                    Fields{{":status", "200"}, {"content-type", "text/html"}, {"content-length", "1234"}, {"cache-control", "no-cache"}});
+            REQUIRE(decode(decoder, second) == response);
+            REQUIRE(second.size() == 1 + 1 + (2 + 1 + 3) + 1); // content-length : name index, length and Huffman coded value
+        }
+        WHEN("The table size of the decoder shrinks") {
+            auto first = encode(response);
+            encoder.setTableSizeMax(0);
+            auto second = encode(response);
+            THEN("The next block starts with a size update, the fields being sent as literals") {
+                REQUIRE(second.front() == '\x20');
+                REQUIRE(decode(decoder, first));
+                REQUIRE(decode(decoder, second) == response);
+            }
+        }
+    }
+}
@@ -0,0 +1,254 @@
+#include <http/HTTP2.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace webfront::http;
+using namespace webfront::http::http2;
+
+namespace {
+/// Answers each request with the body registered for its path, and records what the session hands it
+struct Streams {
+    map<string, string> bodies;
+    map<uint32_t, string> responses;   // Body left to send, by stream
+    map<uint32_t, string> uploads;     // Request bodies received
+    vector<uint32_t> closed;
+    bool answerAtOnce{true};
+    Session<Streams>* session{nullptr};
+
+    void onRequest(uint32_t streamId, span<const hpack::Field> fields, bool /*endStream*/) {
+        auto path = ranges::find(fields, ":path", &hpack::Field::first)->second;
+        responses[streamId] = bodies[string(path)];
+        if (answerAtOnce) answer(streamId);
+    }
+    void answer(uint32_t streamId) {
+        vector<hpack::Field> fields{{":status", "200"}};
+        session->respond(streamId, fields, !responses[streamId].empty());
+    }
+    void onData(uint32_t streamId, span<const byte> data, bool endStream) {
+        uploads[streamId].append(reinterpret_cast<const char*>(data.data()), data.size());
+        if (endStream) answer(streamId);
+    }
+    pair<span<const byte>, bool> readBody(uint32_t streamId, size_t sizeMax) {
+        auto& body = responses[streamId];
+        auto size = min(sizeMax, body.size());
+        sent = body.substr(0, size);
+        body.erase(0, size);
+        return {as_bytes(span{sent}), body.empty()};
+    }
+    void onClose(uint32_t streamId) { closed.push_back(streamId); }
+
+    string sent;
+};
+
+struct Frame {
+    FrameHeader header;
+    string payload;
+};
+
+/// Client side of the tests : sends frames to the session, and parses the frames of its writes
+struct Client {
+    Streams streams;
+    Session<Streams> session;
+    hpack::Encoder encoder;
+    hpack::Decoder decoder;
+
+    explicit Client(Settings settings = {}) : session(streams, settings) { streams.session = &session; }
+
+    bool send(string_view data) {
+        auto buffer = session.receiveBuffer();
+        REQUIRE(data.size() <= buffer.size());
+        ranges::copy(data, buffer.begin());
+        return session.received(data.size());
+    }
+
+    string frame(FrameType type, uint8_t frameFlags, uint32_t streamId, string_view payload = {}) {
+        string out;
+        appendFrame(out, type, frameFlags, streamId, payload);
+        return out;
+    }
+
+    string request(uint32_t streamId, string_view path, bool endStream = true) {
+        string block;
+        for (auto [name, value] : {pair{":method"sv, "GET"sv}, {":scheme", "http"}, {":path", path}, {":authority", "localhost"}})
+            encoder.encode(name, value, block);
+        return frame(FrameType::headers, flags::endHeaders | (endStream ? flags::endStream : 0), streamId, block);
+    }
+
+    string windowUpdate(uint32_t streamId, uint32_t increment) {
+        string payload;
+        appendUint32(payload, increment);
+        return frame(FrameType::windowUpdate, 0, streamId, payload);
+    }
+
+    /// Connects : preface and empty SETTINGS
+    void connect() {
+        REQUIRE(send(string(preface) + frame(FrameType::settings, 0, 0)));
+    }
+
+    vector<Frame> written() {
+        string bytes;
+        for (auto buffer : session.nextWrite()) bytes += buffer;
+        vector<Frame> frames;
+        for (string_view data{bytes}; !data.empty();) {
+            auto header = FrameHeader::parse(data);
+            frames.push_back({header, string(data.substr(FrameHeader::size, header.length))});
+            data.remove_prefix(FrameHeader::size + header.length);
+        }
+        return frames;
+    }
+
+    static size_t count(const vector<Frame>& frames, FrameType type) {
+        return static_cast<size_t>(ranges::count(frames, type, [](const Frame& frame) { return frame.header.type; }));
+    }
+
+    static string data(const vector<Frame>& frames, uint32_t streamId) {
+        string body;
+        for (auto& frame : frames)
+            if (frame.header.type == FrameType::data && frame.header.streamId == streamId) body += frame.payload;
+        return body;
+    }
+};
+} // namespace
+
+SCENARIO("HTTP/2 session") {
+    GIVEN("A client connecting with its preface") {
+        Client client({.concurrentStreamsMax = 2});
+        client.streams.bodies = {{"/", "Hello WebFront"}, {"/large", string(100'000, 'x')}, {"/other", string(100'000, 'y')}};
+        client.connect();
+        auto frames = client.written();
+        THEN("The server sends its SETTINGS and acknowledges the client's ones") {
+            REQUIRE(frames.size() == 2);
+            REQUIRE(frames[0].header.type == FrameType::settings);
+            REQUIRE(frames[0].header.flags == 0);
+            Settings announced;
+            REQUIRE(!announced.apply(frames[0].payload));
+            REQUIRE(announced.concurrentStreamsMax == 2);
+            REQUIRE(frames[1].header.type == FrameType::settings);
+            REQUIRE(frames[1].header.flags == flags::ack);
+        }
+
+        WHEN("It sends a request") {
+            REQUIRE(client.send(client.request(1, "/")));
+            frames = client.written();
+            THEN("It is answered by HEADERS followed by DATA ending the stream") {
+                REQUIRE(frames.size() == 2);
+                REQUIRE(frames[0].header.type == FrameType::headers);
+                REQUIRE(frames[0].header.streamId == 1);
+                REQUIRE((frames[0].header.flags & flags::endHeaders) != 0);
+                vector<pair<string, string>> fields;
+                REQUIRE(client.decoder.decode(frames[0].payload, [&](string_view name, string_view value) { fields.emplace_back(name, value); }));
+                REQUIRE(fields == vector<pair<string, string>>{{":status", "200"}});
+                REQUIRE(Client::data(frames, 1) == "Hello WebFront");
+                REQUIRE(frames[1].header.flags == flags::endStream);
+                REQUIRE(client.session.openStreams() == 0);
+                client.written();
+                REQUIRE(client.streams.closed == vector<uint32_t>{1});
+            }
+        }
+
+        WHEN("A response is larger than the flow control window of the client") {
+            REQUIRE(client.send(client.request(1, "/large")));
+            frames = client.written();
+            THEN("Its DATA stops at the window, then resumes with WINDOW_UPDATE") {
+                REQUIRE(Client::data(frames, 1).size() == Settings::windowSizeDefault);
+                REQUIRE(client.written().empty());
+                REQUIRE(client.send(client.windowUpdate(0, 50'000) + client.windowUpdate(1, 50'000)));
+                frames = client.written();
+                REQUIRE(Client::data(frames, 1).size() == 100'000 - Settings::windowSizeDefault);
+                REQUIRE(frames.back().header.flags == flags::endStream);
+            }
+        }
+
+        WHEN("Two large responses are sent at once") {
+            auto requests = client.request(1, "/large");
+            requests += client.request(3, "/other"); // In this order : the requests share the dynamic table of the encoder
+            REQUIRE(client.send(requests));
+            frames = client.written();
+            THEN("Their DATA frames share the connection window") {
+                auto first = Client::data(frames, 1), second = Client::data(frames, 3);
+                REQUIRE(first.size() == Settings::windowSizeDefault / 2);
+                REQUIRE(second.size() == Settings::windowSizeDefault / 2);
+                REQUIRE(ranges::all_of(second, [](char c) { return c == 'y'; }));
+            }
+        }
+
+        WHEN("More streams than allowed are opened") {
+            client.streams.answerAtOnce = false;
+            string requests;
+            for (uint32_t streamId : std::initializer_list<uint32_t>{1, 3, 5}) requests += client.request(streamId, "/", false);
+            REQUIRE(client.send(requests));
+            frames = client.written();
+            THEN("The last one is refused") {
+                REQUIRE(frames.size() == 1);
+                REQUIRE(frames[0].header.type == FrameType::rstStream);
+                REQUIRE(frames[0].header.streamId == 5);
+                REQUIRE(readUint32(frames[0].payload) == static_cast<uint32_t>(ErrorCode::refusedStream));
+                REQUIRE(client.session.openStreams() == 2);
+            }
+        }
+
+        WHEN("A request body is sent") {
+            client.streams.answerAtOnce = false;
+            REQUIRE(client.send(client.request(1, "/", false) + client.frame(FrameType::data, 0, 1, "Hello ") +
+                                client.frame(FrameType::data, flags::endStream, 1, "WebFront")));
+            frames = client.written();
+            THEN("It is handed to the handler, which answers once it is complete") {
+                REQUIRE(client.streams.uploads[1] == "Hello WebFront");
+                REQUIRE(Client::count(frames, FrameType::headers) == 1);
+            }
+        }
+
+        WHEN("It sends a PING") {
+            REQUIRE(client.send(client.frame(FrameType::ping, 0, 0, "12345678")));
+            frames = client.written();
+            THEN("The PING is acknowledged with the same payload") {
+                REQUIRE(frames.size() == 1);
+                REQUIRE(frames[0].header.type == FrameType::ping);
+                REQUIRE(frames[0].header.flags == flags::ack);
+                REQUIRE(frames[0].payload == "12345678");
+            }
+        }
+
+        WHEN("It sends an invalid frame") {
+            REQUIRE(!client.send(client.frame(FrameType::data, 0, 0, "data")));
+            frames = client.written();
+            THEN("The connection is closed with GOAWAY") {
+                REQUIRE(frames.size() == 1);
+                REQUIRE(frames[0].header.type == FrameType::goAway);
+                REQUIRE(readUint32(string_view(frames[0].payload).substr(4)) == static_cast<uint32_t>(ErrorCode::protocolError));
+                REQUIRE(client.session.isDone());
+            }
+        }
+    }
+
+    GIVEN("A client not sending the preface") {
+        Client client;
+        THEN("The connection is closed with GOAWAY") {
+            REQUIRE(!client.send("GET / HTTP/1.1\r\n\r\n"));
+            auto frames = client.written();
+            REQUIRE(Client::count(frames, FrameType::goAway) == 1);
+            REQUIRE(client.session.isDone());
+        }
+    }
+
+    GIVEN("An HTTP/1.1 request upgraded to h2c") {
+        Client client;
+        client.streams.answerAtOnce = false;
+        THEN("Its stream 1 is half-closed, its settings applied") {
+            REQUIRE(!client.session.upgrade("AAMAA"));
+            REQUIRE(client.session.upgrade("AAMAAABkAAQAAP__"));
+            REQUIRE(client.session.openStreams() == 1);
+        }
+    }
+}
@@ -0,0 +1,822 @@
+#include <WebFront.hpp>
+#include <http/HPACK.hpp>
+#include <http/HTTP2.hpp>
+#include <http/HTTPServer.hpp>
+#include <networking/TCPNetworkingTS.hpp>
+#include <system/NativeFS.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace webfront;
+using namespace webfront::http;
+using namespace std;
+using Net = networking::TCPNetworkingTS;
+
+namespace {
+
+/// Serves a single 'hello.txt' file containing "Hello WebFront"
+struct HelloFS {
+    HelloFS(filesystem::path) {}
+
+    struct Hello {
+        static constexpr size_t dataSize{14};
+        static constexpr array<uint8_t, 14> data{'H', 'e', 'l', 'l', 'o', ' ', 'W', 'e', 'b', 'F', 'r', 'o', 'n', 't'};
+    };
+
+    optional<fs::File> open(filesystem::path file) {
+        if (file.relative_path().string() == "hello.txt") return fs::File{Hello{}};
+        return {};
+    }
+};
+
+/// Serves the files of its root as streams whose size is unknown
+struct UnsizedFS {
+    UnsizedFS(filesystem::path docRoot) : root(std::move(docRoot)) {}
+
+    optional<fs::File> open(filesystem::path file) {
+        ifstream stream(root / file.relative_path(), ios::binary);
+        if (!stream.is_open()) return {};
+        return fs::File{std::move(stream)};
+    }
+
+    filesystem::path root;
+};
+
+/// Runs a server on an ephemeral loopback port for the lifetime of the object
+template<fs::Provider FS = HelloFS>
+class RunningServer {
+public:
+    /// @param configure called before the server runs, e.g. to add routes
+    explicit RunningServer(ServerOptions options, filesystem::path docRoot = ".", function<void(Server<Net, FS>&)> configure = {})
+        : server("127.0.0.1", "0", docRoot, options), listeningPort(to_string(server.port())) {
+        if (configure) configure(server);
+        runner = thread([this] { server.run(); });
+    }
+    ~RunningServer() {
+        server.stop();
+        runner.join();
+    }
+    RunningServer(const RunningServer&) = delete;
+    RunningServer& operator=(const RunningServer&) = delete;
+
+    [[nodiscard]] string_view port() const { return listeningPort; }
+
+private:
+    Server<Net, FS> server;
+    string listeningPort;
+    thread runner;
+};
+
+/// Blocking HTTP client used to exercise the server from the test threads
+class Client {
+public:
+    explicit Client(string_view port) : socket(ioContext) {
+        Net::Resolver resolver(ioContext);
+        socket.connect(*resolver.resolve("127.0.0.1", port).begin());
+    }
+
+    void send(string_view request) { Net::Write(socket, Net::Buffer(request)); }
+
+    /// @return the next response (status line, headers and Content-Length bytes of body)
+    string receive() {
+        auto headerEnd = string::npos;
+        while ((headerEnd = received.find("\r\n\r\n")) == string::npos) readSome();
+        headerEnd += 4;
+
+        if (auto field = received.find("Transfer-Encoding: chunked\r\n"); field < headerEnd) return receiveChunked(headerEnd);
+        size_t contentLength = 0;
+        if (auto field = received.find("Content-Length: "); field < headerEnd) contentLength = stoul(received.substr(field + 16));
+        while (received.size() < headerEnd + contentLength) readSome();
+
+        auto response = received.substr(0, headerEnd + contentLength);
+        received.erase(0, headerEnd + contentLength);
+        return response;
+    }
+
+    /// @return the next size bytes received
+    string receive(size_t size) {
+        while (received.size() < size) readSome();
+        auto bytes = received.substr(0, size);
+        received.erase(0, size);
+        return bytes;
+    }
+
+    /// @return everything received until the server closes the connection
+    string receiveUntilClosed() {
+        while (!closedByServer()) {}
+        return exchange(received, {});
+    }
+
+    /// @return true if the server closed the connection
+    bool closedByServer() {
+        try {
+            readSome();
+        }
+        catch (const exception&) {
+            return true;
+        }
+        return false;
+    }
+
+private:
+    Net::IoContext ioContext;
+    Net::Socket socket;
+    string received;
+
+    // @return the headers and the decoded body of a response sent with the chunked transfer coding
+    string receiveChunked(size_t headerEnd) {
+        auto response = received.substr(0, headerEnd);
+        for (size_t chunkStart = headerEnd;;) {
+            size_t sizeEnd;
+            while ((sizeEnd = received.find("\r\n", chunkStart)) == string::npos) readSome();
+            auto size = stoul(received.substr(chunkStart, sizeEnd - chunkStart), nullptr, 16);
+            while (received.size() < sizeEnd + 2 + size + 2) readSome();
+            response.append(received, sizeEnd + 2, size);
+            chunkStart = sizeEnd + 2 + size + 2;
+            if (size == 0) {
+                received.erase(0, chunkStart);
+                return response;
+            }
+        }
+    }
+
+    void readSome() {
+        array<char, 1024> buffer;
+        received.append(buffer.data(), socket.read_some(Net::Buffer(buffer)));
+    }
+};
+
+} // namespace
+
+SCENARIO("A multi-threaded HTTP server serves concurrent clients") {
+    GIVEN("A server running its io_context on 4 threads") {
+        RunningServer server({.threadsCount = 4});
+
+        WHEN("32 clients concurrently request a file 8 times each") {
+            constexpr size_t clientsCount = 32, requestsCount = 8;
+            atomic<size_t> okResponses{0}, notFoundResponses{0};
+            {
+                vector<jthread> clients;
+                for (size_t index = 0; index < clientsCount; ++index)
+                    clients.emplace_back([&] {
+                        for (size_t request = 0; request < requestsCount; ++request) {
+                            Client client(server.port());
+                            client.send("GET /hello.txt HTTP/1.1\r\nHost: localhost\r\n\r\n");
+                            auto response = client.receive();
+                            if (response.starts_with("HTTP/1.1 200 OK\r\n") && response.ends_with("\r\n\r\nHello WebFront")) ++okResponses;
+
+                            Client missing(server.port());
+                            missing.send("GET /missing.txt HTTP/1.1\r\nHost: localhost\r\n\r\n");
+                            if (missing.receive().starts_with("HTTP/1.1 404 Not Found\r\n")) ++notFoundResponses;
+                        }
+                    });
+            }
+            THEN("Every request gets its own correct response") {
+                REQUIRE(okResponses == clientsCount * requestsCount);
+                REQUIRE(notFoundResponses == clientsCount * requestsCount);
+            }
+        }
+    }
+}
+
+SCENARIO("A sharded HTTP server shares nothing between its shards") {
+    GIVEN("A server running 3 shards") {
+        Server<Net, HelloFS> server("127.0.0.1", "0", ".", {.shardsCount = 3});
+        jthread runner([&server] { server.run(); });
+
+        WHEN("Clients connect to its port") {
+            size_t okResponses = 0;
+            for (size_t index = 0; index < 12; ++index) {
+                Client client(to_string(server.port()));
+                client.send("GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+                if (client.receive().ends_with("\r\n\r\nHello WebFront")) ++okResponses;
+            }
+            THEN("Each one is served by one of the shards") { REQUIRE(okResponses == 12); }
+        }
+
+        WHEN("Tasks are posted to each shard from another thread") {
+            vector<optional<size_t>> ranOn(server.shardsCount());
+            atomic<size_t> done{0};
+            for (size_t shard = 0; shard < server.shardsCount(); ++shard)
+                server.post(shard, [&, shard] {
+                    ranOn[shard] = server.currentShard();
+                    ++done;
+                });
+            while (done < server.shardsCount()) this_thread::sleep_for(1ms);
+            THEN("They run on the thread of their shard") {
+                REQUIRE(!server.currentShard());
+                REQUIRE(ranOn == vector<optional<size_t>>{0, 1, 2});
+            }
+        }
+        server.stop();
+    }
+}
+
+SCENARIO("WebLinks are reached from any thread while they close") {
+    GIVEN("A WebFront running its server on 4 threads, linked to 8 WebSocket clients") {
+        BasicWF<Net, HelloFS> webFront("0", ".", {.threadsCount = 4});
+        jthread runner([&webFront] { webFront.run(); });
+        constexpr WebLinkId linksCount = 8;
+        vector<unique_ptr<Client>> clients;
+        for (WebLinkId id = 0; id < linksCount; ++id) {
+            clients.push_back(make_unique<Client>(to_string(webFront.port())));
+            clients.back()->send("GET / HTTP/1.1\r\nHost: localhost\r\nConnection: Upgrade\r\nUpgrade: websocket\r\n"
+                                 "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n");
+            REQUIRE(clients.back()->receive().starts_with("HTTP/1.1 101 Switching Protocols\r\n"));
+            while (!webFront.withLink(id, [](WebLink<Net>&) {})) this_thread::sleep_for(1ms); // Created once the response is written
+        }
+
+        WHEN("The clients disconnect while other threads run tasks with their links") {
+            atomic<size_t> ran{0};
+            atomic<bool> reaching{true};
+            vector<jthread> reachers;
+            for (size_t index = 0; index < 4; ++index)
+                reachers.emplace_back([&] {
+                    while (reaching)
+                        for (WebLinkId id = 0; id < linksCount; ++id)
+                            webFront.withLink(id, [&ran](WebLink<Net>& link) {
+                                link.sendCommand(msg::TextCommand(msg::TxtOpcode::debugLog, "Reached"));
+                                if (link.memory().used() > 0) ++ran;
+                            });
+                });
+            while (ran == 0) this_thread::sleep_for(1ms);
+            clients.clear();
+
+            THEN("The tasks run with the links until they are closed and erased, then are dropped") {
+                for (WebLinkId id = 0; id < linksCount; ++id)
+                    while (webFront.withLink(id, [](WebLink<Net>&) {})) this_thread::sleep_for(1ms);
+                reaching = false;
+                reachers.clear();
+                REQUIRE(ran > 0);
+                for (WebLinkId id = 0; id < linksCount; ++id) REQUIRE_FALSE(webFront.withLink(id, [](WebLink<Net>&) { FAIL("Link reached once closed"); }));
+            }
+        }
+        webFront.stop();
+    }
+}
+
+SCENARIO("Admission control sheds the excess load with 503") {
+    GIVEN("A server admitting 2 connections at once") {
+        RunningServer server({.connectionsMax = 2, .retryAfter = 2s});
+        Client first(server.port()), second(server.port());
+        first.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+        second.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+        REQUIRE(first.receive().ends_with("Hello WebFront"));
+        REQUIRE(second.receive().ends_with("Hello WebFront"));
+
+        WHEN("A third client connects") {
+            Client third(server.port());
+            THEN("It is refused as soon as accepted, until another connection is closed") {
+                auto refusal = third.receiveUntilClosed();
+                REQUIRE(refusal.starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+                REQUIRE(refusal.find("Retry-After: 2\r\n") != string::npos);
+                REQUIRE(refusal.find("Connection: close\r\n") != string::npos);
+
+                first.send("GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+                REQUIRE(first.receive().ends_with("Hello WebFront"));
+                REQUIRE(first.closedByServer());
+                this_thread::sleep_for(50ms); // The connection is released once closed
+                Client fourth(server.port());
+                fourth.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(fourth.receive().ends_with("Hello WebFront"));
+            }
+        }
+    }
+
+    GIVEN("A server answering a single request at once, whose route waits for a signal") {
+        atomic<bool> released{false}, entered{false};
+        auto routes = [&](Server<Net, HelloFS>& server) {
+            server.route(Request::Method::Get, "/slow", [&](const Request&, const RouteParameters&) {
+                entered = true;
+                while (!released) this_thread::sleep_for(1ms);
+                return Response::getContentResponse(Response::ok, "slow", "text/plain");
+            });
+        };
+        RunningServer<> server({.threadsCount = 2, .requestsInFlightMax = 1}, ".", routes);
+        Client slow(server.port()), other(server.port());
+        slow.send("GET /slow HTTP/1.1\r\n\r\n");
+        while (!entered) this_thread::sleep_for(1ms);
+
+        WHEN("Another request comes while the first one is being answered") {
+            other.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+            auto shed = other.receive();
+            released = true;
+            THEN("It is answered 503 without being handled, its connection staying open") {
+                REQUIRE(shed.starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+                REQUIRE(shed.find("Retry-After: 1\r\n") != string::npos);
+                REQUIRE(shed.find("Connection: keep-alive\r\n") != string::npos);
+                REQUIRE(slow.receive().ends_with("slow"));
+                this_thread::sleep_for(50ms); // The request is admitted until its response has been written
+                other.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(other.receive().ends_with("Hello WebFront"));
+            }
+        }
+    }
+
+    GIVEN("A server accepting a burst of 2 connections per client, then 1 per minute") {
+        RunningServer server({.clientConnectionsRate = 1.0 / 60, .clientConnectionsBurst = 2});
+
+        WHEN("A client reconnects 3 times") {
+            Client first(server.port()), second(server.port()), third(server.port());
+            THEN("Its third connection is refused") {
+                first.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(first.receive().ends_with("Hello WebFront"));
+                second.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(second.receive().ends_with("Hello WebFront"));
+                REQUIRE(third.receiveUntilClosed().starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+            }
+        }
+    }
+}
+
+SCENARIO("Memory budget of the server") {
+    GIVEN("A server limiting the memory of each connection to 64 KiB, whose route answers 1 MiB") {
+        const utils::MemoryBudget* memory = nullptr;
+        auto routes = [&](Server<Net, HelloFS>& server) {
+            memory = &server.memory();
+            server.route(Request::Method::Get, "/large", [](const Request&, const RouteParameters&) {
+                return Response::getContentResponse(Response::ok, string(1024 * 1024, 'x'), "text/plain");
+            });
+        };
+        RunningServer<> server({.connectionMemoryMax = 64 * 1024}, ".", routes);
+        Client client(server.port());
+
+        WHEN("The large response is requested") {
+            client.send("GET /large HTTP/1.1\r\n\r\n");
+            auto response = client.receive();
+            THEN("It is replaced by 503, the connection staying open and its memory queryable") {
+                REQUIRE(response.starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+                client.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(client.receive().ends_with("Hello WebFront"));
+                REQUIRE(memory->used() >= Connection<Net, HelloFS>::fixedSize());
+                REQUIRE(memory->used() < 64 * 1024);
+            }
+        }
+    }
+
+    GIVEN("A server whose budget holds a single connection") {
+        RunningServer server({.memoryBudget = Connection<Net, HelloFS>::fixedSize() + 1024});
+        Client first(server.port());
+        first.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+        REQUIRE(first.receive().ends_with("Hello WebFront"));
+
+        WHEN("A second client connects") {
+            Client second(server.port());
+            THEN("It is refused with 503 until the first connection is closed") {
+                REQUIRE(second.receiveUntilClosed().starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+                first.send("GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+                REQUIRE(first.receive().ends_with("Hello WebFront"));
+                REQUIRE(first.closedByServer());
+                this_thread::sleep_for(50ms); // The memory of the connection is released once closed
+                Client third(server.port());
+                third.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+                REQUIRE(third.receive().ends_with("Hello WebFront"));
+            }
+        }
+    }
+}
+
+#if defined(__linux__)
+SCENARIO("Socket tuning profiles") {
+    GIVEN("A connected loopback socket") {
+        Net::IoContext ioContext;
+        Net::Acceptor acceptor(ioContext, Net::Endpoint(std::experimental::net::ip::make_address("127.0.0.1"), 0));
+        Net::Socket socket(ioContext);
+        socket.connect(acceptor.local_endpoint());
+        auto option = [&](int level, int name) {
+            int value = 0;
+            socklen_t size = sizeof(value);
+            ::getsockopt(socket.native_handle(), level, name, &value, &size);
+            return value;
+        };
+
+        WHEN("It is tuned with the low latency profile") {
+            Net::Tune(socket, networking::SocketTuning::of(networking::SocketProfile::lowLatency));
+            THEN("Its writes are sent at once") { REQUIRE(option(IPPROTO_TCP, TCP_NODELAY) != 0); }
+        }
+        WHEN("It is tuned with the throughput profile") {
+            auto sendBufferSize = option(SOL_SOCKET, SO_SNDBUF);
+            Net::Tune(socket, networking::SocketTuning::of(networking::SocketProfile::throughput));
+            THEN("Its writes are coalesced into larger buffers (up to net.core.wmem_max)") {
+                REQUIRE(option(IPPROTO_TCP, TCP_NODELAY) == 0);
+                REQUIRE(option(SOL_SOCKET, SO_SNDBUF) > sendBufferSize);
+            }
+            THEN("It can be corked and uncorked") {
+                Net::Cork(socket, true);
+                REQUIRE(option(IPPROTO_TCP, TCP_CORK) != 0);
+                Net::Cork(socket, false);
+                REQUIRE(option(IPPROTO_TCP, TCP_CORK) == 0);
+            }
+        }
+    }
+
+    GIVEN("A directory holding a large file, served with each profile") {
+        auto root = filesystem::temp_directory_path() / ("profiles_loopback_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        string large(4 * 1024 * 1024, '\0');
+        for (size_t index = 0; index < large.size(); ++index) large[index] = static_cast<char>('a' + index % 26);
+        ofstream(root / "large.txt", ios::binary) << large;
+        for (auto profile : {networking::SocketProfile::lowLatency, networking::SocketProfile::throughput}) {
+            RunningServer<fs::NativeMappedFS> server({.socketProfile = profile}, root);
+            Client client(server.port());
+            client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+            auto fileResponse = client.receive();
+            client.send("GET /missing.txt HTTP/1.1\r\n\r\n");
+            auto missingResponse = client.receive();
+            THEN("The file and the following response are received whole") {
+                REQUIRE(fileResponse.ends_with("\r\n\r\n" + large));
+                REQUIRE(missingResponse.starts_with("HTTP/1.1 404 Not Found\r\n"));
+            }
+        }
+        filesystem::remove_all(root);
+    }
+}
+#endif
+
+SCENARIO("HTTP/1.1 persistent connections") {
+    GIVEN("A server allowing 3 requests per connection") {
+        RunningServer server({.keepAliveMaxRequests = 3});
+        Client client(server.port());
+        constexpr string_view helloRequest{"GET /hello.txt HTTP/1.1\r\nHost: localhost\r\n\r\n"};
+
+        WHEN("Sending requests one after the other on the same connection") {
+            client.send(helloRequest);
+            auto first = client.receive();
+            client.send(helloRequest);
+            auto second = client.receive();
+            client.send(helloRequest);
+            auto third = client.receive();
+            THEN("The connection is kept alive until the maximum count of requests is reached") {
+                REQUIRE(first.starts_with("HTTP/1.1 200 OK\r\n"));
+                REQUIRE(first.find("Connection: keep-alive\r\n") != string::npos);
+                REQUIRE(second.starts_with("HTTP/1.1 200 OK\r\n"));
+                REQUIRE(second.find("Connection: keep-alive\r\n") != string::npos);
+                REQUIRE(third.starts_with("HTTP/1.1 200 OK\r\n"));
+                REQUIRE(third.find("Connection: close\r\n") != string::npos);
+                REQUIRE(client.closedByServer());
+            }
+        }
+
+        WHEN("Pipelining several requests in a single write") {
+            client.send("GET /hello.txt HTTP/1.1\r\n\r\nGET /missing.txt HTTP/1.1\r\n\r\nGET /hello.txt HTTP/1.1\r\n\r\n");
+            THEN("Responses are sent in the order of the requests") {
+                REQUIRE(client.receive().starts_with("HTTP/1.1 200 OK\r\n"));
+                REQUIRE(client.receive().starts_with("HTTP/1.1 404 Not Found\r\n"));
+                REQUIRE(client.receive().ends_with("Hello WebFront"));
+            }
+        }
+
+        WHEN("The client asks for the connection to be closed") {
+            client.send("GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+            THEN("The server closes it after the response") {
+                REQUIRE(client.receive().find("Connection: close\r\n") != string::npos);
+                REQUIRE(client.closedByServer());
+            }
+        }
+
+        WHEN("A HTTP/1.0 client does not ask for keep-alive") {
+            client.send("GET /hello.txt HTTP/1.0\r\n\r\n");
+            THEN("The server closes the connection after the response") {
+                REQUIRE(client.receive().find("Connection: close\r\n") != string::npos);
+                REQUIRE(client.closedByServer());
+            }
+        }
+    }
+
+    GIVEN("A server with a short keep-alive timeout") {
+        RunningServer server({.keepAliveTimeout = 50ms});
+        Client client(server.port());
+
+        WHEN("The client stays idle after a response") {
+            client.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+            REQUIRE(client.receive().find("Connection: keep-alive\r\n") != string::npos);
+            this_thread::sleep_for(200ms);
+            THEN("The server closes the connection") { REQUIRE(client.closedByServer()); }
+        }
+    }
+}
+
+SCENARIO("Request bodies are streamed to the routes reading them") {
+    GIVEN("A server with routes uploading files and echoing the size of bodies") {
+        auto root = filesystem::temp_directory_path() / ("bodies_loopback_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        auto routes = [&root](Server<Net, HelloFS>& server) {
+            server.route(Request::Method::Put, "/upload/{name}", [&root](const Request&, const RouteParameters& route) {
+                return uploadTo(root / string(*route["name"]), 1024 * 1024);
+            });
+            server.route(Request::Method::Post, "/size", [](const Request&, const RouteParameters&) {
+                auto size = make_shared<size_t>(0);
+                return BodyConsumer{[size](span<const byte> data) { *size += data.size(); },
+                                    [size] { return Response::getContentResponse(Response::ok, to_string(*size), "text/plain"); }};
+            });
+        };
+        RunningServer<> server({.requestBodySizeMax = 1000}, ".", routes);
+        Client client(server.port());
+        string large(300000, '\0');
+        for (size_t index = 0; index < large.size(); ++index) large[index] = static_cast<char>('a' + index % 26);
+        auto uploaded = [&root](string_view name) {
+            ifstream file(root / name, ios::binary);
+            return string(istreambuf_iterator<char>(file), {});
+        };
+
+        WHEN("Bodies framed by their Content-Length are sent, followed by pipelined requests") {
+            client.send("PUT /upload/large.txt HTTP/1.1\r\nContent-Length: " + to_string(large.size()) + "\r\n\r\n" + large +
+                        "POST /size HTTP/1.1\r\nContent-Length: 5\r\n\r\nHelloGET /hello.txt HTTP/1.1\r\n\r\n");
+            auto upload = client.receive();
+            auto size = client.receive();
+            auto hello = client.receive();
+            THEN("They are consumed as they are received and the connection goes on") {
+                REQUIRE(upload.starts_with("HTTP/1.1 201 Created\r\n"));
+                REQUIRE(upload.find("Connection: keep-alive\r\n") != string::npos);
+                REQUIRE(uploaded("large.txt") == large);
+                REQUIRE(size.ends_with("\r\n\r\n5"));
+                REQUIRE(hello.ends_with("Hello WebFront"));
+            }
+        }
+
+        WHEN("A chunked body is sent in several writes") {
+            client.send("POST /size HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n1F4\r\n" + string(500, 'x'));
+            this_thread::sleep_for(20ms);
+            client.send("\r\n3;ext=1\r\nabc\r\n0\r\n\r\n");
+            THEN("Its payload is decoded") { REQUIRE(client.receive().ends_with("\r\n\r\n503")); }
+        }
+
+        WHEN("A client expects 100 Continue before sending its body") {
+            client.send("PUT /upload/hello.txt HTTP/1.1\r\nContent-Length: 14\r\nExpect: 100-continue\r\n\r\n");
+            auto interim = client.receive();
+            client.send("Hello WebFront");
+            THEN("It is invited to send it") {
+                REQUIRE(interim == "HTTP/1.1 100 Continue\r\n\r\n");
+                REQUIRE(client.receive().starts_with("HTTP/1.1 201 Created\r\n"));
+                REQUIRE(uploaded("hello.txt") == "Hello WebFront");
+            }
+        }
+
+        WHEN("Bodies larger than the limits are announced") {
+            client.send("POST /size HTTP/1.1\r\nContent-Length: 1001\r\n\r\n");
+            auto tooLarge = client.receive();
+            Client chunked(server.port());
+            chunked.send("PUT /upload/chunked.txt HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n100001\r\n");
+            THEN("They are refused with 413 and the connection is closed") {
+                REQUIRE(tooLarge.starts_with("HTTP/1.1 413 Content Too Large\r\n"));
+                REQUIRE(client.closedByServer());
+                REQUIRE(chunked.receive().starts_with("HTTP/1.1 413 Content Too Large\r\n"));
+                REQUIRE(!filesystem::exists(root / "chunked.txt.part"));
+            }
+        }
+
+        WHEN("A body is framed by differing Content-Length lines, smuggling a pipelined request to a proxy framing it by the last one") {
+            client.send("POST /size HTTP/1.1\r\nContent-Length: 0\r\nContent-Length: 40\r\n\r\n"
+                        "GET /hello.txt HTTP/1.1\r\nHost: localhost\r\n\r\n");
+            THEN("It is refused with 400 and the connection is closed, without answering the smuggled request") {
+                REQUIRE(client.receive().starts_with("HTTP/1.1 400 Bad Request\r\n"));
+                REQUIRE(client.receiveUntilClosed().empty());
+            }
+        }
+
+        WHEN("A body is framed by several Transfer-Encoding lines") {
+            client.send("POST /size HTTP/1.1\r\nTransfer-Encoding: chunked\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n");
+            THEN("It is refused with 400 and the connection is closed") {
+                REQUIRE(client.receive().starts_with("HTTP/1.1 400 Bad Request\r\n"));
+                REQUIRE(client.closedByServer());
+            }
+        }
+
+        WHEN("A body is sent to a route not reading it") {
+            client.send("POST /hello.txt HTTP/1.1\r\nContent-Length: 5\r\n\r\nHello");
+            THEN("The request is answered and the connection closed") {
+                REQUIRE(client.receive().find("Connection: close\r\n") != string::npos);
+                REQUIRE(client.closedByServer());
+            }
+        }
+        filesystem::remove_all(root);
+    }
+}
+
+SCENARIO("Cleartext HTTP/2 connections") {
+    GIVEN("A server and a client speaking HTTP/2") {
+        RunningServer server({});
+        Client client(server.port());
+        hpack::Encoder encoder;
+        hpack::Decoder decoder;
+        auto frame = [](http2::FrameType type, uint8_t frameFlags, uint32_t streamId, string_view payload = {}) {
+            string out;
+            http2::appendFrame(out, type, frameFlags, streamId, payload);
+            return out;
+        };
+        auto request = [&](uint32_t streamId, string_view path) {
+            string block;
+            for (auto [name, value] : {pair{":method"sv, "GET"sv}, {":scheme", "http"}, {":path", path}, {":authority", "localhost"}})
+                encoder.encode(name, value, block);
+            return frame(http2::FrameType::headers, http2::flags::endHeaders | http2::flags::endStream, streamId, block);
+        };
+        // Reads the frames until the responses of count streams have ended : @return the status and the body of each stream
+        auto responses = [&](size_t count) {
+            map<uint32_t, pair<string, string>> streams;
+            for (size_t ended = 0; ended < count;) {
+                auto header = http2::FrameHeader::parse(client.receive(http2::FrameHeader::size));
+                auto payload = client.receive(header.length);
+                if (header.type == http2::FrameType::headers)
+                    REQUIRE(decoder.decode(payload, [&](string_view name, string_view value) {
+                        if (name == ":status") streams[header.streamId].first = value;
+                    }));
+                if (header.type == http2::FrameType::data) streams[header.streamId].second += payload;
+                if ((header.type == http2::FrameType::headers || header.type == http2::FrameType::data) && (header.flags & http2::flags::endStream))
+                    ++ended;
+            }
+            return streams;
+        };
+
+        WHEN("It starts with the HTTP/2 preface and sends two requests at once") {
+            auto requests = string(http2::preface) + frame(http2::FrameType::settings, 0, 0) + request(1, "/hello.txt");
+            requests += request(3, "/missing.txt"); // After the first one : they share the dynamic table of the encoder
+            client.send(requests);
+            auto streams = responses(2);
+            THEN("Both are answered on their streams, the connection staying open") {
+                REQUIRE(streams[1] == pair<string, string>{"200", "Hello WebFront"});
+                REQUIRE(streams[3].first == "404");
+                client.send(request(5, "/hello.txt"));
+                REQUIRE(responses(1)[5].second == "Hello WebFront");
+            }
+        }
+
+        WHEN("It upgrades a HTTP/1.1 request to h2c") {
+            client.send("GET /hello.txt HTTP/1.1\r\nHost: localhost\r\nConnection: Upgrade, HTTP2-Settings\r\nUpgrade: h2c\r\nHTTP2-Settings: \r\n\r\n");
+            auto switching = client.receive();
+            client.send(string(http2::preface) + frame(http2::FrameType::settings, 0, 0));
+            THEN("The request is answered by HTTP/2 on the stream 1") {
+                REQUIRE(switching.starts_with("HTTP/1.1 101 Switching Protocols\r\n"));
+                REQUIRE(responses(1)[1] == pair<string, string>{"200", "Hello WebFront"});
+            }
+        }
+    }
+}
+
+SCENARIO("Slow clients are disconnected by the timeouts") {
+    GIVEN("A server with a short header timeout") {
+        RunningServer server({.headerTimeout = 100ms});
+        Client client(server.port());
+
+        WHEN("The client sends its header block too slowly") {
+            client.send("GET /hello.txt HTTP/1.1\r\n");
+            try {
+                for (int field = 0; field < 5; ++field) {
+                    this_thread::sleep_for(40ms);
+                    client.send("X: y\r\n");
+                }
+            }
+            catch (const exception&) {} // Closed by the server meanwhile
+            THEN("The server closes the connection without answering") { REQUIRE(client.receiveUntilClosed().empty()); }
+        }
+
+        WHEN("The client sends its requests in time") {
+            client.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+            auto first = client.receive();
+            this_thread::sleep_for(150ms);
+            client.send("GET /hello.txt HTTP/1.1\r\n\r\n");
+            THEN("The header timeout does not run while the connection waits for the next request") {
+                REQUIRE(first.ends_with("Hello WebFront"));
+                REQUIRE(client.receive().ends_with("Hello WebFront"));
+            }
+        }
+    }
+
+#if defined(__linux__)
+    GIVEN("A server with a short write timeout and a file larger than the socket buffers") {
+        auto root = filesystem::temp_directory_path() / ("timeouts_loopback_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        constexpr size_t largeSize = 64 * 1024 * 1024;
+        ofstream(root / "large.bin", ios::binary) << string(largeSize, 'w');
+        {
+            RunningServer<fs::NativeMappedFS> server({.writeTimeout = 100ms}, root);
+            Client client(server.port());
+
+            WHEN("The client does not read the response") {
+                client.send("GET /large.bin HTTP/1.1\r\n\r\n");
+                this_thread::sleep_for(600ms);
+                THEN("The server closes the stalled connection") { REQUIRE(client.receiveUntilClosed().size() < largeSize); }
+            }
+        }
+        filesystem::remove_all(root);
+    }
+#endif
+}
+
+#if defined(__linux__)
+SCENARIO("Files of a NativeMappedFS are sent without copy") {
+    GIVEN("A server of a directory holding a small and a large file") {
+        auto root = filesystem::temp_directory_path() / ("mappedfs_loopback_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        string large(16 * fs::NativeMappedFS::defaultMappedSizeLimit, '\0');
+        for (size_t index = 0; index < large.size(); ++index) large[index] = static_cast<char>('a' + index % 26);
+        ofstream(root / "small.html", ios::binary) << "<html></html>";
+        ofstream(root / "large.txt", ios::binary) << large;
+        {
+            RunningServer<fs::NativeMappedFS> server({}, root);
+            Client client(server.port());
+
+            WHEN("Both files are requested on the same connection") {
+                client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+                auto largeResponse = client.receive();
+                client.send("GET /small.html HTTP/1.1\r\n\r\n");
+                auto smallResponse = client.receive();
+                THEN("The large file is sent by the kernel and the small one from its mapping") {
+                    REQUIRE(largeResponse.starts_with("HTTP/1.1 200 OK\r\n"));
+                    REQUIRE(largeResponse.find("Content-Length: " + to_string(large.size()) + "\r\n") != string::npos);
+                    REQUIRE(largeResponse.ends_with("\r\n\r\n" + large));
+                    REQUIRE(smallResponse.starts_with("HTTP/1.1 200 OK\r\n"));
+                    REQUIRE(smallResponse.ends_with("\r\n\r\n<html></html>"));
+                }
+            }
+
+            WHEN("A range of the large file is requested") {
+                client.send("GET /large.txt HTTP/1.1\r\nRange: bytes=1000000-1999999\r\n\r\n");
+                auto response = client.receive();
+                THEN("The kernel sends it from its offset") {
+                    REQUIRE(response.starts_with("HTTP/1.1 206 Partial Content\r\n"));
+                    REQUIRE(response.find("Content-Range: bytes 1000000-1999999/" + to_string(large.size()) + "\r\n") != string::npos);
+                    REQUIRE(response.ends_with("\r\n\r\n" + large.substr(1000000, 1000000)));
+                }
+            }
+        }
+        filesystem::remove_all(root);
+    }
+}
+#endif
+
+SCENARIO("Large files are streamed chunk by chunk") {
+    GIVEN("A directory holding a file larger than the streaming threshold") {
+        auto root = filesystem::temp_directory_path() / ("streaming_loopback_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        string large(10 * RequestHandler<Net, UnsizedFS>::streamedSizeMin + 7, '\0');
+        for (size_t index = 0; index < large.size(); ++index) large[index] = static_cast<char>('a' + index % 26);
+        ofstream(root / "large.txt", ios::binary) << large;
+        WHEN("It is served by a file system knowing its size") {
+            RunningServer<fs::NativeDebugFS> server({.streamChunkSize = 4096}, root);
+            Client client(server.port());
+            client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+            auto response = client.receive();
+            client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+            THEN("It is sent with its Content-Length, the connection staying alive") {
+                REQUIRE(response.find("Content-Length: " + to_string(large.size()) + "\r\n") != string::npos);
+                REQUIRE(response.ends_with("\r\n\r\n" + large));
+                REQUIRE(client.receive().ends_with("\r\n\r\n" + large));
+            }
+        }
+
+        WHEN("A range of it is requested") {
+            RunningServer<fs::NativeDebugFS> server({.streamChunkSize = 4096}, root);
+            Client client(server.port());
+            client.send("GET /large.txt HTTP/1.1\r\nRange: bytes=100000-\r\n\r\n");
+            auto response = client.receive();
+            THEN("Only the range is streamed") {
+                REQUIRE(response.starts_with("HTTP/1.1 206 Partial Content\r\n"));
+                REQUIRE(response.ends_with("\r\n\r\n" + large.substr(100000)));
+            }
+        }
+
+        WHEN("It is served by a file system not knowing its size") {
+            RunningServer<UnsizedFS> server({}, root);
+            Client client(server.port());
+            client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+            auto response = client.receive();
+            client.send("GET /large.txt HTTP/1.1\r\n\r\n");
+            THEN("It is sent with the chunked transfer coding to a HTTP/1.1 client") {
+                REQUIRE(response.find("Transfer-Encoding: chunked\r\n") != string::npos);
+                REQUIRE(response.find("Content-Length") == string::npos);
+                REQUIRE(response.ends_with("\r\n\r\n" + large));
+                REQUIRE(client.receive().ends_with("\r\n\r\n" + large));
+            }
+        }
+
+        WHEN("It is requested by a HTTP/1.0 client from a file system not knowing its size") {
+            RunningServer<UnsizedFS> server({}, root);
+            Client client(server.port());
+            client.send("GET /large.txt HTTP/1.0\r\nConnection: keep-alive\r\n\r\n");
+            auto response = client.receiveUntilClosed();
+            THEN("Its end is signaled by closing the connection") {
+                REQUIRE(response.find("Transfer-Encoding") == string::npos);
+                REQUIRE(response.find("Connection: close\r\n") != string::npos);
+                REQUIRE(response.ends_with("\r\n\r\n" + large));
+            }
+        }
+        filesystem::remove_all(root);
+    }
+}
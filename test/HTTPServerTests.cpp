@@ -1,11 +1,25 @@
 #include <http/HTTPServer.hpp>
 #include <networking/NetworkingMock.hpp>
+#include <system/EmbeddedFS.hpp>
+#include <system/IndexFS.hpp>
+#include <system/NativeFS.hpp>
+#include <utils/Deflate.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include "Mocks.hpp"
 
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace webfront;
 using namespace webfront::http;
@@ -61,31 +75,52 @@ SCENARIO("HTTP Response") {
     GIVEN("badRequest Response") {
         auto bad = Response::getStatusResponse(Response::badRequest);
         WHEN("extracting buffers") {
-            auto buffers = bad.toBuffers<Net>();
-            THEN("buffer contents should be") {
-                REQUIRE(buffers.size() == 11);
-                using Buffer = decltype(buffers[0]);
-                auto compare = [](Buffer b, std::string s) {
-                    auto data = reinterpret_cast<const char*>(b.data());
-                    for (size_t index = 0; index < s.size(); ++index)
-                        if (data[index] != s[index]) return false;
-                    return true;
-                };
-                REQUIRE(compare(buffers[0], "HTTP/1.1 400 Bad Request"));
-                REQUIRE(compare(buffers[1], "Content-Length"));
-                REQUIRE(compare(buffers[2], ": "));
-                REQUIRE(compare(buffers[3], "89"));
-                REQUIRE(compare(buffers[4], "\r\n"));
-                REQUIRE(compare(buffers[5], "Content-Type"));
-                REQUIRE(compare(buffers[6], ": "));
-                REQUIRE(compare(buffers[7], "text/html"));
-                REQUIRE(compare(buffers[8], "\r\n"));
-                REQUIRE(compare(buffers[9], "\r\n"));
-                REQUIRE(compare(buffers[10],
-                                "<html><head><title>Bad Request</title></head><body><h1>400 Bad Request</h1></body></html>"));
+            string headerBlock;
+            auto buffers = bad.toBuffers<Net>(headerBlock);
+            THEN("The status line and the headers are serialized in a single buffer followed by the content") {
+                REQUIRE(buffers.size() == 2);
+                auto toString = [](auto buffer) { return string(reinterpret_cast<const char*>(buffer.data()), buffer.size()); };
+                REQUIRE(toString(buffers[0]) == "HTTP/1.1 400 Bad Request\r\nContent-Length: 89\r\nContent-Type: text/html\r\n\r\n");
+                REQUIRE(toString(buffers[1]) == "<html><head><title>Bad Request</title></head><body><h1>400 Bad Request</h1></body></html>");
+            }
+            THEN("The header block keeps its capacity for the next response") {
+                auto data = headerBlock.data();
+                auto ok = Response::getStatusResponse(Response::ok);
+                REQUIRE(ok.toBuffers<Net>(headerBlock)[0].data() == data);
+                REQUIRE(headerBlock.starts_with("HTTP/1.1 200 OK\r\n"));
+            }
+        }
+    }
+
+    GIVEN("A connection's arena") {
+        array<byte, 4096> arenaBuffer;
+        pmr::monotonic_buffer_resource arena{arenaBuffer.data(), arenaBuffer.size(), pmr::null_memory_resource()};
+        WHEN("a response is built in its scope") {
+            auto inArena = [&] {
+                ArenaScope scope(arena);
+                return Response::getContentResponse(Response::ok, string(100, 'x'), "text/plain");
+            }();
+            auto copied = inArena;
+            Response outside;
+            THEN("its headers and content are allocated from the arena, its copies and the responses built outside from the default resource") {
+                auto inBuffer = [&](const void* address) { return address >= arenaBuffer.data() && address < arenaBuffer.data() + arenaBuffer.size(); };
+                REQUIRE(inBuffer(inArena.content.data()));
+                REQUIRE(inBuffer(inArena.headers.data()));
+                REQUIRE(inArena.headers[1].value == "text/plain");
+                REQUIRE(copied.content == inArena.content);
+                REQUIRE(!inBuffer(copied.content.data()));
+                REQUIRE(outside.headers.get_allocator().resource() == pmr::get_default_resource());
+                REQUIRE(requestArena == nullptr);
             }
         }
     }
+
+    GIVEN("The pre-rendered status lines") {
+        static_assert(Response::getStatusLine(Response::notFound) == "HTTP/1.1 404 Not Found\r\n");
+        REQUIRE(Response::getStatusLine(Response::switchingProtocols) == "HTTP/1.1 101 Switching Protocols\r\n");
+        REQUIRE(Response::getStatusLine(Response::requestHeaderFieldsTooLarge) == "HTTP/1.1 431 Request Header Fields Too Large\r\n");
+        REQUIRE(Response::getStatusLine(Response::serviceUnavailable) == "HTTP/1.1 503 Service Unavailable\r\n");
+    }
 }
 
 SCENARIO("RequestParser") {
@@ -95,7 +130,7 @@ SCENARIO("RequestParser") {
                      "Accept-Encoding: deflate\r\nConnection: Keep-Alive\r\n\r\n"};
         WHEN("parsing it") {
             Request request;
-            REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+            REQUIRE(request.parse(input) == Request::ParseResult::completed);
             THEN("It should fill correctly the Request structure") {
                 REQUIRE(request.completed());
                 REQUIRE(request.uri == "/hello.htm");
@@ -112,6 +147,14 @@ SCENARIO("RequestParser") {
                 REQUIRE(request.headersContain("Accept-Encoding", "deflate"));
                 REQUIRE(request.headersContain("Accept-Encoding", "gzip"));
             }
+            THEN("Well-known headers are found by their HeaderField, whatever the case of their name") {
+                REQUIRE(request.getHeaderValue(HeaderField::host) == "www.tutorialspoint.com");
+                REQUIRE(request.getHeaderValue("HOST") == "www.tutorialspoint.com");
+                REQUIRE(request.headersContain(HeaderField::acceptEncoding, "DEFLATE"));
+                REQUIRE(request.headersContain(HeaderField::connection, "keep-alive"));
+                REQUIRE(!request.getHeaderValue(HeaderField::upgrade));
+                REQUIRE(!request.headersContain(HeaderField::upgrade, "websocket"));
+            }
         }
     }
 
@@ -121,7 +164,49 @@ SCENARIO("RequestParser") {
                      "Keep-Alive\r\n\r\n"};
         WHEN("parsing it") {
             Request request;
-            REQUIRE_THROWS(request.parseSomeData(input.cbegin(), input.cend()));
+            REQUIRE(request.parse(input) == Request::ParseResult::badRequest);
+        }
+    }
+
+    GIVEN("Two pipelined requests") {
+        string input{"GET /first.htm HTTP/1.1\r\nConnection: keep-alive\r\n\r\nGET /second.htm HTTP/1.0\r\n\r\n"};
+        WHEN("parsing them") {
+            Request request;
+            REQUIRE(request.parse(input) == Request::ParseResult::completed);
+            THEN("Parsing stops at the end of the first request") {
+                REQUIRE(request.uri == "/first.htm");
+                REQUIRE(request.isPersistent());
+                REQUIRE(request.size() == input.find("GET /second.htm"));
+
+                string_view next = string_view(input).substr(request.size());
+                request.reset();
+                REQUIRE(request.parse(next) == Request::ParseResult::completed);
+                REQUIRE(request.size() == next.size());
+                REQUIRE(request.uri == "/second.htm");
+                REQUIRE(!request.isPersistent());
+            }
+        }
+    }
+
+    GIVEN("Malformed HTTP requests") {
+        auto parse = [](string_view input) { return Request{}.parse(input); };
+        THEN("They are reported as bad requests without throwing") {
+            REQUIRE(parse("GET /hello.htm HTTP/1.1\nHost: localhost\r\n\r\n") == Request::ParseResult::badRequest);
+            REQUIRE(parse("GET /hello.htm HTTP/1.1\r\nHost: local\x01host\r\n\r\n") == Request::ParseResult::badRequest);
+            REQUIRE(parse("GET /hello.htm HTTP/1.1\r\nHost: localhost\r\n continued\r\n\r\n") == Request::ParseResult::badRequest);
+            REQUIRE(parse("GET /hello.htm HTTP/11\r\n\r\n") == Request::ParseResult::badRequest);
+            REQUIRE(parse("G(T /hello.htm HTTP/1.1\r\n\r\n") == Request::ParseResult::badRequest);
+        }
+    }
+
+    GIVEN("A request with leading empty lines and header values surrounded by whitespaces") {
+        string input{"\r\nGET /hello.htm HTTP/1.1\r\nHost:\t localhost \t\r\nAccept:\r\n\r\n"};
+        Request request;
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        THEN("Empty lines are skipped and values are trimmed") {
+            REQUIRE(request.uri == "/hello.htm");
+            REQUIRE(request.getHeaderValue("Host") == "localhost");
+            REQUIRE(request.getHeaderValue("Accept") == "");
         }
     }
 
@@ -131,7 +216,7 @@ SCENARIO("RequestParser") {
                      "Upgrade\r\nUpgrade: websocket\r\n\r\n"};
         WHEN("parsing it") {
             Request request;
-            REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+            REQUIRE(request.parse(input) == Request::ParseResult::completed);
             THEN("An upgrade request should be detected") {
                 REQUIRE(request.completed());
                 REQUIRE(request.isUpgradeRequest("websocket"));
@@ -156,7 +241,7 @@ SCENARIO("Request parsing") {
         string input{"DELETE /ressource.txt HTTP/1.1\r\nUser-Agent: Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)\r\nHost: "
                      "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\n\r\n"};
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
         REQUIRE(request.completed());
         REQUIRE(request.uri == "/ressource.txt");
         REQUIRE(request.method == Request::Method::Delete);
@@ -165,7 +250,8 @@ SCENARIO("Request parsing") {
             auto response = handler.handleRequest(request);
 
             THEN("It should respond with a 'Not Implemented' http response") {
-                auto buffers = response.toBuffers<Net>();
+                string headerBlock;
+                auto buffers = response.toBuffers<Net>(headerBlock);
                 REQUIRE(compare(buffers[0], "HTTP/1.1 501 Not Implemented"));
             }
         }
@@ -177,7 +263,7 @@ SCENARIO("Request parsing") {
           "x3JJHMbDL1EzLkh9GBhXDw==\r\nSec-WebSocket-Protocol: chat, superchat\r\nSec-WebSocket-Version: 13\r\nOrigin: "
           "http://example.com\r\n\r\n"};
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
         REQUIRE(request.completed());
         REQUIRE(request.uri == "/chat");
         REQUIRE(request.method == Request::Method::Get);
@@ -186,21 +272,21 @@ SCENARIO("Request parsing") {
             auto response = handler.handleRequest(request);
 
             THEN("It should respond with a 'Switching Protocols' http response") {
-                auto buffers = response.toBuffers<Net>();
+                string headerBlock;
+                auto buffers = response.toBuffers<Net>(headerBlock);
                 REQUIRE(compare(buffers[0], "HTTP/1.1 101 Switching Protocols"));
-                REQUIRE(compare(buffers[1], "Upgrade"));
-                REQUIRE(compare(buffers[3], "websocket"));
-                REQUIRE(compare(buffers[9], "Sec-WebSocket-Accept"));
-                REQUIRE(compare(buffers[11], "HSmrc0sMlYUkAGmm5OPpG2HaGWk="));
+                REQUIRE(headerBlock.find("\r\nUpgrade: websocket\r\n") != string::npos);
+                REQUIRE(headerBlock.find("\r\nSec-WebSocket-Accept: HSmrc0sMlYUkAGmm5OPpG2HaGWk=\r\n") != string::npos);
+                REQUIRE(buffers[1].size() == 0);
             }
         }
     }
 
     GIVEN("A HTTP HEAD request") {
         string input{"HEAD /file.txt HTTP/1.1\r\nUser-Agent: Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)\r\nHost: "
-                     "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\n\r\n"};
+                     "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\nAccept-Encoding: br\r\n\r\n"};
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
         REQUIRE(request.completed());
         REQUIRE(request.uri == "/file.txt");
         REQUIRE(request.method == Request::Method::Head);
@@ -217,7 +303,7 @@ SCENARIO("Request parsing") {
                      "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\n\r\n"};
 
         Request request;
-        REQUIRE_THROWS_AS(request.parseSomeData(input.cbegin(), input.cend()), BadRequestException);
+        REQUIRE(request.parse(input) == Request::ParseResult::badRequest);
     }
 }
 
@@ -225,14 +311,14 @@ SCENARIO("Asynchronous Request parsing") {
     GIVEN("A HTTP HEAD request received asynchronously") {
         string chunk1{"HEAD /file.txt HTTP/1.1\r\nUser-Agent:"};
         string chunk2{" Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)\r\nHost: "};
-        string chunk3{"www.bernardlehacker.com\r\nConnection: Keep-Alive\r\n\r\n"};
+        string chunk3{"www.bernardlehacker.com\r\nConnection: Keep-Alive\r\nAccept-Encoding: br\r\n\r\n"};
+        string received;
+        received.reserve(chunk1.size() + chunk2.size() + chunk3.size()); // Parsed data is referenced in place : no reallocation allowed
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(chunk1.cbegin(), chunk1.cend()));
-        REQUIRE(!request.completed());
-        REQUIRE_NOTHROW(request.parseSomeData(chunk2.cbegin(), chunk2.cend()));
-        REQUIRE(!request.completed());
-        REQUIRE_NOTHROW(request.parseSomeData(chunk3.cbegin(), chunk3.cend()));
-        REQUIRE(request.completed());
+        REQUIRE(request.parse(received += chunk1) == Request::ParseResult::incomplete);
+        REQUIRE(request.parse(received += chunk2) == Request::ParseResult::incomplete);
+        REQUIRE(request.parse(received += chunk3) == Request::ParseResult::completed);
+        REQUIRE(request.getHeaderValue("User-Agent") == "Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)");
         REQUIRE(request.uri == "/file.txt");
         REQUIRE(request.method == Request::Method::Head);
         WHEN("A RequestHandler process it") {
@@ -244,12 +330,99 @@ SCENARIO("Asynchronous Request parsing") {
     }
 }
 
+/// MockFileSystem reporting its changes through the callback given to watch()
+struct WatchableFileSystem : MockFileSystem<ResourceAndFile> {
+    using MockFileSystem::MockFileSystem;
+    bool watch(std::function<void(const filesystem::path&)> callback) {
+        onChange = std::move(callback);
+        return true;
+    }
+    inline static std::function<void(const filesystem::path&)> onChange;
+};
+
+SCENARIO("RequestHandler with a response cache") {
+    GIVEN("A RequestHandler caching responses of a watched file system") {
+        RequestHandler<Net, WatchableFileSystem> handler{".", 4096};
+        string input{"GET /file.txt HTTP/1.1\r\nAccept-Encoding: gzip, br\r\n\r\n"};
+        Request request;
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        auto first = handler.handleRequest(request);
+        auto openings = WatchableFileSystem::openingsCounter;
+
+        WHEN("The same file is requested again") {
+            auto second = handler.handleRequest(request);
+            THEN("It is served from the cache without opening the file") {
+                REQUIRE(WatchableFileSystem::openingsCounter == openings);
+                REQUIRE(second.statusCode == Response::ok);
+                REQUIRE(second.serialized);
+                string firstHeaders, secondHeaders;
+                auto firstBuffers = first.toBuffers<Net>(firstHeaders);
+                auto secondBuffers = second.toBuffers<Net>(secondHeaders);
+                REQUIRE(firstHeaders == secondHeaders);
+                REQUIRE(firstBuffers[1].size() == secondBuffers[1].size());
+                REQUIRE(secondHeaders.find("Content-Encoding: br\r\n") != string::npos);
+            }
+        }
+
+        WHEN("A client not accepting the file encoding requests it") {
+            string plain{"GET /file.txt HTTP/1.1\r\n\r\n"};
+            Request plainRequest;
+            REQUIRE(plainRequest.parse(plain) == Request::ParseResult::completed);
+            THEN("The cached response is not used") {
+                REQUIRE(handler.handleRequest(plainRequest).statusCode == Response::variantAlsoNegotiates);
+            }
+        }
+
+        WHEN("The file system reports a change of the file") {
+            WatchableFileSystem::onChange("file.txt");
+            auto second = handler.handleRequest(request);
+            THEN("The file is opened again") {
+                REQUIRE(WatchableFileSystem::openingsCounter == openings + 1);
+                REQUIRE(!second.serialized);
+            }
+        }
+    }
+
+    GIVEN("A RequestHandler without response cache") {
+        RequestHandler<Net, MockFileSystem<ResourceAndFile>> handler{"."};
+        string input{"GET /file.txt HTTP/1.1\r\nAccept-Encoding: br\r\n\r\n"};
+        Request request;
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        auto openings = MockFileSystem<ResourceAndFile>::openingsCounter;
+        handler.handleRequest(request);
+        handler.handleRequest(request);
+        THEN("Every request opens the file") { REQUIRE(MockFileSystem<ResourceAndFile>::openingsCounter == openings + 2); }
+    }
+}
+
+SCENARIO("RequestHandler shedding the excess load") {
+    GIVEN("A RequestHandler announcing a 3 seconds Retry-After") {
+        RequestHandler<Net, MockFileSystem<ResourceAndFile>> handler{".", 0, {}, 1024, 0, 3s};
+        auto first = handler.serviceUnavailable();
+        auto second = handler.serviceUnavailable();
+        THEN("Its 503 responses share their precomputed headers and content") {
+            REQUIRE(first.statusCode == Response::serviceUnavailable);
+            REQUIRE(first.headers.empty());
+            REQUIRE(first.serialized == second.serialized);
+            REQUIRE(first.serialized->headers.find("Retry-After: 3\r\n") != string::npos);
+            REQUIRE(first.serialized->content.find("503 Service Unavailable") != string::npos);
+        }
+        THEN("Its message refusing a connection is complete and closes it") {
+            auto message = handler.serviceUnavailableMessage();
+            REQUIRE(message.starts_with("HTTP/1.1 503 Service Unavailable\r\n"));
+            REQUIRE(message.find("Retry-After: 3\r\n") != string::npos);
+            REQUIRE(message.find("Connection: close\r\n\r\n") != string::npos);
+            REQUIRE(message.ends_with(first.serialized->content));
+        }
+    }
+}
+
 SCENARIO("RequestHandler on a HTTP GET") {
     GIVEN("A valid HTTP GET request on a compressed file with no supported encoding") {
         string input{"GET /compressed.txt HTTP/1.1\r\nUser-Agent: Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)\r\nHost: "
                      "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\n\r\n"};
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
         REQUIRE(request.completed());
         REQUIRE(request.uri == "/compressed.txt");
         REQUIRE(request.method == Request::Method::Get);
@@ -258,7 +431,8 @@ SCENARIO("RequestHandler on a HTTP GET") {
             auto response = handler.handleRequest(request);
 
             THEN("It should respond with a 'Variant Also Negotiates' http response") {
-                auto buffers = response.toBuffers<Net>();
+                string headerBlock;
+                auto buffers = response.toBuffers<Net>(headerBlock);
                 REQUIRE(compare(buffers[0], "HTTP/1.1 506 Variant Also Negotiates"));
             }
         }
@@ -268,7 +442,7 @@ SCENARIO("RequestHandler on a HTTP GET") {
         string input{"GET /compressed.txt HTTP/1.1\r\nUser-Agent: Mozilla / 4.0 (compatible; MSIE5.01; Windows NT)\r\nHost: "
                      "www.bernardlehacker.com\r\nConnection: Keep-Alive\r\nAccept-encoding: gzip, br, deflate\r\n\r\n"};
         Request request;
-        REQUIRE_NOTHROW(request.parseSomeData(input.cbegin(), input.cend()));
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
         REQUIRE(request.completed());
         REQUIRE(request.uri == "/compressed.txt");
         REQUIRE(request.method == Request::Method::Get);
@@ -284,3 +458,574 @@ SCENARIO("RequestHandler on a HTTP GET") {
         }
     }
 }
+
+/// Serves a single embedded 'hello.txt' file
+struct EmbeddedHelloFS {
+    EmbeddedHelloFS(filesystem::path) {}
+    struct Hello {
+        static constexpr size_t dataSize{14};
+        static constexpr array<uint8_t, 14> data{'H', 'e', 'l', 'l', 'o', ' ', 'W', 'e', 'b', 'F', 'r', 'o', 'n', 't'};
+    };
+    optional<fs::File> open(filesystem::path file) {
+        if (file.relative_path() == "hello.txt") return fs::File{Hello{}};
+        return {};
+    }
+};
+
+SCENARIO("RequestHandler on a HTTP GET of an embedded file") {
+    GIVEN("A RequestHandler serving embedded data, with a response cache") {
+        RequestHandler<Net, EmbeddedHelloFS> handler{".", 4096};
+        Request request;
+        REQUIRE(request.parse("GET /hello.txt HTTP/1.1\r\nHost: localhost\r\n\r\n") == Request::ParseResult::completed);
+
+        WHEN("the file is requested") {
+            auto response = handler.handleRequest(request);
+            THEN("the embedded bytes are sent without copy") {
+                REQUIRE(response.statusCode == Response::ok);
+                REQUIRE(response.getHeaderValue("Content-Length") == "14");
+                REQUIRE(response.content.empty());
+                string headerBlock;
+                auto buffers = response.toBuffers<Net>(headerBlock);
+                REQUIRE(buffers[1].data() == EmbeddedHelloFS::Hello::data.data());
+                REQUIRE(buffers[1].size() == 14);
+            }
+        }
+    }
+
+    GIVEN("A RequestHandler serving files embedded with their header lines") {
+        RequestHandler<Net, fs::IndexFS> handler{"."};
+        using Script = fs::IndexFS::WebFrontJs;
+
+        WHEN("a file is requested with GET") {
+            Request request;
+            REQUIRE(request.parse("GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n") == Request::ParseResult::completed);
+            auto response = handler.handleRequest(request);
+            THEN("the static header lines and content are sent") {
+                REQUIRE(response.statusCode == Response::ok);
+                REQUIRE(response.headers.empty());
+                string headerBlock;
+                auto buffers = response.toBuffers<Net>(headerBlock);
+                REQUIRE(headerBlock == "HTTP/1.1 200 OK\r\n" + string(fs::IndexFS::headersAt(2)) + "\r\n");
+                REQUIRE(headerBlock.find("Content-Length: 3501\r\n") != string::npos);
+                REQUIRE(buffers[1].data() == Script::data.data());
+                REQUIRE(buffers[1].size() == Script::dataSize);
+            }
+        }
+        WHEN("a file is requested with HEAD") {
+            Request request;
+            REQUIRE(request.parse("HEAD /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n") == Request::ParseResult::completed);
+            auto response = handler.handleRequest(request);
+            THEN("the same header lines are sent, without content") {
+                REQUIRE(response.statusCode == Response::ok);
+                REQUIRE(response.staticHeaders == fs::IndexFS::headersAt(2));
+                string headerBlock;
+                REQUIRE(response.toBuffers<Net>(headerBlock)[1].size() == 0);
+            }
+        }
+    }
+}
+
+namespace {
+/// Identity, br and gzip variants of 'page.html', gzip being the default one
+struct PageAssets {
+    static constexpr string_view encoding{"gzip"};
+    static constexpr string_view data{"<p>Page</p>" "PAGE.BR" "PAGE.GZ"};
+    static constexpr array<fs::EmbeddedAsset, 3> assets{
+      fs::EmbeddedAsset{"page.html", "", 0, 11, "\"e0\""},
+      fs::EmbeddedAsset{"page.html", "br", 11, 7, "\"e1\""},
+      fs::EmbeddedAsset{"page.html", "gzip", 18, 7, "\"e2\""},
+    };
+    static span<const byte> blob() { return as_bytes(span{data}); }
+};
+} // namespace
+
+SCENARIO("RequestHandler on a HTTP HEAD") {
+    auto root = filesystem::temp_directory_path() / ("webfront_head_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+    filesystem::create_directories(root);
+    ofstream(root / "hello.txt", ios::binary) << "Hello WebFront";
+    ofstream(root / "large.png", ios::binary) << string(300 * 1024, 'x');
+
+    auto handle = [](auto& handler, string_view method, string_view path) {
+        Request request;
+        string input = string(method) + " /" + string(path) + " HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+    auto headerBlockOf = [](const Response& response) {
+        string headerBlock;
+        [[maybe_unused]] auto buffers = response.toBuffers<Net>(headerBlock);
+        return headerBlock;
+    };
+    {
+        RequestHandler<Net, fs::Multi<fs::NativeMappedFS, fs::IndexFS>> handler{root};
+        WHEN("an embedded file is requested with HEAD before any GET") {
+            auto head = handle(handler, "HEAD", "WebFront.js");
+            auto get = handle(handler, "GET", "WebFront.js");
+            auto warmHead = handle(handler, "HEAD", "WebFront.js");
+            THEN("the header lines of the GET response are sent, without content") {
+                REQUIRE(head.statusCode == Response::ok);
+                REQUIRE(headerBlockOf(head) == headerBlockOf(get));
+                REQUIRE(headerBlockOf(head).find("Content-Length: 3501\r\n") != string::npos);
+                string headerBlock;
+                REQUIRE(head.toBuffers<Net>(headerBlock)[1].size() == 0);
+                REQUIRE(headerBlockOf(warmHead) == headerBlockOf(get));
+            }
+        }
+        WHEN("native files are requested with HEAD") {
+            THEN("the headers of the GET response, size and validators included, are sent without content") {
+                for (string_view path : {"hello.txt", "large.png"}) {
+                    auto head = handle(handler, "HEAD", path);
+                    auto get = handle(handler, "GET", path);
+                    REQUIRE(head.statusCode == Response::ok);
+                    REQUIRE(headerBlockOf(head) == headerBlockOf(get));
+                    REQUIRE(head.getHeaderValue("Content-Length") == to_string(filesystem::file_size(root / path)));
+                    REQUIRE(head.getHeaderValue("ETag"));
+                    REQUIRE(head.getHeaderValue("Last-Modified"));
+                    REQUIRE(head.contentSize() == 0);
+                    REQUIRE(!head.fileDescriptor);
+                }
+            }
+        }
+    }
+    auto negotiate = [](auto& handler, string_view method, string_view fields) {
+        Request request;
+        string input = string(method) + " /page.html HTTP/1.1\r\nAccept-Encoding: br, gzip\r\n" + string(fields) + "\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+    {
+        RequestHandler<Net, fs::EmbeddedFS<PageAssets>> handler{root};
+        WHEN("an embedded file having br and gzip variants is requested with HEAD by a client preferring br") {
+            auto head = negotiate(handler, "HEAD", "");
+            auto get = negotiate(handler, "GET", "");
+            auto conditional = negotiate(handler, "HEAD", "If-None-Match: \"e1\"\r\n");
+            THEN("the header lines of the variant negotiated by GET are sent, its ETag being matched") {
+                REQUIRE(headerBlockOf(head) == headerBlockOf(get));
+                REQUIRE(head.staticHeaders.find("Content-Encoding: br\r\n") != string_view::npos);
+                REQUIRE(head.staticHeaders.find("ETag: \"e1\"\r\n") != string_view::npos);
+                REQUIRE(conditional.statusCode == Response::notModified);
+            }
+        }
+    }
+    {
+        RequestHandler<Net, fs::Multi<fs::NativeMappedFS, fs::EmbeddedFS<PageAssets>>> handler{root};
+        WHEN("it is requested with HEAD through a Multi, before and after a GET") {
+            auto head = negotiate(handler, "HEAD", "");
+            auto get = negotiate(handler, "GET", "");
+            auto warmHead = negotiate(handler, "HEAD", "");
+            THEN("the header lines of the variant negotiated by GET are sent") {
+                REQUIRE(headerBlockOf(head) == headerBlockOf(get));
+                REQUIRE(headerBlockOf(warmHead) == headerBlockOf(get));
+                REQUIRE(warmHead.staticHeaders.find("Content-Encoding: br\r\n") != string_view::npos);
+            }
+        }
+    }
+    filesystem::remove_all(root);
+}
+
+SCENARIO("RequestHandler routing requests to C++ handlers") {
+    GIVEN("A RequestHandler with routes, serving embedded files") {
+        RequestHandler<Net, EmbeddedHelloFS> handler{"."};
+        handler.route(Request::Method::Get, "/api/items/{id}", [](const Request&, const RouteParameters& route) {
+            return Response::getContentResponse(Response::ok, "{\"id\":" + string(*route["id"]) + ",\"sort\":\"" + string(*route.queryValue("sort")) + "\"}",
+                                                "application/json");
+        });
+        handler.route(Request::Method::Delete, "/api/items/{id}", [](const Request&, const RouteParameters&) {
+            Response response;
+            response.statusCode = Response::noContent;
+            return response;
+        });
+        handler.route(Request::Method::Post, "/api/fail", [](const Request&, const RouteParameters&) -> Response { throw runtime_error("failure"); });
+        auto handle = [&handler](string input) {
+            Request request;
+            REQUIRE(request.parse(input) == Request::ParseResult::completed);
+            return handler.handleRequest(request);
+        };
+
+        WHEN("Routed requests are received") {
+            auto item = handle("GET /api/items/42?sort=name HTTP/1.1\r\n\r\n");
+            auto head = handle("HEAD /api/items/42?sort=name HTTP/1.1\r\n\r\n");
+            auto removed = handle("DELETE /api/items/42 HTTP/1.1\r\n\r\n");
+            THEN("Their handlers respond, with the Content-Length of their content") {
+                REQUIRE(item.statusCode == Response::ok);
+                REQUIRE(item.content == R"({"id":42,"sort":"name"})");
+                REQUIRE(item.getHeaderValue("Content-Type") == "application/json");
+                REQUIRE(item.getHeaderValue("Content-Length") == "23");
+                REQUIRE(head.statusCode == Response::ok);
+                REQUIRE(head.content.empty());
+                REQUIRE(head.getHeaderValue("Content-Length") == "23");
+                REQUIRE(removed.statusCode == Response::noContent);
+                REQUIRE(!removed.getHeaderValue("Content-Length"));
+                string headerBlock;
+                REQUIRE(compare(removed.toBuffers<Net>(headerBlock)[0], "HTTP/1.1 204 No Content\r\n\r\n"));
+            }
+        }
+
+        WHEN("A routed path is requested with another method") {
+            auto response = handle("PUT /api/items/42 HTTP/1.1\r\n\r\n");
+            THEN("It is answered 405 with the allowed methods") {
+                REQUIRE(response.statusCode == Response::methodNotAllowed);
+                REQUIRE(response.getHeaderValue("Allow") == "DELETE, GET, HEAD");
+            }
+        }
+
+        WHEN("A handler throws") {
+            THEN("It is answered 500") { REQUIRE(handle("POST /api/fail HTTP/1.1\r\n\r\n").statusCode == Response::internalServerError); }
+        }
+
+        WHEN("Paths which are not routed are requested") {
+            THEN("They are served by the file system") {
+                REQUIRE(handle("GET /hello.txt HTTP/1.1\r\n\r\n").statusCode == Response::ok);
+                REQUIRE(handle("GET /api/items HTTP/1.1\r\n\r\n").statusCode == Response::notFound);
+                REQUIRE(handle("PUT /hello.txt HTTP/1.1\r\n\r\n").statusCode == Response::notImplemented);
+            }
+        }
+    }
+}
+
+SCENARIO("RequestHandler on a HTTP GET with a Range") {
+    auto get = [](auto& handler, string_view headers) {
+        Request request;
+        string input = "GET /hello.txt HTTP/1.1\r\n" + string(headers) + "\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+    auto body = [](const Response& response) {
+        string headerBlock;
+        auto buffers = response.toBuffers<Net>(headerBlock);
+        return string(static_cast<const char*>(buffers[1].data()), buffers[1].size());
+    };
+
+    GIVEN("A RequestHandler serving an embedded file, with a response cache") {
+        RequestHandler<Net, EmbeddedHelloFS> handler{".", 4096};
+        REQUIRE(get(handler, "").getHeaderValue("Accept-Ranges") == "bytes");
+
+        WHEN("a single range is requested") {
+            auto response = get(handler, "Range: bytes=6-\r\n");
+            THEN("the part of the file is sent without copy in a 206 response") {
+                REQUIRE(response.statusCode == Response::partialContent);
+                REQUIRE(response.getHeaderValue("Content-Range") == "bytes 6-13/14");
+                REQUIRE(response.getHeaderValue("Content-Length") == "8");
+                REQUIRE(response.getHeaderValue("Content-Type") == "text/plain");
+                REQUIRE(response.fileContent.data() == reinterpret_cast<const byte*>(EmbeddedHelloFS::Hello::data.data() + 6));
+                REQUIRE(body(response) == "WebFront");
+            }
+        }
+        WHEN("several ranges are requested") {
+            auto response = get(handler, "Range: bytes=0-4, -5\r\n");
+            THEN("they are sent as a multipart/byteranges body") {
+                REQUIRE(response.statusCode == Response::partialContent);
+                auto contentType = string(*response.getHeaderValue("Content-Type"));
+                REQUIRE(contentType.starts_with("multipart/byteranges; boundary="));
+                auto boundary = contentType.substr(contentType.find('=') + 1);
+                REQUIRE(body(response) == "\r\n--" + boundary + "\r\nContent-Type: text/plain\r\nContent-Range: bytes 0-4/14\r\n\r\nHello" +
+                                          "\r\n--" + boundary + "\r\nContent-Type: text/plain\r\nContent-Range: bytes 9-13/14\r\n\r\nFront" +
+                                          "\r\n--" + boundary + "--\r\n");
+                REQUIRE(response.getHeaderValue("Content-Length") == to_string(body(response).size()));
+            }
+        }
+        WHEN("a range beyond the end of the file is requested") {
+            auto response = get(handler, "Range: bytes=14-\r\n");
+            THEN("it is not satisfiable") {
+                REQUIRE(response.statusCode == Response::rangeNotSatisfiable);
+                REQUIRE(response.getHeaderValue("Content-Range") == "bytes */14");
+            }
+        }
+        WHEN("an invalid range or an If-Range precondition is received") {
+            THEN("the whole file is sent") {
+                REQUIRE(get(handler, "Range: bytes=9-4\r\n").statusCode == Response::ok);
+                REQUIRE(get(handler, "Range: bytes=0-4\r\nIf-Range: \"abc\"\r\n").statusCode == Response::ok);
+            }
+        }
+    }
+
+    GIVEN("A RequestHandler serving files embedded with their header lines") {
+        RequestHandler<Net, fs::IndexFS> handler{"."};
+        Request request;
+        REQUIRE(request.parse("GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nRange: bytes=100-199\r\n\r\n") ==
+                Request::ParseResult::completed);
+        auto response = handler.handleRequest(request);
+        THEN("the static header lines but Content-Length describe the range") {
+            REQUIRE(response.statusCode == Response::partialContent);
+            REQUIRE(response.getHeaderValue("Content-Length") == "100");
+            REQUIRE(response.getHeaderValue("Content-Range") == "bytes 100-199/3501");
+            REQUIRE(!response.staticHeaders.starts_with("Content-Length"));
+            REQUIRE(response.staticHeaders.find("Content-Encoding: gzip\r\n") != string_view::npos);
+            REQUIRE(response.staticHeaders.find("ETag: ") != string_view::npos);
+            REQUIRE(response.fileContent.size() == 100);
+        }
+    }
+}
+
+SCENARIO("RequestHandler negotiating the content coding") {
+    auto get = [](auto& handler, string_view acceptEncoding) {
+        Request request;
+        string input = "GET /WebFront.js HTTP/1.1\r\n" + string(acceptEncoding) + "\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+    using Script = fs::IndexFS::WebFrontJs;
+
+    GIVEN("A RequestHandler serving a gzip encoded file") {
+        RequestHandler<Net, fs::IndexFS> handler{"."};
+
+        WHEN("a client accepting gzip requests it") {
+            auto response = get(handler, "Accept-Encoding: br;q=1.0, gzip;q=0.8\r\n");
+            THEN("the encoded file is sent, its header lines listing Vary") {
+                REQUIRE(response.statusCode == Response::ok);
+                REQUIRE(response.fileContent.data() == reinterpret_cast<const byte*>(Script::data.data()));
+                REQUIRE(response.staticHeaders.find("Vary: Accept-Encoding\r\n") != string_view::npos);
+            }
+        }
+        WHEN("clients not accepting gzip request it") {
+            auto first = get(handler, "");
+            auto second = get(handler, "Accept-Encoding: br, gzip;q=0\r\n");
+            THEN("the file is decoded once and sent as identity, instead of a 506 response") {
+                REQUIRE(first.statusCode == Response::ok);
+                REQUIRE(!first.getHeaderValue("Content-Encoding"));
+                REQUIRE(first.getHeaderValue("Content-Length") == "14857");
+                REQUIRE(first.getHeaderValue("Vary") == "Accept-Encoding");
+                REQUIRE(first.getHeaderValue("ETag") == "\"92944065c2d1dd6f-identity\"");
+                auto content = string_view(reinterpret_cast<const char*>(first.fileContent.data()), first.fileContent.size());
+                REQUIRE(content.starts_with("/// @date 27/01/2022 22:41:42"));
+                REQUIRE(second.fileContent.data() == first.fileContent.data());
+            }
+        }
+        WHEN("the decoded file is requested with its entity tag") {
+            auto response = get(handler, "If-None-Match: \"92944065c2d1dd6f-identity\"\r\n");
+            THEN("a 304 response listing Vary is sent") {
+                REQUIRE(response.statusCode == Response::notModified);
+                REQUIRE(response.getHeaderValue("Vary") == "Accept-Encoding");
+            }
+        }
+    }
+
+    GIVEN("A RequestHandler serving a brotli encoded file") {
+        RequestHandler<Net, MockFileSystem<ResourceAndFile>> handler{"."};
+        Request request;
+        REQUIRE(request.parse("GET /compressed.txt HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n") == Request::ParseResult::completed);
+        THEN("a client not accepting br gets a 506 response, brotli not being decoded") {
+            REQUIRE(handler.handleRequest(request).statusCode == Response::variantAlsoNegotiates);
+        }
+    }
+}
+
+SCENARIO("RequestHandler compressing the native files") {
+    auto root = filesystem::temp_directory_path() / ("webfront_compression_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+    filesystem::create_directories(root);
+    auto write = [&](const string& name, const string& content) { ofstream(root / name, ios::binary) << content; };
+    string script, style;
+    for (int index = 0; index < 200; ++index) script += "console.log('WebFront " + to_string(index) + "');\n";
+    for (int index = 0; index < 50; ++index) style += ".row" + to_string(index) + " { display: flex; }\n";
+    write("app.js", script);
+    write("logo.png", script);
+    write("style.css", style);
+    write("style.css.gz", utils::gzip(as_bytes(span{style})));
+
+    auto get = [](auto& handler, const string& path, string_view acceptEncoding) {
+        Request request;
+        string input = "GET /" + path + " HTTP/1.1\r\n" + string(acceptEncoding) + "\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+    auto body = [](const Response& response) {
+        if (response.serialized) return response.serialized->content;
+        if (response.fileContent.empty()) return string(response.content);
+        return string(reinterpret_cast<const char*>(response.fileContent.data()), response.fileContent.size());
+    };
+    {
+        RequestHandler<Net, fs::NativeDebugFS> handler{root};
+        WHEN("a client accepting gzip requests a compressible file without precompressed sibling") {
+            auto first = get(handler, "app.js", "Accept-Encoding: gzip, deflate\r\n");
+            auto response = first;
+            for (auto deadline = chrono::steady_clock::now() + chrono::seconds(5);
+                 !response.getHeaderValue("Content-Encoding") && chrono::steady_clock::now() < deadline;) {
+                this_thread::sleep_for(chrono::milliseconds(1));
+                response = get(handler, "app.js", "Accept-Encoding: gzip, deflate\r\n");
+            }
+            THEN("it is sent as is while being compressed in the background, then its gzip variant is sent") {
+                REQUIRE(!first.getHeaderValue("Content-Encoding"));
+                REQUIRE(first.getHeaderValue("Vary") == "Accept-Encoding");
+                REQUIRE(response.getHeaderValue("Content-Encoding") == "gzip");
+                REQUIRE(response.getHeaderValue("Vary") == "Accept-Encoding");
+                REQUIRE(response.getHeaderValue("ETag")->ends_with("-gzip\""));
+                REQUIRE(response.getHeaderValue("Last-Modified") == first.getHeaderValue("Last-Modified"));
+                auto compressed = body(response);
+                REQUIRE(compressed.size() < script.size() / 4);
+                REQUIRE(utils::gunzip(as_bytes(span{compressed})) == script);
+                REQUIRE(get(handler, "app.js", "Accept-Encoding: gzip\r\n").fileContent.data() == response.fileContent.data());
+            }
+            AND_THEN("a client not accepting gzip still gets the file as is") {
+                auto plain = get(handler, "app.js", "");
+                REQUIRE(!plain.getHeaderValue("Content-Encoding"));
+                REQUIRE(body(plain) == script);
+            }
+        }
+        WHEN("a file of a compressed type is requested") {
+            auto response = get(handler, "logo.png", "Accept-Encoding: gzip\r\n");
+            THEN("it is sent as is, not varying") {
+                REQUIRE(!response.getHeaderValue("Content-Encoding"));
+                REQUIRE(!response.getHeaderValue("Vary"));
+            }
+        }
+        WHEN("a file having a precompressed sibling is requested") {
+            auto gzipped = get(handler, "style.css", "Accept-Encoding: br, gzip\r\n");
+            auto plain = get(handler, "style.css", "");
+            THEN("the sibling is sent to the clients accepting its coding") {
+                REQUIRE(gzipped.getHeaderValue("Content-Encoding") == "gzip");
+                REQUIRE(gzipped.getHeaderValue("Content-Type") == "text/css");
+                auto sibling = body(gzipped);
+                REQUIRE(utils::gunzip(as_bytes(span{sibling})) == style);
+                REQUIRE(!plain.getHeaderValue("Content-Encoding"));
+                REQUIRE(body(plain) == style);
+            }
+        }
+    }
+    {
+        write("page.html", "<p>" + style + "</p>");
+        write("page.html.br", "PAGE.BR");
+        write("page.html.gz", "PAGE.GZ");
+        RequestHandler<Net, fs::NativeDebugFS> handler{root, 64 * 1024};
+        WHEN("clients preferring br and clients accepting gzip only alternately request a file having both precompressed siblings") {
+            vector<Response> brotli, gzipped;
+            for (size_t round = 0; round < 3; ++round) {
+                brotli.push_back(get(handler, "page.html", "Accept-Encoding: br, gzip\r\n"));
+                gzipped.push_back(get(handler, "page.html", "Accept-Encoding: gzip\r\n"));
+            }
+            THEN("each one gets the variant of its coding, from the cache once it has been requested") {
+                for (size_t round = 0; round < 3; ++round) {
+                    REQUIRE(body(brotli[round]) == "PAGE.BR");
+                    REQUIRE(body(gzipped[round]) == "PAGE.GZ");
+                    REQUIRE((brotli[round].serialized != nullptr) == (round > 0));
+                    REQUIRE((gzipped[round].serialized != nullptr) == (round > 0));
+                }
+            }
+        }
+        WHEN("clients preferring br request a file having a gzip sibling only") {
+            auto first = get(handler, "style.css", "Accept-Encoding: br, gzip\r\n");
+            auto second = get(handler, "style.css", "Accept-Encoding: br, gzip\r\n");
+            auto gzipOnly = get(handler, "style.css", "Accept-Encoding: gzip\r\n");
+            THEN("the gzip variant is cached for them as for the clients accepting gzip only") {
+                REQUIRE(first.getHeaderValue("Content-Encoding") == "gzip");
+                REQUIRE(!first.serialized);
+                REQUIRE(second.serialized);
+                REQUIRE(gzipOnly.serialized == second.serialized);
+            }
+        }
+    }
+    filesystem::remove_all(root);
+}
+
+/// WatchableFileSystem whose files have a modification time, as native ones
+struct ModifiedFileSystem : WatchableFileSystem {
+    using WatchableFileSystem::WatchableFileSystem;
+    optional<fs::File> open(filesystem::path file) {
+        auto opened = WatchableFileSystem::open(file);
+        if (opened) opened->setModified(modified);
+        return opened;
+    }
+    inline static const chrono::sys_seconds modified{chrono::sys_days{chrono::October / 17 / 2026}};
+};
+
+SCENARIO("RequestHandler on a conditional HTTP GET") {
+    auto handle = [](auto& handler, string_view requestLines) {
+        Request request;
+        string input = string(requestLines) + "\r\n";
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        return handler.handleRequest(request);
+    };
+
+    GIVEN("A RequestHandler serving embedded files with a cache policy") {
+        constexpr string_view eTag{"\"92944065c2d1dd6f\""}; // fs::IndexFS::WebFrontJs
+        RequestHandler<Net, fs::IndexFS> handler{".", 0, CachePolicy{"public, max-age=31536000, immutable", "no-cache"}};
+
+        WHEN("a file is requested without precondition") {
+            auto response = handle(handler, "GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\n");
+            THEN("its ETag and the embedded files policy are sent") {
+                REQUIRE(response.statusCode == Response::ok);
+                string headerBlock;
+                [[maybe_unused]] auto buffers = response.toBuffers<Net>(headerBlock);
+                REQUIRE(headerBlock.find("ETag: " + string(eTag) + "\r\n") != string::npos);
+                REQUIRE(headerBlock.ends_with("Cache-Control: public, max-age=31536000, immutable\r\n\r\n"));
+            }
+        }
+        WHEN("the client's copy has the same entity tag") {
+            auto get = handle(handler, "GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: \"stale\", " + string(eTag) + "\r\n");
+            auto head = handle(handler, "HEAD /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: " + string(eTag) + "\r\n");
+            THEN("a 304 response without content is sent") {
+                for (auto& response : {get, head}) {
+                    REQUIRE(response.statusCode == Response::notModified);
+                    REQUIRE(response.getHeaderValue("ETag") == eTag);
+                    REQUIRE(!response.getHeaderValue("Content-Length"));
+                    string headerBlock;
+                    REQUIRE(response.toBuffers<Net>(headerBlock)[1].size() == 0);
+                    REQUIRE(headerBlock == "HTTP/1.1 304 Not Modified\r\nETag: " + string(eTag) + "\r\nVary: Accept-Encoding" +
+                                             "\r\nCache-Control: public, max-age=31536000, immutable\r\n\r\n");
+                }
+            }
+        }
+        WHEN("the client's copy has another entity tag") {
+            auto response = handle(handler, "GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: \"stale\"\r\n");
+            THEN("the file is sent") { REQUIRE(response.statusCode == Response::ok); }
+        }
+        WHEN("a range is requested with an If-Range precondition") {
+            auto range = "GET /WebFront.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nRange: bytes=0-99\r\nIf-Range: "s;
+            THEN("the range is sent if the entity tag strongly matches, the whole file otherwise") {
+                REQUIRE(handle(handler, range + string(eTag) + "\r\n").statusCode == Response::partialContent);
+                REQUIRE(handle(handler, range + "W/" + string(eTag) + "\r\n").statusCode == Response::ok);
+                REQUIRE(handle(handler, range + "\"stale\"\r\n").statusCode == Response::ok);
+            }
+        }
+    }
+
+    GIVEN("A RequestHandler caching the responses of files having a modification time") {
+        RequestHandler<Net, ModifiedFileSystem> handler{".", 4096, CachePolicy{"", "no-cache"}};
+        auto first = handle(handler, "GET /file.txt HTTP/1.1\r\nAccept-Encoding: br\r\n");
+        auto openings = ModifiedFileSystem::openingsCounter;
+        auto lastModified = toHTTPDate(ModifiedFileSystem::modified);
+        REQUIRE(first.getHeaderValue("Last-Modified") == lastModified);
+        auto eTag = string(*first.getHeaderValue("ETag"));
+
+        WHEN("the file is requested again with the validators received") {
+            auto sameETag = handle(handler, "GET /file.txt HTTP/1.1\r\nAccept-Encoding: br\r\nIf-None-Match: " + eTag + "\r\n");
+            auto sameDate = handle(handler, "GET /file.txt HTTP/1.1\r\nAccept-Encoding: br\r\nIf-Modified-Since: " + lastModified + "\r\n");
+            THEN("a 304 response is built from the cached validators, without opening the file") {
+                REQUIRE(ModifiedFileSystem::openingsCounter == openings);
+                REQUIRE(sameETag.statusCode == Response::notModified);
+                REQUIRE(sameETag.getHeaderValue("ETag") == eTag);
+                REQUIRE(sameETag.cacheControl == "Cache-Control: no-cache\r\n");
+                REQUIRE(sameDate.statusCode == Response::notModified);
+            }
+        }
+        WHEN("the client's copy is older than the file") {
+            auto response = handle(handler, "GET /file.txt HTTP/1.1\r\nAccept-Encoding: br\r\nIf-Modified-Since: Fri, 16 Oct 2026 00:00:00 GMT\r\n");
+            THEN("the cached response is sent") {
+                REQUIRE(response.statusCode == Response::ok);
+                REQUIRE(response.serialized);
+                REQUIRE(response.serialized->headers.find("Cache-Control: no-cache\r\n") != string::npos);
+            }
+        }
+    }
+}
+
+SCENARIO("HTTP scanner") {
+    GIVEN("Texts longer than the SIMD registers") {
+        string text(100, 'a');
+        THEN("The first control character is found whatever its position") {
+            REQUIRE(scanner::findControl(text) == string_view::npos);
+            for (size_t position : std::initializer_list<size_t>{0, 15, 16, 31, 32, 47, 70, 99}) {
+                auto withControl = text;
+                withControl[position] = '\r';
+                withControl[99] = '\x7f';
+                REQUIRE(scanner::findControl(withControl) == position);
+            }
+            text[40] = '\x80';
+            REQUIRE(scanner::findControl(text) == string_view::npos);
+        }
+    }
+    GIVEN("Tokens") {
+        REQUIRE(scanner::isToken("Accept-Encoding"));
+        REQUIRE(!scanner::isToken("Accept Encoding"));
+        REQUIRE(!scanner::isToken(""));
+    }
+}
@@ -0,0 +1,31 @@
+#include <http/HeaderField.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+using namespace webfront::http;
+
+SCENARIO("HeaderFields") {
+    static_assert(HeaderField("Connection") == HeaderField::connection);
+
+    REQUIRE(HeaderField::fromName("Accept-Encoding") == HeaderField::acceptEncoding);
+    REQUIRE(HeaderField::fromName("accept-encoding") == HeaderField::acceptEncoding);
+    REQUIRE(HeaderField::fromName("SEC-WEBSOCKET-KEY") == HeaderField::secWebSocketKey);
+    REQUIRE(HeaderField::fromName("If-None-Match") == HeaderField::ifNoneMatch);
+    REQUIRE(HeaderField::fromName("Range") == HeaderField::range);
+    REQUIRE(HeaderField::fromName("http2-settings") == HeaderField::http2Settings);
+
+    REQUIRE(HeaderField::fromName("X-Requested-With") == HeaderField::unknown);
+    REQUIRE(HeaderField::fromName("Rang") == HeaderField::unknown);
+    REQUIRE(HeaderField::fromName("Range ") == HeaderField::unknown);
+    REQUIRE(HeaderField::fromName("") == HeaderField::unknown);
+    REQUIRE(!HeaderField("Bozo").isKnown());
+
+    for (uint8_t id = 0; id < HeaderField::count; ++id) {
+        HeaderField field{static_cast<HeaderField::Id>(id)};
+        REQUIRE(HeaderField::fromName(field.toString()) == field);
+    }
+    REQUIRE(std::string(HeaderField(HeaderField::userAgent).toString()) == "User-Agent");
+    REQUIRE(HeaderField(HeaderField::unknown).toString().empty());
+}
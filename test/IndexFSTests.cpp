@@ -31,6 +31,18 @@ SCENARIO("IndexFileSystem provides basic files for browser support") {
             }
         }
 
+        WHEN("Requesting WebFront.js") {
+            auto script = FS::open("/WebFront.js");
+            THEN("its header lines are built at compile time") {
+                REQUIRE(script.has_value());
+                STATIC_REQUIRE(FS::headersAt(2).starts_with("Content-Length: 3501\r\nContent-Type: application/javascript\r\nContent-Encoding: gzip\r\n"));
+                REQUIRE(script->headers() == FS::headersAt(2));
+                REQUIRE(script->headers().ends_with("ETag: \"92944065c2d1dd6f\"\r\nAccept-Ranges: bytes\r\n"));
+                REQUIRE(fs::headersOf(FS{"."}, "WebFront.js") == FS::headersAt(2));
+                REQUIRE_FALSE(fs::headersOf(FS{"."}, "missing.js").has_value());
+            }
+        }
+
         WHEN("Requesting favicon.ico") {
             auto faviconFile = FS::open("favicon.ico");
             THEN("correct data is returned") {
@@ -0,0 +1,62 @@
+#include <system/IndexFS.hpp>
+#include <utils/Inflate.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+using namespace std;
+using namespace webfront;
+
+namespace {
+template<size_t N>
+span<const byte> bytesOf(const array<uint8_t, N>& data) {
+    return as_bytes(span{data});
+}
+} // namespace
+
+SCENARIO("Inflate") {
+    GIVEN("\"Hello WebFront\" compressed with gzip") {
+        static constexpr array<uint8_t, 34> fixedHuffman{31, 139, 8, 0, 0, 0, 0, 0, 2, 3, 243, 72, 205, 201, 201, 87, 8,
+                                                         79, 77,  114, 43, 202, 207, 43, 1, 0, 70, 140, 69, 95, 14, 0, 0, 0};
+        static constexpr array<uint8_t, 37> stored{31, 139, 8, 0, 0, 0, 0, 0, 4, 3, 1, 14, 0, 241, 255, 72, 101, 108, 108,
+                                                   111, 32, 87, 101, 98, 70, 114, 111, 110, 116, 70, 140, 69, 95, 14, 0, 0, 0};
+        THEN("Fixed Huffman codes and stored blocks are decoded") {
+            REQUIRE(utils::gunzip(bytesOf(fixedHuffman)) == "Hello WebFront");
+            REQUIRE(utils::gunzip(bytesOf(stored)) == "Hello WebFront");
+        }
+        THEN("A corrupted member, a truncated one or an output larger than the limit are rejected") {
+            auto corrupted = fixedHuffman;
+            corrupted[12] ^= 0x10;
+            REQUIRE_FALSE(utils::gunzip(bytesOf(corrupted)).has_value());
+            REQUIRE_FALSE(utils::gunzip(bytesOf(fixedHuffman).first(30)).has_value());
+            REQUIRE_FALSE(utils::gunzip(bytesOf(fixedHuffman), 10).has_value());
+            REQUIRE_FALSE(utils::gunzip(bytesOf(fixedHuffman).subspan(10)).has_value());
+        }
+    }
+
+    GIVEN("A zlib stream with back references") {
+        static constexpr array<uint8_t, 20> zlibbed{120, 218, 11, 79, 77, 114, 43, 202, 207, 43, 81, 8, 199, 201, 0, 0, 231, 69, 12, 253};
+        THEN("It is decoded and its Adler-32 checked") {
+            REQUIRE(utils::unzlib(bytesOf(zlibbed)) == "WebFront WebFront WebFront WebFront");
+            REQUIRE(utils::inflate(bytesOf(zlibbed).subspan(2)) == "WebFront WebFront WebFront WebFront");
+            auto corrupted = zlibbed;
+            corrupted[19] ^= 1;
+            REQUIRE_FALSE(utils::unzlib(bytesOf(corrupted)).has_value());
+        }
+    }
+
+    GIVEN("A script gzipped with dynamic Huffman codes and a file name") {
+        using Script = fs::IndexFS::WebFrontJs;
+        auto script = utils::gunzip(as_bytes(span{Script::data}).first(Script::dataSize));
+        THEN("It is decoded") {
+            REQUIRE(script.has_value());
+            REQUIRE(script->size() == 14857);
+            REQUIRE(script->starts_with("/// @date 27/01/2022 22:41:42\r\n/// @author Ambroise Leclerc\r\n"));
+        }
+    }
+}
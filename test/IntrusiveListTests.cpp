@@ -0,0 +1,76 @@
+#include <utils/IntrusiveList.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace webfront;
+
+namespace {
+
+struct Item : utils::IntrusiveList<Item>::Hook {
+    explicit Item(int itemValue) : value(itemValue) {}
+    int value;
+};
+
+vector<int> values(utils::IntrusiveList<Item>& list) {
+    vector<int> linked;
+    list.forEach([&linked](Item& item) { linked.push_back(item.value); });
+    return linked;
+}
+
+} // namespace
+
+SCENARIO("IntrusiveList") {
+    GIVEN("A list of three items") {
+        utils::IntrusiveList<Item> list;
+        Item first(1), second(2), third(3);
+        list.pushBack(first);
+        list.pushBack(second);
+        list.pushBack(third);
+        REQUIRE(values(list) == vector{1, 2, 3});
+        REQUIRE(list.size() == 3);
+
+        WHEN("An item is erased") {
+            list.erase(second);
+            list.erase(second);
+            THEN("It is unlinked once, the others keep their order") {
+                REQUIRE(!second.linked());
+                REQUIRE(values(list) == vector{1, 3});
+                REQUIRE(list.size() == 2);
+            }
+        }
+
+        WHEN("An item of the list is pushed again") {
+            list.pushBack(first);
+            THEN("It is moved to the end") {
+                REQUIRE(values(list) == vector{2, 3, 1});
+                REQUIRE(list.size() == 3);
+            }
+        }
+
+        WHEN("An item is destroyed") {
+            {
+                Item temporary(4);
+                list.pushBack(temporary);
+                REQUIRE(list.size() == 4);
+            }
+            list.erase(third);
+            THEN("It has unlinked itself") {
+                REQUIRE(values(list) == vector{1, 2});
+                REQUIRE(list.size() == 2);
+            }
+        }
+
+        WHEN("The list is cleared") {
+            list.clear();
+            THEN("All the items are unlinked") {
+                REQUIRE(list.empty());
+                REQUIRE(list.size() == 0);
+                REQUIRE(!first.linked());
+                REQUIRE(!third.linked());
+            }
+        }
+    }
+}
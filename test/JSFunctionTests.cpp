@@ -48,7 +48,11 @@ struct WebLinkMock {
 
 struct WebFrontMock {
     using Net = networking::NetworkingMock;
-    WebLinkMock<WebFrontMock> getLink(WebLinkId id) { return WebLinkMock<WebFrontMock>{id, *this}; }
+    bool withLink(WebLinkId id, auto task) {
+        WebLinkMock<WebFrontMock> link{id, *this};
+        task(link);
+        return true;
+    }
 };
 
 SCENARIO("JsFunction") {
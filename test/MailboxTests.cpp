@@ -0,0 +1,73 @@
+#include <utils/Mailbox.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace webfront;
+
+SCENARIO("Mailbox") {
+    GIVEN("A mailbox") {
+        utils::Mailbox<> mailbox;
+        vector<int> run;
+
+        WHEN("Tasks are pushed by a single thread") {
+            auto firstWakesUp = mailbox.push([&] { run.push_back(1); });
+            auto secondWakesUp = mailbox.push([&] { run.push_back(2); });
+            THEN("The first push wakes the consumer up, which runs them in order") {
+                REQUIRE(firstWakesUp);
+                REQUIRE(!secondWakesUp);
+                REQUIRE(mailbox.drain() == 2);
+                REQUIRE(run == vector{1, 2});
+                REQUIRE(mailbox.drain() == 0);
+                REQUIRE(mailbox.push([&] { run.push_back(3); })); // Drained : the next push wakes it up again
+            }
+        }
+
+        WHEN("A task pushes another one") {
+            mailbox.push([&] { mailbox.push([&] { run.push_back(2); }); run.push_back(1); });
+            THEN("It is run by the same drain") {
+                REQUIRE(mailbox.drain() == 2);
+                REQUIRE(run == vector{1, 2});
+            }
+        }
+
+        WHEN("Tasks are left in the mailbox") {
+            auto owner = make_shared<int>(0);
+            mailbox.push([owner] {});
+            THEN("They are released without being run") { REQUIRE(owner.use_count() == 2); }
+        }
+    }
+
+    GIVEN("Producers pushing concurrently to a consumer draining when woken up") {
+        constexpr size_t producersCount = 4, tasksCount = 20000;
+        utils::Mailbox<> mailbox;
+        vector<vector<size_t>> received(producersCount);
+        atomic<size_t> wakeUps{0};
+        {
+            vector<jthread> producers;
+            for (size_t producer = 0; producer < producersCount; ++producer)
+                producers.emplace_back([&, producer] {
+                    for (size_t index = 0; index < tasksCount; ++index)
+                        if (mailbox.push([&, producer, index] { received[producer].push_back(index); })) ++wakeUps;
+                });
+            jthread consumer([&](stop_token stop) {
+                while (!stop.stop_requested()) mailbox.drain();
+            });
+        }
+        mailbox.drain();
+        THEN("Every task is run once, in the order of its producer") {
+            vector<size_t> inOrder(tasksCount);
+            iota(inOrder.begin(), inOrder.end(), 0);
+            for (auto& tasks : received) REQUIRE(tasks == inOrder);
+            REQUIRE(wakeUps > 0);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include <utils/MemoryBudget.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+using namespace std;
+using namespace webfront;
+using Budget = utils::MemoryBudget;
+
+SCENARIO("MemoryBudget") {
+    GIVEN("A budget of 1000 bytes and two accounts, one of them limited to 600 bytes") {
+        Budget budget(1000);
+        Budget::Account limited(&budget, 600);
+        Budget::Account unlimited(&budget);
+
+        WHEN("Bytes are reserved within the limits") {
+            REQUIRE(limited.reserve(400));
+            REQUIRE(unlimited.reserve(300));
+            THEN("They are accounted by the account and the budget") {
+                REQUIRE(limited.used() == 400);
+                REQUIRE(unlimited.used() == 300);
+                REQUIRE(budget.used() == 700);
+                REQUIRE(budget.available() == 300);
+            }
+            THEN("A reservation exceeding the account is refused without being counted as a budget refusal") {
+                REQUIRE(!limited.reserve(250));
+                REQUIRE(limited.used() == 400);
+                REQUIRE(budget.refusals() == 0);
+            }
+            THEN("A reservation exceeding the budget is refused and counted") {
+                REQUIRE(!unlimited.reserve(301));
+                REQUIRE(unlimited.used() == 300);
+                REQUIRE(budget.used() == 700);
+                REQUIRE(budget.refusals() == 1);
+            }
+            THEN("Released bytes can be reserved again") {
+                unlimited.release(300);
+                REQUIRE(unlimited.reserve(600));
+                REQUIRE(budget.available() == 0);
+            }
+        }
+        WHEN("Bytes are charged beyond the limits") {
+            unlimited.charge(1200);
+            THEN("They are accounted and the following reservations are refused") {
+                REQUIRE(budget.used() == 1200);
+                REQUIRE(budget.available() == 0);
+                REQUIRE(!limited.reserve(1));
+            }
+        }
+        WHEN("An account is destroyed") {
+            {
+                Budget::Account temporary(&budget);
+                REQUIRE(temporary.reserve(900));
+                REQUIRE(budget.available() == 100);
+            }
+            THEN("Its bytes are given back to the budget") { REQUIRE(budget.used() == 0); }
+        }
+    }
+    GIVEN("A budget without limit") {
+        Budget budget;
+        Budget::Account account(&budget);
+        THEN("Any reservation is accepted and accounted") {
+            REQUIRE(account.reserve(SIZE_MAX / 2));
+            REQUIRE(budget.used() == SIZE_MAX / 2);
+            REQUIRE(budget.available() == SIZE_MAX);
+        }
+    }
+}
@@ -26,4 +26,11 @@ SCENARIO("MimeTypes") {
     REQUIRE(std::string(MimeType(".ico").toString()) == "image/x-icon");
     REQUIRE(std::string(MimeType(".webp").toString()) == "image/webp");
     REQUIRE(std::string(MimeType("webp").toString()) == "image/webp");
+
+    REQUIRE(MimeType(".js").isCompressible());
+    REQUIRE(MimeType(".html").isCompressible());
+    REQUIRE(MimeType(".svg").isCompressible());
+    REQUIRE_FALSE(MimeType(".png").isCompressible());
+    REQUIRE_FALSE(MimeType(".jpg").isCompressible());
+    REQUIRE_FALSE(MimeType(".pdf").isCompressible());
 }
\ No newline at end of file
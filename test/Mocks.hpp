@@ -19,7 +19,7 @@ template<typename KnownFiles = NoNames>
 struct MockFileSystem {
     MockFileSystem(std::filesystem::path docRoot) { root = docRoot; };
     struct Data {
-        static constexpr std::array<uint64_t, 1> data{0};
+        static constexpr std::array<uint8_t, 1> data{0};
         static constexpr size_t dataSize{0};
         static constexpr std::string_view encoding{"br"};
     };
@@ -3,13 +3,19 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <random>
 #include <sstream>
+#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using namespace std;
@@ -144,6 +150,7 @@ SCENARIO("NativeDebugFS opens an existing text file using a relative path") {
         THEN("The file is opened and the content is correct") {
             checkFileRead(debugFS, "sample.txt", "This is a sample text file\nwith multiple lines\nfor testing.");
         }
+        THEN("It is streamed from disk : no contiguous content") { REQUIRE(debugFS.open("sample.txt")->contiguous().empty()); }
     }
 }
 
@@ -308,4 +315,157 @@ SCENARIO("TemporaryTestEnvironment destructor handles remove_all exception") {
     // The test passes if the warning message is present OR if nothing is written (removal succeeded)
     auto warningFound = capturedCerr.str().find("Warning: Failed to clean up test directory") != string::npos;
     REQUIRE((warningFound || capturedCerr.str().empty()));
-}
\ No newline at end of file
+}
+#if defined(__linux__)
+SCENARIO("NativeDebugFS and NativeMappedFS negotiate the precompressed siblings of their files") {
+    TemporaryTestEnvironment testEnv;
+    testEnv.createTextFile("app.js", "identity");
+    testEnv.createTextFile("app.js.gz", "GZ");
+    testEnv.createTextFile("app.js.br", "BR");
+    testEnv.createTextFile("stale.js", "identity");
+    testEnv.createTextFile("stale.js.gz", "GZ");
+    auto stalePath = testEnv.getTestDir() / "stale.js.gz";
+    filesystem::last_write_time(stalePath, filesystem::last_write_time(stalePath) - chrono::hours(1));
+    DebugFS debugFS(testEnv.getTestDir());
+    fs::NativeMappedFS mappedFS(testEnv.getTestDir());
+
+    auto read = [](optional<fs::File> file) {
+        REQUIRE(file.has_value());
+        string content;
+        array<char, 64> buffer;
+        while (auto count = file->read(buffer)) content.append(buffer.data(), count);
+        return pair{content, string(file->getEncoding())};
+    };
+    constexpr array<string_view, 3> brFirst{"br", "gzip", ""};
+    constexpr array<string_view, 2> gzipFirst{"gzip", ""};
+    constexpr array<string_view, 2> identityFirst{"", "gzip"};
+
+    THEN("The sibling of the preferred coding is opened, with its content coding") {
+        REQUIRE(read(debugFS.open("app.js", brFirst)) == pair{"BR"s, "br"s});
+        REQUIRE(read(debugFS.open("app.js", gzipFirst)) == pair{"GZ"s, "gzip"s});
+        REQUIRE(read(mappedFS.open("app.js", gzipFirst)) == pair{"GZ"s, "gzip"s});
+    }
+    THEN("The file itself is opened when identity is preferred, or when its sibling is older than it") {
+        REQUIRE(read(debugFS.open("app.js", identityFirst)) == pair{"identity"s, ""s});
+        REQUIRE(read(debugFS.open("app.js", {})) == pair{"identity"s, ""s});
+        REQUIRE(read(debugFS.open("stale.js", gzipFirst)) == pair{"identity"s, ""s});
+        REQUIRE(read(mappedFS.open("stale.js", brFirst)) == pair{"identity"s, ""s});
+    }
+    THEN("A sibling has its own entity tag") { REQUIRE(debugFS.open("app.js", gzipFirst)->eTag() != debugFS.open("app.js")->eTag()); }
+}
+
+SCENARIO("NativeDebugFS reports the changes of its files") {
+    TemporaryTestEnvironment testEnv;
+    testEnv.createTextFile("index.html", "<html></html>");
+    mutex changesMutex;
+    condition_variable changed;
+    set<string> changes;
+
+    DebugFS debugFS(testEnv.getTestDir().string()); // Destroyed first : its watcher thread no longer calls back
+    REQUIRE(debugFS.watch([&](const filesystem::path& path) {
+        scoped_lock lock(changesMutex);
+        changes.insert(path.generic_string());
+        changed.notify_all();
+    }));
+    auto waitFor = [&](const string& path) {
+        unique_lock lock(changesMutex);
+        return changed.wait_for(lock, chrono::seconds(5), [&] { return changes.contains(path); });
+    };
+
+    WHEN("A file is modified") {
+        testEnv.createTextFile("index.html", "<html><body></body></html>");
+        THEN("Its path relative to the root is reported") { REQUIRE(waitFor("index.html")); }
+    }
+
+    WHEN("A file is created in a new subdirectory") {
+        filesystem::create_directory(testEnv.getTestDir() / "js");
+        REQUIRE(waitFor("js"));
+        testEnv.createTextFile("js/app.js", "console.log('hello');");
+        THEN("The subdirectory is watched too") { REQUIRE(waitFor("js/app.js")); }
+    }
+}
+#endif
+
+#if defined(__linux__)
+SCENARIO("NativeMappedFS serves files without copying them") {
+    TemporaryTestEnvironment testEnv;
+    testEnv.createTextFile("small.html", "<html></html>");
+    testEnv.createBinaryFile("large.bin", 4096);
+    testEnv.createTextFile("empty.txt", "");
+    fs::NativeMappedFS mappedFS(testEnv.getTestDir(), 1024);
+
+    WHEN("A file smaller than the mapped size limit is opened twice") {
+        auto first = mappedFS.open("small.html");
+        auto second = mappedFS.open("small.html");
+        THEN("Both share the same read-only mapping of the file") {
+            REQUIRE(first.has_value());
+            REQUIRE(second.has_value());
+            REQUIRE(first->contiguousOwner() != nullptr);
+            REQUIRE(first->nativeDescriptor() == nullptr);
+            REQUIRE(string_view(reinterpret_cast<const char*>(first->contiguous().data()), first->contiguous().size()) == "<html></html>");
+            REQUIRE(second->contiguous().data() == first->contiguous().data());
+        }
+        AND_WHEN("The file is rewritten") {
+            testEnv.createTextFile("small.html", "<html><body></body></html>");
+            auto rewritten = mappedFS.open("small.html");
+            THEN("Its new content is mapped, the previous mapping staying valid for the files still open") {
+                REQUIRE(rewritten.has_value());
+                REQUIRE(string_view(reinterpret_cast<const char*>(rewritten->contiguous().data()), rewritten->contiguous().size()) ==
+                        "<html><body></body></html>");
+                REQUIRE(first->contiguous().size() == 13);
+            }
+        }
+    }
+
+    WHEN("A file larger than the mapped size limit is opened") {
+        auto file = mappedFS.open("large.bin");
+        THEN("It is opened to be sent by the kernel, and can still be read") {
+            REQUIRE(file.has_value());
+            REQUIRE(file->contiguous().empty());
+            REQUIRE(file->nativeDescriptor() != nullptr);
+            REQUIRE(file->nativeDescriptor()->size == 4096);
+            vector<uint8_t> content;
+            array<char, 1000> buffer;
+            while (auto count = file->read(buffer)) content.insert(content.end(), buffer.begin(), buffer.begin() + static_cast<ptrdiff_t>(count));
+            REQUIRE(file->eof());
+            REQUIRE(content == testEnv.getBinaryData("large.bin"));
+        }
+    }
+
+    WHEN("Files are opened") {
+        auto small = mappedFS.open("small.html");
+        auto large = mappedFS.open("large.bin");
+        auto streamed = DebugFS(testEnv.getTestDir()).open("small.html");
+        THEN("Their validators are derived from their modification time and size") {
+            auto writeTime = filesystem::last_write_time(testEnv.getTestDir() / "small.html");
+            auto modified = chrono::floor<chrono::seconds>(filesystem::file_time_type::clock::to_sys(writeTime));
+            REQUIRE(small->lastModified() == modified);
+            REQUIRE(streamed->lastModified() == modified);
+            REQUIRE(small->eTag().starts_with('"'));
+            REQUIRE(small->eTag().ends_with("-d\""));
+            REQUIRE(streamed->eTag() == small->eTag());
+            REQUIRE(large->eTag().ends_with("-1000\""));
+        }
+        AND_WHEN("A file is rewritten") {
+            testEnv.createTextFile("small.html", "<html><body></body></html>");
+            THEN("Its entity tag changes") { REQUIRE(mappedFS.open("small.html")->eTag() != small->eTag()); }
+        }
+    }
+
+    WHEN("An empty file is opened") {
+        auto file = mappedFS.open("empty.txt");
+        THEN("It has no content") {
+            REQUIRE(file.has_value());
+            REQUIRE(file->contiguous().empty());
+            REQUIRE(file->eof());
+        }
+    }
+
+    WHEN("A missing file or a directory is opened") {
+        THEN("No file is returned") {
+            REQUIRE_FALSE(mappedFS.open("missing.html").has_value());
+            REQUIRE_FALSE(mappedFS.open("subdir").has_value());
+        }
+    }
+}
+#endif
@@ -0,0 +1,66 @@
+#include <utils/PerfectHash.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace webfront;
+
+SCENARIO("PerfectHash") {
+    GIVEN("A hash of a few paths built at compile time") {
+        static constexpr array<string_view, 5> keys{"index.html", "favicon.ico", "WebFront.js", "js/app.js", "css/style.css"};
+        static constexpr utils::PerfectHash<keys.size()> hash{keys};
+
+        THEN("every key is found at its index") {
+            STATIC_REQUIRE(hash.find("index.html") == 0);
+            STATIC_REQUIRE(hash.find("css/style.css") == 4);
+            for (size_t index = 0; index < keys.size(); ++index) REQUIRE(hash.find(keys[index]) == index);
+        }
+        THEN("other strings are not found") {
+            STATIC_REQUIRE(hash.find("") == hash.npos);
+            REQUIRE(hash.find("index.htm") == hash.npos);
+            REQUIRE(hash.find("index.html ") == hash.npos);
+            REQUIRE(hash.find("Index.html") == hash.npos);
+            REQUIRE(hash.find("js/app.css") == hash.npos);
+        }
+    }
+
+    GIVEN("A case insensitive hash of header names") {
+        static constexpr array<string_view, 3> keys{"Content-Type", "ETag", "If-None-Match"};
+        static constexpr utils::PerfectHash<keys.size(), true> hash{keys};
+
+        THEN("the keys are found whatever their case") {
+            STATIC_REQUIRE(hash.find("content-type") == 0);
+            REQUIRE(hash.find("ETAG") == 1);
+            REQUIRE(hash.find("if-none-MATCH") == 2);
+        }
+        THEN("only letters are folded") {
+            REQUIRE(hash.find("Content\rType") == hash.npos);
+            REQUIRE(hash.find("Etag ") == hash.npos);
+        }
+    }
+
+    GIVEN("An empty hash") {
+        static constexpr utils::PerfectHash<0> hash{array<string_view, 0>{}};
+        THEN("nothing is found") { STATIC_REQUIRE(hash.find("index.html") == hash.npos); }
+    }
+
+    GIVEN("A hash of thousands of similar paths") {
+        vector<string> storage;
+        for (size_t index = 0; index < 3000; ++index) storage.push_back("assets/chunk-" + to_string(index) + ".js");
+        auto keys = make_unique<array<string_view, 3000>>();
+        for (size_t index = 0; index < storage.size(); ++index) (*keys)[index] = storage[index];
+        auto hash = make_unique<utils::PerfectHash<3000>>(*keys);
+
+        THEN("every key is found at its index, without false positive") {
+            for (size_t index = 0; index < storage.size(); ++index) REQUIRE(hash->find(storage[index]) == index);
+            REQUIRE(hash->find("assets/chunk-3000.js") == hash->npos);
+            REQUIRE(hash->find("assets/chunk-.js") == hash->npos);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include <http/Range.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace webfront::http;
+
+SCENARIO("Range header field") {
+    using Status = RangeSet::Status;
+
+    GIVEN("Ranges of a 1000 bytes file") {
+        THEN("Bounded, open and suffix ranges are resolved against its size") {
+            REQUIRE(RangeSet::parse("bytes=0-499", 1000).ranges == vector<ByteRange>{{0, 500}});
+            REQUIRE(RangeSet::parse("bytes=500-", 1000).ranges == vector<ByteRange>{{500, 500}});
+            REQUIRE(RangeSet::parse("bytes=-200", 1000).ranges == vector<ByteRange>{{800, 200}});
+            REQUIRE(RangeSet::parse("bytes=900-5000", 1000).ranges == vector<ByteRange>{{900, 100}});
+            REQUIRE(RangeSet::parse("bytes=-5000", 1000).ranges == vector<ByteRange>{{0, 1000}});
+            REQUIRE(RangeSet::parse("Bytes=0-0", 1000).status == Status::satisfiable);
+        }
+        THEN("Several ranges are kept in request order") {
+            auto rangeSet = RangeSet::parse("bytes=500-599, 0-99,, -10", 1000);
+            REQUIRE(rangeSet.status == Status::satisfiable);
+            REQUIRE(rangeSet.ranges == vector<ByteRange>{{500, 100}, {0, 100}, {990, 10}});
+        }
+        THEN("Ranges starting after the end of the file are dropped, unsatisfiable if none is left") {
+            REQUIRE(RangeSet::parse("bytes=0-9,1000-1010", 1000).ranges == vector<ByteRange>{{0, 10}});
+            REQUIRE(RangeSet::parse("bytes=1000-", 1000).status == Status::unsatisfiable);
+            REQUIRE(RangeSet::parse("bytes=-0", 1000).status == Status::unsatisfiable);
+            REQUIRE(RangeSet::parse("bytes=0-", 0).status == Status::unsatisfiable);
+        }
+        THEN("Invalid, overlapping or too many ranges are ignored") {
+            REQUIRE(RangeSet::parse("bytes=", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("items=0-10", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=10-5", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=a-5", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=-", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=5", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=+5-10", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=0-99,50-149", 1000).status == Status::ignored);
+            REQUIRE(RangeSet::parse("bytes=0-0,1-1,2-2,3-3,4-4,5-5,6-6,7-7,8-8,9-9,10-10,11-11,12-12,13-13,14-14,15-15,16-16", 1000).status ==
+                    Status::ignored);
+        }
+    }
+
+    GIVEN("A range") {
+        THEN("Its Content-Range field value gives its last byte position") { REQUIRE(ByteRange{10, 20}.contentRange(1000) == "bytes 10-29/1000"); }
+    }
+}
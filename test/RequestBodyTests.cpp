@@ -0,0 +1,135 @@
+#include <http/HTTPServer.hpp>
+#include <http/RequestBody.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace webfront::http;
+
+namespace {
+/// Decodes data split in parts of partSize bytes : @return the status, the payload and the bytes consumed
+tuple<BodyDecoder::Status, string, size_t> decodeInParts(BodyDecoder decoder, string_view data, size_t partSize,
+                                                         uint64_t sizeMax = numeric_limits<uint64_t>::max()) {
+    string payload;
+    size_t consumed = 0;
+    auto status = BodyDecoder::Status::incomplete;
+    for (size_t start = 0; start < data.size() || start == 0; start += partSize) {
+        auto [count, partStatus] = decoder.decode(data.substr(start, partSize), sizeMax, [&](string_view part) { payload += part; });
+        consumed += count;
+        status = partStatus;
+        if (status != BodyDecoder::Status::incomplete) break;
+    }
+    return {status, payload, consumed};
+}
+
+BodyDecoder::Status statusOf(BodyDecoder decoder, string_view data) { return get<0>(decodeInParts(decoder, data, data.size())); }
+
+optional<BodyDecoder> decoderOf(string input) {
+    Request request;
+    REQUIRE(request.parse(input) == Request::ParseResult::completed);
+    return request.bodyDecoder();
+}
+} // namespace
+
+SCENARIO("BodyDecoder") {
+    GIVEN("A body framed by its Content-Length, followed by a pipelined request") {
+        string_view data{"Hello WebFrontGET / HTTP/1.1\r\n\r\n"};
+        THEN("Its payload is decoded whatever the parts it is received in, the following bytes being left") {
+            for (size_t partSize : std::initializer_list<size_t>{1, 3, 14, 100}) {
+                auto [status, payload, consumed] = decodeInParts(BodyDecoder::ofLength(14), data, partSize);
+                REQUIRE(status == BodyDecoder::Status::completed);
+                REQUIRE(payload == "Hello WebFront");
+                REQUIRE(consumed == 14);
+            }
+            REQUIRE(!BodyDecoder{}.hasBody());
+            REQUIRE(!BodyDecoder::ofLength(0).hasBody());
+            REQUIRE(statusOf(BodyDecoder::ofLength(0), "") == BodyDecoder::Status::completed);
+            REQUIRE(get<0>(decodeInParts(BodyDecoder::ofLength(14), data, 100, 10)) == BodyDecoder::Status::tooLarge);
+        }
+    }
+
+    GIVEN("A chunked body with extensions and trailer fields, followed by a pipelined request") {
+        string_view data{"5\r\nHello\r\n1;name=value\r\n \r\nA\r\nWebFront !\r\n0\r\nChecksum: 12\r\n\r\nGET / HTTP/1.1\r\n\r\n"};
+        THEN("Its payload is decoded whatever the parts it is received in, the following bytes being left") {
+            for (size_t partSize : std::initializer_list<size_t>{1, 2, 7, 1000}) {
+                auto [status, payload, consumed] = decodeInParts(BodyDecoder::chunked(), data, partSize);
+                REQUIRE(status == BodyDecoder::Status::completed);
+                REQUIRE(payload == "Hello WebFront !");
+                REQUIRE(consumed == data.find("GET"));
+            }
+            REQUIRE(get<0>(decodeInParts(BodyDecoder::chunked(), data, 1, 15)) == BodyDecoder::Status::tooLarge);
+            REQUIRE(statusOf(BodyDecoder::chunked(), "0\r\n\r\n") == BodyDecoder::Status::completed);
+        }
+        THEN("Malformed framings are detected") {
+            for (auto malformed : {"x\r\n", "\r\n", "5\r\nHelloX", "5\n", "0\r\n\rX", "FFFFFFFFFFFFFFFFF\r\n"})
+                REQUIRE(statusOf(BodyDecoder::chunked(), malformed) == BodyDecoder::Status::malformed);
+        }
+    }
+
+    GIVEN("Requests with various framings") {
+        THEN("The framing of their body is determined by Transfer-Encoding then by Content-Length") {
+            REQUIRE(!decoderOf("GET / HTTP/1.1\r\n\r\n")->hasBody());
+            REQUIRE(decoderOf("POST / HTTP/1.1\r\nContent-Length: 12\r\n\r\n")->length() == 12);
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: Chunked\r\n\r\n")->length());
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: -1\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: gzip, chunked\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nContent-Length: 12\r\n\r\n"));
+        }
+        THEN("Every line of Content-Length and Transfer-Encoding counts, a proxy reading another one than the first") {
+            REQUIRE(decoderOf("POST / HTTP/1.1\r\nContent-Length: 12\r\nContent-Length: 12\r\n\r\n")->length() == 12);
+            REQUIRE(decoderOf("POST / HTTP/1.1\r\nContent-Length: 12, 12\r\n\r\n")->length() == 12);
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: 0\r\nContent-Length: 40\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: 12, 40\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: 12,\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nContent-Length: 12\r\nHost: localhost\r\nTransfer-Encoding: chunked\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nTransfer-Encoding: chunked\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nTransfer-Encoding: gzip\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: \r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nContent-Length: 12\r\nContent-Length: 12\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nContent-Length: 12\r\n\r\n"));
+            REQUIRE(!decoderOf("POST / HTTP/1.1\r\nTransfer-Encoding: , chunked\r\n\r\n")->length());
+        }
+    }
+}
+
+SCENARIO("FileSink") {
+    GIVEN("A directory receiving uploads") {
+        auto root = filesystem::temp_directory_path() / ("filesink_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+        filesystem::create_directories(root);
+        string_view content{"Hello WebFront"};
+        WHEN("An upload is committed") {
+            {
+                FileSink sink(root / "hello.txt");
+                sink.write(as_bytes(span{content}).first(5));
+                sink.write(as_bytes(span{content}).subspan(5));
+                REQUIRE(!filesystem::exists(root / "hello.txt"));
+                REQUIRE(sink.commit());
+            }
+            THEN("The file holds the whole body") {
+                ifstream file(root / "hello.txt", ios::binary);
+                REQUIRE(string(istreambuf_iterator<char>(file), {}) == content);
+                REQUIRE(!filesystem::exists(root / "hello.txt.part"));
+            }
+        }
+        WHEN("An upload is not committed") {
+            {
+                FileSink sink(root / "hello.txt");
+                sink.write(as_bytes(span{content}));
+            }
+            THEN("Nothing is left") { REQUIRE(filesystem::is_empty(root)); }
+        }
+        filesystem::remove_all(root);
+    }
+}
@@ -0,0 +1,102 @@
+#include <http/ResponseCache.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace webfront::http;
+using namespace std;
+
+namespace {
+shared_ptr<const SerializedResponse> makeResponse(string content) {
+    auto response = make_shared<SerializedResponse>();
+    response->headers = "Content-Length: " + to_string(content.size()) + "\r\n";
+    response->content = std::move(content);
+    return response;
+}
+} // namespace
+
+SCENARIO("ResponseCache") {
+    GIVEN("A cache of 200 bytes") {
+        ResponseCache cache(200);
+        auto small = makeResponse(string(60, 's'));
+        const auto entrySize = string("a.txt").size() + small->size();
+        cache.insert("a.txt", small, cache.generation());
+        cache.insert("b.txt", makeResponse(string(60, 'b')), cache.generation());
+
+        THEN("Inserted responses are found") {
+            REQUIRE(cache.find("a.txt") == small);
+            REQUIRE(cache.find("b.txt")->content == string(60, 'b'));
+            REQUIRE(!cache.find("c.txt"));
+            REQUIRE(cache.size() == 2 * entrySize);
+        }
+
+        WHEN("Inserting beyond its capacity") {
+            REQUIRE(cache.find("a.txt"));
+            cache.insert("c.txt", makeResponse(string(60, 'c')), cache.generation());
+            THEN("The least recently used response is evicted") {
+                REQUIRE(cache.find("a.txt"));
+                REQUIRE(!cache.find("b.txt"));
+                REQUIRE(cache.find("c.txt"));
+                REQUIRE(cache.size() <= 200);
+            }
+        }
+
+        WHEN("Inserting a response larger than the cache") {
+            cache.insert("big.txt", makeResponse(string(300, 'x')), cache.generation());
+            THEN("It is not cached and nothing is evicted") {
+                REQUIRE(!cache.find("big.txt"));
+                REQUIRE(cache.size() == 2 * entrySize);
+            }
+        }
+
+        WHEN("Replacing a response") {
+            cache.insert("a.txt", makeResponse("new"), cache.generation());
+            THEN("The new one is found") { REQUIRE(cache.find("a.txt")->content == "new"); }
+        }
+    }
+
+    GIVEN("A cache holding files in directories") {
+        ResponseCache cache(1000);
+        for (auto path : {"index.html", "js/app.js", "js/lib/react.js", "jsx/app.jsx"}) cache.insert(path, makeResponse(path), cache.generation());
+
+        WHEN("A file is invalidated") {
+            cache.invalidate("js/app.js");
+            THEN("Only this file is removed") {
+                REQUIRE(!cache.find("js/app.js"));
+                REQUIRE(cache.find("js/lib/react.js"));
+            }
+        }
+        WHEN("A directory is invalidated") {
+            cache.invalidate("js");
+            THEN("Everything below it is removed") {
+                REQUIRE(!cache.find("js/app.js"));
+                REQUIRE(!cache.find("js/lib/react.js"));
+                REQUIRE(cache.find("jsx/app.jsx"));
+                REQUIRE(cache.find("index.html"));
+            }
+        }
+        WHEN("A file cached in several variants is invalidated") {
+            cache.insert("style.css\nbr", makeResponse("br"), cache.generation());
+            cache.insert("style.css\ngzip", makeResponse("gzip"), cache.generation());
+            cache.insert("style.css.map\n", makeResponse("map"), cache.generation());
+            cache.invalidate("style.css");
+            THEN("All its variants are removed") {
+                REQUIRE(!cache.find("style.css\nbr"));
+                REQUIRE(!cache.find("style.css\ngzip"));
+                REQUIRE(cache.find("style.css.map\n"));
+            }
+        }
+        WHEN("An empty path is invalidated") {
+            cache.invalidate("");
+            THEN("The cache is cleared") { REQUIRE(cache.size() == 0); }
+        }
+        WHEN("A response loaded before an invalidation is inserted") {
+            auto generation = cache.generation();
+            cache.invalidate("other.txt");
+            cache.insert("late.txt", makeResponse("late"), generation);
+            THEN("It is dropped as it may be stale") { REQUIRE(!cache.find("late.txt")); }
+        }
+    }
+}
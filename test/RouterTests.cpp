@@ -0,0 +1,88 @@
+#include <http/Router.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+using namespace webfront::http;
+
+namespace {
+enum class Method { Delete, Get, Post, Undefined };
+using TestRouter = Router<Method, function<string()>>;
+
+string call(const TestRouter::Match& match) { return match.handler ? (*match.handler)() : "none"; }
+} // namespace
+
+SCENARIO("Router") {
+    GIVEN("Routes with literal segments and parameters") {
+        TestRouter router;
+        REQUIRE(router.isEmpty());
+        router.add(Method::Get, "/", [] { return "root"s; });
+        router.add(Method::Get, "/api/items", [] { return "items"s; });
+        router.add(Method::Get, "/api/items/{id}", [] { return "item"s; });
+        router.add(Method::Delete, "/api/items/{id}", [] { return "delete item"s; });
+        router.add(Method::Get, "/api/items/new", [] { return "new item"s; });
+        router.add(Method::Get, "/api/items/{id}/tags/{tag}", [] { return "tag"s; });
+
+        WHEN("Requests are matched") {
+            auto item = router.find(Method::Get, "/api/items/42?fields=name&sort&x=");
+            auto tag = router.find(Method::Get, "/api/items/42/tags/red%20ish");
+            THEN("Their handler gets the path parameters and the query string as views into the target") {
+                REQUIRE(call(router.find(Method::Get, "/")) == "root");
+                REQUIRE(call(router.find(Method::Get, "/api/items")) == "items");
+                REQUIRE(call(item) == "item");
+                REQUIRE(item.parameters.size() == 1);
+                REQUIRE(item.parameters["id"] == "42");
+                REQUIRE(!item.parameters["name"]);
+                REQUIRE(item.parameters.query() == "fields=name&sort&x=");
+                REQUIRE(item.parameters.queryValue("fields") == "name");
+                REQUIRE(item.parameters.queryValue("sort") == "");
+                REQUIRE(item.parameters.queryValue("x") == "");
+                REQUIRE(!item.parameters.queryValue("name"));
+                REQUIRE(call(tag) == "tag");
+                REQUIRE(tag.parameters["id"] == "42");
+                REQUIRE(tag.parameters["tag"] == "red%20ish");
+            }
+        }
+
+        WHEN("A literal segment and a parameter both match") {
+            auto literal = router.find(Method::Get, "/api/items/new");
+            auto parameter = router.find(Method::Delete, "/api/items/new");
+            THEN("The literal route is preferred, the parameter one serving the other methods") {
+                REQUIRE(call(literal) == "new item");
+                REQUIRE(literal.parameters.size() == 0);
+                REQUIRE(call(parameter) == "delete item");
+                REQUIRE(parameter.parameters["id"] == "new");
+            }
+        }
+
+        WHEN("Requests match no route") {
+            auto otherMethod = router.find(Method::Post, "/api/items/42");
+            THEN("No handler is found, the methods of a routed path being reported") {
+                REQUIRE(call(otherMethod) == "none");
+                REQUIRE(otherMethod.allowed.test(static_cast<size_t>(Method::Get)));
+                REQUIRE(otherMethod.allowed.test(static_cast<size_t>(Method::Delete)));
+                REQUIRE(!otherMethod.allowed.test(static_cast<size_t>(Method::Post)));
+                for (auto target : {"/api", "/api/items/", "/api/items/42/tags", "/api/items//tags/red", "/index.html", "http://host/api/items", ""}) {
+                    auto match = router.find(Method::Get, target);
+                    REQUIRE(call(match) == "none");
+                    REQUIRE(match.allowed.none());
+                }
+            }
+        }
+
+        WHEN("Malformed or duplicated routes are added") {
+            THEN("They are rejected") {
+                REQUIRE_THROWS_AS(router.add(Method::Get, "api", [] { return ""s; }), invalid_argument);
+                REQUIRE_THROWS_AS(router.add(Method::Get, "/api/items/{id}", [] { return ""s; }), invalid_argument);
+                REQUIRE_THROWS_AS(router.add(Method::Get, "/api/items/{name}/x", [] { return ""s; }), invalid_argument);
+                REQUIRE_THROWS_AS(router.add(Method::Get, "/api/{id", [] { return ""s; }), invalid_argument);
+                REQUIRE_THROWS_AS(router.add(Method::Undefined, "/other", [] { return ""s; }), invalid_argument);
+                REQUIRE_THROWS_AS(router.add(Method::Get, "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}", [] { return ""s; }), invalid_argument);
+            }
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#include <utils/SlabPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace webfront;
+
+namespace {
+
+struct Pooled {
+    explicit Pooled(int& constructionsCount) { ++constructionsCount; }
+    void recycle() {
+        ++recycledCount;
+        text.clear(); // Keeps its capacity
+    }
+    string text;
+    int recycledCount{0};
+};
+
+} // namespace
+
+SCENARIO("SlabPool") {
+    GIVEN("A pool of slabs of 4 objects") {
+        utils::SlabPool<Pooled, 4> pool;
+        int constructions = 0;
+
+        WHEN("An object is released") {
+            auto first = pool.acquire(constructions);
+            first->text.assign(100, 'x');
+            auto address = first.get();
+            auto capacity = first->text.capacity();
+            first.reset();
+            THEN("It is recycled instead of being destroyed, and handed out again with the memory it holds") {
+                REQUIRE(pool.available() == 1);
+                auto second = pool.acquire(constructions);
+                REQUIRE(second.get() == address);
+                REQUIRE(second->recycledCount == 1);
+                REQUIRE(second->text.empty());
+                REQUIRE(second->text.capacity() == capacity);
+                REQUIRE(constructions == 1);
+                REQUIRE(pool.size() == 1);
+            }
+        }
+
+        WHEN("More objects than a slab holds are in use") {
+            vector<shared_ptr<Pooled>> objects;
+            for (int index = 0; index < 6; ++index) objects.push_back(pool.acquire(constructions));
+            THEN("A slab is added, and the objects are distinct") {
+                REQUIRE(pool.size() == 6);
+                set<Pooled*> addresses;
+                for (auto& object : objects) addresses.insert(object.get());
+                REQUIRE(addresses.size() == 6);
+                objects.clear();
+                REQUIRE(pool.available() == 6);
+            }
+        }
+
+        WHEN("Objects are acquired and released by concurrent threads") {
+            {
+                vector<jthread> threads;
+                for (int thread = 0; thread < 4; ++thread)
+                    threads.emplace_back([&pool] {
+                        int count = 0;
+                        for (int index = 0; index < 10000; ++index) {
+                            auto object = pool.acquire(count);
+                            object->text = "used";
+                        }
+                    });
+            }
+            THEN("The pool never holds more objects than the peak count in use") {
+                REQUIRE(pool.size() <= 4);
+                REQUIRE(pool.available() == pool.size());
+            }
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include <utils/TimingWheel.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono_literals;
+using namespace webfront;
+using Wheel = utils::TimingWheel;
+
+SCENARIO("TimingWheel") {
+    GIVEN("A wheel of 8 slots ticking every 10ms") {
+        Wheel wheel(10ms, 8);
+        auto start = Wheel::Clock::now();
+        vector<int> expired;
+        Wheel::Timer first(wheel, [&] { expired.push_back(1); }), second(wheel, [&] { expired.push_back(2); });
+
+        WHEN("Timers are armed within a turn of the wheel") {
+            first.expiresAfter(30ms);
+            second.expiresAfter(15ms);
+            THEN("They expire in the order of their deadlines, at the tick following them") {
+                REQUIRE(first.armed());
+                wheel.advance(start + 10ms);
+                REQUIRE(expired.empty());
+                wheel.advance(start + 20ms);
+                REQUIRE(expired == vector{2});
+                wheel.advance(start + 40ms);
+                REQUIRE(expired == vector{2, 1});
+                REQUIRE(!first.armed());
+            }
+        }
+
+        WHEN("A timer is armed beyond a turn of the wheel") {
+            first.expiresAfter(250ms);
+            THEN("It waits the turns of the wheel in its slot") {
+                wheel.advance(start + 240ms);
+                REQUIRE(expired.empty());
+                wheel.advance(start + 250ms);
+                REQUIRE(expired == vector{1});
+            }
+        }
+
+        WHEN("Timers are re-armed or cancelled before their deadline") {
+            first.expiresAfter(20ms);
+            second.expiresAfter(20ms);
+            wheel.advance(start + 10ms);
+            first.expiresAfter(50ms);
+            second.cancel();
+            THEN("Only the last deadline of the armed ones expires") {
+                wheel.advance(start + 50ms);
+                REQUIRE(expired.empty());
+                wheel.advance(start + 60ms);
+                REQUIRE(expired == vector{1});
+            }
+        }
+
+        WHEN("A timer re-arms itself and destroys another one from its expiry function") {
+            auto other = make_unique<Wheel::Timer>(wheel, [&] { expired.push_back(3); });
+            first.onExpiry([&] {
+                expired.push_back(1);
+                other.reset();
+                if (expired.size() < 3) first.expiresAfter(80ms);
+            });
+            first.expiresAfter(10ms);
+            other->expiresAfter(10ms);
+            THEN("The wheel keeps its timers consistent") {
+                wheel.advance(start + 10ms);
+                REQUIRE(expired == vector{1});
+                wheel.advance(start + 90ms);
+                REQUIRE(expired == vector{1, 1});
+                wheel.advance(start + 170ms);
+                REQUIRE(expired == vector{1, 1, 1});
+                wheel.advance(start + 500ms);
+                REQUIRE(expired.size() == 3);
+            }
+        }
+    }
+
+    GIVEN("Many timers armed on a wheel") {
+        Wheel wheel(1ms, 512);
+        auto start = Wheel::Clock::now();
+        size_t expiredCount = 0;
+        vector<unique_ptr<Wheel::Timer>> timers;
+        for (int index = 0; index < 100000; ++index) {
+            timers.push_back(make_unique<Wheel::Timer>(wheel, [&] { ++expiredCount; }));
+            timers.back()->expiresAfter(chrono::milliseconds(1 + index % 1000));
+        }
+        THEN("Each tick expires the timers of its deadline only") {
+            wheel.advance(start + 1ms);
+            REQUIRE(expiredCount == 100);
+            wheel.advance(start + 1000ms);
+            REQUIRE(expiredCount == 100000);
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#include <utils/TokenBucket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+using namespace std;
+using namespace std::chrono_literals;
+using namespace webfront;
+using Bucket = utils::TokenBucket;
+
+SCENARIO("TokenBucket") {
+    GIVEN("A bucket of 3 tokens refilled with 10 tokens per second") {
+        auto start = Bucket::Clock::now();
+        Bucket bucket(10, 3, start);
+
+        WHEN("Events come at once") {
+            THEN("The burst is admitted, the following ones are refused") {
+                REQUIRE(bucket.take(start));
+                REQUIRE(bucket.take(start));
+                REQUIRE(bucket.take(start));
+                REQUIRE(!bucket.take(start));
+            }
+        }
+
+        WHEN("The bucket has been emptied") {
+            while (bucket.take(start)) {}
+            THEN("It admits an event every 1/rate") {
+                REQUIRE(!bucket.take(start + 50ms));
+                REQUIRE(bucket.take(start + 100ms));
+                REQUIRE(!bucket.take(start + 150ms));
+                REQUIRE(bucket.take(start + 200ms));
+            }
+            THEN("It is refilled up to its capacity") {
+                REQUIRE(bucket.available(start + 10s) == 3);
+                REQUIRE(bucket.lastUse() == start + 10s);
+            }
+        }
+    }
+}
@@ -1,9 +1,12 @@
 #include <http/WebSocket.hpp>
 #include <networking/NetworkingMock.hpp>
+#include <weblink/WebLink.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <optional>
+#include <vector>
 
 using namespace webfront;
 using namespace std;
@@ -130,4 +133,150 @@ SCENARIO("WebSocket decoder") {
             }
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO("WebSocket decoder limits") {
+    GIVEN("A decoder accounting its payloads on an account of 1 MiB") {
+        utils::MemoryBudget budget;
+        utils::MemoryBudget::Account account(&budget, 1024 * 1024);
+        websocket::FrameDecoder decoder(&account);
+        auto headerOf = [](uint64_t payloadSize) {
+            array<std::byte, 14> header{std::byte{0x82}, std::byte{0b10000000 | 127}};
+            for (size_t index = 0; index < 8; ++index) header[2 + index] = std::byte(payloadSize >> (8 * (7 - index)));
+            return header;
+        };
+
+        WHEN("A frame announces a 64-bit payload size") {
+            auto header = headerOf(0x7FFF'FFFF'FFFF'FFFFull);
+            THEN("It is refused before any allocation") {
+                REQUIRE(!decoder.parse(header));
+                REQUIRE(decoder.refused());
+                REQUIRE(account.used() == 0);
+            }
+        }
+        WHEN("A frame exceeds the memory of the account") {
+            auto header = headerOf(2 * 1024 * 1024);
+            THEN("It is refused") {
+                REQUIRE(!decoder.parse(header));
+                REQUIRE(decoder.refused());
+                REQUIRE(budget.used() == 0);
+            }
+        }
+        WHEN("A frame within the limits is received") {
+            auto header = headerOf(512 * 1024);
+            REQUIRE(!decoder.parse(header));
+            THEN("Its payload is reserved until the decoder is reset") {
+                REQUIRE(!decoder.refused());
+                REQUIRE(account.used() == 512 * 1024);
+                REQUIRE(budget.used() == 512 * 1024);
+                decoder.reset();
+                REQUIRE(account.used() == 0);
+                REQUIRE(budget.used() == 0);
+            }
+        }
+    }
+    GIVEN("A decoder limited to messages of 1 KiB") {
+        websocket::FrameDecoder decoder(nullptr, 1024);
+        array<std::byte, 14> header{std::byte{0x82}, std::byte{0b10000000 | 126}, std::byte{0x08}, std::byte{0x00}};
+        THEN("A frame of 2 KiB is refused") {
+            REQUIRE(!decoder.parse(header));
+            REQUIRE(decoder.refused());
+        }
+    }
+}
+
+SCENARIO("WebSocket pending writes limits") {
+    GIVEN("A WebSocket whose memory is limited to its reception buffer and 1 KiB") {
+        utils::MemoryBudget budget;
+        networking::SocketMock socket;
+        websocket::WebSocket<Net> webSocket(socket, nullptr, {}, {.budget = &budget, .memoryMax = 8192 + 1024});
+        REQUIRE(budget.used() == 8192);
+
+        THEN("A small message is written and its memory released once sent") {
+            REQUIRE(webSocket.write("Hello WebSocket"));
+            REQUIRE(webSocket.memory().used() == 8192);
+        }
+        THEN("A message exceeding the limit is refused") {
+            vector<std::byte> large(2048);
+            REQUIRE(!webSocket.write(span<const std::byte>(large)));
+            REQUIRE(webSocket.memory().used() == 8192);
+        }
+    }
+}
+
+SCENARIO("WebLink closed over its limits") {
+    GIVEN("A link whose memory is limited to its reception buffer and 1 KiB") {
+        utils::MemoryBudget budget;
+        utils::MemoryBudget::Account server(&budget);
+        server.charge(4096);
+        auto earlierUsage = budget.used();
+        vector<WebLinkEvent::Code> events;
+        optional<WebLink<Net>> link;
+        link.emplace(networking::SocketMock{}, WebLinkId{1}, [&events](WebLinkEvent event) { events.push_back(event.code); }, nullptr,
+                     std::chrono::milliseconds{}, websocket::Limits{.budget = &budget, .memoryMax = 8192 + 1024});
+        REQUIRE(budget.used() == earlierUsage + 8192);
+
+        WHEN("A message exceeding its limit is sent") {
+            vector<std::byte> large(2048);
+            REQUIRE(!link->sendFrame(websocket::Frame<Net>(span<const std::byte>(large))));
+            THEN("The link reports being closed once, and its memory is released when it is erased") {
+                REQUIRE(events == vector{WebLinkEvent::Code::closed});
+                REQUIRE(!link->sendFrame(websocket::Frame<Net>(span<const std::byte>(large))));
+                REQUIRE(events.size() == 1);
+                link.reset();
+                REQUIRE(budget.used() == earlierUsage);
+            }
+        }
+    }
+}
+
+SCENARIO("WebLink closed by its keep-alive") {
+    GIVEN("A link pinging its peer after 1s of silence") {
+        utils::MemoryBudget budget;
+        utils::TimingWheel wheel(std::chrono::milliseconds(100));
+        auto start = utils::TimingWheel::Clock::now();
+        vector<WebLinkEvent::Code> events;
+        optional<WebLink<Net>> link;
+        link.emplace(networking::SocketMock{}, WebLinkId{1}, [&events](WebLinkEvent event) { events.push_back(event.code); }, &wheel,
+                     std::chrono::seconds(1), websocket::Limits{.budget = &budget});
+
+        WHEN("Its peer stays silent for one interval") {
+            wheel.advance(start + std::chrono::milliseconds(1500));
+            THEN("It is pinged and the link stays open") { REQUIRE(events.empty()); }
+        }
+        WHEN("Its peer stays silent for two intervals") {
+            wheel.advance(start + std::chrono::milliseconds(1500));
+            wheel.advance(start + std::chrono::milliseconds(2500));
+            THEN("The link reports being closed and its memory is released when it is erased") {
+                REQUIRE(events == vector{WebLinkEvent::Code::closed});
+                link.reset();
+                REQUIRE(budget.used() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("WebSocket socket profiles") {
+    GIVEN("A WebSocket whose messages are sent with the low latency profile") {
+        networking::SocketMock socket;
+        websocket::WebSocket<Net> webSocket(socket, nullptr, {}, {}, networking::SocketProfile::lowLatency);
+        Net::tuned = {};
+
+        WHEN("A message is written without a profile of its own") {
+            REQUIRE(webSocket.write("UI update"));
+            THEN("The socket is tuned with the profile of the WebSocket") {
+                REQUIRE(Net::tuned == networking::SocketTuning::of(networking::SocketProfile::lowLatency));
+            }
+        }
+        WHEN("A bulk message is written with the throughput profile, then an interactive one") {
+            vector<std::byte> bulk(1024);
+            REQUIRE(webSocket.write(span<const std::byte>(bulk), networking::SocketProfile::throughput));
+            auto bulkTuning = Net::tuned;
+            REQUIRE(webSocket.write("UI update"));
+            THEN("The socket switches to each profile before its message") {
+                REQUIRE(bulkTuning == networking::SocketTuning::of(networking::SocketProfile::throughput));
+                REQUIRE(!bulkTuning.noDelay);
+                REQUIRE(Net::tuned.noDelay);
+            }
+        }
+    }
+}
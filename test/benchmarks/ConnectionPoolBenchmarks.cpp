@@ -0,0 +1,106 @@
+#include <http/HTTPServer.hpp>
+#include <networking/TCPNetworkingTS.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <new>
+#include <optional>
+#include <string>
+#include <thread>
+
+using namespace webfront;
+using namespace webfront::http;
+using namespace std;
+using Net = networking::TCPNetworkingTS;
+
+namespace {
+
+/// Allocations made by the calling thread, counted by the replacement of operator new below (for the whole benchmarks executable)
+thread_local size_t allocationsCount = 0;
+
+} // namespace
+
+void* operator new(size_t size) {
+    ++allocationsCount;
+    if (auto memory = malloc(size == 0 ? 1 : size)) return memory;
+    throw bad_alloc();
+}
+void operator delete(void* memory) noexcept { free(memory); }
+void operator delete(void* memory, size_t) noexcept { free(memory); }
+
+namespace {
+
+/// Serves a single 'hello.txt' file containing "Hello WebFront"
+struct HelloFS {
+    HelloFS(filesystem::path) {}
+
+    struct Hello {
+        static constexpr size_t dataSize{14};
+        static constexpr array<uint8_t, 14> data{'H', 'e', 'l', 'l', 'o', ' ', 'W', 'e', 'b', 'F', 'r', 'o', 'n', 't'};
+    };
+
+    optional<fs::File> open(filesystem::path file) {
+        if (file.relative_path().string() == "hello.txt") return fs::File{Hello{}};
+        return {};
+    }
+};
+
+/// Sends a request for hello.txt on socket : @return its response
+string get(Net::Socket& socket, string_view request) {
+    Net::Write(socket, Net::Buffer(request));
+    array<char, 512> buffer;
+    string response;
+    while (!response.ends_with("Hello WebFront")) response.append(buffer.data(), socket.read_some(Net::Buffer(buffer)));
+    return response;
+}
+
+/// Opens a connection and sends one request closing it : @return its response
+string connectAndGet(const string& port) {
+    Net::IoContext ioContext;
+    Net::Socket socket(ioContext);
+    Net::Resolver resolver(ioContext);
+    socket.connect(*resolver.resolve("127.0.0.1", port).begin());
+    return get(socket, "GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n");
+}
+
+} // namespace
+
+TEST_CASE("Connection pool benchmarks", "[!benchmark]") {
+    constexpr size_t connectionsCount = 1000, requestsCount = 1000;
+    Server<Net, HelloFS> server("127.0.0.1", "0", ".", {.keepAliveMaxRequests = numeric_limits<size_t>::max()});
+    jthread runner([&server] { server.run(); });
+    auto port = to_string(server.port());
+    auto serverAllocations = [&server] { // Of the thread running the server
+        promise<size_t> count;
+        server.post(0, [&count] { count.set_value(allocationsCount); });
+        return count.get_future().get();
+    };
+    for (size_t index = 0; index < 16; ++index) REQUIRE(connectAndGet(port).starts_with("HTTP/1.1 200 OK")); // Fills the pool
+
+    auto before = serverAllocations();
+    for (size_t index = 0; index < connectionsCount; ++index) connectAndGet(port);
+    WARN("Server allocations per request, one connection each : " << static_cast<double>(serverAllocations() - before) / connectionsCount);
+    BENCHMARK("Connection churn - one request per connection") { return connectAndGet(port); };
+
+    Net::IoContext ioContext;
+    Net::Socket socket(ioContext);
+    Net::Resolver resolver(ioContext);
+    constexpr string_view keepAliveRequest{"GET /hello.txt HTTP/1.1\r\nHost: localhost\r\n\r\n"};
+    socket.connect(*resolver.resolve("127.0.0.1", port).begin());
+    get(socket, keepAliveRequest);
+    before = serverAllocations();
+    for (size_t index = 0; index < requestsCount; ++index) get(socket, keepAliveRequest);
+    WARN("Server allocations per request on a persistent connection : " << static_cast<double>(serverAllocations() - before) / requestsCount);
+    BENCHMARK("Persistent connection - one request") { return get(socket, keepAliveRequest); };
+
+    socket.close();
+    server.stop();
+}
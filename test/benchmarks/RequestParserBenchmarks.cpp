@@ -0,0 +1,155 @@
+#include <http/HTTPServer.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace webfront;
+using namespace webfront::http;
+using namespace std;
+
+namespace {
+
+/// Byte per byte state machine parser used by HTTPServer before the in place parser : kept as the benchmark reference.
+struct LegacyRequest : Headers {
+    string methodName;
+    string uri;
+    int httpVersionMajor{};
+    int httpVersionMinor{};
+
+    struct BadRequestException : runtime_error {
+        BadRequestException() : runtime_error("Bad HTTP request") {}
+    };
+
+    template<typename InputIterator>
+    bool parseSomeData(InputIterator begin, InputIterator end) {
+        while (begin != end)
+            if (completeRequest(*begin++)) break;
+        return state == State::completed;
+    }
+
+private: // clang-format off
+    enum class State { methodStart, method, URI, versionH, versionT1, versionT2, versionP, versionSlash, versionMajorStart, versionMajor, versionMinorStart,
+                 versionMinor, newline1, headerLineStart, headerLws, headerName, spaceBeforeHeaderValue, headerValue, newline2, newline3, completed };
+    State state { State::methodStart };
+    bool completeRequest(char input) {
+        auto isChar = [](char c) { return c >= 0; };
+        auto isCtrl = [](char c) { return (c >= 0 && c <= 31) || (c == 127); };
+        auto isSpecial = [](char c) {   switch (c) {
+            case '(': case ')': case '<': case '>': case '@': case ',': case ';': case ':': case '\\': case '"':
+            case '/': case '[': case ']': case '?': case '=': case '{': case '}': case ' ': case '\t': return true;
+            default: return false;
+        }};
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        auto setState = [this](bool cond, State next) {
+            state = next;
+            if (cond) throw BadRequestException();
+        };
+
+        using enum State;
+        switch (state) {
+            case methodStart: setState(!isChar(input) || isCtrl(input) || isSpecial(input), State::method); methodName = input; break;
+            case State::method: if (input == ' ') state = URI;
+                              else if (!isChar(input) || isCtrl(input) || isSpecial(input)) throw BadRequestException();
+                              else methodName.push_back(input);
+                break;
+            case URI: if (input == ' ') { state = versionH; break; }
+                           else if (isCtrl(input)) throw BadRequestException();
+                           else { uri.push_back(input); break; }
+            case versionH: setState(input != 'H', versionT1); break;
+            case versionT1: setState(input != 'T', versionT2); break;
+            case versionT2: setState(input != 'T', versionP); break;
+            case versionP: setState(input != 'P', versionSlash); break;
+            case versionSlash: setState(input != '/', versionMajorStart); httpVersionMajor = 0; httpVersionMinor = 0; break;
+            case versionMajorStart: setState(!isDigit(input), versionMajor); httpVersionMajor = httpVersionMajor * 10 + input - '0'; break;
+            case versionMajor: if (input == '.') state = versionMinorStart;
+                                    else if (isDigit(input)) httpVersionMajor = httpVersionMajor * 10 + input - '0';
+                                    else throw BadRequestException();
+                break;
+            case versionMinorStart: setState(!isDigit(input), versionMinor); httpVersionMinor = httpVersionMinor * 10 + input - '0'; break;
+            case versionMinor: if (input == '\r') state = newline1;
+                                    else if (isDigit(input)) httpVersionMinor = httpVersionMinor * 10 + input - '0';
+                                    else throw BadRequestException();
+                break;
+            case newline1: setState(input != '\n', headerLineStart); break;
+            case headerLineStart: if (input == '\r') { state = newline3; break; }
+                                       else if (!headers.empty() && (input == ' ' || input == '\t')) { state = headerLws; break; }
+                                       else if (!isChar(input) || isCtrl(input) || isSpecial(input)) throw BadRequestException();
+                                       else { headers.push_back({}); headers.back().name.push_back(input); state = headerName; break; }
+            case headerLws:if (input == '\r') { state = newline2; break; }
+                                 else if (input == ' ' || input == '\t') break;
+                                 else if (isCtrl(input)) throw BadRequestException();
+                                 else { state = headerValue; headers.back().value.push_back(input); break; }
+            case headerName: if (input == ':') { state = spaceBeforeHeaderValue; break; }
+                                  else if (!isChar(input) || isCtrl(input) || isSpecial(input)) throw BadRequestException();
+                                  else { headers.back().name.push_back(input); break; }
+            case spaceBeforeHeaderValue: setState(input != ' ', headerValue); break;
+            case headerValue: if (input == '\r') { state = newline2; break; }
+                                   else if (isCtrl(input)) throw BadRequestException();
+                                   else { headers.back().value.push_back(input); break; }
+            case newline2: setState(input != '\n', headerLineStart); break;
+            case newline3: if (input == '\n') { state = completed; return true; } else throw BadRequestException();
+            case completed: return true;
+            default: throw BadRequestException();
+        }
+        return false;
+    }
+}; // clang-format on
+
+constexpr string_view browserRequest{
+  "GET /static/js/main.3f2a9c1b.chunk.js?version=20221104 HTTP/1.1\r\n"
+  "Host: localhost:8080\r\n"
+  "Connection: keep-alive\r\n"
+  "sec-ch-ua: \"Chromium\";v=\"106\", \"Google Chrome\";v=\"106\", \"Not;A=Brand\";v=\"99\"\r\n"
+  "sec-ch-ua-mobile: ?0\r\n"
+  "User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/106.0.0.0 Safari/537.36\r\n"
+  "sec-ch-ua-platform: \"Windows\"\r\n"
+  "Accept: */*\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Sec-Fetch-Mode: no-cors\r\n"
+  "Sec-Fetch-Dest: script\r\n"
+  "Referer: http://localhost:8080/\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: fr-FR,fr;q=0.9,en-US;q=0.8,en;q=0.7\r\n"
+  "\r\n"};
+
+constexpr string_view minimalRequest{"GET / HTTP/1.1\r\nHost: localhost\r\n\r\n"};
+
+} // namespace
+
+TEST_CASE("Request parsers benchmarks", "[!benchmark]") {
+    for (auto input : {minimalRequest, browserRequest}) {
+        LegacyRequest legacy;
+        REQUIRE(legacy.parseSomeData(input.cbegin(), input.cend()));
+        Request request;
+        REQUIRE(request.parse(input) == Request::ParseResult::completed);
+        REQUIRE(request.uri == legacy.uri);
+        REQUIRE(request.headers.size() == legacy.headers.size());
+    }
+
+    BENCHMARK("Legacy parser - minimal request") {
+        LegacyRequest request;
+        return request.parseSomeData(minimalRequest.cbegin(), minimalRequest.cend());
+    };
+    BENCHMARK("In place parser - minimal request") {
+        Request request;
+        return request.parse(minimalRequest);
+    };
+    BENCHMARK("Legacy parser - browser request") {
+        LegacyRequest request;
+        return request.parseSomeData(browserRequest.cbegin(), browserRequest.cend());
+    };
+    BENCHMARK("In place parser - browser request") {
+        Request request;
+        return request.parse(browserRequest);
+    };
+
+    Request reused;
+    BENCHMARK("In place parser - browser request on a reused Request") {
+        reused.reset();
+        return reused.parse(browserRequest);
+    };
+}
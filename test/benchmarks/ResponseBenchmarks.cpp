@@ -0,0 +1,77 @@
+#include <http/HTTPServer.hpp>
+#include <networking/NetworkingMock.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace webfront;
+using namespace webfront::http;
+using namespace std;
+using Net = networking::NetworkingMock;
+
+namespace {
+
+/// Serialization used by HTTPServer before the pre-rendered status lines : kept as the benchmark reference.
+vector<Net::ConstBuffer> legacyToBuffers(const Response& response, string& statusLine) {
+    vector<Net::ConstBuffer> buffers;
+    auto reason = Response::getStatusLine(response.statusCode).substr(13);
+    statusLine = "HTTP/1.1 " + to_string(response.statusCode) + " " + string(reason);
+    buffers.push_back(Net::Buffer(statusLine));
+
+    static const char separator[] = {':', ' '};
+    static const char crlf[] = {'\r', '\n'};
+    for (auto& header : response.headers) {
+        buffers.push_back(Net::Buffer(header.name));
+        buffers.push_back(Net::Buffer(separator));
+        buffers.push_back(Net::Buffer(header.value));
+        buffers.push_back(Net::Buffer(crlf));
+    }
+    buffers.push_back(Net::Buffer(crlf));
+    if (!response.content.empty()) buffers.push_back(Net::Buffer(response.content));
+
+    return buffers;
+}
+
+/// Gathers the buffers the way writev does : the copy to the socket is part of the measured work.
+template<typename Buffers>
+size_t gather(const Buffers& buffers, array<char, 4096>& socket) {
+    size_t size = 0;
+    for (auto& buffer : buffers) {
+        memcpy(socket.data() + size, buffer.data(), buffer.size());
+        size += buffer.size();
+    }
+    return size;
+}
+
+Response fileResponse() {
+    Response response;
+    response.statusCode = Response::ok;
+    response.content = string(512, 'x');
+    response.headers.emplace_back("Content-Length", "512");
+    response.headers.emplace_back("Content-Type", "application/javascript");
+    response.headers.emplace_back("Content-Encoding", "br");
+    response.headers.emplace_back("Connection", "keep-alive");
+    return response;
+}
+
+} // namespace
+
+TEST_CASE("Response serialization benchmarks", "[!benchmark]") {
+    array<char, 4096> socket;
+    auto response = fileResponse();
+    string statusLine, headerBlock;
+    auto legacySize = gather(legacyToBuffers(response, statusLine), socket);
+    REQUIRE(gather(response.toBuffers<Net>(headerBlock), socket) == legacySize);
+
+    BENCHMARK("Legacy serialization - one buffer per header field") { return gather(legacyToBuffers(response, statusLine), socket); };
+    BENCHMARK("Header block serialization - two buffers") { return gather(response.toBuffers<Net>(headerBlock), socket); };
+
+    auto notFound = Response::getStatusResponse(Response::notFound);
+    BENCHMARK("Legacy serialization - 404 page") { return gather(legacyToBuffers(notFound, statusLine), socket); };
+    BENCHMARK("Header block serialization - 404 page") { return gather(notFound.toBuffers<Net>(headerBlock), socket); };
+}
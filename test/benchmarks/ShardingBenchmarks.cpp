@@ -0,0 +1,86 @@
+#include <http/HTTPServer.hpp>
+#include <networking/TCPNetworkingTS.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <latch>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace webfront;
+using namespace webfront::http;
+using namespace std;
+using Net = networking::TCPNetworkingTS;
+
+namespace {
+
+/// Serves a single 'hello.txt' file containing "Hello WebFront"
+struct HelloFS {
+    HelloFS(filesystem::path) {}
+
+    struct Hello {
+        static constexpr size_t dataSize{14};
+        static constexpr array<uint8_t, 14> data{'H', 'e', 'l', 'l', 'o', ' ', 'W', 'e', 'b', 'F', 'r', 'o', 'n', 't'};
+    };
+
+    optional<fs::File> open(filesystem::path file) {
+        if (file.relative_path().string() == "hello.txt") return fs::File{Hello{}};
+        return {};
+    }
+};
+
+/// Opens a connection and sends one request closing it : @return its response
+string connectAndGet(const string& port) {
+    Net::IoContext ioContext;
+    Net::Socket socket(ioContext);
+    Net::Resolver resolver(ioContext);
+    socket.connect(*resolver.resolve("127.0.0.1", port).begin());
+    Net::Write(socket, Net::Buffer(string_view("GET /hello.txt HTTP/1.1\r\nConnection: close\r\n\r\n")));
+    array<char, 512> buffer;
+    string response;
+    while (!response.ends_with("Hello WebFront")) response.append(buffer.data(), socket.read_some(Net::Buffer(buffer)));
+    return response;
+}
+
+/// Shard counts measured : 1, 2, 4... up to the cores of the machine
+vector<size_t> shardCounts() {
+    vector<size_t> counts{1};
+    for (size_t count = 2; count <= max(thread::hardware_concurrency(), 1U); count *= 2) counts.push_back(count);
+    return counts;
+}
+
+} // namespace
+
+TEST_CASE("Sharding benchmarks", "[!benchmark]") {
+    constexpr size_t connectionsCount = 256, clientsCount = 8, messagesCount = 10'000;
+
+    for (auto shards : shardCounts()) {
+        Server<Net, HelloFS> server("127.0.0.1", "0", ".", {.shardsCount = shards});
+        jthread runner([&server] { server.run(); });
+        auto port = to_string(server.port());
+        REQUIRE(connectAndGet(port).starts_with("HTTP/1.1 200 OK"));
+
+        BENCHMARK("Connection rate - " + to_string(connectionsCount) + " connections, " + to_string(shards) + " shard(s)") {
+            vector<jthread> clients;
+            for (size_t client = 0; client < clientsCount; ++client)
+                clients.emplace_back([&] {
+                    for (size_t index = 0; index < connectionsCount / clientsCount; ++index) connectAndGet(port);
+                });
+        };
+
+        BENCHMARK("Cross-shard messages - " + to_string(messagesCount) + " posts, " + to_string(shards) + " shard(s)") {
+            latch done(static_cast<ptrdiff_t>(messagesCount));
+            for (size_t index = 0; index < messagesCount; ++index) server.post(index % shards, [&done] { done.count_down(); });
+            done.wait();
+        };
+
+        server.stop();
+    }
+}
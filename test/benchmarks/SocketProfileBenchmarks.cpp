@@ -0,0 +1,86 @@
+#include <http/WebSocket.hpp>
+#include <networking/SocketTuning.hpp>
+#include <networking/TCPNetworkingTS.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace webfront;
+using namespace std;
+using Net = networking::TCPNetworkingTS;
+using networking::SocketProfile;
+
+namespace {
+
+/// Loopback connection : a WebSocket writing on the server side, run by its own thread, read by a blocking client socket
+class Loopback {
+public:
+    explicit Loopback(SocketProfile profile)
+        : acceptor(ioContext, Net::Endpoint(std::experimental::net::ip::make_address("127.0.0.1"), 0)), client(ioContext) {
+        Net::Tune(acceptor, networking::SocketTuning::of(profile));
+        client.connect(acceptor.local_endpoint());
+        Net::Tune(client, networking::SocketTuning::of(profile));
+        webSocket.emplace(acceptor.accept(), nullptr, std::chrono::milliseconds{}, websocket::Limits{}, profile);
+        runner = thread([this] { ioContext.run(); });
+    }
+    ~Loopback() {
+        ioContext.stop();
+        runner.join();
+    }
+    Loopback(const Loopback&) = delete;
+    Loopback(Loopback&&) = delete;
+    Loopback& operator=(const Loopback&) = delete;
+    Loopback& operator=(Loopback&&) = delete;
+
+    /// Writes count messages of payloadSize bytes, then waits until the client has received them all
+    void transfer(size_t count, size_t payloadSize) {
+        vector<std::byte> payload(payloadSize);
+        auto frameSize = payloadSize + (payloadSize < 126 ? 2 : payloadSize <= 0xFFFF ? 4 : 10);
+        for (size_t index = 0; index < count; ++index) webSocket->write(span<const std::byte>(payload));
+        for (size_t received = 0; received < count * frameSize;) received += client.read_some(Net::Buffer(buffer));
+    }
+
+private:
+    Net::IoContext ioContext;
+    std::experimental::net::executor_work_guard<Net::IoContext::executor_type> work{ioContext.get_executor()};
+    Net::Acceptor acceptor;
+    Net::Socket client;
+    optional<websocket::WebSocket<Net>> webSocket;
+    array<std::byte, 64 * 1024> buffer;
+    thread runner;
+};
+
+} // namespace
+
+TEST_CASE("Socket profile benchmarks", "[!benchmark]") {
+    constexpr size_t burstCount = 16, burstPayloadSize = 32, streamCount = 10'000, bulkCount = 256, bulkPayloadSize = 64 * 1024;
+
+    for (auto [profile, name] : {pair{SocketProfile::system, "system"}, pair{SocketProfile::lowLatency, "lowLatency"},
+                                 pair{SocketProfile::throughput, "throughput"}}) {
+        Loopback loopback(profile);
+        loopback.transfer(1, burstPayloadSize);
+
+        // Latency : the frames following the first one of a burst wait for its acknowledgment unless TCP_NODELAY is set. The loopback
+        // acknowledges at once : the delayed acknowledgments of a network make the gap wider.
+        BENCHMARK("Latency - burst of " + to_string(burstCount) + " UI frames of " + to_string(burstPayloadSize) + " bytes, " + name) {
+            loopback.transfer(burstCount, burstPayloadSize);
+        };
+
+        // Throughput of small messages : coalesced into segments while the previous ones are not acknowledged, unless TCP_NODELAY is set
+        BENCHMARK("Throughput - " + to_string(streamCount) + " frames of " + to_string(burstPayloadSize) + " bytes, " + name) {
+            loopback.transfer(streamCount, burstPayloadSize);
+        };
+
+        BENCHMARK("Throughput - " + to_string(bulkCount * bulkPayloadSize / (1024 * 1024)) + " MiB in frames of " + to_string(bulkPayloadSize / 1024) +
+                  " KiB, " + name) {
+            loopback.transfer(bulkCount, bulkPayloadSize);
+        };
+    }
+}
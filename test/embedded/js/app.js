@@ -0,0 +1 @@
+console.log('WebFront fixture');